@@ -42,6 +42,13 @@
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
 
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
@@ -210,6 +217,339 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/* ==================================================================== */
+/*                   Multi-threaded contour generation                  */
+/* ==================================================================== */
+/************************************************************************/
+
+// The raster is split into horizontal strips that are processed
+// independently by the marching squares algorithm. The contours of each
+// strip are collected in memory, and pieces of contours that cross strip
+// boundaries are then stitched together by the main thread, before being
+// forwarded to the final writer.
+
+namespace
+{
+
+// A contour line, or ring, emitted by the segment merger of a strip
+struct ContourFragment
+{
+    double level = 0;
+    marching_squares::LineString ls{};
+    bool closed = false;
+};
+
+// LineWriter that stores what the segment merger of a strip emits
+struct ContourFragmentCollector
+{
+    std::vector<ContourFragment> fragments{};
+
+    void addLine(double level, marching_squares::LineString &ls, bool closed)
+    {
+        fragments.emplace_back();
+        ContourFragment &fragment = fragments.back();
+        fragment.level = level;
+        fragment.ls.swap(ls);
+        fragment.closed = closed;
+    }
+};
+
+// Joins contour fragments cut at strip boundaries, and forwards complete
+// contours to the final LineWriter.
+template <typename LineWriter> class ContourFragmentStitcher
+{
+  public:
+    explicit ContourFragmentStitcher(LineWriter &writer) : writer_(writer)
+    {
+    }
+
+    ~ContourFragmentStitcher()
+    {
+        flush(marching_squares::NaN);
+    }
+
+    void add(ContourFragment &fragment)
+    {
+        auto &ls = fragment.ls;
+        if (fragment.closed)
+        {
+            writer_.addLine(fragment.level, ls, /* closed */ true);
+            return;
+        }
+
+        auto &pending = pending_[fragment.level];
+        bool merged = true;
+        while (merged && !(ls.front() == ls.back()))
+        {
+            merged = false;
+            for (auto it = pending.begin(); it != pending.end(); ++it)
+            {
+                if (merge_(ls, *it))
+                {
+                    pending.erase(it);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+
+        if (ls.front() == ls.back())
+            writer_.addLine(fragment.level, ls, /* closed */ true);
+        else
+            pending.emplace_back(std::move(ls));
+    }
+
+    // Emit pending fragments that cannot be extended any longer, that is
+    // the ones without end point on the strip boundary at ordinate seamY.
+    void flush(double seamY)
+    {
+        for (auto &levelPending : pending_)
+        {
+            auto &pending = levelPending.second;
+            auto it = pending.begin();
+            while (it != pending.end())
+            {
+                if (it->front().y != seamY && it->back().y != seamY)
+                {
+                    writer_.addLine(levelPending.first, *it,
+                                    /* closed */ false);
+                    it = pending.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    // non copyable
+    ContourFragmentStitcher(const ContourFragmentStitcher &) = delete;
+    ContourFragmentStitcher &
+    operator=(const ContourFragmentStitcher &) = delete;
+
+  private:
+    LineWriter &writer_;
+    // open fragments of each level
+    std::map<double, std::list<marching_squares::LineString>> pending_{};
+
+    // Merge other into ls if they share an end point
+    static bool merge_(marching_squares::LineString &ls,
+                       marching_squares::LineString &other)
+    {
+        if (ls.back() == other.front())
+        {
+            ls.pop_back();
+            ls.splice(ls.end(), other);
+        }
+        else if (ls.front() == other.back())
+        {
+            other.pop_back();
+            ls.splice(ls.begin(), other);
+        }
+        else if (ls.back() == other.back())
+        {
+            ls.pop_back();
+            for (auto rit = other.rbegin(); rit != other.rend(); ++rit)
+                ls.push_back(*rit);
+        }
+        else if (ls.front() == other.front())
+        {
+            ls.pop_front();
+            for (const auto &p : other)
+                ls.push_front(p);
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+};
+
+template <typename LevelGenerator> struct ContourStripJob
+{
+    size_t width = 0;
+    size_t height = 0;
+    bool hasNoData = false;
+    double noDataValue = 0;
+    bool polygonize = false;
+    LevelGenerator *levels = nullptr;
+    // Index of the first line of the strip
+    size_t startLine = 0;
+    size_t lineCount = 0;
+    // Values of line startLine - 1 (nullptr if startLine == 0), immediately
+    // followed by the lineCount lines of the strip
+    const double *previousLine = nullptr;
+    const double *lines = nullptr;
+    ContourFragmentCollector collector{};
+    std::string errorMsg{};
+};
+
+template <typename LevelGenerator> void ContourStripJobFunc(void *pData)
+{
+    using namespace marching_squares;
+
+    auto psJob = static_cast<ContourStripJob<LevelGenerator> *>(pData);
+    try
+    {
+        // The merger must be destroyed before the collected fragments are
+        // used, since it emits remaining lines in its destructor.
+        SegmentMerger<ContourFragmentCollector, LevelGenerator> merger(
+            psJob->collector, *(psJob->levels), psJob->polygonize);
+        ContourGenerator<decltype(merger), LevelGenerator> cg(
+            psJob->width, psJob->height, psJob->hasNoData,
+            psJob->noDataValue, merger, *(psJob->levels));
+        cg.setStartLine(psJob->startLine, psJob->previousLine);
+        for (size_t i = 0; i < psJob->lineCount; ++i)
+            cg.feedLine(psJob->lines + i * psJob->width);
+    }
+    catch (const std::exception &e)
+    {
+        psJob->errorMsg = e.what();
+    }
+}
+
+/************************************************************************/
+/*                        ContourGenerateMT()                           */
+/************************************************************************/
+
+template <typename LineWriter, typename LevelGenerator>
+bool ContourGenerateMT(GDALRasterBandH hBand, bool useNoData,
+                       double noDataValue, LineWriter &lineWriter,
+                       LevelGenerator &levels, bool polygonize,
+                       CPLJobQueue *poJobQueue, int nThreads,
+                       GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const size_t width = GDALGetRasterBandXSize(hBand);
+    const size_t height = GDALGetRasterBandYSize(hBand);
+
+    // Read chunks of about 64 MB, split in one strip per thread
+    const size_t nMaxChunkLines = std::max<size_t>(
+        2 * nThreads, (64 * 1024 * 1024) / (sizeof(double) * width));
+    const size_t nChunkLines = std::min(height, nMaxChunkLines);
+    const size_t nStripLines = (nChunkLines + nThreads - 1) / nThreads;
+
+    // First line of the buffer holds the last line of the previous chunk
+    std::vector<double> adfBuffer;
+    try
+    {
+        adfBuffer.resize((nChunkLines + 1) * width);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate contour line buffer");
+        return false;
+    }
+
+    ContourFragmentStitcher<LineWriter> stitcher(lineWriter);
+    std::vector<ContourStripJob<LevelGenerator>> asJobs;
+    for (size_t nChunkStart = 0; nChunkStart < height;
+         nChunkStart += nChunkLines)
+    {
+        if (pfnProgress &&
+            !pfnProgress(double(nChunkStart) / height, "Processing lines",
+                         pProgressArg))
+            return false;
+
+        const size_t nLines = std::min(nChunkLines, height - nChunkStart);
+        if (nChunkStart > 0)
+        {
+            std::copy(adfBuffer.begin() + nChunkLines * width,
+                      adfBuffer.begin() + (nChunkLines + 1) * width,
+                      adfBuffer.begin());
+        }
+        if (GDALRasterIO(hBand, GF_Read, 0, int(nChunkStart), int(width),
+                         int(nLines), &adfBuffer[width], int(width),
+                         int(nLines), GDT_Float64, 0, 0) != CE_None)
+        {
+            return false;
+        }
+
+        asJobs.clear();
+        asJobs.resize((nLines + nStripLines - 1) / nStripLines);
+        for (size_t i = 0; i < asJobs.size(); ++i)
+        {
+            auto &sJob = asJobs[i];
+            sJob.width = width;
+            sJob.height = height;
+            sJob.hasNoData = useNoData;
+            sJob.noDataValue = noDataValue;
+            sJob.polygonize = polygonize;
+            sJob.levels = &levels;
+            sJob.startLine = nChunkStart + i * nStripLines;
+            sJob.lineCount = std::min(nStripLines, nLines - i * nStripLines);
+            sJob.lines = &adfBuffer[(1 + i * nStripLines) * width];
+            sJob.previousLine =
+                sJob.startLine == 0 ? nullptr : sJob.lines - width;
+            poJobQueue->SubmitJob(ContourStripJobFunc<LevelGenerator>,
+                                  &sJob);
+        }
+        poJobQueue->WaitCompletion();
+
+        for (auto &sJob : asJobs)
+        {
+            if (!sJob.errorMsg.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         sJob.errorMsg.c_str());
+                return false;
+            }
+        }
+
+        // Stitch fragments in strip order. Once a strip has been added,
+        // only fragments ending on its bottom boundary can still be
+        // extended.
+        for (auto &sJob : asJobs)
+        {
+            for (auto &fragment : sJob.collector.fragments)
+                stitcher.add(fragment);
+            sJob.collector.fragments.clear();
+            stitcher.flush(double(sJob.startLine + sJob.lineCount) - .5);
+        }
+    }
+
+    if (pfnProgress)
+        pfnProgress(1.0, "", pProgressArg);
+    return true;
+}
+
+/************************************************************************/
+/*                         ContourGenerate()                            */
+/************************************************************************/
+
+template <typename LineWriter, typename LevelGenerator>
+bool ContourGenerate(GDALRasterBandH hBand, bool useNoData, double noDataValue,
+                     LineWriter &lineWriter, LevelGenerator &levels,
+                     bool polygonize, int nThreads,
+                     GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    if (nThreads > 1 && GDALGetRasterBandYSize(hBand) > 1)
+    {
+        CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+        auto poJobQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+        if (poJobQueue)
+        {
+            return ContourGenerateMT(hBand, useNoData, noDataValue,
+                                     lineWriter, levels, polygonize,
+                                     poJobQueue.get(), nThreads, pfnProgress,
+                                     pProgressArg);
+        }
+    }
+
+    SegmentMerger<LineWriter, LevelGenerator> writer(lineWriter, levels,
+                                                     polygonize);
+    ContourGeneratorFromRaster<decltype(writer), LevelGenerator> cg(
+        hBand, useNoData, noDataValue, writer, levels);
+    return cg.process(pfnProgress, pProgressArg);
+}
+
+}  // namespace
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -545,6 +885,14 @@ mode.
  *
  * If YES, contour polygons will be created, rather than polygon lines.
  *
+ *   NUM_THREADS=n|ALL_CPUS
+ *
+ * (GDAL >= 3.10) Number of worker threads. When greater than 1, the raster
+ * is split into horizontal strips that are contoured in parallel, and the
+ * contour pieces crossing strip boundaries are joined afterwards. The
+ * same contours are generated as with a single thread, but features may
+ * be written in a different order. Defaults to 1.
+ *
  *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
@@ -643,6 +991,14 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    int nThreads = 1;
+    opt = CSLFetchNameValue(options, "NUM_THREADS");
+    if (opt)
+    {
+        nThreads = EQUAL(opt, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(opt);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -705,32 +1061,23 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
             {
                 FixedLevelRangeIterator levels(&fixedLevels[0],
                                                fixedLevels.size(), dfMaximum);
-                SegmentMerger<RingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ true);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerate(hBand, useNoData, noDataValue, appender,
+                                     levels, /* polygonize */ true,
+                                     nThreads, pfnProgress, pProgressArg);
             }
             else if (expBase > 0.0)
             {
                 ExponentialLevelRangeIterator levels(expBase);
-                SegmentMerger<RingAppender, ExponentialLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ true);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           ExponentialLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerate(hBand, useNoData, noDataValue, appender,
+                                     levels, /* polygonize */ true,
+                                     nThreads, pfnProgress, pProgressArg);
             }
             else
             {
                 IntervalLevelRangeIterator levels(contourBase, contourInterval);
-                SegmentMerger<RingAppender, IntervalLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ true);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           IntervalLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerate(hBand, useNoData, noDataValue, appender,
+                                     levels, /* polygonize */ true,
+                                     nThreads, pfnProgress, pProgressArg);
             }
         }
         else
@@ -740,32 +1087,23 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
             {
                 FixedLevelRangeIterator levels(&fixedLevels[0],
                                                fixedLevels.size());
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerate(hBand, useNoData, noDataValue, appender,
+                                     levels, /* polygonize */ false,
+                                     nThreads, pfnProgress, pProgressArg);
             }
             else if (expBase > 0.0)
             {
                 ExponentialLevelRangeIterator levels(expBase);
-                SegmentMerger<GDALRingAppender, ExponentialLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           ExponentialLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerate(hBand, useNoData, noDataValue, appender,
+                                     levels, /* polygonize */ false,
+                                     nThreads, pfnProgress, pProgressArg);
             }
             else
             {
                 IntervalLevelRangeIterator levels(contourBase, contourInterval);
-                SegmentMerger<GDALRingAppender, IntervalLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           IntervalLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerate(hBand, useNoData, noDataValue, appender,
+                                     levels, /* polygonize */ false,
+                                     nThreads, pfnProgress, pProgressArg);
             }
         }
     }
@@ -357,6 +357,15 @@ GDALDatasetH CPL_DLL GDALViewshedGenerate(
     void *pProgressArg, GDALViewshedOutputType heightMode,
     CSLConstList papszExtraOptions);
 
+GDALDatasetH CPL_DLL GDALViewshedGenerateCumulative(
+    GDALRasterBandH hBand, const char *pszDriverName,
+    const char *pszTargetRasterName, CSLConstList papszCreationOptions,
+    int nObserverCount, const double *padfObserverX,
+    const double *padfObserverY, double dfObserverHeight,
+    double dfTargetHeight, double dfCurvCoeff, GDALViewshedMode eMode,
+    double dfMaxDistance, int nThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg, CSLConstList papszExtraOptions);
+
 bool CPL_DLL GDALIsLineOfSightVisible(
     const GDALRasterBandH, const int xA, const int yA, const double zA,
     const int xB, const int yB, const double zB, int *pnxTerrainIntersection,
@@ -206,7 +206,17 @@ bool GDALTransformIsTranslationOnPixelBoundaries(
 bool GDALTransformIsAffineNoRotation(GDALTransformerFunc pfnTransformer,
                                      void *pTransformerArg);
 
-typedef struct _CPLQuadTree CPLQuadTree;
+class CPLPackedRTree;
+
+struct GDALGeoLocGridIndex;
+
+/** Method used for the inverse transformation of geolocation arrays. */
+enum class GDALGeoLocInverseMethod
+{
+    BACKMAP,
+    QUADTREE,
+    GRID
+};
 
 typedef struct
 {
@@ -254,7 +264,10 @@ typedef struct
 
     bool bOriginIsTopLeftCorner;
     bool bGeographicSRSWithMinus180Plus180LongRange;
-    CPLQuadTree *hQuadTree;
+    CPLPackedRTree *poRTree;
+    GDALGeoLocGridIndex *poGridIndex;
+    // Number of threads used to build the inverse index.
+    int nNumThreads;
 
     char **papszGeolocationInfo;
 
@@ -357,20 +357,15 @@ static double RPCEvaluate(const double *padfTerms, const double *padfCoefs)
 #endif
 
 /************************************************************************/
-/*                         RPCTransformPoint()                          */
+/*                            RPCNormalize()                            */
 /************************************************************************/
 
-static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
-                              double dfLong, double dfLat, double dfHeight,
-                              double *pdfPixel, double *pdfLine)
+static void RPCNormalize(const GDALRPCTransformInfo *psRPCTransformInfo,
+                         double dfLong, double dfLat, double dfHeight,
+                         double &dfNormalizedLong, double &dfNormalizedLat,
+                         double &dfNormalizedHeight)
 
 {
-    double adfTermsWithMargin[20 + 1] = {};
-    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
-    double *padfTerms =
-        adfTermsWithMargin +
-        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
-
     // Avoid dateline issues.
     double diffLong = dfLong - psRPCTransformInfo->sRPC.dfLONG_OFF;
     if (diffLong < -270)
@@ -382,12 +377,10 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
         diffLong -= 360;
     }
 
-    const double dfNormalizedLong =
-        diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
-    const double dfNormalizedLat =
-        (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
-        psRPCTransformInfo->sRPC.dfLAT_SCALE;
-    const double dfNormalizedHeight =
+    dfNormalizedLong = diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
+    dfNormalizedLat = (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
+                      psRPCTransformInfo->sRPC.dfLAT_SCALE;
+    dfNormalizedHeight =
         (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
         psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
 
@@ -439,6 +432,28 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
             }
         }
     }
+}
+
+/************************************************************************/
+/*                         RPCTransformPoint()                          */
+/************************************************************************/
+
+static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+                              double dfLong, double dfLat, double dfHeight,
+                              double *pdfPixel, double *pdfLine)
+
+{
+    double adfTermsWithMargin[20 + 1] = {};
+    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
+    double *padfTerms =
+        adfTermsWithMargin +
+        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
+
+    double dfNormalizedLong = 0.0;
+    double dfNormalizedLat = 0.0;
+    double dfNormalizedHeight = 0.0;
+    RPCNormalize(psRPCTransformInfo, dfLong, dfLat, dfHeight, dfNormalizedLong,
+                 dfNormalizedLat, dfNormalizedHeight);
 
     RPCComputeTerms(dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight,
                     padfTerms);
@@ -470,6 +485,173 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
 }
 
+/************************************************************************/
+/*                         RPCTransformPoints()                         */
+/*                                                                      */
+/*      Same as RPCTransformPoint() on an array of points. With SSE2,   */
+/*      the polynomial terms of 4 points are evaluated at once, in a    */
+/*      way that gives the same results as RPCTransformPoint().         */
+/*      The output arrays may alias the input ones.                     */
+/************************************************************************/
+
+static void RPCTransformPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               int nPointCount, const double *padfLong,
+                               const double *padfLat, const double *padfHeight,
+                               double *padfPixel, double *padfLine)
+
+{
+    int i = 0;  // Used after for.
+#ifdef USE_SSE2_OPTIM
+    const double *padfCoeffs = psRPCTransformInfo->padfCoeffs;
+    const double dfOne = 1.0;
+    const auto one = XMMReg4Double::Load1ValHighAndLow(&dfOne);
+    for (; i + 3 < nPointCount; i += 4)
+    {
+        double adfNormalizedLong[4];
+        double adfNormalizedLat[4];
+        double adfNormalizedHeight[4];
+        for (int j = 0; j < 4; ++j)
+        {
+            RPCNormalize(psRPCTransformInfo, padfLong[i + j], padfLat[i + j],
+                         padfHeight[i + j], adfNormalizedLong[j],
+                         adfNormalizedLat[j], adfNormalizedHeight[j]);
+        }
+        const auto L = XMMReg4Double::Load4Val(adfNormalizedLong);
+        const auto P = XMMReg4Double::Load4Val(adfNormalizedLat);
+        const auto H = XMMReg4Double::Load4Val(adfNormalizedHeight);
+
+        // Same terms, and same order of operations, as RPCComputeTerms().
+        const XMMReg4Double aoTerms[20] = {
+            one,
+            L,
+            P,
+            H,
+            L * P,
+            L * H,
+            P * H,
+            L * L,
+            P * P,
+            H * H,
+            L * P * H,
+            L * L * L,
+            L * P * P,
+            L * H * H,
+            L * L * P,
+            P * P * P,
+            P * H * H,
+            L * L * H,
+            P * P * H,
+            H * H * H};
+
+        // RPCEvaluate4() accumulates even and odd terms separately: do the
+        // same to get bit-identical results.
+        XMMReg4Double aoSumEven[4];
+        XMMReg4Double aoSumOdd[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            aoSumEven[k] = XMMReg4Double::Zero();
+            aoSumOdd[k] = XMMReg4Double::Zero();
+        }
+        for (int iTerm = 0; iTerm < 20; iTerm += 2)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                aoSumEven[k] += aoTerms[iTerm] *
+                                XMMReg4Double::Load1ValHighAndLow(
+                                    padfCoeffs + k * 20 + iTerm);
+                aoSumOdd[k] += aoTerms[iTerm + 1] *
+                               XMMReg4Double::Load1ValHighAndLow(
+                                   padfCoeffs + k * 20 + iTerm + 1);
+            }
+        }
+        // LINE_NUM_COEFF, LINE_DEN_COEFF, SAMP_NUM_COEFF, SAMP_DEN_COEFF.
+        const auto resultY =
+            (aoSumEven[0] + aoSumOdd[0]) / (aoSumEven[1] + aoSumOdd[1]);
+        const auto resultX =
+            (aoSumEven[2] + aoSumOdd[2]) / (aoSumEven[3] + aoSumOdd[3]);
+
+        double adfResultX[4];
+        double adfResultY[4];
+        resultX.Store4Val(adfResultX);
+        resultY.Store4Val(adfResultY);
+        for (int j = 0; j < 4; ++j)
+        {
+            padfPixel[i + j] =
+                adfResultX[j] * psRPCTransformInfo->sRPC.dfSAMP_SCALE +
+                psRPCTransformInfo->sRPC.dfSAMP_OFF + 0.5;
+            padfLine[i + j] =
+                adfResultY[j] * psRPCTransformInfo->sRPC.dfLINE_SCALE +
+                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
+        }
+    }
+#endif
+    for (; i < nPointCount; ++i)
+    {
+        RPCTransformPoint(psRPCTransformInfo, padfLong[i], padfLat[i],
+                          padfHeight[i], padfPixel + i, padfLine + i);
+    }
+}
+
+/************************************************************************/
+/*                          RPCTransformBatch                           */
+/*                                                                      */
+/*      Accumulates points to forward transform in place in the         */
+/*      padfX/padfY arrays, so that they are processed by               */
+/*      RPCTransformPoints() in batches.                                */
+/************************************************************************/
+
+namespace
+{
+class RPCTransformBatch
+{
+  public:
+    static constexpr int SIZE = 64;
+
+    RPCTransformBatch(const GDALRPCTransformInfo *psTransform, double *padfX,
+                      double *padfY, int *panSuccess)
+        : m_psTransform(psTransform), m_padfX(padfX), m_padfY(padfY),
+          m_panSuccess(panSuccess)
+    {
+    }
+
+    void Add(int iPoint, double dfHeight)
+    {
+        m_anIdx[m_nCount] = iPoint;
+        m_adfLong[m_nCount] = m_padfX[iPoint];
+        m_adfLat[m_nCount] = m_padfY[iPoint];
+        m_adfHeight[m_nCount] = dfHeight;
+        if (++m_nCount == SIZE)
+            Flush();
+    }
+
+    void Flush()
+    {
+        RPCTransformPoints(m_psTransform, m_nCount, m_adfLong, m_adfLat,
+                           m_adfHeight, m_adfLong, m_adfLat);
+        for (int k = 0; k < m_nCount; ++k)
+        {
+            m_padfX[m_anIdx[k]] = m_adfLong[k];
+            m_padfY[m_anIdx[k]] = m_adfLat[k];
+            m_panSuccess[m_anIdx[k]] = TRUE;
+        }
+        m_nCount = 0;
+    }
+
+  private:
+    const GDALRPCTransformInfo *m_psTransform;
+    double *m_padfX;
+    double *m_padfY;
+    int *m_panSuccess;
+    int m_nCount = 0;
+    int m_anIdx[SIZE];
+    double m_adfLong[SIZE];
+    double m_adfLat[SIZE];
+    double m_adfHeight[SIZE];
+
+    CPL_DISALLOW_COPY_ASSIGN(RPCTransformBatch)
+};
+}  // namespace
+
 /************************************************************************/
 /*                     GDALSerializeRPCDEMResample()                    */
 /************************************************************************/
@@ -731,7 +913,7 @@ void *GDALCreateRPCTransformerV1(GDALRPCInfoV1 *psRPCInfo, int bReversed,
  * requiring CPL_DEBUG to be also set) and/or by setting RPC_INVERSE_LOG to a
  * filename that will contain the content of iterations (this last option only
  * makes sense when debugging point by point, since each time
- * RPCInverseTransformPoint() is called, the file is rewritten).
+ * RPCInverseTransformPoints() is called, the file is rewritten).
  *
  * Additional options to the transformer can be supplied in papszOptions.
  *
@@ -1120,15 +1302,49 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
 }
 
 /************************************************************************/
-/*                      RPCInverseTransformPoint()                      */
+/*                      RPCInverseTransformPoints()                     */
+/*                                                                      */
+/*      Iterative inversion of the RPC model. The points are iterated   */
+/*      in lockstep, so that the forward evaluations of each            */
+/*      iteration can be done by RPCTransformPoints() in a batch.       */
 /************************************************************************/
 
-static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
-                                     double dfPixel, double dfLine,
-                                     double dfUserHeight, double *pdfLong,
-                                     double *pdfLat)
+namespace
+{
+struct RPCInversePoint
+{
+    // Input.
+    double dfPixel = 0.0;
+    double dfLine = 0.0;
+    double dfUserHeight = 0.0;
+
+    // Current guess, and then result.
+    double dfResultX = 0.0;
+    double dfResultY = 0.0;
+
+    // Iteration state.
+    double dfPixelDeltaX = 0.0;
+    double dfPixelDeltaY = 0.0;
+    double dfLastResultX = 0.0;
+    double dfLastResultY = 0.0;
+    double dfLastPixelDeltaX = 0.0;
+    double dfLastPixelDeltaY = 0.0;
+    bool bLastPixelDeltaValid = false;
+    int nCountConsecutiveErrorBelow2 = 0;
+    bool bActive = true;
+    bool bConverged = false;
+};
+}  // namespace
+
+constexpr int RPC_INVERSE_BATCH_SIZE = 64;
+
+static void RPCInverseTransformPoints(GDALRPCTransformInfo *psTransform,
+                                      int nPointCount,
+                                      RPCInversePoint *pasPoints)
 
 {
+    CPLAssert(nPointCount <= RPC_INVERSE_BATCH_SIZE);
+
     // Memo:
     // Known to work with 40 iterations with DEM on all points (int coord and
     // +0.5,+0.5 shift) of flock1.20160216_041050_0905.tif, especially on (0,0).
@@ -1137,22 +1353,33 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
     /*      Compute an initial approximation based on linear                */
     /*      interpolation from our reference point.                         */
     /* -------------------------------------------------------------------- */
-    double dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
-                       psTransform->adfPLToLatLongGeoTransform[1] * dfPixel +
-                       psTransform->adfPLToLatLongGeoTransform[2] * dfLine;
+    for (int i = 0; i < nPointCount; i++)
+    {
+        RPCInversePoint &sPoint = pasPoints[i];
+        sPoint.dfResultX =
+            psTransform->adfPLToLatLongGeoTransform[0] +
+            psTransform->adfPLToLatLongGeoTransform[1] * sPoint.dfPixel +
+            psTransform->adfPLToLatLongGeoTransform[2] * sPoint.dfLine;
 
-    double dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
-                       psTransform->adfPLToLatLongGeoTransform[4] * dfPixel +
-                       psTransform->adfPLToLatLongGeoTransform[5] * dfLine;
+        sPoint.dfResultY =
+            psTransform->adfPLToLatLongGeoTransform[3] +
+            psTransform->adfPLToLatLongGeoTransform[4] * sPoint.dfPixel +
+            psTransform->adfPLToLatLongGeoTransform[5] * sPoint.dfLine;
 
-    if (psTransform->bRPCInverseVerbose)
-    {
-        CPLDebug("RPC", "Computing inverse transform for (pixel,line)=(%f,%f)",
-                 dfPixel, dfLine);
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC",
+                     "Computing inverse transform for (pixel,line)=(%f,%f)",
+                     sPoint.dfPixel, sPoint.dfLine);
+        }
     }
+
+    // The log file is about a single point: the caller only calls us with
+    // one point at a time when it is enabled.
     VSILFILE *fpLog = nullptr;
     if (psTransform->pszRPCInverseLog)
     {
+        CPLAssert(nPointCount == 1);
         fpLog = VSIFOpenL(
             CPLResetExtension(psTransform->pszRPCInverseLog, "csvt"), "wb");
         if (fpLog != nullptr)
@@ -1171,200 +1398,237 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
     /*      Now iterate, trying to find a closer LL location that will      */
     /*      back transform to the indicated pixel and line.                 */
     /* -------------------------------------------------------------------- */
-    double dfPixelDeltaX = 0.0;
-    double dfPixelDeltaY = 0.0;
-    double dfLastResultX = 0.0;
-    double dfLastResultY = 0.0;
-    double dfLastPixelDeltaX = 0.0;
-    double dfLastPixelDeltaY = 0.0;
-    bool bLastPixelDeltaValid = false;
     const int nMaxIterations = (psTransform->nMaxIterations > 0)
                                    ? psTransform->nMaxIterations
                                : (psTransform->poDS != nullptr) ? 20
                                                                 : 10;
-    int nCountConsecutiveErrorBelow2 = 0;
 
-    int iIter = 0;  // Used after for.
-    for (; iIter < nMaxIterations; iIter++)
-    {
-        double dfBackPixel = 0.0;
-        double dfBackLine = 0.0;
+    int anIdx[RPC_INVERSE_BATCH_SIZE];
+    double adfLong[RPC_INVERSE_BATCH_SIZE];
+    double adfLat[RPC_INVERSE_BATCH_SIZE];
+    double adfHeight[RPC_INVERSE_BATCH_SIZE];
+    double adfBackPixel[RPC_INVERSE_BATCH_SIZE];
+    double adfBackLine[RPC_INVERSE_BATCH_SIZE];
 
+    int nActive = nPointCount;
+    for (int iIter = 0; iIter < nMaxIterations && nActive > 0; iIter++)
+    {
         // Update DEMH.
-        double dfDEMH = 0.0;
-        double dfDEMPixel = 0.0;
-        double dfDEMLine = 0.0;
-        if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY,
-                                       &dfDEMH, &dfDEMPixel, &dfDEMLine))
+        int nBatch = 0;
+        for (int i = 0; i < nPointCount; i++)
         {
-            if (psTransform->poDS)
-            {
-                CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
-                         dfDEMLine);
-            }
+            RPCInversePoint &sPoint = pasPoints[i];
+            if (!sPoint.bActive)
+                continue;
 
-            // The first time, the guess might be completely out of the
-            // validity of the DEM, so pickup the "reference Z" as the
-            // first guess or the closest point of the DEM by snapping to it.
-            if (iIter == 0)
+            const double dfPixel = sPoint.dfPixel;
+            const double dfLine = sPoint.dfLine;
+            const double dfResultX = sPoint.dfResultX;
+            const double dfResultY = sPoint.dfResultY;
+            double dfDEMH = 0.0;
+            double dfDEMPixel = 0.0;
+            double dfDEMLine = 0.0;
+            if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY,
+                                           &dfDEMH, &dfDEMPixel, &dfDEMLine))
             {
-                bool bUseRefZ = true;
                 if (psTransform->poDS)
                 {
-                    if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
-                        dfDEMPixel = psTransform->poDS->GetRasterXSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
-                        dfDEMLine = psTransform->poDS->GetRasterYSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel, dfDEMLine,
-                                            &dfDEMH))
+                    CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
+                             dfDEMLine);
+                }
+
+                // The first time, the guess might be completely out of the
+                // validity of the DEM, so pickup the "reference Z" as the
+                // first guess or the closest point of the DEM by snapping to
+                // it.
+                if (iIter == 0)
+                {
+                    bool bUseRefZ = true;
+                    if (psTransform->poDS)
+                    {
+                        if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
+                            dfDEMPixel =
+                                psTransform->poDS->GetRasterXSize() - 0.5;
+                        else if (dfDEMPixel < 0)
+                            dfDEMPixel = 0.5;
+                        if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
+                            dfDEMLine =
+                                psTransform->poDS->GetRasterYSize() - 0.5;
+                        else if (dfDEMPixel < 0)
+                            dfDEMPixel = 0.5;
+                        if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel,
+                                                dfDEMLine, &dfDEMH))
+                        {
+                            bUseRefZ = false;
+                            CPLDebug("RPC",
+                                     "Iteration %d for (pixel, line) = "
+                                     "(%g, %g): "
+                                     "No elevation value at %.15g %.15g. "
+                                     "Using elevation %g at DEM (pixel, "
+                                     "line) = (%g, %g) (snapping to "
+                                     "boundaries) instead",
+                                     iIter, dfPixel, dfLine, dfResultX,
+                                     dfResultY, dfDEMH, dfDEMPixel, dfDEMLine);
+                        }
+                    }
+                    if (bUseRefZ)
                     {
-                        bUseRefZ = false;
+                        dfDEMH = psTransform->dfRefZ;
                         CPLDebug("RPC",
                                  "Iteration %d for (pixel, line) = (%g, %g): "
                                  "No elevation value at %.15g %.15g. "
-                                 "Using elevation %g at DEM (pixel, line) = "
-                                 "(%g, %g) (snapping to boundaries) instead",
+                                 "Using elevation %g of reference point "
+                                 "instead",
                                  iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                                 dfDEMH, dfDEMPixel, dfDEMLine);
+                                 dfDEMH);
                     }
                 }
-                if (bUseRefZ)
+                else
                 {
-                    dfDEMH = psTransform->dfRefZ;
                     CPLDebug("RPC",
                              "Iteration %d for (pixel, line) = (%g, %g): "
-                             "No elevation value at %.15g %.15g. "
-                             "Using elevation %g of reference point instead",
-                             iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                             dfDEMH);
+                             "No elevation value at %.15g %.15g. Erroring out",
+                             iIter, dfPixel, dfLine, dfResultX, dfResultY);
+                    sPoint.bActive = false;
+                    nActive--;
+                    continue;
                 }
             }
-            else
-            {
-                CPLDebug("RPC",
-                         "Iteration %d for (pixel, line) = (%g, %g): "
-                         "No elevation value at %.15g %.15g. Erroring out",
-                         iIter, dfPixel, dfLine, dfResultX, dfResultY);
-                if (fpLog)
-                    VSIFCloseL(fpLog);
-                return false;
-            }
-        }
 
-        RPCTransformPoint(psTransform, dfResultX, dfResultY,
-                          dfUserHeight + dfDEMH, &dfBackPixel, &dfBackLine);
+            anIdx[nBatch] = i;
+            adfLong[nBatch] = dfResultX;
+            adfLat[nBatch] = dfResultY;
+            adfHeight[nBatch] = sPoint.dfUserHeight + dfDEMH;
+            nBatch++;
+        }
 
-        dfPixelDeltaX = dfBackPixel - dfPixel;
-        dfPixelDeltaY = dfBackLine - dfLine;
+        RPCTransformPoints(psTransform, nBatch, adfLong, adfLat, adfHeight,
+                           adfBackPixel, adfBackLine);
 
-        if (psTransform->bRPCInverseVerbose)
-        {
-            CPLDebug("RPC",
-                     "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
-                     "long=%f, lat=%f, height=%f",
-                     iIter, dfPixelDeltaX, dfPixelDeltaY, dfResultX, dfResultY,
-                     dfUserHeight + dfDEMH);
-        }
-        if (fpLog != nullptr)
+        for (int iBatch = 0; iBatch < nBatch; iBatch++)
         {
-            VSIFPrintfL(fpLog,
-                        "%d,%.12f,%.12f,%f,\"POINT(%.12f %.12f)\",%f,%f\n",
-                        iIter, dfResultX, dfResultY, dfUserHeight + dfDEMH,
-                        dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
-        }
+            RPCInversePoint &sPoint = pasPoints[anIdx[iBatch]];
 
-        const double dfError =
-            std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
-        if (dfError < psTransform->dfPixErrThreshold)
-        {
-            iIter = -1;
+            const double dfPixelDeltaX = adfBackPixel[iBatch] - sPoint.dfPixel;
+            const double dfPixelDeltaY = adfBackLine[iBatch] - sPoint.dfLine;
+            sPoint.dfPixelDeltaX = dfPixelDeltaX;
+            sPoint.dfPixelDeltaY = dfPixelDeltaY;
+
+            const double dfResultX = sPoint.dfResultX;
+            const double dfResultY = sPoint.dfResultY;
             if (psTransform->bRPCInverseVerbose)
             {
-                CPLDebug("RPC", "Converged!");
+                CPLDebug("RPC",
+                         "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
+                         "long=%f, lat=%f, height=%f",
+                         iIter, dfPixelDeltaX, dfPixelDeltaY, dfResultX,
+                         dfResultY, adfHeight[iBatch]);
             }
-            break;
-        }
-        else if (psTransform->poDS != nullptr && bLastPixelDeltaValid &&
-                 dfPixelDeltaX * dfLastPixelDeltaX < 0 &&
-                 dfPixelDeltaY * dfLastPixelDeltaY < 0)
-        {
-            // When there is a DEM, if the error changes sign, we might
-            // oscillate forever, so take a mean position as a new guess.
-            if (psTransform->bRPCInverseVerbose)
+            if (fpLog != nullptr)
             {
-                CPLDebug("RPC",
-                         "Oscillation detected. "
-                         "Taking mean of 2 previous results as new guess");
+                VSIFPrintfL(fpLog,
+                            "%d,%.12f,%.12f,%f,\"POINT(%.12f %.12f)\",%f,%f\n",
+                            iIter, dfResultX, dfResultY, adfHeight[iBatch],
+                            dfResultX, dfResultY, dfPixelDeltaX,
+                            dfPixelDeltaY);
             }
-            dfResultX = (fabs(dfPixelDeltaX) * dfLastResultX +
-                         fabs(dfLastPixelDeltaX) * dfResultX) /
-                        (fabs(dfPixelDeltaX) + fabs(dfLastPixelDeltaX));
-            dfResultY = (fabs(dfPixelDeltaY) * dfLastResultY +
-                         fabs(dfLastPixelDeltaY) * dfResultY) /
-                        (fabs(dfPixelDeltaY) + fabs(dfLastPixelDeltaY));
-            bLastPixelDeltaValid = false;
-            nCountConsecutiveErrorBelow2 = 0;
-            continue;
-        }
 
-        double dfBoostFactor = 1.0;
-        if (psTransform->poDS != nullptr && nCountConsecutiveErrorBelow2 >= 5 &&
-            dfError < 2)
-        {
-            // When there is a DEM, if we remain below a given threshold
-            // (somewhat arbitrarily set to 2 pixels) for some time, apply a
-            // "boost factor" for the new guessed result, in the hope we will go
-            // out of the somewhat current stuck situation.
-            dfBoostFactor = 10;
-            if (psTransform->bRPCInverseVerbose)
+            const double dfError =
+                std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
+            if (dfError < psTransform->dfPixErrThreshold)
             {
-                CPLDebug("RPC", "Applying boost factor 10");
+                sPoint.bConverged = true;
+                sPoint.bActive = false;
+                nActive--;
+                if (psTransform->bRPCInverseVerbose)
+                {
+                    CPLDebug("RPC", "Converged!");
+                }
+                continue;
+            }
+            else if (psTransform->poDS != nullptr &&
+                     sPoint.bLastPixelDeltaValid &&
+                     dfPixelDeltaX * sPoint.dfLastPixelDeltaX < 0 &&
+                     dfPixelDeltaY * sPoint.dfLastPixelDeltaY < 0)
+            {
+                // When there is a DEM, if the error changes sign, we might
+                // oscillate forever, so take a mean position as a new guess.
+                if (psTransform->bRPCInverseVerbose)
+                {
+                    CPLDebug("RPC",
+                             "Oscillation detected. "
+                             "Taking mean of 2 previous results as new guess");
+                }
+                sPoint.dfResultX =
+                    (fabs(dfPixelDeltaX) * sPoint.dfLastResultX +
+                     fabs(sPoint.dfLastPixelDeltaX) * dfResultX) /
+                    (fabs(dfPixelDeltaX) + fabs(sPoint.dfLastPixelDeltaX));
+                sPoint.dfResultY =
+                    (fabs(dfPixelDeltaY) * sPoint.dfLastResultY +
+                     fabs(sPoint.dfLastPixelDeltaY) * dfResultY) /
+                    (fabs(dfPixelDeltaY) + fabs(sPoint.dfLastPixelDeltaY));
+                sPoint.bLastPixelDeltaValid = false;
+                sPoint.nCountConsecutiveErrorBelow2 = 0;
+                continue;
             }
-        }
 
-        if (dfError < 2)
-            nCountConsecutiveErrorBelow2++;
-        else
-            nCountConsecutiveErrorBelow2 = 0;
-
-        const double dfNewResultX =
-            dfResultX -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
-             dfBoostFactor);
-        const double dfNewResultY =
-            dfResultY -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
-             dfBoostFactor);
-
-        dfLastResultX = dfResultX;
-        dfLastResultY = dfResultY;
-        dfResultX = dfNewResultX;
-        dfResultY = dfNewResultY;
-        dfLastPixelDeltaX = dfPixelDeltaX;
-        dfLastPixelDeltaY = dfPixelDeltaY;
-        bLastPixelDeltaValid = true;
+            double dfBoostFactor = 1.0;
+            if (psTransform->poDS != nullptr &&
+                sPoint.nCountConsecutiveErrorBelow2 >= 5 && dfError < 2)
+            {
+                // When there is a DEM, if we remain below a given threshold
+                // (somewhat arbitrarily set to 2 pixels) for some time, apply
+                // a "boost factor" for the new guessed result, in the hope we
+                // will go out of the somewhat current stuck situation.
+                dfBoostFactor = 10;
+                if (psTransform->bRPCInverseVerbose)
+                {
+                    CPLDebug("RPC", "Applying boost factor 10");
+                }
+            }
+
+            if (dfError < 2)
+                sPoint.nCountConsecutiveErrorBelow2++;
+            else
+                sPoint.nCountConsecutiveErrorBelow2 = 0;
+
+            const double dfNewResultX =
+                dfResultX -
+                (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
+                 dfBoostFactor) -
+                (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
+                 dfBoostFactor);
+            const double dfNewResultY =
+                dfResultY -
+                (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
+                 dfBoostFactor) -
+                (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
+                 dfBoostFactor);
+
+            sPoint.dfLastResultX = dfResultX;
+            sPoint.dfLastResultY = dfResultY;
+            sPoint.dfResultX = dfNewResultX;
+            sPoint.dfResultY = dfNewResultY;
+            sPoint.dfLastPixelDeltaX = dfPixelDeltaX;
+            sPoint.dfLastPixelDeltaY = dfPixelDeltaY;
+            sPoint.bLastPixelDeltaValid = true;
+        }
     }
     if (fpLog != nullptr)
         VSIFCloseL(fpLog);
 
-    if (iIter != -1)
+    for (int i = 0; i < nPointCount; i++)
     {
-        CPLDebug("RPC", "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
-                 iIter, dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
-        return false;
+        RPCInversePoint &sPoint = pasPoints[i];
+        if (sPoint.bActive)
+        {
+            CPLDebug("RPC",
+                     "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
+                     nMaxIterations, sPoint.dfResultX, sPoint.dfResultY,
+                     sPoint.dfPixelDeltaX, sPoint.dfPixelDeltaY);
+            sPoint.bActive = false;
+        }
     }
-
-    *pdfLong = dfResultX;
-    *pdfLat = dfResultY;
-    return true;
 }
 
 static double BiCubicKernel(double dfVal)
@@ -1695,6 +1959,7 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
     const int nY = static_cast<int>(dfY);
     const double dfDeltaY = dfY - nY;
 
+    RPCTransformBatch oBatch(psTransform, padfX, padfY, panSuccess);
     for (int i = 0; i < nPointCount; i++)
     {
         if (padfX[i] == HUGE_VAL)
@@ -1874,13 +2139,10 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
             padfY[i] = HUGE_VAL;
             continue;
         }
-        RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                          dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                      psTransform->dfHeightScale,
-                          padfX + i, padfY + i);
-
-        panSuccess[i] = TRUE;
+        oBatch.Add(i, dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
+                                  psTransform->dfHeightScale);
     }
+    oBatch.Flush();
 
     VSIFree(padfDEMBuffer);
 
@@ -2146,6 +2408,7 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
         }
 
+        RPCTransformBatch oBatch(psTransform, padfX, padfY, panSuccess);
         for (int i = 0; i < nPointCount; i++)
         {
             if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
@@ -2165,11 +2428,9 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
                 continue;
             }
 
-            RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                              (padfZ ? padfZ[i] : 0.0) + dfHeight, padfX + i,
-                              padfY + i);
-            panSuccess[i] = TRUE;
+            oBatch.Add(i, (padfZ ? padfZ[i] : 0.0) + dfHeight);
         }
+        oBatch.Flush();
 
         return TRUE;
     }
@@ -2186,31 +2447,46 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
     /*      function uses an iterative method from an initial linear        */
     /*      approximation.                                                  */
     /* -------------------------------------------------------------------- */
-    for (int i = 0; i < nPointCount; i++)
+    // The inverse log file can only record a single point.
+    const int nBatchSize =
+        psTransform->pszRPCInverseLog ? 1 : RPC_INVERSE_BATCH_SIZE;
+    RPCInversePoint asPoints[RPC_INVERSE_BATCH_SIZE];
+    for (int iStart = 0; iStart < nPointCount; iStart += nBatchSize)
     {
-        double dfResultX = 0.0;
-        double dfResultY = 0.0;
-
-        if (!RPCInverseTransformPoint(psTransform, padfX[i], padfY[i], padfZ[i],
-                                      &dfResultX, &dfResultY))
+        const int nBatch = std::min(nBatchSize, nPointCount - iStart);
+        for (int j = 0; j < nBatch; j++)
         {
-            panSuccess[i] = FALSE;
-            padfX[i] = HUGE_VAL;
-            padfY[i] = HUGE_VAL;
-            continue;
+            asPoints[j] = RPCInversePoint();
+            asPoints[j].dfPixel = padfX[iStart + j];
+            asPoints[j].dfLine = padfY[iStart + j];
+            asPoints[j].dfUserHeight = padfZ[iStart + j];
         }
-        if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
+
+        RPCInverseTransformPoints(psTransform, nBatch, asPoints);
+
+        for (int j = 0; j < nBatch; j++)
         {
-            panSuccess[i] = FALSE;
-            padfX[i] = HUGE_VAL;
-            padfY[i] = HUGE_VAL;
-            continue;
-        }
+            const int i = iStart + j;
+            if (!asPoints[j].bConverged)
+            {
+                panSuccess[i] = FALSE;
+                padfX[i] = HUGE_VAL;
+                padfY[i] = HUGE_VAL;
+                continue;
+            }
+            if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
+            {
+                panSuccess[i] = FALSE;
+                padfX[i] = HUGE_VAL;
+                padfY[i] = HUGE_VAL;
+                continue;
+            }
 
-        padfX[i] = dfResultX;
-        padfY[i] = dfResultY;
+            padfX[i] = asPoints[j].dfResultX;
+            padfY[i] = asPoints[j].dfResultY;
 
-        panSuccess[i] = TRUE;
+            panSuccess[i] = TRUE;
+        }
     }
 
     return TRUE;
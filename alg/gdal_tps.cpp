@@ -32,6 +32,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <map>
 #include <utility>
 
@@ -62,6 +63,9 @@ struct TPSTransformInfo
     bool bReverseSolved{};
     double dfSrcApproxErrorReverse{};
 
+    // Number of threads of each linear system solve
+    int nSolveThreads = 1;
+
     bool bReversed{};
 
     std::vector<gdal::GCP> asGCPs{};
@@ -146,7 +150,8 @@ void *GDALCreateTPSTransformer(int nGCPCount, const GDAL_GCP *pasGCPList,
 static void GDALTPSComputeForwardInThread(void *pData)
 {
     TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pData);
-    psInfo->bForwardSolved = psInfo->poForward->solve() != 0;
+    psInfo->bForwardSolved =
+        psInfo->poForward->solve(psInfo->nSolveThreads) != 0;
 }
 
 void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
@@ -263,14 +268,18 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
 
     if (nThreads > 1)
     {
-        // Compute direct and reverse transforms in parallel.
+        // Compute direct and reverse transforms in parallel, and split
+        // the threads between the two linear system solves.
+        psInfo->nSolveThreads = std::max(1, nThreads / 2);
         CPLJoinableThread *hThread =
             CPLCreateJoinableThread(GDALTPSComputeForwardInThread, psInfo);
-        psInfo->bReverseSolved = psInfo->poReverse->solve() != 0;
+        psInfo->bReverseSolved =
+            psInfo->poReverse->solve(psInfo->nSolveThreads) != 0;
         if (hThread != nullptr)
             CPLJoinThread(hThread);
         else
-            psInfo->bForwardSolved = psInfo->poForward->solve() != 0;
+            psInfo->bForwardSolved =
+                psInfo->poForward->solve(nThreads) != 0;
     }
     else
     {
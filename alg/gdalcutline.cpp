@@ -230,6 +230,263 @@ static int CutlineTransformer(void *pTransformArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                       SegmentIntersectsRect()                        */
+/************************************************************************/
+
+static bool SegmentIntersectsRect(double dfX1, double dfY1, double dfX2,
+                                  double dfY2, const OGREnvelope &sRect)
+{
+    if (std::max(dfX1, dfX2) < sRect.MinX ||
+        std::min(dfX1, dfX2) > sRect.MaxX ||
+        std::max(dfY1, dfY2) < sRect.MinY || std::min(dfY1, dfY2) > sRect.MaxY)
+    {
+        return false;
+    }
+
+    // Liang-Barsky clipping of the segment against the rectangle.
+    const double dfDX = dfX2 - dfX1;
+    const double dfDY = dfY2 - dfY1;
+    const double adfP[4] = {-dfDX, dfDX, -dfDY, dfDY};
+    const double adfQ[4] = {dfX1 - sRect.MinX, sRect.MaxX - dfX1,
+                            dfY1 - sRect.MinY, sRect.MaxY - dfY1};
+    double dfT0 = 0.0;
+    double dfT1 = 1.0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (adfP[i] == 0.0)
+        {
+            if (adfQ[i] < 0.0)
+                return false;
+        }
+        else
+        {
+            const double dfT = adfQ[i] / adfP[i];
+            if (adfP[i] < 0.0)
+                dfT0 = std::max(dfT0, dfT);
+            else
+                dfT1 = std::min(dfT1, dfT);
+            if (dfT0 > dfT1)
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     CutlineBoundaryIntersects()                      */
+/*                                                                      */
+/*      Returns whether any ring of the cutline crosses or touches      */
+/*      the rectangle.                                                  */
+/************************************************************************/
+
+static bool CutlineBoundaryIntersects(const OGRGeometry *poCutline,
+                                      const OGREnvelope &sRect)
+{
+    const auto RingIntersects = [&sRect](const OGRLinearRing *poRing)
+    {
+        OGREnvelope sRingEnvelope;
+        poRing->getEnvelope(&sRingEnvelope);
+        if (!sRingEnvelope.Intersects(sRect))
+            return false;
+        const int nPoints = poRing->getNumPoints();
+        for (int i = 0; i + 1 < nPoints; ++i)
+        {
+            if (SegmentIntersectsRect(poRing->getX(i), poRing->getY(i),
+                                      poRing->getX(i + 1), poRing->getY(i + 1),
+                                      sRect))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    const auto PolygonIntersects = [&RingIntersects](const OGRPolygon *poPoly)
+    {
+        for (const auto *poRing : *poPoly)
+        {
+            if (RingIntersects(poRing))
+                return true;
+        }
+        return false;
+    };
+
+    if (wkbFlatten(poCutline->getGeometryType()) == wkbPolygon)
+        return PolygonIntersects(poCutline->toPolygon());
+    for (const auto *poPoly : *(poCutline->toMultiPolygon()))
+    {
+        if (PolygonIntersects(poPoly))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          CutlineContains()                           */
+/*                                                                      */
+/*      Even-odd point in polygon test, used when the cutline           */
+/*      boundary does not cross the chunk.                              */
+/************************************************************************/
+
+static bool CutlineContains(const OGRGeometry *poCutline, double dfX,
+                            double dfY)
+{
+    const auto PolygonContains = [dfX, dfY](const OGRPolygon *poPoly)
+    {
+        bool bInside = false;
+        for (const auto *poRing : *poPoly)
+        {
+            const int nPoints = poRing->getNumPoints();
+            for (int i = 0, j = nPoints - 1; i < nPoints; j = i++)
+            {
+                const double dfXI = poRing->getX(i);
+                const double dfYI = poRing->getY(i);
+                const double dfXJ = poRing->getX(j);
+                const double dfYJ = poRing->getY(j);
+                if ((dfYI > dfY) != (dfYJ > dfY) &&
+                    dfX < (dfXJ - dfXI) * (dfY - dfYI) / (dfYJ - dfYI) + dfXI)
+                {
+                    bInside = !bInside;
+                }
+            }
+        }
+        return bInside;
+    };
+
+    if (wkbFlatten(poCutline->getGeometryType()) == wkbPolygon)
+        return PolygonContains(poCutline->toPolygon());
+    for (const auto *poPoly : *(poCutline->toMultiPolygon()))
+    {
+        if (PolygonContains(poPoly))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          ClipRingToRect()                            */
+/*                                                                      */
+/*      Sutherland-Hodgman clipping of a ring against a rectangle.      */
+/*      The result may have degenerate edges along the rectangle        */
+/*      border, but has the same even-odd parity as the source ring     */
+/*      at any point inside the rectangle, which is all the             */
+/*      rasterizer needs.                                               */
+/************************************************************************/
+
+static std::unique_ptr<OGRLinearRing>
+ClipRingToRect(const OGRLinearRing *poRing, const OGREnvelope &sRect)
+{
+    std::vector<OGRRawPoint> aoIn;
+    std::vector<OGRRawPoint> aoOut;
+    const int nPoints = poRing->getNumPoints();
+    aoIn.reserve(nPoints);
+    for (int i = 0; i < nPoints; ++i)
+        aoIn.emplace_back(poRing->getX(i), poRing->getY(i));
+    // Work on an open ring.
+    if (aoIn.size() > 1 && aoIn.front().x == aoIn.back().x &&
+        aoIn.front().y == aoIn.back().y)
+    {
+        aoIn.pop_back();
+    }
+
+    for (int iEdge = 0; iEdge < 4 && !aoIn.empty(); ++iEdge)
+    {
+        const auto Inside = [iEdge, &sRect](const OGRRawPoint &oP)
+        {
+            switch (iEdge)
+            {
+                case 0:
+                    return oP.x >= sRect.MinX;
+                case 1:
+                    return oP.x <= sRect.MaxX;
+                case 2:
+                    return oP.y >= sRect.MinY;
+                default:
+                    return oP.y <= sRect.MaxY;
+            }
+        };
+        const auto Intersection =
+            [iEdge, &sRect](const OGRRawPoint &oA, const OGRRawPoint &oB)
+        {
+            if (iEdge < 2)
+            {
+                const double dfX = iEdge == 0 ? sRect.MinX : sRect.MaxX;
+                const double dfT = (dfX - oA.x) / (oB.x - oA.x);
+                return OGRRawPoint(dfX, oA.y + dfT * (oB.y - oA.y));
+            }
+            const double dfY = iEdge == 2 ? sRect.MinY : sRect.MaxY;
+            const double dfT = (dfY - oA.y) / (oB.y - oA.y);
+            return OGRRawPoint(oA.x + dfT * (oB.x - oA.x), dfY);
+        };
+
+        aoOut.clear();
+        const OGRRawPoint *poPrev = &aoIn.back();
+        bool bPrevInside = Inside(*poPrev);
+        for (const auto &oCur : aoIn)
+        {
+            const bool bCurInside = Inside(oCur);
+            if (bCurInside != bPrevInside)
+                aoOut.push_back(Intersection(*poPrev, oCur));
+            if (bCurInside)
+                aoOut.push_back(oCur);
+            poPrev = &oCur;
+            bPrevInside = bCurInside;
+        }
+        std::swap(aoIn, aoOut);
+    }
+
+    if (aoIn.size() < 3)
+        return nullptr;
+    aoIn.push_back(aoIn.front());
+    auto poClippedRing = std::make_unique<OGRLinearRing>();
+    poClippedRing->setPoints(static_cast<int>(aoIn.size()), aoIn.data());
+    return poClippedRing;
+}
+
+/************************************************************************/
+/*                         ClipCutlineToRect()                          */
+/*                                                                      */
+/*      Returns a (multi)polygon that rasterizes like the cutline       */
+/*      inside the rectangle, but only has the vertices relevant to     */
+/*      it. This avoids the rasterizer scanning all the edges of very   */
+/*      complex cutlines for each line of each chunk.                   */
+/************************************************************************/
+
+static std::unique_ptr<OGRMultiPolygon>
+ClipCutlineToRect(const OGRGeometry *poCutline, const OGREnvelope &sRect)
+{
+    auto poClipped = std::make_unique<OGRMultiPolygon>();
+    const auto ClipPolygon = [&sRect, &poClipped](const OGRPolygon *poPoly)
+    {
+        OGREnvelope sPolyEnvelope;
+        poPoly->getEnvelope(&sPolyEnvelope);
+        if (!sPolyEnvelope.Intersects(sRect))
+            return;
+        auto poClippedPoly = std::make_unique<OGRPolygon>();
+        for (const auto *poRing : *poPoly)
+        {
+            auto poClippedRing = ClipRingToRect(poRing, sRect);
+            if (poClippedRing)
+                poClippedPoly->addRingDirectly(poClippedRing.release());
+            else if (poClippedPoly->IsEmpty())
+                return;  // Exterior ring outside the rectangle.
+        }
+        poClipped->addGeometryDirectly(poClippedPoly.release());
+    };
+
+    if (wkbFlatten(poCutline->getGeometryType()) == wkbPolygon)
+    {
+        ClipPolygon(poCutline->toPolygon());
+    }
+    else
+    {
+        for (const auto *poPoly : *(poCutline->toMultiPolygon()))
+            ClipPolygon(poPoly);
+    }
+    return poClipped;
+}
+
 /************************************************************************/
 /*                       GDALWarpCutlineMasker()                        */
 /*                                                                      */
@@ -320,41 +577,62 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     }
 
     // And now check if the chunk to warp is fully contained within the cutline
-    // to save rasterization.
-    if (OGRGeometryFactory::haveGEOS()
+    // to save rasterization. If the cutline boundary does not cross the
+    // chunk footprint (extended by the blend distance), the chunk is either
+    // fully inside or fully outside of it.
+    const OGRGeometry *poCutline = OGRGeometry::FromHandle(hPolygon);
 #ifdef DEBUG
-        // Env var just for debugging purposes
-        && !CPLTestBool(
-               CPLGetConfigOption("GDALCUTLINE_SKIP_CONTAINMENT_TEST", "NO"))
+    // Env var just for debugging purposes
+    if (!CPLTestBool(
+            CPLGetConfigOption("GDALCUTLINE_SKIP_CONTAINMENT_TEST", "NO")))
 #endif
-    )
     {
-        OGRLinearRing *poRing = new OGRLinearRing();
-        poRing->addPoint(-psWO->dfCutlineBlendDist + nXOff,
-                         -psWO->dfCutlineBlendDist + nYOff);
-        poRing->addPoint(-psWO->dfCutlineBlendDist + nXOff,
-                         psWO->dfCutlineBlendDist + nYOff + nYSize);
-        poRing->addPoint(psWO->dfCutlineBlendDist + nXOff + nXSize,
-                         psWO->dfCutlineBlendDist + nYOff + nYSize);
-        poRing->addPoint(psWO->dfCutlineBlendDist + nXOff + nXSize,
-                         -psWO->dfCutlineBlendDist + nYOff);
-        poRing->addPoint(-psWO->dfCutlineBlendDist + nXOff,
-                         -psWO->dfCutlineBlendDist + nYOff);
-        OGRPolygon oChunkFootprint;
-        oChunkFootprint.addRingDirectly(poRing);
         OGREnvelope sChunkEnvelope;
-        oChunkFootprint.getEnvelope(&sChunkEnvelope);
-        if (sEnvelope.Contains(sChunkEnvelope) &&
-            OGRGeometry::FromHandle(hPolygon)->Contains(&oChunkFootprint))
+        sChunkEnvelope.MinX = -psWO->dfCutlineBlendDist + nXOff;
+        sChunkEnvelope.MinY = -psWO->dfCutlineBlendDist + nYOff;
+        sChunkEnvelope.MaxX = psWO->dfCutlineBlendDist + nXOff + nXSize;
+        sChunkEnvelope.MaxY = psWO->dfCutlineBlendDist + nYOff + nYSize;
+        if (!CutlineBoundaryIntersects(poCutline, sChunkEnvelope))
         {
-            if (pnValidityFlag)
-                *pnValidityFlag = GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
+            if (CutlineContains(poCutline, nXOff + 0.5 * nXSize,
+                                nYOff + 0.5 * nYSize))
+            {
+                if (pnValidityFlag)
+                    *pnValidityFlag = GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
 
-            CPLDebug("WARP", "Source chunk fully contained within cutline.");
+                CPLDebug("WARP",
+                         "Source chunk fully contained within cutline.");
+                return CE_None;
+            }
+
+            if (pnValidityFlag)
+                *pnValidityFlag = GCMVF_NO_INTERSECTION;
+            memset(pafMask, 0, sizeof(float) * nXSize * nYSize);
             return CE_None;
         }
     }
 
+    // Only keep the part of the cutline that matters for the chunk. The
+    // margin makes sure that the clipping edges, which are burnt with
+    // ALL_TOUCHED, do not touch any pixel of the chunk.
+    constexpr double CLIP_MARGIN = 2.0;
+    OGREnvelope sClipEnvelope;
+    sClipEnvelope.MinX = nXOff - CLIP_MARGIN;
+    sClipEnvelope.MinY = nYOff - CLIP_MARGIN;
+    sClipEnvelope.MaxX = nXOff + nXSize + CLIP_MARGIN;
+    sClipEnvelope.MaxY = nYOff + nYSize + CLIP_MARGIN;
+    std::unique_ptr<OGRMultiPolygon> poClippedCutline;
+    if (sEnvelope.MinX < sClipEnvelope.MinX ||
+        sEnvelope.MinY < sClipEnvelope.MinY ||
+        sEnvelope.MaxX > sClipEnvelope.MaxX ||
+        sEnvelope.MaxY > sClipEnvelope.MaxY)
+    {
+        poClippedCutline = ClipCutlineToRect(poCutline, sClipEnvelope);
+    }
+    OGRGeometryH hPolygonToBurn =
+        poClippedCutline ? OGRGeometry::ToHandle(poClippedCutline.get())
+                         : hPolygon;
+
     /* -------------------------------------------------------------------- */
     /*      Create a byte buffer into which we can burn the                 */
     /*      mask polygon and wrap it up as a memory dataset.                */
@@ -385,8 +663,8 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     int anXYOff[2] = {nXOff, nYOff};
 
     CPLErr eErr = GDALRasterizeGeometries(
-        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
-        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+        hMemDS, 1, &nTargetBand, 1, &hPolygonToBurn, CutlineTransformer,
+        anXYOff, &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
 
     CSLDestroy(papszRasterizeOptions);
 
@@ -47,7 +47,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_minixml.h"
-#include "cpl_quad_tree.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
@@ -659,12 +659,18 @@ int GDALGeoLoc<Accessors>::Transform(void *pTransformArg, int bDstToSrc,
     /* -------------------------------------------------------------------- */
     else
     {
-        if (psTransform->hQuadTree)
+        if (psTransform->poRTree)
         {
             GDALGeoLocInverseTransformQuadtree(psTransform, nPointCount, padfX,
                                                padfY, panSuccess);
             return TRUE;
         }
+        if (psTransform->poGridIndex)
+        {
+            GDALGeoLocInverseTransformGridIndex(psTransform, nPointCount,
+                                                padfX, padfY, panSuccess);
+            return TRUE;
+        }
 
         const bool bGeolocMaxAccuracy = CPLTestBool(
             CPLGetConfigOption("GDAL_GEOLOC_USE_MAX_ACCURACY", "YES"));
@@ -1993,9 +1999,23 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
 
     // The quadtree method is experimental. It simplifies the code
     // significantly, but unfortunately burns more RAM and is slower.
-    const bool bUseQuadtree =
-        EQUAL(CPLGetConfigOption("GDAL_GEOLOC_INVERSE_METHOD", "BACKMAP"),
-              "QUADTREE");
+    // The grid method is a more compact alternative to the quadtree, whose
+    // construction can be multithreaded.
+    const char *pszInverseMethod =
+        CPLGetConfigOption("GDAL_GEOLOC_INVERSE_METHOD", "BACKMAP");
+    const GDALGeoLocInverseMethod eInverseMethod =
+        EQUAL(pszInverseMethod, "QUADTREE") ? GDALGeoLocInverseMethod::QUADTREE
+        : EQUAL(pszInverseMethod, "GRID")   ? GDALGeoLocInverseMethod::GRID
+                                            : GDALGeoLocInverseMethod::BACKMAP;
+
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszTransformOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        psTransform->nNumThreads = CPLGetNumCPUs();
+    else
+        psTransform->nNumThreads = std::clamp(atoi(pszNumThreads), 1, 128);
 
     // Decide if we should C-arrays for geoloc and backmap, or on-disk
     // temporary datasets.
@@ -2021,7 +2041,7 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
     {
         auto pAccessors = new GDALGeoLocCArrayAccessors(psTransform);
         psTransform->pAccessors = pAccessors;
-        if (!pAccessors->Load(bIsRegularGrid, bUseQuadtree))
+        if (!pAccessors->Load(bIsRegularGrid, eInverseMethod))
         {
             GDALDestroyGeoLocTransformer(psTransform);
             return nullptr;
@@ -2031,7 +2051,7 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
     {
         auto pAccessors = new GDALGeoLocDatasetAccessors(psTransform);
         psTransform->pAccessors = pAccessors;
-        if (!pAccessors->Load(bIsRegularGrid, bUseQuadtree))
+        if (!pAccessors->Load(bIsRegularGrid, eInverseMethod))
         {
             GDALDestroyGeoLocTransformer(psTransform);
             return nullptr;
@@ -2081,8 +2101,10 @@ void GDALDestroyGeoLocTransformer(void *pTransformAlg)
         GDALDereferenceDataset(psTransform->hDS_Y) == 0)
         GDALClose(psTransform->hDS_Y);
 
-    if (psTransform->hQuadTree != nullptr)
-        CPLQuadTreeDestroy(psTransform->hQuadTree);
+    delete psTransform->poRTree;
+
+    if (psTransform->poGridIndex != nullptr)
+        GDALGeoLocDestroyGridIndex(psTransform->poGridIndex);
 
     CPLFree(pTransformAlg);
 }
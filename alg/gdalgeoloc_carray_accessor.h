@@ -96,7 +96,7 @@ class GDALGeoLocCArrayAccessors
     GDALGeoLocCArrayAccessors &
     operator=(const GDALGeoLocCArrayAccessors &) = delete;
 
-    bool Load(bool bIsRegularGrid, bool bUseQuadtree);
+    bool Load(bool bIsRegularGrid, GDALGeoLocInverseMethod eInverseMethod);
 
     bool AllocateBackMap();
 
@@ -196,12 +196,21 @@ GDALDataset *GDALGeoLocCArrayAccessors::GetBackmapDataset()
 /*                             Load()                                   */
 /************************************************************************/
 
-bool GDALGeoLocCArrayAccessors::Load(bool bIsRegularGrid, bool bUseQuadtree)
+bool GDALGeoLocCArrayAccessors::Load(bool bIsRegularGrid,
+                                      GDALGeoLocInverseMethod eInverseMethod)
 {
-    return LoadGeoloc(bIsRegularGrid) &&
-           ((bUseQuadtree && GDALGeoLocBuildQuadTree(m_psTransform)) ||
-            (!bUseQuadtree &&
-             GDALGeoLoc<AccessorType>::GenerateBackMap(m_psTransform)));
+    if (!LoadGeoloc(bIsRegularGrid))
+        return false;
+    switch (eInverseMethod)
+    {
+        case GDALGeoLocInverseMethod::QUADTREE:
+            return GDALGeoLocBuildQuadTree(m_psTransform);
+        case GDALGeoLocInverseMethod::GRID:
+            return GDALGeoLocBuildGridIndex(m_psTransform);
+        case GDALGeoLocInverseMethod::BACKMAP:
+            break;
+    }
+    return GDALGeoLoc<AccessorType>::GenerateBackMap(m_psTransform);
 }
 
 /************************************************************************/
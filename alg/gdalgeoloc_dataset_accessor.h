@@ -76,7 +76,7 @@ class GDALGeoLocDatasetAccessors
 
     ~GDALGeoLocDatasetAccessors();
 
-    bool Load(bool bIsRegularGrid, bool bUseQuadtree);
+    bool Load(bool bIsRegularGrid, GDALGeoLocInverseMethod eInverseMethod);
 
     bool AllocateBackMap();
 
@@ -190,12 +190,21 @@ void GDALGeoLocDatasetAccessors::FlushBackmapCaches()
 /*                             Load()                                   */
 /************************************************************************/
 
-bool GDALGeoLocDatasetAccessors::Load(bool bIsRegularGrid, bool bUseQuadtree)
+bool GDALGeoLocDatasetAccessors::Load(bool bIsRegularGrid,
+                                       GDALGeoLocInverseMethod eInverseMethod)
 {
-    return LoadGeoloc(bIsRegularGrid) &&
-           ((bUseQuadtree && GDALGeoLocBuildQuadTree(m_psTransform)) ||
-            (!bUseQuadtree &&
-             GDALGeoLoc<AccessorType>::GenerateBackMap(m_psTransform)));
+    if (!LoadGeoloc(bIsRegularGrid))
+        return false;
+    switch (eInverseMethod)
+    {
+        case GDALGeoLocInverseMethod::QUADTREE:
+            return GDALGeoLocBuildQuadTree(m_psTransform);
+        case GDALGeoLocInverseMethod::GRID:
+            return GDALGeoLocBuildGridIndex(m_psTransform);
+        case GDALGeoLocInverseMethod::BACKMAP:
+            break;
+    }
+    return GDALGeoLoc<AccessorType>::GenerateBackMap(m_psTransform);
 }
 
 /************************************************************************/
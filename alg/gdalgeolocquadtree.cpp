@@ -30,13 +30,20 @@
 #include "gdalgeoloc.h"
 #include "gdalgeolocquadtree.h"
 
+#include "cpl_packed_rtree.h"
 #include "cpl_quad_tree.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geometry.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cinttypes>
 #include <cstddef>
 #include <limits>
+#include <memory>
+#include <vector>
 
 /************************************************************************/
 /*               GDALGeoLocQuadTreeGetFeatureCorners()                  */
@@ -109,6 +116,53 @@ static void GDALGeoLocQuadTreeGetFeatureBounds(const void *hFeature,
     pBounds->maxy = std::max(std::max(y0, y1), std::max(y2, y3));
 }
 
+/************************************************************************/
+/*                    GDALGeoLocGetCellFeatures()                       */
+/************************************************************************/
+
+// Returns the features (0, 1 or 2) to index for the cell of index nIdx of
+// the (extended) geolocation array. Cells crossing the antimeridian get
+// a second "version" around +180 deg, flagged with BIT_IDX_RANGE_180_SET.
+static int GDALGeoLocGetCellFeatures(const GDALGeoLocTransformInfo *psTransform,
+                                     size_t nIdx, size_t anFeatures[2])
+{
+    double x0, y0, x1, y1, x2, y2, x3, y3;
+    if (!GDALGeoLocQuadTreeGetFeatureCorners(psTransform, nIdx, x0, y0, x1, y1,
+                                             x2, y2, x3, y3))
+    {
+        return 0;
+    }
+
+    // Skip too large geometries (typically at very high latitudes)
+    // that would fill too many nodes in the quadtree
+    if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+        (std::fabs(x0) > 170 || std::fabs(x1) > 170 || std::fabs(x2) > 170 ||
+         std::fabs(x3) > 170) &&
+        (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
+         std::fabs(x3 - x0) > 180) &&
+        !(std::fabs(x0) > 170 && std::fabs(x1) > 170 && std::fabs(x2) > 170 &&
+          std::fabs(x3) > 170))
+    {
+        return 0;
+    }
+
+    anFeatures[0] = nIdx;
+
+    // For a geometry crossing the antimeridian, the above is the
+    // "version" around -180 deg. Add its corresponding version around
+    // +180 deg.
+    if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+        std::fabs(x0) > 170 && std::fabs(x1) > 170 && std::fabs(x2) > 170 &&
+        std::fabs(x3) > 170 &&
+        (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
+         std::fabs(x3 - x0) > 180))
+    {
+        anFeatures[1] = nIdx | BIT_IDX_RANGE_180_SET;
+        return 2;
+    }
+    return 1;
+}
+
 /************************************************************************/
 /*                      GDALGeoLocBuildQuadTree()                       */
 /************************************************************************/
@@ -137,74 +191,97 @@ bool GDALGeoLocBuildQuadTree(GDALGeoLocTransformInfo *psTransform)
     const size_t nExtendedXYCount =
         static_cast<size_t>(nExtendedWidth) * nExtendedHeight;
 
-    CPLDebug("GEOLOC", "Start quadtree construction");
-
-    CPLRectObj globalBounds;
-    globalBounds.minx = psTransform->dfMinX;
-    globalBounds.miny = psTransform->dfMinY;
-    globalBounds.maxx = psTransform->dfMaxX;
-    globalBounds.maxy = psTransform->dfMaxY;
-    psTransform->hQuadTree = CPLQuadTreeCreateEx(
-        &globalBounds, GDALGeoLocQuadTreeGetFeatureBounds, psTransform);
-
-    CPLQuadTreeForceUseOfSubNodes(psTransform->hQuadTree);
+    CPLDebug("GEOLOC", "Start R-tree construction");
 
+    psTransform->poRTree = new CPLPackedRTree();
+    psTransform->poRTree->Reserve(nExtendedXYCount);
     for (size_t i = 0; i < nExtendedXYCount; i++)
     {
-        double x0, y0, x1, y1, x2, y2, x3, y3;
-        if (!GDALGeoLocQuadTreeGetFeatureCorners(psTransform, i, x0, y0, x1, y1,
-                                                 x2, y2, x3, y3))
+        size_t anFeatures[2];
+        const int nFeatures =
+            GDALGeoLocGetCellFeatures(psTransform, i, anFeatures);
+        for (int j = 0; j < nFeatures; j++)
         {
-            continue;
+            CPLRectObj sBounds;
+            GDALGeoLocQuadTreeGetFeatureBounds(
+                reinterpret_cast<void *>(static_cast<uintptr_t>(anFeatures[j])),
+                psTransform, &sBounds);
+            psTransform->poRTree->Add(sBounds.minx, sBounds.miny, sBounds.maxx,
+                                      sBounds.maxy, anFeatures[j]);
         }
+    }
+    psTransform->poRTree->Build();
 
-        // Skip too large geometries (typically at very high latitudes)
-        // that would fill too many nodes in the quadtree
-        if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-            (std::fabs(x0) > 170 || std::fabs(x1) > 170 ||
-             std::fabs(x2) > 170 || std::fabs(x3) > 170) &&
-            (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
-             std::fabs(x3 - x0) > 180) &&
-            !(std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
-              std::fabs(x2) > 170 && std::fabs(x3) > 170))
-        {
-            continue;
-        }
+    CPLDebug("GEOLOC", "End of R-tree construction");
 
-        CPLQuadTreeInsert(psTransform->hQuadTree,
-                          reinterpret_cast<void *>(static_cast<uintptr_t>(i)));
-
-        // For a geometry crossing the antimeridian, we've insert before
-        // the "version" around -180 deg. Insert its corresponding version
-        // around +180 deg.
-        if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-            std::fabs(x0) > 170 && std::fabs(x1) > 170 && std::fabs(x2) > 170 &&
-            std::fabs(x3) > 170 &&
-            (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
-             std::fabs(x3 - x0) > 180))
-        {
-            CPLQuadTreeInsert(psTransform->hQuadTree,
-                              reinterpret_cast<void *>(static_cast<uintptr_t>(
-                                  i | BIT_IDX_RANGE_180_SET)));
-        }
+    return true;
+}
+
+/************************************************************************/
+/*                     GDALGeoLocPointInFeature()                       */
+/************************************************************************/
+
+// Returns whether (dfGeoX, dfGeoY) is inside the feature nIdx, and if so,
+// sets dfX, dfY to the corresponding pixel/line coordinates.
+// oPoint and oRing are passed to save memory allocations.
+static bool GDALGeoLocPointInFeature(const GDALGeoLocTransformInfo *psTransform,
+                                     size_t nIdx, double dfGeoX, double dfGeoY,
+                                     OGRPoint &oPoint, OGRLinearRing &oRing,
+                                     double &dfX, double &dfY)
+{
+    const bool bXRefAt180 = (nIdx >> BIT_IDX_RANGE_180) != 0;
+    // Clear that bit.
+    nIdx &= ~BIT_IDX_RANGE_180_SET;
+
+    double x0 = 0, y0 = 0, x1 = 0, y1 = 0, x2 = 0, y2 = 0, x3 = 0, y3 = 0;
+    GDALGeoLocQuadTreeGetFeatureCorners(psTransform, nIdx, x0, y0, x2, y2, x1,
+                                        y1, x3, y3);
+
+    if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+        std::fabs(x0) > 170 && std::fabs(x1) > 170 && std::fabs(x2) > 170 &&
+        std::fabs(x3) > 170 &&
+        (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
+         std::fabs(x3 - x0) > 180))
+    {
+        const double dfXRef = bXRefAt180 ? 180 : -180;
+        x0 = ShiftGeoX(psTransform, dfXRef, x0);
+        x1 = ShiftGeoX(psTransform, dfXRef, x1);
+        x2 = ShiftGeoX(psTransform, dfXRef, x2);
+        x3 = ShiftGeoX(psTransform, dfXRef, x3);
     }
 
-    CPLDebug("GEOLOC", "End of quadtree construction");
-
-#ifdef DEBUG_GEOLOC
-    int nFeatureCount = 0;
-    int nNodeCount = 0;
-    int nMaxDepth = 0;
-    int nMaxBucketCapacity = 0;
-    CPLQuadTreeGetStats(psTransform->hQuadTree, &nFeatureCount, &nNodeCount,
-                        &nMaxDepth, &nMaxBucketCapacity);
-    CPLDebug("GEOLOC", "Quadtree stats:");
-    CPLDebug("GEOLOC", "  nFeatureCount = %d", nFeatureCount);
-    CPLDebug("GEOLOC", "  nNodeCount = %d", nNodeCount);
-    CPLDebug("GEOLOC", "  nMaxDepth = %d", nMaxDepth);
-    CPLDebug("GEOLOC", "  nMaxBucketCapacity = %d", nMaxBucketCapacity);
-#endif
+    oRing.setPoint(0, x0, y0);
+    oRing.setPoint(1, x2, y2);
+    oRing.setPoint(2, x3, y3);
+    oRing.setPoint(3, x1, y1);
+    oRing.setPoint(4, x0, y0);
+
+    if (!oRing.isPointInRing(&oPoint) && !oRing.isPointOnRingBoundary(&oPoint))
+        return false;
+
+    const size_t nExtendedWidth =
+        psTransform->nGeoLocXSize +
+        (psTransform->bOriginIsTopLeftCorner ? 0 : 1);
+    dfX = static_cast<double>(nIdx % nExtendedWidth);
+    // store the result as int, and then cast to double, to
+    // avoid Coverity Scan warning about
+    // UNINTENDED_INTEGER_DIVISION
+    const size_t nY = nIdx / nExtendedWidth;
+    dfY = static_cast<double>(nY);
+    if (!psTransform->bOriginIsTopLeftCorner)
+    {
+        dfX -= 1.0;
+        dfY -= 1.0;
+    }
+    GDALInverseBilinearInterpolation(dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2,
+                                     x3, y3, dfX, dfY);
 
+    const double dfGeorefConventionOffset =
+        psTransform->bOriginIsTopLeftCorner ? 0 : 0.5;
+    dfX = (dfX + dfGeorefConventionOffset) * psTransform->dfPIXEL_STEP +
+          psTransform->dfPIXEL_OFFSET;
+    dfY = (dfY + dfGeorefConventionOffset) * psTransform->dfLINE_STEP +
+          psTransform->dfLINE_OFFSET;
     return true;
 }
 
@@ -221,9 +298,7 @@ void GDALGeoLocInverseTransformQuadtree(
     OGRPoint oPoint;
     OGRLinearRing oRing;
     oRing.setNumPoints(5);
-
-    const double dfGeorefConventionOffset =
-        psTransform->bOriginIsTopLeftCorner ? 0 : 0.5;
+    std::vector<size_t> anFeatures;
 
     for (int i = 0; i < nPointCount; i++)
     {
@@ -243,77 +318,23 @@ void GDALGeoLocInverseTransformQuadtree(
 
         bool bDone = false;
 
-        CPLRectObj aoi;
-        aoi.minx = dfGeoX;
-        aoi.maxx = dfGeoX;
-        aoi.miny = dfGeoY;
-        aoi.maxy = dfGeoY;
-        int nFeatureCount = 0;
-        void **pahFeatures =
-            CPLQuadTreeSearch(psTransform->hQuadTree, &aoi, &nFeatureCount);
-        if (nFeatureCount != 0)
+        anFeatures.clear();
+        psTransform->poRTree->Search(dfGeoX, dfGeoY, dfGeoX, dfGeoY,
+                                     anFeatures);
+        if (!anFeatures.empty())
         {
+            // For a deterministic result when the point is on the boundary
+            // of several cells.
+            std::sort(anFeatures.begin(), anFeatures.end());
             oPoint.setX(dfGeoX);
             oPoint.setY(dfGeoY);
-            for (int iFeat = 0; iFeat < nFeatureCount; iFeat++)
+            for (const size_t nIdx : anFeatures)
             {
-                size_t nIdx = reinterpret_cast<size_t>(pahFeatures[iFeat]);
-                const bool bXRefAt180 = (nIdx >> BIT_IDX_RANGE_180) != 0;
-                // Clear that bit.
-                nIdx &= ~BIT_IDX_RANGE_180_SET;
-
-                double x0 = 0, y0 = 0, x1 = 0, y1 = 0, x2 = 0, y2 = 0, x3 = 0,
-                       y3 = 0;
-                GDALGeoLocQuadTreeGetFeatureCorners(psTransform, nIdx, x0, y0,
-                                                    x2, y2, x1, y1, x3, y3);
-
-                if (psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                    std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
-                    std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
-                    (std::fabs(x1 - x0) > 180 || std::fabs(x2 - x0) > 180 ||
-                     std::fabs(x3 - x0) > 180))
-                {
-                    const double dfXRef = bXRefAt180 ? 180 : -180;
-                    x0 = ShiftGeoX(psTransform, dfXRef, x0);
-                    x1 = ShiftGeoX(psTransform, dfXRef, x1);
-                    x2 = ShiftGeoX(psTransform, dfXRef, x2);
-                    x3 = ShiftGeoX(psTransform, dfXRef, x3);
-                }
-
-                oRing.setPoint(0, x0, y0);
-                oRing.setPoint(1, x2, y2);
-                oRing.setPoint(2, x3, y3);
-                oRing.setPoint(3, x1, y1);
-                oRing.setPoint(4, x0, y0);
-
-                if (oRing.isPointInRing(&oPoint) ||
-                    oRing.isPointOnRingBoundary(&oPoint))
+                double dfX = 0;
+                double dfY = 0;
+                if (GDALGeoLocPointInFeature(psTransform, nIdx, dfGeoX, dfGeoY,
+                                             oPoint, oRing, dfX, dfY))
                 {
-                    const size_t nExtendedWidth =
-                        psTransform->nGeoLocXSize +
-                        (psTransform->bOriginIsTopLeftCorner ? 0 : 1);
-                    double dfX = static_cast<double>(nIdx % nExtendedWidth);
-                    // store the result as int, and then cast to double, to
-                    // avoid Coverity Scan warning about
-                    // UNINTENDED_INTEGER_DIVISION
-                    const size_t nY = nIdx / nExtendedWidth;
-                    double dfY = static_cast<double>(nY);
-                    if (!psTransform->bOriginIsTopLeftCorner)
-                    {
-                        dfX -= 1.0;
-                        dfY -= 1.0;
-                    }
-                    GDALInverseBilinearInterpolation(dfGeoX, dfGeoY, x0, y0, x1,
-                                                     y1, x2, y2, x3, y3, dfX,
-                                                     dfY);
-
-                    dfX = (dfX + dfGeorefConventionOffset) *
-                              psTransform->dfPIXEL_STEP +
-                          psTransform->dfPIXEL_OFFSET;
-                    dfY = (dfY + dfGeorefConventionOffset) *
-                              psTransform->dfLINE_STEP +
-                          psTransform->dfLINE_OFFSET;
-
                     bDone = true;
                     panSuccess[i] = TRUE;
                     padfX[i] = dfX;
@@ -322,7 +343,316 @@ void GDALGeoLocInverseTransformQuadtree(
                 }
             }
         }
-        CPLFree(pahFeatures);
+
+        if (!bDone)
+        {
+            panSuccess[i] = FALSE;
+            padfX[i] = HUGE_VAL;
+            padfY[i] = HUGE_VAL;
+        }
+    }
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                         GDALGeoLocGridIndex                          */
+/* ==================================================================== */
+/************************************************************************/
+
+// Regular grid spatial hash of the cells of the geolocation array, in
+// georeferenced space. Each bucket stores the (sorted) indices of the
+// features whose bounding box intersects it, in a compressed sparse row
+// layout: that is much more compact than a quadtree.
+struct GDALGeoLocGridIndex
+{
+    double dfMinX = 0;
+    double dfMinY = 0;
+    double dfBucketSizeX = 0;
+    double dfBucketSizeY = 0;
+    int nWidth = 0;
+    int nHeight = 0;
+    // Of size nWidth * nHeight + 1
+    std::vector<size_t> anBucketStart{};
+    std::vector<size_t> anFeatures{};
+
+    int GetBucketX(double dfX) const
+    {
+        const double dfIdx = (dfX - dfMinX) / dfBucketSizeX;
+        if (!(dfIdx >= 0))
+            return 0;
+        if (dfIdx >= nWidth)
+            return nWidth - 1;
+        return static_cast<int>(dfIdx);
+    }
+
+    int GetBucketY(double dfY) const
+    {
+        const double dfIdx = (dfY - dfMinY) / dfBucketSizeY;
+        if (!(dfIdx >= 0))
+            return 0;
+        if (dfIdx >= nHeight)
+            return nHeight - 1;
+        return static_cast<int>(dfIdx);
+    }
+};
+
+namespace
+{
+struct GDALGeoLocGridIndexJob
+{
+    const GDALGeoLocTransformInfo *psTransform = nullptr;
+    GDALGeoLocGridIndex *poIndex = nullptr;
+    std::atomic<size_t> *panCursor = nullptr;
+    bool bFill = false;
+    size_t nStart = 0;
+    size_t nEnd = 0;
+};
+}  // namespace
+
+// First pass (bFill == false): count the features of each bucket.
+// Second pass (bFill == true): store the features in each bucket.
+static void GDALGeoLocGridIndexJobFunc(void *pData)
+{
+    const auto psJob = static_cast<GDALGeoLocGridIndexJob *>(pData);
+    const GDALGeoLocGridIndex *poIndex = psJob->poIndex;
+    for (size_t i = psJob->nStart; i < psJob->nEnd; i++)
+    {
+        size_t anFeatures[2];
+        const int nFeatures =
+            GDALGeoLocGetCellFeatures(psJob->psTransform, i, anFeatures);
+        for (int j = 0; j < nFeatures; j++)
+        {
+            CPLRectObj sBounds;
+            GDALGeoLocQuadTreeGetFeatureBounds(
+                reinterpret_cast<void *>(static_cast<uintptr_t>(anFeatures[j])),
+                const_cast<GDALGeoLocTransformInfo *>(psJob->psTransform),
+                &sBounds);
+            const int nMinBucketX = poIndex->GetBucketX(sBounds.minx);
+            const int nMaxBucketX = poIndex->GetBucketX(sBounds.maxx);
+            const int nMinBucketY = poIndex->GetBucketY(sBounds.miny);
+            const int nMaxBucketY = poIndex->GetBucketY(sBounds.maxy);
+            for (int iY = nMinBucketY; iY <= nMaxBucketY; iY++)
+            {
+                for (int iX = nMinBucketX; iX <= nMaxBucketX; iX++)
+                {
+                    const size_t nBucket =
+                        static_cast<size_t>(iY) * poIndex->nWidth + iX;
+                    const size_t nPos = psJob->panCursor[nBucket].fetch_add(
+                        1, std::memory_order_relaxed);
+                    if (psJob->bFill)
+                        psJob->poIndex->anFeatures[nPos] = anFeatures[j];
+                }
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                      GDALGeoLocBuildGridIndex()                      */
+/************************************************************************/
+
+bool GDALGeoLocBuildGridIndex(GDALGeoLocTransformInfo *psTransform)
+{
+    // For the pixel-center convention, insert a "virtual" row and column
+    // at top and left of the geoloc array.
+    const int nExtraPixel = psTransform->bOriginIsTopLeftCorner ? 0 : 1;
+
+    if (psTransform->nGeoLocXSize > INT_MAX - nExtraPixel ||
+        psTransform->nGeoLocYSize > INT_MAX - nExtraPixel ||
+        // The >> 1 shift is because we need to reserve the
+        // most-significant-bit for the second 'version' of anti-meridian
+        // crossing quadrilaterals.
+        static_cast<size_t>(psTransform->nGeoLocXSize + nExtraPixel) >
+            (std::numeric_limits<size_t>::max() >> 1) /
+                static_cast<size_t>(psTransform->nGeoLocYSize + nExtraPixel))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too big geolocation array");
+        return false;
+    }
+
+    const size_t nExtendedXYCount =
+        static_cast<size_t>(psTransform->nGeoLocXSize + nExtraPixel) *
+        (psTransform->nGeoLocYSize + nExtraPixel);
+
+    CPLDebug("GEOLOC", "Start grid index construction");
+
+    // About 2 features per bucket.
+    auto poIndex = std::make_unique<GDALGeoLocGridIndex>();
+    const double dfExtentX =
+        std::max(psTransform->dfMaxX - psTransform->dfMinX, 1e-10);
+    const double dfExtentY =
+        std::max(psTransform->dfMaxY - psTransform->dfMinY, 1e-10);
+    const double dfBucketCount =
+        std::max(1.0, static_cast<double>(nExtendedXYCount) / 2);
+    const double dfWidth = std::sqrt(dfBucketCount * dfExtentX / dfExtentY);
+    const double dfMaxSize = std::min(dfBucketCount, 65536.0);
+    poIndex->nWidth = static_cast<int>(std::clamp(dfWidth, 1.0, dfMaxSize));
+    poIndex->nHeight = static_cast<int>(
+        std::clamp(dfBucketCount / poIndex->nWidth, 1.0, dfMaxSize));
+    poIndex->dfMinX = psTransform->dfMinX;
+    poIndex->dfMinY = psTransform->dfMinY;
+    poIndex->dfBucketSizeX = dfExtentX / poIndex->nWidth;
+    poIndex->dfBucketSizeY = dfExtentY / poIndex->nHeight;
+    const size_t nBuckets =
+        static_cast<size_t>(poIndex->nWidth) * poIndex->nHeight;
+
+    std::unique_ptr<std::atomic<size_t>[]> panCursor;
+    try
+    {
+        panCursor.reset(new std::atomic<size_t>[nBuckets]);
+        poIndex->anBucketStart.resize(nBuckets + 1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate geolocation grid index");
+        return false;
+    }
+    for (size_t i = 0; i < nBuckets; i++)
+        panCursor[i].store(0, std::memory_order_relaxed);
+
+    // Reading the geolocation arrays is only thread-safe when they are
+    // in RAM.
+    const int nThreads = psTransform->bUseArray
+                             ? std::max(1, psTransform->nNumThreads)
+                             : 1;
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    const int nJobs = poPool ? nThreads : 1;
+    std::vector<GDALGeoLocGridIndexJob> asJobs(nJobs);
+    for (int i = 0; i < nJobs; i++)
+    {
+        asJobs[i].psTransform = psTransform;
+        asJobs[i].poIndex = poIndex.get();
+        asJobs[i].panCursor = panCursor.get();
+        asJobs[i].nStart = nExtendedXYCount / nJobs * i;
+        asJobs[i].nEnd = i + 1 == nJobs ? nExtendedXYCount
+                                        : nExtendedXYCount / nJobs * (i + 1);
+    }
+    const auto RunJobs = [poPool, &asJobs]()
+    {
+        if (poPool)
+        {
+            auto poQueue = poPool->CreateJobQueue();
+            for (auto &sJob : asJobs)
+                poQueue->SubmitJob(GDALGeoLocGridIndexJobFunc, &sJob);
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            GDALGeoLocGridIndexJobFunc(&asJobs[0]);
+        }
+    };
+
+    // Count the features of each bucket.
+    RunJobs();
+
+    size_t nTotal = 0;
+    for (size_t i = 0; i < nBuckets; i++)
+    {
+        poIndex->anBucketStart[i] = nTotal;
+        nTotal += panCursor[i].load(std::memory_order_relaxed);
+        panCursor[i].store(poIndex->anBucketStart[i],
+                           std::memory_order_relaxed);
+    }
+    poIndex->anBucketStart[nBuckets] = nTotal;
+    try
+    {
+        poIndex->anFeatures.resize(nTotal);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate geolocation grid index");
+        return false;
+    }
+
+    // Store them.
+    for (auto &sJob : asJobs)
+        sJob.bFill = true;
+    RunJobs();
+    panCursor.reset();
+
+    // Sort each bucket, so that the result does not depend on the
+    // scheduling of the jobs.
+    for (size_t i = 0; i < nBuckets; i++)
+    {
+        std::sort(poIndex->anFeatures.begin() + poIndex->anBucketStart[i],
+                  poIndex->anFeatures.begin() + poIndex->anBucketStart[i + 1]);
+    }
+
+    CPLDebug("GEOLOC",
+             "End of grid index construction: %d x %d buckets, "
+             "%" PRIu64 " entries",
+             poIndex->nWidth, poIndex->nHeight, static_cast<uint64_t>(nTotal));
+
+    psTransform->poGridIndex = poIndex.release();
+    return true;
+}
+
+/************************************************************************/
+/*                     GDALGeoLocDestroyGridIndex()                     */
+/************************************************************************/
+
+void GDALGeoLocDestroyGridIndex(GDALGeoLocGridIndex *poIndex)
+{
+    delete poIndex;
+}
+
+/************************************************************************/
+/*                 GDALGeoLocInverseTransformGridIndex()                */
+/************************************************************************/
+
+void GDALGeoLocInverseTransformGridIndex(
+    const GDALGeoLocTransformInfo *psTransform, int nPointCount, double *padfX,
+    double *padfY, int *panSuccess)
+{
+    const GDALGeoLocGridIndex *poIndex = psTransform->poGridIndex;
+
+    // Keep those objects in this outer scope, so they are re-used, to
+    // save memory allocations.
+    OGRPoint oPoint;
+    OGRLinearRing oRing;
+    oRing.setNumPoints(5);
+
+    for (int i = 0; i < nPointCount; i++)
+    {
+        if (padfX[i] == HUGE_VAL || padfY[i] == HUGE_VAL)
+        {
+            panSuccess[i] = FALSE;
+            continue;
+        }
+
+        if (psTransform->bSwapXY)
+        {
+            std::swap(padfX[i], padfY[i]);
+        }
+
+        const double dfGeoX = padfX[i];
+        const double dfGeoY = padfY[i];
+
+        bool bDone = false;
+        const size_t nBucket =
+            static_cast<size_t>(poIndex->GetBucketY(dfGeoY)) * poIndex->nWidth +
+            poIndex->GetBucketX(dfGeoX);
+        oPoint.setX(dfGeoX);
+        oPoint.setY(dfGeoY);
+        for (size_t j = poIndex->anBucketStart[nBucket];
+             j < poIndex->anBucketStart[nBucket + 1]; j++)
+        {
+            double dfX = 0;
+            double dfY = 0;
+            if (GDALGeoLocPointInFeature(psTransform, poIndex->anFeatures[j],
+                                         dfGeoX, dfGeoY, oPoint, oRing, dfX,
+                                         dfY))
+            {
+                bDone = true;
+                panSuccess[i] = TRUE;
+                padfX[i] = dfX;
+                padfY[i] = dfY;
+                break;
+            }
+        }
 
         if (!bDone)
         {
@@ -38,4 +38,12 @@ void GDALGeoLocInverseTransformQuadtree(
     const GDALGeoLocTransformInfo *psTransform, int nPointCount, double *padfX,
     double *padfY, int *panSuccess);
 
+bool GDALGeoLocBuildGridIndex(GDALGeoLocTransformInfo *psTransform);
+
+void GDALGeoLocDestroyGridIndex(GDALGeoLocGridIndex *poIndex);
+
+void GDALGeoLocInverseTransformGridIndex(
+    const GDALGeoLocTransformInfo *psTransform, int nPointCount, double *padfX,
+    double *padfY, int *panSuccess);
+
 #endif
@@ -39,8 +39,10 @@
 
 #include <limits>
 #include <map>
+#include <new>
 #include <utility>
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
@@ -72,6 +74,316 @@ static void GDALGridGetPointBounds(const void *hFeature, CPLRectObj *pBounds)
     pBounds->maxy = dfY;
 }
 
+/************************************************************************/
+/*                            GDALGridKDTree                            */
+/************************************************************************/
+
+// Balanced 2D KD-tree of the input points. It is built once and then only
+// queried, so a single instance is shared by all worker threads.
+// Nodes are stored implicitly: the node covering the range [nBegin, nEnd)
+// of the arrays has its splitting point in the middle of the range, points
+// before it being on the lower side of the splitting line, and points after
+// it on the upper side. Coordinates are copied in tree order, so that
+// points close in space are also close in memory.
+class GDALGridKDTree
+{
+  public:
+    static GDALGridKDTree *Create(GUInt32 nPoints, const double *padfX,
+                                  const double *padfY);
+
+    // Find the nearest point to (dfX, dfY) among the points located in
+    // the square of half side dfMaxDist centered on it. Among points at the
+    // same distance, the one of highest index is selected.
+    // Returns false if there is no point in the square.
+    bool Nearest(double dfX, double dfY, double dfMaxDist,
+                 GUInt32 &nIdx) const
+    {
+        double dfBestDist2 = std::numeric_limits<double>::infinity();
+        bool bFound = false;
+        NearestRec(0, static_cast<GUInt32>(m_anIdx.size()), dfX, dfY,
+                   dfMaxDist, dfBestDist2, nIdx, bFound);
+        return bFound;
+    }
+
+    // Find the nMaxPoints nearest points (or all points if nMaxPoints is 0)
+    // whose squared distance to (dfX, dfY) is not greater than dfMaxDist2.
+    // anNeighbours is filled with (squared distance, index) pairs, sorted by
+    // increasing distance.
+    void Neighbours(double dfX, double dfY, double dfMaxDist2,
+                    GUInt32 nMaxPoints,
+                    std::vector<std::pair<double, GUInt32>> &anNeighbours) const
+    {
+        anNeighbours.clear();
+        NeighboursRec(0, static_cast<GUInt32>(m_anIdx.size()), dfX, dfY,
+                      dfMaxDist2, nMaxPoints, anNeighbours);
+        std::sort_heap(anNeighbours.begin(), anNeighbours.end());
+    }
+
+    // Call f(nIdx) for each point within the rectangle.
+    template <class F>
+    void ForEachInRect(double dfMinX, double dfMinY, double dfMaxX,
+                       double dfMaxY, F f) const
+    {
+        ForEachInRectRec(0, static_cast<GUInt32>(m_anIdx.size()), dfMinX,
+                         dfMinY, dfMaxX, dfMaxY, f);
+    }
+
+  private:
+    static constexpr GUInt32 LEAF_SIZE = 8;
+
+    std::vector<double> m_adfX{};
+    std::vector<double> m_adfY{};
+    // Index in the input arrays of each point.
+    std::vector<GUInt32> m_anIdx{};
+    // Splitting axis of each node (0 for X, 1 for Y), at its middle index.
+    std::vector<GByte> m_abyAxis{};
+
+    GDALGridKDTree() = default;
+
+    void Build(GUInt32 nBegin, GUInt32 nEnd, const double *padfX,
+               const double *padfY);
+
+    void NearestRec(GUInt32 nBegin, GUInt32 nEnd, double dfX, double dfY,
+                    double dfMaxDist, double &dfBestDist2, GUInt32 &nBestIdx,
+                    bool &bFound) const;
+
+    void NeighboursRec(
+        GUInt32 nBegin, GUInt32 nEnd, double dfX, double dfY,
+        double dfMaxDist2, GUInt32 nMaxPoints,
+        std::vector<std::pair<double, GUInt32>> &anNeighbours) const;
+
+    template <class F>
+    void ForEachInRectRec(GUInt32 nBegin, GUInt32 nEnd, double dfMinX,
+                          double dfMinY, double dfMaxX, double dfMaxY,
+                          F &f) const
+    {
+        if (nEnd - nBegin <= LEAF_SIZE)
+        {
+            for (GUInt32 i = nBegin; i < nEnd; ++i)
+            {
+                if (m_adfX[i] >= dfMinX && m_adfX[i] <= dfMaxX &&
+                    m_adfY[i] >= dfMinY && m_adfY[i] <= dfMaxY)
+                {
+                    f(m_anIdx[i]);
+                }
+            }
+            return;
+        }
+
+        const GUInt32 nMid = nBegin + (nEnd - nBegin) / 2;
+        if (m_adfX[nMid] >= dfMinX && m_adfX[nMid] <= dfMaxX &&
+            m_adfY[nMid] >= dfMinY && m_adfY[nMid] <= dfMaxY)
+        {
+            f(m_anIdx[nMid]);
+        }
+        const double dfSplit =
+            m_abyAxis[nMid] == 0 ? m_adfX[nMid] : m_adfY[nMid];
+        const double dfMin = m_abyAxis[nMid] == 0 ? dfMinX : dfMinY;
+        const double dfMax = m_abyAxis[nMid] == 0 ? dfMaxX : dfMaxY;
+        if (dfMin <= dfSplit)
+            ForEachInRectRec(nBegin, nMid, dfMinX, dfMinY, dfMaxX, dfMaxY, f);
+        if (dfMax >= dfSplit)
+            ForEachInRectRec(nMid + 1, nEnd, dfMinX, dfMinY, dfMaxX, dfMaxY,
+                             f);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALGridKDTree)
+};
+
+/************************************************************************/
+/*                       GDALGridKDTree::Create()                       */
+/************************************************************************/
+
+GDALGridKDTree *GDALGridKDTree::Create(GUInt32 nPoints, const double *padfX,
+                                       const double *padfY)
+{
+    auto poTree = new (std::nothrow) GDALGridKDTree();
+    if (poTree == nullptr)
+        return nullptr;
+    try
+    {
+        poTree->m_anIdx.resize(nPoints);
+        poTree->m_abyAxis.resize(nPoints);
+        for (GUInt32 i = 0; i < nPoints; ++i)
+            poTree->m_anIdx[i] = i;
+        poTree->Build(0, nPoints, padfX, padfY);
+
+        poTree->m_adfX.resize(nPoints);
+        poTree->m_adfY.resize(nPoints);
+        for (GUInt32 i = 0; i < nPoints; ++i)
+        {
+            poTree->m_adfX[i] = padfX[poTree->m_anIdx[i]];
+            poTree->m_adfY[i] = padfY[poTree->m_anIdx[i]];
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for KD-tree");
+        delete poTree;
+        return nullptr;
+    }
+    return poTree;
+}
+
+/************************************************************************/
+/*                        GDALGridKDTree::Build()                       */
+/************************************************************************/
+
+void GDALGridKDTree::Build(GUInt32 nBegin, GUInt32 nEnd, const double *padfX,
+                           const double *padfY)
+{
+    if (nEnd - nBegin <= LEAF_SIZE)
+        return;
+
+    // Split along the axis of largest extent.
+    double dfMinX = padfX[m_anIdx[nBegin]];
+    double dfMaxX = dfMinX;
+    double dfMinY = padfY[m_anIdx[nBegin]];
+    double dfMaxY = dfMinY;
+    for (GUInt32 i = nBegin + 1; i < nEnd; ++i)
+    {
+        const GUInt32 nIdx = m_anIdx[i];
+        dfMinX = std::min(dfMinX, padfX[nIdx]);
+        dfMaxX = std::max(dfMaxX, padfX[nIdx]);
+        dfMinY = std::min(dfMinY, padfY[nIdx]);
+        dfMaxY = std::max(dfMaxY, padfY[nIdx]);
+    }
+    const GByte byAxis = (dfMaxX - dfMinX >= dfMaxY - dfMinY) ? 0 : 1;
+    const double *padfCoord = byAxis == 0 ? padfX : padfY;
+
+    const GUInt32 nMid = nBegin + (nEnd - nBegin) / 2;
+    std::nth_element(m_anIdx.begin() + nBegin, m_anIdx.begin() + nMid,
+                     m_anIdx.begin() + nEnd,
+                     [padfCoord](GUInt32 a, GUInt32 b)
+                     { return padfCoord[a] < padfCoord[b]; });
+    m_abyAxis[nMid] = byAxis;
+
+    Build(nBegin, nMid, padfX, padfY);
+    Build(nMid + 1, nEnd, padfX, padfY);
+}
+
+/************************************************************************/
+/*                     GDALGridKDTree::NearestRec()                     */
+/************************************************************************/
+
+void GDALGridKDTree::NearestRec(GUInt32 nBegin, GUInt32 nEnd, double dfX,
+                                double dfY, double dfMaxDist,
+                                double &dfBestDist2, GUInt32 &nBestIdx,
+                                bool &bFound) const
+{
+    const auto TestPoint = [&](GUInt32 i)
+    {
+        const double dfRX = m_adfX[i] - dfX;
+        const double dfRY = m_adfY[i] - dfY;
+        if (std::fabs(dfRX) <= dfMaxDist && std::fabs(dfRY) <= dfMaxDist)
+        {
+            const double dfR2 = dfRX * dfRX + dfRY * dfRY;
+            if (dfR2 < dfBestDist2 ||
+                (dfR2 == dfBestDist2 && m_anIdx[i] > nBestIdx))
+            {
+                dfBestDist2 = dfR2;
+                nBestIdx = m_anIdx[i];
+                bFound = true;
+            }
+        }
+    };
+
+    if (nEnd - nBegin <= LEAF_SIZE)
+    {
+        for (GUInt32 i = nBegin; i < nEnd; ++i)
+            TestPoint(i);
+        return;
+    }
+
+    const GUInt32 nMid = nBegin + (nEnd - nBegin) / 2;
+    TestPoint(nMid);
+
+    const double dfDiff =
+        m_abyAxis[nMid] == 0 ? dfX - m_adfX[nMid] : dfY - m_adfY[nMid];
+    if (dfDiff < 0)
+        NearestRec(nBegin, nMid, dfX, dfY, dfMaxDist, dfBestDist2, nBestIdx,
+                   bFound);
+    else
+        NearestRec(nMid + 1, nEnd, dfX, dfY, dfMaxDist, dfBestDist2, nBestIdx,
+                   bFound);
+    if (dfDiff * dfDiff <= dfBestDist2 && std::fabs(dfDiff) <= dfMaxDist)
+    {
+        if (dfDiff < 0)
+            NearestRec(nMid + 1, nEnd, dfX, dfY, dfMaxDist, dfBestDist2,
+                       nBestIdx, bFound);
+        else
+            NearestRec(nBegin, nMid, dfX, dfY, dfMaxDist, dfBestDist2,
+                       nBestIdx, bFound);
+    }
+}
+
+/************************************************************************/
+/*                    GDALGridKDTree::NeighboursRec()                   */
+/************************************************************************/
+
+void GDALGridKDTree::NeighboursRec(
+    GUInt32 nBegin, GUInt32 nEnd, double dfX, double dfY, double dfMaxDist2,
+    GUInt32 nMaxPoints,
+    std::vector<std::pair<double, GUInt32>> &anNeighbours) const
+{
+    // anNeighbours is a max-heap, so that the farthest neighbour found so
+    // far can be evicted once nMaxPoints points have been found.
+    const auto TestPoint = [&](GUInt32 i)
+    {
+        const double dfRX = m_adfX[i] - dfX;
+        const double dfRY = m_adfY[i] - dfY;
+        const double dfR2 = dfRX * dfRX + dfRY * dfRY;
+        if (dfR2 > dfMaxDist2)
+            return;
+        const std::pair<double, GUInt32> oNeighbour(dfR2, m_anIdx[i]);
+        if (nMaxPoints == 0 || anNeighbours.size() < nMaxPoints)
+        {
+            anNeighbours.push_back(oNeighbour);
+            std::push_heap(anNeighbours.begin(), anNeighbours.end());
+        }
+        else if (oNeighbour < anNeighbours.front())
+        {
+            std::pop_heap(anNeighbours.begin(), anNeighbours.end());
+            anNeighbours.back() = oNeighbour;
+            std::push_heap(anNeighbours.begin(), anNeighbours.end());
+        }
+    };
+
+    if (nEnd - nBegin <= LEAF_SIZE)
+    {
+        for (GUInt32 i = nBegin; i < nEnd; ++i)
+            TestPoint(i);
+        return;
+    }
+
+    const GUInt32 nMid = nBegin + (nEnd - nBegin) / 2;
+    TestPoint(nMid);
+
+    const double dfDiff =
+        m_abyAxis[nMid] == 0 ? dfX - m_adfX[nMid] : dfY - m_adfY[nMid];
+    if (dfDiff < 0)
+        NeighboursRec(nBegin, nMid, dfX, dfY, dfMaxDist2, nMaxPoints,
+                      anNeighbours);
+    else
+        NeighboursRec(nMid + 1, nEnd, dfX, dfY, dfMaxDist2, nMaxPoints,
+                      anNeighbours);
+
+    const double dfBound =
+        (nMaxPoints != 0 && anNeighbours.size() == nMaxPoints)
+            ? anNeighbours.front().first
+            : dfMaxDist2;
+    if (dfDiff * dfDiff <= dfBound)
+    {
+        if (dfDiff < 0)
+            NeighboursRec(nMid + 1, nEnd, dfX, dfY, dfMaxDist2, nMaxPoints,
+                          anNeighbours);
+        else
+            NeighboursRec(nBegin, nMid, dfX, dfY, dfMaxDist2, nMaxPoints,
+                          anNeighbours);
+    }
+}
+
 /************************************************************************/
 /*                   GDALGridInverseDistanceToAPower()                  */
 /************************************************************************/
@@ -274,11 +586,50 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
     const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    const GDALGridKDTree *poKDTree = psExtraParams->poKDTree;
+    CPLAssert(phQuadTree || poKDTree);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
 
+    if (poKDTree != nullptr)
+    {
+        // The KD-tree directly returns the nMaxPoints closest points within
+        // the radius, sorted by increasing distance.
+        auto &anNeighbours = *(psExtraParams->panNeighbours);
+        poKDTree->Neighbours(dfXPoint, dfYPoint, dfRPower2, nMaxPoints,
+                             anNeighbours);
+        if (!anNeighbours.empty() &&
+            anNeighbours[0].first + dfSmoothing2 < 0.0000000000001)
+        {
+            *pdfValue = padfZ[anNeighbours[0].second];
+            return CE_None;
+        }
+
+        double dfNominator = 0.0;
+        double dfDenominator = 0.0;
+        for (const auto &oNeighbour : anNeighbours)
+        {
+            const double dfW =
+                pow(oNeighbour.first + dfSmoothing2, dfPowerDiv2);
+            const double dfInvW = 1.0 / dfW;
+            dfNominator += dfInvW * padfZ[oNeighbour.second];
+            dfDenominator += dfInvW;
+        }
+
+        if (anNeighbours.size() < poOptions->nMinPoints ||
+            dfDenominator == 0.0)
+        {
+            *pdfValue = poOptions->dfNoDataValue;
+        }
+        else
+        {
+            *pdfValue = dfNominator / dfDenominator;
+        }
+
+        return CE_None;
+    }
+
     std::multimap<double, double> oMapDistanceToZValues;
 
     const double dfSearchRadius = dfRadius;
@@ -674,7 +1025,26 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
     double dfAccumulator = 0.0;
 
     GUInt32 n = 0;  // Used after for.
-    if (phQuadTree != nullptr)
+    if (psExtraParams->poKDTree != nullptr)
+    {
+        psExtraParams->poKDTree->ForEachInRect(
+            dfXPoint - dfSearchRadius, dfYPoint - dfSearchRadius,
+            dfXPoint + dfSearchRadius, dfYPoint + dfSearchRadius,
+            [&](GUInt32 i)
+            {
+                const double dfRX = padfX[i] - dfXPoint;
+                const double dfRY = padfY[i] - dfYPoint;
+
+                if (dfRadius2Square * dfRX * dfRX +
+                        dfRadius1Square * dfRY * dfRY <=
+                    dfR12Square)
+                {
+                    dfAccumulator += padfZ[i];
+                    n++;
+                }
+            });
+    }
+    else if (phQuadTree != nullptr)
     {
         CPLRectObj sAoi;
         sAoi.minx = dfXPoint - dfSearchRadius;
@@ -922,7 +1292,22 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
     GUInt32 i = 0;
 
     double dfSearchRadius = psExtraParams->dfInitialSearchRadius;
-    if (hQuadTree != nullptr)
+    if (psExtraParams->poKDTree != nullptr)
+    {
+        // Restrict the search to the square of half side the largest radius,
+        // as done with the quadtree.
+        const double dfMaxDist =
+            (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
+                ? std::max(poOptions->dfRadius1, poOptions->dfRadius2)
+                : std::numeric_limits<double>::infinity();
+        GUInt32 nIdx = 0;
+        if (psExtraParams->poKDTree->Nearest(dfXPoint, dfYPoint, dfMaxDist,
+                                             nIdx))
+        {
+            dfNearestValue = padfZ[nIdx];
+        }
+    }
+    else if (hQuadTree != nullptr)
     {
         if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
             dfSearchRadius =
@@ -2547,12 +2932,17 @@ CPLErr GDALGridLinear(const void *poOptionsIn, GUInt32 nPoints,
 
 typedef struct _GDALGridJob GDALGridJob;
 
+// Size of the square tiles of the output grid processed by jobs, so
+// that consecutive queries of a job hit the same region of the point set.
+constexpr GUInt32 GRID_TILE_SIZE = 64;
+
 struct _GDALGridJob
 {
-    GUInt32 nYStart;
+    GUInt32 nTileStart;
 
     GByte *pabyData;
-    GUInt32 nYStep;
+    GUInt32 nTileStep;
+    GUInt32 nTileCount;
     GUInt32 nXSize;
     GUInt32 nYSize;
     double dfXMin;
@@ -2603,8 +2993,9 @@ static int GDALGridProgressMonoThread(GDALGridJob *psJob)
 {
     const int nCounter = ++(*psJob->pnCounter);
     // coverity[missing_lock]
-    if (!psJob->pfnRealProgress(nCounter / static_cast<double>(psJob->nYSize),
-                                "", psJob->pRealProgressArg))
+    if (!psJob->pfnRealProgress(
+            nCounter / static_cast<double>(psJob->nTileCount), "",
+            psJob->pRealProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
         *psJob->pbStop = TRUE;
@@ -2624,12 +3015,12 @@ static void GDALGridJobProcess(void *user_data)
     const GUInt32 nXSize = psJob->nXSize;
 
     /* -------------------------------------------------------------------- */
-    /*  Allocate a buffer of scanline size, fill it with gridded values     */
+    /*  Allocate a buffer of tile line size, fill it with gridded values    */
     /*  and use GDALCopyWords() to copy values into output data array with  */
     /*  appropriate data type conversion.                                   */
     /* -------------------------------------------------------------------- */
-    double *padfValues =
-        static_cast<double *>(VSI_MALLOC2_VERBOSE(sizeof(double), nXSize));
+    double *padfValues = static_cast<double *>(VSI_MALLOC2_VERBOSE(
+        sizeof(double), std::min(nXSize, GRID_TILE_SIZE)));
     if (padfValues == nullptr)
     {
         *(psJob->pbStop) = TRUE;
@@ -2638,8 +3029,9 @@ static void GDALGridJobProcess(void *user_data)
         return;
     }
 
-    const GUInt32 nYStart = psJob->nYStart;
-    const GUInt32 nYStep = psJob->nYStep;
+    const GUInt32 nTileStart = psJob->nTileStart;
+    const GUInt32 nTileStep = psJob->nTileStep;
+    const GUInt32 nTileCount = psJob->nTileCount;
     GByte *pabyData = psJob->pabyData;
 
     const GUInt32 nYSize = psJob->nYSize;
@@ -2654,39 +3046,57 @@ static void GDALGridJobProcess(void *user_data)
     const void *poOptions = psJob->poOptions;
     GDALGridFunction pfnGDALGridMethod = psJob->pfnGDALGridMethod;
     // Have a local copy of sExtraParameters since we want to modify
-    // nInitialFacetIdx.
+    // nInitialFacetIdx and panNeighbours.
     GDALGridExtraParameters sExtraParameters = *psJob->psExtraParameters;
+    std::vector<std::pair<double, GUInt32>> anNeighbours;
+    sExtraParameters.panNeighbours = &anNeighbours;
     const GDALDataType eType = psJob->eType;
 
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
-    const int nLineSpace = nXSize * nDataTypeSize;
+    const size_t nLineSpace = static_cast<size_t>(nXSize) * nDataTypeSize;
+    const GUInt32 nTilesPerLine =
+        (nXSize + GRID_TILE_SIZE - 1) / GRID_TILE_SIZE;
 
-    for (GUInt32 nYPoint = nYStart; nYPoint < nYSize; nYPoint += nYStep)
+    bool bError = false;
+    for (GUInt32 nTile = nTileStart; nTile < nTileCount && !bError;
+         nTile += nTileStep)
     {
-        const double dfYPoint = dfYMin + (nYPoint + 0.5) * dfDeltaY;
+        const GUInt32 nXStart = (nTile % nTilesPerLine) * GRID_TILE_SIZE;
+        const GUInt32 nXEnd = std::min(nXSize, nXStart + GRID_TILE_SIZE);
+        const GUInt32 nYStart = (nTile / nTilesPerLine) * GRID_TILE_SIZE;
+        const GUInt32 nYEnd = std::min(nYSize, nYStart + GRID_TILE_SIZE);
 
-        for (GUInt32 nXPoint = 0; nXPoint < nXSize; nXPoint++)
+        for (GUInt32 nYPoint = nYStart; nYPoint < nYEnd && !bError; nYPoint++)
         {
-            const double dfXPoint = dfXMin + (nXPoint + 0.5) * dfDeltaX;
+            const double dfYPoint = dfYMin + (nYPoint + 0.5) * dfDeltaY;
 
-            if ((*pfnGDALGridMethod)(poOptions, nPoints, padfX, padfY, padfZ,
-                                     dfXPoint, dfYPoint, padfValues + nXPoint,
-                                     &sExtraParameters) != CE_None)
+            for (GUInt32 nXPoint = nXStart; nXPoint < nXEnd; nXPoint++)
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Gridding failed at X position %lu, Y position %lu",
-                         static_cast<long unsigned int>(nXPoint),
-                         static_cast<long unsigned int>(nYPoint));
-                *psJob->pbStop = TRUE;
-                if (pfnProgress != nullptr)
-                    pfnProgress(psJob);  // To notify the main thread.
-                break;
+                const double dfXPoint = dfXMin + (nXPoint + 0.5) * dfDeltaX;
+
+                if ((*pfnGDALGridMethod)(poOptions, nPoints, padfX, padfY,
+                                         padfZ, dfXPoint, dfYPoint,
+                                         padfValues + (nXPoint - nXStart),
+                                         &sExtraParameters) != CE_None)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Gridding failed at X position %lu, Y position "
+                             "%lu",
+                             static_cast<long unsigned int>(nXPoint),
+                             static_cast<long unsigned int>(nYPoint));
+                    *psJob->pbStop = TRUE;
+                    if (pfnProgress != nullptr)
+                        pfnProgress(psJob);  // To notify the main thread.
+                    bError = true;
+                    break;
+                }
             }
-        }
 
-        GDALCopyWords(padfValues, GDT_Float64, sizeof(double),
-                      pabyData + nYPoint * nLineSpace, eType, nDataTypeSize,
-                      nXSize);
+            GDALCopyWords(padfValues, GDT_Float64, sizeof(double),
+                          pabyData + nYPoint * nLineSpace +
+                              static_cast<size_t>(nXStart) * nDataTypeSize,
+                          eType, nDataTypeSize, nXEnd - nXStart);
+        }
 
         if (*psJob->pbStop || (pfnProgress != nullptr && pfnProgress(psJob)))
             break;
@@ -2742,7 +3152,13 @@ static void GDALGridContextCreateQuadTree(GDALGridContext *psContext);
  * It is possible to set the GDAL_NUM_THREADS
  * configuration option to parallelize the processing. The value to set is
  * the number of worker threads, or ALL_CPUS to use all the cores/CPUs of the
- * computer (default value).
+ * computer (default value). The output grid is processed by square tiles
+ * distributed among the threads.
+ *
+ * Starting with GDAL 3.10, the 'nearest', 'average' and 'invdistnn'
+ * algorithms (without per-quadrant constraints) search the points with a
+ * KD-tree, shared by all threads, instead of a quadtree or a scan of all
+ * points.
  *
  * @param eAlgorithm Gridding method.
  * @param poOptions Options to control chosen gridding method.
@@ -2772,6 +3188,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     CPLAssert(padfY);
     CPLAssert(padfZ);
     bool bCreateQuadTree = false;
+    bool bCreateKDTree = false;
 
     const unsigned int nPointCountThreshold =
         atoi(CPLGetConfigOption("GDAL_GRID_POINT_COUNT_THRESHOLD", "100"));
@@ -2926,13 +3343,14 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             {
                 pfnGDALGridMethod =
                     GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant;
+                bCreateQuadTree = true;
             }
             else
             {
                 pfnGDALGridMethod =
                     GDALGridInverseDistanceToAPowerNearestNeighbor;
+                bCreateKDTree = true;
             }
-            bCreateQuadTree = true;
             break;
         }
         case GGA_MovingAverage:
@@ -2958,7 +3376,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             else
             {
                 pfnGDALGridMethod = GDALGridMovingAverage;
-                bCreateQuadTree = (nPoints > nPointCountThreshold &&
+                bCreateKDTree = (nPoints > nPointCountThreshold &&
                                    poOptionsOld->dfAngle == 0.0 &&
                                    (poOptionsOld->dfRadius1 > 0.0 ||
                                     poOptionsOld->dfRadius2 > 0.0));
@@ -2980,10 +3398,8 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
                    sizeof(GDALGridNearestNeighborOptions));
 
             pfnGDALGridMethod = GDALGridNearestNeighbor;
-            bCreateQuadTree = (nPoints > nPointCountThreshold &&
-                               poOptionsOld->dfAngle == 0.0 &&
-                               (poOptionsOld->dfRadius1 > 0.0 ||
-                                poOptionsOld->dfRadius2 > 0.0));
+            bCreateKDTree = (nPoints > nPointCountThreshold &&
+                             poOptionsOld->dfAngle == 0.0);
             break;
         }
         case GGA_MetricMinimum:
@@ -3218,6 +3634,8 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     psContext->sExtraParameters.pafZ = pafZAligned;
     psContext->sExtraParameters.psTriangulation = nullptr;
     psContext->sExtraParameters.nInitialFacetIdx = 0;
+    psContext->sExtraParameters.poKDTree = nullptr;
+    psContext->sExtraParameters.panNeighbours = nullptr;
     psContext->padfX = pafXAligned ? nullptr : const_cast<double *>(padfX);
     psContext->padfY = pafXAligned ? nullptr : const_cast<double *>(padfY);
     psContext->padfZ = pafXAligned ? nullptr : const_cast<double *>(padfZ);
@@ -3240,6 +3658,20 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*  Create KD-tree if requested.                                        */
+    /* -------------------------------------------------------------------- */
+    if (bCreateKDTree)
+    {
+        psContext->sExtraParameters.poKDTree =
+            GDALGridKDTree::Create(nPoints, padfX, padfY);
+        if (psContext->sExtraParameters.poKDTree == nullptr)
+        {
+            GDALGridContextFree(psContext);
+            return nullptr;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*  Pre-compute extra parameters in GDALGridExtraParameters              */
     /* -------------------------------------------------------------------- */
@@ -3372,6 +3804,7 @@ void GDALGridContextFree(GDALGridContext *psContext)
         CPLFree(psContext->pasGridPoints);
         if (psContext->sExtraParameters.hQuadTree != nullptr)
             CPLQuadTreeDestroy(psContext->sExtraParameters.hQuadTree);
+        delete psContext->sExtraParameters.poKDTree;
         if (psContext->bFreePadfXYZArrays)
         {
             CPLFree(psContext->padfX);
@@ -3494,12 +3927,17 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         }
     }
 
+    const GUInt32 nTileCount =
+        ((nXSize + GRID_TILE_SIZE - 1) / GRID_TILE_SIZE) *
+        ((nYSize + GRID_TILE_SIZE - 1) / GRID_TILE_SIZE);
+
     int nCounter = 0;
     volatile int bStop = FALSE;
     GDALGridJob sJob;
-    sJob.nYStart = 0;
+    sJob.nTileStart = 0;
     sJob.pabyData = static_cast<GByte *>(pData);
-    sJob.nYStep = 1;
+    sJob.nTileStep = 1;
+    sJob.nTileCount = nTileCount;
     sJob.nXSize = nXSize;
     sJob.nYSize = nYSize;
     sJob.dfXMin = dfXMin;
@@ -3538,7 +3976,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         GDALGridJob *pasJobs = static_cast<GDALGridJob *>(
             CPLMalloc(sizeof(GDALGridJob) * nThreads));
 
-        sJob.nYStep = nThreads;
+        sJob.nTileStep = nThreads;
         sJob.hCondMutex = CPLCreateMutex(); /* and  implicitly take the mutex */
         sJob.hCond = CPLCreateCond();
         sJob.pfnProgress = GDALGridProgressMultiThread;
@@ -3551,7 +3989,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         for (int i = 0; i < nThreads && !bStop; i++)
         {
             memcpy(&pasJobs[i], &sJob, sizeof(GDALGridJob));
-            pasJobs[i].nYStart = i;
+            pasJobs[i].nTileStart = i;
             psContext->poWorkerThreadPool->SubmitJob(GDALGridJobProcess,
                                                      &pasJobs[i]);
         }
@@ -3561,7 +3999,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         /*      Report progress. */
         /* --------------------------------------------------------------------
          */
-        while (*(sJob.pnCounter) < static_cast<int>(nYSize) && !bStop)
+        while (*(sJob.pnCounter) < static_cast<int>(nTileCount) && !bStop)
         {
             CPLCondWait(sJob.hCond, sJob.hCondMutex);
 
@@ -3569,8 +4007,8 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
             CPLReleaseMutex(sJob.hCondMutex);
 
             if (pfnProgress != nullptr &&
-                !pfnProgress(nLocalCounter / static_cast<double>(nYSize), "",
-                             pProgressArg))
+                !pfnProgress(nLocalCounter / static_cast<double>(nTileCount),
+                             "", pProgressArg))
             {
                 CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
                 bStop = TRUE;
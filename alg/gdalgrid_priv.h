@@ -35,8 +35,13 @@
 
 #include "gdal_alg.h"
 
+#include <utility>
+#include <vector>
+
 //! @cond Doxygen_Suppress
 
+class GDALGridKDTree;
+
 typedef struct
 {
     const double *padfX;
@@ -62,6 +67,10 @@ typedef struct
     double dfPowerDiv2PreComp;
     /*! The radius of search circle squared (pre-computation). */
     double dfRadiusPower2PreComp;
+    /*! KD-tree of the points, shared by all threads, or nullptr. */
+    const GDALGridKDTree *poKDTree;
+    /*! Scratch buffer for neighbour queries, private to each job. */
+    std::vector<std::pair<double, GUInt32>> *panNeighbours;
 } GDALGridExtraParameters;
 
 #ifdef HAVE_SSE_AT_COMPILE_TIME
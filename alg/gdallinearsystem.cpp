@@ -37,6 +37,11 @@
 #include "cpl_conv.h"
 #include "gdallinearsystem.h"
 
+#ifndef HAVE_ARMADILLO
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+#endif
+
 #ifdef HAVE_ARMADILLO
 #include "armadillo_headers.h"
 #endif
@@ -45,13 +50,50 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <memory>
 
 #ifndef HAVE_ARMADILLO
 namespace
 {
+// Minimum number of columns of the trailing sub-matrix processed by a
+// single job of the parallel LU update.
+constexpr int MIN_COLS_PER_JOB = 64;
+
+struct LUUpdateJob
+{
+    GDALMatrix *A = nullptr;
+    int step = 0;
+    int iColStart = 0;
+    int iColEnd = 0;
+};
+
+// Update columns [iColStart, iColEnd[ of the trailing sub-matrix once
+// column step has been divided by the pivot. Columns are independent from
+// each other, and contiguous in memory given the column-major storage.
+void LUUpdateColumns(GDALMatrix &A, int step, int iColStart, int iColEnd)
+{
+    int const m = A.getNumRows();
+    for (int iCol = iColStart; iCol < iColEnd; ++iCol)
+    {
+        const double dfPivotRow = A(step, iCol);
+        for (int iRow = step + 1; iRow < m; ++iRow)
+        {
+            A(iRow, iCol) -= A(iRow, step) * dfPivotRow;
+        }
+    }
+}
+
+void LUUpdateColumnsJob(void *pData)
+{
+    const LUUpdateJob *psJob = static_cast<const LUUpdateJob *>(pData);
+    LUUpdateColumns(*(psJob->A), psJob->step, psJob->iColStart,
+                    psJob->iColEnd);
+}
+
 // LU decomposition of the quadratic matrix A
 // see https://en.wikipedia.org/wiki/LU_decomposition#C_code_examples
-bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
+bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps,
+           int nNumThreads)
 {
     assert(A.getNumRows() == A.getNumCols());
     if (eps < 0)
@@ -63,6 +105,18 @@ bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
     for (int iRow = 0; iRow < m; ++iRow)
         perm[iRow] = iRow;
 
+    // The O(m^3) trailing update dominates for large systems (e.g. thin
+    // plate splines with thousands of GCPs): split it by column ranges.
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nNumThreads > 1 && m > 2 * MIN_COLS_PER_JOB)
+    {
+        poThreadPool = GDALGetGlobalThreadPool(nNumThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    std::vector<LUUpdateJob> asJobs;
+
     for (int step = 0; step < m - 1; ++step)
     {
         // determine pivot element
@@ -95,12 +149,30 @@ bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
         {
             A(iRow, step) /= A(step, step);
         }
-        for (int iCol = step + 1; iCol < m; ++iCol)
+        const int nRemainingCols = m - (step + 1);
+        const int nJobs =
+            poJobQueue
+                ? std::min(nNumThreads, nRemainingCols / MIN_COLS_PER_JOB)
+                : 1;
+        if (nJobs > 1)
         {
-            for (int iRow = step + 1; iRow < m; ++iRow)
+            asJobs.resize(nJobs);
+            for (int iJob = 0; iJob < nJobs; ++iJob)
             {
-                A(iRow, iCol) -= A(iRow, step) * A(step, iCol);
+                auto &sJob = asJobs[iJob];
+                sJob.A = &A;
+                sJob.step = step;
+                const int nColsPerJob = nRemainingCols / nJobs;
+                sJob.iColStart = step + 1 + iJob * nColsPerJob;
+                sJob.iColEnd =
+                    iJob + 1 == nJobs ? m : sJob.iColStart + nColsPerJob;
+                poJobQueue->SubmitJob(LUUpdateColumnsJob, &sJob);
             }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            LUUpdateColumns(A, step, step + 1, m);
         }
     }
 
@@ -133,8 +205,11 @@ bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
 /*                                                                      */
 /*   Solves the linear system A*X_i = RHS_i for each column i           */
 /*   where A is a square matrix.                                        */
+/*   nNumThreads is only used by the built-in LU solver, Armadillo      */
+/*   relying on the threading of its BLAS/LAPACK backend.               */
 /************************************************************************/
-bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X)
+bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X,
+                           [[maybe_unused]] int nNumThreads)
 {
     assert(A.getNumRows() == RHS.getNumRows());
     assert(A.getNumCols() == X.getNumRows());
@@ -157,7 +232,7 @@ bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X)
 #endif
 
 #else  // HAVE_ARMADILLO
-        return solve(A, RHS, X, 0);
+        return solve(A, RHS, X, 0, nNumThreads);
 #endif
     }
     catch (std::exception const &e)
@@ -100,7 +100,8 @@ struct GDALMatrix
     std::vector<double> v;
 };
 
-bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X);
+bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X,
+                           int nNumThreads = 1);
 
 #endif /* #ifndef GDALLINEARSYSTEM_H_INCLUDED */
 
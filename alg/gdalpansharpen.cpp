@@ -613,6 +613,27 @@ template <class T> static inline T ClampAndRound(double dfVal, T nMaxValue)
         return static_cast<T>(dfVal + 0.5);
 }
 
+/************************************************************************/
+/*                         BroveyOutputValue()                          */
+/************************************************************************/
+
+// Conversion of a pansharpened value to the output type of the fast paths:
+// integer values are clamped and rounded, floating-point ones just converted.
+template <class T> static inline T BroveyOutputValue(double dfVal, T nMaxValue)
+{
+    if constexpr (std::numeric_limits<T>::is_integer)
+    {
+        return ClampAndRound(dfVal, nMaxValue);
+    }
+    else
+    {
+        CPL_IGNORE_RET_VAL(nMaxValue);
+        T val;
+        GDALCopyWord(dfVal, val);
+        return val;
+    }
+}
+
 /************************************************************************/
 /*                         WeightedBrovey()                             */
 /************************************************************************/
@@ -690,7 +711,7 @@ size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
 
     const XMMReg4Double zero = XMMReg4Double::Zero();
     double dfMaxValue = nMaxValue;
-    const XMMReg4Double maxValue =
+    [[maybe_unused]] const XMMReg4Double maxValue =
         XMMReg4Double::Load1ValHighAndLow(&dfMaxValue);
 
     size_t j = 0;  // Used after for.
@@ -723,12 +744,27 @@ size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
             XMMReg4Double::NotEquals(pseudoPanchro, zero),
             XMMReg4Double::Load4Val(pPanBuffer + j) / pseudoPanchro);
 
-        val0 = XMMReg4Double::Min(val0 * factor, maxValue);
-        val1 = XMMReg4Double::Min(val1 * factor, maxValue);
-        val2 = XMMReg4Double::Min(val2 * factor, maxValue);
-        if constexpr (NOUTPUT == 4)
+        if constexpr (std::numeric_limits<T>::is_integer)
+        {
+            val0 = XMMReg4Double::Min(val0 * factor, maxValue);
+            val1 = XMMReg4Double::Min(val1 * factor, maxValue);
+            val2 = XMMReg4Double::Min(val2 * factor, maxValue);
+            if constexpr (NOUTPUT == 4)
+            {
+                val3 = XMMReg4Double::Min(val3 * factor, maxValue);
+            }
+        }
+        else
         {
-            val3 = XMMReg4Double::Min(val3 * factor, maxValue);
+            // No clamping, so that infinite values are propagated as in
+            // the scalar code path.
+            val0 = val0 * factor;
+            val1 = val1 * factor;
+            val2 = val2 * factor;
+            if constexpr (NOUTPUT == 4)
+            {
+                val3 = val3 * factor;
+            }
         }
         val0.Store4Val(pDataBuf + 0 * nBandValues + j);
         val1.Store4Val(pDataBuf + 1 * nBandValues + j);
@@ -789,12 +825,12 @@ size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
         {
             T nRawValue = pUpsampledSpectralBuffer[i * nBandValues + j];
             double dfTmp = nRawValue * dfFactor;
-            pDataBuf[i * nBandValues + j] = ClampAndRound(dfTmp, nMaxValue);
+            pDataBuf[i * nBandValues + j] = BroveyOutputValue(dfTmp, nMaxValue);
 
             T nRawValue2 = pUpsampledSpectralBuffer[i * nBandValues + j + 1];
             double dfTmp2 = nRawValue2 * dfFactor2;
             pDataBuf[i * nBandValues + j + 1] =
-                ClampAndRound(dfTmp2, nMaxValue);
+                BroveyOutputValue(dfTmp2, nMaxValue);
         }
     }
     return j;
@@ -874,14 +910,15 @@ void GDALPansharpenOperation::WeightedBroveyPositiveWeights(
                 const T nRawValue = pUpsampledSpectralBuffer
                     [psOptions->panOutPansharpenedBands[i] * nBandValues + j];
                 const double dfTmp = nRawValue * dfFactor;
-                pDataBuf[i * nBandValues + j] = ClampAndRound(dfTmp, nMaxValue);
+                pDataBuf[i * nBandValues + j] =
+                    BroveyOutputValue(dfTmp, nMaxValue);
 
                 const T nRawValue2 = pUpsampledSpectralBuffer
                     [psOptions->panOutPansharpenedBands[i] * nBandValues + j +
                      1];
                 const double dfTmp2 = nRawValue2 * dfFactor2;
                 pDataBuf[i * nBandValues + j + 1] =
-                    ClampAndRound(dfTmp2, nMaxValue);
+                    BroveyOutputValue(dfTmp2, nMaxValue);
             }
         }
     }
@@ -901,7 +938,7 @@ void GDALPansharpenOperation::WeightedBroveyPositiveWeights(
                                              nBandValues +
                                          j];
             double dfTmp = nRawValue * dfFactor;
-            pDataBuf[i * nBandValues + j] = ClampAndRound(dfTmp, nMaxValue);
+            pDataBuf[i * nBandValues + j] = BroveyOutputValue(dfTmp, nMaxValue);
         }
     }
 }
@@ -925,7 +962,7 @@ void GDALPansharpenOperation::WeightedBrovey(
 }
 
 template <class T>
-void GDALPansharpenOperation::WeightedBroveyGByteOrUInt16(
+void GDALPansharpenOperation::WeightedBroveySameType(
     const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
     size_t nValues, size_t nBandValues, T nMaxValue) const
 {
@@ -952,8 +989,8 @@ void GDALPansharpenOperation::WeightedBrovey<GByte, GByte>(
     const GByte *pPanBuffer, const GByte *pUpsampledSpectralBuffer,
     GByte *pDataBuf, size_t nValues, size_t nBandValues, GByte nMaxValue) const
 {
-    WeightedBroveyGByteOrUInt16(pPanBuffer, pUpsampledSpectralBuffer, pDataBuf,
-                                nValues, nBandValues, nMaxValue);
+    WeightedBroveySameType(pPanBuffer, pUpsampledSpectralBuffer, pDataBuf,
+                           nValues, nBandValues, nMaxValue);
 }
 
 template <>
@@ -962,8 +999,17 @@ void GDALPansharpenOperation::WeightedBrovey<GUInt16, GUInt16>(
     GUInt16 *pDataBuf, size_t nValues, size_t nBandValues,
     GUInt16 nMaxValue) const
 {
-    WeightedBroveyGByteOrUInt16(pPanBuffer, pUpsampledSpectralBuffer, pDataBuf,
-                                nValues, nBandValues, nMaxValue);
+    WeightedBroveySameType(pPanBuffer, pUpsampledSpectralBuffer, pDataBuf,
+                           nValues, nBandValues, nMaxValue);
+}
+
+template <>
+void GDALPansharpenOperation::WeightedBrovey<float, float>(
+    const float *pPanBuffer, const float *pUpsampledSpectralBuffer,
+    float *pDataBuf, size_t nValues, size_t nBandValues, float nMaxValue) const
+{
+    WeightedBroveySameType(pPanBuffer, pUpsampledSpectralBuffer, pDataBuf,
+                           nValues, nBandValues, nMaxValue);
 }
 
 template <class WorkDataType>
@@ -1106,9 +1152,10 @@ CPLErr GDALPansharpenOperation::WeightedBrovey(
             break;
 
         case GDT_Float32:
-            WeightedBrovey3<WorkDataType, float, FALSE>(
-                pPanBuffer, pUpsampledSpectralBuffer,
-                static_cast<float *>(pDataBuf), nValues, nBandValues, 0);
+            // Goes through the SIMD code path when WorkDataType is float.
+            WeightedBrovey(pPanBuffer, pUpsampledSpectralBuffer,
+                           static_cast<float *>(pDataBuf), nValues, nBandValues,
+                           static_cast<WorkDataType>(0));
             break;
 #endif
 
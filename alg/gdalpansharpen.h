@@ -247,10 +247,10 @@ class GDALPansharpenOperation
 
     // cppcheck-suppress unusedPrivateFunction
     template <class T>
-    void WeightedBroveyGByteOrUInt16(const T *pPanBuffer,
-                                     const T *pUpsampledSpectralBuffer,
-                                     T *pDataBuf, size_t nValues,
-                                     size_t nBandValues, T nMaxValue) const;
+    void WeightedBroveySameType(const T *pPanBuffer,
+                                const T *pUpsampledSpectralBuffer, T *pDataBuf,
+                                size_t nValues, size_t nBandValues,
+                                T nMaxValue) const;
 
     // cppcheck-suppress functionStatic
     CPLErr PansharpenChunk(GDALDataType eWorkDataType,
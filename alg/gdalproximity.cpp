@@ -34,6 +34,8 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -41,6 +43,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -49,6 +52,303 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+/************************************************************************/
+/*                   GDALComputeProximityExact()                        */
+/*                                                                      */
+/*      Exact Euclidean distance transform, using the separable         */
+/*      algorithm of Felzenszwalb & Huttenlocher ("Distance             */
+/*      Transforms of Sampled Functions", 2012): a 1D distance          */
+/*      transform along columns, followed by a lower envelope of        */
+/*      parabolas along rows. Each step is linear in the number of      */
+/*      pixels and independent of MAXDIST. The whole raster is kept     */
+/*      in memory as a float buffer.                                    */
+/************************************************************************/
+
+namespace
+{
+struct GDALProximityExactJob
+{
+    float *pafBuffer = nullptr;
+    const GByte *pabyNoDataMask = nullptr;
+    int nXSize = 0;
+    int nYSize = 0;
+    int iStart = 0;
+    int iEnd = 0;
+    double dfMaxDist = 0;
+    double dfDistMult = 1;
+    float fNoDataValue = 0;
+    bool bFixedBufVal = false;
+    double dfFixedBufVal = 0;
+};
+}  // namespace
+
+// Value used for pixels whose column holds no target.
+constexpr float PROXIMITY_EXACT_INF = 1e30f;
+
+// Vertical 1D distance transform of columns [iStart, iEnd[. Rows are
+// swept for all columns of the range at once to stay cache friendly.
+static void GDALProximityExactColumnsFunc(void *pData)
+{
+    const auto &sJob = *static_cast<const GDALProximityExactJob *>(pData);
+    const size_t nXSize = sJob.nXSize;
+    float *const pafBuffer = sJob.pafBuffer;
+
+    for (int iY = 1; iY < sJob.nYSize; ++iY)
+    {
+        float *pafLine = pafBuffer + iY * nXSize;
+        const float *pafPrevLine = pafLine - nXSize;
+        for (int iX = sJob.iStart; iX < sJob.iEnd; ++iX)
+            pafLine[iX] = std::min(pafLine[iX], pafPrevLine[iX] + 1.0f);
+    }
+    for (int iY = sJob.nYSize - 2; iY >= 0; --iY)
+    {
+        float *pafLine = pafBuffer + iY * nXSize;
+        const float *pafNextLine = pafLine + nXSize;
+        for (int iX = sJob.iStart; iX < sJob.iEnd; ++iX)
+            pafLine[iX] = std::min(pafLine[iX], pafNextLine[iX] + 1.0f);
+    }
+}
+
+// Horizontal pass on rows [iStart, iEnd[: lower envelope of the parabolas
+// rooted at each pixel with the squared vertical distance as offset, then
+// conversion of the squared distances to final output values.
+static void GDALProximityExactRowsFunc(void *pData)
+{
+    const auto &sJob = *static_cast<const GDALProximityExactJob *>(pData);
+    const int nXSize = sJob.nXSize;
+    const double dfMaxDistSq = sJob.dfMaxDist * sJob.dfMaxDist;
+
+    std::vector<double> adfF(nXSize);
+    std::vector<int> anV(nXSize);
+    std::vector<double> adfZ(static_cast<size_t>(nXSize) + 1);
+
+    for (int iY = sJob.iStart; iY < sJob.iEnd; ++iY)
+    {
+        float *pafLine = sJob.pafBuffer + static_cast<size_t>(iY) * nXSize;
+        for (int iX = 0; iX < nXSize; ++iX)
+        {
+            const double dfG = pafLine[iX];
+            adfF[iX] = dfG * dfG;
+        }
+
+        int k = 0;
+        anV[0] = 0;
+        adfZ[0] = -std::numeric_limits<double>::infinity();
+        adfZ[1] = std::numeric_limits<double>::infinity();
+        const auto Intersection = [&adfF](int q, int v)
+        {
+            return ((adfF[q] + static_cast<double>(q) * q) -
+                    (adfF[v] + static_cast<double>(v) * v)) /
+                   (2.0 * (q - v));
+        };
+        for (int q = 1; q < nXSize; ++q)
+        {
+            double dfS = Intersection(q, anV[k]);
+            while (dfS <= adfZ[k])
+            {
+                --k;
+                dfS = Intersection(q, anV[k]);
+            }
+            ++k;
+            anV[k] = q;
+            adfZ[k] = dfS;
+            adfZ[k + 1] = std::numeric_limits<double>::infinity();
+        }
+
+        k = 0;
+        for (int q = 0; q < nXSize; ++q)
+        {
+            while (adfZ[k + 1] < q)
+                ++k;
+            const int v = anV[k];
+            const double dfDistSq =
+                static_cast<double>(q - v) * (q - v) + adfF[v];
+
+            if (sJob.pabyNoDataMask &&
+                sJob.pabyNoDataMask[static_cast<size_t>(iY) * nXSize + q])
+                pafLine[q] = sJob.fNoDataValue;
+            else if (dfDistSq > dfMaxDistSq)
+                pafLine[q] = sJob.fNoDataValue;
+            else if (dfDistSq == 0)
+                pafLine[q] = 0.0f;
+            else if (sJob.bFixedBufVal)
+                pafLine[q] = static_cast<float>(sJob.dfFixedBufVal);
+            else
+                pafLine[q] =
+                    static_cast<float>(sqrt(dfDistSq) * sJob.dfDistMult);
+        }
+    }
+}
+
+static CPLErr GDALComputeProximityExact(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hProximityBand, int nXSize,
+    int nYSize, double dfMaxDist, double dfDistMult,
+    const double *pdfSrcNoDataValue, float fNoDataValue, bool bFixedBufVal,
+    double dfFixedBufVal, int nTargetValues, const int *panTargetValues,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    /* -------------------------------------------------------------------- */
+    /*      Allocate the working buffers for the whole raster.              */
+    /* -------------------------------------------------------------------- */
+    float *pafBuffer = static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nYSize, sizeof(float)));
+    GByte *pabyNoDataMask =
+        pdfSrcNoDataValue
+            ? static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, nYSize))
+            : nullptr;
+    std::vector<GInt32> anSrcScanline;
+    CPLErr eErr = CE_None;
+    if (pafBuffer == nullptr ||
+        (pdfSrcNoDataValue != nullptr && pabyNoDataMask == nullptr))
+    {
+        eErr = CE_Failure;
+    }
+    else
+    {
+        try
+        {
+            anSrcScanline.resize(nXSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the source band and seed target pixels with 0.             */
+    /* -------------------------------------------------------------------- */
+    for (int iLine = 0; eErr == CE_None && iLine < nYSize; iLine++)
+    {
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, 1,
+                            anSrcScanline.data(), nXSize, 1, GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        float *pafLine = pafBuffer + static_cast<size_t>(iLine) * nXSize;
+        for (int i = 0; i < nXSize; i++)
+        {
+            const GInt32 nVal = anSrcScanline[i];
+            bool bIsTarget = false;
+            if (nTargetValues == 0)
+            {
+                bIsTarget = nVal != 0;
+            }
+            else
+            {
+                for (int j = 0; j < nTargetValues; j++)
+                {
+                    if (nVal == panTargetValues[j])
+                    {
+                        bIsTarget = true;
+                        break;
+                    }
+                }
+            }
+            pafLine[i] = bIsTarget ? 0.0f : PROXIMITY_EXACT_INF;
+            if (!bIsTarget && pabyNoDataMask && nVal == *pdfSrcNoDataValue)
+                pabyNoDataMask[static_cast<size_t>(iLine) * nXSize + i] = 1;
+        }
+
+        if (!pfnProgress(0.3 * (iLine + 1) / static_cast<double>(nYSize), "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Run the column pass, then the row pass, each split in           */
+    /*      independent jobs.                                               */
+    /* -------------------------------------------------------------------- */
+    if (eErr == CE_None)
+    {
+        nThreads = std::max(1, std::min(nThreads, std::min(nXSize, nYSize)));
+        CPLWorkerThreadPool *poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (!poJobQueue)
+            nThreads = 1;
+
+        std::vector<GDALProximityExactJob> asJobs(nThreads);
+        for (auto &sJob : asJobs)
+        {
+            sJob.pafBuffer = pafBuffer;
+            sJob.pabyNoDataMask = pabyNoDataMask;
+            sJob.nXSize = nXSize;
+            sJob.nYSize = nYSize;
+            sJob.dfMaxDist = dfMaxDist;
+            sJob.dfDistMult = dfDistMult;
+            sJob.fNoDataValue = fNoDataValue;
+            sJob.bFixedBufVal = bFixedBufVal;
+            sJob.dfFixedBufVal = dfFixedBufVal;
+        }
+
+        const auto RunPass = [&](CPLThreadFunc pfnFunc, int nSize)
+        {
+            for (int i = 0; i < nThreads; ++i)
+            {
+                const GIntBig nSize64 = nSize;
+                asJobs[i].iStart = static_cast<int>(nSize64 * i / nThreads);
+                asJobs[i].iEnd = static_cast<int>(nSize64 * (i + 1) / nThreads);
+            }
+            if (poJobQueue)
+            {
+                for (auto &sJob : asJobs)
+                    poJobQueue->SubmitJob(pfnFunc, &sJob);
+                poJobQueue->WaitCompletion();
+            }
+            else
+            {
+                pfnFunc(&asJobs[0]);
+            }
+        };
+
+        RunPass(GDALProximityExactColumnsFunc, nXSize);
+        if (!pfnProgress(0.45, "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        else
+        {
+            RunPass(GDALProximityExactRowsFunc, nYSize);
+            if (!pfnProgress(0.6, "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Write out results.                                              */
+    /* -------------------------------------------------------------------- */
+    for (int iLine = 0; eErr == CE_None && iLine < nYSize; iLine++)
+    {
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iLine, nXSize, 1,
+                            pafBuffer + static_cast<size_t>(iLine) * nXSize,
+                            nXSize, 1, GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        if (!pfnProgress(0.6 + 0.4 * (iLine + 1) / static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    CPLFree(pafBuffer);
+    CPLFree(pabyNoDataMask);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -105,6 +405,21 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threadhold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[APPROXIMATE]/EXACT
+
+(GDAL >= 3.10) The default APPROXIMATE algorithm propagates the nearest
+target found through forward and backward scanline sweeps. Its cost grows
+with MAXDIST and the distances it returns may be slightly overestimated.
+The EXACT algorithm computes an exact Euclidean distance transform whose
+cost is linear in the number of pixels, independently of MAXDIST. It
+needs to hold the whole raster in memory (about 4 bytes per pixel, plus 1
+byte per pixel when USE_INPUT_NODATA is set).
+
+  NUM_THREADS=n/ALL_CPUS
+
+(GDAL >= 3.10) Number of worker threads used by ALGORITHM=EXACT.
+Defaults to 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -251,6 +566,41 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Dispatch to the exact distance transform if requested.          */
+    /* -------------------------------------------------------------------- */
+    const char *pszAlgorithm =
+        CSLFetchNameValueDef(papszOptions, "ALGORITHM", "APPROXIMATE");
+    if (EQUAL(pszAlgorithm, "EXACT"))
+    {
+        const char *pszNumThreads =
+            CSLFetchNameValue(papszOptions, "NUM_THREADS");
+        int nThreads = 1;
+        if (pszNumThreads)
+        {
+            nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads);
+            nThreads = std::max(1, std::min(128, nThreads));
+        }
+
+        const CPLErr eErr = GDALComputeProximityExact(
+            hSrcBand, hProximityBand, nXSize, nYSize, dfMaxDist, dfDistMult,
+            pdfSrcNoData, fNoDataValue, bFixedBufVal, dfFixedBufVal,
+            nTargetValues, panTargetValues, nThreads, pfnProgress,
+            pProgressArg);
+        CPLFree(panTargetValues);
+        return eErr;
+    }
+    else if (!EQUAL(pszAlgorithm, "APPROXIMATE"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported ALGORITHM value '%s', should be APPROXIMATE or "
+                 "EXACT.",
+                 pszAlgorithm);
+        CPLFree(panTargetValues);
+        return CE_Failure;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      We need a signed type for the working proximity values kept     */
     /*      on disk.  If our proximity band is not signed, then create a    */
@@ -39,6 +39,8 @@
 #include <limits>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <memory>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -48,6 +50,7 @@
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -1388,6 +1391,258 @@ static CPLErr GDALRasterizeGeometriesInternal(
     return eErr;
 }
 
+/************************************************************************/
+/*                       GDALRasterizeLayerTiled()                      */
+/************************************************************************/
+
+namespace
+{
+// Geometry of a feature, kept in memory by GDALRasterizeLayerTiled()
+struct GDALRasterizeTiledGeom
+{
+    std::unique_ptr<OGRGeometry> poGeom{};
+    double dfAttrValue = 0;
+};
+
+// State shared by the worker threads of GDALRasterizeLayerTiled()
+struct GDALRasterizeTiledContext
+{
+    std::vector<GDALRasterizeTiledGeom> asGeoms{};
+    // Indices in asGeoms[] of the geometries intersecting each stripe
+    std::vector<std::vector<size_t>> aanStripeGeoms{};
+    int nStripeHeight = 0;
+
+    unsigned char *pabyChunkBuf = nullptr;
+    int nXSize = 0;
+    int nBandCount = 0;
+    GDALDataType eType = GDT_Unknown;
+    int bAllTouched = FALSE;
+    bool bUseAttrValue = false;
+    const double *padfBurnValues = nullptr;
+    GDALBurnValueSrc eBurnValueSource = GBV_UserBurnValue;
+    GDALRasterMergeAlg eMergeAlg = GRMA_Replace;
+    GDALTransformerFunc pfnTransformer = nullptr;
+
+    // Current swath
+    int iY = 0;
+    int nThisYChunkSize = 0;
+    int nLastStripe = 0;
+    std::atomic<int> nNextStripe{0};
+};
+
+// Per-thread state of GDALRasterizeLayerTiled()
+struct GDALRasterizeTiledWorker
+{
+    GDALRasterizeTiledContext *psContext = nullptr;
+    void *pTransformArg = nullptr;
+    std::vector<double> adfAttrValues{};
+};
+}  // namespace
+
+static void GDALRasterizeTiledWorkerFunc(void *pData)
+{
+    auto psWorker = static_cast<GDALRasterizeTiledWorker *>(pData);
+    auto psContext = psWorker->psContext;
+    const GSpacing nLineSpace =
+        static_cast<GSpacing>(psContext->nXSize) *
+        GDALGetDataTypeSizeBytes(psContext->eType);
+    const GSpacing nBandSpace = nLineSpace * psContext->nThisYChunkSize;
+
+    // Stripes do not overlap, so each one can be burnt in the swath buffer
+    // without synchronization. Within a stripe, geometries are burnt in the
+    // order of the layer, as in the non-tiled mode.
+    while (true)
+    {
+        const int iStripe = psContext->nNextStripe++;
+        if (iStripe > psContext->nLastStripe)
+            break;
+        const int nRowStart =
+            std::max(psContext->iY, iStripe * psContext->nStripeHeight);
+        const int nRowEnd =
+            std::min(psContext->iY + psContext->nThisYChunkSize,
+                     (iStripe + 1) * psContext->nStripeHeight);
+        unsigned char *pabyStripeBuf =
+            psContext->pabyChunkBuf + (nRowStart - psContext->iY) * nLineSpace;
+
+        for (const size_t iGeom : psContext->aanStripeGeoms[iStripe])
+        {
+            const auto &oGeom = psContext->asGeoms[iGeom];
+            const double *padfBurnValues = psContext->padfBurnValues;
+            if (psContext->bUseAttrValue)
+            {
+                std::fill(psWorker->adfAttrValues.begin(),
+                          psWorker->adfAttrValues.end(), oGeom.dfAttrValue);
+                padfBurnValues = psWorker->adfAttrValues.data();
+            }
+
+            gv_rasterize_one_shape(
+                pabyStripeBuf, 0, nRowStart, psContext->nXSize,
+                nRowEnd - nRowStart, psContext->nBandCount, psContext->eType,
+                0, nLineSpace, nBandSpace, psContext->bAllTouched,
+                oGeom.poGeom.get(), GDT_Float64, padfBurnValues, nullptr,
+                psContext->eBurnValueSource, psContext->eMergeAlg,
+                psContext->pfnTransformer, psWorker->pTransformArg);
+        }
+    }
+}
+
+// Rasterize a layer by reading its features only once, binning them into
+// horizontal stripes of the output raster according to the range of rows
+// they cover, and rasterizing the stripes of each swath in parallel.
+// All the geometries of the layer are kept in memory.
+static CPLErr GDALRasterizeLayerTiled(
+    GDALDataset *poDS, OGRLayer *poLayer, int nBandCount, int *panBandList,
+    unsigned char *pabyChunkBuf, int nYChunkSize, GDALDataType eType,
+    int bAllTouched, int iBurnField, const double *padfBurnValues,
+    GDALBurnValueSrc eBurnValueSource, GDALRasterMergeAlg eMergeAlg,
+    GDALTransformerFunc pfnTransformer, void *pTransformArg, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+        return CE_Failure;
+
+    GDALRasterizeTiledContext sContext;
+    // Several stripes per thread in each swath, to balance the load
+    sContext.nStripeHeight = std::max(1, nYChunkSize / (4 * nThreads));
+    const int nStripes =
+        nYSize / sContext.nStripeHeight +
+        ((nYSize % sContext.nStripeHeight) != 0 ? 1 : 0);
+    sContext.aanStripeGeoms.resize(nStripes);
+    sContext.pabyChunkBuf = pabyChunkBuf;
+    sContext.nXSize = nXSize;
+    sContext.nBandCount = nBandCount;
+    sContext.eType = eType;
+    sContext.bAllTouched = bAllTouched;
+    sContext.bUseAttrValue = iBurnField >= 0;
+    sContext.padfBurnValues = padfBurnValues;
+    sContext.eBurnValueSource = eBurnValueSource;
+    sContext.eMergeAlg = eMergeAlg;
+    sContext.pfnTransformer = pfnTransformer;
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the features once and bin them into stripes.               */
+    /* -------------------------------------------------------------------- */
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<double> adfVariant;
+    std::vector<int> anPartSize;
+    std::vector<int> anSuccess;
+    poLayer->ResetReading();
+    for (auto &poFeat : poLayer)
+    {
+        std::unique_ptr<OGRGeometry> poGeom(poFeat->StealGeometry());
+        if (poGeom == nullptr || poGeom->IsEmpty())
+            continue;
+
+        adfX.clear();
+        adfY.clear();
+        anPartSize.clear();
+        GDALCollectRingsFromGeometry(poGeom.get(), adfX, adfY, adfVariant,
+                                     anPartSize, GBV_UserBurnValue);
+        if (adfX.empty())
+            continue;
+        anSuccess.resize(adfX.size());
+        pfnTransformer(pTransformArg, FALSE, static_cast<int>(adfX.size()),
+                       adfX.data(), adfY.data(), nullptr, anSuccess.data());
+
+        const auto oMinMaxX = std::minmax_element(adfX.begin(), adfX.end());
+        const auto oMinMaxY = std::minmax_element(adfY.begin(), adfY.end());
+        // Written that way to catch NaN
+        if (!(*oMinMaxX.second >= -1 && *oMinMaxX.first <= nXSize + 1 &&
+              *oMinMaxY.second >= -1 && *oMinMaxY.first <= nYSize + 1))
+        {
+            continue;
+        }
+        // Add a margin of one row for the rounding done by the rasterizer
+        const int nRowMin = static_cast<int>(
+            std::max(0.0, std::floor(*oMinMaxY.first) - 1));
+        const int nRowMax = static_cast<int>(
+            std::min(nYSize - 1.0, std::floor(*oMinMaxY.second) + 1));
+
+        for (int iStripe = nRowMin / sContext.nStripeHeight;
+             iStripe <= nRowMax / sContext.nStripeHeight; ++iStripe)
+        {
+            sContext.aanStripeGeoms[iStripe].push_back(
+                sContext.asGeoms.size());
+        }
+
+        GDALRasterizeTiledGeom oGeom;
+        oGeom.poGeom = std::move(poGeom);
+        if (iBurnField >= 0)
+            oGeom.dfAttrValue = poFeat->GetFieldAsDouble(iBurnField);
+        sContext.asGeoms.push_back(std::move(oGeom));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Each worker thread has its own transformer.                     */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALRasterizeTiledWorker> asWorkers(nThreads);
+    CPLErr eErr = CE_None;
+    for (auto &sWorker : asWorkers)
+    {
+        sWorker.psContext = &sContext;
+        sWorker.adfAttrValues.resize(nBandCount);
+        sWorker.pTransformArg = GDALCloneTransformer(pTransformArg);
+        if (sWorker.pTransformArg == nullptr)
+            eErr = CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Loop over image in designated chunks.                           */
+    /* -------------------------------------------------------------------- */
+    for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nYChunkSize)
+    {
+        const int nThisYChunkSize = std::min(nYChunkSize, nYSize - iY);
+
+        // Only re-read image if not a single chunk is being rendered.
+        if (nYChunkSize < nYSize)
+        {
+            eErr = poDS->RasterIO(GF_Read, 0, iY, nXSize, nThisYChunkSize,
+                                  pabyChunkBuf, nXSize, nThisYChunkSize, eType,
+                                  nBandCount, panBandList, 0, 0, 0, nullptr);
+            if (eErr != CE_None)
+                break;
+        }
+
+        sContext.iY = iY;
+        sContext.nThisYChunkSize = nThisYChunkSize;
+        sContext.nLastStripe =
+            (iY + nThisYChunkSize - 1) / sContext.nStripeHeight;
+        sContext.nNextStripe = iY / sContext.nStripeHeight;
+        for (auto &sWorker : asWorkers)
+            poJobQueue->SubmitJob(GDALRasterizeTiledWorkerFunc, &sWorker);
+        poJobQueue->WaitCompletion();
+
+        // Only write image if not a single chunk is being rendered.
+        if (nYChunkSize < nYSize)
+        {
+            eErr = poDS->RasterIO(GF_Write, 0, iY, nXSize, nThisYChunkSize,
+                                  pabyChunkBuf, nXSize, nThisYChunkSize, eType,
+                                  nBandCount, panBandList, 0, 0, 0, nullptr);
+        }
+
+        if (!pfnProgress((iY + nThisYChunkSize) / static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    for (auto &sWorker : asWorkers)
+    {
+        if (sWorker.pTransformArg)
+            GDALDestroyTransformer(sWorker.pTransformArg);
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                        GDALRasterizeLayers()                         */
 /************************************************************************/
@@ -1442,6 +1697,11 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.10) Number of worker threads, or ALL_CPUS.
+ * When greater than 1, and no transformer is passed, the features of each
+ * layer are read only once and binned into horizontal stripes of the output
+ * raster, which are rasterized in parallel. All geometries of a layer are
+ * then kept in memory. Defaults to 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1488,6 +1748,15 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
         return CE_Failure;
     }
 
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    int nThreads = 1;
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Establish a chunksize to operate on.  The larger the chunk      */
     /*      size the less times we need to make a pass through all the      */
@@ -1645,79 +1914,93 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
             }
         }
 
-        poLayer->ResetReading();
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Loop over image in designated chunks. */
-        /* --------------------------------------------------------------------
-         */
+        if (nThreads > 1 && bNeedToFreeTransformer)
+        {
+            eErr = GDALRasterizeLayerTiled(
+                poDS, poLayer, nBandCount, panBandList, pabyChunkBuf,
+                nYChunkSize, eType, bAllTouched, iBurnField, padfBurnValues,
+                eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg,
+                nThreads, pfnProgress, pProgressArg);
+        }
+        else
+        {
+            poLayer->ResetReading();
 
-        double *padfAttrValues = static_cast<double *>(
-            VSI_MALLOC_VERBOSE(sizeof(double) * nBandCount));
-        if (padfAttrValues == nullptr)
-            eErr = CE_Failure;
+            /* ------------------------------------------------------------ */
+            /*      Loop over image in designated chunks.                   */
+            /* ------------------------------------------------------------ */
 
-        for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
-             iY += nYChunkSize)
-        {
-            int nThisYChunkSize = nYChunkSize;
-            if (nThisYChunkSize + iY > poDS->GetRasterYSize())
-                nThisYChunkSize = poDS->GetRasterYSize() - iY;
+            double *padfAttrValues = static_cast<double *>(
+                VSI_MALLOC_VERBOSE(sizeof(double) * nBandCount));
+            if (padfAttrValues == nullptr)
+                eErr = CE_Failure;
 
-            // Only re-read image if not a single chunk is being rendered.
-            if (nYChunkSize < poDS->GetRasterYSize())
+            for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
+                 iY += nYChunkSize)
             {
-                eErr = poDS->RasterIO(
-                    GF_Read, 0, iY, poDS->GetRasterXSize(), nThisYChunkSize,
-                    pabyChunkBuf, poDS->GetRasterXSize(), nThisYChunkSize,
-                    eType, nBandCount, panBandList, 0, 0, 0, nullptr);
-                if (eErr != CE_None)
-                    break;
-            }
+                int nThisYChunkSize = nYChunkSize;
+                if (nThisYChunkSize + iY > poDS->GetRasterYSize())
+                    nThisYChunkSize = poDS->GetRasterYSize() - iY;
 
-            for (auto &poFeat : poLayer)
-            {
-                OGRGeometry *poGeom = poFeat->GetGeometryRef();
+                // Only re-read image if not a single chunk is being rendered.
+                if (nYChunkSize < poDS->GetRasterYSize())
+                {
+                    eErr = poDS->RasterIO(
+                        GF_Read, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, pabyChunkBuf, poDS->GetRasterXSize(),
+                        nThisYChunkSize, eType, nBandCount, panBandList, 0, 0,
+                        0, nullptr);
+                    if (eErr != CE_None)
+                        break;
+                }
 
-                if (pszBurnAttribute)
+                for (auto &poFeat : poLayer)
                 {
-                    const double dfAttrValue =
-                        poFeat->GetFieldAsDouble(iBurnField);
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                        padfAttrValues[iBand] = dfAttrValue;
+                    OGRGeometry *poGeom = poFeat->GetGeometryRef();
 
-                    padfBurnValues = padfAttrValues;
-                }
+                    if (pszBurnAttribute)
+                    {
+                        const double dfAttrValue =
+                            poFeat->GetFieldAsDouble(iBurnField);
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
+                            padfAttrValues[iBand] = dfAttrValue;
 
-                gv_rasterize_one_shape(
-                    pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
-                    nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    poGeom, GDT_Float64, padfBurnValues, nullptr,
-                    eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
-            }
+                        padfBurnValues = padfAttrValues;
+                    }
 
-            // Only write image if not a single chunk is being rendered.
-            if (nYChunkSize < poDS->GetRasterYSize())
-            {
-                eErr = poDS->RasterIO(
-                    GF_Write, 0, iY, poDS->GetRasterXSize(), nThisYChunkSize,
-                    pabyChunkBuf, poDS->GetRasterXSize(), nThisYChunkSize,
-                    eType, nBandCount, panBandList, 0, 0, 0, nullptr);
-            }
+                    gv_rasterize_one_shape(
+                        pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, nBandCount, eType, 0, 0, 0,
+                        bAllTouched, poGeom, GDT_Float64, padfBurnValues,
+                        nullptr, eBurnValueSource, eMergeAlg, pfnTransformer,
+                        pTransformArg);
+                }
 
-            poLayer->ResetReading();
+                // Only write image if not a single chunk is being rendered.
+                if (nYChunkSize < poDS->GetRasterYSize())
+                {
+                    eErr = poDS->RasterIO(
+                        GF_Write, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, pabyChunkBuf, poDS->GetRasterXSize(),
+                        nThisYChunkSize, eType, nBandCount, panBandList, 0, 0,
+                        0, nullptr);
+                }
 
-            if (!pfnProgress((iY + nThisYChunkSize) /
-                                 static_cast<double>(poDS->GetRasterYSize()),
-                             "", pProgressArg))
-            {
-                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                eErr = CE_Failure;
+                poLayer->ResetReading();
+
+                if (!pfnProgress(
+                        (iY + nThisYChunkSize) /
+                            static_cast<double>(poDS->GetRasterYSize()),
+                        "", pProgressArg))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt,
+                             "User terminated");
+                    eErr = CE_Failure;
+                }
             }
-        }
 
-        VSIFree(padfAttrValues);
+            VSIFree(padfAttrValues);
+        }
 
         if (bNeedToFreeTransformer)
         {
@@ -57,6 +57,12 @@
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
 
+// We restrict to 64bit processors because they are guaranteed to have SSE2.
+#if defined(__x86_64) || defined(_M_X64)
+#define USE_SSE2_APPROX_TRANSFORM
+#include "gdalsse_priv.h"
+#endif
+
 CPL_C_START
 void *GDALDeserializeGCPTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeTPSTransformer(CPLXMLNode *psTree);
@@ -1861,6 +1867,11 @@ static void GDALGCPAntimeridianUnwrap(int nGCPCount, GDAL_GCP *pasGCPList,
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> NUM_THREADS=number_of_threads or ALL_CPUS. (GDAL &gt;= 3.10) Number of
+ * threads used to build the inverse index of geolocation arrays when the
+ * GDAL_GEOLOC_INVERSE_METHOD configuration option is set to GRID. Defaults
+ * to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
@@ -4140,7 +4151,36 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
     /*      NOTE: the above comment is not true: gdalwarp uses approximator */
     /*      also to compute the source pixel of each target pixel.          */
     /* -------------------------------------------------------------------- */
-    for (int i = nPoints - 1; i >= 0; i--)
+    // x[0] is modified by the loop, so save it first. This also enables
+    // the compiler to vectorize the loop.
+    const double dfX0 = x[0];
+    int i = 0;
+#if defined(USE_SSE2_APPROX_TRANSFORM) && !defined(check_error)
+    {
+        const auto xmmX0 = XMMReg4Double::Load1ValHighAndLow(&dfX0);
+        const auto xmmStartX =
+            XMMReg4Double::Load1ValHighAndLow(&xSMETransformed[0]);
+        const auto xmmStartY =
+            XMMReg4Double::Load1ValHighAndLow(&ySMETransformed[0]);
+        const auto xmmStartZ =
+            XMMReg4Double::Load1ValHighAndLow(&zSMETransformed[0]);
+        const auto xmmDeltaX = XMMReg4Double::Load1ValHighAndLow(&dfDeltaX);
+        const auto xmmDeltaY = XMMReg4Double::Load1ValHighAndLow(&dfDeltaY);
+        const auto xmmDeltaZ = XMMReg4Double::Load1ValHighAndLow(&dfDeltaZ);
+        for (; i + 3 < nPoints; i += 4)
+        {
+            const auto xmmDist = XMMReg4Double::Load4Val(x + i) - xmmX0;
+            (xmmStartX + xmmDeltaX * xmmDist).Store4Val(x + i);
+            (xmmStartY + xmmDeltaY * xmmDist).Store4Val(y + i);
+            (xmmStartZ + xmmDeltaZ * xmmDist).Store4Val(z + i);
+            panSuccess[i] = TRUE;
+            panSuccess[i + 1] = TRUE;
+            panSuccess[i + 2] = TRUE;
+            panSuccess[i + 3] = TRUE;
+        }
+    }
+#endif
+    for (; i < nPoints; i++)
     {
 #ifdef check_error
         double xtemp = x[i];
@@ -4152,7 +4192,7 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
         psATInfo->pfnBaseTransformer(psATInfo->pBaseCBData, bDstToSrc, 1,
                                      &xtemp, &ytemp, &ztemp, &btemp);
 #endif
-        const double dfDist = (x[i] - x[0]);
+        const double dfDist = (x[i] - dfX0);
         x[i] = xSMETransformed[0] + dfDeltaX * dfDist;
         y[i] = ySMETransformed[0] + dfDeltaY * dfDist;
         z[i] = zSMETransformed[0] + dfDeltaZ * dfDist;
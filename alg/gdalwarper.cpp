@@ -1267,6 +1267,23 @@ CPLErr GDALWarpDstAlphaMasker(void *pMaskFuncArg, int nBandCount,
  * the excluded value, that is in majority among source pixels, to be used as the
  * target pixel value. Default value is 50 (%)</li>
  *
+ * <li>SOURCE_PREFETCH_CHUNKS=N: (GDAL >= 3.10) When set to a strictly positive
+ * value, GDALDataset::AdviseRead() is called on the source dataset, every N
+ * chunks, with the union of the source windows of the next N chunks (capped
+ * to N times the warp memory limit). This lets drivers that implement
+ * AdviseRead() (WMS, VRT, ECW, ...) fetch source data ahead of the chunk
+ * being warped. Default value is 0 (no prefetching).</li>
+ *
+ * <li>TRANSFORMER_CACHE_FILE=filename: (GDAL >= 3.10) Name of a file where
+ * the source coordinates computed by the warp kernel for each target
+ * scanline are stored. If the file already exists and was generated for
+ * the same transformer (that is the same source and target georeferencing),
+ * the coordinates it contains are used instead of running the transformer
+ * again. This is useful when warping many inputs with the same geometry into
+ * the same target grid. The file is (re)written when the warp operation is
+ * destroyed, if new coordinates have been computed. Note that the whole
+ * content of the file is held in memory.</li>
+ *
  * </ul>
  */
 
@@ -54,6 +54,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_quad_tree.h"
 #include "gdal.h"
 #include "gdal_alg.h"
@@ -234,6 +235,7 @@ struct GWKJobStruct
 
 struct GWKThreadData
 {
+    GDALThreadReservation oThreadReservation{};
     std::unique_ptr<CPLJobQueue> poJobQueue{};
     std::unique_ptr<std::vector<GWKJobStruct>> threadJobs{};
     int nMaxThreads{0};
@@ -333,11 +335,20 @@ void *GWKThreadsCreate(char **papszWarpOptions,
     if (nThreads > 128)
         nThreads = 128;
 
+    GDALThreadReservation oThreadReservation(nThreads);
+    if (nThreads > 0)
+    {
+        nThreads = oThreadReservation.GetThreadCount();
+        if (nThreads <= 1)
+            nThreads = 0;
+    }
+
     GWKThreadData *psThreadData = new GWKThreadData();
     auto poThreadPool =
         nThreads > 0 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
     if (nThreads && poThreadPool)
     {
+        psThreadData->oThreadReservation = std::move(oThreadReservation);
         psThreadData->nMaxThreads = nThreads;
         psThreadData->threadJobs.reset(new std::vector<GWKJobStruct>(
             nThreads,
@@ -4590,6 +4601,86 @@ static void GWKRoundSourceCoordinates(
     }
 }
 
+#if defined(HAVE_OPENCL)
+
+namespace
+{
+struct GWKOpenCLTransformJob
+{
+    GDALWarpKernel *poWK = nullptr;
+    void *pTransformerArg = nullptr;
+    int iYBatchStart = 0;
+    int iYMin = 0;
+    int iYMax = 0;
+    double *padfX = nullptr;
+    double *padfY = nullptr;
+    double *padfZ = nullptr;
+    int *pabSuccess = nullptr;
+    double dfSrcCoordPrecision = 0;
+    double dfErrorThreshold = 0;
+};
+
+// Owner of the transformers cloned for the extra job slots
+struct GWKOpenCLTransformerPool
+{
+    std::vector<void *> apTransformerArg{};
+
+    GWKOpenCLTransformerPool() = default;
+
+    ~GWKOpenCLTransformerPool()
+    {
+        for (size_t i = 1; i < apTransformerArg.size(); ++i)
+            GDALDestroyTransformer(apTransformerArg[i]);
+    }
+
+    GWKOpenCLTransformerPool(const GWKOpenCLTransformerPool &) = delete;
+    GWKOpenCLTransformerPool &
+    operator=(const GWKOpenCLTransformerPool &) = delete;
+};
+}  // namespace
+
+/************************************************************************/
+/*                      GWKOpenCLTransformJobFunc()                     */
+/************************************************************************/
+
+// Transform the destination pixel/line coordinates of lines [iYMin, iYMax[
+// to source pixel/line coordinates.
+static void GWKOpenCLTransformJobFunc(void *pData)
+{
+    auto psJob = static_cast<GWKOpenCLTransformJob *>(pData);
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int nDstXSize = poWK->nDstXSize;
+
+    for (int iDstY = psJob->iYMin; iDstY < psJob->iYMax; ++iDstY)
+    {
+        const size_t nRowOffset =
+            static_cast<size_t>(iDstY - psJob->iYBatchStart) * nDstXSize;
+        double *padfX = psJob->padfX + nRowOffset;
+        double *padfY = psJob->padfY + nRowOffset;
+        double *padfZ = psJob->padfZ + nRowOffset;
+        int *pabSuccess = psJob->pabSuccess + nRowOffset;
+
+        const double dfYConst = iDstY + 0.5 + poWK->nDstYOff;
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        {
+            padfX[iDstX] = iDstX + 0.5 + poWK->nDstXOff;
+            padfY[iDstX] = dfYConst;
+            padfZ[iDstX] = 0;
+        }
+
+        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
+                             padfY, padfZ, pabSuccess);
+        if (psJob->dfSrcCoordPrecision > 0.0)
+        {
+            GWKRoundSourceCoordinates(
+                nDstXSize, padfX, padfY, padfZ, pabSuccess,
+                psJob->dfSrcCoordPrecision, psJob->dfErrorThreshold,
+                poWK->pfnTransformer, psJob->pTransformerArg,
+                0.5 + poWK->nDstXOff, dfYConst);
+        }
+    }
+}
+
 /************************************************************************/
 /*                           GWKOpenCLCase()                            */
 /*                                                                      */
@@ -4600,7 +4691,6 @@ static void GWKRoundSourceCoordinates(
 /*      make some pretty darn good code on the fly.                     */
 /************************************************************************/
 
-#if defined(HAVE_OPENCL)
 static CPLErr GWKOpenCLCase(GDALWarpKernel *poWK)
 {
     const int nDstXSize = poWK->nDstXSize;
@@ -4752,119 +4842,170 @@ static CPLErr GWKOpenCLCase(GDALWarpKernel *poWK)
 
         /* --------------------------------------------------------------------
          */
-        /*      Allocate x,y,z coordinate arrays for transformation ... one */
-        /*      scanlines worth of positions. */
+        /*      Transform destination pixel/line coordinates to source */
+        /*      pixel/line coordinates, by batches of lines. When warping */
+        /*      threads are available, the lines of a batch are transformed */
+        /*      in parallel, while uploading to the OpenCL device is done */
+        /*      from this thread. */
         /* --------------------------------------------------------------------
          */
-
-        // For x, 2 *, because we cache the precomputed values at the end.
-        double *padfX =
-            static_cast<double *>(CPLMalloc(2 * sizeof(double) * nDstXSize));
-        double *padfY =
-            static_cast<double *>(CPLMalloc(sizeof(double) * nDstXSize));
-        double *padfZ =
-            static_cast<double *>(CPLMalloc(sizeof(double) * nDstXSize));
-        int *pabSuccess =
-            static_cast<int *>(CPLMalloc(sizeof(int) * nDstXSize));
         const double dfSrcCoordPrecision = CPLAtof(CSLFetchNameValueDef(
             poWK->papszWarpOptions, "SRC_COORD_PRECISION", "0"));
         const double dfErrorThreshold = CPLAtof(CSLFetchNameValueDef(
             poWK->papszWarpOptions, "ERROR_THRESHOLD", "0"));
 
-        // Precompute values.
-        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
-            padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
-
-        /* ====================================================================
-         */
-        /*      Loop over output lines. */
-        /* ====================================================================
-         */
-        for (int iDstY = 0; iDstY < nDstYSize && eErr == CE_None; ++iDstY)
+        GWKThreadData *psThreadData =
+            static_cast<GWKThreadData *>(poWK->psThreadData);
+        int nThreads = 1;
+        if (psThreadData && psThreadData->poJobQueue)
+            nThreads = std::max(1, std::min(psThreadData->nMaxThreads,
+                                            nDstYSize / 2));
+
+        // Limit the size of the coordinate buffers to about 20 MB
+        constexpr int MAX_PIXELS_PER_BATCH = 1024 * 1024;
+        const int nBatchYSize = std::min(
+            nDstYSize, std::max(nThreads, MAX_PIXELS_PER_BATCH / nDstXSize));
+        const size_t nBatchPixels =
+            static_cast<size_t>(nBatchYSize) * nDstXSize;
+
+        std::vector<double> adfX, adfY, adfZ;
+        std::vector<int> abSuccess;
+        GWKOpenCLTransformerPool oTransformers;
+        try
         {
-            /* ----------------------------------------------------------------
-             */
-            /*      Setup points to transform to source image space. */
-            /* ----------------------------------------------------------------
-             */
-            memcpy(padfX, padfX + nDstXSize, sizeof(double) * nDstXSize);
-            const double dfYConst = iDstY + 0.5 + poWK->nDstYOff;
-            for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
-                padfY[iDstX] = dfYConst;
-            memset(padfZ, 0, sizeof(double) * nDstXSize);
+            adfX.resize(nBatchPixels);
+            adfY.resize(nBatchPixels);
+            adfZ.resize(nBatchPixels);
+            abSuccess.resize(nBatchPixels);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate coordinate buffers");
+            eErr = CE_Failure;
+            throw eErr;
+        }
 
-            /* ----------------------------------------------------------------
-             */
-            /*      Transform the points from destination pixel/line
-             * coordinates*/
-            /*      to source pixel/line coordinates. */
-            /* ----------------------------------------------------------------
-             */
-            poWK->pfnTransformer(poWK->pTransformerArg, TRUE, nDstXSize, padfX,
-                                 padfY, padfZ, pabSuccess);
-            if (dfSrcCoordPrecision > 0.0)
+        // One transformer per job slot. Slot 0 uses the transformer of the
+        // kernel. Jobs of a batch are all completed before the next batch is
+        // submitted, hence a transformer is never used by two threads at the
+        // same time.
+        oTransformers.apTransformerArg.push_back(poWK->pTransformerArg);
+        for (int i = 1; i < nThreads; ++i)
+        {
+            void *pTransformerArg =
+                GDALCloneTransformer(poWK->pTransformerArg);
+            if (pTransformerArg == nullptr)
+                break;
+            oTransformers.apTransformerArg.push_back(pTransformerArg);
+        }
+        nThreads = static_cast<int>(oTransformers.apTransformerArg.size());
+        if (nThreads > 1)
+            CPLDebug("OpenCL", "Transforming coordinates with %d threads",
+                     nThreads);
+
+        std::vector<GWKOpenCLTransformJob> asJobs(nThreads);
+        for (int iBatchY = 0; iBatchY < nDstYSize && eErr == CE_None;
+             iBatchY += nBatchYSize)
+        {
+            const int nRows = std::min(nBatchYSize, nDstYSize - iBatchY);
+            const int nJobs = std::min(nThreads, nRows);
+            for (int i = 0; i < nJobs; ++i)
             {
-                GWKRoundSourceCoordinates(
-                    nDstXSize, padfX, padfY, padfZ, pabSuccess,
-                    dfSrcCoordPrecision, dfErrorThreshold, poWK->pfnTransformer,
-                    poWK->pTransformerArg, 0.5 + nDstXOff,
-                    iDstY + 0.5 + nDstYOff);
+                auto &sJob = asJobs[i];
+                sJob.poWK = poWK;
+                sJob.pTransformerArg = oTransformers.apTransformerArg[i];
+                sJob.iYBatchStart = iBatchY;
+                sJob.iYMin = iBatchY + static_cast<int>(
+                                           static_cast<int64_t>(i) * nRows /
+                                           nJobs);
+                sJob.iYMax = iBatchY + static_cast<int>(
+                                           static_cast<int64_t>(i + 1) *
+                                           nRows / nJobs);
+                sJob.padfX = adfX.data();
+                sJob.padfY = adfY.data();
+                sJob.padfZ = adfZ.data();
+                sJob.pabSuccess = abSuccess.data();
+                sJob.dfSrcCoordPrecision = dfSrcCoordPrecision;
+                sJob.dfErrorThreshold = dfErrorThreshold;
             }
-
-            err = GDALWarpKernelOpenCL_setCoordRow(
-                warper, padfX, padfY, nSrcXOff, nSrcYOff, pabSuccess, iDstY);
-            if (err != CL_SUCCESS)
+            if (nJobs == 1)
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "OpenCL routines reported failure (%d) on line %d.",
-                         static_cast<int>(err), __LINE__);
-                eErr = CE_Failure;
-                break;
+                GWKOpenCLTransformJobFunc(&asJobs[0]);
+            }
+            else
+            {
+                for (int i = 0; i < nJobs; ++i)
+                {
+                    psThreadData->poJobQueue->SubmitJob(
+                        GWKOpenCLTransformJobFunc, &asJobs[i]);
+                }
+                psThreadData->poJobQueue->WaitCompletion();
             }
 
-            // Update the valid & density masks because we don't do so in the
-            // kernel.
-            for (int iDstX = 0; iDstX < nDstXSize && eErr == CE_None; iDstX++)
+            for (int iRow = 0; iRow < nRows && eErr == CE_None; ++iRow)
             {
-                const double dfX = padfX[iDstX];
-                const double dfY = padfY[iDstX];
-                const GPtrDiff_t iDstOffset =
-                    iDstX + static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+                const int iDstY = iBatchY + iRow;
+                const size_t nRowOffset =
+                    static_cast<size_t>(iRow) * nDstXSize;
+                double *padfX = adfX.data() + nRowOffset;
+                double *padfY = adfY.data() + nRowOffset;
+                int *pabSuccess = abSuccess.data() + nRowOffset;
+
+                err = GDALWarpKernelOpenCL_setCoordRow(warper, padfX, padfY,
+                                                       nSrcXOff, nSrcYOff,
+                                                       pabSuccess, iDstY);
+                if (err != CL_SUCCESS)
+                {
+                    CPLError(
+                        CE_Failure, CPLE_AppDefined,
+                        "OpenCL routines reported failure (%d) on line %d.",
+                        static_cast<int>(err), __LINE__);
+                    eErr = CE_Failure;
+                    break;
+                }
 
-                // See GWKGeneralCase() for appropriate commenting.
-                if (!pabSuccess[iDstX] || dfX < nSrcXOff || dfY < nSrcYOff)
-                    continue;
+                // Update the valid & density masks because we don't do so in
+                // the kernel.
+                for (int iDstX = 0; iDstX < nDstXSize && eErr == CE_None;
+                     iDstX++)
+                {
+                    const double dfX = padfX[iDstX];
+                    const double dfY = padfY[iDstX];
+                    const GPtrDiff_t iDstOffset =
+                        iDstX + static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+
+                    // See GWKGeneralCase() for appropriate commenting.
+                    if (!pabSuccess[iDstX] || dfX < nSrcXOff ||
+                        dfY < nSrcYOff)
+                        continue;
 
-                int iSrcX = static_cast<int>(dfX) - nSrcXOff;
-                int iSrcY = static_cast<int>(dfY) - nSrcYOff;
+                    int iSrcX = static_cast<int>(dfX) - nSrcXOff;
+                    int iSrcY = static_cast<int>(dfY) - nSrcYOff;
 
-                if (iSrcX < 0 || iSrcX >= nSrcXSize || iSrcY < 0 ||
-                    iSrcY >= nSrcYSize)
-                    continue;
+                    if (iSrcX < 0 || iSrcX >= nSrcXSize || iSrcY < 0 ||
+                        iSrcY >= nSrcYSize)
+                        continue;
 
-                GPtrDiff_t iSrcOffset =
-                    iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
-                double dfDensity = 1.0;
+                    GPtrDiff_t iSrcOffset =
+                        iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+                    double dfDensity = 1.0;
 
-                if (poWK->pafUnifiedSrcDensity != nullptr && iSrcX >= 0 &&
-                    iSrcY >= 0 && iSrcX < nSrcXSize && iSrcY < nSrcYSize)
-                    dfDensity = poWK->pafUnifiedSrcDensity[iSrcOffset];
+                    if (poWK->pafUnifiedSrcDensity != nullptr && iSrcX >= 0 &&
+                        iSrcY >= 0 && iSrcX < nSrcXSize && iSrcY < nSrcYSize)
+                        dfDensity = poWK->pafUnifiedSrcDensity[iSrcOffset];
 
-                GWKOverlayDensity(poWK, iDstOffset, dfDensity);
+                    GWKOverlayDensity(poWK, iDstOffset, dfDensity);
 
-                // Because this is on the bit-wise level, it can't be done well
-                // in OpenCL.
-                if (poWK->panDstValid != nullptr)
-                    poWK->panDstValid[iDstOffset >> 5] |=
-                        0x01 << (iDstOffset & 0x1f);
+                    // Because this is on the bit-wise level, it can't be done
+                    // well in OpenCL.
+                    if (poWK->panDstValid != nullptr)
+                        poWK->panDstValid[iDstOffset >> 5] |=
+                            0x01 << (iDstOffset & 0x1f);
+                }
             }
         }
 
-        CPLFree(padfX);
-        CPLFree(padfY);
-        CPLFree(padfZ);
-        CPLFree(pabSuccess);
-
         if (eErr != CE_None)
             throw eErr;
 
@@ -7822,12 +7963,7 @@ static void GWKSumPreservingThread(void *pData)
     std::vector<int> abSuccess0(nSrcXSize + 1);
     std::vector<int> abSuccess1(nSrcXSize + 1);
 
-    CPLRectObj sGlobalBounds;
-    sGlobalBounds.minx = -2 * poWK->dfXScale;
-    sGlobalBounds.miny = iYMin - 2 * poWK->dfYScale;
-    sGlobalBounds.maxx = nDstXSize + 2 * poWK->dfXScale;
-    sGlobalBounds.maxy = iYMax + 2 * poWK->dfYScale;
-    CPLQuadTree *hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLPackedRTree oRTree;
 
     struct SourcePixel
     {
@@ -8091,16 +8227,15 @@ static void GWKSumPreservingThread(void *pData)
                     }
                 }
 
-                CPLQuadTreeInsertWithBounds(
-                    hQuadTree,
-                    reinterpret_cast<void *>(
-                        static_cast<uintptr_t>(sourcePixels.size())),
-                    &sRect);
+                oRTree.Add(sRect.minx, sRect.miny, sRect.maxx, sRect.maxy,
+                           sourcePixels.size());
 
                 sourcePixels.push_back(sp);
             }
         }
     }
+    oRTree.Build();
+    std::vector<size_t> anSourcePixels;
 
     std::vector<double> adfRealValue(poWK->nBands);
     std::vector<double> adfImagValue(poWK->nBands);
@@ -8147,14 +8282,13 @@ static void GWKSumPreservingThread(void *pData)
         {
             sRect.minx = iDstX;
             sRect.maxx = iDstX + 1;
-            int nSourcePixels = 0;
-            void **pahSourcePixel =
-                CPLQuadTreeSearch(hQuadTree, &sRect, &nSourcePixels);
-            if (nSourcePixels == 0)
-            {
-                CPLFree(pahSourcePixel);
+            anSourcePixels.clear();
+            oRTree.Search(sRect.minx, sRect.miny, sRect.maxx, sRect.maxy,
+                          anSourcePixels);
+            if (anSourcePixels.empty())
                 continue;
-            }
+            // For a deterministic summation order
+            std::sort(anSourcePixels.begin(), anSourcePixels.end());
 
             std::fill(adfRealValue.begin(), adfRealValue.end(), 0);
             std::fill(adfImagValue.begin(), adfImagValue.end(), 0);
@@ -8174,10 +8308,8 @@ static void GWKSumPreservingThread(void *pData)
             /*          pixel. */
             /* ====================================================================
              */
-            for (int i = 0; i < nSourcePixels; ++i)
+            for (const size_t iSourcePixel : anSourcePixels)
             {
-                const int iSourcePixel = static_cast<int>(
-                    reinterpret_cast<uintptr_t>(pahSourcePixel[i]));
                 auto &sp = sourcePixels[iSourcePixel];
 
                 double dfWeight = 0.0;
@@ -8337,8 +8469,6 @@ static void GWKSumPreservingThread(void *pData)
                 }
             }
 
-            CPLFree(pahSourcePixel);
-
             /* --------------------------------------------------------------------
              */
             /*          Update destination pixel value. */
@@ -8393,5 +8523,4 @@ static void GWKSumPreservingThread(void *pData)
     GEOSGeom_destroy_r(hGEOSContext, hP2);
     OGRGeometry::freeGEOSContext(hGEOSContext);
 #endif
-    CPLQuadTreeDestroy(hQuadTree);
 }
@@ -41,13 +41,16 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <tuple>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_mask.h"
+#include "cpl_minixml.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
@@ -62,12 +65,416 @@ struct _GDALWarpChunk
     double sExtraSx, sExtraSy;
 };
 
+/************************************************************************/
+/*                      GDALWarpCachedTransformer                       */
+/************************************************************************/
+
+// Transformer wrapper used by the TRANSFORMER_CACHE_FILE warping option.
+// It memoizes the results of the transformer for the point arrays that the
+// warp kernel submits (one call per target scanline), and persists them in
+// a file, so that a later warp with identical georeferencing can skip the
+// coordinate transformations altogether.
+
+namespace
+{
+struct GDALWarpTransformerCacheKey
+{
+    int bDstToSrc = 0;
+    int nPointCount = 0;
+    uint64_t nHash = 0;
+    double dfFirstX = 0;
+    double dfFirstY = 0;
+    double dfLastX = 0;
+    double dfLastY = 0;
+
+    bool operator<(const GDALWarpTransformerCacheKey &other) const
+    {
+        return std::tie(bDstToSrc, nPointCount, nHash, dfFirstX, dfFirstY,
+                        dfLastX, dfLastY) <
+               std::tie(other.bDstToSrc, other.nPointCount, other.nHash,
+                        other.dfFirstX, other.dfFirstY, other.dfLastX,
+                        other.dfLastY);
+    }
+};
+
+struct GDALWarpTransformerCacheValue
+{
+    std::vector<double> adfXYZ{};
+    std::vector<int> anSuccess{};
+};
+
+constexpr const char TRANSFORMER_CACHE_MAGIC[] = "GDALTRC1";
+constexpr uint32_t TRANSFORMER_CACHE_BYTE_ORDER = 0x01020304;
+
+class GDALWarpTransformerCache
+{
+    const std::string m_osFilename;
+    const std::string m_osSignature;
+    std::mutex m_oMutex{};
+    std::map<GDALWarpTransformerCacheKey, GDALWarpTransformerCacheValue>
+        m_oMap{};
+    bool m_bDirty = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALWarpTransformerCache)
+
+  public:
+    GDALWarpTransformerCache(const std::string &osFilename,
+                             const std::string &osSignature)
+        : m_osFilename(osFilename), m_osSignature(osSignature)
+    {
+    }
+
+    ~GDALWarpTransformerCache()
+    {
+        if (m_bDirty)
+            Save();
+    }
+
+    void Load();
+    void Save();
+    bool Lookup(const GDALWarpTransformerCacheKey &oKey, double *padfX,
+                double *padfY, double *padfZ, int *panSuccess);
+    void Insert(const GDALWarpTransformerCacheKey &oKey, const double *padfX,
+                const double *padfY, const double *padfZ,
+                const int *panSuccess);
+};
+
+/************************************************************************/
+/*                  GDALWarpTransformerCache::Load()                    */
+/************************************************************************/
+
+void GDALWarpTransformerCache::Load()
+{
+    VSILFILE *fp = VSIFOpenL(m_osFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return;
+
+    bool bOK = true;
+    char szMagic[sizeof(TRANSFORMER_CACHE_MAGIC) - 1] = {};
+    uint32_t nByteOrder = 0;
+    uint64_t nSignatureSize = 0;
+    bOK = VSIFReadL(szMagic, sizeof(szMagic), 1, fp) == 1 &&
+          memcmp(szMagic, TRANSFORMER_CACHE_MAGIC, sizeof(szMagic)) == 0 &&
+          VSIFReadL(&nByteOrder, sizeof(nByteOrder), 1, fp) == 1 &&
+          nByteOrder == TRANSFORMER_CACHE_BYTE_ORDER &&
+          VSIFReadL(&nSignatureSize, sizeof(nSignatureSize), 1, fp) == 1 &&
+          nSignatureSize == m_osSignature.size();
+    if (bOK)
+    {
+        std::string osSignature;
+        osSignature.resize(static_cast<size_t>(nSignatureSize));
+        bOK = VSIFReadL(&osSignature[0], 1, osSignature.size(), fp) ==
+                  osSignature.size() &&
+              osSignature == m_osSignature;
+    }
+    if (!bOK)
+    {
+        CPLDebug("WARP",
+                 "%s is not a transformer cache file matching the current "
+                 "warp geometry. It will be overwritten.",
+                 m_osFilename.c_str());
+        VSIFCloseL(fp);
+        return;
+    }
+
+    try
+    {
+        GDALWarpTransformerCacheKey oKey;
+        while (VSIFReadL(&oKey, sizeof(oKey), 1, fp) == 1)
+        {
+            if (oKey.nPointCount <= 0)
+            {
+                bOK = false;
+                break;
+            }
+            GDALWarpTransformerCacheValue oValue;
+            const size_t nPoints = static_cast<size_t>(oKey.nPointCount);
+            oValue.adfXYZ.resize(3 * nPoints);
+            oValue.anSuccess.resize(nPoints);
+            if (VSIFReadL(oValue.adfXYZ.data(), sizeof(double),
+                          oValue.adfXYZ.size(),
+                          fp) != oValue.adfXYZ.size() ||
+                VSIFReadL(oValue.anSuccess.data(), sizeof(int), nPoints,
+                          fp) != nPoints)
+            {
+                bOK = false;
+                break;
+            }
+            m_oMap[oKey] = std::move(oValue);
+        }
+    }
+    catch (const std::exception &)
+    {
+        bOK = false;
+    }
+    VSIFCloseL(fp);
+
+    if (!bOK)
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "%s is truncated or corrupted. It will be overwritten.",
+                 m_osFilename.c_str());
+        m_oMap.clear();
+    }
+    CPLDebug("WARP", "Loaded %d cached transformations from %s",
+             static_cast<int>(m_oMap.size()), m_osFilename.c_str());
+}
+
+/************************************************************************/
+/*                  GDALWarpTransformerCache::Save()                    */
+/************************************************************************/
+
+void GDALWarpTransformerCache::Save()
+{
+    VSILFILE *fp = VSIFOpenL(m_osFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot create %s",
+                 m_osFilename.c_str());
+        return;
+    }
+
+    const uint64_t nSignatureSize = m_osSignature.size();
+    bool bOK = VSIFWriteL(TRANSFORMER_CACHE_MAGIC,
+                          sizeof(TRANSFORMER_CACHE_MAGIC) - 1, 1, fp) == 1 &&
+               VSIFWriteL(&TRANSFORMER_CACHE_BYTE_ORDER,
+                          sizeof(TRANSFORMER_CACHE_BYTE_ORDER), 1, fp) == 1 &&
+               VSIFWriteL(&nSignatureSize, sizeof(nSignatureSize), 1, fp) ==
+                   1 &&
+               VSIFWriteL(m_osSignature.data(), 1, m_osSignature.size(), fp) ==
+                   m_osSignature.size();
+    for (const auto &oIter : m_oMap)
+    {
+        if (!bOK)
+            break;
+        const auto &oValue = oIter.second;
+        bOK = VSIFWriteL(&oIter.first, sizeof(oIter.first), 1, fp) == 1 &&
+              VSIFWriteL(oValue.adfXYZ.data(), sizeof(double),
+                         oValue.adfXYZ.size(),
+                         fp) == oValue.adfXYZ.size() &&
+              VSIFWriteL(oValue.anSuccess.data(), sizeof(int),
+                         oValue.anSuccess.size(),
+                         fp) == oValue.anSuccess.size();
+    }
+    if (VSIFCloseL(fp) != 0 || !bOK)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Error while writing %s",
+                 m_osFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                  GDALWarpTransformerCache::Lookup()                  */
+/************************************************************************/
+
+bool GDALWarpTransformerCache::Lookup(const GDALWarpTransformerCacheKey &oKey,
+                                      double *padfX, double *padfY,
+                                      double *padfZ, int *panSuccess)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    const auto oIter = m_oMap.find(oKey);
+    if (oIter == m_oMap.end())
+        return false;
+    const size_t nPoints = static_cast<size_t>(oKey.nPointCount);
+    const double *padfXYZ = oIter->second.adfXYZ.data();
+    memcpy(padfX, padfXYZ, nPoints * sizeof(double));
+    memcpy(padfY, padfXYZ + nPoints, nPoints * sizeof(double));
+    if (padfZ)
+        memcpy(padfZ, padfXYZ + 2 * nPoints, nPoints * sizeof(double));
+    memcpy(panSuccess, oIter->second.anSuccess.data(), nPoints * sizeof(int));
+    return true;
+}
+
+/************************************************************************/
+/*                  GDALWarpTransformerCache::Insert()                  */
+/************************************************************************/
+
+void GDALWarpTransformerCache::Insert(const GDALWarpTransformerCacheKey &oKey,
+                                      const double *padfX, const double *padfY,
+                                      const double *padfZ,
+                                      const int *panSuccess)
+{
+    const size_t nPoints = static_cast<size_t>(oKey.nPointCount);
+    GDALWarpTransformerCacheValue oValue;
+    try
+    {
+        oValue.adfXYZ.resize(3 * nPoints);
+        oValue.anSuccess.assign(panSuccess, panSuccess + nPoints);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    memcpy(oValue.adfXYZ.data(), padfX, nPoints * sizeof(double));
+    memcpy(oValue.adfXYZ.data() + nPoints, padfY, nPoints * sizeof(double));
+    if (padfZ)
+        memcpy(oValue.adfXYZ.data() + 2 * nPoints, padfZ,
+               nPoints * sizeof(double));
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_oMap[oKey] = std::move(oValue);
+    m_bDirty = true;
+}
+
+struct GDALWarpCachedTransformInfo
+{
+    GDALTransformerInfo sTI{};
+    GDALTransformerFunc pfnBaseTransformer = nullptr;
+    void *pBaseTransformerArg = nullptr;
+    bool bOwnBaseTransformerArg = false;
+    std::shared_ptr<GDALWarpTransformerCache> poCache{};
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      GDALWarpCachedTransform()                       */
+/************************************************************************/
+
+static int GDALWarpCachedTransform(void *pTransformArg, int bDstToSrc,
+                                   int nPointCount, double *padfX,
+                                   double *padfY, double *padfZ,
+                                   int *panSuccess)
+{
+    auto psInfo = static_cast<GDALWarpCachedTransformInfo *>(pTransformArg);
+    if (nPointCount <= 0)
+    {
+        return psInfo->pfnBaseTransformer(psInfo->pBaseTransformerArg,
+                                          bDstToSrc, nPointCount, padfX,
+                                          padfY, padfZ, panSuccess);
+    }
+
+    // FNV-1a hash of the input coordinates.
+    uint64_t nHash = 14695981039346656037ULL;
+    const auto HashArray = [&nHash, nPointCount](const double *padf)
+    {
+        const GByte *pabyData = reinterpret_cast<const GByte *>(padf);
+        const size_t nBytes = static_cast<size_t>(nPointCount) * sizeof(double);
+        for (size_t i = 0; i < nBytes; ++i)
+        {
+            nHash ^= pabyData[i];
+            nHash *= 1099511628211ULL;
+        }
+    };
+    HashArray(padfX);
+    HashArray(padfY);
+    if (padfZ)
+        HashArray(padfZ);
+
+    GDALWarpTransformerCacheKey oKey;
+    oKey.bDstToSrc = bDstToSrc ? 1 : 0;
+    oKey.nPointCount = nPointCount;
+    oKey.nHash = nHash;
+    oKey.dfFirstX = padfX[0];
+    oKey.dfFirstY = padfY[0];
+    oKey.dfLastX = padfX[nPointCount - 1];
+    oKey.dfLastY = padfY[nPointCount - 1];
+
+    if (psInfo->poCache->Lookup(oKey, padfX, padfY, padfZ, panSuccess))
+        return TRUE;
+
+    const int bRet = psInfo->pfnBaseTransformer(
+        psInfo->pBaseTransformerArg, bDstToSrc, nPointCount, padfX, padfY,
+        padfZ, panSuccess);
+    if (bRet)
+        psInfo->poCache->Insert(oKey, padfX, padfY, padfZ, panSuccess);
+    return bRet;
+}
+
+/************************************************************************/
+/*                   GDALDestroyWarpCachedTransformer()                 */
+/************************************************************************/
+
+static void GDALDestroyWarpCachedTransformer(void *pTransformArg)
+{
+    auto psInfo = static_cast<GDALWarpCachedTransformInfo *>(pTransformArg);
+    if (psInfo->bOwnBaseTransformerArg)
+        GDALDestroyTransformer(psInfo->pBaseTransformerArg);
+    delete psInfo;
+}
+
+/************************************************************************/
+/*                 GDALCreateSimilarWarpCachedTransformer()             */
+/************************************************************************/
+
+// Only used by GDALCloneTransformer() to get per-thread transformers, which
+// share the cache of the original one.
+static void *GDALCreateSimilarWarpCachedTransformer(void *pTransformArg,
+                                                    double dfRatioX,
+                                                    double dfRatioY)
+{
+    auto psInfo = static_cast<GDALWarpCachedTransformInfo *>(pTransformArg);
+    if (dfRatioX != 1.0 || dfRatioY != 1.0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GDALCreateSimilarWarpCachedTransformer() only supports "
+                 "ratios of 1");
+        return nullptr;
+    }
+    void *pClonedBaseArg = GDALCloneTransformer(psInfo->pBaseTransformerArg);
+    if (pClonedBaseArg == nullptr)
+        return nullptr;
+    auto psClonedInfo = new GDALWarpCachedTransformInfo(*psInfo);
+    psClonedInfo->pBaseTransformerArg = pClonedBaseArg;
+    psClonedInfo->bOwnBaseTransformerArg = true;
+    return psClonedInfo;
+}
+
+/************************************************************************/
+/*                    GDALCreateWarpCachedTransformer()                 */
+/************************************************************************/
+
+static void *GDALCreateWarpCachedTransformer(GDALTransformerFunc pfnBase,
+                                             void *pBaseArg,
+                                             const char *pszFilename)
+{
+    CPLXMLNode *psTree = GDALSerializeTransformer(pfnBase, pBaseArg);
+    if (psTree == nullptr)
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "TRANSFORMER_CACHE_FILE ignored, because the transformer "
+                 "cannot be serialized");
+        return nullptr;
+    }
+    char *pszSignature = CPLSerializeXMLTree(psTree);
+    CPLDestroyXMLNode(psTree);
+    const std::string osSignature(pszSignature ? pszSignature : "");
+    CPLFree(pszSignature);
+
+    auto psInfo = new GDALWarpCachedTransformInfo();
+    memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
+           strlen(GDAL_GTI2_SIGNATURE));
+    psInfo->sTI.pszClassName = "GDALWarpCachedTransformer";
+    psInfo->sTI.pfnTransform = GDALWarpCachedTransform;
+    psInfo->sTI.pfnCleanup = GDALDestroyWarpCachedTransformer;
+    psInfo->sTI.pfnCreateSimilar = GDALCreateSimilarWarpCachedTransformer;
+    psInfo->pfnBaseTransformer = pfnBase;
+    psInfo->pBaseTransformerArg = pBaseArg;
+    psInfo->poCache =
+        std::make_shared<GDALWarpTransformerCache>(pszFilename, osSignature);
+    psInfo->poCache->Load();
+    return psInfo;
+}
+
 struct GDALWarpPrivateData
 {
     int nStepCount = 0;
     std::vector<int> abSuccess{};
     std::vector<double> adfDstX{};
     std::vector<double> adfDstY{};
+
+    // Set when the TRANSFORMER_CACHE_FILE warping option is used.
+    void *pCachedTransformerArg = nullptr;
+
+    GDALWarpPrivateData() = default;
+    GDALWarpPrivateData(const GDALWarpPrivateData &) = delete;
+    GDALWarpPrivateData &operator=(const GDALWarpPrivateData &) = delete;
+
+    ~GDALWarpPrivateData()
+    {
+        if (pCachedTransformerArg)
+            GDALDestroyTransformer(pCachedTransformerArg);
+    }
 };
 
 static std::mutex gMutex{};
@@ -182,11 +589,15 @@ GDALWarpOperation::GDALWarpOperation()
 GDALWarpOperation::~GDALWarpOperation()
 
 {
+    // Keep the private data alive until the per-thread transformers, which
+    // may be clones of its cached transformer, have been destroyed.
+    std::unique_ptr<GDALWarpPrivateData> poPrivateData;
     {
         std::lock_guard<std::mutex> oLock(gMutex);
         auto oItem = gMapPrivate.find(this);
         if (oItem != gMapPrivate.end())
         {
+            poPrivateData = std::move(oItem->second);
             gMapPrivate.erase(oItem);
         }
     }
@@ -620,9 +1031,25 @@ CPLErr GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions)
     }
     else
     {
+        void *pKernelTransformerArg = psOptions->pTransformerArg;
+        const char *pszTransformerCacheFile = CSLFetchNameValue(
+            psOptions->papszWarpOptions, "TRANSFORMER_CACHE_FILE");
+        if (pszTransformerCacheFile && pszTransformerCacheFile[0])
+        {
+            GDALWarpPrivateData *privateData = GetWarpPrivateData(this);
+            if (privateData->pCachedTransformerArg)
+                GDALDestroyTransformer(privateData->pCachedTransformerArg);
+            privateData->pCachedTransformerArg =
+                GDALCreateWarpCachedTransformer(psOptions->pfnTransformer,
+                                                psOptions->pTransformerArg,
+                                                pszTransformerCacheFile);
+            if (privateData->pCachedTransformerArg)
+                pKernelTransformerArg = privateData->pCachedTransformerArg;
+        }
+
         psThreadData = GWKThreadsCreate(psOptions->papszWarpOptions,
                                         psOptions->pfnTransformer,
-                                        psOptions->pTransformerArg);
+                                        pKernelTransformerArg);
         if (psThreadData == nullptr)
             eErr = CE_Failure;
 
@@ -902,6 +1329,67 @@ void GDALWarpOperation::CollectChunkList(int nDstXOff, int nDstYOff,
     }
 }
 
+/************************************************************************/
+/*                       AdviseReadSourceChunks()                       */
+/************************************************************************/
+
+// When the SOURCE_PREFETCH_CHUNKS=N warping option is set, advise the source
+// dataset of the union of the source windows of chunks [iChunk, iChunk+N[,
+// every N chunks, so that drivers implementing AdviseRead() can start
+// fetching the data of the following chunks while the current one is warped.
+// The union window is capped to N times the warp memory limit.
+// Must be called with the IO mutex held, if any.
+
+static void AdviseReadSourceChunks(const GDALWarpOptions *psOptions,
+                                   const GDALWarpChunk *pasChunkList,
+                                   int nChunkListCount, int iChunk)
+{
+    const int nPrefetch = atoi(CSLFetchNameValueDef(
+        psOptions->papszWarpOptions, "SOURCE_PREFETCH_CHUNKS", "0"));
+    if (nPrefetch <= 0 || (iChunk % nPrefetch) != 0 ||
+        psOptions->hSrcDS == nullptr)
+        return;
+
+    const int nPixelSize =
+        GDALGetDataTypeSizeBytes(psOptions->eWorkingDataType);
+    const double dfMaxBytes = psOptions->dfWarpMemoryLimit * nPrefetch;
+    int nMinX = INT_MAX;
+    int nMinY = INT_MAX;
+    int nMaxX = INT_MIN;
+    int nMaxY = INT_MIN;
+    for (int i = iChunk; i < nChunkListCount && i < iChunk + nPrefetch; ++i)
+    {
+        const GDALWarpChunk *psChunk = pasChunkList + i;
+        if (psChunk->ssx <= 0 || psChunk->ssy <= 0)
+            continue;
+        const int nNewMinX = std::min(nMinX, psChunk->sx);
+        const int nNewMinY = std::min(nMinY, psChunk->sy);
+        const int nNewMaxX = std::max(nMaxX, psChunk->sx + psChunk->ssx);
+        const int nNewMaxY = std::max(nMaxY, psChunk->sy + psChunk->ssy);
+        if (static_cast<double>(nNewMaxX - nNewMinX) *
+                (nNewMaxY - nNewMinY) * nPixelSize * psOptions->nBandCount >
+            dfMaxBytes)
+        {
+            break;
+        }
+        nMinX = nNewMinX;
+        nMinY = nNewMinY;
+        nMaxX = nNewMaxX;
+        nMaxY = nNewMaxY;
+    }
+    if (nMaxX <= nMinX || nMaxY <= nMinY)
+        return;
+
+    CPLDebug("WARP", "AdviseRead(%d,%d,%d,%d) for chunks %d to %d", nMinX,
+             nMinY, nMaxX - nMinX, nMaxY - nMinY, iChunk,
+             std::min(nChunkListCount, iChunk + nPrefetch) - 1);
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    GDALDatasetAdviseRead(psOptions->hSrcDS, nMinX, nMinY, nMaxX - nMinX,
+                          nMaxY - nMinY, nMaxX - nMinX, nMaxY - nMinY,
+                          psOptions->eWorkingDataType, psOptions->nBandCount,
+                          psOptions->panSrcBands, nullptr);
+}
+
 /************************************************************************/
 /*                         ChunkAndWarpImage()                          */
 /************************************************************************/
@@ -969,6 +1457,9 @@ CPLErr GDALWarpOperation::ChunkAndWarpImage(int nDstXOff, int nDstYOff,
         const double dfProgressBase = dfPixelsProcessed / dfTotalPixels;
         const double dfProgressScale = dfChunkPixels / dfTotalPixels;
 
+        AdviseReadSourceChunks(psOptions, pasChunkList, nChunkListCount,
+                               iChunk);
+
         CPLErr eErr = WarpRegion(
             pasThisChunk->dx, pasThisChunk->dy, pasThisChunk->dsx,
             pasThisChunk->dsy, pasThisChunk->sx, pasThisChunk->sy,
@@ -1013,6 +1504,9 @@ typedef struct
 {
     GDALWarpOperation *poOperation;
     GDALWarpChunk *pasChunkInfo;
+    GDALWarpChunk *pasChunkList;
+    int nChunkListCount;
+    int iChunk;
     CPLJoinableThread *hThreadHandle;
     CPLErr eErr;
     double dfProgressBase;
@@ -1051,6 +1545,10 @@ static void ChunkThreadMain(void *pThreadData)
             CPLReleaseMutex(psData->hCondMutex);
         }
 
+        AdviseReadSourceChunks(psData->poOperation->GetOptions(),
+                               psData->pasChunkList, psData->nChunkListCount,
+                               psData->iChunk);
+
         psData->eErr = psData->poOperation->WarpRegion(
             pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
             pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
@@ -1150,6 +1648,9 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
             dfPixelsProcessed += dfChunkPixels;
 
             asThreadData[iThread].pasChunkInfo = pasThisChunk;
+            asThreadData[iThread].pasChunkList = pasChunkList;
+            asThreadData[iThread].nChunkListCount = nChunkListCount;
+            asThreadData[iThread].iChunk = iChunk;
 
             if (iChunk == 0)
             {
@@ -1387,7 +1888,17 @@ CPLErr GDALWarpOperation::CollectChunkListInternal(int nDstXOff, int nDstYOff,
              nSrcXSize, nSrcYSize, dfSrcFillRatio,
              dfTotalMemoryUse / (1024 * 1024));
 #endif
-    if ((dfTotalMemoryUse > psOptions->dfWarpMemoryLimit &&
+    // Honour the share of CPL_MEMORY_SOFT_LIMIT left by the other
+    // subsystems, if it is lower than the warp memory limit.
+    double dfWarpMemoryLimit = psOptions->dfWarpMemoryLimit;
+    const GIntBig nSoftBudget = VSIGetMemorySoftBudget(VSI_MEMORY_TAG_WARP);
+    if (nSoftBudget >= 0)
+    {
+        dfWarpMemoryLimit =
+            std::max(100000.0, std::min(dfWarpMemoryLimit,
+                                        static_cast<double>(nSoftBudget)));
+    }
+    if ((dfTotalMemoryUse > dfWarpMemoryLimit &&
          (nDstXSize > 2 || nDstYSize > 2)) ||
         (dfSrcFillRatio > 0 && dfSrcFillRatio < 0.5 &&
          (nDstXSize > 100 || nDstYSize > 100) &&
@@ -1593,6 +2104,19 @@ CPLErr GDALWarpOperation::WarpRegion(
 {
     ReportTiming(nullptr);
 
+    CPLTraceSpan oSpan("warp", "WarpRegion");
+    if (oSpan.IsActive())
+    {
+        oSpan.AddArg("dst_x", nDstXOff);
+        oSpan.AddArg("dst_y", nDstYOff);
+        oSpan.AddArg("dst_width", nDstXSize);
+        oSpan.AddArg("dst_height", nDstYSize);
+        oSpan.AddArg("src_x", nSrcXOff);
+        oSpan.AddArg("src_y", nSrcYOff);
+        oSpan.AddArg("src_width", nSrcXSize);
+        oSpan.AddArg("src_height", nSrcYSize);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate the output buffer.                                     */
     /* -------------------------------------------------------------------- */
@@ -1829,6 +2353,28 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         }
     }
 
+    // Account the buffers of this chunk for the duration of the call.
+    struct WarpMemoryAccounting
+    {
+        const GIntBig nBytes;
+
+        explicit WarpMemoryAccounting(double dfBytes)
+            : nBytes(static_cast<GIntBig>(dfBytes))
+        {
+            VSIMemoryAccountingUpdate(VSI_MEMORY_TAG_WARP, nBytes);
+        }
+
+        ~WarpMemoryAccounting()
+        {
+            VSIMemoryAccountingUpdate(VSI_MEMORY_TAG_WARP, -nBytes);
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(WarpMemoryAccounting)
+    };
+
+    const WarpMemoryAccounting oWarpMemoryAccounting(GetWorkingMemoryForWindow(
+        nSrcXSize, nSrcYSize, nDstXSize, nDstYSize));
+
     /* -------------------------------------------------------------------- */
     /*      Prepare a WarpKernel object to match this operation.            */
     /* -------------------------------------------------------------------- */
@@ -1841,6 +2387,12 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
     oWK.pfnTransformer = psOptions->pfnTransformer;
     oWK.pTransformerArg = psOptions->pTransformerArg;
+    if (void *pCachedTransformerArg =
+            GetWarpPrivateData(this)->pCachedTransformerArg)
+    {
+        oWK.pfnTransformer = GDALWarpCachedTransform;
+        oWK.pTransformerArg = pCachedTransformerArg;
+    }
 
     oWK.pfnProgress = psOptions->pfnProgress;
     oWK.pProgress = psOptions->pProgressArg;
@@ -375,6 +375,9 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         }
     }
 
+    if (oPolygonWriter.finalize() != CE_None)
+        eErr = CE_Failure;
+
     /* -------------------------------------------------------------------- */
     /*      Cleanup                                                         */
     /* -------------------------------------------------------------------- */
@@ -468,6 +471,10 @@ GBool GDALFloatEquals(float A, float B)
  * or very large/complex polygons, the memory use for holding polygon
  * enumerations and active polygon geometries may grow to be quite large.
  *
+ * If the output layer supports transactions and no transaction is active,
+ * features are written in transactions grouping 100,000 features (GDAL >=
+ * 3.10).
+ *
  * The algorithm will generally produce very dense polygon geometries, with
  * edges that follow exactly on pixel boundaries for all non-interior pixels.
  * For non-thematic raster data (such as satellite images) the result will
@@ -542,6 +549,10 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * or very large/complex polygons, the memory use for holding polygon
  * enumerations and active polygon geometries may grow to be quite large.
  *
+ * If the output layer supports transactions and no transaction is active,
+ * features are written in transactions grouping 100,000 features (GDAL >=
+ * 3.10).
+ *
  * The algorithm will generally produce very dense polygon geometries, with
  * edges that follow exactly on pixel boundaries for all non-interior pixels.
  * For non-thematic raster data (such as satellite images) the result will
@@ -29,7 +29,10 @@
 
 #include "polygonize_polygonizer.h"
 
+#include "ogr_geometry.h"
+
 #include <algorithm>
+#include <memory>
 
 namespace gdal
 {
@@ -462,6 +465,29 @@ OGRPolygonWriter<DataType>::OGRPolygonWriter(OGRLayerH hOutLayer,
     : PolygonReceiver<DataType>(), hOutLayer_(hOutLayer),
       iPixValField_(iPixValField), padfGeoTransform_(padfGeoTransform)
 {
+    if (OGR_L_TestCapability(hOutLayer_, OLCTransactions))
+    {
+        // Fails if the caller has already started a transaction, in which
+        // case it is in charge of committing it.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        bInTransaction_ = OGR_L_StartTransaction(hOutLayer_) == OGRERR_NONE;
+    }
+}
+
+template <typename DataType> OGRPolygonWriter<DataType>::~OGRPolygonWriter()
+{
+    finalize();
+}
+
+template <typename DataType> CPLErr OGRPolygonWriter<DataType>::finalize()
+{
+    if (bInTransaction_)
+    {
+        bInTransaction_ = false;
+        if (OGR_L_CommitTransaction(hOutLayer_) != OGRERR_NONE)
+            eErr_ = CE_Failure;
+    }
+    return eErr_;
 }
 
 template <typename DataType>
@@ -471,19 +497,30 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
     std::vector<bool> oAccessedArc(poPolygon->oArcConnections.size(), false);
     double *padfGeoTransform = padfGeoTransform_;
 
-    OGRGeometryH hPolygon = OGR_G_CreateGeometry(wkbPolygon);
+    auto poOGRPolygon = std::make_unique<OGRPolygon>();
 
-    auto AddRingToPolygon = [&poPolygon, &oAccessedArc, &hPolygon,
+    auto AddRingToPolygon = [&poPolygon, &oAccessedArc, &poOGRPolygon,
                              padfGeoTransform](std::size_t iFirstArcIndex)
     {
-        OGRGeometryH hRing = OGR_G_CreateGeometry(wkbLinearRing);
+        // Count the points of the ring first, so that it is allocated once
+        std::size_t nPoints = 1;  // closing point
+        std::size_t iArcIndex = iFirstArcIndex;
+        do
+        {
+            nPoints += poPolygon->oArcs[iArcIndex]->size();
+            iArcIndex = poPolygon->oArcConnections[iArcIndex];
+        } while (iArcIndex != iFirstArcIndex);
+
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->setNumPoints(static_cast<int>(nPoints), FALSE);
+        int iPoint = 0;
 
         auto AddArcToRing =
-            [&poPolygon, &hRing, padfGeoTransform](std::size_t iArcIndex)
+            [&poPolygon, &poRing, &iPoint, padfGeoTransform](std::size_t iArc)
         {
-            auto oArc = poPolygon->oArcs[iArcIndex];
-            bool bArcFollowRighthand =
-                poPolygon->oArcRighthandFollow[iArcIndex];
+            const auto oArc = poPolygon->oArcs[iArc];
+            const bool bArcFollowRighthand =
+                poPolygon->oArcRighthandFollow[iArc];
             for (std::size_t i = 0; i < oArc->size(); ++i)
             {
                 const Point &oPixel =
@@ -496,27 +533,22 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
                                    oPixel[1] * padfGeoTransform[4] +
                                    oPixel[0] * padfGeoTransform[5];
 
-                OGR_G_AddPoint_2D(hRing, dfX, dfY);
+                poRing->setPoint(iPoint++, dfX, dfY);
             }
         };
 
-        AddArcToRing(iFirstArcIndex);
-
-        std::size_t iArcIndex = iFirstArcIndex;
-        std::size_t iNextArcIndex = poPolygon->oArcConnections[iArcIndex];
-        oAccessedArc[iArcIndex] = true;
-        while (iNextArcIndex != iFirstArcIndex)
+        iArcIndex = iFirstArcIndex;
+        do
         {
-            AddArcToRing(iNextArcIndex);
-            iArcIndex = iNextArcIndex;
-            iNextArcIndex = poPolygon->oArcConnections[iArcIndex];
+            AddArcToRing(iArcIndex);
             oAccessedArc[iArcIndex] = true;
-        }
+            iArcIndex = poPolygon->oArcConnections[iArcIndex];
+        } while (iArcIndex != iFirstArcIndex);
 
         // close ring manually
-        OGR_G_AddPoint_2D(hRing, OGR_G_GetX(hRing, 0), OGR_G_GetY(hRing, 0));
+        poRing->setPoint(iPoint, poRing->getX(0), poRing->getY(0));
 
-        OGR_G_AddGeometryDirectly(hPolygon, hRing);
+        poOGRPolygon->addRingDirectly(poRing.release());
     };
 
     std::vector<bool>::iterator ite;
@@ -530,7 +562,8 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
     // Create the feature object
     OGRFeatureH hFeat = OGR_F_Create(OGR_L_GetLayerDefn(hOutLayer_));
 
-    OGR_F_SetGeometryDirectly(hFeat, hPolygon);
+    OGR_F_SetGeometryDirectly(hFeat,
+                              OGRGeometry::ToHandle(poOGRPolygon.release()));
 
     if (iPixValField_ >= 0)
         OGR_F_SetFieldDouble(hFeat, iPixValField_,
@@ -541,6 +574,18 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         eErr_ = CE_Failure;
 
     OGR_F_Destroy(hFeat);
+
+    if (bInTransaction_ &&
+        ++nFeaturesInTransaction_ == knFEATURES_PER_TRANSACTION)
+    {
+        nFeaturesInTransaction_ = 0;
+        if (OGR_L_CommitTransaction(hOutLayer_) != OGRERR_NONE ||
+            OGR_L_StartTransaction(hOutLayer_) != OGRERR_NONE)
+        {
+            bInTransaction_ = false;
+            eErr_ = CE_Failure;
+        }
+    }
 }
 
 }  // namespace polygonizer
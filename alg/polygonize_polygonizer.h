@@ -193,13 +193,19 @@ class OGRPolygonWriter : public PolygonReceiver<DataType>
 
     CPLErr eErr_{CE_None};
 
+    // Features are written by groups in transactions, when the output
+    // layer supports them and no transaction has been started by the caller
+    static constexpr int knFEATURES_PER_TRANSACTION = 100 * 1000;
+    bool bInTransaction_{false};
+    int nFeaturesInTransaction_{0};
+
   public:
     OGRPolygonWriter(OGRLayerH hOutLayer, int iPixValField,
                      double *padfGeoTransform);
 
     OGRPolygonWriter(const OGRPolygonWriter<DataType> &) = delete;
 
-    ~OGRPolygonWriter() = default;
+    ~OGRPolygonWriter();
 
     OGRPolygonWriter<DataType> &
     operator=(const OGRPolygonWriter<DataType> &) = delete;
@@ -210,6 +216,11 @@ class OGRPolygonWriter : public PolygonReceiver<DataType>
     {
         return eErr_;
     }
+
+    /**
+     * Commit the pending transaction, if any
+     */
+    CPLErr finalize();
 };
 
 }  // namespace polygonizer
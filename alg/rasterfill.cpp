@@ -35,8 +35,10 @@
 #include <cstring>
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -45,6 +47,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -360,6 +363,192 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                    GDALFillNodataInterpolateLine()                   */
+/************************************************************************/
+
+namespace
+{
+struct GDALFillNodataLineJob
+{
+    int iXStart = 0;
+    int iXEnd = 0;
+    int iY = 0;
+    int nXSize = 0;
+    int nMaxSearchDist = 0;
+    double dfMaxSearchDist = 0;
+    GUInt32 nNoDataVal = 0;
+    bool bNearest = false;
+    bool bHasNoData = false;
+    float fNoData = 0.0f;
+    const GUInt32 *panTopDownY = nullptr;
+    const float *pafTopDownValue = nullptr;
+    const GUInt32 *panLastY = nullptr;
+    const float *pafLastValue = nullptr;
+    GByte *pabyMask = nullptr;
+    float *pafScanline = nullptr;
+    GByte *pabyFiltMask = nullptr;
+};
+}  // namespace
+
+// Interpolate the nodata pixels of columns [iXStart, iXEnd[ of line iY.
+// Each pixel only reads the shared top-down/bottom-up search buffers and
+// only writes its own column, so disjoint column ranges can be processed
+// concurrently.
+static void GDALFillNodataInterpolateLine(void *pData)
+{
+    const GDALFillNodataLineJob &sJob =
+        *static_cast<const GDALFillNodataLineJob *>(pData);
+    const int iY = sJob.iY;
+    const int nXSize = sJob.nXSize;
+    const int nMaxSearchDist = sJob.nMaxSearchDist;
+    const double dfMaxSearchDist = sJob.dfMaxSearchDist;
+    const GUInt32 nNoDataVal = sJob.nNoDataVal;
+    const bool bNearest = sJob.bNearest;
+    const bool bHasNoData = sJob.bHasNoData;
+    const float fNoData = sJob.fNoData;
+    const GUInt32 *const panTopDownY = sJob.panTopDownY;
+    const float *const pafTopDownValue = sJob.pafTopDownValue;
+    const GUInt32 *const panLastY = sJob.panLastY;
+    const float *const pafLastValue = sJob.pafLastValue;
+    GByte *const pabyMask = sJob.pabyMask;
+    float *const pafScanline = sJob.pafScanline;
+    GByte *const pabyFiltMask = sJob.pabyFiltMask;
+
+    for (int iX = sJob.iXStart; iX < sJob.iXEnd; iX++)
+    {
+        int nThisMaxSearchDist = nMaxSearchDist;
+
+        // If this was a valid target - no change.
+        if (pabyMask[iX])
+            continue;
+
+        enum Quadrants
+        {
+            QUAD_TOP_LEFT = 0,
+            QUAD_BOTTOM_LEFT = 1,
+            QUAD_TOP_RIGHT = 2,
+            QUAD_BOTTOM_RIGHT = 3,
+        };
+
+        constexpr int QUAD_COUNT = 4;
+        double adfQuadDist[QUAD_COUNT] = {};
+        float afQuadValue[QUAD_COUNT] = {};
+
+        for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+        {
+            adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
+            afQuadValue[iQuad] = 0.0;
+        }
+
+        // Step left and right by one pixel searching for the closest
+        // target value for each quadrant.
+        for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
+        {
+            const int iLeftX = std::max(0, iX - iStep);
+            const int iRightX = std::min(nXSize - 1, iX + iStep);
+
+            // Top left includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
+                       afQuadValue[QUAD_TOP_LEFT], iLeftX,
+                       panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
+                       nNoDataVal);
+
+            // Bottom left.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
+                       afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
+                       panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
+                       nNoDataVal);
+
+            // Top right and bottom right do no include center pixel.
+            if (iStep == 0)
+                continue;
+
+            // Top right includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
+                       afQuadValue[QUAD_TOP_RIGHT], iRightX,
+                       panTopDownY[iRightX], iX, iY,
+                       pafTopDownValue[iRightX], nNoDataVal);
+
+            // Bottom right.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
+                       afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
+                       panLastY[iRightX], iX, iY, pafLastValue[iRightX],
+                       nNoDataVal);
+
+            // Every four steps, recompute maximum distance.
+            if ((iStep & 0x3) == 0)
+                nThisMaxSearchDist = static_cast<int>(floor(
+                    std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
+                             std::max(adfQuadDist[2], adfQuadDist[3]))));
+        }
+
+        bool bHasSrcValues = false;
+        if (bNearest)
+        {
+            double dfNearestDist = dfMaxSearchDist + 1;
+            float fNearestValue = 0.0f;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] < dfNearestDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        fNearestValue = afQuadValue[iQuad];
+                        dfNearestDist = adfQuadDist[iQuad];
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfNearestDist <= dfMaxSearchDist)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] = fNearestValue;
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+        else
+        {
+            double dfWeightSum = 0.0;
+            double dfValueSum = 0.0;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        const double dfWeight = 1.0 / adfQuadDist[iQuad];
+                        dfWeightSum += dfWeight;
+                        dfValueSum += afQuadValue[iQuad] * dfWeight;
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfWeightSum > 0.0)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] =
+                        static_cast<float>(dfValueSum / dfWeightSum);
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -400,6 +589,10 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
  * interpolated using an inverse distance weighting (INV_DIST). It is also
  * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.10). When greater
+ * than 1, the interpolation of each line is split into column ranges that
+ * are computed in parallel. This mostly helps with large search distances.
+ * Defaults to 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -525,6 +718,48 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         fNoData = static_cast<float>(CPLAtof(pszNoData));
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Split the interpolation of each line into column ranges that    */
+    /*      may be processed by worker threads.                             */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    int nThreads = 1;
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+    // Do not bother dispatching ranges narrower than this.
+    constexpr int MIN_COLUMNS_PER_JOB = 256;
+    const int nJobs =
+        std::max(1, std::min(nThreads, nXSize / MIN_COLUMNS_PER_JOB));
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nJobs > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nJobs);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    std::vector<GDALFillNodataLineJob> asLineJobs(poJobQueue ? nJobs : 1);
+    for (int iJob = 0; iJob < static_cast<int>(asLineJobs.size()); ++iJob)
+    {
+        auto &sJob = asLineJobs[iJob];
+        sJob.iXStart = static_cast<int>(static_cast<GIntBig>(nXSize) * iJob /
+                                        asLineJobs.size());
+        sJob.iXEnd = static_cast<int>(static_cast<GIntBig>(nXSize) *
+                                      (iJob + 1) / asLineJobs.size());
+        sJob.nXSize = nXSize;
+        sJob.nMaxSearchDist = nMaxSearchDist;
+        sJob.dfMaxSearchDist = dfMaxSearchDist;
+        sJob.nNoDataVal = nNoDataVal;
+        sJob.bNearest = bNearest;
+        sJob.bHasNoData = bHasNoData;
+        sJob.fNoData = fNoData;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Initialize progress counter.                                    */
     /* -------------------------------------------------------------------- */
@@ -797,137 +1032,26 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /* --------------------------------------------------------------------
          */
         memset(pabyFiltMask, 0, nXSize);
-        for (int iX = 0; iX < nXSize; iX++)
+        for (auto &sJob : asLineJobs)
         {
-            int nThisMaxSearchDist = nMaxSearchDist;
-
-            // If this was a valid target - no change.
-            if (pabyMask[iX])
-                continue;
-
-            enum Quadrants
-            {
-                QUAD_TOP_LEFT = 0,
-                QUAD_BOTTOM_LEFT = 1,
-                QUAD_TOP_RIGHT = 2,
-                QUAD_BOTTOM_RIGHT = 3,
-            };
-
-            constexpr int QUAD_COUNT = 4;
-            double adfQuadDist[QUAD_COUNT] = {};
-            float afQuadValue[QUAD_COUNT] = {};
-
-            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-            {
-                adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
-                afQuadValue[iQuad] = 0.0;
-            }
-
-            // Step left and right by one pixel searching for the closest
-            // target value for each quadrant.
-            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
-            {
-                const int iLeftX = std::max(0, iX - iStep);
-                const int iRightX = std::min(nXSize - 1, iX + iStep);
-
-                // Top left includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
-                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
-                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
-                           nNoDataVal);
-
-                // Bottom left.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
-                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
-                           panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
-                           nNoDataVal);
-
-                // Top right and bottom right do no include center pixel.
-                if (iStep == 0)
-                    continue;
-
-                // Top right includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
-                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
-                           panTopDownY[iRightX], iX, iY,
-                           pafTopDownValue[iRightX], nNoDataVal);
-
-                // Bottom right.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
-                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
-                           panLastY[iRightX], iX, iY, pafLastValue[iRightX],
-                           nNoDataVal);
-
-                // Every four steps, recompute maximum distance.
-                if ((iStep & 0x3) == 0)
-                    nThisMaxSearchDist = static_cast<int>(floor(
-                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
-                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
-            }
-
-            bool bHasSrcValues = false;
-            if (bNearest)
-            {
-                double dfNearestDist = dfMaxSearchDist + 1;
-                float fNearestValue = 0.0f;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-                {
-                    if (adfQuadDist[iQuad] < dfNearestDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            fNearestValue = afQuadValue[iQuad];
-                            dfNearestDist = adfQuadDist[iQuad];
-                        }
-                    }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfNearestDist <= dfMaxSearchDist)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] = fNearestValue;
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
-            }
-            else
-            {
-                double dfWeightSum = 0.0;
-                double dfValueSum = 0.0;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-                {
-                    if (adfQuadDist[iQuad] <= dfMaxSearchDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            const double dfWeight = 1.0 / adfQuadDist[iQuad];
-                            dfWeightSum += dfWeight;
-                            dfValueSum += afQuadValue[iQuad] * dfWeight;
-                        }
-                    }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfWeightSum > 0.0)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] =
-                            static_cast<float>(dfValueSum / dfWeightSum);
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
-            }
+            sJob.iY = iY;
+            sJob.panTopDownY = panTopDownY;
+            sJob.pafTopDownValue = pafTopDownValue;
+            sJob.panLastY = panLastY;
+            sJob.pafLastValue = pafLastValue;
+            sJob.pabyMask = pabyMask;
+            sJob.pafScanline = pafScanline;
+            sJob.pabyFiltMask = pabyFiltMask;
+        }
+        if (poJobQueue)
+        {
+            for (auto &sJob : asLineJobs)
+                poJobQueue->SubmitJob(GDALFillNodataInterpolateLine, &sJob);
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            GDALFillNodataInterpolateLine(&asLineJobs[0]);
         }
 
         /* --------------------------------------------------------------------
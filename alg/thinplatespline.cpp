@@ -436,7 +436,7 @@ static void VizGeorefSpline2DBase_func4(double *res, const double *pxy,
 }
 #endif  // defined(USE_OPTIMIZED_VizGeorefSpline2DBase_func4)
 
-int VizGeorefSpline2D::solve()
+int VizGeorefSpline2D::solve(int nNumThreads)
 {
     // No points at all.
     if (_nof_points < 1)
@@ -612,7 +612,7 @@ int VizGeorefSpline2D::solve()
 
     GDALMatrix Coef(_nof_eqs, _nof_vars);
 
-    if (!GDALLinearSystemSolve(A, RHS, Coef))
+    if (!GDALLinearSystemSolve(A, RHS, Coef, nNumThreads))
     {
         return 0;
     }
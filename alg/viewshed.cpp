@@ -31,8 +31,12 @@
 #include <cmath>
 #include <cstring>
 #include <array>
+#include <atomic>
 #include <limits>
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -41,6 +45,8 @@
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+#include "memdataset.h"
 #include "ogr_api.h"
 #include "ogr_spatialref.h"
 #include "ogr_core.h"
@@ -883,3 +889,394 @@ GDALDatasetH GDALViewshedGenerate(
 
     return GDALDataset::FromHandle(poDstDS.release());
 }
+
+/************************************************************************/
+/*                  GDALViewshedGenerateCumulative()                    */
+/************************************************************************/
+
+namespace
+{
+struct GDALViewshedCumulativeContext
+{
+    GByte *pabyDEM = nullptr;
+    GDALDataType eDT = GDT_Unknown;
+    int nXSize = 0;
+    int nYSize = 0;
+    std::array<double, 6> adfGeoTransform{{0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
+    double adfInvGeoTransform[6] = {0, 0, 0, 0, 0, 0};
+    const OGRSpatialReference *poSRS = nullptr;
+    double dfObserverHeight = 0;
+    double dfTargetHeight = 0;
+    double dfCurvCoeff = 0;
+    GDALViewshedMode eMode = GVM_Edge;
+    double dfMaxDistance = 0;
+
+    // Protects anCount and poSRS.
+    std::mutex oMutex{};
+    std::vector<GUInt32> anCount{};
+    std::atomic<bool> bStop{false};
+    std::atomic<bool> bError{false};
+};
+
+struct GDALViewshedCumulativeJob
+{
+    GDALViewshedCumulativeContext *psContext = nullptr;
+    double dfObserverX = 0;
+    double dfObserverY = 0;
+};
+}  // namespace
+
+// Computes the viewshed of one observer on a MEM dataset wrapping the
+// shared in-memory DEM, and adds it to the visibility counts.
+static void GDALViewshedCumulativeJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const GDALViewshedCumulativeJob *>(pData);
+    auto &sContext = *(psJob->psContext);
+    if (sContext.bStop)
+        return;
+
+    auto poMEMDS = std::unique_ptr<MEMDataset>(MEMDataset::Create(
+        "", sContext.nXSize, sContext.nYSize, 0, sContext.eDT, nullptr));
+    GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
+        poMEMDS.get(), 1, sContext.pabyDEM, sContext.eDT, 0, 0, false);
+    poMEMDS->AddMEMBand(hMEMBand);
+    poMEMDS->SetGeoTransform(sContext.adfGeoTransform.data());
+    if (sContext.poSRS)
+    {
+        std::lock_guard<std::mutex> oLock(sContext.oMutex);
+        poMEMDS->SetSpatialRef(sContext.poSRS);
+    }
+
+    auto poViewshedDS =
+        std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
+            GDALViewshedGenerate(
+                hMEMBand, "MEM", "", nullptr, psJob->dfObserverX,
+                psJob->dfObserverY, sContext.dfObserverHeight,
+                sContext.dfTargetHeight, 1.0, 0.0, 0.0, -1.0,
+                sContext.dfCurvCoeff, sContext.eMode, sContext.dfMaxDistance,
+                nullptr, nullptr, GVOT_NORMAL, nullptr)));
+    if (!poViewshedDS)
+    {
+        sContext.bError = true;
+        sContext.bStop = true;
+        return;
+    }
+
+    // Locate the viewshed window, which may be clipped by the maximum
+    // distance, in the DEM.
+    double adfVSGeoTransform[6];
+    poViewshedDS->GetGeoTransform(adfVSGeoTransform);
+    double dfXOff = 0;
+    double dfYOff = 0;
+    GDALApplyGeoTransform(sContext.adfInvGeoTransform, adfVSGeoTransform[0],
+                          adfVSGeoTransform[3], &dfXOff, &dfYOff);
+    const int nXOff = static_cast<int>(std::round(dfXOff));
+    const int nYOff = static_cast<int>(std::round(dfYOff));
+    const int nVSXSize = poViewshedDS->GetRasterXSize();
+    const int nVSYSize = poViewshedDS->GetRasterYSize();
+
+    std::vector<GByte> abyVisible;
+    try
+    {
+        abyVisible.resize(static_cast<size_t>(nVSXSize) * nVSYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for viewshed");
+        sContext.bError = true;
+        sContext.bStop = true;
+        return;
+    }
+    if (poViewshedDS->GetRasterBand(1)->RasterIO(
+            GF_Read, 0, 0, nVSXSize, nVSYSize, abyVisible.data(), nVSXSize,
+            nVSYSize, GDT_Byte, 0, 0, nullptr) != CE_None)
+    {
+        sContext.bError = true;
+        sContext.bStop = true;
+        return;
+    }
+
+    std::lock_guard<std::mutex> oLock(sContext.oMutex);
+    for (int iY = 0; iY < nVSYSize; ++iY)
+    {
+        const int iDEMY = nYOff + iY;
+        if (iDEMY < 0 || iDEMY >= sContext.nYSize)
+            continue;
+        const GByte *pabyLine =
+            abyVisible.data() + static_cast<size_t>(iY) * nVSXSize;
+        GUInt32 *panCountLine =
+            sContext.anCount.data() +
+            static_cast<size_t>(iDEMY) * sContext.nXSize;
+        for (int iX = 0; iX < nVSXSize; ++iX)
+        {
+            const int iDEMX = nXOff + iX;
+            if (pabyLine[iX] && iDEMX >= 0 && iDEMX < sContext.nXSize)
+                panCountLine[iDEMX]++;
+        }
+    }
+}
+
+/**
+ * Create a cumulative viewshed from raster DEM.
+ *
+ * Each output pixel contains the number of observers, among the provided
+ * ones, from which it is visible. Each individual viewshed is computed
+ * with the same algorithm as GDALViewshedGenerate().
+ *
+ * The DEM band is read once into memory, which requires about
+ * nXSize * nYSize * (data type size + 4) bytes, and the observers are
+ * processed concurrently on nThreads threads.
+ *
+ * Observers located outside of the DEM are skipped with a warning.
+ *
+ * @param hBand The band to read the DEM data from.
+ *
+ * @param pszDriverName Driver name (GTiff if set to NULL)
+ *
+ * @param pszTargetRasterName The name of the target raster to be generated.
+ * Must not be NULL
+ *
+ * @param papszCreationOptions creation options.
+ *
+ * @param nObserverCount number of observers.
+ *
+ * @param padfObserverX array of nObserverCount observer X values (in SRS
+ * units)
+ *
+ * @param padfObserverY array of nObserverCount observer Y values (in SRS
+ * units)
+ *
+ * @param dfObserverHeight The height of the observers above the DEM surface.
+ *
+ * @param dfTargetHeight The height of the target above the DEM surface.
+ *
+ * @param dfCurvCoeff Coefficient to consider the effect of the curvature and
+ * refraction. See GDALViewshedGenerate().
+ *
+ * @param eMode The mode of the viewshed calculation.
+ *
+ * @param dfMaxDistance maximum distance range to compute viewshed, or 0 for
+ * unlimited range.
+ *
+ * @param nThreads number of worker threads.
+ *
+ * @param pfnProgress A GDALProgressFunc that may be used to report progress
+ * to the user, or to interrupt the algorithm.  May be NULL if not required.
+ *
+ * @param pProgressArg The callback data for the pfnProgress function.
+ *
+ * @param papszExtraOptions Future extra options. Must be set to NULL currently.
+ *
+ * @return not NULL output dataset on success (to be closed with GDALClose()) or
+ * NULL if an error occurs. The output raster is of type UInt16, or UInt32 if
+ * there are more than 65535 observers, and covers the whole DEM.
+ *
+ * @since GDAL 3.10
+ */
+
+GDALDatasetH GDALViewshedGenerateCumulative(
+    GDALRasterBandH hBand, const char *pszDriverName,
+    const char *pszTargetRasterName, CSLConstList papszCreationOptions,
+    int nObserverCount, const double *padfObserverX,
+    const double *padfObserverY, double dfObserverHeight,
+    double dfTargetHeight, double dfCurvCoeff, GDALViewshedMode eMode,
+    double dfMaxDistance, int nThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg, CSLConstList papszExtraOptions)
+{
+    VALIDATE_POINTER1(hBand, "GDALViewshedGenerateCumulative", nullptr);
+    VALIDATE_POINTER1(pszTargetRasterName, "GDALViewshedGenerateCumulative",
+                      nullptr);
+
+    CPL_IGNORE_RET_VAL(papszExtraOptions);
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    if (nObserverCount <= 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "No observer provided");
+        return nullptr;
+    }
+    VALIDATE_POINTER1(padfObserverX, "GDALViewshedGenerateCumulative",
+                      nullptr);
+    VALIDATE_POINTER1(padfObserverY, "GDALViewshedGenerateCumulative",
+                      nullptr);
+
+    if (!pfnProgress(0.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return nullptr;
+    }
+
+    GDALViewshedCumulativeContext sContext;
+    sContext.nXSize = GDALGetRasterBandXSize(hBand);
+    sContext.nYSize = GDALGetRasterBandYSize(hBand);
+    sContext.eDT = GDALGetRasterDataType(hBand);
+    sContext.dfObserverHeight = dfObserverHeight;
+    sContext.dfTargetHeight = dfTargetHeight;
+    sContext.dfCurvCoeff = dfCurvCoeff;
+    sContext.eMode = eMode;
+    sContext.dfMaxDistance = dfMaxDistance;
+
+    GDALDatasetH hSrcDS = GDALGetBandDataset(hBand);
+    if (hSrcDS != nullptr)
+    {
+        GDALGetGeoTransform(hSrcDS, sContext.adfGeoTransform.data());
+        sContext.poSRS = GDALDataset::FromHandle(hSrcDS)->GetSpatialRef();
+    }
+    if (!GDALInvGeoTransform(sContext.adfGeoTransform.data(),
+                             sContext.adfInvGeoTransform))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
+        return nullptr;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Select the observers that fall within the DEM.                  */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALViewshedCumulativeJob> asJobs;
+    for (int i = 0; i < nObserverCount; ++i)
+    {
+        double dfX = 0;
+        double dfY = 0;
+        GDALApplyGeoTransform(sContext.adfInvGeoTransform, padfObserverX[i],
+                              padfObserverY[i], &dfX, &dfY);
+        if (!(dfX >= 0 && dfX < sContext.nXSize && dfY >= 0 &&
+              dfY < sContext.nYSize))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Observer (%.17g, %.17g) falls outside of the DEM area. "
+                     "Skipping it",
+                     padfObserverX[i], padfObserverY[i]);
+            continue;
+        }
+        GDALViewshedCumulativeJob sJob;
+        sJob.psContext = &sContext;
+        sJob.dfObserverX = padfObserverX[i];
+        sJob.dfObserverY = padfObserverY[i];
+        asJobs.push_back(sJob);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the DEM once, in its native data type.                     */
+    /* -------------------------------------------------------------------- */
+    const size_t nPixels =
+        static_cast<size_t>(sContext.nXSize) * sContext.nYSize;
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyDEM(
+        static_cast<GByte *>(VSI_MALLOC3_VERBOSE(
+            sContext.nXSize, sContext.nYSize,
+            GDALGetDataTypeSizeBytes(sContext.eDT))));
+    if (!pabyDEM)
+        return nullptr;
+    try
+    {
+        sContext.anCount.resize(nPixels);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for cumulative viewshed");
+        return nullptr;
+    }
+    if (GDALRasterIO(hBand, GF_Read, 0, 0, sContext.nXSize, sContext.nYSize,
+                     pabyDEM.get(), sContext.nXSize, sContext.nYSize,
+                     sContext.eDT, 0, 0) != CE_None)
+    {
+        return nullptr;
+    }
+    sContext.pabyDEM = pabyDEM.get();
+
+    const int nJobs = static_cast<int>(asJobs.size());
+    const double dfReadRatio = 0.1;
+    if (!pfnProgress(dfReadRatio, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return nullptr;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Run the observers, concurrently if possible.                    */
+    /* -------------------------------------------------------------------- */
+    nThreads = std::max(1, std::min(nThreads, nJobs));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        for (auto &sJob : asJobs)
+            poJobQueue->SubmitJob(GDALViewshedCumulativeJobFunc, &sJob);
+        for (int nRemaining = nJobs - 1; nRemaining >= 0; --nRemaining)
+        {
+            poJobQueue->WaitCompletion(nRemaining);
+            if (!sContext.bStop &&
+                !pfnProgress(dfReadRatio + (1 - dfReadRatio) *
+                                               (nJobs - nRemaining) / nJobs,
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                sContext.bError = true;
+                sContext.bStop = true;
+            }
+        }
+    }
+    else
+    {
+        for (int i = 0; i < nJobs && !sContext.bStop; ++i)
+        {
+            GDALViewshedCumulativeJobFunc(&asJobs[i]);
+            if (!sContext.bStop &&
+                !pfnProgress(dfReadRatio +
+                                 (1 - dfReadRatio) * (i + 1) / nJobs,
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                sContext.bError = true;
+                sContext.bStop = true;
+            }
+        }
+    }
+    if (sContext.bError)
+        return nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Create and write the count raster.                              */
+    /* -------------------------------------------------------------------- */
+    GDALDriverH hDriver =
+        GDALGetDriverByName(pszDriverName ? pszDriverName : "GTiff");
+    if (!hDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot get driver");
+        return nullptr;
+    }
+    auto poDstDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::FromHandle(GDALCreate(
+            hDriver, pszTargetRasterName, sContext.nXSize, sContext.nYSize, 1,
+            nObserverCount > 65535 ? GDT_UInt32 : GDT_UInt16,
+            const_cast<char **>(papszCreationOptions))));
+    if (!poDstDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create dataset for %s",
+                 pszTargetRasterName);
+        return nullptr;
+    }
+    if (sContext.poSRS)
+        poDstDS->SetSpatialRef(sContext.poSRS);
+    poDstDS->SetGeoTransform(sContext.adfGeoTransform.data());
+
+    if (poDstDS->GetRasterBand(1)->RasterIO(
+            GF_Write, 0, 0, sContext.nXSize, sContext.nYSize,
+            sContext.anCount.data(), sContext.nXSize, sContext.nYSize,
+            GDT_UInt32, 0, 0, nullptr) != CE_None)
+    {
+        return nullptr;
+    }
+
+    if (!pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return nullptr;
+    }
+
+    return GDALDataset::ToHandle(poDstDS.release());
+}
@@ -28,14 +28,19 @@
 
 #include "commonutils.h"
 
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
-
+#include <deque>
+#include <mutex>
 #include <string>
 
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "gdal.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /* -------------------------------------------------------------------- */
 /*                         GetOutputDriversFor()                        */
@@ -162,3 +167,168 @@ int ArgIsNumeric(const char *pszArg)
 {
     return CPLGetValueType(pszArg) != CPL_VALUE_STRING;
 }
+
+/************************************************************************/
+/*                   GDALDatasetPrefetcher::Private                     */
+/************************************************************************/
+
+struct GDALDatasetPrefetcher::Private
+{
+    struct Job
+    {
+        Private *poPrivate = nullptr;
+        std::string osFilename{};
+        std::unique_ptr<GDALDataset> poDS{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;
+    };
+
+    unsigned int nOpenFlags = 0;
+    CPLStringList aosOpenOptions{};
+    size_t nMaxPending = 1;
+    std::unique_ptr<CPLJobQueue> poQueue{};
+    std::deque<std::unique_ptr<Job>> apoJobs{};
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+
+    static void OpenJob(void *pData);
+};
+
+/************************************************************************/
+/*                  GDALDatasetPrefetcher::Private::OpenJob()           */
+/************************************************************************/
+
+void GDALDatasetPrefetcher::Private::OpenJob(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    Private *poPrivate = psJob->poPrivate;
+
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    CPLSetCurrentErrorHandlerCatchDebug(FALSE);
+    auto poDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+        psJob->osFilename.c_str(), poPrivate->nOpenFlags, nullptr,
+        poPrivate->aosOpenOptions.List(), nullptr));
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard oLock(poPrivate->oMutex);
+    psJob->poDS = std::move(poDS);
+    psJob->bDone = true;
+    poPrivate->oCV.notify_all();
+}
+
+/************************************************************************/
+/*                        GDALDatasetPrefetcher()                       */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param nNumThreads Number of datasets opened concurrently. Values <= 1
+ *                    disable prefetching.
+ * @param nOpenFlags Flags passed to GDALDataset::Open().
+ * @param papszOpenOptions Open options passed to GDALDataset::Open().
+ */
+GDALDatasetPrefetcher::GDALDatasetPrefetcher(int nNumThreads,
+                                             unsigned int nOpenFlags,
+                                             CSLConstList papszOpenOptions)
+    : m_poPrivate(std::make_unique<Private>())
+{
+    m_poPrivate->nOpenFlags = nOpenFlags;
+    m_poPrivate->aosOpenOptions = CPLStringList(papszOpenOptions);
+    if (nNumThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nNumThreads);
+        if (poThreadPool)
+        {
+            m_poPrivate->poQueue = poThreadPool->CreateJobQueue();
+            // Keep a few datasets in flight per thread, so that workers
+            // are not idle while the caller processes the current one.
+            m_poPrivate->nMaxPending = 2 * static_cast<size_t>(nNumThreads);
+        }
+    }
+}
+
+/************************************************************************/
+/*                       ~GDALDatasetPrefetcher()                       */
+/************************************************************************/
+
+GDALDatasetPrefetcher::~GDALDatasetPrefetcher()
+{
+    if (m_poPrivate->poQueue)
+        m_poPrivate->poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                           GetMaxPending()                            */
+/************************************************************************/
+
+/** Returns the maximum number of datasets that should be submitted and
+ * not yet retrieved.
+ */
+size_t GDALDatasetPrefetcher::GetMaxPending() const
+{
+    return m_poPrivate->nMaxPending;
+}
+
+/************************************************************************/
+/*                          GetPendingCount()                           */
+/************************************************************************/
+
+/** Returns the number of datasets submitted and not yet retrieved. */
+size_t GDALDatasetPrefetcher::GetPendingCount() const
+{
+    return m_poPrivate->apoJobs.size();
+}
+
+/************************************************************************/
+/*                              Submit()                                */
+/************************************************************************/
+
+/** Queues the opening of a dataset. */
+void GDALDatasetPrefetcher::Submit(const std::string &osFilename)
+{
+    auto psJob = std::make_unique<Private::Job>();
+    psJob->poPrivate = m_poPrivate.get();
+    psJob->osFilename = osFilename;
+    if (m_poPrivate->poQueue &&
+        !m_poPrivate->poQueue->SubmitJob(Private::OpenJob, psJob.get()))
+    {
+        // Fallback to a synchronous open in Get()
+        m_poPrivate->poQueue.reset();
+    }
+    m_poPrivate->apoJobs.push_back(std::move(psJob));
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+/** Returns the dataset of the oldest submitted filename, or nullptr if it
+ * could not be opened.
+ */
+std::unique_ptr<GDALDataset> GDALDatasetPrefetcher::Get()
+{
+    if (m_poPrivate->apoJobs.empty())
+        return nullptr;
+    auto psJob = std::move(m_poPrivate->apoJobs.front());
+    m_poPrivate->apoJobs.pop_front();
+
+    bool bDone;
+    {
+        std::unique_lock oLock(m_poPrivate->oMutex);
+        if (m_poPrivate->poQueue)
+        {
+            m_poPrivate->oCV.wait(oLock, [&psJob] { return psJob->bDone; });
+        }
+        bDone = psJob->bDone;
+    }
+    if (!bDone)
+    {
+        return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            psJob->osFilename.c_str(), m_poPrivate->nOpenFlags, nullptr,
+            m_poPrivate->aosOpenOptions.List(), nullptr));
+    }
+
+    for (const auto &oError : psJob->aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    return std::move(psJob->poDS);
+}
@@ -104,6 +104,7 @@ CPL_C_END
 #ifdef __cplusplus
 
 #include "cpl_string.h"
+#include <memory>
 #include <vector>
 
 std::vector<std::string> CPL_DLL
@@ -114,6 +115,40 @@ std::string GDALRemoveSQLComments(const std::string &osInput);
 
 int ArgIsNumeric(const char *pszArg);
 
+class GDALDataset;
+
+/************************************************************************/
+/*                        GDALDatasetPrefetcher                         */
+/************************************************************************/
+
+/** Opens datasets ahead of their use on the global thread pool, and hands
+ * them back in submission order.
+ *
+ * At most GetMaxPending() datasets are submitted but not yet retrieved at
+ * any time, which bounds the number of simultaneously opened datasets.
+ * Errors emitted while opening a dataset are re-emitted in the thread that
+ * calls Get(). With a single thread, datasets are opened synchronously by
+ * Get(), which matches a plain sequential GDALOpenEx() loop.
+ */
+class CPL_DLL GDALDatasetPrefetcher
+{
+    struct Private;
+    std::unique_ptr<Private> m_poPrivate;
+
+    GDALDatasetPrefetcher(const GDALDatasetPrefetcher &) = delete;
+    GDALDatasetPrefetcher &operator=(const GDALDatasetPrefetcher &) = delete;
+
+  public:
+    GDALDatasetPrefetcher(int nNumThreads, unsigned int nOpenFlags,
+                          CSLConstList papszOpenOptions = nullptr);
+    ~GDALDatasetPrefetcher();
+
+    size_t GetMaxPending() const;
+    size_t GetPendingCount() const;
+    void Submit(const std::string &osFilename);
+    std::unique_ptr<GDALDataset> Get();
+};
+
 // those values shouldn't be changed, because overview levels >= 0 are meant
 // to be overview indices, and ovr_level < OVR_LEVEL_AUTO mean overview level
 // automatically selected minus (OVR_LEVEL_AUTO - ovr_level)
@@ -59,6 +59,7 @@ struct GDALContourOptions
     std::string osElevAttribMin;
     std::string osElevAttribMax;
     std::vector<double> adfFixedLevels;
+    std::string osNumThreads;
     CPLStringList aosOpenOptions;
     CPLStringList aosCreationOptions;
     bool bQuiet = false;
@@ -185,6 +186,11 @@ GDALContourAppOptionsGetParser(GDALContourOptions *psOptions)
         .store_into(psOptions->bPolygonize)
         .help(_("Generate contour polygons instead of lines."));
 
+    argParser->add_argument("-j")
+        .metavar("<num_threads>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads to use."));
+
     argParser->add_quiet_argument(&psOptions->bQuiet);
 
     argParser->add_argument("src_filename")
@@ -483,6 +489,11 @@ MAIN_START(argc, argv)
     {
         options = CSLAppendPrintf(options, "POLYGONIZE=YES");
     }
+    if (!sOptions.osNumThreads.empty())
+    {
+        options = CSLAppendPrintf(options, "NUM_THREADS=%s",
+                                  sOptions.osNumThreads.c_str());
+    }
 
     CPLErr eErr =
         GDALContourGenerateEx(hBand, hLayer, options, pfnProgress, nullptr);
@@ -42,12 +42,14 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_mem.h"
@@ -84,6 +86,9 @@ struct GDALFootprintOptions
     /*! Overview index: 0 = first overview level */
     int nOvrIndex = -1;
 
+    /*! Overview index of the coarse pass of the hierarchical mode, or -1 */
+    int nCoarseOvrIndex = -1;
+
     /** Whether output geometry should be in georeferenced coordinates, if
      * possible (if explicitly requested, bOutCSGeorefRequested is also set)
      * false = in pixel coordinates
@@ -575,6 +580,301 @@ class GeoTransformCoordinateTransformation final
     }
 };
 
+/************************************************************************/
+/*                       PolygonizeHierarchical()                       */
+/************************************************************************/
+
+// Size in pixels of the tiles of PolygonizeHierarchical()
+constexpr int HIERARCHICAL_TILE_SIZE = 512;
+
+// Value of the coarse mask over a tile
+enum class TileClass
+{
+    EMPTY,
+    FULL,
+    BOUNDARY
+};
+
+/** Polygonizes poMask (whose valid pixels are non-zero), in pixel
+ * coordinates, into poDstLayer, using poCoarseMask, a lower resolution
+ * version of it, to avoid reading and polygonizing the tiles of poMask that
+ * are far from the boundary of the valid area. Boundary tiles are
+ * polygonized in parallel, and all polygons are then unioned.
+ */
+static bool PolygonizeHierarchical(GDALRasterBand *poMask,
+                                   GDALRasterBand *poCoarseMask,
+                                   OGRLayer *poDstLayer,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressData)
+{
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "-coarse_ovr requires GDAL to be built against GEOS");
+        return false;
+    }
+
+    const int nXSize = poMask->GetXSize();
+    const int nYSize = poMask->GetYSize();
+    const int nCoarseXSize = poCoarseMask->GetXSize();
+    const int nCoarseYSize = poCoarseMask->GetYSize();
+    std::vector<GByte> abyCoarse;
+    try
+    {
+        abyCoarse.resize(static_cast<size_t>(nCoarseXSize) * nCoarseYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate coarse mask buffer");
+        return false;
+    }
+    if (poCoarseMask->RasterIO(GF_Read, 0, 0, nCoarseXSize, nCoarseYSize,
+                               abyCoarse.data(), nCoarseXSize, nCoarseYSize,
+                               GDT_Byte, 0, 0, nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    // Classify tiles from the coarse mask, with a margin of one coarse pixel
+    // to account for the resampling of the overview.
+    const double dfRatioX = static_cast<double>(nXSize) / nCoarseXSize;
+    const double dfRatioY = static_cast<double>(nYSize) / nCoarseYSize;
+    const int nTilesX = DIV_ROUND_UP(nXSize, HIERARCHICAL_TILE_SIZE);
+    const int nTilesY = DIV_ROUND_UP(nYSize, HIERARCHICAL_TILE_SIZE);
+    const auto ClassifyTile = [&](int nTileX, int nTileY)
+    {
+        const int nX0 = nTileX * HIERARCHICAL_TILE_SIZE;
+        const int nY0 = nTileY * HIERARCHICAL_TILE_SIZE;
+        const int nX1 = std::min(nXSize, nX0 + HIERARCHICAL_TILE_SIZE);
+        const int nY1 = std::min(nYSize, nY0 + HIERARCHICAL_TILE_SIZE);
+        const int nCX0 = std::max(0, static_cast<int>(nX0 / dfRatioX) - 1);
+        const int nCY0 = std::max(0, static_cast<int>(nY0 / dfRatioY) - 1);
+        const int nCX1 = std::min(
+            nCoarseXSize, static_cast<int>(std::ceil(nX1 / dfRatioX)) + 1);
+        const int nCY1 = std::min(
+            nCoarseYSize, static_cast<int>(std::ceil(nY1 / dfRatioY)) + 1);
+        bool bHasValid = false;
+        bool bHasInvalid = false;
+        for (int iY = nCY0; iY < nCY1; ++iY)
+        {
+            for (int iX = nCX0; iX < nCX1; ++iX)
+            {
+                if (abyCoarse[static_cast<size_t>(iY) * nCoarseXSize + iX])
+                    bHasValid = true;
+                else
+                    bHasInvalid = true;
+            }
+        }
+        return bHasValid && bHasInvalid ? TileClass::BOUNDARY
+               : bHasValid              ? TileClass::FULL
+                                        : TileClass::EMPTY;
+    };
+
+    std::vector<std::unique_ptr<OGRGeometry>> apoParts;
+    const auto AddRectangle = [&apoParts](int nX0, int nY0, int nX1, int nY1)
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->addPoint(nX0, nY0);
+        poRing->addPoint(nX1, nY0);
+        poRing->addPoint(nX1, nY1);
+        poRing->addPoint(nX0, nY1);
+        poRing->addPoint(nX0, nY0);
+        auto poPoly = std::make_unique<OGRPolygon>();
+        poPoly->addRingDirectly(poRing.release());
+        apoParts.push_back(std::move(poPoly));
+    };
+
+    std::vector<std::pair<int, int>> anBoundaryTiles;
+    for (int nTileY = 0; nTileY < nTilesY; ++nTileY)
+    {
+        const int nY0 = nTileY * HIERARCHICAL_TILE_SIZE;
+        const int nY1 = std::min(nYSize, nY0 + HIERARCHICAL_TILE_SIZE);
+        // Runs of consecutive full tiles of a row become one rectangle
+        int nFullRunStart = -1;
+        for (int nTileX = 0; nTileX <= nTilesX; ++nTileX)
+        {
+            const TileClass eClass =
+                nTileX < nTilesX ? ClassifyTile(nTileX, nTileY)
+                                 : TileClass::EMPTY;
+            if (eClass == TileClass::FULL)
+            {
+                if (nFullRunStart < 0)
+                    nFullRunStart = nTileX;
+                continue;
+            }
+            if (nFullRunStart >= 0)
+            {
+                AddRectangle(nFullRunStart * HIERARCHICAL_TILE_SIZE, nY0,
+                             std::min(nXSize, nTileX * HIERARCHICAL_TILE_SIZE),
+                             nY1);
+                nFullRunStart = -1;
+            }
+            if (eClass == TileClass::BOUNDARY)
+                anBoundaryTiles.emplace_back(nTileX, nTileY);
+        }
+    }
+    CPLDebug("GDAL_FOOTPRINT",
+             "%d tiles, of which %d boundary tiles to refine",
+             nTilesX * nTilesY, static_cast<int>(anBoundaryTiles.size()));
+
+    // Refine boundary tiles. Reading is done by the calling thread, as the
+    // source bands are not thread-safe, and polygonization by worker
+    // threads, by waves of a few tiles per thread to bound memory usage.
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    GDALThreadReservation oThreadReservation(std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads))));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMEMDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "MEM driver not available");
+        return false;
+    }
+
+    struct TileJob
+    {
+        std::unique_ptr<GDALDataset> poDS{};
+        std::vector<std::unique_ptr<OGRGeometry>> apoPolygons{};
+        bool bOK = false;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    const auto TileJobFunc = [](void *pData)
+    {
+        TileJob *psJob = static_cast<TileJob *>(pData);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        auto hBand = GDALRasterBand::ToHandle(psJob->poDS->GetRasterBand(1));
+        OGRMemLayer oLayer("", nullptr, wkbUnknown);
+        psJob->bOK =
+            GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(&oLayer),
+                           /* iPixValField = */ -1, nullptr, nullptr,
+                           nullptr) == CE_None;
+        for (auto &&poFeature : oLayer)
+        {
+            psJob->apoPolygons.emplace_back(poFeature->StealGeometry());
+        }
+        CPLUninstallErrorHandlerAccumulator();
+    };
+
+    const size_t nTilesPerWave = static_cast<size_t>(nThreads) * 4;
+    for (size_t iWaveStart = 0; iWaveStart < anBoundaryTiles.size();
+         iWaveStart += nTilesPerWave)
+    {
+        const size_t iWaveEnd =
+            std::min(anBoundaryTiles.size(), iWaveStart + nTilesPerWave);
+        std::vector<TileJob> asJobs(iWaveEnd - iWaveStart);
+        for (size_t i = iWaveStart; i < iWaveEnd; ++i)
+        {
+            const int nX0 = anBoundaryTiles[i].first * HIERARCHICAL_TILE_SIZE;
+            const int nY0 = anBoundaryTiles[i].second * HIERARCHICAL_TILE_SIZE;
+            const int nTileXSize =
+                std::min(nXSize - nX0, HIERARCHICAL_TILE_SIZE);
+            const int nTileYSize =
+                std::min(nYSize - nY0, HIERARCHICAL_TILE_SIZE);
+            TileJob &sJob = asJobs[i - iWaveStart];
+            sJob.poDS.reset(poMEMDriver->Create("", nTileXSize, nTileYSize, 1,
+                                                GDT_Byte, nullptr));
+            if (!sJob.poDS)
+                return false;
+            // Polygonize directly in the pixel coordinates of poMask
+            double adfGT[6] = {static_cast<double>(nX0), 1, 0,
+                               static_cast<double>(nY0), 0, 1};
+            sJob.poDS->SetGeoTransform(adfGT);
+            std::vector<GByte> abyTile(static_cast<size_t>(nTileXSize) *
+                                       nTileYSize);
+            if (poMask->RasterIO(GF_Read, nX0, nY0, nTileXSize, nTileYSize,
+                                 abyTile.data(), nTileXSize, nTileYSize,
+                                 GDT_Byte, 0, 0, nullptr) != CE_None ||
+                sJob.poDS->GetRasterBand(1)->RasterIO(
+                    GF_Write, 0, 0, nTileXSize, nTileYSize, abyTile.data(),
+                    nTileXSize, nTileYSize, GDT_Byte, 0, 0,
+                    nullptr) != CE_None)
+            {
+                return false;
+            }
+        }
+        for (auto &sJob : asJobs)
+        {
+            if (!poJobQueue || !poJobQueue->SubmitJob(TileJobFunc, &sJob))
+            {
+                // Run it in the calling thread then
+                TileJobFunc(&sJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+        for (auto &sJob : asJobs)
+        {
+            for (const auto &sError : sJob.aoErrors)
+                CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+            if (!sJob.bOK)
+                return false;
+            for (auto &poPolygon : sJob.apoPolygons)
+                apoParts.push_back(std::move(poPolygon));
+        }
+
+        if (pfnProgress &&
+            !pfnProgress(0.9 * static_cast<double>(iWaveEnd) /
+                             static_cast<double>(anBoundaryTiles.size()),
+                         "", pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+    oThreadReservation.Release();
+
+    // Dissolve tile seams
+    if (!apoParts.empty())
+    {
+        std::vector<const OGRGeometry *> apoPartsPtr;
+        for (const auto &poPart : apoParts)
+            apoPartsPtr.push_back(poPart.get());
+        auto poUnion = OGRGeometryFactory::unionGeometries(
+            apoPartsPtr.data(), apoPartsPtr.size());
+        if (!poUnion)
+            return false;
+        apoParts.clear();
+
+        const auto AddPolygon = [poDstLayer](const OGRGeometry *poGeom)
+        {
+            if (wkbFlatten(poGeom->getGeometryType()) != wkbPolygon)
+                return true;
+            OGRFeature oFeature(poDstLayer->GetLayerDefn());
+            oFeature.SetGeometry(poGeom);
+            return poDstLayer->CreateFeature(&oFeature) == OGRERR_NONE;
+        };
+        const auto eUnionType = wkbFlatten(poUnion->getGeometryType());
+        if (eUnionType == wkbMultiPolygon ||
+            eUnionType == wkbGeometryCollection)
+        {
+            for (const auto *poSubGeom : *(poUnion->toGeometryCollection()))
+            {
+                if (!AddPolygon(poSubGeom))
+                    return false;
+            }
+        }
+        else if (!AddPolygon(poUnion.get()))
+        {
+            return false;
+        }
+    }
+
+    if (pfnProgress && !pfnProgress(1.0, "", pProgressData))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                             CountPoints()                            */
 /************************************************************************/
@@ -698,110 +998,144 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             adfSrcNoData.emplace_back(CPLAtof(aosSrcNoData[i]));
         }
     }
-    bool bGlobalMask = true;
-    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
-    for (size_t i = 0; i < anBands.size(); ++i)
+
+    // Collects the mask bands of the selected bands, at full resolution, or
+    // at the nOvrIndex overview level if it is >= 0
+    const auto CollectMaskBands =
+        [poSrcDS, nBandCount, &anBands, &adfSrcNoData](
+            int nOvrIndex, std::vector<GDALRasterBand *> &apoSrcMaskBands,
+            std::vector<std::unique_ptr<GDALRasterBand>> &apoTmpNoDataMaskBands,
+            bool &bGlobalMask)
     {
-        const int nBand = anBands[i];
-        if (nBand <= 0 || nBand > nBandCount)
+        bGlobalMask = true;
+        for (size_t i = 0; i < anBands.size(); ++i)
         {
-            CPLError(CE_Failure, CPLE_AppDefined, "Invalid band number: %d",
-                     nBand);
-            return false;
-        }
-        auto poBand = poSrcDS->GetRasterBand(nBand);
-        if (!adfSrcNoData.empty())
-        {
-            bGlobalMask = false;
-            apoTmpNoDataMaskBands.emplace_back(
-                std::make_unique<GDALNoDataMaskBand>(
-                    poBand, adfSrcNoData.size() == 1 ? adfSrcNoData[0]
-                                                     : adfSrcNoData[i]));
-            apoSrcMaskBands.push_back(apoTmpNoDataMaskBands.back().get());
-        }
-        else
-        {
-            GDALRasterBand *poMaskBand;
-            const int nMaskFlags = poBand->GetMaskFlags();
-            if (poBand->GetColorInterpretation() == GCI_AlphaBand)
+            const int nBand = anBands[i];
+            if (nBand <= 0 || nBand > nBandCount)
             {
-                poMaskBand = poBand;
+                CPLError(CE_Failure, CPLE_AppDefined, "Invalid band number: %d",
+                         nBand);
+                return false;
             }
-            else
+            auto poBand = poSrcDS->GetRasterBand(nBand);
+            if (!adfSrcNoData.empty())
             {
-                if ((nMaskFlags & GMF_PER_DATASET) == 0)
+                bGlobalMask = false;
+                GDALRasterBand *poNoDataBand = poBand;
+                if (nOvrIndex >= 0)
                 {
-                    bGlobalMask = false;
+                    poNoDataBand = poBand->GetOverview(nOvrIndex);
+                    if (!poNoDataBand)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Overview index %d invalid for this dataset",
+                                 nOvrIndex);
+                        return false;
+                    }
                 }
-                poMaskBand = poBand->GetMaskBand();
+                apoTmpNoDataMaskBands.emplace_back(
+                    std::make_unique<GDALNoDataMaskBand>(
+                        poNoDataBand, adfSrcNoData.size() == 1
+                                          ? adfSrcNoData[0]
+                                          : adfSrcNoData[i]));
+                apoSrcMaskBands.push_back(apoTmpNoDataMaskBands.back().get());
             }
-            if (psOptions->nOvrIndex >= 0)
+            else
             {
-                if (nMaskFlags == GMF_NODATA)
+                GDALRasterBand *poMaskBand;
+                const int nMaskFlags = poBand->GetMaskFlags();
+                if (poBand->GetColorInterpretation() == GCI_AlphaBand)
                 {
-                    // If the mask band is based on nodata, we don't need
-                    // to check the overviews of the mask band, but we
-                    // can take the mask band of the overviews
-                    auto poOvrBand = poBand->GetOverview(psOptions->nOvrIndex);
-                    if (!poOvrBand)
-                    {
-                        if (poBand->GetOverviewCount() == 0)
-                        {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Bands of this dataset have no "
-                                "precomputed overviews",
-                                psOptions->nOvrIndex);
-                        }
-                        else
-                        {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Value should be in [0,%d] range",
-                                psOptions->nOvrIndex,
-                                poBand->GetOverviewCount() - 1);
-                        }
-                        return false;
-                    }
-                    if (poOvrBand->GetMaskFlags() != GMF_NODATA)
+                    poMaskBand = poBand;
+                }
+                else
+                {
+                    if ((nMaskFlags & GMF_PER_DATASET) == 0)
                     {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "poOvrBand->GetMaskFlags() != GMF_NODATA");
-                        return false;
+                        bGlobalMask = false;
                     }
-                    poMaskBand = poOvrBand->GetMaskBand();
+                    poMaskBand = poBand->GetMaskBand();
                 }
-                else
+                if (nOvrIndex >= 0)
                 {
-                    poMaskBand = poMaskBand->GetOverview(psOptions->nOvrIndex);
-                    if (!poMaskBand)
+                    if (nMaskFlags == GMF_NODATA)
                     {
-                        if (poBand->GetMaskBand()->GetOverviewCount() == 0)
+                        // If the mask band is based on nodata, we don't need
+                        // to check the overviews of the mask band, but we
+                        // can take the mask band of the overviews
+                        auto poOvrBand = poBand->GetOverview(nOvrIndex);
+                        if (!poOvrBand)
                         {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Mask bands of this dataset have no "
-                                "precomputed overviews",
-                                psOptions->nOvrIndex);
+                            if (poBand->GetOverviewCount() == 0)
+                            {
+                                CPLError(
+                                    CE_Failure, CPLE_AppDefined,
+                                    "Overview index %d invalid for this "
+                                    "dataset. Bands of this dataset have no "
+                                    "precomputed overviews",
+                                    nOvrIndex);
+                            }
+                            else
+                            {
+                                CPLError(
+                                    CE_Failure, CPLE_AppDefined,
+                                    "Overview index %d invalid for this "
+                                    "dataset. Value should be in [0,%d] "
+                                    "range",
+                                    nOvrIndex,
+                                    poBand->GetOverviewCount() - 1);
+                            }
+                            return false;
                         }
-                        else
+                        if (poOvrBand->GetMaskFlags() != GMF_NODATA)
                         {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Value should be in [0,%d] range",
-                                psOptions->nOvrIndex,
-                                poBand->GetMaskBand()->GetOverviewCount() - 1);
+                            CPLError(CE_Failure, CPLE_AppDefined,
+                                     "poOvrBand->GetMaskFlags() != GMF_NODATA");
+                            return false;
+                        }
+                        poMaskBand = poOvrBand->GetMaskBand();
+                    }
+                    else
+                    {
+                        poMaskBand = poMaskBand->GetOverview(nOvrIndex);
+                        if (!poMaskBand)
+                        {
+                            if (poBand->GetMaskBand()->GetOverviewCount() == 0)
+                            {
+                                CPLError(
+                                    CE_Failure, CPLE_AppDefined,
+                                    "Overview index %d invalid for this "
+                                    "dataset. Mask bands of this dataset "
+                                    "have no precomputed overviews",
+                                    nOvrIndex);
+                            }
+                            else
+                            {
+                                CPLError(
+                                    CE_Failure, CPLE_AppDefined,
+                                    "Overview index %d invalid for this "
+                                    "dataset. Value should be in [0,%d] "
+                                    "range",
+                                    nOvrIndex,
+                                    poBand->GetMaskBand()->GetOverviewCount() -
+                                        1);
+                            }
+                            return false;
                         }
-                        return false;
                     }
                 }
+                apoSrcMaskBands.push_back(poMaskBand);
             }
-            apoSrcMaskBands.push_back(poMaskBand);
         }
+        return true;
+    };
+
+    bool bGlobalMask = true;
+    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
+    if (!CollectMaskBands(psOptions->nOvrIndex, apoSrcMaskBands,
+                          apoTmpNoDataMaskBands, bGlobalMask))
+    {
+        return false;
     }
 
     std::unique_ptr<OGRCoordinateTransformation> poCT_GT;
@@ -843,28 +1177,67 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             adfGeoTransform);
     }
 
-    std::unique_ptr<GDALRasterBand> poMaskForRasterize;
-    if (bGlobalMask || anBands.size() == 1)
+    const auto CreateMaskForRasterize =
+        [&anBands, psOptions](const std::vector<GDALRasterBand *> &apoMaskBands,
+                              bool bGlobal)
     {
-        poMaskForRasterize =
-            std::make_unique<GDALFootprintMaskBand>(apoSrcMaskBands[0]);
-    }
-    else
-    {
-        poMaskForRasterize = std::make_unique<GDALFootprintCombinedMaskBand>(
-            apoSrcMaskBands, psOptions->bCombineBandsUnion);
-    }
+        std::unique_ptr<GDALRasterBand> poMask;
+        if (bGlobal || anBands.size() == 1)
+        {
+            poMask = std::make_unique<GDALFootprintMaskBand>(apoMaskBands[0]);
+        }
+        else
+        {
+            poMask = std::make_unique<GDALFootprintCombinedMaskBand>(
+                apoMaskBands, psOptions->bCombineBandsUnion);
+        }
+        return poMask;
+    };
+
+    auto poMaskForRasterize =
+        CreateMaskForRasterize(apoSrcMaskBands, bGlobalMask);
 
-    auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
     auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
-    const CPLErr eErr =
-        GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
-                       /* iPixValField = */ -1,
-                       /* papszOptions = */ nullptr, psOptions->pfnProgress,
-                       psOptions->pProgressData);
-    if (eErr != CE_None)
+    if (psOptions->nCoarseOvrIndex >= 0)
     {
-        return false;
+        std::vector<GDALRasterBand *> apoCoarseMaskBands;
+        std::vector<std::unique_ptr<GDALRasterBand>> apoTmpCoarseMaskBands;
+        bool bCoarseGlobalMask = true;
+        if (!CollectMaskBands(psOptions->nCoarseOvrIndex, apoCoarseMaskBands,
+                              apoTmpCoarseMaskBands, bCoarseGlobalMask))
+        {
+            return false;
+        }
+        auto poCoarseMask =
+            CreateMaskForRasterize(apoCoarseMaskBands, bCoarseGlobalMask);
+        if (poCoarseMask->GetXSize() >= poMaskForRasterize->GetXSize() &&
+            poCoarseMask->GetYSize() >= poMaskForRasterize->GetYSize())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "-coarse_ovr should designate an overview level coarser "
+                     "than the one used to compute the footprint");
+            return false;
+        }
+        if (!PolygonizeHierarchical(poMaskForRasterize.get(),
+                                    poCoarseMask.get(), poMemLayer.get(),
+                                    psOptions->pfnProgress,
+                                    psOptions->pProgressData))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
+        const CPLErr eErr =
+            GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
+                           /* iPixValField = */ -1,
+                           /* papszOptions = */ nullptr,
+                           psOptions->pfnProgress, psOptions->pProgressData);
+        if (eErr != CE_None)
+        {
+            return false;
+        }
     }
 
     if (!psOptions->bSplitPolys)
@@ -1399,6 +1772,11 @@ GDALFootprintOptionsNew(char **papszArgv,
             i++;
             psOptions->nOvrIndex = atoi(papszArgv[i]);
         }
+        else if (i < argc - 1 && EQUAL(papszArgv[i], "-coarse_ovr"))
+        {
+            i++;
+            psOptions->nCoarseOvrIndex = atoi(papszArgv[i]);
+        }
 
         else if (papszArgv[i][0] == '-')
         {
@@ -1450,6 +1828,14 @@ GDALFootprintOptionsNew(char **papszArgv,
         return nullptr;
     }
 
+    if (psOptions->nCoarseOvrIndex >= 0 &&
+        psOptions->nCoarseOvrIndex <= psOptions->nOvrIndex)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "-coarse_ovr should be greater than -ovr.");
+        return nullptr;
+    }
+
     if (psOptionsForBinary)
     {
         psOptionsForBinary->bCreateOutput = psOptions->bCreateOutput;
@@ -38,6 +38,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -352,6 +353,25 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
     oVisitor.dfIncreaseBurnValue = dfIncreaseBurnValue;
     oVisitor.dfMultiplyBurnValue = dfMultiplyBurnValue;
 
+    // Avoid repeated reallocations of the coordinate arrays when the number
+    // of (point) features is cheaply available.
+    const GIntBig nFeatureCount = poSrcLayer->GetFeatureCount(FALSE);
+    if (nFeatureCount > 0 &&
+        nFeatureCount < static_cast<GIntBig>(
+                            std::numeric_limits<uint32_t>::max()))
+    {
+        try
+        {
+            oVisitor.adfX.reserve(static_cast<size_t>(nFeatureCount));
+            oVisitor.adfY.reserve(static_cast<size_t>(nFeatureCount));
+            oVisitor.adfZ.reserve(static_cast<size_t>(nFeatureCount));
+        }
+        catch (const std::exception &)
+        {
+            // Not fatal: the arrays will grow as needed.
+        }
+    }
+
     for (auto &&poFeat : poSrcLayer)
     {
         const OGRGeometry *poGeom = poFeat->GetGeometryRef();
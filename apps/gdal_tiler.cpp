@@ -0,0 +1,1374 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Generate a pyramid of tiles following a tile matrix set
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_version.h"
+#include "gdal.h"
+#include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdal_utils.h"
+#include "gdalwarper.h"
+#include "ogr_api.h"
+#include "ogr_spatialref.h"
+#include "tilematrixset.hpp"
+#include "commonutils.h"
+#include "gdalargumentparser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+/************************************************************************/
+/*                              TileRange                               */
+/************************************************************************/
+
+/** Range of tiles of a zoom level. Max values are exclusive. */
+struct TileRange
+{
+    int nMinX = 0;
+    int nMinY = 0;
+    int nMaxX = 0;
+    int nMaxY = 0;
+};
+
+/************************************************************************/
+/*                                Chunk                                 */
+/************************************************************************/
+
+/** Rectangular group of tiles of a zoom level, held in memory.
+ *
+ * Pixels are stored band-sequential: the data bands first, then an alpha
+ * band. The tiles are surrounded by a margin of nHalo pixels of the
+ * neighbouring tiles, so that resampling kernels see across the borders
+ * of the chunk.
+ */
+struct Chunk
+{
+    int nZoom = 0;
+    int nTileX0 = 0;
+    int nTileY0 = 0;
+    int nTilesX = 0;
+    int nTilesY = 0;
+    int nHalo = 0;
+    std::vector<GByte> abyData{};
+};
+
+/************************************************************************/
+/*                              GDALTiler                               */
+/************************************************************************/
+
+/** Generates a pyramid of tiles in a z/x/y directory hierarchy.
+ *
+ * The maximum zoom level is warped from the source dataset in chunks of
+ * (up to) MAX_CHUNK_TILES x MAX_CHUNK_TILES tiles. Each chunk is
+ * successively downsampled with the overview resampling kernels to produce
+ * the tiles of the lower zoom levels it fully covers. The remaining zoom
+ * levels are produced the same way, from chunks read from an uncompressed
+ * temporary GeoTIFF file holding the lowest zoom level of the previous
+ * pass, so that lossy tile formats do not degrade the lower zoom levels.
+ * Tiles are encoded in worker threads.
+ */
+class GDALTiler
+{
+  public:
+    // Chunks are at most 16x16 tiles (4096x4096 pixels with 256x256 tiles),
+    // and thus provide 4 lower zoom levels from a single warping.
+    static constexpr int MAX_CHUNK_LEVELS = 4;
+    static constexpr int MAX_CHUNK_TILES = 1 << MAX_CHUNK_LEVELS;
+
+    GDALDataset *m_poSrcDS = nullptr;
+    std::unique_ptr<gdal::TileMatrixSet> m_poTMS{};
+    std::string m_osOutputDir{};
+    std::string m_osTileFormat = "PNG";
+    CPLStringList m_aosCreationOptions{};
+    std::string m_osResampling = "average";
+    std::string m_osNumThreads{};
+    bool m_bXYZ = false;
+    int m_nMinZoom = -1;
+    int m_nMaxZoom = -1;
+    bool m_bSrcNoDataSet = false;
+    double m_dfSrcNoData = 0;
+
+    GDALTiler() = default;
+    ~GDALTiler();
+
+    bool Run(GDALProgressFunc pfnProgress, void *pProgressData);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALTiler)
+
+    GDALDriver *m_poMEMDriver = nullptr;
+    GDALDriver *m_poTileDriver = nullptr;
+    std::string m_osExtension{};
+    std::string m_osOvrResampling{};
+    // Radius of the overview resampling kernel, in pixels of the lower
+    // zoom level
+    int m_nOvrRadius = 0;
+    GDALResampleAlg m_eResampleAlg = GRA_Average;
+    int m_nDataBands = 0;
+    bool m_bSrcAlpha = false;
+    int m_nTileSize = 0;
+    double m_dfOriX = 0;
+    double m_dfOriY = 0;
+    std::vector<TileRange> m_aoRanges{};
+    std::set<std::pair<int, int>> m_oCreatedDirs{};
+    // Must be destroyed in reverse order, as each VRT refers to the
+    // previous dataset
+    std::unique_ptr<GDALDataset> m_poExpandedSrcDS{};
+    std::unique_ptr<GDALDataset> m_poClampedSrcDS{};
+    void *m_hTransformArg = nullptr;
+    GDALWarpOptions *m_psWO = nullptr;
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    int m_nMaxPendingJobs = 0;
+    std::atomic<bool> m_bError{false};
+    // Lowest zoom level of the previous pass, read by the current one, and
+    // of the current pass, written for the next one.
+    std::unique_ptr<GDALDataset> m_poReadLevelDS{};
+    std::unique_ptr<GDALDataset> m_poWriteLevelDS{};
+    std::vector<std::string> m_aosTempFiles{};
+
+    // Band of the tile files, as (index of internal band, color
+    // interpretation)
+    std::vector<std::pair<int, GDALColorInterp>> m_aoOutputBands{};
+
+    bool CheckSource();
+    bool SetupTileFormat();
+    bool ComputeZoomLevels();
+    bool SetupWarping();
+    void ClampSourceToMercatorLatitudes();
+
+    const gdal::TileMatrixSet::TileMatrix &GetTileMatrix(int nZoom) const
+    {
+        return m_poTMS->tileMatrixList()[nZoom];
+    }
+
+    int GetInternalBandCount() const
+    {
+        return m_nDataBands + 1;
+    }
+
+    int GetChunkXSize(const Chunk &oChunk) const
+    {
+        return oChunk.nTilesX * m_nTileSize + 2 * oChunk.nHalo;
+    }
+
+    int GetChunkYSize(const Chunk &oChunk) const
+    {
+        return oChunk.nTilesY * m_nTileSize + 2 * oChunk.nHalo;
+    }
+
+    size_t GetChunkPlaneSize(const Chunk &oChunk) const
+    {
+        return static_cast<size_t>(GetChunkXSize(oChunk)) *
+               GetChunkYSize(oChunk);
+    }
+
+    std::string GetTileFilename(int nZoom, int nTileX, int nTileY) const;
+    std::unique_ptr<GDALDataset>
+    WrapBuffer(GByte *pabyData, int nXSize, int nYSize, size_t nPlaneSize,
+               const std::vector<std::pair<int, GDALColorInterp>> &aoBands);
+    std::vector<std::pair<int, GDALColorInterp>> GetInternalBands() const;
+
+    void AllocateChunk(Chunk &oChunk, int nZoom, int nTileX0, int nTileY0,
+                       int nTilesX, int nTilesY, int nHalo) const;
+    bool WarpChunk(Chunk &oChunk);
+    bool ReadChunk(Chunk &oChunk);
+    bool DownsampleChunk(const Chunk &oSrc, Chunk &oDst);
+    bool WriteChunkTiles(const Chunk &oChunk);
+    bool CreateWriteLevelDataset(int nZoom);
+    void RemoveLevelDatasets();
+    bool LevelDatasetIO(GDALRWFlag eRWFlag, GDALDataset *poDS,
+                        Chunk &oChunk);
+    bool ProcessPass(int nBaseZoom, bool bWarp, int nLevels,
+                     GDALProgressFunc pfnProgress, void *pProgressData,
+                     double &dfProgress, double dfProgressPerChunk);
+    int GetPassChunkCount(int nBaseZoom) const;
+
+    struct EncodeJob
+    {
+        GDALTiler *poTiler = nullptr;
+        std::vector<GByte> abyTile{};
+        std::string osFilename{};
+    };
+
+    static void EncodeTileJob(void *pData);
+};
+
+/************************************************************************/
+/*                             ~GDALTiler()                             */
+/************************************************************************/
+
+GDALTiler::~GDALTiler()
+{
+    if (m_psWO)
+        GDALDestroyWarpOptions(m_psWO);
+    if (m_hTransformArg)
+        GDALDestroyGenImgProjTransformer(m_hTransformArg);
+    RemoveLevelDatasets();
+}
+
+/************************************************************************/
+/*                        RemoveLevelDatasets()                         */
+/************************************************************************/
+
+void GDALTiler::RemoveLevelDatasets()
+{
+    m_poReadLevelDS.reset();
+    m_poWriteLevelDS.reset();
+    for (const auto &osFilename : m_aosTempFiles)
+        VSIUnlink(osFilename.c_str());
+    m_aosTempFiles.clear();
+}
+
+/************************************************************************/
+/*                            CheckSource()                             */
+/************************************************************************/
+
+bool GDALTiler::CheckSource()
+{
+    const int nBands = m_poSrcDS->GetRasterCount();
+    if (nBands == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Input dataset has no band");
+        return false;
+    }
+
+    // Paletted datasets are expanded to RGBA
+    if (nBands == 1 && m_poSrcDS->GetRasterBand(1)->GetColorTable())
+    {
+        CPLStringList aosOptions;
+        aosOptions.AddString("-of");
+        aosOptions.AddString("VRT");
+        aosOptions.AddString("-expand");
+        aosOptions.AddString("rgba");
+        GDALTranslateOptions *psOptions =
+            GDALTranslateOptionsNew(aosOptions.List(), nullptr);
+        m_poExpandedSrcDS.reset(GDALDataset::FromHandle(GDALTranslate(
+            "", GDALDataset::ToHandle(m_poSrcDS), psOptions, nullptr)));
+        GDALTranslateOptionsFree(psOptions);
+        if (!m_poExpandedSrcDS)
+            return false;
+        m_poSrcDS = m_poExpandedSrcDS.get();
+    }
+
+    const int nSrcBands = m_poSrcDS->GetRasterCount();
+    for (int i = 1; i <= nSrcBands; ++i)
+    {
+        if (m_poSrcDS->GetRasterBand(i)->GetRasterDataType() != GDT_Byte)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Only Byte bands are supported. You may use "
+                     "gdal_translate -scale -ot Byte first");
+            return false;
+        }
+    }
+
+    m_bSrcAlpha = (nSrcBands == 2 || nSrcBands == 4) &&
+                  m_poSrcDS->GetRasterBand(nSrcBands)
+                          ->GetColorInterpretation() == GCI_AlphaBand;
+    m_nDataBands = m_bSrcAlpha ? nSrcBands - 1 : nSrcBands;
+    if (m_nDataBands != 1 && m_nDataBands != 3)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Only datasets with 1 (gray) or 3 (RGB) bands, optionally "
+                 "followed by an alpha band, are supported");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          SetupTileFormat()                           */
+/************************************************************************/
+
+bool GDALTiler::SetupTileFormat()
+{
+    m_poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    m_poTileDriver =
+        GetGDALDriverManager()->GetDriverByName(m_osTileFormat.c_str());
+    if (!m_poMEMDriver || !m_poTileDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Driver %s is not available",
+                 m_poMEMDriver ? m_osTileFormat.c_str() : "MEM");
+        return false;
+    }
+
+    const int nAlpha = m_nDataBands;
+    if (EQUAL(m_osTileFormat.c_str(), "PNG"))
+    {
+        m_osExtension = "png";
+        if (m_nDataBands == 1)
+        {
+            m_aoOutputBands = {{0, GCI_GrayIndex}, {nAlpha, GCI_AlphaBand}};
+        }
+        else
+        {
+            m_aoOutputBands = {{0, GCI_RedBand},
+                               {1, GCI_GreenBand},
+                               {2, GCI_BlueBand},
+                               {nAlpha, GCI_AlphaBand}};
+        }
+    }
+    else if (EQUAL(m_osTileFormat.c_str(), "JPEG"))
+    {
+        // No transparency: partially covered tiles are filled with black
+        m_osExtension = "jpg";
+        if (m_nDataBands == 1)
+        {
+            m_aoOutputBands = {{0, GCI_GrayIndex}};
+        }
+        else
+        {
+            m_aoOutputBands = {
+                {0, GCI_RedBand}, {1, GCI_GreenBand}, {2, GCI_BlueBand}};
+        }
+    }
+    else if (EQUAL(m_osTileFormat.c_str(), "WEBP"))
+    {
+        // WEBP only handles RGB(A): gray is replicated
+        m_osExtension = "webp";
+        const int nG = m_nDataBands == 1 ? 0 : 1;
+        const int nB = m_nDataBands == 1 ? 0 : 2;
+        m_aoOutputBands = {{0, GCI_RedBand},
+                           {nG, GCI_GreenBand},
+                           {nB, GCI_BlueBand},
+                           {nAlpha, GCI_AlphaBand}};
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported tile format %s. Only PNG, JPEG and WEBP are "
+                 "supported",
+                 m_osTileFormat.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      ClampSourceToMercatorLatitudes()                */
+/************************************************************************/
+
+/** Restricts a geographic source dataset to the latitudes that can be
+ * represented in WebMercator, as GDALSuggestedWarpOutput2() would otherwise
+ * fail or give a poor estimate. */
+void GDALTiler::ClampSourceToMercatorLatitudes()
+{
+    double adfSrcGT[6];
+    const auto poSrcSRS = m_poSrcDS->GetSpatialRef();
+    if (!poSrcSRS || !poSrcSRS->IsGeographic() ||
+        poSrcSRS->IsDerivedGeographic() ||
+        m_poSrcDS->GetGeoTransform(adfSrcGT) != CE_None || adfSrcGT[2] != 0 ||
+        adfSrcGT[4] != 0 || adfSrcGT[5] >= 0)
+    {
+        return;
+    }
+
+    // Corresponds to the latitude of the WebMercator bounds
+    constexpr double MAX_LAT = 85.0511287798066;
+    const double dfMaxLat = adfSrcGT[3];
+    const double dfMinLat =
+        adfSrcGT[3] + m_poSrcDS->GetRasterYSize() * adfSrcGT[5];
+    if (dfMaxLat <= MAX_LAT && dfMinLat >= -MAX_LAT)
+        return;
+
+    CPLStringList aosOptions;
+    aosOptions.AddString("-of");
+    aosOptions.AddString("VRT");
+    aosOptions.AddString("-projwin");
+    aosOptions.AddString(CPLSPrintf("%.18g", adfSrcGT[0]));
+    aosOptions.AddString(CPLSPrintf("%.18g", std::min(dfMaxLat, MAX_LAT)));
+    aosOptions.AddString(CPLSPrintf(
+        "%.18g", adfSrcGT[0] + m_poSrcDS->GetRasterXSize() * adfSrcGT[1]));
+    aosOptions.AddString(CPLSPrintf("%.18g", std::max(dfMinLat, -MAX_LAT)));
+    GDALTranslateOptions *psOptions =
+        GDALTranslateOptionsNew(aosOptions.List(), nullptr);
+    m_poClampedSrcDS.reset(GDALDataset::FromHandle(GDALTranslate(
+        "", GDALDataset::ToHandle(m_poSrcDS), psOptions, nullptr)));
+    GDALTranslateOptionsFree(psOptions);
+    if (m_poClampedSrcDS)
+        m_poSrcDS = m_poClampedSrcDS.get();
+}
+
+/************************************************************************/
+/*                         ComputeZoomLevels()                          */
+/************************************************************************/
+
+bool GDALTiler::ComputeZoomLevels()
+{
+    if (!m_poTMS->haveAllLevelsSameTopLeft() ||
+        !m_poTMS->haveAllLevelsSameTileSize() ||
+        !m_poTMS->hasOnlyPowerOfTwoVaryingScales() ||
+        m_poTMS->hasVariableMatrixWidth())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported tile matrix set: all zoom levels must have the "
+                 "same top left corner and tile size, resolutions must vary "
+                 "by a factor of 2, and matrix widths must be constant");
+        return false;
+    }
+
+    OGRSpatialReference oTargetSRS;
+    if (oTargetSRS.SetFromUserInput(
+            m_poTMS->crs().c_str(),
+            OGRSpatialReference::SET_FROM_USER_INPUT_LIMITATIONS_get()) !=
+        OGRERR_NONE)
+    {
+        return false;
+    }
+    oTargetSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+
+    const char *pszAuthCode = oTargetSRS.GetAuthorityCode(nullptr);
+    if (pszAuthCode && atoi(pszAuthCode) == 3857)
+        ClampSourceToMercatorLatitudes();
+
+    char *pszWKT = nullptr;
+    oTargetSRS.exportToWkt(&pszWKT);
+    CPLStringList aosTO;
+    aosTO.SetNameValue("DST_SRS", pszWKT);
+    CPLFree(pszWKT);
+    m_hTransformArg =
+        GDALCreateGenImgProjTransformer2(m_poSrcDS, nullptr, aosTO.List());
+    if (m_hTransformArg == nullptr)
+        return false;
+
+    double adfGT[6];
+    double adfExtent[4];
+    int nXSize = 0;
+    int nYSize = 0;
+    if (GDALSuggestedWarpOutput2(m_poSrcDS, GDALGenImgProjTransform,
+                                 m_hTransformArg, adfGT, &nXSize, &nYSize,
+                                 adfExtent, 0) != CE_None)
+    {
+        return false;
+    }
+    const double dfSrcRes = adfGT[1];
+
+    const auto &tmList = m_poTMS->tileMatrixList();
+    const int nLevels = static_cast<int>(tmList.size());
+    m_nTileSize = tmList[0].mTileWidth;
+    if (m_nTileSize != tmList[0].mTileHeight)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Only square tiles are supported");
+        return false;
+    }
+
+    // Finest zoom level whose resolution is not coarser than the source one
+    if (m_nMaxZoom < 0)
+    {
+        m_nMaxZoom = 0;
+        while (m_nMaxZoom + 1 < nLevels &&
+               tmList[m_nMaxZoom].mResX > dfSrcRes * (1 + 1e-8))
+        {
+            ++m_nMaxZoom;
+        }
+    }
+    if (m_nMaxZoom >= nLevels)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid zoom level: should be in [0,%d]", nLevels - 1);
+        return false;
+    }
+
+    // Coarsest zoom level is the one where the raster fits into a tile
+    if (m_nMinZoom < 0)
+    {
+        const double dfExtentSize =
+            std::max(adfExtent[2] - adfExtent[0], adfExtent[3] - adfExtent[1]);
+        m_nMinZoom = 0;
+        while (m_nMinZoom < m_nMaxZoom &&
+               tmList[m_nMinZoom + 1].mResX * m_nTileSize >= dfExtentSize)
+        {
+            ++m_nMinZoom;
+        }
+    }
+    if (m_nMinZoom > m_nMaxZoom)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Minimum zoom level is greater than maximum zoom level");
+        return false;
+    }
+
+    const bool bInvertAxis = oTargetSRS.EPSGTreatsAsLatLong() != FALSE ||
+                             oTargetSRS.EPSGTreatsAsNorthingEasting() != FALSE;
+    m_dfOriX = bInvertAxis ? tmList[0].mTopLeftY : tmList[0].mTopLeftX;
+    m_dfOriY = bInvertAxis ? tmList[0].mTopLeftX : tmList[0].mTopLeftY;
+
+    // Tile range of the maximum zoom level, from which the ones of the
+    // lower zoom levels are derived, so that they are consistent.
+    const auto &oTM = GetTileMatrix(m_nMaxZoom);
+    const double dfTileExtent = oTM.mResX * m_nTileSize;
+    constexpr double TOLERANCE_IN_PIXEL = 0.499;
+    const double dfEps = TOLERANCE_IN_PIXEL * oTM.mResX;
+    TileRange oRange;
+    oRange.nMinX = static_cast<int>(std::max(
+        0.0, std::floor((adfExtent[0] - m_dfOriX + dfEps) / dfTileExtent)));
+    oRange.nMinY = static_cast<int>(std::max(
+        0.0, std::floor((m_dfOriY - adfExtent[3] + dfEps) / dfTileExtent)));
+    oRange.nMaxX = static_cast<int>(
+        std::min(static_cast<double>(oTM.mMatrixWidth),
+                 std::ceil((adfExtent[2] - m_dfOriX - dfEps) / dfTileExtent)));
+    oRange.nMaxY = static_cast<int>(
+        std::min(static_cast<double>(oTM.mMatrixHeight),
+                 std::ceil((m_dfOriY - adfExtent[1] - dfEps) / dfTileExtent)));
+    if (oRange.nMinX >= oRange.nMaxX || oRange.nMinY >= oRange.nMaxY)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Raster extent completely outside of tile matrix set");
+        return false;
+    }
+
+    m_aoRanges.resize(m_nMaxZoom + 1);
+    for (int nZoom = m_nMaxZoom; nZoom >= m_nMinZoom; --nZoom)
+    {
+        const int nShift = m_nMaxZoom - nZoom;
+        TileRange &oLevelRange = m_aoRanges[nZoom];
+        oLevelRange.nMinX = oRange.nMinX >> nShift;
+        oLevelRange.nMinY = oRange.nMinY >> nShift;
+        oLevelRange.nMaxX = ((oRange.nMaxX - 1) >> nShift) + 1;
+        oLevelRange.nMaxY = ((oRange.nMaxY - 1) >> nShift) + 1;
+    }
+
+    CPLDebug("GDALTiler", "Zoom levels %d to %d", m_nMinZoom, m_nMaxZoom);
+    return true;
+}
+
+/************************************************************************/
+/*                            SetupWarping()                            */
+/************************************************************************/
+
+bool GDALTiler::SetupWarping()
+{
+    static const struct
+    {
+        const char *pszName;
+        GDALResampleAlg eAlg;
+        const char *pszOvrName;
+        int nOvrRadius;
+    } asResamplings[] = {
+        {"near", GRA_NearestNeighbour, "NEAREST", 0},
+        {"bilinear", GRA_Bilinear, "BILINEAR", 1},
+        {"cubic", GRA_Cubic, "CUBIC", 2},
+        {"cubicspline", GRA_CubicSpline, "CUBICSPLINE", 2},
+        {"lanczos", GRA_Lanczos, "LANCZOS", 3},
+        {"average", GRA_Average, "AVERAGE", 0},
+        {"rms", GRA_RMS, "RMS", 0},
+        {"mode", GRA_Mode, "MODE", 0},
+    };
+    bool bFound = false;
+    for (const auto &sResampling : asResamplings)
+    {
+        if (EQUAL(m_osResampling.c_str(), sResampling.pszName))
+        {
+            m_eResampleAlg = sResampling.eAlg;
+            m_osOvrResampling = sResampling.pszOvrName;
+            m_nOvrRadius = sResampling.nOvrRadius;
+            bFound = true;
+            break;
+        }
+    }
+    if (!bFound)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Unsupported resampling %s",
+                 m_osResampling.c_str());
+        return false;
+    }
+
+    m_psWO = GDALCreateWarpOptions();
+    m_psWO->hSrcDS = GDALDataset::ToHandle(m_poSrcDS);
+    m_psWO->eResampleAlg = m_eResampleAlg;
+    m_psWO->eWorkingDataType = GDT_Byte;
+    m_psWO->dfWarpMemoryLimit = 256 * 1024 * 1024;
+    GDALWarpInitDefaultBandMapping(m_psWO, m_nDataBands);
+    if (m_bSrcAlpha)
+        m_psWO->nSrcAlphaBand = m_nDataBands + 1;
+    m_psWO->nDstAlphaBand = m_nDataBands + 1;
+
+    if (m_bSrcNoDataSet)
+    {
+        GDALWarpInitSrcNoDataReal(m_psWO, m_dfSrcNoData);
+    }
+    else
+    {
+        bool bAllBandsHaveNoData = true;
+        std::vector<double> adfNoData;
+        for (int i = 1; i <= m_nDataBands; ++i)
+        {
+            int bHasNoData = FALSE;
+            adfNoData.push_back(
+                m_poSrcDS->GetRasterBand(i)->GetNoDataValue(&bHasNoData));
+            bAllBandsHaveNoData &= CPL_TO_BOOL(bHasNoData);
+        }
+        if (bAllBandsHaveNoData)
+        {
+            GDALWarpInitSrcNoDataReal(m_psWO, 0);
+            for (int i = 0; i < m_nDataBands; ++i)
+                m_psWO->padfSrcNoDataReal[i] = adfNoData[i];
+        }
+    }
+
+    m_psWO->papszWarpOptions =
+        CSLSetNameValue(m_psWO->papszWarpOptions, "INIT_DEST", "0");
+    if (!m_osNumThreads.empty())
+    {
+        m_psWO->papszWarpOptions = CSLSetNameValue(
+            m_psWO->papszWarpOptions, "NUM_THREADS", m_osNumThreads.c_str());
+    }
+    m_psWO->pfnTransformer = GDALGenImgProjTransform;
+    m_psWO->pTransformerArg = m_hTransformArg;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetTileFilename()                           */
+/************************************************************************/
+
+std::string GDALTiler::GetTileFilename(int nZoom, int nTileX, int nTileY) const
+{
+    // TMS numbering of rows starts from the bottom
+    const int nRow =
+        m_bXYZ ? nTileY : GetTileMatrix(nZoom).mMatrixHeight - 1 - nTileY;
+    return m_osOutputDir + '/' + std::to_string(nZoom) + '/' +
+           std::to_string(nTileX) + '/' + std::to_string(nRow) + '.' +
+           m_osExtension;
+}
+
+/************************************************************************/
+/*                             WrapBuffer()                             */
+/************************************************************************/
+
+/** Returns a MEM dataset whose bands point to the planes of a
+ * band-sequential buffer. A plane may be referenced by several bands. */
+std::unique_ptr<GDALDataset> GDALTiler::WrapBuffer(
+    GByte *pabyData, int nXSize, int nYSize, size_t nPlaneSize,
+    const std::vector<std::pair<int, GDALColorInterp>> &aoBands)
+{
+    std::unique_ptr<GDALDataset> poDS(
+        m_poMEMDriver->Create("", nXSize, nYSize, 0, GDT_Byte, nullptr));
+    if (!poDS)
+        return nullptr;
+    for (const auto &oBand : aoBands)
+    {
+        char szPointer[64] = {'\0'};
+        const int nRet = CPLPrintPointer(
+            szPointer, pabyData + oBand.first * nPlaneSize, sizeof(szPointer));
+        szPointer[nRet] = 0;
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("DATAPOINTER", szPointer);
+        if (poDS->AddBand(GDT_Byte, aosOptions.List()) != CE_None)
+            return nullptr;
+        poDS->GetRasterBand(poDS->GetRasterCount())
+            ->SetColorInterpretation(oBand.second);
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                          GetInternalBands()                          */
+/************************************************************************/
+
+std::vector<std::pair<int, GDALColorInterp>> GDALTiler::GetInternalBands() const
+{
+    std::vector<std::pair<int, GDALColorInterp>> aoBands;
+    if (m_nDataBands == 1)
+    {
+        aoBands.emplace_back(0, GCI_GrayIndex);
+    }
+    else
+    {
+        aoBands.emplace_back(0, GCI_RedBand);
+        aoBands.emplace_back(1, GCI_GreenBand);
+        aoBands.emplace_back(2, GCI_BlueBand);
+    }
+    aoBands.emplace_back(m_nDataBands, GCI_AlphaBand);
+    return aoBands;
+}
+
+/************************************************************************/
+/*                           AllocateChunk()                            */
+/************************************************************************/
+
+void GDALTiler::AllocateChunk(Chunk &oChunk, int nZoom, int nTileX0,
+                              int nTileY0, int nTilesX, int nTilesY,
+                              int nHalo) const
+{
+    oChunk.nZoom = nZoom;
+    oChunk.nTileX0 = nTileX0;
+    oChunk.nTileY0 = nTileY0;
+    oChunk.nTilesX = nTilesX;
+    oChunk.nTilesY = nTilesY;
+    oChunk.nHalo = nHalo;
+    oChunk.abyData.assign(GetChunkPlaneSize(oChunk) * GetInternalBandCount(),
+                          0);
+}
+
+/************************************************************************/
+/*                             WarpChunk()                              */
+/************************************************************************/
+
+bool GDALTiler::WarpChunk(Chunk &oChunk)
+{
+    const auto &oTM = GetTileMatrix(oChunk.nZoom);
+    const TileRange &oRange = m_aoRanges[oChunk.nZoom];
+    const int nXSize = GetChunkXSize(oChunk);
+    const int nYSize = GetChunkYSize(oChunk);
+
+    auto poMEMDS = WrapBuffer(oChunk.abyData.data(), nXSize, nYSize,
+                              GetChunkPlaneSize(oChunk), GetInternalBands());
+    if (!poMEMDS)
+        return false;
+    const double dfTileExtent = oTM.mResX * m_nTileSize;
+    double adfGT[6] = {
+        m_dfOriX + oChunk.nTileX0 * dfTileExtent - oChunk.nHalo * oTM.mResX,
+        oTM.mResX,
+        0,
+        m_dfOriY - oChunk.nTileY0 * dfTileExtent + oChunk.nHalo * oTM.mResY,
+        0,
+        -oTM.mResY};
+    poMEMDS->SetGeoTransform(adfGT);
+    GDALSetGenImgProjTransformerDstGeoTransform(m_hTransformArg, adfGT);
+
+    // Only warp the part of the chunk that intersects the raster extent
+    const int nDstXOff = std::max(
+        0, oChunk.nHalo + (oRange.nMinX - oChunk.nTileX0) * m_nTileSize);
+    const int nDstYOff = std::max(
+        0, oChunk.nHalo + (oRange.nMinY - oChunk.nTileY0) * m_nTileSize);
+    const int nDstXEnd = std::min(
+        nXSize, oChunk.nHalo + (oRange.nMaxX - oChunk.nTileX0) * m_nTileSize);
+    const int nDstYEnd = std::min(
+        nYSize, oChunk.nHalo + (oRange.nMaxY - oChunk.nTileY0) * m_nTileSize);
+
+    GDALWarpOptions *psWO = GDALCloneWarpOptions(m_psWO);
+    psWO->hDstDS = GDALDataset::ToHandle(poMEMDS.get());
+    GDALWarpOperation oWO;
+    bool bOK = oWO.Initialize(psWO) == CE_None &&
+               oWO.ChunkAndWarpImage(nDstXOff, nDstYOff, nDstXEnd - nDstXOff,
+                                     nDstYEnd - nDstYOff) == CE_None;
+    GDALDestroyWarpOptions(psWO);
+    return bOK;
+}
+
+/************************************************************************/
+/*                      CreateWriteLevelDataset()                       */
+/************************************************************************/
+
+/** Creates the temporary dataset receiving the tile range of nZoom, the
+ * lowest zoom level of the current pass, from which the next pass starts.
+ */
+bool GDALTiler::CreateWriteLevelDataset(int nZoom)
+{
+    GDALDriver *poGTiffDriver =
+        GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Driver GTiff is not available");
+        return false;
+    }
+
+    const TileRange &oRange = m_aoRanges[nZoom];
+    const std::string osFilename =
+        std::string(CPLGenerateTempFilename(
+            CPLSPrintf("gdal_tiler_z%d", nZoom))) +
+        ".tif";
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("TILED", "YES");
+    aosOptions.SetNameValue("BLOCKXSIZE", CPLSPrintf("%d", m_nTileSize));
+    aosOptions.SetNameValue("BLOCKYSIZE", CPLSPrintf("%d", m_nTileSize));
+    aosOptions.SetNameValue("INTERLEAVE", "BAND");
+    aosOptions.SetNameValue("SPARSE_OK", "YES");
+    aosOptions.SetNameValue("BIGTIFF", "IF_SAFER");
+    m_poWriteLevelDS.reset(poGTiffDriver->Create(
+        osFilename.c_str(), (oRange.nMaxX - oRange.nMinX) * m_nTileSize,
+        (oRange.nMaxY - oRange.nMinY) * m_nTileSize, GetInternalBandCount(),
+        GDT_Byte, aosOptions.List()));
+    if (!m_poWriteLevelDS)
+        return false;
+    m_aosTempFiles.push_back(osFilename);
+    return true;
+}
+
+/************************************************************************/
+/*                           LevelDatasetIO()                           */
+/************************************************************************/
+
+/** Reads a chunk, including its halo, from the dataset of the tile range of
+ * its zoom level, or writes its tiles to it. */
+bool GDALTiler::LevelDatasetIO(GDALRWFlag eRWFlag, GDALDataset *poDS,
+                               Chunk &oChunk)
+{
+    const TileRange &oRange = m_aoRanges[oChunk.nZoom];
+    const int nHalo = eRWFlag == GF_Read ? oChunk.nHalo : 0;
+    // Window of the chunk in the dataset, clipped to it
+    const int nXOff = std::max(
+        0, (oChunk.nTileX0 - oRange.nMinX) * m_nTileSize - nHalo);
+    const int nYOff = std::max(
+        0, (oChunk.nTileY0 - oRange.nMinY) * m_nTileSize - nHalo);
+    const int nXEnd = std::min(
+        poDS->GetRasterXSize(),
+        (oChunk.nTileX0 + oChunk.nTilesX - oRange.nMinX) * m_nTileSize +
+            nHalo);
+    const int nYEnd = std::min(
+        poDS->GetRasterYSize(),
+        (oChunk.nTileY0 + oChunk.nTilesY - oRange.nMinY) * m_nTileSize +
+            nHalo);
+    if (nXEnd <= nXOff || nYEnd <= nYOff)
+        return true;
+
+    const int nLineSpace = GetChunkXSize(oChunk);
+    const int nBufXOff =
+        nXOff - (oChunk.nTileX0 - oRange.nMinX) * m_nTileSize + oChunk.nHalo;
+    const int nBufYOff =
+        nYOff - (oChunk.nTileY0 - oRange.nMinY) * m_nTileSize + oChunk.nHalo;
+    return poDS->RasterIO(eRWFlag, nXOff, nYOff, nXEnd - nXOff,
+                          nYEnd - nYOff,
+                          oChunk.abyData.data() +
+                              static_cast<size_t>(nBufYOff) * nLineSpace +
+                              nBufXOff,
+                          nXEnd - nXOff, nYEnd - nYOff, GDT_Byte,
+                          GetInternalBandCount(), nullptr, 1, nLineSpace,
+                          static_cast<GSpacing>(GetChunkPlaneSize(oChunk)),
+                          nullptr) == CE_None;
+}
+
+/************************************************************************/
+/*                             ReadChunk()                              */
+/************************************************************************/
+
+/** Reads a chunk from the lowest zoom level of the previous pass */
+bool GDALTiler::ReadChunk(Chunk &oChunk)
+{
+    return LevelDatasetIO(GF_Read, m_poReadLevelDS.get(), oChunk);
+}
+
+/************************************************************************/
+/*                          DownsampleChunk()                           */
+/************************************************************************/
+
+/** Computes the chunk of the next lower zoom level, with the overview
+ * resampling kernels, using the alpha band as the mask. */
+bool GDALTiler::DownsampleChunk(const Chunk &oSrc, Chunk &oDst)
+{
+    AllocateChunk(oDst, oSrc.nZoom - 1, oSrc.nTileX0 / 2, oSrc.nTileY0 / 2,
+                  oSrc.nTilesX / 2, oSrc.nTilesY / 2, oSrc.nHalo / 2);
+
+    const auto aoBands = GetInternalBands();
+    auto poSrcDS = WrapBuffer(const_cast<GByte *>(oSrc.abyData.data()),
+                              GetChunkXSize(oSrc), GetChunkYSize(oSrc),
+                              GetChunkPlaneSize(oSrc), aoBands);
+    auto poDstDS = WrapBuffer(oDst.abyData.data(), GetChunkXSize(oDst),
+                              GetChunkYSize(oDst), GetChunkPlaneSize(oDst),
+                              aoBands);
+    if (!poSrcDS || !poDstDS)
+        return false;
+
+    const int nBands = GetInternalBandCount();
+    std::vector<GDALRasterBand *> apoSrcBands;
+    std::vector<GDALRasterBand *> apoDstBands;
+    for (int i = 1; i <= nBands; ++i)
+    {
+        apoSrcBands.push_back(poSrcDS->GetRasterBand(i));
+        apoDstBands.push_back(poDstDS->GetRasterBand(i));
+    }
+    std::vector<GDALRasterBand **> apapoOvrBands;
+    for (auto &poBand : apoDstBands)
+        apapoOvrBands.push_back(&poBand);
+
+    return GDALRegenerateOverviewsMultiBand(
+               nBands, apoSrcBands.data(), 1, apapoOvrBands.data(),
+               m_osOvrResampling.c_str(), nullptr, nullptr,
+               nullptr) == CE_None;
+}
+
+/************************************************************************/
+/*                           EncodeTileJob()                            */
+/************************************************************************/
+
+void GDALTiler::EncodeTileJob(void *pData)
+{
+    std::unique_ptr<EncodeJob> psJob(static_cast<EncodeJob *>(pData));
+    GDALTiler *poTiler = psJob->poTiler;
+    const int nTileSize = poTiler->m_nTileSize;
+
+    auto poMEMDS = poTiler->WrapBuffer(
+        psJob->abyTile.data(), nTileSize, nTileSize,
+        static_cast<size_t>(nTileSize) * nTileSize, poTiler->m_aoOutputBands);
+    std::unique_ptr<GDALDataset> poOutDS;
+    if (poMEMDS)
+    {
+        poOutDS.reset(poTiler->m_poTileDriver->CreateCopy(
+            psJob->osFilename.c_str(), poMEMDS.get(), false,
+            poTiler->m_aosCreationOptions.List(), nullptr, nullptr));
+    }
+    if (!poOutDS || poOutDS->Close() != CE_None)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot write tile %s",
+                 psJob->osFilename.c_str());
+        poTiler->m_bError = true;
+    }
+}
+
+/************************************************************************/
+/*                          WriteChunkTiles()                           */
+/************************************************************************/
+
+/** Submits the encoding of the non-empty tiles of a chunk */
+bool GDALTiler::WriteChunkTiles(const Chunk &oChunk)
+{
+    const TileRange &oRange = m_aoRanges[oChunk.nZoom];
+    const int nLineSpace = GetChunkXSize(oChunk);
+    const size_t nChunkPlaneSize = GetChunkPlaneSize(oChunk);
+    const size_t nTilePlaneSize =
+        static_cast<size_t>(m_nTileSize) * m_nTileSize;
+    const int nBands = GetInternalBandCount();
+
+    for (int iY = 0; iY < oChunk.nTilesY; ++iY)
+    {
+        const int nTileY = oChunk.nTileY0 + iY;
+        if (nTileY < oRange.nMinY || nTileY >= oRange.nMaxY)
+            continue;
+        for (int iX = 0; iX < oChunk.nTilesX; ++iX)
+        {
+            const int nTileX = oChunk.nTileX0 + iX;
+            if (nTileX < oRange.nMinX || nTileX >= oRange.nMaxX)
+                continue;
+
+            const GByte *pabySrc =
+                oChunk.abyData.data() +
+                (static_cast<size_t>(iY) * m_nTileSize + oChunk.nHalo) *
+                    nLineSpace +
+                static_cast<size_t>(iX) * m_nTileSize + oChunk.nHalo;
+
+            // Skip fully transparent tiles
+            const GByte *pabyAlpha = pabySrc + m_nDataBands * nChunkPlaneSize;
+            bool bEmpty = true;
+            for (int iLine = 0; bEmpty && iLine < m_nTileSize; ++iLine)
+            {
+                const GByte *pabyLine =
+                    pabyAlpha + static_cast<size_t>(iLine) * nLineSpace;
+                for (int iPixel = 0; iPixel < m_nTileSize; ++iPixel)
+                {
+                    if (pabyLine[iPixel] != 0)
+                    {
+                        bEmpty = false;
+                        break;
+                    }
+                }
+            }
+            if (bEmpty)
+                continue;
+
+            const std::pair<int, int> oDir(oChunk.nZoom, nTileX);
+            if (m_oCreatedDirs.find(oDir) == m_oCreatedDirs.end())
+            {
+                const std::string osDir(
+                    CPLGetPath(GetTileFilename(oChunk.nZoom, nTileX, nTileY)
+                                   .c_str()));
+                if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "Cannot create directory %s", osDir.c_str());
+                    return false;
+                }
+                m_oCreatedDirs.insert(oDir);
+            }
+
+            auto psJob = std::make_unique<EncodeJob>();
+            psJob->poTiler = this;
+            psJob->osFilename = GetTileFilename(oChunk.nZoom, nTileX, nTileY);
+            psJob->abyTile.resize(nTilePlaneSize * nBands);
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                for (int iLine = 0; iLine < m_nTileSize; ++iLine)
+                {
+                    memcpy(psJob->abyTile.data() + iBand * nTilePlaneSize +
+                               static_cast<size_t>(iLine) * m_nTileSize,
+                           pabySrc + iBand * nChunkPlaneSize +
+                               static_cast<size_t>(iLine) * nLineSpace,
+                           m_nTileSize);
+                }
+            }
+            m_poJobQueue->SubmitJob(EncodeTileJob, psJob.release());
+
+            // Bound the memory used by pending tiles
+            m_poJobQueue->WaitCompletion(m_nMaxPendingJobs);
+            if (m_bError)
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         GetPassChunkCount()                          */
+/************************************************************************/
+
+int GDALTiler::GetPassChunkCount(int nBaseZoom) const
+{
+    const TileRange &oRange = m_aoRanges[nBaseZoom];
+    const int nChunksX = (oRange.nMaxX - 1) / MAX_CHUNK_TILES -
+                         oRange.nMinX / MAX_CHUNK_TILES + 1;
+    const int nChunksY = (oRange.nMaxY - 1) / MAX_CHUNK_TILES -
+                         oRange.nMinY / MAX_CHUNK_TILES + 1;
+    return nChunksX * nChunksY;
+}
+
+/************************************************************************/
+/*                            ProcessPass()                             */
+/************************************************************************/
+
+/** Processes the tiles of nBaseZoom, either by warping them (and writing
+ * them), or by reading them from the lowest zoom level of the previous
+ * pass, and writes the nLevels lower zoom levels derived from them. */
+bool GDALTiler::ProcessPass(int nBaseZoom, bool bWarp, int nLevels,
+                            GDALProgressFunc pfnProgress, void *pProgressData,
+                            double &dfProgress, double dfProgressPerChunk)
+{
+    const TileRange &oRange = m_aoRanges[nBaseZoom];
+    const int nAlign = 1 << nLevels;
+    // Each downsampling needs a margin of the kernel radius, in pixels of
+    // the higher zoom level, around the tiles. The error due to the
+    // truncation of the kernel at the border of the halo then stays below
+    // that radius at each level, and the halo is halved at each level.
+    const int nHalo = nLevels > 0 ? (2 * m_nOvrRadius) << nLevels : 0;
+
+    if (!bWarp)
+    {
+        if (m_poReadLevelDS)
+        {
+            const std::string osFilename(m_poReadLevelDS->GetDescription());
+            m_poReadLevelDS.reset();
+            VSIUnlink(osFilename.c_str());
+        }
+        m_poReadLevelDS = std::move(m_poWriteLevelDS);
+    }
+    if (nBaseZoom - nLevels > m_nMinZoom &&
+        !CreateWriteLevelDataset(nBaseZoom - nLevels))
+    {
+        return false;
+    }
+
+    for (int nChunkY = oRange.nMinY / MAX_CHUNK_TILES * MAX_CHUNK_TILES;
+         nChunkY < oRange.nMaxY; nChunkY += MAX_CHUNK_TILES)
+    {
+        for (int nChunkX = oRange.nMinX / MAX_CHUNK_TILES * MAX_CHUNK_TILES;
+             nChunkX < oRange.nMaxX; nChunkX += MAX_CHUNK_TILES)
+        {
+            // Restrict the chunk to the tile range, while keeping it
+            // aligned on the tiles of the lowest derived zoom level.
+            const int nX0 = std::max(oRange.nMinX, nChunkX) / nAlign * nAlign;
+            const int nY0 = std::max(oRange.nMinY, nChunkY) / nAlign * nAlign;
+            const int nX1 =
+                (std::min(oRange.nMaxX, nChunkX + MAX_CHUNK_TILES) + nAlign -
+                 1) /
+                nAlign * nAlign;
+            const int nY1 =
+                (std::min(oRange.nMaxY, nChunkY + MAX_CHUNK_TILES) + nAlign -
+                 1) /
+                nAlign * nAlign;
+
+            Chunk oChunk;
+            AllocateChunk(oChunk, nBaseZoom, nX0, nY0, nX1 - nX0, nY1 - nY0,
+                          nHalo);
+            if (bWarp)
+            {
+                if (!WarpChunk(oChunk) || !WriteChunkTiles(oChunk))
+                    return false;
+            }
+            else if (!ReadChunk(oChunk))
+            {
+                return false;
+            }
+
+            for (int i = 0; i < nLevels; ++i)
+            {
+                Chunk oLowerChunk;
+                if (!DownsampleChunk(oChunk, oLowerChunk) ||
+                    !WriteChunkTiles(oLowerChunk))
+                {
+                    return false;
+                }
+                oChunk = std::move(oLowerChunk);
+            }
+            if (m_poWriteLevelDS &&
+                !LevelDatasetIO(GF_Write, m_poWriteLevelDS.get(), oChunk))
+            {
+                return false;
+            }
+
+            dfProgress += dfProgressPerChunk;
+            if (pfnProgress &&
+                !pfnProgress(std::min(1.0, dfProgress), "", pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+        }
+    }
+
+    m_poJobQueue->WaitCompletion();
+    return !m_bError;
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+bool GDALTiler::Run(GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    if (!CheckSource() || !SetupTileFormat() || !ComputeZoomLevels() ||
+        !SetupWarping())
+    {
+        return false;
+    }
+
+    int nThreads = CPLGetNumCPUs();
+    if (!m_osNumThreads.empty() && !EQUAL(m_osNumThreads.c_str(), "ALL_CPUS"))
+        nThreads = std::max(1, atoi(m_osNumThreads.c_str()));
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return false;
+    m_poJobQueue = poPool->CreateJobQueue();
+    m_nMaxPendingJobs = 4 * nThreads;
+
+    if (VSIMkdirRecursive(m_osOutputDir.c_str(), 0755) != 0)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(m_osOutputDir.c_str(), &sStat) != 0 ||
+            !VSI_ISDIR(sStat.st_mode))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                     m_osOutputDir.c_str());
+            return false;
+        }
+    }
+
+    // Plan the passes: the first one warps the maximum zoom level, the
+    // following ones start from the lowest zoom level written by the
+    // previous one.
+    std::vector<std::pair<int, int>> aoPasses;  // (base zoom, levels)
+    int nBaseZoom = m_nMaxZoom;
+    while (true)
+    {
+        const int nLevels = std::min(MAX_CHUNK_LEVELS, nBaseZoom - m_nMinZoom);
+        aoPasses.emplace_back(nBaseZoom, nLevels);
+        nBaseZoom -= nLevels;
+        if (nBaseZoom == m_nMinZoom)
+            break;
+    }
+    int nTotalChunks = 0;
+    for (const auto &oPass : aoPasses)
+        nTotalChunks += GetPassChunkCount(oPass.first);
+
+    double dfProgress = 0;
+    bool bOK = true;
+    for (size_t i = 0; bOK && i < aoPasses.size(); ++i)
+    {
+        bOK = ProcessPass(aoPasses[i].first, i == 0, aoPasses[i].second,
+                          pfnProgress, pProgressData, dfProgress,
+                          1.0 / nTotalChunks);
+    }
+    m_poJobQueue->WaitCompletion();
+    RemoveLevelDatasets();
+    return bOK && !m_bError;
+}
+
+/************************************************************************/
+/*                           ParseZoomLevels()                          */
+/************************************************************************/
+
+/** Parses "<zoom>" or "<min_zoom>-<max_zoom>" */
+bool ParseZoomLevels(const std::string &osZoom, int &nMinZoom, int &nMaxZoom)
+{
+    const CPLStringList aosTokens(
+        CSLTokenizeString2(osZoom.c_str(), "-", CSLT_ALLOWEMPTYTOKENS));
+    if (aosTokens.size() < 1 || aosTokens.size() > 2 ||
+        CPLGetValueType(aosTokens[0]) != CPL_VALUE_INTEGER ||
+        (aosTokens.size() == 2 &&
+         CPLGetValueType(aosTokens[1]) != CPL_VALUE_INTEGER))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Invalid value for -z: %s. Expected <zoom> or "
+                 "<min_zoom>-<max_zoom>",
+                 osZoom.c_str());
+        return false;
+    }
+    nMinZoom = atoi(aosTokens[0]);
+    nMaxZoom = aosTokens.size() == 2 ? atoi(aosTokens[1]) : nMinZoom;
+    return true;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+MAIN_START(argc, argv)
+
+{
+    EarlySetConfigOptions(argc, argv);
+
+    GDALAllRegister();
+
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    CPLStringList aosArgv;
+    aosArgv.Assign(argv, /* bTakeOwnership= */ true);
+    if (argc < 1)
+        std::exit(-argc);
+
+    GDALArgumentParser argParser(aosArgv[0], /* bForBinary=*/true);
+
+    argParser.add_description(
+        _("Generates a directory of tiles, following a tile matrix set, "
+          "from a raster."));
+
+    argParser.add_epilog(_("For more details, consult "
+                           "https://gdal.org/programs/gdal_tiler.html"));
+
+    GDALTiler oTiler;
+
+    std::string osProfile = "mercator";
+    argParser.add_argument("-p")
+        .store_into(osProfile)
+        .metavar("mercator|geodetic|<tile_matrix_set>")
+        .help(_("Tile matrix set. mercator is an alias for "
+                "GoogleMapsCompatible, and geodetic for WorldCRS84Quad."));
+
+    std::string osZoom;
+    argParser.add_argument("-z")
+        .store_into(osZoom)
+        .metavar("<zoom>|<min_zoom>-<max_zoom>")
+        .help(_("Zoom levels to render."));
+
+    argParser.add_argument("-r")
+        .store_into(oTiler.m_osResampling)
+        .metavar("near|bilinear|cubic|cubicspline|lanczos|average|rms|mode")
+        .help(_("Resampling method, for warping and for the lower zoom "
+                "levels. Defaults to average."));
+
+    argParser.add_argument("-a")
+        .scan<'g', double>()
+        .metavar("<value>")
+        .action(
+            [&oTiler](const std::string &s)
+            {
+                oTiler.m_bSrcNoDataSet = true;
+                oTiler.m_dfSrcNoData = CPLAtof(s.c_str());
+            })
+        .help(_("Value in the input dataset considered as transparent."));
+
+    argParser.add_argument("--tiledriver")
+        .store_into(oTiler.m_osTileFormat)
+        .choices("PNG", "JPEG", "WEBP")
+        .metavar("PNG|JPEG|WEBP")
+        .help(_("Format of the tiles. Defaults to PNG."));
+
+    argParser.add_creation_options_argument(oTiler.m_aosCreationOptions)
+        .help(_("Creation option for the tile driver."));
+
+    argParser.add_argument("--xyz")
+        .flag()
+        .store_into(oTiler.m_bXYZ)
+        .help(_("Use XYZ numbering of tile rows (from the top) instead of "
+                "TMS (from the bottom)."));
+
+    argParser.add_argument("-j")
+        .store_into(oTiler.m_osNumThreads)
+        .metavar("<num_threads>|ALL_CPUS")
+        .help(_("Number of threads to use. Defaults to ALL_CPUS."));
+
+    bool bQuiet = false;
+    argParser.add_quiet_argument(&bQuiet);
+
+    std::string osSrcFilename;
+    argParser.add_argument("src_filename")
+        .store_into(osSrcFilename)
+        .metavar("<src_filename>");
+
+    argParser.add_argument("output_directory")
+        .store_into(oTiler.m_osOutputDir)
+        .metavar("<output_directory>");
+
+    try
+    {
+        argParser.parse_args(aosArgv);
+    }
+    catch (const std::exception &err)
+    {
+        argParser.display_error_and_usage(err);
+        std::exit(1);
+    }
+
+    if (!osZoom.empty() &&
+        !ParseZoomLevels(osZoom, oTiler.m_nMinZoom, oTiler.m_nMaxZoom))
+    {
+        std::exit(1);
+    }
+
+    if (EQUAL(osProfile.c_str(), "mercator"))
+        osProfile = "GoogleMapsCompatible";
+    else if (EQUAL(osProfile.c_str(), "geodetic"))
+        osProfile = "WorldCRS84Quad";
+    oTiler.m_poTMS = gdal::TileMatrixSet::parse(osProfile.c_str());
+    if (!oTiler.m_poTMS)
+        std::exit(1);
+
+    // Avoid .aux.xml side car files next to the tiles
+    if (CPLGetConfigOption("GDAL_PAM_ENABLED", nullptr) == nullptr)
+        CPLSetConfigOption("GDAL_PAM_ENABLED", "NO");
+
+    std::unique_ptr<GDALDataset> poSrcDS(
+        GDALDataset::Open(osSrcFilename.c_str(),
+                          GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+    if (!poSrcDS)
+        std::exit(2);
+    oTiler.m_poSrcDS = poSrcDS.get();
+
+    const bool bSuccess =
+        oTiler.Run(bQuiet ? GDALDummyProgress : GDALTermProgress, nullptr);
+
+    GDALDestroyDriverManager();
+    OGRCleanupAll();
+
+    return bSuccess ? 0 : 1;
+}
+
+MAIN_END
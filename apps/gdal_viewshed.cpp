@@ -34,9 +34,14 @@
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
 #include "commonutils.h"
 #include "gdalargumentparser.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 /************************************************************************/
 /*                                main()                                */
 /************************************************************************/
@@ -68,14 +73,12 @@ MAIN_START(argc, argv)
     double dfObserverX = 0;
     argParser.add_argument("-ox")
         .store_into(dfObserverX)
-        .required()
         .metavar("<value>")
         .help(_("The X position of the observer (in SRS units)."));
 
     double dfObserverY = 0;
     argParser.add_argument("-oy")
         .store_into(dfObserverY)
-        .required()
         .metavar("<value>")
         .help(_("The Y position of the observer (in SRS units)."));
 
@@ -171,6 +174,20 @@ MAIN_START(argc, argv)
         .nargs(1)
         .help(_("Sets what information the output contains."));
 
+    std::string osObservers;
+    argParser.add_argument("-observers")
+        .store_into(osObservers)
+        .metavar("<filename>")
+        .help(_("Vector dataset whose point features of the first layer are "
+                "observers. Computes a cumulative viewshed counting, for each "
+                "pixel, the number of observers it is visible from."));
+
+    std::string osNumThreads = "1";
+    argParser.add_argument("-j")
+        .store_into(osNumThreads)
+        .metavar("<num_threads>|ALL_CPUS")
+        .help(_("Number of threads to use with -observers."));
+
     bool bQuiet = false;
     argParser.add_quiet_argument(&bQuiet);
 
@@ -194,6 +211,29 @@ MAIN_START(argc, argv)
         std::exit(1);
     }
 
+    const bool bCumulative = argParser.is_used("-observers");
+    if (bCumulative)
+    {
+        if (argParser.is_used("-ox") || argParser.is_used("-oy"))
+        {
+            fprintf(stderr, "-observers is mutually exclusive with -ox/-oy\n");
+            std::exit(1);
+        }
+        if (argParser.is_used("-om") || argParser.is_used("-vv") ||
+            argParser.is_used("-iv") || argParser.is_used("-ov") ||
+            argParser.is_used("-a_nodata"))
+        {
+            fprintf(stderr, "-om, -vv, -iv, -ov and -a_nodata cannot be used "
+                            "with -observers\n");
+            std::exit(1);
+        }
+    }
+    else if (!argParser.is_used("-ox") || !argParser.is_used("-oy"))
+    {
+        fprintf(stderr, "-ox and -oy, or -observers, must be specified\n");
+        std::exit(1);
+    }
+
     GDALProgressFunc pfnProgress = nullptr;
     if (!bQuiet)
         pfnProgress = GDALTermProgress;
@@ -255,12 +295,55 @@ MAIN_START(argc, argv)
     /* -------------------------------------------------------------------- */
     /*      Invoke.                                                         */
     /* -------------------------------------------------------------------- */
-    GDALDatasetH hDstDS = GDALViewshedGenerate(
-        hBand, osFormat.c_str(), osDstFilename.c_str(),
-        aosCreationOptions.List(), dfObserverX, dfObserverY, dfObserverHeight,
-        dfTargetHeight, dfVisibleVal, dfInvisibleVal, dfOutOfRangeVal,
-        dfNoDataVal, dfCurvCoeff, GVM_Edge, dfMaxDistance, pfnProgress, nullptr,
-        outputMode, nullptr);
+    GDALDatasetH hDstDS = nullptr;
+    if (bCumulative)
+    {
+        std::vector<double> adfObserverX;
+        std::vector<double> adfObserverY;
+        auto poObserversDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            osObservers.c_str(), GDAL_OF_VECTOR | GDAL_OF_VERBOSE_ERROR));
+        if (!poObserversDS)
+            exit(2);
+        OGRLayer *poLayer = poObserversDS->GetLayer(0);
+        if (poLayer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s has no layer",
+                     osObservers.c_str());
+            exit(2);
+        }
+        for (auto &&poFeature : *poLayer)
+        {
+            const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            if (poGeom &&
+                wkbFlatten(poGeom->getGeometryType()) == wkbPoint &&
+                !poGeom->IsEmpty())
+            {
+                adfObserverX.push_back(poGeom->toPoint()->getX());
+                adfObserverY.push_back(poGeom->toPoint()->getY());
+            }
+        }
+
+        const int nThreads = EQUAL(osNumThreads.c_str(), "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(osNumThreads.c_str());
+
+        hDstDS = GDALViewshedGenerateCumulative(
+            hBand, osFormat.c_str(), osDstFilename.c_str(),
+            aosCreationOptions.List(), static_cast<int>(adfObserverX.size()),
+            adfObserverX.data(), adfObserverY.data(), dfObserverHeight,
+            dfTargetHeight, dfCurvCoeff, GVM_Edge, dfMaxDistance,
+            std::max(1, std::min(128, nThreads)), pfnProgress, nullptr,
+            nullptr);
+    }
+    else
+    {
+        hDstDS = GDALViewshedGenerate(
+            hBand, osFormat.c_str(), osDstFilename.c_str(),
+            aosCreationOptions.List(), dfObserverX, dfObserverY,
+            dfObserverHeight, dfTargetHeight, dfVisibleVal, dfInvisibleVal,
+            dfOutOfRangeVal, dfNoDataVal, dfCurvCoeff, GVM_Edge, dfMaxDistance,
+            pfnProgress, nullptr, outputMode, nullptr);
+    }
     bool bSuccess = hDstDS != nullptr;
     GDALClose(hSrcDS);
     if (GDALClose(hDstDS) != CE_None)
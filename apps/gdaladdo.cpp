@@ -551,6 +551,51 @@ static bool PartialRefreshFromProjWin(
                           pfnProgress, pProgressArg);
 }
 
+/************************************************************************/
+/*                   PartialRefreshFromDirtyRegions()                   */
+/************************************************************************/
+
+static bool PartialRefreshFromDirtyRegions(
+    GDALDataset *poDS, const char *pszResampling, int nLevelCount,
+    const int *panLevels, int nBandCount, const int *panBandList,
+    bool bMinSizeSpecified, int nMinSize, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    std::vector<int> anOvrIndices;
+    if (!GetOvrIndices(poDS, nLevelCount, panLevels, bMinSizeSpecified,
+                       nMinSize, anOvrIndices))
+        return false;
+
+    const auto aoRegions = poDS->GetDirtyRegions();
+    double dfTotalPixels = 0;
+    for (const auto &oRegion : aoRegions)
+        dfTotalPixels += static_cast<double>(oRegion.nXSize) * oRegion.nYSize;
+
+    double dfCurPixels = 0;
+    for (const auto &oRegion : aoRegions)
+    {
+        const double dfPixels =
+            static_cast<double>(oRegion.nXSize) * oRegion.nYSize;
+        void *pScaledProgress = GDALCreateScaledProgress(
+            dfCurPixels / dfTotalPixels,
+            (dfCurPixels + dfPixels) / dfTotalPixels, pfnProgress,
+            pProgressArg);
+        const bool bRet = PartialRefresh(
+            poDS, anOvrIndices, nBandCount, panBandList, pszResampling,
+            oRegion.nXOff, oRegion.nYOff, oRegion.nXSize, oRegion.nYSize,
+            GDALScaledProgress, pScaledProgress);
+        GDALDestroyScaledProgress(pScaledProgress);
+        if (!bRet)
+            return false;
+        dfCurPixels += dfPixels;
+    }
+    if (aoRegions.empty())
+        pfnProgress(1.0, "", pProgressArg);
+
+    poDS->ClearDirtyRegions();
+    return true;
+}
+
 /************************************************************************/
 /*                                main()                                */
 /************************************************************************/
@@ -643,6 +688,7 @@ MAIN_START(nArgc, papszArgv)
 
     bool bClean = false;
     bool bPartialRefreshFromSourceTimestamp = false;
+    bool bPartialRefreshFromDirtyRegions = false;
     std::string osPartialRefreshFromSourceExtent;
 
     {
@@ -669,6 +715,11 @@ MAIN_START(nArgc, papszArgv)
             .help(
                 _("Performs a partial refresh of existing overviews, in the "
                   "region of interest specified by one or several filename."));
+
+        group.add_argument("--partial-refresh-from-dirty-regions")
+            .store_into(bPartialRefreshFromDirtyRegions)
+            .help(_("Performs a partial refresh of existing overviews, in the "
+                    "regions modified with GDAL_TRACK_DIRTY_REGIONS=YES."));
     }
 
     std::string osFilename;
@@ -817,6 +868,17 @@ MAIN_START(nArgc, papszArgv)
             nResultStatus = 1;
         }
     }
+    else if (bPartialRefreshFromDirtyRegions)
+    {
+        if (!PartialRefreshFromDirtyRegions(
+                GDALDataset::FromHandle(hDataset), osResampling.c_str(),
+                static_cast<int>(anLevels.size()), anLevels.data(), nBandCount,
+                anBandList.data(), bMinSizeSpecified, nMinSize, pfnProgress,
+                pProgressArg))
+        {
+            nResultStatus = 1;
+        }
+    }
     else if (bPartialRefreshFromProjWin)
     {
         if (!PartialRefreshFromProjWin(
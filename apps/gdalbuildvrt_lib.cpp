@@ -254,6 +254,7 @@ class VRTBuilder
     bool bUseSrcMaskBand = true;
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
+    int nNumThreads = 1;
 
     /* Internal variables */
     char *pszProjectionRef = nullptr;
@@ -291,7 +292,7 @@ class VRTBuilder
                const char *pszVRTNoData, bool bUseSrcMaskBand,
                bool bNoDataFromMask, double dfMaskValueThreshold,
                const char *pszOutputSRS, const char *pszResampling,
-               const char *const *papszOpenOptionsIn);
+               const char *const *papszOpenOptionsIn, int nNumThreads);
 
     ~VRTBuilder();
 
@@ -313,8 +314,9 @@ VRTBuilder::VRTBuilder(
     const char *pszSrcNoDataIn, const char *pszVRTNoDataIn,
     bool bUseSrcMaskBandIn, bool bNoDataFromMaskIn,
     double dfMaskValueThresholdIn, const char *pszOutputSRSIn,
-    const char *pszResamplingIn, const char *const *papszOpenOptionsIn)
-    : bStrict(bStrictIn)
+    const char *pszResamplingIn, const char *const *papszOpenOptionsIn,
+    int nNumThreadsIn)
+    : bStrict(bStrictIn), nNumThreads(nNumThreadsIn)
 {
     pszOutputFilename = CPLStrdup(pszOutputFilenameIn);
     nInputFiles = nInputFilesIn;
@@ -1540,6 +1542,31 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    // Stat network files in a single batch, so that the file system caches
+    // are warmed before the files are opened one at a time.
+    if (pahSrcDS == nullptr && ppszInputFilenames != nullptr)
+    {
+        CPLStringList aosRemoteFilenames;
+        for (int i = 0; i < nInputFiles; i++)
+        {
+            if (!VSIIsLocal(ppszInputFilenames[i]))
+                aosRemoteFilenames.AddString(ppszInputFilenames[i]);
+        }
+        if (aosRemoteFilenames.size() > 1)
+        {
+            std::vector<VSIStatBufL> asStatBuf(aosRemoteFilenames.size());
+            VSIFree(VSIStatMultipleL(aosRemoteFilenames.List(),
+                                     asStatBuf.data(), 0));
+        }
+    }
+
+    // Open the next input files on worker threads while the current one is
+    // analysed. Analysis itself stays sequential, so that the output does not
+    // depend on the number of threads.
+    GDALDatasetPrefetcher oPrefetcher(pahSrcDS ? 1 : nNumThreads,
+                                      GDAL_OF_RASTER, papszOpenOptions);
+    int iNextToSubmit = 0;
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1550,10 +1577,23 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        GDALDatasetH hDS = nullptr;
+        if (pahSrcDS)
+        {
+            hDS = pahSrcDS[i];
+        }
+        else
+        {
+            // nInputFiles may grow during the loop when subdatasets are
+            // expanded, hence the submission is topped up at each iteration.
+            while (iNextToSubmit < nInputFiles &&
+                   oPrefetcher.GetPendingCount() < oPrefetcher.GetMaxPending())
+            {
+                oPrefetcher.Submit(ppszInputFilenames[iNextToSubmit]);
+                ++iNextToSubmit;
+            }
+            hDS = GDALDataset::ToHandle(oPrefetcher.Get().release());
+        }
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -1759,6 +1799,7 @@ struct GDALBuildVRTOptions
     bool bUseSrcMaskBand = true;
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
+    int nNumThreads = 1;
 
     /*! allow or suppress progress monitor and other non-error output */
     bool bQuiet = true;
@@ -1906,7 +1947,7 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.dfMaskValueThreshold,
         sOptions.osOutputSRS.empty() ? nullptr : sOptions.osOutputSRS.c_str(),
         sOptions.osResampling.empty() ? nullptr : sOptions.osResampling.c_str(),
-        sOptions.aosOpenOptions.List());
+        sOptions.aosOpenOptions.List(), sOptions.nNumThreads);
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData));
@@ -2175,6 +2216,21 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
                 "when the value of the mask band of the source is less or "
                 "equal to the threshold."));
 
+    argParser->add_argument("-j")
+        .metavar("<num_threads>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                psOptions->nNumThreads = EQUAL(s.c_str(), "ALL_CPUS")
+                                             ? CPLGetNumCPUs()
+                                             : atoi(s.c_str());
+                if (psOptions->nNumThreads <= 0)
+                {
+                    throw std::invalid_argument("Invalid value for -j: " + s);
+                }
+            })
+        .help(_("Number of threads used to open input datasets."));
+
     if (psOptionsForBinary)
     {
         if (psOptionsForBinary->osDstFilename.empty())
@@ -109,7 +109,10 @@
 #endif
 
 #include <algorithm>
+#include <climits>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_progress.h"
@@ -117,6 +120,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -292,6 +296,323 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                   GDALGeneric3x3ProcessingParams                     */
+/************************************************************************/
+
+template <class T> struct GDALGeneric3x3ProcessingParams
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    void *pData = nullptr;
+    bool bComputeAtEdges = false;
+    bool bSrcHasNoData = false;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+};
+
+/************************************************************************/
+/*                    GDALGeneric3x3LineHasNoData()                     */
+/************************************************************************/
+
+template <class T>
+static bool GDALGeneric3x3LineHasNoData(const T *pafLine, int nXSize,
+                                        T fSrcNoDataValue)
+{
+    int iX = 0;
+    for (; iX + 3 < nXSize; iX += 4)
+    {
+        if (pafLine[iX] == fSrcNoDataValue ||
+            pafLine[iX + 1] == fSrcNoDataValue ||
+            pafLine[iX + 2] == fSrcNoDataValue ||
+            pafLine[iX + 3] == fSrcNoDataValue)
+        {
+            return true;
+        }
+    }
+    for (; iX < nXSize; iX++)
+    {
+        if (pafLine[iX] == fSrcNoDataValue)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     GDALGeneric3x3ProcessLine()                      */
+/************************************************************************/
+
+// Computes an output line that is neither the first nor the last one of
+// the raster, from the source lines above, at and below it.
+template <class T>
+static void
+GDALGeneric3x3ProcessLine(const GDALGeneric3x3ProcessingParams<T> &sParams,
+                          const T *pafThreeLineWin, int nLine1Off,
+                          int nLine2Off, int nLine3Off, int nXSize,
+                          bool bOneOfThreeLinesHasNoData, float *pafOutputBuf)
+{
+    const bool bSrcHasNoData = sParams.bSrcHasNoData;
+    const T fSrcNoDataValue = sParams.fSrcNoDataValue;
+    const bool bIsSrcNoDataNan = sParams.bIsSrcNoDataNan;
+    const float fDstNoDataValue = sParams.fDstNoDataValue;
+    const auto pfnAlg = sParams.pfnAlg;
+    void *const pData = sParams.pData;
+    const bool bComputeAtEdges = sParams.bComputeAtEdges;
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
+                               pafThreeLineWin[nLine1Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine1Off + j],
+                      pafThreeLineWin[nLine1Off + j + 1],
+                      INTERPOL(pafThreeLineWin[nLine2Off + j],
+                               pafThreeLineWin[nLine2Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine2Off + j],
+                      pafThreeLineWin[nLine2Off + j + 1],
+                      INTERPOL(pafThreeLineWin[nLine3Off + j],
+                               pafThreeLineWin[nLine3Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine3Off + j],
+                      pafThreeLineWin[nLine3Off + j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
+
+    int j = 1;
+    if (sParams.pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = sParams.pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
+                                       nLine3Off, nXSize, pData,
+                                       pafOutputBuf);
+    }
+
+    for (; j < nXSize - 1; j++)
+    {
+        T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                      pafThreeLineWin[nLine1Off + j],
+                      pafThreeLineWin[nLine1Off + j + 1],
+                      pafThreeLineWin[nLine2Off + j - 1],
+                      pafThreeLineWin[nLine2Off + j],
+                      pafThreeLineWin[nLine2Off + j + 1],
+                      pafThreeLineWin[nLine3Off + j - 1],
+                      pafThreeLineWin[nLine3Off + j],
+                      pafThreeLineWin[nLine3Off + j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                      pafThreeLineWin[nLine1Off + j],
+                      INTERPOL(pafThreeLineWin[nLine1Off + j],
+                               pafThreeLineWin[nLine1Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine2Off + j - 1],
+                      pafThreeLineWin[nLine2Off + j],
+                      INTERPOL(pafThreeLineWin[nLine2Off + j],
+                               pafThreeLineWin[nLine2Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine3Off + j - 1],
+                      pafThreeLineWin[nLine3Off + j],
+                      INTERPOL(pafThreeLineWin[nLine3Off + j],
+                               pafThreeLineWin[nLine3Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*                    GDALGeneric3x3ProcessLinesJob                     */
+/************************************************************************/
+
+// Range of lines of a chunk processed by a worker thread.
+template <class T> struct GDALGeneric3x3ProcessLinesJob
+{
+    const GDALGeneric3x3ProcessingParams<T> *psParams = nullptr;
+    // Source lines of the chunk, including the line above and the line
+    // below it.
+    const T *pafSrcChunk = nullptr;
+    // Output lines of the chunk.
+    float *pafDstChunk = nullptr;
+    int nXSize = 0;
+    // Range [iStart, iEnd[ of output lines of the chunk to process.
+    int iStart = 0;
+    int iEnd = 0;
+};
+
+template <class T> static void GDALGeneric3x3ProcessLinesFunc(void *pData)
+{
+    const auto psJob =
+        static_cast<const GDALGeneric3x3ProcessLinesJob<T> *>(pData);
+    const auto &sParams = *(psJob->psParams);
+    const int nXSize = psJob->nXSize;
+    const bool bCheckLineNoData =
+        std::numeric_limits<T>::is_integer && sParams.bSrcHasNoData;
+
+    // abLineHasNoData[k] is for source line iStart + k of the chunk,
+    // i.e. line above the output line iStart - 1 + k.
+    bool abLineHasNoData[3] = {sParams.bSrcHasNoData, sParams.bSrcHasNoData,
+                               sParams.bSrcHasNoData};
+    if (bCheckLineNoData)
+    {
+        for (int k = 0; k < 2; ++k)
+        {
+            abLineHasNoData[k] = GDALGeneric3x3LineHasNoData(
+                psJob->pafSrcChunk +
+                    static_cast<size_t>(psJob->iStart + k) * nXSize,
+                nXSize, sParams.fSrcNoDataValue);
+        }
+    }
+
+    for (int i = psJob->iStart; i < psJob->iEnd; ++i)
+    {
+        const int nLine1Off = i * nXSize;
+        const int nLine2Off = nLine1Off + nXSize;
+        const int nLine3Off = nLine2Off + nXSize;
+
+        bool bOneOfThreeLinesHasNoData = sParams.bSrcHasNoData;
+        if (bCheckLineNoData)
+        {
+            abLineHasNoData[2] = GDALGeneric3x3LineHasNoData(
+                psJob->pafSrcChunk + nLine3Off, nXSize,
+                sParams.fSrcNoDataValue);
+            bOneOfThreeLinesHasNoData = abLineHasNoData[0] ||
+                                        abLineHasNoData[1] ||
+                                        abLineHasNoData[2];
+            abLineHasNoData[0] = abLineHasNoData[1];
+            abLineHasNoData[1] = abLineHasNoData[2];
+        }
+
+        GDALGeneric3x3ProcessLine(
+            sParams, psJob->pafSrcChunk, nLine1Off, nLine2Off, nLine3Off,
+            nXSize, bOneOfThreeLinesHasNoData,
+            psJob->pafDstChunk + static_cast<size_t>(i) * nXSize);
+    }
+}
+
+/************************************************************************/
+/*                  GDALGeneric3x3ProcessingMT()                        */
+/************************************************************************/
+
+// Processes the lines 1 to nYSize - 2 by chunks of consecutive lines.
+// Each chunk is read with a one-line halo above and below it, its lines
+// are computed in parallel, and it is then written in a single call.
+template <class T>
+static CPLErr GDALGeneric3x3ProcessingMT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand, GDALDataType eReadDT,
+    const GDALGeneric3x3ProcessingParams<T> &sParams, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Aim at about 64 MB of buffers, with at least one line per thread, and
+    // make sure that line offsets within a chunk fit on an int.
+    constexpr int CHUNK_BUFFER_SIZE = 64 * 1024 * 1024;
+    const GIntBig nBytesPerLine =
+        static_cast<GIntBig>(nXSize) * (sizeof(T) + sizeof(float));
+    int nChunkLines = std::max(
+        nThreads, static_cast<int>(CHUNK_BUFFER_SIZE / nBytesPerLine));
+    nChunkLines = static_cast<int>(
+        std::min<GIntBig>(nChunkLines, INT_MAX / nXSize - 2));
+    nChunkLines = std::min(nChunkLines, nYSize - 2);
+    if (nChunkLines <= 0)
+        return CE_Failure;
+
+    // One extra value, as for the 3-line window of the serial code path.
+    std::unique_ptr<T, VSIFreeReleaser> pafSrcChunk(
+        static_cast<T *>(VSI_MALLOC2_VERBOSE(
+            sizeof(T), static_cast<size_t>(nChunkLines + 2) * nXSize + 1)));
+    std::unique_ptr<float, VSIFreeReleaser> pafDstChunk(static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nChunkLines, nXSize, sizeof(float))));
+    if (!pafSrcChunk || !pafDstChunk)
+        return CE_Failure;
+
+    std::vector<GDALGeneric3x3ProcessLinesJob<T>> asJobs(nThreads);
+    for (auto &sJob : asJobs)
+    {
+        sJob.psParams = &sParams;
+        sJob.pafSrcChunk = pafSrcChunk.get();
+        sJob.pafDstChunk = pafDstChunk.get();
+        sJob.nXSize = nXSize;
+    }
+
+    for (int iChunkStart = 1; iChunkStart < nYSize - 1;
+         iChunkStart += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nYSize - 1 - iChunkStart);
+
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iChunkStart - 1,
+                                   nXSize, nLines + 2, pafSrcChunk.get(),
+                                   nXSize, nLines + 2, eReadDT, 0, 0);
+        if (eErr != CE_None)
+            return eErr;
+
+        const int nJobs = std::min(nThreads, nLines);
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            asJobs[iJob].iStart = static_cast<int>(
+                static_cast<GIntBig>(nLines) * iJob / nJobs);
+            asJobs[iJob].iEnd = static_cast<int>(
+                static_cast<GIntBig>(nLines) * (iJob + 1) / nJobs);
+            if (poJobQueue)
+                poJobQueue->SubmitJob(GDALGeneric3x3ProcessLinesFunc<T>,
+                                      &asJobs[iJob]);
+            else
+                GDALGeneric3x3ProcessLinesFunc<T>(&asJobs[iJob]);
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, iChunkStart, nXSize, nLines,
+                            pafDstChunk.get(), nXSize, nLines, GDT_Float32, 0,
+                            0);
+        if (eErr != CE_None)
+            return eErr;
+
+        if (!pfnProgress(1.0 * (iChunkStart + nLines) / nYSize, nullptr,
+                         pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -302,8 +623,8 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg,
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
-    void *pData, bool bComputeAtEdges, GDALProgressFunc pfnProgress,
-    void *pProgressData)
+    void *pData, bool bComputeAtEdges, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -477,7 +798,41 @@ static CPLErr GDALGeneric3x3Processing(
         return eErr;
     }
 
+    GDALGeneric3x3ProcessingParams<T> sParams;
+    sParams.pfnAlg = pfnAlg;
+    sParams.pfnAlg_multisample = pfnAlg_multisample;
+    sParams.pData = pData;
+    sParams.bComputeAtEdges = bComputeAtEdges;
+    sParams.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+    sParams.fSrcNoDataValue = fSrcNoDataValue;
+    sParams.bIsSrcNoDataNan = CPL_TO_BOOL(bIsSrcNoDataNan);
+    sParams.fDstNoDataValue = fDstNoDataValue;
+
     int i = 1;  // Used after for.
+    if (nThreads > 1 && nYSize > 3)
+    {
+        eErr = GDALGeneric3x3ProcessingMT(hSrcBand, hDstBand, eReadDT, sParams,
+                                          nThreads, pfnProgress,
+                                          pProgressData);
+        // Reload the last two lines for the processing of the last line.
+        for (int k = 0; eErr == CE_None && k < 2; ++k)
+        {
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYSize - 2 + k, nXSize,
+                                1, pafThreeLineWin + k * nXSize, nXSize, 1,
+                                eReadDT, 0, 0);
+        }
+        if (eErr != CE_None)
+        {
+            CPLFree(pafOutputBuf);
+            CPLFree(pafThreeLineWin);
+
+            return eErr;
+        }
+        nLine1Off = 0;
+        nLine2Off = nXSize;
+        i = nYSize - 1;
+    }
+
     for (; i < nYSize - 1; i++)
     {
         /* Read third line of the line buffer */
@@ -497,122 +852,18 @@ static CPLErr GDALGeneric3x3Processing(
         bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
         if (std::numeric_limits<T>::is_integer && bSrcHasNoData)
         {
-            bool bLastLineHasNoDataValue = false;
-            int iX = 0;
-            for (; iX + 3 < nXSize; iX += 4)
-            {
-                if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 1] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 2] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                {
-                    bLastLineHasNoDataValue = true;
-                    break;
-                }
-            }
-            if (!bLastLineHasNoDataValue)
-            {
-                for (; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                    }
-                }
-            }
-            abLineHasNoDataValue[nLine3Off / nXSize] = bLastLineHasNoDataValue;
+            abLineHasNoDataValue[nLine3Off / nXSize] =
+                GDALGeneric3x3LineHasNoData(pafThreeLineWin + nLine3Off,
+                                            nXSize, fSrcNoDataValue);
 
             bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
                                         abLineHasNoDataValue[1] ||
                                         abLineHasNoDataValue[2];
         }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
-                                   nLine3Off, nXSize, pData, pafOutputBuf);
-        }
-
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+        GDALGeneric3x3ProcessLine(sParams, pafThreeLineWin, nLine1Off,
+                                  nLine2Off, nLine3Off, nXSize,
+                                  bOneOfThreeLinesHasNoData, pafOutputBuf);
 
         /* -----------------------------------------
          * Write Line to Raster
@@ -3719,17 +3970,29 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         if (bDstHasNoData)
             GDALSetRasterNoDataValue(hDstBand, dfDstNoDataValue);
 
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        int nThreads = 1;
+        if (pszNumThreads)
+        {
+            nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads);
+            nThreads = std::max(1, std::min(128, nThreads));
+        }
+
         if (eSrcDT == GDT_Byte || eSrcDT == GDT_Int16 || eSrcDT == GDT_UInt16)
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample, pData,
-                psOptions->bComputeAtEdges, pfnProgress, pProgressData);
+                psOptions->bComputeAtEdges, nThreads, pfnProgress,
+                pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, nullptr, pData,
-                psOptions->bComputeAtEdges, pfnProgress, pProgressData);
+                psOptions->bComputeAtEdges, nThreads, pfnProgress,
+                pProgressData);
         }
     }
 
@@ -105,6 +105,9 @@ struct GDALInfoOptions
     /*! force computation of the checksum for each band in the dataset */
     bool bComputeChecksum = false;
 
+    /*! report block cache statistics for each band in the dataset */
+    bool bReportBlockCacheStats = false;
+
     /*! allow or suppress ground control points list printing. It may be useful
         for datasets with huge amount of GCPs, such as L1B AVHRR or HDF4 MODIS
         which contain thousands of them. */
@@ -284,6 +287,11 @@ GDALInfoAppOptionsGetParser(GDALInfoOptions *psOptions,
         .help(_(
             "Force computation of the checksum for each band in the dataset."));
 
+    argParser->add_argument("-cache_stats")
+        .flag()
+        .store_into(psOptions->bReportBlockCacheStats)
+        .help(_("Report block cache statistics for each band in the dataset."));
+
     argParser->add_argument("-listmdd")
         .flag()
         .store_into(psOptions->bListMDD)
@@ -1357,6 +1365,42 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
             }
         }
 
+        if (psOptions->bReportBlockCacheStats)
+        {
+            GDALBlockCacheStatistics sStats;
+            GDALGetRasterBlockCacheStatistics(hBand, &sStats);
+            if (bJson)
+            {
+                json_object *poCacheStats = json_object_new_object();
+                const auto AddCounter =
+                    [poCacheStats](const char *pszKey, GUIntBig nValue)
+                {
+                    json_object_object_add(
+                        poCacheStats, pszKey,
+                        json_object_new_int64(static_cast<int64_t>(nValue)));
+                };
+                AddCounter("hits", sStats.nHits);
+                AddCounter("misses", sStats.nMisses);
+                AddCounter("dirtyBlocksWritten", sStats.nDirtyBlocksWritten);
+                AddCounter("evictions", sStats.nEvictions);
+                AddCounter("cacheUsed",
+                           static_cast<GUIntBig>(sStats.nCacheUsed));
+                json_object_object_add(poBand, "blockCacheStatistics",
+                                       poCacheStats);
+            }
+            else
+            {
+                Concat(osStr, psOptions->bStdoutOutput,
+                       "  Block cache: hits=" CPL_FRMT_GUIB
+                       ", misses=" CPL_FRMT_GUIB
+                       ", dirty blocks written=" CPL_FRMT_GUIB
+                       ", evictions=" CPL_FRMT_GUIB ", bytes=" CPL_FRMT_GIB
+                       "\n",
+                       sStats.nHits, sStats.nMisses, sStats.nDirtyBlocksWritten,
+                       sStats.nEvictions, sStats.nCacheUsed);
+            }
+        }
+
         int bGotNodata = FALSE;
         if (eDT == GDT_Int64)
         {
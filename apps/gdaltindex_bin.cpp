@@ -61,6 +61,7 @@ static void Usage(bool bIsError, const char *pszErrorMsg)
         "                  [-mo <KEY>=<VALUE>]...\n"
         "                  [-fetch_md <gdal_md_name> <fld_name> "
         "<fld_type>]...\n"
+        "                  [-j <num_threads>|ALL_CPUS]\n"
         "                  <index_file> <file_or_dir> [<file_or_dir>]...\n"
         "\n"
         "e.g.\n"
@@ -43,8 +43,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <limits>
 #include <set>
+#include <utility>
 
 typedef enum
 {
@@ -99,6 +101,7 @@ struct GDALTileIndexOptions
     double dfMaxPixelSize = std::numeric_limits<double>::quiet_NaN();
     std::vector<GDALTileIndexRasterMetadata> aoFetchMD{};
     std::set<std::string> oSetFilenameFilters{};
+    int nNumThreads = 1;
 };
 
 /************************************************************************/
@@ -325,6 +328,23 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
     GDALTileIndexTileIterator oGDALTileIndexTileIterator(
         psOptions.get(), nSrcCount, papszSrcDSNames);
 
+    // Stat network files in a single batch, so that the file system caches
+    // are warmed before the files are opened one at a time.
+    {
+        CPLStringList aosRemoteFilenames;
+        for (int i = 0; i < nSrcCount; i++)
+        {
+            if (!VSIIsLocal(papszSrcDSNames[i]))
+                aosRemoteFilenames.AddString(papszSrcDSNames[i]);
+        }
+        if (aosRemoteFilenames.size() > 1)
+        {
+            std::vector<VSIStatBufL> asStatBuf(aosRemoteFilenames.size());
+            VSIFree(VSIStatMultipleL(aosRemoteFilenames.List(),
+                                     asStatBuf.data(), 0));
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Create and validate target SRS if given.                        */
     /* -------------------------------------------------------------------- */
@@ -782,44 +802,80 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         psOptions->bMaskBand || !psOptions->aosMetadata.empty() ||
         !psOptions->osGTIFilename.empty();
 
+    // Source files are opened ahead on worker threads, and consumed in
+    // iteration order, so that the output does not depend on the number
+    // of threads.
+    GDALDatasetPrefetcher oPrefetcher(psOptions->nNumThreads,
+                                      GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR);
+    std::deque<std::pair<std::string, std::string>> aoPendingFilenames;
+    bool bIteratorExhausted = false;
+
+    // Fetches the next file name from the iterator, and submits it for
+    // opening unless it is already in the tile index.
+    const auto SubmitNext = [&]()
+    {
+        while (true)
+        {
+            std::string osSrcFilename = oGDALTileIndexTileIterator.next();
+            if (osSrcFilename.empty())
+            {
+                bIteratorExhausted = true;
+                return;
+            }
+
+            std::string osFileNameToWrite;
+            VSIStatBuf sStatBuf;
+
+            // Make sure it is a file before building absolute path name.
+            if (!osCurrentPath.empty() &&
+                CPLIsFilenameRelative(osSrcFilename.c_str()) &&
+                VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
+            {
+                osFileNameToWrite = CPLProjectRelativeFilename(
+                    osCurrentPath.c_str(), osSrcFilename.c_str());
+            }
+            else
+            {
+                osFileNameToWrite = osSrcFilename.c_str();
+            }
+
+            // Checks that file is not already in tileindex.
+            if (oSetExistingFiles.find(osFileNameToWrite) !=
+                oSetExistingFiles.end())
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "File %s is already in tileindex. Skipping it.",
+                         osFileNameToWrite.c_str());
+                continue;
+            }
+
+            oPrefetcher.Submit(osSrcFilename);
+            aoPendingFilenames.emplace_back(std::move(osSrcFilename),
+                                            std::move(osFileNameToWrite));
+            return;
+        }
+    };
+
     /* -------------------------------------------------------------------- */
     /*      loop over GDAL files, processing.                               */
     /* -------------------------------------------------------------------- */
     while (true)
     {
-        const std::string osSrcFilename = oGDALTileIndexTileIterator.next();
-        if (osSrcFilename.empty())
-            break;
-
-        std::string osFileNameToWrite;
-        VSIStatBuf sStatBuf;
-
-        // Make sure it is a file before building absolute path name.
-        if (!osCurrentPath.empty() &&
-            CPLIsFilenameRelative(osSrcFilename.c_str()) &&
-            VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
+        while (!bIteratorExhausted &&
+               oPrefetcher.GetPendingCount() < oPrefetcher.GetMaxPending())
         {
-            osFileNameToWrite = CPLProjectRelativeFilename(
-                osCurrentPath.c_str(), osSrcFilename.c_str());
-        }
-        else
-        {
-            osFileNameToWrite = osSrcFilename.c_str();
+            SubmitNext();
         }
+        if (aoPendingFilenames.empty())
+            break;
 
-        // Checks that file is not already in tileindex.
-        if (oSetExistingFiles.find(osFileNameToWrite) !=
-            oSetExistingFiles.end())
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "File %s is already in tileindex. Skipping it.",
-                     osFileNameToWrite.c_str());
-            continue;
-        }
+        const std::string osSrcFilename =
+            std::move(aoPendingFilenames.front().first);
+        const std::string osFileNameToWrite =
+            std::move(aoPendingFilenames.front().second);
+        aoPendingFilenames.pop_front();
 
-        auto poSrcDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
-            osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-            nullptr, nullptr, nullptr));
+        auto poSrcDS = oPrefetcher.Get();
         if (poSrcDS == nullptr)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
@@ -1319,6 +1375,20 @@ GDALTileIndexOptionsNew(char **papszArgv,
             CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
             psOptions->oSetFilenameFilters.insert(papszArgv[++iArg]);
         }
+        else if (EQUAL(papszArgv[iArg], "-j"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            const char *pszNumThreads = papszArgv[++iArg];
+            psOptions->nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszNumThreads);
+            if (psOptions->nNumThreads <= 0)
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "Invalid value for -j: %s", pszNumThreads);
+                return nullptr;
+            }
+        }
         else if (EQUAL(papszArgv[iArg], "-fetch_md"))
         {
             CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(3);
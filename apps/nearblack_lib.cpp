@@ -38,6 +38,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <climits>
 #include <memory>
 #include <vector>
 
@@ -47,6 +48,7 @@
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #include "nearblack_lib.h"
 
@@ -334,6 +336,346 @@ GDALDatasetH CPL_DLL GDALNearblack(const char *pszDest, GDALDatasetH hDstDS,
     return hDstDS;
 }
 
+/************************************************************************/
+/*                     GDALNearblackGetNumThreads()                     */
+/************************************************************************/
+
+// Returns the number of threads to use, from the GDAL_NUM_THREADS
+// configuration option.
+int GDALNearblackGetNumThreads()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    int nThreads = 1;
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+    return nThreads;
+}
+
+/************************************************************************/
+/*                            IsNonBlack()                              */
+/************************************************************************/
+
+// Same test as in ProcessLine(): whether a pixel is far from all colors
+static bool IsNonBlack(const GByte *pabyPixel, int nSrcBands, int nNearDist,
+                       const Colors &oColors)
+{
+    bool bIsNonBlack = false;
+    for (const Color &oColor : oColors)
+    {
+        bIsNonBlack = false;
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
+        {
+            const int nPix = pabyPixel[iBand];
+            if (oColor[iBand] - nPix > nNearDist ||
+                nPix > nNearDist + oColor[iBand])
+            {
+                bIsNonBlack = true;
+                break;
+            }
+        }
+        if (!bIsNonBlack)
+            break;
+    }
+    return bIsNonBlack;
+}
+
+/************************************************************************/
+/*                 GDALNearblackTwoPassesAlgorithmMT()                  */
+/************************************************************************/
+
+namespace
+{
+struct GDALNearblackLinesJob
+{
+    const GDALNearblackOptions *psOptions = nullptr;
+    const Colors *poColors = nullptr;
+    int nXSize = 0;
+    int nSrcBands = 0;
+    int nDstBands = 0;
+    bool bBottomUp = false;
+
+    // Lines of the job, in the order of the pass
+    GByte *pabyLines = nullptr;
+    GByte *pabyMask = nullptr;
+    int nLines = 0;
+    // Index of the first line of the job, counted from the top or bottom
+    int iFirstLineFromTopOrBottom = 0;
+
+    // Per-column count of non-black pixels (with the same saturation as
+    // panLastLineCounts of ProcessLine()) over the lines of the job, and
+    // then state of panLastLineCounts before the first line of the job.
+    std::vector<int> anCounts{};
+};
+}  // namespace
+
+static GByte *GetJobLine(const GDALNearblackLinesJob *psJob, int i)
+{
+    const int iLine = psJob->bBottomUp ? psJob->nLines - 1 - i : i;
+    return psJob->pabyLines +
+           static_cast<size_t>(iLine) * psJob->nXSize * psJob->nDstBands;
+}
+
+// First step: compute the contribution of the lines of the job to the
+// vertical counts.
+static void GDALNearblackCountFunc(void *pData)
+{
+    auto psJob = static_cast<GDALNearblackLinesJob *>(pData);
+    const int nMaxNonBlack = psJob->psOptions->nMaxNonBlack;
+    const int nNearDist = psJob->psOptions->nNearDist;
+    psJob->anCounts.assign(psJob->nXSize, 0);
+    for (int i = 0; i < psJob->nLines; ++i)
+    {
+        const GByte *pabyLine = GetJobLine(psJob, i);
+        const bool bFirstLine = psJob->iFirstLineFromTopOrBottom + i == 0;
+        for (int iCol = 0; iCol < psJob->nXSize; ++iCol)
+        {
+            int &nCount = psJob->anCounts[iCol];
+            if (nCount <= nMaxNonBlack &&
+                IsNonBlack(pabyLine + static_cast<size_t>(iCol) *
+                                          psJob->nDstBands,
+                           psJob->nSrcBands, nNearDist, *(psJob->poColors)))
+            {
+                nCount = (bFirstLine && nMaxNonBlack > 0) ? nMaxNonBlack + 1
+                                                          : nCount + 1;
+            }
+        }
+    }
+}
+
+// Second step: process the lines of the job, from the vertical counts
+// before its first line.
+static void GDALNearblackProcessLinesFunc(void *pData)
+{
+    auto psJob = static_cast<GDALNearblackLinesJob *>(pData);
+    const auto psOptions = psJob->psOptions;
+    const int nXSize = psJob->nXSize;
+    for (int i = 0; i < psJob->nLines; ++i)
+    {
+        GByte *pabyLine = GetJobLine(psJob, i);
+        const int iLine = psJob->bBottomUp ? psJob->nLines - 1 - i : i;
+        GByte *pabyMask = psJob->pabyMask
+                              ? psJob->pabyMask +
+                                    static_cast<size_t>(iLine) * nXSize
+                              : nullptr;
+        const int iLineFromTopOrBottom = psJob->iFirstLineFromTopOrBottom + i;
+        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, psJob->nSrcBands,
+                    psJob->nDstBands, psOptions->nNearDist,
+                    psOptions->nMaxNonBlack, psOptions->bNearWhite,
+                    *(psJob->poColors), psJob->anCounts.data(),
+                    true,  // bDoHorizontalCheck
+                    true,  // bDoVerticalCheck
+                    psJob->bBottomUp, iLineFromTopOrBottom);
+        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, psJob->nSrcBands,
+                    psJob->nDstBands, psOptions->nNearDist,
+                    psOptions->nMaxNonBlack, psOptions->bNearWhite,
+                    *(psJob->poColors), psJob->anCounts.data(),
+                    true,   // bDoHorizontalCheck
+                    false,  // bDoVerticalCheck
+                    psJob->bBottomUp, iLineFromTopOrBottom);
+    }
+}
+
+// Multi-threaded version of GDALNearblackTwoPassesAlgorithm(), with the
+// same output.
+// Each pass processes the raster by chunks of consecutive lines, read and
+// written in a single call, and split into one sub-chunk per thread. The
+// only state carried from one line to the next one is the per-column count
+// of non-black pixels of the vertical check, which only depends on the
+// pixels of the column, and saturates. Each sub-chunk first computes its
+// contribution to those counts, the counts at the start of each sub-chunk
+// are then reconciled serially, and the sub-chunks are then processed in
+// parallel.
+static bool GDALNearblackTwoPassesAlgorithmMT(
+    const GDALNearblackOptions *psOptions, GDALDatasetH hSrcDataset,
+    GDALDatasetH hDstDS, GDALRasterBandH hMaskBand, int nBands, int nDstBands,
+    bool bSetMask, const Colors &oColors, int nThreads)
+{
+    const int nXSize = GDALGetRasterXSize(hSrcDataset);
+    const int nYSize = GDALGetRasterYSize(hSrcDataset);
+    const int nMaxNonBlack = psOptions->nMaxNonBlack;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Aim at about 64 MB of buffers, with at least one line per thread
+    constexpr int CHUNK_BUFFER_SIZE = 64 * 1024 * 1024;
+    const GIntBig nBytesPerLine =
+        static_cast<GIntBig>(nXSize) * (nDstBands + (bSetMask ? 1 : 0));
+    const int nChunkLines = std::min(
+        nYSize, std::max(nThreads, static_cast<int>(std::min<GIntBig>(
+                                       INT_MAX, CHUNK_BUFFER_SIZE /
+                                                    nBytesPerLine))));
+
+    std::vector<GByte> abyChunk;
+    std::vector<GByte> abyMask;
+    try
+    {
+        abyChunk.resize(static_cast<size_t>(nChunkLines) * nXSize * nDstBands);
+        if (bSetMask)
+            abyMask.resize(static_cast<size_t>(nChunkLines) * nXSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers: %s", e.what());
+        return false;
+    }
+
+    std::vector<GDALNearblackLinesJob> asJobs(nThreads);
+    for (auto &sJob : asJobs)
+    {
+        sJob.psOptions = psOptions;
+        sJob.poColors = &oColors;
+        sJob.nXSize = nXSize;
+        sJob.nSrcBands = nBands;
+        sJob.nDstBands = nDstBands;
+    }
+
+    const auto RunJobs = [&asJobs, &poJobQueue](int nJobs, CPLThreadFunc pfn)
+    {
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            if (!poJobQueue || !poJobQueue->SubmitJob(pfn, &asJobs[iJob]))
+                pfn(&asJobs[iJob]);
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+    };
+
+    for (int iPass = 0; iPass < 2; ++iPass)
+    {
+        const bool bBottomUp = iPass == 1;
+        // State of panLastLineCounts of the serial algorithm
+        std::vector<int> anLastLineCounts(nXSize);
+
+        for (int iChunk = 0; iChunk < nYSize; iChunk += nChunkLines)
+        {
+            const int nLines = std::min(nChunkLines, nYSize - iChunk);
+            const int nYOff = bBottomUp ? nYSize - iChunk - nLines : iChunk;
+
+            if (!bBottomUp)
+            {
+                if (GDALDatasetRasterIO(
+                        hSrcDataset, GF_Read, 0, nYOff, nXSize, nLines,
+                        abyChunk.data(), nXSize, nLines, GDT_Byte, nBands,
+                        nullptr, nDstBands,
+                        static_cast<GSpacing>(nXSize) * nDstBands,
+                        1) != CE_None)
+                {
+                    return false;
+                }
+                if (psOptions->bSetAlpha)
+                {
+                    for (size_t i = 0; i < static_cast<size_t>(nLines) * nXSize;
+                         i++)
+                    {
+                        abyChunk[i * nDstBands + nDstBands - 1] = 255;
+                    }
+                }
+                if (bSetMask)
+                    memset(abyMask.data(), 255,
+                           static_cast<size_t>(nLines) * nXSize);
+            }
+            else
+            {
+                if (GDALDatasetRasterIO(
+                        hDstDS, GF_Read, 0, nYOff, nXSize, nLines,
+                        abyChunk.data(), nXSize, nLines, GDT_Byte, nDstBands,
+                        nullptr, nDstBands,
+                        static_cast<GSpacing>(nXSize) * nDstBands,
+                        1) != CE_None)
+                {
+                    return false;
+                }
+                if (bSetMask &&
+                    GDALRasterIO(hMaskBand, GF_Read, 0, nYOff, nXSize, nLines,
+                                 abyMask.data(), nXSize, nLines, GDT_Byte, 0,
+                                 0) != CE_None)
+                {
+                    return false;
+                }
+            }
+
+            // Split the chunk in sub-chunks of consecutive lines, in the
+            // order of the pass
+            const int nJobs = std::min(nThreads, nLines);
+            for (int iJob = 0; iJob < nJobs; ++iJob)
+            {
+                auto &sJob = asJobs[iJob];
+                const int iStart = static_cast<int>(
+                    static_cast<GIntBig>(nLines) * iJob / nJobs);
+                const int iEnd = static_cast<int>(
+                    static_cast<GIntBig>(nLines) * (iJob + 1) / nJobs);
+                // Offset in the chunk, in raster order
+                const int iFirstLineInChunk =
+                    bBottomUp ? nLines - iEnd : iStart;
+                sJob.bBottomUp = bBottomUp;
+                sJob.pabyLines = abyChunk.data() +
+                                 static_cast<size_t>(iFirstLineInChunk) *
+                                     nXSize * nDstBands;
+                sJob.pabyMask =
+                    bSetMask ? abyMask.data() +
+                                   static_cast<size_t>(iFirstLineInChunk) *
+                                       nXSize
+                             : nullptr;
+                sJob.nLines = iEnd - iStart;
+                sJob.iFirstLineFromTopOrBottom = iChunk + iStart;
+            }
+
+            RunJobs(nJobs, GDALNearblackCountFunc);
+
+            // Seam reconciliation: replace the contribution of each
+            // sub-chunk by the counts before its first line
+            for (int iJob = 0; iJob < nJobs; ++iJob)
+            {
+                auto &anCounts = asJobs[iJob].anCounts;
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    const int nBefore = anLastLineCounts[iCol];
+                    anLastLineCounts[iCol] = std::min(
+                        nMaxNonBlack + 1, nBefore + anCounts[iCol]);
+                    anCounts[iCol] = nBefore;
+                }
+            }
+
+            RunJobs(nJobs, GDALNearblackProcessLinesFunc);
+
+            if (GDALDatasetRasterIO(hDstDS, GF_Write, 0, nYOff, nXSize, nLines,
+                                    abyChunk.data(), nXSize, nLines, GDT_Byte,
+                                    nDstBands, nullptr, nDstBands,
+                                    static_cast<GSpacing>(nXSize) * nDstBands,
+                                    1) != CE_None)
+            {
+                return false;
+            }
+            if (bSetMask &&
+                GDALRasterIO(hMaskBand, GF_Write, 0, nYOff, nXSize, nLines,
+                             abyMask.data(), nXSize, nLines, GDT_Byte, 0,
+                             0) != CE_None)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "ERROR writing out lines to mask band.");
+                return false;
+            }
+
+            if (!(psOptions->pfnProgress(
+                    0.5 * iPass +
+                        0.5 * ((iChunk + nLines) / static_cast<double>(nYSize)),
+                    nullptr, psOptions->pProgressData)))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                   GDALNearblackTwoPassesAlgorithm()                  */
 /*                                                                      */
@@ -355,6 +697,14 @@ bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
     const bool bNearWhite = psOptions->bNearWhite;
     const bool bSetAlpha = psOptions->bSetAlpha;
 
+    const int nThreads = std::min(GDALNearblackGetNumThreads(), nYSize);
+    if (nThreads > 1)
+    {
+        return GDALNearblackTwoPassesAlgorithmMT(
+            psOptions, hSrcDataset, hDstDS, hMaskBand, nBands, nDstBands,
+            bSetMask, oColors, nThreads);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate a line buffer.                                         */
     /* -------------------------------------------------------------------- */
@@ -28,12 +28,49 @@
  ****************************************************************************/
 
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "nearblack_lib.h"
 
 #include <algorithm>
+#include <climits>
 #include <memory>
 #include <queue>
 
+/************************************************************************/
+/*                        IsTransparentPixel()                          */
+/************************************************************************/
+
+// Returns true if the pixel is "black" (or more generally transparent
+// according to oColors)
+static bool IsTransparentPixel(const GByte *pabyPixel, int nSrcBands,
+                               int nNearDist, const Colors &oColors)
+{
+    /***** loop over the colors *****/
+
+    for (const Color &oColor : oColors)
+    {
+        /***** loop over the bands *****/
+        bool bIsNonBlack = false;
+
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
+        {
+            const int nPix = pabyPixel[iBand];
+
+            if (oColor[iBand] - nPix > nNearDist ||
+                nPix > nNearDist + oColor[iBand])
+            {
+                bIsNonBlack = true;
+                break;
+            }
+        }
+
+        if (!bIsNonBlack)
+            return true;
+    }
+
+    return false;
+}
+
 /************************************************************************/
 /*                    GDALNearblackFloodFillAlg                         */
 /************************************************************************/
@@ -128,36 +165,11 @@ bool GDALNearblackFloodFillAlg::MustSet(int iX, int iY)
         return m_abyLineMustSet[iX] == MUST_FILL_TRUE;
     }
 
-    /***** loop over the colors *****/
-
-    for (int iColor = 0; iColor < static_cast<int>(m_oColors.size()); iColor++)
-    {
-        const Color &oColor = m_oColors[iColor];
-
-        /***** loop over the bands *****/
-        bool bIsNonBlack = false;
-
-        for (int iBand = 0; iBand < m_nSrcBands; iBand++)
-        {
-            const int nPix = m_abyLine[iX * m_nDstBands + iBand];
-
-            if (oColor[iBand] - nPix > m_psOptions->nNearDist ||
-                nPix > m_psOptions->nNearDist + oColor[iBand])
-            {
-                bIsNonBlack = true;
-                break;
-            }
-        }
-
-        if (!bIsNonBlack)
-        {
-            m_abyLineMustSet[iX] = MUST_FILL_TRUE;
-            return true;
-        }
-    }
-
-    m_abyLineMustSet[iX] = MUST_FILL_FALSE;
-    return false;
+    const bool bMustSet =
+        IsTransparentPixel(&m_abyLine[iX * m_nDstBands], m_nSrcBands,
+                           m_psOptions->nNearDist, m_oColors);
+    m_abyLineMustSet[iX] = bMustSet ? MUST_FILL_TRUE : MUST_FILL_FALSE;
+    return bMustSet;
 }
 
 /************************************************************************/
@@ -585,6 +597,461 @@ bool GDALNearblackFloodFillAlg::Process()
     return LoadLine(-1);
 }
 
+/************************************************************************/
+/*                     GDALNearblackFloodFillMT()                       */
+/************************************************************************/
+
+// Multi-threaded alternative to GDALNearblackFloodFillAlg, with the same
+// output: the pixels that are set are the transparent ones that are
+// 4-connected to the border of the raster through transparent pixels.
+//
+// The raster is split in strips of consecutive lines, whose connected
+// components of transparent pixels are labelled in parallel. A first pass
+// only keeps the labels of the top and bottom lines of each strip, and
+// whether each of them touches the border of the raster. Labels are then
+// reconciled across strip seams with a union-find structure, and a second
+// pass labels each strip again and sets the pixels of the components
+// connected to the border.
+
+namespace
+{
+struct GDALNearblackFloodFillStripJob
+{
+    const GDALNearblackOptions *psOptions = nullptr;
+    const Colors *poColors = nullptr;
+    int nXSize = 0;
+    int nSrcBands = 0;
+    int nDstBands = 0;
+    bool bSetMask = false;
+    bool bFirstStrip = false;
+    bool bLastStrip = false;
+    int nLines = 0;
+
+    std::vector<GByte> abyLines{};
+    std::vector<GByte> abyMask{};
+
+    // Output of the first pass: index of the seam node of the top and
+    // bottom lines (or -1 for non-transparent pixels), and whether each
+    // seam node touches the border of the raster.
+    std::vector<int> anTopNodes{};
+    std::vector<int> anBottomNodes{};
+    std::vector<bool> abNodeOnBorder{};
+
+    // Input of the second pass: index of the first seam node of the strip
+    // in pabNodeConnected
+    size_t nFirstNode = 0;
+    const std::vector<bool> *pabNodeConnected = nullptr;
+};
+
+// Labels the 4-connected components of transparent pixels of the strip,
+// from 0 to the returned number of labels - 1. Non transparent pixels
+// are labelled -1.
+int LabelStrip(const GDALNearblackFloodFillStripJob *psJob,
+               std::vector<int> &anLabels)
+{
+    const int nXSize = psJob->nXSize;
+    const size_t nPixels = static_cast<size_t>(nXSize) * psJob->nLines;
+    anLabels.assign(nPixels, -1);
+
+    // Provisional labels, whose parent is always lower or equal
+    std::vector<int> anParent;
+    const auto Find = [&anParent](int i)
+    {
+        while (anParent[i] != i)
+        {
+            anParent[i] = anParent[anParent[i]];
+            i = anParent[i];
+        }
+        return i;
+    };
+
+    for (size_t i = 0; i < nPixels; ++i)
+    {
+        if (!IsTransparentPixel(&psJob->abyLines[i * psJob->nDstBands],
+                                psJob->nSrcBands, psJob->psOptions->nNearDist,
+                                *(psJob->poColors)))
+        {
+            continue;
+        }
+        const int nUp =
+            i >= static_cast<size_t>(nXSize) ? anLabels[i - nXSize] : -1;
+        const int nLeft = (i % nXSize) != 0 ? anLabels[i - 1] : -1;
+        int nLabel;
+        if (nUp < 0 && nLeft < 0)
+        {
+            nLabel = static_cast<int>(anParent.size());
+            anParent.push_back(nLabel);
+        }
+        else if (nUp < 0 || nLeft < 0)
+        {
+            nLabel = std::max(nUp, nLeft);
+        }
+        else
+        {
+            const int nRootUp = Find(nUp);
+            const int nRootLeft = Find(nLeft);
+            nLabel = std::min(nRootUp, nRootLeft);
+            anParent[std::max(nRootUp, nRootLeft)] = nLabel;
+        }
+        anLabels[i] = nLabel;
+    }
+
+    // Compact labels. Roots are lower than their children, and thus
+    // numbered first.
+    std::vector<int> anCompactLabel(anParent.size());
+    int nLabels = 0;
+    for (int i = 0; i < static_cast<int>(anParent.size()); ++i)
+    {
+        const int nRoot = Find(i);
+        anCompactLabel[i] = nRoot == i ? nLabels++ : anCompactLabel[nRoot];
+    }
+    for (int &nLabel : anLabels)
+    {
+        if (nLabel >= 0)
+            nLabel = anCompactLabel[nLabel];
+    }
+    return nLabels;
+}
+
+// Returns, for each label, whether its component touches the border of
+// the raster, not taking into account the other strips.
+std::vector<bool>
+GetLabelsOnBorder(const GDALNearblackFloodFillStripJob *psJob,
+                  const std::vector<int> &anLabels, int nLabels)
+{
+    const int nXSize = psJob->nXSize;
+    std::vector<bool> abOnBorder(nLabels);
+    for (int iLine = 0; iLine < psJob->nLines; ++iLine)
+    {
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        for (const int nLabel :
+             {anLabels[nOffset], anLabels[nOffset + nXSize - 1]})
+        {
+            if (nLabel >= 0)
+                abOnBorder[nLabel] = true;
+        }
+    }
+    const auto MarkLine = [&](int iLine)
+    {
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        for (int iX = 0; iX < nXSize; ++iX)
+        {
+            if (anLabels[nOffset + iX] >= 0)
+                abOnBorder[anLabels[nOffset + iX]] = true;
+        }
+    };
+    if (psJob->bFirstStrip)
+        MarkLine(0);
+    if (psJob->bLastStrip)
+        MarkLine(psJob->nLines - 1);
+    return abOnBorder;
+}
+
+void GDALNearblackFloodFillLabelFunc(void *pData)
+{
+    auto psJob = static_cast<GDALNearblackFloodFillStripJob *>(pData);
+    const int nXSize = psJob->nXSize;
+    std::vector<int> anLabels;
+    const int nLabels = LabelStrip(psJob, anLabels);
+    const auto abOnBorder = GetLabelsOnBorder(psJob, anLabels, nLabels);
+
+    // Number seam nodes in order of appearance on the top and bottom lines
+    std::vector<int> anNodeOfLabel(nLabels, -1);
+    psJob->abNodeOnBorder.clear();
+    const auto GetSeamNodes = [&](int iLine, std::vector<int> &anNodes)
+    {
+        anNodes.resize(nXSize);
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        for (int iX = 0; iX < nXSize; ++iX)
+        {
+            const int nLabel = anLabels[nOffset + iX];
+            if (nLabel >= 0 && anNodeOfLabel[nLabel] < 0)
+            {
+                anNodeOfLabel[nLabel] =
+                    static_cast<int>(psJob->abNodeOnBorder.size());
+                psJob->abNodeOnBorder.push_back(abOnBorder[nLabel]);
+            }
+            anNodes[iX] = nLabel >= 0 ? anNodeOfLabel[nLabel] : -1;
+        }
+    };
+    GetSeamNodes(0, psJob->anTopNodes);
+    GetSeamNodes(psJob->nLines - 1, psJob->anBottomNodes);
+}
+
+void GDALNearblackFloodFillSetFunc(void *pData)
+{
+    auto psJob = static_cast<GDALNearblackFloodFillStripJob *>(pData);
+    const int nXSize = psJob->nXSize;
+    const int nSrcBands = psJob->nSrcBands;
+    const int nDstBands = psJob->nDstBands;
+    std::vector<int> anLabels;
+    const int nLabels = LabelStrip(psJob, anLabels);
+    auto abConnected = GetLabelsOnBorder(psJob, anLabels, nLabels);
+
+    const auto &abNodeConnected = *(psJob->pabNodeConnected);
+    const auto MarkConnectedFromSeam =
+        [&](int iLine, const std::vector<int> &anNodes)
+    {
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        for (int iX = 0; iX < nXSize; ++iX)
+        {
+            if (anNodes[iX] >= 0 &&
+                abNodeConnected[psJob->nFirstNode + anNodes[iX]])
+            {
+                abConnected[anLabels[nOffset + iX]] = true;
+            }
+        }
+    };
+    MarkConnectedFromSeam(0, psJob->anTopNodes);
+    MarkConnectedFromSeam(psJob->nLines - 1, psJob->anBottomNodes);
+
+    const GByte nReplacevalue = psJob->psOptions->bNearWhite ? 255 : 0;
+    for (size_t i = 0; i < anLabels.size(); ++i)
+    {
+        if (anLabels[i] < 0 || !abConnected[anLabels[i]])
+            continue;
+
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
+            psJob->abyLines[i * nDstBands + iBand] = nReplacevalue;
+
+        /***** alpha *****/
+        if (nDstBands > nSrcBands)
+            psJob->abyLines[i * nDstBands + nDstBands - 1] = 0;
+
+        if (psJob->bSetMask)
+            psJob->abyMask[i] = 0;
+    }
+}
+}  // namespace
+
+static bool GDALNearblackFloodFillMT(const GDALNearblackOptions *psOptions,
+                                     GDALDataset *poSrcDataset,
+                                     GDALDataset *poDstDS,
+                                     GDALRasterBand *poMaskBand, int nSrcBands,
+                                     int nDstBands, bool bSetMask,
+                                     const Colors &oColors, int nThreads)
+{
+    const int nXSize = poSrcDataset->GetRasterXSize();
+    const int nYSize = poSrcDataset->GetRasterYSize();
+
+    // When the two-passes algorithm has been run before, start from its
+    // output
+    const bool bReadFromDst = psOptions->nMaxNonBlack > 0;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Aim at about 64 MB of buffers per thread. As the top and bottom lines
+    // of each strip are kept in memory between the two passes, use strips of
+    // at least 256 lines.
+    constexpr int STRIP_BUFFER_SIZE = 64 * 1024 * 1024;
+    constexpr int MIN_STRIP_LINES = 256;
+    const GIntBig nBytesPerLine = static_cast<GIntBig>(nXSize) *
+                                  (nDstBands + (bSetMask ? 1 : 0) +
+                                   static_cast<int>(sizeof(int)));
+    int nStripLines = static_cast<int>(std::max<GIntBig>(
+        MIN_STRIP_LINES, STRIP_BUFFER_SIZE / nBytesPerLine));
+    nStripLines = std::min(nStripLines, INT_MAX / nXSize);
+    nStripLines = std::min(nStripLines, DIV_ROUND_UP(nYSize, nThreads));
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripLines);
+
+    std::vector<GDALNearblackFloodFillStripJob> asStrips(nStrips);
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        auto &sStrip = asStrips[iStrip];
+        sStrip.psOptions = psOptions;
+        sStrip.poColors = &oColors;
+        sStrip.nXSize = nXSize;
+        sStrip.nSrcBands = nSrcBands;
+        sStrip.nDstBands = nDstBands;
+        sStrip.bSetMask = bSetMask;
+        sStrip.bFirstStrip = iStrip == 0;
+        sStrip.bLastStrip = iStrip == nStrips - 1;
+        sStrip.nLines = std::min(nStripLines, nYSize - iStrip * nStripLines);
+    }
+
+    const auto LoadStrip = [&](int iStrip)
+    {
+        auto &sStrip = asStrips[iStrip];
+        const int nYOff = iStrip * nStripLines;
+        const size_t nPixels = static_cast<size_t>(nXSize) * sStrip.nLines;
+        try
+        {
+            sStrip.abyLines.assign(nPixels * nDstBands, 0);
+            if (bSetMask)
+                sStrip.abyMask.resize(nPixels);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffers: %s", e.what());
+            return false;
+        }
+        if (bReadFromDst)
+        {
+            if (poDstDS->RasterIO(
+                    GF_Read, 0, nYOff, nXSize, sStrip.nLines,
+                    sStrip.abyLines.data(), nXSize, sStrip.nLines, GDT_Byte,
+                    nDstBands, nullptr, nDstBands,
+                    static_cast<GSpacing>(nXSize) * nDstBands, 1,
+                    nullptr) != CE_None ||
+                (bSetMask &&
+                 poMaskBand->RasterIO(GF_Read, 0, nYOff, nXSize,
+                                      sStrip.nLines, sStrip.abyMask.data(),
+                                      nXSize, sStrip.nLines, GDT_Byte, 0, 0,
+                                      nullptr) != CE_None))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (poSrcDataset->RasterIO(
+                    GF_Read, 0, nYOff, nXSize, sStrip.nLines,
+                    sStrip.abyLines.data(), nXSize, sStrip.nLines, GDT_Byte,
+                    // m_nSrcBands intended
+                    nSrcBands,
+                    // m_nDstBands intended
+                    nullptr, nDstBands,
+                    static_cast<GSpacing>(nXSize) * nDstBands, 1,
+                    nullptr) != CE_None)
+            {
+                return false;
+            }
+            if (psOptions->bSetAlpha)
+            {
+                for (size_t i = 0; i < nPixels; i++)
+                    sStrip.abyLines[i * nDstBands + nDstBands - 1] = 255;
+            }
+            if (bSetMask)
+                std::fill(sStrip.abyMask.begin(), sStrip.abyMask.end(), 255);
+        }
+        return true;
+    };
+
+    const auto FreeStrip = [&](int iStrip)
+    {
+        auto &sStrip = asStrips[iStrip];
+        sStrip.abyLines = std::vector<GByte>();
+        sStrip.abyMask = std::vector<GByte>();
+    };
+
+    const auto WriteStrip = [&](int iStrip)
+    {
+        auto &sStrip = asStrips[iStrip];
+        const int nYOff = iStrip * nStripLines;
+        if (poDstDS->RasterIO(GF_Write, 0, nYOff, nXSize, sStrip.nLines,
+                              sStrip.abyLines.data(), nXSize, sStrip.nLines,
+                              GDT_Byte, nDstBands, nullptr, nDstBands,
+                              static_cast<GSpacing>(nXSize) * nDstBands, 1,
+                              nullptr) != CE_None)
+        {
+            return false;
+        }
+        if (bSetMask &&
+            poMaskBand->RasterIO(GF_Write, 0, nYOff, nXSize, sStrip.nLines,
+                                 sStrip.abyMask.data(), nXSize, sStrip.nLines,
+                                 GDT_Byte, 0, 0, nullptr) != CE_None)
+        {
+            return false;
+        }
+        return true;
+    };
+
+    // Runs the function on all strips, by waves of nThreads strips, whose
+    // data is loaded (and then written if bWrite) by the calling thread.
+    const auto RunPass = [&](CPLThreadFunc pfnFunc, bool bWrite,
+                             double dfProgressStart)
+    {
+        for (int iWave = 0; iWave < nStrips; iWave += nThreads)
+        {
+            const int iWaveEnd = std::min(nStrips, iWave + nThreads);
+            for (int iStrip = iWave; iStrip < iWaveEnd; ++iStrip)
+            {
+                if (!LoadStrip(iStrip))
+                    return false;
+            }
+            for (int iStrip = iWave; iStrip < iWaveEnd; ++iStrip)
+            {
+                if (!poJobQueue ||
+                    !poJobQueue->SubmitJob(pfnFunc, &asStrips[iStrip]))
+                {
+                    pfnFunc(&asStrips[iStrip]);
+                }
+            }
+            if (poJobQueue)
+                poJobQueue->WaitCompletion();
+            for (int iStrip = iWave; iStrip < iWaveEnd; ++iStrip)
+            {
+                if (bWrite && !WriteStrip(iStrip))
+                    return false;
+                FreeStrip(iStrip);
+            }
+            if (!(psOptions->pfnProgress(
+                    dfProgressStart +
+                        0.5 * iWaveEnd / static_cast<double>(nStrips),
+                    nullptr, psOptions->pProgressData)))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (!RunPass(GDALNearblackFloodFillLabelFunc, false, 0.0))
+        return false;
+
+    /* -------------------------------------------------------------------- */
+    /*      Reconcile labels across strip seams.                            */
+    /* -------------------------------------------------------------------- */
+    // Node 0 stands for the border of the raster
+    std::vector<size_t> anParent(1, 0);
+    for (auto &sStrip : asStrips)
+    {
+        sStrip.nFirstNode = anParent.size();
+        for (size_t i = 0; i < sStrip.abNodeOnBorder.size(); ++i)
+            anParent.push_back(sStrip.abNodeOnBorder[i]
+                                   ? 0
+                                   : sStrip.nFirstNode + i);
+        sStrip.abNodeOnBorder = std::vector<bool>();
+    }
+    const auto Find = [&anParent](size_t i)
+    {
+        while (anParent[i] != i)
+        {
+            anParent[i] = anParent[anParent[i]];
+            i = anParent[i];
+        }
+        return i;
+    };
+    for (int iStrip = 0; iStrip + 1 < nStrips; ++iStrip)
+    {
+        const auto &sAbove = asStrips[iStrip];
+        const auto &sBelow = asStrips[iStrip + 1];
+        for (int iX = 0; iX < nXSize; ++iX)
+        {
+            if (sAbove.anBottomNodes[iX] >= 0 && sBelow.anTopNodes[iX] >= 0)
+            {
+                const size_t nRootAbove =
+                    Find(sAbove.nFirstNode + sAbove.anBottomNodes[iX]);
+                const size_t nRootBelow =
+                    Find(sBelow.nFirstNode + sBelow.anTopNodes[iX]);
+                // Lower root wins, so that node 0 stays a root
+                anParent[std::max(nRootAbove, nRootBelow)] =
+                    std::min(nRootAbove, nRootBelow);
+            }
+        }
+    }
+    std::vector<bool> abNodeConnected(anParent.size());
+    for (size_t i = 0; i < anParent.size(); ++i)
+        abNodeConnected[i] = Find(i) == 0;
+    anParent = std::vector<size_t>();
+    for (auto &sStrip : asStrips)
+        sStrip.pabNodeConnected = &abNodeConnected;
+
+    return RunPass(GDALNearblackFloodFillSetFunc, true, 0.5);
+}
+
 /************************************************************************/
 /*                    GDALNearblackFloodFill()                          */
 /************************************************************************/
@@ -608,6 +1075,9 @@ bool GDALNearblackFloodFill(const GDALNearblackOptions *psOptions,
     alg.m_oColors = oColors;
     alg.m_nReplacevalue = psOptions->bNearWhite ? 255 : 0;
 
+    const int nThreads = std::min(GDALNearblackGetNumThreads(),
+                                  alg.m_poSrcDataset->GetRasterYSize());
+
     if (psOptions->nMaxNonBlack > 0)
     {
         // First pass: use the TwoPasses algorithm to deal with nMaxNonBlack
@@ -627,10 +1097,26 @@ bool GDALNearblackFloodFill(const GDALNearblackOptions *psOptions,
             0.5, 1, psOptions->pfnProgress, psOptions->pProgressData);
         sOptionsTmp.pfnProgress = GDALScaledProgress;
         alg.m_psOptions = &sOptionsTmp;
-        bRet = alg.Process();
+        if (nThreads > 1)
+        {
+            bRet = GDALNearblackFloodFillMT(
+                &sOptionsTmp, alg.m_poSrcDataset, alg.m_poDstDS,
+                alg.m_poMaskBand, nSrcBands, nDstBands, bSetMask, oColors,
+                nThreads);
+        }
+        else
+        {
+            bRet = alg.Process();
+        }
         GDALDestroyScaledProgress(sOptionsTmp.pProgressData);
         return bRet;
     }
+    else if (nThreads > 1)
+    {
+        return GDALNearblackFloodFillMT(
+            psOptions, alg.m_poSrcDataset, alg.m_poDstDS, alg.m_poMaskBand,
+            nSrcBands, nDstBands, bSetMask, oColors, nThreads);
+    }
     else
     {
         return alg.Process();
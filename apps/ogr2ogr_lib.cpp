@@ -40,9 +40,11 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 #include <string>
@@ -52,6 +54,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
@@ -60,6 +63,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -439,6 +443,9 @@ struct GDALVectorTranslateOptions
     /*! Maximum number of features, or -1 if no limit. */
     GIntBig nLimit = -1;
 
+    /*! Number of threads used to process geometries. */
+    int nNumThreads = 1;
+
     /*! Wished offset w.r.t UTC of dateTime */
     int nTZOffsetInSec = TZ_OFFSET_INVALID;
 
@@ -579,17 +586,13 @@ class LayerTranslator
     GeomOperation m_eGeomOp = GEOMOP_NONE;
     double m_dfGeomOpParam = 0;
     OGRGeometry *m_poClipSrcOri = nullptr;
-    bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS;
-    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
+    std::atomic<bool> m_bWarnedClipSrcSRS{false};
     OGRGeometry *m_poClipDstOri = nullptr;
-    bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS;
-    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
+    std::atomic<bool> m_bWarnedClipDstSRS{false};
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
     GIntBig m_nLimit = -1;
-    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache;
+    int m_nNumThreads = 1;
 
     bool Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
                    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
@@ -598,8 +601,83 @@ class LayerTranslator
                    const GDALVectorTranslateOptions *psOptions);
 
   private:
-    const OGRGeometry *GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
-    const OGRGeometry *GetSrcClipGeom(const OGRSpatialReference *poGeomSRS);
+    /** State mutated while processing geometries. In multi-threaded mode,
+     * each worker thread uses its own instance. */
+    struct GeomProcessingContext
+    {
+        // Clones of the coordinate transformations of the target layer, per
+        // geometry field. Empty when the ones of TargetLayerInfo are used.
+        std::vector<std::unique_ptr<OGRCoordinateTransformation>> m_apoCT{};
+        OGRGeometryFactory::TransformWithOptionsCache
+            m_transformWithOptionsCache{};
+        std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
+        const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS =
+            nullptr;
+        std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
+        const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS =
+            nullptr;
+    };
+
+    struct GeomProcessingContextPool
+    {
+        std::mutex m_oMutex{};
+        TargetLayerInfo *m_psInfo = nullptr;
+        std::vector<std::unique_ptr<GeomProcessingContext>>
+            m_apoFreeContexts{};
+
+        std::unique_ptr<GeomProcessingContext> Acquire();
+        void Release(std::unique_ptr<GeomProcessingContext> &&poContext);
+    };
+
+    enum class GeomProcessingStatus
+    {
+        OK,
+        SKIP,
+        FAILURE
+    };
+
+    /** Target feature waiting for its geometries to be processed and to be
+     * written. */
+    struct PendingFeature
+    {
+        std::unique_ptr<OGRFeature> m_poDstFeature{};
+        GIntBig m_nSrcFID = OGRNullFID;
+        GIntBig m_nDesiredFID = OGRNullFID;
+        bool m_bSetZ = false;
+        double m_dfZ = 0;
+        GeomProcessingStatus m_eStatus = GeomProcessingStatus::OK;
+        std::vector<CPLErrorHandlerAccumulatorStruct> m_aoErrors{};
+    };
+
+    struct GeomProcessingJob
+    {
+        LayerTranslator *m_poThis = nullptr;
+        GeomProcessingContextPool *m_poContextPool = nullptr;
+        PendingFeature *m_pasPendingFeatures = nullptr;
+        size_t m_nCount = 0;
+        const OGRSpatialReference *m_poOutputSRS = nullptr;
+        bool m_bRunSetPrecision = false;
+        const GDALVectorTranslateOptions *m_psOptions = nullptr;
+    };
+
+    GeomProcessingContext m_oGeomProcessingContext{};
+
+    GeomProcessingStatus
+    ProcessGeometries(GeomProcessingContext &oContext,
+                      TargetLayerInfo *psInfo, PendingFeature &oPending,
+                      const OGRSpatialReference *poOutputSRS,
+                      bool bRunSetPrecision,
+                      const GDALVectorTranslateOptions *psOptions);
+    static void ProcessGeometriesJob(void *pData);
+    bool WriteFeature(PendingFeature &oPending, TargetLayerInfo *psInfo,
+                      int &nFeaturesInTransaction, GIntBig &nTotalEventsDone,
+                      GIntBig &nFeaturesWritten,
+                      const GDALVectorTranslateOptions *psOptions);
+
+    const OGRGeometry *GetDstClipGeom(GeomProcessingContext &oContext,
+                                      const OGRSpatialReference *poGeomSRS);
+    const OGRGeometry *GetSrcClipGeom(GeomProcessingContext &oContext,
+                                      const OGRSpatialReference *poGeomSRS);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -2823,6 +2901,7 @@ GDALDatasetH GDALVectorTranslate(const char *pszDest, GDALDatasetH hDstDS,
     oTranslator.m_bExplodeCollections = psOptions->bExplodeCollections;
     oTranslator.m_bNativeData = psOptions->bNativeData;
     oTranslator.m_nLimit = psOptions->nLimit;
+    oTranslator.m_nNumThreads = psOptions->nNumThreads;
 
     if (psOptions->nGroupTransactions)
     {
@@ -5766,7 +5845,6 @@ bool LayerTranslator::Translate(
                               pfnProgress, pProgressArg, psOptions);
     }
 
-    const int eGType = m_eGType;
     const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
 
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
@@ -5816,8 +5894,15 @@ bool LayerTranslator::Translate(
     int nFeaturesInTransaction = 0;
     GIntBig nCount = 0; /* written + failed */
     GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
+    // OGR_APPLY_GEOM_SET_PRECISION default value for
+    // OGRLayer::CreateFeature() purposes, but here in the
+    // ogr2ogr -xyRes context, we force calling SetPrecision(),
+    // unless the user explicitly asks not to do it by
+    // setting the config option to NO.
+    const bool bRunSetPrecision =
+        psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "YES"));
 
     bool bRet = true;
     CPLErrorReset();
@@ -5831,6 +5916,68 @@ bool LayerTranslator::Translate(
                              poOutputSRS, m_poGCPCoordTrans, false);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      In multi-threaded mode, the geometries of batches of features   */
+    /*      are processed by worker threads, while the next batch is read.  */
+    /*      Reading and writing remain done by the calling thread, and      */
+    /*      features are written in the order they have been read.         */
+    /* -------------------------------------------------------------------- */
+    GDALThreadReservation oThreadReservation(
+        poFeatureIn == nullptr && psOptions->nFIDToFetch == OGRNullFID &&
+                !psInfo->m_bPerFeatureCT && nDstGeomFieldCount > 0
+            ? m_nNumThreads
+            : 1);
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    constexpr size_t FEATURES_PER_JOB = 16;
+    const size_t nBatchSize =
+        static_cast<size_t>(oThreadReservation.GetThreadCount()) * 256;
+    GeomProcessingContextPool oContextPool;
+    std::vector<PendingFeature> aoPendingFeatures;
+    std::vector<PendingFeature> aoProcessedFeatures;
+    std::vector<GeomProcessingJob> asJobs;
+    // Must be declared after the above objects, so that its destructor,
+    // that waits for the completion of jobs, is called first.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+
+    // Wait for the processing of the in-flight batch, write its features,
+    // and submit the processing of the pending batch.
+    const auto ProcessBatch = [&]()
+    {
+        poJobQueue->WaitCompletion();
+        for (auto &oPending : aoProcessedFeatures)
+        {
+            if (!WriteFeature(oPending, psInfo, nFeaturesInTransaction,
+                              nTotalEventsDone, nFeaturesWritten, psOptions))
+            {
+                return false;
+            }
+        }
+        aoProcessedFeatures.clear();
+
+        std::swap(aoPendingFeatures, aoProcessedFeatures);
+        asJobs.clear();
+        for (size_t i = 0; i < aoProcessedFeatures.size();
+             i += FEATURES_PER_JOB)
+        {
+            GeomProcessingJob sJob;
+            sJob.m_poThis = this;
+            sJob.m_poContextPool = &oContextPool;
+            sJob.m_pasPendingFeatures = aoProcessedFeatures.data() + i;
+            sJob.m_nCount = std::min(FEATURES_PER_JOB,
+                                     aoProcessedFeatures.size() - i);
+            sJob.m_poOutputSRS = poOutputSRS;
+            sJob.m_bRunSetPrecision = bRunSetPrecision;
+            sJob.m_psOptions = psOptions;
+            asJobs.push_back(sJob);
+        }
+        for (auto &sJob : asJobs)
+            poJobQueue->SubmitJob(ProcessGeometriesJob, &sJob);
+        return true;
+    };
+
     while (true)
     {
         if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
@@ -5865,6 +6012,23 @@ bool LayerTranslator::Translate(
             }
         }
 
+        if (poThreadPool && !poJobQueue && psInfo->m_nFeaturesRead == 0)
+        {
+            // Check that the coordinate transformations can be cloned
+            oContextPool.m_psInfo = psInfo;
+            auto poContext = oContextPool.Acquire();
+            if (poContext)
+            {
+                oContextPool.Release(std::move(poContext));
+                poJobQueue = poThreadPool->CreateJobQueue();
+                CPLDebug("GDALVectorTranslate",
+                         "Processing geometries of layer %s with up to %d "
+                         "threads",
+                         poSrcLayer->GetName(),
+                         oThreadReservation.GetThreadCount());
+            }
+        }
+
         psInfo->m_nFeaturesRead++;
 
         int nIters = 1;
@@ -5908,29 +6072,6 @@ bool LayerTranslator::Translate(
 
         for (int iPart = 0; iPart < nIters; iPart++)
         {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
-            {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nFeaturesInTransaction = 0;
-            }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions > 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
-            {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nTotalEventsDone = 0;
-            }
-
             CPLErrorReset();
             if (psInfo->m_bCanAvoidSetFrom)
             {
@@ -5962,7 +6103,8 @@ bool LayerTranslator::Translate(
                     m_poClipSrcOri)
                 {
                     const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poStolenGeometry->getSpatialReference());
+                        GetSrcClipGeom(m_oGeomProcessingContext,
+                                       poStolenGeometry->getSpatialReference());
 
                     if (poClipGeom != nullptr &&
                         !poClipGeom->Intersects(poStolenGeometry.get()))
@@ -5971,6 +6113,8 @@ bool LayerTranslator::Translate(
                     }
                 }
 
+                if (!poDstFeature)
+                    poDstFeature = std::make_unique<OGRFeature>(poDstFDefn);
                 poDstFeature->Reset();
                 if (poDstFeature->SetFrom(poFeature.get(), panMap, TRUE) !=
                     OGRERR_NONE)
@@ -6094,468 +6238,624 @@ bool LayerTranslator::Translate(
                 poDstFeature->SetNativeMediaType(nullptr);
             }
 
-            for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
             {
-                std::unique_ptr<OGRGeometry> poDstGeometry;
-
-                if (poCollToExplode && iGeom == iGeomCollToExplode)
+                PendingFeature oPending;
+                oPending.m_nSrcFID = nSrcFID;
+                oPending.m_nDesiredFID = nDesiredFID;
+                if (poCollToExplode && iGeomCollToExplode < nDstGeomFieldCount)
                 {
                     OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
                     poCollToExplode->removeGeometry(0, FALSE);
-                    poDstGeometry.reset(poPart);
-                }
-                else
-                {
-                    poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
+                    poDstFeature->SetGeomFieldDirectly(iGeomCollToExplode,
+                                                       poPart);
                 }
-                if (poDstGeometry == nullptr)
-                    continue;
 
                 // poFeature hasn't been moved if iSrcZField != -1
                 // cppcheck-suppress accessMoved
                 if (iSrcZField != -1 && poFeature != nullptr)
                 {
-                    SetZ(poDstGeometry.get(),
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    poDstGeometry.reset(poDstGeometry->clone());
-                }
-
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
-                {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
-                {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
-                {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+                    oPending.m_bSetZ = true;
+                    oPending.m_dfZ = poFeature->GetFieldAsDouble(iSrcZField);
                 }
+                oPending.m_poDstFeature = std::move(poDstFeature);
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+                if (poJobQueue)
                 {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
+                    aoPendingFeatures.push_back(std::move(oPending));
+                    if (aoPendingFeatures.size() == nBatchSize &&
+                        !ProcessBatch())
+                    {
+                        return false;
+                    }
                 }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+                else
                 {
-                    if (m_dfGeomOpParam > 0)
+                    oPending.m_eStatus = ProcessGeometries(
+                        m_oGeomProcessingContext, psInfo, oPending,
+                        poOutputSRS, bRunSetPrecision, psOptions);
+                    if (!WriteFeature(oPending, psInfo, nFeaturesInTransaction,
+                                      nTotalEventsDone, nFeaturesWritten,
+                                      psOptions))
                     {
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam));
-                        if (poNewGeom)
-                        {
-                            poDstGeometry = std::move(poNewGeom);
-                        }
+                        return false;
                     }
+                    // Reuse the feature object for the next one
+                    poDstFeature = std::move(oPending.m_poDstFeature);
                 }
+            }
 
-                if (m_poClipSrcOri)
-                {
+        end_loop:;  // nothing
+        }
 
-                    const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poDstGeometry->getSpatialReference());
+        /* Report progress */
+        nCount++;
+        bool bGoOn = true;
+        if (pfnProgress)
+        {
+            bGoOn = pfnProgress(nCountLayerFeatures
+                                    ? nCount * 1.0 / nCountLayerFeatures
+                                    : 1.0,
+                                "", pProgressArg) != FALSE;
+        }
+        if (!bGoOn)
+        {
+            bRet = false;
+            break;
+        }
 
-                    std::unique_ptr<OGRGeometry> poClipped;
-                    if (poClipGeom != nullptr)
-                    {
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
+        if (pnReadFeatureCount)
+            *pnReadFeatureCount = nCount;
 
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
+        if (psOptions->nFIDToFetch != OGRNullFID)
+            break;
+        if (poFeatureIn != nullptr)
+            break;
+    }
 
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
-                    }
+    // Write the features still being processed, and then the last batch
+    if (poJobQueue && (!ProcessBatch() || !ProcessBatch()))
+        return false;
 
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        goto end_loop;
-                    }
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                bRet = false;
+        }
+    }
 
-                    const int nDim = poDstGeometry->getDimension();
-                    if (poClipped->getDimension() < nDim &&
-                        wkbFlatten(
-                            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
-                            wkbUnknown)
-                    {
-                        CPLDebug(
-                            "OGR2OGR",
-                            "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                            "as its intersection with -clipsrc is a %s "
-                            "whereas the input is a %s",
-                            nSrcFID, poSrcLayer->GetName(),
-                            OGRToOGCGeomType(poClipped->getGeometryType()),
-                            OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                        goto end_loop;
-                    }
+    if (poFeatureIn == nullptr)
+    {
+        CPLDebug("GDALVectorTranslate",
+                 CPL_FRMT_GIB " features written in layer '%s'",
+                 nFeaturesWritten, poDstLayer->GetName());
+    }
 
-                    poDstGeometry = std::move(poClipped);
-                }
-
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
-                char **const papszTransformOptions =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_aosTransformOptions.List();
-                const bool bReprojCanInvalidateValidity =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_bCanInvalidateValidity;
-
-                if (poCT != nullptr || papszTransformOptions != nullptr)
-                {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
-                    {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                poDstGeometry.release(), eTargetType));
-                        }
-                    }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
-                    {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
-                    }
+    return bRet;
+}
 
-                    for (int iIter = 0; iIter < 2; ++iIter)
-                    {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
-                        {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
+/************************************************************************/
+/*                   LayerTranslator::WriteFeature()                    */
+/************************************************************************/
 
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
-                        }
+/** Write a target feature whose geometries have been processed, managing
+ * transaction grouping. Returns false if the translation must be stopped.
+ */
+bool LayerTranslator::WriteFeature(PendingFeature &oPending,
+                                   TargetLayerInfo *psInfo,
+                                   int &nFeaturesInTransaction,
+                                   GIntBig &nTotalEventsDone,
+                                   GIntBig &nFeaturesWritten,
+                                   const GDALVectorTranslateOptions *psOptions)
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    OGRFeature *poDstFeature = oPending.m_poDstFeature.get();
+    const GIntBig nSrcFID = oPending.m_nSrcFID;
+    const GIntBig nDesiredFID = oPending.m_nDesiredFID;
 
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
+    // Emit errors collected by worker threads
+    for (const auto &oError : oPending.m_aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    oPending.m_aoErrors.clear();
 
-                        const auto IsValid = [](const OGRGeometry *poGeom)
-                        {
-                            CPLErrorHandlerPusher oErrorHandler(
-                                CPLQuietErrorHandler);
-                            return poGeom->IsValid();
-                        };
-
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            IsValid(poDstGeometry.get()))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp =
-                                std::unique_ptr<OGRGeometry>(
-                                    OGRGeometryFactory::forceTo(
-                                        poReprojectedGeom->clone(),
-                                        eTargetType));
-                            if (!IsValid(poDstGeometryTmp.get()))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid after "
-                                         "reprojection: transforming it into "
-                                         "linear one before reprojecting");
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eTargetType));
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eType));
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
-                        }
-                    }
-                }
-                else if (poOutputSRS != nullptr)
+    if (oPending.m_eStatus == GeomProcessingStatus::FAILURE)
+    {
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+                poDstLayer->CommitTransaction();
+        }
+        return false;
+    }
+    if (oPending.m_eStatus == GeomProcessingStatus::SKIP)
+        return true;
+
+    if (psOptions->nLayerTransaction &&
+        ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+    {
+        if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+            poDstLayer->StartTransaction() == OGRERR_FAILURE)
+        {
+            return false;
+        }
+        nFeaturesInTransaction = 0;
+    }
+    else if (!psOptions->nLayerTransaction &&
+             psOptions->nGroupTransactions > 0 &&
+             ++nTotalEventsDone >= psOptions->nGroupTransactions)
+    {
+        if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+            m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                OGRERR_FAILURE)
+        {
+            return false;
+        }
+        nTotalEventsDone = 0;
+    }
+
+    CPLErrorReset();
+    if ((psOptions->bUpsert ? poDstLayer->UpsertFeature(poDstFeature)
+                            : poDstLayer->CreateFeature(poDstFeature)) ==
+        OGRERR_NONE)
+    {
+        nFeaturesWritten++;
+        if (nDesiredFID != OGRNullFID && poDstFeature->GetFID() != nDesiredFID)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Feature id " CPL_FRMT_GIB " not preserved", nDesiredFID);
+        }
+    }
+    else if (!psOptions->bSkipFailures)
+    {
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+                poDstLayer->RollbackTransaction();
+        }
+
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unable to write feature " CPL_FRMT_GIB " from layer %s.",
+                 nSrcFID, poSrcLayer->GetName());
+
+        return false;
+    }
+    else
+    {
+        CPLDebug("GDALVectorTranslate",
+                 "Unable to write feature " CPL_FRMT_GIB " into layer %s.",
+                 nSrcFID, poSrcLayer->GetName());
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                poDstLayer->RollbackTransaction();
+                CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+            }
+            else
+            {
+                m_poODS->RollbackTransaction();
+                m_poODS->StartTransaction(psOptions->bForceTransaction);
+            }
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                 LayerTranslator::ProcessGeometries()                 */
+/************************************************************************/
+
+/** Apply the geometry operations (reprojection, clipping, simplification,
+ * type conversion, etc.) to the geometries of a target feature.
+ *
+ * This may be called from worker threads, in which case oContext is owned
+ * by the calling thread, and errors are collected by the caller.
+ */
+LayerTranslator::GeomProcessingStatus LayerTranslator::ProcessGeometries(
+    GeomProcessingContext &oContext, TargetLayerInfo *psInfo,
+    PendingFeature &oPending, const OGRSpatialReference *poOutputSRS,
+    bool bRunSetPrecision, const GDALVectorTranslateOptions *psOptions)
+{
+    const int eGType = m_eGType;
+    OGRFeature *poDstFeature = oPending.m_poDstFeature.get();
+    const OGRFeatureDefn *poDstFDefn = poDstFeature->GetDefnRef();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    const GIntBig nSrcFID = oPending.m_nSrcFID;
+
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+    {
+        std::unique_ptr<OGRGeometry> poDstGeometry(
+            poDstFeature->StealGeometry(iGeom));
+        if (poDstGeometry == nullptr)
+            continue;
+
+        if (oPending.m_bSetZ)
+        {
+            SetZ(poDstGeometry.get(), oPending.m_dfZ);
+            /* This will correct the coordinate dimension to 3 */
+            poDstGeometry.reset(poDstGeometry->clone());
+        }
+
+        if (m_nCoordDim == 2 || m_nCoordDim == 3)
+        {
+            poDstGeometry->setCoordinateDimension(m_nCoordDim);
+        }
+        else if (m_nCoordDim == 4)
+        {
+            poDstGeometry->set3D(TRUE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_XYM)
+        {
+            poDstGeometry->set3D(FALSE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+        {
+            const OGRwkbGeometryType eDstLayerGeomType =
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+            poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+            poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+        }
+
+        if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+        {
+            if (m_dfGeomOpParam > 0)
+                poDstGeometry->segmentize(m_dfGeomOpParam);
+        }
+        else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        {
+            if (m_dfGeomOpParam > 0)
+            {
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam));
+                if (poNewGeom)
                 {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
+                    poDstGeometry = std::move(poNewGeom);
                 }
+            }
+        }
 
-                if (poDstGeometry != nullptr)
-                {
-                    if (m_poClipDstOri)
-                    {
-                        const OGRGeometry *poClipGeom = GetDstClipGeom(
-                            poDstGeometry->getSpatialReference());
-                        if (poClipGeom == nullptr)
-                        {
-                            goto end_loop;
-                        }
+        if (m_poClipSrcOri)
+        {
 
-                        std::unique_ptr<OGRGeometry> poClipped;
+            const OGRGeometry *poClipGeom = GetSrcClipGeom(
+                oContext, poDstGeometry->getSpatialReference());
 
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
+            std::unique_ptr<OGRGeometry> poClipped;
+            if (poClipGeom != nullptr)
+            {
+                OGREnvelope oClipEnv;
+                OGREnvelope oDstEnv;
 
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
+                poClipGeom->getEnvelope(&oClipEnv);
+                poDstGeometry->getEnvelope(&oDstEnv);
 
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
+                if (oClipEnv.Intersects(oDstEnv))
+                {
+                    poClipped.reset(
+                        poClipGeom->Intersection(poDstGeometry.get()));
+                }
+            }
 
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            goto end_loop;
-                        }
+            if (poClipped == nullptr || poClipped->IsEmpty())
+            {
+                return GeomProcessingStatus::SKIP;
+            }
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipdst is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            goto end_loop;
-                        }
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                    wkbUnknown)
+            {
+                CPLDebug(
+                    "OGR2OGR",
+                    "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                    "as its intersection with -clipsrc is a %s "
+                    "whereas the input is a %s",
+                    nSrcFID, psInfo->m_poSrcLayer->GetName(),
+                    OGRToOGCGeomType(poClipped->getGeometryType()),
+                    OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                return GeomProcessingStatus::SKIP;
+            }
 
-                        poDstGeometry = std::move(poClipped);
-                    }
+            poDstGeometry = std::move(poClipped);
+        }
 
-                    if (psOptions->dfXYRes !=
-                            OGRGeomCoordinatePrecision::UNKNOWN &&
-                        OGRGeometryFactory::haveGEOS() &&
-                        !poDstGeometry->hasCurveGeometry())
-                    {
-                        // OGR_APPLY_GEOM_SET_PRECISION default value for
-                        // OGRLayer::CreateFeature() purposes, but here in the
-                        // ogr2ogr -xyRes context, we force calling SetPrecision(),
-                        // unless the user explicitly asks not to do it by
-                        // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
-                        if (bRunSetPrecision)
-                        {
-                            auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                                poDstGeometry->SetPrecision(psOptions->dfXYRes,
-                                                            /* nFlags = */ 0));
-                            if (!poNewGeom)
-                                goto end_loop;
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
+        OGRCoordinateTransformation *const poCT =
+            oContext.m_apoCT.empty()
+                ? psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get()
+                : oContext.m_apoCT[iGeom].get();
+        char **const papszTransformOptions =
+            psInfo->m_aoReprojectionInfo[iGeom].m_aosTransformOptions.List();
+        const bool bReprojCanInvalidateValidity =
+            psInfo->m_aoReprojectionInfo[iGeom].m_bCanInvalidateValidity;
 
-                    if (m_bMakeValid)
+        if (poCT != nullptr || papszTransformOptions != nullptr)
+        {
+            // If we need to change the geometry type to linear, and
+            // we have a geometry with curves, then convert it to
+            // linear first, to avoid invalidities due to the fact
+            // that validity of arc portions isn't always kept while
+            // reprojecting and then discretizing.
+            if (bReprojCanInvalidateValidity &&
+                (!psInfo->m_bSupportCurves ||
+                 m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+                 m_eGeomTypeConversion ==
+                     GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
+            {
+                if (poDstGeometry->hasCurveGeometry(TRUE))
+                {
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eTargetType));
+                }
+            }
+            else if (bReprojCanInvalidateValidity &&
+                     eGType != GEOMTYPE_UNCHANGED &&
+                     !OGR_GT_IsNonLinear(
+                         static_cast<OGRwkbGeometryType>(eGType)) &&
+                     poDstGeometry->hasCurveGeometry(TRUE))
+            {
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(),
+                    static_cast<OGRwkbGeometryType>(eGType)));
+            }
+
+            for (int iIter = 0; iIter < 2; ++iIter)
+            {
+                auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                    OGRGeometryFactory::transformWithOptions(
+                        poDstGeometry.get(), poCT, papszTransformOptions,
+                        oContext.m_transformWithOptionsCache));
+                if (poReprojectedGeom == nullptr)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to reproject feature " CPL_FRMT_GIB
+                             " (geometry probably out of source or "
+                             "destination SRS).",
+                             nSrcFID);
+                    if (!psOptions->bSkipFailures)
                     {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->MakeValid());
-                        if (!poNewGeom)
-                            goto end_loop;
-                        poDstGeometry = std::move(poNewGeom);
-                        if (!bIsGeomCollection)
-                        {
-                            poDstGeometry.reset(
-                                OGRGeometryFactory::
-                                    removeLowerDimensionSubGeoms(
-                                        poDstGeometry.get()));
-                        }
+                        return GeomProcessingStatus::FAILURE;
                     }
+                }
 
-                    if (m_eGeomTypeConversion != GTC_DEFAULT)
+                // Check if a curve geometry is no longer valid after
+                // reprojection
+                const auto eType = poDstGeometry->getGeometryType();
+                const auto eFlatType = wkbFlatten(eType);
+
+                const auto IsValid = [](const OGRGeometry *poGeom)
+                {
+                    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                    return poGeom->IsValid();
+                };
+
+                if (iIter == 0 && bReprojCanInvalidateValidity &&
+                    OGRGeometryFactory::haveGEOS() &&
+                    (eFlatType == wkbCurvePolygon ||
+                     eFlatType == wkbCompoundCurve ||
+                     eFlatType == wkbMultiCurve ||
+                     eFlatType == wkbMultiSurface) &&
+                    poDstGeometry->hasCurveGeometry(TRUE) &&
+                    IsValid(poDstGeometry.get()))
+                {
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    auto poDstGeometryTmp = std::unique_ptr<OGRGeometry>(
+                        OGRGeometryFactory::forceTo(poReprojectedGeom->clone(),
+                                                    eTargetType));
+                    if (!IsValid(poDstGeometryTmp.get()))
                     {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
+                        CPLDebug("OGR2OGR",
+                                 "Curve geometry no longer valid after "
+                                 "reprojection: transforming it into "
+                                 "linear one before reprojecting");
                         poDstGeometry.reset(OGRGeometryFactory::forceTo(
                             poDstGeometry.release(), eTargetType));
+                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                            poDstGeometry.release(), eType));
                     }
-                    else if (eGType != GEOMTYPE_UNCHANGED)
+                    else
                     {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
+                        poDstGeometry = std::move(poReprojectedGeom);
+                        break;
                     }
                 }
-
-                poDstFeature->SetGeomFieldDirectly(iGeom,
-                                                   poDstGeometry.release());
+                else
+                {
+                    poDstGeometry = std::move(poReprojectedGeom);
+                    break;
+                }
             }
+        }
+        else if (poOutputSRS != nullptr)
+        {
+            poDstGeometry->assignSpatialReference(poOutputSRS);
+        }
 
-            CPLErrorReset();
-            if ((psOptions->bUpsert
-                     ? poDstLayer->UpsertFeature(poDstFeature.get())
-                     : poDstLayer->CreateFeature(poDstFeature.get())) ==
-                OGRERR_NONE)
+        if (poDstGeometry != nullptr)
+        {
+            if (m_poClipDstOri)
             {
-                nFeaturesWritten++;
-                if (nDesiredFID != OGRNullFID &&
-                    poDstFeature->GetFID() != nDesiredFID)
+                const OGRGeometry *poClipGeom = GetDstClipGeom(
+                    oContext, poDstGeometry->getSpatialReference());
+                if (poClipGeom == nullptr)
                 {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Feature id " CPL_FRMT_GIB " not preserved",
-                             nDesiredFID);
+                    return GeomProcessingStatus::SKIP;
                 }
-            }
-            else if (!psOptions->bSkipFailures)
-            {
-                if (psOptions->nGroupTransactions)
+
+                std::unique_ptr<OGRGeometry> poClipped;
+
+                OGREnvelope oClipEnv;
+                OGREnvelope oDstEnv;
+
+                poClipGeom->getEnvelope(&oClipEnv);
+                poDstGeometry->getEnvelope(&oDstEnv);
+
+                if (oClipEnv.Intersects(oDstEnv))
                 {
-                    if (psOptions->nLayerTransaction)
-                        poDstLayer->RollbackTransaction();
+                    poClipped.reset(
+                        poClipGeom->Intersection(poDstGeometry.get()));
                 }
 
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " from layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
+                if (poClipped == nullptr || poClipped->IsEmpty())
+                {
+                    return GeomProcessingStatus::SKIP;
+                }
 
-                return false;
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(
+                        poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                        wkbUnknown)
+                {
+                    CPLDebug(
+                        "OGR2OGR",
+                        "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                        "as its intersection with -clipdst is a %s "
+                        "whereas the input is a %s",
+                        nSrcFID, psInfo->m_poSrcLayer->GetName(),
+                        OGRToOGCGeomType(poClipped->getGeometryType()),
+                        OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                    return GeomProcessingStatus::SKIP;
+                }
+
+                poDstGeometry = std::move(poClipped);
             }
-            else
+
+            if (bRunSetPrecision &&
+                psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+                OGRGeometryFactory::haveGEOS() &&
+                !poDstGeometry->hasCurveGeometry())
             {
-                CPLDebug("GDALVectorTranslate",
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " into layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
-                if (psOptions->nGroupTransactions)
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poDstGeometry->SetPrecision(psOptions->dfXYRes,
+                                                /* nFlags = */ 0));
+                if (!poNewGeom)
+                    return GeomProcessingStatus::SKIP;
+                poDstGeometry = std::move(poNewGeom);
+            }
+
+            if (m_bMakeValid)
+            {
+                const bool bIsGeomCollection =
+                    wkbFlatten(poDstGeometry->getGeometryType()) ==
+                    wkbGeometryCollection;
+                auto poNewGeom =
+                    std::unique_ptr<OGRGeometry>(poDstGeometry->MakeValid());
+                if (!poNewGeom)
+                    return GeomProcessingStatus::SKIP;
+                poDstGeometry = std::move(poNewGeom);
+                if (!bIsGeomCollection)
                 {
-                    if (psOptions->nLayerTransaction)
-                    {
-                        poDstLayer->RollbackTransaction();
-                        CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
-                    }
-                    else
-                    {
-                        m_poODS->RollbackTransaction();
-                        m_poODS->StartTransaction(psOptions->bForceTransaction);
-                    }
+                    poDstGeometry.reset(
+                        OGRGeometryFactory::removeLowerDimensionSubGeoms(
+                            poDstGeometry.get()));
                 }
             }
 
-        end_loop:;  // nothing
+            if (m_eGeomTypeConversion != GTC_DEFAULT)
+            {
+                OGRwkbGeometryType eTargetType =
+                    poDstGeometry->getGeometryType();
+                eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(), eTargetType));
+            }
+            else if (eGType != GEOMTYPE_UNCHANGED)
+            {
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(),
+                    static_cast<OGRwkbGeometryType>(eGType)));
+            }
         }
 
-        /* Report progress */
-        nCount++;
-        bool bGoOn = true;
-        if (pfnProgress)
+        poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry.release());
+    }
+
+    return GeomProcessingStatus::OK;
+}
+
+/************************************************************************/
+/*               LayerTranslator::ProcessGeometriesJob()                */
+/************************************************************************/
+
+void LayerTranslator::ProcessGeometriesJob(void *pData)
+{
+    GeomProcessingJob *psJob = static_cast<GeomProcessingJob *>(pData);
+    auto poContext = psJob->m_poContextPool->Acquire();
+    for (size_t i = 0; i < psJob->m_nCount; ++i)
+    {
+        PendingFeature &oPending = psJob->m_pasPendingFeatures[i];
+        CPLInstallErrorHandlerAccumulator(oPending.m_aoErrors);
+        if (poContext)
         {
-            bGoOn = pfnProgress(nCountLayerFeatures
-                                    ? nCount * 1.0 / nCountLayerFeatures
-                                    : 1.0,
-                                "", pProgressArg) != FALSE;
+            oPending.m_eStatus = psJob->m_poThis->ProcessGeometries(
+                *poContext, psJob->m_poContextPool->m_psInfo, oPending,
+                psJob->m_poOutputSRS, psJob->m_bRunSetPrecision,
+                psJob->m_psOptions);
         }
-        if (!bGoOn)
+        else
         {
-            bRet = false;
-            break;
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot clone coordinate transformation");
+            oPending.m_eStatus = GeomProcessingStatus::FAILURE;
         }
+        CPLUninstallErrorHandlerAccumulator();
+    }
+    if (poContext)
+        psJob->m_poContextPool->Release(std::move(poContext));
+}
 
-        if (pnReadFeatureCount)
-            *pnReadFeatureCount = nCount;
+/************************************************************************/
+/*          LayerTranslator::GeomProcessingContextPool::Acquire()       */
+/************************************************************************/
 
-        if (psOptions->nFIDToFetch != OGRNullFID)
-            break;
-        if (poFeatureIn != nullptr)
-            break;
+/** Return a processing context for the exclusive use of the calling thread,
+ * with its own clones of the coordinate transformations, or nullptr if they
+ * cannot be cloned.
+ */
+std::unique_ptr<LayerTranslator::GeomProcessingContext>
+LayerTranslator::GeomProcessingContextPool::Acquire()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (!m_apoFreeContexts.empty())
+    {
+        auto poContext = std::move(m_apoFreeContexts.back());
+        m_apoFreeContexts.pop_back();
+        return poContext;
     }
 
-    if (psOptions->nGroupTransactions)
+    auto poContext = std::make_unique<GeomProcessingContext>();
+    for (const auto &oReprojectionInfo : m_psInfo->m_aoReprojectionInfo)
     {
-        if (psOptions->nLayerTransaction)
+        std::unique_ptr<OGRCoordinateTransformation> poCT;
+        if (oReprojectionInfo.m_poCT)
         {
-            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                bRet = false;
+            poCT.reset(oReprojectionInfo.m_poCT->Clone());
+            if (!poCT)
+                return nullptr;
         }
+        poContext->m_apoCT.push_back(std::move(poCT));
     }
+    return poContext;
+}
 
-    if (poFeatureIn == nullptr)
-    {
-        CPLDebug("GDALVectorTranslate",
-                 CPL_FRMT_GIB " features written in layer '%s'",
-                 nFeaturesWritten, poDstLayer->GetName());
-    }
+/************************************************************************/
+/*          LayerTranslator::GeomProcessingContextPool::Release()       */
+/************************************************************************/
 
-    return bRet;
+void LayerTranslator::GeomProcessingContextPool::Release(
+    std::unique_ptr<GeomProcessingContext> &&poContext)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_apoFreeContexts.push_back(std::move(poContext));
 }
 
 /************************************************************************/
@@ -6563,27 +6863,28 @@ bool LayerTranslator::Translate(
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetDstClipGeom(GeomProcessingContext &oContext,
+                                const OGRSpatialReference *poGeomSRS)
 {
-    if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
+    if (oContext.m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
     {
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
         if (poClipDstSRS && poGeomSRS && !poClipDstSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipDstReprojectedToDstSRS.reset(m_poClipDstOri->clone());
-            if (m_poClipDstReprojectedToDstSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oContext.m_poClipDstReprojectedToDstSRS.reset(
+                m_poClipDstOri->clone());
+            if (oContext.m_poClipDstReprojectedToDstSRS->transformTo(
+                    poGeomSRS) != OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
+            oContext.m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
         }
         else if (!poClipDstSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipDstSRS)
+            if (!m_bWarnedClipDstSRS.exchange(true))
             {
-                m_bWarnedClipDstSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip destination geometry has no "
                          "attached SRS, but the feature's "
@@ -6594,8 +6895,9 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipDstReprojectedToDstSRS ? m_poClipDstReprojectedToDstSRS.get()
-                                          : m_poClipDstOri;
+    return oContext.m_poClipDstReprojectedToDstSRS
+               ? oContext.m_poClipDstReprojectedToDstSRS.get()
+               : m_poClipDstOri;
 }
 
 /************************************************************************/
@@ -6603,27 +6905,28 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetSrcClipGeom(GeomProcessingContext &oContext,
+                                const OGRSpatialReference *poGeomSRS)
 {
-    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+    if (oContext.m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
     {
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
         if (poClipSrcSRS && poGeomSRS && !poClipSrcSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipSrcReprojectedToSrcSRS.reset(m_poClipSrcOri->clone());
-            if (m_poClipSrcReprojectedToSrcSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oContext.m_poClipSrcReprojectedToSrcSRS.reset(
+                m_poClipSrcOri->clone());
+            if (oContext.m_poClipSrcReprojectedToSrcSRS->transformTo(
+                    poGeomSRS) != OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
+            oContext.m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
         }
         else if (!poClipSrcSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipSrcSRS)
+            if (!m_bWarnedClipSrcSRS.exchange(true))
             {
-                m_bWarnedClipSrcSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip source geometry has no attached SRS, "
                          "but the feature's geometry has one. "
@@ -6633,8 +6936,9 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipSrcReprojectedToSrcSRS ? m_poClipSrcReprojectedToSrcSRS.get()
-                                          : m_poClipSrcOri;
+    return oContext.m_poClipSrcReprojectedToSrcSRS
+               ? oContext.m_poClipSrcReprojectedToSrcSRS.get()
+               : m_poClipSrcOri;
 }
 
 /************************************************************************/
@@ -7447,6 +7751,21 @@ static std::unique_ptr<GDALArgumentParser> GDALVectorTranslateOptionsGetParser(
         .store_into(psOptions->nLimit)
         .help(_("Limit the number of features per layer."));
 
+    argParser->add_argument("-j")
+        .metavar("<num_threads>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                psOptions->nNumThreads = EQUAL(s.c_str(), "ALL_CPUS")
+                                             ? CPLGetNumCPUs()
+                                             : atoi(s.c_str());
+                if (psOptions->nNumThreads <= 0)
+                {
+                    throw std::invalid_argument("Invalid value for -j: " + s);
+                }
+            })
+        .help(_("Number of threads used to process geometries."));
+
     argParser->add_argument("-ds_transaction")
         .flag()
         .action(
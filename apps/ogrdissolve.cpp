@@ -34,6 +34,7 @@
 #include "commonutils.h"
 #include <map>
 #include <list>
+#include <vector>
 
 static void Usage();
 
@@ -634,13 +635,46 @@ StringGeometryMap *CollectGeometries(OGRLayer *poSrcLayer,
 
     StringGeometryColMap::const_iterator collections_i;
 
+    // Large collections are unioned one at a time, each of them with a
+    // spatially partitioned parallel union. The other ones are buffered all
+    // at once, in parallel if GDAL_NUM_THREADS is set.
+    const int nLargeCollectionSize = 1000;
+    std::vector<const OGRGeometry *> apoCollections;
     for (collections_i = poCollections.begin();
          collections_i != poCollections.end(); ++collections_i)
     {
         CPLDebug("CollectGeometries", "poCollections Geometry size %d",
                  collections_i->second->getNumGeometries());
-        OGRGeometry *buffer = collections_i->second->Buffer(0);
-        buffers->insert(std::make_pair(collections_i->first, buffer));
+        if (collections_i->second->getNumGeometries() >= nLargeCollectionSize)
+        {
+            std::vector<const OGRGeometry *> apoParts;
+            for (const auto *poPart : *(collections_i->second))
+                apoParts.push_back(poPart);
+            auto poUnion = OGRGeometryFactory::unionGeometries(
+                apoParts.data(), apoParts.size());
+            buffers->insert(
+                std::make_pair(collections_i->first, poUnion.release()));
+        }
+        else
+        {
+            apoCollections.push_back(collections_i->second);
+        }
+    }
+
+    auto apoBuffers = OGRGeometryFactory::processGeometries(
+        OGRGeometryFactory::BatchOperation::BUFFER, apoCollections.data(),
+        apoCollections.size());
+
+    size_t iBuffer = 0;
+    for (collections_i = poCollections.begin();
+         collections_i != poCollections.end(); ++collections_i)
+    {
+        if (collections_i->second->getNumGeometries() < nLargeCollectionSize)
+        {
+            buffers->insert(std::make_pair(collections_i->first,
+                                           apoBuffers[iBuffer].release()));
+            ++iBuffer;
+        }
     }
 
     for (collections_i = poCollections.begin();
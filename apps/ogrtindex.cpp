@@ -65,6 +65,7 @@ static void Usage(bool bIsError)
         "                 [-src_srs_name <field_name>] [-src_srs_format "
         "{AUTO|WKT|EPSG|PROJ}]\n"
         "                 [-accept_different_schemas]\n"
+        "                 [-j <num_threads>|ALL_CPUS]\n"
         "                 <output_dataset> <src_dataset> <src_dataset>...\n");
     fprintf(bIsError ? stderr : stdout, "\n");
     fprintf(bIsError ? stderr : stdout,
@@ -75,6 +76,8 @@ static void Usage(bool bIsError)
             "               in the tile index.\n");
     fprintf(bIsError ? stderr : stdout,
             "  -f output_format: Select an output format name.\n");
+    fprintf(bIsError ? stderr : stdout,
+            "  -j num_threads: Number of threads used to open source files.\n");
     fprintf(bIsError ? stderr : stdout,
             "  -tileindex field_name: The name to use for the dataset name.\n"
             "                         Defaults to LOCATION.\n");
@@ -148,6 +151,7 @@ MAIN_START(nArgc, papszArgv)
     bool bSrcSRSFormatSpecified = false;
     SrcSRSFormat eSrcSRSFormat = FORMAT_AUTO;
     size_t nMaxFieldSize = 254;
+    int nNumThreads = 1;
 
     for (int iArg = 1; iArg < nArgc; iArg++)
     {
@@ -180,6 +184,18 @@ MAIN_START(nArgc, papszArgv)
         {
             accept_different_schemas = true;
         }
+        else if (iArg < nArgc - 1 && EQUAL(papszArgv[iArg], "-j"))
+        {
+            const char *pszNumThreads = papszArgv[++iArg];
+            nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads);
+            if (nNumThreads <= 0)
+            {
+                fprintf(stderr, "Invalid value for -j: %s\n", pszNumThreads);
+                Usage(true);
+            }
+        }
         else if (iArg < nArgc - 1 && EQUAL(papszArgv[iArg], "-tileindex"))
         {
             pszTileIndexField = papszArgv[++iArg];
@@ -512,13 +528,31 @@ MAIN_START(nArgc, papszArgv)
     /* ==================================================================== */
     /*      Process each input datasource in turn.                          */
     /* ==================================================================== */
-    for (; nFirstSourceDataset < nArgc; nFirstSourceDataset++)
+    std::vector<int> anSourceArgs;
+    for (int iArg = nFirstSourceDataset; iArg < nArgc; iArg++)
     {
-        if (papszArgv[nFirstSourceDataset][0] == '-')
+        if (papszArgv[iArg][0] == '-')
         {
-            nFirstSourceDataset++;
+            iArg++;
             continue;
         }
+        anSourceArgs.push_back(iArg);
+    }
+
+    // Source datasets are opened ahead on worker threads, and processed in
+    // command line order.
+    GDALDatasetPrefetcher oPrefetcher(nNumThreads, GDAL_OF_VECTOR);
+    size_t iNextToSubmit = 0;
+
+    for (const int iSourceArg : anSourceArgs)
+    {
+        nFirstSourceDataset = iSourceArg;
+        while (iNextToSubmit < anSourceArgs.size() &&
+               oPrefetcher.GetPendingCount() < oPrefetcher.GetMaxPending())
+        {
+            oPrefetcher.Submit(papszArgv[anSourceArgs[iNextToSubmit]]);
+            ++iNextToSubmit;
+        }
 
         char *fileNameToWrite = nullptr;
         VSIStatBuf sStatBuf;
@@ -535,8 +569,7 @@ MAIN_START(nArgc, papszArgv)
             fileNameToWrite = CPLStrdup(papszArgv[nFirstSourceDataset]);
         }
 
-        GDALDataset *poDS = GDALDataset::FromHandle(
-            OGROpen(papszArgv[nFirstSourceDataset], FALSE, nullptr));
+        GDALDataset *poDS = oPrefetcher.Get().release();
 
         if (poDS == nullptr)
         {
@@ -403,3 +403,45 @@ def test_contour_raster_acquisition_error():
         gdal.ContourGenerateEx(
             ds.GetRasterBand(1), ogr_lyr, options=["LEVEL_INTERVAL=1", "ID_FIELD=0"]
         )
+
+
+###############################################################################
+# Check that NUM_THREADS gives the same contours as a single thread
+
+
+@pytest.mark.parametrize("polygonize", [False, True])
+def test_contour_num_threads(polygonize):
+    def generate(num_threads):
+        ogr_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+        ogr_lyr = ogr_ds.CreateLayer(
+            "contour",
+            geom_type=ogr.wkbMultiPolygon if polygonize else ogr.wkbLineString,
+        )
+        ogr_lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        ogr_lyr.CreateField(ogr.FieldDefn("elevMin", ogr.OFTReal))
+        ogr_lyr.CreateField(ogr.FieldDefn("elevMax", ogr.OFTReal))
+
+        ds = gdal.Open("data/contour_in.tif")
+        options = ["LEVEL_INTERVAL=10", "ID_FIELD=0", "NUM_THREADS=%d" % num_threads]
+        if polygonize:
+            options += ["ELEV_FIELD_MIN=1", "ELEV_FIELD_MAX=2", "POLYGONIZE=YES"]
+        else:
+            options += ["ELEV_FIELD=1"]
+        gdal.ContourGenerateEx(ds.GetRasterBand(1), ogr_lyr, options=options)
+
+        res = {}
+        for f in ogr_lyr:
+            g = f.GetGeometryRef()
+            measure = g.Area() if polygonize else g.Length()
+            key = f.GetField("elevMin")
+            count, total = res.get(key, (0, 0))
+            res[key] = (count + 1, total + measure)
+        return res
+
+    ref = generate(1)
+    got = generate(4)
+    assert len(ref) > 1
+    assert got.keys() == ref.keys()
+    for key in ref:
+        assert got[key][0] == ref[key][0], key
+        assert got[key][1] == pytest.approx(ref[key][1], rel=1e-10), key
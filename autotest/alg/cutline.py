@@ -31,6 +31,8 @@
 ###############################################################################
 
 
+import math
+
 import gdaltest
 import pytest
 
@@ -116,3 +118,47 @@ def test_cutline_4():
 
 
 ###############################################################################
+# Test that splitting the warp in many chunks, where the cutline is clipped
+# to each chunk or some chunks are entirely inside/outside the cutline,
+# gives the same result as a single chunk.
+
+
+@pytest.mark.parametrize("all_touched", [False, True])
+def test_cutline_many_chunks(all_touched):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 400, 400)
+    src_ds.SetGeoTransform([0, 1, 0, 400, 0, -1])
+    src_ds.GetRasterBand(1).Fill(255)
+
+    # A complex polygon with a hole, and an island
+    radius = [150 + 20 * math.sin(i * 0.3) for i in range(2000)]
+    angle = [i * 2 * math.pi / 2000 for i in range(2000)]
+    outer = ",".join(
+        "%f %f" % (200 + r * math.cos(a), 200 + r * math.sin(a))
+        for r, a in zip(radius + radius[0:1], angle + angle[0:1])
+    )
+    wkt = (
+        f"MULTIPOLYGON((({outer}),(180 180,180 220,220 220,220 180,180 180)),"
+        "((5 5,5 20,20 20,20 5,5 5)))"
+    )
+    warp_options = ["CUTLINE_ALL_TOUCHED=TRUE"] if all_touched else []
+
+    ref_ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        cutlineWKT=wkt,
+        warpOptions=warp_options,
+    )
+    ref_data = ref_ds.ReadRaster()
+
+    ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        cutlineWKT=wkt,
+        warpOptions=warp_options,
+        warpMemoryLimit=10000,
+    )
+    assert ds.ReadRaster() == ref_data
+    assert ds.GetRasterBand(1).Checksum() != 0
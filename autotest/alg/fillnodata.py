@@ -403,3 +403,38 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that NUM_THREADS gives the same result as the single-threaded path
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+def test_fillnodata_num_threads(interpolation):
+
+    width = 1000
+    height = 50
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    ar = bytearray(width * height)
+    for j in range(height):
+        for i in range(width):
+            if (i * 7 + j * 13) % 11 == 0:
+                ar[j * width + i] = 1 + (i + j) % 250
+    src_ds.WriteRaster(0, 0, width, height, bytes(ar))
+
+    results = []
+    for num_threads in ("1", "4"):
+        ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+        gdal.FillNodata(
+            targetBand=ds.GetRasterBand(1),
+            maxSearchDist=20,
+            maskBand=None,
+            smoothingIterations=2,
+            options=[
+                "INTERPOLATION=" + interpolation,
+                "NUM_THREADS=" + num_threads,
+            ],
+        )
+        results.append(ds.ReadRaster())
+    assert results[0] == results[1]
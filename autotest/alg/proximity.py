@@ -29,6 +29,9 @@
 ###############################################################################
 
 
+import math
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -126,3 +129,49 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test ALGORITHM=EXACT
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_proximity_exact(num_threads):
+
+    width = 37
+    height = 23
+    targets = [(3, 4), (30, 2), (17, 20)]
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    for x, y in targets:
+        src_ds.GetRasterBand(1).WriteRaster(x, y, 1, 1, b"\x01")
+
+    dst_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float32
+    )
+    gdal.ComputeProximity(
+        src_ds.GetRasterBand(1),
+        dst_ds.GetRasterBand(1),
+        options=["ALGORITHM=EXACT", "MAXDIST=15", "NUM_THREADS=" + num_threads],
+    )
+    got = struct.unpack("f" * (width * height), dst_ds.ReadRaster())
+    for y in range(height):
+        for x in range(width):
+            expected = min(math.hypot(x - tx, y - ty) for tx, ty in targets)
+            if expected > 15:
+                expected = 65535
+            assert got[y * width + x] == pytest.approx(expected, rel=1e-6), (
+                x,
+                y,
+            )
+
+
+def test_proximity_invalid_algorithm():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="Unsupported ALGORITHM"):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=["ALGORITHM=INVALID"],
+        )
@@ -1011,3 +1011,65 @@ def test_rasterize_bugfix_gh8918(wkt):
     )
 
     assert target_ds.GetRasterBand(1).Checksum() == 36
+
+
+###############################################################################
+# Test that the multi-threaded tiled mode gives the same result as the
+# default one
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["ALL_TOUCHED=YES"],
+        ["MERGE_ALG=ADD"],
+        ["MERGE_ALG=ADD", "ALL_TOUCHED=YES"],
+        ["ATTRIBUTE=val"],
+        ["CHUNKYSIZE=7"],
+    ],
+)
+def test_rasterize_layer_num_threads(options):
+
+    sr_wkt = 'LOCAL_CS["arbitrary"]'
+    sr = osr.SpatialReference(sr_wkt)
+
+    rast_ogr_ds = ogr.GetDriverByName("Memory").CreateDataSource("wrk")
+    rast_mem_lyr = rast_ogr_ds.CreateLayer("poly", srs=sr)
+    rast_mem_lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+
+    for i, wkt in enumerate(
+        [
+            "POLYGON((1010 1090,1060 1090,1060 1030,1010 1030,1010 1090))",
+            "POLYGON((1020.5 1080.5,1095.5 1070.5,1040.5 1005.5,1020.5 1080.5))",
+            "MULTIPOLYGON(((990 1110,1005 1110,1005 1095,990 1095,990 1110)),"
+            "((1080 1020,1090 1020,1090 1010,1080 1010,1080 1020)))",
+            "LINESTRING(1000 1100,1100 1000,1050 1099.5)",
+            "MULTIPOINT(1050.5 1050.5,1003 1097,1099.9 1000.1)",
+            "POLYGON((1200 1100,1300 1100,1300 1000,1200 1000,1200 1100))",
+        ]
+    ):
+        feat = ogr.Feature(rast_mem_lyr.GetLayerDefn())
+        feat["val"] = i + 1
+        feat.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        rast_mem_lyr.CreateFeature(feat)
+
+    def rasterize(extra_options):
+        target_ds = gdal.GetDriverByName("MEM").Create("", 100, 100, 2, gdal.GDT_Byte)
+        target_ds.SetGeoTransform((1000, 1, 0, 1100, 0, -1))
+        target_ds.SetProjection(sr_wkt)
+        assert (
+            gdal.RasterizeLayer(
+                target_ds,
+                [1, 2],
+                rast_mem_lyr,
+                burn_values=[10, 20],
+                options=options + extra_options,
+            )
+            == gdal.CE_None
+        )
+        return target_ds.ReadRaster()
+
+    ref = rasterize([])
+    assert ref != b"\0" * len(ref)
+    assert rasterize(["NUM_THREADS=4"]) == ref
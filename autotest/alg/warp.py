@@ -1815,3 +1815,63 @@ def test_warp_average_excluded_values():
         (11 + 21 + 31 + 41) // 4,
         (12 + 22 + 32 + 42) // 4,
     )
+
+
+###############################################################################
+# Test SOURCE_PREFETCH_CHUNKS warping option
+
+
+@pytest.mark.parametrize("multi", [False, True])
+def test_warp_source_prefetch_chunks(multi):
+
+    src_ds = gdal.Translate("", "../gcore/data/byte.tif", format="VRT")
+    ref_ds = gdal.Warp("", src_ds, format="MEM", xRes=30, yRes=30)
+
+    out_ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        xRes=30,
+        yRes=30,
+        warpMemoryLimit=1000,
+        multithread=multi,
+        warpOptions=["SOURCE_PREFETCH_CHUNKS=2"],
+    )
+    assert out_ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+
+
+###############################################################################
+# Test TRANSFORMER_CACHE_FILE warping option
+
+
+@pytest.mark.parametrize("multi", [False, True])
+def test_warp_transformer_cache_file(tmp_vsimem, multi):
+
+    cache_filename = str(tmp_vsimem / "transformer_cache.bin")
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+
+    def warp(dst_srs):
+        return gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            dstSRS=dst_srs,
+            multithread=multi,
+            warpOptions=["TRANSFORMER_CACHE_FILE=" + cache_filename],
+        )
+
+    ref_cs = gdal.Warp("", src_ds, format="MEM", dstSRS="EPSG:4326")
+    ref_cs = ref_cs.GetRasterBand(1).Checksum()
+
+    assert warp("EPSG:4326").GetRasterBand(1).Checksum() == ref_cs
+    assert gdal.VSIStatL(cache_filename) is not None
+    size = gdal.VSIStatL(cache_filename).size
+
+    # Reuse the cache
+    assert warp("EPSG:4326").GetRasterBand(1).Checksum() == ref_cs
+    assert gdal.VSIStatL(cache_filename).size == size
+
+    # Different geometry: the cache is not used, and rewritten
+    ref_cs = gdal.Warp("", src_ds, format="MEM", dstSRS="EPSG:32611")
+    ref_cs = ref_cs.GetRasterBand(1).Checksum()
+    assert warp("EPSG:32611").GetRasterBand(1).Checksum() == ref_cs
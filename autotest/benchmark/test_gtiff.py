@@ -181,3 +181,34 @@ def test_gtiff_build_overviews(tmp_vsimem, source_ds_2048x2048_filename, ovr_alg
     ds = gdal.Open(filename, gdal.GA_Update)
     ds.BuildOverviews(ovr_alg, [2, 4, 8])
     ds.Close()
+
+
+@pytest.mark.parametrize("nbits", [1, 2, 4, 10, 12, 14])
+def test_gtiff_nbits_read(tmp_vsimem, nbits):
+    filename = str(tmp_vsimem / "nbits.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        2048,
+        2048,
+        1,
+        gdal.GDT_Byte if nbits <= 8 else gdal.GDT_UInt16,
+        options=["NBITS=" + str(nbits)],
+    )
+    ds.GetRasterBand(1).Fill(1)
+    ds.Close()
+    for i in range(4):
+        ds = gdal.Open(filename)
+        ds.ReadRaster()
+        ds.Close()
+
+
+@pytest.mark.parametrize("nbits", [1, 2, 4, 10, 12, 14])
+def test_gtiff_nbits_write(tmp_vsimem, nbits):
+    filename = str(tmp_vsimem / "nbits.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "", 2048, 2048, 1, gdal.GDT_Byte if nbits <= 8 else gdal.GDT_UInt16
+    )
+    src_ds.GetRasterBand(1).Fill(1)
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["NBITS=" + str(nbits)]
+    )
@@ -36,6 +36,7 @@
 #include "gdal_unit_test.h"
 
 #include "cpl_compressor.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_hash_set.h"
 #include "cpl_list.h"
@@ -51,16 +52,19 @@
 #include "cpl_http.h"
 #include "cpl_auto_close.h"
 #include "cpl_minixml.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_quad_tree.h"
 #include "cpl_worker_thread_pool.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_threadsafe_queue.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <limits>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #include "gtest_include.h"
 
@@ -1278,6 +1282,77 @@ TEST_F(test_cpl, CPLGetThreadLocalConfigOptions)
     CSLDestroy(options);
 }
 
+/************************************************************************/
+/*       CPLGetConfigOption() concurrent with CPLSetConfigOption()      */
+/************************************************************************/
+TEST_F(test_cpl, CPLGetConfigOption_multithreaded)
+{
+    CPLSetConfigOption("FOOFOO_CONSTANT", "BAR");
+    std::atomic<bool> bStop{false};
+    std::atomic<bool> bOK{true};
+    std::vector<std::thread> aoThreads;
+    for (int i = 0; i < 4; ++i)
+    {
+        aoThreads.emplace_back(
+            [&bStop, &bOK]()
+            {
+                while (!bStop)
+                {
+                    if (!EQUAL(CPLGetConfigOption("FOOFOO_CONSTANT", ""),
+                               "BAR"))
+                        bOK = false;
+                    CPLGetConfigOption("FOOFOO_VARYING", nullptr);
+                }
+            });
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        CPLSetConfigOption("FOOFOO_VARYING", CPLSPrintf("%d", i));
+        CPLSetConfigOption(CPLSPrintf("FOOFOO_%d", i % 10), "X");
+    }
+    bStop = true;
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_TRUE(bOK);
+    EXPECT_STREQ(CPLGetConfigOption("FOOFOO_VARYING", nullptr), "9999");
+    EXPECT_STREQ(CPLGetConfigOption("FOOFOO_CONSTANT", nullptr), "BAR");
+    CPLSetConfigOption("FOOFOO_VARYING", nullptr);
+    CPLSetConfigOption("FOOFOO_CONSTANT", nullptr);
+    for (int i = 0; i < 10; ++i)
+        CPLSetConfigOption(CPLSPrintf("FOOFOO_%d", i), nullptr);
+}
+
+/************************************************************************/
+/*                CPLCachedBoolConfigOption / IntConfigOption           */
+/************************************************************************/
+TEST_F(test_cpl, CPLCachedConfigOption)
+{
+    CPLCachedBoolConfigOption oBool("FOOFOO_BOOL", true);
+    CPLCachedIntConfigOption oInt("FOOFOO_INT", 5);
+    EXPECT_TRUE(oBool.Get());
+    EXPECT_EQ(oInt.Get(), 5);
+    EXPECT_EQ(oInt.Get(), 5);
+
+    CPLSetConfigOption("FOOFOO_BOOL", "NO");
+    CPLSetConfigOption("FOOFOO_INT", "-3");
+    EXPECT_FALSE(oBool.Get());
+    EXPECT_EQ(oInt.Get(), -3);
+    EXPECT_EQ(oInt.Get(), -3);
+
+    {
+        // Thread-local options take precedence and are never cached
+        CPLConfigOptionSetter oSetter("FOOFOO_INT", "7", false);
+        EXPECT_EQ(oInt.Get(), 7);
+        EXPECT_FALSE(oBool.Get());
+    }
+    EXPECT_EQ(oInt.Get(), -3);
+
+    CPLSetConfigOption("FOOFOO_BOOL", nullptr);
+    CPLSetConfigOption("FOOFOO_INT", nullptr);
+    EXPECT_TRUE(oBool.Get());
+    EXPECT_EQ(oInt.Get(), 5);
+}
+
 TEST_F(test_cpl, CPLExpandTilde)
 {
     EXPECT_STREQ(CPLExpandTilde("/foo/bar"), "/foo/bar");
@@ -2825,6 +2900,87 @@ TEST_F(test_cpl, CPLJSONDocument)
     }
 }
 
+// Test that the fast JSON parser gives the same results as json_tokener
+TEST_F(test_cpl, CPLJSONDocument_fast_parser)
+{
+    const char *const apszDocs[] = {
+        "{}",
+        "[]",
+        " \r\n\t{ \"a\" : [ 1 , -2, 0, -0, 1.5, -1.25e-3, 1E+2, 3.0 ] } \n",
+        "{\"a\": true, \"b\": false, \"c\": null, \"d\": [null, true]}",
+        "{\"esc\": \"\\\"\\\\\\/\\b\\f\\n\\r\\t\", \"u\": \"\\u00e9\\u20ac\"}",
+        "{\"surrogate\": \"\\ud83d\\ude00\", \"utf8\": \"\xc3\xa9\"}",
+        "{\"long_string_without_escape_longer_than_8_bytes\": "
+        "\"0123456789abcdefghijklmnopqrstuvwxyz\"}",
+        "{\"int64\": [123456789012345678, -123456789012345678, "
+        "9223372036854775807, -9223372036854775808, 18446744073709551615, "
+        "99999999999999999999]}",
+        "{\"dup\": 1, \"dup\": 2}",
+        // Nesting deeper than json_tokener default limit
+        "[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[["
+        "1]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]",
+        "[[[[[[[[[[1]]]]]]]]]]",
+        // Non-strict constructs, handled by json_tokener
+        "{\"a\": 1,}",
+        "{\"a\": 01}",
+        "{\"a\": NaN}",
+        "{\"a\": 'b'}",
+        "{\"a\": \"\\u0000\"}",
+        "{\"a\": \"\\udc00\"}",
+        "{\"a\": \"\t\"}",
+        "{\"a\": 1} trailing",
+        "/* comment */ {\"a\": 1}",
+        "{\"a\": TRUE}",
+        "\"string\"",
+        "123",
+        // Invalid documents
+        "{\"a\": }",
+        "{\"a\" 1}",
+        "[1, 2",
+        "{\"a\": \"unterminated}",
+    };
+    for (const char *pszDoc : apszDocs)
+    {
+        std::string osFast;
+        bool bFastRet;
+        {
+            CPLJSONDocument oDoc;
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            bFastRet = oDoc.LoadMemory(pszDoc);
+            if (bFastRet)
+                osFast =
+                    oDoc.GetRoot().Format(CPLJSONObject::PrettyFormat::Plain);
+        }
+        std::string osTokener;
+        bool bTokenerRet;
+        {
+            CPLConfigOptionSetter oSetter("CPL_JSON_FAST_PARSER", "NO", false);
+            CPLJSONDocument oDoc;
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            bTokenerRet = oDoc.LoadMemory(pszDoc);
+            if (bTokenerRet)
+                osTokener =
+                    oDoc.GetRoot().Format(CPLJSONObject::PrettyFormat::Plain);
+        }
+        EXPECT_EQ(bFastRet, bTokenerRet) << pszDoc;
+        EXPECT_STREQ(osFast.c_str(), osTokener.c_str()) << pszDoc;
+    }
+
+    {
+        CPLJSONDocument oDoc;
+        ASSERT_TRUE(oDoc.LoadMemory(
+            "{\"a\": {\"b\": [1, 2.5, \"x\\u00e9\"]}, \"c\": 1234567890123}"));
+        const auto oArray = oDoc.GetRoot().GetArray("a/b");
+        ASSERT_EQ(oArray.Size(), 3);
+        EXPECT_EQ(oArray[0].GetType(), CPLJSONObject::Type::Integer);
+        EXPECT_EQ(oArray[1].ToDouble(), 2.5);
+        EXPECT_STREQ(oArray[2].ToString().c_str(), "x\xc3\xa9");
+        EXPECT_EQ(oDoc.GetRoot().GetObj("c").GetType(),
+                  CPLJSONObject::Type::Long);
+        EXPECT_EQ(oDoc.GetRoot().GetLong("c"), 1234567890123LL);
+    }
+}
+
 // Test CPLRecodeIconv() with re-allocation
 TEST_F(test_cpl, CPLRecodeIconv)
 {
@@ -4127,6 +4283,60 @@ TEST_F(test_cpl, CPLQuadTree)
     CPLQuadTreeDestroy(hTree);
 }
 
+// Test CPLPackedRTree against a brute-force search
+TEST_F(test_cpl, CPLPackedRTree)
+{
+    unsigned next = 0;
+    constexpr int MAX_RAND_VAL = 32767;
+    const auto DummyRand = [&]()
+    {
+        next = next * 1103515245 + 12345;
+        return double((unsigned)(next / 65536) % (MAX_RAND_VAL + 1)) /
+               MAX_RAND_VAL;
+    };
+
+    for (int nItems : {0, 1, 16, 17, 1000})
+    {
+        CPLPackedRTree oTree(nItems % 2 ? 4 : 16);
+        std::vector<CPLRectObj> asRects;
+        for (int i = 0; i < nItems; ++i)
+        {
+            CPLRectObj rect;
+            rect.minx = DummyRand();
+            rect.miny = DummyRand();
+            rect.maxx = rect.minx + DummyRand() * 0.05;
+            rect.maxy = rect.miny + DummyRand() * 0.05;
+            asRects.push_back(rect);
+            oTree.Add(rect.minx, rect.miny, rect.maxx, rect.maxy, i);
+        }
+        oTree.Build();
+        EXPECT_EQ(oTree.size(), static_cast<size_t>(nItems));
+
+        for (int iQuery = 0; iQuery < 100; ++iQuery)
+        {
+            const double dfMinX = DummyRand();
+            const double dfMinY = DummyRand();
+            const double dfMaxX = dfMinX + DummyRand() * 0.1;
+            const double dfMaxY = dfMinY + DummyRand() * 0.1;
+            std::vector<size_t> anResults;
+            oTree.Search(dfMinX, dfMinY, dfMaxX, dfMaxY, anResults);
+            std::sort(anResults.begin(), anResults.end());
+
+            std::vector<size_t> anExpected;
+            for (int i = 0; i < nItems; ++i)
+            {
+                const auto &rect = asRects[i];
+                if (!(rect.maxx < dfMinX || rect.maxy < dfMinY ||
+                      rect.minx > dfMaxX || rect.miny > dfMaxY))
+                {
+                    anExpected.push_back(i);
+                }
+            }
+            EXPECT_EQ(anResults, anExpected);
+        }
+    }
+}
+
 // Test bUnlinkAndSize on VSIGetMemFileBuffer
 TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
 {
@@ -4659,6 +4869,46 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test CPLWorkerThreadPool with jobs waiting for nested jobs
+TEST_F(test_cpl, CPLWorkerThreadPool_nested_job_queues)
+{
+    struct Context
+    {
+        CPLWorkerThreadPool oThreadPool{};
+        std::atomic<int> nCounter{0};
+    };
+
+    Context ctxt;
+    ctxt.oThreadPool.Setup(2, nullptr, nullptr, /* waitAllStarted = */ true);
+
+    constexpr int N_OUTER_JOBS = 16;
+    constexpr int N_NESTED_JOBS = 32;
+
+    const auto lambda = [](void *pData)
+    {
+        auto psCtxt = static_cast<Context *>(pData);
+        const auto lambda2 = [](void *pData2)
+        { static_cast<Context *>(pData2)->nCounter++; };
+        // All worker threads are busy running outer jobs that wait for their
+        // nested jobs: this must not deadlock.
+        auto poQueue = psCtxt->oThreadPool.CreateJobQueue();
+        for (int i = 0; i < N_NESTED_JOBS; ++i)
+            poQueue->SubmitJob(lambda2, psCtxt);
+        poQueue->WaitCompletion();
+        psCtxt->nCounter++;
+    };
+
+    for (int iIter = 0; iIter < 10; ++iIter)
+    {
+        ctxt.nCounter = 0;
+        auto poQueue = ctxt.oThreadPool.CreateJobQueue();
+        for (int i = 0; i < N_OUTER_JOBS; ++i)
+            poQueue->SubmitJob(lambda, &ctxt);
+        poQueue->WaitCompletion();
+        ASSERT_EQ(ctxt.nCounter, N_OUTER_JOBS * (N_NESTED_JOBS + 1));
+    }
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -4685,6 +4935,82 @@ TEST_F(test_cpl, vsimem_pread)
     VSIFCloseL(fp);
 }
 
+// Test concurrent creation, listing and removal of /vsimem/ files
+TEST_F(test_cpl, vsimem_multithreaded)
+{
+    constexpr int THREAD_COUNT = 8;
+    constexpr int FILE_COUNT = 100;
+    std::atomic<bool> bStart{false};
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < THREAD_COUNT; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [iThread, &bStart]()
+            {
+                while (!bStart)
+                {
+                    // Wait for all threads to be ready
+                }
+
+                // All threads create a file in the same not-yet-existing
+                // directory, hence concurrently create its parents.
+                VSILFILE *fp = VSIFOpenL(
+                    CPLSPrintf("/vsimem/vsimem_multithreaded/shared/sub/%d",
+                               iThread),
+                    "wb");
+                ASSERT_NE(fp, nullptr);
+                VSIFCloseL(fp);
+
+                for (int i = 0; i < FILE_COUNT; ++i)
+                {
+                    const std::string osFilename(CPLSPrintf(
+                        "/vsimem/vsimem_multithreaded/%d/%d", iThread, i));
+                    fp = VSIFOpenL(osFilename.c_str(), "wb");
+                    ASSERT_NE(fp, nullptr);
+                    VSIFWriteL(&i, sizeof(i), 1, fp);
+                    VSIFCloseL(fp);
+                    if ((i % 2) == 0)
+                        VSIUnlink(osFilename.c_str());
+                }
+            });
+    }
+    bStart = true;
+    for (auto &oThread : aoThreads)
+        oThread.join();
+
+    const CPLStringList aosThreadDirs(
+        VSIReadDir("/vsimem/vsimem_multithreaded"));
+    EXPECT_EQ(aosThreadDirs.size(), THREAD_COUNT + 1);
+    EXPECT_EQ(
+        CPLStringList(VSIReadDir("/vsimem/vsimem_multithreaded/shared/sub"))
+            .size(),
+        THREAD_COUNT);
+    for (int iThread = 0; iThread < THREAD_COUNT; ++iThread)
+    {
+        const std::string osDir(
+            CPLSPrintf("/vsimem/vsimem_multithreaded/%d", iThread));
+        const CPLStringList aosFiles(VSIReadDir(osDir.c_str()));
+        EXPECT_EQ(aosFiles.size(), FILE_COUNT / 2);
+        VSIStatBufL sStat;
+        EXPECT_EQ(VSIStatL((osDir + "/1").c_str(), &sStat), 0);
+        EXPECT_EQ(sStat.st_size, static_cast<vsi_l_offset>(sizeof(int)));
+        EXPECT_NE(VSIStatL((osDir + "/0").c_str(), &sStat), 0);
+    }
+
+    // Rename a directory whose files are spread among several shards
+    EXPECT_EQ(VSIRename("/vsimem/vsimem_multithreaded/0",
+                        "/vsimem/vsimem_multithreaded/renamed"),
+              0);
+    VSIStatBufL sStat;
+    EXPECT_NE(VSIStatL("/vsimem/vsimem_multithreaded/0/1", &sStat), 0);
+    EXPECT_EQ(VSIStatL("/vsimem/vsimem_multithreaded/renamed/99", &sStat), 0);
+    EXPECT_EQ(CPLStringList(VSIReadDir("/vsimem/vsimem_multithreaded/renamed"))
+                  .size(),
+              FILE_COUNT / 2);
+
+    VSIRmdirRecursive("/vsimem/vsimem_multithreaded");
+}
+
 // Test regular file system PRead() implementation
 TEST_F(test_cpl, file_system_pread)
 {
@@ -5242,4 +5568,142 @@ TEST_F(test_cpl, CPLUTF8ForceToASCII)
     }
 }
 
+// Test CPLGetRuntimeCPUFeatures() and CPLCPUDispatch()
+TEST_F(test_cpl, CPLCPUDispatch)
+{
+    const int nFeatures = CPLGetRuntimeCPUFeatures();
+    EXPECT_EQ(nFeatures, CPLGetRuntimeCPUFeatures());
+    if (nFeatures & CPL_CPU_FEATURE_AVX2)
+    {
+        EXPECT_TRUE(nFeatures & CPL_CPU_FEATURE_AVX);
+    }
+    if (nFeatures & (CPL_CPU_FEATURE_AVX512BW | CPL_CPU_FEATURE_AVX512VL))
+    {
+        EXPECT_TRUE(nFeatures & CPL_CPU_FEATURE_AVX512F);
+    }
+#if defined(__x86_64) || defined(_M_X64)
+    EXPECT_TRUE(nFeatures & CPL_CPU_FEATURE_SSE2);
+#elif defined(__aarch64__)
+    EXPECT_TRUE(nFeatures & CPL_CPU_FEATURE_NEON);
+#endif
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+    if (CPLHaveRuntimeAVX2())
+    {
+        EXPECT_TRUE(CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_AVX2));
+    }
+#endif
+
+    typedef int (*FnType)();
+    const auto Default = []() { return 0; };
+    const auto Generic = []() { return 1; };
+    const auto Always = []() { return 2; };
+    const FnType pfnDefault = Default;
+
+    // No candidate available
+    EXPECT_EQ(
+        CPLCPUDispatch<FnType>({{CPL_CPU_FEATURE_AVX2, nullptr}}, pfnDefault)(),
+        0);
+
+    // First matching candidate wins
+    EXPECT_EQ(CPLCPUDispatch<FnType>({{0, Generic}, {0, Always}}, pfnDefault)(),
+              1);
+
+    // Unsupported feature combination is skipped
+    const int nMissing = ~nFeatures & (CPL_CPU_FEATURE_NEON |
+                                       CPL_CPU_FEATURE_SSE2);
+    if (nMissing)
+    {
+        EXPECT_EQ(CPLCPUDispatch<FnType>({{nMissing, Generic}, {0, Always}},
+                                         pfnDefault)(),
+                  2);
+    }
+}
+
+// Test VSIStatMultipleL()
+TEST_F(test_cpl, VSIStatMultipleL)
+{
+    const std::string osTmpFile(CPLGenerateTempFilename(nullptr));
+    VSILFILE *fp = VSIFOpenL(osTmpFile.c_str(), "wb");
+    ASSERT_TRUE(fp != nullptr);
+    VSIFCloseL(fp);
+
+    fp = VSIFOpenL("/vsimem/VSIStatMultipleL/a", "wb");
+    ASSERT_TRUE(fp != nullptr);
+    VSIFWriteL("foo", 1, 3, fp);
+    VSIFCloseL(fp);
+    fp = VSIFOpenL("/vsimem/VSIStatMultipleL/b", "wb");
+    ASSERT_TRUE(fp != nullptr);
+    VSIFCloseL(fp);
+
+    // Files from different file system handlers, interleaved
+    const char *const apszFilenames[] = {
+        "/vsimem/VSIStatMultipleL/a", osTmpFile.c_str(),
+        "/vsimem/VSIStatMultipleL/non_existing", "/vsimem/VSIStatMultipleL/b",
+        nullptr};
+    VSIStatBufL asStatBuf[4];
+    int *panRet = VSIStatMultipleL(apszFilenames, asStatBuf, 0);
+    ASSERT_TRUE(panRet != nullptr);
+    EXPECT_EQ(panRet[0], 0);
+    EXPECT_EQ(asStatBuf[0].st_size, 3);
+    EXPECT_EQ(panRet[1], 0);
+    EXPECT_EQ(asStatBuf[1].st_size, 0);
+    EXPECT_EQ(panRet[2], -1);
+    EXPECT_EQ(panRet[3], 0);
+    EXPECT_TRUE(VSI_ISREG(asStatBuf[3].st_mode));
+    VSIFree(panRet);
+
+    VSIRmdirRecursive("/vsimem/VSIStatMultipleL");
+    VSIUnlink(osTmpFile.c_str());
+}
+
+// Test VSIFReadMultiRangeL() on a local file
+TEST_F(test_cpl, VSIFReadMultiRangeL_local_file)
+{
+    const std::string osTmpFile(CPLGenerateTempFilename(nullptr));
+    VSILFILE *fp = VSIFOpenL(osTmpFile.c_str(), "wb");
+    ASSERT_TRUE(fp != nullptr);
+    std::vector<GByte> abyContent(100000);
+    for (size_t i = 0; i < abyContent.size(); ++i)
+        abyContent[i] = static_cast<GByte>(i % 251);
+    ASSERT_EQ(VSIFWriteL(abyContent.data(), 1, abyContent.size(), fp),
+              abyContent.size());
+    VSIFCloseL(fp);
+
+    fp = VSIFOpenL(osTmpFile.c_str(), "rb");
+    ASSERT_TRUE(fp != nullptr);
+    ASSERT_EQ(VSIFSeekL(fp, 10, SEEK_SET), 0);
+
+    // Ranges out of order and overlapping
+    const vsi_l_offset anOffsets[] = {90000, 0, 50000, 50010};
+    const size_t anSizes[] = {10000, 1, 20000, 5};
+    std::vector<std::vector<GByte>> aabyData;
+    std::vector<void *> apData;
+    for (size_t nSize : anSizes)
+    {
+        aabyData.emplace_back(nSize);
+        apData.push_back(aabyData.back().data());
+    }
+    EXPECT_EQ(VSIFReadMultiRangeL(4, apData.data(), anOffsets, anSizes, fp),
+              0);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(memcmp(apData[i], abyContent.data() + anOffsets[i],
+                           anSizes[i]) == 0)
+            << i;
+    }
+    // File position is not affected
+    EXPECT_EQ(VSIFTellL(fp), 10U);
+
+    // Range beyond end of file
+    const vsi_l_offset nOffsetBeyondEOF = 99999;
+    const size_t nSizeBeyondEOF = 2;
+    void *pData = aabyData[0].data();
+    EXPECT_NE(VSIFReadMultiRangeL(1, &pData, &nOffsetBeyondEOF,
+                                  &nSizeBeyondEOF, fp),
+              0);
+
+    VSIFCloseL(fp);
+    VSIUnlink(osTmpFile.c_str());
+}
+
 }  // namespace
@@ -33,6 +33,8 @@
 #include "gdal_utils.h"
 #include "gdal_priv_templates.hpp"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
+#include "ogr_recordbatch.h"
 #include "tilematrixset.hpp"
 #include "gdalcachedpixelaccessor.h"
 
@@ -3147,6 +3149,57 @@ TEST_F(test_gdal, GDALDeinterleave4ComponentsUInt16)
     VSIFree(panDest3);
 }
 
+// Test GDALApplyByteLUT()
+TEST_F(test_gdal, GDALApplyByteLUT)
+{
+    std::vector<GByte> abySrc(2051);
+    for (size_t i = 0; i < abySrc.size(); i++)
+        abySrc[i] = static_cast<GByte>(i * 37);
+    GByte abyLUT[256];
+    for (int i = 0; i < 256; i++)
+        abyLUT[i] = static_cast<GByte>(255 - i);
+    for (int nStride : {1, 3})
+    {
+        std::vector<GByte> abyDst(abySrc.size() * nStride);
+        GDALApplyByteLUT(abySrc.data(), abyLUT, abyDst.data(), nStride,
+                         abySrc.size());
+        for (size_t i = 0; i < abySrc.size(); i++)
+        {
+            EXPECT_EQ(abyDst[i * nStride], 255 - abySrc[i]);
+        }
+    }
+}
+
+// Test GDALExpandPaletteByte()
+TEST_F(test_gdal, GDALExpandPaletteByte)
+{
+    constexpr size_t N = 2051;
+    GByte abyCT[4 * 256];
+    for (int i = 0; i < 4 * 256; i++)
+        abyCT[i] = static_cast<GByte>(i * 7);
+    for (int nComponents = 1; nComponents <= 4; nComponents++)
+    {
+        // Expand in place in the first plane
+        std::vector<GByte> abyBuffer(4 * N);
+        for (size_t i = 0; i < N; i++)
+            abyBuffer[i] = static_cast<GByte>(i * 37);
+        const std::vector<GByte> abySrc(abyBuffer.begin(),
+                                        abyBuffer.begin() + N);
+        GByte *const apabyDst[] = {abyBuffer.data(), abyBuffer.data() + N,
+                                   abyBuffer.data() + 2 * N,
+                                   abyBuffer.data() + 3 * N};
+        GDALExpandPaletteByte(abyBuffer.data(), abyCT, nComponents, apabyDst,
+                              N);
+        for (size_t i = 0; i < N; i++)
+        {
+            for (int iComp = 0; iComp < nComponents; iComp++)
+            {
+                EXPECT_EQ(apabyDst[iComp][i], abyCT[4 * abySrc[i] + iComp]);
+            }
+        }
+    }
+}
+
 // Test GDALDataset::ReportError()
 TEST_F(test_gdal, GDALDatasetReportError)
 {
@@ -3927,4 +3980,318 @@ TEST_F(test_gdal, gdal_gcp_class)
     }
 }
 
+// Test GDALThreadReservation
+TEST_F(test_gdal, GDALThreadReservation)
+{
+    {
+        CPLConfigOptionSetter oSetter("GDAL_THREAD_BUDGET", nullptr, false);
+        EXPECT_EQ(GDALGetThreadBudget(), 0);
+        GDALThreadReservation oRes(8);
+        EXPECT_EQ(oRes.GetThreadCount(), 8);
+    }
+
+    CPLConfigOptionSetter oSetter("GDAL_THREAD_BUDGET", "4", false);
+    EXPECT_EQ(GDALGetThreadBudget(), 4);
+    {
+        GDALThreadReservation oRes1(3);
+        EXPECT_EQ(oRes1.GetThreadCount(), 3);
+        {
+            GDALThreadReservation oRes2(8);
+            EXPECT_EQ(oRes2.GetThreadCount(), 2);
+            // Budget exhausted: only the calling thread
+            GDALThreadReservation oRes3(8);
+            EXPECT_EQ(oRes3.GetThreadCount(), 1);
+
+            GDALThreadReservation oRes4(std::move(oRes2));
+            EXPECT_EQ(oRes4.GetThreadCount(), 2);
+        }
+        GDALThreadReservation oRes5(8);
+        EXPECT_EQ(oRes5.GetThreadCount(), 2);
+        oRes5.Release();
+        EXPECT_EQ(oRes5.GetThreadCount(), 0);
+    }
+    GDALThreadReservation oRes6(8);
+    EXPECT_EQ(oRes6.GetThreadCount(), 4);
+}
+
+// Test GDALDataset::RasterIOAsync() and GDALRasterBand::RasterIOAsync()
+TEST_F(test_gdal, RasterIOAsync)
+{
+    GDALDatasetH hDS = GDALCreate(GDALGetDriverByName("MEM"), "", 64, 48, 2,
+                                  GDT_Byte, nullptr);
+    ASSERT_TRUE(hDS != nullptr);
+    auto poDS = GDALDataset::FromHandle(hDS);
+    std::vector<GByte> abyRef(64 * 48 * 2);
+    for (size_t i = 0; i < abyRef.size(); ++i)
+        abyRef[i] = static_cast<GByte>(i * 7);
+    {
+        auto oFuture =
+            poDS->RasterIOAsync(GF_Write, 0, 0, 64, 48, abyRef.data(), 64, 48,
+                                GDT_Byte, 2, nullptr, 0, 0, 0);
+        EXPECT_EQ(oFuture.get(), CE_None);
+    }
+
+    constexpr int N_REQUESTS = 16;
+    std::vector<std::vector<GByte>> aabyBuffers(N_REQUESTS,
+                                                std::vector<GByte>(8 * 8 * 2));
+    std::vector<std::future<CPLErr>> aoFutures;
+    for (int i = 0; i < N_REQUESTS; ++i)
+    {
+        aoFutures.push_back(poDS->RasterIOAsync(
+            GF_Read, (i % 8) * 8, (i / 8) * 8, 8, 8, aabyBuffers[i].data(), 8,
+            8, GDT_Byte, 2, nullptr, 0, 0, 0));
+    }
+    for (int i = 0; i < N_REQUESTS; ++i)
+    {
+        EXPECT_EQ(aoFutures[i].get(), CE_None);
+        for (int iBand = 0; iBand < 2; ++iBand)
+        {
+            for (int y = 0; y < 8; ++y)
+            {
+                for (int x = 0; x < 8; ++x)
+                {
+                    const int nSrcX = (i % 8) * 8 + x;
+                    const int nSrcY = (i / 8) * 8 + y;
+                    EXPECT_EQ(aabyBuffers[i][iBand * 64 + y * 8 + x],
+                              abyRef[iBand * 64 * 48 + nSrcY * 64 + nSrcX]);
+                }
+            }
+        }
+    }
+
+    // Band level request, and error reporting
+    GByte abyBuf[4] = {0};
+    auto oFuture = poDS->GetRasterBand(2)->RasterIOAsync(
+        GF_Read, 1, 0, 2, 2, abyBuf, 2, 2, GDT_Byte, 0, 0);
+    auto oFutureError = poDS->GetRasterBand(1)->RasterIOAsync(
+        GF_Read, 60, 0, 8, 8, abyBuf, 8, 8, GDT_Byte, 0, 0);
+    EXPECT_EQ(oFutureError.get(), CE_Failure);
+    EXPECT_EQ(oFuture.get(), CE_None);
+    EXPECT_EQ(abyBuf[0], abyRef[64 * 48 + 1]);
+    EXPECT_EQ(abyBuf[3], abyRef[64 * 48 + 64 + 2]);
+
+    // GDALClose() waits for pending requests
+    std::vector<GByte> abyAll(64 * 48);
+    auto oFutureLast = poDS->GetRasterBand(1)->RasterIOAsync(
+        GF_Read, 0, 0, 64, 48, abyAll.data(), 64, 48, GDT_Byte, 0, 0);
+    GDALClose(hDS);
+    EXPECT_EQ(oFutureLast.wait_for(std::chrono::seconds(0)),
+              std::future_status::ready);
+    EXPECT_EQ(abyAll[64 * 48 - 1], abyRef[64 * 48 - 1]);
+}
+
+// Test GDALRasterBand::ReadMultiWindow()
+TEST_F(test_gdal, ReadMultiWindow)
+{
+    std::unique_ptr<GDALDataset> poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+            ->Create("", 20, 10, 1, GDT_Byte, nullptr));
+    std::vector<GByte> abyRef(20 * 10);
+    for (size_t i = 0; i < abyRef.size(); ++i)
+        abyRef[i] = static_cast<GByte>(i);
+    auto poBand = poDS->GetRasterBand(1);
+    ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, 20, 10, abyRef.data(), 20, 10,
+                               GDT_Byte, 0, 0, nullptr),
+              CE_None);
+
+    GByte abyBuf1[3 * 2] = {0};
+    GByte abyBuf2[4 * 4] = {0};
+    GUInt16 anBuf3[2 * 1] = {0};
+    GDALRasterIOWindow asWindows[3];
+    asWindows[0] = {1, 2, 3, 2, abyBuf1, 3, 2, 0, 0};
+    asWindows[1] = {2, 2, 8, 8, abyBuf2, 4, 4, 0, 0};
+    asWindows[2] = {19, 9, 1, 1, anBuf3, 2, 1, 0, 0};
+    ASSERT_EQ(poBand->ReadMultiWindow(2, asWindows, GDT_Byte), CE_None);
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 3; ++x)
+        {
+            EXPECT_EQ(abyBuf1[y * 3 + x], abyRef[(2 + y) * 20 + 1 + x]);
+        }
+    }
+    GByte abyExpected2[4 * 4] = {0};
+    ASSERT_EQ(poBand->RasterIO(GF_Read, 2, 2, 8, 8, abyExpected2, 4, 4,
+                               GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    EXPECT_EQ(memcmp(abyBuf2, abyExpected2, sizeof(abyBuf2)), 0);
+
+    ASSERT_EQ(GDALRasterReadMultiWindow(GDALRasterBand::ToHandle(poBand), 1,
+                                        &asWindows[2], GDT_UInt16, nullptr),
+              CE_None);
+    EXPECT_EQ(anBuf3[0], abyRef[9 * 20 + 19]);
+    EXPECT_EQ(anBuf3[1], abyRef[9 * 20 + 19]);
+
+    EXPECT_EQ(poBand->ReadMultiWindow(0, nullptr, GDT_Byte), CE_None);
+
+    // Out of range window
+    asWindows[1].nXOff = 13;
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    EXPECT_EQ(poBand->ReadMultiWindow(2, asWindows, GDT_Byte), CE_Failure);
+    CPLPopErrorHandler();
+}
+
+// Test GDALRasterBand::BorrowBlock()
+TEST_F(test_gdal, BorrowBlock)
+{
+    std::unique_ptr<GDALDataset> poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+            ->Create("/vsimem/test_gdal_BorrowBlock.tif", 20, 10, 1, GDT_UInt16,
+                     nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    std::vector<GUInt16> anRef(20 * 10);
+    for (size_t i = 0; i < anRef.size(); ++i)
+        anRef[i] = static_cast<GUInt16>(i * 3);
+    auto poBand = poDS->GetRasterBand(1);
+    ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, 20, 10, anRef.data(), 20, 10,
+                               GDT_UInt16, 0, 0, nullptr),
+              CE_None);
+    poDS.reset();
+
+    poDS.reset(GDALDataset::Open(
+        "/vsimem/test_gdal_BorrowBlock.tif", GDAL_OF_RASTER, nullptr, nullptr,
+        nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    poBand = poDS->GetRasterBand(1);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    {
+        GDALRasterBlockView oView = poBand->BorrowBlock(0, 0);
+        ASSERT_TRUE(oView);
+        EXPECT_EQ(oView.GetDataType(), GDT_UInt16);
+        EXPECT_EQ(oView.GetXSize(), nBlockXSize);
+        EXPECT_EQ(oView.GetYSize(), nBlockYSize);
+        EXPECT_EQ(oView.GetValidXSize(), 20);
+        EXPECT_EQ(oView.GetValidYSize(), std::min(10, nBlockYSize));
+        EXPECT_EQ(oView.size(), static_cast<size_t>(nBlockXSize) *
+                                    nBlockYSize * sizeof(GUInt16));
+        const GUInt16 *panData = static_cast<const GUInt16 *>(oView.data());
+        for (int y = 0; y < oView.GetValidYSize(); ++y)
+        {
+            for (int x = 0; x < oView.GetValidXSize(); ++x)
+            {
+                EXPECT_EQ(panData[y * oView.GetXSize() + x], anRef[y * 20 + x]);
+            }
+        }
+
+        // The view points to the data of the cached block
+        GDALRasterBlock *poBlock = poBand->TryGetLockedBlockRef(0, 0);
+        ASSERT_TRUE(poBlock != nullptr);
+        EXPECT_EQ(poBlock->GetDataRef(), oView.data());
+        poBlock->DropLock();
+
+        GDALRasterBlockView oView2(std::move(oView));
+        EXPECT_TRUE(oView2);
+        EXPECT_EQ(oView2.GetValidXSize(), 20);
+        oView2.Release();
+        EXPECT_FALSE(oView2);
+    }
+
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    GDALRasterBlockView oViewInvalid = poBand->BorrowBlock(100, 0);
+    CPLPopErrorHandler();
+    EXPECT_FALSE(oViewInvalid);
+
+    poDS.reset();
+    VSIUnlink("/vsimem/test_gdal_BorrowBlock.tif");
+}
+
+// Test GDALDataset::GetRasterArrowStream()
+TEST_F(test_gdal, GetRasterArrowStream)
+{
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+            ->Create("", 5, 3, 2, GDT_Byte, nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    double adfGT[] = {100, 10, 0, 200, 0, -10};
+    poDS->SetGeoTransform(adfGT);
+    poDS->GetRasterBand(2)->SetNoDataValue(255);
+    std::vector<GByte> abyVals(5 * 3 * 2);
+    for (size_t i = 0; i < abyVals.size(); ++i)
+        abyVals[i] = static_cast<GByte>(i);
+    ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, 5, 3, abyVals.data(), 5, 3,
+                             GDT_Byte, 2, nullptr, 0, 0, 0, nullptr),
+              CE_None);
+
+    struct ArrowArrayStream stream;
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("TILE_XSIZE", "2");
+    aosOptions.SetNameValue("TILE_YSIZE", "2");
+    aosOptions.SetNameValue("MAX_TILES_PER_BATCH", "4");
+    ASSERT_TRUE(poDS->GetRasterArrowStream(&stream, aosOptions.List()));
+
+    struct ArrowSchema schema;
+    ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+    ASSERT_EQ(schema.n_children, 6);
+    EXPECT_STREQ(schema.children[0]->name, "x_off");
+    EXPECT_STREQ(schema.children[4]->name, "geotransform");
+    EXPECT_STREQ(schema.children[4]->format, "+w:6");
+    EXPECT_STREQ(schema.children[5]->name, "data");
+    EXPECT_STREQ(schema.children[5]->format, "+w:8");
+    EXPECT_STREQ(schema.children[5]->children[0]->format, "C");
+    schema.release(&schema);
+
+    int nTotalTiles = 0;
+    for (int nExpectedTiles : {4, 2, 0})
+    {
+        struct ArrowArray array;
+        ASSERT_EQ(stream.get_next(&stream, &array), 0);
+        if (nExpectedTiles == 0)
+        {
+            EXPECT_EQ(array.release, nullptr);
+            break;
+        }
+        ASSERT_EQ(array.length, nExpectedTiles);
+        ASSERT_EQ(array.n_children, 6);
+        const int32_t *panXOff =
+            static_cast<const int32_t *>(array.children[0]->buffers[1]);
+        const int32_t *panYOff =
+            static_cast<const int32_t *>(array.children[1]->buffers[1]);
+        const int32_t *panXSize =
+            static_cast<const int32_t *>(array.children[2]->buffers[1]);
+        const int32_t *panYSize =
+            static_cast<const int32_t *>(array.children[3]->buffers[1]);
+        const double *padfGT = static_cast<const double *>(
+            array.children[4]->children[0]->buffers[1]);
+        const GByte *pabyData = static_cast<const GByte *>(
+            array.children[5]->children[0]->buffers[1]);
+        for (int iTile = 0; iTile < nExpectedTiles; ++iTile, ++nTotalTiles)
+        {
+            const int nXOff = (nTotalTiles % 3) * 2;
+            const int nYOff = (nTotalTiles / 3) * 2;
+            EXPECT_EQ(panXOff[iTile], nXOff);
+            EXPECT_EQ(panYOff[iTile], nYOff);
+            EXPECT_EQ(panXSize[iTile], std::min(2, 5 - nXOff));
+            EXPECT_EQ(panYSize[iTile], std::min(2, 3 - nYOff));
+            EXPECT_EQ(padfGT[6 * iTile + 0], 100 + 10 * nXOff);
+            EXPECT_EQ(padfGT[6 * iTile + 3], 200 - 10 * nYOff);
+            for (int iBand = 0; iBand < 2; ++iBand)
+            {
+                for (int iY = 0; iY < 2; ++iY)
+                {
+                    for (int iX = 0; iX < 2; ++iX)
+                    {
+                        const GByte nVal =
+                            pabyData[iTile * 8 + iBand * 4 + iY * 2 + iX];
+                        if (nXOff + iX < 5 && nYOff + iY < 3)
+                        {
+                            EXPECT_EQ(nVal,
+                                      abyVals[iBand * 15 + (nYOff + iY) * 5 +
+                                              nXOff + iX]);
+                        }
+                        else
+                        {
+                            // Padding uses the nodata value, or zero
+                            EXPECT_EQ(nVal, iBand == 0 ? 0 : 255);
+                        }
+                    }
+                }
+            }
+        }
+        array.release(&array);
+    }
+    EXPECT_EQ(nTotalTiles, 6);
+    stream.release(&stream);
+}
+
 }  // namespace
@@ -3046,6 +3046,187 @@ TEST_F(test_ogr, importFromWkbReuse)
     }
 }
 
+// Test that importFromWkb() on an existing multi-ring / multi-part geometry
+// reuses its sub-geometries
+TEST_F(test_ogr, importFromWkbReuseMultiPart)
+{
+    const auto roundTrip = [](OGRGeometry *poGeom, const char *pszWKT)
+    {
+        SCOPED_TRACE(pszWKT);
+        OGRGeometry *poSrcGeom = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr,
+                                                    &poSrcGeom),
+                  OGRERR_NONE);
+        std::unique_ptr<OGRGeometry> poSrcGeomHolder(poSrcGeom);
+        std::vector<GByte> abyWkb(poSrcGeom->WkbSize());
+        const OGRwkbByteOrder eOrder =
+            poSrcGeom->Is3D() ? wkbXDR : wkbNDR;  // test both byte orders
+        poSrcGeom->exportToWkb(eOrder, abyWkb.data(), wkbVariantIso);
+        size_t nBytesConsumed = 0;
+        EXPECT_EQ(poGeom->importFromWkb(abyWkb.data(), abyWkb.size(),
+                                        wkbVariantIso, nBytesConsumed),
+                  OGRERR_NONE);
+        EXPECT_EQ(nBytesConsumed, abyWkb.size());
+        EXPECT_TRUE(poGeom->Equals(poSrcGeom));
+        EXPECT_EQ(poGeom->Is3D(), poSrcGeom->Is3D());
+        EXPECT_EQ(poGeom->IsMeasured(), poSrcGeom->IsMeasured());
+    };
+
+    {
+        OGRPolygon oPoly;
+        roundTrip(&oPoly, "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))");
+        const OGRLinearRing *poExtRing = oPoly.getExteriorRing();
+        roundTrip(&oPoly, "POLYGON Z ((0 0 1,0 1 2,1 1 3,0 0 1),"
+                          "(0.1 0.1 0,0.1 0.2 0,0.2 0.2 0,0.1 0.1 0),"
+                          "(0.5 0.5 0,0.5 0.6 0,0.6 0.6 0,0.5 0.5 0))");
+        EXPECT_EQ(oPoly.getExteriorRing(), poExtRing);
+        roundTrip(&oPoly, "POLYGON M ((0 0 1,0 1 2,1 1 3,0 0 1))");
+        EXPECT_EQ(oPoly.getExteriorRing(), poExtRing);
+        roundTrip(&oPoly, "POLYGON EMPTY");
+        roundTrip(&oPoly, "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))");
+    }
+
+    {
+        OGRMultiPolygon oMP;
+        roundTrip(&oMP, "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),"
+                        "((2 2,2 3,3 3,2 2),"
+                        "(2.1 2.1,2.1 2.2,2.2 2.2,2.1 2.1)))");
+        const OGRGeometry *poFirstPart = oMP.getGeometryRef(0);
+        roundTrip(&oMP, "MULTIPOLYGON Z (((0 0 1,0 1 1,1 1 1,0 0 1)),"
+                        "((2 2 1,2 3 1,3 3 1,2 2 1)),"
+                        "((5 5 1,5 6 1,6 6 1,5 5 1)))");
+        EXPECT_EQ(oMP.getGeometryRef(0), poFirstPart);
+        roundTrip(&oMP, "MULTIPOLYGON (((0 0,0 1,1 1,0 0)))");
+        roundTrip(&oMP, "MULTIPOLYGON EMPTY");
+    }
+
+    {
+        OGRGeometryCollection oGC;
+        roundTrip(&oGC, "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (0 0,1 1),"
+                        "MULTIPOINT ((1 2),(3 4)))");
+        const OGRGeometry *poSecondPart = oGC.getGeometryRef(1);
+        roundTrip(&oGC, "GEOMETRYCOLLECTION (POINT (3 4),"
+                        "LINESTRING (0 0,1 1,2 2),POLYGON ((0 0,0 1,1 1,0 0)),"
+                        "MULTIPOINT ((1 2)))");
+        EXPECT_EQ(oGC.getGeometryRef(1), poSecondPart);
+        roundTrip(&oGC, "GEOMETRYCOLLECTION (POLYGON ((0 0,0 1,1 1,0 0)),"
+                        "CIRCULARSTRING (0 0,1 1,2 0))");
+    }
+}
+
+// Test OGRLayer::GetNextFeatureInto()
+TEST_F(test_ogr, GetNextFeatureInto)
+{
+    const auto CheckLayer = [](OGRLayer *poLayer, const char *pszDriver)
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoExpected;
+        poLayer->ResetReading();
+        for (auto &&poFeature : *poLayer)
+            apoExpected.emplace_back(poFeature.release());
+
+        poLayer->ResetReading();
+        OGRFeature oFeature(poLayer->GetLayerDefn());
+        size_t i = 0;
+        while (poLayer->GetNextFeatureInto(oFeature))
+        {
+            ASSERT_LT(i, apoExpected.size()) << pszDriver;
+            EXPECT_TRUE(oFeature.Equal(apoExpected[i].get())) << pszDriver;
+            ++i;
+        }
+        EXPECT_EQ(i, apoExpected.size()) << pszDriver;
+
+        // Feature with a different definition: content copied
+        poLayer->ResetReading();
+        OGRFeatureDefn *poOtherDefn = poLayer->GetLayerDefn()->Clone();
+        poOtherDefn->Reference();
+        {
+            OGRFeature oOtherFeature(poOtherDefn);
+            ASSERT_TRUE(poLayer->GetNextFeatureInto(oOtherFeature))
+                << pszDriver;
+            EXPECT_EQ(oOtherFeature.GetFID(), apoExpected[0]->GetFID())
+                << pszDriver;
+            EXPECT_STREQ(oOtherFeature.GetFieldAsString("str"),
+                         apoExpected[0]->GetFieldAsString("str"))
+                << pszDriver;
+        }
+        poOtherDefn->Release();
+    };
+
+    for (const char *pszDriver :
+         {"Memory", "GPKG", "ESRI Shapefile", "FlatGeobuf", "CSV",
+          "OpenFileGDB"})
+    {
+        auto poDriver = GetGDALDriverManager()->GetDriverByName(pszDriver);
+        if (poDriver == nullptr)
+            continue;
+        const bool bIsMem = EQUAL(pszDriver, "Memory");
+        const std::string osFilename =
+            bIsMem ? std::string()
+            : EQUAL(pszDriver, "GPKG")
+                ? std::string("/vsimem/GetNextFeatureInto.gpkg")
+            : EQUAL(pszDriver, "OpenFileGDB")
+                ? std::string("/vsimem/GetNextFeatureInto.gdb")
+                : std::string("/vsimem/GetNextFeatureInto");
+        auto poDS = std::unique_ptr<GDALDataset>(poDriver->Create(
+            osFilename.c_str(), 0, 0, 0, GDT_Unknown, nullptr));
+        ASSERT_TRUE(poDS != nullptr) << pszDriver;
+        CPLStringList aosLCO;
+        if (EQUAL(pszDriver, "CSV"))
+            aosLCO.SetNameValue("GEOMETRY", "AS_WKT");
+        auto poLayer = poDS->CreateLayer("test", nullptr, wkbPolygon,
+                                         aosLCO.List());
+        ASSERT_TRUE(poLayer != nullptr) << pszDriver;
+        OGRFieldDefn oFieldInt("int", OFTInteger);
+        ASSERT_EQ(poLayer->CreateField(&oFieldInt), OGRERR_NONE);
+        OGRFieldDefn oFieldStr("str", OFTString);
+        ASSERT_EQ(poLayer->CreateField(&oFieldStr), OGRERR_NONE);
+        for (int i = 0; i < 10; ++i)
+        {
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            oFeature.SetField("int", i);
+            // Leave some fields unset, to check they are reset
+            if ((i % 3) != 0)
+                oFeature.SetField("str", CPLSPrintf("foo%d", i));
+            if ((i % 4) != 0)
+            {
+                OGRPolygon oPoly;
+                auto poRing = std::make_unique<OGRLinearRing>();
+                poRing->addPoint(i, 0);
+                poRing->addPoint(i, 1 + i);
+                poRing->addPoint(i + 1, 1 + i);
+                poRing->addPoint(i, 0);
+                oPoly.addRingDirectly(poRing.release());
+                oFeature.SetGeometry(&oPoly);
+            }
+            ASSERT_EQ(poLayer->CreateFeature(&oFeature), OGRERR_NONE)
+                << pszDriver;
+        }
+        if (!bIsMem)
+        {
+            poDS.reset();
+            const char *const apszAllowedDrivers[] = {pszDriver, nullptr};
+            poDS.reset(GDALDataset::Open(osFilename.c_str(), GDAL_OF_VECTOR,
+                                         apszAllowedDrivers));
+            ASSERT_TRUE(poDS != nullptr) << pszDriver;
+            poLayer = poDS->GetLayer(0);
+            ASSERT_TRUE(poLayer != nullptr) << pszDriver;
+        }
+
+        CheckLayer(poLayer, pszDriver);
+
+        poLayer->SetAttributeFilter("int >= 5");
+        CheckLayer(poLayer, pszDriver);
+        poLayer->SetAttributeFilter(nullptr);
+
+        poLayer->SetSpatialFilterRect(2.5, 0.5, 6.5, 10);
+        CheckLayer(poLayer, pszDriver);
+
+        poDS.reset();
+        if (!bIsMem)
+            VSIRmdirRecursive(osFilename.c_str());
+    }
+}
+
 // Test sealing functionality on OGRFieldDefn
 TEST_F(test_ogr, OGRFieldDefn_sealing)
 {
@@ -3961,4 +4142,168 @@ TEST_F(test_ogr, OGRFeature_SerializeToBinary)
     }
 }
 
+// Test OGRGeometryFactory::processGeometries()
+TEST_F(test_ogr, OGRGeometryFactory_processGeometries)
+{
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        GTEST_SKIP() << "GEOS missing";
+    }
+
+    // Enough geometries for several jobs
+    constexpr int N = 100;
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+    std::vector<const OGRGeometry *> apoGeomsPtr;
+    for (int i = 0; i < N; ++i)
+    {
+        // Self-intersecting polygon for MakeValid()
+        OGRGeometry *poGeom = nullptr;
+        const std::string osWKT(
+            CPLSPrintf("POLYGON ((%d 0,%d 1,%d 0,%d 1,%d 0))", i, i + 1, i + 1,
+                       i, i));
+        OGRGeometryFactory::createFromWkt(osWKT.c_str(), nullptr, &poGeom);
+        ASSERT_NE(poGeom, nullptr);
+        apoGeoms.emplace_back(poGeom);
+        apoGeomsPtr.push_back(poGeom);
+    }
+    apoGeomsPtr.push_back(nullptr);
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("NUM_THREADS", "4");
+
+    {
+        aosOptions.SetNameValue("DISTANCE", "0.5");
+        const auto apoRes = OGRGeometryFactory::processGeometries(
+            OGRGeometryFactory::BatchOperation::BUFFER, apoGeomsPtr.data(),
+            apoGeomsPtr.size(), nullptr, aosOptions.List());
+        ASSERT_EQ(apoRes.size(), apoGeomsPtr.size());
+        for (int i = 0; i < N; ++i)
+        {
+            std::unique_ptr<OGRGeometry> poExpected(
+                apoGeoms[i]->Buffer(0.5, 30));
+            ASSERT_NE(apoRes[i], nullptr);
+            EXPECT_TRUE(apoRes[i]->Equals(poExpected.get()));
+        }
+        EXPECT_EQ(apoRes[N], nullptr);
+    }
+
+    {
+        const auto apoRes = OGRGeometryFactory::processGeometries(
+            OGRGeometryFactory::BatchOperation::MAKE_VALID, apoGeomsPtr.data(),
+            N, nullptr, aosOptions.List());
+        ASSERT_EQ(apoRes.size(), static_cast<size_t>(N));
+        for (int i = 0; i < N; ++i)
+        {
+            std::unique_ptr<OGRGeometry> poExpected(apoGeoms[i]->MakeValid());
+            ASSERT_NE(apoRes[i], nullptr);
+            EXPECT_TRUE(apoRes[i]->IsValid());
+            EXPECT_TRUE(apoRes[i]->Equals(poExpected.get()));
+        }
+    }
+
+    {
+        OGRPolygon oClip;
+        const char *pszWKT = "POLYGON ((0 0,0 10,10 10,10 0,0 0))";
+        ASSERT_EQ(oClip.importFromWkt(&pszWKT), OGRERR_NONE);
+        const auto apoRes = OGRGeometryFactory::processGeometries(
+            OGRGeometryFactory::BatchOperation::INTERSECTION,
+            apoGeomsPtr.data(), N, &oClip, aosOptions.List());
+        for (int i = 0; i < N; ++i)
+        {
+            std::unique_ptr<OGRGeometry> poExpected(
+                apoGeoms[i]->Intersection(&oClip));
+            ASSERT_NE(apoRes[i], nullptr);
+            EXPECT_TRUE(apoRes[i]->Equals(poExpected.get()));
+        }
+    }
+
+    // WKB variant
+    {
+        std::vector<std::vector<GByte>> aabyWKB;
+        std::vector<const GByte *> apabyWKB;
+        std::vector<size_t> anWKBSize;
+        for (const auto &poGeom : apoGeoms)
+        {
+            aabyWKB.emplace_back(poGeom->WkbSize());
+            poGeom->exportToWkb(wkbNDR, aabyWKB.back().data(), wkbVariantIso);
+        }
+        for (const auto &abyWKB : aabyWKB)
+        {
+            apabyWKB.push_back(abyWKB.data());
+            anWKBSize.push_back(abyWKB.size());
+        }
+        aosOptions.SetNameValue("TOLERANCE", "0.1");
+        const auto aabyRes = OGRGeometryFactory::processWKBGeometries(
+            OGRGeometryFactory::BatchOperation::SIMPLIFY_PRESERVE_TOPOLOGY,
+            apabyWKB.data(), anWKBSize.data(), N, nullptr, aosOptions.List());
+        ASSERT_EQ(aabyRes.size(), static_cast<size_t>(N));
+        for (int i = 0; i < N; ++i)
+        {
+            std::unique_ptr<OGRGeometry> poExpected(
+                apoGeoms[i]->SimplifyPreserveTopology(0.1));
+            OGRGeometry *poGeom = nullptr;
+            ASSERT_EQ(OGRGeometryFactory::createFromWkb(aabyRes[i].data(),
+                                                        nullptr, &poGeom,
+                                                        aabyRes[i].size()),
+                      OGRERR_NONE);
+            std::unique_ptr<OGRGeometry> poGeomUniquePtr(poGeom);
+            EXPECT_TRUE(poGeom->Equals(poExpected.get()));
+        }
+    }
+}
+
+// Test OGRGeometryFactory::unionGeometries() and OGRGeometryUnionAccumulator
+TEST_F(test_ogr, OGRGeometryFactory_unionGeometries)
+{
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        GTEST_SKIP() << "GEOS missing";
+    }
+
+    // Grid of 40x40 overlapping squares, in shuffled order
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+    OGRGeometryCollection oGC;
+    for (int k = 0; k < 1600; ++k)
+    {
+        const int idx = (k * 7919) % 1600;
+        const int i = idx % 40;
+        const int j = idx / 40;
+        OGRGeometry *poGeom = nullptr;
+        const std::string osWKT(CPLSPrintf(
+            "POLYGON ((%d %d,%d %f,%f %f,%f %d,%d %d))", i, j, i, j + 1.5,
+            i + 1.5, j + 1.5, i + 1.5, j, i, j));
+        OGRGeometryFactory::createFromWkt(osWKT.c_str(), nullptr, &poGeom);
+        ASSERT_NE(poGeom, nullptr);
+        oGC.addGeometry(poGeom);
+        apoGeoms.emplace_back(poGeom);
+    }
+    std::unique_ptr<OGRGeometry> poExpected(oGC.UnaryUnion());
+    ASSERT_NE(poExpected, nullptr);
+
+    std::vector<const OGRGeometry *> apoGeomsPtr;
+    for (const auto &poGeom : apoGeoms)
+        apoGeomsPtr.push_back(poGeom.get());
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("NUM_THREADS", "4");
+    auto poUnion = OGRGeometryFactory::unionGeometries(
+        apoGeomsPtr.data(), apoGeomsPtr.size(), aosOptions.List());
+    ASSERT_NE(poUnion, nullptr);
+    EXPECT_NEAR(poUnion->toPolygon()->get_Area(), 40.5 * 40.5, 1e-8);
+    std::unique_ptr<OGRGeometry> poSymDiff(
+        poUnion->SymDifference(poExpected.get()));
+    ASSERT_NE(poSymDiff, nullptr);
+    EXPECT_TRUE(poSymDiff->IsEmpty());
+
+    aosOptions.SetNameValue("BATCH_SIZE", "100");
+    OGRGeometryUnionAccumulator oAccumulator(aosOptions.List());
+    for (auto &poGeom : apoGeoms)
+        EXPECT_TRUE(oAccumulator.AddGeometry(std::move(poGeom)));
+    poUnion = oAccumulator.GetResult();
+    ASSERT_NE(poUnion, nullptr);
+    EXPECT_NEAR(poUnion->toPolygon()->get_Area(), 40.5 * 40.5, 1e-8);
+
+    EXPECT_EQ(OGRGeometryFactory::unionGeometries(nullptr, 0), nullptr);
+}
+
 }  // namespace
@@ -34,6 +34,8 @@
 #include "gtest_include.h"
 
 #include <limits>
+#include <memory>
+#include <string>
 
 namespace
 {
@@ -524,4 +526,225 @@ INSTANTIATE_TEST_SUITE_P(
         OGRWKBIntersectsPessimisticFixture::ParamType> &l_info)
     { return std::get<6>(l_info.param); });
 
+class OGRWKBGeometryViewFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<std::tuple<const char *, bool>>
+{
+};
+
+TEST_P(OGRWKBGeometryViewFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    const bool bLSB = std::get<1>(GetParam());
+
+    OGRGeometry *poGeom = nullptr;
+    ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszInput, nullptr, &poGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeom != nullptr);
+    std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(bLSB ? wkbNDR : wkbXDR, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBGeometryView oView(abyWkb.data(), abyWkb.size());
+    ASSERT_TRUE(oView.IsValid());
+    EXPECT_EQ(oView.GetGeometryType(), poGeom->getGeometryType());
+    EXPECT_EQ(oView.IsEmpty(), CPL_TO_BOOL(poGeom->IsEmpty()));
+
+    OGREnvelope3D sEnvelope;
+    EXPECT_TRUE(oView.GetEnvelope(sEnvelope));
+    if (!poGeom->IsEmpty())
+    {
+        OGREnvelope3D sExpectedEnvelope;
+        poGeom->getEnvelope(&sExpectedEnvelope);
+        EXPECT_EQ(sEnvelope.MinX, sExpectedEnvelope.MinX);
+        EXPECT_EQ(sEnvelope.MinY, sExpectedEnvelope.MinY);
+        EXPECT_EQ(sEnvelope.MaxX, sExpectedEnvelope.MaxX);
+        EXPECT_EQ(sEnvelope.MaxY, sExpectedEnvelope.MaxY);
+    }
+
+    size_t nExpectedPointCount = 0;
+    const auto CountPoints = [&nExpectedPointCount](const OGRGeometry *poG,
+                                                    const auto &self) -> void
+    {
+        const auto eType = wkbFlatten(poG->getGeometryType());
+        if (eType == wkbPoint)
+        {
+            if (!poG->IsEmpty())
+                ++nExpectedPointCount;
+        }
+        else if (OGR_GT_IsCurve(eType))
+        {
+            nExpectedPointCount += poG->toSimpleCurve()->getNumPoints();
+        }
+        else if (OGR_GT_IsSubClassOf(eType, wkbCurvePolygon))
+        {
+            for (const auto *poRing : *(poG->toPolygon()))
+                nExpectedPointCount += poRing->getNumPoints();
+        }
+        else if (OGR_GT_IsSubClassOf(eType, wkbPolyhedralSurface))
+        {
+            for (const auto *poPoly : *(poG->toPolyhedralSurface()))
+                self(poPoly, self);
+        }
+        else
+        {
+            for (const auto *poSubGeom : *(poG->toGeometryCollection()))
+                self(poSubGeom, self);
+        }
+    };
+    CountPoints(poGeom, CountPoints);
+    EXPECT_EQ(oView.GetPointCount(), nExpectedPointCount);
+
+    const auto eFlatType = wkbFlatten(poGeom->getGeometryType());
+    if (eFlatType != wkbPoint && eFlatType != wkbMultiPoint)
+    {
+        EXPECT_NEAR(oView.GetArea(), OGR_G_Area(OGRGeometry::ToHandle(poGeom)),
+                    1e-10);
+    }
+    if (OGR_GT_IsCurve(eFlatType) ||
+        OGR_GT_IsSubClassOf(eFlatType, wkbMultiCurve) ||
+        eFlatType == wkbGeometryCollection)
+    {
+        EXPECT_NEAR(oView.GetLength(),
+                    OGR_G_Length(OGRGeometry::ToHandle(poGeom)), 1e-10);
+    }
+
+    // Truncated WKB
+    EXPECT_FALSE(
+        OGRWKBGeometryView(abyWkb.data(), abyWkb.size() - 1).IsValid());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBGeometryViewFixture,
+    ::testing::Combine(
+        ::testing::Values(
+            "POINT (1 2)", "POINT EMPTY", "POINT ZM (1 2 3 4)",
+            "LINESTRING (0 0,1 1,3 1)", "LINESTRING EMPTY",
+            "LINESTRING M (0 0 1,0 1 2,1 1 3,0 0 4)",
+            "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,1 2,2 2,2 1,1 1))",
+            "POLYGON Z ((0 0 1,0 10 2,10 10 3,0 0 1))", "POLYGON EMPTY",
+            "MULTIPOINT ((1 2),(3 4))",
+            "MULTILINESTRING ((0 0,1 1),EMPTY,(2 2,2 5))",
+            "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))",
+            "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (0 0,0 3),"
+            "POLYGON ((0 0,0 1,1 1,0 0)),"
+            "GEOMETRYCOLLECTION (LINESTRING (0 0,4 3)))",
+            "TIN (((0 0,0 1,1 1,0 0)),((0 0,1 1,1 0,0 0)))"),
+        ::testing::Bool()),
+    [](const ::testing::TestParamInfo<OGRWKBGeometryViewFixture::ParamType>
+           &l_info)
+    {
+        std::string osName(std::get<0>(l_info.param));
+        for (char &c : osName)
+        {
+            if (!isalnum(static_cast<unsigned char>(c)))
+                c = '_';
+        }
+        return osName + (std::get<1>(l_info.param) ? "_LSB" : "_MSB");
+    });
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_Intersects)
+{
+    OGRGeometry *poGeom = nullptr;
+    ASSERT_EQ(OGRGeometryFactory::createFromWkt(
+                  "MULTIPOLYGON (((0 0,0 10,10 10,10 0,0 0),"
+                  "(2 2,2 4,4 4,4 2,2 2),(6 6,6 8,8 8,8 6,6 6)),"
+                  "((20 0,20 1,21 1,20 0)))",
+                  nullptr, &poGeom),
+              OGRERR_NONE);
+    std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBGeometryView oView(abyWkb.data(), abyWkb.size());
+    EXPECT_TRUE(oView.Intersects(1, 1));
+    EXPECT_TRUE(oView.Intersects(5, 5));
+    EXPECT_TRUE(oView.Intersects(0, 5));    // on exterior ring
+    EXPECT_TRUE(oView.Intersects(2, 3));    // on interior ring
+    EXPECT_FALSE(oView.Intersects(3, 3));   // in first hole
+    EXPECT_FALSE(oView.Intersects(7, 7));   // in second hole
+    EXPECT_FALSE(oView.Intersects(11, 5));  // outside
+    EXPECT_TRUE(oView.Intersects(20.2, 0.5));
+    EXPECT_FALSE(oView.Intersects(20.75, 0.25));
+
+    // Not a surface
+    const GByte abyPoint[] = {1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                              0, 0, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_FALSE(
+        OGRWKBGeometryView(abyPoint, sizeof(abyPoint)).Intersects(0, 0));
+}
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_unsupported)
+{
+    OGRGeometry *poGeom = nullptr;
+    ASSERT_EQ(OGRGeometryFactory::createFromWkt("CIRCULARSTRING (0 0,1 1,2 0)",
+                                                nullptr, &poGeom),
+              OGRERR_NONE);
+    std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBGeometryView oView(abyWkb.data(), abyWkb.size());
+    EXPECT_FALSE(oView.IsValid());
+    EXPECT_EQ(oView.GetGeometryType(), wkbUnknown);
+    EXPECT_EQ(oView.GetPointCount(), 0);
+    EXPECT_EQ(oView.GetArea(), 0);
+    EXPECT_FALSE(OGRWKBGeometryView(nullptr, 0).IsValid());
+}
+
+TEST_F(test_ogr_wkb, OGRPreparedGeometryIntersectsWKB)
+{
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        GTEST_SKIP() << "GEOS missing";
+    }
+
+    OGRGeometry *poFilter = nullptr;
+    ASSERT_EQ(OGRGeometryFactory::createFromWkt(
+                  "POLYGON ((0 0,0 10,10 10,10 0,0 0),(2 2,2 8,8 8,8 2,2 2))",
+                  nullptr, &poFilter),
+              OGRERR_NONE);
+    std::unique_ptr<OGRGeometry> poFilterHolder(poFilter);
+    OGRPreparedGeometryUniquePtr poPrepared(
+        OGRCreatePreparedGeometry(OGRGeometry::ToHandle(poFilter)));
+    ASSERT_TRUE(poPrepared != nullptr);
+
+    for (const char *pszWKT :
+         {"POINT (1 1)", "POINT (5 5)", "POINT (0 5)", "POINT Z (1 1 1)",
+          "LINESTRING (3 3,4 4)", "LINESTRING (3 3,12 3)",
+          "POLYGON ((3 3,3 4,4 4,3 3))", "POLYGON ((-1 -1,-1 11,11 11,-1 -1))",
+          "MULTIPOINT ((5 5),(1 1))", "MULTIPOINT ((5 5),(6 6))",
+          "GEOMETRYCOLLECTION (POINT (5 5),LINESTRING (9 9,9 12))"})
+    {
+        OGRGeometry *poGeom = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                  OGRERR_NONE);
+        std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+        std::vector<GByte> abyWkb(poGeom->WkbSize());
+        poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+        const int nExpected = poFilter->Intersects(poGeom) ? 1 : 0;
+        EXPECT_EQ(OGRPreparedGeometryIntersects(poPrepared.get(),
+                                                OGRGeometry::ToHandle(poGeom)),
+                  nExpected)
+            << pszWKT;
+        EXPECT_EQ(OGRPreparedGeometryIntersectsWKB(
+                      poPrepared.get(), abyWkb.data(), abyWkb.size()),
+                  nExpected)
+            << pszWKT;
+    }
+
+    // Unsupported geometry type: caller must fallback
+    OGRGeometry *poGeom = nullptr;
+    ASSERT_EQ(OGRGeometryFactory::createFromWkt("CIRCULARSTRING (0 0,1 1,2 0)",
+                                                nullptr, &poGeom),
+              OGRERR_NONE);
+    std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+    EXPECT_EQ(OGRPreparedGeometryIntersectsWKB(poPrepared.get(), abyWkb.data(),
+                                               abyWkb.size()),
+              -1);
+}
+
 }  // namespace
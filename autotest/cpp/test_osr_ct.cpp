@@ -37,6 +37,8 @@
 #include <algorithm>
 #include <cmath>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -331,6 +333,161 @@ TEST_F(test_osr_ct, Clone_WebMercator_to_WGS84)
     test_clone(poCT.get(), &oSRSSource, &oSRSTarget, 44, -60);
 }
 
+// Test OGRCreateThreadSafeCoordinateTransformation()
+TEST_F(test_osr_ct, OGRCreateThreadSafeCoordinateTransformation)
+{
+    OGRSpatialReference oSRSSource;
+    oSRSSource.SetWellKnownGeogCS("WGS84");
+    oSRSSource.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    OGRSpatialReference oSRSTarget;
+    oSRSTarget.importFromEPSG(32631);
+
+    auto poRefCT = std::unique_ptr<OGRCoordinateTransformation>(
+        OGRCreateCoordinateTransformation(&oSRSSource, &oSRSTarget));
+    ASSERT_TRUE(poRefCT != nullptr);
+    auto poCT = std::unique_ptr<OGRCoordinateTransformation>(
+        OGRCreateThreadSafeCoordinateTransformation(poRefCT->Clone(), 4));
+    ASSERT_TRUE(poCT != nullptr);
+    EXPECT_TRUE(poCT->GetSourceCS()->IsSame(&oSRSSource));
+    EXPECT_TRUE(poCT->GetTargetCS()->IsSame(&oSRSTarget));
+
+    // Large enough to be split between several threads
+    constexpr size_t N = 100 * 1000;
+    std::vector<double> adfRefX(N), adfRefY(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        adfRefX[i] = 2.0 + static_cast<double>(i % 1000) / 1000;
+        adfRefY[i] = 49.0 + static_cast<double>(i / 1000) / 100;
+    }
+    std::vector<double> adfX(adfRefX), adfY(adfRefY);
+    std::vector<int> abSuccess(N);
+    ASSERT_TRUE(poRefCT->Transform(N, adfRefX.data(), adfRefY.data()));
+
+    // Concurrent use from several threads
+    std::vector<std::thread> aoThreads;
+    std::vector<std::vector<double>> aadfX(4, adfX), aadfY(4, adfY);
+    for (int i = 0; i < 4; ++i)
+    {
+        aoThreads.emplace_back(
+            [&poCT, &aadfX, &aadfY, i]()
+            {
+                poCT->Transform(N / 10, aadfX[i].data(), aadfY[i].data(),
+                                nullptr);
+            });
+    }
+    ASSERT_TRUE(poCT->Transform(N, adfX.data(), adfY.data(), nullptr, nullptr,
+                                abSuccess.data()));
+    for (auto &oThread : aoThreads)
+        oThread.join();
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        ASSERT_EQ(adfX[i], adfRefX[i]);
+        ASSERT_EQ(adfY[i], adfRefY[i]);
+        ASSERT_TRUE(abSuccess[i]);
+    }
+    for (int j = 0; j < 4; ++j)
+    {
+        for (size_t i = 0; i < N / 10; ++i)
+        {
+            ASSERT_EQ(aadfX[j][i], adfRefX[i]);
+            ASSERT_EQ(aadfY[j][i], adfRefY[i]);
+        }
+    }
+
+    // Test GetInverse() and Clone()
+    auto poInvCT =
+        std::unique_ptr<OGRCoordinateTransformation>(poCT->GetInverse());
+    ASSERT_TRUE(poInvCT != nullptr);
+    auto poInvCTClone =
+        std::unique_ptr<OGRCoordinateTransformation>(poInvCT->Clone());
+    ASSERT_TRUE(poInvCTClone != nullptr);
+    std::vector<int> anErrorCodes(N);
+    ASSERT_TRUE(poInvCTClone->TransformWithErrorCodes(
+        N, adfX.data(), adfY.data(), nullptr, nullptr, anErrorCodes.data()));
+    for (size_t i = 0; i < N; ++i)
+    {
+        ASSERT_NEAR(adfX[i], 2.0 + static_cast<double>(i % 1000) / 1000,
+                    1e-8);
+        ASSERT_NEAR(adfY[i], 49.0 + static_cast<double>(i / 1000) / 100,
+                    1e-8);
+        ASSERT_EQ(anErrorCodes[i], 0);
+    }
+}
+
+// Test that the analytic fast paths (WGS84 <-> UTM, WGS84 -> WebMercator)
+// give the same results as PROJ
+TEST_F(test_osr_ct, analytic_fast_paths)
+{
+    const auto test = [](int nSrcEPSG, int nDstEPSG,
+                         const std::vector<double> &adfX,
+                         const std::vector<double> &adfY)
+    {
+        SCOPED_TRACE(std::to_string(nSrcEPSG) + " -> " +
+                     std::to_string(nDstEPSG));
+        OGRSpatialReference oSRSSource;
+        oSRSSource.importFromEPSG(nSrcEPSG);
+        OGRSpatialReference oSRSTarget;
+        oSRSTarget.importFromEPSG(nDstEPSG);
+
+        std::unique_ptr<OGRCoordinateTransformation> poCTRef;
+        {
+            CPLConfigOptionSetter oSetter("OGR_CT_USE_FAST_PATH", "NO",
+                                          false);
+            poCTRef.reset(
+                OGRCreateCoordinateTransformation(&oSRSSource, &oSRSTarget));
+        }
+        auto poCT = std::unique_ptr<OGRCoordinateTransformation>(
+            OGRCreateCoordinateTransformation(&oSRSSource, &oSRSTarget));
+        ASSERT_TRUE(poCTRef != nullptr);
+        ASSERT_TRUE(poCT != nullptr);
+
+        std::vector<double> adfXRef(adfX), adfYRef(adfY);
+        std::vector<double> adfXRes(adfX), adfYRes(adfY);
+        std::vector<int> anErrRef(adfX.size()), anErr(adfX.size());
+        poCTRef->TransformWithErrorCodes(adfX.size(), adfXRef.data(),
+                                         adfYRef.data(), nullptr, nullptr,
+                                         anErrRef.data());
+        poCT->TransformWithErrorCodes(adfX.size(), adfXRes.data(),
+                                      adfYRes.data(), nullptr, nullptr,
+                                      anErr.data());
+        const double dfTol = oSRSTarget.IsGeographic() ? 1e-10 : 1e-5;
+        for (size_t i = 0; i < adfX.size(); ++i)
+        {
+            EXPECT_EQ(anErr[i] == 0, anErrRef[i] == 0) << i;
+            if (anErr[i] == 0 && anErrRef[i] == 0)
+            {
+                EXPECT_NEAR(adfXRes[i], adfXRef[i], dfTol) << i;
+                EXPECT_NEAR(adfYRes[i], adfYRef[i], dfTol) << i;
+            }
+        }
+
+        // Round trip through the inverse transformation
+        auto poInvCT =
+            std::unique_ptr<OGRCoordinateTransformation>(poCT->GetInverse());
+        ASSERT_TRUE(poInvCT != nullptr);
+        std::vector<int> anErrInv(adfX.size());
+        poInvCT->TransformWithErrorCodes(adfX.size(), adfXRes.data(),
+                                         adfYRes.data(), nullptr, nullptr,
+                                         anErrInv.data());
+        for (size_t i = 0; i < adfX.size(); ++i)
+        {
+            if (anErr[i] == 0 && anErrInv[i] == 0)
+            {
+                EXPECT_NEAR(adfXRes[i], adfX[i], 1e-5) << i;
+                EXPECT_NEAR(adfYRes[i], adfY[i], 1e-5) << i;
+            }
+        }
+    };
+
+    // EPSG:4326 is in latitude, longitude order
+    test(4326, 32611, {32, 0, -10, 89, 95}, {-117.5, -117, -100, -120, 0});
+    test(4326, 32733, {-10, -80.5, 0}, {15, 20, 14});
+    test(32611, 4326, {452772.06, 500000, 200000}, {3540544.89, 0, 7000000});
+    test(32733, 4326, {500000, 700000}, {8000000, 1000000});
+    test(4326, 3857, {49, -85, 90}, {2, 180, 0});
+}
+
 // Test OGRCoordinateTransformation in pure "C" API
 // OCTClone/OCTGetSourceCS/OCTGetTargetCS/OCTGetInverse
 TEST_F(test_osr_ct, OGRCoordinateTransformation_C_API)
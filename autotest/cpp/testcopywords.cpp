@@ -30,8 +30,10 @@
 #include "cpl_conv.h"
 #include "gdal.h"
 
+#include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 
 #include "gtest_include.h"
 
@@ -789,6 +791,83 @@ void CheckPacked<GUInt16, GInt16>(GDALDataType eIn, GDALDataType eOut)
     }
 }
 
+template <>
+void CheckPacked<float, GByte>(GDALDataType eIn, GDALDataType eOut)
+{
+    CheckPackedGeneric<float, GByte>(eIn, eOut);
+
+    const int N = 64 + 7;
+    float arrayIn[N] = {0};
+    GByte arrayOut[N] = {0};
+    const float afValues[] = {-1.0f,   0.49f,  0.5f, 1.5f,
+                              254.49f, 254.5f, 255.5f, 1e10f,
+                              std::numeric_limits<float>::quiet_NaN()};
+    const GByte abyExpected[] = {0, 0, 1, 2, 254, 255, 255, 255, 0};
+    constexpr int NVALUES = static_cast<int>(CPL_ARRAYSIZE(afValues));
+    for (int i = 0; i < N; i++)
+    {
+        arrayIn[i] = afValues[i % NVALUES];
+    }
+    GDALCopyWords(arrayIn, eIn, GDALGetDataTypeSizeBytes(eIn), arrayOut, eOut,
+                  GDALGetDataTypeSizeBytes(eOut), N);
+    for (int i = 0; i < N; i++)
+    {
+        EXPECT_EQ(arrayOut[i], abyExpected[i % NVALUES]) << i;
+    }
+}
+
+template <>
+void CheckPacked<float, GUInt16>(GDALDataType eIn, GDALDataType eOut)
+{
+    CheckPackedGeneric<float, GUInt16>(eIn, eOut);
+
+    const int N = 64 + 7;
+    float arrayIn[N] = {0};
+    GUInt16 arrayOut[N] = {0};
+    const float afValues[] = {-1.0f, 0.49f, 0.5f, 65534.5f, 1e10f,
+                              std::numeric_limits<float>::quiet_NaN()};
+    const GUInt16 anExpected[] = {0, 0, 1, 65535, 65535, 0};
+    constexpr int NVALUES = static_cast<int>(CPL_ARRAYSIZE(afValues));
+    for (int i = 0; i < N; i++)
+    {
+        arrayIn[i] = afValues[i % NVALUES];
+    }
+    GDALCopyWords(arrayIn, eIn, GDALGetDataTypeSizeBytes(eIn), arrayOut, eOut,
+                  GDALGetDataTypeSizeBytes(eOut), N);
+    for (int i = 0; i < N; i++)
+    {
+        EXPECT_EQ(arrayOut[i], anExpected[i % NVALUES]) << i;
+    }
+}
+
+template <>
+void CheckPacked<double, float>(GDALDataType eIn, GDALDataType eOut)
+{
+    CheckPackedGeneric<double, float>(eIn, eOut);
+
+    const int N = 64 + 7;
+    double arrayIn[N] = {0};
+    float arrayOut[N] = {0};
+    // Second value is greater than FLT_MAX, but would be rounded to it
+    const double adfValues[] = {1e39, 3.4028235e+38, -1e39, 1.5,
+                                -0.25};
+    const float afExpected[] = {std::numeric_limits<float>::infinity(),
+                                std::numeric_limits<float>::infinity(),
+                                -std::numeric_limits<float>::infinity(), 1.5f,
+                                -0.25f};
+    constexpr int NVALUES = static_cast<int>(CPL_ARRAYSIZE(adfValues));
+    for (int i = 0; i < N; i++)
+    {
+        arrayIn[i] = adfValues[i % NVALUES];
+    }
+    GDALCopyWords(arrayIn, eIn, GDALGetDataTypeSizeBytes(eIn), arrayOut, eOut,
+                  GDALGetDataTypeSizeBytes(eOut), N);
+    for (int i = 0; i < N; i++)
+    {
+        EXPECT_EQ(arrayOut[i], afExpected[i % NVALUES]) << i;
+    }
+}
+
 template <class Tin> void CheckPacked(GDALDataType eIn, GDALDataType eOut)
 {
     switch (eOut)
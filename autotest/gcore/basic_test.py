@@ -965,3 +965,22 @@ def test_band_getitem():
 
     with pytest.raises(IndexError):
         ds[5]
+
+
+###############################################################################
+# Test that GDALOpenEx() takes into account changes of the driver capabilities
+
+
+def test_basic_open_driver_capabilities_changed():
+
+    drv = gdal.GetDriverByName("AAIGrid")
+    md = drv.GetMetadata()
+    assert gdal.Open("data/testserialization.asc") is not None
+    try:
+        drv.SetMetadata({k: v for k, v in md.items() if k != gdal.DCAP_OPEN})
+        with pytest.raises(Exception):
+            gdal.OpenEx("data/testserialization.asc", allowed_drivers=["AAIGrid"])
+    finally:
+        drv.SetMetadata(md)
+    ds = gdal.Open("data/testserialization.asc")
+    assert ds.GetDriver().ShortName == "AAIGrid"
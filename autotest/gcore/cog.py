@@ -1922,3 +1922,34 @@ def test_cog_stats(tmp_vsimem, nbands, co, src_has_stats, expected_val):
     if expected_val and ds.RasterCount == 2:
         assert ds.GetRasterBand(2).GetMetadataItem("STATISTICS_MINIMUM") == "255"
     ds = None
+
+
+###############################################################################
+# Test that the strile size is read from the block leader when reading
+# single blocks
+
+
+def test_cog_read_block_leader(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "out.tif")
+    src_ds = gdal.Open("data/byte.tif")
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["BLOCKSIZE=16", "COMPRESS=DEFLATE"]
+    )
+
+    def read_blocks():
+        ds = gdal.Open(filename)
+        band = ds.GetRasterBand(1)
+        sizes = []
+        blocks = []
+        for y in range(2):
+            for x in range(2):
+                sizes.append(band.GetMetadataItem(f"BLOCK_SIZE_{x}_{y}", "TIFF"))
+                blocks.append(band.ReadBlock(x, y))
+        return sizes, blocks
+
+    ref_sizes, ref_blocks = read_blocks()
+    with gdal.config_option("GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", "YES"):
+        sizes, blocks = read_blocks()
+    assert sizes == ref_sizes
+    assert blocks == ref_blocks
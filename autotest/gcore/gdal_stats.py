@@ -905,3 +905,119 @@ def test_stats_mask_band():
     assert src_ds.GetRasterBand(1).ComputeRasterMinMax(False) == (2, 3)
     assert src_ds.GetRasterBand(1).ComputeStatistics(False) == [2, 3, 2.5, 0.5]
     assert src_ds.GetRasterBand(1).GetHistogram(False) == [0, 0, 1, 1] + ([0] * 252)
+
+
+###############################################################################
+# Test that processing blocks in parallel gives the same results
+
+
+@pytest.mark.parametrize(
+    "datatype",
+    [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16, gdal.GDT_Float32],
+)
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_stats_num_threads(datatype, with_mask):
+
+    width = 100
+    height = 50
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        struct.pack(
+            "B" * (width * height), *[(i * 7) % 251 for i in range(width * height)]
+        ),
+        buf_type=gdal.GDT_Byte,
+    )
+    if with_mask:
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            struct.pack(
+                "B" * (width * height),
+                *[255 if (i % 3) else 0 for i in range(width * height)]
+            ),
+        )
+    band = ds.GetRasterBand(1)
+
+    def compute():
+        return (
+            band.ComputeRasterMinMax(False),
+            band.ComputeStatistics(False),
+            band.GetHistogram(-0.5, 255.5, 256, False, False),
+        )
+
+    ref_minmax, ref_stats, ref_hist = compute()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        minmax, stats, hist = compute()
+    assert minmax == ref_minmax
+    assert stats == pytest.approx(ref_stats, rel=1e-12)
+    assert hist == ref_hist
+
+
+###############################################################################
+# Test that blocks reported as uniform by the driver (missing blocks of a
+# sparse GeoTIFF file) give the same results as regular blocks
+
+
+@pytest.mark.parametrize(
+    "datatype,nodata",
+    [
+        (gdal.GDT_Byte, None),
+        (gdal.GDT_Byte, 0),
+        (gdal.GDT_Byte, 10),
+        (gdal.GDT_UInt16, 10),
+        (gdal.GDT_Int16, -1),
+        (gdal.GDT_Float32, -9999),
+        (gdal.GDT_Float64, float("nan")),
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_stats_uniform_blocks(tmp_vsimem, datatype, nodata, num_threads):
+
+    filename = str(tmp_vsimem / "test_stats_uniform_blocks.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        100,
+        50,
+        1,
+        datatype,
+        options=["SPARSE_OK=YES", "TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+    ds.GetRasterBand(1).WriteRaster(
+        20,
+        10,
+        30,
+        20,
+        struct.pack("B" * 600, *[(i * 7) % 251 for i in range(600)]),
+        buf_type=gdal.GDT_Byte,
+    )
+    ds = None
+
+    ds = gdal.Open(filename)
+    ref_ds = gdal.GetDriverByName("MEM").CreateCopy("", ds)
+
+    def compute(band):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            return (
+                band.ComputeRasterMinMax(False),
+                band.ComputeStatistics(False),
+                band.GetHistogram(-0.5, 255.5, 256, False, False),
+                band.GetHistogram(-0.5, 255.5, 256, True, False),
+            )
+
+    minmax, stats, hist, hist_out_of_range = compute(ds.GetRasterBand(1))
+    ref_minmax, ref_stats, ref_hist, ref_hist_out_of_range = compute(
+        ref_ds.GetRasterBand(1)
+    )
+    assert minmax == ref_minmax
+    assert stats == pytest.approx(ref_stats, rel=1e-12)
+    assert hist == ref_hist
+    assert hist_out_of_range == ref_hist_out_of_range
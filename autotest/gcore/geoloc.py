@@ -260,7 +260,7 @@ def test_geoloc_error_cases():
 
 @pytest.mark.parametrize("step", [1, 2])
 @pytest.mark.parametrize("convention", ["TOP_LEFT_CORNER", "PIXEL_CENTER"])
-@pytest.mark.parametrize("inverse_method", ["BACKMAP", "QUADTREE"])
+@pytest.mark.parametrize("inverse_method", ["BACKMAP", "QUADTREE", "GRID"])
 def test_geoloc_affine_transformation(step, convention, inverse_method):
 
     shift = 0.5 if convention == "PIXEL_CENTER" else 0
@@ -322,7 +322,12 @@ def test_geoloc_affine_transformation(step, convention, inverse_method):
 
 @pytest.mark.parametrize("step", [1, 2])
 @pytest.mark.parametrize("convention", ["TOP_LEFT_CORNER", "PIXEL_CENTER"])
-def test_geoloc_affine_transformation_with_noise(step, convention):
+@pytest.mark.parametrize(
+    "inverse_method,num_threads", [("BACKMAP", 1), ("GRID", 1), ("GRID", 4)]
+)
+def test_geoloc_affine_transformation_with_noise(
+    step, convention, inverse_method, num_threads
+):
 
     r = random.Random(0)
 
@@ -367,7 +372,8 @@ def test_geoloc_affine_transformation_with_noise(step, convention):
         "GEOREFERENCING_CONVENTION": convention,
     }
     ds.SetMetadata(md, "GEOLOCATION")
-    tr = gdal.Transformer(ds, None, [])
+    with gdaltest.config_option("GDAL_GEOLOC_INVERSE_METHOD", inverse_method):
+        tr = gdal.Transformer(ds, None, ["NUM_THREADS=%d" % num_threads])
 
     def check_point(x, y):
         success, pnt = tr.TransformPoint(False, x, y)
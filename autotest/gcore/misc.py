@@ -29,6 +29,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import json
 import os
 import shutil
 
@@ -989,6 +990,25 @@ def test_misc_general_cmd_line_processor(tmp_path):
     assert processed == ["program", "2", str(tmp_path / "a_path"), "a_string"]
 
 
+###############################################################################
+# Test per-subsystem memory accounting
+
+
+def test_misc_memory_accounting():
+
+    gdal.MemoryAccountingResetHighWaterMarks()
+    ds = gdal.Open("data/byte.tif")
+    ds.GetRasterBand(1).ReadRaster()
+    stats = json.loads(gdal.MemoryAccountingGetAsSerializedJSON())
+    assert stats["subsystems"]["block_cache"]["usage"] >= 400
+    assert stats["subsystems"]["block_cache"]["high_water_mark"] >= 400
+    assert stats["total"]["usage"] >= stats["subsystems"]["block_cache"]["usage"]
+
+    ds = None
+    stats = json.loads(gdal.MemoryAccountingGetAsSerializedJSON())
+    assert stats["subsystems"]["block_cache"]["high_water_mark"] >= 400
+
+
 ###############################################################################
 
 
@@ -1015,3 +1015,99 @@ def test_numpy_rw_masked_array_2():
     assert numpy.all(masked_arr.mask[mask != 255])
 
     assert masked_arr.sum() == arr[mask == 255].sum()
+
+
+###############################################################################
+# Test Band.ReadMultiWindowAsArray()
+
+
+def test_numpy_rw_band_read_multi_window_as_array():
+
+    ds = gdal.GetDriverByName("MEM").Create("", 20, 10, 1, gdal.GDT_UInt16)
+    ref = numpy.arange(200, dtype=numpy.uint16).reshape(10, 20)
+    ds.WriteArray(ref)
+    band = ds.GetRasterBand(1)
+
+    ars = band.ReadMultiWindowAsArray([(1, 2, 3, 2), (0, 0, 20, 10)])
+    assert len(ars) == 2
+    assert ars[0].dtype == numpy.uint16
+    numpy.testing.assert_array_equal(ars[0], ref[2:4, 1:4])
+    numpy.testing.assert_array_equal(ars[1], ref)
+
+    ars = band.ReadMultiWindowAsArray([(1, 2, 3, 2)], buf_type=gdal.GDT_Float64)
+    assert ars[0].dtype == numpy.float64
+    numpy.testing.assert_array_equal(ars[0], ref[2:4, 1:4])
+
+    assert band.ReadMultiWindowAsArray([]) == []
+
+    # Read into non-contiguous views of a preallocated array, with
+    # resampling for the second window
+    big = numpy.zeros((10, 30), dtype=numpy.int32)
+    views = [big[0:4:2, 0:9:3], big[5:10, 10:30]]
+    ars = band.ReadMultiWindowAsArray([(1, 2, 3, 2), (0, 0, 20, 10)], views)
+    assert ars[0] is views[0] and ars[1] is views[1]
+    numpy.testing.assert_array_equal(big[0:4:2, 0:9:3], ref[2:4, 1:4])
+    numpy.testing.assert_array_equal(big[5:10, 10:30], ref[::2, :])
+    assert big[1, 0] == 0
+
+    with pytest.raises(Exception, match="out of range"):
+        band.ReadMultiWindowAsArray([(15, 0, 10, 1)])
+
+    with pytest.raises(Exception, match="as many arrays as windows"):
+        band.ReadMultiWindowAsArray([(0, 0, 1, 1)], [])
+
+    with pytest.raises(Exception, match="same data type"):
+        band.ReadMultiWindowAsArray(
+            [(0, 0, 1, 1), (0, 0, 1, 1)],
+            [numpy.empty((1, 1), numpy.uint8), numpy.empty((1, 1), numpy.uint16)],
+        )
+
+    with pytest.raises(Exception, match="non-writeable"):
+        ar = numpy.empty((1, 1), numpy.uint8)
+        ar.setflags(write=False)
+        band.ReadMultiWindowAsArray([(0, 0, 1, 1)], [ar])
+
+
+###############################################################################
+# Test reading into a shared preallocated array from several Python threads
+
+
+def test_numpy_rw_band_read_as_array_from_threads():
+
+    import threading
+
+    ref = gdal.Open("data/byte.tif").ReadAsArray()
+    nthreads = 4
+    out = numpy.zeros((ref.shape[0], ref.shape[1] * nthreads), dtype=numpy.uint8)
+    errors = []
+
+    def read(i):
+        try:
+            ds = gdal.Open("data/byte.tif")
+            band = ds.GetRasterBand(1)
+            half = ref.shape[0] // 2
+            band.ReadAsArray(
+                0,
+                0,
+                ref.shape[1],
+                half,
+                buf_obj=out[0:half, i * ref.shape[1] : (i + 1) * ref.shape[1]],
+            )
+            band.ReadMultiWindowAsArray(
+                [(0, half, ref.shape[1], ref.shape[0] - half)],
+                [out[half:, i * ref.shape[1] : (i + 1) * ref.shape[1]]],
+            )
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=read, args=(i,)) for i in range(nthreads)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert not errors
+    for i in range(nthreads):
+        numpy.testing.assert_array_equal(
+            out[:, i * ref.shape[1] : (i + 1) * ref.shape[1]], ref
+        )
@@ -29,6 +29,7 @@
 ###############################################################################
 
 import math
+import re
 
 import gdaltest
 import pytest
@@ -1464,4 +1465,123 @@ def test_pixfun_max_no_nodata():
     assert ar[10][12] == 255
 
 
+###############################################################################
+# Test expression pixel function
+
+
+def _get_expression_vrt(expression, nodata=None, dataType="Float64"):
+
+    return f"""<VRTDataset rasterXSize="20" rasterYSize="20">
+  <VRTRasterBand dataType="{dataType}" band="1" subClass="VRTDerivedRasterBand">
+    {'<NoDataValue>%s</NoDataValue>' % nodata if nodata is not None else ''}
+    <PixelFunctionType>expression</PixelFunctionType>
+    <PixelFunctionArguments expression="{expression}" />
+    <SourceTransferType>Float64</SourceTransferType>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">data/byte.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">data/float32.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>"""
+
+
+@pytest.mark.parametrize(
+    "expression,expected",
+    [
+        ("B1 + 2 * B2", lambda b1, b2: b1 + 2 * b2),
+        ("(B1 - B2) / (B1 + B2)", lambda b1, b2: (b1 - b2) / (b1 + b2)),
+        ("B1 &gt; 120 ? B1 : -B2", lambda b1, b2: numpy.where(b1 > 120, b1, -b2)),
+        (
+            "B1 &lt;= 107 &amp;&amp; B2 != 132 || !B1",
+            lambda b1, b2: ((b1 <= 107) & (b2 != 132)).astype(float),
+        ),
+        (
+            "min(B1, B2, 115) + max(B1, B2)",
+            lambda b1, b2: numpy.minimum(numpy.minimum(b1, b2), 115)
+            + numpy.maximum(b1, b2),
+        ),
+        ("2 ^ 3 ^ 0.5 + B1 % 7", lambda b1, b2: 2 ** (3**0.5) + numpy.fmod(b1, 7)),
+        (
+            "sqrt(abs(B1 - B2)) + log10(B1) + floor(B2 / 3) + atan2(B1, B2) + pi",
+            lambda b1, b2: numpy.sqrt(numpy.abs(b1 - b2))
+            + numpy.log10(b1)
+            + numpy.floor(b2 / 3)
+            + numpy.arctan2(b1, b2)
+            + math.pi,
+        ),
+    ],
+)
+def test_pixfun_expression(expression, expected):
+
+    b1 = gdal.Open("data/byte.tif").ReadAsArray().astype(float)
+    b2 = gdal.Open("data/float32.tif").ReadAsArray().astype(float)
+
+    ds = gdal.Open(_get_expression_vrt(expression))
+    assert numpy.allclose(ds.ReadAsArray(), expected(b1, b2))
+
+    # Check that reading without block alignment gives the same result
+    assert numpy.allclose(ds.ReadAsArray(3, 5, 11, 7), expected(b1, b2)[5:12, 3:14])
+
+
+def test_pixfun_expression_nodata():
+
+    b1 = gdal.Open("data/byte.tif").ReadAsArray()
+
+    ds = gdal.Open(
+        _get_expression_vrt("B1 == 107 ? NoData : B1", nodata=255, dataType="Byte")
+    )
+    assert numpy.array_equal(ds.ReadAsArray(), numpy.where(b1 == 107, 255, b1))
+
+    ds = gdal.Open(_get_expression_vrt("NoData"))
+    with pytest.raises(Exception):
+        ds.ReadAsArray()
+
+
+@pytest.mark.parametrize(
+    "expression,message",
+    [
+        ("B1 +", "unexpected end of expression"),
+        ("B1 B2", "unexpected character"),
+        ("(B1", "')' expected"),
+        ("B1 ? 1", "':' expected"),
+        ("foo", "unknown variable 'foo'"),
+        ("B0", "unknown variable 'B0'"),
+        ("B3", "B3 is referenced, but there are only 2 source(s)"),
+        ("bar(B1)", "unknown function 'bar'"),
+        ("sqrt(B1, B2)", "wrong number of arguments for function 'sqrt'"),
+        ("min(B1)", "wrong number of arguments for function 'min'"),
+        ("(" * 1000 + "B1" + ")" * 1000, "too many nested levels"),
+        ("-" * 1000 + "B1", "too many nested levels"),
+    ],
+)
+def test_pixfun_expression_errors(expression, message):
+
+    ds = gdal.Open(_get_expression_vrt(expression))
+    with pytest.raises(Exception, match=re.escape(message)):
+        ds.ReadAsArray()
+
+
+def test_pixfun_expression_missing_argument():
+
+    ds = gdal.Open(
+        """<VRTDataset rasterXSize="20" rasterYSize="20">
+  <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>expression</PixelFunctionType>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">data/byte.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>"""
+    )
+    with pytest.raises(
+        Exception, match="Missing pixel function argument: expression"
+    ):
+        ds.ReadAsArray()
+
+
 ###############################################################################
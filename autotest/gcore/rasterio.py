@@ -3282,3 +3282,57 @@ def test_rasterio_overview_selection():
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 29, 29)[0] == 2
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 25, 25)[0] == 3
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 24, 24)[0] == 3
+
+
+###############################################################################
+# Test GDALDatasetCopyWholeRaster() with a pipelined reader thread
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+@pytest.mark.parametrize("depth", ["1", "2", "4"])
+def test_rasterio_copy_whole_raster_pipelined(tmp_vsimem, interleave, depth):
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", width=1000, height=1000
+    )
+    ref_checksums = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    # Small swaths so that the copy is split in several of them
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "1000000", "GDAL_COPY_PIPELINE_DEPTH": depth}
+    ):
+        gdal.GetDriverByName("GTiff").CreateCopy(
+            out_filename,
+            src_ds,
+            options=["COMPRESS=DEFLATE", "TILED=YES", "INTERLEAVE=" + interleave],
+        )
+
+    ds = gdal.Open(out_filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == ref_checksums
+
+
+###############################################################################
+# Test that resampled RasterIO() gives the same result with multithreading
+
+
+@pytest.mark.parametrize(
+    "resample_alg",
+    [gdal.GRIORA_Bilinear, gdal.GRIORA_Cubic, gdal.GRIORA_Average, gdal.GRIORA_Mode],
+)
+@pytest.mark.parametrize("with_nodata", [False, True])
+def test_rasterio_resampled_multithreaded(resample_alg, with_nodata):
+
+    ds = gdal.Translate("", "data/byte.tif", format="MEM", width=2000, height=1500)
+    if with_nodata:
+        ds.GetRasterBand(1).SetNoDataValue(107)
+    band = ds.GetRasterBand(1)
+
+    def read():
+        return band.ReadRaster(
+            buf_xsize=400, buf_ysize=300, resample_alg=resample_alg
+        )
+
+    ref = read()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert read() == ref
@@ -178,3 +178,73 @@ def test_rat_4():
 
 
 ##############################################################################
+# Test ValuesIO() on a subset of rows
+
+
+def test_rat_values_io_subset():
+
+    numpy = pytest.importorskip("numpy")
+    pytest.importorskip("osgeo.gdal_array")
+
+    rat = gdal.RasterAttributeTable()
+    rat.CreateColumn("int", gdal.GFT_Integer, gdal.GFU_Generic)
+    rat.CreateColumn("real", gdal.GFT_Real, gdal.GFU_Generic)
+    rat.CreateColumn("str", gdal.GFT_String, gdal.GFU_Generic)
+    rat.SetRowCount(5)
+
+    rat.WriteArray(numpy.array([10, 11, 12]), 0, start=2)
+    rat.WriteArray(numpy.array([1.5, 2.5]), 1, start=3)
+    rat.WriteArray(numpy.array([7, 8]), 2, start=1)
+
+    assert list(rat.ReadAsArray(0)) == [0, 0, 10, 11, 12]
+    assert list(rat.ReadAsArray(0, start=3, length=2)) == [11, 12]
+    assert list(rat.ReadAsArray(1, start=3)) == [1.5, 2.5]
+    assert rat.GetValueAsString(2, 2) == "8"
+
+    with pytest.raises(Exception):
+        rat.ReadAsArray(0, start=4, length=2)
+
+
+###############################################################################
+# Test GetRowOfValue() with the different combinations of Min/Max columns
+
+
+@pytest.mark.parametrize(
+    "usages,values,expected",
+    [
+        # MinMax column, with a duplicate value
+        ([gdal.GFU_MinMax], [[5, 3, 5, 1]], {5: 0, 3: 1, 1: 3, 2: -1}),
+        # Min column only: first row whose min is <= value
+        ([gdal.GFU_Min], [[10, 0, 20]], {-1: -1, 0: 1, 15: 0, 25: 0}),
+        # Max column only: first row whose max is >= value
+        ([gdal.GFU_Max], [[10, 30, 20]], {40: -1, 25: 1, 15: 1, 5: 0}),
+        # Disjoint intervals
+        (
+            [gdal.GFU_Min, gdal.GFU_Max],
+            [[20, 0, 10], [29, 9, 19]],
+            {-1: -1, 0: 1, 9.5: -1, 15: 2, 29: 0, 30: -1},
+        ),
+        # Overlapping intervals
+        (
+            [gdal.GFU_Min, gdal.GFU_Max],
+            [[5, 0, 10], [15, 9, 19]],
+            {-1: -1, 0: 1, 7: 0, 12: 0, 16: 2, 20: -1},
+        ),
+    ],
+)
+def test_rat_get_row_of_value(usages, values, expected):
+
+    rat = gdal.RasterAttributeTable()
+    for i, usage in enumerate(usages):
+        rat.CreateColumn("col%d" % i, gdal.GFT_Real, usage)
+    for i, col_values in enumerate(values):
+        for row, value in enumerate(col_values):
+            rat.SetValueAsDouble(row, i, value)
+
+    for value, row in expected.items():
+        assert rat.GetRowOfValue(value) == row, value
+
+    # Check that modifications are taken into account
+    rat.SetValueAsDouble(0, 0, 1000)
+    if usages[0] != gdal.GFU_Max:
+        assert rat.GetRowOfValue(1000) == (0 if len(usages) == 1 else -1)
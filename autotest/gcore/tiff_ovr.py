@@ -720,6 +720,37 @@ def test_tiff_ovr_mode_multiband(multiband, read_only):
     gdal.GetDriverByName("GTiff").Delete("/vsimem/test.tif")
 
 
+###############################################################################
+# Check mode resampling on non-Byte data types with a large window
+
+
+@pytest.mark.parametrize(
+    "datatype", [gdal.GDT_UInt16, gdal.GDT_Int16, gdal.GDT_Float32, gdal.GDT_Float64]
+)
+def test_tiff_ovr_mode_large_window(datatype):
+
+    # Pseudo-random classes from 1 to 7
+    vals = [1 + (i * 37 + (i // 16) * 11) % 7 for i in range(256)]
+
+    # Expected value: first one to reach the maximum count, in scan order.
+    counts = {}
+    expected = None
+    max_count = 0
+    for v in vals:
+        counts[v] = counts.get(v, 0) + 1
+        if counts[v] > max_count:
+            max_count = counts[v]
+            expected = v
+
+    ds = gdal.GetDriverByName("MEM").Create("", 16, 16, 1, datatype)
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, 16, 16, struct.pack("B" * 256, *vals), buf_type=gdal.GDT_Byte
+    )
+    ds.BuildOverviews("MODE", [16])
+    ovr = ds.GetRasterBand(1).GetOverview(0)
+    assert struct.unpack("B", ovr.ReadRaster(buf_type=gdal.GDT_Byte))[0] == expected
+
+
 ###############################################################################
 # Check that we can create overviews on a newly create file (#2621)
 
@@ -2919,3 +2950,68 @@ def test_tiff_ovr_JXL_ALPHA_DISTANCE_OVERVIEW(tmp_vsimem):
     assert ds.GetRasterBand(4).Checksum() != cs4
     del ds
     gdal.Unlink(tmpfilename + ".ovr")
+
+
+###############################################################################
+# Test that keeping an overview level in memory to compute the next one
+# gives the same result as reading it back
+
+
+@pytest.mark.parametrize("resampling", ["NEAREST", "AVERAGE", "CUBIC"])
+def test_tiff_ovr_level_in_memory(tmp_vsimem, resampling):
+
+    src_ds = gdal.Open("data/stefan_full_rgba.tif")
+    checksums = []
+    for max_size in ["0", None]:
+        tmpfilename = str(tmp_vsimem / "test_tiff_ovr_level_in_memory.tif")
+        ds = gdal.Translate(
+            tmpfilename,
+            src_ds,
+            bandList=[1, 2, 3],
+            creationOptions=["INTERLEAVE=PIXEL", "COMPRESS=DEFLATE"],
+        )
+        with gdal.config_option("GDAL_OVR_LEVEL_IN_MEMORY_MAX_SIZE", max_size):
+            ds.BuildOverviews(resampling, [2, 4, 8])
+        checksums.append(
+            [
+                [ds.GetRasterBand(i + 1).GetOverview(j).Checksum() for j in range(3)]
+                for i in range(3)
+            ]
+        )
+        ds = None
+        gdal.Unlink(tmpfilename)
+    assert checksums[0] == checksums[1]
+
+
+###############################################################################
+# Test GDAL_CACHED_VIRTUAL_OVERVIEWS on a dataset without overviews
+
+
+def test_tiff_ovr_cached_virtual_overviews(tmp_vsimem):
+
+    tmpfilename = str(tmp_vsimem / "test_tiff_ovr_cached_virtual_overviews.tif")
+    gdal.Translate(tmpfilename, "data/byte.tif", width=1000, height=600)
+
+    ds = gdal.Open(tmpfilename)
+    assert ds.GetRasterBand(1).GetOverviewCount() == 0
+    expected = ds.GetRasterBand(1).ReadRaster(buf_xsize=500, buf_ysize=300)
+    ds = None
+
+    with gdal.config_option("GDAL_CACHED_VIRTUAL_OVERVIEWS", "YES"):
+        ds = gdal.Open(tmpfilename)
+        band = ds.GetRasterBand(1)
+        assert band.GetOverviewCount() == 2
+        assert band.GetOverview(0).XSize == 500
+        assert band.GetOverview(0).YSize == 300
+        assert band.GetOverview(1).XSize == 250
+        assert band.GetOverview(1).YSize == 150
+        assert band.GetOverview(0).ReadRaster() == expected
+        assert band.ReadRaster(buf_xsize=500, buf_ysize=300) == expected
+        assert ds.ReadRaster(buf_xsize=500, buf_ysize=300) == expected
+        assert band.GetOverview(1).Checksum() != 0
+        ds = None
+
+        # Not in update mode
+        ds = gdal.Open(tmpfilename, gdal.GA_Update)
+        assert ds.GetRasterBand(1).GetOverviewCount() == 0
+        ds = None
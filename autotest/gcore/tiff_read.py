@@ -1211,6 +1211,99 @@ def test_tiff_read_vsicurl_multirange():
         gdal.VSICurlClearCache()
 
 
+###############################################################################
+# Test that Band.ReadMultiWindowAsArray() fetches all the tiles of the batch
+# with a single multi-range request, and that the per-window reads do not
+# issue their own requests
+
+
+@pytest.mark.require_curl()
+def test_tiff_read_vsicurl_read_multi_window(tmp_vsimem):
+
+    np = pytest.importorskip("numpy")
+    pytest.importorskip("osgeo.gdal_array")
+
+    filename = str(tmp_vsimem / "multi_window.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        1024,
+        1024,
+        options=["TILED=YES", "BLOCKXSIZE=256", "BLOCKYSIZE=256"],
+    )
+    ref = (np.arange(1024 * 1024, dtype=np.uint32) % 251).astype(np.uint8)
+    ref = ref.reshape(1024, 1024)
+    src_ds.GetRasterBand(1).WriteArray(ref)
+    src_ds = None
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, gdal.VSIStatL(filename).size, f)
+    gdal.VSIFCloseL(f)
+
+    class RangeHandler:
+        def __init__(self):
+            self.get_count = 0
+
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(data))
+            request.end_headers()
+
+        def do_GET(self, request):
+            self.get_count += 1
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), len(data) - 1)
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header("Content-type", "application/octet-stream")
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(data))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(data[start : end + 1])
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    try:
+        handler = RangeHandler()
+        with webserver.install_http_handler(handler), gdaltest.config_options(
+            {
+                "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            }
+        ):
+            ds = gdal.Open(
+                "/vsicurl/http://127.0.0.1:%d/multi_window.tif" % webserver_port
+            )
+            assert ds is not None
+
+            # Tiles 0 and 15 are not contiguous: one GET request per tile
+            handler.get_count = 0
+            ars = ds.GetRasterBand(1).ReadMultiWindowAsArray(
+                [(0, 0, 256, 256), (768, 768, 256, 256)]
+            )
+            assert handler.get_count == 2
+            ds = None
+
+        np.testing.assert_array_equal(ars[0], ref[0:256, 0:256])
+        np.testing.assert_array_equal(ars[1], ref[768:1024, 768:1024])
+
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+
+        gdal.VSICurlClearCache()
+
+
 ###############################################################################
 # Test reading a TIFF made of a single-strip that is more than 2GB (#5403)
 
@@ -4844,6 +4937,15 @@ def test_tiff_jxl_read_for_files_created_before_6393():
             gdal.GDT_Byte,
             ["COMPRESS=PACKBITS", "BLOCKYSIZE=18"],
         ),
+        (
+            False,
+            False,
+            100,
+            100,
+            3,
+            gdal.GDT_Byte,
+            ["COMPRESS=DEFLATE", "BLOCKYSIZE=3", "INTERLEAVE=BAND"],
+        ),  # many small strips, with a shorter last one, band interleaved
     ],
 )
 def test_tiff_read_multi_threaded(
@@ -5230,3 +5332,75 @@ def test_tiff_read_jpeg_cached_multi_range_issue_9563(tmp_vsimem):
     out = str(tmp_vsimem / "out.tif")
     with gdal.config_option("GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", "YES"):
         gdal.Translate(out, vrt, options="-tr 0.000071806 0.000071806 -f COG")
+
+
+###############################################################################
+# Test GTIFF_METADATA_CACHE_SIZE
+
+
+def test_tiff_read_metadata_cache(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+
+    def create(width, epsg):
+        ds = gdal.GetDriverByName("GTiff").Create(filename, width, 1)
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(epsg)
+        ds.SetSpatialRef(srs)
+        ds.SetGeoTransform([2, 1, 0, 49, 0, -1])
+        ds.SetMetadataItem("AREA_OR_POINT", "Point")
+        ds = None
+
+    create(1, 32631)
+
+    with gdal.config_option("GTIFF_METADATA_CACHE_SIZE", "10"):
+        for i in range(2):
+            ds = gdal.Open(filename)
+            assert ds.GetSpatialRef().GetAuthorityCode(None) == "32631"
+            assert ds.GetMetadataItem("AREA_OR_POINT") == "Point"
+            ds = None
+
+        # Changing the file invalidates the cached entry
+        create(2, 4326)
+        ds = gdal.Open(filename)
+        assert ds.GetSpatialRef().GetAuthorityCode(None) == "4326"
+        ds = None
+
+
+###############################################################################
+# Test GDAL_COMPRESSED_BLOCK_CACHEMAX
+
+
+def test_tiff_read_compressed_block_cache(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.Translate(
+        filename,
+        "data/byte.tif",
+        options="-co TILED=YES -co BLOCKXSIZE=16 -co BLOCKYSIZE=16 -co COMPRESS=LZW",
+    )
+
+    # Second iteration decodes blocks from the compressed block cache
+    with gdal.config_option("GDAL_COMPRESSED_BLOCK_CACHEMAX", "1"):
+        for i in range(2):
+            ds = gdal.Open(filename)
+            assert ds.GetRasterBand(1).Checksum() == 4672
+            ds = None
+
+        # Blocks of a file modified in update mode must not be reused
+        ds = gdal.Open(filename, gdal.GA_Update)
+        ds.GetRasterBand(1).Fill(1)
+        ds = None
+        ds = gdal.Open(filename)
+        assert ds.GetRasterBand(1).Checksum() == 400
+        ds = None
+
+        # Nor those of a file overwritten by another one
+        gdal.Translate(
+            filename,
+            "data/byte.tif",
+            options="-co TILED=YES -co BLOCKXSIZE=16 -co BLOCKYSIZE=16 -co COMPRESS=LZW",
+        )
+        ds = gdal.Open(filename)
+        assert ds.GetRasterBand(1).Checksum() == 4672
+        ds = None
@@ -1529,6 +1529,40 @@ def test_tiff_write_43():
     return tiff_write_big_odd_bits("data/uint32_3band.vrt", "tmp/tw_43.tif", 24, "BAND")
 
 
+###############################################################################
+# Test exact round-trip of odd bit depths, with widths that do not end on a
+# byte boundary
+
+
+@pytest.mark.parametrize("nbits", [2, 4, 10, 12, 14, 20])
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_tiff_write_odd_bits_roundtrip(tmp_vsimem, nbits, interleave):
+
+    if nbits <= 8:
+        dt, fmt = gdal.GDT_Byte, "B"
+    elif nbits <= 16:
+        dt, fmt = gdal.GDT_UInt16, "H"
+    else:
+        dt, fmt = gdal.GDT_UInt32, "I"
+    width, height = 37, 5
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 3, dt)
+    for i in range(3):
+        values = [(j * 7919 + i * 31) % (1 << nbits) for j in range(width * height)]
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, width, height, struct.pack(fmt * len(values), *values)
+        )
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdaltest.tiff_drv.CreateCopy(
+        filename, src_ds, options=["NBITS=%d" % nbits, "INTERLEAVE=" + interleave]
+    )
+    ds = gdal.Open(filename)
+    for i in range(3):
+        assert ds.GetRasterBand(i + 1).ReadRaster() == src_ds.GetRasterBand(
+            i + 1
+        ).ReadRaster()
+
+
 ###############################################################################
 # Test create with NBITS=9 and preservation through CreateCopy of NBITS
 
@@ -9624,6 +9658,36 @@ def test_tiff_write_jpegxl_uint16_single_band():
     ut.testCreateCopy()
 
 
+###############################################################################
+# Test JXL compression of a single tile raster with several threads
+
+
+@pytest.mark.require_creation_option("GTiff", "JXL")
+def test_tiff_write_jpegxl_single_tile_multithreaded():
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = "/vsimem/test_tiff_write_jpegxl_single_tile_multithreaded.tif"
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        gdal.GetDriverByName("GTiff").CreateCopy(
+            filename,
+            src_ds,
+            options=[
+                "COMPRESS=JXL",
+                "JXL_LOSSLESS=YES",
+                "TILED=YES",
+                "BLOCKXSIZE=64",
+                "BLOCKYSIZE=64",
+            ],
+        )
+        ds = gdal.Open(filename)
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ]
+        ds = None
+
+    gdal.Unlink(filename)
+
+
 ###############################################################################
 # Test JXL_ALPHA_DISTANCE option
 
@@ -9649,6 +9713,83 @@ def test_tiff_write_jpegxl_alpha_distance_zero():
     gdal.Unlink(filename)
 
 
+###############################################################################
+# Test QB3 compression
+
+
+@pytest.mark.parametrize(
+    "dt",
+    [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16, gdal.GDT_UInt32, gdal.GDT_Int32],
+)
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+        ["INTERLEAVE=BAND"],
+        ["ENDIANNESS=BIG"],
+    ],
+)
+@pytest.mark.require_creation_option("GTiff", "QB3")
+def test_tiff_write_qb3(tmp_vsimem, dt, options):
+
+    # 3-band source with a size that is not a multiple of 4, to exercise
+    # edge padding
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", outputType=dt, width=47, height=45
+    )
+    filename = str(tmp_vsimem / "test_tiff_write_qb3.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["COMPRESS=QB3"] + options
+    )
+    ds = gdal.Open(filename)
+    assert ds.GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE") == "QB3"
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
+
+
+###############################################################################
+# Test QB3 compression with multi-threaded encoding and decoding
+
+
+@pytest.mark.require_creation_option("GTiff", "QB3")
+def test_tiff_write_qb3_multithreaded(tmp_vsimem):
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM", width=500, height=500)
+    filename = str(tmp_vsimem / "test_tiff_write_qb3_multithreaded.tif")
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        gdal.GetDriverByName("GTiff").CreateCopy(
+            filename,
+            src_ds,
+            options=["COMPRESS=QB3", "TILED=YES", "BLOCKXSIZE=64", "BLOCKYSIZE=64"],
+        )
+        ds = gdal.Open(filename)
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ]
+
+
+###############################################################################
+# Test that QB3 rejects unsupported data types
+
+
+@pytest.mark.require_creation_option("GTiff", "QB3")
+def test_tiff_write_qb3_unsupported_data_type(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_tiff_write_qb3_unsupported_data_type.tif")
+    with gdal.quiet_errors():
+        ds = gdal.GetDriverByName("GTiff").Create(
+            filename, 1, 1, 1, gdal.GDT_Float32, options=["COMPRESS=QB3"]
+        )
+    assert ds is None
+    with gdal.quiet_errors():
+        ds = gdal.GetDriverByName("GTiff").Create(
+            filename, 1, 1, 1, options=["COMPRESS=QB3", "NBITS=7"]
+        )
+    assert ds is None
+
+
 ###############################################################################
 # Test creating overviews with NaN nodata
 
@@ -11523,3 +11664,103 @@ def test_tiff_write_copy_mdd():
     ds = None
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test BLOCK_STATISTICS=YES creation option
+
+
+@pytest.mark.parametrize(
+    "datatype,nodata,interleave",
+    [
+        (gdal.GDT_Byte, None, "BAND"),
+        (gdal.GDT_Byte, 0, "PIXEL"),
+        (gdal.GDT_Int16, -32768, "BAND"),
+        (gdal.GDT_Float32, None, "PIXEL"),
+        (gdal.GDT_Float32, -9999, "BAND"),
+        (gdal.GDT_Float64, float("nan"), "BAND"),
+    ],
+)
+def test_tiff_write_block_statistics(tmp_vsimem, datatype, nodata, interleave):
+
+    src_ds = gdal.Translate(
+        "",
+        "data/byte.tif",
+        options="-of MEM -b 1 -b 1 -scale 0 255 -50 200 -outsize 50 40 -ot "
+        + gdal.GetDataTypeName(datatype),
+    )
+    if nodata is not None:
+        for i in range(2):
+            src_ds.GetRasterBand(i + 1).SetNoDataValue(nodata)
+    # Make the second band different
+    src_ds.GetRasterBand(2).WriteRaster(0, 0, 7, 3, b"\x01" * 21, 7, 3, gdal.GDT_Byte)
+
+    filename = str(tmp_vsimem / "test_tiff_write_block_statistics.tif")
+    ref_filename = str(tmp_vsimem / "test_tiff_write_block_statistics_ref.tif")
+    options = [
+        "TILED=YES",
+        "BLOCKXSIZE=16",
+        "BLOCKYSIZE=16",
+        "COMPRESS=DEFLATE",
+        "INTERLEAVE=" + interleave,
+    ]
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=options + ["BLOCK_STATISTICS=YES"]
+    )
+    gdal.GetDriverByName("GTiff").CreateCopy(ref_filename, src_ds, options=options)
+
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, 100000, f)
+    gdal.VSIFCloseL(f)
+    assert b"block_statistics" in data
+
+    def check(ds, ref_ds):
+        for i in range(ds.RasterCount):
+            band = ds.GetRasterBand(i + 1)
+            ref_band = ref_ds.GetRasterBand(i + 1)
+            assert band.ComputeRasterMinMax(False) == ref_band.ComputeRasterMinMax(
+                False
+            )
+            stats = band.ComputeStatistics(False)
+            ref_stats = ref_band.ComputeStatistics(False)
+            assert stats == pytest.approx(ref_stats, rel=1e-10)
+            assert band.GetMetadataItem(
+                "STATISTICS_VALID_PERCENT"
+            ) == ref_band.GetMetadataItem("STATISTICS_VALID_PERCENT")
+
+    with gdal.Open(filename) as ds, gdal.Open(ref_filename) as ref_ds:
+        check(ds, ref_ds)
+
+    # Modify the files in update mode, and check that summaries are updated
+    for fname in (filename, ref_filename):
+        with gdal.Open(fname, gdal.GA_Update) as ds:
+            ds.GetRasterBand(1).WriteRaster(
+                20, 20, 5, 5, b"\xFA" * 25, 5, 5, gdal.GDT_Byte
+            )
+    with gdal.Open(filename) as ds, gdal.Open(ref_filename) as ref_ds:
+        assert ds.GetRasterBand(1).ComputeRasterMinMax(False)[1] == 250
+        check(ds, ref_ds)
+
+    # Changing the nodata value makes the summaries unusable, but results
+    # must remain correct.
+    for fname in (filename, ref_filename):
+        with gdal.Open(fname, gdal.GA_Update) as ds:
+            ds.GetRasterBand(1).SetNoDataValue(1)
+    with gdal.Open(filename) as ds, gdal.Open(ref_filename) as ref_ds:
+        check(ds, ref_ds)
+
+
+###############################################################################
+# Test BLOCK_STATISTICS=YES with a lossy compression method
+
+
+@pytest.mark.require_creation_option("GTiff", "JPEG")
+def test_tiff_write_block_statistics_lossy(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_tiff_write_block_statistics_lossy.tif")
+    with gdal.quiet_errors():
+        ds = gdal.GetDriverByName("GTiff").Create(
+            filename, 1, 1, options=["COMPRESS=JPEG", "BLOCK_STATISTICS=YES"]
+        )
+    assert "BLOCK_STATISTICS=YES is only supported" in gdal.GetLastErrorMsg()
+    ds = None
@@ -360,6 +360,42 @@ def test_transformer_5():
     gdal.Unlink("/vsimem/dem.tif")
 
 
+###############################################################################
+# Test that transforming many points at once with the RPC transformer, which
+# uses batched code paths, gives the same results as one point at a time.
+
+
+def test_transformer_rpc_many_points():
+
+    ds = gdal.Open("data/rpc.vrt")
+    tr = gdal.Transformer(ds, None, ["METHOD=RPC", "RPC_PIXEL_ERROR_THRESHOLD=0.05"])
+
+    pixel_line = [(0.5 + i * 1.7, 0.5 + i * 0.9, i * 10.0) for i in range(67)]
+
+    ref_long_lat = []
+    for x, y, z in pixel_line:
+        success, pnt = tr.TransformPoint(0, x, y, z)
+        assert success
+        ref_long_lat.append(tuple(pnt))
+
+    long_lat, success = tr.TransformPoints(0, pixel_line)
+    assert all(success)
+    assert long_lat == ref_long_lat
+
+    ref_pixel_line = []
+    for pnt in ref_long_lat:
+        success, back = tr.TransformPoint(1, pnt[0], pnt[1], pnt[2])
+        assert success
+        ref_pixel_line.append(tuple(back))
+
+    back, success = tr.TransformPoints(1, ref_long_lat)
+    assert all(success)
+    assert back == ref_pixel_line
+    for (x, y, _), (back_x, back_y, _) in zip(pixel_line, back):
+        assert back_x == pytest.approx(x, abs=0.05)
+        assert back_y == pytest.approx(y, abs=0.05)
+
+
 ###############################################################################
 # Test RPC convergence bug (bug # 5395)
 
@@ -1015,10 +1051,11 @@ def test_transformer_no_reverse_method():
 # Test precision of GCP based transformer with thin plate splines and lots of GCPs (2115).
 
 
-def test_transformer_tps_precision():
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_transformer_tps_precision(num_threads):
 
     ds = gdal.Open("data/gcps_2115.vrt")
-    tr = gdal.Transformer(ds, None, ["METHOD=GCP_TPS"])
+    tr = gdal.Transformer(ds, None, ["METHOD=GCP_TPS", f"NUM_THREADS={num_threads}"])
     assert tr, "tps transformation could not be computed"
 
     success = True
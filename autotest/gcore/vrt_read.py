@@ -2639,3 +2639,169 @@ def test_vrt_read_virtual_overviews_match_src_overviews(tmp_vsimem):
     assert vrt_band.GetOverview(1).YSize == 1024
     assert vrt_band.GetOverview(2).XSize == 1024
     assert vrt_band.GetOverview(2).YSize == 512
+
+
+###############################################################################
+# Test reading sources of a mosaic in parallel
+
+
+def test_vrt_read_multithreaded_mosaic(tmp_vsimem):
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM")
+    tile_filenames = []
+    for y in range(0, 50, 10):
+        for x in range(0, 50, 25):
+            tile_filename = str(tmp_vsimem / f"tile_{x}_{y}.tif")
+            gdal.Translate(tile_filename, src_ds, srcWin=[x, y, 25, 10])
+            tile_filenames.append(tile_filename)
+    vrt_ds = gdal.BuildVRT("", tile_filenames)
+
+    def read(ds):
+        return (
+            ds.ReadRaster(),
+            ds.GetRasterBand(2).ReadRaster(),
+            ds.ReadRaster(3, 4, 40, 39, 13, 17),
+            ds.GetRasterBand(3).ReadRaster(
+                3, 4, 40, 39, 13, 17, resample_alg=gdal.GRIORA_Bilinear
+            ),
+        )
+
+    expected = read(vrt_ds)
+    assert expected[:2] == (src_ds.ReadRaster(), src_ds.GetRasterBand(2).ReadRaster())
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert read(vrt_ds) == expected
+
+        # Overlapping sources: read sequentially
+        vrt_overlap_ds = gdal.BuildVRT("", tile_filenames + ["data/rgbsmall.tif"])
+        assert vrt_overlap_ds.ReadRaster() == src_ds.ReadRaster()
+
+
+def test_vrt_read_multithreaded_mosaic_error(tmp_vsimem):
+
+    src_ds = gdal.Open("data/byte.tif")
+    tile_filenames = []
+    for x in range(0, 20, 5):
+        tile_filename = str(tmp_vsimem / f"tile_{x}.tif")
+        gdal.Translate(tile_filename, src_ds, srcWin=[x, 0, 5, 20])
+        tile_filenames.append(tile_filename)
+    vrt_filename = str(tmp_vsimem / "mosaic.vrt")
+    gdal.BuildVRT(vrt_filename, tile_filenames).Close()
+
+    # Corrupt one of the sources
+    gdal.FileFromMemBuffer(tile_filenames[2], b"garbage")
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        vrt_ds = gdal.Open(vrt_filename)
+        with pytest.raises(Exception):
+            vrt_ds.GetRasterBand(1).ReadRaster()
+
+
+###############################################################################
+# Test reading a VRT with enough sources to trigger the use of a spatial
+# index of the sources
+
+
+def _get_mosaic_of_many_sources_with_hole():
+
+    src_ds = gdal.Open("data/byte.tif")
+    tile_ds_list = []
+    for y in range(0, 20, 2):
+        for x in range(0, 20, 2):
+            # Leave a hole in the mosaic
+            if (x, y) == (10, 10):
+                continue
+            tile_ds_list.append(
+                gdal.Translate("", src_ds, format="MEM", srcWin=[x, y, 2, 2])
+            )
+    return gdal.BuildVRT("", tile_ds_list)
+
+
+def test_vrt_read_many_sources_spatial_index():
+
+    vrt_ds = _get_mosaic_of_many_sources_with_hole()
+
+    src_ds = gdal.Open("data/byte.tif")
+    expected = bytearray(src_ds.ReadRaster())
+    for y in range(10, 12):
+        for x in range(10, 12):
+            expected[y * 20 + x] = 0
+    expected = bytes(expected)
+    assert vrt_ds.ReadRaster() == expected
+    assert vrt_ds.GetRasterBand(1).ReadRaster() == expected
+
+    for y in range(0, 20, 3):
+        for x in range(0, 20, 3):
+            w = min(3, 20 - x)
+            h = min(3, 20 - y)
+            got = vrt_ds.GetRasterBand(1).ReadRaster(x, y, w, h)
+            assert got == b"".join(
+                expected[(y + j) * 20 + x : (y + j) * 20 + x + w] for j in range(h)
+            ), (x, y)
+
+    # Adding a source must invalidate the index
+    vrt_ds.GetRasterBand(1).SetMetadataItem(
+        "source_0",
+        """<SimpleSource>
+      <SourceFilename relativeToVRT="0">data/byte.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="10" yOff="10" xSize="2" ySize="2" />
+      <DstRect xOff="10" yOff="10" xSize="2" ySize="2" />
+    </SimpleSource>""",
+        "new_vrt_sources",
+    )
+    assert vrt_ds.GetRasterBand(1).ReadRaster(
+        10, 10, 2, 2
+    ) == src_ds.GetRasterBand(1).ReadRaster(10, 10, 2, 2)
+
+
+@pytest.mark.require_geos
+def test_vrt_read_many_sources_spatial_index_data_coverage_status():
+
+    vrt_ds = _get_mosaic_of_many_sources_with_hole()
+
+    (flags, pct) = vrt_ds.GetRasterBand(1).GetDataCoverageStatus(0, 0, 4, 4)
+    assert flags == gdal.GDAL_DATA_COVERAGE_STATUS_DATA and pct == 100.0
+
+    (flags, pct) = vrt_ds.GetRasterBand(1).GetDataCoverageStatus(10, 10, 2, 2)
+    assert flags == gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY and pct == 0.0
+
+    (flags, pct) = vrt_ds.GetRasterBand(1).GetDataCoverageStatus(10, 10, 4, 4)
+    assert (
+        flags
+        == gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY
+        and pct == 75.0
+    )
+
+
+###############################################################################
+# Test opening a VRT with many sources relative to the VRT path
+
+
+def test_vrt_read_many_relative_sources(tmp_vsimem):
+
+    src_ds = gdal.Open("data/byte.tif")
+    gdal.Translate(tmp_vsimem / "byte.tif", src_ds)
+    sources = ""
+    for y in range(20):
+        for x in range(20):
+            sources += f"""<SimpleSource>
+      <SourceFilename relativeToVRT="1">byte.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="{x}" yOff="{y}" xSize="1" ySize="1" />
+      <DstRect xOff="{x}" yOff="{y}" xSize="1" ySize="1" />
+    </SimpleSource>"""
+    vrt_filename = tmp_vsimem / "test.vrt"
+    gdal.FileFromMemBuffer(
+        vrt_filename,
+        f"""<VRTDataset rasterXSize="20" rasterYSize="20">
+  <VRTRasterBand dataType="Byte" band="1">
+    {sources}
+  </VRTRasterBand>
+</VRTDataset>""",
+    )
+
+    ds = gdal.Open(vrt_filename)
+    assert len(ds.GetRasterBand(1).GetMetadata("vrt_sources")) == 400
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    assert ds.GetFileList() == [str(vrt_filename), str(tmp_vsimem / "byte.tif")]
@@ -28,6 +28,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -610,6 +611,62 @@ def test_vsicurl_test_retry(server):
         assert "429" in error_msg
 
 
+###############################################################################
+# Test CPL_VSIL_NETWORK_STATS_DETAILED
+
+
+def test_vsicurl_network_stats_detailed(server):
+
+    gdal.VSICurlClearCache()
+    gdal.NetworkStatsReset()
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/test_network_stats/", 404)
+    handler.add("HEAD", "/test_network_stats/test.txt", 200, {"Content-Length": "3"})
+    handler.add("GET", "/test_network_stats/test.txt", 200, {}, "foo")
+    try:
+        with gdaltest.config_options(
+            {
+                "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+                "CPL_VSIL_NETWORK_STATS_DETAILED": "YES",
+            },
+            thread_local=False,
+        ), webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(
+                "/vsicurl/http://localhost:%d/test_network_stats/test.txt"
+                % server.port,
+                "rb",
+            )
+            assert f is not None
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+            # Served from the region cache
+            gdal.VSIFSeekL(f, 0, 0)
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+            gdal.VSIFCloseL(f)
+
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+    finally:
+        gdal.NetworkStatsReset()
+
+    head = j["methods"]["HEAD"]
+    assert head["count"] == 1
+    assert head["time_to_first_byte"]["count"] == 1
+    assert head["total_time"]["count"] == 1
+    assert head["total_time"]["buckets_ms"]["+Inf"] == 1
+    assert head["total_time"]["sum_ms"] >= 0
+
+    assert j["region_cache"] == {
+        "hits": 1,
+        "misses": 1,
+        "hit_ratio": 0.5,
+        "downloaded_bytes": 3,
+        "unconsumed_bytes": 0,
+    }
+
+    endpoint = j["endpoints"]["http://localhost:%d" % server.port]
+    assert endpoint["HEAD"]["total_time"]["count"] == 1
+
+
 ###############################################################################
 
 
@@ -1170,3 +1227,311 @@ def test_vsicurl_404_repeated_same_resource(server):
 
     with pytest.raises(Exception, match="404"):
         gdal.Open("/vsicurl/http://localhost:%d/does/not/exist.bin" % server.port)
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    url = "/vsicurl/http://localhost:%d/test_vsicurl_disk_cache.bin" % server.port
+
+    def read(handler):
+        gdal.VSICurlClearCache()
+        with webserver.install_http_handler(handler):
+            with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", str(tmp_path)):
+                f = gdal.VSIFOpenL(url, "rb")
+                assert f
+                data = gdal.VSIFReadL(1, 3, f)
+                gdal.VSIFCloseL(f)
+        return data
+
+    # First access: data is downloaded and stored in the disk cache
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag1"'},
+    )
+    handler.add(
+        "GET",
+        "/test_vsicurl_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag1"'},
+        b"foo",
+    )
+    assert read(handler) == b"foo"
+    assert len(gdal.ReadDirRecursive(str(tmp_path))) == 2
+
+    # Same ETag: data is read from the disk cache, without GET request
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag1"'},
+    )
+    assert read(handler) == b"foo"
+
+    # Changed ETag: cached data must not be used
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag2"'},
+    )
+    handler.add(
+        "GET",
+        "/test_vsicurl_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag2"'},
+        b"bar",
+    )
+    assert read(handler) == b"bar"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE / _CONNECTIONS
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_parallel_read(server):
+
+    gdal.VSICurlClearCache()
+
+    file_size = 65536
+    content = bytes([i % 251 for i in range(file_size)])
+
+    def method(request):
+        assert request.headers["Range"].startswith("bytes=")
+        start, end = [int(x) for x in request.headers["Range"][6:].split("-")]
+        assert end - start + 1 == 16384
+        request.protocol_version = "HTTP/1.1"
+        request.send_response(206)
+        request.send_header(
+            "Content-Range", "bytes %d-%d/%d" % (start, end, file_size)
+        )
+        request.send_header("Content-Length", end - start + 1)
+        request.end_headers()
+        request.wfile.write(content[start : end + 1])
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_parallel_read.bin",
+        200,
+        {"Content-Length": "%d" % file_size},
+    )
+    for i in range(4):
+        handler.add("GET", "/test_vsicurl_parallel_read.bin", custom_method=method)
+
+    with webserver.install_http_handler(handler):
+        with gdal.config_options(
+            {
+                "CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE": "16384",
+                "CPL_VSIL_CURL_PARALLEL_READ_CONNECTIONS": "2",
+            }
+        ):
+            f = gdal.VSIFOpenL(
+                "/vsicurl/http://localhost:%d/test_vsicurl_parallel_read.bin"
+                % server.port,
+                "rb",
+            )
+            assert f
+            data = gdal.VSIFReadL(1, file_size, f)
+            assert gdal.VSIFTellL(f) == file_size
+            gdal.VSIFCloseL(f)
+    assert data == content
+
+
+###############################################################################
+# Test that parallel reads do not download again chunks in the region cache
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_parallel_read_skip_cached_chunks(server):
+
+    gdal.VSICurlClearCache()
+
+    file_size = 65536
+    content = bytes([i % 251 for i in range(file_size)])
+
+    # Ranges expected to be requested, in any order for the parallel ones
+    expected_ranges = ["0-16383", "16384-32767", "32768-49151", "49152-65535"]
+
+    def method(request):
+        assert request.headers["Range"].startswith("bytes=")
+        rng = request.headers["Range"][6:]
+        assert rng in expected_ranges
+        expected_ranges.remove(rng)
+        start, end = [int(x) for x in rng.split("-")]
+        request.protocol_version = "HTTP/1.1"
+        request.send_response(206)
+        request.send_header(
+            "Content-Range", "bytes %d-%d/%d" % (start, end, file_size)
+        )
+        request.send_header("Content-Length", end - start + 1)
+        request.end_headers()
+        request.wfile.write(content[start : end + 1])
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_parallel_read_skip_cached_chunks.bin",
+        200,
+        {"Content-Length": "%d" % file_size},
+    )
+    for i in range(4):
+        handler.add(
+            "GET",
+            "/test_vsicurl_parallel_read_skip_cached_chunks.bin",
+            custom_method=method,
+        )
+
+    with webserver.install_http_handler(handler):
+        with gdal.config_options(
+            {
+                "CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE": "16384",
+                "CPL_VSIL_CURL_PARALLEL_READ_CONNECTIONS": "4",
+            }
+        ):
+            f = gdal.VSIFOpenL(
+                "/vsicurl/http://localhost:%d/test_vsicurl_parallel_read_skip_cached_chunks.bin"
+                % server.port,
+                "rb",
+            )
+            assert f
+            # Puts the first chunk in the region cache
+            assert gdal.VSIFReadL(1, 100, f) == content[0:100]
+            gdal.VSIFSeekL(f, 0, 0)
+            data = gdal.VSIFReadL(1, file_size, f)
+            gdal.VSIFCloseL(f)
+    assert data == content
+    assert expected_ranges == []
+
+
+###############################################################################
+# Test asynchronous read-ahead during sequential reads
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_read_ahead(server):
+
+    gdal.VSICurlClearCache()
+
+    file_size = 11 * 16384
+    content = bytes([i % 251 for i in range(file_size)])
+
+    def get_range(expected_range):
+        def method(request):
+            assert request.headers["Range"] == "bytes=" + expected_range
+            start, end = [int(x) for x in expected_range.split("-")]
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, file_size)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+        return method
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/", 404)
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_read_ahead.bin",
+        200,
+        {"Content-Length": "%d" % file_size},
+    )
+    # Sequential reads double the size of each request...
+    for expected_range in ("0-16383", "16384-49151", "49152-114687"):
+        handler.add(
+            "GET",
+            "/test_vsicurl_read_ahead.bin",
+            custom_method=get_range(expected_range),
+        )
+    # ... and the end of the file is then fetched in the background
+    handler.add(
+        "GET",
+        "/test_vsicurl_read_ahead.bin",
+        custom_method=get_range("114688-180223"),
+    )
+
+    with webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_vsicurl_read_ahead.bin" % server.port,
+            "rb",
+        )
+        assert f
+        data = b""
+        for i in range(file_size // 16384):
+            data += gdal.VSIFReadL(1, 16384, f)
+        gdal.VSIFCloseL(f)
+    assert data == content
+
+
+###############################################################################
+# Test VSICurlPrimeCache() and CPL_VSIL_CURL_METADATA_CACHE_TTL
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_prime_cache(server):
+
+    gdal.VSICurlClearCache()
+
+    dirname = "/vsicurl/http://localhost:%d/test_vsicurl_prime_cache" % server.port
+
+    with pytest.raises(Exception, match="same number of elements"):
+        gdal.VSICurlPrimeCache(dirname, ["a.tif", "b.tif"], [1])
+
+    assert gdal.VSICurlPrimeCache(dirname + "/", ["a.tif", "b.tif"], [123, 456])
+
+    # Everything is answered from the cache
+    handler = webserver.SequentialHandler()
+    with webserver.install_http_handler(handler):
+        assert gdal.ReadDir(dirname) == ["a.tif", "b.tif"]
+        assert gdal.VSIStatL(dirname).IsDirectory()
+        assert gdal.VSIStatL(dirname + "/a.tif").size == 123
+        assert gdal.VSIStatL(dirname + "/b.tif").size == 456
+        assert gdal.VSIStatL(dirname + "/a.tif.aux.xml") is None
+        assert gdal.VSIStatL(dirname + "/a.tif.ovr") is None
+        with pytest.raises(Exception):
+            gdal.VSIFOpenL(dirname + "/a.tif.msk", "rb")
+
+    # Sizes are optional
+    gdal.VSICurlClearCache()
+    assert gdal.VSICurlPrimeCache(dirname, ["c.tif"], [])
+    handler = webserver.SequentialHandler()
+    with webserver.install_http_handler(handler):
+        assert gdal.ReadDir(dirname) == ["c.tif"]
+        assert gdal.VSIStatL(dirname + "/a.tif") is None
+
+    # Expired entries are no longer used
+    gdal.VSICurlClearCache()
+    assert gdal.VSICurlPrimeCache(dirname, ["a.tif"], [123])
+    with gdaltest.config_option("CPL_VSIL_CURL_METADATA_CACHE_TTL", "1"):
+        time.sleep(2.5)
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_prime_cache/a.tif",
+            200,
+            {"Content-Length": "789"},
+        )
+        with webserver.install_http_handler(handler):
+            assert gdal.VSIStatL(dirname + "/a.tif").size == 789
+
+    gdal.VSICurlClearCache()
@@ -837,6 +837,50 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test parallel reading using an index of access points
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_vsigzip_index(tmp_path, num_threads):
+
+    import gzip
+
+    content = "".join("%d\n" % i for i in range(200000)).encode("ascii")
+    filename = str(tmp_path / "test.txt.gz")
+    with open(filename, "wb") as f:
+        f.write(gzip.compress(content))
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_SPACING": "64K",
+            "GDAL_NUM_THREADS": num_threads,
+        }
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        assert gdal.VSIFReadL(1, len(content) + 1, f) == content
+        assert gdal.VSIFEofL(f)
+
+        assert gdal.VSIFSeekL(f, 1000000, 0) == 0
+        assert gdal.VSIFReadL(1, 100, f) == content[1000000:1000100]
+        assert gdal.VSIFSeekL(f, 10, 0) == 0
+        assert gdal.VSIFReadL(1, 200000, f) == content[10:200010]
+        assert gdal.VSIFSeekL(f, 0, 2) == 0
+        assert gdal.VSIFTellL(f) == len(content)
+        gdal.VSIFCloseL(f)
+
+        assert gdal.VSIStatL(filename + ".gzidx") is not None
+
+        # Re-open, reusing the index
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        assert gdal.VSIFSeekL(f, len(content) - 10, 0) == 0
+        assert gdal.VSIFReadL(1, 100, f) == content[-10:]
+        gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -3043,6 +3043,135 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test multipart upload with parts uploaded in parallel
+
+
+def test_vsis3_write_multipart_parallel(aws_test_config, webserver_port):
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE": "1", "VSIS3_UPLOAD_PARALLEL_PARTS": "2"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(webserver.SequentialHandler()):
+            f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.tif", "wb")
+    assert f is not None
+    size = 2 * 1024 * 1024 + 1
+    big_buffer = "a" * size
+
+    handler = webserver.SequentialHandler()
+
+    response = """<?xml version="1.0" encoding="UTF-8"?>
+    <InitiateMultipartUploadResult>
+    <UploadId>my_id</UploadId>
+    </InitiateMultipartUploadResult>"""
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.tif?uploads",
+        200,
+        {
+            "Content-type": "application/xml",
+            "Content-Length": len(response),
+            "Connection": "close",
+        },
+        response,
+    )
+
+    # Parts may be received in any order
+    for i in range(1, 4):
+        handler.add_unordered(
+            "PUT",
+            "/s3_fake_bucket4/large_file.tif?partNumber=%d&uploadId=my_id" % i,
+            200,
+            {"Content-Length": "0", "ETag": '"etag%d"' % i, "Connection": "close"},
+            {},
+        )
+
+    handler.add_unordered(
+        "POST",
+        "/s3_fake_bucket4/large_file.tif?uploadId=my_id",
+        200,
+        {"Content-Length": "0", "Connection": "close"},
+        {},
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    with webserver.install_http_handler(handler):
+        ret = gdal.VSIFWriteL(big_buffer, 1, size, f)
+        assert ret == size
+        assert gdal.VSIFCloseL(f) == 0
+
+
+###############################################################################
+# Test S3 Express One Zone directory buckets: CreateSession based
+# authentication and no directory listing on open
+
+
+def test_vsis3_directory_bucket(aws_test_config, webserver_port):
+
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET",
+        "/mybucket--usw2-az1--x-s3/?session",
+        200,
+        {"Content-type": "application/xml"},
+        """<?xml version="1.0" encoding="UTF-8"?>
+        <CreateSessionResult>
+            <Credentials>
+                <SessionToken>SESSION_TOKEN</SessionToken>
+                <SecretAccessKey>SESSION_SECRET_ACCESS_KEY</SecretAccessKey>
+                <AccessKeyId>SESSION_ACCESS_KEY_ID</AccessKeyId>
+                <Expiration>3000-01-01T00:00:00Z</Expiration>
+            </Credentials>
+        </CreateSessionResult>""",
+    )
+
+    def method(request):
+        if request.headers.get("x-amz-s3session-token") != "SESSION_TOKEN" or (
+            "Credential=SESSION_ACCESS_KEY_ID/20150101/us-east-1/s3express/"
+            not in request.headers.get("Authorization", "")
+        ):
+            sys.stderr.write("Bad headers: %s\n" % str(request.headers))
+            request.send_response(403)
+            request.send_header("Content-Length", 0)
+            request.end_headers()
+            return
+        request.protocol_version = "HTTP/1.1"
+        request.send_response(206)
+        request.send_header("Content-type", "text/plain")
+        request.send_header("Content-Range", "bytes 0-2/3")
+        request.send_header("Content-Length", 3)
+        request.end_headers()
+        request.wfile.write("foo".encode("ascii"))
+
+    handler.add("GET", "/mybucket--usw2-az1--x-s3/test.bin", custom_method=method)
+
+    with webserver.install_http_handler(handler):
+        f = open_for_read("/vsis3/mybucket--usw2-az1--x-s3/test.bin")
+        assert f is not None
+        data = gdal.VSIFReadL(1, 3, f).decode("ascii")
+        gdal.VSIFCloseL(f)
+    assert data == "foo"
+
+    # The session is reused
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/mybucket--usw2-az1--x-s3/test2.bin", custom_method=method)
+    with webserver.install_http_handler(handler):
+        f = open_for_read("/vsis3/mybucket--usw2-az1--x-s3/test2.bin")
+        assert f is not None
+        gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
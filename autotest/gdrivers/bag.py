@@ -796,6 +796,34 @@ def test_bag_vr_interpolated():
     assert ds.GetRasterBand(1).Checksum() in (9896, 9899)
 
 
+###############################################################################
+# Test that computing resampled and interpolated grids with several threads
+# gives the same result as with a single one
+
+
+@pytest.mark.parametrize(
+    "filename,open_options",
+    [
+        ("data/bag/test_vr.bag", ["MODE=RESAMPLED_GRID", "VALUE_POPULATION=MEAN"]),
+        ("data/bag/test_vr.bag", ["MODE=RESAMPLED_GRID", "SUPERGRIDS_MASK=YES"]),
+        ("data/bag/test_interpolated.bag", ["MODE=INTERPOLATED"]),
+    ],
+)
+def test_bag_vr_multithreaded(filename, open_options):
+
+    open_options = open_options + ["RESX=0.5", "RESY=0.5"]
+
+    def read():
+        ds = gdal.OpenEx(filename, open_options=open_options)
+        return [
+            ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+        ]
+
+    expected = read()
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert read() == expected
+
+
 ###############################################################################
 #
 
@@ -581,6 +581,81 @@ def test_eedai_geotiff():
     gdal.SetConfigOption("EEDA_BEARER", None)
 
 
+###############################################################################
+# Read an area exceeding the server dimension limit, which must be tiled
+# into several requests issued concurrently
+
+
+def test_eedai_concurrent_requests():
+
+    gdal.FileFromMemBuffer(
+        "/vsimem/ee/projects/earthengine-public/assets/image",
+        json.dumps(
+            {
+                "type": "IMAGE",
+                "bands": [
+                    {
+                        "id": "B1",
+                        "dataType": {"precision": "INT", "range": {"max": 65535}},
+                        "grid": {
+                            "crsCode": "EPSG:32610",
+                            "affineTransform": {
+                                "translateX": 499980,
+                                "translateY": 4200000,
+                                "scaleX": 60,
+                                "scaleY": -60,
+                            },
+                            "dimensions": {"width": 10240, "height": 256},
+                        },
+                    }
+                ],
+            }
+        ),
+    )
+
+    with gdaltest.config_options(
+        {
+            "EEDA_BEARER": "mybearer",
+            "EEDA_URL": "/vsimem/ee/",
+            "EEDA_MAX_CONNECTIONS": "2",
+        }
+    ):
+        ds = gdal.Open("EEDAI:image")
+
+        # The server dimension limit is 10000 pixels: 39 blocks of 256 pixels
+        # in the first request, and the remaining block in the second one.
+        for width, translate_x, value in [
+            (9984, "499980.0", 1),
+            (256, "1099020.0", 2),
+        ]:
+            mem_ds = gdal.GetDriverByName("MEM").Create(
+                "", width, 256, 1, gdal.GDT_UInt16
+            )
+            mem_ds.GetRasterBand(1).Fill(value)
+            gdal.GetDriverByName("GTiff").CreateCopy("/vsimem/out.tif", mem_ds)
+            f = gdal.VSIFOpenL("/vsimem/out.tif", "rb")
+            data = gdal.VSIFReadL(1, 100000000, f)
+            gdal.VSIFCloseL(f)
+            gdal.Unlink("/vsimem/out.tif")
+
+            gdal.FileFromMemBuffer(
+                '/vsimem/ee/projects/earthengine-public/assets/image:getPixels&CUSTOMREQUEST=POST&POSTFIELDS={ "fileFormat": "GEO_TIFF", "bandIds": [ "B1" ], "grid": { "affineTransform": { "translateX": '
+                + translate_x
+                + ', "translateY": 4200000.0, "scaleX": 60.0, "scaleY": -60.0, "shearX": 0.0, "shearY": 0.0 }, "dimensions": { "width": '
+                + str(width)
+                + ', "height": 256 } } }',
+                data,
+            )
+
+        got_data = struct.unpack("H" * (10240 * 256), ds.ReadRaster())
+        assert got_data[0] == 1
+        assert got_data[9983] == 1
+        assert got_data[9984] == 2
+        assert got_data[10240 * 256 - 1] == 2
+
+        ds = None
+
+
 ###############################################################################
 #
 
@@ -403,3 +403,55 @@ def test_ehdr_approx_stats_flag():
     ds = None
 
     gdal.GetDriverByName("EHDR").Delete(tmpfile)
+
+
+###############################################################################
+# Test reading through a memory mapping of the file (RAW_USE_MMAP)
+
+
+@pytest.mark.parametrize(
+    "datatype", [gdal.GDT_Int16, gdal.GDT_Float32, gdal.GDT_Float64]
+)
+@pytest.mark.parametrize("byteorder", ["I", "M"])
+def test_ehdr_read_mmap(tmp_path, datatype, byteorder):
+
+    filename = str(tmp_path / "test.bil")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 150, 100, 3, datatype)
+    for i in range(3):
+        values = [(i * 7 + j) % 251 for j in range(150 * 100)]
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            150,
+            100,
+            struct.pack("B" * len(values), *values),
+            buf_type=gdal.GDT_Byte,
+        )
+    gdal.GetDriverByName("EHDR").CreateCopy(filename, src_ds)
+
+    # Force data to be read as if it was written on a platform of the other
+    # endianness, to exercise byte swapping
+    hdr_filename = str(tmp_path / "test.hdr")
+    with open(hdr_filename, "rt") as f:
+        hdr = f.read()
+    with open(hdr_filename, "wt") as f:
+        f.write(hdr.replace("BYTEORDER      I", "BYTEORDER      " + byteorder))
+
+    def read_all():
+        ds = gdal.Open(filename)
+        band = ds.GetRasterBand(2)
+        return [
+            band.ReadRaster(),
+            band.ReadRaster(10, 20, 30, 40),
+            band.ReadRaster(10, 20, 30, 40, buf_type=gdal.GDT_Float64),
+            band.ReadRaster(0, 0, 150, 100, 75, 50),
+            band.ReadRaster(0, 0, 150, 1),
+            ds.ReadRaster(),
+            ds.ReadRaster(5, 5, 20, 20, band_list=[3, 1]),
+        ]
+
+    with gdaltest.config_option("RAW_USE_MMAP", "NO"):
+        expected = read_all()
+    with gdaltest.config_option("RAW_USE_MMAP", "YES"):
+        got = read_all()
+    assert got == expected
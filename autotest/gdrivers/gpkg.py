@@ -4298,3 +4298,133 @@ def test_gpkg_gti_gpkg_ext(tmp_vsimem):
     ds = gdal.Open(filename)
     assert ds.GetDriver().ShortName == "GPKG"
     assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test RasterIO() requests spanning several tiles, which are fetched with a
+# single SQL request and decoded in parallel
+
+
+@pytest.mark.parametrize("num_threads", [None, "4"])
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG"])
+def test_gpkg_raster_io_prefetch_tiles(tmp_vsimem, num_threads, tile_format):
+
+    if gdal.GetDriverByName(tile_format) is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    filename = str(tmp_vsimem / "test_gpkg_raster_io_prefetch_tiles.gpkg")
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="GPKG",
+        creationOptions=[f"TILE_FORMAT={tile_format}", "BLOCKSIZE=16"],
+    )
+
+    # Reference: read tile by tile
+    ds = gdal.Open(filename)
+    expected = [
+        ds.GetRasterBand(i + 1).ReadRaster(x, y, 16, 16)
+        for i in range(4)
+        for y in range(0, 48, 16)
+        for x in range(0, 48, 16)
+    ]
+    ds = None
+
+    # Delete a tile to check that missing tiles are read as empty
+    ds = ogr.Open(filename, update=1)
+    ds.ExecuteSQL(
+        "DELETE FROM test_gpkg_raster_io_prefetch_tiles "
+        "WHERE tile_row = 1 AND tile_column = 1"
+    )
+    ds = None
+    empty_tile = b"\x00" * (16 * 16)
+
+    ds = gdal.Open(filename)
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        data = ds.ReadRaster(0, 0, 48, 48)
+    ds = None
+
+    mem_ds = gdal.GetDriverByName("MEM").Create("", 48, 48, 4)
+    mem_ds.WriteRaster(0, 0, 48, 48, data)
+    idx = 0
+    for i in range(4):
+        for y in range(0, 48, 16):
+            for x in range(0, 48, 16):
+                got = mem_ds.GetRasterBand(i + 1).ReadRaster(x, y, 16, 16)
+                if x == 16 and y == 16:
+                    assert got == empty_tile
+                else:
+                    assert got == expected[idx]
+                idx += 1
+
+    # Band level RasterIO()
+    ds = gdal.Open(filename)
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        data = ds.GetRasterBand(2).ReadRaster(0, 0, 48, 48)
+    ds = None
+    assert data == mem_ds.GetRasterBand(2).ReadRaster()
+
+
+###############################################################################
+# Test copying JPEG tiles from a GeoTIFF without re-encoding them
+
+
+def test_gpkg_lossless_copy_jpeg_tiles(tmp_vsimem):
+
+    if gdal.GetDriverByName("JPEG") is None:
+        pytest.skip("JPEG driver missing")
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.Translate(
+        src_filename,
+        "data/rgbsmall.tif",
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS=JPEG",
+            "PHOTOMETRIC=YCBCR",
+        ],
+    )
+    expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    filename = str(tmp_vsimem / "test_gpkg_lossless_copy_jpeg_tiles.gpkg")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="GPKG",
+        creationOptions=["TILE_FORMAT=JPEG", "BLOCKSIZE=16"],
+    )
+
+    ds = gdal.Open(filename)
+    assert ds.RasterCount == 3
+    assert ds.GetGeoTransform() == src_ds.GetGeoTransform()
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+    ds = None
+
+    # Re-encoding requested
+    for options in (["LOSSLESS_COPY=NO"], ["QUALITY=50"]):
+        gdal.Translate(
+            filename,
+            src_ds,
+            format="GPKG",
+            creationOptions=["TILE_FORMAT=JPEG", "BLOCKSIZE=16"] + options,
+        )
+        ds = gdal.Open(filename)
+        assert [
+            ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ] != expected_cs
+        ds = None
+
+    # Tiling grids do not match
+    with gdaltest.error_handler():
+        assert (
+            gdal.Translate(
+                filename,
+                src_ds,
+                format="GPKG",
+                creationOptions=["TILE_FORMAT=JPEG", "LOSSLESS_COPY=YES"],
+            )
+            is None
+        )
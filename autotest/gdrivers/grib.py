@@ -2377,3 +2377,26 @@ def test_grib_grib2_template_5_42_CCDS_aes_decompression():
         assert ds.GetRasterBand(1).Checksum() == 41970
     else:
         assert ds.GetRasterBand(1).Checksum() == -1
+
+
+###############################################################################
+# Test decoding of several messages in parallel through the dataset
+# RasterIO() interface
+
+
+def test_grib_read_bands_multithreaded():
+
+    filename = "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2"
+    ds = gdal.Open(filename)
+    assert ds.RasterCount > 1
+    ref_data = ds.ReadRaster()
+    ref_checksums = [
+        ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+    ]
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == ref_data
+    assert [
+        ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+    ] == ref_checksums
@@ -2601,3 +2601,34 @@ def test_gti_xml_vrtti_embedded(tmp_vsimem):
     assert band.GetCategoryNames() == ["cat"]
     assert band.GetDefaultRAT() is not None
     del vrt_ds
+
+
+###############################################################################
+# Test rendering tiles in parallel
+
+
+def test_gti_multithreaded(tmp_vsimem):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    tiles = []
+    for y in range(0, 50, 10):
+        for x in range(0, 50, 25):
+            tile_filename = str(tmp_vsimem / f"tile_{x}_{y}.tif")
+            gdal.Translate(tile_filename, src_ds, srcWin=[x, y, 25, 10])
+            tiles.append(gdal.Open(tile_filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles)
+    del index_ds
+    del tiles
+
+    vrt_ds = gdal.Open(index_filename)
+    expected = vrt_ds.ReadRaster(), vrt_ds.ReadRaster(3, 4, 40, 39, 13, 17)
+    assert expected[0] == src_ds.ReadRaster()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        vrt_ds = gdal.Open(index_filename)
+        assert (
+            vrt_ds.ReadRaster(),
+            vrt_ds.ReadRaster(3, 4, 40, 39, 13, 17),
+        ) == expected
@@ -31,6 +31,7 @@
 
 import array
 import shutil
+import threading
 
 import gdaltest
 import pytest
@@ -1498,3 +1499,62 @@ END
     assert ds.GetRasterBand(1).ReadBlock(1, 2) == mem_ds.GetRasterBand(1).ReadRaster(
         1 * blockxsize, 2 * blockysize, blockxsize, blockysize
     )
+
+
+###############################################################################
+# Test reading chunks with H5Dread_chunk() and decompressing them in GDAL
+
+
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_hdf5_direct_chunk_read(num_threads):
+
+    filename = 'HDF5:"data/hdf5/dummy_HDFEOS_swath_chunked.h5"://HDFEOS/SWATHS/MySwath/Data_Fields/MyDataField'
+
+    with gdaltest.config_option("HDF5_DIRECT_CHUNK_READ", "NO"):
+        ds = gdal.Open(filename)
+        assert ds.GetMetadataItem("DirectChunkRead", "__DEBUG__") == "NO"
+        expected = [
+            ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+        ]
+        expected_window = ds.ReadRaster(1, 2, 11, 9, band_list=[2, 3, 4, 5])
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": num_threads, "HDF5_CHUNK_CACHE_SIZE": "10000000"}
+    ):
+        ds = gdal.Open(filename)
+        if ds.GetMetadataItem("DirectChunkRead", "__DEBUG__") != "YES":
+            pytest.skip("libhdf5 >= 1.10.5 required")
+        assert ds.ReadRaster(1, 2, 11, 9, band_list=[2, 3, 4, 5]) == expected_window
+        assert [
+            ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+        ] == expected
+        blockxsize, blockysize = ds.GetRasterBand(1).GetBlockSize()
+        assert ds.GetRasterBand(7).ReadBlock(1, 2) == ds.GetRasterBand(
+            7
+        ).ReadRaster(1 * blockxsize, 2 * blockysize, blockxsize, blockysize)
+
+
+###############################################################################
+# Test concurrent reading from several threads, each one with its own dataset
+
+
+def test_hdf5_concurrent_reads():
+
+    filename = 'HDF5:"data/hdf5/dummy_HDFEOS_swath_chunked.h5"://HDFEOS/SWATHS/MySwath/Data_Fields/MyDataField'
+    ds = gdal.Open(filename)
+    expected = ds.ReadRaster()
+    ds = None
+
+    results = [None] * 4
+
+    def worker(i):
+        for _ in range(5):
+            ds = gdal.Open(filename)
+            results[i] = ds.ReadRaster()
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert results == [expected] * 4
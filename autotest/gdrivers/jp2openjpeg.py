@@ -3924,3 +3924,27 @@ def test_jp2openjpeg_unsupported_srs_for_gmljp2(tmp_vsimem):
     assert ds.GetSpatialRef().IsSame(ref_srs)
     # Check that we do *not* have a GMLJP2 box
     assert "xml:gml.root-instance" not in ds.GetMetadataDomainList()
+
+
+###############################################################################
+# Test multi-threaded decoding of tiles, with and without reuse of the
+# codec between the tiles decoded by a same thread
+
+
+@pytest.mark.parametrize("reuse_codec", ["YES", "NO"])
+def test_jp2openjpeg_multithreaded_tile_decoding(tmp_vsimem, reuse_codec):
+
+    filename = str(tmp_vsimem / "test.jp2")
+    src_ds = gdal.Open("../gcore/data/utmsmall.tif")
+    gdaltest.jp2openjpeg_drv.CreateCopy(
+        filename,
+        src_ds,
+        options=["BLOCKXSIZE=32", "BLOCKYSIZE=32", "REVERSIBLE=YES", "QUALITY=100"],
+    )
+
+    with gdal.config_options(
+        {"GDAL_NUM_THREADS": "4", "OPENJPEG_REUSE_CODEC_IN_THREADS": reuse_codec}
+    ):
+        ds = gdal.Open(filename)
+        assert ds.GetRasterBand(1).GetBlockSize() == [32, 32]
+        assert ds.ReadRaster() == src_ds.ReadRaster()
@@ -1587,6 +1587,101 @@ def test_jpeg_copy_mdd():
     gdal.Unlink(filename)
 
 
+###############################################################################
+# Test reading windows out of order, which exercises skipping scanlines
+
+
+@pytest.mark.parametrize("progressive", ["OFF", "ON"])
+@pytest.mark.parametrize("nbands", [1, 3])
+def test_jpeg_read_window_skip_scanlines(tmp_vsimem, progressive, nbands):
+
+    src_ds = gdal.Open("data/jpeg/albania.jpg")
+    filename = str(tmp_vsimem / "test.jpg")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="JPEG",
+        creationOptions=["PROGRESSIVE=" + progressive],
+        bandList=[i + 1 for i in range(nbands)],
+    )
+
+    ds = gdal.Open(filename)
+    assert ds.RasterCount == nbands
+    ref_data = ds.ReadRaster()
+    width = ds.RasterXSize
+    height = ds.RasterYSize
+    ds = None
+
+    def extract(y, h):
+        out = b""
+        for b in range(nbands):
+            offset = b * width * height
+            out += ref_data[offset + y * width : offset + (y + h) * width]
+        return out
+
+    for y, h in ((height - 10, 10), (height // 2, 10), (3, 10), (height - 1, 1)):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster(0, y, width, h) == extract(y, h)
+        ds = None
+
+    # Several reads on the same dataset, forward and backward
+    ds = gdal.Open(filename)
+    for y in (10, 100, height - 5, 50, height - 1):
+        assert ds.ReadRaster(0, y, width, 1) == extract(y, 1)
+
+
+###############################################################################
+# Test writing restart markers, and decoding them in parallel
+
+
+@pytest.mark.parametrize("nbands", [1, 3])
+def test_jpeg_restart_interval_parallel_decoding(tmp_vsimem, nbands):
+
+    src_ds = gdal.Translate(
+        "",
+        "data/jpeg/albania.jpg",
+        format="MEM",
+        width=400,
+        height=1100,
+        bandList=[i + 1 for i in range(nbands)],
+    )
+    assert src_ds.RasterCount == nbands
+
+    filename = str(tmp_vsimem / "test.jpg")
+    gdal.GetDriverByName("JPEG").CreateCopy(
+        filename, src_ds, options=["RESTART_INTERVAL=0"]
+    )
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, 10000, f)
+    gdal.VSIFCloseL(f)
+    assert b"\xff\xdd" not in data
+
+    gdal.GetDriverByName("JPEG").CreateCopy(filename, src_ds)
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, 10000, f)
+    gdal.VSIFCloseL(f)
+    assert b"\xff\xdd" in data
+
+    ds = gdal.Open(filename)
+    assert ds.RasterCount == nbands
+    ref_data = ds.ReadRaster()
+    ref_window = ds.ReadRaster(15, 99, 300, 900, band_list=[nbands])
+    ref_band = ds.GetRasterBand(1).ReadRaster()
+    ref_ovr = ds.GetRasterBand(1).GetOverview(0).ReadRaster()
+    ref_interleaved = ds.ReadRaster(buf_pixel_space=nbands, buf_band_space=1)
+    ds = None
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == ref_data
+        assert ds.ReadRaster(15, 99, 300, 900, band_list=[nbands]) == ref_window
+        assert ds.GetRasterBand(1).ReadRaster() == ref_band
+        assert ds.GetRasterBand(1).GetOverview(0).ReadRaster() == ref_ovr
+        assert (
+            ds.ReadRaster(buf_pixel_space=nbands, buf_band_space=1) == ref_interleaved
+        )
+
+
 ###############################################################################
 # Cleanup
 
@@ -783,6 +783,35 @@ def test_mem_alpha_ismaskband():
     assert ds.GetRasterBand(2).IsMaskBand()
 
 
+###############################################################################
+# Test HUGE_PAGES and NUMA_PLACEMENT options
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["HUGE_PAGES=YES"],
+        ["NUMA_PLACEMENT=FIRST_TOUCH"],
+        ["NUMA_PLACEMENT=INTERLEAVE"],
+        ["HUGE_PAGES=YES", "NUMA_PLACEMENT=FIRST_TOUCH", "INTERLEAVE=PIXEL"],
+    ],
+)
+def test_mem_allocation_options(options):
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.GetDriverByName("MEM").Create(
+            "", 1000, 1100, 2, gdal.GDT_Int16, options=options
+        )
+    assert ds.GetRasterBand(1).Checksum() == 0
+    assert ds.GetRasterBand(2).Checksum() == 0
+    ds.GetRasterBand(2).Fill(1)
+    assert ds.GetRasterBand(1).Checksum() == 0
+    assert ds.GetRasterBand(2).ComputeRasterMinMax() == (1, 1)
+
+    ds.AddBand(gdal.GDT_Byte, options=options)
+    assert ds.GetRasterBand(3).Checksum() == 0
+
+
 ###############################################################################
 # cleanup
 
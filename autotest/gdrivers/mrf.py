@@ -645,6 +645,53 @@ def test_mrf_setspatialref():
     gdal.GetDriverByName("MRF").Delete(filename)
 
 
+###############################################################################
+# Test compressing the tiles in worker threads
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["COMPRESS=NONE", "OPTIONS=DEFLATE:1"],
+        ["COMPRESS=JPEG", "INTERLEAVE=BAND"],
+        ["COMPRESS=JPEG", "INTERLEAVE=PIXEL"],
+        ["COMPRESS=LERC"],
+        ["COMPRESS=ZSTD"],
+        ["COMPRESS=PNG"],
+    ],
+)
+def test_mrf_write_multithreaded(tmp_vsimem, options):
+
+    mrf_co = gdal.GetDriverByName("MRF").GetMetadataItem("DMD_CREATIONOPTIONLIST")
+    for comp in "LERC", "ZSTD":
+        if ("COMPRESS=" + comp) in options and comp not in mrf_co:
+            pytest.skip(f"COMPRESS={comp} not supported")
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    options = options + ["BLOCKSIZE=16"]
+
+    def create(filename):
+        ds = gdal.GetDriverByName("MRF").CreateCopy(filename, src_ds, options=options)
+        ds.BuildOverviews("AVERAGE", [2, 4])
+        ds = None
+        ds = gdal.Open(filename)
+        cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+        ovr_cs = ds.GetRasterBand(1).GetOverview(0).Checksum()
+        ds = None
+        f = gdal.VSIFOpenL(filename[:-3] + "idx", "rb")
+        idx = gdal.VSIFReadL(1, 100000, f)
+        gdal.VSIFCloseL(f)
+        return cs, ovr_cs, idx
+
+    ref = create(str(tmp_vsimem / "ref.mrf"))
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        got = create(str(tmp_vsimem / "out.mrf"))
+    assert got[0] == ref[0]
+    assert got[1] == ref[1]
+    # Same tile order in the data file
+    assert got[2] == ref[2]
+
+
 def test_mrf_cleanup():
 
     files = (
@@ -6529,3 +6529,62 @@ def test_netcdf_create_metadata_with_equal_sign(tmp_path):
 
     ds = gdal.Open(fname)
     assert ds.GetRasterBand(1).GetMetadataItem("long_name") == value
+
+
+###############################################################################
+# Test reading the blocks of all the bands of a netCDF-4 chunk at once
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("bottom_up", ["YES", "NO"])
+def test_netcdf_read_band_chunk_at_once(tmp_path, bottom_up):
+
+    fname = str(tmp_path / "test_netcdf_read_band_chunk_at_once.nc")
+
+    ds = gdal.GetDriverByName("netCDF").CreateMultiDimensional(
+        fname, options=["FORMAT=NC4"]
+    )
+    rg = ds.GetRootGroup()
+    dim_t = rg.CreateDimension("time", None, None, 7)
+    dim_y = rg.CreateDimension("y", None, None, 9)
+    dim_x = rg.CreateDimension("x", None, None, 11)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim_t, dim_y, dim_x],
+        gdal.ExtendedDataType.Create(gdal.GDT_Int16),
+        ["BLOCKSIZE=3,4,5"],
+    )
+    ar.Write(struct.pack("h" * (7 * 9 * 11), *[i for i in range(7 * 9 * 11)]))
+    ds = None
+
+    with gdaltest.config_options(
+        {
+            "GDAL_NETCDF_BOTTOMUP": bottom_up,
+            "GDAL_NETCDF_READ_BAND_CHUNK_AT_ONCE": "NO",
+        }
+    ):
+        ds = gdal.Open(fname)
+        expected = [
+            ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+        ]
+        expected_window = ds.GetRasterBand(6).ReadRaster(3, 2, 8, 7)
+        ds = None
+
+    def my_handler(typ, errno, msg):
+        if typ == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    debug_msgs = []
+    with gdaltest.config_options(
+        {"GDAL_NETCDF_BOTTOMUP": bottom_up, "CPL_DEBUG": "GDAL_netCDF"}
+    ):
+        ds = gdal.Open(fname)
+        with gdaltest.error_handler(my_handler):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            assert ds.GetRasterBand(6).ReadRaster(3, 2, 8, 7) == expected_window
+        assert "GDAL_netCDF: Reading chunk of bands 4 to 6 at once" in debug_msgs
+        assert ds.RasterCount == 7
+        assert ds.GetRasterBand(1).GetBlockSize() == [5, 4]
+        # Read bands in non-sequential order
+        for i in (5, 0, 6, 2, 1, 4, 3):
+            assert ds.GetRasterBand(i + 1).ReadRaster() == expected[i], i
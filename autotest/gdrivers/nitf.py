@@ -1639,6 +1639,30 @@ def test_nitf_39():
     ds = None
 
 
+###############################################################################
+# Test multi-threaded decoding of JPEG blocks
+
+
+@pytest.mark.parametrize("ic", ["C3", "M3"])
+def test_nitf_jpeg_blocks_multithreaded(tmp_vsimem, ic):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    filename = str(tmp_vsimem / "out.ntf")
+    gdal.GetDriverByName("NITF").CreateCopy(
+        filename, src_ds, options=["IC=" + ic, "BLOCKSIZE=16", "QUALITY=100"]
+    )
+
+    ds = gdal.Open(filename)
+    expected = ds.ReadRaster()
+    expected_window = ds.ReadRaster(8, 8, 24, 24)
+    ds = None
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster(8, 8, 24, 24) == expected_window
+        assert ds.ReadRaster() == expected
+
+
 ###############################################################################
 # Create a 10 GB NITF file
 
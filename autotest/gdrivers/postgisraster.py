@@ -661,6 +661,31 @@ def test_postgisraster_test_outdb_client_side_if_possible():
     assert cs == [30111, 32302, 40026]
 
 
+###############################################################################
+# Test fetching tiles over one or several connections (PR_NUM_CONNECTIONS)
+
+
+@pytest.mark.parametrize(
+    "table", ["small_world_constraint", "small_world_constraint_with_spi"]
+)
+def test_postgisraster_test_num_connections(table):
+
+    results = {}
+    for num_connections in ("1", "4"):
+        with gdaltest.config_option("PR_NUM_CONNECTIONS", num_connections):
+            ds = gdal.Open(
+                gdaltest.postgisraster_connection_string
+                + f"table='{table}' mode=2"
+            )
+            cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+            window = ds.ReadRaster(100, 50, 200, 100)
+            ds = None
+        results[num_connections] = (cs, window)
+
+    assert results["1"][0] == [30111, 32302, 40026]
+    assert results["4"] == results["1"]
+
+
 ###############################################################################
 # Test gdal subdataset informational functions
 
@@ -28,6 +28,8 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import json
+
 import pytest
 
 from osgeo import gdal
@@ -74,6 +76,24 @@ def test_stacit_max_items():
     assert ds.GetRasterBand(1).Checksum() == 4672
 
 
+def test_stacit_links_before_features(tmp_vsimem):
+
+    # The next page is fetched as soon as the "links" member has been parsed
+    links = [{"rel": "next", "href": str(tmp_vsimem / "page2.json")}]
+    page1 = open("data/stacit/test.json").read()
+    page1 = page1.replace('"links"', '"unused_links"')
+    page1 = '{\n  "links": ' + json.dumps(links) + "," + page1[1:]
+    gdal.FileFromMemBuffer(tmp_vsimem / "page1.json", page1)
+    gdal.FileFromMemBuffer(
+        tmp_vsimem / "page2.json", open("data/stacit/test_page2.json").read()
+    )
+
+    ds = gdal.Open(tmp_vsimem / "page1.json")
+    assert ds is not None
+    assert ds.RasterXSize == 40
+    assert ds.GetRasterBand(1).Checksum() == 9239
+
+
 def test_stacit_multiple_assets():
 
     ds = gdal.Open("data/stacit/test_multiple_assets.json")
@@ -2064,6 +2064,71 @@ def test_vrtpansharpen_10():
     assert data == ref_data
 
 
+###############################################################################
+# Test Float32 optimizations
+
+
+def test_vrtpansharpen_float32():
+
+    ds = gdal.GetDriverByName("GTiff").Create(
+        "/vsimem/pan_float32.tif", 1023, 1023, 1, gdal.GDT_Float32
+    )
+    ds.SetGeoTransform([0, 1.0 / 1023, 0, 0, 0, 1.0 / 1023])
+    ds.WriteRaster(
+        0,
+        0,
+        1023,
+        1023,
+        struct.pack("f" * 1023, *[1000.5 + i for i in range(1023)]),
+        buf_xsize=1023,
+        buf_ysize=1,
+    )
+    ds = None
+    ds = gdal.GetDriverByName("GTiff").Create(
+        "/vsimem/ms_float32.tif", 256, 256, 4, gdal.GDT_Float32
+    )
+    ds.SetGeoTransform([0, 1.0 / 256, 0, 0, 0, 1.0 / 256])
+    for i in range(4):
+        ds.GetRasterBand(i + 1).Fill(100.25 * (i + 1))
+    ds = None
+
+    for nbands in (3, 4):
+        spectral_bands = "".join(
+            f"""<SpectralBand dstBand="{i + 1}">
+                    <SourceFilename>/vsimem/ms_float32.tif</SourceFilename>
+                    <SourceBand>{i + 1}</SourceBand>
+            </SpectralBand>"""
+            for i in range(nbands)
+        )
+        vrt_ds = gdal.Open(
+            f"""<VRTDataset subClass="VRTPansharpenedDataset">
+        <PansharpeningOptions>
+            <NumThreads>ALL_CPUS</NumThreads>
+            <PanchroBand>
+                    <SourceFilename>/vsimem/pan_float32.tif</SourceFilename>
+                    <SourceBand>1</SourceBand>
+            </PanchroBand>
+            {spectral_bands}
+        </PansharpeningOptions>
+    </VRTDataset>"""
+        )
+        assert vrt_ds.GetRasterBand(1).DataType == gdal.GDT_Float32
+
+        # Actually go through the optimized impl
+        data = struct.unpack(
+            "f" * (1023 * 1023 * nbands), vrt_ds.ReadRaster(buf_type=gdal.GDT_Float32)
+        )
+        # And check against the generic one
+        ref_data = struct.unpack(
+            "d" * (1023 * 1023 * nbands), vrt_ds.ReadRaster(buf_type=gdal.GDT_Float64)
+        )
+        for i in range(0, len(data), 997):
+            assert data[i] == pytest.approx(ref_data[i], rel=1e-6)
+
+    gdal.Unlink("/vsimem/pan_float32.tif")
+    gdal.Unlink("/vsimem/ms_float32.tif")
+
+
 ###############################################################################
 # Test gdal.CreatePansharpenedVRT()
 
@@ -226,6 +226,64 @@ def test_vrtprocesseddataset_several_steps(tmp_vsimem):
     assert ds.GetRasterBand(3).ComputeRasterMinMax(False) == (3, 3)
 
 
+###############################################################################
+# Test that pixel-wise steps are processed by chunks of lines, possibly in
+# parallel, with the same result as processing blocks at once
+
+
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_vrtprocesseddataset_pixel_wise_steps_chunked(tmp_vsimem, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename, 600, 500, 3, options=["TILED=YES", "BLOCKXSIZE=512"]
+    )
+    src_data = np.arange(600 * 500 * 3, dtype=np.uint8).reshape(3, 500, 600)
+    src_ds.WriteRaster(0, 0, 600, 500, src_data.tobytes())
+    src_ds.Close()
+
+    xml = f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <SourceFilename>{src_filename}</SourceFilename>
+    </Input>
+    <BlockXSize>600</BlockXSize>
+    <BlockYSize>500</BlockYSize>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">1,0,1,0</Argument>
+            <Argument name="coefficients_2">0,0,0,1</Argument>
+            <Argument name="coefficients_3">0,1,0,0</Argument>
+        </Step>
+        <Step>
+            <Algorithm>LUT</Algorithm>
+            <Argument name="lut_1">0:0,256:512</Argument>
+            <Argument name="lut_2">0:0,255:255</Argument>
+            <Argument name="lut_3">0:255,255:0</Argument>
+        </Step>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">0,0.5,0,0</Argument>
+            <Argument name="coefficients_2">0,0,1,0</Argument>
+            <Argument name="coefficients_3">0,0,0,1</Argument>
+        </Step>
+    </ProcessingSteps>
+    </VRTDataset>"""
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": num_threads} if num_threads else {}
+    ):
+        ds = gdal.Open(xml)
+        assert ds.GetRasterBand(1).GetBlockSize() == [600, 500]
+        got = ds.ReadAsArray()
+
+    np.testing.assert_array_equal(
+        got[0], np.minimum(src_data[1].astype(np.int32) + 1, 255)
+    )
+    np.testing.assert_array_equal(got[1], src_data[2])
+    np.testing.assert_array_equal(got[2], 255 - src_data[0])
+
+
 ###############################################################################
 # Test nominal cases of BandAffineCombination algorithm with nodata
 
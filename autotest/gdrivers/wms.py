@@ -37,6 +37,7 @@ from time import sleep
 
 import gdaltest
 import pytest
+import webserver
 
 from osgeo import gdal
 
@@ -1160,3 +1161,235 @@ def test_wms_cache_path():
 
     with pytest.raises(Exception):
         gdal.Open("<GDAL_WMS><Service/><Cache/></GDAL_WMS>")
+
+
+###############################################################################
+# Tests of the file cache, with tiles served by a local web server
+
+
+@pytest.fixture(scope="module")
+def server():
+
+    (process, port) = webserver.launch(handler=webserver.DispatcherHttpHandler)
+
+    if port == 0:
+        pytest.skip()
+
+    import collections
+
+    WebServer = collections.namedtuple("WebServer", "process port")
+
+    yield WebServer(process, port)
+
+    webserver.server_stop(process, port)
+
+
+class WMSTileHandler:
+    """Serves the same PNG tile for all requests, and counts them"""
+
+    def __init__(self, tile, delay=0):
+        self.tile = tile
+        self.delay = delay
+        self.get_count = 0
+
+    def final_check(self):
+        pass
+
+    def do_GET(self, request):
+        self.get_count += 1
+        if self.delay:
+            sleep(self.delay)
+        request.send_response(200)
+        request.send_header("Content-Type", "image/png")
+        request.send_header("Content-Length", len(self.tile))
+        request.end_headers()
+        request.wfile.write(self.tile)
+
+
+@pytest.fixture()
+def wms_tile(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 256, 256, 3)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).Fill(64 * (i + 1))
+    filename = str(tmp_vsimem / "tile.png")
+    gdal.GetDriverByName("PNG").CreateCopy(filename, src_ds)
+    f = gdal.VSIFOpenL(filename, "rb")
+    tile = gdal.VSIFReadL(1, gdal.VSIStatL(filename).size, f)
+    gdal.VSIFCloseL(f)
+    return tile
+
+
+def wms_cache_xml(port, cache_dir, extra_cache_options=""):
+
+    return f"""<GDAL_WMS>
+    <Service name="TMS">
+        <ServerUrl>http://127.0.0.1:{port}/tiles/${{z}}/${{x}}/${{y}}.png</ServerUrl>
+    </Service>
+    <DataWindow>
+        <UpperLeftX>-20037508.34</UpperLeftX>
+        <UpperLeftY>20037508.34</UpperLeftY>
+        <LowerRightX>20037508.34</LowerRightX>
+        <LowerRightY>-20037508.34</LowerRightY>
+        <TileLevel>0</TileLevel>
+        <TileCountX>1</TileCountX>
+        <TileCountY>1</TileCountY>
+        <YOrigin>top</YOrigin>
+    </DataWindow>
+    <Projection>EPSG:3857</Projection>
+    <BlockSizeX>256</BlockSizeX>
+    <BlockSizeY>256</BlockSizeY>
+    <BandsCount>3</BandsCount>
+    <Cache>
+        <Path>{cache_dir}</Path>
+        <Unique>False</Unique>
+        {extra_cache_options}
+    </Cache>
+</GDAL_WMS>"""
+
+
+def wms_cache_tile_path(port, cache_dir):
+
+    url = f"http://127.0.0.1:{port}/tiles/0/0/0.png"
+    md5 = hashlib.md5(url.encode("utf-8")).hexdigest()
+    return cache_dir / md5[0] / md5[1] / md5
+
+
+def wms_cache_list_files(cache_dir):
+
+    return sorted(
+        os.path.relpath(os.path.join(root, name), cache_dir).replace("\\", "/")
+        for root, _, files in os.walk(cache_dir)
+        for name in files
+    )
+
+
+###############################################################################
+# Test that a tile being downloaded by a thread is not downloaded again by
+# another thread using the same cache, but read from the cache
+
+
+def test_wms_cache_deduplicate_in_flight_requests(tmp_path, server, wms_tile):
+
+    import threading
+
+    cache_dir = tmp_path / "cache"
+    xml = wms_cache_xml(server.port, cache_dir)
+    datasets = [gdal.Open(xml) for i in range(2)]
+    results = [None, None]
+    barrier = threading.Barrier(2)
+
+    def read(i):
+        barrier.wait()
+        results[i] = datasets[i].GetRasterBand(1).Checksum()
+
+    # The delay makes sure the second thread starts while the tile is being
+    # downloaded by the first one
+    handler = WMSTileHandler(wms_tile, delay=0.5)
+    with webserver.install_http_handler(handler):
+        threads = [threading.Thread(target=read, args=(i,)) for i in range(2)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+    datasets = None
+
+    assert handler.get_count == 1
+    assert results[0] is not None
+    assert results[0] == results[1]
+
+
+###############################################################################
+# Test that tiles are inserted in the cache through a temporary file, renamed
+# to the final name
+
+
+def test_wms_cache_insert(tmp_path, server, wms_tile):
+
+    cache_dir = tmp_path / "cache"
+    handler = WMSTileHandler(wms_tile)
+    with webserver.install_http_handler(handler):
+        ds = gdal.Open(wms_cache_xml(server.port, cache_dir))
+        cs = ds.GetRasterBand(1).Checksum()
+        ds = None
+    assert handler.get_count == 1
+
+    tile_path = wms_cache_tile_path(server.port, cache_dir)
+    assert wms_cache_list_files(cache_dir) == [
+        os.path.relpath(tile_path, cache_dir).replace("\\", "/")
+    ]
+    with open(tile_path, "rb") as f:
+        assert f.read() == wms_tile
+
+    # Read again from the cache
+    handler = WMSTileHandler(wms_tile)
+    with webserver.install_http_handler(handler):
+        ds = gdal.Open(wms_cache_xml(server.port, cache_dir))
+        assert ds.GetRasterBand(1).Checksum() == cs
+        ds = None
+    assert handler.get_count == 0
+
+
+###############################################################################
+# Test that the cleaning of the cache removes the temporary files left by
+# interrupted insertions, but not the ones of insertions in progress
+
+
+def test_wms_cache_clean_temporary_files(tmp_path, server, wms_tile):
+
+    cache_dir = tmp_path / "cache"
+    os.makedirs(cache_dir / "a" / "b")
+    stale_tmp = cache_dir / "a" / "b" / "leftover.1234_0.tmp"
+    recent_tmp = cache_dir / "a" / "b" / "inprogress.1234_1.tmp"
+    for filename in (stale_tmp, recent_tmp):
+        with open(filename, "wb") as f:
+            f.write(b"x" * 100)
+    two_hours_ago = os.path.getmtime(recent_tmp) - 7200
+    os.utime(stale_tmp, (two_hours_ago, two_hours_ago))
+
+    # The insertion of the tile triggers the cleaning, that is complete when
+    # the dataset is closed
+    handler = WMSTileHandler(wms_tile)
+    with webserver.install_http_handler(handler):
+        ds = gdal.Open(wms_cache_xml(server.port, cache_dir))
+        ds.GetRasterBand(1).Checksum()
+        ds = None
+
+    assert not stale_tmp.exists()
+    assert recent_tmp.exists()
+    assert wms_cache_tile_path(server.port, cache_dir).exists()
+
+
+###############################################################################
+# Test that, when the cache exceeds MaxSize, the oldest tiles are evicted
+# first until it fits
+
+
+def test_wms_cache_clean_evicts_oldest_first(tmp_path, server, wms_tile):
+
+    cache_dir = tmp_path / "cache"
+    os.makedirs(cache_dir / "0" / "0")
+    old_files = [cache_dir / "0" / "0" / f"old{i}" for i in range(3)]
+    for filename in old_files:
+        with open(filename, "wb") as f:
+            f.write(b"x" * 1000)
+    # old0 is the oldest one. None is expired.
+    now = os.path.getmtime(old_files[0])
+    for i, filename in enumerate(old_files):
+        mtime = now - 300 + 100 * i
+        os.utime(filename, (mtime, mtime))
+
+    # Room for the new tile and two of the old ones
+    max_size = len(wms_tile) + 2500
+    handler = WMSTileHandler(wms_tile)
+    with webserver.install_http_handler(handler):
+        ds = gdal.Open(
+            wms_cache_xml(server.port, cache_dir, f"<MaxSize>{max_size}</MaxSize>")
+        )
+        ds.GetRasterBand(1).Checksum()
+        ds = None
+
+    assert not old_files[0].exists()
+    assert old_files[1].exists()
+    assert old_files[2].exists()
+    assert wms_cache_tile_path(server.port, cache_dir).exists()
@@ -5470,3 +5470,455 @@ def test_zarr_read_cf1_zarrv3():
         ds.GetSpatialRef().ExportToProj4()
         == "+proj=utm +zone=11 +ellps=clrk66 +units=m +no_defs"
     )
+
+
+###############################################################################
+# Test writing and reading arrays using the sharding_indexed codec
+
+
+@pytest.mark.parametrize("num_threads", [None, "4"])
+@gdaltest.enable_exceptions()
+def test_zarr_write_read_sharding_v3(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=ZARR_V3"]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 8)
+    dim1 = rg.CreateDimension("dim1", None, None, 12)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=4,6", "SHARD_INNER_BLOCKSIZE=2,3", "COMPRESS=GZIP"],
+    )
+    data = array.array("H", [i for i in range(8 * 12)])
+    assert ar.Write(data) == gdal.CE_None
+    ds = None
+
+    f = gdal.VSIFOpenL(filename + "/test/zarr.json", "rb")
+    assert f
+    data_json = gdal.VSIFReadL(1, 10000, f)
+    gdal.VSIFCloseL(f)
+    j = json.loads(data_json)
+    assert len(j["codecs"]) == 1
+    assert j["codecs"][0]["name"] == "sharding_indexed"
+    config = j["codecs"][0]["configuration"]
+    assert config["chunk_shape"] == [2, 3]
+    assert config["codecs"] == [{"name": "gzip", "configuration": {"level": 6}}]
+    assert config["index_location"] == "end"
+
+    # 2x2 shards of 2x2 inner chunks
+    assert gdal.VSIStatL(filename + "/test/c/1/1") is not None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.GetBlockSize() == [4, 6]
+        assert ar.Read() == data.tobytes()
+        assert ar.Read(array_start_idx=[3, 5], count=[3, 4]) == array.array(
+            "H", [r * 12 + c for r in range(3, 6) for c in range(5, 9)]
+        )
+
+
+###############################################################################
+# Test reading a hand-crafted shard with a missing inner chunk and the index
+# at the start of the shard
+
+
+def _crc32c(data):
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x82F63B78 if crc & 1 else crc >> 1
+    return crc ^ 0xFFFFFFFF
+
+
+@pytest.mark.parametrize("corrupted_crc", [False, True])
+def test_zarr_read_sharding_index_location_start_v3(tmp_vsimem, corrupted_crc):
+
+    j = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [6],
+        "data_type": "uint8",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [6]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 255,
+        "codecs": [
+            {
+                "name": "sharding_indexed",
+                "configuration": {
+                    "chunk_shape": [2],
+                    "codecs": [{"name": "bytes"}],
+                    "index_codecs": [
+                        {"name": "bytes", "configuration": {"endian": "little"}},
+                        {"name": "crc32c"},
+                    ],
+                    "index_location": "start",
+                },
+            }
+        ],
+    }
+    gdal.FileFromMemBuffer(tmp_vsimem / "test.zarr/zarr.json", json.dumps(j))
+
+    index_size = 3 * 16 + 4
+    empty = 0xFFFFFFFFFFFFFFFF
+    # Inner chunks 0 and 2 are stored in reverse order, inner chunk 1 is missing
+    index = struct.pack("<QQQQQQ", index_size + 2, 2, empty, empty, index_size, 2)
+    crc = _crc32c(index) ^ (1 if corrupted_crc else 0)
+    shard = index + struct.pack("<I", crc) + b"\x05\x06" + b"\x01\x02"
+    gdal.FileFromMemBuffer(tmp_vsimem / "test.zarr/c/0", shard)
+
+    ds = gdal.OpenEx(tmp_vsimem / "test.zarr", gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    if corrupted_crc:
+        with gdal.quiet_errors():
+            assert ar.Read() is None
+    else:
+        assert ar.Read() == b"\x01\x02\xff\xff\x05\x06"
+
+
+###############################################################################
+# Test that reading a window intersecting many tiles with GDAL_NUM_THREADS
+# (tiles prefetched in parallel by batches) gives the same result as without
+
+
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+@pytest.mark.parametrize("cachemax", [None, 1000])
+@gdaltest.enable_exceptions()
+def test_zarr_read_prefetch_tiles_num_threads(tmp_vsimem, format, cachemax):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=" + format]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 20)
+    dim1 = rg.CreateDimension("dim1", None, None, 30)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=3,4", "COMPRESS=ZLIB"],
+    )
+    assert ar.Write(array.array("H", [i for i in range(20 * 30)])) == gdal.CE_None
+    ds = None
+
+    requests = [
+        {},
+        {"array_start_idx": [2, 3], "count": [15, 22]},
+        {"array_start_idx": [1, 2], "count": [7, 9], "array_step": [2, 3]},
+        {"array_start_idx": [19, 29], "count": [10, 6], "array_step": [-2, -5]},
+        {"array_start_idx": [0, 0], "count": [4, 3], "array_step": [5, 10]},
+    ]
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    expected = [ar.Read(**kwargs) for kwargs in requests]
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"), gdaltest.SetCacheMax(
+        cachemax if cachemax else gdal.GetCacheMax()
+    ):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        for kwargs, exp in zip(requests, expected):
+            assert ar.Read(**kwargs) == exp, kwargs
+
+
+###############################################################################
+# Test GDAL_MDARRAY_CHUNK_CACHE_SIZE
+
+
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+@gdaltest.enable_exceptions()
+def test_zarr_read_decoded_chunk_cache(tmp_vsimem, format):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=" + format]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 10)
+    dim1 = rg.CreateDimension("dim1", None, None, 7)
+    dim2 = rg.CreateDimension("dim2", None, None, 9)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1, dim2],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=4,3,2"],
+    )
+    assert ar.Write(array.array("H", [i for i in range(10 * 7 * 9)])) == gdal.CE_None
+    ds = None
+
+    requests = [
+        {},
+        {"array_start_idx": [0, 2, 3], "count": [10, 1, 1]},
+        {"array_start_idx": [1, 1, 2], "count": [4, 5, 6], "array_step": [2, 1, 1]},
+        {"array_start_idx": [9, 6, 8], "count": [4, 3, 3], "array_step": [-3, -2, -4]},
+        {"array_start_idx": [3, 0, 1], "count": [1, 7, 4], "array_step": [0, 1, 2]},
+    ]
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    expected = [ar.Read(**kwargs) for kwargs in requests]
+    expected_float = ar.Read(
+        buffer_datatype=gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+    )
+    expected_transposed = ar.Transpose([2, 1, 0]).Read()
+    expected_pixels = [
+        ar.GetView("[:,%d,%d]" % (j, i)).Read() for j, i in ((0, 0), (6, 8))
+    ]
+    ds = None
+
+    with gdaltest.config_option("GDAL_MDARRAY_CHUNK_CACHE_SIZE", "1000000"):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        for kwargs, exp in zip(requests, expected):
+            assert ar.Read(**kwargs) == exp, kwargs
+        assert (
+            ar.Read(buffer_datatype=gdal.ExtendedDataType.Create(gdal.GDT_Float64))
+            == expected_float
+        )
+        assert ar.Transpose([2, 1, 0]).Read() == expected_transposed
+        assert [
+            ar.GetView("[:,%d,%d]" % (j, i)).Read() for j, i in ((0, 0), (6, 8))
+        ] == expected_pixels
+
+        # Writing must invalidate the cached chunks
+        view = ar.GetView("[:,0,0]")
+        assert view.Write(array.array("H", [65535] * 10)) == gdal.CE_None
+        assert struct.unpack("H" * 10, view.Read()) == (65535,) * 10
+
+
+
+###############################################################################
+# Test GDALMDArray::Drill()
+
+
+@gdaltest.enable_exceptions()
+def test_zarr_drill(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("time", None, None, 10)
+    dim1 = rg.CreateDimension("y", None, None, 7)
+    dim2 = rg.CreateDimension("x", None, None, 9)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1, dim2],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=4,3,2"],
+    )
+    ar.Write(array.array("H", [i for i in range(10 * 7 * 9)]))
+
+    def value(t, j, i):
+        return t * 7 * 9 + j * 9 + i
+
+    points = [(0, 0), (6, 8), (1, 1), (2, 1), (1, 0), (5, 3), (6, 8)]
+    got = struct.unpack("H" * (len(points) * 10), ar.Drill(0, points))
+    assert got == tuple(value(t, j, i) for j, i in points for t in range(10))
+
+    got = struct.unpack("H" * (len(points) * 5), ar.Drill(0, points, 3, 5))
+    assert got == tuple(value(t, j, i) for j, i in points for t in range(3, 8))
+
+    got = struct.unpack(
+        "d" * (len(points) * 2),
+        ar.Drill(
+            0,
+            points,
+            start_idx=8,
+            buffer_datatype=gdal.ExtendedDataType.Create(gdal.GDT_Float64),
+        ),
+    )
+    assert got == tuple(value(t, j, i) for j, i in points for t in range(8, 10))
+
+    # Drill along the last dimension
+    points = [(9, 6), (0, 0), (3, 4)]
+    got = struct.unpack("H" * (len(points) * 9), ar.Drill(2, points))
+    assert got == tuple(value(t, j, i) for t, j in points for i in range(9))
+
+    # Array without block size
+    transposed = ar.Transpose([2, 1, 0])
+    points = [(6, 8), (0, 0), (3, 4)]
+    got = struct.unpack("H" * (len(points) * 9), transposed.Drill(0, points))
+    assert got == tuple(value(t, j, i) for j, t in points for i in range(9))
+
+    assert ar.Drill(0, []) == bytearray()
+
+    with pytest.raises(Exception, match="Invalid dim_idx"):
+        ar.Drill(3, [(0, 0)])
+    with pytest.raises(Exception, match="Wrong number of values"):
+        ar.Drill(0, [(0, 0, 0)])
+    with pytest.raises(Exception, match="out of range"):
+        ar.Drill(0, [(0, 9)])
+    with pytest.raises(Exception, match="greater than dimension size"):
+        ar.Drill(0, [(0, 0)], 5, 6)
+
+###############################################################################
+# Test asynchronous writing of tiles with GDAL_NUM_THREADS
+
+
+@pytest.mark.parametrize(
+    "format,options",
+    [
+        ("ZARR_V2", ["COMPRESS=ZLIB"]),
+        ("ZARR_V2", ["COMPRESS=ZLIB", "FILTER=delta", "DIM_SEPARATOR=/"]),
+        ("ZARR_V3", ["COMPRESS=GZIP"]),
+        ("ZARR_V3", ["COMPRESS=GZIP", "SHARD_INNER_BLOCKSIZE=2,2"]),
+    ],
+)
+@gdaltest.enable_exceptions()
+def test_zarr_write_tiles_num_threads(tmp_vsimem, format, options):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=" + format]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 20)
+        dim1 = rg.CreateDimension("dim1", None, None, 30)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["BLOCKSIZE=4,6"] + options,
+        )
+        # Write by rows, so that tiles are completed by several calls
+        for i in range(20):
+            data = array.array("H", [i * 30 + j for j in range(30)])
+            ar.Write(data, array_start_idx=[i, 0], count=[1, 30])
+        # Rewrite some already written tiles
+        data = array.array("H", [65535] * (8 * 12))
+        ar.Write(data, array_start_idx=[4, 6], count=[8, 12])
+        # Reading back while tiles are being written
+        got = struct.unpack("H" * (20 * 30), ar.Read())
+        ds = None
+
+    expected = [
+        65535 if (4 <= i < 12 and 6 <= j < 18) else i * 30 + j
+        for i in range(20)
+        for j in range(30)
+    ]
+    assert list(got) == expected
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert list(struct.unpack("H" * (20 * 30), ar.Read())) == expected
+
+
+###############################################################################
+# Test reading Zarr V3 consolidated metadata stored in the root zarr.json
+
+
+@gdaltest.enable_exceptions()
+def test_zarr_read_consolidated_metadata_v3(tmp_vsimem):
+
+    array_def = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [2],
+        "data_type": "uint8",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [2]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 1,
+        "attributes": {"bar": "baz"},
+    }
+    j = {
+        "zarr_format": 3,
+        "node_type": "group",
+        "attributes": {"root_attr": "val"},
+        "consolidated_metadata": {
+            "kind": "inline",
+            "must_understand": False,
+            "metadata": {
+                "grp": {
+                    "zarr_format": 3,
+                    "node_type": "group",
+                    "attributes": {"foo": "bar"},
+                },
+                "grp/ar": array_def,
+                "implicit/ar2": array_def,
+            },
+        },
+    }
+    # Only the root zarr.json exists: everything else must come from
+    # consolidated metadata
+    filename = str(tmp_vsimem / "test.zarr")
+    gdal.FileFromMemBuffer(filename + "/zarr.json", json.dumps(j))
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    assert rg.GetAttribute("root_attr").Read() == "val"
+    assert rg.GetGroupNames() == ["grp", "implicit"]
+    assert rg.GetMDArrayNames() is None
+    grp = rg.OpenGroup("grp")
+    assert grp.GetAttribute("foo").Read() == "bar"
+    assert grp.GetMDArrayNames() == ["ar"]
+    ar = grp.OpenMDArray("ar")
+    assert ar.GetAttribute("bar").Read() == "baz"
+    assert ar.Read() == b"\x01\x01"
+    implicit = rg.OpenGroup("implicit")
+    assert implicit.GetMDArrayNames() == ["ar2"]
+    assert rg.OpenMDArrayFromFullname("/implicit/ar2").Read() == b"\x01\x01"
+    assert rg.OpenGroup("not_existing") is None
+    ds = None
+
+    ds = gdal.OpenEx(
+        filename, gdal.OF_MULTIDIM_RASTER, open_options=["USE_ZMETADATA=NO"]
+    )
+    assert ds.GetRootGroup().GetGroupNames() is None
+
+
+###############################################################################
+# Test the persistent metadata cache of Zarr V3 datasets
+
+
+@gdaltest.enable_exceptions()
+def test_zarr_read_metadata_cache_v3(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=ZARR_V3"]
+    )
+    rg = ds.GetRootGroup()
+    grp = rg.CreateGroup("grp")
+    dim = grp.CreateDimension("dim0", None, None, 2)
+    grp.CreateMDArray(
+        "ar", [dim], gdal.ExtendedDataType.Create(gdal.GDT_Byte)
+    ).Write(b"\x01\x02")
+    ds = None
+
+    cache_dir = str(tmp_vsimem / "cache")
+
+    def explore():
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        rg = ds.GetRootGroup()
+        assert rg.GetGroupNames() == ["grp"]
+        return rg.OpenGroup("grp").GetMDArrayNames()
+
+    with gdaltest.config_option("ZARR_METADATA_CACHE_DIR", cache_dir):
+        assert explore() == ["ar"]
+    assert len(gdal.ReadDir(cache_dir)) == 1
+
+    # Remove the zarr.json file of the array: it is still known from the cache
+    gdal.Unlink(filename + "/grp/ar/zarr.json")
+    with gdaltest.config_option("ZARR_METADATA_CACHE_DIR", cache_dir):
+        assert explore() == ["ar"]
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArrayFromFullname("/grp/ar")
+        assert ar.Read() == b"\x01\x02"
+        ds = None
+    assert explore() is None
+
+    # Modifying the root zarr.json invalidates the cache
+    j = json.loads(gdal.VSIFile(filename + "/zarr.json", "rb").read())
+    j["attributes"] = {"foo": "bar"}
+    gdal.FileFromMemBuffer(filename + "/zarr.json", json.dumps(j))
+    with gdaltest.config_option("ZARR_METADATA_CACHE_DIR", cache_dir):
+        assert explore() is None
@@ -3089,6 +3089,114 @@ def test_ogr_csv_geom_coord_precision_OGR_APPLY_GEOM_SET_PRECISION(tmp_vsimem):
     assert b"MULTIPOLYGON" in data
 
 
+###############################################################################
+# Test multi-threaded reading, including records with quoted line breaks
+
+
+def test_ogr_csv_read_multithreaded(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    lines = ["\ufeffid,int,text,WKT"]
+    for i in range(2500):
+        if i % 100 == 0:
+            lines.append("")
+        elif i % 100 == 1:
+            lines.append('%d,%d,"multi\r\nline ""%d""\nvalue",' % (i, i, i))
+        else:
+            lines.append('%d,%d,text %d,"POINT (%d %d)"' % (i, i, i, i, -i))
+    gdal.FileFromMemBuffer(filename, "\r\n".join(lines).encode("UTF-8"))
+
+    def get_content():
+        ds = gdal.OpenEx(
+            filename, gdal.OF_VECTOR, open_options=["AUTODETECT_TYPE=YES"]
+        )
+        lyr = ds.GetLayer(0)
+        content = []
+        for f in lyr:
+            geom = f.GetGeometryRef()
+            content.append(
+                (
+                    f.GetFID(),
+                    f["id"],
+                    f["int"],
+                    f["text"],
+                    geom.ExportToIsoWkt() if geom else None,
+                )
+            )
+        # Random access after a partial sequential read
+        lyr.ResetReading()
+        for _ in range(10):
+            lyr.GetNextFeature()
+        content.append(lyr.GetFeature(1500).GetField("text"))
+        content.append(lyr.GetNextFeature().GetFID())
+        return content
+
+    expected_content = get_content()
+    assert len(expected_content) == 2500 - 25 + 2
+    assert expected_content[0][1] == "1"
+    assert expected_content[0][3] == 'multi\nline "1"\nvalue'
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert get_content() == expected_content
+
+
+###############################################################################
+# Test the sidecar spatial index
+
+
+def test_ogr_csv_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    lines = ["id,text,WKT"]
+    for i in range(1000):
+        if i % 100 == 0:
+            lines.append("")
+        elif i % 100 == 1:
+            lines.append('%d,"multi\r\nline",POINT (%d %d)' % (i, i % 50, i // 50))
+        elif i % 100 == 2:
+            lines.append("%d,no geometry," % i)
+        else:
+            lines.append("%d,,POINT (%d %d)" % (i, i % 50, i // 50))
+    gdal.FileFromMemBuffer(filename, "\r\n".join(lines))
+
+    def get_content(ds, wkt="POLYGON ((10 5,20 5,20 10,10 10,10 5))"):
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilter(ogr.CreateGeometryFromWkt(wkt))
+        return [(f.GetFID(), f["id"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    all_wkt = "POLYGON ((-1 -1,-1 21,51 21,51 -1,-1 -1))"
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        expected = get_content(ds)
+        expected_all = get_content(ds, all_wkt)
+        assert not ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+        assert ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_content(ds) == expected
+    assert len(expected) == 66
+    assert len(expected_all) == 1000 - 20
+    assert gdal.VSIStatL(filename + ".sidx") is not None
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        assert filename + ".sidx" in ds.GetFileList()
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_content(ds) == expected
+        assert get_content(ds, all_wkt) == expected_all
+        assert get_content(ds, "POLYGON ((100 100,100 101,101 101,100 100))") == []
+        assert lyr.GetFeatureCount() == 0
+        lyr.SetSpatialFilter(ogr.CreateGeometryFromWkt(expected[0][2]))
+        assert lyr.GetFeatureCount() == 1
+        # Random access while the index is in use
+        assert lyr.GetFeature(500)["id"] == "505"
+
+    # The index is ignored once the data file is modified
+    gdal.FileFromMemBuffer(filename, "\r\n".join(lines[0:500]))
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        assert not ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_content(ds) == [x for x in expected if int(x[1]) < 499]
+        ds.ExecuteSQL("DROP SPATIAL INDEX ON test")
+    assert gdal.VSIStatL(filename + ".sidx") is None
+
+
 ###############################################################################
 
 
@@ -3903,6 +3903,54 @@ def test_ogr_dxf_55():
         )
 
 
+###############################################################################
+# Test a block inserted many times, whose merged geometry is computed once
+
+
+def test_ogr_dxf_insert_same_block_many_times(tmp_vsimem):
+
+    tmpfile = tmp_vsimem / "ogr_dxf_insert_same_block_many_times.dxf"
+    ds = ogr.GetDriverByName("DXF").CreateDataSource(tmpfile)
+    blyr = ds.CreateLayer("blocks")
+    lyr = ds.CreateLayer("entities")
+
+    f = ogr.Feature(blyr.GetLayerDefn())
+    f.SetGeometryDirectly(
+        ogr.CreateGeometryFromWkt(
+            "GEOMETRYCOLLECTION(POLYGON((0 0,0 10,10 10,10 0,0 0)),"
+            "POLYGON((2 2,2 8,8 8,8 2,2 2)))"
+        )
+    )
+    f.SetField("Block", "SQUARE")
+    blyr.CreateFeature(f)
+
+    for i in range(3):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({100 * i} 0)"))
+        f.SetField("BlockName", "SQUARE")
+        if i == 2:
+            f.SetField("BlockAngle", "90")
+            f.SetFieldDoubleList(
+                lyr.GetLayerDefn().GetFieldIndex("BlockScale"), [2.0, 2.0, 1.0]
+            )
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(tmpfile)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 3
+    for envelope, area in [
+        ((0, 10, 0, 10), 64),
+        ((100, 110, 0, 10), 64),
+        ((180, 200, 0, 20), 256),
+    ]:
+        f = lyr.GetNextFeature()
+        g = f.GetGeometryRef()
+        assert g.GetGeometryType() == ogr.wkbPolygon
+        assert g.GetEnvelope() == pytest.approx(envelope)
+        assert g.GetArea() == pytest.approx(area)
+
+
 ###############################################################################
 def test_ogr_dxf_insert_too_many_errors():
 
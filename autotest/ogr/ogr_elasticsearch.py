@@ -529,6 +529,66 @@ def test_ogr_elasticsearch_3(es_url, handle_get, handle_post, handle_put):
     ds = None
 
 
+###############################################################################
+# Test BULK_CONCURRENT_REQUESTS
+
+
+def test_ogr_elasticsearch_bulk_concurrent_requests(
+    es_url, handle_get, handle_post, handle_put
+):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"2.0.0"}}""")
+
+    ds = ogrtest.elasticsearch_drv.CreateDataSource(f"{es_url}/fakeelasticsearch")
+    assert ds is not None, "did not manage to open Elasticsearch datastore"
+
+    handle_put("/fakeelasticsearch/concurrent", "{}")
+    handle_post(
+        "/fakeelasticsearch/concurrent/_mapping/FeatureCollection",
+        post_body='{ "FeatureCollection": { "properties": { "type": { "type": "string" }, "properties": { "properties": { } }, "geometry": { "type": "geo_shape" } } } }',
+        contents="{}",
+    )
+    handle_post(
+        "/fakeelasticsearch/_bulk",
+        post_body="""{"index" :{"_index":"concurrent", "_type":"FeatureCollection"}}
+{ "properties": { } }
+
+""",
+        contents="{}",
+    )
+
+    lyr = ds.CreateLayer(
+        "concurrent",
+        srs=ogrtest.srs_wgs84,
+        options=["FID=", "BULK_SIZE=1", "BULK_CONCURRENT_REQUESTS=2"],
+    )
+    for _ in range(10):
+        feat = ogr.Feature(lyr.GetLayerDefn())
+        assert lyr.CreateFeature(feat) == 0
+    assert lyr.SyncToDisk() == 0
+
+    # Errors of asynchronous requests are reported at the latest on sync
+    handle_put("/fakeelasticsearch/concurrent_error", "{}")
+    handle_post(
+        "/fakeelasticsearch/concurrent_error/_mapping/FeatureCollection",
+        post_body='{ "FeatureCollection": { "properties": { "type": { "type": "string" }, "properties": { "properties": { } }, "geometry": { "type": "geo_shape" } } } }',
+        contents="{}",
+    )
+    lyr = ds.CreateLayer(
+        "concurrent_error",
+        srs=ogrtest.srs_wgs84,
+        options=["FID=", "BULK_SIZE=1", "BULK_CONCURRENT_REQUESTS=2"],
+    )
+    with gdal.quiet_errors():
+        for _ in range(3):
+            feat = ogr.Feature(lyr.GetLayerDefn())
+            lyr.CreateFeature(feat)
+        ret = lyr.SyncToDisk()
+    assert ret != 0
+
+    ds = None
+
+
 ###############################################################################
 # Test basic read functionality
 
@@ -1775,6 +1835,94 @@ def test_ogr_elasticsearch_9(es_url, handle_get, handle_post, handle_delete):
     assert f is not None
 
 
+###############################################################################
+# Test SCROLL_SLICES
+
+
+def test_ogr_elasticsearch_scroll_slices(
+    es_url, handle_get, handle_post, handle_delete
+):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"5.0.0"}}""")
+
+    handle_get("""/fakeelasticsearch/_cat/indices?h=i""", "a_layer  \n")
+    handle_get(
+        """/fakeelasticsearch/a_layer/_mapping?pretty""",
+        """
+{
+    "a_layer":
+    {
+        "mappings":
+        {
+            "FeatureCollection":
+            {
+                "properties":
+                {
+                    "type": { "type": "text" },
+                    "properties" :
+                    {
+                        "properties":
+                        {
+                            "str_field": { "type": "text"}
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+""",
+    )
+    handle_get(
+        """/fakeelasticsearch/a_layer/FeatureCollection/_search?scroll=1m&size=100""",
+        """{}""",
+    )
+
+    def hit(scroll_id, value):
+        return (
+            """{ "_scroll_id": "%s", "hits": { "hits": [ { "_id": "%s", "_source": { "type": "Feature", "properties": { "str_field": "%s" } } } ] } }"""
+            % (scroll_id, value, value)
+        )
+
+    # First slice: exhausted after its first page
+    handle_post(
+        """/fakeelasticsearch/a_layer/FeatureCollection/_search?scroll=1m&size=100""",
+        post_body="""{ "slice": { "id": 0, "max": 2 } }""",
+        contents=hit("scroll_slice0", "foo"),
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=scroll_slice0""",
+        """{ "_scroll_id": "scroll_slice0", "hits": { "hits": [] } }""",
+    )
+    # Second slice: returns two pages
+    handle_post(
+        """/fakeelasticsearch/a_layer/FeatureCollection/_search?scroll=1m&size=100""",
+        post_body="""{ "slice": { "id": 1, "max": 2 } }""",
+        contents=hit("scroll_slice1", "bar"),
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=scroll_slice1""",
+        hit("scroll_slice1_bis", "baz"),
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=scroll_slice1_bis""",
+        """{}""",
+    )
+    handle_delete(
+        "/fakeelasticsearch/_search/scroll?scroll_id=scroll_slice1_bis",
+        "{}",
+    )
+
+    ds = gdal.OpenEx(
+        f"ES:{es_url}/fakeelasticsearch", open_options=["SCROLL_SLICES=2"]
+    )
+    lyr = ds.GetLayer(0)
+    for _ in range(2):
+        values = sorted(f["str_field"] for f in lyr)
+        assert values == ["bar", "baz", "foo"]
+        lyr.ResetReading()
+
+
 ###############################################################################
 # Test SQL
 
@@ -1171,6 +1171,56 @@ def test_ogr_flatgeobuf_arrow_stream_empty_file():
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test GDAL_NUM_THREADS on writing (Hilbert sort) and reading (Arrow stream)
+
+
+@pytest.mark.parametrize("spatial_filter", [False, True])
+def test_ogr_flatgeobuf_multithreaded(tmp_vsimem, spatial_filter):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    def create(filename):
+        ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+        for i in range(25000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["id"] = i
+            x = (i * 7919) % 1000
+            y = (i * 104729) % 997
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({x} {y})"))
+            lyr.CreateFeature(f)
+        ds = None
+
+    def read(filename):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        if spatial_filter:
+            lyr.SetSpatialFilterRect(100, 200, 600, 700)
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=1000"])
+        ret = []
+        for batch in stream:
+            ret += [
+                (id, bytes(geom))
+                for id, geom in zip(batch["id"], batch["wkb_geometry"])
+            ]
+        lyr.ResetReading()
+        assert [(f["id"], f.GetGeometryRef().ExportToWkb()) for f in lyr] == ret
+        return ret
+
+    filename_st = str(tmp_vsimem / "st.fgb")
+    create(filename_st)
+    expected = read(filename_st)
+
+    filename_mt = str(tmp_vsimem / "mt.fgb")
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        create(filename_mt)
+        assert read(filename_mt) == expected
+        assert read(filename_st) == expected
+    assert read(filename_mt) == expected
+
+
 def test_ogr_flatgeobuf_issue_7401():
     # Verify null geom handling without spatial index
     ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource("/vsimem/test.fgb")
@@ -5151,3 +5151,56 @@ def test_ogr_geojson_geom_coord_precision_RFC7946(tmp_vsimem):
     prec = geom_fld.GetCoordinatePrecision()
     assert prec.GetXYResolution() == pytest.approx(8.983152841195214e-09)
     assert prec.GetZResolution() == 1e-3
+
+
+###############################################################################
+# Test multi-threaded conversion of features
+
+
+@pytest.mark.parametrize("native_data", [False, True])
+def test_ogr_geojson_read_multithreaded(tmp_vsimem, native_data):
+
+    filename = tmp_vsimem / "test_ogr_geojson_read_multithreaded.json"
+    features = []
+    for i in range(2500):
+        if i % 100 == 0:
+            # Missing and duplicated ids are renumbered
+            id_member = ""
+        elif i % 100 == 1:
+            id_member = '"id":1,'
+        else:
+            id_member = '"id":%d,' % i
+        features.append(
+            '{"type":"Feature",%s"properties":{"int":%d,"str":"%d","list":[%d]},'
+            '"geometry":{"type":"Point","coordinates":[%d,%d]}}'
+            % (id_member, i, i, i, i, -i)
+        )
+    gdal.FileFromMemBuffer(
+        filename,
+        '{"type":"FeatureCollection","features":[%s]}' % ",".join(features),
+    )
+
+    open_options = ["NATIVE_DATA=YES"] if native_data else []
+
+    def get_content():
+        ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=open_options)
+        lyr = ds.GetLayer(0)
+        content = []
+        for f in lyr:
+            content.append(
+                (
+                    f.GetFID(),
+                    f["int"],
+                    f["str"],
+                    f["list"],
+                    f.GetGeometryRef().ExportToIsoWkt(),
+                    f.GetNativeData(),
+                )
+            )
+        return content
+
+    with gdal.quiet_errors():
+        expected_content = get_content()
+    assert len(expected_content) == 2500
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"), gdal.quiet_errors():
+        assert get_content() == expected_content
@@ -490,3 +490,106 @@ def test_ogr_geojsonseq_geom_coord_precision_not_4326(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert b'"coordinates": [ 2.363925, 45.151706, 9.877 ]' in data
+
+
+###############################################################################
+# Test multi-threaded reading
+
+
+def test_ogr_geojsonseq_read_multithreaded(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    records = []
+    for i in range(2500):
+        if i % 100 == 50:
+            # Bare geometries are wrapped in features
+            records.append('{"type":"Point","coordinates":[%d,%d]}' % (i, -i))
+        elif i % 100 == 1:
+            records.append("")
+        elif i % 100 == 2:
+            records.append('{"type":"FeatureCollection","features":[]}')
+        else:
+            id_member = '"id":%d,' % (10000 + i) if i % 2 else ""
+            records.append(
+                '{"type":"Feature",%s"properties":{"int":%d,"str":"%d"},'
+                '"geometry":{"type":"Point","coordinates":[%d,%d]}}'
+                % (id_member, i, i, i, -i)
+            )
+    gdal.FileFromMemBuffer(filename, "\r\n".join(records))
+
+    def get_content():
+        ds = gdal.OpenEx(filename, gdal.OF_VECTOR)
+        lyr = ds.GetLayer(0)
+        content = []
+        for f in lyr:
+            content.append(
+                (
+                    f.GetFID(),
+                    f["int"],
+                    f["str"],
+                    f.GetGeometryRef().ExportToIsoWkt(),
+                )
+            )
+        return content
+
+    expected_content = get_content()
+    assert len(expected_content) == 2500 - 2 * 25
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert get_content() == expected_content
+
+
+###############################################################################
+# Test the sidecar spatial index
+
+
+def test_ogr_geojsonseq_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    records = []
+    for i in range(1000):
+        if i % 100 == 1:
+            records.append("")
+        elif i % 100 == 2:
+            records.append('{"type":"Feature","properties":{},"geometry":null}')
+        else:
+            id_member = '"id":%d,' % (10000 + i) if i % 2 else ""
+            records.append(
+                '{"type":"Feature",%s"properties":{"int":%d},'
+                '"geometry":{"type":"Point","coordinates":[%d,%d]}}'
+                % (id_member, i, i % 50, i // 50)
+            )
+    gdal.FileFromMemBuffer(filename, "\n".join(records))
+
+    def get_content(ds, wkt="POLYGON ((10 5,20 5,20 10,10 10,10 5))"):
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilter(ogr.CreateGeometryFromWkt(wkt))
+        return [(f.GetFID(), f["int"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    all_wkt = "POLYGON ((-1 -1,-1 21,51 21,51 -1,-1 -1))"
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        expected = get_content(ds)
+        expected_all = get_content(ds, all_wkt)
+        assert not ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+        assert ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_content(ds) == expected
+    assert len(expected) == 66
+    assert len(expected_all) == 1000 - 20
+    assert gdal.VSIStatL(filename + ".sidx") is not None
+
+    # Use a small buffer to exercise seeking out of the current buffer
+    with gdaltest.config_option("OGR_GEOJSONSEQ_CHUNK_SIZE", "100"):
+        with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+            assert filename + ".sidx" in ds.GetFileList()
+            assert ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+            assert get_content(ds) == expected
+            assert get_content(ds, all_wkt) == expected_all
+
+    # The index is ignored once the data file is modified
+    gdal.FileFromMemBuffer(filename, "\n".join(records[0:500]))
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        assert not ds.GetLayer(0).TestCapability(ogr.OLCFastSpatialFilter)
+        assert get_content(ds) == [x for x in expected if x[1] < 500]
+        ds.ExecuteSQL("DROP SPATIAL INDEX ON test")
+    assert gdal.VSIStatL(filename + ".sidx") is None
+
@@ -4315,3 +4315,40 @@ def test_ogr_gml_geom_coord_precision(tmp_vsimem):
     prec = geom_fld.GetCoordinatePrecision()
     assert prec.GetXYResolution() == 1e-5
     assert prec.GetZResolution() == 1e-3
+
+
+###############################################################################
+# Test building geometries with worker threads (GDAL_NUM_THREADS)
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/gml/gnis_pop_100.gml",
+        "data/gml/multiple_geometry_fields_srs_detection.gml",
+    ],
+)
+def test_ogr_gml_read_num_threads(filename):
+    def get_features():
+        ds = gdal.OpenEx(filename, open_options=["WRITE_GFS=NO"])
+        ret = []
+        for lyr in ds:
+            for f in lyr:
+                ret.append(
+                    [f.GetFID(), f.GetField(0)]
+                    + [
+                        (
+                            f.GetGeomFieldRef(i).ExportToIsoWkt()
+                            if f.GetGeomFieldRef(i)
+                            else None
+                        )
+                        for i in range(f.GetGeomFieldCount())
+                    ]
+                )
+        return ret
+
+    ref = get_features()
+    assert ref
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        got = get_features()
+    assert got == ref
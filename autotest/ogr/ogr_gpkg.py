@@ -8408,6 +8408,61 @@ def test_ogr_gpkg_arrow_stream_numpy_multi_threading(
     assert i == num_features
 
 
+###############################################################################
+# Test multi-threaded Arrow interface with holes in the FID numbering
+
+
+@pytest.mark.parametrize(
+    "fids",
+    [
+        [fid for fid in range(5, 1005) if not (300 <= fid < 450)],
+        [fid for fid in range(1, 1001) if fid % 3 != 0],
+        # Too sparse FID numbering for the optimized code path
+        [1, 2, 3, 1000, 10000],
+    ],
+)
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_ogr_gpkg_arrow_stream_numpy_multi_threading_fid_holes(
+    tmp_vsimem, fids, num_threads
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+
+    for fid in fids:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(fid)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({fid} {fid})"))
+        lyr.CreateFeature(f)
+
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    with gdaltest.config_option("OGR_GPKG_NUM_THREADS", str(num_threads)):
+        for _ in range(2):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            got_fids = []
+            gdal.ErrorReset()
+            for batch in stream:
+                assert len(batch["fid"]) > 0
+                for fid, wkb in zip(batch["fid"], batch["geom"]):
+                    assert (
+                        ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt()
+                        == f"POINT ({fid} {fid})"
+                    )
+                    got_fids.append(fid)
+            assert gdal.GetLastErrorMsg() == ""
+            assert got_fids == fids
+            lyr.ResetReading()
+
+
 ###############################################################################
 # Test Arrow interface with bool fields
 
@@ -9980,6 +10035,89 @@ def test_ogr_gpkg_write_arrow_fallback_types(tmp_vsimem):
     assert f.GetGeometryRef().ExportToIsoWkt() == "POINT (1 2)"
 
 
+###############################################################################
+# Test WriteArrowBatch() on types directly bound to the INSERT statement
+
+
+def test_ogr_gpkg_write_arrow_native_types(tmp_vsimem):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("string", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["string"] = "foo"
+    f["int"] = 123
+    f["int64"] = 12345678901234
+    f["real"] = 1.5
+    f.SetField("binary", b"\x01\x23\x46\x57\x89\xAB\xCD\xEF")
+    f.SetFID(10)
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POLYGON ((0 0,0 3,3 3,0 0))"))
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("CIRCULARSTRING (0 0,1 1,2 0)"))
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    src_lyr.CreateFeature(f)
+
+    filename = tmp_vsimem / "test_ogr_gpkg_write_arrow_native_types.gpkg"
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+
+    stream = src_lyr.GetArrowStream()
+    schema = stream.GetSchema()
+
+    for i in range(schema.GetChildrenCount()):
+        if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+            lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+
+    assert lyr.GetFeatureCount() == 4
+    assert lyr.GetExtent() == (0, 3, 0, 3)
+
+    f = lyr.GetNextFeature()
+    assert f.GetFID() == 10
+    assert f["string"] == "foo"
+    assert f["int"] == 123
+    assert f["int64"] == 12345678901234
+    assert f["real"] == 1.5
+    assert f["binary"] == "0123465789ABCDEF"
+    assert f.GetGeometryRef().ExportToIsoWkt() == "POINT (1 2)"
+
+    f = lyr.GetNextFeature()
+    polygon_fid = f.GetFID()
+    assert f.IsFieldNull("string")
+    assert f.IsFieldNull("int")
+    assert f.GetGeometryRef().ExportToIsoWkt() == "POLYGON ((0 0,0 3,3 3,0 0))"
+
+    f = lyr.GetNextFeature()
+    assert f.GetGeometryRef().ExportToIsoWkt() == "CIRCULARSTRING (0 0,1 1,2 0)"
+
+    f = lyr.GetNextFeature()
+    assert f.GetGeometryRef() is None
+
+    ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetSpatialFilterRect(2.5, 2.5, 3.5, 3.5)
+    assert [f.GetFID() for f in lyr] == [polygon_fid]
+    sql = "SELECT * FROM gpkg_extensions WHERE extension_name = 'gpkg_geom_CIRCULARSTRING'"
+    with ds.ExecuteSQL(sql) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 1
+
+
 ###############################################################################
 # Test a SQL request with the geometry in the first row being null
 
@@ -10510,3 +10648,40 @@ def test_ogr_gpkg_launder(tmp_vsimem):
     assert lyr.GetGeometryColumn() == "my_geom"
     lyr.CreateField(ogr.FieldDefn("_"))
     assert lyr.GetLayerDefn().GetFieldDefn(0).GetNameRef() == "x_"
+
+
+###############################################################################
+# Test the prefetching of sibling B-tree pages by the SQLite VFS
+
+
+@pytest.mark.parametrize("prefetch", ["YES", "NO"])
+def test_ogr_gpkg_sqlite_vfs_prefetch(tmp_vsimem, prefetch):
+
+    filename = str(tmp_vsimem / "test_ogr_gpkg_sqlite_vfs_prefetch.gpkg")
+    ds = ogr.GetDriverByName("GPKG").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.StartTransaction()
+    for i in range(5000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "value %d" % i + "x" * (i % 100)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {i})"))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    ds = None
+
+    with gdaltest.config_option("OGR_SQLITE_VFS_PREFETCH", prefetch):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        for i, f in enumerate(lyr):
+            assert f.GetFID() == i + 1
+            assert f["str"] == "value %d" % i + "x" * (i % 100)
+            assert f.GetGeometryRef().GetX() == i
+        assert i == 4999
+
+        f = lyr.GetFeature(2500)
+        assert f["str"] == "value 2499" + "x" * 99
+
+        lyr.SetAttributeFilter("str = 'value 4321'")
+        assert [f.GetFID() for f in lyr] == [4322]
+        ds = None
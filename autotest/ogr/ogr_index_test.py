@@ -463,3 +463,64 @@ def test_ogr_index_11(tmp_path):
     ogr_index_11_check(lyr, [0, 1, 2, 3, 4])
 
     ds = None
+
+
+###############################################################################
+# Test range and prefix LIKE queries using the index
+
+
+@pytest.mark.parametrize(
+    "where,pyfilter",
+    [
+        ("intfield > 990", lambda i, r, s: i > 990),
+        ("intfield >= 990", lambda i, r, s: i >= 990),
+        ("10 > intfield", lambda i, r, s: i < 10),
+        ("intfield <= -3", lambda i, r, s: i <= -3),
+        ("intfield < 2.5", lambda i, r, s: i < 2.5),
+        ("intfield BETWEEN 100 AND 150", lambda i, r, s: 100 <= i <= 150),
+        ("intfield > 5000", lambda i, r, s: False),
+        ("realfield > 400.5", lambda i, r, s: r > 400.5),
+        ("realfield < -400.5", lambda i, r, s: r < -400.5),
+        ("realfield BETWEEN -10 AND 10", lambda i, r, s: -10 <= r <= 10),
+        ("realfield >= 0", lambda i, r, s: r >= 0),
+        ("strfield LIKE 'val_12%'", lambda i, r, s: s.startswith("val_12")),
+        ("strfield ILIKE 'VAL_99%'", lambda i, r, s: s.startswith("val_99")),
+        ("strfield LIKE 'VAL%'", lambda i, r, s: False),
+        (
+            "intfield > 500 AND strfield LIKE 'val_6%'",
+            lambda i, r, s: i > 500 and s.startswith("val_6"),
+        ),
+        (
+            "intfield < 3 OR realfield > 495",
+            lambda i, r, s: i < 3 or r > 495,
+        ),
+    ],
+)
+def test_ogr_index_range_queries(tmp_path, where, pyfilter):
+
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(
+        tmp_path / "ogr_index_range.dbf"
+    )
+    lyr = ds.CreateLayer("ogr_index_range", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("intfield", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("realfield", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+
+    # Enough features to have several levels of nodes in the index
+    values = []
+    for i in range(1000):
+        v = ((i * 7919) % 1000) - 5
+        values.append((v, (v - 500) + 0.25, "val_%d" % v))
+        ogrtest.quick_create_feature(lyr, list(values[-1]), None)
+
+    ds.ExecuteSQL("CREATE INDEX ON ogr_index_range USING intfield")
+    ds.ExecuteSQL("CREATE INDEX ON ogr_index_range USING realfield")
+    ds.ExecuteSQL("CREATE INDEX ON ogr_index_range USING strfield")
+
+    lyr.SetAttributeFilter(where)
+    got_fids = [f.GetFID() for f in lyr]
+    expected_fids = [fid for fid, v in enumerate(values) if pyfilter(*v)]
+    assert got_fids == expected_fids
+    assert lyr.GetFeatureCount() == len(expected_fids)
+
+    ds = None
@@ -481,3 +481,141 @@ def test_ogr_join_23():
     ds.ReleaseResultSet(sql_lyr)
 
     ds = None
+
+
+###############################################################################
+# Test join on integer keys, with and without the hash table
+
+
+@pytest.mark.parametrize("hash_join", ["YES", "NO"])
+def test_ogr_join_integer_keys(hash_join):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for v in [1, None, 3, 2, 4]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = v
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for v, val in [(2, "a"), (None, "b"), (1, "c"), (2, "d"), (3, "e")]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = v
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR_GENSQL_HASH_JOIN", hash_join):
+        sql_lyr = ds.ExecuteSQL(
+            "SELECT first.id, second.val FROM first "
+            "LEFT JOIN second ON first.id = second.id"
+        )
+        res = [(f["id"], f["val"]) for f in sql_lyr]
+        ds.ReleaseResultSet(sql_lyr)
+
+    assert res == [(1, "c"), (None, None), (3, "e"), (2, "a"), (4, None)]
+
+
+###############################################################################
+# Test join on real and string keys, with and without the hash table, and
+# with a hash table of FIDs
+
+
+@pytest.mark.parametrize("hash_join", ["YES", "NO", "FID_ONLY"])
+def test_ogr_join_real_and_string_keys(hash_join):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    for r, s in [(1.5, "foo"), (2, "BAR"), (None, None), (3.25, "baz")]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["r"] = r
+        f["s"] = s
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for i, r, s, val in [
+        (2, 3.25, "Foo", "a"),
+        (1, 1.5, "bar", "b"),
+        (3, None, "foo", "c"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i
+        f["r"] = r
+        f["s"] = s
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    options = {"OGR_GENSQL_HASH_JOIN": "NO" if hash_join == "NO" else "YES"}
+    if hash_join == "FID_ONLY":
+        options["OGR_GENSQL_HASH_JOIN_MAX_FEATURES"] = "1"
+    with gdal.config_options(options):
+        res = []
+        for sql in [
+            "SELECT second.val FROM first LEFT JOIN second ON first.r = second.r",
+            "SELECT second.val FROM first LEFT JOIN second ON first.r = second.i",
+            "SELECT second.val FROM first LEFT JOIN second ON first.s = second.s",
+        ]:
+            sql_lyr = ds.ExecuteSQL(sql)
+            res.append([f["val"] for f in sql_lyr])
+            ds.ReleaseResultSet(sql_lyr)
+
+    assert res == [
+        ["b", None, None, "a"],
+        [None, "a", None, None],
+        ["a", "b", None, None],
+    ]
+
+
+###############################################################################
+# Test that the hash table on string keys follows the case sensitivity of
+# the attribute filter of the secondary layer: case-insensitive when evaluated
+# by OGR SQL (Memory), case-sensitive when forwarded to SQLite (GPKG)
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("driver", ["Memory", "GPKG"])
+@pytest.mark.parametrize("hash_join", ["YES", "NO", "FID_ONLY"])
+def test_ogr_join_string_keys_case_sensitivity(tmp_vsimem, driver, hash_join):
+
+    ds = ogr.GetDriverByName(driver).CreateDataSource(
+        "" if driver == "Memory" else str(tmp_vsimem / "test.gpkg")
+    )
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    for s in ["foo", "BAR", None, "baz", "123"]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["s"] = s
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for s, val in [("123", "z"), ("Foo", "a"), ("bar", "b"), ("foo", "c")]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["s"] = s
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    options = {"OGR_GENSQL_HASH_JOIN": "NO" if hash_join == "NO" else "YES"}
+    if hash_join == "FID_ONLY":
+        options["OGR_GENSQL_HASH_JOIN_MAX_FEATURES"] = "1"
+    with gdal.config_options(options):
+        sql_lyr = ds.ExecuteSQL(
+            "SELECT second.val FROM first LEFT JOIN second ON first.s = second.s",
+            dialect="OGRSQL",
+        )
+        res = [f["val"] for f in sql_lyr]
+        ds.ReleaseResultSet(sql_lyr)
+
+    if driver == "Memory":
+        assert res == ["a", "b", None, None, "z"]
+    else:
+        assert res == ["c", None, None, None, "z"]
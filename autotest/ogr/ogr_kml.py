@@ -807,3 +807,46 @@ def test_ogr_kml_read_non_conformant_multi_geometries():
     feat = lyr.GetNextFeature()
     wkt = "MULTIPOINT ((0 0))"
     ogrtest.check_feature_geometry(feat, wkt)
+
+
+###############################################################################
+# Test that streaming mode, where Placemarks are parsed again from the file
+# when features are read, returns the same content as the in-memory mode
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "samples.kml",
+        "geometries.kml",
+        "description_with_xml.kml",
+        "placemark_with_kml_prefix.kml",
+        "placemark_in_root_and_subfolder.kml",
+        "non_conformant_multi.kml",
+    ],
+)
+def test_ogr_kml_read_streaming(filename):
+
+    if not ogrtest.have_read_kml:
+        pytest.skip()
+
+    def get_content(streaming):
+        with gdal.config_option("KML_STREAMING", streaming):
+            ds = ogr.Open("data/kml/" + filename)
+        ret = []
+        for lyr in ds:
+            ret.append((lyr.GetName(), lyr.GetGeomType()))
+            for f in lyr:
+                g = f.GetGeometryRef()
+                ret.append(
+                    (
+                        f.GetField("Name"),
+                        f.GetField("Description"),
+                        g.ExportToIsoWkt() if g else None,
+                    )
+                )
+        return ret
+
+    ref = get_content("NO")
+    assert ref
+    assert get_content("YES") == ref
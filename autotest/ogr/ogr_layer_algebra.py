@@ -584,3 +584,46 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Test that the spatial index and multi-threading of the method layer do not
+# change the result of the overlay methods
+
+
+@pytest.mark.parametrize(
+    "method",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_algebra_spatial_index_and_threads(mem_ds, method, num_threads):
+
+    def create_grid(name, offset):
+        lyr = mem_ds.CreateLayer(name)
+        lyr.CreateField(ogr.FieldDefn(name, ogr.OFTString))
+        for j in range(10):
+            for i in range(10):
+                x = i * 2 + offset
+                y = j * 2 + offset
+                feat = ogr.Feature(lyr.GetLayerDefn())
+                feat.SetField(name, "%d_%d" % (i, j))
+                feat.SetGeometryDirectly(
+                    ogr.CreateGeometryFromWkt(
+                        "POLYGON((%f %f,%f %f,%f %f,%f %f,%f %f))"
+                        % (x, y, x, y + 1.5, x + 1.5, y + 1.5, x + 1.5, y, x, y)
+                    )
+                )
+                lyr.CreateFeature(feat)
+        return lyr
+
+    A = create_grid("A", 0)
+    B = create_grid("B", 0.75)
+
+    def run(options):
+        C = mem_ds.CreateLayer("C_%d" % mem_ds.GetLayerCount())
+        assert getattr(A, method)(B, C, options=options) == ogr.OGRERR_NONE
+        return [(f.GetField(0), f.GetGeometryRef().ExportToIsoWkt()) for f in C]
+
+    ref = run(["USE_SPATIAL_INDEX=NO"])
+    assert len(ref) > 0
+    assert run(["NUM_THREADS=" + num_threads]) == ref
@@ -2760,3 +2760,74 @@ def test_ogr_mem_lyr_get_dataset():
     ds = ogr.GetDriverByName("Memory").CreateDataSource("foo")
     lyr = ds.CreateLayer("test")
     assert lyr.GetDataset().GetDescription() == "foo"
+
+
+###############################################################################
+# Test STORAGE=ARROW layers
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_mem_storage_arrow():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", options=["STORAGE=ARROW"])
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int"] = i
+        f["str"] = "foo%d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, i)))
+        lyr.CreateFeature(f)
+
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    assert not lyr.TestCapability(ogr.OLCCreateField)
+    with pytest.raises(Exception, match="once features have been written"):
+        lyr.CreateField(ogr.FieldDefn("other", ogr.OFTString))
+
+    assert lyr.GetFeatureCount() == 10
+    assert [f["int"] for f in lyr] == list(range(10))
+    f = lyr.GetFeature(3)
+    assert f["str"] == "foo3"
+    assert f.GetGeometryRef().ExportToWkt() == "POINT (3 3)"
+
+    lyr.SetSpatialFilterRect(1.5, 1.5, 4.5, 4.5)
+    assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+    assert [f["int"] for f in lyr] == [2, 3, 4]
+    lyr.SetAttributeFilter("int <> 3")
+    assert lyr.GetFeatureCount() == 2
+    lyr.SetSpatialFilter(None)
+    lyr.SetAttributeFilter(None)
+
+    # Stored batches are returned as they are, and can be written as they
+    # are into another STORAGE=ARROW layer
+    out_lyr = ds.CreateLayer("out", options=["STORAGE=ARROW"])
+    out_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    out_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    stream = lyr.GetArrowStream()
+    schema = stream.GetSchema()
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert out_lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+    del stream
+
+    # Appending features after a batch
+    f = ogr.Feature(out_lyr.GetLayerDefn())
+    f["int"] = 10
+    out_lyr.CreateFeature(f)
+    assert f.GetFID() == 10
+
+    assert out_lyr.GetFeatureCount() == 11
+    out_lyr.SetSpatialFilterRect(8.5, 8.5, 9.5, 9.5)
+    assert [(f.GetFID(), f["str"]) for f in out_lyr] == [(9, "foo9")]
+    out_lyr.SetSpatialFilter(None)
+    assert [f["int"] for f in out_lyr] == list(range(11))
+
+
+def test_ogr_mem_storage_invalid():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    with gdal.quiet_errors():
+        assert ds.CreateLayer("test", options=["STORAGE=invalid"]) is None
@@ -391,6 +391,75 @@ def test_ogr_oapif_id_is_integer():
 ###############################################################################
 
 
+@pytest.mark.parametrize("prefetch_pages", [1, 2])
+def test_ogr_oapif_prefetch_pages(prefetch_pages):
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET",
+        "/oapif/collections",
+        200,
+        {"Content-Type": "application/json"},
+        '{ "collections" : [ { "name": "foo" }] }',
+    )
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(
+            "OAPIF:http://localhost:%d/oapif" % gdaltest.webserver_port,
+            open_options=["PREFETCH_PAGES=%d" % prefetch_pages],
+        )
+    lyr = ds.GetLayer(0)
+
+    def page(value, next_url):
+        links = ""
+        if next_url:
+            links = """"links" : [ { "rel": "next",
+                "type": "application/geo+json",
+                "href": "http://localhost:%d%s" } ],""" % (
+                gdaltest.webserver_port,
+                next_url,
+            )
+        return """{ "type": "FeatureCollection", %s "features": [
+                    { "type": "Feature", "properties": { "foo": "%s" } } ] }""" % (
+            links,
+            value,
+        )
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET",
+        "/oapif/collections/foo/items?limit=20",
+        200,
+        {"Content-Type": "application/geo+json"},
+        page("bar", None),
+    )
+    handler.add(
+        "GET",
+        "/oapif/collections/foo/items?limit=1000",
+        200,
+        {"Content-Type": "application/geo+json"},
+        page("page1", "/oapif/foo_page2"),
+    )
+    handler.add(
+        "GET",
+        "/oapif/foo_page2",
+        200,
+        {"Content-Type": "application/geo+json"},
+        page("page2", "/oapif/foo_page3"),
+    )
+    handler.add(
+        "GET",
+        "/oapif/foo_page3",
+        200,
+        {"Content-Type": "application/geo+json"},
+        page("page3", None),
+    )
+    with webserver.install_http_handler(handler):
+        assert [f["foo"] for f in lyr] == ["page1", "page2", "page3"]
+
+
+###############################################################################
+
+
 def NO_LONGER_USED_test_ogr_oapif_fc_links_next_headers():
 
     handler = webserver.SequentialHandler()
@@ -2695,3 +2695,101 @@ def test_ogr_openfilegdb_get_extent_getextent3d():
             0.0,
         )
     )
+
+
+###############################################################################
+# Test that the optimized GetNextArrowArray() returns the same content as the
+# generic implementation
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/arcgis_pro_32_types.gdb",
+        "data/filegdb/curves.gdb",
+    ],
+)
+@pytest.mark.parametrize("num_threads", [None, "4"])
+@pytest.mark.parametrize("max_features_in_batch", [None, "3"])
+def test_ogr_openfilegdb_arrow_stream(filename, num_threads, max_features_in_batch):
+    pytest.importorskip("pyarrow")
+
+    options = []
+    if max_features_in_batch:
+        options.append("MAX_FEATURES_IN_BATCH=" + max_features_in_batch)
+
+    def get_content(lyr):
+        lyr.ResetReading()
+        stream = lyr.GetArrowStreamAsPyArrow(options)
+        content = []
+        for batch in stream:
+            content += batch.to_pylist()
+        return content
+
+    ds = ogr.Open(filename)
+    for lyr in ds:
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            content = get_content(lyr)
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "YES"
+        ) or lyr.GetFeatureCount() == 0
+        with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+            assert content == get_content(lyr), lyr.GetName()
+
+
+###############################################################################
+# Test that GetNextArrowArray() falls back to the generic implementation
+# when filters are set
+
+
+def test_ogr_openfilegdb_arrow_stream_filters():
+    pytest.importorskip("pyarrow")
+
+    ds = ogr.Open("data/filegdb/testopenfilegdb.gdb.zip")
+    lyr = ds.GetLayerByName("point")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    lyr.SetAttributeFilter("id = 1")
+    assert not lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    stream = lyr.GetArrowStreamAsPyArrow()
+    assert sum(len(batch) for batch in stream) == lyr.GetFeatureCount()
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "NO"
+    )
+
+
+###############################################################################
+# Test that the read-ahead of .gdbtable/.gdbtablx files does not alter the
+# content returned by sequential and random reads
+
+
+@pytest.mark.parametrize(
+    "filename",
+    ["data/filegdb/testopenfilegdb.gdb.zip", "data/filegdb/sparse.gdb.zip"],
+)
+@pytest.mark.parametrize("read_ahead_size", ["1", "64", "1000000"])
+def test_ogr_openfilegdb_read_ahead(filename, read_ahead_size):
+    def get_content(ds):
+        content = []
+        for lyr in ds:
+            content += [f.DumpReadableAsString() for f in lyr]
+            lyr.ResetReading()
+            # Random reads, in reverse order
+            for fid in range(lyr.GetFeatureCount(), 0, -1):
+                f = lyr.GetFeature(fid)
+                content.append(f.DumpReadableAsString() if f else None)
+        return content
+
+    with gdaltest.config_option("OPENFILEGDB_READ_AHEAD_SIZE", "0"):
+        ds = ogr.Open(filename)
+    ref_content = get_content(ds)
+
+    with gdaltest.config_option("OPENFILEGDB_READ_AHEAD_SIZE", read_ahead_size):
+        ds = ogr.Open(filename)
+    assert get_content(ds) == ref_content
@@ -1543,6 +1543,51 @@ def test_ogr_openfilegdb_write_spatial_index(
     ds = None
 
 
+###############################################################################
+# Test index creation with the parallel sort of values
+
+
+def test_ogr_openfilegdb_write_index_parallel_sort(tmp_vsimem):
+
+    dirname = tmp_vsimem / "out.gdb"
+
+    numPoints = 1000
+    ds = ogr.GetDriverByName("OpenFileGDB").CreateDataSource(dirname)
+    lyr = ds.CreateLayer("points", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    for j in range(numPoints):
+        # Values in a non-sorted order
+        v = (j * 7919) % numPoints
+        feat = ogr.Feature(lyr.GetLayerDefn())
+        feat["int32"] = v
+        feat.SetGeometry(ogr.CreateGeometryFromWkt("POINT(%d %d)" % (v, v)))
+        lyr.CreateFeature(feat)
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "OPENFILEGDB_MIN_VALUES_PER_SORT_RUN": "10"}
+    ):
+        ds.ExecuteSQL("CREATE INDEX idx_int32 ON points(int32)")
+        gdal.ErrorReset()
+        lyr.SyncToDisk()
+        assert gdal.GetLastErrorMsg() == ""
+    ds = None
+
+    ds = ogr.Open(dirname)
+    lyr = ds.GetLayer(0)
+    for v in (0, 1, 499, 500, numPoints - 1):
+        lyr.SetSpatialFilterRect(v - 0.1, v - 0.1, v + 0.1, v + 0.1)
+        lyr.ResetReading()
+        f = lyr.GetNextFeature()
+        assert f is not None and f["int32"] == v
+        lyr.SetSpatialFilter(None)
+
+        lyr.SetAttributeFilter("int32 = %d" % v)
+        assert lyr.GetFeatureCount() == 1
+        lyr.SetAttributeFilter("int32 < %d" % v)
+        assert lyr.GetFeatureCount() == v
+        lyr.SetAttributeFilter(None)
+    ds = None
+
+
 ###############################################################################
 
 
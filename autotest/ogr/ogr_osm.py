@@ -324,6 +324,18 @@ def test_ogr_osm_3_custom_compress_nodes():
         test_ogr_osm_3()
 
 
+###############################################################################
+# Test parallel decoding of PBF blocks, and its disabling
+
+
+@pytest.mark.parametrize("parallel_decoding", ["YES", "NO"])
+def test_ogr_osm_pbf_parallel_decoding(parallel_decoding):
+    with gdal.config_options(
+        {"GDAL_NUM_THREADS": "4", "OSM_PARALLEL_DECODING": parallel_decoding}
+    ):
+        test_ogr_osm_1()
+
+
 ###############################################################################
 # Test ogr2ogr with all layers
 
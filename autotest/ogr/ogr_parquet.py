@@ -1455,6 +1455,62 @@ def test_ogr_parquet_ignored_fields_and_then_attribute_filter():
     assert lyr.GetFeatureCount() == 1
 
 
+###############################################################################
+# Test late materialization of the columns of an attribute filter
+
+
+@pytest.mark.parametrize("with_fid", [False, True])
+@pytest.mark.parametrize("late_materialization", ["YES", "NO"])
+def test_ogr_parquet_attribute_filter_late_materialization(
+    tmp_vsimem, with_fid, late_materialization
+):
+
+    outfilename = str(tmp_vsimem / "test.parquet")
+    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+    options = ["ROW_GROUP_SIZE=3"]
+    if with_fid:
+        options.append("FID=fid")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=options)
+    lyr.CreateField(ogr.FieldDefn("v", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("other", ogr.OFTReal))
+    # Each row group has min(v) = 0 and max(v) = 10, so that statistics
+    # cannot discard any of them
+    values = [0, 10, 1, 0, 10, 5, 0, 10, 2, 5, 0, 10]
+    for i, v in enumerate(values):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if with_fid:
+            f.SetFID(100 + i)
+        f["v"] = v
+        f["str"] = "str%d" % i
+        f["other"] = i * 0.5
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, i)))
+        lyr.CreateFeature(f)
+    ds = None
+
+    with gdaltest.config_option(
+        "OGR_PARQUET_LATE_MATERIALIZATION", late_materialization
+    ):
+        ds = ogr.Open(outfilename)
+        lyr = ds.GetLayer(0)
+        assert lyr.SetIgnoredFields(["other", "geometry"]) == ogr.OGRERR_NONE
+        assert lyr.SetAttributeFilter("v = 5") == ogr.OGRERR_NONE
+        res = [(f.GetFID(), f["v"], f["str"]) for f in lyr]
+        fid_offset = 100 if with_fid else 0
+        assert res == [(fid_offset + 5, 5, "str5"), (fid_offset + 9, 5, "str9")]
+        assert lyr.GetFeatureCount() == 2
+
+        assert lyr.SetAttributeFilter("v = 5 AND str = 'str9'") == ogr.OGRERR_NONE
+        assert [f.GetFID() for f in lyr] == [fid_offset + 9]
+
+        assert lyr.SetAttributeFilter("v = 7") == ogr.OGRERR_NONE
+        assert lyr.GetNextFeature() is None
+
+        if with_fid:
+            assert lyr.SetAttributeFilter("fid = 107") == ogr.OGRERR_NONE
+            assert [f["str"] for f in lyr] == ["str7"]
+
+
 def test_ogr_parquet_attribute_filter_and_spatial_filter():
 
     filter = "int8 != 0"
@@ -1617,6 +1673,65 @@ def test_ogr_parquet_read_partitioned_geo():
     gdal.RmdirRecursive("/vsimem/somedir")
 
 
+###############################################################################
+# Test spatial filtering of a partitioned dataset with a bbox covering column
+
+
+@pytest.mark.skipif(not _has_arrow_dataset(), reason="GDAL not built with ArrowDataset")
+@pytest.mark.parametrize("with_fid", [True, False])
+def test_ogr_parquet_read_partitioned_geo_covering_bbox(tmp_vsimem, with_fid):
+
+    dirname = str(tmp_vsimem / "somedir")
+    gdal.Mkdir(dirname, 0o755)
+    fid = 0
+    for name, wkts in [
+        ("part.0.parquet", ["POINT(1 2)", "POINT(3 4)"]),
+        ("part.1.parquet", ["POINT(10 20)", "POINT(30 40)"]),
+    ]:
+        ds = ogr.GetDriverByName("Parquet").CreateDataSource(dirname + "/" + name)
+        options = ["WRITE_COVERING_BBOX=YES"]
+        if with_fid:
+            options.append("FID=fid")
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=options)
+        for wkt in wkts:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetFID(fid)
+            fid += 1
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+            assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+        ds = None
+
+    ds = ogr.Open(dirname)
+    lyr = ds.GetLayer(0)
+    # The bbox covering column is not exposed as a regular field
+    assert lyr.GetLayerDefn().GetFieldCount() == 0
+    assert lyr.GetFeatureCount() == 4
+
+    lyr.SetSpatialFilterRect(5, 5, 35, 35)
+    assert [f.GetFID() for f in lyr] == [2]
+
+    lyr.SetSpatialFilterRect(0, 0, 100, 100)
+    assert [f.GetFID() for f in lyr] == [0, 1, 2, 3]
+
+    lyr.SetSpatialFilterRect(-100, -100, -90, -90)
+    assert lyr.GetNextFeature() is None
+    assert lyr.GetFeatureCount() == 0
+
+    lyr.SetSpatialFilterRect(25, 35, 35, 45)
+    stream = lyr.GetArrowStream()
+    count = 0
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        count += array.GetLength()
+    assert count == 1
+    del stream
+
+    lyr.SetSpatialFilter(None)
+    assert lyr.GetFeatureCount() == 4
+
+
 ###############################################################################
 # Test that we don't write an id in members of datum ensemble
 # Cf https://github.com/opengeospatial/geoparquet/discussions/110
@@ -2177,6 +2292,54 @@ def test_ogr_parquet_arrow_stream_numpy_fast_attribute_filter(filter):
         assert fc != 0
 
 
+###############################################################################
+# Test evaluation of attribute filters directly on Arrow arrays
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "int8 = -1 OR string = 'd'",
+        "uint8 IN (1, 2) OR int8 IS NULL",
+        "NOT (int8 IS NULL) OR float64 = 2.5",
+        "int32 BETWEEN -1000000000 AND 0 OR boolean = 1",
+        "5 > uint8 OR uint16 >= 10001",
+        "int64 < 0 OR float32 <= 2.5",
+        "string LIKE 'd%' OR large_string ILIKE 'A'",
+        "string IN ('a', 'C') OR large_string > 'c'",
+        "NOT (string = 'b' OR float64 > 2)",
+        "fid = 2 OR fid > 3",
+    ],
+)
+def test_ogr_parquet_arrow_stream_numpy_columnar_attribute_filter(filter):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    def get_uint8_values(columnar):
+        ds = ogr.Open("data/parquet/test.parquet")
+        lyr = ds.GetLayer(0)
+        ignored_fields = ["decimal128", "decimal256", "time64_ns"]
+        lyr_defn = lyr.GetLayerDefn()
+        for i in range(lyr_defn.GetFieldCount()):
+            fld_defn = lyr_defn.GetFieldDefn(i)
+            if fld_defn.GetName().startswith("map_"):
+                ignored_fields.append(fld_defn.GetNameRef())
+        lyr.SetIgnoredFields(ignored_fields)
+        lyr.SetAttributeFilter(filter)
+        with gdaltest.config_option(
+            "OGR_ARROW_COLUMNAR_ATTRIBUTE_FILTER", columnar
+        ):
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            values = []
+            for batch in stream:
+                values += list(batch["uint8"])
+        return values
+
+    ref = get_uint8_values("NO")
+    assert ref
+    assert get_uint8_values("YES") == ref
+
+
 ###############################################################################
 
 
@@ -3533,6 +3696,102 @@ def test_ogr_parquet_sort_by_bbox(tmp_vsimem):
     check_file(outfilename2)
 
 
+###############################################################################
+# Test SORT_BY_BBOX=HILBERT layer creation option
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.require_driver("GPKG")
+def test_ogr_parquet_sort_by_bbox_hilbert(tmp_vsimem):
+
+    outfilename = str(tmp_vsimem / "test_ogr_parquet_sort_by_bbox_hilbert.parquet")
+    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+    ROW_GROUP_SIZE = 100
+    lyr = ds.CreateLayer(
+        "test",
+        geom_type=ogr.wkbPoint,
+        options=[
+            "SORT_BY_BBOX=HILBERT",
+            f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}",
+            "FID=fid",
+        ],
+    )
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    COUNT_NON_SPATIAL = 11
+    GRID_SIZE = 30
+    for i in range(COUNT_NON_SPATIAL):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i
+        lyr.CreateFeature(f)
+    for i in range(GRID_SIZE * GRID_SIZE):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i + COUNT_NON_SPATIAL
+        x = i % GRID_SIZE
+        y = i // GRID_SIZE
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({x} {y})"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    # Row groups of features sorted along a Hilbert curve are spatially
+    # compact
+    with gdaltest.config_option("OGR_PARQUET_SHOW_ROW_GROUP_EXTENT", "YES"):
+        ds = ogr.Open(outfilename)
+        lyr = ds.GetLayer(0)
+        total_area = (GRID_SIZE - 1) * (GRID_SIZE - 1)
+        areas = [f.GetGeometryRef().GetArea() for f in lyr]
+        assert sum(areas) / len(areas) < 0.5 * total_area
+        ds = None
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    for i in range(COUNT_NON_SPATIAL):
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == i
+        assert f.GetGeometryRef() is None
+    set_i = set()
+    for f in lyr:
+        assert f.GetFID() == f["i"]
+        idx = f["i"] - COUNT_NON_SPATIAL
+        assert f.GetGeometryRef().GetX() == idx % GRID_SIZE
+        assert f.GetGeometryRef().GetY() == idx // GRID_SIZE
+        set_i.add(f["i"])
+    assert len(set_i) == GRID_SIZE * GRID_SIZE
+
+
+###############################################################################
+# Test writing with several threads encoding the columns of row groups
+
+
+def test_ogr_parquet_write_multithreaded(tmp_vsimem):
+
+    outfilename = str(tmp_vsimem / "test_ogr_parquet_write_multithreaded.parquet")
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+        lyr = ds.CreateLayer(
+            "test", geom_type=ogr.wkbPoint, options=["ROW_GROUP_SIZE=10"]
+        )
+        lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(95):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["i"] = i
+            f["str"] = str(i)
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {-i})"))
+            lyr.CreateFeature(f)
+        ds = None
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == "10"
+    assert lyr.GetFeatureCount() == 95
+    for i, f in enumerate(lyr):
+        assert f["i"] == i
+        assert f["str"] == str(i)
+        assert f.GetGeometryRef().GetX() == i
+        assert f.GetGeometryRef().GetY() == -i
+    assert lyr.GetExtent() == (0, 94, -94, 0)
+
+
 ###############################################################################
 # Check GeoArrow struct encoding
 
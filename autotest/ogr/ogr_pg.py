@@ -5953,3 +5953,171 @@ def test_ogr_pg_LAUNDER_ASCII(pg_ds, tmp_schema):
     assert lyr.GetName() == f"{tmp_schema}.ae"
     lyr.CreateField(ogr.FieldDefn("b" + eacute))
     assert lyr.GetLayerDefn().GetFieldDefn(0).GetNameRef() == "be"
+
+
+###############################################################################
+# Test the native GetNextArrowArray() implementation using binary COPY
+
+
+@only_with_postgis
+@pytest.mark.parametrize("max_features_in_batch", [None, "2"])
+def test_ogr_pg_arrow_stream_binary_copy(pg_ds, max_features_in_batch):
+    pytest.importorskip("pyarrow")
+
+    pg_ds.ExecuteSQL(
+        "CREATE TABLE test_arrow(fid SERIAL PRIMARY KEY, "
+        "b BOOLEAN, i2 SMALLINT, i4 INTEGER, i8 BIGINT, "
+        "f4 REAL, f8 DOUBLE PRECISION, num NUMERIC(10,3), "
+        "str VARCHAR, txt TEXT, js JSON, u UUID, bin BYTEA, "
+        "d DATE, t TIME, ts TIMESTAMP, "
+        "geom GEOMETRY(POINT, 4326), geog GEOGRAPHY(LINESTRING, 4326))"
+    )
+    pg_ds.ExecuteSQL(
+        "INSERT INTO test_arrow(b, i2, i4, i8, f4, f8, num, str, txt, js, u, "
+        "bin, d, t, ts, geom, geog) VALUES "
+        "(true, -32768, 123456789, 1234567890123, 1.5, 1.25, 12.345, "
+        "'foo', 'bar', '{\"a\": 1}', 'a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11', "
+        "'\\x0001FF', '1950-12-31', '12:34:56.789', "
+        "'1969-12-31 23:59:59.999', 'SRID=4326;POINT(1 2)', "
+        "'SRID=4326;LINESTRING(1 2,3 4)'), "
+        "(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, "
+        "NULL, NULL, NULL, NULL, NULL, NULL), "
+        "(false, 1, -1, -1, -1.5, -1.25, 0, 'éé', '', '[]', "
+        "'a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a12', '', '2023-06-15', "
+        "'00:00:00', '2023-06-15 01:02:03.5', 'SRID=4326;POINT(3 4)', "
+        "'SRID=4326;LINESTRING(5 6,7 8)')"
+    )
+    pg_ds.ExecuteSQL("DELETE FROM test_arrow WHERE fid = 2")
+    pg_ds.ExecuteSQL(
+        "INSERT INTO test_arrow(i4, geom) VALUES (5, 'SRID=4326;POINT(5 6)')"
+    )
+
+    ds = reconnect(pg_ds, update=False)
+    lyr = ds.GetLayerByName("test_arrow")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+    options = []
+    if max_features_in_batch:
+        options.append("MAX_FEATURES_IN_BATCH=" + max_features_in_batch)
+
+    def get_content():
+        lyr.ResetReading()
+        stream = lyr.GetArrowStreamAsPyArrow(options)
+        content = []
+        for batch in stream:
+            content += batch.to_pylist()
+        return content
+
+    def check():
+        content = get_content()
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "YES"
+        )
+        with gdaltest.config_option("OGR_PG_STREAM_BASE_IMPL", "YES"):
+            expected_content = get_content()
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "NO"
+        )
+        assert content == expected_content
+        return content
+
+    content = check()
+    assert [f["fid"] for f in content] == [1, 3, 4]
+
+    lyr.SetAttributeFilter("i4 < 100")
+    content = check()
+    assert len(content) == 2
+
+    lyr.SetAttributeFilter(None)
+    lyr.SetSpatialFilterRect(0, 2.5, 4, 4.5)
+    content = check()
+    assert len(content) == 1
+
+    lyr.SetSpatialFilter(None)
+    lyr.SetIgnoredFields(["i8", "str", "geog"])
+    check()
+
+
+###############################################################################
+# Test the native WriteArrowBatch() implementation using binary COPY
+
+
+@only_with_postgis
+def test_ogr_pg_write_arrow_binary_copy(pg_ds):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("string", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["string"] = "fooé"
+    f["int"] = 123
+    f["bool"] = True
+    f["int64"] = 12345678901234
+    f["real"] = 1.5
+    f.SetField("binary", b"\x01\x23\x46\x57\x89\xAB\xCD\xEF")
+    f.SetFID(10)
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POLYGON ((0 0,0 3,3 3,0 0))"))
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    src_lyr.CreateFeature(f)
+
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    lyr = pg_ds.CreateLayer("test_write_arrow", srs=srs, geom_type=ogr.wkbUnknown)
+
+    stream = src_lyr.GetArrowStream()
+    schema = stream.GetSchema()
+
+    for i in range(schema.GetChildrenCount()):
+        if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+            lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+
+    ds = reconnect(pg_ds, update=True)
+    lyr = ds.GetLayerByName("test_write_arrow")
+    assert lyr.GetFeatureCount() == 3
+
+    f = lyr.GetNextFeature()
+    assert f.GetFID() == 10
+    assert f["string"] == "fooé"
+    assert f["int"] == 123
+    assert f["bool"] == 1
+    assert f["int64"] == 12345678901234
+    assert f["real"] == 1.5
+    assert f["binary"] == "0123465789ABCDEF"
+    assert f.GetGeometryRef().ExportToIsoWkt() == "POINT (1 2)"
+    assert f.GetGeometryRef().GetSpatialReference().GetAuthorityCode(None) == "4326"
+
+    f = lyr.GetNextFeature()
+    assert f.IsFieldNull("string")
+    assert f.IsFieldNull("int")
+    assert f.GetGeometryRef().ExportToIsoWkt() == "POLYGON ((0 0,0 3,3 3,0 0))"
+
+    f = lyr.GetNextFeature()
+    assert f.GetGeometryRef() is None
+
+    # Check that the sequence has been updated after writing explicit FIDs
+    f = ogr.Feature(lyr.GetLayerDefn())
+    assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+    assert f.GetFID() > 12
@@ -629,3 +629,48 @@ def test_ogr_pmtiles_read_with_many_directories():
     )
     lyr = ds.GetLayer(0)
     assert lyr.GetFeatureCount() != 0
+
+
+###############################################################################
+
+
+@pytest.mark.require_driver("MBTiles")
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_driver("PNG")
+def test_ogr_pmtiles_write_raster():
+
+    filename = "/vsimem/test_raster.pmtiles"
+    try:
+        out_ds = gdal.Translate(
+            filename,
+            "../gdrivers/data/small_world.tif",
+            options="-of PMTiles -co TILE_FORMAT=PNG",
+        )
+        assert out_ds
+        assert out_ds.GetMetadataItem("format") == "png"
+        out_ds = None
+
+        f = gdal.VSIFOpenL(f"/vsipmtiles/{filename}/pmtiles_header.json", "rb")
+        assert f
+        try:
+            data = gdal.VSIFReadL(1, 10000, f)
+        finally:
+            gdal.VSIFCloseL(f)
+        got = json.loads(data)
+        assert got["tile_type_str"] == "PNG"
+        assert got["tile_compression_str"] == "none"
+        assert got["clustered"]
+        assert got["min_zoom"] == 0
+        assert got["max_zoom"] > 0
+        assert got["tile_contents_count"] <= got["addressed_tiles_count"]
+
+        f = gdal.VSIFOpenL(f"/vsipmtiles/{filename}/0/0/0.png", "rb")
+        assert f
+        try:
+            data = gdal.VSIFReadL(1, 8, f)
+        finally:
+            gdal.VSIFCloseL(f)
+        assert data == b"\x89PNG\r\n\x1a\n"
+    finally:
+        if gdal.VSIStatL(filename):
+            gdal.Unlink(filename)
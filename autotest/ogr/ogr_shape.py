@@ -6121,3 +6121,55 @@ def test_ogr_shape_logical_field(tmp_vsimem):
     assert f["int_field"] == -1234
     f = lyr.GetNextFeature()
     assert f["bool_field"] is None
+
+
+###############################################################################
+# Test reading through the Arrow stream interface with GDAL_NUM_THREADS
+
+
+@pytest.mark.parametrize("in_memory", [False, True])
+def test_ogr_shape_arrow_stream_multithreaded(tmp_path, tmp_vsimem, in_memory):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str((tmp_vsimem if in_memory else tmp_path) / "test.shp")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPolygon)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(5000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 3:
+            f["str"] = f"value {i}"
+        if i % 7:
+            x = i % 100
+            y = i // 100
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON (({x} {y},{x} {y+1},{x+1} {y+1},{x} {y}))"
+                )
+            )
+        lyr.CreateFeature(f)
+    for fid in (10, 1000, 4999):
+        lyr.DeleteFeature(fid)
+    ds = None
+
+    def read():
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=1500"])
+        ret = []
+        for batch in stream:
+            ret += [
+                (fid, id_val, str_val, bytes(geom) if geom is not None else None)
+                for fid, id_val, str_val, geom in zip(
+                    batch["OGC_FID"], batch["id"], batch["str"], batch["wkb_geometry"]
+                )
+            ]
+        return ret
+
+    expected = read()
+    assert len(expected) == 4997
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert read() == expected
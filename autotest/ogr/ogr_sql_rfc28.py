@@ -1667,3 +1667,89 @@ def test_ogr_rfc28_in_date_filter():
 
     lyr.SetAttributeFilter("date_slash IN ('2020-12-31', '2020-12-31')")
     _ogr_in_date_filter_check([])
+
+
+###############################################################################
+# Test that the compiled evaluation of attribute filters gives the same
+# results as the evaluation of the expression tree
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "i = 2",
+        "2 = i",
+        "i <> 2",
+        "i < 2",
+        "2 < i",
+        "i >= 2",
+        "i BETWEEN 1 AND 3",
+        "i IN (1, 3, 5)",
+        "i64 > 3000000000",
+        "i64 IN (3000000001, 1)",
+        "r = 1.5",
+        "r > 1",
+        "1.5 <= r",
+        "i = 1.0",
+        "r BETWEEN 1.5 AND 2.5",
+        "r IN (1.5, -0.0)",
+        "s = 'b'",
+        "s = 'B'",
+        "'b' > s",
+        "s BETWEEN 'a' AND 'c'",
+        "s IN ('A', 'c')",
+        "s <> 'a'",
+        "s LIKE 'a%'",
+        "s LIKE '%c'",
+        "s LIKE '%b%'",
+        "s LIKE 'abc'",
+        "s LIKE '%'",
+        "s LIKE 'a_c'",
+        "s ILIKE 'A%'",
+        "s LIKE 'a!%%' ESCAPE '!'",
+        "s IS NULL",
+        "i IS NOT NULL",
+        "NOT (i = 2)",
+        "i = 1 OR s = 'b'",
+        "i > 1 AND r < 3",
+        "NOT (i = 1 OR (r IS NULL AND s LIKE 'a%'))",
+        "1 = 1 AND i = 2",
+        "1 = 0 OR i = 2",
+        "i + 1 = 3",
+        "b = 1",
+    ],
+)
+def test_ogr_rfc28_compiled_attribute_filter(where):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("i64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("b", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    for values in [
+        (1, 1, 1.5, "a", 0),
+        (2, 3000000001, 2.5, "b", 1),
+        (3, 3000000002, -0.0, "abc", 0),
+        (5, None, None, "a%c", None),
+        (None, 1, 0.5, None, 1),
+        (2, 2, 3.0, "B", 0),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for i, v in enumerate(values):
+            if v is None:
+                f.SetFieldNull(i)
+            else:
+                f.SetField(i, v)
+        lyr.CreateFeature(f)
+
+    def get_fids():
+        assert lyr.SetAttributeFilter(where) == ogr.OGRERR_NONE
+        return [f.GetFID() for f in lyr]
+
+    with gdal.config_option("OGR_SQL_COMPILED_FILTER", "NO"):
+        expected = get_fids()
+    assert get_fids() == expected
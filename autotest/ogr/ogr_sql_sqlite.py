@@ -2510,3 +2510,62 @@ def test_ogr_sql_sqlite_execute_sql_error_on_spatial_filter_shp_layer(tmp_vsimem
         Exception, match="Cannot set spatial filter: no geometry field selected"
     ):
         ds.ExecuteSQL("SELECT 1 FROM test", spatialFilter=geom, dialect="SQLITE")
+
+
+###############################################################################
+# Test that the fields not used by the statement are ignored on the layers
+# exposed through virtual tables
+
+
+@pytest.mark.parametrize("ignore_unused_fields", ["YES", "NO"])
+def test_ogr_sql_sqlite_ignore_unused_fields(ignore_unused_fields):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("a", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("b", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("c", ogr.OFTReal))
+    for i in range(3):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["a"] = i
+        f["b"] = "val%d" % i
+        f["c"] = i + 0.5
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, i)))
+        lyr.CreateFeature(f)
+
+    with gdaltest.config_option(
+        "OGR_SQLITE_VTABLE_IGNORE_UNUSED_FIELDS", ignore_unused_fields
+    ):
+        sql_lyr = ds.ExecuteSQL(
+            "SELECT b, GEOMETRY, AsText(GEOMETRY) AS wkt FROM test WHERE a >= 1",
+            dialect="SQLite",
+        )
+        try:
+            f = sql_lyr.GetNextFeature()
+            assert f["b"] == "val1"
+            assert f["wkt"] == "POINT(1 1)"
+            assert f.GetGeometryRef().ExportToWkt() == "POINT (1 1)"
+
+            lyr_defn = lyr.GetLayerDefn()
+            assert not lyr_defn.GetFieldDefn(0).IsIgnored()
+            assert not lyr_defn.GetFieldDefn(1).IsIgnored()
+            assert lyr_defn.GetFieldDefn(2).IsIgnored() == (
+                ignore_unused_fields == "YES"
+            )
+            assert not lyr_defn.IsGeometryIgnored()
+
+            f = sql_lyr.GetNextFeature()
+            assert f["b"] == "val2"
+            assert f["wkt"] == "POINT(2 2)"
+            assert sql_lyr.GetNextFeature() is None
+        finally:
+            ds.ReleaseResultSet(sql_lyr)
+
+    # Ignored fields must be reset once the statement is finished
+    assert not lyr.GetLayerDefn().GetFieldDefn(2).IsIgnored()
+
+    sql_lyr = ds.ExecuteSQL("SELECT c FROM test WHERE a = 2", dialect="SQLite")
+    f = sql_lyr.GetNextFeature()
+    assert f["c"] == 2.5
+    assert f.GetGeometryRef() is None
+    ds.ReleaseResultSet(sql_lyr)
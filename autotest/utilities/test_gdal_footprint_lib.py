@@ -36,7 +36,7 @@ import pathlib
 import ogrtest
 import pytest
 
-from osgeo import gdal, osr
+from osgeo import gdal, ogr, osr
 
 pytestmark = pytest.mark.require_geos
 
@@ -338,6 +338,55 @@ def test_gdal_footprint_lib_ovr():
     ogrtest.check_feature_geometry(f, "MULTIPOLYGON (((0 0,0 2,1.5 2.0,1.5 0.0,0 0)))")
 
 
+###############################################################################
+# Test hierarchical polygonization with coarseOvr
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_gdal_footprint_lib_coarse_ovr(num_threads):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1500, 1200, 1)
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    # L-shaped valid area, spanning several 512x512 tiles
+    src_ds.GetRasterBand(1).WriteRaster(100, 50, 1300, 400, b"\xFF" * (1300 * 400))
+    src_ds.GetRasterBand(1).WriteRaster(100, 450, 600, 700, b"\xFF" * (600 * 700))
+    src_ds.BuildOverviews("NEAR", [8])
+
+    ref_ds = gdal.Footprint("", src_ds, format="Memory", targetCoordinateSystem="pixel")
+    ref_geom = ref_ds.GetLayer(0).GetNextFeature().GetGeometryRef()
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        out_ds = gdal.Footprint(
+            "",
+            src_ds,
+            format="Memory",
+            targetCoordinateSystem="pixel",
+            coarseOvr=0,
+        )
+    assert out_ds is not None
+    lyr = out_ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 1
+    geom = lyr.GetNextFeature().GetGeometryRef()
+    assert geom.GetGeometryType() == ogr.wkbMultiPolygon
+    assert geom.GetArea() == pytest.approx(ref_geom.GetArea())
+    assert geom.SymDifference(ref_geom).GetArea() == pytest.approx(0)
+
+
+###############################################################################
+#
+
+
+def test_gdal_footprint_lib_coarse_ovr_not_coarser():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 20, 20, 1)
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.BuildOverviews("NEAR", [2, 4])
+    with pytest.raises(Exception, match="-coarse_ovr should be greater than -ovr"):
+        gdal.Footprint("", src_ds, format="Memory", ovr=1, coarseOvr=0)
+    with pytest.raises(Exception, match="Overview index 2 invalid"):
+        gdal.Footprint("", src_ds, format="Memory", coarseOvr=2)
+
+
 ###############################################################################
 #
 
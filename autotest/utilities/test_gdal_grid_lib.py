@@ -31,6 +31,7 @@
 
 import array
 import collections
+import random
 import struct
 
 import gdaltest
@@ -1101,3 +1102,76 @@ def test_gdal_grid_lib_errors():
             algorithm="invdist",
             SQLStatement="invalid",
         )
+
+
+###############################################################################
+# Test the KD-tree backed algorithms against a brute force computation,
+# with one and several threads
+
+
+@pytest.mark.parametrize(
+    "alg",
+    [
+        "nearest",
+        "nearest:radius1=0.2:radius2=0.2",
+        "invdistnn:power=2:radius=0.3:max_points=5",
+        "average:radius1=0.25:radius2=0.25",
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdal_grid_lib_kdtree(alg, num_threads):
+
+    rng = random.Random(0)
+    points = [(rng.random(), rng.random(), rng.random() * 100) for i in range(500)]
+
+    mem_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    lyr = mem_ds.CreateLayer("test")
+    for x, y, z in points:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.Geometry(wkt="POINT Z (%.17g %.17g %.17g)" % (x, y, z)))
+        lyr.CreateFeature(f)
+
+    width = 70
+    height = 70
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Grid(
+            "",
+            mem_ds,
+            width=width,
+            height=height,
+            outputBounds=[0, 0, 1, 1],
+            outputType=gdal.GDT_Float64,
+            format="MEM",
+            algorithm=alg,
+        )
+    got = struct.unpack("d" * width * height, ds.ReadRaster())
+
+    def expected_value(px, py):
+        dists = sorted(
+            ((x - px) ** 2 + (y - py) ** 2, z, x, y) for (x, y, z) in points
+        )
+        if alg == "nearest":
+            return dists[0][1]
+        if alg.startswith("nearest"):
+            for d2, z, x, y in dists:
+                if abs(x - px) <= 0.2 and abs(y - py) <= 0.2:
+                    return z
+            return 0
+        if alg.startswith("invdistnn"):
+            neighbours = [(d2, z) for (d2, z, _, _) in dists if d2 <= 0.3**2][:5]
+            if not neighbours:
+                return 0
+            return sum(z / d2 for (d2, z) in neighbours) / sum(
+                1 / d2 for (d2, z) in neighbours
+            )
+        values = [z for (d2, z, _, _) in dists if d2 <= 0.25**2]
+        return sum(values) / len(values) if values else 0
+
+    # Check a subset of the pixels, including the borders of the 64x64 tiles
+    for j in (0, 1, 31, 63, 64, 69):
+        for i in (0, 2, 40, 63, 64, 69):
+            px = (i + 0.5) / width
+            py = 1 - (j + 0.5) / height
+            assert got[j * width + i] == pytest.approx(
+                expected_value(px, py), rel=1e-9, abs=1e-9
+            ), (i, j)
@@ -0,0 +1,198 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  gdal_tiler testing
+#
+###############################################################################
+# Copyright (c) 2024, GDAL contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+import struct
+
+import gdaltest
+import pytest
+import test_cli_utilities
+
+from osgeo import gdal, osr
+
+pytestmark = pytest.mark.skipif(
+    test_cli_utilities.get_gdal_tiler_path() is None,
+    reason="gdal_tiler not available",
+)
+
+
+@pytest.fixture()
+def gdal_tiler_path():
+    return test_cli_utilities.get_gdal_tiler_path()
+
+
+def _list_tiles(root):
+    tiles = []
+    for dirpath, _, filenames in os.walk(root):
+        for filename in filenames:
+            tiles.append(os.path.relpath(os.path.join(dirpath, filename), root))
+    return sorted(tiles)
+
+
+###############################################################################
+# Test WebMercator tiles, with lower zoom levels derived from the maximum one
+
+
+def test_gdal_tiler_mercator(gdal_tiler_path, tmp_path):
+
+    out_dir = str(tmp_path / "out")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_tiler_path + " -q -z 10-12 ../gcore/data/byte.tif " + out_dir
+    )
+    assert err == ""
+
+    tiles = _list_tiles(out_dir)
+    assert sorted(set(t.split(os.sep)[0] for t in tiles)) == ["10", "11", "12"]
+    assert not [t for t in tiles if not t.endswith(".png")]
+
+    for tile in tiles:
+        ds = gdal.Open(os.path.join(out_dir, tile))
+        assert ds.RasterXSize == 256
+        assert ds.RasterYSize == 256
+        assert ds.RasterCount == 2
+        assert ds.GetRasterBand(2).GetColorInterpretation() == gdal.GCI_AlphaBand
+        assert ds.GetRasterBand(2).Checksum() != 0
+
+
+###############################################################################
+# Test geodetic tiles, TMS and XYZ numbering
+
+
+@pytest.mark.parametrize("xyz", [False, True])
+def test_gdal_tiler_geodetic(gdal_tiler_path, tmp_path, xyz):
+
+    out_dir = str(tmp_path / "out")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_tiler_path
+        + " -q -p geodetic -z 0-1"
+        + (" --xyz" if xyz else "")
+        + " ../gdrivers/data/small_world.tif "
+        + out_dir
+    )
+    assert err == ""
+
+    tiles = _list_tiles(out_dir)
+    expected = [
+        os.path.join("0", "0", "0.png"),
+        os.path.join("0", "1", "0.png"),
+    ] + [
+        os.path.join("1", str(x), str(y) + ".png") for x in range(4) for y in range(2)
+    ]
+    assert tiles == sorted(expected)
+
+    # Northern hemisphere tile of the western part of the world
+    ds = gdal.Open(os.path.join(out_dir, "1", "0", ("0" if xyz else "1") + ".png"))
+    assert ds.RasterCount == 4
+    assert ds.GetRasterBand(4).ComputeRasterMinMax()[1] == 255
+
+
+###############################################################################
+# Test JPEG tiles
+
+
+def test_gdal_tiler_jpeg(gdal_tiler_path, tmp_path):
+
+    if gdal.GetDriverByName("JPEG") is None:
+        pytest.skip("JPEG driver not available")
+
+    out_dir = str(tmp_path / "out")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_tiler_path
+        + " -q -p geodetic -z 0-1 --tiledriver JPEG -co QUALITY=90"
+        + " ../gdrivers/data/small_world.tif "
+        + out_dir
+    )
+    assert err == ""
+
+    ds = gdal.Open(os.path.join(out_dir, "0", "0", "0.jpg"))
+    assert ds.GetDriver().ShortName == "JPEG"
+    assert ds.RasterCount == 3
+
+
+###############################################################################
+# Test that lower zoom levels have no seams at the borders of the chunks,
+# including for those computed from the temporary file of the previous pass
+
+
+def test_gdal_tiler_no_seams_between_chunks(gdal_tiler_path, tmp_path):
+
+    # Step from 0 to 255 at longitude 0, which is a chunk border, on the
+    # grid of zoom level 8 of WorldCRS84Quad
+    src_filename = str(tmp_path / "src.tif")
+    res = 180.0 / 256 / 256
+    ds = gdal.GetDriverByName("GTiff").Create(src_filename, 512, 512)
+    ds.SetGeoTransform([-256 * res, res, 0, 256 * res, 0, -res])
+    ds.SetSpatialRef(osr.SpatialReference(epsg=4326))
+    ds.WriteRaster(0, 0, 512, 512, (b"\x00" * 256 + b"\xff" * 256) * 512)
+    ds = None
+
+    tmp_dir = tmp_path / "tmp"
+    tmp_dir.mkdir()
+    out_dir = str(tmp_path / "out")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_tiler_path
+        + f" -q -p geodetic -z 3-8 -r cubic --xyz --config CPL_TMPDIR {tmp_dir} "
+        + src_filename
+        + " "
+        + out_dir
+    )
+    assert err == ""
+    assert list(tmp_dir.iterdir()) == []
+
+    # Rows at latitude 0.35
+    for zoom, row in ((4, 248), (3, 252)):
+        x = 1 << zoom
+        y = (1 << (zoom - 1)) - 1
+        left_ds = gdal.Open(os.path.join(out_dir, str(zoom), str(x - 1), f"{y}.png"))
+        right_ds = gdal.Open(os.path.join(out_dir, str(zoom), str(x), f"{y}.png"))
+        left = struct.unpack("B" * 2, left_ds.ReadRaster(255, row, 1, 1))
+        right = struct.unpack("B" * 2, right_ds.ReadRaster(0, row, 1, 1))
+        assert left[1] == 255 and right[1] == 255
+        # Without the neighbouring chunk, they would be 0 and 255
+        assert left[0] > 0
+        assert right[0] < 255
+
+
+###############################################################################
+# Test error cases
+
+
+def test_gdal_tiler_errors(gdal_tiler_path, tmp_path):
+
+    out_dir = str(tmp_path / "out")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_tiler_path + " -z 12-10 ../gcore/data/byte.tif " + out_dir
+    )
+    assert "Minimum zoom level is greater than maximum zoom level" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_tiler_path + " ../gcore/data/uint16.tif " + out_dir
+    )
+    assert "Only Byte bands are supported" in err
@@ -424,3 +424,61 @@ def test_gdal_viewshed_south_up(gdal_viewshed_path, tmp_path, viewshed_input):
         struct.unpack("B" * (width * height), ds.GetRasterBand(1).ReadRaster())
         == expected_data
     )
+
+
+###############################################################################
+
+
+@pytest.mark.parametrize("num_threads", ["1", "ALL_CPUS"])
+def test_gdal_viewshed_cumulative(
+    gdal_viewshed_path, tmp_path, viewshed_input, num_threads
+):
+
+    observers = str(tmp_path / "observers.csv")
+    with open(observers, "wt") as f:
+        f.write("WKT\n")
+        f.write(f'"POINT ({ox[0]} {oy[0]})"\n')
+        f.write(f'"POINT ({ox[0] + 2000} {oy[0] - 2000})"\n')
+        f.write(f'"POINT ({ox[0] + 2000} {oy[0] - 2000})"\n')
+        f.write('"POINT (0 0)"\n')
+
+    single_out = str(tmp_path / "single.tif")
+    gdaltest.runexternal(
+        gdal_viewshed_path
+        + " -oz {} -ox {} -oy {} -vv 1 {} {}".format(
+            oz[0], ox[0], oy[0], viewshed_input, single_out
+        )
+    )
+
+    viewshed_out = str(tmp_path / "test_gdal_viewshed_cumulative.tif")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " -oz {} -observers {} -j {} {} {}".format(
+            oz[0], observers, num_threads, viewshed_input, viewshed_out
+        )
+    )
+    assert "falls outside of the DEM area" in err
+    ds = gdal.Open(viewshed_out)
+    assert ds.GetRasterBand(1).DataType == gdal.GDT_UInt16
+    assert ds.RasterXSize == gdal.Open(viewshed_input).RasterXSize
+    ar = ds.GetRasterBand(1).ReadRaster()
+    counts = struct.unpack("H" * (ds.RasterXSize * ds.RasterYSize), ar)
+    assert max(counts) >= 2
+    assert max(counts) <= 3
+
+    # Pixels visible from the first observer must have a count of at
+    # least 1.
+    single_ds = gdal.Open(single_out)
+    single = single_ds.GetRasterBand(1).ReadRaster()
+    assert all(counts[i] >= 1 for i in range(len(counts)) if single[i] == 1)
+
+
+###############################################################################
+
+
+def test_gdal_viewshed_observers_and_ox(gdal_viewshed_path, tmp_path):
+
+    _, err = gdaltest.runexternal_out_and_err(
+        f"{gdal_viewshed_path} -ox 0 -oy 0 -observers foo.csv ../gdrivers/data/n43.tif {tmp_path}/tmp.tif"
+    )
+    assert "-observers is mutually exclusive with -ox/-oy" in err
@@ -226,6 +226,60 @@ def test_gdaladdo_partial_refresh_from_projwin(gdaladdo_path, tmp_path):
     ds = None
 
 
+###############################################################################
+# Test --partial-refresh-from-dirty-regions
+
+
+def test_gdaladdo_partial_refresh_from_dirty_regions(gdaladdo_path, tmp_path):
+
+    input_tif = str(tmp_path / "tmp.tif")
+
+    gdal.Translate(
+        input_tif, "../gcore/data/byte.tif", options="-outsize 512 512 -r cubic"
+    )
+    gdaltest.runexternal(f"{gdaladdo_path} -r bilinear {input_tif} 2 4")
+
+    x = 10
+    y = 20
+    width = 30
+    height = 40
+    with gdal.config_option("GDAL_TRACK_DIRTY_REGIONS", "YES"):
+        ds = gdal.Open(input_tif, gdal.GA_Update)
+        ovr_data_ori = array.array(
+            "B", ds.GetRasterBand(1).GetOverview(0).ReadRaster()
+        )
+        # Two adjacent writes that are merged into a single region
+        ds.GetRasterBand(1).WriteRaster(x, y, width, height // 2, b"\0" * 600)
+        ds.GetRasterBand(1).WriteRaster(
+            x, y + height // 2, width, height // 2, b"\0" * 600
+        )
+        ds = None
+
+    ds = gdal.Open(input_tif)
+    assert ds.GetMetadata("DIRTY_REGIONS") == {"REGIONS": f"{x},{y},{width},{height}"}
+    ds = None
+
+    out, err = gdaltest.runexternal_out_and_err(
+        gdaladdo_path
+        + f" -r bilinear --partial-refresh-from-dirty-regions {input_tif} 2"
+    )
+    assert "ERROR" not in err, (out, err)
+
+    ds = gdal.Open(input_tif)
+    assert ds.GetMetadata("DIRTY_REGIONS") == {}
+    ovr_band = ds.GetRasterBand(1).GetOverview(0)
+    ovr_data_refreshed = array.array("B", ovr_band.ReadRaster())
+    # Test that data is zero only in the refreshed area, and unchanged
+    # in other areas
+    for j in range(height // 2):
+        for i in range(width // 2):
+            idx = (y // 2 + j) * ovr_band.XSize + (x // 2 + i)
+            assert ovr_data_refreshed[idx] == 0
+            ovr_data_refreshed[idx] = ovr_data_ori[idx]
+    assert ovr_data_refreshed == ovr_data_ori
+    ds = None
+
+
 ###############################################################################
 # Test --partial-refresh-from-source-timestamp
 
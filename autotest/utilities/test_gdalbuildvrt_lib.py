@@ -903,3 +903,42 @@ def test_gdalbuildvrt_lib_nodataMaxMaskThreshold_rgb_mask(tmp_vsimem):
     assert struct.unpack(
         "f" * 3, vrt_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32)
     ) == pytest.approx((1.0, 1.001, 2.0))
+
+
+###############################################################################
+# Test that opening sources on several threads gives the same VRT
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_gdalbuildvrt_lib_num_threads(tmp_vsimem, num_threads):
+
+    src_filenames = []
+    for i in range(20):
+        filename = str(tmp_vsimem / f"src{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(filename, 10, 10)
+        ds.SetGeoTransform([i * 10, 1, 0, 0, 0, -1])
+        ds.GetRasterBand(1).Fill(i)
+        ds = None
+        src_filenames.append(filename)
+    src_filenames.append(str(tmp_vsimem / "non_existing.tif"))
+
+    with gdal.quiet_errors():
+        vrt_ds = gdal.BuildVRT("", src_filenames, options=["-j", num_threads])
+    assert vrt_ds.RasterXSize == 200
+    xml = vrt_ds.GetMetadata("xml:VRT")[0]
+    positions = [xml.find(f"src{i}.tif<") for i in range(20)]
+    assert min(positions) >= 0
+    assert positions == sorted(positions)
+    assert vrt_ds.GetRasterBand(1).ReadRaster(0, 5, 200, 1) == b"".join(
+        bytes([i]) * 10 for i in range(20)
+    )
+
+
+###############################################################################
+# Test invalid -j value
+
+
+def test_gdalbuildvrt_lib_num_threads_invalid():
+
+    with pytest.raises(Exception, match="Invalid value for -j"):
+        gdal.BuildVRT("", ["../gcore/data/byte.tif"], options=["-j", "0"])
@@ -715,3 +715,36 @@ def test_gdaldem_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that GDAL_NUM_THREADS gives the same results as single-threaded mode
+
+
+@pytest.mark.parametrize("processing", ["hillshade", "slope", "aspect", "TRI"])
+@pytest.mark.parametrize("compute_edges", [False, True])
+@pytest.mark.parametrize("src_type", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_num_threads(processing, compute_edges, src_type):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=src_type
+    )
+    # Add a few nodata pixels
+    src_ds.GetRasterBand(1).SetNoDataValue(-32768)
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 10, 2, 2, struct.pack("f" * 4, *([-32768] * 4)), buf_type=gdal.GDT_Float32
+    )
+
+    checksums = []
+    for num_threads in ("1", "4"):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.DEMProcessing(
+                "",
+                src_ds,
+                processing,
+                format="MEM",
+                scale=111120,
+                computeEdges=compute_edges,
+            )
+        checksums.append(ds.GetRasterBand(1).Checksum())
+    assert checksums[0] == checksums[1]
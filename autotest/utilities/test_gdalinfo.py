@@ -74,6 +74,32 @@ def test_gdalinfo_2(gdalinfo_path):
     assert ret.find("Checksum=4672") != -1
 
 
+###############################################################################
+# Test the CPL_TRACE_FILE configuration option
+
+
+def test_gdalinfo_trace_file(gdalinfo_path, tmp_path):
+
+    trace_filename = str(tmp_path / "trace.json")
+    ret = gdaltest.runexternal(
+        f"{gdalinfo_path} -checksum ../gcore/data/byte.tif "
+        f"--config CPL_TRACE_FILE {trace_filename}"
+    )
+    assert "Checksum=4672" in ret
+
+    with open(trace_filename) as f:
+        events = json.load(f)
+    names = set(event["name"] for event in events)
+    assert "GDALOpen" in names
+    assert "RasterIO read" in names
+    assert "IReadBlock" in names
+    for event in events:
+        assert event["ph"] == "X"
+        assert event["dur"] >= 0
+    read_block = [event for event in events if event["name"] == "IReadBlock"][0]
+    assert read_block["args"]["driver"] == "GTiff"
+
+
 ###############################################################################
 # Test -nomd option
 
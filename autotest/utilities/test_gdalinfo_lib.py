@@ -306,3 +306,26 @@ def test_gdalinfo_lib_json_engineering_crs():
     assert "coordinateSystem" in ret
     assert "cornerCoordinates" in ret
     assert "wgs84Extent" not in ret
+
+
+###############################################################################
+# Test -cache_stats
+
+
+def test_gdalinfo_lib_cache_stats():
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+
+    ret = gdal.Info(ds, options="-cache_stats")
+    assert "Block cache: hits=0, misses=0," in ret
+
+    ret = gdal.Info(ds, options="-json -checksum -cache_stats")
+    stats = ret["bands"][0]["blockCacheStatistics"]
+    assert stats["misses"] > 0
+    assert stats["hits"] >= 0
+    assert stats["dirtyBlocksWritten"] == 0
+    assert stats["evictions"] == 0
+    assert stats["cacheUsed"] > 0
+
+    ret = gdal.Info(ds, options="-cache_stats")
+    assert "Block cache: hits=0, misses=0," not in ret
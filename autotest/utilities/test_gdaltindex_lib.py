@@ -458,3 +458,20 @@ def test_gdaltindex_lib_fetch_md(tmp_path, four_tiles):
     lyr = ds.GetLayer(0)
     f = lyr.GetNextFeature()
     assert f["foo_field"] == "bar"
+
+
+###############################################################################
+# Test that opening sources on several threads gives the same index
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdaltindex_lib_num_threads(tmp_path, four_tiles, num_threads):
+
+    index_filename = str(tmp_path / "test_gdaltindex_lib_num_threads.shp")
+
+    gdal.TileIndex(index_filename, four_tiles * 3, options=["-j", num_threads])
+
+    ds = ogr.Open(index_filename)
+    lyr = ds.GetLayer(0)
+    assert [f["location"] for f in lyr] == four_tiles * 3
+    del ds
@@ -463,6 +463,47 @@ def test_nearblack_lib_erosion_from_top_and_bottom(alg):
     )
 
 
+###############################################################################
+# Test that multi-threaded processing gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("alg", ["twopasses", "floodfill"])
+@pytest.mark.parametrize("maxNonBlack", [0, 2])
+@pytest.mark.parametrize("num_threads", ["2", "7"])
+def test_nearblack_lib_multithreaded(alg, maxNonBlack, num_threads):
+
+    src_ds = gdal.Warp(
+        "",
+        "../gdrivers/data/rgbsmall.tif",
+        format="MEM",
+        warpOptions=["INIT_DEST=0"],
+        srcNodata=255,
+        width=61,
+        height=57,
+    )
+
+    def run():
+        ds = gdal.Nearblack(
+            "",
+            src_ds,
+            format="MEM",
+            maxNonBlack=maxNonBlack,
+            nearDist=15,
+            setAlpha=True,
+            setMask=True,
+            alg=alg,
+        )
+        return [ds.GetRasterBand(i + 1).ReadRaster() for i in range(4)] + [
+            ds.GetRasterBand(1).GetMaskBand().ReadRaster()
+        ]
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ref = run()
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        assert run() == ref
+
+
 def test_nearblack_lib_floodfill_concave_from_left():
 
     XXX = 0
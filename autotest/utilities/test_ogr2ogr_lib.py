@@ -2710,3 +2710,49 @@ def test_ogr2ogr_lib_coordinate_precision_with_geom():
         assert f.GetGeometryRef().ExportToWkt() == "LINESTRING (0 0,10 10)"
     else:
         assert f.GetGeometryRef().ExportToWkt() == "LINESTRING (1 1,9 9)"
+
+
+###############################################################################
+# Test -j
+
+
+@pytest.mark.require_geos
+@pytest.mark.parametrize("num_threads", ["2", "ALL_CPUS"])
+def test_ogr2ogr_lib_multithreaded(num_threads):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    src_lyr = src_ds.CreateLayer("test", srs=srs, geom_type=ogr.wkbMultiLineString)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(2000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        x = (i % 100) / 10.0
+        y = (i // 100) / 10.0
+        x2 = x + 0.5
+        y2 = y + 0.5
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                f"MULTILINESTRING (({x} {y},{x2} {y2}),({x} {y2},{x2} {y}))"
+            )
+        )
+        src_lyr.CreateFeature(f)
+
+    def translate(options):
+        ds = gdal.VectorTranslate(
+            "",
+            src_ds,
+            options="-f Memory -t_srs EPSG:32631 -clipsrc 0 0 5 1 "
+            + "-explodecollections "
+            + options,
+        )
+        lyr = ds.GetLayer(0)
+        return [(f["id"], f.GetGeometryRef().ExportToIsoWkt()) for f in lyr]
+
+    ref = translate("")
+    assert len(ref) > 0
+    assert ref == translate("-j " + num_threads)
+
+    with pytest.raises(Exception, match="Invalid value for -j"):
+        gdal.VectorTranslate("", src_ds, options="-f Memory -j 0")
@@ -371,6 +371,8 @@ gdal_internal_library(ZLIB REQUIRED)
 
 gdal_check_package(Deflate "Enable libdeflate compression library (complement to ZLib)" CAN_DISABLE)
 
+gdal_check_package(ISAL "Enable Intel ISA-L igzip library for faster Deflate decompression (complement to ZLib)" CAN_DISABLE)
+
 gdal_check_package(OpenSSL "Use OpenSSL library" COMPONENTS SSL Crypto CAN_DISABLE)
 
 gdal_check_package(CryptoPP "Use crypto++ library for CPL." CAN_DISABLE)
@@ -523,7 +525,7 @@ endif()
 
 gdal_check_package(BRUNSLI "Enable BRUNSLI for JPEG packing in MRF" CAN_DISABLE)
 
-gdal_check_package(libQB3 "Enable QB3 compression in MRF" CONFIG CAN_DISABLE)
+gdal_check_package(libQB3 "Enable QB3 compression in MRF and GTiff" CONFIG CAN_DISABLE)
 
 # Disable by default the use of external shapelib, as currently the SAOffset member that holds file offsets in it is a
 # 'unsigned long', hence 32 bit on 32 bit platforms, whereas we can handle DBFs file > 4 GB. Internal shapelib has not
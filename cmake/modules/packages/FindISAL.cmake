@@ -0,0 +1,132 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+#[=======================================================================[.rst:
+FindISAL
+--------
+
+Find the Intel ISA-L (Intelligent Storage Acceleration Library) include
+directory and library.
+
+Use this module by invoking find_package with the form::
+
+.. code-block:: cmake
+
+  find_package(ISAL
+    [version]              # Minimum version e.g. 2.30.0
+    [REQUIRED]             # Fail with error if ISAL is not found
+  )
+
+Imported targets
+^^^^^^^^^^^^^^^^
+
+This module defines the following :prop_tgt:`IMPORTED` targets:
+
+.. variable:: ISAL::ISAL
+
+  Imported target for using the ISAL library, if found.
+
+Result variables
+^^^^^^^^^^^^^^^^
+
+.. variable:: ISAL_FOUND
+
+  Set to true if ISAL library found, otherwise false or undefined.
+
+.. variable:: ISAL_INCLUDE_DIRS
+
+  Paths to include directories listed in one variable for use by ISAL client.
+
+.. variable:: ISAL_LIBRARIES
+
+  Paths to libraries to linked against to use ISAL.
+
+.. variable:: ISAL_VERSION
+
+  The version string of ISAL found.
+
+Cache variables
+^^^^^^^^^^^^^^^
+
+For users who wish to edit and control the module behavior, this module
+reads hints about search locations from the following variables::
+
+.. variable:: ISAL_INCLUDE_DIR
+
+  Path to the include directory containing the ``isa-l/igzip_lib.h`` header.
+
+.. variable:: ISAL_LIBRARY
+
+  Path to ISAL library to be linked.
+
+NOTE: The variables above should not usually be used in CMakeLists.txt files!
+
+#]=======================================================================]
+
+### Find library ##############################################################
+
+if(NOT ISAL_LIBRARY)
+  find_library(ISAL_LIBRARY_RELEASE NAMES isal libisal isa-l)
+  find_library(ISAL_LIBRARY_DEBUG NAMES isald)
+
+  include(SelectLibraryConfigurations)
+  select_library_configurations(ISAL)
+else()
+  file(TO_CMAKE_PATH "${ISAL_LIBRARY}" ISAL_LIBRARY)
+endif()
+
+### Find include directory ####################################################
+find_path(ISAL_INCLUDE_DIR NAMES isa-l/igzip_lib.h)
+
+if(ISAL_INCLUDE_DIR AND EXISTS "${ISAL_INCLUDE_DIR}/isa-l.h")
+    file(STRINGS "${ISAL_INCLUDE_DIR}/isa-l.h" _isal_h_contents
+      REGEX "#define ISAL_[A-Z]+_VERSION[ ]+[0-9]+")
+    string(REGEX REPLACE ".*#define ISAL_MAJOR_VERSION[ ]+([0-9]+).*" "\\1"
+      ISAL_VERSION_MAJOR "${_isal_h_contents}")
+    string(REGEX REPLACE ".*#define ISAL_MINOR_VERSION[ ]+([0-9]+).*" "\\1"
+      ISAL_VERSION_MINOR "${_isal_h_contents}")
+    string(REGEX REPLACE ".*#define ISAL_PATCH_VERSION[ ]+([0-9]+).*" "\\1"
+      ISAL_VERSION_PATCH "${_isal_h_contents}")
+    set(ISAL_VERSION "${ISAL_VERSION_MAJOR}.${ISAL_VERSION_MINOR}.${ISAL_VERSION_PATCH}")
+    unset(_isal_h_contents)
+endif()
+
+### Set result variables ######################################################
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(ISAL
+    REQUIRED_VARS ISAL_LIBRARY ISAL_INCLUDE_DIR
+    VERSION_VAR ISAL_VERSION)
+
+mark_as_advanced(ISAL_INCLUDE_DIR ISAL_LIBRARY)
+
+set(ISAL_LIBRARIES ${ISAL_LIBRARY})
+set(ISAL_INCLUDE_DIRS ${ISAL_INCLUDE_DIR})
+
+### Import targets ############################################################
+if(ISAL_FOUND)
+  if(NOT TARGET ISAL::ISAL)
+    add_library(ISAL::ISAL UNKNOWN IMPORTED)
+    set_target_properties(ISAL::ISAL PROPERTIES
+      IMPORTED_LINK_INTERFACE_LANGUAGES "C"
+      INTERFACE_INCLUDE_DIRECTORIES "${ISAL_INCLUDE_DIR}")
+
+    if(ISAL_LIBRARY_RELEASE)
+      set_property(TARGET ISAL::ISAL APPEND PROPERTY
+        IMPORTED_CONFIGURATIONS RELEASE)
+      set_target_properties(ISAL::ISAL PROPERTIES
+        IMPORTED_LOCATION_RELEASE "${ISAL_LIBRARY_RELEASE}")
+      endif()
+
+    if(ISAL_LIBRARY_DEBUG)
+      set_property(TARGET ISAL::ISAL APPEND PROPERTY
+        IMPORTED_CONFIGURATIONS DEBUG)
+      set_target_properties(ISAL::ISAL PROPERTIES
+        IMPORTED_LOCATION_DEBUG "${ISAL_LIBRARY_DEBUG}")
+    endif()
+
+    if(NOT ISAL_LIBRARY_RELEASE AND NOT ISAL_LIBRARY_DEBUG)
+      set_property(TARGET ISAL::ISAL APPEND PROPERTY
+        IMPORTED_LOCATION "${ISAL_LIBRARY}")
+    endif()
+  endif()
+endif()
@@ -418,6 +418,13 @@ man_pages = [
         [author_evenr],
         1,
     ),
+    (
+        "programs/gdal_tiler",
+        "gdal_tiler",
+        "Generates a directory of tiles following a tile matrix set.",
+        [author_evenr],
+        1,
+    ),
 ]
 
 
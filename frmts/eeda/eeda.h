@@ -41,7 +41,8 @@
 #include <vector>
 #include <map>
 
-CPLHTTPResult *EEDAHTTPFetch(const char *pszURL, char **papszOptions);
+CPLHTTPResult *EEDAHTTPFetch(const char *pszURL, CSLConstList papszOptions,
+                             bool *pbThrottled = nullptr);
 
 /************************************************************************/
 /*                             EEDAIBandDesc                            */
@@ -467,7 +467,12 @@ static double EEDABackoffFactor(double base)
 /*                           EEDAHTTPFetch()                            */
 /************************************************************************/
 
-CPLHTTPResult *EEDAHTTPFetch(const char *pszURL, char **papszOptions)
+// If pbThrottled is not null, it is set to true if the server responded
+// that the request quota has been exceeded (HTTP 429), even if the request
+// eventually succeeded.
+
+CPLHTTPResult *EEDAHTTPFetch(const char *pszURL, CSLConstList papszOptions,
+                             bool *pbThrottled)
 {
     CPLHTTPResult *psResult;
     const int RETRY_COUNT = 4;
@@ -503,6 +508,9 @@ CPLHTTPResult *EEDAHTTPFetch(const char *pszURL, char **papszOptions)
                         reinterpret_cast<const char *>(psResult->pabyData);
             }
 
+            if (nHTTPStatus == 429 && pbThrottled)
+                *pbThrottled = true;
+
             if ((nHTTPStatus == 429 || nHTTPStatus == 500 ||
                  (nHTTPStatus >= 502 && nHTTPStatus <= 504)) &&
                 i < RETRY_COUNT)
@@ -27,6 +27,7 @@
  ****************************************************************************/
 
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "cpl_http.h"
 #include "cpl_conv.h"
 #include "ogrgeojsonreader.h"
@@ -50,6 +51,33 @@ const int SERVER_BYTE_LIMIT = 16 * 1024 * 1024;
 const int SERVER_SIMUTANEOUS_BAND_LIMIT = 100;
 const int SERVER_DIMENSION_LIMIT = 10000;
 
+// Default maximum number of getPixels requests issued concurrently
+static const int DEFAULT_MAX_CONNECTIONS = 4;
+
+class GDALEEDAIRasterBand;
+
+/************************************************************************/
+/*                          EEDAIPixelsRequest                          */
+/************************************************************************/
+
+// getPixels request of a rectangle of blocks, and its response decoded as
+// one plane per queried band.
+struct EEDAIPixelsRequest
+{
+    const GDALEEDAIRasterBand *poBand = nullptr;
+    bool bQueryAllBands = false;
+    int nBlockXOff = 0;
+    int nBlockYOff = 0;
+    int nXBlocks = 0;
+    int nYBlocks = 0;
+    int nReqXSize = 0;
+    int nReqYSize = 0;
+    CPLStringList aosOptions{};
+    std::vector<GByte> abyDecoded{};
+    bool bOK = false;
+    bool bThrottled = false;
+};
+
 /************************************************************************/
 /*                          GDALEEDAIDataset                            */
 /************************************************************************/
@@ -73,6 +101,11 @@ class GDALEEDAIDataset final : public GDALEEDABaseDataset
     double m_adfGeoTransform[6];
     std::vector<GDALEEDAIDataset *> m_apoOverviewDS{};
 
+    // Only used on the full resolution dataset
+    int m_nMaxConnections = DEFAULT_MAX_CONNECTIONS;
+    int m_nConnections = DEFAULT_MAX_CONNECTIONS;
+    int m_nMaxConnectionsUsed = 1;
+
     GDALEEDAIDataset(GDALEEDAIDataset *poParentDS, int iOvrLevel);
 
     void
@@ -112,15 +145,18 @@ class GDALEEDAIRasterBand final : public GDALRasterBand
     GDALColorInterp m_eInterp;
 
     bool DecodeNPYArray(const GByte *pabyData, int nDataLen,
-                        bool bQueryAllBands, void *pDstBuffer, int nBlockXOff,
-                        int nBlockYOff, int nXBlocks, int nYBlocks,
-                        int nReqXSize, int nReqYSize) const;
+                        bool bQueryAllBands, int nReqXSize, int nReqYSize,
+                        GByte *pabyDecoded) const;
     bool DecodeGDALDataset(const GByte *pabyData, int nDataLen,
-                           bool bQueryAllBands, void *pDstBuffer,
-                           int nBlockXOff, int nBlockYOff, int nXBlocks,
-                           int nYBlocks, int nReqXSize, int nReqYSize);
+                           bool bQueryAllBands, int nReqXSize, int nReqYSize,
+                           GByte *pabyDecoded) const;
 
-    CPLErr GetBlocks(int nBlockXOff, int nBlockYOff, int nXBlocks, int nYBlocks,
+    void PrepareRequest(EEDAIPixelsRequest &oReq, bool bQueryAllBands,
+                        CSLConstList papszBaseOptions) const;
+    bool FetchAndDecode(EEDAIPixelsRequest &oReq) const;
+    void FillBlocks(const EEDAIPixelsRequest &oReq, void *pDstBuffer);
+
+    CPLErr GetBlocks(std::vector<EEDAIPixelsRequest> &aoRequests,
                      bool bQueryAllBands, void *pBuffer);
     GUInt32 PrefetchBlocks(int nXOff, int nYOff, int nXSize, int nYSize,
                            int nBufXSize, int nBufYSize, bool bQueryAllBands);
@@ -163,6 +199,11 @@ GDALEEDAIDataset::GDALEEDAIDataset()
       m_bQueryMultipleBands(false)
 {
     m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    m_nMaxConnections = std::max(
+        1, std::min(64, atoi(CPLGetConfigOption(
+                            "EEDA_MAX_CONNECTIONS",
+                            CPLSPrintf("%d", DEFAULT_MAX_CONNECTIONS)))));
+    m_nConnections = m_nMaxConnections;
     m_adfGeoTransform[0] = 0.0;
     m_adfGeoTransform[1] = 1.0;
     m_adfGeoTransform[2] = 0.0;
@@ -208,6 +249,16 @@ GDALEEDAIDataset::~GDALEEDAIDataset()
     {
         delete m_apoOverviewDS[i];
     }
+
+    // Close the additional persistent sessions used by concurrent requests
+    for (int i = 1; i < m_nMaxConnectionsUsed; i++)
+    {
+        char **papszOptions =
+            CSLSetNameValue(nullptr, "CLOSE_PERSISTENT",
+                            CPLSPrintf("EEDAI:%p:%d", this, i));
+        CPLHTTPDestroyResult(CPLHTTPFetch(m_osBaseURL, papszOptions));
+        CSLDestroy(papszOptions);
+    }
 }
 
 /************************************************************************/
@@ -259,11 +310,13 @@ GDALRasterBand *GDALEEDAIRasterBand::GetOverview(int iIndex)
 /*                            DecodeNPYArray()                          */
 /************************************************************************/
 
+// Decode a NPY array into one plane of nReqXSize * nReqYSize pixels per
+// queried band, in pabyDecoded.
+
 bool GDALEEDAIRasterBand::DecodeNPYArray(const GByte *pabyData, int nDataLen,
-                                         bool bQueryAllBands, void *pDstBuffer,
-                                         int nBlockXOff, int nBlockYOff,
-                                         int nXBlocks, int nYBlocks,
-                                         int nReqXSize, int nReqYSize) const
+                                         bool bQueryAllBands, int nReqXSize,
+                                         int nReqYSize,
+                                         GByte *pabyDecoded) const
 {
     GDALEEDAIDataset *poGDS = reinterpret_cast<GDALEEDAIDataset *>(poDS);
 
@@ -334,88 +387,27 @@ bool GDALEEDAIRasterBand::DecodeNPYArray(const GByte *pabyData, int nDataLen,
                  10 + nHeaderLen + nDataSize, nDataLen);
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; iYBlock++)
+    // Pixels are records of the values of all queried bands: de-interleave
+    // them into one plane per band.
+    const GPtrDiff_t nPixels = static_cast<GPtrDiff_t>(nReqXSize) * nReqYSize;
+    int nOffsetBand = 10 + nHeaderLen;
+    for (int i = 1; i <= poGDS->GetRasterCount(); i++)
     {
-        int nBlockActualYSize = nBlockYSize;
-        if ((iYBlock + nBlockYOff + 1) * nBlockYSize > nRasterYSize)
-        {
-            nBlockActualYSize =
-                nRasterYSize - (iYBlock + nBlockYOff) * nBlockYSize;
-        }
-
-        for (int iXBlock = 0; iXBlock < nXBlocks; iXBlock++)
-        {
-            int nBlockActualXSize = nBlockXSize;
-            if ((iXBlock + nBlockXOff + 1) * nBlockXSize > nRasterXSize)
-            {
-                nBlockActualXSize =
-                    nRasterXSize - (iXBlock + nBlockXOff) * nBlockXSize;
-            }
-
-            int nOffsetBand =
-                10 + nHeaderLen +
-                (iYBlock * nBlockYSize * nReqXSize + iXBlock * nBlockXSize) *
-                    nTotalDataTypeSize;
+        if (!bQueryAllBands && i != nBand)
+            continue;
 
-            for (int i = 1; i <= poGDS->GetRasterCount(); i++)
-            {
-                GDALRasterBlock *poBlock = nullptr;
-                GByte *pabyDstBuffer;
-                if (i == nBand && pDstBuffer != nullptr)
-                    pabyDstBuffer = reinterpret_cast<GByte *>(pDstBuffer);
-                else if (bQueryAllBands ||
-                         (i == nBand && pDstBuffer == nullptr))
-                {
-                    GDALEEDAIRasterBand *poOtherBand =
-                        reinterpret_cast<GDALEEDAIRasterBand *>(
-                            poGDS->GetRasterBand(i));
-                    poBlock = poOtherBand->TryGetLockedBlockRef(
-                        nBlockXOff + iXBlock, nBlockYOff + iYBlock);
-                    if (poBlock != nullptr)
-                    {
-                        poBlock->DropLock();
-                        continue;
-                    }
-                    poBlock = poOtherBand->GetLockedBlockRef(
-                        nBlockXOff + iXBlock, nBlockYOff + iYBlock, TRUE);
-                    if (poBlock == nullptr)
-                    {
-                        continue;
-                    }
-                    pabyDstBuffer =
-                        reinterpret_cast<GByte *>(poBlock->GetDataRef());
-                }
-                else
-                {
-                    continue;
-                }
-
-                GDALDataType eDT = poGDS->GetRasterBand(i)->GetRasterDataType();
-                const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
-
-                for (int iLine = 0; iLine < nBlockActualYSize; iLine++)
-                {
-                    GByte *pabyLineDest =
-                        pabyDstBuffer + iLine * nDTSize * nBlockXSize;
-                    GDALCopyWords(const_cast<GByte *>(pabyData) + nOffsetBand +
-                                      iLine * nTotalDataTypeSize * nReqXSize,
-                                  eDT, nTotalDataTypeSize, pabyLineDest, eDT,
-                                  nDTSize, nBlockActualXSize);
+        const GDALDataType eDT = poGDS->GetRasterBand(i)->GetRasterDataType();
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        GDALCopyWords64(pabyData + nOffsetBand, eDT, nTotalDataTypeSize,
+                        pabyDecoded, eDT, nDTSize, nPixels);
 #ifdef CPL_MSB
-                    if (nDTSize > 1)
-                    {
-                        GDALSwapWords(pabyLineDest, nDTSize, nBlockActualXSize,
-                                      nDTSize);
-                    }
-#endif
-                }
-
-                nOffsetBand += nDTSize;
-
-                if (poBlock)
-                    poBlock->DropLock();
-            }
+        if (nDTSize > 1)
+        {
+            GDALSwapWords(pabyDecoded, nDTSize, nPixels, nDTSize);
         }
+#endif
+        nOffsetBand += nDTSize;
+        pabyDecoded += nPixels * nDTSize;
     }
     return true;
 }
@@ -424,16 +416,19 @@ bool GDALEEDAIRasterBand::DecodeNPYArray(const GByte *pabyData, int nDataLen,
 /*                            DecodeGDALDataset()                         */
 /************************************************************************/
 
+// Decode a PNG, JPEG or GeoTIFF image into one plane of
+// nReqXSize * nReqYSize pixels per queried band, in pabyDecoded.
+
 bool GDALEEDAIRasterBand::DecodeGDALDataset(const GByte *pabyData, int nDataLen,
-                                            bool bQueryAllBands,
-                                            void *pDstBuffer, int nBlockXOff,
-                                            int nBlockYOff, int nXBlocks,
-                                            int nYBlocks, int nReqXSize,
-                                            int nReqYSize)
+                                            bool bQueryAllBands, int nReqXSize,
+                                            int nReqYSize,
+                                            GByte *pabyDecoded) const
 {
     GDALEEDAIDataset *poGDS = reinterpret_cast<GDALEEDAIDataset *>(poDS);
 
-    CPLString osTmpFilename(CPLSPrintf("/vsimem/eeai/%p", this));
+    // Several responses may be decoded at the same time: name the temporary
+    // file after the destination buffer.
+    CPLString osTmpFilename(CPLSPrintf("/vsimem/eeai/%p", pabyDecoded));
     VSIFCloseL(VSIFileFromMemBuffer(
         osTmpFilename, const_cast<GByte *>(pabyData), nDataLen, false));
     const char *const apszDrivers[] = {"PNG", "JPEG", "GTIFF", nullptr};
@@ -464,89 +459,42 @@ bool GDALEEDAIRasterBand::DecodeGDALDataset(const GByte *pabyData, int nDataLen,
         return false;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; iYBlock++)
+    bool bRet = true;
+    for (int i = 1; bRet && i <= poGDS->GetRasterCount(); i++)
     {
-        int nBlockActualYSize = nBlockYSize;
-        if ((iYBlock + nBlockYOff + 1) * nBlockYSize > nRasterYSize)
-        {
-            nBlockActualYSize =
-                nRasterYSize - (iYBlock + nBlockYOff) * nBlockYSize;
-        }
-
-        for (int iXBlock = 0; iXBlock < nXBlocks; iXBlock++)
-        {
-            int nBlockActualXSize = nBlockXSize;
-            if ((iXBlock + nBlockXOff + 1) * nBlockXSize > nRasterXSize)
-            {
-                nBlockActualXSize =
-                    nRasterXSize - (iXBlock + nBlockXOff) * nBlockXSize;
-            }
-
-            for (int i = 1; i <= poGDS->GetRasterCount(); i++)
-            {
-                GDALRasterBlock *poBlock = nullptr;
-                GByte *pabyDstBuffer;
-                if (i == nBand && pDstBuffer != nullptr)
-                    pabyDstBuffer = reinterpret_cast<GByte *>(pDstBuffer);
-                else if (bQueryAllBands ||
-                         (i == nBand && pDstBuffer == nullptr))
-                {
-                    GDALEEDAIRasterBand *poOtherBand =
-                        reinterpret_cast<GDALEEDAIRasterBand *>(
-                            poGDS->GetRasterBand(i));
-                    poBlock = poOtherBand->TryGetLockedBlockRef(
-                        nBlockXOff + iXBlock, nBlockYOff + iYBlock);
-                    if (poBlock != nullptr)
-                    {
-                        poBlock->DropLock();
-                        continue;
-                    }
-                    poBlock = poOtherBand->GetLockedBlockRef(
-                        nBlockXOff + iXBlock, nBlockYOff + iYBlock, TRUE);
-                    if (poBlock == nullptr)
-                    {
-                        continue;
-                    }
-                    pabyDstBuffer =
-                        reinterpret_cast<GByte *>(poBlock->GetDataRef());
-                }
-                else
-                {
-                    continue;
-                }
-
-                GDALDataType eDT = poGDS->GetRasterBand(i)->GetRasterDataType();
-                const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
-                const int nTileBand = bQueryAllBands ? i : 1;
-                CPLErr eErr = poTileDS->GetRasterBand(nTileBand)->RasterIO(
-                    GF_Read, iXBlock * nBlockXSize, iYBlock * nBlockYSize,
-                    nBlockActualXSize, nBlockActualYSize, pabyDstBuffer,
-                    nBlockActualXSize, nBlockActualYSize, eDT, nDTSize,
-                    static_cast<GSpacing>(nDTSize) * nBlockXSize, nullptr);
-
-                if (poBlock)
-                    poBlock->DropLock();
-                if (eErr != CE_None)
-                {
-                    delete poTileDS;
-                    VSIUnlink(osTmpFilename);
-                    return false;
-                }
-            }
-        }
+        if (!bQueryAllBands && i != nBand)
+            continue;
+
+        const GDALDataType eDT = poGDS->GetRasterBand(i)->GetRasterDataType();
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        const int nTileBand = bQueryAllBands ? i : 1;
+        bRet = poTileDS->GetRasterBand(nTileBand)->RasterIO(
+                   GF_Read, 0, 0, nReqXSize, nReqYSize, pabyDecoded, nReqXSize,
+                   nReqYSize, eDT, 0, 0, nullptr) == CE_None;
+        pabyDecoded += static_cast<size_t>(nReqXSize) * nReqYSize * nDTSize;
     }
 
     delete poTileDS;
     VSIUnlink(osTmpFilename);
-    return true;
+    return bRet;
 }
 
-CPLErr GDALEEDAIRasterBand::GetBlocks(int nBlockXOff, int nBlockYOff,
-                                      int nXBlocks, int nYBlocks,
-                                      bool bQueryAllBands, void *pBuffer)
+/************************************************************************/
+/*                           PrepareRequest()                           */
+/************************************************************************/
+
+// Compute the dimensions of the pixel grid of the request and the options
+// of its getPixels POST request.
+
+void GDALEEDAIRasterBand::PrepareRequest(EEDAIPixelsRequest &oReq,
+                                         bool bQueryAllBands,
+                                         CSLConstList papszBaseOptions) const
 {
     GDALEEDAIDataset *poGDS = reinterpret_cast<GDALEEDAIDataset *>(poDS);
 
+    oReq.poBand = this;
+    oReq.bQueryAllBands = bQueryAllBands;
+
     // Build request content
     json_object *poReq = json_object_new_object();
     json_object_object_add(poReq, "fileFormat",
@@ -563,21 +511,24 @@ CPLErr GDALEEDAIRasterBand::GetBlocks(int nBlockXOff, int nBlockYOff,
     }
     json_object_object_add(poReq, "bandIds", poBands);
 
-    int nReqXSize = nBlockXSize * nXBlocks;
-    if ((nBlockXOff + nXBlocks) * nBlockXSize > nRasterXSize)
-        nReqXSize = nRasterXSize - nBlockXOff * nBlockXSize;
-    int nReqYSize = nBlockYSize * nYBlocks;
-    if ((nBlockYOff + nYBlocks) * nBlockYSize > nRasterYSize)
-        nReqYSize = nRasterYSize - nBlockYOff * nBlockYSize;
+    const int nBlockXOff = oReq.nBlockXOff;
+    const int nBlockYOff = oReq.nBlockYOff;
+    oReq.nReqXSize = nBlockXSize * oReq.nXBlocks;
+    if ((nBlockXOff + oReq.nXBlocks) * nBlockXSize > nRasterXSize)
+        oReq.nReqXSize = nRasterXSize - nBlockXOff * nBlockXSize;
+    oReq.nReqYSize = nBlockYSize * oReq.nYBlocks;
+    if ((nBlockYOff + oReq.nYBlocks) * nBlockYSize > nRasterYSize)
+        oReq.nReqYSize = nRasterYSize - nBlockYOff * nBlockYSize;
     const double dfX0 = poGDS->m_adfGeoTransform[0] +
                         nBlockXOff * nBlockXSize * poGDS->m_adfGeoTransform[1];
     const double dfY0 = poGDS->m_adfGeoTransform[3] +
                         nBlockYOff * nBlockYSize * poGDS->m_adfGeoTransform[5];
 #ifdef DEBUG_VERBOSE
     CPLDebug("EEDAI",
-             "nBlockYOff=%d nBlockYOff=%d "
+             "nBlockXOff=%d nBlockYOff=%d "
              "nXBlocks=%d nYBlocks=%d nReqXSize=%d nReqYSize=%d",
-             nBlockYOff, nBlockYOff, nXBlocks, nYBlocks, nReqXSize, nReqYSize);
+             nBlockXOff, nBlockYOff, oReq.nXBlocks, oReq.nYBlocks,
+             oReq.nReqXSize, oReq.nReqYSize);
 #endif
 
     json_object *poPixelGrid = json_object_new_object();
@@ -605,32 +556,41 @@ CPLErr GDALEEDAIRasterBand::GetBlocks(int nBlockXOff, int nBlockYOff,
 
     json_object *poDimensions = json_object_new_object();
     json_object_object_add(poDimensions, "width",
-                           json_object_new_int(nReqXSize));
+                           json_object_new_int(oReq.nReqXSize));
     json_object_object_add(poDimensions, "height",
-                           json_object_new_int(nReqYSize));
+                           json_object_new_int(oReq.nReqYSize));
     json_object_object_add(poPixelGrid, "dimensions", poDimensions);
     json_object_object_add(poReq, "grid", poPixelGrid);
 
     CPLString osPostContent = json_object_get_string(poReq);
     json_object_put(poReq);
 
-    // Issue request
-    char **papszOptions = (poGDS->m_poParentDS)
-                              ? poGDS->m_poParentDS->GetBaseHTTPOptions()
-                              : poGDS->GetBaseHTTPOptions();
-    papszOptions = CSLSetNameValue(papszOptions, "CUSTOMREQUEST", "POST");
-    CPLString osHeaders = CSLFetchNameValueDef(papszOptions, "HEADERS", "");
+    oReq.aosOptions.Assign(CSLDuplicate(papszBaseOptions), true);
+    oReq.aosOptions.SetNameValue("CUSTOMREQUEST", "POST");
+    CPLString osHeaders = oReq.aosOptions.FetchNameValueDef("HEADERS", "");
     if (!osHeaders.empty())
         osHeaders += "\r\n";
     osHeaders += "Content-Type: application/json";
-    papszOptions = CSLSetNameValue(papszOptions, "HEADERS", osHeaders);
-    papszOptions = CSLSetNameValue(papszOptions, "POSTFIELDS", osPostContent);
+    oReq.aosOptions.SetNameValue("HEADERS", osHeaders);
+    oReq.aosOptions.SetNameValue("POSTFIELDS", osPostContent);
+}
+
+/************************************************************************/
+/*                           FetchAndDecode()                           */
+/************************************************************************/
+
+// Issue the getPixels request and decode its response. Thread-safe, as long
+// as requests issued concurrently use different persistent sessions.
+
+bool GDALEEDAIRasterBand::FetchAndDecode(EEDAIPixelsRequest &oReq) const
+{
+    GDALEEDAIDataset *poGDS = reinterpret_cast<GDALEEDAIDataset *>(poDS);
+
     CPLHTTPResult *psResult = EEDAHTTPFetch(
         (poGDS->m_osBaseURL + poGDS->m_osAssetName + ":getPixels").c_str(),
-        papszOptions);
-    CSLDestroy(papszOptions);
+        oReq.aosOptions.List(), &oReq.bThrottled);
     if (psResult == nullptr)
-        return CE_Failure;
+        return false;
 
     if (psResult->pszErrBuf != nullptr)
     {
@@ -644,7 +604,7 @@ CPLErr GDALEEDAIRasterBand::GetBlocks(int nBlockXOff, int nBlockYOff,
             CPLError(CE_Failure, CPLE_AppDefined, "%s", psResult->pszErrBuf);
         }
         CPLHTTPDestroyResult(psResult);
-        return CE_Failure;
+        return false;
     }
 
     if (psResult->pabyData == nullptr)
@@ -652,7 +612,7 @@ CPLErr GDALEEDAIRasterBand::GetBlocks(int nBlockXOff, int nBlockYOff,
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Empty content returned by server");
         CPLHTTPDestroyResult(psResult);
-        return CE_Failure;
+        return false;
     }
 #ifdef DEBUG_VERBOSE
     CPLDebug("EEADI", "Result: %s (%d bytes)",
@@ -660,30 +620,232 @@ CPLErr GDALEEDAIRasterBand::GetBlocks(int nBlockXOff, int nBlockYOff,
              psResult->nDataLen);
 #endif
 
-    if (EQUAL(poGDS->m_osPixelEncoding, "NPY"))
+    size_t nDecodedSize = 0;
+    for (int i = 1; i <= poGDS->GetRasterCount(); i++)
     {
-        if (!DecodeNPYArray(psResult->pabyData, psResult->nDataLen,
-                            bQueryAllBands, pBuffer, nBlockXOff, nBlockYOff,
-                            nXBlocks, nYBlocks, nReqXSize, nReqYSize))
+        if (oReq.bQueryAllBands || i == nBand)
         {
-            CPLHTTPDestroyResult(psResult);
-            return CE_Failure;
+            nDecodedSize += static_cast<size_t>(oReq.nReqXSize) *
+                            oReq.nReqYSize *
+                            GDALGetDataTypeSizeBytes(
+                                poGDS->GetRasterBand(i)->GetRasterDataType());
         }
     }
+    try
+    {
+        oReq.abyDecoded.resize(nDecodedSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for decoded pixels");
+        CPLHTTPDestroyResult(psResult);
+        return false;
+    }
+
+    bool bRet;
+    if (EQUAL(poGDS->m_osPixelEncoding, "NPY"))
+    {
+        bRet = DecodeNPYArray(psResult->pabyData, psResult->nDataLen,
+                              oReq.bQueryAllBands, oReq.nReqXSize,
+                              oReq.nReqYSize, oReq.abyDecoded.data());
+    }
     else
     {
-        if (!DecodeGDALDataset(psResult->pabyData, psResult->nDataLen,
-                               bQueryAllBands, pBuffer, nBlockXOff, nBlockYOff,
-                               nXBlocks, nYBlocks, nReqXSize, nReqYSize))
+        bRet = DecodeGDALDataset(psResult->pabyData, psResult->nDataLen,
+                                 oReq.bQueryAllBands, oReq.nReqXSize,
+                                 oReq.nReqYSize, oReq.abyDecoded.data());
+    }
+
+    CPLHTTPDestroyResult(psResult);
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                             FillBlocks()                             */
+/************************************************************************/
+
+// Copy the decoded pixels of a request into the blocks of the queried
+// bands that are not yet cached, or into pDstBuffer for the block of this
+// band when it is not null (single block request).
+
+void GDALEEDAIRasterBand::FillBlocks(const EEDAIPixelsRequest &oReq,
+                                     void *pDstBuffer)
+{
+    GDALEEDAIDataset *poGDS = reinterpret_cast<GDALEEDAIDataset *>(poDS);
+
+    const GByte *pabyPlane = oReq.abyDecoded.data();
+    for (int i = 1; i <= poGDS->GetRasterCount(); i++)
+    {
+        if (!oReq.bQueryAllBands && i != nBand)
+            continue;
+
+        GDALEEDAIRasterBand *poOtherBand =
+            reinterpret_cast<GDALEEDAIRasterBand *>(poGDS->GetRasterBand(i));
+        const int nDTSize =
+            GDALGetDataTypeSizeBytes(poOtherBand->GetRasterDataType());
+
+        for (int iYBlock = 0; iYBlock < oReq.nYBlocks; iYBlock++)
         {
-            CPLHTTPDestroyResult(psResult);
-            return CE_Failure;
+            const int nBlockY = oReq.nBlockYOff + iYBlock;
+            int nBlockActualYSize = nBlockYSize;
+            if ((nBlockY + 1) * nBlockYSize > nRasterYSize)
+                nBlockActualYSize = nRasterYSize - nBlockY * nBlockYSize;
+
+            for (int iXBlock = 0; iXBlock < oReq.nXBlocks; iXBlock++)
+            {
+                const int nBlockX = oReq.nBlockXOff + iXBlock;
+                int nBlockActualXSize = nBlockXSize;
+                if ((nBlockX + 1) * nBlockXSize > nRasterXSize)
+                    nBlockActualXSize = nRasterXSize - nBlockX * nBlockXSize;
+
+                GDALRasterBlock *poBlock = nullptr;
+                GByte *pabyDstBuffer;
+                if (i == nBand && pDstBuffer != nullptr)
+                    pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
+                else
+                {
+                    poBlock =
+                        poOtherBand->TryGetLockedBlockRef(nBlockX, nBlockY);
+                    if (poBlock != nullptr)
+                    {
+                        poBlock->DropLock();
+                        continue;
+                    }
+                    poBlock =
+                        poOtherBand->GetLockedBlockRef(nBlockX, nBlockY, TRUE);
+                    if (poBlock == nullptr)
+                        continue;
+                    pabyDstBuffer = static_cast<GByte *>(poBlock->GetDataRef());
+                }
+
+                for (int iLine = 0; iLine < nBlockActualYSize; iLine++)
+                {
+                    const size_t nSrcOffset =
+                        (static_cast<size_t>(iYBlock * nBlockYSize + iLine) *
+                             oReq.nReqXSize +
+                         static_cast<size_t>(iXBlock) * nBlockXSize) *
+                        nDTSize;
+                    memcpy(pabyDstBuffer +
+                               static_cast<size_t>(iLine) * nBlockXSize *
+                                   nDTSize,
+                           pabyPlane + nSrcOffset,
+                           static_cast<size_t>(nBlockActualXSize) * nDTSize);
+                }
+
+                if (poBlock)
+                    poBlock->DropLock();
+            }
         }
+
+        pabyPlane +=
+            static_cast<size_t>(oReq.nReqXSize) * oReq.nReqYSize * nDTSize;
     }
+}
 
-    CPLHTTPDestroyResult(psResult);
+/************************************************************************/
+/*                              GetBlocks()                             */
+/************************************************************************/
 
-    return CE_None;
+// Issue the getPixels requests, up to the current number of connections
+// at a time, and fill the block cache with their result.
+// pBuffer may only be not null for a single block request.
+
+CPLErr GDALEEDAIRasterBand::GetBlocks(
+    std::vector<EEDAIPixelsRequest> &aoRequests, bool bQueryAllBands,
+    void *pBuffer)
+{
+    GDALEEDAIDataset *poGDS = reinterpret_cast<GDALEEDAIDataset *>(poDS);
+    GDALEEDAIDataset *poRootDS =
+        poGDS->m_poParentDS ? poGDS->m_poParentDS : poGDS;
+
+    // Done once, as this may refresh the bearer
+    char **papszBaseOptions = poRootDS->GetBaseHTTPOptions();
+    const CPLString osSessionName(
+        CSLFetchNameValueDef(papszBaseOptions, "PERSISTENT", ""));
+    for (auto &oReq : aoRequests)
+        PrepareRequest(oReq, bQueryAllBands, papszBaseOptions);
+    CSLDestroy(papszBaseOptions);
+
+    const auto FetchJob = [](void *pData)
+    {
+        EEDAIPixelsRequest *psReq = static_cast<EEDAIPixelsRequest *>(pData);
+        psReq->bOK = psReq->poBand->FetchAndDecode(*psReq);
+    };
+
+    CPLErr eErr = CE_None;
+    for (size_t iReq = 0; iReq < aoRequests.size();)
+    {
+        const int nWaveSize = static_cast<int>(
+            std::min(static_cast<size_t>(poRootDS->m_nConnections),
+                     aoRequests.size() - iReq));
+
+        // A persistent session can only serve one request at a time
+        if (!osSessionName.empty())
+        {
+            for (int j = 1; j < nWaveSize; j++)
+            {
+                aoRequests[iReq + j].aosOptions.SetNameValue(
+                    "PERSISTENT",
+                    CPLSPrintf("%s:%d", osSessionName.c_str(), j));
+            }
+        }
+        poRootDS->m_nMaxConnectionsUsed =
+            std::max(poRootDS->m_nMaxConnectionsUsed, nWaveSize);
+
+        // Requests mostly wait for the server, so they are not accounted
+        // in the thread budget.
+        CPLWorkerThreadPool *poThreadPool =
+            nWaveSize > 1 ? GDALGetGlobalThreadPool(nWaveSize) : nullptr;
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (poJobQueue)
+        {
+            for (int j = 0; j < nWaveSize; j++)
+                poJobQueue->SubmitJob(FetchJob, &aoRequests[iReq + j]);
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            for (int j = 0; j < nWaveSize; j++)
+                FetchJob(&aoRequests[iReq + j]);
+        }
+
+        bool bThrottled = false;
+        for (int j = 0; j < nWaveSize; j++)
+        {
+            auto &oReq = aoRequests[iReq + j];
+            bThrottled |= oReq.bThrottled;
+            if (oReq.bOK)
+                FillBlocks(oReq, pBuffer);
+            else
+                eErr = CE_Failure;
+            oReq.abyDecoded.clear();
+            oReq.abyDecoded.shrink_to_fit();
+        }
+        iReq += nWaveSize;
+
+        // Additive increase / multiplicative decrease of the number of
+        // concurrent requests, depending on whether the server reported
+        // that we exceeded our quota.
+        if (bThrottled)
+        {
+            poRootDS->m_nConnections =
+                std::max(1, poRootDS->m_nConnections / 2);
+            CPLDebug("EEDAI", "Throttled by server. Using %d connection(s)",
+                     poRootDS->m_nConnections);
+        }
+        else if (poRootDS->m_nConnections < poRootDS->m_nMaxConnections)
+        {
+            poRootDS->m_nConnections++;
+        }
+
+        if (eErr != CE_None)
+            break;
+    }
+
+    return eErr;
 }
 
 /************************************************************************/
@@ -699,8 +861,12 @@ CPLErr GDALEEDAIRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
              nBlockYOff, nBand, poGDS->m_iOvrLevel);
 #endif
 
-    return GetBlocks(nBlockXOff, nBlockYOff, 1, 1, poGDS->m_bQueryMultipleBands,
-                     pBuffer);
+    std::vector<EEDAIPixelsRequest> aoRequests(1);
+    aoRequests[0].nBlockXOff = nBlockXOff;
+    aoRequests[0].nBlockYOff = nBlockYOff;
+    aoRequests[0].nXBlocks = 1;
+    aoRequests[0].nYBlocks = 1;
+    return GetBlocks(aoRequests, poGDS->m_bQueryMultipleBands, pBuffer);
 }
 
 /************************************************************************/
@@ -804,31 +970,19 @@ GUInt32 GDALEEDAIRasterBand::PrefetchBlocks(int nXOff, int nYOff, int nXSize,
             }
         }
 
-        // Don't request too many pixels in one dimension
-        if (nXBlocks * nBlockXSize > SERVER_DIMENSION_LIMIT ||
-            nYBlocks * nBlockYSize > SERVER_DIMENSION_LIMIT)
-        {
-            bMustReturn = true;
-            nRetryFlags |= RETRY_SPATIAL_SPLIT;
-        }
-
         // Make sure that we have enough cache (with a margin of 50%)
-        // and the number of queried pixels isn't too big w.r.t server
-        // limit
         const GIntBig nUncompressedSize = static_cast<GIntBig>(nXBlocks) *
                                           nYBlocks * nBlockXSize * nBlockYSize *
                                           nTotalDataTypeSize;
         const GIntBig nCacheMax = GDALGetCacheMax64() / 2;
-        if (nUncompressedSize > nCacheMax ||
-            nUncompressedSize > SERVER_BYTE_LIMIT)
+        if (nUncompressedSize > nCacheMax)
         {
             if (bQueryAllBands && poGDS->GetRasterCount() > 1)
             {
                 const GIntBig nUncompressedSizeThisBand =
                     static_cast<GIntBig>(nXBlocks) * nYBlocks * nBlockXSize *
                     nBlockYSize * nThisDTSize;
-                if (nUncompressedSizeThisBand <= SERVER_BYTE_LIMIT &&
-                    nUncompressedSizeThisBand <= nCacheMax)
+                if (nUncompressedSizeThisBand <= nCacheMax)
                 {
                     nRetryFlags |= RETRY_PER_BAND;
                 }
@@ -842,8 +996,40 @@ GUInt32 GDALEEDAIRasterBand::PrefetchBlocks(int nXOff, int nYOff, int nXSize,
         if (bMustReturn)
             return nRetryFlags;
 
-        GetBlocks(nBlockXOff, nBlockYOff, nXBlocks, nYBlocks, bQueryAllBands,
-                  nullptr);
+        // Tile the area of interest into requests that do not exceed the
+        // server limits in pixel dimensions and number of bytes, so that
+        // they can be issued concurrently.
+        const int nBytesPerBlock =
+            nBlockXSize * nBlockYSize * nTotalDataTypeSize;
+        const int nMaxBlocksPerRequest =
+            std::max(1, SERVER_BYTE_LIMIT / nBytesPerBlock);
+        const int nReqXBlocks =
+            std::min(std::min(nXBlocks, nMaxBlocksPerRequest),
+                     std::max(1, SERVER_DIMENSION_LIMIT / nBlockXSize));
+        const int nReqYBlocks =
+            std::min(std::min(nYBlocks, nMaxBlocksPerRequest / nReqXBlocks),
+                     std::max(1, SERVER_DIMENSION_LIMIT / nBlockYSize));
+
+        if (nBytesPerBlock > SERVER_BYTE_LIMIT && bQueryAllBands &&
+            poGDS->GetRasterCount() > 1)
+        {
+            return nRetryFlags | RETRY_PER_BAND;
+        }
+
+        std::vector<EEDAIPixelsRequest> aoRequests;
+        for (int iYBlock = 0; iYBlock < nYBlocks; iYBlock += nReqYBlocks)
+        {
+            for (int iXBlock = 0; iXBlock < nXBlocks; iXBlock += nReqXBlocks)
+            {
+                EEDAIPixelsRequest oReq;
+                oReq.nBlockXOff = nBlockXOff + iXBlock;
+                oReq.nBlockYOff = nBlockYOff + iYBlock;
+                oReq.nXBlocks = std::min(nReqXBlocks, nXBlocks - iXBlock);
+                oReq.nYBlocks = std::min(nReqYBlocks, nYBlocks - iYBlock);
+                aoRequests.emplace_back(std::move(oReq));
+            }
+        }
+        GetBlocks(aoRequests, bQueryAllBands, nullptr);
     }
 
     return 0;
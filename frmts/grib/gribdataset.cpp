@@ -50,6 +50,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -68,6 +69,7 @@ CPL_C_END
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
@@ -851,52 +853,70 @@ CPLErr GRIBRasterBand::LoadData()
         }
 
         // we don't seem to have any way to detect errors in this!
+        double *padfData = nullptr;
+        grib_MetaData *psMetaData = nullptr;
+        ReadGribData(poGDS->fp, start, subgNum, &padfData, &psMetaData);
+        return InstallData(padfData, psMetaData);
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                            InstallData()                             */
+/************************************************************************/
+
+// Takes ownership of the data and metadata returned by ReadGribData(), and
+// checks them against the dataset dimensions.
+CPLErr GRIBRasterBand::InstallData(double *padfData, grib_MetaData *psMetaData)
+{
+    GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
+
+    if (m_Grib_MetaData != nullptr)
+    {
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+    }
+    m_Grib_Data = padfData;
+    m_Grib_MetaData = psMetaData;
+    if (!m_Grib_Data)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
         if (m_Grib_MetaData != nullptr)
         {
             MetaFree(m_Grib_MetaData);
             delete m_Grib_MetaData;
             m_Grib_MetaData = nullptr;
         }
-        ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data, &m_Grib_MetaData);
-        if (!m_Grib_Data)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
-            if (m_Grib_MetaData != nullptr)
-            {
-                MetaFree(m_Grib_MetaData);
-                delete m_Grib_MetaData;
-                m_Grib_MetaData = nullptr;
-            }
-            return CE_Failure;
-        }
+        return CE_Failure;
+    }
 
-        // Check the band matches the dataset as a whole, size wise. (#3246)
-        nGribDataXSize = m_Grib_MetaData->gds.Nx;
-        nGribDataYSize = m_Grib_MetaData->gds.Ny;
-        if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
-                     nGribDataYSize);
-            MetaFree(m_Grib_MetaData);
-            delete m_Grib_MetaData;
-            m_Grib_MetaData = nullptr;
-            return CE_Failure;
-        }
+    // Check the band matches the dataset as a whole, size wise. (#3246)
+    nGribDataXSize = m_Grib_MetaData->gds.Nx;
+    nGribDataYSize = m_Grib_MetaData->gds.Ny;
+    if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
+                 nGribDataYSize);
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+        m_Grib_MetaData = nullptr;
+        return CE_Failure;
+    }
 
-        poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
-                               nGribDataYSize * sizeof(double);
-        poGDS->poLastUsedBand = this;
+    poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
+                           nGribDataYSize * sizeof(double);
+    poGDS->poLastUsedBand = this;
 
-        if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d, while the first band "
-                     "and dataset is %dx%d.  Georeferencing of band %d may "
-                     "be incorrect, and data access may be incomplete.",
-                     nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
-                     nRasterYSize, nBand);
-        }
+    if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d, while the first band "
+                 "and dataset is %dx%d.  Georeferencing of band %d may "
+                 "be incorrect, and data access may be incomplete.",
+                 nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
+                 nRasterYSize, nBand);
     }
 
     return CE_None;
@@ -1299,6 +1319,127 @@ CPLErr GRIBDataset::GetGeoTransform(double *padfTransform)
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              int *panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nBandCount > 1)
+        PrefetchBands(nBandCount, panBandMap);
+
+    return GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
+/************************************************************************/
+/*                           PrefetchBands()                            */
+/************************************************************************/
+
+namespace
+{
+struct GRIBDecodingJob
+{
+    std::string osFilename{};
+    GRIBRasterBand *poBand = nullptr;
+    vsi_l_offset nStart = 0;
+    int nSubgNum = 0;
+    double *padfData = nullptr;
+    grib_MetaData *psMetaData = nullptr;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+// Decodes the messages of the requested bands that are not cached yet in
+// worker threads (each with its own file handle), when GDAL_NUM_THREADS is
+// set and the result fits in the GRIB_CACHEMAX budget. Bands that cannot be
+// prefetched are just loaded on demand by IReadBlock().
+void GRIBDataset::PrefetchBands(int nBandCount, const int *panBandMap)
+{
+    if (bCacheOnlyOneBand)
+        return;
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszThreads == nullptr)
+        return;
+    int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+    nThreads = std::min(std::max(nThreads, 1), 128);
+    if (nThreads <= 1)
+        return;
+
+    std::vector<GRIBDecodingJob> asJobs;
+    std::set<int> oSetBands;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        auto poBand =
+            cpl::down_cast<GRIBRasterBand *>(GetRasterBand(panBandMap[i]));
+        if (poBand->m_Grib_Data == nullptr &&
+            oSetBands.insert(panBandMap[i]).second)
+        {
+            GRIBDecodingJob sJob;
+            sJob.osFilename = GetDescription();
+            sJob.poBand = poBand;
+            sJob.nStart = poBand->start;
+            sJob.nSubgNum = poBand->subgNum;
+            asJobs.push_back(std::move(sJob));
+        }
+    }
+    if (asJobs.size() <= 1)
+        return;
+
+    const GIntBig nBandBytes =
+        static_cast<GIntBig>(nRasterXSize) * nRasterYSize * sizeof(double);
+    if (nCachedBytes + nBandBytes * static_cast<GIntBig>(asJobs.size()) >
+        nCachedBytesThreshold)
+    {
+        return;
+    }
+
+    nThreads = std::min(nThreads, static_cast<int>(asJobs.size()));
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool == nullptr)
+        return;
+    auto poQueue = poPool->CreateJobQueue();
+    CPLDebug("GRIB", "Decoding %d messages with %d threads",
+             static_cast<int>(asJobs.size()), nThreads);
+
+    const auto JobFunc = [](void *pData)
+    {
+        auto psJob = static_cast<GRIBDecodingJob *>(pData);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        VSILFILE *fpJob = VSIFOpenL(psJob->osFilename.c_str(), "rb");
+        if (fpJob)
+        {
+            GRIBRasterBand::ReadGribData(fpJob, psJob->nStart, psJob->nSubgNum,
+                                         &psJob->padfData,
+                                         &psJob->psMetaData);
+            VSIFCloseL(fpJob);
+        }
+        CPLUninstallErrorHandlerAccumulator();
+    };
+    for (auto &sJob : asJobs)
+        poQueue->SubmitJob(JobFunc, &sJob);
+    poQueue->WaitCompletion();
+
+    for (auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        if (sJob.psMetaData == nullptr)
+            continue;  // could not open the file: will be read on demand
+        sJob.poBand->InstallData(sJob.padfData, sJob.psMetaData);
+    }
+}
+
 /************************************************************************/
 /*                                Inventory()                           */
 /************************************************************************/
@@ -111,8 +111,16 @@ class GRIBDataset final : public GDALPamDataset
         return m_poRootGroup;
     }
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount, int *panBandMap,
+                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                     GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
   private:
     void SetGribMetaData(grib_MetaData *meta);
+    void PrefetchBands(int nBandCount, const int *panBandMap);
     static GDALDataset *OpenMultiDim(GDALOpenInfo *);
     static std::unique_ptr<gdal::grib::InventoryWrapper>
     Inventory(VSILFILE *, GDALOpenInfo *);
@@ -168,6 +176,7 @@ class GRIBRasterBand final : public GDALPamRasterBand
 
   private:
     CPLErr LoadData();
+    CPLErr InstallData(double *padfData, grib_MetaData *psMetaData);
     void FindNoDataGrib2(bool bSeekToStart = true);
     void FindMetaData();
     // Heuristic search for the start of the message
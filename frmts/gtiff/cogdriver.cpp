@@ -39,6 +39,7 @@
 #include "tilematrixset.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -70,8 +71,25 @@ static bool HasZSTDCompression()
 /*                           GetTmpFilename()                           */
 /************************************************************************/
 
-static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
+// dfUncompressedSize is the size in bytes of the uncompressed content of
+// the temporary file. If it is below COG_IN_MEMORY_TMP_MAX_SIZE (default: a
+// tenth of the usable RAM), the temporary file is created in /vsimem/, which
+// saves writing it to disk and reading it back.
+static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt,
+                                double dfUncompressedSize)
 {
+    const char *pszMaxSize =
+        CPLGetConfigOption("COG_IN_MEMORY_TMP_MAX_SIZE", nullptr);
+    const double dfMaxSize =
+        pszMaxSize ? CPLAtof(pszMaxSize)
+                   : static_cast<double>(CPLGetUsablePhysicalRAM()) / 10;
+    if (dfUncompressedSize <= dfMaxSize)
+    {
+        static std::atomic<int> nCounter{0};
+        return CPLSPrintf("/vsimem/cog_%d_%s.%s", ++nCounter,
+                          CPLGetBasename(pszFilename), pszExt);
+    }
+
     const bool bSupportsRandomWrite =
         VSISupportsRandomWrite(pszFilename, false);
     CPLString osTmpFilename;
@@ -689,7 +707,11 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     CPLDebug("COG", "Reprojecting source dataset: start");
     GDALWarpAppOptionsSetProgress(psOptions, GDALScaledProgress,
                                   pScaledProgress);
-    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp"));
+    const double dfWarpedSize =
+        double(nXSize) * nYSize * (nBands + (bHasNoData ? 0 : 1)) *
+        GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType());
+    CPLString osTmpFile(
+        GetTmpFilename(pszDstFilename, "warped.tif.tmp", dfWarpedSize));
     auto hSrcDS = GDALDataset::ToHandle(poSrcDS);
 
     std::unique_ptr<CPLConfigOptionSetter> poWarpThreadSetter;
@@ -1121,7 +1143,8 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename = GetTmpFilename(
+            pszFilename, "msk.ovr.tmp", double(nXSize) * nYSize / 3);
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1151,7 +1174,10 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetTmpFilename(
+            pszFilename, "ovr.tmp",
+            double(nXSize) * nYSize * nBands / 3 *
+                GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType()));
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
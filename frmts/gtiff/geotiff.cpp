@@ -38,8 +38,10 @@
 #include "gtiffdataset.h"
 #include "tiffio.h"
 #include "tif_jxl.h"
+#include "tif_qb3.h"
 #include "xtiffio.h"
 #include <cctype>
+#include <mutex>
 
 // Needed to expose WEBP_LOSSLESS option
 #ifdef WEBP_SUPPORT
@@ -997,6 +999,9 @@ static std::mutex oDeleteMutex;
 #ifdef HAVE_JXL
 static TIFFCodec *pJXLCodec = nullptr;
 #endif
+#ifdef HAVE_QB3
+static TIFFCodec *pQB3Codec = nullptr;
+#endif
 
 void GTiffOneTimeInit()
 
@@ -1015,6 +1020,12 @@ void GTiffOneTimeInit()
         pJXLCodec = TIFFRegisterCODEC(COMPRESSION_JXL, "JXL", TIFFInitJXL);
     }
 #endif
+#ifdef HAVE_QB3
+    if (pQB3Codec == nullptr)
+    {
+        pQB3Codec = TIFFRegisterCODEC(COMPRESSION_QB3, "QB3", TIFFInitQB3);
+    }
+#endif
 
     _ParentExtender = TIFFSetTagExtender(GTiffTagExtender);
 
@@ -1033,11 +1044,17 @@ void GTiffOneTimeInit()
 static void GDALDeregister_GTiff(GDALDriver *)
 
 {
+    GTiffClearMetadataCache();
 #ifdef HAVE_JXL
     if (pJXLCodec)
         TIFFUnRegisterCODEC(pJXLCodec);
     pJXLCodec = nullptr;
 #endif
+#ifdef HAVE_QB3
+    if (pQB3Codec)
+        TIFFUnRegisterCODEC(pQB3Codec);
+    pQB3Codec = nullptr;
+#endif
 }
 
 #define COMPRESSION_ENTRY(x, bWriteSupported)                                  \
@@ -1071,6 +1088,7 @@ static const struct
     {COMPRESSION_LERC, "LERC_ZSTD", true},
     COMPRESSION_ENTRY(WEBP, true),
     COMPRESSION_ENTRY(JXL, true),
+    COMPRESSION_ENTRY(QB3, true),
 
     // Compression methods in read-only
     COMPRESSION_ENTRY(OJPEG, false),
@@ -1229,6 +1247,9 @@ CPLString GTiffGetCompressValues(bool &bHasLZW, bool &bHasDEFLATE,
     }
 #ifdef HAVE_JXL
     osCompressValues += "       <Value>JXL</Value>";
+#endif
+#ifdef HAVE_QB3
+    osCompressValues += "       <Value>QB3</Value>";
 #endif
     _TIFFfree(codecs);
 
@@ -1310,16 +1331,13 @@ static GDALSubdatasetInfo *GTiffDriverGetSubdatasetInfo(const char *pszFileName)
 }
 
 /************************************************************************/
-/*                          GDALRegister_GTiff()                        */
+/*                           GDALGTiffDriver                            */
 /************************************************************************/
 
-void GDALRegister_GTiff()
-
+class GDALGTiffDriver final : public GDALDriver
 {
-    if (GDALGetDriverByName("GTiff") != nullptr)
-        return;
-
-    CPLString osOptions;
+    std::mutex m_oMutex{};
+    bool m_bInitialized = false;
 
     bool bHasLZW = false;
     bool bHasDEFLATE = false;
@@ -1328,15 +1346,58 @@ void GDALRegister_GTiff()
     bool bHasJPEG = false;
     bool bHasWebP = false;
     bool bHasLERC = false;
-    CPLString osCompressValues(GTiffGetCompressValues(
-        bHasLZW, bHasDEFLATE, bHasLZMA, bHasZSTD, bHasJPEG, bHasWebP, bHasLERC,
-        false /* bForCOG */));
+    std::string osCompressValues{};
+
+    void InitializeCreationOptionList();
+
+  public:
+    GDALGTiffDriver();
+
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override
+    {
+        if (EQUAL(pszName, GDAL_DMD_CREATIONOPTIONLIST))
+        {
+            InitializeCreationOptionList();
+        }
+        return GDALDriver::GetMetadataItem(pszName, pszDomain);
+    }
 
-    GDALDriver *poDriver = new GDALDriver();
+    char **GetMetadata(const char *pszDomain) override
+    {
+        InitializeCreationOptionList();
+        return GDALDriver::GetMetadata(pszDomain);
+    }
+};
+
+GDALGTiffDriver::GDALGTiffDriver()
+{
+    // We could defer this in InitializeCreationOptionList() but with currently
+    // released libtiff versions where there was a bug (now fixed) in
+    // TIFFGetConfiguredCODECs(), this wouldn't work properly if the LERC codec
+    // had been registered in between
+    osCompressValues = GTiffGetCompressValues(bHasLZW, bHasDEFLATE, bHasLZMA,
+                                              bHasZSTD, bHasJPEG, bHasWebP,
+                                              bHasLERC, false /* bForCOG */);
+}
+
+/************************************************************************/
+/*                   InitializeCreationOptionList()                     */
+/************************************************************************/
+
+// The creation option list is long and only needed by a few callers
+// (gdalinfo --format, option validation, ...), so build it on first use
+// rather than at driver registration time.
+void GDALGTiffDriver::InitializeCreationOptionList()
+{
+    std::lock_guard oLock(m_oMutex);
+    if (m_bInitialized)
+        return;
 
     /* -------------------------------------------------------------------- */
     /*      Build full creation option list.                                */
     /* -------------------------------------------------------------------- */
+    CPLString osOptions;
     osOptions = "<CreationOptionList>"
                 "   <Option name='COMPRESS' type='string-select'>";
     osOptions += osCompressValues;
@@ -1469,6 +1530,9 @@ void GDALRegister_GTiff()
         "   </Option>"
         "   <Option name='SPARSE_OK' type='boolean' description='Should empty "
         "blocks be omitted on disk?' default='FALSE'/>"
+        "   <Option name='BLOCK_STATISTICS' type='boolean' description='"
+        "Whether per-block summaries of pixel values should be stored, to "
+        "speed up computation of exact statistics' default='NO'/>"
         "   <Option name='ALPHA' type='string-select' description='Mark first "
         "extrasample as being alpha'>"
         "       <Value>NON-PREMULTIPLIED</Value>"
@@ -1543,6 +1607,22 @@ void GDALRegister_GTiff()
 #endif
         "</CreationOptionList>";
 
+    GDALDriver::SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST, osOptions);
+    m_bInitialized = true;
+}
+
+/************************************************************************/
+/*                          GDALRegister_GTiff()                        */
+/************************************************************************/
+
+void GDALRegister_GTiff()
+
+{
+    if (GDALGetDriverByName("GTiff") != nullptr)
+        return;
+
+    GDALDriver *poDriver = new GDALGTiffDriver();
+
     /* -------------------------------------------------------------------- */
     /*      Set the driver details.                                         */
     /* -------------------------------------------------------------------- */
@@ -1556,7 +1636,6 @@ void GDALRegister_GTiff()
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES,
                               "Byte Int8 UInt16 Int16 UInt32 Int32 Float32 "
                               "Float64 CInt16 CInt32 CFloat32 CFloat64");
-    poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST, osOptions);
     poDriver->SetMetadataItem(
         GDAL_DMD_OPENOPTIONLIST,
         "<OpenOptionList>"
@@ -45,6 +45,7 @@
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
+#include "gdal_compressed_block_cache.h"
 #include "ogr_proj_p.h"  // OSRGetProjTLSContext()
 #include "tif_jxl.h"
 #include "tifvsi.h"
@@ -115,7 +116,7 @@ GTiffDataset::GTiffDataset()
       m_bLeaderSizeAsUInt4(false), m_bTrailerRepeatedLast4BytesRepeated(false),
       m_bMaskInterleavedWithImagery(false), m_bKnownIncompatibleEdition(false),
       m_bWriteKnownIncompatibleEdition(false), m_bHasUsedReadEncodedAPI(false),
-      m_bWriteCOGLayout(false)
+      m_bWriteCOGLayout(false), m_bBlockStatistics(false)
 {
     // CPLDebug("GDAL", "sizeof(GTiffDataset) = %d bytes", static_cast<int>(
     //     sizeof(GTiffDataset)));
@@ -249,6 +250,7 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
             }
         }
         m_poCompressQueue.reset();
+        m_oCompressThreadReservation.Release();
     }
 
     /* -------------------------------------------------------------------- */
@@ -353,6 +355,10 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
             }
             m_fpL = nullptr;
         }
+
+        // Blocks of the file may have been modified
+        if (eAccess == GA_Update && m_pszFilename)
+            GDALCompressedBlockCacheRemoveFile(m_pszFilename);
     }
 
     if (m_fpToWrite != nullptr)
@@ -737,6 +743,49 @@ void GTiffDataset::InitCreationOrOpenOptions(bool bUpdateMode,
     m_eGeoTIFFVersion = GetGeoTIFFVersion(papszOptions);
 }
 
+/************************************************************************/
+/*                          CanUseBlockLeader()                         */
+/************************************************************************/
+
+// Returns true if the size of a strile can be retrieved from the 4 bytes
+// that precede its data (BLOCK_LEADER=SIZE_AS_UINT4 COG layout), instead of
+// from the Strip/TileByteCounts array. This is only worth it on network
+// file systems, where it saves fetching pages of that array.
+bool GTiffDataset::CanUseBlockLeader()
+{
+    return eAccess == GA_ReadOnly && !m_bStreamingIn && m_bLeaderSizeAsUInt4 &&
+           !m_bKnownIncompatibleEdition && HasOptimizedReadMultiRange();
+}
+
+/************************************************************************/
+/*                          ReadBlockLeader()                           */
+/************************************************************************/
+
+bool GTiffDataset::ReadBlockLeader(vsi_l_offset nOffset, vsi_l_offset &nSize)
+{
+    if (nOffset < sizeof(GUInt32))
+        return false;
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
+    GUInt32 nLeader = 0;
+    const vsi_l_offset nLeaderOffset = nOffset - sizeof(nLeader);
+    if (fp->HasPRead())
+    {
+        if (fp->PRead(&nLeader, sizeof(nLeader), nLeaderOffset) !=
+            sizeof(nLeader))
+            return false;
+    }
+    else if (VSIFSeekL(fp, nLeaderOffset, SEEK_SET) != 0 ||
+             VSIFReadL(&nLeader, sizeof(nLeader), 1, fp) != 1)
+    {
+        return false;
+    }
+    CPL_LSBPTR32(&nLeader);
+    if (nLeader == 0)
+        return false;
+    nSize = nLeader;
+    return true;
+}
+
 /************************************************************************/
 /*                          IsBlockAvailable()                          */
 /*                                                                      */
@@ -769,6 +818,30 @@ bool GTiffDataset::IsBlockAvailable(int nBlockId, vsi_l_offset *pnOffset,
     if (eAccess == GA_ReadOnly && !m_bStreamingIn)
     {
         int nErrOccurred = 0;
+
+        // For COG files with a block leader, get the strile size from the
+        // leader, so that only the pages of the Strip/TileOffsets array
+        // needed for the block are fetched.
+        if (CanUseBlockLeader())
+        {
+            const vsi_l_offset nOffset =
+                TIFFGetStrileOffsetWithErr(m_hTIFF, nBlockId, &nErrOccurred);
+            vsi_l_offset nSize = 0;
+            if (!nErrOccurred &&
+                (nOffset == 0 || ReadBlockLeader(nOffset, nSize)))
+            {
+                m_oCacheStrileToOffsetByteCount.insert(
+                    nBlockId, std::pair<vsi_l_offset, vsi_l_offset>(
+                                  nSize ? nOffset : 0, nSize));
+                if (pnOffset)
+                    *pnOffset = nSize ? nOffset : 0;
+                if (pnSize)
+                    *pnSize = nSize;
+                return nSize != 0;
+            }
+            nErrOccurred = 0;
+        }
+
         auto bytecount =
             TIFFGetStrileByteCountWithErr(m_hTIFF, nBlockId, &nErrOccurred);
         if (nErrOccurred && pbErrOccurred)
@@ -934,6 +1007,11 @@ void GTiffDataset::RestoreVolatileParameters(TIFF *hTIFF)
         GTiffSetDeflateSubCodec(hTIFF);
     }
 
+#if HAVE_JXL
+    if (m_nJXLNumThreads > 1 && m_nCompression == COMPRESSION_JXL)
+        TIFFSetField(hTIFF, TIFFTAG_JXL_NUM_THREADS, m_nJXLNumThreads);
+#endif
+
     /* -------------------------------------------------------------------- */
     /*      Propagate any quality settings.                                 */
     /* -------------------------------------------------------------------- */
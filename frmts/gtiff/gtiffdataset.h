@@ -37,6 +37,7 @@
 
 #include "cpl_mem_cache.h"
 #include "cpl_worker_thread_pool.h"  // CPLJobQueue, CPLWorkerThreadPool
+#include "gdal_thread_pool.h"        // GDALThreadReservation
 #include "fetchbufferdirectio.h"
 #include "gtiff.h"
 #include "gt_wkt_srs.h"  // GTIFFKeysFlavorEnum
@@ -165,10 +166,14 @@ class GTiffDataset final : public GDALPamDataset
     CPLVirtualMem *m_psVirtualMemIOMapping = nullptr;
     CPLWorkerThreadPool *m_poThreadPool = nullptr;
     std::unique_ptr<CPLJobQueue> m_poCompressQueue{};
+    GDALThreadReservation m_oCompressThreadReservation{};
     std::mutex m_oCompressThreadPoolMutex{};
 
     lru11::Cache<int, std::pair<vsi_l_offset, vsi_l_offset>>
         m_oCacheStrileToOffsetByteCount{1024};
+    // Filename, size and modification time of the file, used as prefix of
+    // the keys of the compressed block cache.
+    std::string m_osCompressedBlockCacheKeyPrefix{};
 
     MaskOffset *m_panMaskOffsetLsb = nullptr;
     char *m_pszVertUnit = nullptr;
@@ -186,6 +191,7 @@ class GTiffDataset final : public GDALPamDataset
     float m_fJXLDistance = 1.0f;
     float m_fJXLAlphaDistance = -1.0f;  // -1 = same as non-alpha channel
     uint32_t m_nJXLEffort = 5;
+    int m_nJXLNumThreads = 1;  // threads used by libjxl for a single block
 #endif
     double m_dfNoDataValue = DEFAULT_NODATA_VALUE;
     int64_t m_nNoDataValueInt64 = GDAL_PAM_DEFAULT_NODATA_VALUE_INT64;
@@ -204,6 +210,8 @@ class GTiffDataset final : public GDALPamDataset
     int m_nLastWrittenBlockId = -1;  // used for m_bStreamingOut
     int m_nRefBaseMapping = 0;
     int m_nDisableMultiThreadedRead = 0;
+    // > 0 while IReadMultiWindow() has cached the ranges of a whole batch
+    int m_nMultiWindowBatchCounter = 0;
 
     GTIFFKeysFlavorEnum m_eGeoTIFFKeysFlavor = GEOTIFF_KEYS_STANDARD;
     GeoTIFFVersionEnum m_eGeoTIFFVersion = GEOTIFF_VERSION_AUTO;
@@ -314,16 +322,25 @@ class GTiffDataset final : public GDALPamDataset
     bool m_bWriteKnownIncompatibleEdition : 1;
     bool m_bHasUsedReadEncodedAPI : 1;  // for debugging
     bool m_bWriteCOGLayout : 1;
+    bool m_bBlockStatistics : 1;  // Whether per-block summaries of the pixel
+                                  // values must be maintained when writing
 
     void ScanDirectories();
     bool ReadStrile(int nBlockId, void *pOutputBuffer,
                     GPtrDiff_t nBlockReqSize);
+    bool ReadStrileUsingBlockLeader(int nBlockId, vsi_l_offset nOffset,
+                                    size_t nSize, void *pOutputBuffer,
+                                    GPtrDiff_t nBlockReqSize);
+    bool ReadStrileThroughCompressedBlockCache(int nBlockId,
+                                               void *pOutputBuffer,
+                                               GPtrDiff_t nBlockReqSize);
     CPLErr LoadBlockBuf(int nBlockId, bool bReadFromDisk = true);
     CPLErr FlushBlockBuf();
 
     void LoadMDAreaOrPoint();
     void LookForProjection();
     void LookForProjectionFromGeoTIFF();
+    std::string GetGeoTIFFCacheKey() const;
     void LookForProjectionFromXML();
 
     void Crystalize();  // TODO: Spelling.
@@ -338,6 +355,8 @@ class GTiffDataset final : public GDALPamDataset
     bool IsBlockAvailable(int nBlockId, vsi_l_offset *pnOffset = nullptr,
                           vsi_l_offset *pnSize = nullptr,
                           bool *pbErrOccurred = nullptr);
+    bool CanUseBlockLeader();
+    bool ReadBlockLeader(vsi_l_offset nOffset, vsi_l_offset &nSize);
 
     void ApplyPamInfo();
     void PushMetadataToPam();
@@ -357,6 +376,10 @@ class GTiffDataset final : public GDALPamDataset
 
     CPLErr FillEmptyTiles();
 
+    bool CanMaintainBlockStatistics() const;
+    void InitBlockStatistics(CSLConstList papszOptions);
+    void UpdateBlockStatistics(int nBlockId, const GByte *pabyData);
+
     CPLErr FlushDirectory();
     CPLErr CleanOverviews();
 
@@ -380,6 +403,7 @@ class GTiffDataset final : public GDALPamDataset
     static void ThreadCompressionFunc(void *pData);
     void WaitCompletionForJobIdx(int i);
     void WaitCompletionForBlock(int nBlockId);
+    void WriteReadyCompressionJobs();
     void WriteRawStripOrTile(int nStripOrTile, GByte *pabyCompressedBuffer,
                              GPtrDiff_t nCompressedBufferSize);
     bool SubmitCompressionJob(int nStripOrTile, GByte *pabyData, GPtrDiff_t cc,
@@ -564,5 +588,6 @@ class GTiffDataset final : public GDALPamDataset
 GTIFFKeysFlavorEnum GetGTIFFKeysFlavor(CSLConstList papszOptions);
 GeoTIFFVersionEnum GetGeoTIFFVersion(CSLConstList papszOptions);
 void GTiffSetDeflateSubCodec(TIFF *hTIFF);
+void GTiffClearMetadataCache();
 
 #endif  // GTIFFDATASET_H_INCLUDED
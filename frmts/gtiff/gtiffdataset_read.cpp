@@ -48,14 +48,17 @@
 
 #include "cpl_error.h"
 #include "cpl_error_internal.h"  // CPLErrorHandlerAccumulatorStruct
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
 #include "fetchbufferdirectio.h"
+#include "gdal_compressed_block_cache.h"
 #include "gdal_mdreader.h"    // MD_DOMAIN_RPC
 #include "geovalues.h"        // RasterPixelIsPoint
 #include "gt_wkt_srs_priv.h"  // GDALGTIFKeyGetSHORT()
 #include "tif_jxl.h"
+#include "tif_qb3.h"
 #include "tifvsi.h"
 #include "xtiffio.h"
 
@@ -395,6 +398,34 @@ struct GTiffDecompressContext
 
     uint16_t *pExtraSamples = nullptr;
     uint16_t nExtraSampleCount = 0;
+
+    // Temporary in-memory TIFF handles that are reused across jobs, since
+    // creating them is costly compared to decoding small striles (typically
+    // strips of a few lines).
+    struct TmpTIFF
+    {
+        TIFF *hTIFF = nullptr;
+        VSILFILE *fp = nullptr;
+        std::string osFilename{};
+        int nBlockYSize = 0;
+    };
+
+    std::vector<TmpTIFF> aoTmpTIFFPool{};
+
+    GTiffDecompressContext() = default;
+
+    ~GTiffDecompressContext()
+    {
+        for (auto &oTmpTIFF : aoTmpTIFFPool)
+        {
+            XTIFFClose(oTmpTIFF.hTIFF);
+            CPL_IGNORE_RET_VAL(VSIFCloseL(oTmpTIFF.fp));
+            VSIUnlink(oTmpTIFF.osFilename.c_str());
+        }
+    }
+
+    GTiffDecompressContext(const GTiffDecompressContext &) = delete;
+    GTiffDecompressContext &operator=(const GTiffDecompressContext &) = delete;
 };
 
 struct GTiffDecompressJob
@@ -701,15 +732,6 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
 
     if (nAlreadyLoadedBlocks != nBandsToCache)
     {
-        // Generate a dummy in-memory TIFF file that has all the needed tags
-        // from the original file
-        CPLString osTmpFilename;
-        osTmpFilename.Printf("/vsimem/decompress_%p.tif", psJob);
-        VSILFILE *fpTmp = VSIFOpenL(osTmpFilename.c_str(), "wb+");
-        TIFF *hTIFFTmp =
-            VSI_TIFFOpen(osTmpFilename.c_str(),
-                         psContext->bTIFFIsBigEndian ? "wb+" : "wl+", fpTmp);
-        CPLAssert(hTIFFTmp != nullptr);
         const int nBlockYSize =
             (psContext->bIsTiled ||
              psJob->nYBlock < poDS->m_nBlocksPerColumn - 1)
@@ -717,53 +739,92 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
             : (poDS->nRasterYSize % poDS->m_nBlockYSize) == 0
                 ? poDS->m_nBlockYSize
                 : poDS->nRasterYSize % poDS->m_nBlockYSize;
-        TIFFSetField(hTIFFTmp, TIFFTAG_IMAGEWIDTH, poDS->m_nBlockXSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_IMAGELENGTH, nBlockYSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_BITSPERSAMPLE, poDS->m_nBitsPerSample);
-        TIFFSetField(hTIFFTmp, TIFFTAG_COMPRESSION, poDS->m_nCompression);
-        TIFFSetField(hTIFFTmp, TIFFTAG_PHOTOMETRIC, poDS->m_nPhotometric);
-        TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLEFORMAT, poDS->m_nSampleFormat);
-        TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLESPERPIXEL,
-                     poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
-                         ? poDS->m_nSamplesPerPixel
-                         : 1);
-        TIFFSetField(hTIFFTmp, TIFFTAG_ROWSPERSTRIP, nBlockYSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_PLANARCONFIG, poDS->m_nPlanarConfig);
-        if (psContext->nPredictor != PREDICTOR_NONE)
-            TIFFSetField(hTIFFTmp, TIFFTAG_PREDICTOR, psContext->nPredictor);
-        if (poDS->m_nCompression == COMPRESSION_LERC)
-        {
-            TIFFSetField(hTIFFTmp, TIFFTAG_LERC_PARAMETERS, 2,
-                         poDS->m_anLercAddCompressionAndVersion);
-        }
-        else if (poDS->m_nCompression == COMPRESSION_JPEG)
-        {
-            if (psContext->pJPEGTable)
+
+        // Reuse a temporary TIFF handle from a previous job if possible
+        GTiffDecompressContext::TmpTIFF oTmpTIFF;
+        {
+            std::lock_guard<std::recursive_mutex> oLock(psContext->oMutex);
+            auto &aoPool = psContext->aoTmpTIFFPool;
+            for (auto oIter = aoPool.begin(); oIter != aoPool.end(); ++oIter)
             {
-                TIFFSetField(hTIFFTmp, TIFFTAG_JPEGTABLES,
-                             psContext->nJPEGTableSize, psContext->pJPEGTable);
+                if (oIter->nBlockYSize == nBlockYSize)
+                {
+                    oTmpTIFF = std::move(*oIter);
+                    aoPool.erase(oIter);
+                    break;
+                }
             }
-            if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+        }
+        TIFF *hTIFFTmp = oTmpTIFF.hTIFF;
+        if (hTIFFTmp == nullptr)
+        {
+            // Generate a dummy in-memory TIFF file that has all the needed
+            // tags from the original file
+            oTmpTIFF.osFilename =
+                CPLSPrintf("/vsimem/decompress_%p.tif", psJob);
+            oTmpTIFF.nBlockYSize = nBlockYSize;
+            const char *pszTmpFilename = oTmpTIFF.osFilename.c_str();
+            VSILFILE *fpTmp = VSIFOpenL(pszTmpFilename, "wb+");
+            hTIFFTmp = VSI_TIFFOpen(pszTmpFilename,
+                                    psContext->bTIFFIsBigEndian ? "wb+"
+                                                                : "wl+",
+                                    fpTmp);
+            CPLAssert(hTIFFTmp != nullptr);
+            TIFFSetField(hTIFFTmp, TIFFTAG_IMAGEWIDTH, poDS->m_nBlockXSize);
+            TIFFSetField(hTIFFTmp, TIFFTAG_IMAGELENGTH, nBlockYSize);
+            TIFFSetField(hTIFFTmp, TIFFTAG_BITSPERSAMPLE,
+                         poDS->m_nBitsPerSample);
+            TIFFSetField(hTIFFTmp, TIFFTAG_COMPRESSION, poDS->m_nCompression);
+            TIFFSetField(hTIFFTmp, TIFFTAG_PHOTOMETRIC, poDS->m_nPhotometric);
+            TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLEFORMAT,
+                         poDS->m_nSampleFormat);
+            TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLESPERPIXEL,
+                         poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
+                             ? poDS->m_nSamplesPerPixel
+                             : 1);
+            TIFFSetField(hTIFFTmp, TIFFTAG_ROWSPERSTRIP, nBlockYSize);
+            TIFFSetField(hTIFFTmp, TIFFTAG_PLANARCONFIG,
+                         poDS->m_nPlanarConfig);
+            if (psContext->nPredictor != PREDICTOR_NONE)
+                TIFFSetField(hTIFFTmp, TIFFTAG_PREDICTOR,
+                             psContext->nPredictor);
+            if (poDS->m_nCompression == COMPRESSION_LERC)
             {
-                TIFFSetField(hTIFFTmp, TIFFTAG_YCBCRSUBSAMPLING,
-                             psContext->nYCrbCrSubSampling0,
-                             psContext->nYCrbCrSubSampling1);
+                TIFFSetField(hTIFFTmp, TIFFTAG_LERC_PARAMETERS, 2,
+                             poDS->m_anLercAddCompressionAndVersion);
             }
-        }
-        if (psContext->pExtraSamples)
-        {
-            TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
-                         psContext->nExtraSampleCount,
-                         psContext->pExtraSamples);
-        }
-        TIFFWriteCheck(hTIFFTmp, FALSE, "ThreadDecompressionFunc");
-        TIFFWriteDirectory(hTIFFTmp);
-        XTIFFClose(hTIFFTmp);
+            else if (poDS->m_nCompression == COMPRESSION_JPEG)
+            {
+                if (psContext->pJPEGTable)
+                {
+                    TIFFSetField(hTIFFTmp, TIFFTAG_JPEGTABLES,
+                                 psContext->nJPEGTableSize,
+                                 psContext->pJPEGTable);
+                }
+                if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+                {
+                    TIFFSetField(hTIFFTmp, TIFFTAG_YCBCRSUBSAMPLING,
+                                 psContext->nYCrbCrSubSampling0,
+                                 psContext->nYCrbCrSubSampling1);
+                }
+            }
+            if (psContext->pExtraSamples)
+            {
+                TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
+                             psContext->nExtraSampleCount,
+                             psContext->pExtraSamples);
+            }
+            TIFFWriteCheck(hTIFFTmp, FALSE, "ThreadDecompressionFunc");
+            TIFFWriteDirectory(hTIFFTmp);
+            XTIFFClose(hTIFFTmp);
 
-        // Re-open file
-        hTIFFTmp = VSI_TIFFOpen(osTmpFilename.c_str(), "r", fpTmp);
-        CPLAssert(hTIFFTmp != nullptr);
-        poDS->RestoreVolatileParameters(hTIFFTmp);
+            // Re-open file
+            hTIFFTmp = VSI_TIFFOpen(pszTmpFilename, "r", fpTmp);
+            CPLAssert(hTIFFTmp != nullptr);
+            poDS->RestoreVolatileParameters(hTIFFTmp);
+            oTmpTIFF.hTIFF = hTIFFTmp;
+            oTmpTIFF.fp = fpTmp;
+        }
 
         bool bRet = true;
         // Request m_nBlockYSize line in the block, except on the bottom-most
@@ -797,6 +858,11 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
             {
                 pabyOutput = static_cast<GByte *>(apoBlocks[0]->GetDataRef());
             }
+            CPLTraceSpan oSpan("decompression", "GTiff decompress");
+            oSpan.AddArg("block_x", psJob->nXBlock);
+            oSpan.AddArg("block_y", psJob->nYBlock);
+            oSpan.AddArg("compression", poDS->m_nCompression);
+            oSpan.AddArg("bytes", static_cast<GIntBig>(abyInput.size()));
             if (!TIFFReadFromUserBuffer(hTIFFTmp, 0, abyInput.data(),
                                         abyInput.size(), pabyOutput,
                                         nReqSize) &&
@@ -805,9 +871,23 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
                 bRet = false;
             }
         }
-        XTIFFClose(hTIFFTmp);
-        CPL_IGNORE_RET_VAL(VSIFCloseL(fpTmp));
-        VSIUnlink(osTmpFilename.c_str());
+        if (bRet
+#if TIFFLIB_VERSION <= 20220520 && !defined(INTERNAL_LIBTIFF)
+            // See comment in ReadStrile() about TIFFReadFromUserBuffer()
+            // and JPEG with libtiff <= 4.4.0
+            && poDS->m_nCompression != COMPRESSION_JPEG
+#endif
+        )
+        {
+            std::lock_guard<std::recursive_mutex> oLock(psContext->oMutex);
+            psContext->aoTmpTIFFPool.push_back(std::move(oTmpTIFF));
+        }
+        else
+        {
+            XTIFFClose(hTIFFTmp);
+            CPL_IGNORE_RET_VAL(VSIFCloseL(oTmpTIFF.fp));
+            VSIUnlink(oTmpTIFF.osFilename.c_str());
+        }
 
         if (!bRet)
         {
@@ -974,12 +1054,14 @@ bool GTiffDataset::IsMultiThreadedReadCompatible() const
            !m_bStreamingIn && !m_bStreamingOut &&
            (m_nCompression == COMPRESSION_NONE ||
             m_nCompression == COMPRESSION_ADOBE_DEFLATE ||
+            m_nCompression == COMPRESSION_DEFLATE ||
             m_nCompression == COMPRESSION_LZW ||
             m_nCompression == COMPRESSION_PACKBITS ||
             m_nCompression == COMPRESSION_LZMA ||
             m_nCompression == COMPRESSION_ZSTD ||
             m_nCompression == COMPRESSION_LERC ||
             m_nCompression == COMPRESSION_JXL ||
+            m_nCompression == COMPRESSION_QB3 ||
             m_nCompression == COMPRESSION_WEBP ||
             m_nCompression == COMPRESSION_JPEG);
 }
@@ -3185,6 +3267,142 @@ int GTiffDataset::DirectIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
     return eErr;
 }
 
+/************************************************************************/
+/*                      ReadStrileUsingBlockLeader()                    */
+/************************************************************************/
+
+bool GTiffDataset::ReadStrileUsingBlockLeader(int nBlockId,
+                                              vsi_l_offset nOffset,
+                                              size_t nSize,
+                                              void *pOutputBuffer,
+                                              GPtrDiff_t nBlockReqSize)
+{
+    const size_t nTrailerSize = m_bTrailerRepeatedLast4BytesRepeated ? 4 : 0;
+    if (nSize > std::numeric_limits<size_t>::max() - nTrailerSize)
+        return false;
+    GByte *pabyData =
+        static_cast<GByte *>(VSI_MALLOC_VERBOSE(nSize + nTrailerSize));
+    if (pabyData == nullptr)
+        return false;
+
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
+    bool bOK = VSIFSeekL(fp, nOffset, SEEK_SET) == 0 &&
+               VSIFReadL(pabyData, 1, nSize + nTrailerSize, fp) ==
+                   nSize + nTrailerSize;
+
+    // Check that the trailer repeats the last 4 bytes of the strile, as a
+    // protection against a leader that would not be consistent with the
+    // actual data.
+    if (bOK && nTrailerSize)
+    {
+        GByte abyLastBytes[4] = {};
+        if (nSize >= 4)
+            memcpy(abyLastBytes, pabyData + nSize - 4, 4);
+        else
+            memcpy(abyLastBytes, pabyData, nSize);
+        bOK = memcmp(pabyData + nSize, abyLastBytes, 4) == 0;
+        if (!bOK)
+        {
+            CPLDebug("GTiff",
+                     "Inconsistent block leader or trailer for block %d",
+                     nBlockId);
+            // Do not trust the cached size anymore
+            m_oCacheStrileToOffsetByteCount.remove(nBlockId);
+        }
+    }
+
+    bOK = bOK && TIFFReadFromUserBuffer(m_hTIFF, nBlockId, pabyData, nSize,
+                                        pOutputBuffer, nBlockReqSize);
+    VSIFree(pabyData);
+    return bOK;
+}
+
+/************************************************************************/
+/*               ReadStrileThroughCompressedBlockCache()                */
+/************************************************************************/
+
+// Decodes the strile from the compressed block cache, or reads it from the
+// file and inserts it in the cache.
+bool GTiffDataset::ReadStrileThroughCompressedBlockCache(
+    int nBlockId, void *pOutputBuffer, GPtrDiff_t nBlockReqSize)
+{
+    if (eAccess != GA_ReadOnly || m_pszFilename == nullptr ||
+        m_nCompression == COMPRESSION_NONE ||
+#if TIFFLIB_VERSION <= 20220520 && !defined(INTERNAL_LIBTIFF)
+        // See comment in ReadStrile()
+        m_nCompression == COMPRESSION_JPEG ||
+#endif
+        !GDALCompressedBlockCacheIsEnabled())
+    {
+        return false;
+    }
+
+    int bErrOccurred = FALSE;
+    const vsi_l_offset nOffset =
+        TIFFGetStrileOffsetWithErr(m_hTIFF, nBlockId, &bErrOccurred);
+    const vsi_l_offset nSize =
+        TIFFGetStrileByteCountWithErr(m_hTIFF, nBlockId, &bErrOccurred);
+    if (bErrOccurred || nOffset == 0 || nSize == 0 ||
+        nSize > static_cast<vsi_l_offset>(INT_MAX))
+    {
+        return false;
+    }
+
+    if (m_osCompressedBlockCacheKeyPrefix.empty())
+    {
+        // Include the size and modification time of the file in the key, so
+        // that blocks of a file rewritten since they were cached are not
+        // reused.
+        VSIStatBufL sStat;
+        if (VSIStatL(m_pszFilename, &sStat) != 0)
+            return false;
+        m_osCompressedBlockCacheKeyPrefix = m_pszFilename;
+        m_osCompressedBlockCacheKeyPrefix += '\n';
+        m_osCompressedBlockCacheKeyPrefix +=
+            std::to_string(static_cast<GUIntBig>(sStat.st_size));
+        m_osCompressedBlockCacheKeyPrefix += '\n';
+        m_osCompressedBlockCacheKeyPrefix +=
+            std::to_string(static_cast<GIntBig>(sStat.st_mtime));
+    }
+
+    std::string osKey(m_osCompressedBlockCacheKeyPrefix);
+    osKey += '\n';
+    osKey += std::to_string(static_cast<GUIntBig>(nOffset));
+    osKey += '\n';
+    osKey += std::to_string(static_cast<GUIntBig>(nSize));
+
+    // TIFFReadFromUserBuffer() may modify the input buffer (e.g. bit
+    // reversal), so always decode from a copy.
+    std::vector<GByte> abyData;
+    auto poCached = GDALCompressedBlockCacheGet(osKey);
+    if (poCached)
+    {
+        abyData = *poCached;
+    }
+    else
+    {
+        try
+        {
+            abyData.resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+        VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
+        if (VSIFSeekL(fp, nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(abyData.data(), 1, abyData.size(), fp) != abyData.size())
+        {
+            return false;
+        }
+        GDALCompressedBlockCachePut(osKey, abyData.data(), abyData.size());
+    }
+
+    return TIFFReadFromUserBuffer(m_hTIFF, nBlockId, abyData.data(),
+                                  abyData.size(), pOutputBuffer,
+                                  nBlockReqSize) != 0;
+}
+
 /************************************************************************/
 /*                             ReadStrile()                             */
 /************************************************************************/
@@ -3192,6 +3410,12 @@ int GTiffDataset::DirectIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
 bool GTiffDataset::ReadStrile(int nBlockId, void *pOutputBuffer,
                               GPtrDiff_t nBlockReqSize)
 {
+    // Covers the fetching of the strile, unless already cached, and its
+    // decompression.
+    CPLTraceSpan oSpan("decompression", "GTiff ReadStrile");
+    oSpan.AddArg("block", nBlockId);
+    oSpan.AddArg("compression", m_nCompression);
+
     // Optimization by which we can save some libtiff buffer copy
     std::pair<vsi_l_offset, vsi_l_offset> oPair;
     if (
@@ -3220,6 +3444,23 @@ bool GTiffDataset::ReadStrile(int nBlockId, void *pOutputBuffer,
         {
             return true;
         }
+
+        // The strile size may come from the block leader (see
+        // IsBlockAvailable()). Read the strile ourselves, as libtiff would
+        // otherwise fetch the Strip/TileByteCounts array.
+        if (!pInputBuffer && oPair.first != 0 && CanUseBlockLeader() &&
+            ReadStrileUsingBlockLeader(nBlockId, oPair.first,
+                                       static_cast<size_t>(oPair.second),
+                                       pOutputBuffer, nBlockReqSize))
+        {
+            return true;
+        }
+    }
+
+    if (ReadStrileThroughCompressedBlockCache(nBlockId, pOutputBuffer,
+                                              nBlockReqSize))
+    {
+        return true;
     }
 
     // For debugging
@@ -4080,12 +4321,122 @@ void GTiffDataset::LookForProjection()
     }
 }
 
+/************************************************************************/
+/*                     GeoTIFF georeferencing cache                     */
+/************************************************************************/
+
+// Process-wide cache of the CRS built from the GeoTIFF keys, which is the
+// costliest part of opening a GeoTIFF file (PROJ database lookups). It is
+// disabled by default, and enabled by setting GTIFF_METADATA_CACHE_SIZE to
+// the maximum number of entries.
+
+namespace
+{
+struct GTiffGeoTIFFCacheEntry
+{
+    OGRSpatialReference oSRS{};
+    std::string osVertUnit{};
+    std::string osAreaOrPoint{};
+};
+
+typedef lru11::Cache<std::string, std::shared_ptr<GTiffGeoTIFFCacheEntry>>
+    GTiffGeoTIFFCache;
+}  // namespace
+
+static std::mutex goGeoTIFFCacheMutex;
+// Heap allocated so that the OGRSpatialReference objects are not destroyed
+// by static destructors, after PROJ has been cleaned up.
+static GTiffGeoTIFFCache *gpoGeoTIFFCache = nullptr;
+
+/************************************************************************/
+/*                      GTiffClearMetadataCache()                       */
+/************************************************************************/
+
+void GTiffClearMetadataCache()
+{
+    std::lock_guard<std::mutex> oLock(goGeoTIFFCacheMutex);
+    delete gpoGeoTIFFCache;
+    gpoGeoTIFFCache = nullptr;
+}
+
+/************************************************************************/
+/*                      GetGeoTIFFCacheKey()                            */
+/************************************************************************/
+
+// Returns an empty string if the cache is disabled or cannot be used for
+// this dataset.
+std::string GTiffDataset::GetGeoTIFFCacheKey() const
+{
+    const int nCacheSize =
+        atoi(CPLGetConfigOption("GTIFF_METADATA_CACHE_SIZE", "0"));
+    if (nCacheSize <= 0 || eAccess != GA_ReadOnly || m_pszFilename == nullptr)
+        return std::string();
+
+    // The file size and modification time act as validators. For network
+    // file systems, they come from the cached HEAD/GET response (which
+    // holds the ETag), so this does not trigger network I/O.
+    VSIStatBufL sStat;
+    if (VSIStatExL(m_pszFilename, &sStat,
+                   VSI_STAT_EXISTS_FLAG | VSI_STAT_NATURE_FLAG |
+                       VSI_STAT_SIZE_FLAG) != 0)
+        return std::string();
+
+    std::string osKey(m_pszFilename);
+    osKey += '\n';
+    osKey += std::to_string(static_cast<GUIntBig>(m_nDirOffset));
+    osKey += '\n';
+    osKey += std::to_string(static_cast<GUIntBig>(sStat.st_size));
+    osKey += '\n';
+    osKey += std::to_string(static_cast<GIntBig>(sStat.st_mtime));
+    // Config options that influence the result of the CRS building.
+    osKey += '\n';
+    osKey += CPLGetConfigOption("GTIFF_REPORT_COMPD_CS", "");
+    osKey += '\n';
+    osKey += CPLGetConfigOption("GTIFF_SRS_SOURCE", "");
+    osKey += '\n';
+    osKey += CPLGetConfigOption("GTIFF_LINEAR_UNITS", "");
+    osKey += '\n';
+    osKey += CPLGetConfigOption("GTIFF_IMPORT_FROM_EPSG", "");
+    return osKey;
+}
+
 /************************************************************************/
 /*                      LookForProjectionFromGeoTIFF()                  */
 /************************************************************************/
 
 void GTiffDataset::LookForProjectionFromGeoTIFF()
 {
+    const std::string osCacheKey = GetGeoTIFFCacheKey();
+    if (!osCacheKey.empty())
+    {
+        std::shared_ptr<GTiffGeoTIFFCacheEntry> poEntry;
+        {
+            std::lock_guard<std::mutex> oLock(goGeoTIFFCacheMutex);
+            if (gpoGeoTIFFCache)
+                gpoGeoTIFFCache->tryGet(osCacheKey, poEntry);
+        }
+        if (poEntry)
+        {
+            if (!poEntry->oSRS.IsEmpty())
+            {
+                CPLFree(m_pszXMLFilename);
+                m_pszXMLFilename = nullptr;
+                m_oSRS = poEntry->oSRS;
+            }
+            if (!poEntry->osVertUnit.empty())
+            {
+                CPLFree(m_pszVertUnit);
+                m_pszVertUnit = CPLStrdup(poEntry->osVertUnit.c_str());
+            }
+            if (!poEntry->osAreaOrPoint.empty())
+            {
+                m_oGTiffMDMD.SetMetadataItem(GDALMD_AREA_OR_POINT,
+                                             poEntry->osAreaOrPoint.c_str());
+            }
+            return;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Capture the GeoTIFF projection, if available.                   */
     /* -------------------------------------------------------------------- */
@@ -4195,6 +4546,30 @@ void GTiffDataset::LookForProjectionFromGeoTIFF()
         GTiffDatasetSetAreaOrPointMD(hGTIF, m_oGTiffMDMD);
 
         GTIFFree(hGTIF);
+
+        // Do not cache results that came with warnings, so that they are
+        // emitted again on the next open.
+        if (!osCacheKey.empty() && oSetErrorMsg.empty())
+        {
+            auto poEntry = std::make_shared<GTiffGeoTIFFCacheEntry>();
+            poEntry->oSRS = m_oSRS;
+            if (m_pszVertUnit)
+                poEntry->osVertUnit = m_pszVertUnit;
+            const char *pszAreaOrPoint =
+                m_oGTiffMDMD.GetMetadataItem(GDALMD_AREA_OR_POINT);
+            if (pszAreaOrPoint)
+                poEntry->osAreaOrPoint = pszAreaOrPoint;
+
+            std::lock_guard<std::mutex> oLock(goGeoTIFFCacheMutex);
+            if (!gpoGeoTIFFCache)
+            {
+                const int nCacheSize =
+                    atoi(CPLGetConfigOption("GTIFF_METADATA_CACHE_SIZE", "0"));
+                gpoGeoTIFFCache =
+                    new GTiffGeoTIFFCache(static_cast<size_t>(nCacheSize));
+            }
+            gpoGeoTIFFCache->insert(osCacheKey, poEntry);
+        }
     }
 }
 
@@ -5624,6 +5999,16 @@ CPLErr GTiffDataset::OpenOffset(TIFF *hTIFFIn, toff_t nDirOffsetIn,
                         poBand->m_eBandInterp =
                             GDALGetColorInterpretationByName(pszUnescapedValue);
                     }
+                    else if (EQUAL(pszRole, "block_statistics"))
+                    {
+                        poBand->DeserializeBlockStatistics(pszUnescapedValue);
+                    }
+                    else if (EQUAL(pszRole, "block_statistics_nodata"))
+                    {
+                        poBand->m_bBlockStatisticsHasNoData = true;
+                        poBand->m_dfBlockStatisticsNoData =
+                            CPLAtofM(pszUnescapedValue);
+                    }
                     else
                     {
                         if (bIsXML)
@@ -5650,6 +6035,34 @@ CPLErr GTiffDataset::OpenOffset(TIFF *hTIFFIn, toff_t nDirOffsetIn,
         CPLDestroyXMLNode(psRoot);
     }
 
+    // Keep per-block summaries up to date if the file is modified, or
+    // discard them when we can't.
+    if (eAccess == GA_Update)
+    {
+        bool bHasBlockStatistics = false;
+        for (int i = 0; i < nBands; ++i)
+        {
+            if (!cpl::down_cast<GTiffRasterBand *>(papoBands[i])
+                     ->m_aoBlockStatistics.empty())
+            {
+                bHasBlockStatistics = true;
+                break;
+            }
+        }
+        if (bHasBlockStatistics)
+        {
+            m_bBlockStatistics = CanMaintainBlockStatistics();
+            if (!m_bBlockStatistics)
+            {
+                for (int i = 0; i < nBands; ++i)
+                {
+                    cpl::down_cast<GTiffRasterBand *>(papoBands[i])
+                        ->InvalidateBlockStatistics();
+                }
+            }
+        }
+    }
+
     if (m_bStreamingIn)
     {
         toff_t *panOffsets = nullptr;
@@ -59,6 +59,7 @@
 #include "quant_table_md5sum.h"
 #include "quant_table_md5sum_jpeg9e.h"
 #include "tif_jxl.h"
+#include "tif_qb3.h"
 #include "tifvsi.h"
 #include "xtiffio.h"
 
@@ -331,6 +332,10 @@ CPLErr GTiffDataset::FillEmptyTiles()
                         break;
                     }
                 }
+                else if (m_bBlockStatistics)
+                {
+                    UpdateBlockStatistics(iBlock, pabyData);
+                }
                 nCountBlocksToZero++;
             }
         }
@@ -430,6 +435,8 @@ CPLErr GTiffDataset::FillEmptyTiles()
             {
                 WriteRawStripOrTile(iBlock, pabyRaw,
                                     static_cast<GPtrDiff_t>(nRawSize));
+                if (m_bBlockStatistics)
+                    UpdateBlockStatistics(iBlock, pabyData);
             }
         }
     }
@@ -599,6 +606,128 @@ void GTiffDataset::WriteDealWithLercAndNan(T *pBuffer, int nActualBlockWidth,
     }
 }
 
+/************************************************************************/
+/*                     CanMaintainBlockStatistics()                     */
+/************************************************************************/
+
+// Per-block summaries are computed from the buffers passed to
+// WriteEncodedTile() / WriteEncodedStrip(), so they are only valid if
+// reading back the file returns exactly those values.
+bool GTiffDataset::CanMaintainBlockStatistics() const
+{
+    if (m_poBaseDS != nullptr || m_bStreamingOut || m_bWriteCOGLayout ||
+        m_panMaskOffsetLsb != nullptr || nBands == 0)
+        return false;
+
+    switch (m_nCompression)
+    {
+        case COMPRESSION_JPEG:
+            return false;
+        case COMPRESSION_WEBP:
+            if (!m_bWebPLossless)
+                return false;
+            break;
+        case COMPRESSION_LERC:
+            if (m_dfMaxZError != 0)
+                return false;
+            break;
+#if HAVE_JXL
+        case COMPRESSION_JXL:
+            if (!m_bJXLLossless)
+                return false;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    const auto poBand = cpl::down_cast<GTiffRasterBand *>(papoBands[0]);
+    if (!poBand->IsBaseGTiffClass())
+        return false;
+    const GDALDataType eDT = poBand->GetRasterDataType();
+    switch (eDT)
+    {
+        case GDT_Byte:
+            if (m_nSampleFormat == SAMPLEFORMAT_INT)
+                return false;
+            break;
+        case GDT_Int8:
+        case GDT_UInt16:
+        case GDT_Int16:
+        case GDT_UInt32:
+        case GDT_Int32:
+        case GDT_Float32:
+        case GDT_Float64:
+            break;
+        default:
+            return false;
+    }
+    return m_nBitsPerSample == GDALGetDataTypeSizeBits(eDT);
+}
+
+/************************************************************************/
+/*                        InitBlockStatistics()                         */
+/************************************************************************/
+
+void GTiffDataset::InitBlockStatistics(CSLConstList papszOptions)
+{
+    if (!CPLFetchBool(papszOptions, "BLOCK_STATISTICS", false))
+        return;
+    if (!CanMaintainBlockStatistics())
+    {
+        ReportError(CE_Warning, CPLE_NotSupported,
+                    "BLOCK_STATISTICS=YES is only supported for lossless "
+                    "compression methods, without NBITS, DISCARD_LSB, "
+                    "COPY_SRC_OVERVIEWS or streaming output, and for 8, 16, "
+                    "32 and 64 bit data types. Ignored");
+        return;
+    }
+    if (m_eProfile != GTiffProfile::GDALGEOTIFF)
+    {
+        ReportError(CE_Warning, CPLE_NotSupported,
+                    "BLOCK_STATISTICS=YES requires PROFILE=GDALGeoTIFF. "
+                    "Ignored");
+        return;
+    }
+    m_bBlockStatistics = true;
+}
+
+/************************************************************************/
+/*                       UpdateBlockStatistics()                        */
+/************************************************************************/
+
+void GTiffDataset::UpdateBlockStatistics(int nBlockId, const GByte *pabyData)
+{
+    const int nBlockIdInBand = nBlockId % m_nBlocksPerBand;
+    const int iColumn = nBlockIdInBand % m_nBlocksPerRow;
+    const int iRow = nBlockIdInBand / m_nBlocksPerRow;
+    const int nActualBlockWidth =
+        std::min(m_nBlockXSize, nRasterXSize - iColumn * m_nBlockXSize);
+    const int nActualBlockHeight =
+        std::min(m_nBlockYSize, nRasterYSize - iRow * m_nBlockYSize);
+
+    if (m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+    {
+        cpl::down_cast<GTiffRasterBand *>(
+            papoBands[nBlockId / m_nBlocksPerBand])
+            ->UpdateBlockStatistics(nBlockIdInBand, pabyData,
+                                    nActualBlockWidth, nActualBlockHeight, 1,
+                                    m_nBlockXSize);
+    }
+    else
+    {
+        const int nDTSize = m_nBitsPerSample / 8;
+        for (int i = 0; i < nBands; ++i)
+        {
+            cpl::down_cast<GTiffRasterBand *>(papoBands[i])
+                ->UpdateBlockStatistics(nBlockIdInBand,
+                                        pabyData + i * nDTSize,
+                                        nActualBlockWidth, nActualBlockHeight,
+                                        nBands, m_nBlockXSize * nBands);
+        }
+    }
+}
+
 /************************************************************************/
 /*                        WriteEncodedTile()                            */
 /************************************************************************/
@@ -617,6 +746,9 @@ bool GTiffDataset::WriteEncodedTile(uint32_t tile, GByte *pabyData,
                                        ? nRasterYSize - iRow * m_nBlockYSize
                                        : m_nBlockYSize;
 
+    if (m_bBlockStatistics)
+        UpdateBlockStatistics(tile, pabyData);
+
     /* -------------------------------------------------------------------- */
     /*      Don't write empty blocks in some cases.                         */
     /* -------------------------------------------------------------------- */
@@ -803,6 +935,9 @@ bool GTiffDataset::WriteEncodedStrip(uint32_t strip, GByte *pabyData,
                  static_cast<GUIntBig>(cc));
     }
 
+    if (m_bBlockStatistics)
+        UpdateBlockStatistics(strip, pabyData);
+
     /* -------------------------------------------------------------------- */
     /*      Don't write empty blocks in some cases.                         */
     /* -------------------------------------------------------------------- */
@@ -900,13 +1035,35 @@ bool GTiffDataset::WriteEncodedStrip(uint32_t strip, GByte *pabyData,
 void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
                                           CSLConstList papszOptions)
 {
-    // Raster == tile, then no need for threads
-    if (m_nBlockXSize == nRasterXSize && m_nBlockYSize == nRasterYSize)
-        return;
-
     const char *pszValue = CSLFetchNameValue(papszOptions, "NUM_THREADS");
     if (pszValue == nullptr)
         pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+
+    // Raster == tile, then no need for threads
+    if (m_nBlockXSize == nRasterXSize && m_nBlockYSize == nRasterYSize)
+    {
+#if HAVE_JXL
+        // ... at the block level. But libjxl can use several threads to
+        // encode or decode a single block.
+        if (pszValue && m_nCompression == COMPRESSION_JXL)
+        {
+            int nThreads =
+                EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+            if (nThreads > 1)
+            {
+                m_oCompressThreadReservation =
+                    GDALThreadReservation(std::min(nThreads, 1024));
+                m_nJXLNumThreads =
+                    m_oCompressThreadReservation.GetThreadCount();
+                CPLDebug("GTiff", "Using up to %d threads in libjxl",
+                         m_nJXLNumThreads);
+                TIFFSetField(m_hTIFF, TIFFTAG_JXL_NUM_THREADS,
+                             m_nJXLNumThreads);
+            }
+        }
+#endif
+        return;
+    }
     if (pszValue)
     {
         int nThreads =
@@ -918,6 +1075,15 @@ void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
             if ((bUpdateMode && m_nCompression != COMPRESSION_NONE) ||
                 (nBands >= 1 && IsMultiThreadedReadCompatible()))
             {
+                if (bUpdateMode && m_nCompression != COMPRESSION_NONE)
+                {
+                    // Compression threads are used until the dataset is
+                    // closed. Borrow them from the process-wide budget.
+                    m_oCompressThreadReservation =
+                        GDALThreadReservation(nThreads);
+                    nThreads = m_oCompressThreadReservation.GetThreadCount();
+                }
+
                 CPLDebug("GTiff",
                          "Using up to %d threads for compression/decompression",
                          nThreads);
@@ -928,10 +1094,23 @@ void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
 
                 if (m_poCompressQueue != nullptr)
                 {
-                    // Add a margin of an extra job w.r.t thread number
-                    // so as to optimize compression time (enables the main
-                    // thread to do boring I/O while all CPUs are working).
-                    m_asCompressionJobs.resize(nThreads + 1);
+                    // Add a margin of extra jobs w.r.t thread number so as
+                    // to optimize compression time: the main thread writes
+                    // the compressed blocks in order, and queues new ones,
+                    // while all CPUs are working. The number of pending
+                    // blocks is bounded by a fraction of the block cache.
+                    const GIntBig nBlockBytes =
+                        static_cast<GIntBig>(m_nBlockXSize) * m_nBlockYSize *
+                        ((m_nBitsPerSample + 7) / 8) *
+                        (m_nPlanarConfig == PLANARCONFIG_CONTIG ? nBands : 1);
+                    int nJobs = 2 * nThreads;
+                    if (nBlockBytes > 0)
+                    {
+                        nJobs = static_cast<int>(std::min<GIntBig>(
+                            nJobs, GDALGetCacheMax64() / 4 / nBlockBytes));
+                    }
+                    nJobs = std::max(nJobs, nThreads + 1);
+                    m_asCompressionJobs.resize(nJobs);
                     memset(&m_asCompressionJobs[0], 0,
                            m_asCompressionJobs.size() *
                                sizeof(GTiffCompressionJob));
@@ -1271,6 +1450,30 @@ void GTiffDataset::WaitCompletionForJobIdx(int i)
     oQueue.pop();
 }
 
+/************************************************************************/
+/*                      WriteReadyCompressionJobs()                     */
+/************************************************************************/
+
+// Write, in submission order, the compressed blocks at the head of the
+// queue whose job is completed. Does not wait for running jobs.
+void GTiffDataset::WriteReadyCompressionJobs()
+{
+    auto poMainDS = m_poBaseDS ? m_poBaseDS : this;
+    auto &oQueue = poMainDS->m_asQueueJobIdx;
+    auto &asJobs = poMainDS->m_asCompressionJobs;
+    auto &mutex = poMainDS->m_oCompressThreadPoolMutex;
+
+    while (!oQueue.empty())
+    {
+        {
+            std::lock_guard oLock(mutex);
+            if (!asJobs[oQueue.front()].bReady)
+                break;
+        }
+        WaitCompletionForJobIdx(oQueue.front());
+    }
+}
+
 /************************************************************************/
 /*                        WaitCompletionForBlock()                      */
 /************************************************************************/
@@ -1365,6 +1568,7 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
                                 m_nCompression == COMPRESSION_ZSTD ||
                                 m_nCompression == COMPRESSION_LERC ||
                                 m_nCompression == COMPRESSION_JXL ||
+                                m_nCompression == COMPRESSION_QB3 ||
                                 m_nCompression == COMPRESSION_WEBP ||
                                 m_nCompression == COMPRESSION_JPEG))
     {
@@ -1399,6 +1603,11 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
     auto &oQueue = poMainDS->m_asQueueJobIdx;
     auto &asJobs = poMainDS->m_asCompressionJobs;
 
+    // Write the blocks whose compression is already finished, so that
+    // I/O overlaps with the compression of the next ones, instead of
+    // waiting for the queue to be full.
+    WriteReadyCompressionJobs();
+
     int nNextCompressionJobAvail = -1;
 
     if (oQueue.size() == asJobs.size())
@@ -4161,6 +4370,28 @@ bool GTiffDataset::WriteMetadata(GDALDataset *poSrcDS, TIFF *l_hTIFF,
             assert(poSrcBandGTiff);
             WriteMDMetadata(&poSrcBandGTiff->m_oGTiffMDMD, l_hTIFF, &psRoot,
                             &psTail, nBand, eProfile);
+
+            if (!poSrcBandGTiff->m_aoBlockStatistics.empty() &&
+                eProfile == GTiffProfile::GDALGEOTIFF)
+            {
+                const std::string osBlockStats =
+                    poSrcBandGTiff->SerializeBlockStatistics();
+                if (!osBlockStats.empty())
+                {
+                    AppendMetadataItem(&psRoot, &psTail, "BLOCK_STATISTICS",
+                                       osBlockStats.c_str(), nBand,
+                                       "block_statistics", "");
+                    if (poSrcBandGTiff->m_bBlockStatisticsHasNoData)
+                    {
+                        AppendMetadataItem(
+                            &psRoot, &psTail, "BLOCK_STATISTICS_NODATA",
+                            CPLSPrintf(
+                                "%.17g",
+                                poSrcBandGTiff->m_dfBlockStatisticsNoData),
+                            nBand, "block_statistics_nodata", "");
+                    }
+                }
+            }
         }
         else
         {
@@ -5231,6 +5462,32 @@ TIFF *GTiffDataset::CreateLL(const char *pszFilename, int nXSize, int nYSize,
     }
 #endif
 
+#ifdef HAVE_QB3
+    if (l_nCompression == COMPRESSION_QB3)
+    {
+        // Reflects tif_qb3's GetQB3DataType()
+        if (eType != GDT_Byte && eType != GDT_UInt16 && eType != GDT_Int16 &&
+            eType != GDT_UInt32 && eType != GDT_Int32)
+        {
+            ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
+                        "Data type %s not supported for QB3 compression. Only "
+                        "Byte, UInt16, Int16, UInt32, Int32 are supported",
+                        GDALGetDataTypeName(eType));
+            return nullptr;
+        }
+
+        if (l_nBitsPerSample != GDALGetDataTypeSizeBits(eType))
+        {
+            ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
+                        "Bits per sample=%d not supported for QB3 compression. "
+                        "Only %d is supported for %s data type.",
+                        l_nBitsPerSample, GDALGetDataTypeSizeBits(eType),
+                        GDALGetDataTypeName(eType));
+            return nullptr;
+        }
+    }
+#endif
+
     int nPredictor = PREDICTOR_NONE;
     pszValue = CSLFetchNameValue(papszParamList, "PREDICTOR");
     if (pszValue != nullptr)
@@ -6446,6 +6703,7 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     }
 
     poDS->GetDiscardLsbOption(papszParamList);
+    poDS->InitBlockStatistics(papszParamList);
 
     if (poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG && l_nBands != 1)
         poDS->SetMetadataItem("INTERLEAVE", "PIXEL", "IMAGE_STRUCTURE");
@@ -7785,6 +8043,8 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
         }
     }
 
+    poDS->InitBlockStatistics(papszOptions);
+
     /* -------------------------------------------------------------------- */
     /*      Do we want to ensure all blocks get written out on close to     */
     /*      avoid sparse files?                                             */
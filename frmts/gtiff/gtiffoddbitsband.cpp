@@ -33,6 +33,51 @@
 #include "gtiffdataset.h"
 #include "tiffio.h"
 
+/************************************************************************/
+/*                           ExtractBitsMSB()                           */
+/************************************************************************/
+
+// Returns the value of the nBits (<= 32) bits starting at bit iBitOffset of
+// pabyData, most significant bit first as in TIFF. Only the bytes that
+// contain the value are accessed.
+static inline unsigned ExtractBitsMSB(const GByte *pabyData,
+                                      GUIntBig iBitOffset, unsigned nBits)
+{
+    const GByte *pabyFirst = pabyData + (iBitOffset >> 3);
+    const unsigned nShift = static_cast<unsigned>(iBitOffset & 7);
+    const unsigned nBytes = (nShift + nBits + 7) / 8;
+    GUInt64 nWord = 0;
+    for (unsigned i = 0; i < nBytes; ++i)
+        nWord = (nWord << 8) | pabyFirst[i];
+    return static_cast<unsigned>((nWord >> (nBytes * 8 - nShift - nBits)) &
+                                 ((static_cast<GUInt64>(1) << nBits) - 1));
+}
+
+/************************************************************************/
+/*                            StoreBitsMSB()                            */
+/************************************************************************/
+
+// Overwrites the nBits (<= 32) bits starting at bit iBitOffset of pabyData
+// with nValue, most significant bit first. Other bits are preserved.
+static inline void StoreBitsMSB(GByte *pabyData, GUIntBig iBitOffset,
+                                unsigned nBits, unsigned nValue)
+{
+    GByte *pabyFirst = pabyData + (iBitOffset >> 3);
+    const unsigned nShift = static_cast<unsigned>(iBitOffset & 7);
+    const unsigned nBytes = (nShift + nBits + 7) / 8;
+    const unsigned nTrailingBits = nBytes * 8 - nShift - nBits;
+    GUInt64 nMask = ((static_cast<GUInt64>(1) << nBits) - 1) << nTrailingBits;
+    GUInt64 nWord = static_cast<GUInt64>(nValue) << nTrailingBits;
+    for (unsigned i = nBytes; i > 0; --i)
+    {
+        pabyFirst[i - 1] = static_cast<GByte>(
+            (pabyFirst[i - 1] & ~static_cast<GByte>(nMask)) |
+            static_cast<GByte>(nWord));
+        nMask >>= 8;
+        nWord >>= 8;
+    }
+}
+
 /************************************************************************/
 /*                           GTiffOddBitsBand()                         */
 /************************************************************************/
@@ -291,14 +336,9 @@ CPLErr GTiffOddBitsBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
                 }
                 else
                 {
-                    for (int iBit = 0; iBit < m_poGDS->m_nBitsPerSample; ++iBit)
-                    {
-                        if (nInWord &
-                            (1 << (m_poGDS->m_nBitsPerSample - 1 - iBit)))
-                            m_poGDS->m_pabyBlockBuf[iBitOffset >> 3] |=
-                                (0x80 >> (iBitOffset & 7));
-                        ++iBitOffset;
-                    }
+                    StoreBitsMSB(m_poGDS->m_pabyBlockBuf, iBitOffset,
+                                 m_poGDS->m_nBitsPerSample, nInWord);
+                    iBitOffset += m_poGDS->m_nBitsPerSample;
                 }
             }
         }
@@ -489,25 +529,11 @@ CPLErr GTiffOddBitsBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
                 }
                 else
                 {
-                    for (int iBit = 0; iBit < m_poGDS->m_nBitsPerSample; ++iBit)
-                    {
-                        // TODO(schwehr): Revisit this block.
-                        if (nInWord &
-                            (1 << (m_poGDS->m_nBitsPerSample - 1 - iBit)))
-                        {
-                            m_poGDS->m_pabyBlockBuf[iBitOffset >> 3] |=
-                                (0x80 >> (iBitOffset & 7));
-                        }
-                        else
-                        {
-                            // We must explicitly unset the bit as we
-                            // may update an existing block.
-                            m_poGDS->m_pabyBlockBuf[iBitOffset >> 3] &=
-                                ~(0x80 >> (iBitOffset & 7));
-                        }
-
-                        ++iBitOffset;
-                    }
+                    // Bits of other bands are preserved, as we may update an
+                    // existing block.
+                    StoreBitsMSB(m_poGDS->m_pabyBlockBuf, iBitOffset,
+                                 m_poGDS->m_nBitsPerSample, nInWord);
+                    iBitOffset += m_poGDS->m_nBitsPerSample;
                 }
 
                 iBitOffset =
@@ -585,6 +611,34 @@ static void ExpandPacked8ToByte255(const GByte *const CPL_RESTRICT pabySrc,
     }
 }
 
+// Expands a byte aligned line of nValues 2 or 4 bit samples, most
+// significant bits first, to one byte per sample. The loop on whole bytes
+// is branch-free and gets vectorized by compilers.
+template <int NBITS>
+static void ExpandPackedSubByteToByte(const GByte *const CPL_RESTRICT pabySrc,
+                                      GByte *const CPL_RESTRICT pabyDest,
+                                      int nValues)
+{
+    constexpr int VALUES_PER_BYTE = 8 / NBITS;
+    constexpr unsigned MASK = (1U << NBITS) - 1;
+    const int nFullBytes = nValues / VALUES_PER_BYTE;
+    for (int i = 0; i < nFullBytes; ++i)
+    {
+        const unsigned nByte = pabySrc[i];
+        for (int j = 0; j < VALUES_PER_BYTE; ++j)
+        {
+            pabyDest[i * VALUES_PER_BYTE + j] =
+                static_cast<GByte>((nByte >> (8 - NBITS * (j + 1))) & MASK);
+        }
+    }
+    for (int k = nFullBytes * VALUES_PER_BYTE; k < nValues; ++k)
+    {
+        const int j = k % VALUES_PER_BYTE;
+        pabyDest[k] = static_cast<GByte>(
+            (pabySrc[nFullBytes] >> (8 - NBITS * (j + 1))) & MASK);
+    }
+}
+
 CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                     void *pImage)
 
@@ -740,7 +794,25 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         {
             GPtrDiff_t iBitOffset = iBandBitOffset + iY * nBitsPerLine;
 
-            for (int iX = 0; iX < nBlockXSize; ++iX)
+            int iX = 0;
+            if (iPixelBitSkip == 12)
+            {
+                // Packed samples: decode pairs from groups of 3 bytes.
+                const GByte *pabySrc =
+                    m_poGDS->m_pabyBlockBuf + (iBitOffset >> 3);
+                GUInt16 *panDst = static_cast<GUInt16 *>(pImage) + iPixel;
+                for (; iX + 1 < nBlockXSize; iX += 2, pabySrc += 3)
+                {
+                    panDst[iX] = static_cast<GUInt16>((pabySrc[0] << 4) |
+                                                      (pabySrc[1] >> 4));
+                    panDst[iX + 1] = static_cast<GUInt16>(
+                        ((pabySrc[1] & 0xf) << 8) | pabySrc[2]);
+                }
+                iPixel += iX;
+                iBitOffset += static_cast<GPtrDiff_t>(iX) * 12;
+            }
+
+            for (; iX < nBlockXSize; ++iX)
             {
                 const auto iByte = iBitOffset >> 3;
 
@@ -858,6 +930,25 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 }
             }
         }
+        else if ((nBitsPerSample == 2 || nBitsPerSample == 4) &&
+                 iPixelBitSkip == nBitsPerSample && eDataType == GDT_Byte)
+        {
+            // Packed samples: lines start on a byte boundary.
+            for (int iY = 0; iY < nBlockYSize; ++iY)
+            {
+                const GByte *pabySrc =
+                    m_pabyBlockBuf + static_cast<GPtrDiff_t>(
+                                         iY * (nBitsPerLine / 8));
+                GByte *pabyDest = static_cast<GByte *>(pImage) + iPixel;
+                if (nBitsPerSample == 2)
+                    ExpandPackedSubByteToByte<2>(pabySrc, pabyDest,
+                                                 nBlockXSize);
+                else
+                    ExpandPackedSubByteToByte<4>(pabySrc, pabyDest,
+                                                 nBlockXSize);
+                iPixel += nBlockXSize;
+            }
+        }
         else
         {
             for (unsigned iY = 0; iY < static_cast<unsigned>(nBlockYSize); ++iY)
@@ -867,17 +958,10 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 for (unsigned iX = 0; iX < static_cast<unsigned>(nBlockXSize);
                      ++iX)
                 {
-                    unsigned nOutWord = 0;
-
-                    for (unsigned iBit = 0; iBit < nBitsPerSample; ++iBit)
-                    {
-                        if (m_pabyBlockBuf[iBitOffset >> 3] &
-                            (0x80 >> (iBitOffset & 7)))
-                            nOutWord |= (1 << (nBitsPerSample - 1 - iBit));
-                        ++iBitOffset;
-                    }
-
-                    iBitOffset = iBitOffset + iPixelBitSkip - nBitsPerSample;
+                    const unsigned nOutWord =
+                        ExtractBitsMSB(m_pabyBlockBuf, iBitOffset,
+                                       nBitsPerSample);
+                    iBitOffset += iPixelBitSkip;
 
                     if (eDataType == GDT_Byte)
                     {
@@ -315,6 +315,7 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     BufferedDataFreer bufferedDataFreer;
 
     if (m_poGDS->eAccess == GA_ReadOnly && eRWFlag == GF_Read &&
+        m_poGDS->m_nMultiWindowBatchCounter == 0 &&
         m_poGDS->HasOptimizedReadMultiRange())
     {
         if (bCanUseMultiThreadedRead &&
@@ -35,6 +35,9 @@
 #include "gtiff.h"
 
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 /************************************************************************/
 /* ==================================================================== */
@@ -44,6 +47,17 @@
 
 class GTiffDataset;
 
+// Summary of the valid pixel values of a block, maintained when the
+// BLOCK_STATISTICS creation option is set.
+struct GTiffBlockStatistics
+{
+    double dfValidCount = -1;  // Negative when unknown
+    double dfMin = 0;
+    double dfMax = 0;
+    double dfMean = 0;
+    double dfM2 = 0;  // Sum of square of differences to the mean
+};
+
 class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
 {
     CPL_DISALLOW_COPY_ASSIGN(GTiffRasterBand)
@@ -58,6 +72,18 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     std::set<GTiffRasterBand **> m_aSetPSelf{};
     bool m_bHaveOffsetScale = false;
 
+    std::vector<GTiffBlockStatistics> m_aoBlockStatistics{};
+    bool m_bBlockStatisticsHasNoData = false;
+    double m_dfBlockStatisticsNoData = 0;
+
+    void UpdateBlockStatistics(int nBlockIdInBand, const void *pData,
+                               int nXCheck, int nYCheck, int nPixelStride,
+                               int nLineStride);
+    void InvalidateBlockStatistics();
+    std::string SerializeBlockStatistics() const;
+    void DeserializeBlockStatistics(const char *pszValue);
+    bool MergeBlockStatistics(GTiffBlockStatistics &sStats);
+
     int DirectIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
                  int nYSize, void *pData, int nBufXSize, int nBufYSize,
                  GDALDataType eBufType, GSpacing nPixelSpace,
@@ -72,6 +98,7 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     void *CacheMultiRange(int nXOff, int nYOff, int nXSize, int nYSize,
                           int nBufXSize, int nBufYSize,
                           GDALRasterIOExtraArg *psExtraArg);
+    void *CacheMultiRange(const std::vector<std::pair<int, int>> &aoBlocks);
 
   protected:
     GTiffDataset *m_poGDS = nullptr;
@@ -115,6 +142,11 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
                                        int nYSize, int nMaskFlagStop,
                                        double *pdfDataPct) override;
 
+    virtual CPLErr IReadMultiWindow(int nWindowCount,
+                                    const GDALRasterIOWindow *pasWindows,
+                                    GDALDataType eBufType,
+                                    GDALRasterIOExtraArg *psExtraArg) override;
+
     virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                              int nXSize, int nYSize, void *pData, int nBufXSize,
                              int nBufYSize, GDALDataType eBufType,
@@ -177,6 +209,11 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
                                        int *pnBuckets, GUIntBig **ppanHistogram,
                                        int bForce, GDALProgressFunc,
                                        void *pProgressData) override final;
+
+    CPLErr ComputeStatistics(int bApproxOK, double *pdfMin, double *pdfMax,
+                             double *pdfMean, double *pdfStdDev,
+                             GDALProgressFunc, void *pProgressData) override;
+    CPLErr ComputeRasterMinMax(int bApproxOK, double *adfMinMax) override;
 };
 
 #endif  //  GTIFFRASTERBAND_H_INCLUDED
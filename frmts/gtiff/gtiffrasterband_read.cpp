@@ -32,6 +32,7 @@
 #include "gtiffjpegoverviewds.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <set>
@@ -83,6 +84,184 @@ CPLErr GTiffRasterBand::GetDefaultHistogram(
                                                   pfnProgress, pProgressData);
 }
 
+/************************************************************************/
+/*                    DeserializeBlockStatistics()                      */
+/************************************************************************/
+
+// Reverse of SerializeBlockStatistics()
+void GTiffRasterBand::DeserializeBlockStatistics(const char *pszValue)
+{
+    m_aoBlockStatistics.clear();
+    std::string osDecoded(pszValue);
+    const int nBytes = CPLBase64DecodeInPlace(
+        reinterpret_cast<GByte *>(osDecoded.empty() ? nullptr : &osDecoded[0]));
+    constexpr int VALUES_PER_BLOCK = 5;
+    if (nBytes < 0 ||
+        static_cast<size_t>(nBytes) !=
+            static_cast<size_t>(m_poGDS->m_nBlocksPerBand) * VALUES_PER_BLOCK *
+                sizeof(double))
+    {
+        CPLDebug("GTiff",
+                 "Ignoring BLOCK_STATISTICS of band %d: inconsistent size",
+                 nBand);
+        return;
+    }
+    m_aoBlockStatistics.resize(m_poGDS->m_nBlocksPerBand);
+    for (size_t i = 0; i < m_aoBlockStatistics.size(); ++i)
+    {
+        double adfValues[VALUES_PER_BLOCK];
+        memcpy(adfValues, osDecoded.data() + i * sizeof(adfValues),
+               sizeof(adfValues));
+        for (double &dfVal : adfValues)
+            CPL_LSBPTR64(&dfVal);
+        auto &sStats = m_aoBlockStatistics[i];
+        sStats.dfValidCount = adfValues[0];
+        sStats.dfMin = adfValues[1];
+        sStats.dfMax = adfValues[2];
+        sStats.dfMean = adfValues[3];
+        sStats.dfM2 = adfValues[4];
+    }
+}
+
+/************************************************************************/
+/*                       MergeBlockStatistics()                         */
+/************************************************************************/
+
+// Merges the per-block summaries into statistics for the whole band.
+// Returns false if they are missing, incomplete or cannot be trusted given
+// the current nodata value and mask of the band.
+bool GTiffRasterBand::MergeBlockStatistics(GTiffBlockStatistics &sStats)
+{
+    if (!IsBaseGTiffClass() || m_aoBlockStatistics.empty())
+        return false;
+
+    if (m_poGDS->eAccess == GA_Update)
+    {
+        // Make sure that pending dirty blocks have been accounted for.
+        m_poGDS->FlushCacheInternal(false, false);
+    }
+
+    if (m_aoBlockStatistics.size() !=
+            static_cast<size_t>(m_poGDS->m_nBlocksPerBand) ||
+        (eDataType == GDT_Byte &&
+         m_poGDS->m_nSampleFormat == SAMPLEFORMAT_INT) ||
+        m_poGDS->m_bNoDataSetAsInt64 || m_poGDS->m_bNoDataSetAsUInt64)
+    {
+        return false;
+    }
+
+    int bHasNoData = FALSE;
+    const double dfNoData = GetNoDataValue(&bHasNoData);
+    const bool bValidNoData = bHasNoData && !std::isnan(dfNoData);
+    if (bValidNoData != m_bBlockStatisticsHasNoData ||
+        (bValidNoData && dfNoData != m_dfBlockStatisticsNoData))
+    {
+        return false;
+    }
+    if (!bValidNoData)
+    {
+        // Statistics computed by GDALRasterBand take the mask band into
+        // account, unless it is an alpha band.
+        const int l_nMaskFlags = GetMaskFlags();
+        if (l_nMaskFlags != GMF_ALL_VALID && l_nMaskFlags != GMF_NODATA &&
+            GetColorInterpretation() != GCI_AlphaBand)
+        {
+            return false;
+        }
+    }
+
+    sStats = GTiffBlockStatistics();
+    sStats.dfValidCount = 0;
+    for (const auto &sBlockStats : m_aoBlockStatistics)
+    {
+        if (sBlockStats.dfValidCount < 0)
+            return false;
+        if (sBlockStats.dfValidCount == 0)
+            continue;
+        if (sStats.dfValidCount == 0)
+        {
+            sStats = sBlockStats;
+            continue;
+        }
+        // Chan et al. formula for combining partial variances
+        const double dfCount = sStats.dfValidCount + sBlockStats.dfValidCount;
+        const double dfDelta = sBlockStats.dfMean - sStats.dfMean;
+        sStats.dfMean += dfDelta * sBlockStats.dfValidCount / dfCount;
+        sStats.dfM2 += sBlockStats.dfM2 + dfDelta * dfDelta *
+                                              sStats.dfValidCount *
+                                              sBlockStats.dfValidCount /
+                                              dfCount;
+        sStats.dfMin = std::min(sStats.dfMin, sBlockStats.dfMin);
+        sStats.dfMax = std::max(sStats.dfMax, sBlockStats.dfMax);
+        sStats.dfValidCount = dfCount;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         ComputeStatistics()                          */
+/************************************************************************/
+
+CPLErr GTiffRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
+                                          double *pdfMax, double *pdfMean,
+                                          double *pdfStdDev,
+                                          GDALProgressFunc pfnProgress,
+                                          void *pProgressData)
+{
+    m_poGDS->LoadGeoreferencingAndPamIfNeeded();
+
+    GTiffBlockStatistics sStats;
+    if (!MergeBlockStatistics(sStats) || !(sStats.dfValidCount > 0))
+    {
+        return GDALPamRasterBand::ComputeStatistics(bApproxOK, pdfMin, pdfMax,
+                                                    pdfMean, pdfStdDev,
+                                                    pfnProgress, pProgressData);
+    }
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+    if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
+    {
+        ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    // The summaries are exact, whatever bApproxOK.
+    const double dfStdDev = sqrt(sStats.dfM2 / sStats.dfValidCount);
+    if (GetMetadataItem("STATISTICS_APPROXIMATE"))
+        SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
+    SetStatistics(sStats.dfMin, sStats.dfMax, sStats.dfMean, dfStdDev);
+    SetValidPercent(static_cast<GUIntBig>(nRasterXSize) * nRasterYSize,
+                    static_cast<GUIntBig>(sStats.dfValidCount));
+
+    if (pdfMin)
+        *pdfMin = sStats.dfMin;
+    if (pdfMax)
+        *pdfMax = sStats.dfMax;
+    if (pdfMean)
+        *pdfMean = sStats.dfMean;
+    if (pdfStdDev)
+        *pdfStdDev = dfStdDev;
+    return CE_None;
+}
+
+/************************************************************************/
+/*                        ComputeRasterMinMax()                         */
+/************************************************************************/
+
+CPLErr GTiffRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
+{
+    m_poGDS->LoadGeoreferencingAndPamIfNeeded();
+
+    GTiffBlockStatistics sStats;
+    if (!MergeBlockStatistics(sStats) || !(sStats.dfValidCount > 0))
+        return GDALPamRasterBand::ComputeRasterMinMax(bApproxOK, adfMinMax);
+
+    adfMinMax[0] = sStats.dfMin;
+    adfMinMax[1] = sStats.dfMax;
+    return CE_None;
+}
+
 /************************************************************************/
 /*                           DirectIO()                                 */
 /************************************************************************/
@@ -381,6 +560,11 @@ CPLVirtualMem *GTiffRasterBand::GetVirtualMemAutoInternal(GDALRWFlag eRWFlag,
                                                           GIntBig *pnLineSpace,
                                                           char **papszOptions)
 {
+    // Per-block summaries cannot be maintained when writing through a
+    // memory mapping.
+    if (eRWFlag == GF_Write)
+        InvalidateBlockStatistics();
+
     int nLineSize = nBlockXSize * GDALGetDataTypeSizeBytes(eDataType);
     if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
         nLineSize *= m_poGDS->nBands;
@@ -636,7 +820,6 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                                        int nYSize, int nBufXSize, int nBufYSize,
                                        GDALRasterIOExtraArg *psExtraArg)
 {
-    void *pBufferedData = nullptr;
     // Same logic as in GDALRasterBand::IRasterIO()
     double dfXOff = nXOff;
     double dfYOff = nYOff;
@@ -669,6 +852,22 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                      (nBufYSize - 1 + 0.5) * dfSrcYInc + dfYOff + EPS)) /
         nBlockYSize;
 
+    std::vector<std::pair<int, int>> aoBlocks;
+    for (int iY = nBlockY1; iY <= nBlockY2; iY++)
+    {
+        for (int iX = nBlockX1; iX <= nBlockX2; iX++)
+            aoBlocks.emplace_back(iX, iY);
+    }
+    return CacheMultiRange(aoBlocks);
+}
+
+/** Precache the strips/tiles of the (iX, iY) blocks of aoBlocks, that
+ * are not already in the block cache, with a single multi-range request.
+ */
+void *GTiffRasterBand::CacheMultiRange(
+    const std::vector<std::pair<int, int>> &aoBlocks)
+{
+    void *pBufferedData = nullptr;
     const int nBlockCount = nBlocksPerRow * nBlocksPerColumn;
 
     struct StrileData
@@ -936,56 +1135,54 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
         const unsigned int nMaxRawBlockCacheSize = atoi(
             CPLGetConfigOption("GDAL_MAX_RAW_BLOCK_CACHE_SIZE", "10485760"));
         bool bGoOn = true;
-        for (int iY = nBlockY1; bGoOn && iY <= nBlockY2; iY++)
+        for (size_t i = 0; bGoOn && i < aoBlocks.size(); i++)
         {
-            for (int iX = nBlockX1; bGoOn && iX <= nBlockX2; iX++)
+            const int iX = aoBlocks[i].first;
+            const int iY = aoBlocks[i].second;
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
+            if (poBlock != nullptr)
             {
-                GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
-                if (poBlock != nullptr)
-                {
-                    poBlock->DropLock();
-                    continue;
-                }
-                int nBlockId = iX + iY * nBlocksPerRow;
-                if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
-                    nBlockId += (nBand - 1) * m_poGDS->m_nBlocksPerBand;
-                vsi_l_offset nOffset = 0;
-                vsi_l_offset nSize = 0;
-
-                if ((m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG ||
-                     m_poGDS->nBands == 1) &&
-                    !m_poGDS->m_bStreamingIn &&
-                    m_poGDS->m_bBlockOrderRowMajor &&
-                    m_poGDS->m_bLeaderSizeAsUInt4)
+                poBlock->DropLock();
+                continue;
+            }
+            int nBlockId = iX + iY * nBlocksPerRow;
+            if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+                nBlockId += (nBand - 1) * m_poGDS->m_nBlocksPerBand;
+            vsi_l_offset nOffset = 0;
+            vsi_l_offset nSize = 0;
+
+            if ((m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG ||
+                 m_poGDS->nBands == 1) &&
+                !m_poGDS->m_bStreamingIn && m_poGDS->m_bBlockOrderRowMajor &&
+                m_poGDS->m_bLeaderSizeAsUInt4)
+            {
+                OptimizedRetrievalOfOffsetSize(nBlockId, nOffset, nSize,
+                                               nTotalSize,
+                                               nMaxRawBlockCacheSize);
+            }
+            else
+            {
+                CPL_IGNORE_RET_VAL(
+                    m_poGDS->IsBlockAvailable(nBlockId, &nOffset, &nSize));
+            }
+            if (nSize)
+            {
+                if (nTotalSize + nSize < nMaxRawBlockCacheSize)
                 {
-                    OptimizedRetrievalOfOffsetSize(nBlockId, nOffset, nSize,
-                                                   nTotalSize,
-                                                   nMaxRawBlockCacheSize);
+#ifdef DEBUG_VERBOSE
+                    CPLDebug("GTiff",
+                             "Precaching for block (%d, %d), " CPL_FRMT_GUIB
+                             "-" CPL_FRMT_GUIB,
+                             iX, iY, nOffset,
+                             nOffset + static_cast<size_t>(nSize) - 1);
+#endif
+                    aOffsetSize.push_back(
+                        std::pair(nOffset, static_cast<size_t>(nSize)));
+                    nTotalSize += static_cast<size_t>(nSize);
                 }
                 else
                 {
-                    CPL_IGNORE_RET_VAL(
-                        m_poGDS->IsBlockAvailable(nBlockId, &nOffset, &nSize));
-                }
-                if (nSize)
-                {
-                    if (nTotalSize + nSize < nMaxRawBlockCacheSize)
-                    {
-#ifdef DEBUG_VERBOSE
-                        CPLDebug("GTiff",
-                                 "Precaching for block (%d, %d), " CPL_FRMT_GUIB
-                                 "-" CPL_FRMT_GUIB,
-                                 iX, iY, nOffset,
-                                 nOffset + static_cast<size_t>(nSize) - 1);
-#endif
-                        aOffsetSize.push_back(
-                            std::pair(nOffset, static_cast<size_t>(nSize)));
-                        nTotalSize += static_cast<size_t>(nSize);
-                    }
-                    else
-                    {
-                        bGoOn = false;
-                    }
+                    bGoOn = false;
                 }
             }
         }
@@ -1063,9 +1260,7 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                         // Retry without optimization
                         CPLFree(pBufferedData);
                         m_poGDS->m_bLeaderSizeAsUInt4 = false;
-                        void *pRet =
-                            CacheMultiRange(nXOff, nYOff, nXSize, nYSize,
-                                            nBufXSize, nBufYSize, psExtraArg);
+                        void *pRet = CacheMultiRange(aoBlocks);
                         m_poGDS->m_bLeaderSizeAsUInt4 = true;
                         return pRet;
                     }
@@ -1080,6 +1275,86 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
     return pBufferedData;
 }
 
+/************************************************************************/
+/*                          IReadMultiWindow()                          */
+/************************************************************************/
+
+CPLErr GTiffRasterBand::IReadMultiWindow(int nWindowCount,
+                                         const GDALRasterIOWindow *pasWindows,
+                                         GDALDataType eBufType,
+                                         GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_poGDS->eAccess != GA_ReadOnly ||
+        m_poGDS->m_eVirtualMemIOUsage != GTiffDataset::VirtualMemIOEnum::NO ||
+        m_poGDS->m_bDirectIO || !m_poGDS->HasOptimizedReadMultiRange())
+    {
+        return GDALRasterBand::IReadMultiWindow(nWindowCount, pasWindows,
+                                                eBufType, psExtraArg);
+    }
+
+    // Collect the blocks intersecting the full resolution windows (others
+    // may be served by overviews), and fetch all of them with a single
+    // multi-range request. The per-window RasterIO() calls below will then
+    // be served from those cached ranges.
+    std::set<std::pair<int, int>> oSetBlocks;
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        if (sWindow.nXSize != sWindow.nBufXSize ||
+            sWindow.nYSize != sWindow.nBufYSize || sWindow.nXSize == 0 ||
+            sWindow.nYSize == 0)
+        {
+            continue;
+        }
+        const int nBlockX1 = sWindow.nXOff / nBlockXSize;
+        const int nBlockY1 = sWindow.nYOff / nBlockYSize;
+        const int nBlockX2 = (sWindow.nXOff + sWindow.nXSize - 1) / nBlockXSize;
+        const int nBlockY2 = (sWindow.nYOff + sWindow.nYSize - 1) / nBlockYSize;
+        for (int iY = nBlockY1; iY <= nBlockY2; iY++)
+        {
+            for (int iX = nBlockX1; iX <= nBlockX2; iX++)
+                oSetBlocks.insert(std::pair(iY, iX));
+        }
+    }
+    std::vector<std::pair<int, int>> aoBlocks;
+    aoBlocks.reserve(oSetBlocks.size());
+    for (const auto &oBlock : oSetBlocks)
+        aoBlocks.emplace_back(oBlock.second, oBlock.first);
+
+    GTiffRasterBand *poBandForCache = this;
+    if (!m_poGDS->m_bStreamingIn && m_poGDS->m_bBlockOrderRowMajor &&
+        m_poGDS->m_bLeaderSizeAsUInt4 &&
+        m_poGDS->m_bMaskInterleavedWithImagery && m_poGDS->m_poImageryDS)
+    {
+        poBandForCache = cpl::down_cast<GTiffRasterBand *>(
+            m_poGDS->m_poImageryDS->GetRasterBand(1));
+    }
+    void *pBufferedData =
+        aoBlocks.empty() ? nullptr : poBandForCache->CacheMultiRange(aoBlocks);
+
+    // Make sure the per-window reads use the cached ranges, rather than the
+    // multi-threaded code path that would fetch the blocks again, and that
+    // they neither issue their own multi-range request nor reset the ranges
+    // cached for the whole batch.
+    if (pBufferedData)
+    {
+        ++m_poGDS->m_nDisableMultiThreadedRead;
+        ++m_poGDS->m_nMultiWindowBatchCounter;
+    }
+    const CPLErr eErr = GDALRasterBand::IReadMultiWindow(
+        nWindowCount, pasWindows, eBufType, psExtraArg);
+    if (pBufferedData)
+    {
+        --m_poGDS->m_nMultiWindowBatchCounter;
+        --m_poGDS->m_nDisableMultiThreadedRead;
+        VSIFree(pBufferedData);
+        VSI_TIFFSetCachedRanges(
+            TIFFClientdata(poBandForCache->m_poGDS->m_hTIFF), 0, nullptr,
+            nullptr, nullptr);
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                       IGetDataCoverageStatus()                       */
 /************************************************************************/
@@ -1224,6 +1499,17 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
         NullBlock(pImage);
         if (bErrOccurred)
             return CE_Failure;
+        // Let the block cache know that the block is filled with a single
+        // value, so that consumers can skip per-pixel processing.
+        if (!GDALDataTypeIsComplex(eDataType) && eDataType != GDT_Int64 &&
+            eDataType != GDT_UInt64 &&
+            !(eDataType == GDT_Byte &&
+              m_poGDS->m_nSampleFormat == SAMPLEFORMAT_INT))
+        {
+            double dfValue = 0;
+            GDALCopyWords(pImage, eDataType, 0, &dfValue, GDT_Float64, 0, 1);
+            SetReadBlockUniformValue(dfValue);
+        }
         return CE_None;
     }
 
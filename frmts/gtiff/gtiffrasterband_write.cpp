@@ -31,9 +31,12 @@
 #include "gtiffdataset.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <type_traits>
 
 #include "cpl_vsi_virtual.h"
+#include "gdal_priv_templates.hpp"
 #include "gtiff.h"
 #include "tifvsi.h"
 
@@ -1074,3 +1077,232 @@ void GTiffRasterBand::NullBlock(void *pData)
         }
     }
 }
+
+/************************************************************************/
+/*                      ComputeBlockStatistics()                        */
+/************************************************************************/
+
+// Two-pass computation of the count, min, max, mean and sum of squared
+// deviations of the valid values of a block, with the same validity rules
+// as GDALRasterBand::ComputeStatistics().
+template <class T>
+static void ComputeBlockStatistics(const T *pData, int nXCheck, int nYCheck,
+                                   int nPixelStride, int nLineStride,
+                                   bool bHasNoData, double dfNoData,
+                                   GTiffBlockStatistics &sStats)
+{
+    bool bHasFloatNoData = false;
+    float fNoData = 0.0f;
+    if constexpr (std::is_same<T, float>::value)
+    {
+        if (bHasNoData)
+        {
+            const double dfAdjusted = GDALAdjustNoDataCloseToFloatMax(dfNoData);
+            if (GDALIsValueInRange<float>(dfAdjusted))
+            {
+                bHasFloatNoData = true;
+                fNoData = static_cast<float>(dfAdjusted);
+            }
+        }
+    }
+    const auto IsValid = [bHasNoData, dfNoData, bHasFloatNoData,
+                          fNoData](T nValue)
+    {
+        if constexpr (std::is_same<T, float>::value)
+        {
+            CPL_IGNORE_RET_VAL(dfNoData);
+            return !std::isnan(nValue) &&
+                   !(bHasFloatNoData && ARE_REAL_EQUAL(nValue, fNoData));
+        }
+        else
+        {
+            CPL_IGNORE_RET_VAL(bHasFloatNoData);
+            CPL_IGNORE_RET_VAL(fNoData);
+            if constexpr (std::is_same<T, double>::value)
+            {
+                if (std::isnan(nValue))
+                    return false;
+            }
+            return !(bHasNoData &&
+                     ARE_REAL_EQUAL(static_cast<double>(nValue), dfNoData));
+        }
+    };
+
+    double dfCount = 0;
+    double dfMin = std::numeric_limits<double>::infinity();
+    double dfMax = -std::numeric_limits<double>::infinity();
+    double dfSum = 0;
+    for (int iY = 0; iY < nYCheck; ++iY)
+    {
+        const T *pLine = pData + static_cast<size_t>(iY) * nLineStride;
+        for (int iX = 0; iX < nXCheck; ++iX)
+        {
+            const T nValue = pLine[static_cast<size_t>(iX) * nPixelStride];
+            if (IsValid(nValue))
+            {
+                const double dfValue = static_cast<double>(nValue);
+                dfCount += 1;
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+                dfSum += dfValue;
+            }
+        }
+    }
+
+    sStats.dfValidCount = dfCount;
+    if (dfCount == 0)
+    {
+        sStats.dfMin = 0;
+        sStats.dfMax = 0;
+        sStats.dfMean = 0;
+        sStats.dfM2 = 0;
+        return;
+    }
+
+    const double dfMean = dfSum / dfCount;
+    double dfM2 = 0;
+    double dfSumDiff = 0;
+    for (int iY = 0; iY < nYCheck; ++iY)
+    {
+        const T *pLine = pData + static_cast<size_t>(iY) * nLineStride;
+        for (int iX = 0; iX < nXCheck; ++iX)
+        {
+            const T nValue = pLine[static_cast<size_t>(iX) * nPixelStride];
+            if (IsValid(nValue))
+            {
+                const double dfDiff = static_cast<double>(nValue) - dfMean;
+                dfM2 += dfDiff * dfDiff;
+                dfSumDiff += dfDiff;
+            }
+        }
+    }
+
+    sStats.dfMin = dfMin;
+    sStats.dfMax = dfMax;
+    sStats.dfMean = dfMean;
+    // Corrected two-pass formula, to compensate for the rounding error of
+    // dfMean.
+    sStats.dfM2 = std::max(0.0, dfM2 - dfSumDiff * dfSumDiff / dfCount);
+}
+
+/************************************************************************/
+/*                       UpdateBlockStatistics()                        */
+/************************************************************************/
+
+// Called with the content of a block (or interleaved block) about to be
+// written. nPixelStride and nLineStride are expressed in number of values.
+void GTiffRasterBand::UpdateBlockStatistics(int nBlockIdInBand,
+                                            const void *pData, int nXCheck,
+                                            int nYCheck, int nPixelStride,
+                                            int nLineStride)
+{
+    int bHasNoData = FALSE;
+    const double dfNoData = GetNoDataValue(&bHasNoData);
+    const bool bValidNoData = bHasNoData && !std::isnan(dfNoData);
+
+    // Summaries computed against another nodata value cannot be reused.
+    if (m_aoBlockStatistics.empty() ||
+        bValidNoData != m_bBlockStatisticsHasNoData ||
+        (bValidNoData && dfNoData != m_dfBlockStatisticsNoData))
+    {
+        m_aoBlockStatistics.clear();
+        m_aoBlockStatistics.resize(m_poGDS->m_nBlocksPerBand);
+        m_bBlockStatisticsHasNoData = bValidNoData;
+        m_dfBlockStatisticsNoData = bValidNoData ? dfNoData : 0;
+    }
+
+    auto &sStats = m_aoBlockStatistics[nBlockIdInBand];
+    switch (eDataType)
+    {
+        case GDT_Byte:
+            ComputeBlockStatistics(static_cast<const GByte *>(pData), nXCheck,
+                                   nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_Int8:
+            ComputeBlockStatistics(static_cast<const GInt8 *>(pData), nXCheck,
+                                   nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_UInt16:
+            ComputeBlockStatistics(static_cast<const GUInt16 *>(pData),
+                                   nXCheck, nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_Int16:
+            ComputeBlockStatistics(static_cast<const GInt16 *>(pData), nXCheck,
+                                   nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_UInt32:
+            ComputeBlockStatistics(static_cast<const GUInt32 *>(pData),
+                                   nXCheck, nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_Int32:
+            ComputeBlockStatistics(static_cast<const GInt32 *>(pData), nXCheck,
+                                   nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_Float32:
+            ComputeBlockStatistics(static_cast<const float *>(pData), nXCheck,
+                                   nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        case GDT_Float64:
+            ComputeBlockStatistics(static_cast<const double *>(pData), nXCheck,
+                                   nYCheck, nPixelStride, nLineStride,
+                                   bValidNoData, dfNoData, sStats);
+            break;
+        default:
+            // Should not happen given CanMaintainBlockStatistics()
+            sStats = GTiffBlockStatistics();
+            break;
+    }
+
+    m_poGDS->m_bMetadataChanged = true;
+}
+
+/************************************************************************/
+/*                     InvalidateBlockStatistics()                      */
+/************************************************************************/
+
+void GTiffRasterBand::InvalidateBlockStatistics()
+{
+    if (!m_aoBlockStatistics.empty())
+    {
+        m_aoBlockStatistics.clear();
+        m_poGDS->m_bMetadataChanged = true;
+    }
+}
+
+/************************************************************************/
+/*                     SerializeBlockStatistics()                       */
+/************************************************************************/
+
+// Base64 encoding of 5 little-endian doubles per block: valid count, min,
+// max, mean and sum of squared deviations from the mean.
+std::string GTiffRasterBand::SerializeBlockStatistics() const
+{
+    const size_t nValues = m_aoBlockStatistics.size() * 5;
+    if (nValues == 0 ||
+        nValues > static_cast<size_t>(INT_MAX) / sizeof(double))
+        return std::string();
+    std::vector<double> adfValues;
+    adfValues.reserve(nValues);
+    for (const auto &sStats : m_aoBlockStatistics)
+    {
+        for (double dfVal : {sStats.dfValidCount, sStats.dfMin, sStats.dfMax,
+                             sStats.dfMean, sStats.dfM2})
+        {
+            CPL_LSBPTR64(&dfVal);
+            adfValues.push_back(dfVal);
+        }
+    }
+    char *pszBase64 = CPLBase64Encode(
+        static_cast<int>(nValues * sizeof(double)),
+        reinterpret_cast<const GByte *>(adfValues.data()));
+    std::string osRet(pszBase64);
+    CPLFree(pszBase64);
+    return osRet;
+}
@@ -27,6 +27,9 @@
 
 #include <jxl/decode.h>
 #include <jxl/encode.h>
+#ifdef HAVE_JXL_THREADS
+#include <jxl/resizable_parallel_runner.h>
+#endif
 
 #include <stdint.h>
 
@@ -46,6 +49,7 @@ typedef struct
     int effort;           /* 3 to 9. default: 7 */
     float distance;       /* 0 to 15. default: 1.0 */
     float alpha_distance; /* 0 to 15. default: -1.0 (same as distance) */
+    uint32_t num_threads; /* >= 1. default: 1 */
 
     uint32_t segment_width;
     uint32_t segment_height;
@@ -56,6 +60,7 @@ typedef struct
     unsigned int uncompressed_offset;
 
     JxlDecoder *decoder;
+    void *runner; /* JxlResizableParallelRunner, created if num_threads > 1 */
 
     TIFFVGetMethod vgetparent; /* super-class method */
     TIFFVSetMethod vsetparent; /* super-class method */
@@ -68,6 +73,35 @@ typedef struct
 static int JXLEncode(TIFF *tif, uint8_t *bp, tmsize_t cc, uint16_t s);
 static int JXLDecode(TIFF *tif, uint8_t *op, tmsize_t occ, uint16_t s);
 
+#ifdef HAVE_JXL_THREADS
+/*
+ * Returns the parallel runner to use for the current strip/tile, or NULL if
+ * libjxl must use the calling thread only.
+ */
+static void *GetParallelRunner(TIFF *tif, JXLState *sp)
+{
+    static const char module[] = "GetParallelRunner";
+    if (sp->num_threads <= 1)
+        return NULL;
+    if (sp->runner == NULL)
+    {
+        sp->runner = JxlResizableParallelRunnerCreate(NULL);
+        if (sp->runner == NULL)
+        {
+            TIFFWarningExtR(tif, module,
+                            "JxlResizableParallelRunnerCreate() failed");
+            return NULL;
+        }
+    }
+    uint32_t num_threads = JxlResizableParallelRunnerSuggestThreads(
+        sp->segment_width, sp->segment_height);
+    if (num_threads > sp->num_threads)
+        num_threads = sp->num_threads;
+    JxlResizableParallelRunnerSetThreads(sp->runner, num_threads);
+    return sp->runner;
+}
+#endif
+
 static int GetJXLDataType(TIFF *tif)
 {
     TIFFDirectory *td = &tif->tif_dir;
@@ -248,6 +282,16 @@ static int JXLPreDecode(TIFF *tif, uint16_t s)
     }
 
     JxlDecoderStatus status;
+#ifdef HAVE_JXL_THREADS
+    void *runner = GetParallelRunner(tif, sp);
+    if (runner != NULL &&
+        JxlDecoderSetParallelRunner(sp->decoder, JxlResizableParallelRunner,
+                                    runner) != JXL_DEC_SUCCESS)
+    {
+        TIFFErrorExtR(tif, module, "JxlDecoderSetParallelRunner() failed");
+        return 0;
+    }
+#endif
     status = JxlDecoderSubscribeEvents(sp->decoder,
                                        JXL_DEC_BASIC_INFO | JXL_DEC_FULL_IMAGE);
     if (status != JXL_DEC_SUCCESS)
@@ -780,6 +824,18 @@ static int JXLPostEncode(TIFF *tif)
     }
     JxlEncoderUseContainer(enc, JXL_FALSE);
 
+#ifdef HAVE_JXL_THREADS
+    void *runner = GetParallelRunner(tif, sp);
+    if (runner != NULL &&
+        JxlEncoderSetParallelRunner(enc, JxlResizableParallelRunner, runner) !=
+            JXL_ENC_SUCCESS)
+    {
+        TIFFErrorExtR(tif, module, "JxlEncoderSetParallelRunner() failed");
+        JxlEncoderDestroy(enc);
+        return 0;
+    }
+#endif
+
 #ifdef HAVE_JxlEncoderFrameSettingsCreate
     JxlEncoderFrameSettings *opts = JxlEncoderFrameSettingsCreate(enc, NULL);
 #else
@@ -1141,6 +1197,11 @@ static void JXLCleanup(TIFF *tif)
     if (sp->decoder)
         JxlDecoderDestroy(sp->decoder);
 
+#ifdef HAVE_JXL_THREADS
+    if (sp->runner)
+        JxlResizableParallelRunnerDestroy(sp->runner);
+#endif
+
     _TIFFfreeExt(tif, sp);
     tif->tif_data = NULL;
 
@@ -1156,6 +1217,8 @@ static const TIFFField JXLFields[] = {
      TIFF_SETGET_UNDEFINED, FIELD_PSEUDO, FALSE, FALSE, "Distance", NULL},
     {TIFFTAG_JXL_ALPHA_DISTANCE, 0, 0, TIFF_ANY, 0, TIFF_SETGET_FLOAT,
      TIFF_SETGET_UNDEFINED, FIELD_PSEUDO, FALSE, FALSE, "AlphaDistance", NULL},
+    {TIFFTAG_JXL_NUM_THREADS, 0, 0, TIFF_ANY, 0, TIFF_SETGET_UINT32,
+     TIFF_SETGET_UNDEFINED, FIELD_PSEUDO, FALSE, FALSE, "NumThreads", NULL},
 };
 
 static int JXLVSetField(TIFF *tif, uint32_t tag, va_list ap)
@@ -1222,6 +1285,19 @@ static int JXLVSetField(TIFF *tif, uint32_t tag, va_list ap)
             return 1;
         }
 
+        case TIFFTAG_JXL_NUM_THREADS:
+        {
+            uint32_t num_threads = va_arg(ap, uint32_t);
+            if (num_threads < 1 || num_threads > 1024)
+            {
+                TIFFErrorExtR(tif, module, "Invalid value for NumThreads: %u",
+                              num_threads);
+                return 0;
+            }
+            sp->num_threads = num_threads;
+            return 1;
+        }
+
         default:
         {
             return (*sp->vsetparent)(tif, tag, ap);
@@ -1248,6 +1324,9 @@ static int JXLVGetField(TIFF *tif, uint32_t tag, va_list ap)
         case TIFFTAG_JXL_ALPHA_DISTANCE:
             *va_arg(ap, float *) = sp->alpha_distance;
             break;
+        case TIFFTAG_JXL_NUM_THREADS:
+            *va_arg(ap, uint32_t *) = sp->num_threads;
+            break;
         default:
             return (*sp->vgetparent)(tif, tag, ap);
     }
@@ -1306,12 +1385,14 @@ int TIFFInitJXL(TIFF *tif, int scheme)
 
     /* Default values for codec-specific fields */
     sp->decoder = NULL;
+    sp->runner = NULL;
 
     sp->state = 0;
     sp->lossless = TRUE;
     sp->effort = 5;
     sp->distance = 1.0;
     sp->alpha_distance = -1.0;
+    sp->num_threads = 1;
 
     return 1;
 bad:
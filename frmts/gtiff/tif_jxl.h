@@ -49,6 +49,13 @@
              max butteraugli distance, lower = higher quality. Range: 0 .. 15.*/
 #endif
 
+#ifndef TIFFTAG_JXL_NUM_THREADS
+#define TIFFTAG_JXL_NUM_THREADS                                                \
+    65539 /* Maximum number of threads used by libjxl to encode or decode a    \
+             single strip/tile. Only honored when built against libjxl_threads.\
+             Default is 1 */
+#endif
+
 #if defined(__cplusplus)
 extern "C"
 {
@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and
+ * its documentation for any purpose is hereby granted without fee, provided
+ * that (i) the above copyright notices and this permission notice appear in
+ * all copies of the software and related documentation, and (ii) the names of
+ * Sam Leffler and Silicon Graphics may not be used in any advertising or
+ * publicity relating to the software without the specific, prior written
+ * permission of Sam Leffler and Silicon Graphics.
+ *
+ * THE SOFTWARE IS PROVIDED "AS-IS" AND WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS, IMPLIED OR OTHERWISE, INCLUDING WITHOUT LIMITATION, ANY
+ * WARRANTY OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * IN NO EVENT SHALL SAM LEFFLER OR SILICON GRAPHICS BE LIABLE FOR
+ * ANY SPECIAL, INCIDENTAL, INDIRECT OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+ * OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+ * WHETHER OR NOT ADVISED OF THE POSSIBILITY OF DAMAGE, AND ON ANY THEORY OF
+ * LIABILITY, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+
+/*
+ * QB3 lossless compression of integer strips/tiles, using libQB3.
+ *
+ * A QB3 stream encodes whole 4x4 blocks. Strips and tiles whose dimensions
+ * are not a multiple of 4 are padded, by replicating the last column and row,
+ * before encoding, and cropped after decoding.
+ */
+
+#include "tiffiop.h"
+#include "tif_qb3.h"
+
+#include <QB3.h>
+
+#include <stdint.h>
+
+#include <assert.h>
+
+#define LSTATE_INIT_DECODE 0x01
+#define LSTATE_INIT_ENCODE 0x02
+
+/*
+ * State block for each open TIFF file using QB3 compression/decompression.
+ */
+typedef struct
+{
+    int state; /* state flags */
+
+    uint32_t segment_width;
+    uint32_t segment_height;
+    uint32_t padded_width;  /* segment_width rounded up to a multiple of 4 */
+    uint32_t padded_height; /* segment_height rounded up to a multiple of 4 */
+    unsigned int bands;
+    unsigned int sample_size;
+
+    /* Unpadded strip/tile, as seen by libtiff */
+    tmsize_t uncompressed_size;
+    tmsize_t uncompressed_alloc;
+    uint8_t *uncompressed_buffer;
+    tmsize_t uncompressed_offset;
+
+    /* Padded strip/tile, as seen by libQB3, only if padding is needed */
+    tmsize_t padded_size;
+    tmsize_t padded_alloc;
+    uint8_t *padded_buffer;
+
+    tmsize_t compressed_alloc;
+    uint8_t *compressed_buffer;
+} QB3State;
+
+#define LState(tif) ((QB3State *)(tif)->tif_data)
+#define DecoderState(tif) LState(tif)
+#define EncoderState(tif) LState(tif)
+
+static int GetQB3DataType(TIFF *tif, enum qb3_dtype *pdtype)
+{
+    TIFFDirectory *td = &tif->tif_dir;
+    static const char module[] = "GetQB3DataType";
+
+    if (td->td_sampleformat == SAMPLEFORMAT_UINT)
+    {
+        switch (td->td_bitspersample)
+        {
+            case 8:
+                *pdtype = QB3_U8;
+                return 1;
+            case 16:
+                *pdtype = QB3_U16;
+                return 1;
+            case 32:
+                *pdtype = QB3_U32;
+                return 1;
+            default:
+                break;
+        }
+    }
+    else if (td->td_sampleformat == SAMPLEFORMAT_INT)
+    {
+        switch (td->td_bitspersample)
+        {
+            case 16:
+                *pdtype = QB3_I16;
+                return 1;
+            case 32:
+                *pdtype = QB3_I32;
+                return 1;
+            default:
+                break;
+        }
+    }
+
+    TIFFErrorExtR(tif, module,
+                  "Unsupported combination of SampleFormat and BitsPerSample");
+    return 0;
+}
+
+static int QB3FixupTags(TIFF *tif)
+{
+    (void)tif;
+    return 1;
+}
+
+static int QB3SetupDecode(TIFF *tif)
+{
+    QB3State *sp = DecoderState(tif);
+
+    assert(sp != NULL);
+
+    /* if we were last encoding, terminate this mode */
+    if (sp->state & LSTATE_INIT_ENCODE)
+    {
+        sp->state = 0;
+    }
+
+    sp->state |= LSTATE_INIT_DECODE;
+    return 1;
+}
+
+static int ReallocBuffer(TIFF *tif, uint8_t **pbuffer, tmsize_t *palloc,
+                         uint64_t size_64, const char *module)
+{
+    const tmsize_t size = (tmsize_t)size_64;
+    if ((uint64_t)size != size_64 || size <= 0)
+    {
+        TIFFErrorExtR(tif, module, "Too large uncompressed strip/tile");
+        return 0;
+    }
+    if (*palloc < size)
+    {
+        _TIFFfreeExt(tif, *pbuffer);
+        *palloc = 0;
+        *pbuffer = (uint8_t *)_TIFFmallocExt(tif, size);
+        if (*pbuffer == NULL)
+        {
+            TIFFErrorExtR(tif, module, "Cannot allocate buffer");
+            return 0;
+        }
+        *palloc = size;
+    }
+    return 1;
+}
+
+static int SetupUncompressedBuffer(TIFF *tif, QB3State *sp, const char *module)
+{
+    TIFFDirectory *td = &tif->tif_dir;
+    enum qb3_dtype dtype;
+
+    sp->uncompressed_offset = 0;
+
+    if (!GetQB3DataType(tif, &dtype))
+        return 0;
+
+    if (isTiled(tif))
+    {
+        sp->segment_width = td->td_tilewidth;
+        sp->segment_height = td->td_tilelength;
+    }
+    else
+    {
+        sp->segment_width = td->td_imagewidth;
+        sp->segment_height = td->td_imagelength - tif->tif_row;
+        if (sp->segment_height > td->td_rowsperstrip)
+            sp->segment_height = td->td_rowsperstrip;
+    }
+    if (sp->segment_width == 0 || sp->segment_height == 0)
+    {
+        TIFFErrorExtR(tif, module, "Invalid strip/tile dimensions");
+        return 0;
+    }
+    sp->padded_width = (uint32_t)((sp->segment_width + 3ULL) / 4 * 4);
+    sp->padded_height = (uint32_t)((sp->segment_height + 3ULL) / 4 * 4);
+
+    sp->bands = td->td_planarconfig == PLANARCONFIG_CONTIG
+                    ? td->td_samplesperpixel
+                    : 1;
+    sp->sample_size = td->td_bitspersample / 8;
+
+    const uint64_t pixel_size = (uint64_t)sp->bands * sp->sample_size;
+    const uint64_t size_64 =
+        (uint64_t)sp->segment_width * sp->segment_height * pixel_size;
+    if (!ReallocBuffer(tif, &sp->uncompressed_buffer, &sp->uncompressed_alloc,
+                       size_64, module))
+        return 0;
+    sp->uncompressed_size = (tmsize_t)size_64;
+
+    sp->padded_size = 0;
+    if (sp->padded_width != sp->segment_width ||
+        sp->padded_height != sp->segment_height)
+    {
+        const uint64_t padded_size_64 =
+            (uint64_t)sp->padded_width * sp->padded_height * pixel_size;
+        if (!ReallocBuffer(tif, &sp->padded_buffer, &sp->padded_alloc,
+                           padded_size_64, module))
+            return 0;
+        sp->padded_size = (tmsize_t)padded_size_64;
+    }
+
+    return 1;
+}
+
+/*
+ * libQB3 works on values in native byte order, while libtiff hands over and
+ * expects data in the byte order of the file.
+ */
+static void SwabBuffer(TIFF *tif, QB3State *sp)
+{
+    if (!(tif->tif_flags & TIFF_SWAB))
+        return;
+    if (sp->sample_size == 2)
+        TIFFSwabArrayOfShort((uint16_t *)sp->uncompressed_buffer,
+                             sp->uncompressed_size / 2);
+    else if (sp->sample_size == 4)
+        TIFFSwabArrayOfLong((uint32_t *)sp->uncompressed_buffer,
+                            sp->uncompressed_size / 4);
+}
+
+/*
+ * Setup state for decoding a strip.
+ */
+static int QB3PreDecode(TIFF *tif, uint16_t s)
+{
+    static const char module[] = "QB3PreDecode";
+    QB3State *sp = DecoderState(tif);
+
+    (void)s;
+    assert(sp != NULL);
+    if (sp->state != LSTATE_INIT_DECODE)
+        tif->tif_setupdecode(tif);
+
+    if (!SetupUncompressedBuffer(tif, sp, module))
+        return 0;
+
+    size_t image_size[3];
+    decsp dec = qb3_read_start(tif->tif_rawcp, (size_t)tif->tif_rawcc,
+                               image_size);
+    if (dec == NULL)
+    {
+        TIFFErrorExtR(tif, module, "qb3_read_start() failed");
+        return 0;
+    }
+
+    if (image_size[0] != sp->padded_width ||
+        image_size[1] != sp->padded_height || image_size[2] != sp->bands)
+    {
+        TIFFErrorExtR(tif, module,
+                      "QB3 stream has dimensions %ux%ux%u, "
+                      "whereas %ux%ux%u were expected",
+                      (unsigned)image_size[0], (unsigned)image_size[1],
+                      (unsigned)image_size[2], sp->padded_width,
+                      sp->padded_height, sp->bands);
+        qb3_destroy_decoder(dec);
+        return 0;
+    }
+
+    uint8_t *dst =
+        sp->padded_size ? sp->padded_buffer : sp->uncompressed_buffer;
+    const size_t dst_size = sp->padded_size ? (size_t)sp->padded_size
+                                            : (size_t)sp->uncompressed_size;
+    if (!qb3_read_info(dec) || qb3_decoded_size(dec) != dst_size ||
+        qb3_read_data(dec, dst) != dst_size)
+    {
+        TIFFErrorExtR(tif, module, "QB3 decoding failed");
+        qb3_destroy_decoder(dec);
+        return 0;
+    }
+    qb3_destroy_decoder(dec);
+
+    if (sp->padded_size)
+    {
+        /* Crop the padding */
+        const size_t line_size =
+            (size_t)sp->segment_width * sp->bands * sp->sample_size;
+        const size_t padded_line_size =
+            (size_t)sp->padded_width * sp->bands * sp->sample_size;
+        for (uint32_t y = 0; y < sp->segment_height; y++)
+        {
+            memcpy(sp->uncompressed_buffer + y * line_size,
+                   sp->padded_buffer + y * padded_line_size, line_size);
+        }
+    }
+
+    SwabBuffer(tif, sp);
+
+    tif->tif_rawcp += tif->tif_rawcc;
+    tif->tif_rawcc = 0;
+
+    return 1;
+}
+
+/*
+ * Decode a strip, tile or scanline.
+ */
+static int QB3Decode(TIFF *tif, uint8_t *op, tmsize_t occ, uint16_t s)
+{
+    static const char module[] = "QB3Decode";
+    QB3State *sp = DecoderState(tif);
+
+    (void)s;
+    assert(sp != NULL);
+    assert(sp->state == LSTATE_INIT_DECODE);
+
+    if (sp->uncompressed_buffer == NULL)
+    {
+        TIFFErrorExtR(tif, module, "Uncompressed buffer not allocated");
+        return 0;
+    }
+
+    if ((uint64_t)sp->uncompressed_offset + (uint64_t)occ >
+        (uint64_t)sp->uncompressed_size)
+    {
+        TIFFErrorExtR(tif, module, "Too many bytes read");
+        return 0;
+    }
+
+    memcpy(op, sp->uncompressed_buffer + sp->uncompressed_offset, occ);
+    sp->uncompressed_offset += occ;
+
+    return 1;
+}
+
+static int QB3SetupEncode(TIFF *tif)
+{
+    QB3State *sp = EncoderState(tif);
+    enum qb3_dtype dtype;
+
+    assert(sp != NULL);
+    if (sp->state & LSTATE_INIT_DECODE)
+    {
+        sp->state = 0;
+    }
+
+    if (!GetQB3DataType(tif, &dtype))
+        return 0;
+
+    sp->state |= LSTATE_INIT_ENCODE;
+
+    return 1;
+}
+
+/*
+ * Reset encoding state at the start of a strip.
+ */
+static int QB3PreEncode(TIFF *tif, uint16_t s)
+{
+    static const char module[] = "QB3PreEncode";
+    QB3State *sp = EncoderState(tif);
+
+    (void)s;
+    assert(sp != NULL);
+    if (sp->state != LSTATE_INIT_ENCODE)
+        tif->tif_setupencode(tif);
+
+    if (!SetupUncompressedBuffer(tif, sp, module))
+        return 0;
+
+    return 1;
+}
+
+/*
+ * Encode a chunk of pixels.
+ */
+static int QB3Encode(TIFF *tif, uint8_t *bp, tmsize_t cc, uint16_t s)
+{
+    static const char module[] = "QB3Encode";
+    QB3State *sp = EncoderState(tif);
+
+    (void)s;
+    assert(sp != NULL);
+    assert(sp->state == LSTATE_INIT_ENCODE);
+
+    if ((uint64_t)sp->uncompressed_offset + (uint64_t)cc >
+        (uint64_t)sp->uncompressed_size)
+    {
+        TIFFErrorExtR(tif, module, "Too many bytes written");
+        return 0;
+    }
+
+    memcpy(sp->uncompressed_buffer + sp->uncompressed_offset, bp, cc);
+    sp->uncompressed_offset += cc;
+
+    return 1;
+}
+
+/*
+ * Finish off an encoded strip by flushing it.
+ */
+static int QB3PostEncode(TIFF *tif)
+{
+    static const char module[] = "QB3PostEncode";
+    QB3State *sp = EncoderState(tif);
+    TIFFDirectory *td = &tif->tif_dir;
+    enum qb3_dtype dtype;
+
+    if (sp->uncompressed_offset != sp->uncompressed_size)
+    {
+        TIFFErrorExtR(tif, module, "Unexpected number of bytes in the buffer");
+        return 0;
+    }
+
+    if (!GetQB3DataType(tif, &dtype))
+        return 0;
+
+    SwabBuffer(tif, sp);
+
+    uint8_t *src = sp->uncompressed_buffer;
+    if (sp->padded_size)
+    {
+        /* Replicate the last column and the last row */
+        const size_t pixel_size = (size_t)sp->bands * sp->sample_size;
+        const size_t line_size = (size_t)sp->segment_width * pixel_size;
+        const size_t padded_line_size = (size_t)sp->padded_width * pixel_size;
+        for (uint32_t y = 0; y < sp->padded_height; y++)
+        {
+            const uint32_t src_y =
+                y < sp->segment_height ? y : sp->segment_height - 1;
+            uint8_t *dst_line = sp->padded_buffer + y * padded_line_size;
+            memcpy(dst_line, sp->uncompressed_buffer + src_y * line_size,
+                   line_size);
+            for (uint32_t x = sp->segment_width; x < sp->padded_width; x++)
+            {
+                memcpy(dst_line + x * pixel_size,
+                       dst_line + (sp->segment_width - 1) * pixel_size,
+                       pixel_size);
+            }
+        }
+        src = sp->padded_buffer;
+    }
+
+    encsp enc = qb3_create_encoder(sp->padded_width, sp->padded_height,
+                                   sp->bands, dtype);
+    if (enc == NULL)
+    {
+        TIFFErrorExtR(tif, module, "qb3_create_encoder() failed");
+        return 0;
+    }
+
+    /* By default, QB3 decorrelates the bands of RGB(A) images using the
+     * second one as the core band. Keep the bands independent otherwise. */
+    if ((sp->bands == 3 || sp->bands == 4) &&
+        td->td_photometric != PHOTOMETRIC_RGB)
+    {
+        size_t corebands[4] = {0, 1, 2, 3};
+        qb3_set_encoder_coreband(enc, sp->bands, corebands);
+    }
+
+    const size_t max_size = qb3_max_encoded_size(enc);
+    if (!ReallocBuffer(tif, &sp->compressed_buffer, &sp->compressed_alloc,
+                       max_size, module))
+    {
+        qb3_destroy_encoder(enc);
+        return 0;
+    }
+
+    const size_t encoded_size = qb3_encode(enc, src, sp->compressed_buffer);
+    qb3_destroy_encoder(enc);
+    if (encoded_size == 0 || encoded_size > max_size)
+    {
+        TIFFErrorExtR(tif, module, "qb3_encode() failed");
+        return 0;
+    }
+
+    int ret;
+    uint8_t *tif_rawdata_backup = tif->tif_rawdata;
+    tif->tif_rawdata = sp->compressed_buffer;
+    tif->tif_rawcc = (tmsize_t)encoded_size;
+    ret = TIFFFlushData1(tif);
+    tif->tif_rawdata = tif_rawdata_backup;
+
+    return ret;
+}
+
+static void QB3Cleanup(TIFF *tif)
+{
+    QB3State *sp = LState(tif);
+
+    assert(sp != 0);
+
+    _TIFFfreeExt(tif, sp->uncompressed_buffer);
+    _TIFFfreeExt(tif, sp->padded_buffer);
+    _TIFFfreeExt(tif, sp->compressed_buffer);
+
+    _TIFFfreeExt(tif, sp);
+    tif->tif_data = NULL;
+
+    _TIFFSetDefaultCompressionState(tif);
+}
+
+int TIFFInitQB3(TIFF *tif, int scheme)
+{
+    static const char module[] = "TIFFInitQB3";
+
+    (void)scheme;
+    assert(scheme == COMPRESSION_QB3);
+
+    /*
+     * Allocate state block.
+     */
+    tif->tif_data = (uint8_t *)_TIFFcallocExt(tif, 1, sizeof(QB3State));
+    if (tif->tif_data == NULL)
+    {
+        TIFFErrorExtR(tif, module, "No space for QB3 state block");
+        return 0;
+    }
+
+    /*
+     * Install codec methods.
+     */
+    tif->tif_fixuptags = QB3FixupTags;
+    tif->tif_setupdecode = QB3SetupDecode;
+    tif->tif_predecode = QB3PreDecode;
+    tif->tif_decoderow = QB3Decode;
+    tif->tif_decodestrip = QB3Decode;
+    tif->tif_decodetile = QB3Decode;
+    tif->tif_setupencode = QB3SetupEncode;
+    tif->tif_preencode = QB3PreEncode;
+    tif->tif_postencode = QB3PostEncode;
+    tif->tif_encoderow = QB3Encode;
+    tif->tif_encodestrip = QB3Encode;
+    tif->tif_encodetile = QB3Encode;
+    tif->tif_cleanup = QB3Cleanup;
+
+    return 1;
+}
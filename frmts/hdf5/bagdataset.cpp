@@ -40,6 +40,7 @@
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
+#include "gdal_thread_pool.h"
 #include "iso19115_srs.h"
 #include "ogr_core.h"
 #include "ogr_spatialref.h"
@@ -48,6 +49,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <map>
 #include <utility>
@@ -142,9 +144,6 @@ class BAGDataset final : public GDALPamDataset
     int m_nChunkYSizeVarresMD = 0;
     void GetVarresMetadataChunkSizes(int &nChunkXSize, int &nChunkYSize);
 
-    unsigned m_nChunkSizeVarresRefinement = 0;
-    void GetVarresRefinementChunkSize(unsigned &nChunkSize);
-
     bool ReadVarresMetadataValue(int y, int x, hid_t memspace,
                                  BAGRefinementGrid *rgrid, int height,
                                  int width);
@@ -168,8 +167,15 @@ class BAGDataset final : public GDALPamDataset
 
     unsigned m_nSuperGridRefinementStartIndex = 0;
 
-    lru11::Cache<unsigned, std::vector<float>> m_oCacheRefinementValues;
-    const float *GetRefinementValues(unsigned nRefinementIndex);
+    // Refinement values of whole supergrids, as (depth, uncertainty) pairs,
+    // indexed by the index of their first refinement. The cache is not
+    // bounded in number of entries, but by m_nCacheSuperGridValuesBytes.
+    using SuperGridValues = std::shared_ptr<const std::vector<float>>;
+    lru11::Cache<unsigned, SuperGridValues> m_oCacheSuperGridValues{0, 0};
+    size_t m_nCacheSuperGridValuesBytes = 0;
+    bool IsSuperGridSelected(const BAGRefinementGrid &rgrid) const;
+    bool GetSuperGridValues(const std::vector<BAGRefinementGrid> &rgrids,
+                            std::vector<SuperGridValues> &apoValues);
 
     bool GetMeanSupergridsResolution(double &dfResX, double &dfResY);
 
@@ -426,12 +432,13 @@ class BAGInterpolatedBand final : public BAGBaseBand
 
     void LoadClosestRefinedNodes(
         double dfX, double dfY, int iXRefinedGrid, int iYRefinedGrid,
-        const std::vector<BAGRefinementGrid> &rgrids, int nLowResMinIdxX,
-        int nLowResMinIdxY, int nCountLowResX, int nCountLowResY,
-        double dfLowResMinX, double dfLowResMinY, double dfLowResResX,
-        double dfLowResResY, std::vector<double> &adfX,
+        const std::vector<BAGRefinementGrid> &rgrids,
+        const std::vector<BAGDataset::SuperGridValues> &apoValues,
+        int nLowResMinIdxX, int nLowResMinIdxY, int nCountLowResX,
+        int nCountLowResY, double dfLowResMinX, double dfLowResMinY,
+        double dfLowResResX, double dfLowResResY, std::vector<double> &adfX,
         std::vector<double> &adfY, std::vector<float> &afDepth,
-        std::vector<float> &afUncrt);
+        std::vector<float> &afUncrt) const;
 
   public:
     BAGInterpolatedBand(BAGDataset *, int nBandIn, bool bHasNoData,
@@ -1142,6 +1149,65 @@ double BAGResampledBand::GetMaximum(int *pbSuccess)
     return GDALRasterBand::GetMaximum(pbSuccess);
 }
 
+/************************************************************************/
+/*                        ProcessRowsInParallel()                       */
+/************************************************************************/
+
+// Calls pfnProcessRows(nYStart, nYEnd) on slabs of rows covering [0, nRows[,
+// in parallel when GDAL_NUM_THREADS is set. pfnProcessRows() must not call
+// libhdf5, nor write outside of the rows of its slab.
+static void
+ProcessRowsInParallel(int nRows,
+                      const std::function<void(int, int)> &pfnProcessRows)
+{
+    // Not worth spawning jobs for slabs smaller than that
+    constexpr int MIN_ROWS_PER_JOB = 16;
+
+    int nThreads = 1;
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::min(nThreads, nRows / MIN_ROWS_PER_JOB);
+    }
+    GDALThreadReservation oThreadReservation(std::max(1, nThreads));
+    nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        pfnProcessRows(0, nRows);
+        return;
+    }
+
+    struct Slab
+    {
+        const std::function<void(int, int)> *pfnProcessRows = nullptr;
+        int nYStart = 0;
+        int nYEnd = 0;
+    };
+
+    std::vector<Slab> asSlabs(nThreads);
+    for (int i = 0; i < nThreads; ++i)
+    {
+        asSlabs[i].pfnProcessRows = &pfnProcessRows;
+        asSlabs[i].nYStart = static_cast<int>(
+            static_cast<GIntBig>(i) * nRows / nThreads);
+        asSlabs[i].nYEnd = static_cast<int>(
+            static_cast<GIntBig>(i + 1) * nRows / nThreads);
+        poJobQueue->SubmitJob(
+            [](void *pData)
+            {
+                const Slab *psSlab = static_cast<const Slab *>(pData);
+                (*psSlab->pfnProcessRows)(psSlab->nYStart, psSlab->nYEnd);
+            },
+            &asSlabs[i]);
+    }
+    poJobQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
@@ -1297,166 +1363,188 @@ CPLErr BAGResampledBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 
     H5Sclose(memspaceVarresMD);
 
-    CPLErr eErr = CE_None;
-    for (int y = nLowResMinIdxY; y <= nLowResMaxIdxY; y++)
+    // Fetch the refinement values of all the supergrids intersecting the
+    // block beforehand, so that the block can then be computed in parallel
+    // without involving libhdf5.
+    std::vector<BAGDataset::SuperGridValues> apoValues;
+    if (!poGDS->m_bMask &&
+        poGDS->m_ePopulation != BAGDataset::Population::COUNT &&
+        !poGDS->GetSuperGridValues(rgrids, apoValues))
     {
-        for (int x = nLowResMinIdxX; x <= nLowResMaxIdxX; x++)
+        if (poBlock != nullptr)
         {
-            const auto &rgrid = rgrids[(y - nLowResMinIdxY) * nCountLowResX +
-                                       (x - nLowResMinIdxX)];
-            if (rgrid.nWidth == 0)
-            {
-                continue;
-            }
-            const float gridRes = std::max(rgrid.fResX, rgrid.fResY);
-            if (!(gridRes > poGDS->m_dfResFilterMin &&
-                  gridRes <= poGDS->m_dfResFilterMax))
-            {
-                continue;
-            }
-
-            // Super grid bounding box with pixel-center convention
-            const double dfMinX =
-                poGDS->m_dfLowResMinX + x * dfLowResResX + rgrid.fSWX;
-            const double dfMaxX =
-                dfMinX + (rgrid.nWidth - 1) * static_cast<double>(rgrid.fResX);
-            const double dfMinY =
-                poGDS->m_dfLowResMinY + y * dfLowResResY + rgrid.fSWY;
-            const double dfMaxY =
-                dfMinY + (rgrid.nHeight - 1) * static_cast<double>(rgrid.fResY);
-
-            // Intersection of super grid with block
-            const double dfInterMinX = std::max(dfBlockMinX, dfMinX);
-            const double dfInterMinY = std::max(dfBlockMinY, dfMinY);
-            const double dfInterMaxX = std::min(dfBlockMaxX, dfMaxX);
-            const double dfInterMaxY = std::min(dfBlockMaxY, dfMaxY);
-
-            // Min/max indices in the super grid
-            const int nMinSrcX = std::max(
-                0, static_cast<int>((dfInterMinX - dfMinX) / rgrid.fResX));
-            const int nMinSrcY = std::max(
-                0, static_cast<int>((dfInterMinY - dfMinY) / rgrid.fResY));
-            // Need to use ceil due to numerical imprecision
-            const int nMaxSrcX =
-                std::min(static_cast<int>(rgrid.nWidth) - 1,
-                         static_cast<int>(
-                             std::ceil((dfInterMaxX - dfMinX) / rgrid.fResX)));
-            const int nMaxSrcY =
-                std::min(static_cast<int>(rgrid.nHeight) - 1,
-                         static_cast<int>(
-                             std::ceil((dfInterMaxY - dfMinY) / rgrid.fResY)));
-#ifdef DEBUG_VERBOSE
-            CPLDebug(
-                "BAG",
-                "y = %d, x = %d, minx = %d, miny = %d, maxx = %d, maxy = %d", y,
-                x, nMinSrcX, nMinSrcY, nMaxSrcX, nMaxSrcY);
-#endif
-            const double dfCstX =
-                (dfMinX - dfBlockMinX) / poGDS->adfGeoTransform[1];
-            const double dfMulX = rgrid.fResX / poGDS->adfGeoTransform[1];
+            poBlock->DropLock();
+            poBlock = nullptr;
+        }
+        return CE_Failure;
+    }
 
-            for (int super_y = nMinSrcY; super_y <= nMaxSrcY; super_y++)
+    // Only writes the target rows in [nYStart, nYEnd[
+    const auto ProcessRows = [&](int nYStart, int nYEnd)
+    {
+        for (int y = nLowResMinIdxY; y <= nLowResMaxIdxY; y++)
+        {
+            for (int x = nLowResMinIdxX; x <= nLowResMaxIdxX; x++)
             {
-                const double dfSrcY =
-                    dfMinY + super_y * static_cast<double>(rgrid.fResY);
-                const int nTargetY = static_cast<int>(std::floor(
-                    (dfBlockMaxY - dfSrcY) / -poGDS->adfGeoTransform[5]));
-                if (!(nTargetY >= 0 && nTargetY < nReqCountY))
+                const size_t iGrid =
+                    static_cast<size_t>(y - nLowResMinIdxY) * nCountLowResX +
+                    (x - nLowResMinIdxX);
+                const auto &rgrid = rgrids[iGrid];
+                if (!poGDS->IsSuperGridSelected(rgrid))
                 {
                     continue;
                 }
+                const float *pafSuperGridValues =
+                    iGrid < apoValues.size() && apoValues[iGrid]
+                        ? apoValues[iGrid]->data()
+                        : nullptr;
+
+                // Super grid bounding box with pixel-center convention
+                const double dfMinX =
+                    poGDS->m_dfLowResMinX + x * dfLowResResX + rgrid.fSWX;
+                const double dfMaxX =
+                    dfMinX +
+                    (rgrid.nWidth - 1) * static_cast<double>(rgrid.fResX);
+                const double dfMinY =
+                    poGDS->m_dfLowResMinY + y * dfLowResResY + rgrid.fSWY;
+                const double dfMaxY =
+                    dfMinY +
+                    (rgrid.nHeight - 1) * static_cast<double>(rgrid.fResY);
+
+                // Intersection of super grid with block
+                const double dfInterMinX = std::max(dfBlockMinX, dfMinX);
+                const double dfInterMinY = std::max(dfBlockMinY, dfMinY);
+                const double dfInterMaxX = std::min(dfBlockMaxX, dfMaxX);
+                const double dfInterMaxY = std::min(dfBlockMaxY, dfMaxY);
+
+                // Min/max indices in the super grid
+                const int nMinSrcX = std::max(
+                    0, static_cast<int>((dfInterMinX - dfMinX) / rgrid.fResX));
+                const int nMinSrcY = std::max(
+                    0, static_cast<int>((dfInterMinY - dfMinY) / rgrid.fResY));
+                // Need to use ceil due to numerical imprecision
+                const int nMaxSrcX = std::min(
+                    static_cast<int>(rgrid.nWidth) - 1,
+                    static_cast<int>(
+                        std::ceil((dfInterMaxX - dfMinX) / rgrid.fResX)));
+                const int nMaxSrcY = std::min(
+                    static_cast<int>(rgrid.nHeight) - 1,
+                    static_cast<int>(
+                        std::ceil((dfInterMaxY - dfMinY) / rgrid.fResY)));
+#ifdef DEBUG_VERBOSE
+                CPLDebug("BAG",
+                         "y = %d, x = %d, minx = %d, miny = %d, maxx = %d, "
+                         "maxy = %d",
+                         y, x, nMinSrcX, nMinSrcY, nMaxSrcX, nMaxSrcY);
+#endif
+                const double dfCstX =
+                    (dfMinX - dfBlockMinX) / poGDS->adfGeoTransform[1];
+                const double dfMulX = rgrid.fResX / poGDS->adfGeoTransform[1];
 
-                const unsigned nTargetIdxBase = nTargetY * nBlockXSize;
-                const unsigned nRefinementIndexase =
-                    rgrid.nIndex + super_y * rgrid.nWidth;
-
-                for (int super_x = nMinSrcX; super_x <= nMaxSrcX; super_x++)
+                for (int super_y = nMinSrcY; super_y <= nMaxSrcY; super_y++)
                 {
-                    /*
-                    const double dfSrcX = dfMinX + super_x * rgrid.fResX;
-                    const int nTargetX = static_cast<int>(std::floor(
-                        (dfSrcX - dfBlockMinX) / poGDS->adfGeoTransform[1]));
-                    */
-                    const int nTargetX =
-                        static_cast<int>(std::floor(dfCstX + super_x * dfMulX));
-                    if (!(nTargetX >= 0 && nTargetX < nReqCountX))
+                    const double dfSrcY =
+                        dfMinY + super_y * static_cast<double>(rgrid.fResY);
+                    const int nTargetY = static_cast<int>(std::floor(
+                        (dfBlockMaxY - dfSrcY) / -poGDS->adfGeoTransform[5]));
+                    if (!(nTargetY >= nYStart && nTargetY < nYEnd))
                     {
                         continue;
                     }
 
-                    const unsigned nTargetIdx = nTargetIdxBase + nTargetX;
-                    if (poGDS->m_bMask)
-                    {
-                        static_cast<GByte *>(pImage)[nTargetIdx] = 255;
-                        continue;
-                    }
+                    const unsigned nTargetIdxBase = nTargetY * nBlockXSize;
+                    const size_t nRefinementIdxBase =
+                        static_cast<size_t>(super_y) * rgrid.nWidth;
 
-                    if (poGDS->m_ePopulation == BAGDataset::Population::COUNT)
+                    for (int super_x = nMinSrcX; super_x <= nMaxSrcX;
+                         super_x++)
                     {
-                        static_cast<GUInt32 *>(pImage)[nTargetIdx]++;
-                        continue;
-                    }
-
-                    CPLAssert(depthsPtr);
-                    CPLAssert(uncrtPtr);
+                        /*
+                        const double dfSrcX = dfMinX + super_x * rgrid.fResX;
+                        const int nTargetX = static_cast<int>(std::floor(
+                            (dfSrcX - dfBlockMinX) /
+                            poGDS->adfGeoTransform[1]));
+                        */
+                        const int nTargetX = static_cast<int>(
+                            std::floor(dfCstX + super_x * dfMulX));
+                        if (!(nTargetX >= 0 && nTargetX < nReqCountX))
+                        {
+                            continue;
+                        }
 
-                    const unsigned nRefinementIndex =
-                        nRefinementIndexase + super_x;
-                    const auto *pafRefValues =
-                        poGDS->GetRefinementValues(nRefinementIndex);
-                    if (!pafRefValues)
-                    {
-                        eErr = CE_Failure;
-                        goto end;
-                    }
+                        const unsigned nTargetIdx = nTargetIdxBase + nTargetX;
+                        if (poGDS->m_bMask)
+                        {
+                            static_cast<GByte *>(pImage)[nTargetIdx] = 255;
+                            continue;
+                        }
 
-                    float depth = pafRefValues[0];
-                    if (depth == fNoDataValue)
-                    {
-                        if (depthsPtr[nTargetIdx] == fNoSuperGridValue)
+                        if (poGDS->m_ePopulation ==
+                            BAGDataset::Population::COUNT)
                         {
-                            depthsPtr[nTargetIdx] = fNoDataValue;
+                            static_cast<GUInt32 *>(pImage)[nTargetIdx]++;
+                            continue;
                         }
-                        continue;
-                    }
 
-                    if (poGDS->m_ePopulation == BAGDataset::Population::MEAN)
-                    {
+                        CPLAssert(depthsPtr);
+                        CPLAssert(uncrtPtr);
+                        CPLAssert(pafSuperGridValues);
+
+                        const float *pafRefValues =
+                            pafSuperGridValues +
+                            2 * (nRefinementIdxBase + super_x);
 
-                        if (counts[nTargetIdx] == 0)
+                        float depth = pafRefValues[0];
+                        if (depth == fNoDataValue)
                         {
-                            depthsPtr[nTargetIdx] = depth;
+                            if (depthsPtr[nTargetIdx] == fNoSuperGridValue)
+                            {
+                                depthsPtr[nTargetIdx] = fNoDataValue;
+                            }
+                            continue;
                         }
-                        else
+
+                        if (poGDS->m_ePopulation ==
+                            BAGDataset::Population::MEAN)
                         {
-                            depthsPtr[nTargetIdx] += depth;
-                        }
-                        counts[nTargetIdx]++;
 
-                        auto uncrt = pafRefValues[1];
-                        auto &target_uncrt_ptr = uncrtPtr[nTargetIdx];
-                        if (uncrt > target_uncrt_ptr ||
-                            target_uncrt_ptr == fNoDataValue)
+                            if (counts[nTargetIdx] == 0)
+                            {
+                                depthsPtr[nTargetIdx] = depth;
+                            }
+                            else
+                            {
+                                depthsPtr[nTargetIdx] += depth;
+                            }
+                            counts[nTargetIdx]++;
+
+                            auto uncrt = pafRefValues[1];
+                            auto &target_uncrt_ptr = uncrtPtr[nTargetIdx];
+                            if (uncrt > target_uncrt_ptr ||
+                                target_uncrt_ptr == fNoDataValue)
+                            {
+                                target_uncrt_ptr = uncrt;
+                            }
+                        }
+                        else if ((poGDS->m_ePopulation ==
+                                      BAGDataset::Population::MAX &&
+                                  depth > depthsPtr[nTargetIdx]) ||
+                                 (poGDS->m_ePopulation ==
+                                      BAGDataset::Population::MIN &&
+                                  depth < depthsPtr[nTargetIdx]) ||
+                                 depthsPtr[nTargetIdx] == fNoDataValue ||
+                                 depthsPtr[nTargetIdx] == fNoSuperGridValue)
                         {
-                            target_uncrt_ptr = uncrt;
+                            depthsPtr[nTargetIdx] = depth;
+                            uncrtPtr[nTargetIdx] = pafRefValues[1];
                         }
                     }
-                    else if ((poGDS->m_ePopulation ==
-                                  BAGDataset::Population::MAX &&
-                              depth > depthsPtr[nTargetIdx]) ||
-                             (poGDS->m_ePopulation ==
-                                  BAGDataset::Population::MIN &&
-                              depth < depthsPtr[nTargetIdx]) ||
-                             depthsPtr[nTargetIdx] == fNoDataValue ||
-                             depthsPtr[nTargetIdx] == fNoSuperGridValue)
-                    {
-                        depthsPtr[nTargetIdx] = depth;
-                        uncrtPtr[nTargetIdx] = pafRefValues[1];
-                    }
                 }
             }
         }
-    }
+    };
+
+    ProcessRowsInParallel(nReqCountY, ProcessRows);
 
     if (poGDS->m_ePopulation == BAGDataset::Population::MEAN && depthsPtr)
     {
@@ -1469,14 +1557,13 @@ CPLErr BAGResampledBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
-end:
     if (poBlock != nullptr)
     {
         poBlock->DropLock();
         poBlock = nullptr;
     }
 
-    return eErr;
+    return CE_None;
 }
 
 /************************************************************************/
@@ -1747,362 +1834,392 @@ CPLErr BAGInterpolatedBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 
     H5Sclose(memspaceVarresMD);
 
-    CPLErr eErr = CE_None;
+    // Fetch the refinement values of all the supergrids intersecting the
+    // block beforehand, so that the block can then be computed in parallel
+    // without involving libhdf5.
+    std::vector<BAGDataset::SuperGridValues> apoValues;
+    if (!poGDS->GetSuperGridValues(rgrids, apoValues))
+    {
+        if (poBlock != nullptr)
+        {
+            poBlock->DropLock();
+            poBlock = nullptr;
+        }
+        return CE_Failure;
+    }
+
     const double dfLowResMinX = poGDS->m_dfLowResMinX;
     const double dfLowResMinY = poGDS->m_dfLowResMinY;
 
-    // georeferenced (X,Y) coordinates of the source nodes from the refinement
-    //grids
-    std::vector<double> adfX, adfY;
-    // Depth and uncertainty values from the source nodes from the refinement
-    //grids
-    std::vector<float> afDepth, afUncrt;
-    // Work variable to sort adfX, adfY, afDepth, afUncrt w.r.t to their
-    // distance with the (dfX, dfY) point to be interpolated
-    std::vector<int> anIndices;
-
     // Maximum distance of candidate source nodes to the point to be
     // interpolated
     const double dfMaxDistance = 0.5 * std::max(dfLowResResX, dfLowResResY);
 
-    for (int y = 0; y < nReqCountY; ++y)
+    // Only writes the target rows in [nYStart, nYEnd[
+    const auto ProcessRows = [&](int nYStart, int nYEnd)
     {
-        // Y georeference ordinate of the center of the cell to interpolate
-        const double dfY = dfBlockMaxY + (y + 0.5) * poGDS->adfGeoTransform[5];
-        // Y index of the corresponding refinement grid
-        const int iYRefinedGrid =
-            static_cast<int>(floor((dfY - dfLowResMinY) / dfLowResResY));
-        if (iYRefinedGrid < nLowResMinIdxY || iYRefinedGrid > nLowResMaxIdxY)
-            continue;
-        for (int x = 0; x < nReqCountX; ++x)
-        {
-            // X georeference ordinate of the center of the cell to interpolate
-            const double dfX =
-                dfBlockMinX + (x + 0.5) * poGDS->adfGeoTransform[1];
-            // X index of the corresponding refinement grid
-            const int iXRefinedGrid =
-                static_cast<int>((dfX - dfLowResMinX) / dfLowResResX);
-            if (iXRefinedGrid < nLowResMinIdxX ||
-                iXRefinedGrid > nLowResMaxIdxX)
-                continue;
+        // georeferenced (X,Y) coordinates of the source nodes from the
+        // refinement grids
+        std::vector<double> adfX, adfY;
+        // Depth and uncertainty values from the source nodes from the
+        // refinement grids
+        std::vector<float> afDepth, afUncrt;
+        // Work variable to sort adfX, adfY, afDepth, afUncrt w.r.t to their
+        // distance with the (dfX, dfY) point to be interpolated
+        std::vector<int> anIndices;
 
-            // Correspond refinement grid
-            const auto &rgrid =
-                rgrids[(iYRefinedGrid - nLowResMinIdxY) * nCountLowResX +
-                       (iXRefinedGrid - nLowResMinIdxX)];
-            if (rgrid.nWidth == 0)
-            {
+        for (int y = nYStart; y < nYEnd; ++y)
+        {
+            // Y georeference ordinate of the center of the cell to
+            // interpolate
+            const double dfY =
+                dfBlockMaxY + (y + 0.5) * poGDS->adfGeoTransform[5];
+            // Y index of the corresponding refinement grid
+            const int iYRefinedGrid =
+                static_cast<int>(floor((dfY - dfLowResMinY) / dfLowResResY));
+            if (iYRefinedGrid < nLowResMinIdxY ||
+                iYRefinedGrid > nLowResMaxIdxY)
                 continue;
-            }
-            const float gridRes = std::max(rgrid.fResX, rgrid.fResY);
-            if (!(gridRes > poGDS->m_dfResFilterMin &&
-                  gridRes <= poGDS->m_dfResFilterMax))
+            for (int x = 0; x < nReqCountX; ++x)
             {
-                continue;
-            }
+                // X georeference ordinate of the center of the cell to
+                // interpolate
+                const double dfX =
+                    dfBlockMinX + (x + 0.5) * poGDS->adfGeoTransform[1];
+                // X index of the corresponding refinement grid
+                const int iXRefinedGrid =
+                    static_cast<int>((dfX - dfLowResMinX) / dfLowResResX);
+                if (iXRefinedGrid < nLowResMinIdxX ||
+                    iXRefinedGrid > nLowResMaxIdxX)
+                    continue;
 
-            // (dfMinRefinedX, dfMinRefinedY) is the georeferenced coordinate
-            // of the bottom-left corner of the refinement grid
-            const double dfMinRefinedX =
-                dfLowResMinX + iXRefinedGrid * dfLowResResX + rgrid.fSWX;
-            const double dfMinRefinedY =
-                dfLowResMinY + iYRefinedGrid * dfLowResResY + rgrid.fSWY;
-
-            // (iXInRefinedGrid, iYInRefinedGrid) is the index of the cell
-            // within the refinement grid into which (dfX, dfY) falls into.
-            const int iXInRefinedGrid =
-                static_cast<int>(floor((dfX - dfMinRefinedX) / rgrid.fResX));
-            const int iYInRefinedGrid =
-                static_cast<int>(floor((dfY - dfMinRefinedY) / rgrid.fResY));
-
-            if (iXInRefinedGrid >= 0 &&
-                iXInRefinedGrid < static_cast<int>(rgrid.nWidth) - 1 &&
-                iYInRefinedGrid >= 0 &&
-                iYInRefinedGrid < static_cast<int>(rgrid.nHeight) - 1)
-            {
-                // The point to interpolate is fully within a single refinement
-                // grid
-                const unsigned nRefinementIndexBase =
-                    rgrid.nIndex + iYInRefinedGrid * rgrid.nWidth +
-                    iXInRefinedGrid;
-                float d[2][2];
-                float u[2][2];
-                int nCountNoData = 0;
-
-                // Load the depth and uncertainty values of the 4 nodes of
-                // the refinement grid surrounding the center of the target
-                // cell.
-                for (int j = 0; j < 2; ++j)
+                // Correspond refinement grid
+                const size_t iGrid =
+                    static_cast<size_t>(iYRefinedGrid - nLowResMinIdxY) *
+                        nCountLowResX +
+                    (iXRefinedGrid - nLowResMinIdxX);
+                const auto &rgrid = rgrids[iGrid];
+                if (!apoValues[iGrid])
                 {
-                    for (int i = 0; i < 2; ++i)
+                    // No supergrid, or filtered out by resolution
+                    continue;
+                }
+
+                // (dfMinRefinedX, dfMinRefinedY) is the georeferenced
+                // coordinate of the bottom-left corner of the refinement grid
+                const double dfMinRefinedX =
+                    dfLowResMinX + iXRefinedGrid * dfLowResResX + rgrid.fSWX;
+                const double dfMinRefinedY =
+                    dfLowResMinY + iYRefinedGrid * dfLowResResY + rgrid.fSWY;
+
+                // (iXInRefinedGrid, iYInRefinedGrid) is the index of the cell
+                // within the refinement grid into which (dfX, dfY) falls into.
+                const int iXInRefinedGrid = static_cast<int>(
+                    floor((dfX - dfMinRefinedX) / rgrid.fResX));
+                const int iYInRefinedGrid = static_cast<int>(
+                    floor((dfY - dfMinRefinedY) / rgrid.fResY));
+
+                if (iXInRefinedGrid >= 0 &&
+                    iXInRefinedGrid < static_cast<int>(rgrid.nWidth) - 1 &&
+                    iYInRefinedGrid >= 0 &&
+                    iYInRefinedGrid < static_cast<int>(rgrid.nHeight) - 1)
+                {
+                    // The point to interpolate is fully within a single
+                    // refinement grid
+                    const float *pafRefValuesBase =
+                        apoValues[iGrid]->data() +
+                        2 * (static_cast<size_t>(iYInRefinedGrid) *
+                                 rgrid.nWidth +
+                             iXInRefinedGrid);
+                    float d[2][2];
+                    float u[2][2];
+                    int nCountNoData = 0;
+
+                    // Load the depth and uncertainty values of the 4 nodes of
+                    // the refinement grid surrounding the center of the target
+                    // cell.
+                    for (int j = 0; j < 2; ++j)
                     {
-                        const unsigned nRefinementIndex =
-                            nRefinementIndexBase + j * rgrid.nWidth + i;
-                        const auto pafRefValues =
-                            poGDS->GetRefinementValues(nRefinementIndex);
-                        if (!pafRefValues)
+                        for (int i = 0; i < 2; ++i)
                         {
-                            eErr = CE_Failure;
-                            goto end;
+                            const float *pafRefValues =
+                                pafRefValuesBase +
+                                2 * (static_cast<size_t>(j) * rgrid.nWidth + i);
+                            d[j][i] = pafRefValues[0];
+                            u[j][i] = pafRefValues[1];
+                            if (d[j][i] == m_fNoDataValue)
+                                ++nCountNoData;
                         }
-                        d[j][i] = pafRefValues[0];
-                        u[j][i] = pafRefValues[1];
-                        if (d[j][i] == m_fNoDataValue)
-                            ++nCountNoData;
                     }
-                }
 
-                // Compute the relative distance of the point to be
-                // interpolated compared to the closest bottom-left most node
-                // of the refinement grid.
-                // (alphaX,alphaY)=(0,0): point to be interpolated matches the
-                // closest bottom-left most node
-                // (alphaX,alphaY)=(1,1): point to be interpolated matches the
-                // closest top-right most node
-                const double alphaX =
-                    fmod(dfX - dfMinRefinedX, rgrid.fResX) / rgrid.fResX;
-                const double alphaY =
-                    fmod(dfY - dfMinRefinedY, rgrid.fResY) / rgrid.fResY;
-                if (nCountNoData == 0)
-                {
-                    // If the 4 nodes of the supergrid around the point
-                    // to be interpolated are valid, do bilinear interpolation
+                    // Compute the relative distance of the point to be
+                    // interpolated compared to the closest bottom-left most
+                    // node of the refinement grid.
+                    // (alphaX,alphaY)=(0,0): point to be interpolated matches
+                    // the closest bottom-left most node
+                    // (alphaX,alphaY)=(1,1): point to be interpolated matches
+                    // the closest top-right most node
+                    const double alphaX =
+                        fmod(dfX - dfMinRefinedX, rgrid.fResX) / rgrid.fResX;
+                    const double alphaY =
+                        fmod(dfY - dfMinRefinedY, rgrid.fResY) / rgrid.fResY;
+                    if (nCountNoData == 0)
+                    {
+                        // If the 4 nodes of the supergrid around the point
+                        // to be interpolated are valid, do bilinear
+                        // interpolation
 #define BILINEAR_INTERP(var)                                                   \
     ((1 - alphaY) * ((1 - alphaX) * var[0][0] + alphaX * var[0][1]) +          \
      alphaY * ((1 - alphaX) * var[1][0] + alphaX * var[1][1]))
 
-                    depthsPtr[y * nBlockXSize + x] =
-                        static_cast<float>(BILINEAR_INTERP(d));
-                    uncrtPtr[y * nBlockXSize + x] =
-                        static_cast<float>(BILINEAR_INTERP(u));
-                }
-                else if (nCountNoData == 1)
-                {
-                    // If only one of the 4 nodes is at nodata, determine if the
-                    // point to be interpolated is within the triangle formed
-                    // by the remaining 3 valid nodes.
-                    // If so, do barycentric interpolation
-                    adfX.resize(3);
-                    adfY.resize(3);
-                    afDepth.resize(3);
-                    afUncrt.resize(3);
-
-                    int idx = 0;
-                    for (int j = 0; j < 2; ++j)
+                        depthsPtr[y * nBlockXSize + x] =
+                            static_cast<float>(BILINEAR_INTERP(d));
+                        uncrtPtr[y * nBlockXSize + x] =
+                            static_cast<float>(BILINEAR_INTERP(u));
+                    }
+                    else if (nCountNoData == 1)
                     {
-                        for (int i = 0; i < 2; ++i)
+                        // If only one of the 4 nodes is at nodata, determine
+                        // if the point to be interpolated is within the
+                        // triangle formed by the remaining 3 valid nodes.
+                        // If so, do barycentric interpolation
+                        adfX.resize(3);
+                        adfY.resize(3);
+                        afDepth.resize(3);
+                        afUncrt.resize(3);
+
+                        int idx = 0;
+                        for (int j = 0; j < 2; ++j)
                         {
-                            if (d[j][i] != m_fNoDataValue)
+                            for (int i = 0; i < 2; ++i)
                             {
-                                CPLAssert(idx < 3);
-                                adfX[idx] = i;
-                                adfY[idx] = j;
-                                afDepth[idx] = d[j][i];
-                                afUncrt[idx] = u[j][i];
-                                ++idx;
+                                if (d[j][i] != m_fNoDataValue)
+                                {
+                                    CPLAssert(idx < 3);
+                                    adfX[idx] = i;
+                                    adfY[idx] = j;
+                                    afDepth[idx] = d[j][i];
+                                    afUncrt[idx] = u[j][i];
+                                    ++idx;
+                                }
                             }
                         }
+                        CPLAssert(idx == 3);
+                        double dfCoord0;
+                        double dfCoord1;
+                        double dfCoord2;
+                        if (BarycentricInterpolation(
+                                alphaX, alphaY, adfX.data(), adfY.data(),
+                                dfCoord0, dfCoord1, dfCoord2))
+                        {
+                            // Inside triangle
+                            depthsPtr[y * nBlockXSize + x] =
+                                static_cast<float>(dfCoord0 * afDepth[0] +
+                                                   dfCoord1 * afDepth[1] +
+                                                   dfCoord2 * afDepth[2]);
+                            uncrtPtr[y * nBlockXSize + x] =
+                                static_cast<float>(dfCoord0 * afUncrt[0] +
+                                                   dfCoord1 * afUncrt[1] +
+                                                   dfCoord2 * afUncrt[2]);
+                        }
                     }
-                    CPLAssert(idx == 3);
-                    double dfCoord0;
-                    double dfCoord1;
-                    double dfCoord2;
-                    if (BarycentricInterpolation(alphaX, alphaY, adfX.data(),
-                                                 adfY.data(), dfCoord0,
-                                                 dfCoord1, dfCoord2))
-                    {
-                        // Inside triangle
-                        depthsPtr[y * nBlockXSize + x] = static_cast<float>(
-                            dfCoord0 * afDepth[0] + dfCoord1 * afDepth[1] +
-                            dfCoord2 * afDepth[2]);
-                        uncrtPtr[y * nBlockXSize + x] = static_cast<float>(
-                            dfCoord0 * afUncrt[0] + dfCoord1 * afUncrt[1] +
-                            dfCoord2 * afUncrt[2]);
-                    }
+                    // else: 2 or more nodes invalid. Target point is set at
+                    // nodata
                 }
-                // else: 2 or more nodes invalid. Target point is set at nodata
-            }
-            else
-            {
-                // Point to interpolate is on an edge or corner of the
-                // refinement grid
-                adfX.clear();
-                adfY.clear();
-                afDepth.clear();
-                afUncrt.clear();
-
-                const auto LoadValues =
-                    [this, dfX, dfY, &rgrids, nLowResMinIdxX, nLowResMinIdxY,
-                     nCountLowResX, nCountLowResY, dfLowResMinX, dfLowResMinY,
-                     dfLowResResX, dfLowResResY, &adfX, &adfY, &afDepth,
-                     &afUncrt](int iX, int iY)
-                {
-                    LoadClosestRefinedNodes(
-                        dfX, dfY, iX, iY, rgrids, nLowResMinIdxX,
-                        nLowResMinIdxY, nCountLowResX, nCountLowResY,
-                        dfLowResMinX, dfLowResMinY, dfLowResResX, dfLowResResY,
-                        adfX, adfY, afDepth, afUncrt);
-                };
-
-                // Load values of the closest point to the point to be
-                // interpolated in the current refinement grid
-                LoadValues(iXRefinedGrid, iYRefinedGrid);
-
-                const bool bAtLeft = iXInRefinedGrid < 0 && iXRefinedGrid > 0;
-                const bool bAtRight =
-                    iXInRefinedGrid >= static_cast<int>(rgrid.nWidth) - 1 &&
-                    iXRefinedGrid + 1 < poGDS->m_nLowResWidth;
-                const bool bAtBottom = iYInRefinedGrid < 0 && iYRefinedGrid > 0;
-                const bool bAtTop =
-                    iYInRefinedGrid >= static_cast<int>(rgrid.nHeight) - 1 &&
-                    iYRefinedGrid + 1 < poGDS->m_nLowResHeight;
-                const int nXShift = bAtLeft ? -1 : bAtRight ? 1 : 0;
-                const int nYShift = bAtBottom ? -1 : bAtTop ? 1 : 0;
-
-                // Load values of the closest point to the point to be
-                // interpolated in the surrounding refinement grids.
-                if (nXShift)
+                else
                 {
-                    LoadValues(iXRefinedGrid + nXShift, iYRefinedGrid);
-                    if (nYShift)
+                    // Point to interpolate is on an edge or corner of the
+                    // refinement grid
+                    adfX.clear();
+                    adfY.clear();
+                    afDepth.clear();
+                    afUncrt.clear();
+
+                    const auto LoadValues =
+                        [this, dfX, dfY, &rgrids, &apoValues, nLowResMinIdxX,
+                         nLowResMinIdxY, nCountLowResX, nCountLowResY,
+                         dfLowResMinX, dfLowResMinY, dfLowResResX,
+                         dfLowResResY, &adfX, &adfY, &afDepth,
+                         &afUncrt](int iX, int iY)
                     {
-                        LoadValues(iXRefinedGrid + nXShift,
-                                   iYRefinedGrid + nYShift);
+                        LoadClosestRefinedNodes(
+                            dfX, dfY, iX, iY, rgrids, apoValues,
+                            nLowResMinIdxX, nLowResMinIdxY, nCountLowResX,
+                            nCountLowResY, dfLowResMinX, dfLowResMinY,
+                            dfLowResResX, dfLowResResY, adfX, adfY, afDepth,
+                            afUncrt);
+                    };
+
+                    // Load values of the closest point to the point to be
+                    // interpolated in the current refinement grid
+                    LoadValues(iXRefinedGrid, iYRefinedGrid);
+
+                    const bool bAtLeft =
+                        iXInRefinedGrid < 0 && iXRefinedGrid > 0;
+                    const bool bAtRight =
+                        iXInRefinedGrid >=
+                            static_cast<int>(rgrid.nWidth) - 1 &&
+                        iXRefinedGrid + 1 < poGDS->m_nLowResWidth;
+                    const bool bAtBottom =
+                        iYInRefinedGrid < 0 && iYRefinedGrid > 0;
+                    const bool bAtTop =
+                        iYInRefinedGrid >=
+                            static_cast<int>(rgrid.nHeight) - 1 &&
+                        iYRefinedGrid + 1 < poGDS->m_nLowResHeight;
+                    const int nXShift = bAtLeft ? -1 : bAtRight ? 1 : 0;
+                    const int nYShift = bAtBottom ? -1 : bAtTop ? 1 : 0;
+
+                    // Load values of the closest point to the point to be
+                    // interpolated in the surrounding refinement grids.
+                    if (nXShift)
+                    {
+                        LoadValues(iXRefinedGrid + nXShift, iYRefinedGrid);
+                        if (nYShift)
+                        {
+                            LoadValues(iXRefinedGrid + nXShift,
+                                       iYRefinedGrid + nYShift);
+                        }
                     }
-                }
-                if (nYShift)
-                {
-                    LoadValues(iXRefinedGrid, iYRefinedGrid + nYShift);
-                }
-
-                // Filter out candidate source points that are away from
-                // target point of more than dfMaxDistance
-                size_t j = 0;
-                for (size_t i = 0; i < adfX.size(); ++i)
-                {
-                    if (SQ(adfX[i] - dfX) + SQ(adfY[i] - dfY) <=
-                        dfMaxDistance * dfMaxDistance)
+                    if (nYShift)
                     {
-                        adfX[j] = adfX[i];
-                        adfY[j] = adfY[i];
-                        afDepth[j] = afDepth[i];
-                        afUncrt[j] = afUncrt[i];
-                        ++j;
+                        LoadValues(iXRefinedGrid, iYRefinedGrid + nYShift);
                     }
-                }
-                adfX.resize(j);
-                adfY.resize(j);
-                afDepth.resize(j);
-                afUncrt.resize(j);
-
-                // Now interpolate the target point from the source values
-                bool bTryIDW = false;
-                if (adfX.size() >= 3)
-                {
-                    // If there are at least 3 source nodes, sort them
-                    // by increasing distance w.r.t the point to be interpolated
-                    anIndices.clear();
+
+                    // Filter out candidate source points that are away from
+                    // target point of more than dfMaxDistance
+                    size_t j = 0;
                     for (size_t i = 0; i < adfX.size(); ++i)
-                        anIndices.push_back(static_cast<int>(i));
-                    // Sort nodes by increasing distance w.r.t (dfX, dfY)
-                    std::sort(
-                        anIndices.begin(), anIndices.end(),
-                        [&adfX, &adfY, dfX, dfY](int i1, int i2)
-                        {
-                            return SQ(adfX[i1] - dfX) + SQ(adfY[i1] - dfY) <
-                                   SQ(adfX[i2] - dfX) + SQ(adfY[i2] - dfY);
-                        });
-                    double adfXSorted[3];
-                    double adfYSorted[3];
-                    float afDepthSorted[3];
-                    float afUncrtSorted[3];
-                    for (int i = 0; i < 3; ++i)
                     {
-                        adfXSorted[i] = adfX[anIndices[i]];
-                        adfYSorted[i] = adfY[anIndices[i]];
-                        afDepthSorted[i] = afDepth[anIndices[i]];
-                        afUncrtSorted[i] = afUncrt[anIndices[i]];
+                        if (SQ(adfX[i] - dfX) + SQ(adfY[i] - dfY) <=
+                            dfMaxDistance * dfMaxDistance)
+                        {
+                            adfX[j] = adfX[i];
+                            adfY[j] = adfY[i];
+                            afDepth[j] = afDepth[i];
+                            afUncrt[j] = afUncrt[i];
+                            ++j;
+                        }
                     }
-                    double dfCoord0;
-                    double dfCoord1;
-                    double dfCoord2;
-                    // Perform barycentric interpolation with those 3
-                    // points if they are all valid, and if the point to
-                    // be interpolated falls into it.
-                    if (afDepthSorted[0] != m_fNoDataValue &&
-                        afDepthSorted[1] != m_fNoDataValue &&
-                        afDepthSorted[2] != m_fNoDataValue)
+                    adfX.resize(j);
+                    adfY.resize(j);
+                    afDepth.resize(j);
+                    afUncrt.resize(j);
+
+                    // Now interpolate the target point from the source values
+                    bool bTryIDW = false;
+                    if (adfX.size() >= 3)
                     {
-                        if (BarycentricInterpolation(dfX, dfY, adfXSorted,
-                                                     adfYSorted, dfCoord0,
-                                                     dfCoord1, dfCoord2))
+                        // If there are at least 3 source nodes, sort them
+                        // by increasing distance w.r.t the point to be
+                        // interpolated
+                        anIndices.clear();
+                        for (size_t i = 0; i < adfX.size(); ++i)
+                            anIndices.push_back(static_cast<int>(i));
+                        // Sort nodes by increasing distance w.r.t (dfX, dfY)
+                        std::sort(
+                            anIndices.begin(), anIndices.end(),
+                            [&adfX, &adfY, dfX, dfY](int i1, int i2)
+                            {
+                                return SQ(adfX[i1] - dfX) + SQ(adfY[i1] - dfY) <
+                                       SQ(adfX[i2] - dfX) + SQ(adfY[i2] - dfY);
+                            });
+                        double adfXSorted[3];
+                        double adfYSorted[3];
+                        float afDepthSorted[3];
+                        float afUncrtSorted[3];
+                        for (int i = 0; i < 3; ++i)
                         {
-                            // Inside triangle
-                            depthsPtr[y * nBlockXSize + x] =
-                                static_cast<float>(dfCoord0 * afDepthSorted[0] +
-                                                   dfCoord1 * afDepthSorted[1] +
-                                                   dfCoord2 * afDepthSorted[2]);
-                            uncrtPtr[y * nBlockXSize + x] =
-                                static_cast<float>(dfCoord0 * afUncrtSorted[0] +
-                                                   dfCoord1 * afUncrtSorted[1] +
-                                                   dfCoord2 * afUncrtSorted[2]);
+                            adfXSorted[i] = adfX[anIndices[i]];
+                            adfYSorted[i] = adfY[anIndices[i]];
+                            afDepthSorted[i] = afDepth[anIndices[i]];
+                            afUncrtSorted[i] = afUncrt[anIndices[i]];
                         }
-                        else
+                        double dfCoord0;
+                        double dfCoord1;
+                        double dfCoord2;
+                        // Perform barycentric interpolation with those 3
+                        // points if they are all valid, and if the point to
+                        // be interpolated falls into it.
+                        if (afDepthSorted[0] != m_fNoDataValue &&
+                            afDepthSorted[1] != m_fNoDataValue &&
+                            afDepthSorted[2] != m_fNoDataValue)
                         {
-                            // Attempt inverse distance weighting in the
-                            // cases where the point to be interpolated doesn't
-                            // fall within the triangle formed by the 3
-                            // closes points.
-                            bTryIDW = true;
+                            if (BarycentricInterpolation(dfX, dfY, adfXSorted,
+                                                         adfYSorted, dfCoord0,
+                                                         dfCoord1, dfCoord2))
+                            {
+                                // Inside triangle
+                                depthsPtr[y * nBlockXSize + x] =
+                                    static_cast<float>(
+                                        dfCoord0 * afDepthSorted[0] +
+                                        dfCoord1 * afDepthSorted[1] +
+                                        dfCoord2 * afDepthSorted[2]);
+                                uncrtPtr[y * nBlockXSize + x] =
+                                    static_cast<float>(
+                                        dfCoord0 * afUncrtSorted[0] +
+                                        dfCoord1 * afUncrtSorted[1] +
+                                        dfCoord2 * afUncrtSorted[2]);
+                            }
+                            else
+                            {
+                                // Attempt inverse distance weighting in the
+                                // cases where the point to be interpolated
+                                // doesn't fall within the triangle formed by
+                                // the 3 closes points.
+                                bTryIDW = true;
+                            }
                         }
                     }
-                }
-                if (bTryIDW)
-                {
-                    // Do inverse distance weighting a a fallback.
-
-                    int nCountValid = 0;
-                    double dfTotalDepth = 0;
-                    double dfTotalUncrt = 0;
-                    double dfTotalWeight = 0;
-                    // Epsilon value to add to weights to avoid potential
-                    // divergence to infinity if a source node is too close
-                    // to the target point
-                    const double EPS = SQ(std::min(poGDS->adfGeoTransform[1],
-                                                   -poGDS->adfGeoTransform[5]) /
-                                          10);
-                    for (size_t i = 0; i < adfX.size(); ++i)
+                    if (bTryIDW)
                     {
-                        if (afDepth[i] != m_fNoDataValue)
+                        // Do inverse distance weighting a a fallback.
+
+                        int nCountValid = 0;
+                        double dfTotalDepth = 0;
+                        double dfTotalUncrt = 0;
+                        double dfTotalWeight = 0;
+                        // Epsilon value to add to weights to avoid potential
+                        // divergence to infinity if a source node is too close
+                        // to the target point
+                        const double EPS =
+                            SQ(std::min(poGDS->adfGeoTransform[1],
+                                        -poGDS->adfGeoTransform[5]) /
+                               10);
+                        for (size_t i = 0; i < adfX.size(); ++i)
                         {
-                            nCountValid++;
-                            double dfSqrDistance =
-                                SQ(adfX[i] - dfX) + SQ(adfY[i] - dfY) + EPS;
-                            double dfWeight = 1. / dfSqrDistance;
-                            dfTotalDepth += dfWeight * afDepth[i];
-                            dfTotalUncrt += dfWeight * afUncrt[i];
-                            dfTotalWeight += dfWeight;
+                            if (afDepth[i] != m_fNoDataValue)
+                            {
+                                nCountValid++;
+                                double dfSqrDistance =
+                                    SQ(adfX[i] - dfX) + SQ(adfY[i] - dfY) + EPS;
+                                double dfWeight = 1. / dfSqrDistance;
+                                dfTotalDepth += dfWeight * afDepth[i];
+                                dfTotalUncrt += dfWeight * afUncrt[i];
+                                dfTotalWeight += dfWeight;
+                            }
+                        }
+                        if (nCountValid >= 3)
+                        {
+                            depthsPtr[y * nBlockXSize + x] = static_cast<float>(
+                                dfTotalDepth / dfTotalWeight);
+                            uncrtPtr[y * nBlockXSize + x] = static_cast<float>(
+                                dfTotalUncrt / dfTotalWeight);
                         }
-                    }
-                    if (nCountValid >= 3)
-                    {
-                        depthsPtr[y * nBlockXSize + x] =
-                            static_cast<float>(dfTotalDepth / dfTotalWeight);
-                        uncrtPtr[y * nBlockXSize + x] =
-                            static_cast<float>(dfTotalUncrt / dfTotalWeight);
                     }
                 }
             }
         }
-    }
-end:
+    };
+
+    ProcessRowsInParallel(nReqCountY, ProcessRows);
+
     if (poBlock != nullptr)
     {
         poBlock->DropLock();
         poBlock = nullptr;
     }
 
-    return eErr;
+    return CE_None;
 }
 
 /************************************************************************/
@@ -2111,31 +2228,29 @@ end:
 
 void BAGInterpolatedBand::LoadClosestRefinedNodes(
     double dfX, double dfY, int iXRefinedGrid, int iYRefinedGrid,
-    const std::vector<BAGRefinementGrid> &rgrids, int nLowResMinIdxX,
-    int nLowResMinIdxY, int nCountLowResX, int nCountLowResY,
-    double dfLowResMinX, double dfLowResMinY, double dfLowResResX,
-    double dfLowResResY, std::vector<double> &adfX, std::vector<double> &adfY,
-    std::vector<float> &afDepth, std::vector<float> &afUncrt)
+    const std::vector<BAGRefinementGrid> &rgrids,
+    const std::vector<BAGDataset::SuperGridValues> &apoValues,
+    int nLowResMinIdxX, int nLowResMinIdxY, int nCountLowResX,
+    int nCountLowResY, double dfLowResMinX, double dfLowResMinY,
+    double dfLowResResX, double dfLowResResY, std::vector<double> &adfX,
+    std::vector<double> &adfY, std::vector<float> &afDepth,
+    std::vector<float> &afUncrt) const
 {
-    BAGDataset *poGDS = cpl::down_cast<BAGDataset *>(poDS);
     CPLAssert(iXRefinedGrid >= nLowResMinIdxX);
     CPLAssert(iXRefinedGrid < nLowResMinIdxX + nCountLowResX);
     CPLAssert(iYRefinedGrid >= nLowResMinIdxY);
     CPLAssert(iYRefinedGrid < nLowResMinIdxY + nCountLowResY);
     CPL_IGNORE_RET_VAL(nCountLowResY);
-    const auto &rgrid =
-        rgrids[(iYRefinedGrid - nLowResMinIdxY) * nCountLowResX +
-               (iXRefinedGrid - nLowResMinIdxX)];
-    if (rgrid.nWidth == 0)
-    {
-        return;
-    }
-    const float gridRes = std::max(rgrid.fResX, rgrid.fResY);
-    if (!(gridRes > poGDS->m_dfResFilterMin &&
-          gridRes <= poGDS->m_dfResFilterMax))
+    const size_t iGrid =
+        static_cast<size_t>(iYRefinedGrid - nLowResMinIdxY) * nCountLowResX +
+        (iXRefinedGrid - nLowResMinIdxX);
+    const auto &rgrid = rgrids[iGrid];
+    if (!apoValues[iGrid])
     {
+        // No supergrid, or filtered out by resolution
         return;
     }
+    const float *pafSuperGridValues = apoValues[iGrid]->data();
 
     const double dfMinRefinedX =
         dfLowResMinX + iXRefinedGrid * dfLowResResX + rgrid.fSWX;
@@ -2146,22 +2261,19 @@ void BAGInterpolatedBand::LoadClosestRefinedNodes(
     const int iYInRefinedGrid =
         static_cast<int>(floor((dfY - dfMinRefinedY) / rgrid.fResY));
 
-    const auto LoadValues = [poGDS, dfMinRefinedX, dfMinRefinedY, &rgrid, &adfX,
-                             &adfY, &afDepth,
-                             &afUncrt](int iXAdjusted, int iYAdjusted)
-    {
-        const unsigned nRefinementIndex =
-            rgrid.nIndex + iYAdjusted * rgrid.nWidth + iXAdjusted;
-        const auto pafRefValues = poGDS->GetRefinementValues(nRefinementIndex);
-        if (pafRefValues)
-        {
-            adfX.push_back(dfMinRefinedX +
-                           iXAdjusted * static_cast<double>(rgrid.fResX));
-            adfY.push_back(dfMinRefinedY +
-                           iYAdjusted * static_cast<double>(rgrid.fResY));
-            afDepth.push_back(pafRefValues[0]);
-            afUncrt.push_back(pafRefValues[1]);
-        }
+    const auto LoadValues =
+        [pafSuperGridValues, dfMinRefinedX, dfMinRefinedY, &rgrid, &adfX,
+         &adfY, &afDepth, &afUncrt](int iXAdjusted, int iYAdjusted)
+    {
+        const float *pafRefValues =
+            pafSuperGridValues +
+            2 * (static_cast<size_t>(iYAdjusted) * rgrid.nWidth + iXAdjusted);
+        adfX.push_back(dfMinRefinedX +
+                       iXAdjusted * static_cast<double>(rgrid.fResX));
+        adfY.push_back(dfMinRefinedY +
+                       iYAdjusted * static_cast<double>(rgrid.fResY));
+        afDepth.push_back(pafRefValues[0]);
+        afUncrt.push_back(pafRefValues[1]);
     };
 
     const int iXAdjusted = std::max(
@@ -2502,7 +2614,6 @@ void BAGDataset::InitOverviewDS(BAGDataset *poParentDS, int nXSize, int nYSize)
     // char        *apszMDList[2]{};
     m_nChunkXSizeVarresMD = poParentDS->m_nChunkXSizeVarresMD;
     m_nChunkYSizeVarresMD = poParentDS->m_nChunkYSizeVarresMD;
-    m_nChunkSizeVarresRefinement = poParentDS->m_nChunkSizeVarresRefinement;
 
     m_hVarresMetadata = poParentDS->m_hVarresMetadata;
     m_hVarresMetadataDataType = poParentDS->m_hVarresMetadataDataType;
@@ -3836,78 +3947,168 @@ void BAGDataset::GetVarresMetadataChunkSizes(int &nChunkXSize, int &nChunkYSize)
 }
 
 /************************************************************************/
-/*                     GetVarresRefinementChunkSize()                   */
+/*                        IsSuperGridSelected()                         */
 /************************************************************************/
 
-void BAGDataset::GetVarresRefinementChunkSize(unsigned &nChunkSize)
+// Returns whether a supergrid exists and passes the resolution filter.
+bool BAGDataset::IsSuperGridSelected(const BAGRefinementGrid &rgrid) const
 {
-    const hid_t listid = H5Dget_create_plist(m_hVarresRefinements);
-    nChunkSize = 1024;
-    if (listid > 0)
-    {
-        if (H5Pget_layout(listid) == H5D_CHUNKED)
-        {
-            hsize_t panChunkDims[2] = {0, 0};
-            const int nDimSize = H5Pget_chunk(listid, 2, panChunkDims);
-            CPL_IGNORE_RET_VAL(nDimSize);
-            CPLAssert(nDimSize == 2);
-            nChunkSize = static_cast<unsigned>(panChunkDims[1]);
-        }
-
-        H5Pclose(listid);
-    }
+    if (rgrid.nWidth == 0)
+        return false;
+    const float gridRes = std::max(rgrid.fResX, rgrid.fResY);
+    return gridRes > m_dfResFilterMin && gridRes <= m_dfResFilterMax;
 }
 
 /************************************************************************/
-/*                        GetRefinementValues()                         */
+/*                         GetSuperGridValues()                         */
 /************************************************************************/
 
-const float *BAGDataset::GetRefinementValues(unsigned nRefinementIndex)
+// Fills apoValues, parallel to rgrids, with the refinement values of the
+// selected supergrids (nullptr for the other ones).
+// Supergrids not already cached and whose refinements are contiguous in the
+// varres_refinements array are fetched with a single hyperslab read.
+bool BAGDataset::GetSuperGridValues(
+    const std::vector<BAGRefinementGrid> &rgrids,
+    std::vector<SuperGridValues> &apoValues)
 {
-    unsigned nStartIndex = (nRefinementIndex / m_nChunkSizeVarresRefinement) *
-                           m_nChunkSizeVarresRefinement;
-    const auto vPtr = m_oCacheRefinementValues.getPtr(nStartIndex);
-    if (vPtr)
-        return vPtr->data() + 2 * (nRefinementIndex - nStartIndex);
-
-    const unsigned nCachedRefinementCount = std::min(
-        m_nChunkSizeVarresRefinement, m_nRefinementsSize - nStartIndex);
-    std::vector<float> values(2 * nCachedRefinementCount);
-
-    hsize_t countVarresRefinements[2] = {
-        static_cast<hsize_t>(1), static_cast<hsize_t>(nCachedRefinementCount)};
-    const hid_t memspaceVarresRefinements =
-        H5Screate_simple(2, countVarresRefinements, nullptr);
-    H5OFFSET_TYPE mem_offset[2] = {static_cast<H5OFFSET_TYPE>(0),
-                                   static_cast<H5OFFSET_TYPE>(0)};
-    if (H5Sselect_hyperslab(memspaceVarresRefinements, H5S_SELECT_SET,
-                            mem_offset, nullptr, countVarresRefinements,
-                            nullptr) < 0)
+    apoValues.clear();
+    apoValues.resize(rgrids.size());
+
+    // Maximum number of refinements fetched by a single read
+    constexpr GUIntBig MAX_REFINEMENTS_PER_READ = 4 * 1024 * 1024;
+
+    std::vector<size_t> anMissing;
+    for (size_t i = 0; i < rgrids.size(); ++i)
     {
-        H5Sclose(memspaceVarresRefinements);
-        return nullptr;
+        const auto &rgrid = rgrids[i];
+        if (!IsSuperGridSelected(rgrid))
+            continue;
+        const GUIntBig nCount =
+            static_cast<GUIntBig>(rgrid.nWidth) * rgrid.nHeight;
+        if (rgrid.nIndex > m_nRefinementsSize ||
+            nCount > m_nRefinementsSize - rgrid.nIndex ||
+            nCount > MAX_REFINEMENTS_PER_READ)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid refinement grid: index=%u, width=%u, height=%u",
+                     rgrid.nIndex, rgrid.nWidth, rgrid.nHeight);
+            return false;
+        }
+        if (nCount == 0)
+            continue;
+        const auto poCached = m_oCacheSuperGridValues.getPtr(rgrid.nIndex);
+        if (poCached)
+            apoValues[i] = *poCached;
+        else
+            anMissing.push_back(i);
     }
 
-    H5OFFSET_TYPE offsetRefinement[2] = {
-        static_cast<H5OFFSET_TYPE>(0), static_cast<H5OFFSET_TYPE>(nStartIndex)};
-    if (H5Sselect_hyperslab(m_hVarresRefinementsDataspace, H5S_SELECT_SET,
-                            offsetRefinement, nullptr, countVarresRefinements,
-                            nullptr) < 0)
+    std::sort(anMissing.begin(), anMissing.end(),
+              [&rgrids](size_t a, size_t b)
+              { return rgrids[a].nIndex < rgrids[b].nIndex; });
+
+    std::vector<float> afValues;
+    size_t iRunStart = 0;
+    while (iRunStart < anMissing.size())
     {
+        // Gather the longest run of supergrids stored one after the other
+        const auto &rgridStart = rgrids[anMissing[iRunStart]];
+        GUIntBig nRunCount =
+            static_cast<GUIntBig>(rgridStart.nWidth) * rgridStart.nHeight;
+        size_t iRunEnd = iRunStart + 1;
+        while (iRunEnd < anMissing.size())
+        {
+            const auto &rgrid = rgrids[anMissing[iRunEnd]];
+            const GUIntBig nCount =
+                static_cast<GUIntBig>(rgrid.nWidth) * rgrid.nHeight;
+            if (rgrid.nIndex != rgridStart.nIndex + nRunCount &&
+                rgrid.nIndex != rgrids[anMissing[iRunEnd - 1]].nIndex)
+                break;
+            if (rgrid.nIndex == rgridStart.nIndex + nRunCount)
+            {
+                if (nRunCount + nCount > MAX_REFINEMENTS_PER_READ)
+                    break;
+                nRunCount += nCount;
+            }
+            ++iRunEnd;
+        }
+
+        try
+        {
+            afValues.resize(static_cast<size_t>(2 * nRunCount));
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for refinement values");
+            return false;
+        }
+
+        hsize_t countVarresRefinements[2] = {
+            static_cast<hsize_t>(1), static_cast<hsize_t>(nRunCount)};
+        const hid_t memspaceVarresRefinements =
+            H5Screate_simple(2, countVarresRefinements, nullptr);
+        H5OFFSET_TYPE mem_offset[2] = {static_cast<H5OFFSET_TYPE>(0),
+                                       static_cast<H5OFFSET_TYPE>(0)};
+        H5OFFSET_TYPE offsetRefinement[2] = {
+            static_cast<H5OFFSET_TYPE>(0),
+            static_cast<H5OFFSET_TYPE>(rgridStart.nIndex)};
+        const bool bOK =
+            H5Sselect_hyperslab(memspaceVarresRefinements, H5S_SELECT_SET,
+                                mem_offset, nullptr, countVarresRefinements,
+                                nullptr) >= 0 &&
+            H5Sselect_hyperslab(m_hVarresRefinementsDataspace, H5S_SELECT_SET,
+                                offsetRefinement, nullptr,
+                                countVarresRefinements, nullptr) >= 0 &&
+            H5Dread(m_hVarresRefinements, m_hVarresRefinementsNative,
+                    memspaceVarresRefinements, m_hVarresRefinementsDataspace,
+                    H5P_DEFAULT, afValues.data()) >= 0;
         H5Sclose(memspaceVarresRefinements);
-        return nullptr;
+        if (!bOK)
+            return false;
+
+        // Split the run into its supergrids, and cache them
+        for (size_t i = iRunStart; i < iRunEnd; ++i)
+        {
+            const auto &rgrid = rgrids[anMissing[i]];
+            const auto poCached = m_oCacheSuperGridValues.getPtr(rgrid.nIndex);
+            if (poCached)
+            {
+                // Same supergrid referenced several times
+                apoValues[anMissing[i]] = *poCached;
+                continue;
+            }
+            const size_t nOffset =
+                2 * static_cast<size_t>(rgrid.nIndex - rgridStart.nIndex);
+            const size_t nValues =
+                2 * static_cast<size_t>(rgrid.nWidth) * rgrid.nHeight;
+            auto poValues = std::make_shared<const std::vector<float>>(
+                afValues.begin() + nOffset,
+                afValues.begin() + nOffset + nValues);
+            apoValues[anMissing[i]] = poValues;
+            m_oCacheSuperGridValues.insert(rgrid.nIndex, std::move(poValues));
+            m_nCacheSuperGridValuesBytes += nValues * sizeof(float);
+        }
+
+        iRunStart = iRunEnd;
     }
-    if (H5Dread(m_hVarresRefinements, m_hVarresRefinementsNative,
-                memspaceVarresRefinements, m_hVarresRefinementsDataspace,
-                H5P_DEFAULT, values.data()) < 0)
+
+    // Evict least recently used supergrids beyond a fraction of the block
+    // cache size. Values in use by the caller are kept alive by apoValues.
+    const GIntBig nMaxCacheBytes = std::max<GIntBig>(
+        GDALGetCacheMax64() / 4, static_cast<GIntBig>(1024) * 1024);
+    while (static_cast<GIntBig>(m_nCacheSuperGridValuesBytes) >
+           nMaxCacheBytes)
     {
-        H5Sclose(memspaceVarresRefinements);
-        return nullptr;
+        unsigned nOldestIndex = 0;
+        SuperGridValues poOldest;
+        if (!m_oCacheSuperGridValues.getOldestEntry(nOldestIndex, poOldest))
+            break;
+        m_nCacheSuperGridValuesBytes -= poOldest->size() * sizeof(float);
+        m_oCacheSuperGridValues.remove(nOldestIndex);
     }
-    H5Sclose(memspaceVarresRefinements);
-    const auto &vRef =
-        m_oCacheRefinementValues.insert(nStartIndex, std::move(values));
-    return vRef.data() + 2 * (nRefinementIndex - nStartIndex);
+
+    return true;
 }
 
 /************************************************************************/
@@ -4143,9 +4344,6 @@ bool BAGDataset::LookForRefinementGrids(CSLConstList l_papszOpenOptions,
     GetVarresMetadataChunkSizes(m_nChunkXSizeVarresMD, m_nChunkYSizeVarresMD);
     CPLDebug("BAG", "m_nChunkXSizeVarresMD = %d, m_nChunkYSizeVarresMD = %d",
              m_nChunkXSizeVarresMD, m_nChunkYSizeVarresMD);
-    GetVarresRefinementChunkSize(m_nChunkSizeVarresRefinement);
-    CPLDebug("BAG", "m_nChunkSizeVarresRefinement = %u",
-             m_nChunkSizeVarresRefinement);
 
     const char *pszMode = CSLFetchNameValueDef(l_papszOpenOptions, "MODE", "");
     if (EQUAL(pszMode, "RESAMPLED_GRID") || EQUAL(pszMode, "INTERPOLATED"))
@@ -29,10 +29,13 @@
 
 #include "hdf5_api.h"
 
+#include "cpl_compressor.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gh5_convenience.h"
 #include "hdf5dataset.h"
 #include "hdf5drivercore.h"
@@ -40,6 +43,18 @@
 #include "../mem/memdataset.h"
 
 #include <algorithm>
+#include <set>
+#include <tuple>
+
+#if defined(H5_VERSION_GE)  // added in 1.8.7
+#define HDF5_HAS_CHUNK_CACHE
+#if H5_VERSION_GE(1, 10, 5)
+#define HDF5_HAS_DIRECT_CHUNK_READ
+#endif
+#endif
+
+// Identifier of the HDF5 Zstandard filter plugin
+constexpr unsigned H5Z_FILTER_ZSTD = 32015;
 
 class HDF5ImageDataset final : public HDF5Dataset
 {
@@ -114,8 +129,41 @@ class HDF5ImageDataset final : public HDF5Dataset
     // [m_iCurrentBandChunk * m_nBandChunkSize, (m_iCurrentBandChunk+1) * m_nBandChunkSize[
     std::vector<GByte> m_abyBandChunk{};
 
+    //! Whether chunks can be read with H5Dread_chunk() and decoded by GDAL
+    bool m_bDirectChunkRead = false;
+    //! Decompressor for the filter of the chunks, or nullptr if not filtered
+    const CPLCompressor *m_psChunkDecompressor = nullptr;
+    //! Size in bytes of a decoded chunk
+    size_t m_nChunkBytes = 0;
+
     CPLErr CreateODIMH5Projection();
 
+    void ConfigureChunkCache(const hsize_t *panChunkDims);
+    void DetectDirectChunkRead(hid_t listid, const hsize_t *panChunkDims);
+    bool ReadRawChunk(int nBlockXOff, int nBlockYOff, int iBandChunk,
+                      std::vector<GByte> &abyRaw, uint32_t &nFilterMask,
+                      bool &bChunkExists);
+    bool DecodeChunk(const std::vector<GByte> &abyRaw, uint32_t nFilterMask,
+                     void *pDst) const;
+    void FillCacheFromChunk(int nBlockXOff, int nBlockYOff, int iBandChunk,
+                            const GByte *pabyChunk, int nBandToSkip);
+    CPLErr ReadChunkDirect(int nBand, int nBlockXOff, int nBlockYOff,
+                           void *pImage, bool &bChunkExists);
+    bool PrefetchChunks(int nXOff, int nYOff, int nXSize, int nYSize,
+                        int nBandCount, const int *panBandMap);
+
+    //! Whether RasterIO() requests should go through the block cache, so that
+    // chunks are decompressed by IReadBlock() outside of the HDF5 global
+    // lock, and concurrent reads from several threads can scale.
+    bool DecodesChunksOutsideGlobalLock() const
+    {
+#ifdef ENABLE_HDF5_GLOBAL_LOCK
+        return m_bDirectChunkRead && m_psChunkDecompressor != nullptr;
+#else
+        return false;
+#endif
+    }
+
   public:
     HDF5ImageDataset();
     virtual ~HDF5ImageDataset();
@@ -355,6 +403,17 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
+    if (poGDS->m_bDirectChunkRead)
+    {
+        bool bChunkExists = false;
+        const CPLErr eErr = poGDS->ReadChunkDirect(nBand, nBlockXOff,
+                                                   nBlockYOff, pImage,
+                                                   bChunkExists);
+        // If the chunk is not allocated, let libhdf5 apply the fill value
+        if (eErr != CE_None || bChunkExists)
+            return eErr;
+    }
+
     HDF5_GLOBAL_LOCK();
 
     hsize_t count[3] = {0, 0, 0};
@@ -608,6 +667,15 @@ CPLErr HDF5ImageRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
+    if (eRWFlag == GF_Read && m_nIRasterIORecCounter == 0 &&
+        (poGDS->PrefetchChunks(nXOff, nYOff, nXSize, nYSize, 1, &nBand) ||
+         poGDS->DecodesChunksOutsideGlobalLock()))
+    {
+        return GDALPamRasterBand::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    }
+
     const bool bIsExpectedLayout =
         (bIsBandInterleavedData ||
          (poGDS->ndims == 2 && poGDS->GetYIndex() == 0 &&
@@ -721,6 +789,17 @@ CPLErr HDF5ImageDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return true;
     };
 
+    if (eRWFlag == GF_Read &&
+        (PrefetchChunks(nXOff, nYOff, nXSize, nYSize, nBandCount,
+                        panBandMap) ||
+         DecodesChunksOutsideGlobalLock()))
+    {
+        return HDF5Dataset::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
+            nBandSpace, psExtraArg);
+    }
+
     const auto eDT = GetRasterBand(1)->GetRasterDataType();
     const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
 
@@ -869,6 +948,501 @@ CPLErr HDF5ImageDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                   nBandSpace, psExtraArg);
 }
 
+/************************************************************************/
+/*                        ConfigureChunkCache()                         */
+/************************************************************************/
+
+// The default libhdf5 chunk cache is 1 MB, which may not even be able to hold
+// a single chunk, in which case each access to a chunk, for example from
+// different bands sharing it, decompresses it again. By default, size the
+// cache so that it can hold one row of chunks of all the bands.
+void HDF5ImageDataset::ConfigureChunkCache(const hsize_t *panChunkDims)
+{
+#ifdef HDF5_HAS_CHUNK_CACHE
+    if (ndims > 3)
+        return;
+    uint64_t nChunkBytes = size;
+    for (int i = 0; i < ndims; ++i)
+    {
+        if (panChunkDims[i] == 0 ||
+            nChunkBytes > std::numeric_limits<uint64_t>::max() /
+                              static_cast<uint64_t>(panChunkDims[i]))
+            return;
+        nChunkBytes *= static_cast<uint64_t>(panChunkDims[i]);
+    }
+    if (nChunkBytes == 0)
+        return;
+
+    uint64_t nCacheSize = 0;
+    const char *pszCacheSize =
+        CPLGetConfigOption("HDF5_CHUNK_CACHE_SIZE", "AUTO");
+    if (EQUAL(pszCacheSize, "AUTO"))
+    {
+        const uint64_t nChunksPerRow =
+            DIV_ROUND_UP(static_cast<uint64_t>(nRasterXSize),
+                         static_cast<uint64_t>(m_nBlockXSize));
+        const uint64_t nBandChunks =
+            ndims == 3 ? DIV_ROUND_UP(
+                             static_cast<uint64_t>(dims[m_nOtherDimIndex]),
+                             static_cast<uint64_t>(
+                                 panChunkDims[m_nOtherDimIndex]))
+                       : 1;
+        const uint64_t nMaxCacheSize = static_cast<uint64_t>(
+            std::max<GIntBig>(0, GDALGetCacheMax64() / 4));
+        if (nChunkBytes > nMaxCacheSize ||
+            nChunksPerRow * nBandChunks > nMaxCacheSize / nChunkBytes)
+        {
+            nCacheSize = std::max(nMaxCacheSize, nChunkBytes);
+        }
+        else
+        {
+            nCacheSize = nChunkBytes * nChunksPerRow * nBandChunks;
+        }
+        // Keep the libhdf5 default when it is large enough
+        constexpr uint64_t DEFAULT_CHUNK_CACHE_SIZE = 1024 * 1024;
+        if (nCacheSize <= DEFAULT_CHUNK_CACHE_SIZE)
+            return;
+    }
+    else
+    {
+        nCacheSize = std::strtoull(pszCacheSize, nullptr, 10);
+    }
+    if (nCacheSize > std::numeric_limits<size_t>::max())
+        nCacheSize = std::numeric_limits<size_t>::max();
+
+    // libhdf5 recommends a prime number of hash slots, about 100 times the
+    // number of chunks that fit in the cache.
+    const auto IsPrime = [](uint64_t n)
+    {
+        for (uint64_t i = 2; i * i <= n; ++i)
+        {
+            if ((n % i) == 0)
+                return false;
+        }
+        return true;
+    };
+    uint64_t nSlots = std::min<uint64_t>(
+        1000 * 1000, std::max<uint64_t>(521, 100 * (nCacheSize / nChunkBytes)));
+    while (!IsPrime(nSlots))
+        ++nSlots;
+
+    CPLDebug("HDF5", "Using a chunk cache of " CPL_FRMT_GUIB " bytes",
+             static_cast<GUIntBig>(nCacheSize));
+
+    const hid_t hDAPL = H5Pcreate(H5P_DATASET_ACCESS);
+    if (hDAPL < 0)
+        return;
+    if (H5Pset_chunk_cache(hDAPL, static_cast<size_t>(nSlots),
+                           static_cast<size_t>(nCacheSize),
+                           H5D_CHUNK_CACHE_W0_DEFAULT) >= 0)
+    {
+        // The chunk cache is a property of the dataset access property list,
+        // hence the dataset must be re-opened
+        const hid_t hDataset = H5Dopen2(m_hHDF5, poH5Objects->pszPath, hDAPL);
+        if (hDataset >= 0)
+        {
+            H5Dclose(dataset_id);
+            dataset_id = hDataset;
+        }
+    }
+    H5Pclose(hDAPL);
+#else
+    CPL_IGNORE_RET_VAL(panChunkDims);
+#endif
+}
+
+/************************************************************************/
+/*                       DetectDirectChunkRead()                        */
+/************************************************************************/
+
+// Checks if the chunks can be read with H5Dread_chunk() and decoded by GDAL,
+// that is if each chunk maps to one block of one or several bands, if
+// there is at most one filter, DEFLATE or ZSTD, and if the data type needs
+// no conversion.
+void HDF5ImageDataset::DetectDirectChunkRead(hid_t listid,
+                                             const hsize_t *panChunkDims)
+{
+#ifdef HDF5_HAS_DIRECT_CHUNK_READ
+    if (eAccess == GA_Update ||
+        !CPLTestBool(CPLGetConfigOption("HDF5_DIRECT_CHUNK_READ", "YES")))
+        return;
+
+    const bool bIsBandInterleavedData = ndims == 3 && m_nOtherDimIndex == 0 &&
+                                        GetYIndex() == 1 && GetXIndex() == 2;
+    if (!(bIsBandInterleavedData ||
+          (ndims == 2 && GetYIndex() == 0 && GetXIndex() == 1)))
+        return;
+    if (bIsBandInterleavedData &&
+        panChunkDims[0] != static_cast<hsize_t>(m_nBandChunkSize))
+        return;
+
+    const auto eClass = H5Tget_class(native);
+    if ((eClass != H5T_INTEGER && eClass != H5T_FLOAT) ||
+        H5Tequal(datatype, native) <= 0)
+        return;
+    const GDALDataType eDT = GetDataType(native);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    if (eDT == GDT_Unknown || static_cast<hsize_t>(nDTSize) != size)
+        return;
+
+    const int nFilters = H5Pget_nfilters(listid);
+    if (nFilters > 1)
+        return;
+    if (nFilters == 1)
+    {
+        unsigned int flags = 0;
+        size_t cd_nelmts = 0;
+        const auto eFilter =
+            H5Pget_filter(listid, 0, &flags, &cd_nelmts, nullptr, 0, nullptr);
+        if (eFilter == H5Z_FILTER_DEFLATE)
+            m_psChunkDecompressor = CPLGetDecompressor("zlib");
+        else if (eFilter == static_cast<H5Z_filter_t>(H5Z_FILTER_ZSTD))
+            m_psChunkDecompressor = CPLGetDecompressor("zstd");
+        if (!m_psChunkDecompressor)
+            return;
+    }
+
+    m_nChunkBytes = static_cast<size_t>(m_nBandChunkSize) * m_nBlockXSize *
+                    m_nBlockYSize * nDTSize;
+    m_bDirectChunkRead = true;
+#else
+    CPL_IGNORE_RET_VAL(listid);
+    CPL_IGNORE_RET_VAL(panChunkDims);
+#endif
+}
+
+/************************************************************************/
+/*                            ReadRawChunk()                            */
+/************************************************************************/
+
+// Reads the (compressed) content of the chunk corresponding to the block
+// (nBlockXOff, nBlockYOff) of the bands of iBandChunk, without going through
+// the libhdf5 filter pipeline.
+// bChunkExists is set to false if the chunk is not allocated.
+bool HDF5ImageDataset::ReadRawChunk(int nBlockXOff, int nBlockYOff,
+                                    int iBandChunk, std::vector<GByte> &abyRaw,
+                                    uint32_t &nFilterMask, bool &bChunkExists)
+{
+    bChunkExists = false;
+#ifdef HDF5_HAS_DIRECT_CHUNK_READ
+    hsize_t anOffset[3] = {0, 0, 0};
+    if (ndims == 3)
+        anOffset[m_nOtherDimIndex] =
+            static_cast<hsize_t>(iBandChunk) * m_nBandChunkSize;
+    anOffset[GetYIndex()] = static_cast<hsize_t>(nBlockYOff) * m_nBlockYSize;
+    anOffset[GetXIndex()] = static_cast<hsize_t>(nBlockXOff) * m_nBlockXSize;
+
+    HDF5_GLOBAL_LOCK();
+
+    hsize_t nStorageSize = 0;
+    if (H5Dget_chunk_storage_size(dataset_id, anOffset, &nStorageSize) < 0 ||
+        nStorageSize == 0)
+    {
+        return true;
+    }
+    // Sanity check: a compressed chunk should not be much larger than the
+    // uncompressed one
+    if (nStorageSize > 2 * static_cast<hsize_t>(m_nChunkBytes) + 1024 * 1024)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Too large storage size for chunk: " CPL_FRMT_GUIB " bytes",
+                 static_cast<GUIntBig>(nStorageSize));
+        return false;
+    }
+    try
+    {
+        abyRaw.resize(static_cast<size_t>(nStorageSize));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for chunk");
+        return false;
+    }
+    if (H5Dread_chunk(dataset_id, H5P_DEFAULT, anOffset, &nFilterMask,
+                      abyRaw.data()) < 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "H5Dread_chunk() failed");
+        return false;
+    }
+    bChunkExists = true;
+    return true;
+#else
+    CPL_IGNORE_RET_VAL(nBlockXOff);
+    CPL_IGNORE_RET_VAL(nBlockYOff);
+    CPL_IGNORE_RET_VAL(iBandChunk);
+    CPL_IGNORE_RET_VAL(abyRaw);
+    CPL_IGNORE_RET_VAL(nFilterMask);
+    return false;
+#endif
+}
+
+/************************************************************************/
+/*                            DecodeChunk()                             */
+/************************************************************************/
+
+// Decodes a chunk read by ReadRawChunk() into pDst, which must be able
+// to hold m_nChunkBytes bytes.
+// Does not use the HDF5 API, and may thus be called from worker threads.
+bool HDF5ImageDataset::DecodeChunk(const std::vector<GByte> &abyRaw,
+                                   uint32_t nFilterMask, void *pDst) const
+{
+    // Bit 0 of nFilterMask is set if the (optional) filter was skipped
+    if (m_psChunkDecompressor == nullptr || (nFilterMask & 1) != 0)
+    {
+        if (abyRaw.size() != m_nChunkBytes)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unexpected size for uncompressed chunk");
+            return false;
+        }
+        memcpy(pDst, abyRaw.data(), m_nChunkBytes);
+        return true;
+    }
+
+    void *pOutBuffer = pDst;
+    size_t nOutSize = m_nChunkBytes;
+    if (!m_psChunkDecompressor->pfnFunc(abyRaw.data(), abyRaw.size(),
+                                        &pOutBuffer, &nOutSize, nullptr,
+                                        m_psChunkDecompressor->user_data) ||
+        nOutSize != m_nChunkBytes)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompression of chunk failed");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        FillCacheFromChunk()                          */
+/************************************************************************/
+
+// Stores the blocks of the bands of iBandChunk held in a decoded chunk in the
+// block cache, except the one of band nBandToSkip and the ones already
+// cached.
+void HDF5ImageDataset::FillCacheFromChunk(int nBlockXOff, int nBlockYOff,
+                                          int iBandChunk,
+                                          const GByte *pabyChunk,
+                                          int nBandToSkip)
+{
+    const size_t nBlockBytes = m_nChunkBytes / m_nBandChunkSize;
+    const int nFirstBand = iBandChunk * m_nBandChunkSize + 1;
+    const int nLastBand = std::min(nBands, nFirstBand + m_nBandChunkSize - 1);
+    for (int iBand = nFirstBand; iBand <= nLastBand; ++iBand)
+    {
+        if (iBand == nBandToSkip)
+            continue;
+        GDALRasterBand *poBand = GetRasterBand(iBand);
+        GDALRasterBlock *poBlock =
+            poBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+        if (poBlock)
+        {
+            poBlock->DropLock();
+            continue;
+        }
+        poBlock = poBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+        if (poBlock)
+        {
+            memcpy(poBlock->GetDataRef(),
+                   pabyChunk + static_cast<size_t>(iBand - nFirstBand) *
+                                   nBlockBytes,
+                   nBlockBytes);
+            poBlock->DropLock();
+        }
+    }
+}
+
+/************************************************************************/
+/*                          ReadChunkDirect()                           */
+/************************************************************************/
+
+// Reads the block (nBlockXOff, nBlockYOff) of nBand with H5Dread_chunk(),
+// and caches the blocks of the other bands of the same chunk.
+// bChunkExists is set to false if the chunk is not allocated, in which case
+// pImage is left untouched.
+CPLErr HDF5ImageDataset::ReadChunkDirect(int nBand, int nBlockXOff,
+                                         int nBlockYOff, void *pImage,
+                                         bool &bChunkExists)
+{
+    const int iBandChunk = (nBand - 1) / m_nBandChunkSize;
+    std::vector<GByte> abyRaw;
+    uint32_t nFilterMask = 0;
+    if (!ReadRawChunk(nBlockXOff, nBlockYOff, iBandChunk, abyRaw, nFilterMask,
+                      bChunkExists))
+        return CE_Failure;
+    if (!bChunkExists)
+        return CE_None;
+    if (m_nBandChunkSize == 1)
+        return DecodeChunk(abyRaw, nFilterMask, pImage) ? CE_None : CE_Failure;
+
+    std::vector<GByte> abyChunk;
+    try
+    {
+        abyChunk.resize(m_nChunkBytes);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for chunk");
+        return CE_Failure;
+    }
+    if (!DecodeChunk(abyRaw, nFilterMask, abyChunk.data()))
+        return CE_Failure;
+    const size_t nBlockBytes = m_nChunkBytes / m_nBandChunkSize;
+    memcpy(pImage,
+           abyChunk.data() +
+               static_cast<size_t>((nBand - 1) % m_nBandChunkSize) *
+                   nBlockBytes,
+           nBlockBytes);
+    FillCacheFromChunk(nBlockXOff, nBlockYOff, iBandChunk, abyChunk.data(),
+                       nBand);
+    return CE_None;
+}
+
+/************************************************************************/
+/*                          PrefetchChunks()                            */
+/************************************************************************/
+
+// When GDAL_NUM_THREADS is set and chunks can be read directly, reads the
+// chunks intersecting a request, whose blocks are not already cached, and
+// decodes them in parallel into the block cache.
+// Returns true if the request can then be satisfied from the block cache.
+bool HDF5ImageDataset::PrefetchChunks(int nXOff, int nYOff, int nXSize,
+                                      int nYSize, int nBandCount,
+                                      const int *panBandMap)
+{
+    if (!m_bDirectChunkRead)
+        return false;
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return false;
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::min(nThreads, 1024);
+    if (nThreads <= 1)
+        return false;
+
+    const int nBlockXStart = nXOff / m_nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / m_nBlockXSize;
+    const int nBlockYStart = nYOff / m_nBlockYSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / m_nBlockYSize;
+
+    struct Chunk
+    {
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        int iBandChunk = 0;
+        std::vector<GByte> abyRaw{};
+        uint32_t nFilterMask = 0;
+        std::vector<GByte> abyDecoded{};
+        bool bOK = false;
+        const HDF5ImageDataset *poDS = nullptr;
+    };
+
+    // Collect the chunks of the blocks that are not cached yet
+    std::set<std::tuple<int, int, int>> oSetChunks;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        GDALRasterBand *poBand = GetRasterBand(panBandMap[i]);
+        const int iBandChunk = (panBandMap[i] - 1) / m_nBandChunkSize;
+        for (int nBlockYOff = nBlockYStart; nBlockYOff <= nBlockYEnd;
+             ++nBlockYOff)
+        {
+            for (int nBlockXOff = nBlockXStart; nBlockXOff <= nBlockXEnd;
+                 ++nBlockXOff)
+            {
+                GDALRasterBlock *poBlock =
+                    poBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+                if (poBlock)
+                    poBlock->DropLock();
+                else
+                    oSetChunks.insert(
+                        std::make_tuple(iBandChunk, nBlockYOff, nBlockXOff));
+            }
+        }
+    }
+    if (oSetChunks.empty())
+        return true;
+    if (oSetChunks.size() == 1)
+        return false;
+
+    // Do not prefetch more than what the block cache can hold
+    if (static_cast<uint64_t>(oSetChunks.size()) * m_nChunkBytes >
+        static_cast<uint64_t>(GDALGetCacheMax64() / 2))
+    {
+        return false;
+    }
+
+    // Reading chunks with libhdf5 must be done sequentially
+    std::vector<Chunk> aoChunks;
+    aoChunks.reserve(oSetChunks.size());
+    for (const auto &[iBandChunk, nBlockYOff, nBlockXOff] : oSetChunks)
+    {
+        Chunk oChunk;
+        oChunk.nBlockXOff = nBlockXOff;
+        oChunk.nBlockYOff = nBlockYOff;
+        oChunk.iBandChunk = iBandChunk;
+        oChunk.poDS = this;
+        bool bChunkExists = false;
+        if (!ReadRawChunk(nBlockXOff, nBlockYOff, iBandChunk, oChunk.abyRaw,
+                          oChunk.nFilterMask, bChunkExists))
+            return false;
+        // Blocks of non-allocated chunks will be read by IReadBlock()
+        if (bChunkExists)
+            aoChunks.emplace_back(std::move(oChunk));
+    }
+
+    const auto DecodeJob = [](void *pData)
+    {
+        Chunk *psChunk = static_cast<Chunk *>(pData);
+        try
+        {
+            psChunk->abyDecoded.resize(psChunk->poDS->m_nChunkBytes);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for chunk");
+            return;
+        }
+        psChunk->bOK = psChunk->poDS->DecodeChunk(
+            psChunk->abyRaw, psChunk->nFilterMask, psChunk->abyDecoded.data());
+        psChunk->abyRaw.clear();
+    };
+
+    GDALThreadReservation oThreadReservation(
+        std::min(nThreads, static_cast<int>(aoChunks.size())));
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        CPLDebug("HDF5", "Decoding %d chunks with up to %d threads",
+                 static_cast<int>(aoChunks.size()),
+                 oThreadReservation.GetThreadCount());
+        for (auto &oChunk : aoChunks)
+            poJobQueue->SubmitJob(DecodeJob, &oChunk);
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &oChunk : aoChunks)
+            DecodeJob(&oChunk);
+    }
+
+    for (const auto &oChunk : aoChunks)
+    {
+        if (!oChunk.bOK)
+            return false;
+        FillCacheFromChunk(oChunk.nBlockXOff, oChunk.nBlockYOff,
+                           oChunk.iBandChunk, oChunk.abyDecoded.data(), 0);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                                Open()                                */
 /************************************************************************/
@@ -1163,6 +1737,9 @@ GDALDataset *HDF5ImageDataset::Open(GDALOpenInfo *poOpenInfo)
                                       CPLSPrintf("%d", poDS->m_nBandChunkSize),
                                       "IMAGE_STRUCTURE");
             }
+
+            poDS->ConfigureChunkCache(panChunkDims);
+            poDS->DetectDirectChunkRead(listid, panChunkDims);
         }
 
         const int nFilters = H5Pget_nfilters(listid);
@@ -1540,6 +2117,11 @@ const char *HDF5ImageDataset::GetMetadataItem(const char *pszName,
                 return "ENABLED";
         }
     }
+    if (pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "DirectChunkRead"))
+    {
+        return m_bDirectChunkRead ? "YES" : "NO";
+    }
     return GDALPamDataset::GetMetadataItem(pszName, pszDomain);
 }
 
@@ -26,12 +26,14 @@
  ****************************************************************************/
 
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 
 #include "include_libheif.h"
 
 #include "heifdrivercore.h"
 
+#include <algorithm>
 #include <vector>
 
 extern "C" void CPL_DLL GDALRegister_HEIF();
@@ -55,6 +57,13 @@ class GDALHEIFDataset final : public GDALPamDataset
     bool m_bFailureDecoding = false;
     std::vector<std::unique_ptr<GDALHEIFDataset>> m_apoOvrDS{};
     bool m_bIsThumbnail = false;
+#ifdef HAS_IMAGE_TILING
+    // Whether the image is a grid of independently coded tiles, exposed as
+    // GDAL blocks
+    bool m_bTiled = false;
+    int m_nTileWidth = 0;
+    int m_nTileHeight = 0;
+#endif
 
 #ifdef HAS_CUSTOM_FILE_READER
     heif_reader m_oReader{};
@@ -72,6 +81,25 @@ class GDALHEIFDataset final : public GDALPamDataset
     void ReadMetadata();
     void OpenThumbnails();
 
+    heif_chroma GetChroma() const;
+    bool CheckDecodedImage(const heif_image *hImage, int nMinWidth,
+                           int nMinHeight) const;
+
+#ifdef HAS_IMAGE_TILING
+    bool DecodeTile(int nTileX, int nTileY, heif_image **phImage) const;
+    void FillBlocksFromTile(const heif_image *hImage, int nBlockXOff,
+                            int nBlockYOff, int nDstBand, void *pDstBuffer);
+    void PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize);
+#endif
+
+  protected:
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount, int *panBandMap,
+                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                     GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
   public:
     GDALHEIFDataset();
     ~GDALHEIFDataset();
@@ -87,6 +115,11 @@ class GDALHEIFRasterBand final : public GDALPamRasterBand
 {
   protected:
     CPLErr IReadBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
 
   public:
     GDALHEIFRasterBand(GDALHEIFDataset *poDSIn, int nBandIn);
@@ -303,12 +336,41 @@ bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
 
     nRasterXSize = heif_image_handle_get_width(m_hImageHandle);
     nRasterYSize = heif_image_handle_get_height(m_hImageHandle);
+
+#ifdef HAS_IMAGE_TILING
+    // Grid images (typically from cameras) are made of tiles that can be
+    // decoded independently: expose them as blocks, so that only the tiles
+    // intersecting a request are decoded.
+    heif_image_tiling sTiling;
+    err = heif_image_handle_get_image_tiling(m_hImageHandle, true, &sTiling);
+    if (err.code == heif_error_Ok &&
+        static_cast<uint64_t>(sTiling.num_columns) * sTiling.num_rows > 1 &&
+        sTiling.top_offset == 0 && sTiling.left_offset == 0 &&
+        sTiling.number_of_extra_dimensions == 0 &&
+        sTiling.tile_width > 0 && sTiling.tile_width <= 65536 &&
+        sTiling.tile_height > 0 && sTiling.tile_height <= 65536)
+    {
+        CPLDebug("HEIF", "Grid of %ux%u tiles of %ux%u pixels",
+                 sTiling.num_columns, sTiling.num_rows, sTiling.tile_width,
+                 sTiling.tile_height);
+        m_bTiled = true;
+        m_nTileWidth = static_cast<int>(sTiling.tile_width);
+        m_nTileHeight = static_cast<int>(sTiling.tile_height);
+    }
+#endif
+
     const int l_nBands =
         3 + (heif_image_handle_has_alpha_channel(m_hImageHandle) ? 1 : 0);
     for (int i = 0; i < l_nBands; i++)
     {
         SetBand(i + 1, new GDALHEIFRasterBand(this, i + 1));
     }
+#ifdef HAS_IMAGE_TILING
+    if (m_bTiled)
+    {
+        GDALDataset::SetMetadataItem("INTERLEAVE", "PIXEL", "IMAGE_STRUCTURE");
+    }
+#endif
 
     ReadMetadata();
 
@@ -602,47 +664,339 @@ GDALHEIFRasterBand::GDALHEIFRasterBand(GDALHEIFDataset *poDSIn, int nBandIn)
 #endif
     nBlockXSize = poDS->GetRasterXSize();
     nBlockYSize = 1;
+#ifdef HAS_IMAGE_TILING
+    if (poDSIn->m_bTiled)
+    {
+        nBlockXSize = poDSIn->m_nTileWidth;
+        nBlockYSize = poDSIn->m_nTileHeight;
+    }
+#endif
 }
 
 /************************************************************************/
-/*                            IReadBlock()                              */
+/*                             GetChroma()                              */
 /************************************************************************/
 
-CPLErr GDALHEIFRasterBand::IReadBlock(int, int nBlockYOff, void *pImage)
+heif_chroma GDALHEIFDataset::GetChroma() const
 {
-    GDALHEIFDataset *poGDS = static_cast<GDALHEIFDataset *>(poDS);
-    if (poGDS->m_bFailureDecoding)
-        return CE_Failure;
-    const int nBands = poGDS->GetRasterCount();
-    if (poGDS->m_hImage == nullptr)
-    {
-        auto err = heif_decode_image(
-            poGDS->m_hImageHandle, &(poGDS->m_hImage), heif_colorspace_RGB,
-            nBands == 3
-                ? (
 #if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 4, 0)
-                      eDataType == GDT_UInt16 ?
+    if (papoBands[0]->GetRasterDataType() == GDT_UInt16)
+    {
 #if CPL_IS_LSB
-                                              heif_chroma_interleaved_RRGGBB_LE
+        return nBands == 3 ? heif_chroma_interleaved_RRGGBB_LE
+                           : heif_chroma_interleaved_RRGGBBAA_LE;
 #else
-                                              heif_chroma_interleaved_RRGGBB_BE
+        return nBands == 3 ? heif_chroma_interleaved_RRGGBB_BE
+                           : heif_chroma_interleaved_RRGGBBAA_BE;
 #endif
-                                              :
+    }
 #endif
-                                              heif_chroma_interleaved_RGB)
-                : (
-#if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 4, 0)
-                      eDataType == GDT_UInt16
-                          ?
-#if CPL_IS_LSB
-                          heif_chroma_interleaved_RRGGBBAA_LE
-#else
-                          heif_chroma_interleaved_RRGGBBAA_BE
+    return nBands == 3 ? heif_chroma_interleaved_RGB
+                       : heif_chroma_interleaved_RGBA;
+}
+
+/************************************************************************/
+/*                         CheckDecodedImage()                          */
+/************************************************************************/
+
+bool GDALHEIFDataset::CheckDecodedImage(const heif_image *hImage,
+                                        int nMinWidth, int nMinHeight) const
+{
+    const int nBitsPerPixel =
+        heif_image_get_bits_per_pixel(hImage, heif_channel_interleaved);
+    if (nBitsPerPixel !=
+        nBands * GDALGetDataTypeSize(papoBands[0]->GetRasterDataType()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unexpected bits_per_pixel = %d value", nBitsPerPixel);
+        return false;
+    }
+    if (heif_image_get_width(hImage, heif_channel_interleaved) < nMinWidth ||
+        heif_image_get_height(hImage, heif_channel_interleaved) < nMinHeight)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unexpected dimensions of decoded image");
+        return false;
+    }
+    return true;
+}
+
+#ifdef HAS_IMAGE_TILING
+
+/************************************************************************/
+/*                            DecodeTile()                              */
+/************************************************************************/
+
+// May be called concurrently from several threads.
+bool GDALHEIFDataset::DecodeTile(int nTileX, int nTileY,
+                                 heif_image **phImage) const
+{
+    *phImage = nullptr;
+    auto err = heif_image_handle_decode_image_tile(
+        m_hImageHandle, phImage, heif_colorspace_RGB, GetChroma(), nullptr,
+        static_cast<uint32_t>(nTileX), static_cast<uint32_t>(nTileY));
+    if (err.code != heif_error_Ok)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                 err.message ? err.message : "Cannot decode tile");
+        if (*phImage)
+        {
+            heif_image_release(*phImage);
+            *phImage = nullptr;
+        }
+        return false;
+    }
+    if (!CheckDecodedImage(
+            *phImage,
+            std::min(m_nTileWidth, nRasterXSize - nTileX * m_nTileWidth),
+            std::min(m_nTileHeight, nRasterYSize - nTileY * m_nTileHeight)))
+    {
+        heif_image_release(*phImage);
+        *phImage = nullptr;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        FillBlocksFromTile()                          */
+/************************************************************************/
+
+// Copy a decoded tile into pDstBuffer for band nDstBand, and into the
+// not yet cached blocks of the other bands.
+void GDALHEIFDataset::FillBlocksFromTile(const heif_image *hImage,
+                                         int nBlockXOff, int nBlockYOff,
+                                         int nDstBand, void *pDstBuffer)
+{
+    const GDALDataType eDT = papoBands[0]->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const int nXSize =
+        std::min(m_nTileWidth, nRasterXSize - nBlockXOff * m_nTileWidth);
+    const int nYSize =
+        std::min(m_nTileHeight, nRasterYSize - nBlockYOff * m_nTileHeight);
+
+    int nStride = 0;
+    const uint8_t *pSrcData = heif_image_get_plane_readonly(
+        hImage, heif_channel_interleaved, &nStride);
+
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        GDALRasterBlock *poBlock = nullptr;
+        GByte *pabyDst;
+        if (iBand == nDstBand)
+        {
+            pabyDst = static_cast<GByte *>(pDstBuffer);
+        }
+        else
+        {
+            GDALRasterBand *poBand = papoBands[iBand - 1];
+            poBlock = poBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            poBlock = poBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+            if (!poBlock)
+                continue;
+            pabyDst = static_cast<GByte *>(poBlock->GetDataRef());
+        }
+
+        for (int iY = 0; iY < nYSize; ++iY)
+        {
+            GDALCopyWords(pSrcData + static_cast<size_t>(iY) * nStride +
+                              (iBand - 1) * nDTSize,
+                          eDT, nBands * nDTSize,
+                          pabyDst + static_cast<size_t>(iY) * m_nTileWidth *
+                                        nDTSize,
+                          eDT, nDTSize, nXSize);
+        }
+
+        if (poBlock)
+            poBlock->DropLock();
+    }
+}
+
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+// When GDAL_NUM_THREADS is set, decodes in parallel the tiles intersecting
+// a request that are not already cached, and put them in the block cache.
+void GDALHEIFDataset::PrefetchTiles(int nXOff, int nYOff, int nXSize,
+                                    int nYSize)
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return;
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::min(nThreads, 1024);
+    if (nThreads <= 1)
+        return;
+
+    struct Tile
+    {
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        heif_image *hImage = nullptr;
+        const GDALHEIFDataset *poDS = nullptr;
+    };
+
+    // Do not decode more tiles than what the block cache can hold
+    const GIntBig nTileSize =
+        static_cast<GIntBig>(m_nTileWidth) * m_nTileHeight * nBands *
+        GDALGetDataTypeSizeBytes(papoBands[0]->GetRasterDataType());
+    const GIntBig nMaxTiles = GDALGetCacheMax64() / 2 / nTileSize;
+
+    std::vector<Tile> aoTiles;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / m_nTileWidth;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / m_nTileHeight;
+    for (int nBlockYOff = nYOff / m_nTileHeight; nBlockYOff <= nBlockYEnd;
+         ++nBlockYOff)
+    {
+        for (int nBlockXOff = nXOff / m_nTileWidth; nBlockXOff <= nBlockXEnd;
+             ++nBlockXOff)
+        {
+            GDALRasterBlock *poBlock =
+                papoBands[0]->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            if (static_cast<GIntBig>(aoTiles.size()) >= nMaxTiles)
+                break;
+            Tile oTile;
+            oTile.nBlockXOff = nBlockXOff;
+            oTile.nBlockYOff = nBlockYOff;
+            oTile.poDS = this;
+            aoTiles.push_back(oTile);
+        }
+    }
+    if (aoTiles.size() < 2)
+        return;
+
+    const auto DecodeJob = [](void *pData)
+    {
+        Tile *psTile = static_cast<Tile *>(pData);
+        psTile->poDS->DecodeTile(psTile->nBlockXOff, psTile->nBlockYOff,
+                                 &psTile->hImage);
+    };
+
+    GDALThreadReservation oThreadReservation(
+        std::min(nThreads, static_cast<int>(aoTiles.size())));
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+        return;
+
+    CPLDebug("HEIF", "Decoding %d tiles with up to %d threads",
+             static_cast<int>(aoTiles.size()),
+             oThreadReservation.GetThreadCount());
+    for (auto &oTile : aoTiles)
+        poJobQueue->SubmitJob(DecodeJob, &oTile);
+    poJobQueue->WaitCompletion();
+
+    // Tiles that failed to decode are left to IReadBlock(), which will
+    // report the error.
+    for (auto &oTile : aoTiles)
+    {
+        if (oTile.hImage)
+        {
+            FillBlocksFromTile(oTile.hImage, oTile.nBlockXOff,
+                               oTile.nBlockYOff, 0, nullptr);
+            heif_image_release(oTile.hImage);
+        }
+    }
+}
+
+#endif
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALHEIFDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                  int nXSize, int nYSize, void *pData,
+                                  int nBufXSize, int nBufYSize,
+                                  GDALDataType eBufType, int nBandCount,
+                                  int *panBandMap, GSpacing nPixelSpace,
+                                  GSpacing nLineSpace, GSpacing nBandSpace,
+                                  GDALRasterIOExtraArg *psExtraArg)
+{
+#ifdef HAS_IMAGE_TILING
+    // Sub-sampled requests might be satisfied from the thumbnail
+    if (m_bTiled && eRWFlag == GF_Read &&
+        ((nBufXSize == nXSize && nBufYSize == nYSize) || m_apoOvrDS.empty()))
+    {
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+    }
+#endif
+    return GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALHEIFRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                     int nXSize, int nYSize, void *pData,
+                                     int nBufXSize, int nBufYSize,
+                                     GDALDataType eBufType,
+                                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                                     GDALRasterIOExtraArg *psExtraArg)
+{
+#ifdef HAS_IMAGE_TILING
+    GDALHEIFDataset *poGDS = static_cast<GDALHEIFDataset *>(poDS);
+    if (poGDS->m_bTiled && eRWFlag == GF_Read &&
+        ((nBufXSize == nXSize && nBufYSize == nYSize) ||
+         poGDS->m_apoOvrDS.empty()))
+    {
+        poGDS->PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+    }
 #endif
-                          :
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                            IReadBlock()                              */
+/************************************************************************/
+
+CPLErr GDALHEIFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                      void *pImage)
+{
+    GDALHEIFDataset *poGDS = static_cast<GDALHEIFDataset *>(poDS);
+#ifdef HAS_IMAGE_TILING
+    if (poGDS->m_bTiled)
+    {
+        heif_image *hTile = nullptr;
+        if (!poGDS->DecodeTile(nBlockXOff, nBlockYOff, &hTile))
+            return CE_Failure;
+        poGDS->FillBlocksFromTile(hTile, nBlockXOff, nBlockYOff, nBand,
+                                  pImage);
+        heif_image_release(hTile);
+        return CE_None;
+    }
+#else
+    CPL_IGNORE_RET_VAL(nBlockXOff);
 #endif
-                          heif_chroma_interleaved_RGBA),
-            nullptr);
+    if (poGDS->m_bFailureDecoding)
+        return CE_Failure;
+    const int nBands = poGDS->GetRasterCount();
+    if (poGDS->m_hImage == nullptr)
+    {
+        auto err = heif_decode_image(poGDS->m_hImageHandle, &(poGDS->m_hImage),
+                                     heif_colorspace_RGB, poGDS->GetChroma(),
+                                     nullptr);
         if (err.code != heif_error_Ok)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "%s",
@@ -650,12 +1004,9 @@ CPLErr GDALHEIFRasterBand::IReadBlock(int, int nBlockYOff, void *pImage)
             poGDS->m_bFailureDecoding = true;
             return CE_Failure;
         }
-        const int nBitsPerPixel = heif_image_get_bits_per_pixel(
-            poGDS->m_hImage, heif_channel_interleaved);
-        if (nBitsPerPixel != nBands * GDALGetDataTypeSize(eDataType))
+        if (!poGDS->CheckDecodedImage(poGDS->m_hImage, nRasterXSize,
+                                      nRasterYSize))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Unexpected bits_per_pixel = %d value", nBitsPerPixel);
             poGDS->m_bFailureDecoding = true;
             return CE_Failure;
         }
@@ -37,4 +37,8 @@
 #define HAS_CUSTOM_FILE_READER
 #endif
 
+#if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 19, 0)
+#define HAS_IMAGE_TILING
+#endif
+
 #endif
@@ -60,10 +60,12 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdalexif.h"
 CPL_C_START
 #ifdef LIBJPEG_12_PATH
@@ -84,6 +86,14 @@ CPL_C_END
 #endif
 #endif
 
+// jpeg_skip_scanlines() is available since libjpeg-turbo 1.5, but had issues
+// with some upsampling modes before 2.1. Only used for 8-bit JPEG (the 12-bit
+// driver is built from this file with JPGDataset defined).
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && !defined(JPGDataset) &&          \
+    LIBJPEG_TURBO_VERSION_NUMBER >= 2001000
+#define JPGDATASET_HAS_SKIP_SCANLINES
+#endif
+
 constexpr int TIFF_VERSION = 42;
 
 constexpr int TIFF_BIGENDIAN = 0x4d4d;
@@ -1520,6 +1530,30 @@ CPLErr JPGRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr JPGRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                int nXSize, int nYSize, void *pData,
+                                int nBufXSize, int nBufYSize,
+                                GDALDataType eBufType, GSpacing nPixelSpace,
+                                GSpacing nLineSpace,
+                                GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        poGDS->ReadLinesInParallel(nXOff, nYOff, nXSize, nYSize, pData,
+                                   eBufType, 1, &nBand, nPixelSpace,
+                                   nLineSpace, 0))
+    {
+        return CE_None;
+    }
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                       GetColorInterpretation()                       */
 /************************************************************************/
@@ -2200,6 +2234,21 @@ CPLErr JPGDataset::LoadScanline(int iLine, GByte *outBuffer)
             return CE_Failure;
     }
 
+#ifdef JPGDATASET_HAS_SKIP_SCANLINES
+    // Jump over the lines we are not interested in: they still need to be
+    // entropy decoded, but the IDCT, upsampling and color conversion of
+    // most of them is skipped, which matters for windowed reads far from
+    // the top of the image.
+    if (iLine > nLoadedScanline + 1)
+    {
+        const JDIMENSION nSkipped = jpeg_skip_scanlines(
+            &sDInfo, static_cast<JDIMENSION>(iLine - 1 - nLoadedScanline));
+        if (ErrorOutOnNonFatalError())
+            return CE_Failure;
+        nLoadedScanline += static_cast<int>(nSkipped);
+    }
+#endif
+
     while (nLoadedScanline < iLine)
     {
         GDAL_JSAMPLE *ppSamples = reinterpret_cast<GDAL_JSAMPLE *>(
@@ -2378,17 +2427,706 @@ void JPGDataset::LoadDefaultTables(int n)
 /*                       SetScaleNumAndDenom()                          */
 /************************************************************************/
 
-void JPGDataset::SetScaleNumAndDenom()
+static void SetDecompressScale(struct jpeg_decompress_struct *psDInfo,
+                               int nScaleFactor)
 {
 #if JPEG_LIB_VERSION > 62
-    sDInfo.scale_num = 8 / nScaleFactor;
-    sDInfo.scale_denom = 8;
+    psDInfo->scale_num = 8 / nScaleFactor;
+    psDInfo->scale_denom = 8;
+#else
+    psDInfo->scale_num = 1;
+    psDInfo->scale_denom = nScaleFactor;
+#endif
+}
+
+void JPGDataset::SetScaleNumAndDenom()
+{
+    SetDecompressScale(&sDInfo, nScaleFactor);
+}
+
+#if !defined(JPGDataset)
+
+/************************************************************************/
+/*                          InitRestartIndex()                          */
+/*                                                                      */
+/*      Parse the headers of the JPEG stream to check if it can be      */
+/*      decoded in parallel, one run of restart intervals per thread.   */
+/*      That requires a single baseline scan whose restart intervals    */
+/*      are made of whole MCU rows.                                     */
+/************************************************************************/
+
+bool JPGDataset::InitRestartIndex()
+{
+    if (m_bRestartIndexInitDone)
+        return !m_anRestartIntervalOffsets.empty();
+    m_bRestartIndexInitDone = true;
+
+    if (m_fpImage == nullptr || GetDataPrecision() != 8)
+        return false;
+
+    // Save current position to avoid disturbing JPEG stream decoding.
+    const vsi_l_offset nCurOffset = VSIFTellL(m_fpImage);
+    VSIFSeekL(m_fpImage, nSubfileOffset, SEEK_SET);
+
+    std::vector<GByte> abyHeader;
+    GByte abySOI[2] = {0, 0};
+    if (VSIFReadL(abySOI, 1, 2, m_fpImage) != 2 || abySOI[0] != 0xFF ||
+        abySOI[1] != 0xD8)
+    {
+        VSIFSeekL(m_fpImage, nCurOffset, SEEK_SET);
+        return false;
+    }
+    abyHeader.insert(abyHeader.end(), abySOI, abySOI + 2);
+
+    int nWidth = 0;
+    int nHeight = 0;
+    int nComponents = 0;
+    int nMaxHSampling = 1;
+    int nMaxVSampling = 1;
+    int nMinVSampling = 4;
+    int nRestartInterval = 0;
+    size_t nHeightPos = 0;
+    bool bHasDQT = false;
+    bool bHasDHT = false;
+    bool bOK = false;
+    std::vector<GByte> abySegment;
+    while (true)
+    {
+        GByte abyMarker[4] = {0, 0, 0, 0};
+        if (VSIFReadL(abyMarker, 1, 4, m_fpImage) != 4 ||
+            abyMarker[0] != 0xFF)
+            break;
+        const int nMarker = abyMarker[1];
+        const int nSegmentSize = (abyMarker[2] << 8) | abyMarker[3];
+        // Markers without a payload are not expected in the header
+        if (nSegmentSize < 2 || nMarker == 0x01 ||
+            (nMarker >= 0xD0 && nMarker <= 0xD9))
+            break;
+        abySegment.resize(nSegmentSize - 2);
+        if (!abySegment.empty() &&
+            VSIFReadL(abySegment.data(), abySegment.size(), 1, m_fpImage) != 1)
+            break;
+
+        bool bKeep = true;
+        if (nMarker == 0xC0 || nMarker == 0xC1)
+        {
+            // SOF0 (baseline) or SOF1 (extended sequential Huffman)
+            if (nHeightPos != 0 || abySegment.size() < 6 ||
+                abySegment[0] != 8)
+                break;
+            nHeight = (abySegment[1] << 8) | abySegment[2];
+            nWidth = (abySegment[3] << 8) | abySegment[4];
+            nComponents = abySegment[5];
+            if (abySegment.size() < 6 + 3 * static_cast<size_t>(nComponents))
+                break;
+            for (int i = 0; i < nComponents; ++i)
+            {
+                const int nHSampling = abySegment[6 + 3 * i + 1] >> 4;
+                const int nVSampling = abySegment[6 + 3 * i + 1] & 0xF;
+                nMaxHSampling = std::max(nMaxHSampling, nHSampling);
+                nMaxVSampling = std::max(nMaxVSampling, nVSampling);
+                nMinVSampling = std::min(nMinVSampling, nVSampling);
+            }
+            nHeightPos = abyHeader.size() + 5;
+        }
+        else if (nMarker >= 0xC2 && nMarker <= 0xCF && nMarker != 0xC4)
+        {
+            // Progressive, lossless, hierarchical or arithmetic coding
+            break;
+        }
+        else if (nMarker == 0xC4)
+        {
+            bHasDHT = true;
+        }
+        else if (nMarker == 0xDB)
+        {
+            bHasDQT = true;
+        }
+        else if (nMarker == 0xDD)
+        {
+            if (abySegment.size() < 2)
+                break;
+            nRestartInterval = (abySegment[0] << 8) | abySegment[1];
+        }
+        else if ((nMarker >= 0xE1 && nMarker <= 0xED) || nMarker == 0xEF ||
+                 nMarker == 0xFE)
+        {
+            // Skip APPn (EXIF, XMP, ICC, ...) and COM segments, but keep
+            // APP0 (JFIF) and APP14 (Adobe) that libjpeg uses to guess the
+            // color space.
+            bKeep = false;
+        }
+
+        if (bKeep)
+        {
+            abyHeader.insert(abyHeader.end(), abyMarker, abyMarker + 4);
+            abyHeader.insert(abyHeader.end(), abySegment.begin(),
+                             abySegment.end());
+        }
+
+        if (nMarker == 0xDA)
+        {
+            // SOS: the scan must contain all components, and be sequential
+            const int nScanComponents = abySegment.empty() ? 0 : abySegment[0];
+            const size_t nSpectralPos = 1 + 2 * nScanComponents;
+            bOK = nHeightPos != 0 && nScanComponents == nComponents &&
+                  abySegment.size() >= nSpectralPos + 3 &&
+                  abySegment[nSpectralPos] == 0 &&
+                  abySegment[nSpectralPos + 1] == 63 &&
+                  abySegment[nSpectralPos + 2] == 0;
+            break;
+        }
+    }
+    const vsi_l_offset nDataOffset = VSIFTellL(m_fpImage);
+    VSIFSeekL(m_fpImage, nCurOffset, SEEK_SET);
+
+    if (!bOK || !bHasDQT || !bHasDHT || nRestartInterval == 0 ||
+        nComponents != nBands ||
+        nWidth != static_cast<int>(sDInfo.image_width) ||
+        nHeight != static_cast<int>(sDInfo.image_height))
+    {
+        return false;
+    }
+
+    // A single component scan is non-interleaved: its MCU is a 8x8 block
+    const int nMCUWidth = nComponents == 1 ? 8 : 8 * nMaxHSampling;
+    const int nMCUHeight = nComponents == 1 ? 8 : 8 * nMaxVSampling;
+    const int nMCUsPerRow = DIV_ROUND_UP(nWidth, nMCUWidth);
+    if ((nRestartInterval % nMCUsPerRow) != 0)
+        return false;
+    m_nRestartIntervalLines = (nRestartInterval / nMCUsPerRow) * nMCUHeight;
+    m_nRestartIntervalCount = DIV_ROUND_UP(nHeight, m_nRestartIntervalLines);
+    if (m_nRestartIntervalCount < 2)
+        return false;
+
+    CPLDebug("JPEG", "%d restart intervals of %d lines",
+             m_nRestartIntervalCount, m_nRestartIntervalLines);
+    m_abyRestartHeader = std::move(abyHeader);
+    m_nRestartHeaderHeightPos = nHeightPos;
+    // Vertically subsampled components are upsampled with the help of the
+    // lines of the adjacent intervals
+    m_bRestartNeedsContext = nComponents > 1 && nMinVSampling != nMaxVSampling;
+    m_anRestartIntervalOffsets.push_back(nDataOffset);
+    m_nRestartScanOffset = nDataOffset;
+    return true;
+}
+
+/************************************************************************/
+/*                       IndexRestartIntervals()                        */
+/*                                                                      */
+/*      Scan the entropy coded data for restart markers, until the      */
+/*      end of interval nLastInterval is known.                         */
+/************************************************************************/
+
+bool JPGDataset::IndexRestartIntervals(int nLastInterval)
+{
+    const auto IsIndexed = [this, nLastInterval]()
+    {
+        return m_anRestartIntervalOffsets.size() >
+               static_cast<size_t>(nLastInterval) + 1;
+    };
+    if (IsIndexed())
+        return true;
+    if (m_bRestartScanDone)
+        return false;
+
+    const auto Invalidate = [this]()
+    {
+        CPLDebug("JPEG", "Unexpected restart markers. Parallel decoding "
+                         "disabled");
+        m_anRestartIntervalOffsets.clear();
+        m_bRestartScanDone = true;
+    };
+
+    // Save current position to avoid disturbing JPEG stream decoding.
+    const vsi_l_offset nCurOffset = VSIFTellL(m_fpImage);
+    VSIFSeekL(m_fpImage, m_nRestartScanOffset, SEEK_SET);
+
+    constexpr size_t BUFFER_SIZE = 1024 * 1024;
+    std::vector<GByte> abyBuffer(BUFFER_SIZE);
+    vsi_l_offset nBufferOffset = m_nRestartScanOffset;
+    bool bPendingFF = false;
+    while (!m_bRestartScanDone && !IsIndexed())
+    {
+        const size_t nRead =
+            VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), m_fpImage);
+        if (nRead == 0)
+        {
+            // Truncated file
+            Invalidate();
+            break;
+        }
+        size_t i = 0;
+        while (i < nRead && !m_bRestartScanDone && !IsIndexed())
+        {
+            if (!bPendingFF)
+            {
+                const void *pFF =
+                    memchr(abyBuffer.data() + i, 0xFF, nRead - i);
+                if (pFF == nullptr)
+                    break;
+                i = static_cast<const GByte *>(pFF) - abyBuffer.data() + 1;
+                bPendingFF = true;
+                continue;
+            }
+            const GByte nCode = abyBuffer[i];
+            ++i;
+            if (nCode == 0xFF)  // Fill byte
+                continue;
+            bPendingFF = false;
+            if (nCode == 0x00)  // Stuffed byte
+                continue;
+
+            const vsi_l_offset nAfterMarker = nBufferOffset + i;
+            const size_t nKnownIntervals = m_anRestartIntervalOffsets.size();
+            if (nCode >= 0xD0 && nCode <= 0xD7)
+            {
+                if (nCode - 0xD0 !=
+                        static_cast<int>((nKnownIntervals - 1) % 8) ||
+                    nKnownIntervals >=
+                        static_cast<size_t>(m_nRestartIntervalCount))
+                {
+                    Invalidate();
+                    break;
+                }
+            }
+            else
+            {
+                // EOI, or any other marker, ends the scan
+                m_bRestartScanDone = true;
+                if (nKnownIntervals !=
+                    static_cast<size_t>(m_nRestartIntervalCount))
+                {
+                    Invalidate();
+                    break;
+                }
+            }
+            m_anRestartIntervalOffsets.push_back(nAfterMarker);
+            m_nRestartScanOffset = nAfterMarker;
+        }
+        nBufferOffset += nRead;
+    }
+
+    VSIFSeekL(m_fpImage, nCurOffset, SEEK_SET);
+    return IsIndexed();
+}
+
+namespace
+{
+
+/************************************************************************/
+/*                        JPGRestartIntervalsSource                     */
+/*                                                                      */
+/*      Source manager feeding libjpeg with a stream made of the JPEG   */
+/*      header and of a run of consecutive restart intervals, with      */
+/*      restart markers renumbered from 0.                              */
+/************************************************************************/
+
+struct JPGRestartIntervalsSource
+{
+    struct jpeg_source_mgr pub;
+    std::vector<std::pair<const GByte *, size_t>> aoParts{};
+    size_t iNextPart = 0;
+};
+
+}  // namespace
+
+static void JPGRestartIntervalsInitSource(j_decompress_ptr)
+{
+}
+
+static void JPGRestartIntervalsTermSource(j_decompress_ptr)
+{
+}
+
+static boolean JPGRestartIntervalsFillInputBuffer(j_decompress_ptr cinfo)
+{
+    auto psSrc = reinterpret_cast<JPGRestartIntervalsSource *>(cinfo->src);
+    static const JOCTET abyEOI[2] = {0xFF, JPEG_EOI};
+    if (psSrc->iNextPart < psSrc->aoParts.size())
+    {
+        psSrc->pub.next_input_byte = psSrc->aoParts[psSrc->iNextPart].first;
+        psSrc->pub.bytes_in_buffer = psSrc->aoParts[psSrc->iNextPart].second;
+        ++psSrc->iNextPart;
+    }
+    else
+    {
+        // Insert a fake EOI marker, as libjpeg's data sources do.
+        psSrc->pub.next_input_byte = abyEOI;
+        psSrc->pub.bytes_in_buffer = 2;
+    }
+    return TRUE;
+}
+
+static void JPGRestartIntervalsSkipInputData(j_decompress_ptr cinfo,
+                                             long num_bytes)
+{
+    auto psSrc = reinterpret_cast<JPGRestartIntervalsSource *>(cinfo->src);
+    while (num_bytes > static_cast<long>(psSrc->pub.bytes_in_buffer))
+    {
+        num_bytes -= static_cast<long>(psSrc->pub.bytes_in_buffer);
+        JPGRestartIntervalsFillInputBuffer(cinfo);
+    }
+    if (num_bytes > 0)
+    {
+        psSrc->pub.next_input_byte += num_bytes;
+        psSrc->pub.bytes_in_buffer -= num_bytes;
+    }
+}
+
+namespace
+{
+
+/************************************************************************/
+/*                          JPGParallelRequest                          */
+/************************************************************************/
+
+struct JPGParallelRequest
+{
+    const JPGDataset *poDS = nullptr;
+    int nScaleFactor = 1;
+    J_COLOR_SPACE eOutColorSpace = JCS_UNKNOWN;
+    int nComponents = 0;
+    int nRasterXSize = 0;
+    int nOutLinesPerInterval = 0;  // at nScaleFactor
+    const GByte *pabyCompressed = nullptr;
+    vsi_l_offset nCompressedOffset = 0;
+    // Window of the request
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    GByte *pabyData = nullptr;
+    GDALDataType eBufType = GDT_Byte;
+    int nBandCount = 0;
+    const int *panBandMap = nullptr;
+    GSpacing nPixelSpace = 0;
+    GSpacing nLineSpace = 0;
+    GSpacing nBandSpace = 0;
+    bool bDirectCopy = false;
+};
+
+/************************************************************************/
+/*                             JPGParallelRun                           */
+/************************************************************************/
+
+struct JPGParallelRun
+{
+    const JPGParallelRequest *psRequest = nullptr;
+    int iFirstInterval = 0;  // decoded, including context interval
+    int iLastInterval = 0;   // decoded, including context interval
+    int nFirstLine = 0;      // first output line to keep, in the image
+    int nLines = 0;          // number of output lines to keep
+    bool bOK = false;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                     DecodeRestartIntervalsJob()                      */
+/************************************************************************/
+
+void JPGDataset::DecodeRestartIntervalsJob(void *pData)
+{
+    JPGParallelRun *psRun = static_cast<JPGParallelRun *>(pData);
+    const JPGParallelRequest *psRequest = psRun->psRequest;
+    const JPGDataset *poDS = psRequest->poDS;
+
+    // Errors will be reported by the sequential code path the caller falls
+    // back to.
+    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+
+    // Patch the height of the image in the copy of the header
+    std::vector<GByte> abyHeader(poDS->m_abyRestartHeader);
+    const int nImageHeight = static_cast<int>(poDS->sDInfo.image_height);
+    const int nStreamFirstLine =
+        psRun->iFirstInterval * poDS->m_nRestartIntervalLines;
+    const int nStreamHeight =
+        std::min(nImageHeight,
+                 (psRun->iLastInterval + 1) * poDS->m_nRestartIntervalLines) -
+        nStreamFirstLine;
+    abyHeader[poDS->m_nRestartHeaderHeightPos] =
+        static_cast<GByte>(nStreamHeight >> 8);
+    abyHeader[poDS->m_nRestartHeaderHeightPos + 1] =
+        static_cast<GByte>(nStreamHeight & 0xFF);
+
+    static const GByte abyRST[8][2] = {
+        {0xFF, 0xD0}, {0xFF, 0xD1}, {0xFF, 0xD2}, {0xFF, 0xD3},
+        {0xFF, 0xD4}, {0xFF, 0xD5}, {0xFF, 0xD6}, {0xFF, 0xD7}};
+    JPGRestartIntervalsSource sSrc;
+    memset(&sSrc.pub, 0, sizeof(sSrc.pub));
+    sSrc.aoParts.emplace_back(abyHeader.data(), abyHeader.size());
+    for (int i = psRun->iFirstInterval; i <= psRun->iLastInterval; ++i)
+    {
+        if (i > psRun->iFirstInterval)
+            sSrc.aoParts.emplace_back(
+                abyRST[(i - psRun->iFirstInterval - 1) % 8], 2);
+        // Exclude the marker that ends the interval
+        const vsi_l_offset nStart = poDS->m_anRestartIntervalOffsets[i];
+        const vsi_l_offset nEnd = poDS->m_anRestartIntervalOffsets[i + 1] - 2;
+        sSrc.aoParts.emplace_back(psRequest->pabyCompressed +
+                                      (nStart - psRequest->nCompressedOffset),
+                                  static_cast<size_t>(nEnd - nStart));
+    }
+    sSrc.pub.init_source = JPGRestartIntervalsInitSource;
+    sSrc.pub.fill_input_buffer = JPGRestartIntervalsFillInputBuffer;
+    sSrc.pub.skip_input_data = JPGRestartIntervalsSkipInputData;
+    sSrc.pub.resync_to_restart = jpeg_resync_to_restart;
+    sSrc.pub.term_source = JPGRestartIntervalsTermSource;
+
+    // Lines of the context interval and of the window that are above the
+    // request
+    const int nStreamFirstOutLine =
+        psRun->iFirstInterval * psRequest->nOutLinesPerInterval;
+    const int nLinesToSkip = psRun->nFirstLine - nStreamFirstOutLine;
+
+    std::vector<GByte> abyScanline;
+    if (!psRequest->bDirectCopy || nLinesToSkip > 0)
+    {
+        try
+        {
+            abyScanline.resize(static_cast<size_t>(psRequest->nRasterXSize) *
+                               psRequest->nComponents);
+        }
+        catch (const std::exception &)
+        {
+            return;
+        }
+    }
+
+    GDALJPEGUserData sUserData;
+    struct jpeg_error_mgr sJErr;
+    struct jpeg_decompress_struct sJobDInfo;
+    memset(&sJobDInfo, 0, sizeof(sJobDInfo));
+    sJobDInfo.err = jpeg_std_error(&sJErr);
+    sJErr.error_exit = JPGDataset::ErrorExit;
+    sJErr.output_message = JPGDataset::OutputMessage;
+    sUserData.p_previous_emit_message = sJErr.emit_message;
+    sJErr.emit_message = JPGDataset::EmitMessage;
+    sJobDInfo.client_data = &sUserData;
+
+    // Setup to trap a fatal error.
+    if (setjmp(sUserData.setjmp_buffer))
+    {
+        jpeg_destroy_decompress(&sJobDInfo);
+        return;
+    }
+
+    jpeg_create_decompress(&sJobDInfo);
+    SetMaxMemoryToUse(&sJobDInfo);
+    sJobDInfo.src = &sSrc.pub;
+    jpeg_read_header(&sJobDInfo, TRUE);
+    sJobDInfo.out_color_space = psRequest->eOutColorSpace;
+    SetDecompressScale(&sJobDInfo, psRequest->nScaleFactor);
+    jpeg_start_decompress(&sJobDInfo);
+    if (static_cast<int>(sJobDInfo.output_width) != psRequest->nRasterXSize ||
+        sJobDInfo.output_components != psRequest->nComponents)
+    {
+        jpeg_destroy_decompress(&sJobDInfo);
+        return;
+    }
+
+#ifdef JPGDATASET_HAS_SKIP_SCANLINES
+    const int nLinesSkipped =
+        nLinesToSkip > 0
+            ? static_cast<int>(jpeg_skip_scanlines(
+                  &sJobDInfo, static_cast<JDIMENSION>(nLinesToSkip)))
+            : 0;
 #else
-    sDInfo.scale_num = 1;
-    sDInfo.scale_denom = nScaleFactor;
+    constexpr int nLinesSkipped = 0;
 #endif
+    for (int iLine = nLinesSkipped - nLinesToSkip;
+         iLine < psRun->nLines && !sUserData.bNonFatalErrorEncountered;
+         ++iLine)
+    {
+        GByte *pabyDstLine =
+            iLine >= 0 ? psRequest->pabyData +
+                             (psRun->nFirstLine - psRequest->nYOff + iLine) *
+                                 psRequest->nLineSpace
+                       : nullptr;
+        GDAL_JSAMPLE *ppSamples = reinterpret_cast<GDAL_JSAMPLE *>(
+            psRequest->bDirectCopy && pabyDstLine ? pabyDstLine
+                                                  : abyScanline.data());
+        if (jpeg_read_scanlines(&sJobDInfo, &ppSamples, 1) != 1)
+            break;
+        if (pabyDstLine && !psRequest->bDirectCopy)
+        {
+            for (int iBand = 0; iBand < psRequest->nBandCount; ++iBand)
+            {
+                GDALCopyWords64(
+                    abyScanline.data() +
+                        static_cast<size_t>(psRequest->nXOff) *
+                            psRequest->nComponents +
+                        (psRequest->panBandMap[iBand] - 1),
+                    GDT_Byte, psRequest->nComponents,
+                    pabyDstLine + iBand * psRequest->nBandSpace,
+                    psRequest->eBufType,
+                    static_cast<int>(psRequest->nPixelSpace),
+                    psRequest->nXSize);
+            }
+        }
+        if (iLine == psRun->nLines - 1)
+            psRun->bOK = !sUserData.bNonFatalErrorEncountered;
+    }
+
+    jpeg_abort_decompress(&sJobDInfo);
+    jpeg_destroy_decompress(&sJobDInfo);
 }
 
+/************************************************************************/
+/*                        ReadLinesInParallel()                         */
+/************************************************************************/
+
+bool JPGDataset::ReadLinesInParallel(int nXOff, int nYOff, int nXSize,
+                                     int nYSize, void *pData,
+                                     GDALDataType eBufType, int nBandCount,
+                                     const int *panBandMap,
+                                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                                     GSpacing nBandSpace)
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return false;
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::min(nThreads, 1024);
+    if (nThreads <= 1)
+        return false;
+
+    const int nOutColorSpace = GetOutColorSpace();
+    if (pData == nullptr ||
+        (nOutColorSpace != JCS_GRAYSCALE && nOutColorSpace != JCS_RGB &&
+         nOutColorSpace != JCS_YCbCr) ||
+        nPixelSpace > INT_MAX || !InitRestartIndex())
+    {
+        return false;
+    }
+
+    const int nOutLinesPerInterval = m_nRestartIntervalLines / nScaleFactor;
+    const int nFirstInterval = nYOff / nOutLinesPerInterval;
+    const int nLastInterval = (nYOff + nYSize - 1) / nOutLinesPerInterval;
+    const int nIntervals = nLastInterval - nFirstInterval + 1;
+    // Each run should be made of at least 2 intervals, as decoding
+    // the context interval before it may be needed
+    const int nRuns = std::min(nThreads * 2, nIntervals / 2);
+    if (nRuns < 2)
+        return false;
+
+    const int nContext = m_bRestartNeedsContext ? 1 : 0;
+    const int nFirstDecodedInterval = std::max(0, nFirstInterval - nContext);
+    const int nLastDecodedInterval =
+        std::min(m_nRestartIntervalCount - 1, nLastInterval + nContext);
+    if (!IndexRestartIntervals(nLastDecodedInterval))
+        return false;
+
+    // Read the compressed data of all the intervals at once.
+    const vsi_l_offset nCompressedOffset =
+        m_anRestartIntervalOffsets[nFirstDecodedInterval];
+    const vsi_l_offset nCompressedSize =
+        m_anRestartIntervalOffsets[nLastDecodedInterval + 1] -
+        nCompressedOffset;
+    if (nCompressedSize > std::numeric_limits<size_t>::max() / 2)
+        return false;
+    std::vector<GByte> abyCompressed;
+    try
+    {
+        abyCompressed.resize(static_cast<size_t>(nCompressedSize));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    const vsi_l_offset nCurOffset = VSIFTellL(m_fpImage);
+    const bool bReadOK =
+        VSIFSeekL(m_fpImage, nCompressedOffset, SEEK_SET) == 0 &&
+        VSIFReadL(abyCompressed.data(), abyCompressed.size(), 1, m_fpImage) ==
+            1;
+    VSIFSeekL(m_fpImage, nCurOffset, SEEK_SET);
+    if (!bReadOK)
+        return false;
+
+    JPGParallelRequest sRequest;
+    sRequest.poDS = this;
+    sRequest.nScaleFactor = nScaleFactor;
+    sRequest.eOutColorSpace = static_cast<J_COLOR_SPACE>(nOutColorSpace);
+    sRequest.nComponents = nBands;
+    sRequest.nRasterXSize = nRasterXSize;
+    sRequest.nOutLinesPerInterval = nOutLinesPerInterval;
+    sRequest.pabyCompressed = abyCompressed.data();
+    sRequest.nCompressedOffset = nCompressedOffset;
+    sRequest.nXOff = nXOff;
+    sRequest.nYOff = nYOff;
+    sRequest.nXSize = nXSize;
+    sRequest.nYSize = nYSize;
+    sRequest.pabyData = static_cast<GByte *>(pData);
+    sRequest.eBufType = eBufType;
+    sRequest.nBandCount = nBandCount;
+    sRequest.panBandMap = panBandMap;
+    sRequest.nPixelSpace = nPixelSpace;
+    sRequest.nLineSpace = nLineSpace;
+    sRequest.nBandSpace = nBandSpace;
+    // Can libjpeg decode straight into the output buffer?
+    bool bIdentityBandMap = nBandCount == nBands;
+    for (int i = 0; bIdentityBandMap && i < nBandCount; ++i)
+        bIdentityBandMap = panBandMap[i] == i + 1;
+    sRequest.bDirectCopy = bIdentityBandMap && nXOff == 0 &&
+                           nXSize == nRasterXSize && eBufType == GDT_Byte &&
+                           nPixelSpace == nBands &&
+                           (nBands == 1 || nBandSpace == 1);
+
+    std::vector<JPGParallelRun> asRuns(nRuns);
+    for (int iRun = 0; iRun < nRuns; ++iRun)
+    {
+        auto &sRun = asRuns[iRun];
+        sRun.psRequest = &sRequest;
+        const int iRunFirstInterval =
+            nFirstInterval +
+            static_cast<int>(static_cast<int64_t>(iRun) * nIntervals / nRuns);
+        const int iRunLastInterval =
+            nFirstInterval +
+            static_cast<int>(static_cast<int64_t>(iRun + 1) * nIntervals /
+                             nRuns) -
+            1;
+        sRun.iFirstInterval =
+            std::max(nFirstDecodedInterval, iRunFirstInterval - nContext);
+        sRun.iLastInterval =
+            std::min(nLastDecodedInterval, iRunLastInterval + nContext);
+        sRun.nFirstLine =
+            std::max(nYOff, iRunFirstInterval * nOutLinesPerInterval);
+        sRun.nLines =
+            std::min(nYOff + nYSize,
+                     (iRunLastInterval + 1) * nOutLinesPerInterval) -
+            sRun.nFirstLine;
+    }
+
+    GDALThreadReservation oThreadReservation(std::min(nThreads, nRuns));
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+        return false;
+
+    CPLDebug("JPEG", "Decoding %d restart intervals with up to %d threads",
+             nIntervals, oThreadReservation.GetThreadCount());
+    for (auto &sRun : asRuns)
+        poJobQueue->SubmitJob(DecodeRestartIntervalsJob, &sRun);
+    poJobQueue->WaitCompletion();
+
+    for (const auto &sRun : asRuns)
+    {
+        if (!sRun.bOK)
+        {
+            CPLDebug("JPEG", "Parallel decoding failed");
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif  // !defined(JPGDataset)
+
 /************************************************************************/
 /*                              Restart()                               */
 /*                                                                      */
@@ -2570,6 +3308,14 @@ CPLErr JPGDatasetCommon::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        ReadLinesInParallel(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                            nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                            nBandSpace))
+    {
+        return CE_None;
+    }
+
 #ifndef JPEG_LIB_MK1
     if ((eRWFlag == GF_Read) && (nBandCount == 3) && (nBands == 3) &&
         (nXOff == 0) && (nYOff == 0) && (nXSize == nBufXSize) &&
@@ -4572,6 +5318,29 @@ GDALDataset *JPGDataset::CreateCopyStage2(
     if (bProgressive)
         jpeg_simple_progression(&sCInfo);
 
+    // Restart markers at MCU row boundaries enable parallel decoding.
+    const char *pszRestartInterval =
+        CSLFetchNameValueDef(papszOptions, "RESTART_INTERVAL", "AUTO");
+    if (EQUAL(pszRestartInterval, "AUTO"))
+    {
+        if (!bProgressive && !sCInfo.arith_code && nYSize >= 1024)
+        {
+            int nMaxVSampling = 1;
+            for (int i = 0; i < sCInfo.num_components; ++i)
+                nMaxVSampling =
+                    std::max(nMaxVSampling, sCInfo.comp_info[i].v_samp_factor);
+            const int nMCUHeight = sCInfo.num_components == 1
+                                       ? DCTSIZE
+                                       : DCTSIZE * nMaxVSampling;
+            // About one restart marker every 128 lines
+            sCInfo.restart_in_rows = std::max(1, 128 / nMCUHeight);
+        }
+    }
+    else
+    {
+        sCInfo.restart_in_rows = std::max(0, atoi(pszRestartInterval));
+    }
+
     jpeg_start_compress(&sCInfo, TRUE);
 
     JPGAddEXIF(eWorkDT, poSrcDS, papszOptions, &sCInfo,
@@ -4838,7 +5607,10 @@ const char *GDALJPGDriver::GetMetadataItem(const char *pszName,
             "to generate a worldfile' default='NO'/>\n"
             "   <Option name='INTERNAL_MASK' type='boolean' "
             "description='whether to generate a validity mask' "
-            "default='YES'/>\n";
+            "default='YES'/>\n"
+            "   <Option name='RESTART_INTERVAL' type='string' "
+            "description='AUTO, or number of MCU rows between restart "
+            "markers (0 for none)' default='AUTO'/>\n";
 #ifndef C_ARITH_CODING_SUPPORTED
         if (GDALJPEGIsArithmeticCodingAvailable())
 #endif
@@ -47,6 +47,7 @@
 
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -212,6 +213,22 @@ class JPGDatasetCommon CPL_NON_FINAL : public GDALPamDataset
     virtual int GetOutColorSpace() = 0;
     virtual int GetJPEGColorSpace() = 0;
 
+    // Decode a window in parallel by using the restart markers of the JPEG
+    // stream. Returns false if that is not possible (the caller will then
+    // go through the sequential code path).
+    virtual bool ReadLinesInParallel(int /* nXOff */, int /* nYOff */,
+                                     int /* nXSize */, int /* nYSize */,
+                                     void * /* pData */,
+                                     GDALDataType /* eBufType */,
+                                     int /* nBandCount */,
+                                     const int * /* panBandMap */,
+                                     GSpacing /* nPixelSpace */,
+                                     GSpacing /* nLineSpace */,
+                                     GSpacing /* nBandSpace */)
+    {
+        return false;
+    }
+
     bool EXIFInit(VSILFILE *);
     void ReadICCProfile();
 
@@ -327,6 +344,30 @@ class JPGDataset final : public JPGDatasetCommon
     int nQLevel;
 #if !defined(JPGDataset)
     void LoadDefaultTables(int);
+
+    // Index of the restart intervals of a baseline JPEG stream whose restart
+    // markers are at MCU row boundaries, for parallel decoding.
+    bool m_bRestartIndexInitDone = false;
+    std::vector<GByte> m_abyRestartHeader{};  // from SOI to the end of SOS
+    size_t m_nRestartHeaderHeightPos = 0;     // position of height in SOF
+    int m_nRestartIntervalLines = 0;          // at full resolution
+    int m_nRestartIntervalCount = 0;
+    bool m_bRestartNeedsContext = false;  // vertical chroma upsampling
+    // Offset of the entropy coded data of each interval, followed when known
+    // by the offset just after the marker ending the last interval
+    std::vector<vsi_l_offset> m_anRestartIntervalOffsets{};
+    vsi_l_offset m_nRestartScanOffset = 0;
+    bool m_bRestartScanDone = false;
+
+    bool InitRestartIndex();
+    bool IndexRestartIntervals(int nLastInterval);
+    static void DecodeRestartIntervalsJob(void *pData);
+
+    bool ReadLinesInParallel(int nXOff, int nYOff, int nXSize, int nYSize,
+                             void *pData, GDALDataType eBufType,
+                             int nBandCount, const int *panBandMap,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GSpacing nBandSpace) override;
 #endif
     void SetScaleNumAndDenom();
 
@@ -378,6 +419,10 @@ class JPGRasterBand final : public GDALPamRasterBand
     }
 
     virtual CPLErr IReadBlock(int, int, void *) override;
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, GSpacing nPixelSpace,
+                             GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual GDALColorInterp GetColorInterpretation() override;
 
     virtual GDALSuggestedBlockAccessPattern
@@ -136,6 +136,14 @@ class MBTilesDataset final : public GDALPamDataset,
                                    void *pProgressData,
                                    CSLConstList papszOptions) override;
 
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData, int nBufXSize,
+                             int nBufYSize, GDALDataType eBufType,
+                             int nBandCount, int *panBandMap,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GSpacing nBandSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
+
     virtual int GetLayerCount() override
     {
         return static_cast<int>(m_apoLayers.size());
@@ -3505,6 +3513,30 @@ void MBTilesDataset::ParseCompressionOptions(char **papszOptions)
         m_bDither = CPLTestBool(pszDither);
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 int *panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    const bool bPrefetched =
+        eRWFlag == GF_Read && PrefetchTiles(nXOff, nYOff, nXSize, nYSize,
+                                            nBufXSize, nBufYSize);
+    const CPLErr eErr = GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+    if (bPrefetched)
+        ClearPrefetchedTiles();
+    return eErr;
+}
+
 /************************************************************************/
 /*                          IBuildOverviews()                           */
 /************************************************************************/
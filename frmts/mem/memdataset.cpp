@@ -44,9 +44,19 @@
 #include "cpl_minixml.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
+#include "gdal_thread_pool.h"
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 struct MEMDataset::Private
 {
@@ -148,7 +158,10 @@ MEMRasterBand::~MEMRasterBand()
 {
     if (bOwnData)
     {
-        VSIFree(pabyData);
+        if (m_bOwnDataAligned)
+            VSIFreeAligned(pabyData);
+        else
+            VSIFree(pabyData);
     }
 }
 
@@ -718,6 +731,177 @@ CPLErr MEMDataset::SetGCPs(int nNewCount, const GDAL_GCP *pasNewGCPList,
     return CE_None;
 }
 
+/************************************************************************/
+/*                       MEMSetInterleavedPolicy()                      */
+/************************************************************************/
+
+// Requests pages of [pData, pData + nSize[ to be spread across all online
+// NUMA nodes when they are first touched.
+static void MEMSetInterleavedPolicy(void *pData, size_t nSize)
+{
+#if defined(__linux__) && defined(SYS_mbind) && defined(MPOL_INTERLEAVE)
+    // Content is for example "0-1" or "0,2-3"
+    unsigned long nNodeMask = 0;
+    int nNodes = 0;
+    VSILFILE *fp = VSIFOpenL("/sys/devices/system/node/online", "rb");
+    if (fp)
+    {
+        const char *pszLine = CPLReadLineL(fp);
+        const CPLStringList aosRanges(
+            CSLTokenizeString2(pszLine ? pszLine : "", ",", 0));
+        for (const char *pszRange : aosRanges)
+        {
+            const int nFirst = atoi(pszRange);
+            const char *pszDash = strchr(pszRange, '-');
+            const int nLast = pszDash ? atoi(pszDash + 1) : nFirst;
+            for (int i = std::max(nFirst, 0);
+                 i <= nLast && i < static_cast<int>(8 * sizeof(nNodeMask));
+                 ++i)
+            {
+                nNodeMask |= 1UL << i;
+                ++nNodes;
+            }
+        }
+        VSIFCloseL(fp);
+    }
+    if (nNodes < 2)
+    {
+        CPLDebug("MEM", "NUMA_PLACEMENT=INTERLEAVE ignored: "
+                        "less than 2 NUMA nodes");
+        return;
+    }
+
+    // mbind() requires a page aligned range
+    const size_t nPageSize = CPLGetPageSize();
+    const size_t nLen = nSize / nPageSize * nPageSize;
+    if (nLen > 0 && syscall(SYS_mbind, pData, nLen, MPOL_INTERLEAVE,
+                            &nNodeMask, 8 * sizeof(nNodeMask) + 1, 0) != 0)
+    {
+        CPLDebug("MEM", "mbind(MPOL_INTERLEAVE) failed");
+    }
+#else
+    CPL_IGNORE_RET_VAL(pData);
+    CPL_IGNORE_RET_VAL(nSize);
+    CPLDebug("MEM", "NUMA_PLACEMENT=INTERLEAVE not supported on this "
+                    "platform");
+#endif
+}
+
+/************************************************************************/
+/*                        MEMZeroInParallel()                           */
+/************************************************************************/
+
+// Zeroes the buffer from several threads, so that with the default first
+// touch policy of the OS, its pages are spread across the NUMA nodes of
+// the threads of the pool.
+static void MEMZeroInParallel(GByte *pabyData, size_t nSize, size_t nChunkSize)
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::min(nThreads, 1024);
+    const size_t nChunks = (nSize + nChunkSize - 1) / nChunkSize;
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 && nChunks > 1 ? GDALGetGlobalThreadPool(nThreads)
+                                    : nullptr;
+    if (!poPool)
+    {
+        memset(pabyData, 0, nSize);
+        return;
+    }
+
+    struct Job
+    {
+        GByte *pabyStart;
+        size_t nSize;
+    };
+
+    // Contiguous ranges, a few per thread
+    const size_t nJobs = std::min(nChunks, static_cast<size_t>(4) * nThreads);
+    const size_t nChunksPerJob = (nChunks + nJobs - 1) / nJobs;
+    std::vector<Job> asJobs;
+    for (size_t nOffset = 0; nOffset < nSize;
+         nOffset += nChunksPerJob * nChunkSize)
+    {
+        asJobs.push_back(
+            Job{pabyData + nOffset,
+                std::min(nChunksPerJob * nChunkSize, nSize - nOffset)});
+    }
+    std::vector<void *> apJobs;
+    for (auto &sJob : asJobs)
+        apJobs.push_back(&sJob);
+    poPool->SubmitJobs(
+        [](void *pData)
+        {
+            const Job *psJob = static_cast<const Job *>(pData);
+            memset(psJob->pabyStart, 0, psJob->nSize);
+        },
+        apJobs);
+    poPool->WaitCompletion();
+}
+
+/************************************************************************/
+/*                        MEMAllocateBandData()                         */
+/************************************************************************/
+
+// Allocates a zero-initialized buffer of nSize bytes, taking into account
+// the HUGE_PAGES and NUMA_PLACEMENT options. bAligned is set when the buffer
+// must be freed with VSIFreeAligned() instead of VSIFree().
+static GByte *MEMAllocateBandData(size_t nSize, CSLConstList papszOptions,
+                                  bool &bAligned)
+{
+    bAligned = false;
+    const bool bHugePages = CPLFetchBool(papszOptions, "HUGE_PAGES", false);
+    const char *pszNUMAPlacement =
+        CSLFetchNameValueDef(papszOptions, "NUMA_PLACEMENT", "DEFAULT");
+    const bool bFirstTouch = EQUAL(pszNUMAPlacement, "FIRST_TOUCH");
+    const bool bInterleave = EQUAL(pszNUMAPlacement, "INTERLEAVE");
+    if (!bFirstTouch && !bInterleave && !EQUAL(pszNUMAPlacement, "DEFAULT"))
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Unsupported value for NUMA_PLACEMENT: %s", pszNUMAPlacement);
+    }
+    if (!bHugePages && !bFirstTouch && !bInterleave)
+        return static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, nSize));
+
+    // Transparent huge pages are 2 MB large on x86_64, and on aarch64 with
+    // 4 KB base pages.
+    constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    const size_t nAlignment = bHugePages ? HUGE_PAGE_SIZE : CPLGetPageSize();
+    GByte *pabyData = static_cast<GByte *>(VSIMallocAligned(nAlignment, nSize));
+    if (!pabyData)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate " CPL_FRMT_GUIB " bytes",
+                 static_cast<GUIntBig>(nSize));
+        return nullptr;
+    }
+    bAligned = true;
+
+    // Policies must be set before pages are touched for the first time.
+    if (bHugePages)
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (madvise(pabyData, nSize / nAlignment * nAlignment,
+                    MADV_HUGEPAGE) != 0)
+        {
+            CPLDebug("MEM", "madvise(MADV_HUGEPAGE) failed");
+        }
+#else
+        CPLDebug("MEM", "HUGE_PAGES not supported on this platform");
+#endif
+    }
+    if (bInterleave)
+        MEMSetInterleavedPolicy(pabyData, nSize);
+
+    if (bFirstTouch)
+        MEMZeroInParallel(pabyData, nSize, nAlignment);
+    else
+        memset(pabyData, 0, nSize);
+    return pabyData;
+}
+
 /************************************************************************/
 /*                              AddBand()                               */
 /*                                                                      */
@@ -739,21 +923,28 @@ CPLErr MEMDataset::AddBand(GDALDataType eType, char **papszOptions)
     if (CSLFetchNameValue(papszOptions, "DATAPOINTER") == nullptr)
     {
         const GSpacing nTmp = nPixelSize * GetRasterXSize();
+        bool bAligned = false;
         GByte *pData =
 #if SIZEOF_VOIDP == 4
             (nTmp > INT_MAX) ? nullptr :
 #endif
-                             static_cast<GByte *>(VSI_CALLOC_VERBOSE(
-                                 (size_t)nTmp, GetRasterYSize()));
+            (GetRasterYSize() > 0 &&
+             static_cast<size_t>(nTmp) >
+                 std::numeric_limits<size_t>::max() / GetRasterYSize())
+                ? nullptr
+                : MEMAllocateBandData(static_cast<size_t>(nTmp) *
+                                          GetRasterYSize(),
+                                      papszOptions, bAligned);
 
         if (pData == nullptr)
         {
             return CE_Failure;
         }
 
-        SetBand(nBandId,
-                new MEMRasterBand(this, nBandId, pData, eType, nPixelSize,
-                                  nPixelSize * GetRasterXSize(), TRUE));
+        auto poBand = new MEMRasterBand(this, nBandId, pData, eType, nPixelSize,
+                                        nPixelSize * GetRasterXSize(), TRUE);
+        poBand->m_bOwnDataAligned = bAligned;
+        SetBand(nBandId, poBand);
 
         return CE_None;
     }
@@ -1271,10 +1462,11 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
 #endif
 
     std::vector<GByte *> apbyBandData;
+    bool bAligned = false;
     if (nBandsIn > 0)
     {
         GByte *pabyData =
-            static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, nGlobalSize));
+            MEMAllocateBandData(nGlobalSize, papszOptions, bAligned);
         if (!pabyData)
         {
             return nullptr;
@@ -1328,6 +1520,7 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
         else
             poNewBand = new MEMRasterBand(poDS, iBand + 1, apbyBandData[iBand],
                                           eType, 0, 0, iBand == 0);
+        poNewBand->m_bOwnDataAligned = bAligned && iBand == 0;
 
         poDS->SetBand(iBand + 1, poNewBand);
     }
@@ -3152,6 +3345,16 @@ void GDALRegister_MEM()
         "       <Value>BAND</Value>"
         "       <Value>PIXEL</Value>"
         "   </Option>"
+        "   <Option name='HUGE_PAGES' type='boolean' default='NO' "
+        "description='Whether to back the band buffers with transparent huge "
+        "pages (Linux only)'/>"
+        "   <Option name='NUMA_PLACEMENT' type='string-select' "
+        "default='DEFAULT' description='How the pages of the band buffers "
+        "are placed on NUMA nodes'>"
+        "       <Value>DEFAULT</Value>"
+        "       <Value>FIRST_TOUCH</Value>"
+        "       <Value>INTERLEAVE</Value>"
+        "   </Option>"
         "</CreationOptionList>");
 
     // Define GDAL_NO_OPEN_FOR_MEM_DRIVER macro to undefine Open() method for
@@ -153,6 +153,8 @@ class CPL_DLL MEMRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     GSpacing nPixelOffset;
     GSpacing nLineOffset;
     int bOwnData;
+    // Whether pabyData must be freed with VSIFreeAligned()
+    bool m_bOwnDataAligned = false;
 
     bool m_bIsMask = false;
 
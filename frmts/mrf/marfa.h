@@ -68,10 +68,15 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include <atomic>
+#include <deque>
+#include <memory>
 #if defined(ZSTD_SUPPORT)
 #include <zstd.h>
 #endif
 
+class CPLJobQueue;
+
 #define NAMESPACE_MRF_START                                                    \
     namespace GDAL_MRF                                                         \
     {
@@ -357,6 +362,31 @@ enum
 MRFRasterBand *newMRFRasterBand(MRFDataset *, const ILImage &, int,
                                 int level = 0);
 
+// A page handed over to a worker thread for compression
+struct MRFCompressJob
+{
+    MRFCompressJob() = default;
+    MRFCompressJob(const MRFCompressJob &) = delete;
+    MRFCompressJob &operator=(const MRFCompressJob &) = delete;
+
+    ~MRFCompressJob()
+    {
+        CPLFree(buffer);
+    }
+
+    MRFRasterBand *band = nullptr;
+    GUIntBig infooffset = 0;
+    // Raw page, followed by space for the compressed one
+    char *buffer = nullptr;
+    size_t pagesize = 0;
+    size_t buffersize = 0;
+    // Compressed page, points inside buffer
+    buf_mgr result = {nullptr, 0};
+    CPLErr ret = CE_None;
+    std::chrono::nanoseconds duration{0};
+    std::atomic<bool> done{false};
+};
+
 class MRFDataset final : public GDALPamDataset
 {
     friend class MRFRasterBand;
@@ -504,10 +534,26 @@ class MRFDataset final : public GDALPamDataset
 
     virtual int CloseDependentDatasets() override;
 
+    virtual CPLErr FlushCache(bool bAtClosing) override;
+
     // Write a tile, the infooffset is the relative position in the index file
     virtual CPLErr WriteTile(void *buff, GUIntBig infooffset,
                              GUIntBig size = 0);
 
+    // Job queue for compressing pages in worker threads, null if
+    // GDAL_NUM_THREADS is not set
+    CPLJobQueue *GetCompressQueue();
+
+    // Compress a page asynchronously, takes ownership of the job
+    CPLErr QueueTile(std::unique_ptr<MRFCompressJob> job);
+
+    // Write the compressed pages in submission order, until at most
+    // maxpending are left
+    CPLErr WritePendingTiles(size_t maxpending = 0);
+
+    // Is there a page for this index record waiting to be written
+    bool IsTilePending(GUIntBig infooffset) const;
+
     // Custom CopyWholeRaster for Zen JPEG
     CPLErr ZenCopy(GDALDataset *poSrc, GDALProgressFunc pfnProgress,
                    void *pProgressData);
@@ -631,6 +677,11 @@ class MRFDataset final : public GDALPamDataset
 #endif
     // Time duration spend for decompression and compression
     std::chrono::nanoseconds read_timer, write_timer;
+
+    // Asynchronous compression, -1 until GDAL_NUM_THREADS is checked
+    int compressThreads;
+    std::unique_ptr<CPLJobQueue> poCompressQueue;
+    std::deque<std::unique_ptr<MRFCompressJob>> pendingTiles;
 };
 
 class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
@@ -752,6 +803,16 @@ class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) = 0;
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) = 0;
 
+    // True if Compress() can run concurrently for different pages, without
+    // changing the band state
+    virtual bool CanCompressInParallel() const
+    {
+        return false;
+    }
+
+    // Compress a page, including the optional deflate or zstd stage
+    static void CompressJob(void *job);
+
     // Read the index record itself, can be overwritten
     //    virtual CPLErr ReadTileIdx(const ILSize &, ILIdx &, GIntBig bias = 0);
 
@@ -886,6 +947,12 @@ class JPEG_Band final : public MRFRasterBand
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) override;
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) override;
 
+    // The 12 bit encoder keeps a global clipping warning flag
+    virtual bool CanCompressInParallel() const override
+    {
+        return img.dt == GDT_Byte;
+    }
+
     JPEG_Codec codec;
 };
 
@@ -935,6 +1002,11 @@ class Raw_Band final : public MRFRasterBand
     {
         return Decompress(dst, src);
     }
+
+    virtual bool CanCompressInParallel() const override
+    {
+        return true;
+    }
 };
 
 class TIF_Band final : public MRFRasterBand
@@ -965,6 +1037,12 @@ class LERC_Band final : public MRFRasterBand
   protected:
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) override;
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) override;
+
+    virtual bool CanCompressInParallel() const override
+    {
+        return true;
+    }
+
     double precision;
     // L1 or L2
     int version;
@@ -1003,6 +1081,11 @@ class QB3_Band final : public MRFRasterBand
   protected:
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) override;
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) override;
+
+    virtual bool CanCompressInParallel() const override
+    {
+        return true;
+    }
 };
 #endif
 
@@ -61,7 +61,9 @@
 #include "marfa.h"
 #include "mrfdrivercore.h"
 #include "cpl_multiproc.h" /* for CPLSleep() */
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include <assert.h>
 
 #include <algorithm>
@@ -84,7 +86,8 @@ MRFDataset::MRFDataset()
       spacing(0), no_errors(0), missing(0), poSrcDS(nullptr), level(-1),
       cds(nullptr), scale(0.0), pbuffer(nullptr), pbsize(0), tile(ILSize()),
       bdirty(0), bGeoTransformValid(TRUE), poColorTable(nullptr), Quality(0),
-      pzscctx(nullptr), pzsdctx(nullptr), read_timer(), write_timer(0)
+      pzscctx(nullptr), pzsdctx(nullptr), read_timer(), write_timer(0),
+      compressThreads(-1)
 {
     m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
     //                X0   Xx   Xy  Y0    Yx   Yy
@@ -149,6 +152,112 @@ int MRFDataset::CloseDependentDatasets()
     return bHasDroppedRef;
 }
 
+CPLErr MRFDataset::FlushCache(bool bAtClosing)
+{
+    CPLErr ret = GDALPamDataset::FlushCache(bAtClosing);
+    // Dirty blocks may have been queued for compression
+    if (WritePendingTiles() != CE_None)
+        ret = CE_Failure;
+    return ret;
+}
+
+//
+// Pages can be compressed by the global thread pool when GDAL_NUM_THREADS is
+// set.  Only the compression runs in the worker threads, the data and index
+// files are written by the calling thread, in the order the pages were
+// submitted, so the output is identical to the single threaded one.
+//
+CPLJobQueue *MRFDataset::GetCompressQueue()
+{
+    if (compressThreads < 0)
+    {
+        compressThreads = 0;
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                               ? CPLGetNumCPUs()
+                               : atoi(pszNumThreads);
+            nThreads = std::min(nThreads, 1024);
+            if (nThreads > 1)
+            {
+                auto poPool = GDALGetGlobalThreadPool(nThreads);
+                if (poPool)
+                {
+                    poCompressQueue = poPool->CreateJobQueue();
+                    compressThreads = nThreads;
+                }
+            }
+        }
+    }
+    return poCompressQueue.get();
+}
+
+CPLErr MRFDataset::QueueTile(std::unique_ptr<MRFCompressJob> job)
+{
+    auto poQueue = GetCompressQueue();
+    if (!poQueue)
+    {  // Should not happen, compress in this thread
+        MRFRasterBand::CompressJob(job.get());
+        pendingTiles.push_back(std::move(job));
+        return WritePendingTiles();
+    }
+    pendingTiles.push_back(std::move(job));
+    if (!poQueue->SubmitJob(MRFRasterBand::CompressJob,
+                            pendingTiles.back().get()))
+    {
+        MRFRasterBand::CompressJob(pendingTiles.back().get());
+    }
+    // Keep the worker threads busy, while limiting the memory used
+    return WritePendingTiles(static_cast<size_t>(compressThreads) * 2);
+}
+
+CPLErr MRFDataset::WritePendingTiles(size_t maxpending)
+{
+    CPLErr ret = CE_None;
+    while (pendingTiles.size() > maxpending)
+    {
+        MRFCompressJob *job = pendingTiles.front().get();
+        while (!job->done)
+        {
+            // Wait for at least one more job to finish
+            int running = 0;
+            for (const auto &pending : pendingTiles)
+                if (!pending->done)
+                    running++;
+            if (running > 0)
+                poCompressQueue->WaitCompletion(running - 1);
+        }
+
+        write_timer += job->duration;
+        if (job->ret == CE_None)
+        {
+            if (WriteTile(job->result.buffer, job->infooffset,
+                          job->result.size) != CE_None)
+                ret = CE_Failure;
+        }
+        else
+        {
+            // Errors from the worker thread are not seen by the caller
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "MRF: Tile compression error");
+            WriteTile(nullptr, job->infooffset, 0);
+            ret = CE_Failure;
+        }
+        pendingTiles.pop_front();
+    }
+    return ret;
+}
+
+bool MRFDataset::IsTilePending(GUIntBig infooffset) const
+{
+    for (const auto &job : pendingTiles)
+        if (job->infooffset == infooffset)
+            return true;
+    return false;
+}
+
 MRFDataset::~MRFDataset()
 {  // Make sure everything gets written
     if (0 != write_timer.count())
@@ -2532,6 +2641,10 @@ CPLErr MRFDataset::GetGeoTransform(double *gt)
 CPLErr MRFDataset::ReadTileIdx(ILIdx &tinfo, const ILSize &pos,
                                const ILImage &img, const GIntBig bias)
 {
+    // Pages still being compressed are not in the index yet
+    if (!pendingTiles.empty())
+        WritePendingTiles();
+
     VSILFILE *l_ifp = IdxFP();
 
     // Initialize the tinfo structure, in case the files are missing
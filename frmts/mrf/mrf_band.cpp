@@ -57,6 +57,7 @@
 #include "ogr_srs_api.h"
 #include "ogr_spatialref.h"
 
+#include <memory>
 #include <vector>
 #include <cassert>
 #include <zlib.h>
@@ -1219,6 +1220,64 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
     return ReadInterleavedBlock(xblk, yblk, buffer);
 }
 
+/**
+ *\brief Compress a page in a worker thread
+ *
+ * The job buffer holds the raw page, followed by space for the compressed one.
+ * Mirrors the synchronous path of IWriteBlock, but uses its own zstd context
+ *
+ */
+
+void MRFRasterBand::CompressJob(void *p)
+{
+    MRFCompressJob *job = static_cast<MRFCompressJob *>(p);
+    MRFRasterBand *band = job->band;
+    auto start_time = steady_clock::now();
+
+    buf_mgr src = {job->buffer, job->pagesize};
+    char *outbuff = job->buffer + job->pagesize;
+    buf_mgr dst = {outbuff, job->buffersize - job->pagesize};
+    job->ret = band->Compress(dst, src);
+
+    // Where the output is, in case we deflate
+    void *usebuff = outbuff;
+    if (job->ret == CE_None && band->dodeflate)
+    {
+        // Move the packed part at the start of the buffer, to make more space
+        // available
+        memmove(job->buffer, outbuff, dst.size);
+        dst.buffer = job->buffer;
+        usebuff = DeflateBlock(dst, job->buffersize - dst.size,
+                               band->deflate_flags);
+    }
+
+#if defined(ZSTD_SUPPORT)
+    else if (job->ret == CE_None && band->dozstd)
+    {
+        memmove(job->buffer, outbuff, dst.size);
+        dst.buffer = job->buffer;
+        const ILImage &img = band->img;
+        size_t ranks = 0;  // Assume no need for byte rank sort
+        if (img.comp == IL_NONE || img.comp == IL_ZSTD)
+            ranks = static_cast<size_t>(GDALGetDataTypeSizeBytes(img.dt)) *
+                    img.pagesize.c;
+        // The dataset context can't be shared between threads
+        ZSTD_CCtx *cctx = ZSTD_createCCtx();
+        usebuff = ZstdCompBlock(dst, job->buffersize - dst.size,
+                                band->zstd_level, cctx, ranks);
+        ZSTD_freeCCtx(cctx);
+    }
+#endif
+
+    if (!usebuff)
+        job->ret = CE_Failure;
+    job->result.buffer = static_cast<char *>(usebuff);
+    job->result.size = dst.size;
+    job->duration =
+        duration_cast<nanoseconds>(steady_clock::now() - start_time);
+    job->done = true;
+}
+
 /**
  *\brief Write a block from the provided buffer
  *
@@ -1245,6 +1304,13 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
         return CE_Failure;
     }
 
+    // An older version of this page might still be waiting to be written
+    if (poMRFDS->IsTilePending(infooffset))
+        poMRFDS->WritePendingTiles();
+
+    // Compress in a worker thread, the page gets written later
+    const bool async = CanCompressInParallel() && poMRFDS->GetCompressQueue();
+
     if (1 == cstride)
     {  // Separate bands, we can write it as is
         // Empty page skip
@@ -1255,6 +1321,27 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
         if (isAllVal(eDataType, buffer, img.pageSizeBytes, val))
             return poMRFDS->WriteTile(nullptr, infooffset, 0);
 
+        if (async)
+        {
+            auto job = std::make_unique<MRFCompressJob>();
+            job->band = this;
+            job->infooffset = infooffset;
+            job->pagesize = static_cast<size_t>(img.pageSizeBytes);
+            job->buffersize = job->pagesize + poMRFDS->pbsize;
+            job->buffer =
+                static_cast<char *>(VSI_MALLOC_VERBOSE(job->buffersize));
+            if (!job->buffer)
+                return CE_Failure;
+            memcpy(job->buffer, buffer, job->pagesize);
+
+            // Swab the copy, the block stays as it is
+            buf_mgr src = {job->buffer, job->pagesize};
+            if (is_Endianness_Dependent(img.dt, img.comp) &&
+                (img.nbo != NET_ORDER))
+                swab_buff(src, img);
+            return poMRFDS->QueueTile(std::move(job));
+        }
+
         // Use the pbuffer to hold the compressed page before writing it
         poMRFDS->tile = ILSize();  // Mark it corrupt
 
@@ -1421,6 +1508,18 @@ CPLErr MRFRasterBand::IWriteBlock(int xblk, int yblk, void *buffer)
                  " instead of " CPL_FRMT_GIB,
                  poMRFDS->bdirty, AllBandMask());
 
+    if (async)
+    {  // The job takes ownership of tbuffer
+        auto job = std::make_unique<MRFCompressJob>();
+        job->band = this;
+        job->infooffset = infooffset;
+        job->buffer = static_cast<char *>(tbuffer);
+        job->pagesize = static_cast<size_t>(img.pageSizeBytes);
+        job->buffersize = job->pagesize + poMRFDS->pbsize;
+        poMRFDS->bdirty = 0;
+        return poMRFDS->QueueTile(std::move(job));
+    }
+
     buf_mgr src;
     src.buffer = (char *)tbuffer;
     src.size = static_cast<size_t>(img.pageSizeBytes);
@@ -139,6 +139,28 @@ static CPLErr NCDFGetCoordAndBoundVarFullNames(int nCdfId, char ***ppapszVars);
 
 CPLMutex *hNCMutex = nullptr;
 
+namespace
+{
+// Temporarily releases hNCMutex, which must be held by the calling thread,
+// while it does work that does not involve the netCDF library, so that
+// other threads can use it in the meantime.
+class NCMutexReleaser
+{
+  public:
+    NCMutexReleaser()
+    {
+        CPLReleaseMutex(hNCMutex);
+    }
+
+    ~NCMutexReleaser()
+    {
+        CPLAcquireMutex(hNCMutex, 1000.0);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(NCMutexReleaser)
+};
+}  // namespace
+
 // Workaround https://github.com/OSGeo/gdal/issues/6253
 // Having 2 netCDF handles on the same file doesn't work in a multi-threaded
 // way. Apparently having the same handle works better (this is OK since
@@ -226,6 +248,9 @@ class netCDFRasterBand final : public GDALPamRasterBand
     bool bSignedData;
     bool bCheckLongitude;
     bool m_bCreateMetadataFromOtherVarsDone = false;
+    //! Number of bands (levels of the non-spatial dimension of a 3D variable)
+    // in a netCDF-4 chunk, when they are read at once.
+    int m_nBandChunkSize = 1;
 
     void CreateMetadataFromAttributes();
     void CreateMetadataFromOtherVars();
@@ -238,7 +263,12 @@ class netCDFRasterBand final : public GDALPamRasterBand
                       size_t nTmpBlockYSize, bool bCheckIsNan = false);
     void SetBlockSize();
 
-    bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage);
+    bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage,
+                          int nBandCount = 1);
+    CPLErr FetchNetcdfChunkOfBands(int nBlockXOff, int nBlockYOff,
+                                   size_t xstart, size_t ystart, void *pImage);
+    bool FetchBottomUpChunk(int nBlockXOff, size_t xstart, size_t nChunkBlock,
+                            std::shared_ptr<std::vector<GByte>> &poChunk);
 
     void SetNoDataValueNoUpdate(double dfNoData);
     void SetNoDataValueNoUpdate(int64_t nNoData);
@@ -856,11 +886,30 @@ void netCDFRasterBand::SetBlockSize()
         status = nc_inq_var_chunking(cdfid, nZId, &nTmpFormat, chunksize);
         if ((status == NC_NOERR) && (nTmpFormat == NC_CHUNKED))
         {
-            nBlockXSize = (int)chunksize[nZDim - 1];
-            if (nZDim >= 2)
-                nBlockYSize = (int)chunksize[nZDim - 2];
+            nBlockXSize = (int)chunksize[nBandXPos];
+            if (nBandYPos >= 0)
+                nBlockYSize = (int)chunksize[nBandYPos];
             else
                 nBlockYSize = 1;
+
+            // For 3D variables chunked along their non-spatial dimension
+            // (typically time), read all the bands of a chunk at once.
+            if (nZDim == 3 && poDS->GetAccess() == GA_ReadOnly &&
+                chunksize[panBandZPos[0]] > 1 &&
+                CPLTestBool(CPLGetConfigOption(
+                    "GDAL_NETCDF_READ_BAND_CHUNK_AT_ONCE", "YES")))
+            {
+                constexpr size_t MAX_CHUNK_SIZE = 100 * 1024 * 1024;
+                const size_t nBlockSize =
+                    static_cast<size_t>(GDALGetDataTypeSizeBytes(eDataType)) *
+                    nBlockXSize * nBlockYSize;
+                if (nBlockSize > 0 &&
+                    chunksize[panBandZPos[0]] <= MAX_CHUNK_SIZE / nBlockSize)
+                {
+                    m_nBandChunkSize =
+                        static_cast<int>(chunksize[panBandZPos[0]]);
+                }
+            }
         }
     }
 
@@ -876,6 +925,8 @@ void netCDFRasterBand::SetBlockSize()
                 static_cast<size_t>(DIV_ROUND_UP(nRasterXSize, nBlockXSize));
             if ((nRasterYSize % nBlockYSize) != 0)
                 nChunks *= 2;
+            // Room for the chunks of the other bands fetched at once
+            nChunks *= m_nBandChunkSize;
             const size_t nChunkSize =
                 static_cast<size_t>(GDALGetDataTypeSizeBytes(eDataType)) *
                 nBlockXSize * nBlockYSize;
@@ -2155,6 +2206,10 @@ void netCDFRasterBand::CheckData(void *pImage, void *pImageNC,
 {
     CPLAssert(pImage != nullptr && pImageNC != nullptr);
 
+    // Called by FetchNetcdfChunk() with hNCMutex held, once the data has been
+    // read: the rest is pure computation on the block.
+    NCMutexReleaser oReleaser;
+
     // If this block is not a full block (in the x axis), we need to re-arrange
     // the data this is because partial blocks are not arranged the same way in
     // netcdf and gdal.
@@ -2239,6 +2294,10 @@ void netCDFRasterBand::CheckDataCpx(void *pImage, void *pImageNC,
 {
     CPLAssert(pImage != nullptr && pImageNC != nullptr);
 
+    // Called by FetchNetcdfChunk() with hNCMutex held, once the data has been
+    // read: the rest is pure computation on the block.
+    NCMutexReleaser oReleaser;
+
     // If this block is not a full block (in the x axis), we need to re-arrange
     // the data this is because partial blocks are not arranged the same way in
     // netcdf and gdal.
@@ -2292,8 +2351,11 @@ void netCDFRasterBand::CheckDataCpx(void *pImage, void *pImageNC,
 /*                         FetchNetcdfChunk()                           */
 /************************************************************************/
 
+// When nBandCount > 1, 3D variables only, reads the block of nBandCount bands
+// starting at this one. They are returned one after the other in pImage, with
+// the partial rows of the last row of blocks packed.
 bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
-                                        void *pImage)
+                                        void *pImage, int nBandCount)
 {
     size_t start[MAX_NC_DIMS] = {};
     size_t edge[MAX_NC_DIMS] = {};
@@ -2310,6 +2372,11 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
             edge[nBandYPos] = nRasterYSize - start[nBandYPos];
     }
     const size_t nYChunkSize = nBandYPos < 0 ? 1 : edge[nBandYPos];
+    // Number of rows of all the bands
+    const size_t nRows = nYChunkSize * nBandCount;
+    if (nBandCount > 1)
+        CPLDebug("GDAL_netCDF", "Reading chunk of bands %d to %d at once",
+                 nLevel + 1, nLevel + nBandCount);
 
 #ifdef NCDF_DEBUG
     CPLDebug("GDAL_netCDF", "start={%ld,%ld} edge={%ld,%ld} bBottomUp=%d",
@@ -2322,7 +2389,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     if (nd == 3)
     {
         start[panBandZPos[0]] = nLevel;  // z
-        edge[panBandZPos[0]] = 1;
+        edge[panBandZPos[0]] = nBandCount;
     }
 
     // Compute multidimention band position.
@@ -2369,8 +2436,9 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     if (edge[nBandXPos] != static_cast<size_t>(nBlockXSize))
     {
         pImageNC = static_cast<GByte *>(pImage) +
-                   ((static_cast<size_t>(nBlockXSize) * nBlockYSize -
-                     edge[nBandXPos] * nYChunkSize) *
+                   ((static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                         nBandCount -
+                     edge[nBandXPos] * nRows) *
                     (GDALGetDataTypeSize(eDataType) / 8));
     }
 
@@ -2383,8 +2451,8 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
             status = nc_get_vara_schar(cdfid, nZId, start, edge,
                                        static_cast<signed char *>(pImageNC));
             if (status == NC_NOERR)
-                CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
-                                       nYChunkSize, false);
+                CheckData<signed char>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                       false);
         }
         else
         {
@@ -2392,7 +2460,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
                                        static_cast<unsigned char *>(pImageNC));
             if (status == NC_NOERR)
                 CheckData<unsigned char>(pImage, pImageNC, edge[nBandXPos],
-                                         nYChunkSize, false);
+                                         nRows, false);
         }
     }
     else if (eDataType == GDT_Int8)
@@ -2400,8 +2468,8 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
         status = nc_get_vara_schar(cdfid, nZId, start, edge,
                                    static_cast<signed char *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
-                                   nYChunkSize, false);
+            CheckData<signed char>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                   false);
     }
     else if (nc_datatype == NC_SHORT)
     {
@@ -2411,13 +2479,13 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
         {
             if (eDataType == GDT_Int16)
             {
-                CheckData<GInt16>(pImage, pImageNC, edge[nBandXPos],
-                                  nYChunkSize, false);
+                CheckData<GInt16>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                  false);
             }
             else
             {
-                CheckData<GUInt16>(pImage, pImageNC, edge[nBandXPos],
-                                   nYChunkSize, false);
+                CheckData<GUInt16>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                   false);
             }
         }
     }
@@ -2427,14 +2495,12 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
         status = nc_get_vara_long(cdfid, nZId, start, edge,
                                   static_cast<long *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<long>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                            false);
+            CheckData<long>(pImage, pImageNC, edge[nBandXPos], nRows, false);
 #else
         status = nc_get_vara_int(cdfid, nZId, start, edge,
                                  static_cast<int *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                           false);
+            CheckData<int>(pImage, pImageNC, edge[nBandXPos], nRows, false);
 #endif
     }
     else if (eDataType == GDT_Float32)
@@ -2442,40 +2508,38 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
         status = nc_get_vara_float(cdfid, nZId, start, edge,
                                    static_cast<float *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                             true);
+            CheckData<float>(pImage, pImageNC, edge[nBandXPos], nRows, true);
     }
     else if (eDataType == GDT_Float64)
     {
         status = nc_get_vara_double(cdfid, nZId, start, edge,
                                     static_cast<double *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                              true);
+            CheckData<double>(pImage, pImageNC, edge[nBandXPos], nRows, true);
     }
     else if (eDataType == GDT_UInt16)
     {
         status = nc_get_vara_ushort(cdfid, nZId, start, edge,
                                     static_cast<unsigned short *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<unsigned short>(pImage, pImageNC, edge[nBandXPos],
-                                      nYChunkSize, false);
+            CheckData<unsigned short>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                      false);
     }
     else if (eDataType == GDT_UInt32)
     {
         status = nc_get_vara_uint(cdfid, nZId, start, edge,
                                   static_cast<unsigned int *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<unsigned int>(pImage, pImageNC, edge[nBandXPos],
-                                    nYChunkSize, false);
+            CheckData<unsigned int>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                    false);
     }
     else if (eDataType == GDT_Int64)
     {
         status = nc_get_vara_longlong(cdfid, nZId, start, edge,
                                       static_cast<long long *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<std::int64_t>(pImage, pImageNC, edge[nBandXPos],
-                                    nYChunkSize, false);
+            CheckData<std::int64_t>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                    false);
     }
     else if (eDataType == GDT_UInt64)
     {
@@ -2483,35 +2547,34 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
             nc_get_vara_ulonglong(cdfid, nZId, start, edge,
                                   static_cast<unsigned long long *>(pImageNC));
         if (status == NC_NOERR)
-            CheckData<std::uint64_t>(pImage, pImageNC, edge[nBandXPos],
-                                     nYChunkSize, false);
+            CheckData<std::uint64_t>(pImage, pImageNC, edge[nBandXPos], nRows,
+                                     false);
     }
     else if (eDataType == GDT_CInt16)
     {
         status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
-            CheckDataCpx<short>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
+            CheckDataCpx<short>(pImage, pImageNC, edge[nBandXPos], nRows,
                                 false);
     }
     else if (eDataType == GDT_CInt32)
     {
         status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
-            CheckDataCpx<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                              false);
+            CheckDataCpx<int>(pImage, pImageNC, edge[nBandXPos], nRows, false);
     }
     else if (eDataType == GDT_CFloat32)
     {
         status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
-            CheckDataCpx<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
+            CheckDataCpx<float>(pImage, pImageNC, edge[nBandXPos], nRows,
                                 false);
     }
     else if (eDataType == GDT_CFloat64)
     {
         status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
-            CheckDataCpx<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
+            CheckDataCpx<double>(pImage, pImageNC, edge[nBandXPos], nRows,
                                  false);
     }
 
@@ -2583,25 +2646,17 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 const size_t nChunkLineSize =
                     static_cast<size_t>(GDALGetDataTypeSizeBytes(eDataType)) *
                     nBlockXSize;
-                const size_t nChunkSize = nChunkLineSize * nBlockYSize;
-                if (!firstChunk)
+                if (!firstChunk && !FetchBottomUpChunk(nBlockXOff, xstart,
+                                                       nFirstChunkBlock,
+                                                       firstChunk))
                 {
-                    firstChunk.reset(new std::vector<GByte>(nChunkSize));
-                    if (!FetchNetcdfChunk(xstart,
-                                          nFirstChunkBlock * nBlockYSize,
-                                          firstChunk.get()->data()))
-                        return CE_Failure;
-                    if (poGDS->poChunkCache)
-                        poGDS->poChunkCache->insert(firstKey, firstChunk);
+                    return CE_Failure;
                 }
-                if (!secondChunk && firstKey != secondKey)
+                if (!secondChunk && firstKey != secondKey &&
+                    !FetchBottomUpChunk(nBlockXOff, xstart, nLastChunkBlock,
+                                        secondChunk))
                 {
-                    secondChunk.reset(new std::vector<GByte>(nChunkSize));
-                    if (!FetchNetcdfChunk(xstart, nLastChunkBlock * nBlockYSize,
-                                          secondChunk.get()->data()))
-                        return CE_Failure;
-                    if (poGDS->poChunkCache)
-                        poGDS->poChunkCache->insert(secondKey, secondChunk);
+                    return CE_Failure;
                 }
 
                 // Assemble netCDF chunks into GDAL block
@@ -2642,9 +2697,151 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
+    if (m_nBandChunkSize > 1)
+        return FetchNetcdfChunkOfBands(nBlockXOff, nBlockYOff, xstart, ystart,
+                                       pImage);
+
     return FetchNetcdfChunk(xstart, ystart, pImage) ? CE_None : CE_Failure;
 }
 
+/************************************************************************/
+/*                         FetchBottomUpChunk()                         */
+/************************************************************************/
+
+// Fetches the netCDF chunk of index nChunkBlock along Y (in netCDF space) for
+// the bottom-up code path of IReadBlock(), and inserts it in the chunk cache.
+// When the variable is chunked along its non-spatial dimension, the chunks of
+// all the bands sharing the netCDF-4 chunk are fetched and cached at once.
+bool netCDFRasterBand::FetchBottomUpChunk(
+    int nBlockXOff, size_t xstart, size_t nChunkBlock,
+    std::shared_ptr<std::vector<GByte>> &poChunk)
+{
+    auto poGDS = static_cast<netCDFDataset *>(poDS);
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nChunkSize = nDTSize * nBlockXSize * nBlockYSize;
+    const size_t ystart = nChunkBlock * nBlockYSize;
+
+    const int nFirstLevel = (nLevel / m_nBandChunkSize) * m_nBandChunkSize;
+    const int nBandsInChunk =
+        std::min(m_nBandChunkSize, poDS->GetRasterCount() - nFirstLevel);
+    auto poFirstBand = static_cast<netCDFRasterBand *>(
+        poDS->GetRasterBand(nFirstLevel + 1));
+    if (poGDS->poChunkCache && nBandsInChunk > 1 && poFirstBand)
+    {
+        std::vector<GByte> abyBuffer;
+        try
+        {
+            abyBuffer.resize(nChunkSize * nBandsInChunk);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for chunk");
+            return false;
+        }
+        if (!poFirstBand->FetchNetcdfChunk(xstart, ystart, abyBuffer.data(),
+                                           nBandsInChunk))
+            return false;
+
+        const size_t nYChunkSize =
+            std::min(static_cast<size_t>(nBlockYSize),
+                     static_cast<size_t>(nRasterYSize) - ystart);
+        const size_t nBandBytes = nDTSize * nBlockXSize * nYChunkSize;
+        for (int i = 0; i < nBandsInChunk; ++i)
+        {
+            const int iBand = nFirstLevel + i + 1;
+            auto poBandChunk = std::make_shared<std::vector<GByte>>(nChunkSize);
+            memcpy(poBandChunk->data(), abyBuffer.data() + i * nBandBytes,
+                   nBandBytes);
+            if (iBand == nBand)
+                poChunk = poBandChunk;
+            poGDS->poChunkCache->insert(
+                netCDFDataset::ChunkKey(nBlockXOff, nChunkBlock, iBand),
+                poBandChunk);
+        }
+        return true;
+    }
+
+    poChunk = std::make_shared<std::vector<GByte>>(nChunkSize);
+    if (!FetchNetcdfChunk(xstart, ystart, poChunk->data()))
+        return false;
+    if (poGDS->poChunkCache)
+        poGDS->poChunkCache->insert(
+            netCDFDataset::ChunkKey(nBlockXOff, nChunkBlock, nBand), poChunk);
+    return true;
+}
+
+/************************************************************************/
+/*                      FetchNetcdfChunkOfBands()                       */
+/************************************************************************/
+
+// Reads with a single nc_get_vara() call the block of all the bands sharing
+// the netCDF-4 chunk of this band along the non-spatial dimension, and stores
+// the blocks of the other bands in the block cache, instead of having
+// libnetcdf decompress the chunk again for each band.
+CPLErr netCDFRasterBand::FetchNetcdfChunkOfBands(int nBlockXOff,
+                                                 int nBlockYOff, size_t xstart,
+                                                 size_t ystart, void *pImage)
+{
+    const int nFirstLevel = (nLevel / m_nBandChunkSize) * m_nBandChunkSize;
+    const int nBandsInChunk =
+        std::min(m_nBandChunkSize, poDS->GetRasterCount() - nFirstLevel);
+    auto poFirstBand = static_cast<netCDFRasterBand *>(
+        poDS->GetRasterBand(nFirstLevel + 1));
+    if (nBandsInChunk <= 1 || poFirstBand == nullptr)
+        return FetchNetcdfChunk(xstart, ystart, pImage) ? CE_None : CE_Failure;
+
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(nDTSize * nBlockXSize * nBlockYSize * nBandsInChunk);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for chunk");
+        return CE_Failure;
+    }
+    if (!poFirstBand->FetchNetcdfChunk(xstart, ystart, abyBuffer.data(),
+                                       nBandsInChunk))
+        return CE_Failure;
+
+    // Block cache operations must not be done while holding hNCMutex
+    NCMutexReleaser oReleaser;
+
+    const size_t nYChunkSize =
+        nBandYPos < 0 ? 1
+                      : std::min(static_cast<size_t>(nBlockYSize),
+                                 static_cast<size_t>(nRasterYSize) - ystart);
+    const size_t nBandBytes = nDTSize * nBlockXSize * nYChunkSize;
+    for (int i = 0; i < nBandsInChunk; ++i)
+    {
+        const GByte *pabySrc = abyBuffer.data() + i * nBandBytes;
+        const int iBand = nFirstLevel + i + 1;
+        if (iBand == nBand)
+        {
+            memcpy(pImage, pabySrc, nBandBytes);
+            continue;
+        }
+        GDALRasterBand *poOtherBand = poDS->GetRasterBand(iBand);
+        GDALRasterBlock *poBlock =
+            poOtherBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+        if (poBlock)
+        {
+            poBlock->DropLock();
+            continue;
+        }
+        poBlock = poOtherBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+        if (poBlock)
+        {
+            memcpy(poBlock->GetDataRef(), pabySrc, nBandBytes);
+            poBlock->DropLock();
+        }
+    }
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IWriteBlock()                            */
 /************************************************************************/
@@ -58,6 +58,7 @@
 #include "gdal.h"
 #include "gdal_frmts.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
@@ -824,6 +825,19 @@ NITFDataset *NITFDataset::OpenInternal(GDALOpenInfo *poOpenInfo,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      For JPEG images with a data mask subheader, the block offsets   */
+    /*      can be computed right now from the mask table.                  */
+    /* -------------------------------------------------------------------- */
+    if (bOpenUnderlyingDS && psImage != nullptr &&
+        EQUAL(psImage->szIC, "M3") && poDS->poJPEGDataset == nullptr &&
+        poDS->GetRasterCount() > 0)
+    {
+        // Errors will be reported when reading blocks
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        poDS->InitJPEGBlockOffsets();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Report problems with odd bit sizes.                             */
     /* -------------------------------------------------------------------- */
@@ -2069,18 +2083,18 @@ CPLErr NITFDataset::AdviseRead(int nXOff, int nYOff, int nXSize, int nYSize,
                                char **papszOptions)
 
 {
-    if (poJ2KDataset == nullptr)
-        return GDALDataset::AdviseRead(nXOff, nYOff, nXSize, nYSize, nBufXSize,
-                                       nBufYSize, eDT, nBandCount, panBandList,
-                                       papszOptions);
+    if (poJ2KDataset != nullptr)
+        return poJ2KDataset->AdviseRead(nXOff, nYOff, nXSize, nYSize, nBufXSize,
+                                        nBufYSize, eDT, nBandCount, panBandList,
+                                        papszOptions);
     else if (poJPEGDataset != nullptr)
         return poJPEGDataset->AdviseRead(nXOff, nYOff, nXSize, nYSize,
                                          nBufXSize, nBufYSize, eDT, nBandCount,
                                          panBandList, papszOptions);
     else
-        return poJ2KDataset->AdviseRead(nXOff, nYOff, nXSize, nYSize, nBufXSize,
-                                        nBufYSize, eDT, nBandCount, panBandList,
-                                        papszOptions);
+        return GDALDataset::AdviseRead(nXOff, nYOff, nXSize, nYSize, nBufXSize,
+                                       nBufYSize, eDT, nBandCount, panBandList,
+                                       papszOptions);
 }
 
 /************************************************************************/
@@ -2106,11 +2120,18 @@ CPLErr NITFDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                        pData, nBufXSize, nBufYSize, eBufType,
                                        nBandCount, panBandMap, nPixelSpace,
                                        nLineSpace, nBandSpace, psExtraArg);
-    else
-        return GDALDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
-                                      pData, nBufXSize, nBufYSize, eBufType,
-                                      nBandCount, panBandMap, nPixelSpace,
-                                      nLineSpace, nBandSpace, psExtraArg);
+
+    if (eRWFlag == GF_Read && psImage != nullptr &&
+        (EQUAL(psImage->szIC, "C3") || EQUAL(psImage->szIC, "M3")))
+    {
+        PrefetchJPEGBlocks(nXOff, nYOff, nXSize, nYSize, nBandCount,
+                           panBandMap);
+    }
+
+    return GDALDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
+                                  nBufXSize, nBufYSize, eBufType, nBandCount,
+                                  panBandMap, nPixelSpace, nLineSpace,
+                                  nBandSpace, psExtraArg);
 }
 
 /************************************************************************/
@@ -3680,70 +3701,140 @@ CPLErr NITFDataset::ScanJPEGBlocks()
 }
 
 /************************************************************************/
-/*                           ReadJPEGBlock()                            */
+/*                        InitJPEGBlockOffsets()                        */
 /************************************************************************/
 
-CPLErr NITFDataset::ReadJPEGBlock(int iBlockX, int iBlockY)
+CPLErr NITFDataset::InitJPEGBlockOffsets()
 
 {
-    CPLErr eErr;
+    if (panJPEGBlockOffset != nullptr)
+        return CE_None;
+
+    if (!EQUAL(psImage->szIC, "M3"))
+    {
+        /* ---------------------------------------------------------------- */
+        /*      Scan through the whole image data stream identifying all    */
+        /*      block boundaries.                                           */
+        /* ---------------------------------------------------------------- */
+        const CPLErr eErr = ScanJPEGBlocks();
+        if (eErr != CE_None)
+        {
+            CPLFree(panJPEGBlockOffset);
+            panJPEGBlockOffset = nullptr;
+        }
+        return eErr;
+    }
 
     /* -------------------------------------------------------------------- */
-    /*      If this is our first request, do a scan for block boundaries.   */
+    /*      When a data mask subheader is present, we don't need to scan    */
+    /*      the whole file. We just use the psImage->panBlockStart table.   */
     /* -------------------------------------------------------------------- */
+    const int nBlockCount = psImage->nBlocksPerRow * psImage->nBlocksPerColumn;
+    panJPEGBlockOffset = reinterpret_cast<GIntBig *>(
+        VSI_CALLOC_VERBOSE(sizeof(GIntBig), static_cast<size_t>(nBlockCount)));
     if (panJPEGBlockOffset == nullptr)
     {
-        if (EQUAL(psImage->szIC, "M3"))
-        {
-            /* --------------------------------------------------------------------
-             */
-            /*      When a data mask subheader is present, we don't need to scan
-             */
-            /*      the whole file. We just use the psImage->panBlockStart table
-             */
-            /* --------------------------------------------------------------------
-             */
-            panJPEGBlockOffset = reinterpret_cast<GIntBig *>(VSI_CALLOC_VERBOSE(
-                sizeof(GIntBig), static_cast<size_t>(psImage->nBlocksPerRow) *
-                                     psImage->nBlocksPerColumn));
-            if (panJPEGBlockOffset == nullptr)
+        return CE_Failure;
+    }
+    bool bQLevelFound = false;
+    for (int i = 0; i < nBlockCount; i++)
+    {
+        panJPEGBlockOffset[i] = psImage->panBlockStart[i];
+        if (!bQLevelFound && panJPEGBlockOffset[i] != -1 &&
+            panJPEGBlockOffset[i] != UINT_MAX)
+        {
+            // All the blocks of an image share the same Q level, so only
+            // the first one is probed, which matters for remote files.
+            // A block not starting at its expected offset will fail to be
+            // opened as JPEG when being read.
+            GUIntBig nOffset = panJPEGBlockOffset[i];
+            bool bError = false;
+            nQLevel = ScanJPEGQLevel(&nOffset, &bError);
+            /* The beginning of the JPEG stream should be the offset */
+            /* from the panBlockStart table */
+            if (bError || nOffset != (GUIntBig)panJPEGBlockOffset[i])
             {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "JPEG block doesn't start at expected offset");
+                CPLFree(panJPEGBlockOffset);
+                panJPEGBlockOffset = nullptr;
                 return CE_Failure;
             }
-            for (int i = 0;
-                 i < psImage->nBlocksPerRow * psImage->nBlocksPerColumn; i++)
-            {
-                panJPEGBlockOffset[i] = psImage->panBlockStart[i];
-                if (panJPEGBlockOffset[i] != -1 &&
-                    panJPEGBlockOffset[i] != UINT_MAX)
-                {
-                    GUIntBig nOffset = panJPEGBlockOffset[i];
-                    bool bError = false;
-                    nQLevel = ScanJPEGQLevel(&nOffset, &bError);
-                    /* The beginning of the JPEG stream should be the offset */
-                    /* from the panBlockStart table */
-                    if (bError || nOffset != (GUIntBig)panJPEGBlockOffset[i])
-                    {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "JPEG block doesn't start at expected offset");
-                        return CE_Failure;
-                    }
-                }
-            }
-        }
-        else /* 'C3' case */
-        {
-            /* --------------------------------------------------------------------
-             */
-            /*      Scan through the whole image data stream identifying all */
-            /*      block boundaries. */
-            /* --------------------------------------------------------------------
-             */
-            eErr = ScanJPEGBlocks();
-            if (eErr != CE_None)
-                return eErr;
+            bQLevelFound = true;
         }
     }
+    return CE_None;
+}
+
+/************************************************************************/
+/*                          DecodeJPEGBlock()                           */
+/*                                                                      */
+/*      Decode the JPEG stream of a block, found in pszFilename at      */
+/*      nOffset, into pabyDst (band sequential). May be called from     */
+/*      several threads at once.                                        */
+/************************************************************************/
+
+CPLErr NITFDataset::DecodeJPEGBlock(int iBlock, const char *pszFilename,
+                                    GIntBig nOffset, GIntBig nSize,
+                                    GDALDataType eDT, GByte *pabyDst) const
+
+{
+    CPLString osFilename;
+    osFilename.Printf("JPEG_SUBFILE:Q%d," CPL_FRMT_GIB "," CPL_FRMT_GIB ",%s",
+                      nQLevel, nOffset, nSize, pszFilename);
+
+    auto poDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::FromHandle(GDALOpen(osFilename, GA_ReadOnly)));
+    if (poDS == nullptr)
+        return CE_Failure;
+
+    if (poDS->GetRasterXSize() != psImage->nBlockWidth ||
+        poDS->GetRasterYSize() != psImage->nBlockHeight)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "JPEG block %d not same size as NITF blocksize.", iBlock);
+        return CE_Failure;
+    }
+
+    if (poDS->GetRasterCount() < psImage->nBands)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "JPEG block %d has not enough bands.", iBlock);
+        return CE_Failure;
+    }
+
+    if (poDS->GetRasterBand(1)->GetRasterDataType() != eDT)
+    {
+        CPLError(
+            CE_Failure, CPLE_AppDefined,
+            "JPEG block %d data type (%s) not consistent with band data type "
+            "(%s).",
+            iBlock,
+            GDALGetDataTypeName(poDS->GetRasterBand(1)->GetRasterDataType()),
+            GDALGetDataTypeName(eDT));
+        return CE_Failure;
+    }
+
+    int anBands[3] = {1, 2, 3};
+    return poDS->RasterIO(GF_Read, 0, 0, psImage->nBlockWidth,
+                          psImage->nBlockHeight, pabyDst, psImage->nBlockWidth,
+                          psImage->nBlockHeight, eDT, psImage->nBands, anBands,
+                          0, 0, 0, nullptr);
+}
+
+/************************************************************************/
+/*                           ReadJPEGBlock()                            */
+/************************************************************************/
+
+CPLErr NITFDataset::ReadJPEGBlock(int iBlockX, int iBlockY)
+
+{
+    /* -------------------------------------------------------------------- */
+    /*      If this is our first request, do a scan for block boundaries.   */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = InitJPEGBlockOffsets();
+    if (eErr != CE_None)
+        return eErr;
 
     /* -------------------------------------------------------------------- */
     /*    Allocate image data block (where the uncompressed image will go)  */
@@ -3774,56 +3865,264 @@ CPLErr NITFDataset::ReadJPEGBlock(int iBlockX, int iBlockY)
         return CE_None;
     }
 
-    CPLString osFilename;
-    osFilename.Printf("JPEG_SUBFILE:Q%d," CPL_FRMT_GIB ",%d,%s", nQLevel,
-                      panJPEGBlockOffset[iBlock], 0, osNITFFilename.c_str());
+    return DecodeJPEGBlock(iBlock, osNITFFilename.c_str(),
+                           panJPEGBlockOffset[iBlock], 0,
+                           GetRasterBand(1)->GetRasterDataType(),
+                           pabyJPEGBlock);
+}
 
-    GDALDataset *poDS =
-        GDALDataset::FromHandle(GDALOpen(osFilename, GA_ReadOnly));
-    if (poDS == nullptr)
-        return CE_Failure;
+/************************************************************************/
+/*                         PrefetchJPEGBlocks()                         */
+/*                                                                      */
+/*      For a request intersecting several JPEG blocks that are not     */
+/*      cached yet, read their compressed data at once (with a single   */
+/*      multi-range request for remote files), and decode them in       */
+/*      parallel when GDAL_NUM_THREADS is set, into the block cache.    */
+/************************************************************************/
 
-    if (poDS->GetRasterXSize() != psImage->nBlockWidth ||
-        poDS->GetRasterYSize() != psImage->nBlockHeight)
+void NITFDataset::PrefetchJPEGBlocks(int nXOff, int nYOff, int nXSize,
+                                     int nYSize, int nBandCount,
+                                     const int *panBandMap)
+
+{
+    int nThreads = 1;
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "JPEG block %d not same size as NITF blocksize.", iBlock);
-        delete poDS;
-        return CE_Failure;
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::min(nThreads, 1024);
     }
+    const bool bRemote = !VSIIsLocal(osNITFFilename.c_str());
+    if (nThreads <= 1 && !bRemote)
+        return;
 
-    if (poDS->GetRasterCount() < psImage->nBands)
+    if (InitJPEGBlockOffsets() != CE_None)
+        return;
+
+    /* -------------------------------------------------------------------- */
+    /*      Collect the blocks that are not cached yet.                     */
+    /* -------------------------------------------------------------------- */
+    const int nBlockXStart = nXOff / psImage->nBlockWidth;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / psImage->nBlockWidth;
+    const int nBlockYStart = nYOff / psImage->nBlockHeight;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / psImage->nBlockHeight;
+
+    struct JPEGBlock
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "JPEG block %d has not enough bands.", iBlock);
-        delete poDS;
-        return CE_Failure;
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        int iBlock = 0;
+        vsi_l_offset nOffset = 0;
+        size_t nSize = 0;
+        std::vector<GByte> abyRaw{};
+        std::vector<GByte> abyDecoded{};
+        bool bOK = false;
+        const NITFDataset *poDS = nullptr;
+        GDALDataType eDT = GDT_Unknown;
+    };
+
+    std::vector<JPEGBlock> aoBlocks;
+    for (int nBlockYOff = nBlockYStart; nBlockYOff <= nBlockYEnd; ++nBlockYOff)
+    {
+        for (int nBlockXOff = nBlockXStart; nBlockXOff <= nBlockXEnd;
+             ++nBlockXOff)
+        {
+            const int iBlock = nBlockXOff + nBlockYOff * psImage->nBlocksPerRow;
+            if (panJPEGBlockOffset[iBlock] == -1 ||
+                panJPEGBlockOffset[iBlock] == UINT_MAX)
+                continue;
+            bool bCached = true;
+            for (int i = 0; bCached && i < nBandCount; ++i)
+            {
+                GDALRasterBlock *poBlock =
+                    GetRasterBand(panBandMap[i])
+                        ->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+                if (poBlock)
+                    poBlock->DropLock();
+                else
+                    bCached = false;
+            }
+            if (bCached)
+                continue;
+            JPEGBlock oBlock;
+            oBlock.nBlockXOff = nBlockXOff;
+            oBlock.nBlockYOff = nBlockYOff;
+            oBlock.iBlock = iBlock;
+            oBlock.nOffset =
+                static_cast<vsi_l_offset>(panJPEGBlockOffset[iBlock]);
+            oBlock.poDS = this;
+            oBlock.eDT = GetRasterBand(1)->GetRasterDataType();
+            aoBlocks.emplace_back(std::move(oBlock));
+        }
+    }
+    if (aoBlocks.size() < 2)
+        return;
+
+    // Do not prefetch more than what the block cache can hold
+    const size_t nDecodedBytes = static_cast<size_t>(psImage->nBands) *
+                                 psImage->nBlockWidth * psImage->nBlockHeight *
+                                 GDALGetDataTypeSizeBytes(aoBlocks[0].eDT);
+    if (static_cast<uint64_t>(aoBlocks.size()) * nDecodedBytes >
+        static_cast<uint64_t>(GDALGetCacheMax64() / 2))
+    {
+        return;
     }
 
-    if (poDS->GetRasterBand(1)->GetRasterDataType() !=
-        GetRasterBand(1)->GetRasterDataType())
+    /* -------------------------------------------------------------------- */
+    /*      The compressed data of a block extends up to the start of the   */
+    /*      next block in the file, or the end of the image segment.        */
+    /* -------------------------------------------------------------------- */
+    const NITFSegmentInfo *psSegInfo =
+        psFile->pasSegmentInfo + psImage->iSegment;
+    const vsi_l_offset nSegmentEnd =
+        psSegInfo->nSegmentStart + psSegInfo->nSegmentSize;
+    const int nBlockCount = psImage->nBlocksPerRow * psImage->nBlocksPerColumn;
+    std::vector<vsi_l_offset> anSortedOffsets;
+    for (int i = 0; i < nBlockCount; ++i)
     {
-        CPLError(
-            CE_Failure, CPLE_AppDefined,
-            "JPEG block %d data type (%s) not consistent with band data type "
-            "(%s).",
-            iBlock,
-            GDALGetDataTypeName(poDS->GetRasterBand(1)->GetRasterDataType()),
-            GDALGetDataTypeName(GetRasterBand(1)->GetRasterDataType()));
-        delete poDS;
-        return CE_Failure;
+        if (panJPEGBlockOffset[i] != -1 && panJPEGBlockOffset[i] != UINT_MAX)
+            anSortedOffsets.push_back(
+                static_cast<vsi_l_offset>(panJPEGBlockOffset[i]));
     }
+    anSortedOffsets.push_back(nSegmentEnd);
+    std::sort(anSortedOffsets.begin(), anSortedOffsets.end());
 
-    int anBands[3] = {1, 2, 3};
-    eErr = poDS->RasterIO(GF_Read, 0, 0, psImage->nBlockWidth,
-                          psImage->nBlockHeight, pabyJPEGBlock,
-                          psImage->nBlockWidth, psImage->nBlockHeight,
-                          GetRasterBand(1)->GetRasterDataType(),
-                          psImage->nBands, anBands, 0, 0, 0, nullptr);
+    // Sanity limit, to avoid huge allocations on corrupted files
+    constexpr vsi_l_offset MAX_JPEG_BLOCK_SIZE = 100 * 1024 * 1024;
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for (auto &oBlock : aoBlocks)
+    {
+        const auto oIter = std::upper_bound(
+            anSortedOffsets.begin(), anSortedOffsets.end(), oBlock.nOffset);
+        if (oIter == anSortedOffsets.end() ||
+            *oIter - oBlock.nOffset > MAX_JPEG_BLOCK_SIZE)
+            return;
+        oBlock.nSize = static_cast<size_t>(*oIter - oBlock.nOffset);
+        try
+        {
+            oBlock.abyRaw.resize(oBlock.nSize);
+        }
+        catch (const std::exception &)
+        {
+            return;
+        }
+        apData.push_back(oBlock.abyRaw.data());
+        anOffsets.push_back(oBlock.nOffset);
+        anSizes.push_back(oBlock.nSize);
+    }
 
-    delete poDS;
+    /* -------------------------------------------------------------------- */
+    /*      Read the compressed data.                                       */
+    /* -------------------------------------------------------------------- */
+    if (bRemote)
+    {
+        if (VSIFReadMultiRangeL(static_cast<int>(aoBlocks.size()),
+                                apData.data(), anOffsets.data(), anSizes.data(),
+                                psFile->fp) != 0)
+            return;
+    }
+    else
+    {
+        for (auto &oBlock : aoBlocks)
+        {
+            if (VSIFSeekL(psFile->fp, oBlock.nOffset, SEEK_SET) != 0 ||
+                VSIFReadL(oBlock.abyRaw.data(), 1, oBlock.nSize, psFile->fp) !=
+                    oBlock.nSize)
+                return;
+        }
+    }
 
-    return eErr;
+    /* -------------------------------------------------------------------- */
+    /*      Decode the blocks.                                              */
+    /* -------------------------------------------------------------------- */
+    const auto DecodeJob = [](void *pData)
+    {
+        JPEGBlock *psBlock = static_cast<JPEGBlock *>(pData);
+        const std::string osTmpFilename(
+            CPLSPrintf("/vsimem/nitf_jpeg_block_%p.jpg", psBlock));
+        VSILFILE *fpTmp = VSIFileFromMemBuffer(
+            osTmpFilename.c_str(), psBlock->abyRaw.data(),
+            static_cast<vsi_l_offset>(psBlock->nSize), FALSE);
+        if (fpTmp == nullptr)
+            return;
+        VSIFCloseL(fpTmp);
+        try
+        {
+            psBlock->abyDecoded.resize(
+                static_cast<size_t>(psBlock->poDS->psImage->nBands) *
+                psBlock->poDS->psImage->nBlockWidth *
+                psBlock->poDS->psImage->nBlockHeight *
+                GDALGetDataTypeSizeBytes(psBlock->eDT));
+            psBlock->bOK =
+                psBlock->poDS->DecodeJPEGBlock(
+                    psBlock->iBlock, osTmpFilename.c_str(), 0,
+                    static_cast<GIntBig>(psBlock->nSize), psBlock->eDT,
+                    psBlock->abyDecoded.data()) == CE_None;
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for JPEG block");
+        }
+        VSIUnlink(osTmpFilename.c_str());
+        psBlock->abyRaw.clear();
+    };
+
+    GDALThreadReservation oThreadReservation(
+        std::min(std::max(nThreads, 1), static_cast<int>(aoBlocks.size())));
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        CPLDebug("NITF", "Decoding %d JPEG blocks with up to %d threads",
+                 static_cast<int>(aoBlocks.size()),
+                 oThreadReservation.GetThreadCount());
+        for (auto &oBlock : aoBlocks)
+            poJobQueue->SubmitJob(DecodeJob, &oBlock);
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &oBlock : aoBlocks)
+            DecodeJob(&oBlock);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Fill the block cache of all bands.                              */
+    /* -------------------------------------------------------------------- */
+    const size_t nBlockBandBytes = nDecodedBytes / psImage->nBands;
+    for (const auto &oBlock : aoBlocks)
+    {
+        if (!oBlock.bOK)
+            continue;
+        for (int iBand = 1; iBand <= std::min(nBands, psImage->nBands);
+             ++iBand)
+        {
+            GDALRasterBand *poBand = GetRasterBand(iBand);
+            GDALRasterBlock *poBlock = poBand->TryGetLockedBlockRef(
+                oBlock.nBlockXOff, oBlock.nBlockYOff);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            poBlock = poBand->GetLockedBlockRef(oBlock.nBlockXOff,
+                                                oBlock.nBlockYOff, TRUE);
+            if (poBlock)
+            {
+                memcpy(poBlock->GetDataRef(),
+                       oBlock.abyDecoded.data() + (iBand - 1) * nBlockBandBytes,
+                       nBlockBandBytes);
+                poBlock->DropLock();
+            }
+        }
+    }
 }
 
 /************************************************************************/
@@ -109,7 +109,13 @@ class NITFDataset final : public GDALPamDataset
 
     int ScanJPEGQLevel(GUIntBig *pnDataStart, bool *pbError);
     CPLErr ScanJPEGBlocks();
+    CPLErr InitJPEGBlockOffsets();
+    CPLErr DecodeJPEGBlock(int iBlock, const char *pszFilename,
+                           GIntBig nOffset, GIntBig nSize, GDALDataType eDT,
+                           GByte *pabyDst) const;
     CPLErr ReadJPEGBlock(int, int);
+    void PrefetchJPEGBlocks(int nXOff, int nYOff, int nXSize, int nYSize,
+                            int nBandCount, const int *panBandMap);
     void CheckGeoSDEInfo();
     char **AddFile(char **papszFileList, const char *EXTENSION,
                    const char *extension);
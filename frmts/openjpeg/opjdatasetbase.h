@@ -322,6 +322,17 @@ struct OPJCodecWrapper
         return true;
     }
 
+    // Whether opj_get_decoded_tile() can be called several times on the
+    // same codec, which avoids parsing the main header for each tile.
+    static bool canDecodeSeveralTiles(void)
+    {
+#if IS_OPENJPEG_OR_LATER(2, 3, 0)
+        return true;
+#else
+        return false;
+#endif
+    }
+
     static uint32_t stride(jp2_image_comp *comp)
     {
         return comp->w;
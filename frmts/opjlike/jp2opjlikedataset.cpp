@@ -236,6 +236,15 @@ void JP2OPJLikeDataset<CODEC, BASE>::ReadBlockInThread(void *userdata)
         return;
     }
 
+    // When possible, decode all the tiles processed by this thread with the
+    // same codec, so that the main header (and the tile-part index built
+    // while seeking through the codestream) is only read once per thread.
+    CODEC oCodec;
+    const bool bReuseCodec =
+        CODEC::canDecodeSeveralTiles() &&
+        CPLTestBool(
+            CPLGetConfigOption("OPENJPEG_REUSE_CODEC_IN_THREADS", "YES"));
+
     while ((nPair = CPLAtomicInc(&(poJob->nCurPair))) < nPairs &&
            poJob->bSuccess)
     {
@@ -254,7 +263,8 @@ void JP2OPJLikeDataset<CODEC, BASE>::ReadBlockInThread(void *userdata)
 
         void *pDstBuffer = poBlock->GetDataRef();
         if (poGDS->ReadBlock(nBand, fp, nBlockXOff, nBlockYOff, pDstBuffer,
-                             nBandCount, panBandMap) != CE_None)
+                             nBandCount, panBandMap,
+                             bReuseCodec ? &oCodec : nullptr) != CE_None)
         {
             poJob->bSuccess = false;
         }
@@ -262,6 +272,7 @@ void JP2OPJLikeDataset<CODEC, BASE>::ReadBlockInThread(void *userdata)
         poBlock->DropLock();
     }
 
+    oCodec.cleanUpDecompress();
     VSIFCloseL(fp);
     // VSIFree(pDummy);
 }
@@ -498,10 +509,15 @@ template <typename CODEC, typename BASE>
 CPLErr JP2OPJLikeDataset<CODEC, BASE>::ReadBlock(int nBand, VSILFILE *fpIn,
                                                  int nBlockXOff, int nBlockYOff,
                                                  void *pImage, int nBandCount,
-                                                 int *panBandMap)
+                                                 int *panBandMap,
+                                                 CODEC *poReusableCodec)
 {
     CPLErr eErr = CE_None;
-    CODEC localctx;
+    // If poReusableCodec is provided, it is kept open on return so that the
+    // caller can decode other tiles with it, without parsing again the main
+    // header.
+    CODEC oLocalCodec;
+    CODEC &localctx = poReusableCodec ? *poReusableCodec : oLocalCodec;
 
     auto poBand = (JP2OPJLikeRasterBand<CODEC, BASE> *)GetRasterBand(nBand);
     int nBlockXSize = poBand->nBlockXSize;
@@ -706,7 +722,10 @@ CPLErr JP2OPJLikeDataset<CODEC, BASE>::ReadBlock(int nBand, VSILFILE *fpIn,
     }
 
 end:
-    this->cache(&localctx);
+    if (poReusableCodec == nullptr)
+        this->cache(&localctx);
+    else if (eErr != CE_None)
+        localctx.cleanUpDecompress();
 
     return eErr;
 }
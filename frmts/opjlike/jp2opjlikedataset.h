@@ -186,7 +186,8 @@ class JP2OPJLikeDataset final : public GDALJP2AbstractDataset, public BASE
     static bool WriteIPRBox(VSILFILE *fp, GDALDataset *poSrcDS);
 
     CPLErr ReadBlock(int nBand, VSILFILE *fp, int nBlockXOff, int nBlockYOff,
-                     void *pImage, int nBandCount, int *panBandMap);
+                     void *pImage, int nBandCount, int *panBandMap,
+                     CODEC *poReusableCodec = nullptr);
 
     int PreloadBlocks(JP2OPJLikeRasterBand<CODEC, BASE> *poBand, int nXOff,
                       int nYOff, int nXSize, int nYSize, int nBandCount,
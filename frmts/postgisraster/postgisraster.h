@@ -44,6 +44,8 @@
 #include "cpl_quad_tree.h"
 #include <float.h>
 #include <map>
+#include <string>
+#include <vector>
 
 // #define DEBUG_VERBOSE
 // #define DEBUG_QUERY
@@ -261,11 +263,24 @@ class PostGISRasterDataset final : public VRTDataset
     int nTileWidth;
     int nTileHeight;
 
-    int m_nLastLoadSourcesXOff = 0;
-    int m_nLastLoadSourcesYOff = 0;
-    int m_nLastLoadSourcesXSize = 0;
-    int m_nLastLoadSourcesYSize = 0;
-    int m_nLastLoadSourcesBand = 0;
+    // Pixel windows whose tiles have already been fully indexed by
+    // LoadSources(), most recent last.
+    struct LoadedWindow
+    {
+        int nXOff;
+        int nYOff;
+        int nXSize;
+        int nYSize;
+        int nBand;
+    };
+
+    std::vector<LoadedWindow> m_aoLoadedWindows{};
+
+    // Connection string of poConn, used to open the extra connections
+    // requested with PR_NUM_CONNECTIONS
+    std::string m_osConnectionString{};
+    std::vector<PGconn *> m_apoExtraConn{};
+    bool m_bExtraConnFailed = false;
 
     lru11::Cache<std::string, std::shared_ptr<GDALDataset>> oOutDBDatasetCache{
         8, 0};
@@ -299,6 +314,14 @@ class PostGISRasterDataset final : public VRTDataset
     bool CanUseClientSideOutDB(bool bAllBandCaching, int nBand,
                                const CPLString &osWHERE);
 
+    int GetNumConnections() const;
+    std::vector<PGconn *> GetTileConnections(int nMaxCount);
+    std::vector<std::string>
+    BuildIDsWHERE(const std::vector<CPLString> &aosIDs, int nChunks) const;
+    bool ExecuteTileQueries(const std::string &osSelect,
+                            const std::vector<std::string> &aosWHERE,
+                            std::vector<PGresult *> &apoResults);
+
     bool LoadOutdbRaster(int &nCurOffset, GDALDataType eDT, int nBand,
                          const GByte *pbyData, int nWKBLength, void *pImage,
                          double dfTileUpperLeftX, double dfTileUpperLeftY,
@@ -338,8 +361,9 @@ class PostGISRasterDataset final : public VRTDataset
     GBool LoadSources(int nXOff, int nYOff, int nXSize, int nYSize, int nBand);
     GBool PolygonFromCoords(int nXOff, int nYOff, int nXEndOff, int nYEndOff,
                             double adfProjWin[8]);
-    void CacheTile(const char *pszMetadata, const char *pszRaster,
-                   const char *pszPKID, int nBand, bool bAllBandCaching);
+    void CacheTile(const char *pszMetadata, const GByte *pabyWKB,
+                   int nWKBLength, const char *pszPKID, int nBand,
+                   bool bAllBandCaching);
 };
 
 /***********************************************************************
@@ -256,6 +256,9 @@ PostGISRasterDataset::~PostGISRasterDataset()
         VSIFree(papoSourcesHolders);
         papoSourcesHolders = nullptr;
     }
+
+    for (PGconn *poExtraConn : m_apoExtraConn)
+        PQfinish(poExtraConn);
 }
 
 /************************************************************************/
@@ -877,8 +880,9 @@ PostGISRasterDataset::GetMatchingSourceRef(double dfUpperLeftX,
 /*                           CacheTile()                                */
 /************************************************************************/
 void PostGISRasterDataset::CacheTile(const char *pszMetadata,
-                                     const char *pszRaster, const char *pszPKID,
-                                     int nBand, bool bAllBandCaching)
+                                     const GByte *pabyWKB, int nWKBLength,
+                                     const char *pszPKID, int nBand,
+                                     bool bAllBandCaching)
 {
     /**
      * Get metadata record and unpack it
@@ -917,19 +921,9 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
         nTileXSize * nTileYSize * nBandDataTypeSize;
     const int nExpectedBands = bAllBandCaching ? GetRasterCount() : 1;
 
-    int nWKBLength = 0;
-
-    struct CPLFreer
-    {
-        void operator()(GByte *x) const
-        {
-            CPLFree(x);
-        }
-    };
-
-    std::unique_ptr<GByte, CPLFreer> pbyDataAutoFreed(
-        CPLHexToBinary(pszRaster, &nWKBLength));
-    GByte *pbyData = pbyDataAutoFreed.get();
+    // The raster is transferred in binary form: use it directly from the
+    // PGresult buffer, without any intermediate copy.
+    const GByte *pbyData = pabyWKB;
     const int nMinimumWKBLength =
         RASTER_HEADER_SIZE + BAND_SIZE(1, nBandDataTypeSize) * nExpectedBands;
     if (nWKBLength < nMinimumWKBLength)
@@ -994,15 +988,9 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
                 return;
             }
 
-            GByte *pbyDataToRead = pbyData + nCurOffset;
+            const GByte *pbyDataToRead = pbyData + nCurOffset;
             nCurOffset += nExpectedBandDataSize;
 
-            if (bSwap && nBandDataTypeSize > 1)
-            {
-                GDALSwapWords(pbyDataToRead, nBandDataTypeSize,
-                              nTileXSize * nTileYSize, nBandDataTypeSize);
-            }
-
             /**
              * Manually add each tile data to the cache of the
              * matching PostGISRasterTileRasterBand.
@@ -1014,6 +1002,13 @@ void PostGISRasterDataset::CacheTile(const char *pszMetadata,
                 memcpy(poBlock->GetDataRef(), pbyDataToRead,
                        nExpectedBandDataSize);
 
+                // Do byte-swapping if necessary
+                if (bSwap && nBandDataTypeSize > 1)
+                {
+                    GDALSwapWords(poBlock->GetDataRef(), nBandDataTypeSize,
+                                  nTileXSize * nTileYSize, nBandDataTypeSize);
+                }
+
                 poBlock->DropLock();
             }
         }
@@ -1147,7 +1142,7 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
         return false;
 
     CPLString osSpatialFilter;
-    CPLString osIDsToFetch;
+    std::vector<CPLString> aosIDsToFetch;
     int nYSizeToQuery = nYSize;
 
     bool bFetchAll = false;
@@ -1158,15 +1153,17 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
     }
     else
     {
-        if (nXOff >= m_nLastLoadSourcesXOff &&
-            nYOff >= m_nLastLoadSourcesYOff &&
-            nXOff + nXSize <=
-                m_nLastLoadSourcesXOff + m_nLastLoadSourcesXSize &&
-            nYOff + nYSize <=
-                m_nLastLoadSourcesYOff + m_nLastLoadSourcesYSize &&
-            nBand == m_nLastLoadSourcesBand)
+        // The tiles of windows that have already been loaded are in the
+        // quad tree, so there is no need to query the index again.
+        for (const auto &oWindow : m_aoLoadedWindows)
         {
-            return true;
+            if (nXOff >= oWindow.nXOff && nYOff >= oWindow.nYOff &&
+                nXOff + nXSize <= oWindow.nXOff + oWindow.nXSize &&
+                nYOff + nYSize <= oWindow.nYOff + oWindow.nYSize &&
+                nBand == oWindow.nBand)
+            {
+                return true;
+            }
         }
 
         // To avoid doing too many small requests, try to query for at
@@ -1287,39 +1284,30 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
                     bFetchTile = TRUE;
             }
             if (bFetchTile)
-            {
-                if (!osIDsToFetch.empty())
-                    osIDsToFetch += ",";
-                osIDsToFetch += "'";
-                osIDsToFetch += pszPKID;
-                osIDsToFetch += "'";
-            }
+                aosIDsToFetch.push_back(pszPKID);
         }
 
         PQclear(poResult);
     }
 
-    if (bFetchAll || !osIDsToFetch.empty() || !osSpatialFilter.empty())
+    if (bFetchAll || !aosIDsToFetch.empty() || !osSpatialFilter.empty())
     {
         std::string osWHERE;
-        if (!osIDsToFetch.empty())
+        if (!aosIDsToFetch.empty())
         {
-            osWHERE += osPrimaryKeyNameI;
-            osWHERE += " IN (";
-            osWHERE += osIDsToFetch;
-            osWHERE += ")";
+            osWHERE = BuildIDsWHERE(aosIDsToFetch, 1)[0];
         }
-        else if (!osSpatialFilter.empty())
+        else
         {
             osWHERE = std::move(osSpatialFilter);
-        }
-        if (pszWhere != nullptr)
-        {
-            if (!osWHERE.empty())
-                osWHERE += " AND ";
-            osWHERE += "(";
-            osWHERE += pszWhere;
-            osWHERE += ")";
+            if (pszWhere != nullptr)
+            {
+                if (!osWHERE.empty())
+                    osWHERE += " AND ";
+                osWHERE += "(";
+                osWHERE += pszWhere;
+                osWHERE += ")";
+            }
         }
 
         bool bCanUseClientSide = true;
@@ -1330,8 +1318,9 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
                 CanUseClientSideOutDB(bAllBandCaching, nBand, osWHERE);
         }
 
+        // Results are requested in binary format, hence the text casts
         CPLString osCommand;
-        osCommand.Printf("SELECT %s, ST_Metadata(%s)",
+        osCommand.Printf("SELECT %s::text, ST_Metadata(%s)::text",
                          osPrimaryKeyNameI.c_str(), osColumnI.c_str());
         if (bLoadRasters)
         {
@@ -1345,95 +1334,277 @@ GBool PostGISRasterDataset::LoadSources(int nXOff, int nYOff, int nXSize,
                 orRasterToFetch.Printf("ST_Band(%s, %d)", osColumnI.c_str(),
                                        nBand);
             }
-            if (eOutDBResolution == OutDBResolution::SERVER_SIDE ||
-                !bCanUseClientSide)
-            {
-                orRasterToFetch =
-                    "encode(ST_AsBinary(" + orRasterToFetch + ",TRUE),'hex')";
-            }
+            const bool bOutDBAsInDB =
+                eOutDBResolution == OutDBResolution::SERVER_SIDE ||
+                !bCanUseClientSide;
+            orRasterToFetch = "ST_AsBinary(" + orRasterToFetch +
+                              (bOutDBAsInDB ? ",TRUE)" : ",FALSE)");
             osCommand += ", " + orRasterToFetch;
         }
         osCommand +=
             CPLSPrintf(" FROM %s.%s", osSchemaI.c_str(), osTableI.c_str());
-        if (!osWHERE.empty())
+
+        // Split the list of tiles to fetch between the available connections
+        std::vector<std::string> aosWHERE;
+        if (!aosIDsToFetch.empty())
+            aosWHERE = BuildIDsWHERE(aosIDsToFetch, GetNumConnections());
+        else
+            aosWHERE.push_back(std::move(osWHERE));
+
+        std::vector<PGresult *> apoResults;
+        if (!ExecuteTileQueries(osCommand, aosWHERE, apoResults))
+            return false;
+
+        for (PGresult *poTileResult : apoResults)
         {
-            osCommand += " WHERE ";
-            osCommand += osWHERE;
+            poResult = poTileResult;
+            for (int i = 0; i < PQntuples(poResult); i++)
+            {
+                const char *pszPKID = PQgetvalue(poResult, i, 0);
+                const char *pszMetadata = PQgetvalue(poResult, i, 1);
+
+                PostGISRasterTileDataset *poRTDS =
+                    GetMatchingSourceRef(pszPKID);
+                if (poRTDS == nullptr)
+                {
+                    poRTDS = BuildRasterTileDataset(pszMetadata, pszPKID,
+                                                    GetRasterCount(), nullptr);
+                    if (poRTDS != nullptr)
+                    {
+                        AddComplexSource(poRTDS);
+
+                        oMapPKIDToRTDS[poRTDS->pszPKID] = poRTDS;
+                        papoSourcesHolders =
+                            static_cast<PostGISRasterTileDataset **>(
+                                CPLRealloc(papoSourcesHolders,
+                                           sizeof(PostGISRasterTileDataset *) *
+                                               (m_nTiles + 1)));
+                        papoSourcesHolders[m_nTiles++] = poRTDS;
+                        CPLQuadTreeInsert(hQuadTree, poRTDS);
+                    }
+                }
+
+                if (bLoadRasters && poRTDS != nullptr)
+                {
+                    CacheTile(pszMetadata,
+                              reinterpret_cast<const GByte *>(
+                                  PQgetvalue(poResult, i, 2)),
+                              PQgetlength(poResult, i, 2), pszPKID, nBand,
+                              bAllBandCaching);
+                }
+            }
+
+            PQclear(poResult);
         }
+    }
 
-        poResult = PQexec(poConn, osCommand.c_str());
+    // If we have fetched the surface of all the dataset, then all sources have
+    // been built, and we don't need to do a spatial query on following
+    // IRasterIO() calls
+    if (bFetchAll)
+        bBuildQuadTreeDynamically = false;
 
-#ifdef DEBUG_QUERY
-        CPLDebug("PostGIS_Raster",
-                 "PostGISRasterDataset::LoadSources(): Query = \"%s\" --> "
-                 "number of rows = %d",
-                 osCommand.c_str(), poResult ? PQntuples(poResult) : 0);
-#endif
+    // Keep track of a bounded number of already indexed windows, so that
+    // going back and forth between a few areas does not trigger new
+    // index queries.
+    constexpr size_t MAX_LOADED_WINDOWS = 32;
+    if (m_aoLoadedWindows.size() == MAX_LOADED_WINDOWS)
+        m_aoLoadedWindows.erase(m_aoLoadedWindows.begin());
+    m_aoLoadedWindows.push_back({nXOff, nYOff, nXSize, nYSizeToQuery, nBand});
 
-        if (poResult == nullptr ||
-            PQresultStatus(poResult) != PGRES_TUPLES_OK ||
-            PQntuples(poResult) < 0)
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNumConnections()                          */
+/************************************************************************/
+
+/** Returns the maximum number of connections that can be used to fetch
+ * tiles concurrently, from the PR_NUM_CONNECTIONS configuration option. */
+int PostGISRasterDataset::GetNumConnections() const
+{
+    return std::max(
+        1, std::min(64, atoi(CPLGetConfigOption("PR_NUM_CONNECTIONS", "1"))));
+}
+
+/************************************************************************/
+/*                         GetTileConnections()                         */
+/************************************************************************/
+
+/** Returns at most nMaxCount connections to fetch tiles: the main
+ * connection, followed by extra connections that are opened on first use
+ * and kept until the dataset is closed. */
+std::vector<PGconn *> PostGISRasterDataset::GetTileConnections(int nMaxCount)
+{
+    // Overviews share the connections of their parent
+    if (poParentDS != nullptr)
+        return poParentDS->GetTileConnections(nMaxCount);
+
+    const int nCount = std::min(nMaxCount, GetNumConnections());
+    while (static_cast<int>(m_apoExtraConn.size()) + 1 < nCount &&
+           !m_bExtraConnFailed && !m_osConnectionString.empty())
+    {
+        PGconn *poExtraConn = PQconnectdb(m_osConnectionString.c_str());
+        if (poExtraConn == nullptr || PQstatus(poExtraConn) == CONNECTION_BAD)
         {
+            CPLDebug("PostGIS_Raster",
+                     "Cannot open extra connection, using %d connection(s): "
+                     "%s",
+                     static_cast<int>(m_apoExtraConn.size()) + 1,
+                     PQerrorMessage(poExtraConn));
+            PQfinish(poExtraConn);
+            m_bExtraConnFailed = true;
+            break;
+        }
+        m_apoExtraConn.push_back(poExtraConn);
+    }
 
-            if (poResult)
-                PQclear(poResult);
+    std::vector<PGconn *> apoConn{poConn};
+    for (PGconn *poExtraConn : m_apoExtraConn)
+    {
+        if (static_cast<int>(apoConn.size()) >= nCount)
+            break;
+        apoConn.push_back(poExtraConn);
+    }
+    return apoConn;
+}
 
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "PostGISRasterDataset::LoadSources(): %s",
-                     PQerrorMessage(poConn));
+/************************************************************************/
+/*                           BuildIDsWHERE()                            */
+/************************************************************************/
 
-            return false;
+/** Builds at most nChunks WHERE clauses selecting the tiles whose primary key
+ * values are in aosIDs, with about the same number of tiles each. */
+std::vector<std::string>
+PostGISRasterDataset::BuildIDsWHERE(const std::vector<CPLString> &aosIDs,
+                                    int nChunks) const
+{
+    const std::string osPrimaryKeyNameI(
+        CPLQuotedSQLIdentifier(pszPrimaryKeyName));
+    std::vector<std::string> aosWHERE;
+    const size_t nIDs = aosIDs.size();
+    const size_t nClauses =
+        std::max<size_t>(1, std::min<size_t>(nChunks, nIDs));
+    for (size_t iClause = 0; iClause < nClauses; ++iClause)
+    {
+        const size_t iStart = iClause * nIDs / nClauses;
+        const size_t iEnd = (iClause + 1) * nIDs / nClauses;
+        std::string osWHERE(osPrimaryKeyNameI);
+        osWHERE += " IN (";
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            if (i > iStart)
+                osWHERE += ",";
+            osWHERE += "'";
+            osWHERE += aosIDs[i];
+            osWHERE += "'";
+        }
+        osWHERE += ")";
+        if (pszWhere != nullptr)
+        {
+            osWHERE += " AND (";
+            osWHERE += pszWhere;
+            osWHERE += ")";
+        }
+        aosWHERE.push_back(std::move(osWHERE));
+    }
+    return aosWHERE;
+}
+
+/************************************************************************/
+/*                        ExecuteTileQueries()                          */
+/************************************************************************/
+
+/** Runs osSelect, restricted by each of the aosWHERE clauses, requesting
+ * results in binary format.
+ *
+ * Queries are sent asynchronously, one per connection returned by
+ * GetTileConnections(), so that the server evaluates them in parallel, and
+ * the results are then collected. On success, the caller must PQclear()
+ * the returned results.
+ */
+bool PostGISRasterDataset::ExecuteTileQueries(
+    const std::string &osSelect, const std::vector<std::string> &aosWHERE,
+    std::vector<PGresult *> &apoResults)
+{
+    apoResults.clear();
+    const std::vector<PGconn *> apoConn =
+        GetTileConnections(static_cast<int>(aosWHERE.size()));
+
+    bool bOK = true;
+    size_t iQuery = 0;
+    while (bOK && iQuery < aosWHERE.size())
+    {
+        size_t nSent = 0;
+        for (; nSent < apoConn.size() && iQuery + nSent < aosWHERE.size();
+             ++nSent)
+        {
+            std::string osCommand(osSelect);
+            if (!aosWHERE[iQuery + nSent].empty())
+            {
+                osCommand += " WHERE ";
+                osCommand += aosWHERE[iQuery + nSent];
+            }
+#ifdef DEBUG_QUERY
+            CPLDebug("PostGIS_Raster",
+                     "PostGISRasterDataset::ExecuteTileQueries(): "
+                     "Query (connection %d) = \"%s\"",
+                     static_cast<int>(nSent), osCommand.c_str());
+#endif
+            if (!PQsendQueryParams(apoConn[nSent], osCommand.c_str(), 0,
+                                   nullptr, nullptr, nullptr, nullptr,
+                                   /* resultFormat = binary */ 1))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "PostGISRasterDataset::ExecuteTileQueries(): %s",
+                         PQerrorMessage(apoConn[nSent]));
+                bOK = false;
+                break;
+            }
         }
 
-        for (int i = 0; i < PQntuples(poResult); i++)
+        // Always drain the connections on which a query has been sent, so
+        // that they remain usable.
+        for (size_t i = 0; i < nSent; ++i)
         {
-            const char *pszPKID = PQgetvalue(poResult, i, 0);
-            const char *pszMetadata = PQgetvalue(poResult, i, 1);
+            PGresult *poResult = nullptr;
+            PGresult *poNextResult = nullptr;
+            while ((poNextResult = PQgetResult(apoConn[i])) != nullptr)
+            {
+                if (poResult == nullptr)
+                    poResult = poNextResult;
+                else
+                    PQclear(poNextResult);
+            }
 
-            PostGISRasterTileDataset *poRTDS = GetMatchingSourceRef(pszPKID);
-            if (poRTDS == nullptr)
+            if (poResult == nullptr ||
+                PQresultStatus(poResult) != PGRES_TUPLES_OK)
             {
-                poRTDS = BuildRasterTileDataset(pszMetadata, pszPKID,
-                                                GetRasterCount(), nullptr);
-                if (poRTDS != nullptr)
+                if (bOK)
                 {
-                    AddComplexSource(poRTDS);
-
-                    oMapPKIDToRTDS[poRTDS->pszPKID] = poRTDS;
-                    papoSourcesHolders =
-                        static_cast<PostGISRasterTileDataset **>(
-                            CPLRealloc(papoSourcesHolders,
-                                       sizeof(PostGISRasterTileDataset *) *
-                                           (m_nTiles + 1)));
-                    papoSourcesHolders[m_nTiles++] = poRTDS;
-                    CPLQuadTreeInsert(hQuadTree, poRTDS);
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "PostGISRasterDataset::ExecuteTileQueries(): %s",
+                             PQerrorMessage(apoConn[i]));
                 }
+                if (poResult)
+                    PQclear(poResult);
+                bOK = false;
             }
-
-            if (bLoadRasters && poRTDS != nullptr)
+            else
             {
-                const char *pszRaster = PQgetvalue(poResult, i, 2);
-                CacheTile(pszMetadata, pszRaster, pszPKID, nBand,
-                          bAllBandCaching);
+                apoResults.push_back(poResult);
             }
         }
-
-        PQclear(poResult);
+        iQuery += nSent;
     }
 
-    // If we have fetched the surface of all the dataset, then all sources have
-    // been built, and we don't need to do a spatial query on following
-    // IRasterIO() calls
-    if (bFetchAll)
-        bBuildQuadTreeDynamically = false;
-
-    m_nLastLoadSourcesXOff = nXOff;
-    m_nLastLoadSourcesYOff = nYOff;
-    m_nLastLoadSourcesXSize = nXSize;
-    m_nLastLoadSourcesYSize = nYSizeToQuery;
-    m_nLastLoadSourcesBand = nBand;
-
-    return true;
+    if (!bOK)
+    {
+        for (PGresult *poResult : apoResults)
+            PQclear(poResult);
+        apoResults.clear();
+    }
+    return bOK;
 }
 
 /***********************************************************************
@@ -3311,6 +3482,7 @@ GDALDataset *PostGISRasterDataset::Open(GDALOpenInfo *poOpenInfo)
         poDS->pszTable = pszTable;
         poDS->pszColumn = pszColumn;
         poDS->pszWhere = pszWhere;
+        poDS->m_osConnectionString = pszConnectionString;
 
         /**
          * Fetch basic raster metadata from db
@@ -335,7 +335,7 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
     sAoi.maxy = 0.0;
 
     GIntBig nMemoryRequiredForTiles = 0;
-    CPLString osIDsToFetch;
+    std::vector<CPLString> aosIDsToFetch;
     int nTilesToFetch = 0;
     int nBandDataTypeSize = GDALGetDataTypeSize(eDataType) / 8;
 
@@ -357,13 +357,7 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
 
             // If we have a PKID, add the tile PKID to the list
             if (poTile->pszPKID != nullptr)
-            {
-                if (!osIDsToFetch.empty())
-                    osIDsToFetch += ",";
-                osIDsToFetch += "'";
-                osIDsToFetch += poTile->pszPKID;
-                osIDsToFetch += "'";
-            }
+                aosIDsToFetch.push_back(poTile->pszPKID);
 
             double dfTileMinX, dfTileMinY, dfTileMaxX, dfTileMaxY;
             poTile->GetExtent(&dfTileMinX, &dfTileMinY, &dfTileMaxX,
@@ -469,16 +463,15 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
         CPLString osColumnI(CPLQuotedSQLIdentifier(pszColumn));
 
         CPLString osWHERE;
-        if (!osIDsToFetch.empty() &&
+        bool bFetchByIDs = false;
+        if (!aosIDsToFetch.empty() &&
             (poRDS->bIsFastPK || !(poRDS->HasSpatialIndex())))
         {
             if (nTilesToFetch < poRDS->m_nTiles ||
                 poRDS->bBuildQuadTreeDynamically)
             {
-                osWHERE += poRDS->pszPrimaryKeyName;
-                osWHERE += " IN (";
-                osWHERE += osIDsToFetch;
-                osWHERE += ")";
+                bFetchByIDs = true;
+                osWHERE = poRDS->BuildIDsWHERE(aosIDsToFetch, 1)[0];
             }
         }
         else
@@ -505,7 +498,7 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
             }
         }
 
-        if (poRDS->pszWhere != nullptr)
+        if (poRDS->pszWhere != nullptr && !bFetchByIDs)
         {
             if (!osWHERE.empty())
                 osWHERE += " AND ";
@@ -526,76 +519,74 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
             osRasterToFetch = osColumnI;
         else
             osRasterToFetch.Printf("ST_Band(%s, %d)", osColumnI.c_str(), nBand);
-        if (poRDS->eOutDBResolution == OutDBResolution::SERVER_SIDE ||
-            !bCanUseClientSide)
-        {
-            osRasterToFetch =
-                "encode(ST_AsBinary(" + osRasterToFetch + ",TRUE),'hex')";
-        }
+        const bool bOutDBAsInDB =
+            poRDS->eOutDBResolution == OutDBResolution::SERVER_SIDE ||
+            !bCanUseClientSide;
+        osRasterToFetch = "ST_AsBinary(" + osRasterToFetch +
+                          (bOutDBAsInDB ? ",TRUE)" : ",FALSE)");
 
+        // Results are requested in binary format, hence the text casts
         CPLString osCommand;
-        osCommand.Printf("SELECT %s, ST_Metadata(%s), %s FROM %s.%s",
-                         (poRDS->GetPrimaryKeyRef()) ? poRDS->GetPrimaryKeyRef()
-                                                     : "NULL",
-                         osColumnI.c_str(), osRasterToFetch.c_str(),
-                         osSchemaI.c_str(), osTableI.c_str());
-        if (!osWHERE.empty())
+        osCommand.Printf(
+            "SELECT %s::text, ST_Metadata(%s)::text, %s FROM %s.%s",
+            (poRDS->GetPrimaryKeyRef())
+                ? CPLQuotedSQLIdentifier(poRDS->GetPrimaryKeyRef()).c_str()
+                : "NULL",
+            osColumnI.c_str(), osRasterToFetch.c_str(), osSchemaI.c_str(),
+            osTableI.c_str());
+
+        // When fetching by primary key, split the list of tiles between the
+        // available connections
+        std::vector<std::string> aosWHERE;
+        if (bFetchByIDs)
         {
-            osCommand += " WHERE " + osWHERE;
+            aosWHERE = poRDS->BuildIDsWHERE(aosIDsToFetch,
+                                            poRDS->GetNumConnections());
         }
-
-        PGresult *poResult = PQexec(poRDS->poConn, osCommand.c_str());
-
-#ifdef DEBUG_QUERY
-        CPLDebug("PostGIS_Raster",
-                 "PostGISRasterRasterBand::IRasterIO(): Query = \"%s\" --> "
-                 "number of rows = %d",
-                 osCommand.c_str(), poResult ? PQntuples(poResult) : 0);
-#endif
-
-        if (poResult == nullptr ||
-            PQresultStatus(poResult) != PGRES_TUPLES_OK ||
-            PQntuples(poResult) < 0)
+        else
         {
+            aosWHERE.push_back(osWHERE);
+        }
 
-            if (poResult)
-                PQclear(poResult);
-
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "PostGISRasterRasterBand::IRasterIO(): %s",
-                     PQerrorMessage(poRDS->poConn));
-
+        std::vector<PGresult *> apoResults;
+        if (!poRDS->ExecuteTileQueries(osCommand, aosWHERE, apoResults))
+        {
             // Free the object that holds pointers to matching tiles
             CPLFree(papsMatchingTiles);
             return CE_Failure;
         }
 
         /**
-         * No data. Return the buffer filled with nodata values
+         * Ok, we loop over the results
          **/
-        else if (PQntuples(poResult) == 0)
+        int nTotalTuples = 0;
+        for (PGresult *poResult : apoResults)
         {
-            PQclear(poResult);
+            const int nTuples = PQntuples(poResult);
+            nTotalTuples += nTuples;
+            for (i = 0; i < nTuples; i++)
+            {
+                const char *pszPKID = PQgetvalue(poResult, i, 0);
+                const char *pszMetadata = PQgetvalue(poResult, i, 1);
+                poRDS->CacheTile(
+                    pszMetadata,
+                    reinterpret_cast<const GByte *>(PQgetvalue(poResult, i, 2)),
+                    PQgetlength(poResult, i, 2), pszPKID, nBand,
+                    bAllBandCaching);
+            }  // All tiles have been added to cache
 
-            // Free the object that holds pointers to matching tiles
-            CPLFree(papsMatchingTiles);
-            return CE_None;
+            PQclear(poResult);
         }
 
         /**
-         * Ok, we loop over the results
+         * No data. Return the buffer filled with nodata values
          **/
-        int nTuples = PQntuples(poResult);
-        for (i = 0; i < nTuples; i++)
+        if (nTotalTuples == 0)
         {
-            const char *pszPKID = PQgetvalue(poResult, i, 0);
-            const char *pszMetadata = PQgetvalue(poResult, i, 1);
-            const char *pszRaster = PQgetvalue(poResult, i, 2);
-            poRDS->CacheTile(pszMetadata, pszRaster, pszPKID, nBand,
-                             bAllBandCaching);
-        }  // All tiles have been added to cache
-
-        PQclear(poResult);
+            // Free the object that holds pointers to matching tiles
+            CPLFree(papsMatchingTiles);
+            return CE_None;
+        }
     }  // End missing tiles
 
     /* -------------------------------------------------------------------- */
@@ -115,11 +115,10 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
     osRasterToFetch.Printf("ST_Band(%s, %d)", osColumnI.c_str(), nBand);
     // We don't honour CLIENT_SIDE_IF_POSSIBLE since it would be likely too
     // costly in that context.
-    if (poRTDS->poRDS->eOutDBResolution != OutDBResolution::CLIENT_SIDE)
-    {
-        osRasterToFetch =
-            "encode(ST_AsBinary(" + osRasterToFetch + ",TRUE),'hex')";
-    }
+    const bool bOutDBAsInDB =
+        poRTDS->poRDS->eOutDBResolution != OutDBResolution::CLIENT_SIDE;
+    osRasterToFetch = "ST_AsBinary(" + osRasterToFetch +
+                      (bOutDBAsInDB ? ",TRUE)" : ",FALSE)");
 
     osCommand.Printf("SELECT %s FROM %s.%s WHERE ", osRasterToFetch.c_str(),
                      osSchemaI.c_str(), osTableI.c_str());
@@ -142,7 +141,9 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
                                 osColumnI.c_str(), dfTileUpperLeftY);
     }
 
-    poResult = PQexec(poRTDS->poRDS->poConn, osCommand.c_str());
+    // Fetch the raster in binary format
+    poResult = PQexecParams(poRTDS->poRDS->poConn, osCommand.c_str(), 0,
+                            nullptr, nullptr, nullptr, nullptr, 1);
 
 #ifdef DEBUG_QUERY
     CPLDebug("PostGIS_Raster",
@@ -175,18 +176,9 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
     /* Copy only data size, without payload */
     int nExpectedDataSize = nBlockXSize * nBlockYSize * nPixelSize;
 
-    struct CPLFreer
-    {
-        void operator()(GByte *x) const
-        {
-            CPLFree(x);
-        }
-    };
-
-    std::unique_ptr<GByte, CPLFreer> pbyDataAutoFreed(
-        CPLHexToBinary(PQgetvalue(poResult, 0, 0), &nWKBLength));
-    GByte *pbyData = pbyDataAutoFreed.get();
-    PQclear(poResult);
+    nWKBLength = PQgetlength(poResult, 0, 0);
+    const GByte *pbyData =
+        reinterpret_cast<const GByte *>(PQgetvalue(poResult, 0, 0));
 
     const int nMinimumWKBLength = RASTER_HEADER_SIZE + BAND_SIZE(1, nPixelSize);
     if (nWKBLength < nMinimumWKBLength)
@@ -194,6 +186,7 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
         CPLDebug("PostGIS_Raster",
                  "nWKBLength=%d. too short. Expected at least %d", nWKBLength,
                  nMinimumWKBLength);
+        PQclear(poResult);
         return CE_Failure;
     }
 
@@ -206,10 +199,11 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
         {
             CPLDebug("PostGIS_Raster", "nWKBLength=%d, nExpectedWKBLength=%d",
                      nWKBLength, nExpectedWKBLength);
+            PQclear(poResult);
             return CE_Failure;
         }
 
-        GByte *pbyDataToRead =
+        const GByte *pbyDataToRead =
             GET_BAND_DATA(pbyData, 1, nPixelSize, nExpectedDataSize);
 
         // Do byte-swapping if necessary */
@@ -220,13 +214,13 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
         const bool bSwap = bIsLittleEndian;
 #endif
 
+        memcpy(pImage, pbyDataToRead, nExpectedDataSize);
+
         if (bSwap && nPixelSize > 1)
         {
-            GDALSwapWords(pbyDataToRead, nPixelSize, nBlockXSize * nBlockYSize,
+            GDALSwapWords(pImage, nPixelSize, nBlockXSize * nBlockYSize,
                           nPixelSize);
         }
-
-        memcpy(pImage, pbyDataToRead, nExpectedDataSize);
     }
     else
     {
@@ -236,9 +230,11 @@ CPLErr PostGISRasterTileRasterBand::IReadBlock(int /*nBlockXOff*/,
                 dfTileUpperLeftX, dfTileUpperLeftY, dfTileResX, dfTileResY,
                 nTileXSize, nTileYSize))
         {
+            PQclear(poResult);
             return CE_Failure;
         }
     }
 
+    PQclear(poResult);
     return CE_None;
 }
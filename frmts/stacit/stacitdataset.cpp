@@ -26,14 +26,20 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
+#include "cpl_http.h"
 #include "cpl_json.h"
+#include "cpl_json_streaming_parser.h"
+#include "cpl_vsi.h"
 #include "vrtdataset.h"
 #include "ogr_spatialref.h"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <map>
 #include <string>
+#include <thread>
 
 namespace
 {
@@ -690,6 +696,324 @@ void STACITDataset::SetSubdatasets(
     GDALDataset::SetMetadata(aosSubdatasets.List(), "SUBDATASETS");
 }
 
+/************************************************************************/
+/*                         STACITItemsParser                            */
+/************************************************************************/
+
+namespace
+{
+/** Streaming parser of an ItemCollection document.
+ *
+ * Only one Feature at a time is materialized as a CPLJSONObject, instead of
+ * building the DOM of the whole document, which can be huge for searches
+ * returning thousands of items.
+ */
+class STACITItemsParser final : public CPLJSonStreamingParser
+{
+  public:
+    //! Called for each feature. Parsing stops if it returns false.
+    std::function<bool(const CPLJSONObject &)> m_oFeatureCallback{};
+    //! Called as soon as the "next" link has been parsed.
+    std::function<void(const std::string &)> m_oNextLinkCallback{};
+
+    void Reset() override
+    {
+        CPLJSonStreamingParser::Reset();
+        m_nDepth = 0;
+        m_bFeaturesKey = false;
+        m_bInFeatures = false;
+        m_bFeaturesFound = false;
+        m_bStop = false;
+        m_eCapture = Capture::NONE;
+        m_osBuffer.clear();
+        m_osNextLink.clear();
+    }
+
+    bool HasFeatures() const
+    {
+        return m_bFeaturesFound;
+    }
+
+    bool IsStopped() const
+    {
+        return m_bStop;
+    }
+
+    const std::string &GetNextLink() const
+    {
+        return m_osNextLink;
+    }
+
+  protected:
+    void String(const char *pszValue, size_t) override
+    {
+        AppendScalar(GetSerializedString(pszValue));
+    }
+
+    void Number(const char *pszValue, size_t nLength) override
+    {
+        AppendScalar(std::string(pszValue, nLength));
+    }
+
+    void Boolean(bool b) override
+    {
+        AppendScalar(b ? "true" : "false");
+    }
+
+    void Null() override
+    {
+        AppendScalar("null");
+    }
+
+    void StartObject() override
+    {
+        if (m_eCapture != Capture::NONE)
+            m_osBuffer += '{';
+        ++m_nDepth;
+    }
+
+    void EndObject() override
+    {
+        --m_nDepth;
+        if (m_eCapture != Capture::NONE)
+        {
+            m_osBuffer += '}';
+            if ((m_eCapture == Capture::FEATURE && m_nDepth == 2) ||
+                (m_eCapture == Capture::LINKS && m_nDepth == 1))
+            {
+                FinishCapture();
+            }
+        }
+    }
+
+    void StartObjectMember(const char *pszKey, size_t nLength) override
+    {
+        if (m_nDepth == 1)
+        {
+            const std::string osKey(pszKey, nLength);
+            m_bFeaturesKey = osKey == "features";
+            m_bInFeatures = false;
+            m_osBuffer.clear();
+            m_eCapture = osKey == "links" ? Capture::LINKS : Capture::NONE;
+        }
+        else if (m_eCapture != Capture::NONE)
+        {
+            if (m_osBuffer.back() != '{')
+                m_osBuffer += ',';
+            m_osBuffer +=
+                GetSerializedString(std::string(pszKey, nLength).c_str());
+            m_osBuffer += ':';
+        }
+    }
+
+    void StartArray() override
+    {
+        if (m_eCapture != Capture::NONE)
+            m_osBuffer += '[';
+        else if (m_nDepth == 1 && m_bFeaturesKey)
+        {
+            m_bInFeatures = true;
+            m_bFeaturesFound = true;
+        }
+        ++m_nDepth;
+    }
+
+    void EndArray() override
+    {
+        --m_nDepth;
+        if (m_nDepth == 1 && m_bInFeatures)
+        {
+            m_bInFeatures = false;
+            m_eCapture = Capture::NONE;
+        }
+        else if (m_eCapture != Capture::NONE)
+        {
+            m_osBuffer += ']';
+            if (m_eCapture == Capture::LINKS && m_nDepth == 1)
+                FinishCapture();
+        }
+    }
+
+    void StartArrayMember() override
+    {
+        if (m_nDepth == 2 && m_bInFeatures)
+        {
+            m_osBuffer.clear();
+            m_eCapture = Capture::FEATURE;
+        }
+        else if (m_eCapture != Capture::NONE && m_osBuffer.back() != '[')
+        {
+            m_osBuffer += ',';
+        }
+    }
+
+    void Exception(const char *pszMessage) override
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", pszMessage);
+    }
+
+  private:
+    enum class Capture
+    {
+        NONE,
+        FEATURE,
+        LINKS
+    };
+
+    int m_nDepth = 0;
+    bool m_bFeaturesKey = false;
+    bool m_bInFeatures = false;
+    bool m_bFeaturesFound = false;
+    bool m_bStop = false;
+    Capture m_eCapture = Capture::NONE;
+    std::string m_osBuffer{};
+    std::string m_osNextLink{};
+
+    void AppendScalar(const std::string &osValue)
+    {
+        if (m_eCapture != Capture::NONE)
+        {
+            m_osBuffer += osValue;
+            if (m_eCapture == Capture::LINKS && m_nDepth == 1)
+                FinishCapture();
+        }
+    }
+
+    void FinishCapture()
+    {
+        CPLJSONDocument oDoc;
+        if (!m_bStop && oDoc.LoadMemory(m_osBuffer))
+        {
+            if (m_eCapture == Capture::FEATURE)
+            {
+                if (m_oFeatureCallback && !m_oFeatureCallback(oDoc.GetRoot()))
+                    m_bStop = true;
+            }
+            else
+            {
+                const auto oLinks = oDoc.GetRoot().ToArray();
+                for (const auto &oLink : oLinks)
+                {
+                    if (oLink["rel"].ToString() == "next")
+                    {
+                        m_osNextLink = oLink["href"].ToString();
+                        if (m_oNextLinkCallback)
+                            m_oNextLinkCallback(m_osNextLink);
+                        break;
+                    }
+                }
+            }
+        }
+        m_osBuffer.clear();
+        m_eCapture = Capture::NONE;
+    }
+};
+
+/************************************************************************/
+/*                        FetchItemCollection()                         */
+/************************************************************************/
+
+bool FetchItemCollection(const std::string &osFilename, std::string &osContent)
+{
+    osContent.clear();
+    if (STARTS_WITH(osFilename.c_str(), "http://") ||
+        STARTS_WITH(osFilename.c_str(), "https://"))
+    {
+        CPLHTTPResult *psResult = CPLHTTPFetch(osFilename.c_str(), nullptr);
+        if (!psResult)
+            return false;
+        const bool bRet =
+            psResult->nStatus == 0 && psResult->pszErrBuf == nullptr;
+        if (bRet && psResult->pabyData)
+        {
+            osContent.assign(reinterpret_cast<const char *>(psResult->pabyData),
+                             psResult->nDataLen);
+        }
+        CPLHTTPDestroyResult(psResult);
+        return bRet;
+    }
+
+    GByte *pabyContent = nullptr;
+    vsi_l_offset nSize = 0;
+    if (!VSIIngestFile(nullptr, osFilename.c_str(), &pabyContent, &nSize, -1))
+        return false;
+    osContent.assign(reinterpret_cast<const char *>(pabyContent),
+                     static_cast<size_t>(nSize));
+    VSIFree(pabyContent);
+    return true;
+}
+
+/************************************************************************/
+/*                        STACITPagePrefetcher                          */
+/************************************************************************/
+
+/** Fetches the next page of results in a background thread, while the
+ * current one is being parsed.
+ */
+class STACITPagePrefetcher
+{
+  public:
+    STACITPagePrefetcher() = default;
+
+    ~STACITPagePrefetcher()
+    {
+        Join();
+    }
+
+    void Start(const std::string &osURL)
+    {
+        Join();
+        m_osURL = osURL;
+        m_bOK = false;
+        m_osContent.clear();
+        m_aoErrors.clear();
+        const CPLStringList aosTLConfigOptions(
+            CPLGetThreadLocalConfigOptions());
+        m_oThread = std::thread(
+            [this, aosTLConfigOptions]()
+            {
+                CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+                CPLInstallErrorHandlerAccumulator(m_aoErrors);
+                m_bOK = FetchItemCollection(m_osURL, m_osContent);
+                CPLUninstallErrorHandlerAccumulator();
+                CPLSetThreadLocalConfigOptions(nullptr);
+            });
+    }
+
+    //! Returns the content of osURL, using the prefetched one if possible.
+    bool Get(const std::string &osURL, std::string &osContent)
+    {
+        if (!m_oThread.joinable() || osURL != m_osURL)
+        {
+            Join();
+            return FetchItemCollection(osURL, osContent);
+        }
+        m_oThread.join();
+        for (const auto &oError : m_aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        m_aoErrors.clear();
+        osContent = std::move(m_osContent);
+        m_osContent.clear();
+        return m_bOK;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(STACITPagePrefetcher)
+
+    std::thread m_oThread{};
+    std::string m_osURL{};
+    std::string m_osContent{};
+    bool m_bOK = false;
+    std::vector<CPLErrorHandlerAccumulatorStruct> m_aoErrors{};
+
+    void Join()
+    {
+        if (m_oThread.joinable())
+            m_oThread.join();
+    }
+};
+}  // namespace
+
 /************************************************************************/
 /*                               Open()                                 */
 /************************************************************************/
@@ -741,94 +1065,138 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
         }
     }
 
-    auto osCurFilename = osFilename;
-    do
+    const auto ProcessFeature = [&](const CPLJSONObject &oFeature)
     {
-        CPLJSONDocument oDoc;
-        if (STARTS_WITH(osCurFilename, "http://") ||
-            STARTS_WITH(osCurFilename, "https://"))
+        nItemIter++;
+        if (nItemIter > nMaxItems)
         {
-            if (!oDoc.LoadUrl(osCurFilename, nullptr))
-                return false;
-        }
-        else
-        {
-            if (!oDoc.Load(osCurFilename))
-                return false;
+            return false;
         }
-        const auto oRoot = oDoc.GetRoot();
-        const auto oFeatures = oRoot.GetArray("features");
-        if (!oFeatures.IsValid())
+
+        auto oStacExtensions = oFeature.GetArray("stac_extensions");
+        if (!oStacExtensions.IsValid())
         {
-            CPLError(CE_Failure, CPLE_AppDefined, "Missing features");
-            return false;
+            CPLDebug("STACIT", "Skipping Feature that lacks stac_extensions");
+            return true;
         }
-        for (const auto &oFeature : oFeatures)
+        bool bProjExtensionFound = false;
+        for (const auto &oStacExtension : oStacExtensions)
         {
-            nItemIter++;
-            if (nItemIter > nMaxItems)
+            if (oStacExtension.ToString() == "proj" ||
+                oStacExtension.ToString().find(
+                    "https://stac-extensions.github.io/projection/") == 0)
             {
+                bProjExtensionFound = true;
                 break;
             }
+        }
+        if (!bProjExtensionFound)
+        {
+            CPLDebug("STACIT",
+                     "Skipping Feature that lacks the 'proj' STAC extension");
+            return true;
+        }
 
-            auto oStacExtensions = oFeature.GetArray("stac_extensions");
-            if (!oStacExtensions.IsValid())
-            {
-                CPLDebug("STACIT",
-                         "Skipping Feature that lacks stac_extensions");
-                continue;
-            }
-            bool bProjExtensionFound = false;
-            for (const auto &oStacExtension : oStacExtensions)
-            {
-                if (oStacExtension.ToString() == "proj" ||
-                    oStacExtension.ToString().find(
-                        "https://stac-extensions.github.io/projection/") == 0)
-                {
-                    bProjExtensionFound = true;
-                    break;
-                }
-            }
-            if (!bProjExtensionFound)
-            {
-                CPLDebug(
-                    "STACIT",
-                    "Skipping Feature that lacks the 'proj' STAC extension");
+        auto jAssets = oFeature["assets"];
+        if (!jAssets.IsValid() ||
+            jAssets.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Missing assets on a Feature");
+            return true;
+        }
+
+        auto oProperties = oFeature["properties"];
+        if (!oProperties.IsValid() ||
+            oProperties.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Missing properties on a Feature");
+            return true;
+        }
+
+        const auto osCollection = oFeature["collection"].ToString();
+        if (!osFilteredCollection.empty() &&
+            osFilteredCollection != osCollection)
+            return true;
+
+        for (const auto &jAsset : jAssets.GetChildren())
+        {
+            const auto osAssetName = jAsset.GetName();
+            if (!osFilteredAsset.empty() && osFilteredAsset != osAssetName)
                 continue;
-            }
 
-            auto jAssets = oFeature["assets"];
-            if (!jAssets.IsValid() ||
-                jAssets.GetType() != CPLJSONObject::Type::Object)
+            ParseAsset(jAsset, oProperties, osCollection, osFilteredCRS,
+                       oMapCollection);
+        }
+        return true;
+    };
+
+    // Items are processed while the document is parsed, and the next page
+    // of results is downloaded as soon as its link is known.
+    auto osCurFilename = osFilename;
+    STACITPagePrefetcher oPrefetcher;
+    STACITItemsParser oParser;
+    oParser.m_oFeatureCallback = ProcessFeature;
+    oParser.m_oNextLinkCallback = [&](const std::string &osNextLink)
+    {
+        if (nItemIter < nMaxItems && osNextLink != osCurFilename)
+            oPrefetcher.Start(osNextLink);
+    };
+    constexpr size_t CHUNK_SIZE = 65536;
+    bool bFirstPage = true;
+    do
+    {
+        oParser.Reset();
+        bool bOK = true;
+        if (bFirstPage && !STARTS_WITH(osCurFilename, "http://") &&
+            !STARTS_WITH(osCurFilename, "https://"))
+        {
+            // Stream local files, instead of ingesting them
+            auto fp = VSIFOpenL(osCurFilename.c_str(), "rb");
+            if (!fp)
             {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Missing assets on a Feature");
-                continue;
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                         osCurFilename.c_str());
+                return false;
             }
-
-            auto oProperties = oFeature["properties"];
-            if (!oProperties.IsValid() ||
-                oProperties.GetType() != CPLJSONObject::Type::Object)
+            std::string osChunk;
+            osChunk.resize(CHUNK_SIZE);
+            while (bOK && !oParser.IsStopped())
             {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Missing properties on a Feature");
-                continue;
+                const size_t nRead =
+                    VSIFReadL(&osChunk[0], 1, osChunk.size(), fp);
+                const bool bFinished = nRead < osChunk.size();
+                bOK = oParser.Parse(osChunk.data(), nRead, bFinished);
+                if (bFinished)
+                    break;
             }
-
-            const auto osCollection = oFeature["collection"].ToString();
-            if (!osFilteredCollection.empty() &&
-                osFilteredCollection != osCollection)
-                continue;
-
-            for (const auto &jAsset : jAssets.GetChildren())
+            VSIFCloseL(fp);
+        }
+        else
+        {
+            std::string osContent;
+            if (!oPrefetcher.Get(osCurFilename, osContent))
+                return false;
+            for (size_t nPos = 0;
+                 bOK && !oParser.IsStopped() && nPos < osContent.size();
+                 nPos += CHUNK_SIZE)
             {
-                const auto osAssetName = jAsset.GetName();
-                if (!osFilteredAsset.empty() && osFilteredAsset != osAssetName)
-                    continue;
-
-                ParseAsset(jAsset, oProperties, osCollection, osFilteredCRS,
-                           oMapCollection);
+                const size_t nSize =
+                    std::min(CHUNK_SIZE, osContent.size() - nPos);
+                bOK = oParser.Parse(osContent.data() + nPos, nSize,
+                                    nPos + nSize == osContent.size());
             }
+            if (bOK && osContent.empty())
+                bOK = oParser.Parse("", 0, true);
+        }
+        bFirstPage = false;
+        if (!bOK)
+            return false;
+        if (!oParser.HasFeatures())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Missing features");
+            return false;
         }
         if (nItemIter >= nMaxItems)
         {
@@ -851,18 +1219,7 @@ bool STACITDataset::Open(GDALOpenInfo *poOpenInfo)
         }
 
         // Follow next link
-        const auto oLinks = oRoot.GetArray("links");
-        if (!oLinks.IsValid())
-            break;
-        std::string osNewFilename;
-        for (const auto &oLink : oLinks)
-        {
-            if (oLink["rel"].ToString() == "next")
-            {
-                osNewFilename = oLink["href"].ToString();
-                break;
-            }
-        }
+        const std::string osNewFilename = oParser.GetNextLink();
         if (!osNewFilename.empty() && osNewFilename != osCurFilename)
             osCurFilename = osNewFilename;
         else
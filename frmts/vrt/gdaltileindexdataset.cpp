@@ -3367,7 +3367,8 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     const bool bNeedInitBuffer = NeedInitBuffer(nBandCount, panBandMap);
 
-    const auto RenderSource = [=](SourceDesc &oSourceDesc)
+    const auto RenderSource =
+        [=](SourceDesc &oSourceDesc, VRTSource::WorkingState &oWorkingState)
     {
         auto &poTileDS = oSourceDesc.poDS;
         auto &poSource = oSourceDesc.poSource;
@@ -3456,7 +3457,7 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     eErr = poSource->RasterIO(
                         poTileBand->GetRasterDataType(), nXOff, nYOff, nXSize,
                         nYSize, pabyBandData, nBufXSize, nBufYSize, eBufType,
-                        nPixelSpace, nLineSpace, &sExtraArg, m_oWorkingState);
+                        nPixelSpace, nLineSpace, &sExtraArg, oWorkingState);
                 }
             }
             return eErr;
@@ -3695,7 +3696,7 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     papoBands[nBandNr - 1]->GetRasterDataType(), nXOff, nYOff,
                     nXSize, nYSize, pabyBandData, nBufXSize, nBufYSize,
                     eBufType, nPixelSpace, nLineSpace, &sExtraArg,
-                    m_oWorkingState);
+                    oWorkingState);
             }
         }
         return eErr;
@@ -3703,17 +3704,80 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     if (!bNeedInitBuffer)
     {
-        return RenderSource(m_aoSourceDesc.back());
+        return RenderSource(m_aoSourceDesc.back(), m_oWorkingState);
     }
     else
     {
         InitBuffer(pData, nBufXSize, nBufYSize, eBufType, nBandCount,
                    panBandMap, nPixelSpace, nLineSpace, nBandSpace);
 
+        // If sources write to disjoint regions of the output buffer, their
+        // rendering order does not matter, and they can be rendered in
+        // parallel.
+        // Progress functions are not expected to be called from several
+        // threads.
+        const int nRequestedThreads = VRTGetRequestedThreadCount();
+        if (nRequestedThreads > 1 && m_aoSourceDesc.size() > 1 &&
+            (psExtraArg->pfnProgress == nullptr ||
+             psExtraArg->pfnProgress == GDALDummyProgress))
+        {
+            std::vector<SourceDesc *> apoSourceDescs;
+            std::vector<VRTSource *> apoSources;
+            for (auto &oSourceDesc : m_aoSourceDesc)
+            {
+                if (oSourceDesc.poDS)
+                {
+                    oSourceDesc.poSource->SetRasterBand(
+                        oSourceDesc.poDS->GetRasterBand(1), false);
+                    apoSourceDescs.push_back(&oSourceDesc);
+                    apoSources.push_back(oSourceDesc.poSource.get());
+                }
+            }
+
+            std::vector<VRTSimpleSource *> apoContributingSources;
+            if (VRTCollectSourcesForParallelIO(
+                    apoSources.data(), static_cast<int>(apoSources.size()),
+                    dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                    apoContributingSources))
+            {
+                // Only keep the contributing sources
+                std::vector<SourceDesc *> apoContributingSourceDescs;
+                size_t iContributing = 0;
+                for (auto *poSourceDesc : apoSourceDescs)
+                {
+                    if (iContributing < apoContributingSources.size() &&
+                        poSourceDesc->poSource.get() ==
+                            apoContributingSources[iContributing])
+                    {
+                        apoContributingSourceDescs.push_back(poSourceDesc);
+                        ++iContributing;
+                    }
+                }
+
+                const auto RenderSourceJob = [&](int iSource)
+                {
+                    VRTSource::WorkingState oWorkingState;
+                    return RenderSource(*apoContributingSourceDescs[iSource],
+                                        oWorkingState);
+                };
+                CPLErr eErr = CE_None;
+                if (VRTRunJobsInParallel(
+                        static_cast<int>(apoContributingSourceDescs.size()),
+                        nRequestedThreads, RenderSourceJob, eErr))
+                {
+                    CPLDebugOnly(
+                        "GTI", "IRasterIO(): rendered %d sources in parallel",
+                        static_cast<int>(apoContributingSourceDescs.size()));
+                    return eErr;
+                }
+            }
+        }
+
         // Now render from bottom of the stack to top.
         for (auto &oSourceDesc : m_aoSourceDesc)
         {
-            if (oSourceDesc.poDS && RenderSource(oSourceDesc) != CE_None)
+            if (oSourceDesc.poDS &&
+                RenderSource(oSourceDesc, m_oWorkingState) != CE_None)
                 return CE_Failure;
         }
 
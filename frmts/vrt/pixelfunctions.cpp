@@ -31,7 +31,15 @@
 #include "gdal.h"
 #include "vrtdataset.h"
 
+#include <algorithm>
+#include <cctype>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 template <typename T>
 inline double GetSrcVal(const void *pSource, GDALDataType eSrcType, T ii)
@@ -1630,6 +1638,649 @@ static CPLErr MaxPixelFunc(void **papoSources, int nSources, void *pData,
                                          nPixelSpace, nLineSpace, papszArgs);
 }
 
+/************************************************************************/
+/*                         Expression evaluation                        */
+/************************************************************************/
+
+namespace
+{
+
+// Number of pixels processed at once by each instruction of a compiled
+// expression. Small enough so that the working set stays in cache, large
+// enough for the per-instruction loops to be vectorized by the compiler.
+constexpr int EXPR_CHUNK_SIZE = 256;
+
+// Maximum nesting level of parenthesis / operators, to avoid stack overflows
+constexpr int EXPR_MAX_DEPTH = 100;
+
+enum class ExprOp
+{
+    Neg,
+    Not,
+    Abs,
+    Sqrt,
+    Exp,
+    Log,
+    Log10,
+    Sin,
+    Cos,
+    Tan,
+    Asin,
+    Acos,
+    Atan,
+    Floor,
+    Ceil,
+    Round,
+    IsNaN,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Mod,
+    Pow,
+    Atan2,
+    Min,
+    Max,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    Eq,
+    Ne,
+    And,
+    Or,
+    Cond,
+};
+
+/** Evaluates an instruction on nCount values.
+ *
+ * Unary operators only use padfA, binary ones padfA and padfB, and the
+ * conditional operator padfA ? padfB : padfC.
+ */
+void EvalExprOp(ExprOp eOp, double *CPL_RESTRICT padfDst,
+                const double *CPL_RESTRICT padfA,
+                const double *CPL_RESTRICT padfB,
+                const double *CPL_RESTRICT padfC, int nCount)
+{
+#define EXPR_LOOP(expr)                                                        \
+    for (int i = 0; i < nCount; ++i)                                           \
+        padfDst[i] = (expr);                                                   \
+    break
+
+    switch (eOp)
+    {
+        case ExprOp::Neg:
+            EXPR_LOOP(-padfA[i]);
+        case ExprOp::Not:
+            EXPR_LOOP(padfA[i] == 0 ? 1.0 : 0.0);
+        case ExprOp::Abs:
+            EXPR_LOOP(std::fabs(padfA[i]));
+        case ExprOp::Sqrt:
+            EXPR_LOOP(std::sqrt(padfA[i]));
+        case ExprOp::Exp:
+            EXPR_LOOP(std::exp(padfA[i]));
+        case ExprOp::Log:
+            EXPR_LOOP(std::log(padfA[i]));
+        case ExprOp::Log10:
+            EXPR_LOOP(std::log10(padfA[i]));
+        case ExprOp::Sin:
+            EXPR_LOOP(std::sin(padfA[i]));
+        case ExprOp::Cos:
+            EXPR_LOOP(std::cos(padfA[i]));
+        case ExprOp::Tan:
+            EXPR_LOOP(std::tan(padfA[i]));
+        case ExprOp::Asin:
+            EXPR_LOOP(std::asin(padfA[i]));
+        case ExprOp::Acos:
+            EXPR_LOOP(std::acos(padfA[i]));
+        case ExprOp::Atan:
+            EXPR_LOOP(std::atan(padfA[i]));
+        case ExprOp::Floor:
+            EXPR_LOOP(std::floor(padfA[i]));
+        case ExprOp::Ceil:
+            EXPR_LOOP(std::ceil(padfA[i]));
+        case ExprOp::Round:
+            EXPR_LOOP(std::round(padfA[i]));
+        case ExprOp::IsNaN:
+            EXPR_LOOP(std::isnan(padfA[i]) ? 1.0 : 0.0);
+        case ExprOp::Add:
+            EXPR_LOOP(padfA[i] + padfB[i]);
+        case ExprOp::Sub:
+            EXPR_LOOP(padfA[i] - padfB[i]);
+        case ExprOp::Mul:
+            EXPR_LOOP(padfA[i] * padfB[i]);
+        case ExprOp::Div:
+            EXPR_LOOP(padfA[i] / padfB[i]);
+        case ExprOp::Mod:
+            EXPR_LOOP(std::fmod(padfA[i], padfB[i]));
+        case ExprOp::Pow:
+            EXPR_LOOP(std::pow(padfA[i], padfB[i]));
+        case ExprOp::Atan2:
+            EXPR_LOOP(std::atan2(padfA[i], padfB[i]));
+        case ExprOp::Min:
+            EXPR_LOOP(std::fmin(padfA[i], padfB[i]));
+        case ExprOp::Max:
+            EXPR_LOOP(std::fmax(padfA[i], padfB[i]));
+        case ExprOp::Lt:
+            EXPR_LOOP(padfA[i] < padfB[i] ? 1.0 : 0.0);
+        case ExprOp::Le:
+            EXPR_LOOP(padfA[i] <= padfB[i] ? 1.0 : 0.0);
+        case ExprOp::Gt:
+            EXPR_LOOP(padfA[i] > padfB[i] ? 1.0 : 0.0);
+        case ExprOp::Ge:
+            EXPR_LOOP(padfA[i] >= padfB[i] ? 1.0 : 0.0);
+        case ExprOp::Eq:
+            EXPR_LOOP(padfA[i] == padfB[i] ? 1.0 : 0.0);
+        case ExprOp::Ne:
+            EXPR_LOOP(padfA[i] != padfB[i] ? 1.0 : 0.0);
+        case ExprOp::And:
+            EXPR_LOOP((padfA[i] != 0) & (padfB[i] != 0) ? 1.0 : 0.0);
+        case ExprOp::Or:
+            EXPR_LOOP((padfA[i] != 0) | (padfB[i] != 0) ? 1.0 : 0.0);
+        case ExprOp::Cond:
+            EXPR_LOOP(padfA[i] != 0 ? padfB[i] : padfC[i]);
+    }
+#undef EXPR_LOOP
+}
+
+/** Compiled form of an expression.
+ *
+ * Each node of the expression is assigned a register, holding
+ * EXPR_CHUNK_SIZE values. Registers are either sources (B1, B2, ...),
+ * the NoData value, constants, or the result of an instruction.
+ * Instructions are stored in evaluation order and each of them writes to
+ * its own register.
+ */
+struct ExprProgram
+{
+    enum class RegType
+    {
+        Source,
+        NoData,
+        Constant,
+        Temporary,
+    };
+
+    struct Register
+    {
+        RegType eType = RegType::Temporary;
+        int nSourceIdx = 0;  // for RegType::Source (0-based)
+        double dfValue = 0;  // for RegType::Constant
+    };
+
+    struct Instruction
+    {
+        ExprOp eOp = ExprOp::Neg;
+        int nDst = 0;
+        int nA = 0;
+        int nB = 0;
+        int nC = 0;
+    };
+
+    std::vector<Register> aoRegisters{};
+    std::vector<Instruction> aoInstructions{};
+    int nResult = 0;
+    int nMaxSourceIdx = -1;
+    bool bUsesNoData = false;
+};
+
+/** Recursive descent parser turning an expression into an ExprProgram */
+class ExprCompiler
+{
+    const char *const m_pszExpr;
+    const char *m_pszCur;
+    int m_nDepth = 0;
+    ExprProgram &m_oProgram;
+
+    void SkipSpaces()
+    {
+        while (isspace(static_cast<unsigned char>(*m_pszCur)))
+            ++m_pszCur;
+    }
+
+    bool Accept(const char *pszToken)
+    {
+        SkipSpaces();
+        const size_t nLen = strlen(pszToken);
+        if (strncmp(m_pszCur, pszToken, nLen) != 0)
+            return false;
+        m_pszCur += nLen;
+        return true;
+    }
+
+    int Error(const char *pszMsg)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "expression: %s at position %d of '%s'", pszMsg,
+                 static_cast<int>(m_pszCur - m_pszExpr), m_pszExpr);
+        return -1;
+    }
+
+    int NewRegister(ExprProgram::RegType eType, int nSourceIdx = 0,
+                    double dfValue = 0)
+    {
+        ExprProgram::Register oReg;
+        oReg.eType = eType;
+        oReg.nSourceIdx = nSourceIdx;
+        oReg.dfValue = dfValue;
+        m_oProgram.aoRegisters.push_back(oReg);
+        return static_cast<int>(m_oProgram.aoRegisters.size()) - 1;
+    }
+
+    bool IsConstant(int nReg) const
+    {
+        return m_oProgram.aoRegisters[nReg].eType ==
+               ExprProgram::RegType::Constant;
+    }
+
+    int Emit(ExprOp eOp, int nA, int nB = -1, int nC = -1)
+    {
+        if (nA < 0 || (nB < 0 && eOp >= ExprOp::Add) ||
+            (nC < 0 && eOp == ExprOp::Cond))
+            return -1;
+
+        // Fold operations on constants
+        if (IsConstant(nA) && (nB < 0 || IsConstant(nB)) &&
+            (nC < 0 || IsConstant(nC)))
+        {
+            const auto &aoRegs = m_oProgram.aoRegisters;
+            const double dfA = aoRegs[nA].dfValue;
+            const double dfB = nB >= 0 ? aoRegs[nB].dfValue : 0;
+            const double dfC = nC >= 0 ? aoRegs[nC].dfValue : 0;
+            double dfRes = 0;
+            EvalExprOp(eOp, &dfRes, &dfA, &dfB, &dfC, 1);
+            return NewRegister(ExprProgram::RegType::Constant, 0, dfRes);
+        }
+
+        ExprProgram::Instruction oInstr;
+        oInstr.eOp = eOp;
+        oInstr.nDst = NewRegister(ExprProgram::RegType::Temporary);
+        oInstr.nA = nA;
+        oInstr.nB = nB < 0 ? nA : nB;
+        oInstr.nC = nC < 0 ? nA : nC;
+        m_oProgram.aoInstructions.push_back(oInstr);
+        return oInstr.nDst;
+    }
+
+    // expr := or_expr [ '?' expr ':' expr ]
+    int ParseExpr()
+    {
+        if (++m_nDepth > EXPR_MAX_DEPTH)
+            return Error("too many nested levels");
+        int nRet = ParseBinary(0);
+        if (nRet >= 0 && Accept("?"))
+        {
+            const int nIfTrue = ParseExpr();
+            if (nIfTrue < 0)
+                return -1;
+            if (!Accept(":"))
+                return Error("':' expected");
+            const int nIfFalse = ParseExpr();
+            nRet = Emit(ExprOp::Cond, nRet, nIfTrue, nIfFalse);
+        }
+        --m_nDepth;
+        return nRet;
+    }
+
+    // Left-associative binary operators, from lowest to highest precedence
+    int ParseBinary(int nLevel)
+    {
+        struct BinaryOp
+        {
+            const char *pszToken;
+            ExprOp eOp;
+        };
+
+        static const std::vector<std::vector<BinaryOp>> aaoLevels = {
+            {{"||", ExprOp::Or}},
+            {{"&&", ExprOp::And}},
+            {{"==", ExprOp::Eq}, {"!=", ExprOp::Ne}},
+            {{"<=", ExprOp::Le},
+             {">=", ExprOp::Ge},
+             {"<", ExprOp::Lt},
+             {">", ExprOp::Gt}},
+            {{"+", ExprOp::Add}, {"-", ExprOp::Sub}},
+            {{"*", ExprOp::Mul}, {"/", ExprOp::Div}, {"%", ExprOp::Mod}},
+        };
+
+        if (nLevel == static_cast<int>(aaoLevels.size()))
+            return ParseUnary();
+
+        int nRet = ParseBinary(nLevel + 1);
+        while (nRet >= 0)
+        {
+            const BinaryOp *poOp = nullptr;
+            for (const auto &oOp : aaoLevels[nLevel])
+            {
+                if (Accept(oOp.pszToken))
+                {
+                    poOp = &oOp;
+                    break;
+                }
+            }
+            if (!poOp)
+                break;
+            nRet = Emit(poOp->eOp, nRet, ParseBinary(nLevel + 1));
+        }
+        return nRet;
+    }
+
+    // unary := ( '-' | '+' | '!' ) unary | power
+    int ParseUnary()
+    {
+        if (++m_nDepth > EXPR_MAX_DEPTH)
+            return Error("too many nested levels");
+        int nRet;
+        if (Accept("-"))
+            nRet = Emit(ExprOp::Neg, ParseUnary());
+        else if (Accept("+"))
+            nRet = ParseUnary();
+        else if (Accept("!"))
+            nRet = Emit(ExprOp::Not, ParseUnary());
+        else
+        {
+            // power := primary [ '^' unary ], right-associative
+            nRet = ParsePrimary();
+            if (nRet >= 0 && Accept("^"))
+                nRet = Emit(ExprOp::Pow, nRet, ParseUnary());
+        }
+        --m_nDepth;
+        return nRet;
+    }
+
+    int ParseFunctionCall(const std::string &osName)
+    {
+        struct Function
+        {
+            const char *pszName;
+            ExprOp eOp;
+            int nArgs;  // -1 for variadic functions taking at least 2 args
+        };
+
+        static const Function asFunctions[] = {
+            {"abs", ExprOp::Abs, 1},     {"sqrt", ExprOp::Sqrt, 1},
+            {"exp", ExprOp::Exp, 1},     {"log", ExprOp::Log, 1},
+            {"log10", ExprOp::Log10, 1}, {"sin", ExprOp::Sin, 1},
+            {"cos", ExprOp::Cos, 1},     {"tan", ExprOp::Tan, 1},
+            {"asin", ExprOp::Asin, 1},   {"acos", ExprOp::Acos, 1},
+            {"atan", ExprOp::Atan, 1},   {"floor", ExprOp::Floor, 1},
+            {"ceil", ExprOp::Ceil, 1},   {"round", ExprOp::Round, 1},
+            {"isnan", ExprOp::IsNaN, 1}, {"atan2", ExprOp::Atan2, 2},
+            {"pow", ExprOp::Pow, 2},     {"fmod", ExprOp::Mod, 2},
+            {"min", ExprOp::Min, -1},    {"max", ExprOp::Max, -1},
+        };
+
+        const Function *psFunc = nullptr;
+        for (const auto &sFunc : asFunctions)
+        {
+            if (osName == sFunc.pszName)
+            {
+                psFunc = &sFunc;
+                break;
+            }
+        }
+        if (!psFunc)
+            return Error(("unknown function '" + osName + "'").c_str());
+
+        std::vector<int> anArgs;
+        if (!Accept(")"))
+        {
+            do
+            {
+                const int nArg = ParseExpr();
+                if (nArg < 0)
+                    return -1;
+                anArgs.push_back(nArg);
+            } while (Accept(","));
+            if (!Accept(")"))
+                return Error("')' expected");
+        }
+
+        const int nArgCount = static_cast<int>(anArgs.size());
+        if (psFunc->nArgs < 0 ? nArgCount < 2 : nArgCount != psFunc->nArgs)
+            return Error(("wrong number of arguments for function '" + osName +
+                          "'")
+                             .c_str());
+
+        int nRet = Emit(psFunc->eOp, anArgs[0], nArgCount > 1 ? anArgs[1] : -1);
+        for (int i = 2; i < nArgCount; ++i)
+            nRet = Emit(psFunc->eOp, nRet, anArgs[i]);
+        return nRet;
+    }
+
+    // primary := number | variable | function '(' args ')' | '(' expr ')'
+    int ParsePrimary()
+    {
+        SkipSpaces();
+        const char chFirst = *m_pszCur;
+        if (isdigit(static_cast<unsigned char>(chFirst)) || chFirst == '.')
+        {
+            char *pszEnd = nullptr;
+            const double dfValue = CPLStrtod(m_pszCur, &pszEnd);
+            if (pszEnd == m_pszCur)
+                return Error("invalid number");
+            m_pszCur = pszEnd;
+            return NewRegister(ExprProgram::RegType::Constant, 0, dfValue);
+        }
+
+        if (isalpha(static_cast<unsigned char>(chFirst)) || chFirst == '_')
+        {
+            const char *pszStart = m_pszCur;
+            while (isalnum(static_cast<unsigned char>(*m_pszCur)) ||
+                   *m_pszCur == '_')
+                ++m_pszCur;
+            const std::string osName(pszStart, m_pszCur - pszStart);
+
+            if (Accept("("))
+                return ParseFunctionCall(osName);
+
+            if (osName == "pi")
+                return NewRegister(ExprProgram::RegType::Constant, 0, M_PI);
+
+            if (osName == "NoData")
+            {
+                m_oProgram.bUsesNoData = true;
+                return GetVariableRegister(ExprProgram::RegType::NoData, 0);
+            }
+
+            if (osName.size() >= 2 && osName[0] == 'B' &&
+                osName.find_first_not_of("0123456789", 1) == std::string::npos)
+            {
+                const int nBand = atoi(osName.c_str() + 1);
+                if (nBand >= 1 && osName.size() <= 6)
+                {
+                    m_oProgram.nMaxSourceIdx =
+                        std::max(m_oProgram.nMaxSourceIdx, nBand - 1);
+                    return GetVariableRegister(ExprProgram::RegType::Source,
+                                               nBand - 1);
+                }
+            }
+
+            m_pszCur = pszStart;
+            return Error(("unknown variable '" + osName + "'").c_str());
+        }
+
+        if (Accept("("))
+        {
+            const int nRet = ParseExpr();
+            if (nRet < 0)
+                return -1;
+            if (!Accept(")"))
+                return Error("')' expected");
+            return nRet;
+        }
+
+        return Error(chFirst == 0 ? "unexpected end of expression"
+                                  : "unexpected character");
+    }
+
+    int GetVariableRegister(ExprProgram::RegType eType, int nSourceIdx)
+    {
+        const auto &aoRegs = m_oProgram.aoRegisters;
+        for (int i = 0; i < static_cast<int>(aoRegs.size()); ++i)
+        {
+            if (aoRegs[i].eType == eType && aoRegs[i].nSourceIdx == nSourceIdx)
+                return i;
+        }
+        return NewRegister(eType, nSourceIdx);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(ExprCompiler)
+
+  public:
+    ExprCompiler(const char *pszExpr, ExprProgram &oProgram)
+        : m_pszExpr(pszExpr), m_pszCur(pszExpr), m_oProgram(oProgram)
+    {
+    }
+
+    bool Compile()
+    {
+        const int nRes = ParseExpr();
+        if (nRes < 0)
+            return false;
+        SkipSpaces();
+        if (*m_pszCur != 0)
+        {
+            Error("unexpected character");
+            return false;
+        }
+        m_oProgram.nResult = nRes;
+        return true;
+    }
+};
+
+/** Returns the compiled form of an expression, from a cache of recently
+ * used expressions, so that expressions are only parsed once and not for
+ * each block.
+ */
+std::shared_ptr<const ExprProgram> GetExprProgram(const char *pszExpr)
+{
+    static std::mutex oMutex;
+    static std::map<std::string, std::shared_ptr<const ExprProgram>> oCache;
+    constexpr size_t MAX_CACHE_SIZE = 64;
+
+    std::lock_guard<std::mutex> oLock(oMutex);
+    const auto oIter = oCache.find(pszExpr);
+    if (oIter != oCache.end())
+        return oIter->second;
+
+    auto poProgram = std::make_shared<ExprProgram>();
+    if (!ExprCompiler(pszExpr, *poProgram).Compile())
+        return nullptr;
+    if (oCache.size() == MAX_CACHE_SIZE)
+        oCache.clear();
+    oCache[pszExpr] = poProgram;
+    return poProgram;
+}
+
+}  // namespace
+
+static const char pszExprPixelFuncMetadata[] =
+    "<PixelFunctionArgumentsList>"
+    "   <Argument name='expression' description='Expression to evaluate' "
+    "type='string' />"
+    "   <Argument type='builtin' value='NoData' optional='true' />"
+    "</PixelFunctionArgumentsList>";
+
+static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
+                            int nXSize, int nYSize, GDALDataType eSrcType,
+                            GDALDataType eBufType, int nPixelSpace,
+                            int nLineSpace, CSLConstList papszArgs)
+{
+    /* ---- Init ---- */
+    if (GDALDataTypeIsComplex(eSrcType))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "expression cannot be applied to complex data types");
+        return CE_Failure;
+    }
+
+    const char *pszExpr = CSLFetchNameValue(papszArgs, "expression");
+    if (pszExpr == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Missing pixel function argument: expression");
+        return CE_Failure;
+    }
+
+    const auto poProgram = GetExprProgram(pszExpr);
+    if (!poProgram)
+        return CE_Failure;
+
+    if (poProgram->nMaxSourceIdx >= nSources)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "expression: B%d is referenced, but there are only %d "
+                 "source(s)",
+                 poProgram->nMaxSourceIdx + 1, nSources);
+        return CE_Failure;
+    }
+
+    double dfNoData = 0;
+    if (poProgram->bUsesNoData &&
+        FetchDoubleArg(papszArgs, "NoData", &dfNoData) != CE_None)
+        return CE_Failure;
+
+    const auto &aoRegs = poProgram->aoRegisters;
+    std::vector<double> adfRegs(aoRegs.size() * EXPR_CHUNK_SIZE);
+    std::vector<std::pair<int, int>> anSourceRegs;  // (register, source)
+    for (int iReg = 0; iReg < static_cast<int>(aoRegs.size()); ++iReg)
+    {
+        const auto &oReg = aoRegs[iReg];
+        double *padfReg = adfRegs.data() + iReg * EXPR_CHUNK_SIZE;
+        if (oReg.eType == ExprProgram::RegType::Source)
+            anSourceRegs.emplace_back(iReg, oReg.nSourceIdx);
+        else if (oReg.eType == ExprProgram::RegType::Constant)
+            std::fill_n(padfReg, EXPR_CHUNK_SIZE, oReg.dfValue);
+        else if (oReg.eType == ExprProgram::RegType::NoData)
+            std::fill_n(padfReg, EXPR_CHUNK_SIZE, dfNoData);
+    }
+    const double *padfResult =
+        adfRegs.data() + poProgram->nResult * EXPR_CHUNK_SIZE;
+
+    /* ---- Set pixels ---- */
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    size_t ii = 0;
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        for (int iCol = 0; iCol < nXSize; iCol += EXPR_CHUNK_SIZE)
+        {
+            const int nCount = std::min(EXPR_CHUNK_SIZE, nXSize - iCol);
+
+            for (const auto &oSourceReg : anSourceRegs)
+            {
+                GDALCopyWords(static_cast<const GByte *>(
+                                  papoSources[oSourceReg.second]) +
+                                  ii * nSrcTypeSize,
+                              eSrcType, nSrcTypeSize,
+                              adfRegs.data() +
+                                  oSourceReg.first * EXPR_CHUNK_SIZE,
+                              GDT_Float64, sizeof(double), nCount);
+            }
+
+            for (const auto &oInstr : poProgram->aoInstructions)
+            {
+                EvalExprOp(oInstr.eOp,
+                           adfRegs.data() + oInstr.nDst * EXPR_CHUNK_SIZE,
+                           adfRegs.data() + oInstr.nA * EXPR_CHUNK_SIZE,
+                           adfRegs.data() + oInstr.nB * EXPR_CHUNK_SIZE,
+                           adfRegs.data() + oInstr.nC * EXPR_CHUNK_SIZE,
+                           nCount);
+            }
+
+            GDALCopyWords(padfResult, GDT_Float64, sizeof(double),
+                          static_cast<GByte *>(pData) +
+                              static_cast<GSpacing>(nLineSpace) * iLine +
+                              static_cast<GSpacing>(iCol) * nPixelSpace,
+                          eBufType, nPixelSpace, nCount);
+            ii += nCount;
+        }
+    }
+
+    /* ---- Return success ---- */
+    return CE_None;
+}  // ExprPixelFunc
+
 /************************************************************************/
 /*                     GDALRegisterDefaultPixelFunc()                   */
 /************************************************************************/
@@ -1698,6 +2349,8 @@ static CPLErr MaxPixelFunc(void **papoSources, int nSources, void *pData,
  *                      exponential interpolation
  * - "scale": Apply the RasterBand metadata values of "offset" and "scale"
  * - "nan": Convert incoming NoData values to IEEE 754 nan
+ * - "expression": evaluate an arithmetic/conditional expression over the
+ *                 sources, referenced as B1, B2, ... (since GDAL 3.10)
  *
  * @see GDALAddDerivedBandPixelFunc
  *
@@ -1751,5 +2404,7 @@ CPLErr GDALRegisterDefaultPixelFunc()
                                         pszMinMaxFuncMetadataNodata);
     GDALAddDerivedBandPixelFuncWithArgs("max", MaxPixelFunc,
                                         pszMinMaxFuncMetadataNodata);
+    GDALAddDerivedBandPixelFuncWithArgs("expression", ExprPixelFunc,
+                                        pszExprPixelFuncMetadata);
     return CE_None;
 }
@@ -33,6 +33,7 @@
 #include "cpl_port.h"
 #include "gdal_priv.h"
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -57,6 +58,20 @@ CPLStringList VRTParseCategoryNames(const CPLXMLNode *psCategoryNames);
 std::unique_ptr<GDALColorTable>
 VRTParseColorTable(const CPLXMLNode *psColorTable);
 
+class VRTSource;
+class VRTSimpleSource;
+
+int VRTGetRequestedThreadCount();
+
+bool VRTCollectSourcesForParallelIO(
+    VRTSource *const *papoSources, int nSources, double dfXOff, double dfYOff,
+    double dfXSize, double dfYSize, int nBufXSize, int nBufYSize,
+    std::vector<VRTSimpleSource *> &apoContributingSources);
+
+bool VRTRunJobsInParallel(int nJobs, int nMaxThreads,
+                          const std::function<CPLErr(int)> &fnJob,
+                          CPLErr &eErr);
+
 #endif
 
 #endif  // VRT_PRIV_H_INCLUDED
@@ -28,6 +28,7 @@
  ****************************************************************************/
 
 #include "vrtdataset.h"
+#include "vrt_priv.h"
 
 #include "cpl_minixml.h"
 #include "cpl_string.h"
@@ -39,6 +40,7 @@
 #include <cmath>
 #include <set>
 #include <typeinfo>
+#include <vector>
 #include "gdal_proxy.h"
 
 /*! @cond Doxygen_Suppress */
@@ -2288,17 +2290,67 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         // they don't necessary instantiate all underlying rasterbands.
         VRTSourcedRasterBand *poBand =
             static_cast<VRTSourcedRasterBand *>(papoBands[nBands - 1]);
-        for (int iSource = 0; eErr == CE_None && iSource < poBand->nSources;
+
+        double dfXOff = nXOff;
+        double dfYOff = nYOff;
+        double dfXSize = nXSize;
+        double dfYSize = nYSize;
+        if (psExtraArg->bFloatingPointWindowValidity)
+        {
+            dfXOff = psExtraArg->dfXOff;
+            dfYOff = psExtraArg->dfYOff;
+            dfXSize = psExtraArg->dfXSize;
+            dfYSize = psExtraArg->dfYSize;
+        }
+        std::vector<VRTSource *> apoCandidateSources;
+        poBand->GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize,
+                                             apoCandidateSources);
+        const int nCandidateSources =
+            static_cast<int>(apoCandidateSources.size());
+
+        // Read sources in parallel if GDAL_NUM_THREADS allows it.
+        // Progress functions are not expected to be called from several
+        // threads.
+        const int nRequestedThreads = VRTGetRequestedThreadCount();
+        if (nRequestedThreads > 1 && nCandidateSources > 1 &&
+            (pfnProgressGlobal == nullptr ||
+             pfnProgressGlobal == GDALDummyProgress))
+        {
+            std::vector<VRTSimpleSource *> apoSources;
+            const auto ReadSource = [&](int iSource)
+            {
+                GDALRasterIOExtraArg sExtraArg = *psExtraArg;
+                sExtraArg.pfnProgress = nullptr;
+                sExtraArg.pProgressData = nullptr;
+                return apoSources[iSource]->DatasetRasterIO(
+                    poBand->GetRasterDataType(), nXOff, nYOff, nXSize, nYSize,
+                    pData, nBufXSize, nBufYSize, eBufType, nBandCount,
+                    panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+                    &sExtraArg);
+            };
+            if (VRTCollectSourcesForParallelIO(
+                    apoCandidateSources.data(), nCandidateSources, dfXOff,
+                    dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                    apoSources) &&
+                VRTRunJobsInParallel(static_cast<int>(apoSources.size()),
+                                     nRequestedThreads, ReadSource, eErr))
+            {
+                CPLDebugOnly("VRT", "IRasterIO(): read %d sources in parallel",
+                             static_cast<int>(apoSources.size()));
+                return eErr;
+            }
+        }
+        for (int iSource = 0; eErr == CE_None && iSource < nCandidateSources;
              iSource++)
         {
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / poBand->nSources,
-                1.0 * (iSource + 1) / poBand->nSources, pfnProgressGlobal,
+                1.0 * iSource / nCandidateSources,
+                1.0 * (iSource + 1) / nCandidateSources, pfnProgressGlobal,
                 pProgressDataGlobal);
 
             VRTSimpleSource *poSource =
-                static_cast<VRTSimpleSource *>(poBand->papoSources[iSource]);
+                static_cast<VRTSimpleSource *>(apoCandidateSources[iSource]);
 
             eErr = poSource->DatasetRasterIO(
                 poBand->GetRasterDataType(), nXOff, nYOff, nXSize, nYSize,
@@ -2815,7 +2867,15 @@ std::string VRTDataset::BuildSourceFilename(const char *pszFilename,
                                             bool bRelativeToVRT)
 {
     std::string osSrcDSName;
-    if (pszVRTPath != nullptr && bRelativeToVRT)
+    if (pszVRTPath != nullptr && bRelativeToVRT &&
+        strchr(pszFilename, ':') == nullptr)
+    {
+        // Fast path for the common case of a plain relative filename, as
+        // subdataset and special syntaxes all involve a colon. This avoids
+        // querying all drivers for each source of huge VRTs.
+        osSrcDSName = CPLProjectRelativeFilename(pszVRTPath, pszFilename);
+    }
+    else if (pszVRTPath != nullptr && bRelativeToVRT)
     {
         // Try subdatasetinfo API first
         // Note: this will become the only branch when subdatasetinfo will become
@@ -35,6 +35,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
@@ -655,6 +656,10 @@ class VRTProcessedDataset final : public VRTDataset
     //! Output buffer of a processing step
     std::vector<NoInitByte> m_abyOutput{};
 
+    //! Intermediate buffers used by ProcessSteps() when run sequentially
+    std::vector<NoInitByte> m_abyStepBuffer1{};
+    std::vector<NoInitByte> m_abyStepBuffer2{};
+
     CPLErr Init(const CPLXMLNode *, const char *,
                 const VRTProcessedDataset *poParentDS,
                 GDALDataset *poParentSrcDS, int iOvrLevel);
@@ -664,6 +669,11 @@ class VRTProcessedDataset final : public VRTDataset
                    std::vector<double> &adfInNoData,
                    std::vector<double> &adfOutNoData);
     bool ProcessRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize);
+    bool ProcessSteps(const GByte *pabyInput, GByte *pabyOutput, int nXOff,
+                      int nYOff, int nBufXSize, int nBufYSize,
+                      const double *padfSrcGT,
+                      std::vector<NoInitByte> &abyBuffer1,
+                      std::vector<NoInitByte> &abyBuffer2) const;
 };
 
 /************************************************************************/
@@ -825,12 +835,28 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     CPLString m_osLastLocationInfo{};
     char **m_papszSourceList = nullptr;
     int m_nSkipBufferInitialization = -1;
+    // Allocated size of papoSources, that grows geometrically
+    int m_nSourcesAllocated = 0;
+
+    // Spatial index over the destination windows of the sources, lazily
+    // built by GetSourcesIntersectingWindow() for large mosaics.
+    CPLQuadTree *m_hSourcesQuadTree = nullptr;
+    // Value of nSources when m_hSourcesQuadTree was built, or -1 if not built
+    int m_nSourcesInQuadTree = -1;
+
+    void InvalidateSourcesQuadTree();
 
     bool CanUseSourcesMinMaxImplementations();
 
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
         bool bAllowMaxValAdjustment) const;
 
+    bool IRasterIOInParallel(int nXOff, int nYOff, int nXSize, int nYSize,
+                             void *pData, int nBufXSize, int nBufYSize,
+                             GDALDataType eBufType, GSpacing nPixelSpace,
+                             GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg, CPLErr &eErr);
+
     CPL_DISALLOW_COPY_ASSIGN(VRTSourcedRasterBand)
 
   protected:
@@ -940,6 +966,10 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
 
     void RemoveCoveredSources(CSLConstList papszOptions = nullptr);
 
+    void GetSourcesIntersectingWindow(double dfXOff, double dfYOff,
+                                      double dfXSize, double dfYSize,
+                                      std::vector<VRTSource *> &apoSources);
+
     bool CanIRasterIOBeForwardedToEachSource(
         GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
         int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg) const;
@@ -1508,6 +1538,12 @@ class CPL_DLL VRTComplexSource CPL_NON_FINAL : public VRTSimpleSource
                                  GDALRasterIOExtraArg *psExtraArg,
                                  WorkingState &oWorkingState);
 
+    CPLErr RasterIOExpandColorTableByte(
+        GDALRasterBand *poSourceBand, int nReqXOff, int nReqYOff,
+        int nReqXSize, int nReqYSize, void *pData, int nOutXSize, int nOutYSize,
+        GSpacing nPixelSpace, GSpacing nLineSpace,
+        GDALRasterIOExtraArg *psExtraArg, WorkingState &oWorkingState);
+
   public:
     VRTComplexSource() = default;
     VRTComplexSource(const VRTComplexSource *poSrcSource, double dfXDstRatio,
@@ -29,6 +29,7 @@
 #include "cpl_minixml.h"
 #include "cpl_string.h"
 #include "vrtdataset.h"
+#include "vrt_priv.h"
 
 #include <algorithm>
 #include <limits>
@@ -83,6 +84,14 @@ struct VRTProcessedDatasetFunc
 
     //! Required processing function
     GDALVRTProcessedDatasetFuncProcess pfnProcess = nullptr;
+
+    //! Whether output values of a pixel only depend on the input values of
+    //! the same pixel, so that a region can be processed in several parts.
+    bool bPixelWise = false;
+
+    //! Whether pfnProcess may be called concurrently with the same working
+    //! data.
+    bool bThreadSafe = false;
 };
 
 /************************************************************************/
@@ -938,11 +947,6 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         return false;
     }
 
-    const double dfSrcXOff = nXOff;
-    const double dfSrcYOff = nYOff;
-    const double dfSrcXSize = nBufXSize;
-    const double dfSrcYSize = nBufYSize;
-
     double adfSrcGT[6];
     if (m_poSrcDS->GetGeoTransform(adfSrcGT) != CE_None)
     {
@@ -954,66 +958,206 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         adfSrcGT[5] = 1;
     }
 
-    GDALDataType eLastDT = eFirstDT;
+    // Determine if the region can be processed in several chunks of lines,
+    // and the size of the largest intermediate pixel.
+    bool bPixelWise = true;
+    bool bThreadSafe = true;
+    size_t nMaxPixelSize = static_cast<size_t>(nFirstDTSize) * nFirstBandCount;
     const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
     for (const auto &oStep : m_aoSteps)
     {
         const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
         CPLAssert(oIterFunc != oMapFunctions.end());
+        bPixelWise = bPixelWise && oIterFunc->second.bPixelWise;
+        bThreadSafe = bThreadSafe && oIterFunc->second.bThreadSafe;
+        nMaxPixelSize = std::max(
+            nMaxPixelSize, static_cast<size_t>(oStep.nInBands) *
+                               GDALGetDataTypeSizeBytes(oStep.eInDT));
+        nMaxPixelSize = std::max(
+            nMaxPixelSize, static_cast<size_t>(oStep.nOutBands) *
+                               GDALGetDataTypeSizeBytes(oStep.eOutDT));
+    }
 
-        // Data type adaptation
-        if (eLastDT != oStep.eInDT)
+    const auto &oLastStep = m_aoSteps.back();
+    const size_t nInLineSize =
+        static_cast<size_t>(nBufXSize) * nFirstBandCount * nFirstDTSize;
+    const size_t nOutLineSize = static_cast<size_t>(nBufXSize) *
+                                oLastStep.nOutBands *
+                                GDALGetDataTypeSizeBytes(oLastStep.eOutDT);
+    try
+    {
+        abyOutput.resize(nOutLineSize * nBufYSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+
+    // When all steps are pixel-wise, run all of them on chunks of lines
+    // whose intermediate buffers fit in the CPU cache, rather than
+    // materializing intermediate results for the whole region.
+    int nLinesPerChunk = nBufYSize;
+    int nThreads = 1;
+    if (bPixelWise)
+    {
+        constexpr size_t CHUNK_SIZE = 256 * 1024;
+        const size_t nMaxLineSize = nMaxPixelSize * nBufXSize;
+        nLinesPerChunk = static_cast<int>(
+            std::min(static_cast<size_t>(nBufYSize),
+                     std::max<size_t>(1, CHUNK_SIZE / nMaxLineSize)));
+        if (bThreadSafe)
         {
-            try
-            {
-                abyOutput.resize(static_cast<size_t>(nBufXSize) * nBufYSize *
-                                 oStep.nInBands *
-                                 GDALGetDataTypeSizeBytes(oStep.eInDT));
-            }
-            catch (const std::bad_alloc &)
+            nThreads = std::min(VRTGetRequestedThreadCount(), nBufYSize);
+            if (nThreads > 1)
             {
-                CPLError(CE_Failure, CPLE_OutOfMemory,
-                         "Out of memory allocating working buffer");
-                return false;
+                nLinesPerChunk = std::min(
+                    nLinesPerChunk, DIV_ROUND_UP(nBufYSize, nThreads));
             }
+        }
+    }
+    const int nChunks = DIV_ROUND_UP(nBufYSize, nLinesPerChunk);
 
-            GDALCopyWords64(abyInput.data(), eLastDT,
-                            GDALGetDataTypeSizeBytes(eLastDT), abyOutput.data(),
-                            oStep.eInDT, GDALGetDataTypeSizeBytes(oStep.eInDT),
-                            static_cast<size_t>(nBufXSize) * nBufYSize *
-                                oStep.nInBands);
+    const auto ProcessChunk = [&](int iChunk,
+                                  std::vector<NoInitByte> &abyBuffer1,
+                                  std::vector<NoInitByte> &abyBuffer2)
+    {
+        const int iLine = iChunk * nLinesPerChunk;
+        const int nLines = std::min(nLinesPerChunk, nBufYSize - iLine);
+        return ProcessSteps(
+            reinterpret_cast<const GByte *>(abyInput.data()) +
+                iLine * nInLineSize,
+            reinterpret_cast<GByte *>(abyOutput.data()) + iLine * nOutLineSize,
+            nXOff, nYOff + iLine, nBufXSize, nLines, adfSrcGT, abyBuffer1,
+            abyBuffer2);
+    };
 
-            std::swap(abyInput, abyOutput);
+    bool bRunInParallel = false;
+    if (nThreads > 1 && nChunks > 1)
+    {
+        CPLErr eErr = CE_None;
+        const auto ProcessChunkJob = [&ProcessChunk](int iChunk)
+        {
+            std::vector<NoInitByte> abyBuffer1;
+            std::vector<NoInitByte> abyBuffer2;
+            return ProcessChunk(iChunk, abyBuffer1, abyBuffer2) ? CE_None
+                                                                : CE_Failure;
+        };
+        bRunInParallel =
+            VRTRunJobsInParallel(nChunks, nThreads, ProcessChunkJob, eErr);
+        if (bRunInParallel && eErr != CE_None)
+            return false;
+    }
+    if (!bRunInParallel)
+    {
+        for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            if (!ProcessChunk(iChunk, m_abyStepBuffer1, m_abyStepBuffer2))
+                return false;
         }
+    }
+
+    std::swap(abyInput, abyOutput);
+
+    return true;
+}
+
+/************************************************************************/
+/*                            ProcessSteps()                            */
+/************************************************************************/
 
+/** Run all processing steps on the specified region.
+ *
+ * pabyInput is a pixel-interleaved buffer with the values of the input
+ * dataset for the region, and the output of the last step is written in
+ * pabyOutput, in a pixel-interleaved way. abyBuffer1 and abyBuffer2 are used
+ * to store intermediate results.
+ */
+bool VRTProcessedDataset::ProcessSteps(
+    const GByte *pabyInput, GByte *pabyOutput, int nXOff, int nYOff,
+    int nBufXSize, int nBufYSize, const double *padfSrcGT,
+    std::vector<NoInitByte> &abyBuffer1,
+    std::vector<NoInitByte> &abyBuffer2) const
+{
+    const size_t nPixels = static_cast<size_t>(nBufXSize) * nBufYSize;
+    std::vector<NoInitByte> *const apabyBuffers[] = {&abyBuffer1,
+                                                     &abyBuffer2};
+    // Index in apabyBuffers[] of the buffer holding the current values,
+    // or -1 if they are in pabyInput.
+    int iCurBuffer = -1;
+    const GByte *pabyCur = pabyInput;
+
+    // Returns a buffer of nSize bytes that does not hold the current values
+    const auto GetFreeBuffer = [&apabyBuffers, &iCurBuffer](size_t nSize,
+                                                            int &iFreeBuffer)
+    {
+        iFreeBuffer = iCurBuffer == 0 ? 1 : 0;
+        auto &abyBuffer = *(apabyBuffers[iFreeBuffer]);
         try
         {
-            abyOutput.resize(static_cast<size_t>(nBufXSize) * nBufYSize *
-                             oStep.nOutBands *
-                             GDALGetDataTypeSizeBytes(oStep.eOutDT));
+            abyBuffer.resize(nSize);
         }
         catch (const std::bad_alloc &)
         {
             CPLError(CE_Failure, CPLE_OutOfMemory,
                      "Out of memory allocating working buffer");
-            return false;
+            return static_cast<GByte *>(nullptr);
+        }
+        return reinterpret_cast<GByte *>(abyBuffer.data());
+    };
+
+    GDALDataType eLastDT = m_aoSteps.front().eInDT;
+    const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
+    for (size_t iStep = 0; iStep < m_aoSteps.size(); ++iStep)
+    {
+        const auto &oStep = m_aoSteps[iStep];
+        const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
+        CPLAssert(oIterFunc != oMapFunctions.end());
+
+        const int nInDTSize = GDALGetDataTypeSizeBytes(oStep.eInDT);
+        const size_t nInSize = nPixels * oStep.nInBands * nInDTSize;
+
+        // Data type adaptation
+        if (eLastDT != oStep.eInDT)
+        {
+            int iFreeBuffer = 0;
+            GByte *pabyConverted = GetFreeBuffer(nInSize, iFreeBuffer);
+            if (!pabyConverted)
+                return false;
+
+            GDALCopyWords64(pabyCur, eLastDT, GDALGetDataTypeSizeBytes(eLastDT),
+                            pabyConverted, oStep.eInDT, nInDTSize,
+                            nPixels * oStep.nInBands);
+
+            pabyCur = pabyConverted;
+            iCurBuffer = iFreeBuffer;
         }
 
+        const size_t nOutSize = nPixels * oStep.nOutBands *
+                                GDALGetDataTypeSizeBytes(oStep.eOutDT);
+        const bool bIsLastStep = iStep + 1 == m_aoSteps.size();
+        int iFreeBuffer = -1;
+        GByte *pabyOut = bIsLastStep ? pabyOutput
+                                     : GetFreeBuffer(nOutSize, iFreeBuffer);
+        if (!pabyOut)
+            return false;
+
         const auto &oFunc = oIterFunc->second;
         if (oFunc.pfnProcess(
                 oStep.osAlgorithm.c_str(), oFunc.pUserData, oStep.pWorkingData,
-                oStep.aosArguments.List(), nBufXSize, nBufYSize,
-                abyInput.data(), abyInput.size(), oStep.eInDT, oStep.nInBands,
-                oStep.adfInNoData.data(), abyOutput.data(), abyOutput.size(),
-                oStep.eOutDT, oStep.nOutBands, oStep.adfOutNoData.data(),
-                dfSrcXOff, dfSrcYOff, dfSrcXSize, dfSrcYSize, adfSrcGT,
-                m_osVRTPath.c_str(),
+                oStep.aosArguments.List(), nBufXSize, nBufYSize, pabyCur,
+                nInSize, oStep.eInDT, oStep.nInBands, oStep.adfInNoData.data(),
+                pabyOut, nOutSize, oStep.eOutDT, oStep.nOutBands,
+                oStep.adfOutNoData.data(), nXOff, nYOff, nBufXSize, nBufYSize,
+                padfSrcGT, m_osVRTPath.c_str(),
                 /*papszExtra=*/nullptr) != CE_None)
         {
             return false;
         }
 
-        std::swap(abyInput, abyOutput);
+        pabyCur = pabyOut;
+        iCurBuffer = iFreeBuffer;
         eLastDT = oStep.eOutDT;
     }
 
@@ -1177,7 +1321,21 @@ CPLErr VRTProcessedRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 by pfnInit. May be nullptr.
  @param pfnProcess Processing function called to compute pixel values. Must
                    not be nullptr.
- @param papszOptions Unused currently. Must be nullptr.
+ @param papszOptions Options. May be nullptr. Starting with GDAL 3.10, the
+                     following options are supported:
+                     <ul>
+                     <li>PIXEL_WISE=YES/NO: whether the output values of a
+                     pixel only depend on the input values of that same
+                     pixel (and on its location), in which case a region may
+                     be processed in several parts, each part being processed
+                     by all steps before moving to the next one.
+                     Defaults to NO.</li>
+                     <li>THREAD_SAFE=YES/NO: whether pfnProcess may be called
+                     concurrently from several threads, on different parts
+                     of a region, with the same working structure. Only
+                     taken into account if PIXEL_WISE=YES. Defaults to
+                     NO.</li>
+                     </ul>
  @return CE_None in case of success, error otherwise.
  @since 3.9
  */
@@ -1188,8 +1346,7 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     size_t nSupportedInputBandCountSize,
     GDALVRTProcessedDatasetFuncInit pfnInit,
     GDALVRTProcessedDatasetFuncFree pfnFree,
-    GDALVRTProcessedDatasetFuncProcess pfnProcess,
-    CPL_UNUSED CSLConstList papszOptions)
+    GDALVRTProcessedDatasetFuncProcess pfnProcess, CSLConstList papszOptions)
 {
     if (pszFuncName == nullptr || pszFuncName[0] == '\0')
     {
@@ -1335,6 +1492,10 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     oFunc.pfnInit = pfnInit;
     oFunc.pfnFree = pfnFree;
     oFunc.pfnProcess = pfnProcess;
+    oFunc.bPixelWise =
+        CPLFetchBool(papszOptions, "PIXEL_WISE", oFunc.bPixelWise);
+    oFunc.bThreadSafe =
+        CPLFetchBool(papszOptions, "THREAD_SAFE", oFunc.bThreadSafe);
 
     oMap[pszFuncName] = std::move(oFunc);
 
@@ -1490,6 +1490,9 @@ static CPLErr TrimmingProcess(
  */
 void GDALVRTRegisterDefaultProcessedDatasetFuncs()
 {
+    const char *const apszPixelWiseOptions[] = {"PIXEL_WISE=YES",
+                                                "THREAD_SAFE=YES", nullptr};
+
     GDALVRTRegisterProcessedDatasetFunc(
         "BandAffineCombination", nullptr,
         "<ProcessedDatasetFunctionArgumentsList>"
@@ -1511,7 +1514,8 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "   <Argument name='max' description='clamp max value' type='double'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, BandAffineCombinationInit,
-        BandAffineCombinationFree, BandAffineCombinationProcess, nullptr);
+        BandAffineCombinationFree, BandAffineCombinationProcess,
+        apszPixelWiseOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LUT", nullptr,
@@ -1526,7 +1530,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='string' required='true'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, LUTInit, LUTFree, LUTProcess,
-        nullptr);
+        apszPixelWiseOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LocalScaleOffset", nullptr,
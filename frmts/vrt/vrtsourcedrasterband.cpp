@@ -30,8 +30,10 @@
 #include "cpl_port.h"
 #include "gdal_vrt.h"
 #include "vrtdataset.h"
+#include "vrt_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -42,9 +44,11 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
 #include "cpl_progress.h"
@@ -130,6 +134,7 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
 {
     VRTSourcedRasterBand::CloseDependentDatasets();
     CSLDestroy(m_papszSourceList);
+    InvalidateSourcesQuadTree();
 }
 
 /************************************************************************/
@@ -239,6 +244,411 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
     return true;
 }
 
+/************************************************************************/
+/*                     VRTGetRequestedThreadCount()                     */
+/************************************************************************/
+
+/** Returns the number of threads requested with GDAL_NUM_THREADS */
+int VRTGetRequestedThreadCount()
+{
+    const char *pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    // Upper bound to please Coverity
+    return std::max(1, std::min(1024, nThreads));
+}
+
+/************************************************************************/
+/*                       AreDatasetsDistinct()                          */
+/************************************************************************/
+
+/* Returns true if all datasets are different, so that they can be accessed
+ * concurrently from different threads.
+ * If the datasets belong to the MEM driver, check GDALDataset* pointer
+ * values. Otherwise use dataset name.
+ */
+static bool AreDatasetsDistinct(const std::vector<GDALDataset *> &apoDatasets)
+{
+    std::set<std::string> oSetDatasetNames;
+    std::set<GDALDataset *> oSetDatasetPointers;
+    for (GDALDataset *poDS : apoDatasets)
+    {
+        if (poDS == nullptr)
+            return false;
+        auto poDriver = poDS->GetDriver();
+        if (poDriver && EQUAL(poDriver->GetDescription(), "MEM"))
+        {
+            if (!oSetDatasetPointers.insert(poDS).second)
+                return false;
+        }
+        else
+        {
+            if (!oSetDatasetNames.insert(poDS->GetDescription()).second)
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   VRTCollectSourcesForParallelIO()                   */
+/************************************************************************/
+
+/** Collects the sources contributing to a RasterIO() request, and returns
+ * true if they can be read in parallel.
+ *
+ * That is the case when there are at least 2 contributing sources, which
+ * are all simple or complex sources, that write to disjoint regions of the
+ * output buffer, so that the compositing order does not matter, and that
+ * refer to different datasets.
+ */
+bool VRTCollectSourcesForParallelIO(
+    VRTSource *const *papoSources, int nSources, double dfXOff, double dfYOff,
+    double dfXSize, double dfYSize, int nBufXSize, int nBufYSize,
+    std::vector<VRTSimpleSource *> &apoContributingSources)
+{
+    struct Window
+    {
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+    };
+
+    std::vector<Window> aoWindows;
+    std::vector<GDALDataset *> apoDatasets;
+    apoContributingSources.clear();
+    for (int i = 0; i < nSources; ++i)
+    {
+        if (!papoSources[i]->IsSimpleSource())
+            return false;
+        auto poSimpleSource = cpl::down_cast<VRTSimpleSource *>(papoSources[i]);
+        if (!EQUAL(poSimpleSource->GetType(), "SimpleSource") &&
+            !EQUAL(poSimpleSource->GetType(), "ComplexSource"))
+        {
+            return false;
+        }
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        Window oWindow;
+        bool bError = false;
+        if (!poSimpleSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+                &nReqYOff, &nReqXSize, &nReqYSize, &oWindow.nXOff,
+                &oWindow.nYOff, &oWindow.nXSize, &oWindow.nYSize, bError))
+        {
+            if (bError)
+                return false;
+            continue;
+        }
+
+        auto poSourceBand = poSimpleSource->GetRasterBand();
+        if (poSourceBand == nullptr)
+            return false;
+        apoContributingSources.push_back(poSimpleSource);
+        aoWindows.push_back(oWindow);
+        apoDatasets.push_back(poSourceBand->GetDataset());
+    }
+
+    if (apoContributingSources.size() < 2)
+        return false;
+
+    // Check that output windows do not overlap
+    std::sort(aoWindows.begin(), aoWindows.end(),
+              [](const Window &a, const Window &b)
+              { return a.nYOff < b.nYOff; });
+    for (size_t i = 0; i < aoWindows.size(); ++i)
+    {
+        const auto &a = aoWindows[i];
+        for (size_t j = i + 1;
+             j < aoWindows.size() && aoWindows[j].nYOff < a.nYOff + a.nYSize;
+             ++j)
+        {
+            const auto &b = aoWindows[j];
+            if (b.nXOff < a.nXOff + a.nXSize && a.nXOff < b.nXOff + b.nXSize)
+                return false;
+        }
+    }
+
+    return AreDatasetsDistinct(apoDatasets);
+}
+
+/************************************************************************/
+/*                        VRTRunJobsInParallel()                        */
+/************************************************************************/
+
+/** Runs fnJob(0), ..., fnJob(nJobs - 1) with the global thread pool, using
+ * at most nMaxThreads threads.
+ *
+ * Errors emitted by jobs are re-emitted in the calling thread, in job order,
+ * once all jobs are completed. Remaining jobs are skipped once one of them
+ * has failed.
+ *
+ * @return false if no thread could be allocated, in which case no job has
+ * been run, otherwise true and eErr is set to CE_Failure if a job failed.
+ */
+bool VRTRunJobsInParallel(int nJobs, int nMaxThreads,
+                          const std::function<CPLErr(int)> &fnJob,
+                          CPLErr &eErr)
+{
+    GDALThreadReservation oThreadReservation(std::min(nJobs, nMaxThreads));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        return false;
+    auto poQueue = poThreadPool->CreateJobQueue();
+
+    struct Job
+    {
+        const std::function<CPLErr(int)> *pfnJob = nullptr;
+        std::atomic<bool> *pbFailure = nullptr;
+        int iJob = 0;
+        CPLErr eErr = CE_None;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    const auto JobRunner = [](void *pData)
+    {
+        auto psJob = static_cast<Job *>(pData);
+        if (*(psJob->pbFailure))
+            return;
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        CPLSetCurrentErrorHandlerCatchDebug(FALSE);
+        psJob->eErr = (*(psJob->pfnJob))(psJob->iJob);
+        CPLUninstallErrorHandlerAccumulator();
+        if (psJob->eErr == CE_Failure)
+            *(psJob->pbFailure) = true;
+    };
+
+    std::atomic<bool> bFailure{false};
+    std::vector<Job> asJobs(nJobs);
+    for (int i = 0; i < nJobs; ++i)
+    {
+        asJobs[i].pfnJob = &fnJob;
+        asJobs[i].pbFailure = &bFailure;
+        asJobs[i].iJob = i;
+        if (!poQueue->SubmitJob(JobRunner, &asJobs[i]))
+            JobRunner(&asJobs[i]);
+    }
+    poQueue->WaitCompletion();
+
+    eErr = CE_None;
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        if (sJob.eErr == CE_Failure)
+            eErr = CE_Failure;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      InvalidateSourcesQuadTree()                     */
+/************************************************************************/
+
+void VRTSourcedRasterBand::InvalidateSourcesQuadTree()
+{
+    if (m_hSourcesQuadTree)
+    {
+        CPLQuadTreeDestroy(m_hSourcesQuadTree);
+        m_hSourcesQuadTree = nullptr;
+    }
+    m_nSourcesInQuadTree = -1;
+}
+
+/************************************************************************/
+/*                    GetSourcesIntersectingWindow()                    */
+/************************************************************************/
+
+// Below that number of sources, testing each source is cheap enough
+constexpr int VRT_MIN_SOURCES_FOR_QUAD_TREE = 64;
+
+/* Returns, in their declaration order, the sources that may intersect the
+ * passed window, expressed in the pixel space of the band.
+ * For mosaics made of many simple sources, a quad tree of their destination
+ * windows is built on first use, so that small requests do not need to test
+ * every source. The returned list may contain sources that do not actually
+ * intersect the window, so callers must still handle that case.
+ */
+void VRTSourcedRasterBand::GetSourcesIntersectingWindow(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<VRTSource *> &apoSources)
+{
+    apoSources.clear();
+    if (nSources < VRT_MIN_SOURCES_FOR_QUAD_TREE)
+    {
+        apoSources.insert(apoSources.end(), papoSources,
+                          papoSources + nSources);
+        return;
+    }
+
+    if (m_nSourcesInQuadTree != nSources)
+    {
+        InvalidateSourcesQuadTree();
+        m_nSourcesInQuadTree = nSources;
+
+        bool bOK = true;
+        for (int i = 0; i < nSources; ++i)
+        {
+            if (!papoSources[i]->IsSimpleSource())
+            {
+                bOK = false;
+                break;
+            }
+        }
+        if (bOK)
+        {
+            CPLRectObj sGlobalBounds;
+            sGlobalBounds.minx = 0;
+            sGlobalBounds.miny = 0;
+            sGlobalBounds.maxx = nRasterXSize;
+            sGlobalBounds.maxy = nRasterYSize;
+            m_hSourcesQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+            for (int i = 0; i < nSources; ++i)
+            {
+                auto poSS = cpl::down_cast<VRTSimpleSource *>(papoSources[i]);
+                CPLRectObj rect;
+                if (poSS->m_dfDstXSize == -1 || poSS->m_dfDstYSize == -1)
+                {
+                    // Unspecified destination window: assume the source
+                    // may cover the whole band
+                    rect = sGlobalBounds;
+                }
+                else
+                {
+                    rect.minx = std::max(0.0, poSS->m_dfDstXOff);
+                    rect.miny = std::max(0.0, poSS->m_dfDstYOff);
+                    rect.maxx =
+                        std::min(double(nRasterXSize),
+                                 poSS->m_dfDstXOff + poSS->m_dfDstXSize);
+                    rect.maxy =
+                        std::min(double(nRasterYSize),
+                                 poSS->m_dfDstYOff + poSS->m_dfDstYSize);
+                    // Source entirely outside of the band (or invalid
+                    // window)
+                    if (!(rect.minx <= rect.maxx && rect.miny <= rect.maxy))
+                        continue;
+                }
+                void *hFeature =
+                    reinterpret_cast<void *>(static_cast<uintptr_t>(i));
+                CPLQuadTreeInsertWithBounds(m_hSourcesQuadTree, hFeature,
+                                            &rect);
+            }
+        }
+    }
+
+    if (!m_hSourcesQuadTree)
+    {
+        apoSources.insert(apoSources.end(), papoSources,
+                          papoSources + nSources);
+        return;
+    }
+
+    CPLRectObj sAOI;
+    sAOI.minx = dfXOff;
+    sAOI.miny = dfYOff;
+    sAOI.maxx = dfXOff + dfXSize;
+    sAOI.maxy = dfYOff + dfYSize;
+    int nFeatureCount = 0;
+    void **pahFeatures =
+        CPLQuadTreeSearch(m_hSourcesQuadTree, &sAOI, &nFeatureCount);
+    std::vector<int> anIndices;
+    anIndices.reserve(nFeatureCount);
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anIndices.push_back(static_cast<int>(
+            reinterpret_cast<uintptr_t>(pahFeatures[i])));
+    }
+    CPLFree(pahFeatures);
+
+    // Sources must be composited in their declaration order
+    std::sort(anIndices.begin(), anIndices.end());
+    apoSources.reserve(anIndices.size());
+    for (int i : anIndices)
+        apoSources.push_back(papoSources[i]);
+}
+
+/************************************************************************/
+/*                        IRasterIOInParallel()                         */
+/************************************************************************/
+
+/* Reads the sources contributing to a RasterIO() request in parallel, when
+ * GDAL_NUM_THREADS is set and VRTCollectSourcesForParallelIO() allows it.
+ * Returns false if the request must be processed sequentially.
+ */
+bool VRTSourcedRasterBand::IRasterIOInParallel(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg, CPLErr &eErr)
+{
+    // Progress functions are not expected to be called from several threads
+    if (nSources < 2 ||
+        (psExtraArg->pfnProgress != nullptr &&
+         psExtraArg->pfnProgress != GDALDummyProgress))
+    {
+        return false;
+    }
+    const int nRequestedThreads = VRTGetRequestedThreadCount();
+    if (nRequestedThreads <= 1)
+        return false;
+
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+
+    std::vector<VRTSource *> apoCandidateSources;
+    GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize,
+                                 apoCandidateSources);
+    std::vector<VRTSimpleSource *> apoSources;
+    if (!VRTCollectSourcesForParallelIO(
+            apoCandidateSources.data(),
+            static_cast<int>(apoCandidateSources.size()), dfXOff, dfYOff,
+            dfXSize, dfYSize, nBufXSize, nBufYSize, apoSources))
+    {
+        return false;
+    }
+
+    const auto ReadSource = [&](int iSource)
+    {
+        GDALRasterIOExtraArg sExtraArg = *psExtraArg;
+        sExtraArg.pfnProgress = nullptr;
+        sExtraArg.pProgressData = nullptr;
+        VRTSource::WorkingState oWorkingState;
+        return apoSources[iSource]->RasterIO(
+            eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+            nBufYSize, eBufType, nPixelSpace, nLineSpace, &sExtraArg,
+            oWorkingState);
+    };
+
+    if (!VRTRunJobsInParallel(static_cast<int>(apoSources.size()),
+                              nRequestedThreads, ReadSource, eErr))
+    {
+        return false;
+    }
+    CPLDebugOnly("VRT", "IRasterIO(): read %d sources in parallel",
+                 static_cast<int>(apoSources.size()));
+    return true;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -351,24 +761,49 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         }
     }
 
+    CPLErr eErr = CE_None;
+    if (IRasterIOInParallel(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                            nBufYSize, eBufType, nPixelSpace, nLineSpace,
+                            psExtraArg, eErr))
+    {
+        return eErr;
+    }
+
     GDALProgressFunc const pfnProgressGlobal = psExtraArg->pfnProgress;
     void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+    std::vector<VRTSource *> apoSources;
+    GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize,
+                                 apoSources);
+    const int nSourcesToRead = static_cast<int>(apoSources.size());
+
     /* -------------------------------------------------------------------- */
     /*      Overlay each source in turn over top this.                      */
     /* -------------------------------------------------------------------- */
-    CPLErr eErr = CE_None;
     VRTSource::WorkingState oWorkingState;
-    for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
+    for (int iSource = 0; eErr == CE_None && iSource < nSourcesToRead;
+         iSource++)
     {
         psExtraArg->pfnProgress = GDALScaledProgress;
         psExtraArg->pProgressData = GDALCreateScaledProgress(
-            1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
-            pfnProgressGlobal, pProgressDataGlobal);
+            1.0 * iSource / nSourcesToRead,
+            1.0 * (iSource + 1) / nSourcesToRead, pfnProgressGlobal,
+            pProgressDataGlobal);
         if (psExtraArg->pProgressData == nullptr)
             psExtraArg->pfnProgress = nullptr;
 
-        eErr = papoSources[iSource]->RasterIO(
+        eErr = apoSources[iSource]->RasterIO(
             eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
             nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg,
             l_poDS ? l_poDS->m_oWorkingState : oWorkingState);
@@ -416,16 +851,17 @@ int VRTSourcedRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff,
     poLR->addPoint(nXOff, nYOff);
     poPolyNonCoveredBySources->addRingDirectly(poLR);
 
-    for (int iSource = 0; iSource < nSources; iSource++)
+    std::vector<VRTSource *> apoSources;
+    GetSourcesIntersectingWindow(nXOff, nYOff, nXSize, nYSize, apoSources);
+    for (VRTSource *poSource : apoSources)
     {
-        if (!papoSources[iSource]->IsSimpleSource())
+        if (!poSource->IsSimpleSource())
         {
             delete poPolyNonCoveredBySources;
             return GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED |
                    GDAL_DATA_COVERAGE_STATUS_DATA;
         }
-        VRTSimpleSource *poSS =
-            static_cast<VRTSimpleSource *>(papoSources[iSource]);
+        VRTSimpleSource *poSS = static_cast<VRTSimpleSource *>(poSource);
         // Check if the AOI is fully inside the source
         double dfDstXOff = std::max(0.0, poSS->m_dfDstXOff);
         double dfDstYOff = std::max(0.0, poSS->m_dfDstYOff);
@@ -1461,10 +1897,7 @@ CPLErr VRTSourcedRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             {
                 // Check that all sources refer to different datasets
                 // before allowing multithreaded access
-                // If the datasets belong to the MEM driver, check GDALDataset*
-                // pointer values. Otherwise use dataset name.
-                std::set<std::string> oSetDatasetNames;
-                std::set<GDALDataset *> oSetDatasetPointers;
+                std::vector<GDALDataset *> apoDatasets;
                 for (int i = 0; i < nSources; ++i)
                 {
                     auto poSimpleSource =
@@ -1472,37 +1905,9 @@ CPLErr VRTSourcedRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     assert(poSimpleSource);
                     auto poSimpleSourceBand = poSimpleSource->GetRasterBand();
                     assert(poSimpleSourceBand);
-                    auto poSourceDataset = poSimpleSourceBand->GetDataset();
-                    if (poSourceDataset == nullptr)
-                    {
-                        nThreads = 0;
-                        break;
-                    }
-                    auto poDriver = poSourceDataset->GetDriver();
-                    if (poDriver && EQUAL(poDriver->GetDescription(), "MEM"))
-                    {
-                        if (oSetDatasetPointers.find(poSourceDataset) !=
-                            oSetDatasetPointers.end())
-                        {
-                            nThreads = 0;
-                            break;
-                        }
-                        oSetDatasetPointers.insert(poSourceDataset);
-                    }
-                    else
-                    {
-                        if (oSetDatasetNames.find(
-                                poSourceDataset->GetDescription()) !=
-                            oSetDatasetNames.end())
-                        {
-                            nThreads = 0;
-                            break;
-                        }
-                        oSetDatasetNames.insert(
-                            poSourceDataset->GetDescription());
-                    }
+                    apoDatasets.push_back(poSimpleSourceBand->GetDataset());
                 }
-                if (nThreads > 1)
+                if (AreDatasetsDistinct(apoDatasets))
                 {
                     poThreadPool = GDALGetGlobalThreadPool(nThreads);
                 }
@@ -1761,10 +2166,36 @@ CPLErr VRTSourcedRasterBand::GetHistogram(double dfMin, double dfMax,
 CPLErr VRTSourcedRasterBand::AddSource(VRTSource *poNewSource)
 
 {
-    nSources++;
+    InvalidateSourcesQuadTree();
 
-    papoSources = static_cast<VRTSource **>(
-        CPLRealloc(papoSources, sizeof(void *) * nSources));
+    // Grow the array geometrically, as VRTs may have hundreds of thousands
+    // of sources.
+    if (papoSources == nullptr)
+        m_nSourcesAllocated = 0;
+    if (nSources == m_nSourcesAllocated)
+    {
+        const int nNewAllocated =
+            nSources < 8 ? 8
+                         : static_cast<int>(std::min<int64_t>(
+                               std::numeric_limits<int>::max(),
+                               static_cast<int64_t>(nSources) * 2));
+        if (nNewAllocated == nSources)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Too many sources");
+            delete poNewSource;
+            return CE_Failure;
+        }
+        VRTSource **papoNewSources = static_cast<VRTSource **>(
+            VSI_REALLOC_VERBOSE(papoSources, sizeof(void *) * nNewAllocated));
+        if (papoNewSources == nullptr)
+        {
+            delete poNewSource;
+            return CE_Failure;
+        }
+        papoSources = papoNewSources;
+        m_nSourcesAllocated = nNewAllocated;
+    }
+    nSources++;
     papoSources[nSources - 1] = poNewSource;
 
     static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
@@ -1991,6 +2422,7 @@ void VRTSourcedRasterBand::ConfigureSource(VRTSimpleSource *poSimpleSource,
 
     poSimpleSource->SetSrcWindow(dfSrcXOff, dfSrcYOff, dfSrcXSize, dfSrcYSize);
     poSimpleSource->SetDstWindow(dfDstXOff, dfDstYOff, dfDstXSize, dfDstYSize);
+    InvalidateSourcesQuadTree();
 
     /* -------------------------------------------------------------------- */
     /*      If we can get the associated GDALDataset, add a reference to it.*/
@@ -2580,6 +3012,7 @@ CPLErr VRTSourcedRasterBand::SetMetadataItem(const char *pszName,
         {
             delete papoSources[iSource];
             papoSources[iSource] = poSource;
+            InvalidateSourcesQuadTree();
             static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
             return CE_None;
         }
@@ -2611,6 +3044,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata(char **papszNewMD,
             CPLFree(papoSources);
             papoSources = nullptr;
             nSources = 0;
+            InvalidateSourcesQuadTree();
         }
 
         for (const char *const pszMDItem :
@@ -2676,6 +3110,7 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
     CPLFree(papoSources);
     papoSources = nullptr;
     nSources = 0;
+    InvalidateSourcesQuadTree();
 
     return TRUE;
 }
@@ -2870,6 +3305,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
             papoSources[iDst++] = papoSources[iSrc];
     }
     nSources = iDst;
+    InvalidateSourcesQuadTree();
 
     CPLQuadTreeDestroy(hTree);
 #endif
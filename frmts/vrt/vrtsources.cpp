@@ -2863,6 +2863,17 @@ CPLErr VRTComplexSource::RasterIO(GDALDataType eVRTBandDataType, int nXOff,
                 nLineSpace, psExtraArg, oWorkingState);
         }
     }
+    else if (m_nProcessingFlags == PROCESSING_FLAG_COLOR_TABLE_EXPANSION &&
+             m_nColorTableComponent >= 1 && m_nColorTableComponent <= 4 &&
+             eVRTBandDataType == GDT_Byte && eBufType == GDT_Byte &&
+             poSourceBand->GetRasterDataType() == GDT_Byte)
+    {
+        // Optimization if doing only color table expansion of a Byte band
+        return RasterIOExpandColorTableByte(
+            poSourceBand, nReqXOff, nReqYOff, nReqXSize, nReqYSize, pabyOut,
+            nOutXSize, nOutYSize, nPixelSpace, nLineSpace, psExtraArg,
+            oWorkingState);
+    }
 
     const bool bIsComplex =
         CPL_TO_BOOL(GDALDataTypeIsComplex(eVRTBandDataType));
@@ -3089,6 +3100,116 @@ CPLErr VRTComplexSource::RasterIOProcessNoData(
     return CE_None;
 }
 
+/************************************************************************/
+/*                    RasterIOExpandColorTableByte()                    */
+/************************************************************************/
+
+// This method is an optimization of the generic RasterIOInternal()
+// that deals with a VRTComplexSource of type Byte with only a color table
+// expansion, to a Byte band and buffer (typical of gdal_translate -expand).
+// The color table component is turned into a 256-entry lookup table.
+
+// nReqXOff, nReqYOff, nReqXSize, nReqYSize are expressed in source band
+// referential.
+CPLErr VRTComplexSource::RasterIOExpandColorTableByte(
+    GDALRasterBand *poSourceBand, int nReqXOff, int nReqYOff, int nReqXSize,
+    int nReqYSize, void *pData, int nOutXSize, int nOutYSize,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg, WorkingState &oWorkingState)
+{
+    CPLAssert(m_nProcessingFlags == PROCESSING_FLAG_COLOR_TABLE_EXPANSION);
+    CPLAssert(m_nColorTableComponent >= 1 && m_nColorTableComponent <= 4);
+
+    const GDALColorTable *poColorTable = poSourceBand->GetColorTable();
+    if (poColorTable == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Source band has no color table.");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Read into a temporary buffer.                                   */
+    /* -------------------------------------------------------------------- */
+    // Cannot overflow since pData should at least have that number of
+    // elements
+    const size_t nPixelCount = static_cast<size_t>(nOutXSize) * nOutYSize;
+    try
+    {
+        oWorkingState.m_abyWrkBuffer.resize(nPixelCount);
+    }
+    catch (const std::bad_alloc &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return CE_Failure;
+    }
+    const GByte *pabySrcData =
+        reinterpret_cast<const GByte *>(oWorkingState.m_abyWrkBuffer.data());
+
+    const GDALRIOResampleAlg eResampleAlgBack = psExtraArg->eResampleAlg;
+    if (!m_osResampling.empty())
+    {
+        psExtraArg->eResampleAlg = GDALRasterIOGetResampleAlg(m_osResampling);
+    }
+
+    const CPLErr eErr = poSourceBand->RasterIO(
+        GF_Read, nReqXOff, nReqYOff, nReqXSize, nReqYSize,
+        oWorkingState.m_abyWrkBuffer.data(), nOutXSize, nOutYSize, GDT_Byte, 1,
+        static_cast<GSpacing>(nOutXSize), psExtraArg);
+    if (!m_osResampling.empty())
+        psExtraArg->eResampleAlg = eResampleAlgBack;
+
+    if (eErr != CE_None)
+    {
+        return eErr;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Build the lookup table, clamping to the Byte range as the       */
+    /*      generic code path does.                                         */
+    /* -------------------------------------------------------------------- */
+    const int nEntryCount = std::min(poColorTable->GetColorEntryCount(), 256);
+    GByte abyLUT[256] = {0};
+    for (int i = 0; i < nEntryCount; ++i)
+    {
+        const GDALColorEntry *poEntry = poColorTable->GetColorEntry(i);
+        const short nVal = m_nColorTableComponent == 1   ? poEntry->c1
+                           : m_nColorTableComponent == 2 ? poEntry->c2
+                           : m_nColorTableComponent == 3 ? poEntry->c3
+                                                         : poEntry->c4;
+        abyLUT[i] = static_cast<GByte>(std::max<short>(
+            0, std::min<short>(nVal, std::numeric_limits<GByte>::max())));
+    }
+
+    if (nEntryCount < 256)
+    {
+        // Indices without color entry require the error reporting and
+        // pixel skipping of the generic path.
+        for (size_t i = 0; i < nPixelCount; ++i)
+        {
+            if (pabySrcData[i] >= nEntryCount)
+            {
+                return RasterIOInternal<float>(
+                    poSourceBand, GDT_Byte, nReqXOff, nReqYOff, nReqXSize,
+                    nReqYSize, pData, nOutXSize, nOutYSize, GDT_Byte,
+                    nPixelSpace, nLineSpace, psExtraArg, GDT_Float32,
+                    oWorkingState);
+            }
+        }
+    }
+
+    for (int iY = 0; iY < nOutYSize; iY++)
+    {
+        GDALApplyByteLUT(pabySrcData + static_cast<size_t>(iY) * nOutXSize,
+                         abyLUT,
+                         static_cast<GByte *>(pData) +
+                             static_cast<GPtrDiff_t>(nLineSpace) * iY,
+                         static_cast<GPtrDiff_t>(nPixelSpace), nOutXSize);
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                          RasterIOInternal()                          */
 /************************************************************************/
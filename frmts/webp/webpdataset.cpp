@@ -275,6 +275,22 @@ char **WEBPDataset::GetMetadata(const char *pszDomain)
     return GDALPamDataset::GetMetadata(pszDomain);
 }
 
+/************************************************************************/
+/*                          WEBPUseThreads()                            */
+/************************************************************************/
+
+// libwebp can use one extra thread for decoding (filtering) and for lossy
+// encoding. Enabled when GDAL_NUM_THREADS allows more than one thread.
+static bool WEBPUseThreads()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        return false;
+    return EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs() > 1
+                                            : atoi(pszNumThreads) > 1;
+}
+
 /************************************************************************/
 /*                            Uncompress()                              */
 /************************************************************************/
@@ -311,20 +327,40 @@ CPLErr WEBPDataset::Uncompress()
     if (pabyCompressed == nullptr)
         return CE_Failure;
     VSIFReadL(pabyCompressed, 1, nSize, fpImage);
-    uint8_t *pRet;
-
-    if (nBands == 4)
-        pRet = WebPDecodeRGBAInto(pabyCompressed, static_cast<uint32_t>(nSize),
-                                  static_cast<uint8_t *>(pabyUncompressed),
-                                  static_cast<size_t>(nRasterXSize) *
-                                      nRasterYSize * nBands,
-                                  nRasterXSize * nBands);
+    uint8_t *pRet = nullptr;
+
+#if WEBP_DECODER_ABI_VERSION >= 0x0002
+    WebPDecoderConfig config;
+    if (WEBPUseThreads() && WebPInitDecoderConfig(&config))
+    {
+        // Same as WebPDecodeRGB(A)Into(), but with multi-threaded filtering
+        config.options.use_threads = 1;
+        config.output.colorspace = nBands == 4 ? MODE_RGBA : MODE_RGB;
+        config.output.is_external_memory = 1;
+        config.output.u.RGBA.rgba = static_cast<uint8_t *>(pabyUncompressed);
+        config.output.u.RGBA.stride = nRasterXSize * nBands;
+        config.output.u.RGBA.size =
+            static_cast<size_t>(nRasterXSize) * nRasterYSize * nBands;
+        if (WebPDecode(pabyCompressed, nSize, &config) == VP8_STATUS_OK)
+            pRet = static_cast<uint8_t *>(pabyUncompressed);
+        WebPFreeDecBuffer(&config.output);
+    }
     else
-        pRet = WebPDecodeRGBInto(pabyCompressed, static_cast<uint32_t>(nSize),
-                                 static_cast<uint8_t *>(pabyUncompressed),
-                                 static_cast<size_t>(nRasterXSize) *
-                                     nRasterYSize * nBands,
-                                 nRasterXSize * nBands);
+#endif
+    {
+        if (nBands == 4)
+            pRet = WebPDecodeRGBAInto(
+                pabyCompressed, static_cast<uint32_t>(nSize),
+                static_cast<uint8_t *>(pabyUncompressed),
+                static_cast<size_t>(nRasterXSize) * nRasterYSize * nBands,
+                nRasterXSize * nBands);
+        else
+            pRet = WebPDecodeRGBInto(
+                pabyCompressed, static_cast<uint32_t>(nSize),
+                static_cast<uint8_t *>(pabyUncompressed),
+                static_cast<size_t>(nRasterXSize) * nRasterYSize * nBands,
+                nRasterXSize * nBands);
+    }
 
     VSIFree(pabyCompressed);
     if (pRet == nullptr)
@@ -912,6 +948,10 @@ GDALDataset *WEBPDataset::CreateCopy(const char *pszFilename,
 #if WEBP_ENCODER_ABI_VERSION >= 0x0209
     FETCH_AND_SET_OPTION_INT("EXACT", exact, 0, 1);
 #endif
+#if WEBP_ENCODER_ABI_VERSION >= 0x0201
+    if (WEBPUseThreads())
+        sConfig.thread_level = 1;
+#endif
 
     if (!WebPValidateConfig(&sConfig))
     {
@@ -30,8 +30,45 @@
  ****************************************************************************/
 
 #include "cpl_md5.h"
+#include "cpl_multiproc.h"
 #include "wmsdriver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+
+// Temporary files older than that are leftovers of interrupted inserts
+constexpr int STALE_TEMPORARY_FILE_DELAY = 3600;
+
+//------------------------------------------------------------------------------
+// State shared by all the GDALWMSCache instances of the process, so that
+// datasets using the same cache directory, possibly from several threads,
+// cooperate instead of each downloading the same tiles and scanning the
+// same directory.
+//------------------------------------------------------------------------------
+namespace
+{
+struct GDALWMSCacheSharedState
+{
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    // Keys (cache path + request key) of the tiles being downloaded
+    std::set<std::string> oInFlight{};
+    // Cache paths being cleaned, and the time of their last cleaning
+    std::set<std::string> oCleaning{};
+    std::map<std::string, time_t> oLastClean{};
+};
+}  // namespace
+
+static GDALWMSCacheSharedState &GetSharedState()
+{
+    static GDALWMSCacheSharedState oState;
+    return oState;
+}
+
 static void CleanCacheThread(void *pData)
 {
     GDALWMSCache *pCache = static_cast<GDALWMSCache *>(pData);
@@ -93,8 +130,24 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
         // Warns if it fails to write, but returns success
         CPLString soFilePath = GetFilePath(pszKey);
         MakeDirs(CPLGetDirname(soFilePath));
-        if (CPLCopyFile(soFilePath, osFileName) == CE_None)
-            return CE_None;
+        // Write into a temporary file, then atomically rename it, so that
+        // concurrent readers, possibly in other processes, never see a
+        // partially written tile.
+        static std::atomic<int> nCounter{0};
+        const CPLString osTmpFilePath(
+            CPLSPrintf("%s.%d_%d.tmp", soFilePath.c_str(),
+                       CPLGetCurrentProcessID(), nCounter++));
+        if (CPLCopyFile(osTmpFilePath, osFileName) == 0)
+        {
+            if (VSIRename(osTmpFilePath, soFilePath) == 0)
+                return CE_None;
+            // Can happen on Windows if another process has just created
+            // the same entry.
+            VSIUnlink(osTmpFilePath);
+            if (IsPathExists(soFilePath))
+                return CE_None;
+        }
+        VSIUnlink(osTmpFilePath);
         // Warn if it fails after folder creation
         CPLError(CE_Warning, CPLE_FileIO, "Error writing to WMS cache %s",
                  m_soPath.c_str());
@@ -122,52 +175,67 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
             papszOpenOptions, nullptr));
     }
 
+    // Compute the size of the cache, and if it exceeds the limit, delete
+    // the expired entries, and then the oldest ones until the size is below
+    // the limit.
     virtual void Clean() override
     {
-        char **papszList = VSIReadDirRecursive(m_soPath);
-        if (papszList == nullptr)
+        const CPLStringList aosList(VSIReadDirRecursive(m_soPath));
+        if (aosList.empty())
         {
             return;
         }
 
-        int counter = 0;
-        std::vector<int> toDelete;
-        long nSize = 0;
-        time_t nTime = time(nullptr);
-        while (papszList[counter] != nullptr)
+        struct Entry
+        {
+            std::string osPath;
+            GIntBig nSize;
+            time_t nMTime;
+        };
+
+        std::vector<Entry> aoEntries;
+        GIntBig nSize = 0;
+        const time_t nTime = time(nullptr);
+        for (const char *pszFile : aosList)
         {
-            const char *pszPath =
-                CPLFormFilename(m_soPath, papszList[counter], nullptr);
+            std::string osPath = CPLFormFilename(m_soPath, pszFile, nullptr);
             VSIStatBufL sStatBuf;
-            if (VSIStatL(pszPath, &sStatBuf) == 0)
+            if (VSIStatL(osPath.c_str(), &sStatBuf) != 0 ||
+                VSI_ISDIR(sStatBuf.st_mode))
             {
-                if (!VSI_ISDIR(sStatBuf.st_mode))
-                {
-                    long seconds = static_cast<long>(nTime - sStatBuf.st_mtime);
-                    if (seconds > m_nExpires)
-                    {
-                        toDelete.push_back(counter);
-                    }
-
-                    nSize += static_cast<long>(sStatBuf.st_size);
-                }
+                continue;
+            }
+            if (EQUAL(CPLGetExtension(pszFile), "tmp"))
+            {
+                if (nTime - sStatBuf.st_mtime > STALE_TEMPORARY_FILE_DELAY)
+                    VSIUnlink(osPath.c_str());
+                continue;
             }
-            counter++;
+            nSize += static_cast<GIntBig>(sStatBuf.st_size);
+            aoEntries.push_back(Entry{std::move(osPath),
+                                      static_cast<GIntBig>(sStatBuf.st_size),
+                                      sStatBuf.st_mtime});
         }
 
         if (nSize > m_nMaxSize)
         {
-            CPLDebug("WMS", "Delete %u items from cache",
-                     static_cast<unsigned int>(toDelete.size()));
-            for (size_t i = 0; i < toDelete.size(); ++i)
+            std::sort(aoEntries.begin(), aoEntries.end(),
+                      [](const Entry &a, const Entry &b)
+                      { return a.nMTime < b.nMTime; });
+            size_t nDeleted = 0;
+            for (const auto &oEntry : aoEntries)
             {
-                const char *pszPath =
-                    CPLFormFilename(m_soPath, papszList[toDelete[i]], nullptr);
-                VSIUnlink(pszPath);
+                const bool bExpired = nTime - oEntry.nMTime > m_nExpires;
+                if (!bExpired && nSize <= m_nMaxSize)
+                    break;
+                // Failure is fine: another process may have deleted it
+                VSIUnlink(oEntry.osPath.c_str());
+                nSize -= oEntry.nSize;
+                ++nDeleted;
             }
+            CPLDebug("WMS", "Delete %u items from cache",
+                     static_cast<unsigned int>(nDeleted));
         }
-
-        CSLDestroy(papszList);
     }
 
   private:
@@ -336,6 +404,20 @@ CPLErr GDALWMSCache::Insert(const char *pszKey, const CPLString &soFileName)
                 time(nullptr) - m_nCleanThreadLastRunTime >
                     cleanThreadRunTimeout)
             {
+                // Other datasets using the same cache path may have cleaned it
+                // recently
+                {
+                    auto &oState = GetSharedState();
+                    std::lock_guard<std::mutex> oLock(oState.oMutex);
+                    const auto oIter = oState.oLastClean.find(m_osCachePath);
+                    if (oIter != oState.oLastClean.end())
+                        m_nCleanThreadLastRunTime =
+                            std::max(m_nCleanThreadLastRunTime, oIter->second);
+                }
+                if (time(nullptr) - m_nCleanThreadLastRunTime <=
+                    cleanThreadRunTimeout)
+                    return result;
+
                 if (m_hThread)
                     CPLJoinThread(m_hThread);
                 m_bIsCleanThreadRunning = true;
@@ -372,10 +454,74 @@ void GDALWMSCache::Clean()
 {
     if (m_poCache != nullptr)
     {
-        CPLDebug("WMS", "Clean cache");
-        m_poCache->Clean();
+        // Only one dataset at a time cleans a given cache path
+        auto &oState = GetSharedState();
+        bool bClean;
+        {
+            std::lock_guard<std::mutex> oLock(oState.oMutex);
+            bClean = oState.oCleaning.insert(m_osCachePath).second;
+        }
+        if (bClean)
+        {
+            CPLDebug("WMS", "Clean cache");
+            m_poCache->Clean();
+
+            std::lock_guard<std::mutex> oLock(oState.oMutex);
+            oState.oCleaning.erase(m_osCachePath);
+            oState.oLastClean[m_osCachePath] = time(nullptr);
+        }
     }
 
     m_nCleanThreadLastRunTime = time(nullptr);
     m_bIsCleanThreadRunning = false;
 }
+
+/************************************************************************/
+/*                           TryBeginFetch()                            */
+/************************************************************************/
+
+// Registers that the caller is about to download the tile of key pszKey.
+// Returns false if another thread is already downloading it, in which case
+// the caller should call WaitForFetch() and then look again in the cache.
+bool GDALWMSCache::TryBeginFetch(const char *pszKey)
+{
+    auto &oState = GetSharedState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+    return oState.oInFlight.insert(GetInFlightKey(pszKey)).second;
+}
+
+/************************************************************************/
+/*                             EndFetch()                               */
+/************************************************************************/
+
+// Must be called, after the tile has been inserted in the cache or the
+// download has failed, for each successful call to TryBeginFetch().
+void GDALWMSCache::EndFetch(const char *pszKey)
+{
+    auto &oState = GetSharedState();
+    {
+        std::lock_guard<std::mutex> oLock(oState.oMutex);
+        oState.oInFlight.erase(GetInFlightKey(pszKey));
+    }
+    oState.oCV.notify_all();
+}
+
+/************************************************************************/
+/*                           WaitForFetch()                             */
+/************************************************************************/
+
+// Waits until no other thread is downloading the tile of key pszKey.
+void GDALWMSCache::WaitForFetch(const char *pszKey)
+{
+    auto &oState = GetSharedState();
+    const std::string osKey(GetInFlightKey(pszKey));
+    std::unique_lock<std::mutex> oLock(oState.oMutex);
+    oState.oCV.wait(oLock,
+                    [&oState, &osKey]
+                    { return oState.oInFlight.count(osKey) == 0; });
+}
+
+std::string GDALWMSCache::GetInFlightKey(const char *pszKey) const
+{
+    return std::string(m_osCachePath).append(1, '\n').append(pszKey);
+}
@@ -80,7 +80,8 @@ GDALWMSRasterBand::~GDALWMSRasterBand()
 
 // Request for x, y but all blocks between bx0-bx1 and by0-by1 should be read
 CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
-                                     int by0, int bx1, int by1, int advise_read)
+                                     int by0, int bx1, int by1, int advise_read,
+                                     bool bDeduplicate)
 {
     CPLErr ret = CE_None;
 
@@ -88,6 +89,16 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
     std::vector<WMSHTTPRequest> requests(static_cast<size_t>(bx1 - bx0 + 1) *
                                          (by1 - by0 + 1));
 
+    // Blocks being downloaded by another thread, sharing the same cache
+    struct DeferredBlock
+    {
+        int x;
+        int y;
+        CPLString osURL;
+    };
+
+    std::vector<DeferredBlock> deferred;
+
     size_t count = 0;  // How many requests are valid
     GDALWMSCache *cache = m_parent_dataset->m_cache;
     int offline = m_parent_dataset->m_offline_mode;
@@ -185,6 +196,11 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                         }
                     }
                 }
+                else if (cache != nullptr && bDeduplicate &&
+                         !cache->TryBeginFetch(request.URL))
+                {
+                    deferred.push_back(DeferredBlock{ix, iy, request.URL});
+                }
                 else
                 {
                     request.options = options;
@@ -322,6 +338,35 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
         }
     }
 
+    if (cache != nullptr && bDeduplicate)
+    {
+        for (size_t i = 0; i < count; ++i)
+            cache->EndFetch(requests[i].URL);
+    }
+
+    // Now that we no longer hold any in-flight tile, get the ones that
+    // other threads were downloading from the cache, or download them
+    // ourselves if that failed.
+    for (const auto &block : deferred)
+    {
+        void *p = ((block.x == x) && (block.y == y)) ? buffer : nullptr;
+        cache->WaitForFetch(block.osURL);
+        CPLErr eErr = CE_Failure;
+        if (cache->GetItemStatus(block.osURL) == CACHE_ITEM_OK)
+        {
+            eErr = advise_read ? CE_None
+                               : ReadBlockFromCache(block.osURL, block.x,
+                                                    block.y, nBand, p, 0);
+        }
+        if (eErr != CE_None)
+        {
+            eErr = ReadBlocks(block.x, block.y, p, block.x, block.y, block.x,
+                              block.y, advise_read, false);
+        }
+        if (eErr != CE_None)
+            ret = eErr;
+    }
+
     return ret;
 }
 
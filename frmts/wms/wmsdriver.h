@@ -300,6 +300,11 @@ class GDALWMSCache
     GDALDataset *GetDataset(const char *pszKey, char **papszOpenOptions) const;
     void Clean();
 
+    // Deduplication of concurrent downloads of the same tile
+    bool TryBeginFetch(const char *pszKey);
+    void EndFetch(const char *pszKey);
+    void WaitForFetch(const char *pszKey);
+
   protected:
     CPLString CachePath() const
     {
@@ -312,6 +317,8 @@ class GDALWMSCache
     time_t m_nCleanThreadLastRunTime = 0;
 
   private:
+    std::string GetInFlightKey(const char *pszKey) const;
+
     GDALWMSCacheImpl *m_poCache = nullptr;
     CPLJoinableThread *m_hThread = nullptr;
 };
@@ -579,7 +586,7 @@ class GDALWMSRasterBand final : public GDALPamRasterBand
 
   protected:
     CPLErr ReadBlocks(int x, int y, void *buffer, int bx0, int by0, int bx1,
-                      int by1, int advise_read);
+                      int by1, int advise_read, bool bDeduplicate = true);
     bool IsBlockInCache(int x, int y);
     CPLErr AskMiniDriverForBlock(WMSHTTPRequest &request, int x, int y);
     CPLErr ReadBlockFromCache(const char *pszKey, int x, int y,
@@ -33,9 +33,12 @@
 #include "cpl_json.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "memmultidim.h"
 
 #include <array>
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -253,11 +256,29 @@ class ZarrSharedResource
     std::weak_ptr<ZarrGroupBase> m_poWeakRootGroup{};
     std::set<std::string> m_oSetArrayInLoading{};
 
+    // Zarr V3 nodes (content of zarr.json files) coming from consolidated
+    // metadata or from the persistent metadata cache. Keys are directory
+    // names relative to the root directory. Invalid objects are used for
+    // directories without a zarr.json file.
+    bool m_bZarrV3ConsolidatedMetadata = false;
+    std::map<std::string, CPLJSONObject> m_oMapZarrV3Nodes{};
+    // Sub-directories of directories, for the persistent metadata cache
+    std::map<std::string, std::vector<std::string>> m_oMapZarrV3SubDirs{};
+    std::string m_osZarrV3CacheFilename{};
+    std::string m_osZarrV3CacheMarker{};
+    bool m_bZarrV3CacheModified = false;
+
     explicit ZarrSharedResource(const std::string &osRootDirectoryName,
                                 bool bUpdatable);
 
     std::shared_ptr<ZarrGroupBase> OpenRootGroup();
 
+    bool GetRelativeDirectoryName(const std::string &osDirectoryName,
+                                  std::string &osRelativeName) const;
+    void InitZarrV3Metadata(const CPLJSONObject &oRoot,
+                            const VSIStatBufL &sStat);
+    void SaveZarrV3MetadataCache();
+
   public:
     static std::shared_ptr<ZarrSharedResource>
     Create(const std::string &osRootDirectoryName, bool bUpdatable);
@@ -318,6 +339,20 @@ class ZarrSharedResource
     bool AddArrayInLoading(const std::string &osZarrayFilename);
     void RemoveArrayInLoading(const std::string &osZarrayFilename);
 
+    bool HasZarrV3ConsolidatedMetadata() const
+    {
+        return m_bZarrV3ConsolidatedMetadata;
+    }
+
+    bool LoadZarrV3Json(const std::string &osZarrJsonFilename,
+                        CPLJSONObject &oRoot);
+    bool IsZarrV3Directory(const std::string &osDirectoryName);
+    std::vector<std::string>
+    GetZarrV3SubDirectories(const std::string &osDirectoryName);
+    void GetZarrV3ConsolidatedChildren(const std::string &osDirectoryName,
+                                       std::vector<std::string> &aosGroups,
+                                       std::vector<std::string> &aosArrays);
+
     struct SetFilenameAdder
     {
         std::shared_ptr<ZarrSharedResource> m_poSharedResource;
@@ -750,6 +785,14 @@ class ZarrByteVectorQuickResize
     {
         return m_oVec[idx];
     }
+
+    // Explicit deep copy. May throw std::bad_alloc
+    void CopyFrom(const ZarrByteVectorQuickResize &other)
+    {
+        resize(other.m_nSize);
+        if (m_nSize)
+            memcpy(m_oVec.data(), other.m_oVec.data(), m_nSize);
+    }
 };
 
 /************************************************************************/
@@ -805,6 +848,14 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
 
+    // Asynchronous encoding and writing of dirty tiles, when
+    // GDAL_NUM_THREADS is set.
+    mutable GDALThreadReservation m_oTileWriteThreadReservation{};
+    mutable std::unique_ptr<CPLJobQueue> m_poTileWriteJobQueue{};
+    mutable int m_nTileWriteMaxPendingJobs = 0;
+    mutable std::set<std::vector<uint64_t>> m_oSetTilesBeingWritten{};
+    mutable std::atomic<bool> m_bTileWriteFailed{false};
+
     static uint64_t
     ComputeTileCount(const std::string &osName,
                      const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -836,6 +887,12 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     virtual bool FlushDirtyTile() const = 0;
 
+    bool CanWriteTilesAsynchronously() const;
+
+    bool SubmitTileWrite(std::function<bool()> &&fnWriteTile) const;
+
+    bool WaitForTileWrites(const uint64_t *tileIndices = nullptr) const;
+
     std::shared_ptr<GDALMDArray> OpenTilePresenceCache(bool bCanCreate) const;
 
     void NotifyChildrenOfRenaming() override;
@@ -854,6 +911,12 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
                const GDALExtendedDataType &bufferDataType,
                void *pDstBuffer) const override;
 
+    bool IReadWithPrefetch(const GUInt64 *arrayStartIdx, const size_t *count,
+                           const GInt64 *arrayStep,
+                           const GPtrDiff_t *bufferStride,
+                           const GDALExtendedDataType &bufferDataType,
+                           void *pDstBuffer, bool &bHandled) const;
+
     bool IWrite(const GUInt64 *arrayStartIdx, const size_t *count,
                 const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
                 const GDALExtendedDataType &bufferDataType,
@@ -1073,6 +1136,13 @@ class ZarrV2Array final : public ZarrArray
     mutable ZarrByteVectorQuickResize
         m_abyTmpRawTileData{};  // used for Fortran order
 
+    // Options of the compressor and filters, evaluated once, so that tiles
+    // can be encoded from worker threads without accessing JSON objects.
+    mutable bool m_bWriteOptionsPrepared = false;
+    mutable CPLStringList m_aosCompressorOptions{};
+    mutable std::vector<std::pair<const CPLCompressor *, CPLStringList>>
+        m_aoFilterCompressors{};
+
     ZarrV2Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1096,6 +1166,13 @@ class ZarrV2Array final : public ZarrArray
                            ZarrByteVectorQuickResize &abyTmpRawTileData,
                            ZarrByteVectorQuickResize &abyDecodedTileData) const;
 
+    void PrepareWriteOptions() const;
+
+    bool WriteTile(const uint64_t *tileIndices, bool bEmptyTile,
+                   bool bUseMutex, ZarrByteVectorQuickResize &abyRawTileData,
+                   ZarrByteVectorQuickResize &abyTmpRawTileData,
+                   ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
     // Disable copy constructor and assignment operator
     ZarrV2Array(const ZarrV2Array &) = delete;
     ZarrV2Array &operator=(const ZarrV2Array &) = delete;
@@ -1114,6 +1191,7 @@ class ZarrV2Array final : public ZarrArray
     void SetCompressorJson(const CPLJSONObject &oCompressor)
     {
         m_oCompressorJSon = oCompressor;
+        m_bWriteOptionsPrepared = false;
     }
 
     void SetCompressorDecompressor(const std::string &osDecompressorId,
@@ -1128,6 +1206,7 @@ class ZarrV2Array final : public ZarrArray
     void SetFilters(const CPLJSONArray &oFiltersArray)
     {
         m_oFiltersArray = oFiltersArray;
+        m_bWriteOptionsPrepared = false;
     }
 
     void Flush() override;
@@ -1159,6 +1238,8 @@ struct ZarrArrayMetadata
 {
     DtypeElt oElt{};
     std::vector<size_t> anBlockSizes{};
+    // Fill value in the decoded representation of oElt, or empty if unknown
+    std::vector<GByte> abyNoData{};
 
     size_t GetEltCount() const
     {
@@ -1420,6 +1501,42 @@ class ZarrV3CodecTranspose final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
 };
 
+/************************************************************************/
+/*                          ZarrV3CodecCRC32C                           */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/crc32c/v1.0.html
+class ZarrV3CodecCRC32C final : public ZarrV3Codec
+{
+  public:
+    static constexpr const char *NAME = "crc32c";
+
+    ZarrV3CodecCRC32C();
+    ~ZarrV3CodecCRC32C() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+};
+
 /************************************************************************/
 /*                          ZarrV3CodecSequence                         */
 /************************************************************************/
@@ -1451,6 +1568,84 @@ class ZarrV3CodecSequence
 
     bool Encode(ZarrByteVectorQuickResize &abyBuffer);
     bool Decode(ZarrByteVectorQuickResize &abyBuffer);
+
+    // Whether DecodeFromFile() can be used instead of reading the whole
+    // file and calling Decode(), i.e. when the last codec is sharding_indexed
+    bool CanDecodeFromFile() const;
+    bool DecodeFromFile(VSILFILE *fp, vsi_l_offset nFileSize,
+                        ZarrByteVectorQuickResize &abyBuffer);
+};
+
+/************************************************************************/
+/*                      ZarrV3CodecShardingIndexed                      */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/v1.0.html
+class ZarrV3CodecShardingIndexed final : public ZarrV3Codec
+{
+    // Codecs applied to each inner chunk
+    std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
+    // Codecs applied to the shard index
+    std::unique_ptr<ZarrV3CodecSequence> m_poIndexCodecs{};
+    std::vector<size_t> m_anInnerBlockSize{};
+    // Number of inner chunks along each dimension of a shard
+    std::vector<size_t> m_anInnerBlockCount{};
+    // Stride in bytes of each dimension of a shard
+    std::vector<size_t> m_anShardStride{};
+    size_t m_nInnerBlockCount = 0;
+    size_t m_nInnerBlockRawSize = 0;
+    // Size of the encoded index
+    size_t m_nIndexSize = 0;
+    bool m_bIndexAtEnd = true;
+
+    ZarrV3CodecShardingIndexed(const ZarrV3CodecShardingIndexed &) = delete;
+    ZarrV3CodecShardingIndexed &
+    operator=(const ZarrV3CodecShardingIndexed &) = delete;
+
+    void CopyInnerChunk(size_t iChunk, const GByte *pabySrc, GByte *pabyDst,
+                        bool bToShard) const;
+    bool DecodeIndex(ZarrByteVectorQuickResize &abyIndex, uint64_t nShardSize,
+                     std::vector<uint64_t> &anIndex) const;
+    bool DecodeInnerChunks(const std::vector<uint64_t> &anIndex,
+                           const std::vector<const GByte *> &apabyChunkData,
+                           ZarrByteVectorQuickResize &abyDst) const;
+
+  public:
+    static constexpr const char *NAME = "sharding_indexed";
+
+    ZarrV3CodecShardingIndexed();
+    ~ZarrV3CodecShardingIndexed() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::ARRAY;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    static CPLJSONObject
+    GetConfiguration(const std::vector<GUInt64> &anInnerBlockSize,
+                     const CPLJSONArray &oCodecs);
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    // Decode a shard by reading only its index and its non-empty inner
+    // chunks from the file.
+    bool DecodeFromFile(VSILFILE *fp, vsi_l_offset nFileSize,
+                        ZarrByteVectorQuickResize &abyDst) const;
 };
 
 /************************************************************************/
@@ -1483,6 +1678,11 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    bool WriteTile(const uint64_t *tileIndices, bool bEmptyTile,
+                   bool bUseMutex, ZarrV3CodecSequence *poCodecs,
+                   ZarrByteVectorQuickResize &abyRawTileData,
+                   ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -890,6 +890,9 @@ bool ZarrArray::IAdviseReadCommon(const GUInt64 *arrayStartIdx,
     if (!CheckValidAndErrorOutIfNot())
         return false;
 
+    if (!WaitForTileWrites())
+        return false;
+
     const size_t nDims = m_aoDims.size();
     anIndicesCur.resize(nDims);
     std::vector<uint64_t> anIndicesMin(nDims);
@@ -1026,6 +1029,131 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*                     ZarrArray::IReadWithPrefetch()                   */
+/************************************************************************/
+
+// When GDAL_NUM_THREADS is set, reads a request intersecting several tiles
+// by batches of rows of tiles (along the first dimension), whose tiles are
+// fetched and decoded concurrently with IAdviseRead(). The size of a batch
+// is bounded by half of the remaining block cache.
+// bHandled is set to false if the request is not suitable for that, in which
+// case the caller must do the reading itself.
+// arrayStep[] is assumed to be positive.
+bool ZarrArray::IReadWithPrefetch(const GUInt64 *arrayStartIdx,
+                                  const size_t *count, const GInt64 *arrayStep,
+                                  const GPtrDiff_t *bufferStride,
+                                  const GDALExtendedDataType &bufferDataType,
+                                  void *pDstBuffer, bool &bHandled) const
+{
+    bHandled = false;
+
+    const size_t nDims = m_aoDims.size();
+    if (nDims == 0)
+        return true;
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return true;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    if (nThreads <= 1)
+        return true;
+
+    // Number of rows of tiles along the first dimension, and number of
+    // tiles in each row.
+    uint64_t nTileRowCount = 1;
+    uint64_t nTilesPerRow = 1;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        // If the request skips whole tiles, not all tiles need to be fetched
+        const uint64_t nStep = static_cast<uint64_t>(arrayStep[i]);
+        if (count[i] > 1 && nStep > m_anBlockSize[i])
+            return true;
+        const uint64_t nLastIdx = arrayStartIdx[i] + (count[i] - 1) * nStep;
+        const uint64_t nTiles = nLastIdx / m_anBlockSize[i] -
+                                arrayStartIdx[i] / m_anBlockSize[i] + 1;
+        if (i == 0)
+            nTileRowCount = nTiles;
+        else
+            nTilesPerRow *= nTiles;
+    }
+    if (nTileRowCount * nTilesPerRow < 2)
+        return true;
+
+    const GIntBig nCacheMax = GDALGetCacheMax64();
+    const GIntBig nCacheUsed = GDALGetCacheUsed64();
+    const uint64_t nCacheSize =
+        nCacheMax > nCacheUsed
+            ? static_cast<uint64_t>(nCacheMax - nCacheUsed) / 2
+            : 0;
+    const uint64_t nTileSize = std::max(m_nTileSize, nDims);
+    if (nTilesPerRow > nCacheSize / nTileSize)
+    {
+        // Not even a single row of tiles fits in the cache
+        return true;
+    }
+    const uint64_t nTileRowsPerBatch =
+        std::min(nTileRowCount, nCacheSize / (nTileSize * nTilesPerRow));
+
+    if (!FlushDirtyTile())
+        return false;
+    bHandled = true;
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("NUM_THREADS", pszNumThreads);
+    aosOptions.SetNameValue("CACHE_SIZE",
+                            CPLSPrintf(CPL_FRMT_GUIB,
+                                       static_cast<GUIntBig>(nCacheSize)));
+
+    std::vector<GUInt64> anBatchStartIdx(arrayStartIdx, arrayStartIdx + nDims);
+    std::vector<size_t> anBatchCount(count, count + nDims);
+    std::vector<size_t> anAdviseCount(nDims);
+    for (size_t i = 1; i < nDims; ++i)
+    {
+        anAdviseCount[i] = static_cast<size_t>(
+            (count[i] - 1) * static_cast<uint64_t>(arrayStep[i]) + 1);
+    }
+
+    const uint64_t nStep0 = static_cast<uint64_t>(arrayStep[0]);
+    const GPtrDiff_t nDstStride0 =
+        bufferStride[0] * static_cast<GPtrDiff_t>(bufferDataType.GetSize());
+    bool bRet = true;
+    size_t iFirst = 0;
+    uint64_t iTileRow = arrayStartIdx[0] / m_anBlockSize[0];
+    while (bRet && iFirst < count[0])
+    {
+        // Index (along the first dimension) of the first element of the
+        // request that is beyond this batch of tile rows
+        iTileRow += nTileRowsPerBatch;
+        const uint64_t nBatchEndIdx = iTileRow * m_anBlockSize[0];
+        size_t iLast = count[0];
+        if (nStep0 > 0 &&
+            nBatchEndIdx <= arrayStartIdx[0] + (count[0] - 1) * nStep0)
+        {
+            iLast = static_cast<size_t>(
+                (nBatchEndIdx - arrayStartIdx[0] + nStep0 - 1) / nStep0);
+            iLast = std::max(iLast, iFirst + 1);
+        }
+
+        anBatchStartIdx[0] = arrayStartIdx[0] + iFirst * nStep0;
+        anBatchCount[0] = iLast - iFirst;
+        anAdviseCount[0] =
+            static_cast<size_t>((anBatchCount[0] - 1) * nStep0 + 1);
+        bRet = IAdviseRead(anBatchStartIdx.data(), anAdviseCount.data(),
+                           aosOptions.List()) &&
+               IRead(anBatchStartIdx.data(), anBatchCount.data(), arrayStep,
+                     bufferStride, bufferDataType,
+                     static_cast<GByte *>(pDstBuffer) +
+                         static_cast<GPtrDiff_t>(iFirst) * nDstStride0);
+        m_oMapTileIndexToCachedTile.clear();
+        iFirst = iLast;
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                           ZarrArray::IRead()                         */
 /************************************************************************/
@@ -1041,6 +1169,9 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
     if (!AllocateWorkingBuffers())
         return false;
 
+    if (!WaitForTileWrites())
+        return false;
+
     // Need to be kept in top-level scope
     std::vector<GUInt64> arrayStartIdxMod;
     std::vector<GInt64> arrayStepMod;
@@ -1091,6 +1222,18 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
         bufferStride = bufferStrideMod.data();
     }
 
+    // Fetch and decode in parallel the tiles intersecting the request,
+    // unless this has already been done by IAdviseRead().
+    if (m_oMapTileIndexToCachedTile.empty())
+    {
+        bool bHandled = false;
+        const bool bRet =
+            IReadWithPrefetch(arrayStartIdx, count, arrayStep, bufferStride,
+                              bufferDataType, pDstBuffer, bHandled);
+        if (bHandled)
+            return bRet;
+    }
+
     std::vector<uint64_t> indicesOuterLoop(nDims + 1);
     std::vector<GByte *> dstPtrStackOuterLoop(nDims + 1);
 
@@ -1692,6 +1835,8 @@ lbl_next_depth:
             {
                 // If we don't write the whole tile, we need to fetch a
                 // potentially existing one.
+                if (!WaitForTileWrites(tileIndices.data()))
+                    return false;
                 bool bEmptyTile = false;
                 m_bCachedTiledValid =
                     LoadTileData(tileIndices.data(), bEmptyTile);
@@ -1989,6 +2134,116 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*               ZarrArray::CanWriteTilesAsynchronously()               */
+/************************************************************************/
+
+// When GDAL_NUM_THREADS is set to a value greater than 1, dirty tiles are
+// encoded and written by worker threads of the global thread pool, while the
+// calling thread goes on filling the next tiles.
+bool ZarrArray::CanWriteTilesAsynchronously() const
+{
+    if (m_poTileWriteJobQueue)
+        return true;
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return false;
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::min(nThreads, 1024);
+    if (nThreads <= 1)
+        return false;
+
+    GDALThreadReservation oThreadReservation(nThreads);
+    nThreads = oThreadReservation.GetThreadCount();
+    if (nThreads <= 1)
+        return false;
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+    m_poTileWriteJobQueue = poThreadPool->CreateJobQueue();
+    if (!m_poTileWriteJobQueue)
+        return false;
+    m_oTileWriteThreadReservation = std::move(oThreadReservation);
+    // Limit the number of pending tiles, and thus the memory consumption,
+    // while keeping all threads busy.
+    m_nTileWriteMaxPendingJobs = 2 * nThreads;
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrArray::SubmitTileWrite()                     */
+/************************************************************************/
+
+bool ZarrArray::SubmitTileWrite(std::function<bool()> &&fnWriteTile) const
+{
+    if (m_bTileWriteFailed)
+        return WaitForTileWrites();
+
+    // Writes of a same tile must be serialized
+    if (!WaitForTileWrites(m_anCachedTiledIndices.data()))
+        return false;
+    if (!CanWriteTilesAsynchronously())
+        return fnWriteTile();
+
+    struct Job
+    {
+        const ZarrArray *poArray = nullptr;
+        std::function<bool()> fnWriteTile{};
+    };
+
+    const auto JobRunner = [](void *pData)
+    {
+        std::unique_ptr<Job> psJob(static_cast<Job *>(pData));
+        if (!psJob->fnWriteTile())
+            psJob->poArray->m_bTileWriteFailed = true;
+    };
+
+    m_oSetTilesBeingWritten.insert(m_anCachedTiledIndices);
+
+    auto psJob = new Job();
+    psJob->poArray = this;
+    psJob->fnWriteTile = std::move(fnWriteTile);
+    if (!m_poTileWriteJobQueue->SubmitJob(JobRunner, psJob))
+        JobRunner(psJob);
+    m_poTileWriteJobQueue->WaitCompletion(m_nTileWriteMaxPendingJobs);
+    return true;
+}
+
+/************************************************************************/
+/*                   ZarrArray::WaitForTileWrites()                     */
+/************************************************************************/
+
+// Waits for the completion of the asynchronous writes of tiles. If
+// tileIndices is not null, only waits if that tile is being written.
+bool ZarrArray::WaitForTileWrites(const uint64_t *tileIndices) const
+{
+    if (!m_poTileWriteJobQueue)
+        return true;
+    if (tileIndices &&
+        m_oSetTilesBeingWritten.find(std::vector<uint64_t>(
+            tileIndices, tileIndices + m_aoDims.size())) ==
+            m_oSetTilesBeingWritten.end())
+    {
+        return true;
+    }
+
+    m_poTileWriteJobQueue->WaitCompletion();
+    m_poTileWriteJobQueue.reset();
+    m_oTileWriteThreadReservation.Release();
+    m_oSetTilesBeingWritten.clear();
+    if (m_bTileWriteFailed)
+    {
+        m_bTileWriteFailed = false;
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Writing of at least one tile of %s failed",
+                 GetFullName().c_str());
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                   ZarrArray::IsEmptyTile()                           */
 /************************************************************************/
@@ -2160,6 +2415,9 @@ bool ZarrArray::CacheTilePresence()
     if (m_nTotalTileCount == 1)
         return true;
 
+    if (!WaitForTileWrites())
+        return false;
+
     const std::string osDirectoryName = GetDataDirectory();
 
     struct DirCloser
@@ -2681,6 +2939,9 @@ bool ZarrArray::Rename(const std::string &osNewName)
             return false;
     }
 
+    if (!WaitForTileWrites())
+        return false;
+
     const std::string osRootDirectoryName(
         CPLGetDirname(CPLGetDirname(m_osFilename.c_str())));
     const std::string osOldDirectoryName =
@@ -29,6 +29,9 @@
 #include "zarr.h"
 
 #include "cpl_json.h"
+#include "cpl_md5.h"
+
+#include <algorithm>
 
 /************************************************************************/
 /*              ZarrSharedResource::ZarrSharedResource()                */
@@ -75,6 +78,8 @@ ZarrSharedResource::~ZarrSharedResource()
         oDoc.Save(CPLFormFilename(m_osRootDirectoryName.c_str(), ".zmetadata",
                                   nullptr));
     }
+    if (m_bZarrV3CacheModified)
+        SaveZarrV3MetadataCache();
 }
 
 /************************************************************************/
@@ -190,6 +195,7 @@ std::shared_ptr<ZarrGroupBase> ZarrSharedResource::OpenRootGroup()
         }
         else if (osNodeType == "group")
         {
+            InitZarrV3Metadata(oRoot, sStat);
             return poRG_V3;
         }
         else
@@ -365,3 +371,351 @@ void ZarrSharedResource::RemoveArrayInLoading(
 {
     m_oSetArrayInLoading.erase(osZarrayFilename);
 }
+
+/************************************************************************/
+/*          ZarrSharedResource::GetRelativeDirectoryName()              */
+/************************************************************************/
+
+/** Returns the name of osDirectoryName relative to the root directory, with
+ * forward slashes. Returns false if it is not under the root directory. */
+bool ZarrSharedResource::GetRelativeDirectoryName(
+    const std::string &osDirectoryName, std::string &osRelativeName) const
+{
+    CPLString osNormalized(osDirectoryName);
+    osNormalized.replaceAll('\\', '/');
+    CPLString osRoot(m_osRootDirectoryName);
+    osRoot.replaceAll('\\', '/');
+    if (osNormalized == osRoot)
+    {
+        osRelativeName.clear();
+        return true;
+    }
+    if (!STARTS_WITH(osNormalized.c_str(), (osRoot + '/').c_str()))
+        return false;
+    osRelativeName = osNormalized.substr(osRoot.size() + 1);
+    return true;
+}
+
+/************************************************************************/
+/*              ZarrSharedResource::InitZarrV3Metadata()                */
+/************************************************************************/
+
+/** Initializes the Zarr V3 node cache, from the consolidated metadata of the
+ * root zarr.json if present, or otherwise from the persistent metadata cache
+ * if the ZARR_METADATA_CACHE_DIR configuration option is set.
+ *
+ * The persistent cache is keyed by the root directory name, and invalidated
+ * when the modification time or size of the root zarr.json file changes.
+ */
+void ZarrSharedResource::InitZarrV3Metadata(const CPLJSONObject &oRoot,
+                                            const VSIStatBufL &sStat)
+{
+    // Consolidated metadata is not updated when modifying the dataset
+    if (m_bUpdatable)
+        return;
+
+    const auto oConsolidated = oRoot["consolidated_metadata"];
+    if (CPLTestBool(CSLFetchNameValueDef(GetOpenOptions(), "USE_ZMETADATA",
+                                         "YES")) &&
+        oConsolidated.GetType() == CPLJSONObject::Type::Object &&
+        oConsolidated.GetString("kind") == "inline")
+    {
+        const auto oMetadata = oConsolidated["metadata"];
+        if (oMetadata.GetType() == CPLJSONObject::Type::Object)
+        {
+            m_bZarrV3ConsolidatedMetadata = true;
+            for (const auto &oNode : oMetadata.GetChildren())
+            {
+                if (oNode.GetType() == CPLJSONObject::Type::Object)
+                    m_oMapZarrV3Nodes[oNode.GetName()] = oNode;
+            }
+            m_oMapZarrV3Nodes[std::string()] = oRoot;
+            return;
+        }
+    }
+
+    const char *pszCacheDir =
+        CPLGetConfigOption("ZARR_METADATA_CACHE_DIR", nullptr);
+    if (!pszCacheDir || pszCacheDir[0] == '\0')
+        return;
+
+    m_osZarrV3CacheFilename = CPLFormFilename(
+        pszCacheDir, CPLMD5String(m_osRootDirectoryName.c_str()), "json");
+    m_osZarrV3CacheMarker =
+        CPLSPrintf(CPL_FRMT_GIB "_" CPL_FRMT_GUIB,
+                   static_cast<GIntBig>(sStat.st_mtime),
+                   static_cast<GUIntBig>(sStat.st_size));
+
+    VSIStatBufL sStatCache;
+    if (VSIStatL(m_osZarrV3CacheFilename.c_str(), &sStatCache) == 0)
+    {
+        CPLJSONDocument oDoc;
+        bool bLoaded;
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            bLoaded = oDoc.Load(m_osZarrV3CacheFilename);
+        }
+        const auto oCache = oDoc.GetRoot();
+        if (bLoaded && oCache.GetString("url") == m_osRootDirectoryName &&
+            oCache.GetString("marker") == m_osZarrV3CacheMarker)
+        {
+            CPLDebug("ZARR", "Using metadata cache %s",
+                     m_osZarrV3CacheFilename.c_str());
+            for (const auto &oNode : oCache["nodes"].GetChildren())
+            {
+                if (oNode.GetType() == CPLJSONObject::Type::Object)
+                {
+                    m_oMapZarrV3Nodes[oNode.GetName()] = oNode;
+                }
+                else
+                {
+                    CPLJSONObject oInvalid;
+                    oInvalid.Deinit();
+                    m_oMapZarrV3Nodes[oNode.GetName()] = oInvalid;
+                }
+            }
+            for (const auto &oDir : oCache["subdirs"].GetChildren())
+            {
+                auto &aosSubDirs = m_oMapZarrV3SubDirs[oDir.GetName()];
+                for (const auto &oSubDir : oDir.ToArray())
+                    aosSubDirs.push_back(oSubDir.ToString());
+            }
+        }
+    }
+    m_oMapZarrV3Nodes[std::string()] = oRoot;
+}
+
+/************************************************************************/
+/*            ZarrSharedResource::SaveZarrV3MetadataCache()             */
+/************************************************************************/
+
+void ZarrSharedResource::SaveZarrV3MetadataCache()
+{
+    CPLJSONDocument oDoc;
+    auto oCache = oDoc.GetRoot();
+    oCache.Add("url", m_osRootDirectoryName);
+    oCache.Add("marker", m_osZarrV3CacheMarker);
+    CPLJSONObject oNodes;
+    for (const auto &[osName, oNode] : m_oMapZarrV3Nodes)
+    {
+        if (osName.empty())
+            continue;
+        if (oNode.IsValid())
+            oNodes.AddNoSplitName(osName, oNode);
+        else
+            oNodes.AddNull(osName);
+    }
+    oCache.Add("nodes", oNodes);
+    CPLJSONObject oSubDirs;
+    for (const auto &[osName, aosSubDirs] : m_oMapZarrV3SubDirs)
+    {
+        CPLJSONArray oArray;
+        for (const auto &osSubDir : aosSubDirs)
+            oArray.Add(osSubDir);
+        oSubDirs.AddNoSplitName(osName, oArray);
+    }
+    oCache.Add("subdirs", oSubDirs);
+
+    // Write to a temporary file first, so that concurrent processes never
+    // see a partially written cache
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSIMkdirRecursive(CPLGetPath(m_osZarrV3CacheFilename.c_str()), 0755);
+    const std::string osTmpFilename =
+        m_osZarrV3CacheFilename +
+        CPLSPrintf(".%d.tmp", static_cast<int>(CPLGetCurrentProcessID()));
+    if (oDoc.Save(osTmpFilename) &&
+        VSIRename(osTmpFilename.c_str(), m_osZarrV3CacheFilename.c_str()) ==
+            0)
+    {
+        CPLDebug("ZARR", "Metadata cache %s written",
+                 m_osZarrV3CacheFilename.c_str());
+    }
+    else
+    {
+        CPLDebug("ZARR", "Cannot write metadata cache %s",
+                 m_osZarrV3CacheFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                ZarrSharedResource::LoadZarrV3Json()                  */
+/************************************************************************/
+
+/** Returns in oRoot the content of a Zarr V3 zarr.json file, possibly from
+ * consolidated metadata or the persistent metadata cache, without any file
+ * access.
+ *
+ * Returns false if the file does not exist. If it exists but cannot be
+ * parsed, true is returned and oRoot is invalid.
+ */
+bool ZarrSharedResource::LoadZarrV3Json(const std::string &osZarrJsonFilename,
+                                        CPLJSONObject &oRoot)
+{
+    std::string osKey;
+    const bool bCacheable =
+        (m_bZarrV3ConsolidatedMetadata || !m_osZarrV3CacheFilename.empty()) &&
+        GetRelativeDirectoryName(CPLGetPath(osZarrJsonFilename.c_str()),
+                                 osKey);
+    if (bCacheable)
+    {
+        const auto oIter = m_oMapZarrV3Nodes.find(osKey);
+        if (oIter != m_oMapZarrV3Nodes.end())
+        {
+            oRoot = oIter->second;
+            return oRoot.IsValid();
+        }
+        // Consolidated metadata lists all nodes
+        if (m_bZarrV3ConsolidatedMetadata)
+        {
+            oRoot.Deinit();
+            return false;
+        }
+    }
+
+    oRoot.Deinit();
+    VSIStatBufL sStat;
+    if (VSIStatL(osZarrJsonFilename.c_str(), &sStat) != 0)
+    {
+        if (bCacheable)
+        {
+            m_oMapZarrV3Nodes[osKey] = oRoot;
+            m_bZarrV3CacheModified = true;
+        }
+        return false;
+    }
+    CPLJSONDocument oDoc;
+    if (oDoc.Load(osZarrJsonFilename))
+    {
+        oRoot = oDoc.GetRoot();
+        if (bCacheable)
+        {
+            m_oMapZarrV3Nodes[osKey] = oRoot;
+            m_bZarrV3CacheModified = true;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*               ZarrSharedResource::IsZarrV3Directory()                */
+/************************************************************************/
+
+/** Returns whether osDirectoryName is an existing directory (possibly an
+ * implicit group), using consolidated metadata or the persistent metadata
+ * cache when available. */
+bool ZarrSharedResource::IsZarrV3Directory(const std::string &osDirectoryName)
+{
+    std::string osKey;
+    if (m_bZarrV3ConsolidatedMetadata &&
+        GetRelativeDirectoryName(osDirectoryName, osKey))
+    {
+        if (osKey.empty() ||
+            m_oMapZarrV3Nodes.find(osKey) != m_oMapZarrV3Nodes.end())
+            return true;
+        // Names starting with osPrefix are sorted contiguously from there
+        const std::string osPrefix(osKey + '/');
+        const auto oIter = m_oMapZarrV3Nodes.lower_bound(osPrefix);
+        return oIter != m_oMapZarrV3Nodes.end() &&
+               STARTS_WITH(oIter->first.c_str(), osPrefix.c_str());
+    }
+
+    if (!m_osZarrV3CacheFilename.empty() &&
+        GetRelativeDirectoryName(osDirectoryName, osKey) && !osKey.empty())
+    {
+        const auto aosSubDirs =
+            GetZarrV3SubDirectories(CPLGetPath(osDirectoryName.c_str()));
+        return std::find(aosSubDirs.begin(), aosSubDirs.end(),
+                         CPLGetFilename(osDirectoryName.c_str())) !=
+               aosSubDirs.end();
+    }
+
+    VSIStatBufL sStat;
+    return VSIStatL(osDirectoryName.c_str(), &sStat) == 0 &&
+           VSI_ISDIR(sStat.st_mode);
+}
+
+/************************************************************************/
+/*            ZarrSharedResource::GetZarrV3SubDirectories()             */
+/************************************************************************/
+
+/** Returns the names of the sub-directories of osDirectoryName, using the
+ * persistent metadata cache when available. */
+std::vector<std::string>
+ZarrSharedResource::GetZarrV3SubDirectories(const std::string &osDirectoryName)
+{
+    std::string osKey;
+    const bool bCacheable = !m_osZarrV3CacheFilename.empty() &&
+                            GetRelativeDirectoryName(osDirectoryName, osKey);
+    if (bCacheable)
+    {
+        const auto oIter = m_oMapZarrV3SubDirs.find(osKey);
+        if (oIter != m_oMapZarrV3SubDirs.end())
+            return oIter->second;
+    }
+
+    std::vector<std::string> aosSubDirs;
+    auto psDir = VSIOpenDir(osDirectoryName.c_str(), 0, nullptr);
+    if (!psDir)
+        return aosSubDirs;
+    while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+    {
+        if (VSI_ISDIR(psEntry->nMode))
+            aosSubDirs.emplace_back(psEntry->pszName);
+    }
+    VSICloseDir(psDir);
+
+    if (bCacheable)
+    {
+        m_oMapZarrV3SubDirs[osKey] = aosSubDirs;
+        m_bZarrV3CacheModified = true;
+    }
+    return aosSubDirs;
+}
+
+/************************************************************************/
+/*         ZarrSharedResource::GetZarrV3ConsolidatedChildren()          */
+/************************************************************************/
+
+/** Appends to aosGroups and aosArrays the names of the child groups and
+ * arrays of osDirectoryName, from consolidated metadata. */
+void ZarrSharedResource::GetZarrV3ConsolidatedChildren(
+    const std::string &osDirectoryName, std::vector<std::string> &aosGroups,
+    std::vector<std::string> &aosArrays)
+{
+    std::string osPrefix;
+    if (!GetRelativeDirectoryName(osDirectoryName, osPrefix))
+        return;
+    if (!osPrefix.empty())
+        osPrefix += '/';
+
+    const auto AddIfNotPresent =
+        [](std::vector<std::string> &aosNames, const std::string &osName)
+    {
+        if (std::find(aosNames.begin(), aosNames.end(), osName) ==
+            aosNames.end())
+        {
+            aosNames.push_back(osName);
+        }
+    };
+
+    for (const auto &[osKey, oNode] : m_oMapZarrV3Nodes)
+    {
+        if (osKey.size() <= osPrefix.size() ||
+            !STARTS_WITH(osKey.c_str(), osPrefix.c_str()))
+            continue;
+        const std::string osRest = osKey.substr(osPrefix.size());
+        const auto nSlashPos = osRest.find('/');
+        if (nSlashPos != std::string::npos)
+        {
+            // Intermediate node, possibly an implicit group
+            AddIfNotPresent(aosGroups, osRest.substr(0, nSlashPos));
+            continue;
+        }
+        const std::string osNodeType = oNode.GetString("node_type");
+        if (osNodeType == "array")
+            AddIfNotPresent(aosArrays, osRest);
+        else if (osNodeType == "group")
+            AddIfNotPresent(aosGroups, osRest);
+    }
+}
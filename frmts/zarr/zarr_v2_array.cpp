@@ -95,9 +95,13 @@ ZarrV2Array::~ZarrV2Array()
 void ZarrV2Array::Flush()
 {
     if (!m_bValid)
+    {
+        WaitForTileWrites();
         return;
+    }
 
     ZarrV2Array::FlushDirtyTile();
+    WaitForTileWrites();
 
     if (m_bDefinitionModified)
     {
@@ -660,6 +664,9 @@ bool ZarrV2Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
         return true;
     }
 
+    const GDALThreadReservation oThreadReservation(nThreadsMax);
+    nThreadsMax = oThreadReservation.GetThreadCount();
+
     const int nThreads =
         static_cast<int>(std::min(static_cast<size_t>(nThreadsMax), nReqTiles));
 
@@ -806,6 +813,49 @@ bool ZarrV2Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     return bGlobalStatus;
 }
 
+/************************************************************************/
+/*                  ZarrV2Array::PrepareWriteOptions()                  */
+/************************************************************************/
+
+void ZarrV2Array::PrepareWriteOptions() const
+{
+    if (m_bWriteOptionsPrepared)
+        return;
+    m_bWriteOptionsPrepared = true;
+
+    m_aosCompressorOptions.Clear();
+    for (const auto &obj : m_oCompressorJSon.GetChildren())
+    {
+        m_aosCompressorOptions.SetNameValue(obj.GetName().c_str(),
+                                            obj.ToString().c_str());
+    }
+    if (m_psCompressor && EQUAL(m_psCompressor->pszId, "blosc") &&
+        m_oType.GetClass() == GEDTC_NUMERIC)
+    {
+        const GDALDataType eDT =
+            GDALGetNonComplexDataType(m_oType.GetNumericDataType());
+        m_aosCompressorOptions.SetNameValue(
+            "TYPESIZE", CPLSPrintf("%d", GDALGetDataTypeSizeBytes(eDT)));
+    }
+
+    m_aoFilterCompressors.clear();
+    for (const auto &oFilter : m_oFiltersArray)
+    {
+        const auto osFilterId = oFilter["id"].ToString();
+        const auto psFilterCompressor = CPLGetCompressor(osFilterId.c_str());
+        CPLAssert(psFilterCompressor);
+
+        CPLStringList aosOptions;
+        for (const auto &obj : oFilter.GetChildren())
+        {
+            aosOptions.SetNameValue(obj.GetName().c_str(),
+                                    obj.ToString().c_str());
+        }
+        m_aoFilterCompressors.emplace_back(psFilterCompressor,
+                                           std::move(aosOptions));
+    }
+}
+
 /************************************************************************/
 /*                    ZarrV2Array::FlushDirtyTile()                     */
 /************************************************************************/
@@ -816,17 +866,88 @@ bool ZarrV2Array::FlushDirtyTile() const
         return true;
     m_bDirtyTile = false;
 
-    std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
+    PrepareWriteOptions();
 
-    const size_t nSourceSize =
-        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
     const auto &abyTile =
         m_abyDecodedTileData.empty() ? m_abyRawTileData : m_abyDecodedTileData;
+    const bool bEmptyTile = IsEmptyTile(abyTile);
+    if (bEmptyTile)
+        m_bCachedTiledEmpty = true;
 
-    if (IsEmptyTile(abyTile))
+    if (!CanWriteTilesAsynchronously())
     {
-        m_bCachedTiledEmpty = true;
+        return WriteTile(m_anCachedTiledIndices.data(), bEmptyTile,
+                         /* bUseMutex = */ false, m_abyRawTileData,
+                         m_abyTmpRawTileData, m_abyDecodedTileData);
+    }
+
+    // Give a copy of the tile to a worker thread, so that the current tile
+    // remains usable.
+    struct TileBuffers
+    {
+        ZarrByteVectorQuickResize abyRawTileData{};
+        ZarrByteVectorQuickResize abyTmpRawTileData{};
+        ZarrByteVectorQuickResize abyDecodedTileData{};
+    };
+
+    auto poBuffers = std::make_shared<TileBuffers>();
+    try
+    {
+        if (m_abyDecodedTileData.empty())
+        {
+            poBuffers->abyRawTileData.CopyFrom(m_abyRawTileData);
+        }
+        else
+        {
+            poBuffers->abyRawTileData.resize(m_abyRawTileData.size());
+            poBuffers->abyDecodedTileData.CopyFrom(m_abyDecodedTileData);
+        }
+        poBuffers->abyTmpRawTileData.resize(m_abyTmpRawTileData.size());
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    const std::vector<uint64_t> anTileIndices(m_anCachedTiledIndices);
+    return SubmitTileWrite(
+        [this, anTileIndices, bEmptyTile, poBuffers]()
+        {
+            return WriteTile(anTileIndices.data(), bEmptyTile,
+                             /* bUseMutex = */ true, poBuffers->abyRawTileData,
+                             poBuffers->abyTmpRawTileData,
+                             poBuffers->abyDecodedTileData);
+        });
+}
+
+/************************************************************************/
+/*                      ZarrV2Array::WriteTile()                        */
+/************************************************************************/
 
+bool ZarrV2Array::WriteTile(const uint64_t *tileIndices, bool bEmptyTile,
+                            bool bUseMutex,
+                            ZarrByteVectorQuickResize &abyRawTileData,
+                            ZarrByteVectorQuickResize &abyTmpRawTileData,
+                            ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    // This method should NOT modify any ZarrArray member, as it may be
+    // called concurrently from several threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyTmpRawTileData cannot_use_here
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+#define m_oFiltersArray cannot_use_here
+#define m_oCompressorJSon cannot_use_here
+
+    std::string osFilename = BuildTileFilename(tileIndices);
+
+    const size_t nSourceSize =
+        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+
+    if (bEmptyTile)
+    {
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -838,12 +959,12 @@ bool ZarrV2Array::FlushDirtyTile() const
         return true;
     }
 
-    if (!m_abyDecodedTileData.empty())
+    if (!abyDecodedTileData.empty())
     {
         const size_t nDTSize = m_oType.GetSize();
-        const size_t nValues = m_abyDecodedTileData.size() / nDTSize;
-        GByte *pDst = &m_abyRawTileData[0];
-        const GByte *pSrc = m_abyDecodedTileData.data();
+        const size_t nValues = abyDecodedTileData.size() / nDTSize;
+        GByte *pDst = &abyRawTileData[0];
+        const GByte *pSrc = abyDecodedTileData.data();
         for (size_t i = 0; i < nValues;
              i++, pDst += nSourceSize, pSrc += nDTSize)
         {
@@ -853,42 +974,36 @@ bool ZarrV2Array::FlushDirtyTile() const
 
     if (m_bFortranOrder && !m_aoDims.empty())
     {
-        BlockTranspose(m_abyRawTileData, m_abyTmpRawTileData, false);
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        BlockTranspose(abyRawTileData, abyTmpRawTileData, false);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
-    size_t nRawDataSize = m_abyRawTileData.size();
-    for (const auto &oFilter : m_oFiltersArray)
+    size_t nRawDataSize = abyRawTileData.size();
+    for (const auto &oFilter : m_aoFilterCompressors)
     {
-        const auto osFilterId = oFilter["id"].ToString();
-        const auto psFilterCompressor = CPLGetCompressor(osFilterId.c_str());
-        CPLAssert(psFilterCompressor);
-
-        CPLStringList aosOptions;
-        for (const auto &obj : oFilter.GetChildren())
-        {
-            aosOptions.SetNameValue(obj.GetName().c_str(),
-                                    obj.ToString().c_str());
-        }
-        void *out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
+        const auto psFilterCompressor = oFilter.first;
+        void *out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
         if (!psFilterCompressor->pfnFunc(
-                m_abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
-                aosOptions.List(), psFilterCompressor->user_data))
+                abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
+                oFilter.second.List(), psFilterCompressor->user_data))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
-                     "Filter %s for tile %s failed", osFilterId.c_str(),
+                     "Filter %s for tile %s failed", psFilterCompressor->pszId,
                      osFilename.c_str());
             return false;
         }
 
         nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
     if (m_osDimSeparator == "/")
     {
         std::string osDir = CPLGetDirname(osFilename.c_str());
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
         VSIStatBufL sStat;
         if (VSIStatL(osDir.c_str(), &sStat) != 0)
         {
@@ -912,7 +1027,7 @@ bool ZarrV2Array::FlushDirtyTile() const
     bool bRet = true;
     if (m_psCompressor == nullptr)
     {
-        if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+        if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
             nRawDataSize)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -940,26 +1055,10 @@ bool ZarrV2Array::FlushDirtyTile() const
         {
             void *out_buffer = &abyCompressedData[0];
             size_t out_size = abyCompressedData.size();
-            CPLStringList aosOptions;
-            const auto &compressorConfig = m_oCompressorJSon;
-            for (const auto &obj : compressorConfig.GetChildren())
-            {
-                aosOptions.SetNameValue(obj.GetName().c_str(),
-                                        obj.ToString().c_str());
-            }
-            if (EQUAL(m_psCompressor->pszId, "blosc") &&
-                m_oType.GetClass() == GEDTC_NUMERIC)
-            {
-                aosOptions.SetNameValue(
-                    "TYPESIZE",
-                    CPLSPrintf("%d", GDALGetDataTypeSizeBytes(
-                                         GDALGetNonComplexDataType(
-                                             m_oType.GetNumericDataType()))));
-            }
-
             if (!m_psCompressor->pfnFunc(
-                    m_abyRawTileData.data(), nRawDataSize, &out_buffer,
-                    &out_size, aosOptions.List(), m_psCompressor->user_data))
+                    abyRawTileData.data(), nRawDataSize, &out_buffer,
+                    &out_size, m_aosCompressorOptions.List(),
+                    m_psCompressor->user_data))
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Compression of tile %s failed", osFilename.c_str());
@@ -980,6 +1079,12 @@ bool ZarrV2Array::FlushDirtyTile() const
     VSIFCloseL(fp);
 
     return bRet;
+
+#undef m_abyTmpRawTileData
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_oFiltersArray
+#undef m_oCompressorJSon
 }
 
 /************************************************************************/
@@ -91,9 +91,13 @@ ZarrV3Array::~ZarrV3Array()
 void ZarrV3Array::Flush()
 {
     if (!m_bValid)
+    {
+        WaitForTileWrites();
         return;
+    }
 
     ZarrV3Array::FlushDirtyTile();
+    WaitForTileWrites();
 
     if (!m_aoDims.empty())
     {
@@ -397,9 +401,14 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
     std::string osFilename = BuildTileFilename(tileIndices);
 
     // For network file systems, get the streaming version of the filename,
-    // as we don't need arbitrary seeking in the file
-    osFilename = VSIFileManager::GetHandler(osFilename.c_str())
-                     ->GetStreamingFilename(osFilename);
+    // as we don't need arbitrary seeking in the file, unless it is a shard
+    // whose index and inner chunks are read with ranged requests.
+    const bool bDecodeFromFile = poCodecs && poCodecs->CanDecodeFromFile();
+    if (!bDecodeFromFile)
+    {
+        osFilename = VSIFileManager::GetHandler(osFilename.c_str())
+                         ->GetStreamingFilename(osFilename);
+    }
 
     // First if we have a tile presence cache, check tile presence from it
     if (bUseMutex)
@@ -478,7 +487,18 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
         VSIFSeekL(fp, 0, SEEK_END);
         const auto nSize = VSIFTellL(fp);
         VSIFSeekL(fp, 0, SEEK_SET);
-        if (nSize > static_cast<vsi_l_offset>(std::numeric_limits<int>::max()))
+        if (bDecodeFromFile)
+        {
+            if (!poCodecs->DecodeFromFile(fp, nSize, abyRawTileData))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Decompression of tile %s failed",
+                         osFilename.c_str());
+                bRet = false;
+            }
+        }
+        else if (nSize >
+                 static_cast<vsi_l_offset>(std::numeric_limits<int>::max()))
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Too large tile %s",
                      osFilename.c_str());
@@ -578,6 +598,9 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
         return true;
     }
 
+    const GDALThreadReservation oThreadReservation(nThreadsMax);
+    nThreadsMax = oThreadReservation.GetThreadCount();
+
     const int nThreads =
         static_cast<int>(std::min(static_cast<size_t>(nThreadsMax), nReqTiles));
 
@@ -736,17 +759,84 @@ bool ZarrV3Array::FlushDirtyTile() const
         return true;
     m_bDirtyTile = false;
 
-    std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
-
-    const size_t nSourceSize =
-        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
     const auto &abyTile =
         m_abyDecodedTileData.empty() ? m_abyRawTileData : m_abyDecodedTileData;
+    const bool bEmptyTile = IsEmptyTile(abyTile);
+    if (bEmptyTile)
+        m_bCachedTiledEmpty = true;
 
-    if (IsEmptyTile(abyTile))
+    if (!CanWriteTilesAsynchronously())
     {
-        m_bCachedTiledEmpty = true;
+        return WriteTile(m_anCachedTiledIndices.data(), bEmptyTile,
+                         /* bUseMutex = */ false, m_poCodecs.get(),
+                         m_abyRawTileData, m_abyDecodedTileData);
+    }
+
+    // Give a copy of the tile, and of the codecs (that are not thread-safe),
+    // to a worker thread, so that the current tile remains usable.
+    struct TileBuffers
+    {
+        std::unique_ptr<ZarrV3CodecSequence> poCodecs{};
+        ZarrByteVectorQuickResize abyRawTileData{};
+        ZarrByteVectorQuickResize abyDecodedTileData{};
+    };
 
+    auto poBuffers = std::make_shared<TileBuffers>();
+    try
+    {
+        if (m_abyDecodedTileData.empty())
+        {
+            poBuffers->abyRawTileData.CopyFrom(m_abyRawTileData);
+        }
+        else
+        {
+            poBuffers->abyRawTileData.resize(m_abyRawTileData.size());
+            poBuffers->abyDecodedTileData.CopyFrom(m_abyDecodedTileData);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    if (m_poCodecs && !bEmptyTile)
+        poBuffers->poCodecs = m_poCodecs->Clone();
+
+    const std::vector<uint64_t> anTileIndices(m_anCachedTiledIndices);
+    return SubmitTileWrite(
+        [this, anTileIndices, bEmptyTile, poBuffers]()
+        {
+            return WriteTile(anTileIndices.data(), bEmptyTile,
+                             /* bUseMutex = */ true, poBuffers->poCodecs.get(),
+                             poBuffers->abyRawTileData,
+                             poBuffers->abyDecodedTileData);
+        });
+}
+
+/************************************************************************/
+/*                      ZarrV3Array::WriteTile()                        */
+/************************************************************************/
+
+bool ZarrV3Array::WriteTile(const uint64_t *tileIndices, bool bEmptyTile,
+                            bool bUseMutex, ZarrV3CodecSequence *poCodecs,
+                            ZarrByteVectorQuickResize &abyRawTileData,
+                            ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    // This method should NOT modify any ZarrArray member, as it may be
+    // called concurrently from several threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+#define m_poCodecs cannot_use_here
+
+    std::string osFilename = BuildTileFilename(tileIndices);
+
+    const size_t nSourceSize =
+        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+
+    if (bEmptyTile)
+    {
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -758,12 +848,12 @@ bool ZarrV3Array::FlushDirtyTile() const
         return true;
     }
 
-    if (!m_abyDecodedTileData.empty())
+    if (!abyDecodedTileData.empty())
     {
         const size_t nDTSize = m_oType.GetSize();
-        const size_t nValues = m_abyDecodedTileData.size() / nDTSize;
-        GByte *pDst = &m_abyRawTileData[0];
-        const GByte *pSrc = m_abyDecodedTileData.data();
+        const size_t nValues = abyDecodedTileData.size() / nDTSize;
+        GByte *pDst = &abyRawTileData[0];
+        const GByte *pSrc = abyDecodedTileData.data();
         for (size_t i = 0; i < nValues;
              i++, pDst += nSourceSize, pSrc += nDTSize)
         {
@@ -771,12 +861,12 @@ bool ZarrV3Array::FlushDirtyTile() const
         }
     }
 
-    const size_t nSizeBefore = m_abyRawTileData.size();
-    if (m_poCodecs)
+    const size_t nSizeBefore = abyRawTileData.size();
+    if (poCodecs)
     {
-        if (!m_poCodecs->Encode(m_abyRawTileData))
+        if (!poCodecs->Encode(abyRawTileData))
         {
-            m_abyRawTileData.resize(nSizeBefore);
+            abyRawTileData.resize(nSizeBefore);
             return false;
         }
     }
@@ -784,6 +874,9 @@ bool ZarrV3Array::FlushDirtyTile() const
     if (m_osDimSeparator == "/")
     {
         std::string osDir = CPLGetDirname(osFilename.c_str());
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
         VSIStatBufL sStat;
         if (VSIStatL(osDir.c_str(), &sStat) != 0)
         {
@@ -791,7 +884,7 @@ bool ZarrV3Array::FlushDirtyTile() const
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
-                m_abyRawTileData.resize(nSizeBefore);
+                abyRawTileData.resize(nSizeBefore);
                 return false;
             }
         }
@@ -802,13 +895,13 @@ bool ZarrV3Array::FlushDirtyTile() const
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
                  osFilename.c_str());
-        m_abyRawTileData.resize(nSizeBefore);
+        abyRawTileData.resize(nSizeBefore);
         return false;
     }
 
     bool bRet = true;
-    const size_t nRawDataSize = m_abyRawTileData.size();
-    if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+    const size_t nRawDataSize = abyRawTileData.size();
+    if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
         nRawDataSize)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -817,9 +910,13 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
     VSIFCloseL(fp);
 
-    m_abyRawTileData.resize(nSizeBefore);
+    abyRawTileData.resize(nSizeBefore);
 
     return bRet;
+
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_poCodecs
 }
 
 /************************************************************************/
@@ -1258,14 +1355,13 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
                     CPLFormFilename(CPLFormFilename(osDirName.c_str(),
                                                     osDimName.c_str(), nullptr),
                                     "zarr.json", nullptr);
-                VSIStatBufL sStat;
-                if (VSIStatL(osArrayFilenameDim.c_str(), &sStat) == 0)
+                CPLJSONObject oDimRoot;
+                if (m_poSharedResource->LoadZarrV3Json(osArrayFilenameDim,
+                                                       oDimRoot))
                 {
-                    CPLJSONDocument oDoc;
-                    if (oDoc.Load(osArrayFilenameDim))
+                    if (oDimRoot.IsValid())
                     {
-                        LoadArray(osDimName, osArrayFilenameDim,
-                                  oDoc.GetRoot());
+                        LoadArray(osDimName, osArrayFilenameDim, oDimRoot);
                     }
                 }
                 else
@@ -1565,6 +1661,13 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
             oInputArrayMetadata.anBlockSizes.push_back(
                 static_cast<size_t>(nSize));
         oInputArrayMetadata.oElt = aoDtypeElts.back();
+        // Used by the sharding_indexed codec for missing inner chunks
+        if (aoDtypeElts.size() == 1 &&
+            !aoDtypeElts.back().gdalTypeIsApproxOfNative &&
+            abyNoData.size() == aoDtypeElts.back().nativeSize)
+        {
+            oInputArrayMetadata.abyNoData = abyNoData;
+        }
         poCodecs = std::make_unique<ZarrV3CodecSequence>(oInputArrayMetadata);
         if (!poCodecs->InitFromJson(oCodecs))
             return nullptr;
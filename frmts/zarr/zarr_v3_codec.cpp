@@ -29,6 +29,12 @@
 #include "zarr.h"
 
 #include "cpl_compressor.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
 
 /************************************************************************/
 /*                          ZarrV3Codec()                               */
@@ -916,6 +922,149 @@ bool ZarrV3CodecTranspose::Decode(const ZarrByteVectorQuickResize &abySrc,
     return Transpose(abySrc, abyDst, false);
 }
 
+/************************************************************************/
+/*                          ZarrV3CodecCRC32C()                         */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::ZarrV3CodecCRC32C() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                         ~ZarrV3CodecCRC32C()                         */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::~ZarrV3CodecCRC32C() = default;
+
+/************************************************************************/
+/*                 ZarrV3CodecCRC32C::InitFromConfiguration()           */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec crc32c: configuration is not an object");
+            return false;
+        }
+
+        const auto aoChildren = configuration.GetChildren();
+        if (!aoChildren.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec crc32c: configuration contains a unhandled "
+                     "member: %s",
+                     aoChildren[0].GetName().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Clone()                       */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecCRC32C::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecCRC32C>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                           ComputeCRC32C()                            */
+/************************************************************************/
+
+// CRC-32 with the Castagnoli polynomial (reflected form 0x82F63B78)
+static uint32_t ComputeCRC32C(const GByte *pabyData, size_t nSize)
+{
+    static const std::array<uint32_t, 256> anTable = []()
+    {
+        std::array<uint32_t, 256> anRet{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t nVal = i;
+            for (int j = 0; j < 8; ++j)
+                nVal = (nVal & 1) ? (nVal >> 1) ^ 0x82F63B78U : (nVal >> 1);
+            anRet[i] = nVal;
+        }
+        return anRet;
+    }();
+
+    uint32_t nCRC = 0xFFFFFFFFU;
+    for (size_t i = 0; i < nSize; ++i)
+        nCRC = anTable[(nCRC ^ pabyData[i]) & 0xFF] ^ (nCRC >> 8);
+    return nCRC ^ 0xFFFFFFFFU;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecCRC32C::Encode()                     */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Encode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nSize = abySrc.size();
+    try
+    {
+        abyDst.resize(nSize + sizeof(uint32_t));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    uint32_t nCRC = ComputeCRC32C(abySrc.data(), nSize);
+    CPL_LSBPTR32(&nCRC);
+    memcpy(abyDst.data() + nSize, &nCRC, sizeof(nCRC));
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecCRC32C::Decode()                     */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Decode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    if (abySrc.size() < sizeof(uint32_t))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec crc32c: input buffer too small");
+        return false;
+    }
+    const size_t nSize = abySrc.size() - sizeof(uint32_t);
+    uint32_t nExpectedCRC = 0;
+    memcpy(&nExpectedCRC, abySrc.data() + nSize, sizeof(nExpectedCRC));
+    CPL_LSBPTR32(&nExpectedCRC);
+    if (ComputeCRC32C(abySrc.data(), nSize) != nExpectedCRC)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Codec crc32c: CRC mismatch");
+        return false;
+    }
+    abyDst.resize(nSize);
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    return true;
+}
+
 /************************************************************************/
 /*                    ZarrV3CodecSequence::Clone()                      */
 /************************************************************************/
@@ -980,10 +1129,15 @@ bool ZarrV3CodecSequence::InitFromJson(const CPLJSONObject &oCodecs)
             poCodec = std::make_unique<ZarrV3CodecGZip>();
         else if (osName == "blosc")
             poCodec = std::make_unique<ZarrV3CodecBlosc>();
-        else if (osName == "endian")
+        // "bytes" is the name of the "endian" codec in the final spec
+        else if (osName == "endian" || osName == "bytes")
             poCodec = std::make_unique<ZarrV3CodecEndian>();
         else if (osName == "transpose")
             poCodec = std::make_unique<ZarrV3CodecTranspose>();
+        else if (osName == "crc32c")
+            poCodec = std::make_unique<ZarrV3CodecCRC32C>();
+        else if (osName == "sharding_indexed")
+            poCodec = std::make_unique<ZarrV3CodecShardingIndexed>();
         else
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unsupported codec: %s",
@@ -1107,3 +1261,829 @@ bool ZarrV3CodecSequence::Decode(ZarrByteVectorQuickResize &abyBuffer)
     }
     return true;
 }
+
+/************************************************************************/
+/*                ZarrV3CodecSequence::CanDecodeFromFile()              */
+/************************************************************************/
+
+bool ZarrV3CodecSequence::CanDecodeFromFile() const
+{
+    return !m_apoCodecs.empty() &&
+           m_apoCodecs.back()->GetName() == ZarrV3CodecShardingIndexed::NAME;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecSequence::DecodeFromFile()                */
+/************************************************************************/
+
+bool ZarrV3CodecSequence::DecodeFromFile(VSILFILE *fp, vsi_l_offset nFileSize,
+                                         ZarrByteVectorQuickResize &abyBuffer)
+{
+    CPLAssert(CanDecodeFromFile());
+    if (!AllocateBuffer(abyBuffer))
+        return false;
+    const auto poShardingCodec =
+        cpl::down_cast<const ZarrV3CodecShardingIndexed *>(
+            m_apoCodecs.back().get());
+    if (!poShardingCodec->DecodeFromFile(fp, nFileSize, abyBuffer))
+        return false;
+    for (auto iter = m_apoCodecs.rbegin() + 1; iter != m_apoCodecs.rend();
+         ++iter)
+    {
+        const auto &poCodec = *iter;
+        if (!poCodec->Decode(abyBuffer, m_abyTmp))
+            return false;
+        std::swap(abyBuffer, m_abyTmp);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::ZarrV3CodecShardingIndexed() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                    ~ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::~ZarrV3CodecShardingIndexed() = default;
+
+/************************************************************************/
+/*                           GetConfiguration()                         */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3CodecShardingIndexed::GetConfiguration(
+    const std::vector<GUInt64> &anInnerBlockSize, const CPLJSONArray &oCodecs)
+{
+    CPLJSONObject oConfig;
+    CPLJSONArray oChunkShape;
+    for (const auto nVal : anInnerBlockSize)
+        oChunkShape.Add(static_cast<uint64_t>(nVal));
+    oConfig.Add("chunk_shape", oChunkShape);
+    oConfig.Add("codecs", oCodecs);
+
+    CPLJSONArray oIndexCodecs;
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecEndian::NAME);
+        oCodec.Add("configuration", ZarrV3CodecEndian::GetConfiguration(true));
+        oIndexCodecs.Add(oCodec);
+    }
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecCRC32C::NAME);
+        oIndexCodecs.Add(oCodec);
+    }
+    oConfig.Add("index_codecs", oIndexCodecs);
+    oConfig.Add("index_location", "end");
+    return oConfig;
+}
+
+/************************************************************************/
+/*              ZarrV3CodecShardingIndexed::InitFromConfiguration()     */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (!configuration.IsValid() ||
+        configuration.GetType() != CPLJSONObject::Type::Object)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: configuration missing or not an "
+                 "object");
+        return false;
+    }
+
+    for (const auto &oChild : configuration.GetChildren())
+    {
+        const auto osName = oChild.GetName();
+        if (osName != "chunk_shape" && osName != "codecs" &&
+            osName != "index_codecs" && osName != "index_location")
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: configuration contains a "
+                     "unhandled member: %s",
+                     osName.c_str());
+            return false;
+        }
+    }
+
+    const auto &anShardSize = oInputArrayMetadata.anBlockSizes;
+    const size_t nDims = anShardSize.size();
+    if (nDims == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Codec sharding_indexed: not supported on 0-dimensional "
+                 "arrays");
+        return false;
+    }
+
+    const auto oChunkShape = configuration.GetArray("chunk_shape");
+    if (!oChunkShape.IsValid() ||
+        static_cast<size_t>(oChunkShape.Size()) != nDims)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: chunk_shape missing or not an array "
+                 "with the expected number of elements");
+        return false;
+    }
+
+    const size_t nEltSize = oInputArrayMetadata.oElt.nativeSize;
+    m_anInnerBlockSize.clear();
+    m_anInnerBlockCount.clear();
+    m_nInnerBlockCount = 1;
+    m_nInnerBlockRawSize = nEltSize;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const auto oVal = oChunkShape[static_cast<int>(i)];
+        const GInt64 nVal = oVal.ToLong();
+        if ((oVal.GetType() != CPLJSONObject::Type::Integer &&
+             oVal.GetType() != CPLJSONObject::Type::Long) ||
+            nVal <= 0 || static_cast<uint64_t>(nVal) > anShardSize[i] ||
+            (anShardSize[i] % static_cast<size_t>(nVal)) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[%d] is not a "
+                     "strictly positive integer dividing the shard shape",
+                     static_cast<int>(i));
+            return false;
+        }
+        m_anInnerBlockSize.push_back(static_cast<size_t>(nVal));
+        m_anInnerBlockCount.push_back(anShardSize[i] /
+                                      static_cast<size_t>(nVal));
+        // Cannot overflow, as bounded by the number of elements in the shard
+        m_nInnerBlockCount *= m_anInnerBlockCount.back();
+        m_nInnerBlockRawSize *= m_anInnerBlockSize.back();
+    }
+    if (m_nInnerBlockCount >
+        static_cast<size_t>(std::numeric_limits<int>::max()) /
+            (2 * sizeof(uint64_t)))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Codec sharding_indexed: too many inner chunks per shard");
+        return false;
+    }
+
+    m_anShardStride.resize(nDims);
+    m_anShardStride[nDims - 1] = nEltSize;
+    for (size_t i = nDims - 1; i > 0; --i)
+        m_anShardStride[i - 1] = m_anShardStride[i] * anShardSize[i];
+
+    const auto osIndexLocation =
+        configuration.GetString("index_location", "end");
+    if (osIndexLocation == "end")
+        m_bIndexAtEnd = true;
+    else if (osIndexLocation == "start")
+        m_bIndexAtEnd = false;
+    else
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: invalid value for index_location");
+        return false;
+    }
+
+    ZarrArrayMetadata oInnerArrayMetadata = oInputArrayMetadata;
+    oInnerArrayMetadata.anBlockSizes = m_anInnerBlockSize;
+    m_poCodecs = std::make_unique<ZarrV3CodecSequence>(oInnerArrayMetadata);
+    if (!m_poCodecs->InitFromJson(configuration.GetObj("codecs")))
+        return false;
+
+    // The index is an array of (offset, nbytes) pairs of uint64 values, with
+    // one pair per inner chunk.
+    ZarrArrayMetadata oIndexArrayMetadata;
+    oIndexArrayMetadata.oElt.nativeType = DtypeElt::NativeType::UNSIGNED_INT;
+    oIndexArrayMetadata.oElt.nativeSize = sizeof(uint64_t);
+    oIndexArrayMetadata.oElt.gdalType =
+        GDALExtendedDataType::Create(GDT_UInt64);
+    oIndexArrayMetadata.oElt.gdalSize = sizeof(uint64_t);
+    oIndexArrayMetadata.anBlockSizes = m_anInnerBlockCount;
+    oIndexArrayMetadata.anBlockSizes.push_back(2);
+
+    // The size of the encoded index must be known before reading it, so
+    // only fixed-size codecs are accepted.
+    const auto oIndexCodecs = configuration.GetObj("index_codecs");
+    size_t nChecksumCount = 0;
+    if (oIndexCodecs.GetType() == CPLJSONObject::Type::Array)
+    {
+        for (const auto &oCodec : oIndexCodecs.ToArray())
+        {
+            const auto osName = oCodec["name"].ToString();
+            if (osName == ZarrV3CodecCRC32C::NAME)
+                ++nChecksumCount;
+            else if (osName != ZarrV3CodecEndian::NAME && osName != "bytes" &&
+                     osName != ZarrV3CodecTranspose::NAME)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Codec sharding_indexed: unsupported codec %s in "
+                         "index_codecs",
+                         osName.c_str());
+                return false;
+            }
+        }
+    }
+    m_poIndexCodecs =
+        std::make_unique<ZarrV3CodecSequence>(oIndexArrayMetadata);
+    if (!m_poIndexCodecs->InitFromJson(oIndexCodecs))
+        return false;
+    m_nIndexSize = 2 * sizeof(uint64_t) * m_nInnerBlockCount +
+                   sizeof(uint32_t) * nChecksumCount;
+
+    return true;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Clone()                  */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecShardingIndexed::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecShardingIndexed>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*             ZarrV3CodecShardingIndexed::CopyInnerChunk()             */
+/************************************************************************/
+
+// Copy the content of inner chunk iChunk from pabySrc to pabyDst, pabySrc
+// being the shard buffer and pabyDst the inner chunk buffer if bToShard is
+// false, or the reverse if bToShard is true.
+void ZarrV3CodecShardingIndexed::CopyInnerChunk(size_t iChunk,
+                                                const GByte *pabySrc,
+                                                GByte *pabyDst,
+                                                bool bToShard) const
+{
+    const size_t nDims = m_anInnerBlockSize.size();
+
+    // Offset of the first element of the inner chunk in the shard
+    size_t nShardOffset = 0;
+    for (size_t i = nDims; i > 0;)
+    {
+        --i;
+        const size_t nChunkIdx = iChunk % m_anInnerBlockCount[i];
+        iChunk /= m_anInnerBlockCount[i];
+        nShardOffset += nChunkIdx * m_anInnerBlockSize[i] * m_anShardStride[i];
+    }
+
+    // Copy line by line along the fastest varying dimension
+    const size_t nLineSize = m_anInnerBlockSize.back() * m_anShardStride.back();
+    std::vector<size_t> anIdx(nDims, 0);
+    size_t nChunkOffset = 0;
+    while (true)
+    {
+        size_t nOffset = nShardOffset;
+        for (size_t i = 0; i + 1 < nDims; ++i)
+            nOffset += anIdx[i] * m_anShardStride[i];
+        if (bToShard)
+            memcpy(pabyDst + nOffset, pabySrc + nChunkOffset, nLineSize);
+        else
+            memcpy(pabyDst + nChunkOffset, pabySrc + nOffset, nLineSize);
+        nChunkOffset += nLineSize;
+
+        size_t i = nDims - 1;
+        for (; i > 0; --i)
+        {
+            if (++anIdx[i - 1] < m_anInnerBlockSize[i - 1])
+                break;
+            anIdx[i - 1] = 0;
+        }
+        if (i == 0)
+            break;
+    }
+}
+
+/************************************************************************/
+/*                     GetInnerChunkThreadCount()                       */
+/************************************************************************/
+
+// Number of threads to use to encode or decode nChunks inner chunks
+static int GetInnerChunkThreadCount(size_t nChunks)
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::max(1, std::min(nThreads, 1024));
+    if (static_cast<size_t>(nThreads) > nChunks)
+        nThreads = static_cast<int>(std::max<size_t>(1, nChunks));
+    return nThreads;
+}
+
+/************************************************************************/
+/*                         RunInnerChunkJobs()                          */
+/************************************************************************/
+
+// Runs fnJob(iThread, iFirst, iLast) on nThreads contiguous sub-ranges of
+// [0, nItems), using the global thread pool.
+static bool
+RunInnerChunkJobs(size_t nItems, int nThreads,
+                  const std::function<bool(int, size_t, size_t)> &fnJob)
+{
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        return fnJob(0, 0, nItems);
+    auto poQueue = poThreadPool->CreateJobQueue();
+
+    struct Job
+    {
+        const std::function<bool(int, size_t, size_t)> *pfnJob = nullptr;
+        int iThread = 0;
+        size_t iFirst = 0;
+        size_t iLast = 0;
+        bool bRet = false;
+    };
+
+    const auto JobRunner = [](void *pData)
+    {
+        auto psJob = static_cast<Job *>(pData);
+        psJob->bRet =
+            (*(psJob->pfnJob))(psJob->iThread, psJob->iFirst, psJob->iLast);
+    };
+
+    std::vector<Job> asJobs(nThreads);
+    for (int i = 0; i < nThreads; ++i)
+    {
+        asJobs[i].pfnJob = &fnJob;
+        asJobs[i].iThread = i;
+        asJobs[i].iFirst = static_cast<size_t>(i) * nItems / nThreads;
+        asJobs[i].iLast = static_cast<size_t>(i + 1) * nItems / nThreads;
+        if (!poQueue->SubmitJob(JobRunner, &asJobs[i]))
+            JobRunner(&asJobs[i]);
+    }
+    poQueue->WaitCompletion();
+
+    bool bRet = true;
+    for (const auto &sJob : asJobs)
+        bRet = bRet && sJob.bRet;
+    return bRet;
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::Encode()                   */
+/************************************************************************/
+
+constexpr uint64_t EMPTY_INNER_CHUNK = std::numeric_limits<uint64_t>::max();
+
+bool ZarrV3CodecShardingIndexed::Encode(const ZarrByteVectorQuickResize &abySrc,
+                                        ZarrByteVectorQuickResize &abyDst) const
+{
+    if (abySrc.size() < m_nInnerBlockCount * m_nInnerBlockRawSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecShardingIndexed::Encode(): input buffer too "
+                 "small");
+        return false;
+    }
+
+    // Inner chunks only made of the fill value are not written
+    const auto &abyNoData = m_oInputArrayMetadata.abyNoData;
+    const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+    const bool bHasNoData = abyNoData.size() == nEltSize;
+
+    std::vector<ZarrByteVectorQuickResize> aabyEncoded;
+    std::vector<uint8_t> abIsEmpty;
+    try
+    {
+        aabyEncoded.resize(m_nInnerBlockCount);
+        abIsEmpty.resize(m_nInnerBlockCount);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    GDALThreadReservation oThreadReservation(
+        GetInnerChunkThreadCount(m_nInnerBlockCount));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    std::vector<std::unique_ptr<ZarrV3CodecSequence>> apoCodecs;
+    for (int i = 1; i < nThreads; ++i)
+        apoCodecs.emplace_back(m_poCodecs->Clone());
+
+    std::atomic<bool> bFailure{false};
+    const auto EncodeJob = [this, &abySrc, &abyNoData, nEltSize, bHasNoData,
+                            &aabyEncoded, &abIsEmpty, &apoCodecs,
+                            &bFailure](int iThread, size_t iFirst, size_t iLast)
+    {
+        ZarrV3CodecSequence *poCodecs =
+            iThread == 0 ? m_poCodecs.get() : apoCodecs[iThread - 1].get();
+        for (size_t iChunk = iFirst; iChunk < iLast && !bFailure; ++iChunk)
+        {
+            auto &abyChunk = aabyEncoded[iChunk];
+            try
+            {
+                abyChunk.resize(m_nInnerBlockRawSize);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+                bFailure = true;
+                return false;
+            }
+            CopyInnerChunk(iChunk, abySrc.data(), abyChunk.data(), false);
+
+            if (bHasNoData)
+            {
+                bool bEmpty = true;
+                for (size_t i = 0; bEmpty && i < m_nInnerBlockRawSize;
+                     i += nEltSize)
+                {
+                    bEmpty = memcmp(abyChunk.data() + i, abyNoData.data(),
+                                    nEltSize) == 0;
+                }
+                if (bEmpty)
+                {
+                    abIsEmpty[iChunk] = true;
+                    abyChunk.resize(0);
+                    continue;
+                }
+            }
+
+            if (!poCodecs->Encode(abyChunk))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec sharding_indexed: encoding of inner chunk %u "
+                         "failed",
+                         static_cast<unsigned>(iChunk));
+                bFailure = true;
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!RunInnerChunkJobs(m_nInnerBlockCount, nThreads, EncodeJob) ||
+        bFailure)
+    {
+        return false;
+    }
+
+    // Build the index
+    std::vector<uint64_t> anIndex(2 * m_nInnerBlockCount);
+    size_t nOffset = m_bIndexAtEnd ? 0 : m_nIndexSize;
+    for (size_t iChunk = 0; iChunk < m_nInnerBlockCount; ++iChunk)
+    {
+        if (abIsEmpty[iChunk])
+        {
+            anIndex[2 * iChunk] = EMPTY_INNER_CHUNK;
+            anIndex[2 * iChunk + 1] = EMPTY_INNER_CHUNK;
+        }
+        else
+        {
+            anIndex[2 * iChunk] = nOffset;
+            anIndex[2 * iChunk + 1] = aabyEncoded[iChunk].size();
+            nOffset += aabyEncoded[iChunk].size();
+        }
+    }
+
+    ZarrByteVectorQuickResize abyIndex;
+    abyIndex.resize(anIndex.size() * sizeof(uint64_t));
+    memcpy(abyIndex.data(), anIndex.data(), abyIndex.size());
+    if (!m_poIndexCodecs->Encode(abyIndex) || abyIndex.size() != m_nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: encoding of shard index failed");
+        return false;
+    }
+
+    try
+    {
+        abyDst.resize(nOffset + (m_bIndexAtEnd ? m_nIndexSize : 0));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    GByte *pabyDst = abyDst.data();
+    if (!m_bIndexAtEnd)
+    {
+        memcpy(pabyDst, abyIndex.data(), m_nIndexSize);
+        pabyDst += m_nIndexSize;
+    }
+    for (const auto &abyChunk : aabyEncoded)
+    {
+        if (!abyChunk.empty())
+        {
+            memcpy(pabyDst, abyChunk.data(), abyChunk.size());
+            pabyDst += abyChunk.size();
+        }
+    }
+    if (m_bIndexAtEnd)
+    {
+        memcpy(pabyDst, abyIndex.data(), m_nIndexSize);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::DecodeIndex()              */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::DecodeIndex(
+    ZarrByteVectorQuickResize &abyIndex, uint64_t nShardSize,
+    std::vector<uint64_t> &anIndex) const
+{
+    if (!m_poIndexCodecs->Decode(abyIndex) ||
+        abyIndex.size() != 2 * sizeof(uint64_t) * m_nInnerBlockCount)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: decoding of shard index failed");
+        return false;
+    }
+
+    try
+    {
+        anIndex.resize(2 * m_nInnerBlockCount);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    memcpy(anIndex.data(), abyIndex.data(), abyIndex.size());
+
+    for (size_t iChunk = 0; iChunk < m_nInnerBlockCount; ++iChunk)
+    {
+        const uint64_t nOffset = anIndex[2 * iChunk];
+        const uint64_t nSize = anIndex[2 * iChunk + 1];
+        if (nOffset == EMPTY_INNER_CHUNK && nSize == EMPTY_INNER_CHUNK)
+            continue;
+        if (nSize > nShardSize || nOffset > nShardSize - nSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: invalid index entry for inner "
+                     "chunk %u",
+                     static_cast<unsigned>(iChunk));
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*            ZarrV3CodecShardingIndexed::DecodeInnerChunks()           */
+/************************************************************************/
+
+// Decode the inner chunks into abyDst, apabyChunkData[i] pointing to the
+// encoded data of inner chunk i, or being null for a missing chunk.
+bool ZarrV3CodecShardingIndexed::DecodeInnerChunks(
+    const std::vector<uint64_t> &anIndex,
+    const std::vector<const GByte *> &apabyChunkData,
+    ZarrByteVectorQuickResize &abyDst) const
+{
+    try
+    {
+        abyDst.resize(m_nInnerBlockCount * m_nInnerBlockRawSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    // Missing inner chunks are filled with the fill value
+    std::vector<size_t> anChunks;
+    std::vector<GByte> abyFillChunk;
+    for (size_t iChunk = 0; iChunk < m_nInnerBlockCount; ++iChunk)
+    {
+        if (apabyChunkData[iChunk])
+        {
+            anChunks.push_back(iChunk);
+            continue;
+        }
+        if (abyFillChunk.empty())
+        {
+            const auto &abyNoData = m_oInputArrayMetadata.abyNoData;
+            const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+            abyFillChunk.resize(m_nInnerBlockRawSize);
+            if (abyNoData.size() == nEltSize)
+            {
+                for (size_t i = 0; i < m_nInnerBlockRawSize; i += nEltSize)
+                    memcpy(&abyFillChunk[i], abyNoData.data(), nEltSize);
+            }
+        }
+        CopyInnerChunk(iChunk, abyFillChunk.data(), abyDst.data(), true);
+    }
+
+    GDALThreadReservation oThreadReservation(
+        GetInnerChunkThreadCount(anChunks.size()));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    std::vector<std::unique_ptr<ZarrV3CodecSequence>> apoCodecs;
+    for (int i = 1; i < nThreads; ++i)
+        apoCodecs.emplace_back(m_poCodecs->Clone());
+
+    std::atomic<bool> bFailure{false};
+    const auto DecodeJob = [this, &anIndex, &apabyChunkData, &abyDst, &anChunks,
+                            &apoCodecs,
+                            &bFailure](int iThread, size_t iFirst, size_t iLast)
+    {
+        ZarrV3CodecSequence *poCodecs =
+            iThread == 0 ? m_poCodecs.get() : apoCodecs[iThread - 1].get();
+        ZarrByteVectorQuickResize abyChunk;
+        for (size_t i = iFirst; i < iLast && !bFailure; ++i)
+        {
+            const size_t iChunk = anChunks[i];
+            const size_t nSize = static_cast<size_t>(anIndex[2 * iChunk + 1]);
+            try
+            {
+                abyChunk.resize(nSize);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+                bFailure = true;
+                return false;
+            }
+            if (nSize)
+                memcpy(abyChunk.data(), apabyChunkData[iChunk], nSize);
+            if (!poCodecs->Decode(abyChunk) ||
+                abyChunk.size() != m_nInnerBlockRawSize)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec sharding_indexed: decoding of inner chunk %u "
+                         "failed",
+                         static_cast<unsigned>(iChunk));
+                bFailure = true;
+                return false;
+            }
+            CopyInnerChunk(iChunk, abyChunk.data(), abyDst.data(), true);
+        }
+        return true;
+    };
+    return RunInnerChunkJobs(anChunks.size(), nThreads, DecodeJob) &&
+           !bFailure;
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::Decode()                   */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Decode(const ZarrByteVectorQuickResize &abySrc,
+                                        ZarrByteVectorQuickResize &abyDst) const
+{
+    if (abySrc.size() < m_nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: shard too small");
+        return false;
+    }
+
+    ZarrByteVectorQuickResize abyIndex;
+    try
+    {
+        abyIndex.resize(m_nIndexSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    memcpy(abyIndex.data(),
+           abySrc.data() + (m_bIndexAtEnd ? abySrc.size() - m_nIndexSize : 0),
+           m_nIndexSize);
+
+    std::vector<uint64_t> anIndex;
+    if (!DecodeIndex(abyIndex, abySrc.size(), anIndex))
+        return false;
+
+    std::vector<const GByte *> apabyChunkData(m_nInnerBlockCount);
+    for (size_t iChunk = 0; iChunk < m_nInnerBlockCount; ++iChunk)
+    {
+        if (anIndex[2 * iChunk] != EMPTY_INNER_CHUNK)
+            apabyChunkData[iChunk] =
+                abySrc.data() + static_cast<size_t>(anIndex[2 * iChunk]);
+    }
+
+    return DecodeInnerChunks(anIndex, apabyChunkData, abyDst);
+}
+
+/************************************************************************/
+/*            ZarrV3CodecShardingIndexed::DecodeFromFile()              */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::DecodeFromFile(
+    VSILFILE *fp, vsi_l_offset nFileSize,
+    ZarrByteVectorQuickResize &abyDst) const
+{
+    if (nFileSize < m_nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: shard too small");
+        return false;
+    }
+
+    // Read the index with a single ranged request
+    ZarrByteVectorQuickResize abyIndex;
+    try
+    {
+        abyIndex.resize(m_nIndexSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    if (VSIFSeekL(fp, m_bIndexAtEnd ? nFileSize - m_nIndexSize : 0,
+                  SEEK_SET) != 0 ||
+        VSIFReadL(abyIndex.data(), 1, m_nIndexSize, fp) != m_nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Codec sharding_indexed: cannot read shard index");
+        return false;
+    }
+
+    std::vector<uint64_t> anIndex;
+    if (!DecodeIndex(abyIndex, nFileSize, anIndex))
+        return false;
+
+    // Sort non-empty inner chunks by offset, and coalesce contiguous ones
+    // into a single range.
+    std::vector<size_t> anChunks;
+    for (size_t iChunk = 0; iChunk < m_nInnerBlockCount; ++iChunk)
+    {
+        if (anIndex[2 * iChunk] != EMPTY_INNER_CHUNK)
+            anChunks.push_back(iChunk);
+    }
+    std::sort(anChunks.begin(), anChunks.end(),
+              [&anIndex](size_t a, size_t b)
+              { return anIndex[2 * a] < anIndex[2 * b]; });
+
+    std::vector<vsi_l_offset> anRangeOffsets;
+    std::vector<size_t> anRangeSizes;
+    // Position of each inner chunk in the buffer receiving the ranges
+    std::vector<size_t> anChunkPosInBuffer(m_nInnerBlockCount);
+    uint64_t nBufferSize = 0;
+    for (const size_t iChunk : anChunks)
+    {
+        const uint64_t nOffset = anIndex[2 * iChunk];
+        const uint64_t nSize = anIndex[2 * iChunk + 1];
+        if (nSize > std::numeric_limits<size_t>::max() - nBufferSize)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Codec sharding_indexed: too large shard");
+            return false;
+        }
+        if (anRangeOffsets.empty() ||
+            anRangeOffsets.back() + anRangeSizes.back() != nOffset)
+        {
+            anRangeOffsets.push_back(nOffset);
+            anRangeSizes.push_back(0);
+        }
+        anRangeSizes.back() += static_cast<size_t>(nSize);
+        anChunkPosInBuffer[iChunk] = static_cast<size_t>(nBufferSize);
+        nBufferSize += nSize;
+    }
+
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nBufferSize));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    if (!anRangeOffsets.empty())
+    {
+        std::vector<void *> apData;
+        size_t nPos = 0;
+        for (const size_t nRangeSize : anRangeSizes)
+        {
+            apData.push_back(abyBuffer.data() + nPos);
+            nPos += nRangeSize;
+        }
+        if (VSIFReadMultiRangeL(static_cast<int>(anRangeOffsets.size()),
+                                apData.data(), anRangeOffsets.data(),
+                                anRangeSizes.data(), fp) != 0)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Codec sharding_indexed: cannot read inner chunks");
+            return false;
+        }
+    }
+
+    std::vector<const GByte *> apabyChunkData(m_nInnerBlockCount);
+    for (const size_t iChunk : anChunks)
+        apabyChunkData[iChunk] = abyBuffer.data() + anChunkPosInBuffer[iChunk];
+
+    return DecodeInnerChunks(anIndex, apabyChunkData, abyDst);
+}
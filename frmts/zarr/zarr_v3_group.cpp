@@ -68,13 +68,11 @@ std::shared_ptr<ZarrArray> ZarrV3Group::OpenZarrArray(const std::string &osName,
     const std::string osZarrayFilename =
         CPLFormFilename(osSubDir.c_str(), "zarr.json", nullptr);
 
-    VSIStatBufL sStat;
-    if (VSIStatL(osZarrayFilename.c_str(), &sStat) == 0)
+    CPLJSONObject oRoot;
+    if (m_poSharedResource->LoadZarrV3Json(osZarrayFilename, oRoot))
     {
-        CPLJSONDocument oDoc;
-        if (!oDoc.Load(osZarrayFilename))
+        if (!oRoot.IsValid())
             return nullptr;
-        const auto oRoot = oDoc.GetRoot();
         return LoadArray(osName, osZarrayFilename, oRoot);
     }
 
@@ -94,13 +92,10 @@ void ZarrV3Group::LoadAttributes() const
     const std::string osFilename =
         CPLFormFilename(m_osDirectoryName.c_str(), "zarr.json", nullptr);
 
-    VSIStatBufL sStat;
-    if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+    CPLJSONObject oRoot;
+    if (m_poSharedResource->LoadZarrV3Json(osFilename, oRoot) &&
+        oRoot.IsValid())
     {
-        CPLJSONDocument oDoc;
-        if (!oDoc.Load(osFilename))
-            return;
-        auto oRoot = oDoc.GetRoot();
         m_oAttrGroup.Init(oRoot["attributes"], m_bUpdatable);
     }
 }
@@ -115,67 +110,67 @@ void ZarrV3Group::ExploreDirectory() const
         return;
     m_bDirectoryExplored = true;
 
-    auto psDir = VSIOpenDir(m_osDirectoryName.c_str(), 0, nullptr);
-    if (!psDir)
+    // No file access at all with consolidated metadata
+    if (m_poSharedResource->HasZarrV3ConsolidatedMetadata())
+    {
+        m_poSharedResource->GetZarrV3ConsolidatedChildren(
+            m_osDirectoryName, m_aosGroups, m_aosArrays);
         return;
-    while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+    }
+
+    for (const std::string &osSubDirName :
+         m_poSharedResource->GetZarrV3SubDirectories(m_osDirectoryName))
     {
-        if (VSI_ISDIR(psEntry->nMode))
+        const std::string osSubDir = CPLFormFilename(
+            m_osDirectoryName.c_str(), osSubDirName.c_str(), nullptr);
+        const std::string osZarrJsonFilename =
+            CPLFormFilename(osSubDir.c_str(), "zarr.json", nullptr);
+        CPLJSONObject oRoot;
+        if (m_poSharedResource->LoadZarrV3Json(osZarrJsonFilename, oRoot))
         {
-            const std::string osSubDir = CPLFormFilename(
-                m_osDirectoryName.c_str(), psEntry->pszName, nullptr);
-            VSIStatBufL sStat;
-            std::string osZarrJsonFilename =
-                CPLFormFilename(osSubDir.c_str(), "zarr.json", nullptr);
-            if (VSIStatL(osZarrJsonFilename.c_str(), &sStat) == 0)
+            if (oRoot.IsValid())
             {
-                CPLJSONDocument oDoc;
-                if (oDoc.Load(osZarrJsonFilename.c_str()))
+                if (oRoot.GetInteger("zarr_format") != 3)
                 {
-                    const auto oRoot = oDoc.GetRoot();
-                    if (oRoot.GetInteger("zarr_format") != 3)
-                    {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Unhandled zarr_format value");
-                        continue;
-                    }
-                    const std::string osNodeType = oRoot.GetString("node_type");
-                    if (osNodeType == "array")
-                    {
-                        if (std::find(m_aosArrays.begin(), m_aosArrays.end(),
-                                      psEntry->pszName) == m_aosArrays.end())
-                        {
-                            m_aosArrays.emplace_back(psEntry->pszName);
-                        }
-                    }
-                    else if (osNodeType == "group")
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Unhandled zarr_format value");
+                    continue;
+                }
+                const std::string osNodeType = oRoot.GetString("node_type");
+                if (osNodeType == "array")
+                {
+                    if (std::find(m_aosArrays.begin(), m_aosArrays.end(),
+                                  osSubDirName) == m_aosArrays.end())
                     {
-                        if (std::find(m_aosGroups.begin(), m_aosGroups.end(),
-                                      psEntry->pszName) == m_aosGroups.end())
-                        {
-                            m_aosGroups.emplace_back(psEntry->pszName);
-                        }
+                        m_aosArrays.emplace_back(osSubDirName);
                     }
-                    else
+                }
+                else if (osNodeType == "group")
+                {
+                    if (std::find(m_aosGroups.begin(), m_aosGroups.end(),
+                                  osSubDirName) == m_aosGroups.end())
                     {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Unhandled node_type value");
-                        continue;
+                        m_aosGroups.emplace_back(osSubDirName);
                     }
                 }
-            }
-            else
-            {
-                // Implicit group
-                if (std::find(m_aosGroups.begin(), m_aosGroups.end(),
-                              psEntry->pszName) == m_aosGroups.end())
+                else
                 {
-                    m_aosGroups.emplace_back(psEntry->pszName);
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Unhandled node_type value");
+                    continue;
                 }
             }
         }
+        else
+        {
+            // Implicit group
+            if (std::find(m_aosGroups.begin(), m_aosGroups.end(),
+                          osSubDirName) == m_aosGroups.end())
+            {
+                m_aosGroups.emplace_back(osSubDirName);
+            }
+        }
     }
-    VSICloseDir(psDir);
 }
 
 /************************************************************************/
@@ -229,14 +224,12 @@ ZarrV3Group::OpenZarrGroup(const std::string &osName, CSLConstList) const
     const std::string osSubDirZarrJsonFilename =
         CPLFormFilename(osSubDir.c_str(), "zarr.json", nullptr);
 
-    VSIStatBufL sStat;
     // Explicit group
-    if (VSIStatL(osSubDirZarrJsonFilename.c_str(), &sStat) == 0)
+    CPLJSONObject oRoot;
+    if (m_poSharedResource->LoadZarrV3Json(osSubDirZarrJsonFilename, oRoot))
     {
-        CPLJSONDocument oDoc;
-        if (oDoc.Load(osSubDirZarrJsonFilename.c_str()))
+        if (oRoot.IsValid())
         {
-            const auto oRoot = oDoc.GetRoot();
             if (oRoot.GetInteger("zarr_format") != 3)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -262,7 +255,7 @@ ZarrV3Group::OpenZarrGroup(const std::string &osName, CSLConstList) const
     }
 
     // Implicit group
-    if (VSIStatL(osSubDir.c_str(), &sStat) == 0 && VSI_ISDIR(sStat.st_mode))
+    if (m_poSharedResource->IsZarrV3Directory(osSubDir))
     {
         auto poSubGroup = ZarrV3Group::Create(m_poSharedResource, GetFullName(),
                                               osName, osSubDir);
@@ -666,6 +659,44 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
         return nullptr;
     }
 
+    const char *pszShardInnerBlockSize =
+        CSLFetchNameValue(papszOptions, "SHARD_INNER_BLOCKSIZE");
+    if (pszShardInnerBlockSize)
+    {
+        const CPLStringList aosTokens(
+            CSLTokenizeString2(pszShardInnerBlockSize, ",", 0));
+        if (static_cast<size_t>(aosTokens.size()) != anBlockSize.size() ||
+            anBlockSize.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid number of values in SHARD_INNER_BLOCKSIZE");
+            return nullptr;
+        }
+        std::vector<GUInt64> anInnerBlockSize;
+        for (size_t i = 0; i < anBlockSize.size(); ++i)
+        {
+            const GUInt64 nVal =
+                static_cast<GUInt64>(CPLAtoGIntBig(aosTokens[i]));
+            if (nVal == 0 || (anBlockSize[i] % nVal) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Values in SHARD_INNER_BLOCKSIZE should be > 0 and "
+                         "divide the values of BLOCKSIZE");
+                return nullptr;
+            }
+            anInnerBlockSize.push_back(nVal);
+        }
+
+        // Chunks become shards whose inner chunks use the above codecs
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecShardingIndexed::NAME);
+        oCodec.Add("configuration",
+                   ZarrV3CodecShardingIndexed::GetConfiguration(
+                       anInnerBlockSize, oCodecs));
+        oCodecs = CPLJSONArray();
+        oCodecs.Add(oCodec);
+    }
+
     if (oCodecs.Size() > 0)
     {
         // Byte swapping will be done by the codec chain
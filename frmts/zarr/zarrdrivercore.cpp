@@ -93,7 +93,8 @@ void ZARRDriverSetCommonMetadata(GDALDriver *poDriver)
         GDAL_DMD_OPENOPTIONLIST,
         "<OpenOptionList>"
         "   <Option name='USE_ZMETADATA' type='boolean' description='Whether "
-        "to use consolidated metadata from .zmetadata' default='YES'/>"
+        "to use consolidated metadata from .zmetadata (Zarr V2) or zarr.json "
+        "(Zarr V3)' default='YES'/>"
         "   <Option name='CACHE_TILE_PRESENCE' type='boolean' "
         "description='Whether to establish an initial listing of present "
         "tiles' default='NO'/>"
@@ -314,6 +314,31 @@ typedef void *GDALRelationshipH;
 /** Type to express pixel, line or band spacing. Signed 64 bit integer. */
 typedef GIntBig GSpacing;
 
+/** Window to read with GDALRasterReadMultiWindow().
+ * @since GDAL 3.10
+ */
+typedef struct
+{
+    /*! Pixel offset to the top left corner of the window */
+    int nXOff;
+    /*! Line offset to the top left corner of the window */
+    int nYOff;
+    /*! Width of the window, in pixels */
+    int nXSize;
+    /*! Height of the window, in lines */
+    int nYSize;
+    /*! Buffer into which the window is read */
+    void *pData;
+    /*! Width of the buffer, in pixels */
+    int nBufXSize;
+    /*! Height of the buffer, in lines */
+    int nBufYSize;
+    /*! Byte offset between pixels in pData, or 0 for the default */
+    GSpacing nPixelSpace;
+    /*! Byte offset between lines in pData, or 0 for the default */
+    GSpacing nLineSpace;
+} GDALRasterIOWindow;
+
 /** Enumeration giving the class of a GDALExtendedDataType.
  * @since GDAL 3.1
  */
@@ -1306,6 +1331,10 @@ bool CPL_DLL GDALDatasetUpdateRelationship(GDALDatasetH hDS,
                                            GDALRelationshipH hRelationship,
                                            char **ppszFailureReason);
 
+bool CPL_DLL GDALDatasetGetRasterArrowStream(
+    GDALDatasetH hDS, struct ArrowArrayStream *out_stream,
+    CSLConstList papszOptions);
+
 /** Type of functions to pass to GDALDatasetSetQueryLoggerFunc
  * @since GDAL 3.7 */
 typedef void (*GDALQueryLoggerFunc)(const char *pszSQL, const char *pszError,
@@ -1509,6 +1538,10 @@ CPLErr CPL_DLL CPL_STDCALL GDALRasterIOEx(
     int nDSXSize, int nDSYSize, void *pBuffer, int nBXSize, int nBYSize,
     GDALDataType eBDataType, GSpacing nPixelSpace, GSpacing nLineSpace,
     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
+CPLErr CPL_DLL GDALRasterReadMultiWindow(
+    GDALRasterBandH hBand, int nWindowCount,
+    const GDALRasterIOWindow *pasWindows, GDALDataType eBufType,
+    GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALReadBlock(GDALRasterBandH, int, int,
                                          void *) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALWriteBlock(GDALRasterBandH, int, int,
@@ -2187,6 +2220,34 @@ GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
 
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
+/** Statistics about the use of the raster block cache by a raster band or a
+ * dataset.
+ *
+ * @see GDALGetRasterBlockCacheStatistics(),
+ *      GDALDatasetGetBlockCacheStatistics()
+ * @since GDAL 3.10
+ */
+typedef struct
+{
+    /** Number of block requests served from the block cache. */
+    GUIntBig nHits;
+    /** Number of block requests that required a new block to be
+     * instantiated (and generally read). */
+    GUIntBig nMisses;
+    /** Number of dirty blocks that have been written. */
+    GUIntBig nDirtyBlocksWritten;
+    /** Number of blocks evicted from the global block cache to make room for
+     * other blocks. */
+    GUIntBig nEvictions;
+    /** Memory currently used in the block cache, in bytes. */
+    GIntBig nCacheUsed;
+} GDALBlockCacheStatistics;
+
+void CPL_DLL GDALGetRasterBlockCacheStatistics(
+    GDALRasterBandH hBand, GDALBlockCacheStatistics *psStats);
+void CPL_DLL GDALDatasetGetBlockCacheStatistics(
+    GDALDatasetH hDS, GDALBlockCacheStatistics *psStats);
+
 /* ==================================================================== */
 /*      GDAL virtual memory                                             */
 /* ==================================================================== */
@@ -2399,6 +2460,11 @@ int CPL_DLL GDALMDArrayAdviseReadEx(GDALMDArrayH hArray,
                                     const GUInt64 *arrayStartIdx,
                                     const size_t *count,
                                     CSLConstList papszOptions);
+int CPL_DLL GDALMDArrayDrill(GDALMDArrayH hArray, size_t iDim, size_t nPoints,
+                             const GUInt64 *panPointIndices, GUInt64 nStartIdx,
+                             size_t nCount,
+                             GDALExtendedDataTypeH bufferDataType,
+                             void *pDstBuffer, CSLConstList papszOptions);
 GDALAttributeH CPL_DLL GDALMDArrayGetAttribute(
     GDALMDArrayH hArray, const char *pszName) CPL_WARN_UNUSED_RESULT;
 GDALAttributeH CPL_DLL *
@@ -2463,6 +2529,9 @@ GDALDatasetH CPL_DLL GDALMDArrayAsClassicDatasetEx(GDALMDArrayH hArray,
                                                    size_t iXDim, size_t iYDim,
                                                    GDALGroupH hRootGroup,
                                                    CSLConstList papszOptions);
+bool CPL_DLL GDALMDArrayGetRasterArrowStream(
+    GDALMDArrayH hArray, struct ArrowArrayStream *out_stream,
+    CSLConstList papszOptions);
 CPLErr CPL_DLL GDALMDArrayGetStatistics(
     GDALMDArrayH hArray, GDALDatasetH, int bApproxOK, int bForce,
     double *pdfMin, double *pdfMax, double *pdfMean, double *pdfStdDev,
@@ -0,0 +1,231 @@
+/**********************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Process-wide cache of compressed block bytes
+ *
+ **********************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdal_compressed_block_cache.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+struct CompressedBlockCache
+{
+    using Entry =
+        std::pair<std::string, std::shared_ptr<const std::vector<GByte>>>;
+
+    std::mutex oMutex{};
+    // Most recently used entries first
+    std::list<Entry> oLRU{};
+    std::unordered_map<std::string, std::list<Entry>::iterator> oMap{};
+    size_t nTotalBytes = 0;
+
+    // Must be called with the mutex held
+    void Evict(GIntBig nMaxBytes)
+    {
+        while (!oLRU.empty() && static_cast<GIntBig>(nTotalBytes) > nMaxBytes)
+        {
+            nTotalBytes -= oLRU.back().second->size();
+            oMap.erase(oLRU.back().first);
+            oLRU.pop_back();
+        }
+    }
+};
+
+CompressedBlockCache &GetCache()
+{
+    static CompressedBlockCache sCache;
+    return sCache;
+}
+
+/************************************************************************/
+/*                            GetCacheMax()                             */
+/************************************************************************/
+
+// Same syntax as GDAL_CACHEMAX: a percentage of the usable physical RAM,
+// a number of megabytes if lower than 100000, or a number of bytes.
+GIntBig GetCacheMax()
+{
+    const char *pszCacheMax =
+        CPLGetConfigOption("GDAL_COMPRESSED_BLOCK_CACHEMAX", "0");
+    GIntBig nCacheMax;
+    if (strchr(pszCacheMax, '%') != nullptr)
+    {
+        const double dfCacheMax =
+            static_cast<double>(CPLGetUsablePhysicalRAM()) *
+            CPLAtof(pszCacheMax) / 100.0;
+        nCacheMax = dfCacheMax > 0 && dfCacheMax < 1e15
+                        ? static_cast<GIntBig>(dfCacheMax)
+                        : 0;
+    }
+    else
+    {
+        nCacheMax = CPLAtoGIntBig(pszCacheMax);
+        if (nCacheMax < 0)
+            nCacheMax = 0;
+        else if (nCacheMax < 100000)
+            nCacheMax *= 1024 * 1024;
+    }
+    return nCacheMax;
+}
+}  // namespace
+
+/************************************************************************/
+/*                 GDALCompressedBlockCacheIsEnabled()                  */
+/************************************************************************/
+
+/** Returns whether GDAL_COMPRESSED_BLOCK_CACHEMAX is set to a non-zero
+ * value.
+ *
+ * This is called for each block read, so the state is cached and only
+ * evaluated again when configuration options change.
+ */
+bool GDALCompressedBlockCacheIsEnabled()
+{
+    static CPLCachedBoolConfigOption gbEnabled("GDAL_COMPRESSED_BLOCK_CACHEMAX",
+                                               false);
+    static std::atomic<bool> gbWasEnabled{false};
+    if (gbEnabled.Get())
+    {
+        if (!gbWasEnabled.load(std::memory_order_relaxed))
+            gbWasEnabled.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Release the memory if the cache has been disabled meanwhile
+    if (gbWasEnabled.exchange(false))
+        GDALCompressedBlockCacheClear();
+    return false;
+}
+
+/************************************************************************/
+/*                    GDALCompressedBlockCacheGet()                     */
+/************************************************************************/
+
+/** Returns the cached content of a block, or nullptr. */
+std::shared_ptr<const std::vector<GByte>>
+GDALCompressedBlockCacheGet(const std::string &osKey)
+{
+    auto &oCache = GetCache();
+    std::lock_guard<std::mutex> oLock(oCache.oMutex);
+    const auto oIter = oCache.oMap.find(osKey);
+    if (oIter == oCache.oMap.end())
+        return nullptr;
+    oCache.oLRU.splice(oCache.oLRU.begin(), oCache.oLRU, oIter->second);
+    return oIter->second->second;
+}
+
+/************************************************************************/
+/*                    GDALCompressedBlockCachePut()                     */
+/************************************************************************/
+
+/** Adds the content of a block to the cache, evicting the least recently
+ * used ones if needed. */
+void GDALCompressedBlockCachePut(const std::string &osKey, const void *pData,
+                                 size_t nSize)
+{
+    const GIntBig nCacheMax = GetCacheMax();
+    if (static_cast<GIntBig>(nSize) > nCacheMax)
+        return;
+
+    std::shared_ptr<const std::vector<GByte>> poData;
+    try
+    {
+        poData = std::make_shared<const std::vector<GByte>>(
+            static_cast<const GByte *>(pData),
+            static_cast<const GByte *>(pData) + nSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return;
+    }
+
+    auto &oCache = GetCache();
+    std::lock_guard<std::mutex> oLock(oCache.oMutex);
+    const auto oIter = oCache.oMap.find(osKey);
+    if (oIter != oCache.oMap.end())
+    {
+        oCache.nTotalBytes -= oIter->second->second->size();
+        oCache.oLRU.erase(oIter->second);
+        oCache.oMap.erase(oIter);
+    }
+    oCache.oLRU.emplace_front(osKey, std::move(poData));
+    oCache.oMap[osKey] = oCache.oLRU.begin();
+    oCache.nTotalBytes += nSize;
+    oCache.Evict(nCacheMax);
+}
+
+/************************************************************************/
+/*                 GDALCompressedBlockCacheRemoveFile()                 */
+/************************************************************************/
+
+/** Removes the entries of a file from the cache, typically after it has been
+ * modified. */
+void GDALCompressedBlockCacheRemoveFile(const char *pszFilename)
+{
+    std::string osPrefix(pszFilename);
+    osPrefix += '\n';
+
+    auto &oCache = GetCache();
+    std::lock_guard<std::mutex> oLock(oCache.oMutex);
+    for (auto oIter = oCache.oLRU.begin(); oIter != oCache.oLRU.end();)
+    {
+        if (oIter->first.compare(0, osPrefix.size(), osPrefix) == 0)
+        {
+            oCache.nTotalBytes -= oIter->second->size();
+            oCache.oMap.erase(oIter->first);
+            oIter = oCache.oLRU.erase(oIter);
+        }
+        else
+        {
+            ++oIter;
+        }
+    }
+}
+
+/************************************************************************/
+/*                   GDALCompressedBlockCacheClear()                    */
+/************************************************************************/
+
+/** Removes all entries from the cache. */
+void GDALCompressedBlockCacheClear()
+{
+    auto &oCache = GetCache();
+    std::lock_guard<std::mutex> oLock(oCache.oMutex);
+    oCache.Evict(0);
+}
+
+/*! @endcond */
@@ -0,0 +1,71 @@
+/**********************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Process-wide cache of compressed block bytes
+ *
+ **********************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef GDAL_COMPRESSED_BLOCK_CACHE_H
+#define GDAL_COMPRESSED_BLOCK_CACHE_H
+
+#include "cpl_port.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*! @cond Doxygen_Suppress */
+
+/** Cache of the compressed (encoded) bytes of blocks, as read from files.
+ *
+ * It comes in addition to the cache of decoded blocks (GDALRasterBlock),
+ * and is sized separately with the GDAL_COMPRESSED_BLOCK_CACHEMAX
+ * configuration option (disabled by default). As compressed blocks are
+ * typically several times smaller than decoded ones, it can hold a much
+ * larger working set, from which blocks evicted from the decoded cache are
+ * decoded again without being fetched again from disk or network.
+ *
+ * Keys are chosen by drivers, and must uniquely identify the content of
+ * the block. They must start with the filename followed by a '\n'
+ * character, typically followed by the size and modification time of the
+ * file and the offset and size of the block in the file. Drivers should only
+ * use it for files opened in read-only mode, and call
+ * GDALCompressedBlockCacheRemoveFile() when closing a file opened in update
+ * mode.
+ */
+
+bool CPL_DLL GDALCompressedBlockCacheIsEnabled();
+
+std::shared_ptr<const std::vector<GByte>>
+    CPL_DLL GDALCompressedBlockCacheGet(const std::string &osKey);
+
+void CPL_DLL GDALCompressedBlockCachePut(const std::string &osKey,
+                                         const void *pData, size_t nSize);
+
+void CPL_DLL GDALCompressedBlockCacheRemoveFile(const char *pszFilename);
+
+void CPL_DLL GDALCompressedBlockCacheClear();
+
+/*! @endcond */
+
+#endif  // GDAL_COMPRESSED_BLOCK_CACHE_H
@@ -70,8 +70,11 @@ class GDALRelationship;
 
 #include <stdarg.h>
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -233,6 +236,14 @@ class CPL_DLL GDALDefaultOverviews
     bool bInitNameIsOVR;
     char **papszInitSiblingFiles;
 
+    // Overviews computed on the fly when the dataset has none, and the
+    // GDAL_CACHED_VIRTUAL_OVERVIEWS configuration option is set.
+    std::vector<GDALDataset *> m_apoVirtualOverviews{};
+    bool m_bCheckedForVirtualOverviews = false;
+    int m_nVirtualOverviewsBusyCounter = 0;
+    void CreateVirtualOverviews();
+    void DestroyVirtualOverviews();
+
   public:
     GDALDefaultOverviews();
     ~GDALDefaultOverviews();
@@ -485,6 +496,17 @@ typedef struct GDALSQLParseInfo GDALSQLParseInfo;
 #endif
 //! @endcond
 
+/** Rectangular window of a raster, in pixel coordinates.
+ * @since GDAL 3.10
+ */
+struct GDALRasterWindow
+{
+    int nXOff = 0;  /**< Left pixel offset */
+    int nYOff = 0;  /**< Top line offset */
+    int nXSize = 0; /**< Width in pixels */
+    int nYSize = 0; /**< Height in lines */
+};
+
 /** A set of associated raster bands, usually from one file. */
 class CPL_DLL GDALDataset : public GDALMajorObject
 {
@@ -499,11 +521,21 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     friend class GDALDefaultOverviews;
     friend class GDALProxyDataset;
     friend class GDALDriverManager;
+    friend class GDALRasterBlock;
 
     CPL_INTERNAL void AddToDatasetOpenList();
 
+    CPL_INTERNAL void AddToBlockCacheUsed(GIntBig nDelta);
+    CPL_INTERNAL GIntBig GetBlockCacheUsed() const;
+
+    CPL_INTERNAL std::future<CPLErr>
+    SubmitAsyncRasterIO(std::function<CPLErr()> &&fnRequest);
+    CPL_INTERNAL static void AsyncRasterIOWorker(void *pData);
+
     CPL_INTERNAL void UnregisterFromSharedDataset();
 
+    CPL_INTERNAL void PersistDirtyRegions();
+
     CPL_INTERNAL static void ReportErrorV(const char *pszDSName,
                                           CPLErr eErrClass, CPLErrorNum err_no,
                                           const char *fmt, va_list args);
@@ -681,6 +713,8 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     virtual CPLErr FlushCache(bool bAtClosing = false);
     virtual CPLErr DropCache();
 
+    void GetBlockCacheStatistics(GDALBlockCacheStatistics *psStats);
+
     virtual GIntBig GetEstimatedRAMUsage();
 
     virtual const OGRSpatialReference *GetSpatialRef() const;
@@ -758,6 +792,19 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 #endif
                         ) CPL_WARN_UNUSED_RESULT;
 
+    virtual std::future<CPLErr>
+    RasterIOAsync(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                  int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                  GDALDataType eBufType, int nBandCount, const int *panBandMap,
+                  GSpacing nPixelSpace, GSpacing nLineSpace,
+                  GSpacing nBandSpace,
+                  const GDALRasterIOExtraArg *psExtraArg = nullptr);
+    void WaitAsyncRasterIO();
+
+    void MarkDirtyRegion(int nXOff, int nYOff, int nXSize, int nYSize);
+    std::vector<GDALRasterWindow> GetDirtyRegions();
+    void ClearDirtyRegions();
+
     virtual CPLStringList GetCompressionFormats(int nXOff, int nYOff,
                                                 int nXSize, int nYSize,
                                                 int nBandCount,
@@ -1036,6 +1083,9 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     UpdateRelationship(std::unique_ptr<GDALRelationship> &&relationship,
                        std::string &failureReason);
 
+    bool GetRasterArrowStream(struct ArrowArrayStream *out_stream,
+                              CSLConstList papszOptions = nullptr);
+
     //! @cond Doxygen_Suppress
     OGRLayer *CreateLayer(const char *pszName);
 
@@ -1174,6 +1224,16 @@ class CPL_DLL GDALRasterBlock
 
     bool bMustDetach;
 
+    // Index of the global block cache shard this block belongs to.
+    int nShard;
+
+    // Index of the list of the shard this block belongs to.
+    int nCacheList;
+
+    // Whether all pixels of the block are known to be equal to dfUniformValue
+    bool bUniform;
+    double dfUniformValue;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
 
@@ -1188,6 +1248,26 @@ class CPL_DLL GDALRasterBlock
     void Touch(void);
     void MarkDirty(void);
     void MarkClean(void);
+    void MarkUniform(double dfValue);
+
+    /** Return whether all the pixels of the block are known to have the same
+     * value.
+     *
+     * This is only set when the driver knows it at decode time (for example
+     * for a missing block of a sparse GeoTIFF file), and is reset when the
+     * block is marked as dirty.
+     *
+     * @param pdfValue Pointer to a double receiving the value of the pixels,
+     * or nullptr.
+     * @return whether the block is uniform.
+     * @since GDAL 3.10
+     */
+    bool IsUniform(double *pdfValue = nullptr) const
+    {
+        if (bUniform && pdfValue)
+            *pdfValue = dfUniformValue;
+        return bUniform;
+    }
 
     /** Increment the lock count */
     int AddLock(void)
@@ -1302,6 +1382,92 @@ class CPL_DLL GDALRasterBlock
     CPL_DISALLOW_COPY_ASSIGN(GDALRasterBlock)
 };
 
+/* ******************************************************************** */
+/*                          GDALRasterBlockView                         */
+/* ******************************************************************** */
+
+/** Read-only view on the data of a block pinned in the block cache.
+ *
+ * Instances are returned by GDALRasterBand::BorrowBlock(). The block is
+ * locked in the cache, and thus cannot be evicted, as long as the view is
+ * alive. The view must be released before its band is destroyed.
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL GDALRasterBlockView
+{
+    GDALRasterBlock *m_poBlock = nullptr;
+    int m_nValidXSize = 0;
+    int m_nValidYSize = 0;
+
+    friend class GDALRasterBand;
+    CPL_INTERNAL GDALRasterBlockView(GDALRasterBlock *poBlock,
+                                     int nValidXSize, int nValidYSize);
+
+  public:
+    GDALRasterBlockView() = default;
+    GDALRasterBlockView(GDALRasterBlockView &&other) noexcept;
+    GDALRasterBlockView &operator=(GDALRasterBlockView &&other) noexcept;
+    ~GDALRasterBlockView();
+
+    void Release();
+
+    /** Return whether this view points to a block */
+    explicit operator bool() const
+    {
+        return m_poBlock != nullptr;
+    }
+
+    /** Return the data of the block, in its native data type, with
+     * GetXSize() pixels per line. Only valid if the view is not empty.
+     */
+    const void *data() const
+    {
+        return m_poBlock->GetDataRef();
+    }
+
+    /** Return the size in bytes of the block data */
+    size_t size() const
+    {
+        return m_poBlock ? static_cast<size_t>(m_poBlock->GetBlockSize()) : 0;
+    }
+
+    /** Return the data type of the block */
+    GDALDataType GetDataType() const
+    {
+        return m_poBlock ? m_poBlock->GetDataType() : GDT_Unknown;
+    }
+
+    /** Return the width of the block, that is the line stride in pixels */
+    int GetXSize() const
+    {
+        return m_poBlock ? m_poBlock->GetXSize() : 0;
+    }
+
+    /** Return the height of the block */
+    int GetYSize() const
+    {
+        return m_poBlock ? m_poBlock->GetYSize() : 0;
+    }
+
+    /** Return the number of valid pixels in a line of the block, which is
+     * less than GetXSize() for blocks on the right edge of the raster */
+    int GetValidXSize() const
+    {
+        return m_nValidXSize;
+    }
+
+    /** Return the number of valid lines of the block, which is less than
+     * GetYSize() for blocks on the bottom edge of the raster */
+    int GetValidYSize() const
+    {
+        return m_nValidYSize;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterBlockView)
+};
+
 /* ******************************************************************** */
 /*                             GDALColorTable                           */
 /* ******************************************************************** */
@@ -1370,6 +1536,13 @@ class GDALAbstractBandBlockCache
 
     volatile int m_nDirtyBlocks = 0;
 
+    // Statistics, see GDALBlockCacheStatistics
+    std::atomic<GUIntBig> m_nHits{0};
+    std::atomic<GUIntBig> m_nMisses{0};
+    std::atomic<GUIntBig> m_nDirtyBlocksWritten{0};
+    std::atomic<GUIntBig> m_nEvictions{0};
+    std::atomic<GIntBig> m_nCacheUsed{0};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALAbstractBandBlockCache)
 
   protected:
@@ -1410,6 +1583,33 @@ class GDALAbstractBandBlockCache
         return m_nDirtyBlocks > 0;
     }
 
+    void IncHits()
+    {
+        m_nHits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void IncMisses()
+    {
+        m_nMisses.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void IncDirtyBlocksWritten()
+    {
+        m_nDirtyBlocksWritten.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void IncEvictions()
+    {
+        m_nEvictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AddCacheUsed(GIntBig nDelta)
+    {
+        m_nCacheUsed.fetch_add(nDelta, std::memory_order_relaxed);
+    }
+
+    void GetStatistics(GDALBlockCacheStatistics *psStats) const;
+
     virtual bool Init() = 0;
     virtual bool IsInitOK() = 0;
     virtual CPLErr FlushCache() = 0;
@@ -1475,6 +1675,10 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     CPLErr eFlushBlockErr = CE_None;
     GDALAbstractBandBlockCache *poBandBlockCache = nullptr;
 
+    // Set by SetReadBlockUniformValue() during IReadBlock()
+    bool m_bReadBlockIsUniform = false;
+    double m_dfReadBlockUniformValue = 0;
+
     CPL_INTERNAL void SetFlushBlockErr(CPLErr eErr);
     CPL_INTERNAL CPLErr UnreferenceBlock(GDALRasterBlock *poBlock);
     CPL_INTERNAL void IncDirtyBlocks(int nInc);
@@ -1563,7 +1767,6 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     int EnterReadWrite(GDALRWFlag eRWFlag);
     void LeaveReadWrite();
     void InitRWLock();
-    void SetValidPercent(GUIntBig nSampleCount, GUIntBig nValidCount);
 
     //! @endcond
 
@@ -1579,6 +1782,12 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     virtual int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize,
                                        int nYSize, int nMaskFlagStop,
                                        double *pdfDataPct);
+
+    virtual CPLErr IReadMultiWindow(int nWindowCount,
+                                    const GDALRasterIOWindow *pasWindows,
+                                    GDALDataType eBufType,
+                                    GDALRasterIOExtraArg *psExtraArg)
+        CPL_WARN_UNUSED_RESULT;
     //! @cond Doxygen_Suppress
     CPLErr
     OverviewRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
@@ -1594,6 +1803,10 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     int InitBlockInfo();
 
+    void SetReadBlockUniformValue(double dfValue);
+
+    void SetValidPercent(GUIntBig nSampleCount, GUIntBig nValidCount);
+
     void AddBlockToFreeList(GDALRasterBlock *);
 
     bool HasBlockCache() const
@@ -1635,6 +1848,17 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                         OPTIONAL_OUTSIDE_GDAL(nullptr)
 #endif
                         ) CPL_WARN_UNUSED_RESULT;
+    std::future<CPLErr>
+    RasterIOAsync(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                  int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                  GDALDataType eBufType, GSpacing nPixelSpace,
+                  GSpacing nLineSpace,
+                  const GDALRasterIOExtraArg *psExtraArg = nullptr);
+    CPLErr ReadMultiWindow(int nWindowCount,
+                           const GDALRasterIOWindow *pasWindows,
+                           GDALDataType eBufType,
+                           GDALRasterIOExtraArg *psExtraArg = nullptr)
+        CPL_WARN_UNUSED_RESULT;
     CPLErr ReadBlock(int, int, void *) CPL_WARN_UNUSED_RESULT;
 
     CPLErr WriteBlock(int, int, void *) CPL_WARN_UNUSED_RESULT;
@@ -1644,6 +1868,7 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                       int bJustInitialize = FALSE) CPL_WARN_UNUSED_RESULT;
     GDALRasterBlock *TryGetLockedBlockRef(int nXBlockOff, int nYBlockYOff)
         CPL_WARN_UNUSED_RESULT;
+    GDALRasterBlockView BorrowBlock(int nXBlockOff, int nYBlockOff);
     CPLErr FlushBlock(int, int, int bWriteDirtyBlock = TRUE);
 
     unsigned char *
@@ -1655,6 +1880,7 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     virtual CPLErr FlushCache(bool bAtClosing = false);
     virtual CPLErr DropCache();
+    void GetBlockCacheStatistics(GDALBlockCacheStatistics *psStats) const;
     virtual char **GetCategoryNames();
     virtual double GetNoDataValue(int *pbSuccess = nullptr);
     virtual int64_t GetNoDataValueAsInt64(int *pbSuccess = nullptr);
@@ -1953,6 +2179,8 @@ class CPL_DLL GDALDriver : public GDALMajorObject
 
     CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
                            const char *pszDomain = "") override;
+    CPLErr SetMetadata(char **papszMetadata,
+                       const char *pszDomain = "") override;
 
     /* -------------------------------------------------------------------- */
     /*      Public C++ methods.                                             */
@@ -1996,6 +2224,17 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     // Not aimed at being used outside of GDAL. Use GDALDataset::Open() instead
     GDALDataset *Open(GDALOpenInfo *poOpenInfo, bool bSetOpenOptions);
 
+    /** Flags returned by GetOpenCapabilities() */
+    enum OpenCapability
+    {
+        OPEN_CAP_OPEN = 1 << 0,            // GDAL_DCAP_OPEN
+        OPEN_CAP_RASTER = 1 << 1,          // GDAL_DCAP_RASTER
+        OPEN_CAP_VECTOR = 1 << 2,          // GDAL_DCAP_VECTOR
+        OPEN_CAP_MULTIDIM_RASTER = 1 << 3  // GDAL_DCAP_MULTIDIM_RASTER
+    };
+
+    int GetOpenCapabilities();
+
     typedef GDALDataset *(*OpenCallback)(GDALOpenInfo *);
 
     OpenCallback pfnOpen = nullptr;
@@ -2176,6 +2415,9 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     }
 
   private:
+    // Cached result of GetOpenCapabilities(), or -1 if not computed.
+    std::atomic<int> m_nOpenCapabilities{-1};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALDriver)
 };
 
@@ -3309,6 +3551,21 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     mutable bool m_bHasTriedCachedArray = false;
     mutable std::shared_ptr<GDALMDArray> m_poCachedArray{};
 
+    // Decoded chunk cache, enabled with GDAL_MDARRAY_CHUNK_CACHE_SIZE
+    friend class GDALAbstractMDArray;
+    struct DecodedChunkCache;
+    mutable bool m_bHasTriedDecodedChunkCache = false;
+    mutable std::shared_ptr<DecodedChunkCache> m_poDecodedChunkCache{};
+
+    bool ReadThroughDecodedChunkCache(
+        const GDALMDArray *poArray, const GUInt64 *arrayStartIdx,
+        const size_t *count, const GInt64 *arrayStep,
+        const GPtrDiff_t *bufferStride,
+        const GDALExtendedDataType &bufferDataType, void *pDstBuffer,
+        bool &bHandled) const;
+
+    void InvalidateDecodedChunkCache();
+
   protected:
     //! @cond Doxygen_Suppress
     GDALMDArray(const std::string &osParentName, const std::string &osName,
@@ -3317,6 +3574,12 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     virtual bool IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                              CSLConstList papszOptions) const;
 
+    virtual bool IDrill(size_t iDim, size_t nPoints,
+                        const GUInt64 *panPointIndices, GUInt64 nStartIdx,
+                        size_t nCount,
+                        const GDALExtendedDataType &bufferDataType,
+                        void *pDstBuffer, CSLConstList papszOptions) const;
+
     virtual bool IsCacheable() const
     {
         return true;
@@ -3488,6 +3751,9 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
                      const std::shared_ptr<GDALGroup> &poRootGroup = nullptr,
                      CSLConstList papszOptions = nullptr) const;
 
+    bool GetRasterArrowStream(struct ArrowArrayStream *out_stream,
+                              CSLConstList papszOptions = nullptr) const;
+
     virtual CPLErr GetStatistics(bool bApproxOK, bool bForce, double *pdfMin,
                                  double *pdfMax, double *pdfMean,
                                  double *padfStdDev, GUInt64 *pnValidCount,
@@ -3508,6 +3774,11 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     bool AdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                     CSLConstList papszOptions = nullptr) const;
 
+    bool Drill(size_t iDim, size_t nPoints, const GUInt64 *panPointIndices,
+               GUInt64 nStartIdx, size_t nCount,
+               const GDALExtendedDataType &bufferDataType, void *pDstBuffer,
+               CSLConstList papszOptions = nullptr) const;
+
     bool IsRegularlySpaced(double &dfStart, double &dfIncrement) const;
 
     bool GuessGeoTransform(size_t nDimX, size_t nDimY, bool bPixelIsPoint,
@@ -4303,6 +4574,15 @@ void CPL_DLL GDALCopyNoDataValue(GDALRasterBand *poDstBand,
 double CPL_DLL GDALGetNoDataValueCastToDouble(int64_t nVal);
 double CPL_DLL GDALGetNoDataValueCastToDouble(uint64_t nVal);
 
+void CPL_DLL GDALApplyByteLUT(const GByte *pabySrc, const GByte *pabyLUT,
+                              GByte *pabyDst, GPtrDiff_t nDstPixelStride,
+                              size_t nCount);
+
+void CPL_DLL GDALExpandPaletteByte(const GByte *pabySrc,
+                                   const GByte *pabyColorTable,
+                                   int nComponents, GByte *const *papabyDst,
+                                   size_t nCount);
+
 // Remove me in GDAL 4.0. See GetMetadataItem() implementation
 // Internal use in GDAL only !
 // Declaration copied in swig/include/gdal.i
@@ -710,6 +710,46 @@ inline void GDALCopy4Words(const double *pValueIn, float *const pValueOut)
 }
 #endif
 
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+// In the following, negative values and NaN are converted to 0 by
+// vcvtq_u32_f32(), which saturates.
+
+template <>
+inline void GDALCopy4Words(const float *pValueIn, GByte *const pValueOut)
+{
+    float32x4_t v = vaddq_f32(vld1q_f32(pValueIn), vdupq_n_f32(0.5f));
+    v = vminq_f32(v, vdupq_n_f32(255.0f));
+    const uint16x4_t v16 = vmovn_u32(vcvtq_u32_f32(v));
+    const uint8x8_t v8 = vmovn_u16(vcombine_u16(v16, v16));
+    const uint32_t n32 = vget_lane_u32(vreinterpret_u32_u8(v8), 0);
+    memcpy(pValueOut, &n32, sizeof(n32));
+}
+
+template <>
+inline void GDALCopy8Words(const float *pValueIn, GByte *const pValueOut)
+{
+    const float32x4_t p0d5 = vdupq_n_f32(0.5f);
+    const float32x4_t v_max = vdupq_n_f32(255.0f);
+    const float32x4_t v0 =
+        vminq_f32(vaddq_f32(vld1q_f32(pValueIn), p0d5), v_max);
+    const float32x4_t v1 =
+        vminq_f32(vaddq_f32(vld1q_f32(pValueIn + 4), p0d5), v_max);
+    const uint16x8_t v16 = vcombine_u16(vmovn_u32(vcvtq_u32_f32(v0)),
+                                        vmovn_u32(vcvtq_u32_f32(v1)));
+    vst1_u8(pValueOut, vmovn_u16(v16));
+}
+
+template <>
+inline void GDALCopy4Words(const float *pValueIn, GUInt16 *const pValueOut)
+{
+    float32x4_t v = vaddq_f32(vld1q_f32(pValueIn), vdupq_n_f32(0.5f));
+    v = vminq_f32(v, vdupq_n_f32(65535.0f));
+    vst1_u16(pValueOut, vmovn_u32(vcvtq_u32_f32(v)));
+}
+
 #endif  //  defined(__x86_64) || defined(_M_X64)
 
 #endif  // GDAL_PRIV_TEMPLATES_HPP_INCLUDED
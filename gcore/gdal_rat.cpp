@@ -37,6 +37,9 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -134,14 +137,14 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            pdfData[iIndex] = GetValueAsDouble(iIndex, iField);
+            pdfData[iIndex - iStartRow] = GetValueAsDouble(iIndex, iField);
         }
     }
     else
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            SetValue(iIndex, iField, pdfData[iIndex]);
+            SetValue(iIndex, iField, pdfData[iIndex - iStartRow]);
         }
     }
     return CE_None;
@@ -198,14 +201,14 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            pnData[iIndex] = GetValueAsInt(iIndex, iField);
+            pnData[iIndex - iStartRow] = GetValueAsInt(iIndex, iField);
         }
     }
     else
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            SetValue(iIndex, iField, pnData[iIndex]);
+            SetValue(iIndex, iField, pnData[iIndex - iStartRow]);
         }
     }
     return CE_None;
@@ -264,14 +267,15 @@ CPLErr GDALRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag, int iField,
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            papszStrList[iIndex] = VSIStrdup(GetValueAsString(iIndex, iField));
+            papszStrList[iIndex - iStartRow] =
+                VSIStrdup(GetValueAsString(iIndex, iField));
         }
     }
     else
     {
         for (int iIndex = iStartRow; iIndex < (iStartRow + iLength); iIndex++)
         {
-            SetValue(iIndex, iField, papszStrList[iIndex]);
+            SetValue(iIndex, iField, papszStrList[iIndex - iStartRow]);
         }
     }
     return CE_None;
@@ -1661,6 +1665,7 @@ void GDALDefaultRasterAttributeTable::SetRowCount(int nNewCount)
     }
 
     nRowCount = nNewCount;
+    bRowOfValueIndexBuilt = false;
 }
 
 /************************************************************************/
@@ -1708,6 +1713,7 @@ void GDALDefaultRasterAttributeTable::SetValue(int iRow, int iField,
             aoFields[iField].aosValues[iRow] = pszValue;
             break;
     }
+    bRowOfValueIndexBuilt = false;
 }
 
 /************************************************************************/
@@ -1779,6 +1785,7 @@ void GDALDefaultRasterAttributeTable::SetValue(int iRow, int iField, int nValue)
         }
         break;
     }
+    bRowOfValueIndexBuilt = false;
 }
 
 /************************************************************************/
@@ -1845,6 +1852,7 @@ void GDALDefaultRasterAttributeTable::SetValue(int iRow, int iField,
         }
         break;
     }
+    bRowOfValueIndexBuilt = false;
 }
 
 /************************************************************************/
@@ -1866,6 +1874,146 @@ void CPL_STDCALL GDALRATSetValueAsDouble(GDALRasterAttributeTableH hRAT,
     GDALRasterAttributeTable::FromHandle(hRAT)->SetValue(iRow, iField, dfValue);
 }
 
+/************************************************************************/
+/*                      CheckValuesIOParameters()                       */
+/************************************************************************/
+
+bool GDALDefaultRasterAttributeTable::CheckValuesIOParameters(
+    int iField, int iStartRow, int iLength) const
+{
+    if (iField < 0 || iField >= static_cast<int>(aoFields.size()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "iField (%d) out of range.",
+                 iField);
+        return false;
+    }
+
+    if (iStartRow < 0 || iLength < 0 || iStartRow > nRowCount - iLength)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "iStartRow (%d) + iLength (%d) out of range.", iStartRow,
+                 iLength);
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                              ValuesIO()                              */
+/*                                                                      */
+/*      Whole runs of values are copied from/to the column vectors,     */
+/*      instead of going through GetValueAsXXX()/SetValue() for each    */
+/*      cell.                                                           */
+/************************************************************************/
+
+CPLErr GDALDefaultRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag,
+                                                 int iField, int iStartRow,
+                                                 int iLength, double *pdfData)
+{
+    if (!CheckValuesIOParameters(iField, iStartRow, iLength))
+        return CE_Failure;
+
+    auto &oField = aoFields[iField];
+    if (eRWFlag == GF_Read)
+    {
+        switch (oField.eType)
+        {
+            case GFT_Integer:
+                std::copy_n(oField.anValues.begin() + iStartRow, iLength,
+                            pdfData);
+                break;
+
+            case GFT_Real:
+                std::copy_n(oField.adfValues.begin() + iStartRow, iLength,
+                            pdfData);
+                break;
+
+            case GFT_String:
+                for (int i = 0; i < iLength; i++)
+                    pdfData[i] =
+                        CPLAtof(oField.aosValues[iStartRow + i].c_str());
+                break;
+        }
+    }
+    else
+    {
+        switch (oField.eType)
+        {
+            case GFT_Integer:
+                for (int i = 0; i < iLength; i++)
+                    oField.anValues[iStartRow + i] =
+                        static_cast<int>(pdfData[i]);
+                break;
+
+            case GFT_Real:
+                std::copy_n(pdfData, iLength,
+                            oField.adfValues.begin() + iStartRow);
+                break;
+
+            case GFT_String:
+                for (int i = 0; i < iLength; i++)
+                    SetValue(iStartRow + i, iField, pdfData[i]);
+                break;
+        }
+        bRowOfValueIndexBuilt = false;
+    }
+    return CE_None;
+}
+
+CPLErr GDALDefaultRasterAttributeTable::ValuesIO(GDALRWFlag eRWFlag,
+                                                 int iField, int iStartRow,
+                                                 int iLength, int *pnData)
+{
+    if (!CheckValuesIOParameters(iField, iStartRow, iLength))
+        return CE_Failure;
+
+    auto &oField = aoFields[iField];
+    if (eRWFlag == GF_Read)
+    {
+        switch (oField.eType)
+        {
+            case GFT_Integer:
+                std::copy_n(oField.anValues.begin() + iStartRow, iLength,
+                            pnData);
+                break;
+
+            case GFT_Real:
+                for (int i = 0; i < iLength; i++)
+                    pnData[i] =
+                        static_cast<int>(oField.adfValues[iStartRow + i]);
+                break;
+
+            case GFT_String:
+                for (int i = 0; i < iLength; i++)
+                    pnData[i] = atoi(oField.aosValues[iStartRow + i].c_str());
+                break;
+        }
+    }
+    else
+    {
+        switch (oField.eType)
+        {
+            case GFT_Integer:
+                std::copy_n(pnData, iLength,
+                            oField.anValues.begin() + iStartRow);
+                break;
+
+            case GFT_Real:
+                std::copy_n(pnData, iLength,
+                            oField.adfValues.begin() + iStartRow);
+                break;
+
+            case GFT_String:
+                for (int i = 0; i < iLength; i++)
+                    SetValue(iStartRow + i, iField, pnData[i]);
+                break;
+        }
+        bRowOfValueIndexBuilt = false;
+    }
+    return CE_None;
+}
+
 /************************************************************************/
 /*                       ChangesAreWrittenToFile()                      */
 /************************************************************************/
@@ -1925,6 +2073,55 @@ int GDALDefaultRasterAttributeTable::GetRowOfValue(double dfValue) const
     if (nMinCol == -1 && nMaxCol == -1)
         return -1;
 
+    /* -------------------------------------------------------------------- */
+    /*      Use the sorted index of the Min/Max columns if possible.        */
+    /* -------------------------------------------------------------------- */
+    if (!bRowOfValueIndexBuilt)
+        const_cast<GDALDefaultRasterAttributeTable *>(this)
+            ->BuildRowOfValueIndex();
+
+    if (bRowOfValueIndexUsable && !std::isnan(dfValue))
+    {
+        const auto &aoIndex = aoRowOfValueIndex;
+        const auto oFirstOfValue =
+            std::make_pair(dfValue, std::numeric_limits<int>::min());
+        const auto oLastOfValue =
+            std::make_pair(dfValue, std::numeric_limits<int>::max());
+        if (nMinCol == nMaxCol)
+        {
+            const auto oIter = std::lower_bound(aoIndex.begin(), aoIndex.end(),
+                                                oFirstOfValue);
+            if (oIter != aoIndex.end() && oIter->first == dfValue)
+                return oIter->second;
+        }
+        else if (nMaxCol == -1)
+        {
+            const auto oIter = std::upper_bound(aoIndex.begin(), aoIndex.end(),
+                                                oLastOfValue);
+            if (oIter != aoIndex.begin())
+                return std::prev(oIter)->second;
+        }
+        else if (nMinCol == -1)
+        {
+            const auto oIter = std::lower_bound(aoIndex.begin(), aoIndex.end(),
+                                                oFirstOfValue);
+            if (oIter != aoIndex.end())
+                return oIter->second;
+        }
+        else
+        {
+            const auto oIter = std::upper_bound(aoIndex.begin(), aoIndex.end(),
+                                                oLastOfValue);
+            if (oIter != aoIndex.begin())
+            {
+                const size_t i = (oIter - aoIndex.begin()) - 1;
+                if (dfValue <= adfRowOfValueIndexAux[i])
+                    return aoIndex[i].second;
+            }
+        }
+        return -1;
+    }
+
     const GDALRasterAttributeField *poMin = nullptr;
     if (nMinCol != -1)
         poMin = &(aoFields[nMinCol]);
@@ -1973,6 +2170,100 @@ int GDALDefaultRasterAttributeTable::GetRowOfValue(double dfValue) const
     return -1;
 }
 
+/************************************************************************/
+/*                        BuildRowOfValueIndex()                        */
+/*                                                                      */
+/*      Sort the rows by the value of the Min column (or Max column     */
+/*      if there is no Min column), so that GetRowOfValue() is a        */
+/*      binary search. The second member of the index pairs is the      */
+/*      row to return when the value falls at that position:            */
+/*       - MinMax column: the row itself (lowest row among equal        */
+/*         values, as rows are a secondary sort key),                   */
+/*       - Min column only: the lowest row of the entries up to that    */
+/*         position,                                                    */
+/*       - Max column only: the lowest row of the entries from that     */
+/*         position,                                                    */
+/*       - Min and Max columns: the row itself, provided that the       */
+/*         [min,max] intervals are disjoint. adfRowOfValueIndexAux      */
+/*         then holds the max of each entry.                            */
+/*      Otherwise, or with string columns or NaN values, the index is   */
+/*      not usable and GetRowOfValue() scans the rows.                  */
+/************************************************************************/
+
+void GDALDefaultRasterAttributeTable::BuildRowOfValueIndex()
+{
+    bRowOfValueIndexBuilt = true;
+    bRowOfValueIndexUsable = false;
+    aoRowOfValueIndex.clear();
+    adfRowOfValueIndexAux.clear();
+
+    if ((nMinCol >= 0 && aoFields[nMinCol].eType == GFT_String) ||
+        (nMaxCol >= 0 && aoFields[nMaxCol].eType == GFT_String))
+    {
+        return;
+    }
+
+    const auto GetValue = [this](int iCol, int iRow)
+    {
+        const auto &oField = aoFields[iCol];
+        return oField.eType == GFT_Integer
+                   ? static_cast<double>(oField.anValues[iRow])
+                   : oField.adfValues[iRow];
+    };
+
+    const int iKeyCol = nMinCol >= 0 ? nMinCol : nMaxCol;
+    aoRowOfValueIndex.reserve(nRowCount);
+    for (int iRow = 0; iRow < nRowCount; iRow++)
+    {
+        const double dfKey = GetValue(iKeyCol, iRow);
+        if (std::isnan(dfKey))
+        {
+            aoRowOfValueIndex.clear();
+            return;
+        }
+        aoRowOfValueIndex.emplace_back(dfKey, iRow);
+    }
+    std::sort(aoRowOfValueIndex.begin(), aoRowOfValueIndex.end());
+
+    const size_t nEntries = aoRowOfValueIndex.size();
+    if (nMinCol >= 0 && nMaxCol == -1)
+    {
+        for (size_t i = 1; i < nEntries; i++)
+        {
+            aoRowOfValueIndex[i].second = std::min(
+                aoRowOfValueIndex[i].second, aoRowOfValueIndex[i - 1].second);
+        }
+    }
+    else if (nMinCol == -1)
+    {
+        for (size_t i = nEntries; i > 1; i--)
+        {
+            aoRowOfValueIndex[i - 2].second =
+                std::min(aoRowOfValueIndex[i - 2].second,
+                         aoRowOfValueIndex[i - 1].second);
+        }
+    }
+    else if (nMinCol != nMaxCol)
+    {
+        adfRowOfValueIndexAux.reserve(nEntries);
+        for (size_t i = 0; i < nEntries; i++)
+        {
+            const double dfMax = GetValue(nMaxCol, aoRowOfValueIndex[i].second);
+            if (std::isnan(dfMax) ||
+                (i > 0 && !(adfRowOfValueIndexAux[i - 1] <
+                            aoRowOfValueIndex[i].first)))
+            {
+                aoRowOfValueIndex.clear();
+                adfRowOfValueIndexAux.clear();
+                return;
+            }
+            adfRowOfValueIndexAux.push_back(dfMax);
+        }
+    }
+
+    bRowOfValueIndexUsable = true;
+}
+
 /************************************************************************/
 /*                           GetRowOfValue()                            */
 /*                                                                      */
@@ -2096,6 +2387,9 @@ GDALDefaultRasterAttributeTable::CreateColumn(const char *pszFieldName,
     else if (eFieldType == GFT_String)
         aoFields[iNewField].aosValues.resize(nRowCount);
 
+    bColumnsAnalysed = false;
+    bRowOfValueIndexBuilt = false;
+
     return CE_None;
 }
 
@@ -2148,6 +2442,8 @@ void GDALDefaultRasterAttributeTable::RemoveStatistics()
         }
     }
     aoFields = std::move(aoNewFields);
+    bColumnsAnalysed = false;
+    bRowOfValueIndexBuilt = false;
 }
 
 /************************************************************************/
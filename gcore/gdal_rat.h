@@ -362,6 +362,14 @@ class CPL_DLL GDALDefaultRasterAttributeTable : public GDALRasterAttributeTable
 
     CPLString osWorkingResult{};
 
+    // Index of the Min/Max columns used by GetRowOfValue(), built on demand.
+    void BuildRowOfValueIndex();
+    bool CheckValuesIOParameters(int iField, int iStartRow, int iLength) const;
+    bool bRowOfValueIndexBuilt = false;
+    bool bRowOfValueIndexUsable = false;
+    std::vector<std::pair<double, int>> aoRowOfValueIndex{};
+    std::vector<double> adfRowOfValueIndexAux{};
+
   public:
     GDALDefaultRasterAttributeTable();
     ~GDALDefaultRasterAttributeTable() override;
@@ -386,6 +394,12 @@ class CPL_DLL GDALDefaultRasterAttributeTable : public GDALRasterAttributeTable
     void SetValue(int iRow, int iField, double dfValue) override;
     void SetValue(int iRow, int iField, int nValue) override;
 
+    using GDALRasterAttributeTable::ValuesIO;
+    CPLErr ValuesIO(GDALRWFlag eRWFlag, int iField, int iStartRow,
+                    int iLength, double *pdfData) override;
+    CPLErr ValuesIO(GDALRWFlag eRWFlag, int iField, int iStartRow,
+                    int iLength, int *pnData) override;
+
     int ChangesAreWrittenToFile() override;
     void SetRowCount(int iCount) override;
 
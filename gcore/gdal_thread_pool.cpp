@@ -28,6 +28,11 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -44,6 +49,11 @@ static std::mutex &GetMutexThreadPool()
 
 CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
 {
+    // The global thread pool never exceeds the process-wide thread budget
+    const int nBudget = GDALGetThreadBudget();
+    if (nBudget > 0)
+        nThreads = std::min(nThreads, nBudget);
+
     std::lock_guard oGuard(GetMutexThreadPool());
     if (gpoCompressThreadPool == nullptr)
     {
@@ -68,3 +78,98 @@ void GDALDestroyGlobalThreadPool()
     delete gpoCompressThreadPool;
     gpoCompressThreadPool = nullptr;
 }
+
+/************************************************************************/
+/*                        GDALGetThreadBudget()                         */
+/************************************************************************/
+
+/** Return the process-wide thread budget, as set by the GDAL_THREAD_BUDGET
+ * configuration option, or 0 if there is no limit.
+ */
+int GDALGetThreadBudget()
+{
+    const char *pszBudget = CPLGetConfigOption("GDAL_THREAD_BUDGET", nullptr);
+    if (pszBudget == nullptr)
+        return 0;
+    const int nBudget =
+        EQUAL(pszBudget, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszBudget);
+    return std::max(0, nBudget);
+}
+
+/************************************************************************/
+/*                         GDALThreadReservation                        */
+/************************************************************************/
+
+// Number of threads currently borrowed from the thread budget
+static std::atomic<int> gnBorrowedThreads{0};
+
+/** Reserve up to nThreads threads (including the calling thread) from the
+ * process-wide thread budget.
+ *
+ * GetThreadCount() must be used to know how many threads have actually been
+ * granted. It is between 1 and nThreads (or nThreads itself if it is lower
+ * than 1).
+ */
+GDALThreadReservation::GDALThreadReservation(int nThreads)
+    : m_nThreads(nThreads)
+{
+    const int nBudget = nThreads > 1 ? GDALGetThreadBudget() : 0;
+    if (nBudget == 0)
+        return;
+
+    int nBorrowedThreads = gnBorrowedThreads.load();
+    int nToBorrow;
+    do
+    {
+        nToBorrow =
+            std::min(nThreads - 1, std::max(0, nBudget - 1 - nBorrowedThreads));
+    } while (!gnBorrowedThreads.compare_exchange_weak(
+        nBorrowedThreads, nBorrowedThreads + nToBorrow));
+
+    m_nBorrowedThreads = nToBorrow;
+    m_nThreads = 1 + nToBorrow;
+    if (m_nThreads < nThreads)
+    {
+        CPLDebug("GDAL",
+                 "GDAL_THREAD_BUDGET=%d: using %d thread(s) instead of %d",
+                 nBudget, m_nThreads, nThreads);
+    }
+}
+
+/** Move constructor */
+GDALThreadReservation::GDALThreadReservation(
+    GDALThreadReservation &&other) noexcept
+    : m_nThreads(other.m_nThreads), m_nBorrowedThreads(other.m_nBorrowedThreads)
+{
+    other.m_nThreads = 0;
+    other.m_nBorrowedThreads = 0;
+}
+
+/** Move assignment operator */
+GDALThreadReservation &
+GDALThreadReservation::operator=(GDALThreadReservation &&other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        m_nThreads = other.m_nThreads;
+        m_nBorrowedThreads = other.m_nBorrowedThreads;
+        other.m_nThreads = 0;
+        other.m_nBorrowedThreads = 0;
+    }
+    return *this;
+}
+
+/** Destructor. Returns the borrowed threads to the budget. */
+GDALThreadReservation::~GDALThreadReservation()
+{
+    Release();
+}
+
+/** Return the borrowed threads to the budget. */
+void GDALThreadReservation::Release()
+{
+    gnBorrowedThreads -= m_nBorrowedThreads;
+    m_nBorrowedThreads = 0;
+    m_nThreads = 0;
+}
@@ -35,4 +35,40 @@ CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
 void GDALDestroyGlobalThreadPool();
 
+int CPL_DLL GDALGetThreadBudget();
+
+/** Reservation of threads from the process-wide thread budget, set with
+ * the GDAL_THREAD_BUDGET configuration option.
+ *
+ * Subsystems that process jobs in parallel borrow threads from that budget
+ * for the duration of their processing, so that nested parallel operations
+ * (e.g. warping into a GeoTIFF file with multi-threaded compression) do not
+ * oversubscribe the CPUs. A reservation always grants at least one thread,
+ * the calling one, which is not accounted in the budget. Borrowed threads are
+ * returned to the budget when the object is destroyed.
+ */
+class CPL_DLL GDALThreadReservation
+{
+    int m_nThreads = 0;
+    int m_nBorrowedThreads = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadReservation)
+
+  public:
+    GDALThreadReservation() = default;
+    explicit GDALThreadReservation(int nThreads);
+    GDALThreadReservation(GDALThreadReservation &&other) noexcept;
+    GDALThreadReservation &operator=(GDALThreadReservation &&other) noexcept;
+    ~GDALThreadReservation();
+
+    void Release();
+
+    /** Return the number of threads that can be used, including the
+     * calling thread. */
+    int GetThreadCount() const
+    {
+        return m_nThreads;
+    }
+};
+
 #endif  // GDAL_THREAD_POOL_H
@@ -211,6 +211,25 @@ void GDALAbstractBandBlockCache::IncDirtyBlocks(int nInc)
     CPLAtomicAdd(&m_nDirtyBlocks, nInc);
 }
 
+/************************************************************************/
+/*                           GetStatistics()                            */
+/************************************************************************/
+
+/**
+ * \brief Fetch the block cache statistics of the band
+ */
+
+void GDALAbstractBandBlockCache::GetStatistics(
+    GDALBlockCacheStatistics *psStats) const
+{
+    psStats->nHits = m_nHits.load(std::memory_order_relaxed);
+    psStats->nMisses = m_nMisses.load(std::memory_order_relaxed);
+    psStats->nDirtyBlocksWritten =
+        m_nDirtyBlocksWritten.load(std::memory_order_relaxed);
+    psStats->nEvictions = m_nEvictions.load(std::memory_order_relaxed);
+    psStats->nCacheUsed = m_nCacheUsed.load(std::memory_order_relaxed);
+}
+
 /************************************************************************/
 /*                      StartDirtyBlockFlushingLog()                    */
 /************************************************************************/
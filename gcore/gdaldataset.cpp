@@ -37,7 +37,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <new>
 #include <set>
 #include <string>
@@ -49,8 +53,10 @@
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -123,6 +129,25 @@ class GDALDataset::Private
 
     bool m_bOverviewsEnabled = true;
 
+    // Memory used by the blocks of this dataset in the global block cache.
+    // Only maintained when GDAL_CACHEMAX_PER_DATASET is set.
+    std::atomic<GIntBig> m_nBlockCacheUsed{0};
+
+    // Pending RasterIOAsync() requests, run in sequence by a single job of
+    // the global thread pool.
+    std::mutex m_oAsyncRasterIOMutex{};
+    std::condition_variable m_oAsyncRasterIOCV{};
+    std::deque<std::packaged_task<CPLErr()>> m_aoAsyncRasterIORequests{};
+    bool m_bAsyncRasterIOWorkerRunning = false;
+
+    // Regions written since opening, when GDAL_TRACK_DIRTY_REGIONS is set.
+    std::mutex m_oDirtyRegionsMutex{};
+    // -1: configuration option not read yet. Tested without holding
+    // m_oDirtyRegionsMutex, so that writes do not take the lock when
+    // tracking is disabled.
+    std::atomic<int> m_nTrackDirtyRegions{-1};
+    std::vector<GDALRasterWindow> m_aoDirtyRegions{};
+
     Private() = default;
 };
 
@@ -529,6 +554,28 @@ void GDALDataset::AddToDatasetOpenList()
     (*poAllDatasetMap)[this] = -1;
 }
 
+/************************************************************************/
+/*                        AddToBlockCacheUsed()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+void GDALDataset::AddToBlockCacheUsed(GIntBig nDelta)
+{
+    if (m_poPrivate)
+        m_poPrivate->m_nBlockCacheUsed += nDelta;
+}
+
+/************************************************************************/
+/*                         GetBlockCacheUsed()                          */
+/************************************************************************/
+
+GIntBig GDALDataset::GetBlockCacheUsed() const
+{
+    return m_poPrivate ? m_poPrivate->m_nBlockCacheUsed.load() : 0;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                             FlushCache()                             */
 /************************************************************************/
@@ -666,6 +713,62 @@ CPLErr CPL_STDCALL GDALDropCache(GDALDatasetH hDS)
     return GDALDataset::FromHandle(hDS)->DropCache();
 }
 
+/************************************************************************/
+/*                      GetBlockCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Fetch statistics about the use of the block cache by this dataset.
+ *
+ * The returned values are the sum of the values returned by
+ * GDALRasterBand::GetBlockCacheStatistics() on each band of the dataset.
+ * Overviews and mask bands are not taken into account.
+ *
+ * This method is the same as the C function
+ * GDALDatasetGetBlockCacheStatistics().
+ *
+ * @param psStats Pointer to the structure to fill. Must not be NULL.
+ * @since 3.10
+ */
+
+void GDALDataset::GetBlockCacheStatistics(GDALBlockCacheStatistics *psStats)
+{
+    memset(psStats, 0, sizeof(*psStats));
+    for (int i = 0; i < nBands; ++i)
+    {
+        if (papoBands[i])
+        {
+            GDALBlockCacheStatistics sBandStats;
+            papoBands[i]->GetBlockCacheStatistics(&sBandStats);
+            psStats->nHits += sBandStats.nHits;
+            psStats->nMisses += sBandStats.nMisses;
+            psStats->nDirtyBlocksWritten += sBandStats.nDirtyBlocksWritten;
+            psStats->nEvictions += sBandStats.nEvictions;
+            psStats->nCacheUsed += sBandStats.nCacheUsed;
+        }
+    }
+}
+
+/************************************************************************/
+/*                 GDALDatasetGetBlockCacheStatistics()                 */
+/************************************************************************/
+
+/**
+ * \brief Fetch statistics about the use of the block cache by a dataset.
+ *
+ * @see GDALDataset::GetBlockCacheStatistics()
+ * @since 3.10
+ */
+
+void GDALDatasetGetBlockCacheStatistics(GDALDatasetH hDS,
+                                        GDALBlockCacheStatistics *psStats)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetGetBlockCacheStatistics");
+    VALIDATE_POINTER0(psStats, "GDALDatasetGetBlockCacheStatistics");
+
+    GDALDataset::FromHandle(hDS)->GetBlockCacheStatistics(psStats);
+}
+
 /************************************************************************/
 /*                      GetEstimatedRAMUsage()                          */
 /************************************************************************/
@@ -1624,6 +1727,7 @@ int GDALDataset::ReleaseRef()
     if (Dereference() <= 0)
     {
         nRefCount = 1;
+        WaitAsyncRasterIO();
         delete this;
         return TRUE;
     }
@@ -2757,6 +2861,9 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     if (eErr != CE_None || bStopProcessing)
         return eErr;
 
+    if (eRWFlag == GF_Write)
+        MarkDirtyRegion(nXOff, nYOff, nXSize, nYSize);
+
     /* -------------------------------------------------------------------- */
     /*      If pixel and line spacing are defaulted assign reasonable      */
     /*      value assuming a packed buffer.                                 */
@@ -2897,6 +3004,387 @@ CPLErr CPL_STDCALL GDALDatasetRasterIOEx(
                           psExtraArg);
 }
 
+/************************************************************************/
+/*                           RasterIOAsync()                            */
+/************************************************************************/
+
+/**
+ * \brief Queue an asynchronous read or write of a region of image data
+ * from multiple bands.
+ *
+ * The arguments have the same meaning as in GDALDataset::RasterIO(). The
+ * request is run in a thread of the global thread pool, and the returned
+ * future provides the return value of the underlying RasterIO() call once
+ * it has completed. This lets the caller overlap its own processing with
+ * network fetches and decompression done by the driver.
+ *
+ * Requests on a same dataset are run in sequence, in the order they have
+ * been queued. As datasets are not thread-safe, the dataset must not be
+ * otherwise used, nor closed, until all futures have been waited for, or
+ * WaitAsyncRasterIO() has been called. GDALClose() waits for pending
+ * requests. pData (and panBandMap, psExtraArg) may be freed only once the
+ * request has completed. Errors are emitted from the thread running the
+ * request.
+ *
+ * The default implementation is a thread pool based emulation on top of
+ * RasterIO(). Drivers may override it with a native asynchronous
+ * implementation.
+ *
+ * @return a future holding CE_None on success, or CE_Failure.
+ * @since GDAL 3.10
+ */
+
+std::future<CPLErr> GDALDataset::RasterIOAsync(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace,
+    const GDALRasterIOExtraArg *psExtraArg)
+{
+    std::vector<int> anBandMap;
+    if (panBandMap)
+    {
+        anBandMap.assign(panBandMap, panBandMap + std::max(0, nBandCount));
+    }
+    else
+    {
+        for (int i = 0; i < nBandCount; ++i)
+            anBandMap.push_back(i + 1);
+    }
+
+    GDALRasterIOExtraArg sExtraArg;
+    if (psExtraArg)
+    {
+        sExtraArg = *psExtraArg;
+    }
+    else
+    {
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    }
+
+    return SubmitAsyncRasterIO(
+        [this, eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+         nBufYSize, eBufType, nBandCount, anBandMap, nPixelSpace, nLineSpace,
+         nBandSpace, sExtraArg]() mutable
+        {
+            return RasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
+                            nBufXSize, nBufYSize, eBufType, nBandCount,
+                            anBandMap.empty() ? nullptr : anBandMap.data(),
+                            nPixelSpace, nLineSpace, nBandSpace, &sExtraArg);
+        });
+}
+
+/************************************************************************/
+/*                        SubmitAsyncRasterIO()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+std::future<CPLErr>
+GDALDataset::SubmitAsyncRasterIO(std::function<CPLErr()> &&fnRequest)
+{
+    std::packaged_task<CPLErr()> oTask(std::move(fnRequest));
+    auto oFuture = oTask.get_future();
+
+    auto poThreadPool =
+        m_poPrivate ? GDALGetGlobalThreadPool(CPLGetNumCPUs()) : nullptr;
+    if (poThreadPool == nullptr)
+    {
+        oTask();
+        return oFuture;
+    }
+
+    bool bStartWorker;
+    {
+        std::lock_guard<std::mutex> oLock(m_poPrivate->m_oAsyncRasterIOMutex);
+        m_poPrivate->m_aoAsyncRasterIORequests.push_back(std::move(oTask));
+        bStartWorker = !m_poPrivate->m_bAsyncRasterIOWorkerRunning;
+        m_poPrivate->m_bAsyncRasterIOWorkerRunning = true;
+    }
+    if (bStartWorker && !poThreadPool->SubmitJob(AsyncRasterIOWorker, this))
+    {
+        AsyncRasterIOWorker(this);
+    }
+    return oFuture;
+}
+
+/************************************************************************/
+/*                        AsyncRasterIOWorker()                         */
+/************************************************************************/
+
+void GDALDataset::AsyncRasterIOWorker(void *pData)
+{
+    auto poDS = static_cast<GDALDataset *>(pData);
+    auto poPrivate = poDS->m_poPrivate;
+    while (true)
+    {
+        std::packaged_task<CPLErr()> oTask;
+        {
+            std::lock_guard<std::mutex> oLock(poPrivate->m_oAsyncRasterIOMutex);
+            if (poPrivate->m_aoAsyncRasterIORequests.empty())
+            {
+                poPrivate->m_bAsyncRasterIOWorkerRunning = false;
+                poPrivate->m_oAsyncRasterIOCV.notify_all();
+                return;
+            }
+            oTask = std::move(poPrivate->m_aoAsyncRasterIORequests.front());
+            poPrivate->m_aoAsyncRasterIORequests.pop_front();
+        }
+        oTask();
+    }
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                         WaitAsyncRasterIO()                          */
+/************************************************************************/
+
+/**
+ * \brief Wait for the completion of all requests queued with
+ * RasterIOAsync() (or GDALRasterBand::RasterIOAsync()) on this dataset.
+ *
+ * @since GDAL 3.10
+ */
+
+void GDALDataset::WaitAsyncRasterIO()
+{
+    if (!m_poPrivate)
+        return;
+    std::unique_lock<std::mutex> oLock(m_poPrivate->m_oAsyncRasterIOMutex);
+    m_poPrivate->m_oAsyncRasterIOCV.wait(
+        oLock, [this] { return !m_poPrivate->m_bAsyncRasterIOWorkerRunning; });
+}
+
+/************************************************************************/
+/*                          AddDirtyRegion()                            */
+/************************************************************************/
+
+// Adds a region to a list of regions, merging it with the regions that
+// contain it, that it contains or with which its union is a rectangle.
+static void AddDirtyRegion(std::vector<GDALRasterWindow> &aoRegions,
+                           GDALRasterWindow oNew)
+{
+    const auto Contains = [](const GDALRasterWindow &a,
+                             const GDALRasterWindow &b)
+    {
+        return b.nXOff >= a.nXOff && b.nYOff >= a.nYOff &&
+               b.nXOff + b.nXSize <= a.nXOff + a.nXSize &&
+               b.nYOff + b.nYSize <= a.nYOff + a.nYSize;
+    };
+    const auto UnionIsRectangle =
+        [](const GDALRasterWindow &a, const GDALRasterWindow &b)
+    {
+        return (a.nXOff == b.nXOff && a.nXSize == b.nXSize &&
+                a.nYOff <= b.nYOff + b.nYSize &&
+                b.nYOff <= a.nYOff + a.nYSize) ||
+               (a.nYOff == b.nYOff && a.nYSize == b.nYSize &&
+                a.nXOff <= b.nXOff + b.nXSize &&
+                b.nXOff <= a.nXOff + a.nXSize);
+    };
+    const auto Union = [](const GDALRasterWindow &a, const GDALRasterWindow &b)
+    {
+        GDALRasterWindow oRet;
+        oRet.nXOff = std::min(a.nXOff, b.nXOff);
+        oRet.nYOff = std::min(a.nYOff, b.nYOff);
+        oRet.nXSize =
+            std::max(a.nXOff + a.nXSize, b.nXOff + b.nXSize) - oRet.nXOff;
+        oRet.nYSize =
+            std::max(a.nYOff + a.nYSize, b.nYOff + b.nYSize) - oRet.nYOff;
+        return oRet;
+    };
+
+    bool bMerged = true;
+    while (bMerged)
+    {
+        bMerged = false;
+        for (size_t i = 0; i < aoRegions.size(); ++i)
+        {
+            if (Contains(aoRegions[i], oNew))
+                return;
+            if (Contains(oNew, aoRegions[i]) ||
+                UnionIsRectangle(aoRegions[i], oNew))
+            {
+                oNew = Union(aoRegions[i], oNew);
+                aoRegions.erase(aoRegions.begin() + i);
+                bMerged = true;
+                break;
+            }
+        }
+    }
+    aoRegions.push_back(oNew);
+
+    // Bound the size of the list, at the expense of precision
+    constexpr size_t MAX_REGIONS = 256;
+    if (aoRegions.size() > MAX_REGIONS)
+    {
+        GDALRasterWindow oBBox = aoRegions[0];
+        for (const auto &oRegion : aoRegions)
+            oBBox = Union(oBBox, oRegion);
+        aoRegions.clear();
+        aoRegions.push_back(oBBox);
+    }
+}
+
+/************************************************************************/
+/*                          MarkDirtyRegion()                           */
+/************************************************************************/
+
+/**
+ * \brief Record that a region of the dataset has been modified.
+ *
+ * This is a no-op unless the GDAL_TRACK_DIRTY_REGIONS configuration option
+ * is set to YES when the dataset is first written. It is called by
+ * GDALDataset::RasterIO(), GDALRasterBand::RasterIO(),
+ * GDALRasterBand::WriteBlock() and GDALRasterBand::Fill(), and may be called
+ * by drivers that write pixels through other code paths.
+ *
+ * @param nXOff Left pixel offset of the region.
+ * @param nYOff Top line offset of the region.
+ * @param nXSize Width of the region in pixels.
+ * @param nYSize Height of the region in lines.
+ *
+ * @see GetDirtyRegions()
+ * @since GDAL 3.10
+ */
+void GDALDataset::MarkDirtyRegion(int nXOff, int nYOff, int nXSize,
+                                  int nYSize)
+{
+    if (!m_poPrivate || nXSize <= 0 || nYSize <= 0)
+        return;
+    if (m_poPrivate->m_nTrackDirtyRegions == 0)
+        return;
+    std::lock_guard<std::mutex> oLock(m_poPrivate->m_oDirtyRegionsMutex);
+    if (m_poPrivate->m_nTrackDirtyRegions < 0)
+    {
+        m_poPrivate->m_nTrackDirtyRegions =
+            CPLTestBool(CPLGetConfigOption("GDAL_TRACK_DIRTY_REGIONS", "NO"));
+    }
+    if (m_poPrivate->m_nTrackDirtyRegions == 0)
+        return;
+
+    GDALRasterWindow oRegion;
+    oRegion.nXOff = nXOff;
+    oRegion.nYOff = nYOff;
+    oRegion.nXSize = nXSize;
+    oRegion.nYSize = nYSize;
+    AddDirtyRegion(m_poPrivate->m_aoDirtyRegions, oRegion);
+}
+
+/************************************************************************/
+/*                          GetDirtyRegions()                           */
+/************************************************************************/
+
+/**
+ * \brief Return the regions of the dataset that have been modified.
+ *
+ * This returns the regions recorded by MarkDirtyRegion() since the dataset
+ * has been opened, plus the ones persisted in the REGIONS item of the
+ * DIRTY_REGIONS metadata domain by previous sessions.
+ *
+ * When the GDAL_TRACK_DIRTY_REGIONS configuration option is set to YES,
+ * and the dataset has overviews, the dirty regions are persisted in that
+ * metadata item when the dataset is closed, so that the overviews can be
+ * refreshed later, for example with gdaladdo
+ * --partial-refresh-from-dirty-regions.
+ *
+ * @return a list of rectangles, in pixel coordinates.
+ * @see ClearDirtyRegions()
+ * @since GDAL 3.10
+ */
+std::vector<GDALRasterWindow> GDALDataset::GetDirtyRegions()
+{
+    std::vector<GDALRasterWindow> aoRegions;
+    const char *pszPersisted = GetMetadataItem("REGIONS", "DIRTY_REGIONS");
+    if (pszPersisted)
+    {
+        const CPLStringList aosRegions(
+            CSLTokenizeString2(pszPersisted, ";", 0));
+        for (const char *pszRegion : aosRegions)
+        {
+            const CPLStringList aosTokens(
+                CSLTokenizeString2(pszRegion, ",", 0));
+            if (aosTokens.size() != 4)
+                continue;
+            GDALRasterWindow oRegion;
+            oRegion.nXOff = atoi(aosTokens[0]);
+            oRegion.nYOff = atoi(aosTokens[1]);
+            oRegion.nXSize = atoi(aosTokens[2]);
+            oRegion.nYSize = atoi(aosTokens[3]);
+            // Clamp to the raster, in case it has been resized
+            oRegion.nXOff = std::max(0, std::min(oRegion.nXOff, nRasterXSize));
+            oRegion.nYOff = std::max(0, std::min(oRegion.nYOff, nRasterYSize));
+            oRegion.nXSize = std::max(
+                0, std::min(oRegion.nXSize, nRasterXSize - oRegion.nXOff));
+            oRegion.nYSize = std::max(
+                0, std::min(oRegion.nYSize, nRasterYSize - oRegion.nYOff));
+            if (oRegion.nXSize > 0 && oRegion.nYSize > 0)
+                AddDirtyRegion(aoRegions, oRegion);
+        }
+    }
+
+    if (m_poPrivate)
+    {
+        std::lock_guard<std::mutex> oLock(m_poPrivate->m_oDirtyRegionsMutex);
+        for (const auto &oRegion : m_poPrivate->m_aoDirtyRegions)
+            AddDirtyRegion(aoRegions, oRegion);
+    }
+    return aoRegions;
+}
+
+/************************************************************************/
+/*                         ClearDirtyRegions()                          */
+/************************************************************************/
+
+/**
+ * \brief Forget the regions of the dataset that have been modified.
+ *
+ * Both the regions recorded during this session and the persisted ones are
+ * cleared. This is typically called once overviews have been refreshed.
+ *
+ * @see GetDirtyRegions()
+ * @since GDAL 3.10
+ */
+void GDALDataset::ClearDirtyRegions()
+{
+    if (m_poPrivate)
+    {
+        std::lock_guard<std::mutex> oLock(m_poPrivate->m_oDirtyRegionsMutex);
+        m_poPrivate->m_aoDirtyRegions.clear();
+    }
+    if (GetMetadataItem("REGIONS", "DIRTY_REGIONS"))
+        SetMetadataItem("REGIONS", nullptr, "DIRTY_REGIONS");
+}
+
+/************************************************************************/
+/*                        PersistDirtyRegions()                         */
+/************************************************************************/
+
+// Called by GDALClose() to save the regions recorded during this session
+// with the dataset, so that its overviews can be refreshed later.
+void GDALDataset::PersistDirtyRegions()
+{
+    if (!m_poPrivate || eAccess != GA_Update)
+        return;
+    {
+        std::lock_guard<std::mutex> oLock(m_poPrivate->m_oDirtyRegionsMutex);
+        if (m_poPrivate->m_aoDirtyRegions.empty())
+            return;
+    }
+    // Without overviews, there is nothing to refresh.
+    if (nBands == 0 || papoBands[0]->GetOverviewCount() == 0)
+        return;
+
+    std::string osRegions;
+    for (const auto &oRegion : GetDirtyRegions())
+    {
+        if (!osRegions.empty())
+            osRegions += ';';
+        osRegions += CPLSPrintf("%d,%d,%d,%d", oRegion.nXOff, oRegion.nYOff,
+                                oRegion.nXSize, oRegion.nYSize);
+    }
+    SetMetadataItem("REGIONS", osRegions.c_str(), "DIRTY_REGIONS");
+}
+
 /************************************************************************/
 /*                          GetOpenDatasets()                           */
 /************************************************************************/
@@ -3608,6 +4096,9 @@ GDALDatasetH CPL_STDCALL GDALOpenEx(const char *pszFilename,
         }
     }
 
+    CPLTraceSpan oSpan("gdal", "GDALOpen");
+    oSpan.AddArg("filename", pszFilename);
+
     GDALDriverManager *poDM = GetGDALDriverManager();
     // CPLLocaleC  oLocaleForcer;
 
@@ -3701,20 +4192,23 @@ retry:
             continue;
         }
 
-        if (poDriver->GetMetadataItem(GDAL_DCAP_OPEN) == nullptr)
+        // Use the cached capabilities of the driver rather than looking up
+        // several metadata items for each of the registered drivers.
+        const int nOpenCaps = poDriver->GetOpenCapabilities();
+        if ((nOpenCaps & GDALDriver::OPEN_CAP_OPEN) == 0)
             continue;
 
         if ((nOpenFlags & GDAL_OF_RASTER) != 0 &&
             (nOpenFlags & GDAL_OF_VECTOR) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_RASTER) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_RASTER) == 0)
             continue;
         if ((nOpenFlags & GDAL_OF_VECTOR) != 0 &&
             (nOpenFlags & GDAL_OF_RASTER) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_VECTOR) == 0)
             continue;
         if ((nOpenFlags & GDAL_OF_MULTIDIM_RASTER) != 0 &&
             (nOpenFlags & GDAL_OF_RASTER) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_MULTIDIM_RASTER) == 0)
             continue;
 
         // Remove general OVERVIEW_LEVEL open options from list before passing
@@ -4149,6 +4643,8 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
         if (poDS->Dereference() > 0)
             return CE_None;
 
+        poDS->WaitAsyncRasterIO();
+        poDS->PersistDirtyRegions();
         CPLErr eErr = poDS->Close();
         delete poDS;
 
@@ -4163,6 +4659,8 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
     /* -------------------------------------------------------------------- */
     /*      This is not shared dataset, so directly delete it.              */
     /* -------------------------------------------------------------------- */
+    poDS->WaitAsyncRasterIO();
+    poDS->PersistDirtyRegions();
     CPLErr eErr = poDS->Close();
     delete poDS;
 
@@ -48,6 +48,179 @@
 #include "gdal.h"
 
 //! @cond Doxygen_Suppress
+
+namespace
+{
+
+/************************************************************************/
+/* ==================================================================== */
+/*                   GDALCachedVirtualOverviewDataset                   */
+/* ==================================================================== */
+/************************************************************************/
+
+// Overview level computed on the fly, block by block, from the previous
+// level (or from the full resolution dataset for the first level). Computed
+// blocks are kept in the block cache, so repeated reads are cheap.
+class GDALCachedVirtualOverviewDataset final : public GDALDataset
+{
+  public:
+    GDALCachedVirtualOverviewDataset(GDALDataset *poBaseDS,
+                                     GDALDataset *poSrcDS, int nXSize,
+                                     int nYSize,
+                                     GDALRIOResampleAlg eResampleAlg,
+                                     int *pnBusyCounter);
+};
+
+/************************************************************************/
+/* ==================================================================== */
+/*                    GDALCachedVirtualOverviewBand                     */
+/* ==================================================================== */
+/************************************************************************/
+
+class GDALCachedVirtualOverviewBand final : public GDALRasterBand
+{
+    GDALRasterBand *m_poBaseBand = nullptr;
+    GDALRasterBand *m_poSrcBand = nullptr;
+    GDALRIOResampleAlg m_eResampleAlg = GRIORA_NearestNeighbour;
+    int *m_pnBusyCounter = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALCachedVirtualOverviewBand)
+
+  protected:
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override;
+
+  public:
+    GDALCachedVirtualOverviewBand(GDALCachedVirtualOverviewDataset *poDSIn,
+                                  int nBandIn, GDALRasterBand *poBaseBand,
+                                  GDALRasterBand *poSrcBand,
+                                  GDALRIOResampleAlg eResampleAlg,
+                                  int *pnBusyCounter);
+
+    double GetNoDataValue(int *pbSuccess) override
+    {
+        return m_poBaseBand->GetNoDataValue(pbSuccess);
+    }
+
+    GDALColorInterp GetColorInterpretation() override
+    {
+        return m_poBaseBand->GetColorInterpretation();
+    }
+
+    GDALColorTable *GetColorTable() override
+    {
+        return m_poBaseBand->GetColorTable();
+    }
+
+    double GetOffset(int *pbSuccess) override
+    {
+        return m_poBaseBand->GetOffset(pbSuccess);
+    }
+
+    double GetScale(int *pbSuccess) override
+    {
+        return m_poBaseBand->GetScale(pbSuccess);
+    }
+};
+
+/************************************************************************/
+/*                  GDALCachedVirtualOverviewDataset()                  */
+/************************************************************************/
+
+GDALCachedVirtualOverviewDataset::GDALCachedVirtualOverviewDataset(
+    GDALDataset *poBaseDS, GDALDataset *poSrcDS, int nXSize, int nYSize,
+    GDALRIOResampleAlg eResampleAlg, int *pnBusyCounter)
+{
+    nRasterXSize = nXSize;
+    nRasterYSize = nYSize;
+    eAccess = GA_ReadOnly;
+    for (int i = 1; i <= poBaseDS->GetRasterCount(); ++i)
+    {
+        SetBand(i, new GDALCachedVirtualOverviewBand(
+                       this, i, poBaseDS->GetRasterBand(i),
+                       poSrcDS->GetRasterBand(i), eResampleAlg,
+                       pnBusyCounter));
+    }
+}
+
+/************************************************************************/
+/*                   GDALCachedVirtualOverviewBand()                    */
+/************************************************************************/
+
+GDALCachedVirtualOverviewBand::GDALCachedVirtualOverviewBand(
+    GDALCachedVirtualOverviewDataset *poDSIn, int nBandIn,
+    GDALRasterBand *poBaseBand, GDALRasterBand *poSrcBand,
+    GDALRIOResampleAlg eResampleAlg, int *pnBusyCounter)
+    : m_poBaseBand(poBaseBand), m_poSrcBand(poSrcBand),
+      m_eResampleAlg(eResampleAlg), m_pnBusyCounter(pnBusyCounter)
+{
+    poDS = poDSIn;
+    nBand = nBandIn;
+    eAccess = GA_ReadOnly;
+    nRasterXSize = poDSIn->GetRasterXSize();
+    nRasterYSize = poDSIn->GetRasterYSize();
+    eDataType = poBaseBand->GetRasterDataType();
+    nBlockXSize = std::min(256, nRasterXSize);
+    nBlockYSize = std::min(256, nRasterYSize);
+}
+
+/************************************************************************/
+/*                             IReadBlock()                             */
+/************************************************************************/
+
+CPLErr GDALCachedVirtualOverviewBand::IReadBlock(int nBlockXOff,
+                                                 int nBlockYOff, void *pImage)
+{
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nReqXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+    const int nReqYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+
+    // Window of the source level covered by this block
+    const double dfXRatio =
+        static_cast<double>(m_poSrcBand->GetXSize()) / nRasterXSize;
+    const double dfYRatio =
+        static_cast<double>(m_poSrcBand->GetYSize()) / nRasterYSize;
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    sExtraArg.eResampleAlg = m_eResampleAlg;
+    sExtraArg.bFloatingPointWindowValidity = TRUE;
+    sExtraArg.dfXOff = nXOff * dfXRatio;
+    sExtraArg.dfYOff = nYOff * dfYRatio;
+    sExtraArg.dfXSize =
+        std::min(nReqXSize * dfXRatio,
+                 static_cast<double>(m_poSrcBand->GetXSize()) -
+                     sExtraArg.dfXOff);
+    sExtraArg.dfYSize =
+        std::min(nReqYSize * dfYRatio,
+                 static_cast<double>(m_poSrcBand->GetYSize()) -
+                     sExtraArg.dfYOff);
+    const int nSrcXOff = static_cast<int>(sExtraArg.dfXOff);
+    const int nSrcYOff = static_cast<int>(sExtraArg.dfYOff);
+    const int nSrcXSize =
+        std::min(m_poSrcBand->GetXSize(),
+                 static_cast<int>(
+                     std::ceil(sExtraArg.dfXOff + sExtraArg.dfXSize - 1e-8))) -
+        nSrcXOff;
+    const int nSrcYSize =
+        std::min(m_poSrcBand->GetYSize(),
+                 static_cast<int>(
+                     std::ceil(sExtraArg.dfYOff + sExtraArg.dfYSize - 1e-8))) -
+        nSrcYOff;
+
+    // Prevent the full resolution band from selecting this very overview
+    // to serve the request.
+    ++(*m_pnBusyCounter);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const CPLErr eErr = m_poSrcBand->RasterIO(
+        GF_Read, nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize, pImage, nReqXSize,
+        nReqYSize, eDataType, nDTSize,
+        static_cast<GSpacing>(nDTSize) * nBlockXSize, &sExtraArg);
+    --(*m_pnBusyCounter);
+    return eErr;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                        GDALDefaultOverviews()                        */
 /************************************************************************/
@@ -73,6 +246,85 @@ GDALDefaultOverviews::~GDALDefaultOverviews()
     CloseDependentDatasets();
 }
 
+/************************************************************************/
+/*                       CreateVirtualOverviews()                       */
+/************************************************************************/
+
+void GDALDefaultOverviews::CreateVirtualOverviews()
+{
+    if (m_bCheckedForVirtualOverviews)
+        return;
+    m_bCheckedForVirtualOverviews = true;
+
+    // Only for full resolution datasets opened in read-only mode, so that
+    // the cached blocks cannot become stale.
+    if (poDS == nullptr || poBaseDS != nullptr ||
+        poDS->GetAccess() != GA_ReadOnly || poDS->GetRasterCount() == 0 ||
+        !CPLTestBool(
+            CPLGetConfigOption("GDAL_CACHED_VIRTUAL_OVERVIEWS", "NO")))
+    {
+        return;
+    }
+    const int nBands = poDS->GetRasterCount();
+    for (int i = 1; i <= nBands; ++i)
+    {
+        const auto poBand = poDS->GetRasterBand(i);
+        if (poBand->GetXSize() != poDS->GetRasterXSize() ||
+            poBand->GetYSize() != poDS->GetRasterYSize())
+        {
+            return;
+        }
+    }
+
+    const char *pszResampling = CPLGetConfigOption(
+        "GDAL_CACHED_VIRTUAL_OVERVIEWS_RESAMPLING", "NEAREST");
+    const GDALRIOResampleAlg eResampleAlg =
+        GDALRasterIOGetResampleAlg(pszResampling);
+
+    // Power-of-two levels, down to the one that fits in 256x256 pixels,
+    // each one computed from the previous one.
+    constexpr int MIN_SIZE = 256;
+    GDALDataset *poSrcDS = poDS;
+    for (int nFactor = 2; poSrcDS->GetRasterXSize() > MIN_SIZE ||
+                          poSrcDS->GetRasterYSize() > MIN_SIZE;
+         nFactor *= 2)
+    {
+        const int nXSize = static_cast<int>(
+            (static_cast<GIntBig>(poDS->GetRasterXSize()) + nFactor - 1) /
+            nFactor);
+        const int nYSize = static_cast<int>(
+            (static_cast<GIntBig>(poDS->GetRasterYSize()) + nFactor - 1) /
+            nFactor);
+        poSrcDS = new GDALCachedVirtualOverviewDataset(
+            poDS, poSrcDS, nXSize, nYSize, eResampleAlg,
+            &m_nVirtualOverviewsBusyCounter);
+        m_apoVirtualOverviews.push_back(poSrcDS);
+        if (nFactor > INT_MAX / 2)
+            break;
+    }
+    if (!m_apoVirtualOverviews.empty())
+    {
+        CPLDebug("GDAL", "Using %d cached virtual overview levels for %s",
+                 static_cast<int>(m_apoVirtualOverviews.size()),
+                 poDS->GetDescription());
+    }
+}
+
+/************************************************************************/
+/*                      DestroyVirtualOverviews()                       */
+/************************************************************************/
+
+void GDALDefaultOverviews::DestroyVirtualOverviews()
+{
+    // Most reduced levels first, as they read from the previous ones.
+    for (auto it = m_apoVirtualOverviews.rbegin();
+         it != m_apoVirtualOverviews.rend(); ++it)
+    {
+        delete *it;
+    }
+    m_apoVirtualOverviews.clear();
+}
+
 /************************************************************************/
 /*                       CloseDependentDatasets()                       */
 /************************************************************************/
@@ -80,6 +332,12 @@ GDALDefaultOverviews::~GDALDefaultOverviews()
 int GDALDefaultOverviews::CloseDependentDatasets()
 {
     bool bHasDroppedRef = false;
+    if (!m_apoVirtualOverviews.empty())
+    {
+        bHasDroppedRef = true;
+        DestroyVirtualOverviews();
+    }
+
     if (poODS != nullptr)
     {
         bHasDroppedRef = true;
@@ -406,7 +664,16 @@ void GDALDefaultOverviews::OverviewScan()
 int GDALDefaultOverviews::GetOverviewCount(int nBand)
 
 {
-    if (poODS == nullptr || nBand < 1 || nBand > poODS->GetRasterCount())
+    if (poODS == nullptr)
+    {
+        if (poDS == nullptr || m_nVirtualOverviewsBusyCounter > 0 ||
+            nBand < 1 || nBand > poDS->GetRasterCount())
+            return 0;
+        CreateVirtualOverviews();
+        return static_cast<int>(m_apoVirtualOverviews.size());
+    }
+
+    if (nBand < 1 || nBand > poODS->GetRasterCount())
         return 0;
 
     GDALRasterBand *poBand = poODS->GetRasterBand(nBand);
@@ -426,7 +693,15 @@ int GDALDefaultOverviews::GetOverviewCount(int nBand)
 GDALRasterBand *GDALDefaultOverviews::GetOverview(int nBand, int iOverview)
 
 {
-    if (poODS == nullptr || nBand < 1 || nBand > poODS->GetRasterCount())
+    if (poODS == nullptr)
+    {
+        if (m_nVirtualOverviewsBusyCounter > 0 || iOverview < 0 ||
+            iOverview >= GetOverviewCount(nBand))
+            return nullptr;
+        return m_apoVirtualOverviews[iOverview]->GetRasterBand(nBand);
+    }
+
+    if (nBand < 1 || nBand > poODS->GetRasterCount())
         return nullptr;
 
     GDALRasterBand *const poBand = poODS->GetRasterBand(nBand);
@@ -640,6 +915,9 @@ CPLErr GDALDefaultOverviews::BuildOverviews(
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    // Real overviews supersede the virtual ones.
+    DestroyVirtualOverviews();
+
     if (nOverviews == 0)
         return CleanOverviews();
 
@@ -2690,13 +2690,14 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             CSLFindString(papszAllowedDrivers,
                           GDALGetDriverShortName(poDriver)) == -1)
             continue;
+        const int nOpenCaps = poDriver->GetOpenCapabilities();
         if ((nIdentifyFlags & GDAL_OF_RASTER) != 0 &&
             (nIdentifyFlags & GDAL_OF_VECTOR) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_RASTER) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_RASTER) == 0)
             continue;
         if ((nIdentifyFlags & GDAL_OF_VECTOR) != 0 &&
             (nIdentifyFlags & GDAL_OF_RASTER) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_VECTOR) == 0)
             continue;
 
         if (poDriver->pfnIdentifyEx)
@@ -2740,13 +2741,14 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
 
         VALIDATE_POINTER1(poDriver, "GDALIdentifyDriver", nullptr);
 
+        const int nOpenCaps = poDriver->GetOpenCapabilities();
         if ((nIdentifyFlags & GDAL_OF_RASTER) != 0 &&
             (nIdentifyFlags & GDAL_OF_VECTOR) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_RASTER) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_RASTER) == 0)
             continue;
         if ((nIdentifyFlags & GDAL_OF_VECTOR) != 0 &&
             (nIdentifyFlags & GDAL_OF_RASTER) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
+            (nOpenCaps & GDALDriver::OPEN_CAP_VECTOR) == 0)
             continue;
 
         if (poDriver->pfnIdentifyEx != nullptr)
@@ -2815,9 +2817,58 @@ CPLErr GDALDriver::SetMetadataItem(const char *pszName, const char *pszValue,
             GDALMajorObject::SetMetadataItem(GDAL_DMD_EXTENSION, pszValue);
         }
     }
-    return GDALMajorObject::SetMetadataItem(pszName, pszValue, pszDomain);
+    const CPLErr eErr =
+        GDALMajorObject::SetMetadataItem(pszName, pszValue, pszDomain);
+    m_nOpenCapabilities = -1;
+    return eErr;
+}
+
+/************************************************************************/
+/*                            SetMetadata()                             */
+/************************************************************************/
+
+CPLErr GDALDriver::SetMetadata(char **papszMetadata, const char *pszDomain)
+
+{
+    const CPLErr eErr = GDALMajorObject::SetMetadata(papszMetadata, pszDomain);
+    m_nOpenCapabilities = -1;
+    return eErr;
+}
+
+/************************************************************************/
+/*                        GetOpenCapabilities()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Return a bit mask of OpenCapability flags.
+ *
+ * This is the same information as the GDAL_DCAP_OPEN, GDAL_DCAP_RASTER,
+ * GDAL_DCAP_VECTOR and GDAL_DCAP_MULTIDIM_RASTER metadata items, but cached,
+ * so that GDALOpenEx() can cheaply skip drivers that cannot handle the
+ * requested dataset type without looking up several metadata items of
+ * each registered driver at each call.
+ */
+int GDALDriver::GetOpenCapabilities()
+{
+    int nCaps = m_nOpenCapabilities.load(std::memory_order_relaxed);
+    if (nCaps < 0)
+    {
+        nCaps = 0;
+        if (GetMetadataItem(GDAL_DCAP_OPEN))
+            nCaps |= OPEN_CAP_OPEN;
+        if (GetMetadataItem(GDAL_DCAP_RASTER))
+            nCaps |= OPEN_CAP_RASTER;
+        if (GetMetadataItem(GDAL_DCAP_VECTOR))
+            nCaps |= OPEN_CAP_VECTOR;
+        if (GetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER))
+            nCaps |= OPEN_CAP_MULTIDIM_RASTER;
+        m_nOpenCapabilities.store(nCaps, std::memory_order_relaxed);
+    }
+    return nCaps;
 }
 
+//! @endcond
+
 /************************************************************************/
 /*                   DoesDriverHandleExtension()                        */
 /************************************************************************/
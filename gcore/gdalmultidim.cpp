@@ -31,6 +31,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <limits>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <utility>
@@ -39,6 +40,7 @@
 #include <ctype.h>  // isalnum
 
 #include "cpl_error_internal.h"
+#include "cpl_mem_cache.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "gdal_utils.h"
@@ -2267,6 +2269,9 @@ bool GDALAbstractMDArray::Write(const GUInt64 *arrayStartIdx,
         return false;
     }
 
+    if (auto poArray = dynamic_cast<GDALMDArray *>(this))
+        poArray->InvalidateDecodedChunkCache();
+
     return IWrite(arrayStartIdx, count, arrayStep, bufferStride, bufferDataType,
                   pSrcBuffer);
 }
@@ -4059,6 +4064,298 @@ bool GDALMDArray::IAdviseRead(const GUInt64 *, const size_t *,
 
 //! @endcond
 
+/************************************************************************/
+/*                                Drill()                               */
+/************************************************************************/
+
+/** Extract the values along one dimension at a set of points.
+ *
+ * This is typically used to extract time series ("pixel drilling") at many
+ * (x,y) locations of a (time,y,x) cube. Compared to issuing one Read() per
+ * point, the default implementation groups the points by chunk (see
+ * GetBlockSize()), and reads each chunk intersecting the request once, with
+ * a single Read() covering all the points that fall into it. Drivers may
+ * override it with a native implementation.
+ *
+ * The values are written in pDstBuffer as nPoints consecutive series of nCount
+ * values: the value at index nStartIdx + j along dimension iDim of point i is
+ * at position i * nCount + j.
+ *
+ * This is the same as the C function GDALMDArrayDrill().
+ *
+ * @param iDim       Index of the dimension along which values are extracted
+ *                   (e.g. the time dimension), in [0, GetDimensionCount()-1]
+ *                   range.
+ * @param nPoints    Number of points.
+ * @param panPointIndices Array of nPoints * (GetDimensionCount() - 1) values,
+ *                   with the indices of each point in all dimensions but
+ *                   iDim, in the order of GetDimensions().
+ * @param nStartIdx  Index of the first value to extract along iDim.
+ * @param nCount     Number of values to extract along iDim.
+ * @param bufferDataType Data type of values in pDstBuffer.
+ * @param pDstBuffer User buffer of at least nPoints * nCount values of
+ *                   bufferDataType.
+ * @param papszOptions Driver specific options, or nullptr. Currently unused.
+ *
+ * @return true in case of success.
+ *
+ * @since GDAL 3.10
+ */
+bool GDALMDArray::Drill(size_t iDim, size_t nPoints,
+                        const GUInt64 *panPointIndices, GUInt64 nStartIdx,
+                        size_t nCount,
+                        const GDALExtendedDataType &bufferDataType,
+                        void *pDstBuffer, CSLConstList papszOptions) const
+{
+    const auto &dims = GetDimensions();
+    const size_t nDims = dims.size();
+    if (iDim >= nDims)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Invalid dimension index");
+        return false;
+    }
+    if (!GetDataType().CanConvertTo(bufferDataType))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Array data type is not convertible to buffer data type");
+        return false;
+    }
+    if (nPoints == 0 || nCount == 0)
+        return true;
+    if (nDims > 1 && panPointIndices == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "panPointIndices is null");
+        return false;
+    }
+    if (pDstBuffer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "pDstBuffer is null");
+        return false;
+    }
+    if (nStartIdx >= dims[iDim]->GetSize() ||
+        nCount > dims[iDim]->GetSize() - nStartIdx)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "nStartIdx + nCount greater than dimension size");
+        return false;
+    }
+    if (nPoints > std::numeric_limits<size_t>::max() / nCount /
+                      std::max<size_t>(1, bufferDataType.GetSize()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Integer overflow");
+        return false;
+    }
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        for (size_t j = 0, k = 0; j < nDims; ++j)
+        {
+            if (j == iDim)
+                continue;
+            if (panPointIndices[i * (nDims - 1) + k] >= dims[j]->GetSize())
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "Index of point %u in dimension %u is out of range",
+                         static_cast<unsigned>(i), static_cast<unsigned>(j));
+                return false;
+            }
+            ++k;
+        }
+    }
+
+    return IDrill(iDim, nPoints, panPointIndices, nStartIdx, nCount,
+                  bufferDataType, pDstBuffer, papszOptions);
+}
+
+/************************************************************************/
+/*                               IDrill()                               */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+bool GDALMDArray::IDrill(size_t iDim, size_t nPoints,
+                         const GUInt64 *panPointIndices, GUInt64 nStartIdx,
+                         size_t nCount,
+                         const GDALExtendedDataType &bufferDataType,
+                         void *pDstBuffer,
+                         CSLConstList /* papszOptions */) const
+{
+    const auto &dims = GetDimensions();
+    const size_t nDims = dims.size();
+    const size_t nDTSize = bufferDataType.GetSize();
+    const size_t nOtherDims = nDims - 1;
+
+    // Dimensions whose block size is unknown are considered as made of blocks
+    // of size 1, except the drilled dimension, which is then read at once.
+    auto anBlockSize = GetBlockSize();
+    anBlockSize.resize(nDims);
+    for (size_t j = 0; j < nDims; ++j)
+    {
+        if (anBlockSize[j] == 0)
+            anBlockSize[j] = j == iDim ? nCount : 1;
+    }
+
+    // Group points by chunk
+    std::map<std::vector<GUInt64>, std::vector<size_t>> oMapChunkToPoints;
+    std::vector<GUInt64> anChunkIdx(nOtherDims);
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        for (size_t j = 0, k = 0; j < nDims; ++j)
+        {
+            if (j == iDim)
+                continue;
+            anChunkIdx[k] =
+                panPointIndices[i * nOtherDims + k] / anBlockSize[j];
+            ++k;
+        }
+        oMapChunkToPoints[anChunkIdx].push_back(i);
+    }
+
+    // Above that size, the bounding box of the points of a chunk is not read
+    // at once, but point per point.
+    constexpr size_t MAX_TEMP_BUFFER_SIZE = 64 * 1024 * 1024;
+
+    const GUInt64 nBlockSizeDrilledDim = anBlockSize[iDim];
+    const GUInt64 nEndIdx = nStartIdx + nCount;
+    GByte *pabyDst = static_cast<GByte *>(pDstBuffer);
+    std::vector<GUInt64> anStartIdx(nDims);
+    std::vector<size_t> anCount(nDims);
+    std::vector<GUInt64> anMinIdx(nOtherDims);
+    std::vector<GUInt64> anMaxIdx(nOtherDims);
+    std::vector<GByte> abyTemp;
+    for (const auto &[anChunk, anPoints] : oMapChunkToPoints)
+    {
+        // Bounding box of the points of this chunk
+        for (size_t k = 0; k < nOtherDims; ++k)
+        {
+            anMinIdx[k] = std::numeric_limits<GUInt64>::max();
+            anMaxIdx[k] = 0;
+        }
+        for (const size_t iPoint : anPoints)
+        {
+            for (size_t k = 0; k < nOtherDims; ++k)
+            {
+                const GUInt64 nIdx = panPointIndices[iPoint * nOtherDims + k];
+                anMinIdx[k] = std::min(anMinIdx[k], nIdx);
+                anMaxIdx[k] = std::max(anMaxIdx[k], nIdx);
+            }
+        }
+        size_t nBBoxElts = 1;
+        for (size_t k = 0; k < nOtherDims; ++k)
+            nBBoxElts *= static_cast<size_t>(anMaxIdx[k] - anMinIdx[k] + 1);
+
+        // Iterate over chunks along the drilled dimension
+        for (GUInt64 nIdx = nStartIdx; nIdx < nEndIdx;)
+        {
+            const GUInt64 nNextIdx = std::min(
+                (nIdx / nBlockSizeDrilledDim + 1) * nBlockSizeDrilledDim,
+                nEndIdx);
+            const size_t nSubCount = static_cast<size_t>(nNextIdx - nIdx);
+            const size_t nOffsetInSeries =
+                static_cast<size_t>(nIdx - nStartIdx);
+            anStartIdx[iDim] = nIdx;
+            anCount[iDim] = nSubCount;
+
+            const bool bReadBBox =
+                anPoints.size() > 1 &&
+                nBBoxElts <= MAX_TEMP_BUFFER_SIZE / nDTSize / nSubCount;
+            const size_t nReads = bReadBBox ? 1 : anPoints.size();
+            for (size_t iRead = 0; iRead < nReads; ++iRead)
+            {
+                size_t nTempElts = nSubCount;
+                for (size_t j = 0, k = 0; j < nDims; ++j)
+                {
+                    if (j == iDim)
+                        continue;
+                    if (bReadBBox)
+                    {
+                        anStartIdx[j] = anMinIdx[k];
+                        anCount[j] =
+                            static_cast<size_t>(anMaxIdx[k] - anMinIdx[k] + 1);
+                    }
+                    else
+                    {
+                        anStartIdx[j] =
+                            panPointIndices[anPoints[iRead] * nOtherDims + k];
+                        anCount[j] = 1;
+                    }
+                    nTempElts *= anCount[j];
+                    ++k;
+                }
+
+                try
+                {
+                    abyTemp.resize(nTempElts * nDTSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate temporary buffer");
+                    return false;
+                }
+                if (!Read(anStartIdx.data(), anCount.data(), nullptr, nullptr,
+                          bufferDataType, abyTemp.data()))
+                {
+                    return false;
+                }
+
+                // Scatter the values of the points into the output buffer
+                const size_t iFirstPoint = bReadBBox ? 0 : iRead;
+                const size_t iLastPoint =
+                    bReadBBox ? anPoints.size() : iRead + 1;
+                for (size_t iP = iFirstPoint; iP < iLastPoint; ++iP)
+                {
+                    const size_t iPoint = anPoints[iP];
+                    // Offset and stride, in elements, of the point in the
+                    // temporary row-major buffer
+                    size_t nSrcOffset = 0;
+                    size_t nStride = 1;
+                    size_t nDrilledDimStride = 1;
+                    for (size_t j = nDims, k = nOtherDims; j > 0;)
+                    {
+                        --j;
+                        if (j == iDim)
+                        {
+                            nDrilledDimStride = nStride;
+                        }
+                        else
+                        {
+                            --k;
+                            nSrcOffset +=
+                                static_cast<size_t>(
+                                    panPointIndices[iPoint * nOtherDims + k] -
+                                    anStartIdx[j]) *
+                                nStride;
+                        }
+                        nStride *= anCount[j];
+                    }
+                    GByte *pabyPointDst =
+                        pabyDst + (iPoint * nCount + nOffsetInSeries) * nDTSize;
+                    for (size_t iVal = 0; iVal < nSubCount; ++iVal)
+                    {
+                        GDALExtendedDataType::CopyValue(
+                            abyTemp.data() +
+                                (nSrcOffset + iVal * nDrilledDimStride) *
+                                    nDTSize,
+                            bufferDataType, pabyPointDst + iVal * nDTSize,
+                            bufferDataType);
+                    }
+                }
+
+                if (bufferDataType.NeedsFreeDynamicMemory())
+                {
+                    for (size_t i = 0; i < nTempElts; ++i)
+                        bufferDataType.FreeDynamicMemory(abyTemp.data() +
+                                                         i * nDTSize);
+                }
+            }
+
+            nIdx = nNextIdx;
+        }
+    }
+    return true;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                            MassageName()                             */
 /************************************************************************/
@@ -4340,10 +4637,334 @@ bool GDALMDArray::Read(const GUInt64 *arrayStartIdx, const size_t *count,
         return false;
     }
 
+    bool bHandled = false;
+    const bool bRet = ReadThroughDecodedChunkCache(
+        array, arrayStartIdx, count, arrayStep, bufferStride, bufferDataType,
+        pDstBuffer, bHandled);
+    if (bHandled)
+        return bRet;
+
     return array->IRead(arrayStartIdx, count, arrayStep, bufferStride,
                         bufferDataType, pDstBuffer);
 }
 
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                        DecodedChunkCache                             */
+/************************************************************************/
+
+struct GDALMDArray::DecodedChunkCache
+{
+    // Block size, clamped to the dimension sizes
+    std::vector<GUInt64> m_anBlockSize{};
+    size_t m_nMaxChunks = 0;
+
+    // Key is the binary representation of the chunk indices
+    lru11::Cache<std::string, std::shared_ptr<std::vector<GByte>>, std::mutex>
+        m_oCache;
+
+    DecodedChunkCache(std::vector<GUInt64> &&anBlockSize, size_t nMaxChunks)
+        : m_anBlockSize(std::move(anBlockSize)), m_nMaxChunks(nMaxChunks),
+          m_oCache(nMaxChunks, 0)
+    {
+    }
+};
+
+/************************************************************************/
+/*                    GetDecodedChunkCacheSize()                        */
+/************************************************************************/
+
+static GIntBig GetDecodedChunkCacheSize()
+{
+    const char *pszVal =
+        CPLGetConfigOption("GDAL_MDARRAY_CHUNK_CACHE_SIZE", nullptr);
+    if (pszVal == nullptr)
+        return 0;
+    if (strchr(pszVal, '%') != nullptr)
+    {
+        const double dfPct = CPLAtof(pszVal);
+        if (!(dfPct > 0 && dfPct <= 100))
+        {
+            CPLError(CE_Warning, CPLE_IllegalArg,
+                     "Invalid value for GDAL_MDARRAY_CHUNK_CACHE_SIZE. "
+                     "Ignoring it.");
+            return 0;
+        }
+        return static_cast<GIntBig>(static_cast<double>(GDALGetCacheMax64()) *
+                                    dfPct / 100);
+    }
+    GIntBig nVal = CPLAtoGIntBig(pszVal);
+    if (nVal < 0)
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for GDAL_MDARRAY_CHUNK_CACHE_SIZE. "
+                 "Ignoring it.");
+        return 0;
+    }
+    if (nVal < 100000)
+        nVal *= 1024 * 1024;
+    return nVal;
+}
+
+/************************************************************************/
+/*                       CopyFromDecodedChunk()                         */
+/************************************************************************/
+
+static void CopyFromDecodedChunk(const GByte *pabySrc,
+                                 const GDALExtendedDataType &eSrcDT,
+                                 const GPtrDiff_t *srcStride, GByte *pabyDst,
+                                 const GDALExtendedDataType &eDstDT,
+                                 const GPtrDiff_t *dstStride,
+                                 const size_t *count, size_t nDims)
+{
+    if (nDims == 1)
+    {
+        GDALExtendedDataType::CopyValues(pabySrc, eSrcDT, srcStride[0],
+                                         pabyDst, eDstDT, dstStride[0],
+                                         count[0]);
+        return;
+    }
+    const GPtrDiff_t nSrcStrideBytes =
+        srcStride[0] * static_cast<GPtrDiff_t>(eSrcDT.GetSize());
+    const GPtrDiff_t nDstStrideBytes =
+        dstStride[0] * static_cast<GPtrDiff_t>(eDstDT.GetSize());
+    for (size_t i = 0; i < count[0]; ++i)
+    {
+        CopyFromDecodedChunk(pabySrc, eSrcDT, srcStride + 1, pabyDst, eDstDT,
+                             dstStride + 1, count + 1, nDims - 1);
+        pabySrc += nSrcStrideBytes;
+        pabyDst += nDstStrideBytes;
+    }
+}
+
+/************************************************************************/
+/*                   ReadThroughDecodedChunkCache()                     */
+/************************************************************************/
+
+// When GDAL_MDARRAY_CHUNK_CACHE_SIZE is set, reads whole chunks of poArray
+// with IRead(), keep them decoded in a LRU cache attached to this array, and
+// extract the requested values from them. As views (GetView(), Transpose(),
+// etc.) end up calling Read() on their parent array, they share that cache.
+// bHandled is set to false if the request must go through IRead() directly.
+bool GDALMDArray::ReadThroughDecodedChunkCache(
+    const GDALMDArray *poArray, const GUInt64 *arrayStartIdx,
+    const size_t *count, const GInt64 *arrayStep,
+    const GPtrDiff_t *bufferStride, const GDALExtendedDataType &bufferDataType,
+    void *pDstBuffer, bool &bHandled) const
+{
+    bHandled = false;
+
+    const auto &dims = poArray->GetDimensions();
+    const size_t nDims = dims.size();
+    const auto &eDT = poArray->GetDataType();
+    const size_t nDTSize = eDT.GetSize();
+
+    if (!m_bHasTriedDecodedChunkCache)
+    {
+        m_bHasTriedDecodedChunkCache = true;
+        const GIntBig nCacheSize = GetDecodedChunkCacheSize();
+        if (nCacheSize == 0 || nDims == 0 ||
+            eDT.GetClass() == GEDTC_STRING || eDT.NeedsFreeDynamicMemory())
+        {
+            return true;
+        }
+        auto anBlockSize = poArray->GetBlockSize();
+        if (anBlockSize.size() != nDims)
+            return true;
+        uint64_t nChunkSize = nDTSize;
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            anBlockSize[i] = std::min(anBlockSize[i], dims[i]->GetSize());
+            if (anBlockSize[i] == 0)
+                return true;
+            if (nChunkSize > static_cast<uint64_t>(nCacheSize) / anBlockSize[i])
+            {
+                CPLDebug("GDAL",
+                         "Chunks of %s are larger than "
+                         "GDAL_MDARRAY_CHUNK_CACHE_SIZE. "
+                         "Not using decoded chunk cache",
+                         GetFullName().c_str());
+                return true;
+            }
+            nChunkSize *= anBlockSize[i];
+        }
+        const size_t nMaxChunks = static_cast<size_t>(
+            std::min<uint64_t>(static_cast<uint64_t>(nCacheSize) / nChunkSize,
+                               std::numeric_limits<size_t>::max() / 2));
+        m_poDecodedChunkCache = std::make_shared<DecodedChunkCache>(
+            std::move(anBlockSize), nMaxChunks);
+    }
+    if (!m_poDecodedChunkCache)
+        return true;
+
+    auto &oChunkCache = *m_poDecodedChunkCache;
+    const auto &anBlockSize = oChunkCache.m_anBlockSize;
+
+    // Compute the range of chunks intersected by the request. Requests that
+    // would not fit into the cache are directly forwarded to IRead(), to
+    // avoid evicting all cached chunks.
+    std::vector<GUInt64> anChunkIdxStart(nDims);
+    std::vector<GUInt64> anChunkIdxEnd(nDims);  // included
+    uint64_t nChunks = 1;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        if (arrayStep[i] == 0 && count[i] > 1)
+            return true;
+        const GInt64 nOffset =
+            static_cast<GInt64>(count[i] - 1) * arrayStep[i];
+        const GUInt64 nMinIdx =
+            nOffset < 0 ? arrayStartIdx[i] - static_cast<GUInt64>(-nOffset)
+                        : arrayStartIdx[i];
+        const GUInt64 nMaxIdx = nOffset < 0
+                                    ? arrayStartIdx[i]
+                                    : arrayStartIdx[i] +
+                                          static_cast<GUInt64>(nOffset);
+        anChunkIdxStart[i] = nMinIdx / anBlockSize[i];
+        anChunkIdxEnd[i] = nMaxIdx / anBlockSize[i];
+        nChunks *= anChunkIdxEnd[i] - anChunkIdxStart[i] + 1;
+        if (nChunks > oChunkCache.m_nMaxChunks)
+            return true;
+    }
+
+    bHandled = true;
+
+    const size_t nBufferDTSize = bufferDataType.GetSize();
+    GByte *pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
+    const std::vector<GInt64> anOnes(nDims, 1);
+    std::vector<GUInt64> anChunkIdx(anChunkIdxStart);
+    std::vector<GUInt64> anChunkOrigin(nDims);
+    std::vector<size_t> anChunkCount(nDims);
+    std::vector<GPtrDiff_t> anChunkBufferStride(nDims);
+    std::vector<GPtrDiff_t> anSrcStride(nDims);
+    std::vector<size_t> anSubCount(nDims);
+    std::string osKey;
+    while (true)
+    {
+        // Compute the part of the request that falls into the current chunk
+        bool bEmpty = false;
+        size_t nSrcOffset = 0;
+        GPtrDiff_t nDstOffset = 0;
+        size_t nChunkElts = 1;
+        for (size_t i = nDims; i > 0;)
+        {
+            --i;
+            const GUInt64 nOrigin = anChunkIdx[i] * anBlockSize[i];
+            anChunkOrigin[i] = nOrigin;
+            anChunkCount[i] = static_cast<size_t>(
+                std::min(anBlockSize[i], dims[i]->GetSize() - nOrigin));
+            const GUInt64 nLast = nOrigin + anChunkCount[i] - 1;
+            const GUInt64 nStart = arrayStartIdx[i];
+
+            // Range [nFirstJ, nLastJ] of request indices that fall into
+            // [nOrigin, nLast]
+            GUInt64 nFirstJ = 0;
+            GUInt64 nLastJ = 0;
+            if (arrayStep[i] >= 0)
+            {
+                const GUInt64 nStep = std::max<GInt64>(arrayStep[i], 1);
+                if (nStart > nLast)
+                {
+                    bEmpty = true;
+                    break;
+                }
+                if (nStart < nOrigin)
+                    nFirstJ = (nOrigin - nStart + nStep - 1) / nStep;
+                nLastJ = std::min<GUInt64>(count[i] - 1,
+                                           (nLast - nStart) / nStep);
+            }
+            else
+            {
+                const GUInt64 nStep = static_cast<GUInt64>(-arrayStep[i]);
+                if (nStart < nOrigin)
+                {
+                    bEmpty = true;
+                    break;
+                }
+                if (nStart > nLast)
+                    nFirstJ = (nStart - nLast + nStep - 1) / nStep;
+                nLastJ = std::min<GUInt64>(count[i] - 1,
+                                           (nStart - nOrigin) / nStep);
+            }
+            if (nFirstJ > nLastJ)
+            {
+                bEmpty = true;
+                break;
+            }
+            anSubCount[i] = static_cast<size_t>(nLastJ - nFirstJ + 1);
+
+            const GUInt64 nFirstIdx = static_cast<GUInt64>(
+                static_cast<GInt64>(nStart) +
+                static_cast<GInt64>(nFirstJ) * arrayStep[i]);
+            nSrcOffset += static_cast<size_t>(nFirstIdx - nOrigin) * nChunkElts;
+            nDstOffset += static_cast<GPtrDiff_t>(nFirstJ) * bufferStride[i];
+            anChunkBufferStride[i] = static_cast<GPtrDiff_t>(nChunkElts);
+            anSrcStride[i] = static_cast<GPtrDiff_t>(nChunkElts) * arrayStep[i];
+            nChunkElts *= anChunkCount[i];
+        }
+
+        if (!bEmpty)
+        {
+            osKey.assign(reinterpret_cast<const char *>(anChunkIdx.data()),
+                         nDims * sizeof(GUInt64));
+            std::shared_ptr<std::vector<GByte>> poChunk;
+            if (!oChunkCache.m_oCache.tryGet(osKey, poChunk))
+            {
+                poChunk = std::make_shared<std::vector<GByte>>();
+                try
+                {
+                    poChunk->resize(nChunkElts * nDTSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate decoded chunk");
+                    return false;
+                }
+                if (!poArray->IRead(anChunkOrigin.data(), anChunkCount.data(),
+                                    anOnes.data(), anChunkBufferStride.data(),
+                                    eDT, poChunk->data()))
+                {
+                    return false;
+                }
+                oChunkCache.m_oCache.insert(osKey, poChunk);
+            }
+            CopyFromDecodedChunk(poChunk->data() + nSrcOffset * nDTSize, eDT,
+                                 anSrcStride.data(),
+                                 pabyDstBuffer + nDstOffset * nBufferDTSize,
+                                 bufferDataType, bufferStride,
+                                 anSubCount.data(), nDims);
+        }
+
+        // Go to next chunk
+        size_t iDim = nDims;
+        while (true)
+        {
+            if (iDim == 0)
+                return true;
+            --iDim;
+            if (anChunkIdx[iDim] < anChunkIdxEnd[iDim])
+            {
+                ++anChunkIdx[iDim];
+                break;
+            }
+            anChunkIdx[iDim] = anChunkIdxStart[iDim];
+        }
+    }
+}
+
+/************************************************************************/
+/*                    InvalidateDecodedChunkCache()                     */
+/************************************************************************/
+
+void GDALMDArray::InvalidateDecodedChunkCache()
+{
+    if (m_poDecodedChunkCache)
+        m_poDecodedChunkCache->m_oCache.clear();
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                          GetRootGroup()                              */
 /************************************************************************/
@@ -11515,6 +12136,32 @@ int GDALMDArrayAdviseReadEx(GDALMDArrayH hArray, const GUInt64 *arrayStartIdx,
     return hArray->m_poImpl->AdviseRead(arrayStartIdx, count, papszOptions);
 }
 
+/************************************************************************/
+/*                          GDALMDArrayDrill()                          */
+/************************************************************************/
+
+/** Extract the values along one dimension at a set of points.
+ *
+ * This is the same as the C++ method GDALMDArray::Drill()
+ *
+ * @return TRUE in case of success.
+ *
+ * @since GDAL 3.10
+ */
+int GDALMDArrayDrill(GDALMDArrayH hArray, size_t iDim, size_t nPoints,
+                     const GUInt64 *panPointIndices, GUInt64 nStartIdx,
+                     size_t nCount, GDALExtendedDataTypeH bufferDataType,
+                     void *pDstBuffer, CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hArray, __func__, FALSE);
+    VALIDATE_POINTER1(bufferDataType, __func__, FALSE);
+    VALIDATE_POINTER1(pDstBuffer, __func__, FALSE);
+    // coverity[var_deref_model]
+    return hArray->m_poImpl->Drill(iDim, nPoints, panPointIndices, nStartIdx,
+                                   nCount, *(bufferDataType->m_poImpl),
+                                   pDstBuffer, papszOptions);
+}
+
 /************************************************************************/
 /*                         GDALMDArrayGetAttribute()                    */
 /************************************************************************/
@@ -34,6 +34,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -55,7 +58,9 @@
 /* ******************************************************************** */
 
 /* This class is a singleton that maintains a pool of opened datasets */
-/* The cache uses a LRU strategy */
+/* The cache uses a LRU strategy. Entries are also indexed by their */
+/* filename and open options, so that looking up a dataset does not */
+/* require walking the whole LRU list. */
 
 class GDALDatasetPool;
 static GDALDatasetPool *singleton = nullptr;
@@ -100,6 +105,10 @@ class GDALDatasetPool
     GDALProxyPoolCacheEntry *firstEntry = nullptr;
     GDALProxyPoolCacheEntry *lastEntry = nullptr;
 
+    /* Entries with a non-null pszFileNameAndOpenOptions, indexed by it */
+    std::unordered_map<std::string, std::vector<GDALProxyPoolCacheEntry *>>
+        mapEntries{};
+
     /* This variable prevents a dataset that is going to be opened in
      * GDALDatasetPool::_RefDataset */
     /* from increasing refCount if, during its opening, it creates a
@@ -125,6 +134,8 @@ class GDALDatasetPool
     void _CloseDatasetIfZeroRefCount(const char *pszFileName,
                                      CSLConstList papszOpenOptions,
                                      GDALAccess eAccess, const char *pszOwner);
+    void AddEntryToMap(GDALProxyPoolCacheEntry *entry);
+    void RemoveEntryFromMap(GDALProxyPoolCacheEntry *entry);
 
 #ifdef DEBUG_PROXY_POOL
     // cppcheck-suppress unusedPrivateFunction
@@ -247,6 +258,42 @@ static std::string GetFilenameAndOpenOptions(const char *pszFileName,
     return osFilenameAndOO;
 }
 
+/************************************************************************/
+/*                           AddEntryToMap()                            */
+/************************************************************************/
+
+void GDALDatasetPool::AddEntryToMap(GDALProxyPoolCacheEntry *entry)
+{
+    CPLAssert(entry->pszFileNameAndOpenOptions);
+    mapEntries[entry->pszFileNameAndOpenOptions].push_back(entry);
+}
+
+/************************************************************************/
+/*                         RemoveEntryFromMap()                         */
+/************************************************************************/
+
+void GDALDatasetPool::RemoveEntryFromMap(GDALProxyPoolCacheEntry *entry)
+{
+    if (!entry->pszFileNameAndOpenOptions)
+        return;
+    auto oIter = mapEntries.find(entry->pszFileNameAndOpenOptions);
+    if (oIter == mapEntries.end())
+    {
+        CPLAssert(false);
+        return;
+    }
+    auto &entries = oIter->second;
+    auto oIterEntry = std::find(entries.begin(), entries.end(), entry);
+    CPLAssert(oIterEntry != entries.end());
+    if (oIterEntry != entries.end())
+    {
+        *oIterEntry = entries.back();
+        entries.pop_back();
+    }
+    if (entries.empty())
+        mapEntries.erase(oIter);
+}
+
 /************************************************************************/
 /*                            _RefDataset()                             */
 /************************************************************************/
@@ -264,19 +311,13 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     const auto EvictEntryWithZeroRefCount =
         [this, responsiblePID](bool evictEntryWithOpenedDataset)
     {
-        GDALProxyPoolCacheEntry *cur = firstEntry;
-        GDALProxyPoolCacheEntry *candidate = nullptr;
-        while (cur)
+        // Find the least recently used entry that is not referenced
+        GDALProxyPoolCacheEntry *candidate = lastEntry;
+        while (candidate &&
+               !(candidate->refCount == 0 &&
+                 (!evictEntryWithOpenedDataset || candidate->nRAMUsage > 0)))
         {
-            GDALProxyPoolCacheEntry *next = cur->next;
-
-            if (cur->refCount == 0 &&
-                (!evictEntryWithOpenedDataset || cur->nRAMUsage > 0))
-            {
-                candidate = cur;
-            }
-
-            cur = next;
+            candidate = candidate->prev;
         }
         if (candidate == nullptr)
             return false;
@@ -284,6 +325,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         nRAMUsage -= candidate->nRAMUsage;
         candidate->nRAMUsage = 0;
 
+        RemoveEntryFromMap(candidate);
         CPLFree(candidate->pszFileNameAndOpenOptions);
         candidate->pszFileNameAndOpenOptions = nullptr;
 
@@ -331,18 +373,17 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         return true;
     };
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
-
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
 
-    while (cur)
+    GDALProxyPoolCacheEntry *cur = nullptr;
+    const auto oIterEntries = mapEntries.find(osFilenameAndOO);
+    for (size_t i = 0;
+         oIterEntries != mapEntries.end() && i < oIterEntries->second.size();
+         ++i)
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
-
-        if (cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
-            ((bShared && cur->responsiblePID == responsiblePID &&
+        cur = oIterEntries->second[i];
+        if (((bShared && cur->responsiblePID == responsiblePID &&
               ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
                (cur->pszOwner != nullptr && pszOwner != nullptr &&
                 strcmp(cur->pszOwner, pszOwner) == 0))) ||
@@ -369,8 +410,6 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             cur->refCount++;
             return cur;
         }
-
-        cur = next;
     }
 
     if (!bForceOpen)
@@ -412,6 +451,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     }
 
     cur->pszFileNameAndOpenOptions = CPLStrdup(osFilenameAndOO.c_str());
+    AddEntryToMap(cur);
     cur->pszOwner = (pszOwner) ? CPLStrdup(pszOwner) : nullptr;
     cur->responsiblePID = responsiblePID;
     cur->refCount = 1;
@@ -457,18 +497,18 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
     if (bInDestruction)
         return;
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
     GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
 
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
 
-    while (cur)
-    {
-        GDALProxyPoolCacheEntry *next = cur->next;
+    const auto oIterEntries = mapEntries.find(osFilenameAndOO);
+    if (oIterEntries == mapEntries.end())
+        return;
 
-        if (cur->refCount == 0 && cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
+    for (GDALProxyPoolCacheEntry *cur : oIterEntries->second)
+    {
+        if (cur->refCount == 0 &&
             ((pszOwner == nullptr && cur->pszOwner == nullptr) ||
              (pszOwner != nullptr && cur->pszOwner != nullptr &&
               strcmp(cur->pszOwner, pszOwner) == 0)) &&
@@ -484,6 +524,8 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             cur->nRAMUsage = 0;
 
             cur->poDS = nullptr;
+            // Invalidates oIterEntries, hence the break below
+            RemoveEntryFromMap(cur);
             CPLFree(cur->pszFileNameAndOpenOptions);
             cur->pszFileNameAndOpenOptions = nullptr;
             CPLFree(cur->pszOwner);
@@ -496,8 +538,6 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
             break;
         }
-
-        cur = next;
     }
 }
 
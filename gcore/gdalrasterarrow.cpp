@@ -0,0 +1,779 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Export of raster tiles as an Arrow C stream
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "gdalmultidim_priv.h"
+#include "cpl_json.h"
+#include "ogr_recordbatch.h"
+#include "ogr_spatialref.h"
+#include "ogrlayerarrow.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+constexpr const char *EXTENSION_NAME_FIXED_SHAPE_TENSOR =
+    "arrow.fixed_shape_tensor";
+
+// Default upper bound for the size of the "data" buffer of a batch
+constexpr size_t DEFAULT_MAX_BATCH_BYTES = 64 * 1024 * 1024;
+
+/************************************************************************/
+/*                      GDALRasterArrowStreamPrivate                    */
+/************************************************************************/
+
+struct GDALRasterArrowStreamPrivate
+{
+    GDALDataset *m_poDS = nullptr;
+    // Only set when the stream was created from a GDALMDArray
+    std::unique_ptr<GDALDataset> m_poOwnedDS{};
+    std::vector<int> m_anBands{};
+    GDALDataType m_eDT = GDT_Unknown;
+    int m_nTileXSize = 0;
+    int m_nTileYSize = 0;
+    int m_nTilesPerRow = 0;
+    int64_t m_nTileCount = 0;
+    int64_t m_nCurTile = 0;
+    int m_nMaxTilesPerBatch = 1;
+    bool m_bHasGT = false;
+    double m_adfGT[6] = {0, 1, 0, 0, 0, 1};
+    std::vector<double> m_adfFillValue{};
+    std::string m_osSchemaMetadata{};
+};
+
+/************************************************************************/
+/*                          RasterArrowGetFormat()                        */
+/************************************************************************/
+
+const char *RasterArrowGetFormat(GDALDataType eDT)
+{
+    switch (eDT)
+    {
+        case GDT_Byte:
+            return "C";
+        case GDT_Int8:
+            return "c";
+        case GDT_UInt16:
+            return "S";
+        case GDT_Int16:
+            return "s";
+        case GDT_UInt32:
+            return "I";
+        case GDT_Int32:
+            return "i";
+        case GDT_UInt64:
+            return "L";
+        case GDT_Int64:
+            return "l";
+        case GDT_Float32:
+            return "f";
+        case GDT_Float64:
+            return "g";
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                       RasterArrowEncodeMetadata()                      */
+/************************************************************************/
+
+// Serialize key/value pairs with the encoding of ArrowSchema::metadata
+char *RasterArrowEncodeMetadata(
+    const std::vector<std::pair<std::string, std::string>> &aoKeyValues)
+{
+    size_t nLen = sizeof(int32_t);
+    for (const auto &oKV : aoKeyValues)
+        nLen += 2 * sizeof(int32_t) + oKV.first.size() + oKV.second.size();
+    char *pszMetadata = static_cast<char *>(CPLMalloc(nLen));
+    size_t nOffset = 0;
+    const auto AppendInt32 = [pszMetadata, &nOffset](size_t nVal)
+    {
+        const int32_t nVal32 = static_cast<int32_t>(nVal);
+        memcpy(pszMetadata + nOffset, &nVal32, sizeof(nVal32));
+        nOffset += sizeof(nVal32);
+    };
+    const auto AppendString = [pszMetadata, &nOffset,
+                               &AppendInt32](const std::string &s)
+    {
+        AppendInt32(s.size());
+        memcpy(pszMetadata + nOffset, s.data(), s.size());
+        nOffset += s.size();
+    };
+    AppendInt32(aoKeyValues.size());
+    for (const auto &oKV : aoKeyValues)
+    {
+        AppendString(oKV.first);
+        AppendString(oKV.second);
+    }
+    CPLAssert(nOffset == nLen);
+    return pszMetadata;
+}
+
+/************************************************************************/
+/*                        RasterArrowReleaseSchema()                      */
+/************************************************************************/
+
+void RasterArrowReleaseSchema(struct ArrowSchema *schema)
+{
+    CPLAssert(schema->release != nullptr);
+    CPLFree(const_cast<char *>(schema->format));
+    CPLFree(const_cast<char *>(schema->name));
+    CPLFree(const_cast<char *>(schema->metadata));
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        if (schema->children[i]->release)
+            schema->children[i]->release(schema->children[i]);
+        CPLFree(schema->children[i]);
+    }
+    CPLFree(schema->children);
+    schema->release = nullptr;
+}
+
+/************************************************************************/
+/*                        RasterArrowCreateSchema()                       */
+/************************************************************************/
+
+struct ArrowSchema *RasterArrowCreateSchema(const char *pszFormat,
+                                            const char *pszName,
+                                            char *pszMetadata = nullptr,
+                                            int nChildren = 0)
+{
+    auto psSchema = static_cast<struct ArrowSchema *>(
+        CPLCalloc(1, sizeof(struct ArrowSchema)));
+    psSchema->format = CPLStrdup(pszFormat);
+    psSchema->name = CPLStrdup(pszName);
+    psSchema->metadata = pszMetadata;
+    psSchema->n_children = nChildren;
+    if (nChildren)
+    {
+        psSchema->children = static_cast<struct ArrowSchema **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowSchema *)));
+    }
+    psSchema->release = RasterArrowReleaseSchema;
+    return psSchema;
+}
+
+/************************************************************************/
+/*                        RasterArrowReleaseArray()                       */
+/************************************************************************/
+
+void RasterArrowReleaseArray(struct ArrowArray *array)
+{
+    CPLAssert(array->release != nullptr);
+    for (int64_t i = 0; i < array->n_buffers; ++i)
+        VSIFreeAligned(const_cast<void *>(array->buffers[i]));
+    CPLFree(array->buffers);
+    for (int64_t i = 0; i < array->n_children; ++i)
+    {
+        if (array->children[i] && array->children[i]->release)
+            array->children[i]->release(array->children[i]);
+        CPLFree(array->children[i]);
+    }
+    CPLFree(array->children);
+    array->release = nullptr;
+}
+
+/************************************************************************/
+/*                         RasterArrowCreateArray()                       */
+/************************************************************************/
+
+// Creates an array without validity bitmap, with a values buffer of
+// nValueBytes bytes if nValueBytes != 0
+struct ArrowArray *RasterArrowCreateArray(int64_t nLength,
+                                          size_t nValueBytes, int nChildren)
+{
+    auto psArray = static_cast<struct ArrowArray *>(
+        CPLCalloc(1, sizeof(struct ArrowArray)));
+    psArray->release = RasterArrowReleaseArray;
+    psArray->length = nLength;
+    psArray->n_buffers = nValueBytes ? 2 : 1;
+    psArray->buffers = static_cast<const void **>(
+        CPLCalloc(static_cast<size_t>(psArray->n_buffers), sizeof(void *)));
+    if (nValueBytes)
+    {
+        psArray->buffers[1] = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nValueBytes);
+        if (psArray->buffers[1] == nullptr)
+        {
+            RasterArrowReleaseArray(psArray);
+            CPLFree(psArray);
+            return nullptr;
+        }
+    }
+    psArray->n_children = nChildren;
+    if (nChildren)
+    {
+        psArray->children = static_cast<struct ArrowArray **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowArray *)));
+    }
+    return psArray;
+}
+
+/************************************************************************/
+/*                          RasterArrowGetSchema()                        */
+/************************************************************************/
+
+int RasterArrowGetSchema(struct ArrowArrayStream *stream,
+                         struct ArrowSchema *out_schema)
+{
+    const auto psPriv =
+        static_cast<GDALRasterArrowStreamPrivate *>(stream->private_data);
+
+    const int nChildren = psPriv->m_bHasGT ? 6 : 5;
+    auto psSchema = RasterArrowCreateSchema(
+        "+s", "",
+        RasterArrowEncodeMetadata(
+            {{"GDAL:raster", psPriv->m_osSchemaMetadata}}),
+        nChildren);
+    int iChild = 0;
+    for (const char *pszName : {"x_off", "y_off", "x_size", "y_size"})
+        psSchema->children[iChild++] = RasterArrowCreateSchema("i", pszName);
+
+    if (psPriv->m_bHasGT)
+    {
+        auto psGT = RasterArrowCreateSchema("+w:6", "geotransform", nullptr, 1);
+        psGT->children[0] = RasterArrowCreateSchema("g", "item");
+        psSchema->children[iChild++] = psGT;
+    }
+
+    const int nBands = static_cast<int>(psPriv->m_anBands.size());
+    CPLJSONObject oTensorMD;
+    CPLJSONArray oShape;
+    oShape.Add(nBands);
+    oShape.Add(psPriv->m_nTileYSize);
+    oShape.Add(psPriv->m_nTileXSize);
+    oTensorMD.Add("shape", oShape);
+    CPLJSONArray oDimNames;
+    oDimNames.Add("band");
+    oDimNames.Add("y");
+    oDimNames.Add("x");
+    oTensorMD.Add("dim_names", oDimNames);
+    const std::string osFormat =
+        CPLSPrintf("+w:%d", nBands * psPriv->m_nTileXSize *
+                                psPriv->m_nTileYSize);
+    auto psData = RasterArrowCreateSchema(
+        osFormat.c_str(), "data",
+        RasterArrowEncodeMetadata(
+            {{ARROW_EXTENSION_NAME_KEY, EXTENSION_NAME_FIXED_SHAPE_TENSOR},
+             {ARROW_EXTENSION_METADATA_KEY,
+              oTensorMD.Format(CPLJSONObject::PrettyFormat::Plain)}}),
+        1);
+    psData->children[0] =
+        RasterArrowCreateSchema(RasterArrowGetFormat(psPriv->m_eDT), "item");
+    psSchema->children[iChild++] = psData;
+    CPLAssert(iChild == nChildren);
+
+    memcpy(out_schema, psSchema, sizeof(*psSchema));
+    CPLFree(psSchema);
+    return 0;
+}
+
+/************************************************************************/
+/*                           RasterArrowGetNext()                         */
+/************************************************************************/
+
+int RasterArrowGetNext(struct ArrowArrayStream *stream,
+                       struct ArrowArray *out_array)
+{
+    auto psPriv =
+        static_cast<GDALRasterArrowStreamPrivate *>(stream->private_data);
+    memset(out_array, 0, sizeof(*out_array));
+    if (psPriv->m_nCurTile >= psPriv->m_nTileCount)
+        return 0;
+
+    const int nTiles = static_cast<int>(
+        std::min<int64_t>(psPriv->m_nMaxTilesPerBatch,
+                          psPriv->m_nTileCount - psPriv->m_nCurTile));
+    const int nBands = static_cast<int>(psPriv->m_anBands.size());
+    const int nDTSize = GDALGetDataTypeSizeBytes(psPriv->m_eDT);
+    const size_t nTilePixels =
+        static_cast<size_t>(psPriv->m_nTileXSize) * psPriv->m_nTileYSize;
+    const size_t nTileBytes = nTilePixels * nBands * nDTSize;
+
+    const int nChildren = psPriv->m_bHasGT ? 6 : 5;
+    auto psArray = RasterArrowCreateArray(nTiles, 0, nChildren);
+    int iChild = 0;
+    int32_t *apanInts[4] = {nullptr, nullptr, nullptr, nullptr};
+    for (int32_t *&panInts : apanInts)
+    {
+        auto psChild =
+            RasterArrowCreateArray(nTiles, nTiles * sizeof(int32_t), 0);
+        psArray->children[iChild++] = psChild;
+        if (!psChild)
+        {
+            RasterArrowReleaseArray(psArray);
+            CPLFree(psArray);
+            return ENOMEM;
+        }
+        panInts =
+            static_cast<int32_t *>(const_cast<void *>(psChild->buffers[1]));
+    }
+
+    double *padfGT = nullptr;
+    if (psPriv->m_bHasGT)
+    {
+        auto psGT = RasterArrowCreateArray(nTiles, 0, 1);
+        psArray->children[iChild++] = psGT;
+        psGT->children[0] =
+            RasterArrowCreateArray(static_cast<int64_t>(nTiles) * 6,
+                        static_cast<size_t>(nTiles) * 6 * sizeof(double), 0);
+        if (!psGT->children[0])
+        {
+            RasterArrowReleaseArray(psArray);
+            CPLFree(psArray);
+            return ENOMEM;
+        }
+        padfGT = static_cast<double *>(
+            const_cast<void *>(psGT->children[0]->buffers[1]));
+    }
+
+    auto psData = RasterArrowCreateArray(nTiles, 0, 1);
+    psArray->children[iChild++] = psData;
+    CPLAssert(iChild == nChildren);
+    psData->children[0] = RasterArrowCreateArray(
+        static_cast<int64_t>(nTiles * nTilePixels * nBands),
+        nTiles * nTileBytes, 0);
+    if (!psData->children[0])
+    {
+        RasterArrowReleaseArray(psArray);
+        CPLFree(psArray);
+        return ENOMEM;
+    }
+    GByte *pabyData = static_cast<GByte *>(
+        const_cast<void *>(psData->children[0]->buffers[1]));
+
+    const int nXSize = psPriv->m_poDS->GetRasterXSize();
+    const int nYSize = psPriv->m_poDS->GetRasterYSize();
+    for (int iTile = 0; iTile < nTiles; ++iTile, ++psPriv->m_nCurTile)
+    {
+        const int nXOff =
+            static_cast<int>(psPriv->m_nCurTile % psPriv->m_nTilesPerRow) *
+            psPriv->m_nTileXSize;
+        const int nYOff =
+            static_cast<int>(psPriv->m_nCurTile / psPriv->m_nTilesPerRow) *
+            psPriv->m_nTileYSize;
+        const int nReqXSize = std::min(psPriv->m_nTileXSize, nXSize - nXOff);
+        const int nReqYSize = std::min(psPriv->m_nTileYSize, nYSize - nYOff);
+        apanInts[0][iTile] = nXOff;
+        apanInts[1][iTile] = nYOff;
+        apanInts[2][iTile] = nReqXSize;
+        apanInts[3][iTile] = nReqYSize;
+        if (padfGT)
+        {
+            const double *adfGT = psPriv->m_adfGT;
+            double *padfTileGT = padfGT + 6 * iTile;
+            padfTileGT[0] = adfGT[0] + nXOff * adfGT[1] + nYOff * adfGT[2];
+            padfTileGT[1] = adfGT[1];
+            padfTileGT[2] = adfGT[2];
+            padfTileGT[3] = adfGT[3] + nXOff * adfGT[4] + nYOff * adfGT[5];
+            padfTileGT[4] = adfGT[4];
+            padfTileGT[5] = adfGT[5];
+        }
+
+        GByte *pabyTile = pabyData + iTile * nTileBytes;
+        if (nReqXSize < psPriv->m_nTileXSize ||
+            nReqYSize < psPriv->m_nTileYSize)
+        {
+            // Pad partial tiles with the nodata value (or zero)
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                GDALCopyWords64(&psPriv->m_adfFillValue[iBand], GDT_Float64, 0,
+                                pabyTile + iBand * nTilePixels * nDTSize,
+                                psPriv->m_eDT, nDTSize, nTilePixels);
+            }
+        }
+
+        // Read directly into the Arrow buffer, with a band-sequential
+        // (band, y, x) layout.
+        if (psPriv->m_poDS->RasterIO(
+                GF_Read, nXOff, nYOff, nReqXSize, nReqYSize, pabyTile,
+                nReqXSize, nReqYSize, psPriv->m_eDT, nBands,
+                psPriv->m_anBands.data(), nDTSize,
+                static_cast<GSpacing>(nDTSize) * psPriv->m_nTileXSize,
+                static_cast<GSpacing>(nTilePixels) * nDTSize,
+                nullptr) != CE_None)
+        {
+            RasterArrowReleaseArray(psArray);
+            CPLFree(psArray);
+            return EIO;
+        }
+    }
+
+    memcpy(out_array, psArray, sizeof(*psArray));
+    CPLFree(psArray);
+    return 0;
+}
+
+/************************************************************************/
+/*                        RasterArrowGetLastError()                       */
+/************************************************************************/
+
+const char *RasterArrowGetLastError(struct ArrowArrayStream *)
+{
+    const char *pszLastErrorMsg = CPLGetLastErrorMsg();
+    return pszLastErrorMsg[0] != '\0' ? pszLastErrorMsg : nullptr;
+}
+
+/************************************************************************/
+/*                        RasterArrowReleaseStream()                      */
+/************************************************************************/
+
+void RasterArrowReleaseStream(struct ArrowArrayStream *stream)
+{
+    delete static_cast<GDALRasterArrowStreamPrivate *>(stream->private_data);
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GDALGetRasterArrowStream()                       */
+/************************************************************************/
+
+static bool GDALGetRasterArrowStream(GDALDataset *poDS,
+                                     std::unique_ptr<GDALDataset> poOwnedDS,
+                                     struct ArrowArrayStream *out_stream,
+                                     CSLConstList papszOptions)
+{
+    memset(out_stream, 0, sizeof(*out_stream));
+    if (poDS->GetRasterCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Dataset has no raster band");
+        return false;
+    }
+
+    auto psPriv = std::make_unique<GDALRasterArrowStreamPrivate>();
+    psPriv->m_poDS = poDS;
+
+    const char *pszBands = CSLFetchNameValue(papszOptions, "BANDS");
+    if (pszBands)
+    {
+        const CPLStringList aosBands(CSLTokenizeString2(pszBands, ",", 0));
+        for (const char *pszBand : aosBands)
+        {
+            const int nBand = atoi(pszBand);
+            if (nBand <= 0 || nBand > poDS->GetRasterCount())
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg, "Invalid band: %s",
+                         pszBand);
+                return false;
+            }
+            psPriv->m_anBands.push_back(nBand);
+        }
+    }
+    if (psPriv->m_anBands.empty())
+    {
+        for (int i = 1; i <= poDS->GetRasterCount(); ++i)
+            psPriv->m_anBands.push_back(i);
+    }
+    const int nBands = static_cast<int>(psPriv->m_anBands.size());
+
+    auto poFirstBand = poDS->GetRasterBand(psPriv->m_anBands[0]);
+    psPriv->m_eDT = poFirstBand->GetRasterDataType();
+    for (int nBand : psPriv->m_anBands)
+    {
+        psPriv->m_eDT = GDALDataTypeUnion(
+            psPriv->m_eDT, poDS->GetRasterBand(nBand)->GetRasterDataType());
+    }
+    if (RasterArrowGetFormat(psPriv->m_eDT) == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Data type %s cannot be exported as Arrow",
+                 GDALGetDataTypeName(psPriv->m_eDT));
+        return false;
+    }
+    const int nDTSize = GDALGetDataTypeSizeBytes(psPriv->m_eDT);
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poFirstBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    psPriv->m_nTileXSize =
+        atoi(CSLFetchNameValueDef(papszOptions, "TILE_XSIZE",
+                                  CPLSPrintf("%d", nBlockXSize)));
+    psPriv->m_nTileYSize =
+        atoi(CSLFetchNameValueDef(papszOptions, "TILE_YSIZE",
+                                  CPLSPrintf("%d", nBlockYSize)));
+    if (psPriv->m_nTileXSize <= 0 || psPriv->m_nTileYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Invalid tile size");
+        return false;
+    }
+    psPriv->m_nTileXSize =
+        std::min(psPriv->m_nTileXSize, poDS->GetRasterXSize());
+    psPriv->m_nTileYSize =
+        std::min(psPriv->m_nTileYSize, poDS->GetRasterYSize());
+    // The list size of a FixedSizeList is a int32
+    const uint64_t nTileValues = static_cast<uint64_t>(nBands) *
+                                 psPriv->m_nTileXSize * psPriv->m_nTileYSize;
+    if (nTileValues >
+            static_cast<uint64_t>(std::numeric_limits<int>::max()) ||
+        nTileValues * nDTSize >
+            static_cast<uint64_t>(std::numeric_limits<int32_t>::max()))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too large tile size");
+        return false;
+    }
+    const size_t nTileBytes = static_cast<size_t>(nTileValues) * nDTSize;
+
+    psPriv->m_nTilesPerRow = DIV_ROUND_UP(poDS->GetRasterXSize(),
+                                          psPriv->m_nTileXSize);
+    psPriv->m_nTileCount =
+        static_cast<int64_t>(psPriv->m_nTilesPerRow) *
+        DIV_ROUND_UP(poDS->GetRasterYSize(), psPriv->m_nTileYSize);
+
+    const char *pszMaxTiles =
+        CSLFetchNameValue(papszOptions, "MAX_TILES_PER_BATCH");
+    const int64_t nMaxTiles =
+        pszMaxTiles
+            ? std::max(1, atoi(pszMaxTiles))
+            : std::max<int64_t>(1, DEFAULT_MAX_BATCH_BYTES / nTileBytes);
+    psPriv->m_nMaxTilesPerBatch = static_cast<int>(std::min<int64_t>(
+        {nMaxTiles, psPriv->m_nTileCount,
+         static_cast<int64_t>(std::numeric_limits<size_t>::max() /
+                              nTileBytes)}));
+
+    psPriv->m_bHasGT = poDS->GetGeoTransform(psPriv->m_adfGT) == CE_None;
+
+    CPLJSONObject oMD;
+    oMD.Add("width", poDS->GetRasterXSize());
+    oMD.Add("height", poDS->GetRasterYSize());
+    oMD.Add("data_type", GDALGetDataTypeName(psPriv->m_eDT));
+    CPLJSONArray oBands;
+    CPLJSONArray oNoData;
+    for (int nBand : psPriv->m_anBands)
+    {
+        oBands.Add(nBand);
+        int bHasNoData = FALSE;
+        const double dfNoData =
+            poDS->GetRasterBand(nBand)->GetNoDataValue(&bHasNoData);
+        if (bHasNoData)
+            oNoData.Add(dfNoData);
+        else
+            oNoData.AddNull();
+        psPriv->m_adfFillValue.push_back(bHasNoData ? dfNoData : 0.0);
+    }
+    oMD.Add("bands", oBands);
+    oMD.Add("nodata", oNoData);
+    if (psPriv->m_bHasGT)
+    {
+        CPLJSONArray oGT;
+        for (double dfVal : psPriv->m_adfGT)
+            oGT.Add(dfVal);
+        oMD.Add("geotransform", oGT);
+    }
+    if (const auto poSRS = poDS->GetSpatialRef())
+    {
+        char *pszPROJJSON = nullptr;
+        if (poSRS->exportToPROJJSON(&pszPROJJSON, nullptr) == OGRERR_NONE)
+        {
+            CPLJSONDocument oCRSDoc;
+            if (oCRSDoc.LoadMemory(pszPROJJSON))
+                oMD.Add("crs", oCRSDoc.GetRoot());
+        }
+        CPLFree(pszPROJJSON);
+    }
+    psPriv->m_osSchemaMetadata =
+        oMD.Format(CPLJSONObject::PrettyFormat::Plain);
+
+    psPriv->m_poOwnedDS = std::move(poOwnedDS);
+    out_stream->get_schema = RasterArrowGetSchema;
+    out_stream->get_next = RasterArrowGetNext;
+    out_stream->get_last_error = RasterArrowGetLastError;
+    out_stream->release = RasterArrowReleaseStream;
+    out_stream->private_data = psPriv.release();
+    return true;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                        GetRasterArrowStream()                        */
+/************************************************************************/
+
+/** Get a Arrow C stream of the raster bands of the dataset, split in tiles.
+ *
+ * Each record of the stream corresponds to a tile, and has the following
+ * fields:
+ * <ul>
+ * <li>x_off, y_off: int32, offset of the tile in pixels and lines.</li>
+ * <li>x_size, y_size: int32, number of valid pixels and lines of the tile.
+ *     This is less than the tile size for tiles at the right and bottom
+ *     edges of the raster, whose extra values are set to the nodata value of
+ *     the band (or zero).</li>
+ * <li>geotransform: FixedSizeList&lt;float64&gt;[6], geotransform of the
+ *     tile. Only present if the dataset has a geotransform.</li>
+ * <li>data: FixedSizeList of (band count * tile height * tile width) values,
+ *     with the "arrow.fixed_shape_tensor" extension, and a (band, y, x)
+ *     layout. The data type is the union of the data types of the exported
+ *     bands. Complex data types are not supported.</li>
+ * </ul>
+ *
+ * The "GDAL:raster" key of the metadata of the schema is a JSON object with
+ * the width, height, data_type, bands, nodata, geotransform and crs
+ * (PROJJSON) of the dataset.
+ *
+ * Tiles are read with GDALDataset::RasterIO() directly into the buffers of
+ * the returned Arrow arrays.
+ *
+ * On successful return, and when the stream interfaces is no longer needed, it
+ * must be freed with out_stream->release(out_stream). The dataset must be kept
+ * opened while the stream is used.
+ *
+ * Supported options are:
+ * <ul>
+ * <li>TILE_XSIZE=integer: tile width. Defaults to the block width of the
+ *     first exported band.</li>
+ * <li>TILE_YSIZE=integer: tile height. Defaults to the block height of the
+ *     first exported band.</li>
+ * <li>BANDS=list: comma separated list of band numbers (starting at 1) to
+ *     export. Defaults to all bands.</li>
+ * <li>MAX_TILES_PER_BATCH=integer: maximum number of tiles in a batch.
+ *     Defaults to the number of tiles that fit in 64 MB.</li>
+ * </ul>
+ *
+ * This method is the same as the C function GDALDatasetGetRasterArrowStream().
+ *
+ * @param out_stream Output stream. Must *not* be NULL. The pointed memory does
+ *                   not need to be initialized.
+ * @param papszOptions NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.10
+ */
+bool GDALDataset::GetRasterArrowStream(struct ArrowArrayStream *out_stream,
+                                       CSLConstList papszOptions)
+{
+    return GDALGetRasterArrowStream(this, nullptr, out_stream, papszOptions);
+}
+
+/************************************************************************/
+/*                   GDALDatasetGetRasterArrowStream()                  */
+/************************************************************************/
+
+/** Get a Arrow C stream of the raster bands of the dataset, split in tiles.
+ *
+ * This function is the same as the C++ method
+ * GDALDataset::GetRasterArrowStream().
+ *
+ * @param hDS Dataset handle.
+ * @param out_stream Output stream. Must *not* be NULL. The pointed memory does
+ *                   not need to be initialized.
+ * @param papszOptions NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.10
+ */
+bool GDALDatasetGetRasterArrowStream(GDALDatasetH hDS,
+                                     struct ArrowArrayStream *out_stream,
+                                     CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hDS, __func__, false);
+    VALIDATE_POINTER1(out_stream, __func__, false);
+
+    return GDALDataset::FromHandle(hDS)->GetRasterArrowStream(out_stream,
+                                                              papszOptions);
+}
+
+/************************************************************************/
+/*                        GetRasterArrowStream()                        */
+/************************************************************************/
+
+/** Get a Arrow C stream of the array, split in 2D tiles.
+ *
+ * The last dimension of the array is used as the X dimension, and the one
+ * before as the Y dimension. For arrays of dimension 3 or more, indices
+ * along the other dimensions are exported as bands. This uses
+ * AsClassicDataset() and GDALDataset::GetRasterArrowStream(), whose
+ * documentation gives the layout of the stream and the supported options.
+ *
+ * On successful return, and when the stream interfaces is no longer needed, it
+ * must be freed with out_stream->release(out_stream).
+ *
+ * This method is the same as the C function GDALMDArrayGetRasterArrowStream().
+ *
+ * @param out_stream Output stream. Must *not* be NULL. The pointed memory does
+ *                   not need to be initialized.
+ * @param papszOptions NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.10
+ */
+bool GDALMDArray::GetRasterArrowStream(struct ArrowArrayStream *out_stream,
+                                       CSLConstList papszOptions) const
+{
+    memset(out_stream, 0, sizeof(*out_stream));
+    const size_t nDims = GetDimensionCount();
+    if (nDims < 2)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GetRasterArrowStream() only supported on arrays of "
+                 "dimension 2 or more");
+        return false;
+    }
+    std::unique_ptr<GDALDataset> poDS(
+        AsClassicDataset(nDims - 1, nDims - 2, nullptr, nullptr));
+    if (!poDS)
+        return false;
+    auto poDSRaw = poDS.get();
+    return GDALGetRasterArrowStream(poDSRaw, std::move(poDS), out_stream,
+                                    papszOptions);
+}
+
+/************************************************************************/
+/*                   GDALMDArrayGetRasterArrowStream()                  */
+/************************************************************************/
+
+/** Get a Arrow C stream of the array, split in 2D tiles.
+ *
+ * This function is the same as the C++ method
+ * GDALMDArray::GetRasterArrowStream().
+ *
+ * @param hArray Array handle.
+ * @param out_stream Output stream. Must *not* be NULL. The pointed memory does
+ *                   not need to be initialized.
+ * @param papszOptions NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.10
+ */
+bool GDALMDArrayGetRasterArrowStream(GDALMDArrayH hArray,
+                                     struct ArrowArrayStream *out_stream,
+                                     CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hArray, __func__, false);
+    VALIDATE_POINTER1(out_stream, __func__, false);
+
+    return hArray->m_poImpl->GetRasterArrowStream(out_stream, papszOptions);
+}
@@ -39,20 +39,28 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_rat.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALRasterBand()                           */
@@ -107,6 +115,49 @@ GDALRasterBand::~GDALRasterBand()
     nBand = -nBand;
 }
 
+/************************************************************************/
+/*                          AddTraceBandArgs()                          */
+/************************************************************************/
+
+static void AddTraceBandArgs(CPLTraceSpan &oSpan, GDALRasterBand *poBand)
+{
+    GDALDataset *poDS = poBand->GetDataset();
+    GDALDriver *poDriver = poDS ? poDS->GetDriver() : nullptr;
+    oSpan.AddArg("driver", poDriver ? poDriver->GetDescription() : "");
+    oSpan.AddArg("dataset", poDS ? poDS->GetDescription() : "");
+    oSpan.AddArg("band", poBand->GetBand());
+}
+
+/************************************************************************/
+/*                         AddTraceBlockArgs()                          */
+/************************************************************************/
+
+static void AddTraceBlockArgs(CPLTraceSpan &oSpan, GDALRasterBand *poBand,
+                              int nXBlockOff, int nYBlockOff)
+{
+    AddTraceBandArgs(oSpan, poBand);
+    oSpan.AddArg("block_x", nXBlockOff);
+    oSpan.AddArg("block_y", nYBlockOff);
+}
+
+/************************************************************************/
+/*                          MarkDirtyRegion()                           */
+/************************************************************************/
+
+// Record a written region in the dataset, for GDALDataset::GetDirtyRegions().
+// Bands whose size differs from the one of their dataset, such as overview
+// bands, are ignored.
+static void MarkDirtyRegion(GDALRasterBand *poBand, int nXOff, int nYOff,
+                            int nXSize, int nYSize)
+{
+    GDALDataset *poDS = poBand->GetDataset();
+    if (poDS && poBand->GetXSize() == poDS->GetRasterXSize() &&
+        poBand->GetYSize() == poDS->GetRasterYSize())
+    {
+        poDS->MarkDirtyRegion(nXOff, nYOff, nXSize, nYSize);
+    }
+}
+
 /************************************************************************/
 /*                              RasterIO()                              */
 /************************************************************************/
@@ -409,10 +460,26 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    if (eRWFlag == GF_Write)
+        MarkDirtyRegion(this, nXOff, nYOff, nXSize, nYSize);
+
     /* -------------------------------------------------------------------- */
     /*      Call the format specific function.                              */
     /* -------------------------------------------------------------------- */
 
+    CPLTraceSpan oSpan("raster", eRWFlag == GF_Read ? "RasterIO read"
+                                                    : "RasterIO write");
+    if (oSpan.IsActive())
+    {
+        AddTraceBandArgs(oSpan, this);
+        oSpan.AddArg("x", nXOff);
+        oSpan.AddArg("y", nYOff);
+        oSpan.AddArg("width", nXSize);
+        oSpan.AddArg("height", nYSize);
+        oSpan.AddArg("buf_width", nBufXSize);
+        oSpan.AddArg("buf_height", nBufYSize);
+    }
+
     const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(eRWFlag));
 
     CPLErr eErr;
@@ -488,6 +555,202 @@ CPLErr CPL_STDCALL GDALRasterIOEx(GDALRasterBandH hBand, GDALRWFlag eRWFlag,
                              nLineSpace, psExtraArg));
 }
 
+/************************************************************************/
+/*                           RasterIOAsync()                            */
+/************************************************************************/
+
+/**
+ * \brief Queue an asynchronous read or write of a region of image data for
+ * this band.
+ *
+ * The arguments have the same meaning as in GDALRasterBand::RasterIO().
+ * Requests are queued on the dataset of the band, and have the same
+ * constraints as GDALDataset::RasterIOAsync(). For a band that does not
+ * belong to a dataset, the request is run synchronously.
+ *
+ * @return a future holding CE_None on success, or CE_Failure.
+ * @since GDAL 3.10
+ */
+
+std::future<CPLErr> GDALRasterBand::RasterIOAsync(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    const GDALRasterIOExtraArg *psExtraArg)
+{
+    GDALRasterIOExtraArg sExtraArg;
+    if (psExtraArg)
+    {
+        sExtraArg = *psExtraArg;
+    }
+    else
+    {
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    }
+
+    std::function<CPLErr()> fnRequest =
+        [this, eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+         nBufYSize, eBufType, nPixelSpace, nLineSpace, sExtraArg]() mutable
+    {
+        return RasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
+                        nBufXSize, nBufYSize, eBufType, nPixelSpace,
+                        nLineSpace, &sExtraArg);
+    };
+
+    if (poDS)
+        return poDS->SubmitAsyncRasterIO(std::move(fnRequest));
+
+    std::promise<CPLErr> oPromise;
+    oPromise.set_value(fnRequest());
+    return oPromise.get_future();
+}
+
+/************************************************************************/
+/*                          ReadMultiWindow()                           */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of image data of this band in one call.
+ *
+ * This is equivalent to calling RasterIO(GF_Read, ...) on each window, but
+ * lets drivers process the windows as a batch. For example, the GTiff driver
+ * fetches the strips or tiles needed by all windows of a file on a network
+ * file system with a single multi-range request. Windows may overlap: blocks
+ * shared by several windows are only decoded once, as they go through the
+ * block cache.
+ *
+ * This method is the same as the C function GDALRasterReadMultiWindow().
+ *
+ * @param nWindowCount Number of windows.
+ * @param pasWindows Array of nWindowCount windows, with the buffers to fill.
+ * @param eBufType Data type of the buffers of the windows.
+ * @param psExtraArg Pointer to a GDALRasterIOExtraArg structure with
+ * additional arguments applied to each window, or NULL. Its
+ * bFloatingPointWindowValidity member must be FALSE.
+ *
+ * @return CE_None if all windows have been read, CE_Failure otherwise.
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBand::ReadMultiWindow(int nWindowCount,
+                                       const GDALRasterIOWindow *pasWindows,
+                                       GDALDataType eBufType,
+                                       GDALRasterIOExtraArg *psExtraArg)
+{
+    GDALRasterIOExtraArg sExtraArg;
+    if (psExtraArg == nullptr)
+    {
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        psExtraArg = &sExtraArg;
+    }
+    else if (psExtraArg->nVersion != RASTERIO_EXTRA_ARG_CURRENT_VERSION)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined,
+                    "Unhandled version of GDALRasterIOExtraArg");
+        return CE_Failure;
+    }
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "bFloatingPointWindowValidity is not supported by "
+                    "ReadMultiWindow()");
+        return CE_Failure;
+    }
+
+    if (nWindowCount < 0 || (nWindowCount > 0 && pasWindows == nullptr))
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Invalid window array in ReadMultiWindow()");
+        return CE_Failure;
+    }
+
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        if (sWindow.pData == nullptr)
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "The buffer into which window %d should be read is "
+                        "null",
+                        i);
+            return CE_Failure;
+        }
+        if (sWindow.nXOff < 0 || sWindow.nXOff > INT_MAX - sWindow.nXSize ||
+            sWindow.nXOff + sWindow.nXSize > nRasterXSize ||
+            sWindow.nYOff < 0 || sWindow.nYOff > INT_MAX - sWindow.nYSize ||
+            sWindow.nYOff + sWindow.nYSize > nRasterYSize)
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "Access window %d out of range in ReadMultiWindow(). "
+                        "Requested (%d,%d) of size %dx%d on raster of %dx%d.",
+                        i, sWindow.nXOff, sWindow.nYOff, sWindow.nXSize,
+                        sWindow.nYSize, nRasterXSize, nRasterYSize);
+            return CE_Failure;
+        }
+    }
+
+    if (nWindowCount == 0)
+        return CE_None;
+
+    return IReadMultiWindow(nWindowCount, pasWindows, eBufType, psExtraArg);
+}
+
+/************************************************************************/
+/*                          IReadMultiWindow()                          */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of image data of this band.
+ *
+ * This is the method that drivers may override to implement
+ * ReadMultiWindow() efficiently. Windows have already been validated.
+ * The default implementation calls RasterIO() on each window.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBand::IReadMultiWindow(int nWindowCount,
+                                        const GDALRasterIOWindow *pasWindows,
+                                        GDALDataType eBufType,
+                                        GDALRasterIOExtraArg *psExtraArg)
+{
+    for (int i = 0; i < nWindowCount; ++i)
+    {
+        const GDALRasterIOWindow &sWindow = pasWindows[i];
+        if (RasterIO(GF_Read, sWindow.nXOff, sWindow.nYOff, sWindow.nXSize,
+                     sWindow.nYSize, sWindow.pData, sWindow.nBufXSize,
+                     sWindow.nBufYSize, eBufType, sWindow.nPixelSpace,
+                     sWindow.nLineSpace, psExtraArg) != CE_None)
+        {
+            return CE_Failure;
+        }
+    }
+    return CE_None;
+}
+
+/************************************************************************/
+/*                     GDALRasterReadMultiWindow()                      */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of image data of a band in one call.
+ *
+ * @see GDALRasterBand::ReadMultiWindow()
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterReadMultiWindow(GDALRasterBandH hBand, int nWindowCount,
+                                 const GDALRasterIOWindow *pasWindows,
+                                 GDALDataType eBufType,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterReadMultiWindow", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return poBand->ReadMultiWindow(nWindowCount, pasWindows, eBufType,
+                                   psExtraArg);
+}
+
 /************************************************************************/
 /*                             ReadBlock()                              */
 /************************************************************************/
@@ -598,6 +861,10 @@ CPLErr GDALRasterBand::ReadBlock(int nXBlockOff, int nYBlockOff, void *pImage)
     /*      Invoke underlying implementation method.                        */
     /* -------------------------------------------------------------------- */
 
+    CPLTraceSpan oSpan("raster", "IReadBlock");
+    if (oSpan.IsActive())
+        AddTraceBlockArgs(oSpan, this, nXBlockOff, nYBlockOff);
+
     int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
     CPLErr eErr = IReadBlock(nXBlockOff, nYBlockOff, pImage);
     if (bCallLeaveReadWrite)
@@ -751,6 +1018,14 @@ CPLErr GDALRasterBand::WriteBlock(int nXBlockOff, int nYBlockOff, void *pImage)
         return eErr;
     }
 
+    {
+        const int nXOff = nXBlockOff * nBlockXSize;
+        const int nYOff = nYBlockOff * nBlockYSize;
+        MarkDirtyRegion(this, nXOff, nYOff,
+                        std::min(nBlockXSize, nRasterXSize - nXOff),
+                        std::min(nBlockYSize, nRasterYSize - nYOff));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Invoke underlying implementation method.                        */
     /* -------------------------------------------------------------------- */
@@ -1222,6 +1497,58 @@ CPLErr CPL_STDCALL GDALDropRasterCache(GDALRasterBandH hBand)
     return GDALRasterBand::FromHandle(hBand)->DropCache();
 }
 
+/************************************************************************/
+/*                      GetBlockCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Fetch statistics about the use of the block cache by this band.
+ *
+ * The counters are accumulated since the band block cache has been
+ * initialized, that is generally since the first block of the band has been
+ * accessed. They are all zero if the block cache of the band has not been
+ * used.
+ *
+ * This method is the same as the C function
+ * GDALGetRasterBlockCacheStatistics().
+ *
+ * @param psStats Pointer to the structure to fill. Must not be NULL.
+ * @since 3.10
+ */
+
+void GDALRasterBand::GetBlockCacheStatistics(
+    GDALBlockCacheStatistics *psStats) const
+{
+    if (poBandBlockCache)
+    {
+        poBandBlockCache->GetStatistics(psStats);
+    }
+    else
+    {
+        memset(psStats, 0, sizeof(*psStats));
+    }
+}
+
+/************************************************************************/
+/*                 GDALGetRasterBlockCacheStatistics()                  */
+/************************************************************************/
+
+/**
+ * \brief Fetch statistics about the use of the block cache by a band.
+ *
+ * @see GDALRasterBand::GetBlockCacheStatistics()
+ * @since 3.10
+ */
+
+void GDALGetRasterBlockCacheStatistics(GDALRasterBandH hBand,
+                                       GDALBlockCacheStatistics *psStats)
+{
+    VALIDATE_POINTER0(hBand, "GDALGetRasterBlockCacheStatistics");
+    VALIDATE_POINTER0(psStats, "GDALGetRasterBlockCacheStatistics");
+
+    GDALRasterBand::FromHandle(hBand)->GetBlockCacheStatistics(psStats);
+}
+
 /************************************************************************/
 /*                        UnreferenceBlock()                            */
 /*                                                                      */
@@ -1419,6 +1746,8 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
     /*      Try and fetch from cache.                                       */
     /* -------------------------------------------------------------------- */
     GDALRasterBlock *poBlock = TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+    if (poBlock != nullptr)
+        poBandBlockCache->IncHits();
 
     /* -------------------------------------------------------------------- */
     /*      If we didn't find it in our memory cache, instantiate a         */
@@ -1458,6 +1787,7 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
         poBlock = poBandBlockCache->CreateBlock(nXBlockOff, nYBlockOff);
         if (poBlock == nullptr)
             return nullptr;
+        poBandBlockCache->IncMisses();
 
         poBlock->AddLock();
 
@@ -1497,7 +1827,17 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
         {
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
-            eErr = IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
+            m_bReadBlockIsUniform = false;
+            {
+                CPLTraceSpan oSpan("raster", "IReadBlock");
+                if (oSpan.IsActive())
+                    AddTraceBlockArgs(oSpan, this, nXBlockOff, nYBlockOff);
+                eErr =
+                    IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
+            }
+            if (eErr == CE_None && m_bReadBlockIsUniform)
+                poBlock->MarkUniform(m_dfReadBlockUniformValue);
+            m_bReadBlockIsUniform = false;
             if (bCallLeaveReadWrite)
                 LeaveReadWrite();
             if (eErr != CE_None)
@@ -1528,6 +1868,71 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
     return poBlock;
 }
 
+/************************************************************************/
+/*                      SetReadBlockUniformValue()                      */
+/************************************************************************/
+
+/**
+ * \brief Report that the block being read has all its pixels equal to the
+ * same value.
+ *
+ * May be called by IReadBlock() implementations that know it without
+ * inspecting the pixels, for example when a block is missing from the file
+ * and has been filled with the nodata value. When IReadBlock() is called by
+ * GetLockedBlockRef(), the information is attached to the GDALRasterBlock
+ * (see GDALRasterBlock::IsUniform()), which lets algorithms such as
+ * ComputeStatistics() skip per-pixel processing of such blocks.
+ *
+ * @param dfValue Value of all the pixels of the block.
+ * @since GDAL 3.10
+ */
+
+void GDALRasterBand::SetReadBlockUniformValue(double dfValue)
+{
+    m_bReadBlockIsUniform = true;
+    m_dfReadBlockUniformValue = dfValue;
+}
+
+/************************************************************************/
+/*                            BorrowBlock()                             */
+/************************************************************************/
+
+/**
+ * \brief Return a read-only view on the data of a block, without copy.
+ *
+ * The block is loaded in the block cache if needed (as with
+ * GetLockedBlockRef()), and stays pinned in it until the returned view is
+ * released or destroyed. The data is exposed in the native data type of the
+ * band, with a line stride of GetXSize() pixels of the view. This avoids the
+ * copy done by RasterIO() into a user buffer when the caller can work on
+ * whole blocks of the native data type.
+ *
+ * The view must be released before the cache of the band is flushed, or
+ * the band is destroyed.
+ *
+ * @param nXBlockOff the horizontal block offset, with zero indicating
+ * the left most block, 1 the next block and so forth.
+ * @param nYBlockOff the vertical block offset, with zero indicating
+ * the top most block, 1 the next block and so forth.
+ *
+ * @return a view, which is empty in case of error.
+ * @since GDAL 3.10
+ */
+
+GDALRasterBlockView GDALRasterBand::BorrowBlock(int nXBlockOff,
+                                                int nYBlockOff)
+{
+    GDALRasterBlock *poBlock = GetLockedBlockRef(nXBlockOff, nYBlockOff);
+    if (poBlock == nullptr)
+        return GDALRasterBlockView();
+
+    int nValidXSize = 0;
+    int nValidYSize = 0;
+    CPL_IGNORE_RET_VAL(GetActualBlockSize(nXBlockOff, nYBlockOff,
+                                          &nValidXSize, &nValidYSize));
+    return GDALRasterBlockView(poBlock, nValidXSize, nValidYSize);
+}
+
 /************************************************************************/
 /*                               Fill()                                 */
 /************************************************************************/
@@ -1595,6 +2000,8 @@ CPLErr GDALRasterBand::Fill(double dfRealValue, double dfImaginaryValue)
     GDALCopyWords64(complexSrc, GDT_CFloat64, 0, srcBlock, eDataType,
                     elementSize, blockSize);
 
+    MarkDirtyRegion(this, 0, 0, nRasterXSize, nRasterYSize);
+
     const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(GF_Write));
 
     // Write block to block cache
@@ -3380,73 +3787,369 @@ static inline void ComputeFloatNoDataValue(GDALDataType eDataType,
 }
 
 /************************************************************************/
-/*                            GetHistogram()                            */
+/*                          GDALBlockReducer                            */
 /************************************************************************/
 
-/**
- * \brief Compute raster histogram.
- *
- * Note that the bucket size is (dfMax-dfMin) / nBuckets.
- *
- * For example to compute a simple 256 entry histogram of eight bit data,
- * the following would be suitable.  The unusual bounds are to ensure that
- * bucket boundaries don't fall right on integer values causing possible errors
- * due to rounding after scaling.
-\code{.cpp}
-    GUIntBig anHistogram[256];
+namespace
+{
 
-    poBand->GetHistogram( -0.5, 255.5, 256, anHistogram, FALSE, FALSE,
-                          GDALDummyProgress, nullptr );
-\endcode
- *
- * Note that setting bApproxOK will generally result in a subsampling of the
- * file, and will utilize overviews if available.  It should generally
- * produce a representative histogram for the data that is suitable for use
- * in generating histogram based luts for instance.  Generally bApproxOK is
- * much faster than an exactly computed histogram.
- *
- * This method is the same as the C functions GDALGetRasterHistogram() and
- * GDALGetRasterHistogramEx().
- *
- * @param dfMin the lower bound of the histogram.
- * @param dfMax the upper bound of the histogram.
- * @param nBuckets the number of buckets in panHistogram.
- * @param panHistogram array into which the histogram totals are placed.
- * @param bIncludeOutOfRange if TRUE values below the histogram range will
- * mapped into panHistogram[0], and values above will be mapped into
- * panHistogram[nBuckets-1] otherwise out of range values are discarded.
- * @param bApproxOK TRUE if an approximate, or incomplete histogram OK.
- * @param pfnProgress function to report progress to completion.
- * @param pProgressData application data to pass to pfnProgress.
- *
- * @return CE_None on success, or CE_Failure if something goes wrong.
- */
+// Iterates over the (sampled) blocks of a band on behalf of
+// ComputeStatistics(), ComputeRasterMinMax() and GetHistogram().
+// When GDAL_NUM_THREADS is set, the blocks are still fetched from the calling
+// thread, since neither the block cache nor the drivers can be accessed
+// concurrently for the same band, but the per-block computations are
+// dispatched to the global thread pool. A block stays locked until the worker
+// thread that processes it is done with it.
+//
+// The callback is invoked with the index of the sampled block, and the index
+// of an accumulator slot (in [0, GetSlotCount() - 1]) that no other
+// concurrently running invocation uses. It returns false if the iteration can
+// stop early (not an error).
+//
+// When there is no mask band, blocks that the driver reported as uniform
+// (see GDALRasterBlock::IsUniform()) are passed to the optional uniform block
+// callback instead, from the calling thread. It returns false if it cannot
+// handle the value, in which case the regular callback is used.
+class GDALBlockReducer
+{
+  public:
+    typedef std::function<bool(size_t iSample, int iSlot, const void *pData,
+                               const GByte *pabyMaskData, int nXCheck,
+                               int nYCheck)>
+        BlockFunc;
 
-CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
-                                    GUIntBig *panHistogram,
-                                    int bIncludeOutOfRange, int bApproxOK,
-                                    GDALProgressFunc pfnProgress,
-                                    void *pProgressData)
+    typedef std::function<bool(size_t iSample, int iSlot, double dfValue,
+                               int nXCheck, int nYCheck)>
+        UniformBlockFunc;
 
-{
-    CPLAssert(nullptr != panHistogram);
+    GDALBlockReducer(GDALRasterBand *poBand, GDALRasterBand *poMaskBand,
+                     int nBlocksPerRow, int nTotalBlocks, int nSampleRate);
 
-    if (pfnProgress == nullptr)
-        pfnProgress = GDALDummyProgress;
+    size_t GetSampleCount() const
+    {
+        return m_nTotalBlocks <= 0
+                   ? 0
+                   : static_cast<size_t>(m_nTotalBlocks - 1) / m_nSampleRate +
+                         1;
+    }
 
-    /* -------------------------------------------------------------------- */
-    /*      If we have overviews, use them for the histogram.               */
-    /* -------------------------------------------------------------------- */
-    if (bApproxOK && GetOverviewCount() > 0 && !HasArbitraryOverviews())
+    bool IsParallel() const
     {
-        // FIXME: should we use the most reduced overview here or use some
-        // minimum number of samples like GDALRasterBand::ComputeStatistics()
-        // does?
-        GDALRasterBand *poBestOverview = GetRasterSampleOverview(0);
+        return m_poJobQueue != nullptr;
+    }
 
-        if (poBestOverview != this)
-        {
-            return poBestOverview->GetHistogram(
+    int GetSlotCount() const
+    {
+        return m_nMaxJobsInFlight + 1;
+    }
+
+    void SetUniformBlockFunc(const UniformBlockFunc &func)
+    {
+        m_uniformFunc = func;
+    }
+
+    CPLErr Run(const BlockFunc &func, GDALProgressFunc pfnProgress,
+               void *pProgressData, const char *pszMessage);
+
+  private:
+    struct Job
+    {
+        GDALBlockReducer *poReducer = nullptr;
+        GDALRasterBlock *poBlock = nullptr;
+        std::vector<GByte> abyMask{};
+        size_t iSample = 0;
+        int nXCheck = 0;
+        int nYCheck = 0;
+    };
+
+    static void JobFunc(void *pData);
+    bool ProcessUniformBlock(GDALRasterBlock *poBlock, size_t iSample,
+                             int nXCheck, int nYCheck);
+
+    GDALRasterBand *const m_poBand;
+    GDALRasterBand *const m_poMaskBand;
+    const int m_nBlocksPerRow;
+    const int m_nTotalBlocks;
+    const int m_nSampleRate;
+    GDALThreadReservation m_oThreadReservation{};
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    int m_nMaxJobsInFlight = 0;
+    const BlockFunc *m_pFunc = nullptr;
+    UniformBlockFunc m_uniformFunc{};
+    std::mutex m_oMutex{};
+    std::vector<int> m_anFreeSlots{};
+    std::atomic<bool> m_bStop{false};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALBlockReducer)
+};
+
+GDALBlockReducer::GDALBlockReducer(GDALRasterBand *poBand,
+                                   GDALRasterBand *poMaskBand,
+                                   int nBlocksPerRow, int nTotalBlocks,
+                                   int nSampleRate)
+    : m_poBand(poBand), m_poMaskBand(poMaskBand),
+      m_nBlocksPerRow(nBlocksPerRow), m_nTotalBlocks(nTotalBlocks),
+      m_nSampleRate(nSampleRate)
+{
+    if (GetSampleCount() <= 1)
+        return;
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nRequestedThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    if (nRequestedThreads <= 1)
+        return;
+    m_oThreadReservation =
+        GDALThreadReservation(std::min(128, nRequestedThreads));
+    const int nThreads = m_oThreadReservation.GetThreadCount();
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (poThreadPool)
+    {
+        m_poJobQueue = poThreadPool->CreateJobQueue();
+        // Limits the number of blocks kept locked in the block cache
+        m_nMaxJobsInFlight = 2 * nThreads;
+    }
+}
+
+void GDALBlockReducer::JobFunc(void *pData)
+{
+    std::unique_ptr<Job> psJob(static_cast<Job *>(pData));
+    GDALBlockReducer *poReducer = psJob->poReducer;
+
+    int iSlot;
+    {
+        std::lock_guard<std::mutex> oLock(poReducer->m_oMutex);
+        iSlot = poReducer->m_anFreeSlots.back();
+        poReducer->m_anFreeSlots.pop_back();
+    }
+
+    if (!poReducer->m_bStop &&
+        !(*poReducer->m_pFunc)(
+            psJob->iSample, iSlot, psJob->poBlock->GetDataRef(),
+            psJob->abyMask.empty() ? nullptr : psJob->abyMask.data(),
+            psJob->nXCheck, psJob->nYCheck))
+    {
+        poReducer->m_bStop = true;
+    }
+    psJob->poBlock->DropLock();
+
+    std::lock_guard<std::mutex> oLock(poReducer->m_oMutex);
+    poReducer->m_anFreeSlots.push_back(iSlot);
+}
+
+bool GDALBlockReducer::ProcessUniformBlock(GDALRasterBlock *poBlock,
+                                           size_t iSample, int nXCheck,
+                                           int nYCheck)
+{
+    double dfValue = 0;
+    if (!m_uniformFunc || m_poMaskBand || !poBlock->IsUniform(&dfValue))
+        return false;
+    if (!m_poJobQueue)
+        return m_uniformFunc(iSample, 0, dfValue, nXCheck, nYCheck);
+
+    // At most m_nMaxJobsInFlight jobs are pending, so a slot is available
+    int iSlot;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        iSlot = m_anFreeSlots.back();
+        m_anFreeSlots.pop_back();
+    }
+    const bool bRet = m_uniformFunc(iSample, iSlot, dfValue, nXCheck, nYCheck);
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_anFreeSlots.push_back(iSlot);
+    return bRet;
+}
+
+CPLErr GDALBlockReducer::Run(const BlockFunc &func,
+                             GDALProgressFunc pfnProgress,
+                             void *pProgressData, const char *pszMessage)
+{
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    m_poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    m_pFunc = &func;
+    m_anFreeSlots.clear();
+    for (int i = GetSlotCount() - 1; i >= 0; --i)
+        m_anFreeSlots.push_back(i);
+    m_bStop = false;
+
+    std::vector<GByte> abyMask;
+    CPLErr eErr = CE_None;
+    for (int iSampleBlock = 0; iSampleBlock < m_nTotalBlocks && !m_bStop;
+         iSampleBlock += m_nSampleRate)
+    {
+        const int iYBlock = iSampleBlock / m_nBlocksPerRow;
+        const int iXBlock = iSampleBlock - m_nBlocksPerRow * iYBlock;
+
+        GDALRasterBlock *const poBlock =
+            m_poBand->GetLockedBlockRef(iXBlock, iYBlock);
+        if (poBlock == nullptr)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        int nXCheck = 0, nYCheck = 0;
+        m_poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+        const size_t iSample =
+            static_cast<size_t>(iSampleBlock) / m_nSampleRate;
+        if (ProcessUniformBlock(poBlock, iSample, nXCheck, nYCheck))
+        {
+            poBlock->DropLock();
+        }
+        else
+        {
+            if (m_poMaskBand)
+            {
+                try
+                {
+                    abyMask.resize(static_cast<size_t>(nBlockXSize) *
+                                   nBlockYSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory allocating mask buffer");
+                    poBlock->DropLock();
+                    eErr = CE_Failure;
+                    break;
+                }
+                if (m_poMaskBand->RasterIO(
+                        GF_Read, iXBlock * nBlockXSize, iYBlock * nBlockYSize,
+                        nXCheck, nYCheck, abyMask.data(), nXCheck, nYCheck,
+                        GDT_Byte, 0, nBlockXSize, nullptr) != CE_None)
+                {
+                    poBlock->DropLock();
+                    eErr = CE_Failure;
+                    break;
+                }
+            }
+
+            if (m_poJobQueue)
+            {
+                auto psJob = std::make_unique<Job>();
+                psJob->poReducer = this;
+                psJob->poBlock = poBlock;
+                psJob->abyMask = std::move(abyMask);
+                psJob->iSample = iSample;
+                psJob->nXCheck = nXCheck;
+                psJob->nYCheck = nYCheck;
+                abyMask = std::vector<GByte>();
+                if (!m_poJobQueue->SubmitJob(JobFunc, psJob.get()))
+                {
+                    poBlock->DropLock();
+                    eErr = CE_Failure;
+                    break;
+                }
+                psJob.release();
+                m_poJobQueue->WaitCompletion(m_nMaxJobsInFlight);
+            }
+            else
+            {
+                if (!func(iSample, 0, poBlock->GetDataRef(),
+                          m_poMaskBand ? abyMask.data() : nullptr, nXCheck,
+                          nYCheck))
+                {
+                    m_bStop = true;
+                }
+                poBlock->DropLock();
+            }
+        }
+
+        if (!pfnProgress(iSampleBlock / static_cast<double>(m_nTotalBlocks),
+                         pszMessage, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+            break;
+        }
+    }
+
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_pFunc = nullptr;
+
+    return eErr;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                            GetHistogram()                            */
+/************************************************************************/
+
+/**
+ * \brief Compute raster histogram.
+ *
+ * Note that the bucket size is (dfMax-dfMin) / nBuckets.
+ *
+ * For example to compute a simple 256 entry histogram of eight bit data,
+ * the following would be suitable.  The unusual bounds are to ensure that
+ * bucket boundaries don't fall right on integer values causing possible errors
+ * due to rounding after scaling.
+\code{.cpp}
+    GUIntBig anHistogram[256];
+
+    poBand->GetHistogram( -0.5, 255.5, 256, anHistogram, FALSE, FALSE,
+                          GDALDummyProgress, nullptr );
+\endcode
+ *
+ * Note that setting bApproxOK will generally result in a subsampling of the
+ * file, and will utilize overviews if available.  It should generally
+ * produce a representative histogram for the data that is suitable for use
+ * in generating histogram based luts for instance.  Generally bApproxOK is
+ * much faster than an exactly computed histogram.
+ *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or an integer value to process blocks in parallel.
+ *
+ * This method is the same as the C functions GDALGetRasterHistogram() and
+ * GDALGetRasterHistogramEx().
+ *
+ * @param dfMin the lower bound of the histogram.
+ * @param dfMax the upper bound of the histogram.
+ * @param nBuckets the number of buckets in panHistogram.
+ * @param panHistogram array into which the histogram totals are placed.
+ * @param bIncludeOutOfRange if TRUE values below the histogram range will
+ * mapped into panHistogram[0], and values above will be mapped into
+ * panHistogram[nBuckets-1] otherwise out of range values are discarded.
+ * @param bApproxOK TRUE if an approximate, or incomplete histogram OK.
+ * @param pfnProgress function to report progress to completion.
+ * @param pProgressData application data to pass to pfnProgress.
+ *
+ * @return CE_None on success, or CE_Failure if something goes wrong.
+ */
+
+CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
+                                    GUIntBig *panHistogram,
+                                    int bIncludeOutOfRange, int bApproxOK,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressData)
+
+{
+    CPLAssert(nullptr != panHistogram);
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    /* -------------------------------------------------------------------- */
+    /*      If we have overviews, use them for the histogram.               */
+    /* -------------------------------------------------------------------- */
+    if (bApproxOK && GetOverviewCount() > 0 && !HasArbitraryOverviews())
+    {
+        // FIXME: should we use the most reduced overview here or use some
+        // minimum number of samples like GDALRasterBand::ComputeStatistics()
+        // does?
+        GDALRasterBand *poBestOverview = GetRasterSampleOverview(0);
+
+        if (poBestOverview != this)
+        {
+            return poBestOverview->GetHistogram(
                 dfMin, dfMax, nBuckets, panHistogram, bIncludeOutOfRange,
                 bApproxOK, pfnProgress, pProgressData);
         }
@@ -3735,15 +4438,23 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        GDALBlockReducer oReducer(this, poMaskBand, nBlocksPerRow,
+                                  nBlocksPerRow * nBlocksPerColumn,
+                                  nSampleRate);
+
+        // Histograms of the accumulator slots other than the first one, which
+        // directly uses panHistogram.
+        std::vector<std::vector<GUIntBig>> aanSlotHistograms;
+        try
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
+            aanSlotHistograms.resize(oReducer.GetSlotCount() - 1,
+                                     std::vector<GUIntBig>(nBuckets));
+        }
+        catch (const std::exception &)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory allocating histograms");
+            return CE_Failure;
         }
 
         /* --------------------------------------------------------------------
@@ -3751,53 +4462,156 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
         /*      Read the blocks, and add to histogram. */
         /* --------------------------------------------------------------------
          */
-        for (int iSampleBlock = 0;
-             iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        // Decodes the pixel at iOffset, and returns false if it must be
+        // ignored.
+        const auto GetHistogramValue =
+            [&](const void *pData, GPtrDiff_t iOffset, double &dfValue)
         {
-            if (!pfnProgress(
-                    iSampleBlock /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData))
+            switch (eDataType)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                case GDT_Byte:
+                {
+                    if (bSignedByte)
+                        dfValue = static_cast<const signed char *>(
+                            pData)[iOffset];
+                    else
+                        dfValue = static_cast<const GByte *>(pData)[iOffset];
+                    break;
+                }
+                case GDT_Int8:
+                    dfValue = static_cast<const GInt8 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt16:
+                    dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_Int16:
+                    dfValue = static_cast<const GInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt32:
+                    dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_Int32:
+                    dfValue = static_cast<const GInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GUInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Int64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Float32:
+                {
+                    const float fValue =
+                        static_cast<const float *>(pData)[iOffset];
+                    if (CPLIsNan(fValue) ||
+                        (bGotFloatNoDataValue &&
+                         ARE_REAL_EQUAL(fValue, fNoDataValue)))
+                        return false;
+                    dfValue = fValue;
+                    break;
+                }
+                case GDT_Float64:
+                    dfValue = static_cast<const double *>(pData)[iOffset];
+                    if (CPLIsNan(dfValue))
+                        return false;
+                    break;
+                case GDT_CInt16:
+                {
+                    double dfReal =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2];
+                    double dfImag = static_cast<const GInt16 *>(
+                        pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                }
+                break;
+                case GDT_CInt32:
+                {
+                    double dfReal =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2];
+                    double dfImag = static_cast<const GInt32 *>(
+                        pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                }
+                break;
+                case GDT_CFloat32:
+                {
+                    double dfReal =
+                        static_cast<const float *>(pData)[iOffset * 2];
+                    double dfImag = static_cast<const float *>(
+                        pData)[iOffset * 2 + 1];
+                    if (CPLIsNan(dfReal) || CPLIsNan(dfImag))
+                        return false;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                }
+                break;
+                case GDT_CFloat64:
+                {
+                    double dfReal =
+                        static_cast<const double *>(pData)[iOffset * 2];
+                    double dfImag = static_cast<const double *>(
+                        pData)[iOffset * 2 + 1];
+                    if (CPLIsNan(dfReal) || CPLIsNan(dfImag))
+                        return false;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                }
+                break;
+                case GDT_Unknown:
+                case GDT_TypeCount:
+                    CPLAssert(false);
+                    return false;
             }
 
-            const int iYBlock = iSampleBlock / nBlocksPerRow;
-            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+            return !(eDataType != GDT_Float32 && bGotNoDataValue &&
+                     ARE_REAL_EQUAL(dfValue, dfNoDataValue));
+        };
+
+        const auto AddToHistogram =
+            [&](GUIntBig *panHist, double dfValue, GUIntBig nCount)
+        {
+            // Given that dfValue and dfMin are not NaN, and dfScale > 0
+            // and finite, the result of the multiplication cannot be
+            // NaN
+            const double dfIndex = floor((dfValue - dfMin) * dfScale);
 
-            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+            if (dfIndex < 0)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                if (bIncludeOutOfRange)
+                    panHist[0] += nCount;
             }
-
-            void *pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+            else if (dfIndex >= nBuckets)
             {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
+                if (bIncludeOutOfRange)
+                    panHist[nBuckets - 1] += nCount;
+            }
+            else
+            {
+                panHist[static_cast<int>(dfIndex)] += nCount;
             }
+        };
+
+        // this is a special case for a common situation.
+        const auto IsByteSpecialCase = [&](int nXCheck, int nYCheck)
+        {
+            return eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
+                   (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
+                   nXCheck == nBlockXSize && nBuckets == 256;
+        };
+
+        const auto AddBlockToHistogram =
+            [&](size_t /* iSample */, int iSlot, const void *pData,
+                const GByte *pabyMaskData, int nXCheck, int nYCheck)
+        {
+            GUIntBig *const panHist =
+                iSlot == 0 ? panHistogram
+                           : aanSlotHistograms[iSlot - 1].data();
 
-            // this is a special case for a common situation.
-            if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
-                (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
-                nXCheck == nBlockXSize && nBuckets == 256)
+            if (IsByteSpecialCase(nXCheck, nYCheck))
             {
                 const GPtrDiff_t nPixels =
                     static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-                GByte *pabyData = static_cast<GByte *>(pData);
+                const GByte *pabyData = static_cast<const GByte *>(pData);
 
                 for (GPtrDiff_t i = 0; i < nPixels; i++)
                 {
@@ -3806,12 +4620,11 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                     if (!(bGotNoDataValue &&
                           (pabyData[i] == static_cast<GByte>(dfNoDataValue))))
                     {
-                        panHistogram[pabyData[i]]++;
+                        panHist[pabyData[i]]++;
                     }
                 }
 
-                poBlock->DropLock();
-                continue;  // To next sample block.
+                return true;
             }
 
             // This isn't the fastest way to do this, but is easier for now.
@@ -3826,134 +4639,56 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                         continue;
 
                     double dfValue = 0.0;
+                    if (GetHistogramValue(pData, iOffset, dfValue))
+                        AddToHistogram(panHist, dfValue, 1);
+                }
+            }
 
-                    switch (eDataType)
-                    {
-                        case GDT_Byte:
-                        {
-                            if (bSignedByte)
-                                dfValue =
-                                    static_cast<signed char *>(pData)[iOffset];
-                            else
-                                dfValue = static_cast<GByte *>(pData)[iOffset];
-                            break;
-                        }
-                        case GDT_Int8:
-                            dfValue = static_cast<GInt8 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt16:
-                            dfValue = static_cast<GUInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int16:
-                            dfValue = static_cast<GInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt32:
-                            dfValue = static_cast<GUInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int32:
-                            dfValue = static_cast<GInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt64:
-                            dfValue = static_cast<double>(
-                                static_cast<GUInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Int64:
-                            dfValue = static_cast<double>(
-                                static_cast<GInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Float32:
-                        {
-                            const float fValue =
-                                static_cast<float *>(pData)[iOffset];
-                            if (CPLIsNan(fValue) ||
-                                (bGotFloatNoDataValue &&
-                                 ARE_REAL_EQUAL(fValue, fNoDataValue)))
-                                continue;
-                            dfValue = fValue;
-                            break;
-                        }
-                        case GDT_Float64:
-                            dfValue = static_cast<double *>(pData)[iOffset];
-                            if (CPLIsNan(dfValue))
-                                continue;
-                            break;
-                        case GDT_CInt16:
-                        {
-                            double dfReal =
-                                static_cast<GInt16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        }
-                        break;
-                        case GDT_CInt32:
-                        {
-                            double dfReal =
-                                static_cast<GInt32 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        }
-                        break;
-                        case GDT_CFloat32:
-                        {
-                            double dfReal =
-                                static_cast<float *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<float *>(pData)[iOffset * 2 + 1];
-                            if (CPLIsNan(dfReal) || CPLIsNan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        }
-                        break;
-                        case GDT_CFloat64:
-                        {
-                            double dfReal =
-                                static_cast<double *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<double *>(pData)[iOffset * 2 + 1];
-                            if (CPLIsNan(dfReal) || CPLIsNan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                        }
-                        break;
-                        case GDT_Unknown:
-                        case GDT_TypeCount:
-                            CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
-                    }
-
-                    if (eDataType != GDT_Float32 && bGotNoDataValue &&
-                        ARE_REAL_EQUAL(dfValue, dfNoDataValue))
-                        continue;
-
-                    // Given that dfValue and dfMin are not NaN, and dfScale > 0
-                    // and finite, the result of the multiplication cannot be
-                    // NaN
-                    const double dfIndex = floor((dfValue - dfMin) * dfScale);
+            return true;
+        };
 
-                    if (dfIndex < 0)
-                    {
-                        if (bIncludeOutOfRange)
-                            panHistogram[0]++;
-                    }
-                    else if (dfIndex >= nBuckets)
-                    {
-                        if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
-                    }
-                    else
+        oReducer.SetUniformBlockFunc(
+            [&](size_t /* iSample */, int iSlot, double dfValue, int nXCheck,
+                int nYCheck)
+            {
+                if (bSignedByte || GDALDataTypeIsComplex(eDataType))
+                    return false;
+                GUIntBig *const panHist =
+                    iSlot == 0 ? panHistogram
+                               : aanSlotHistograms[iSlot - 1].data();
+                const GUIntBig nPixels =
+                    static_cast<GUIntBig>(nXCheck) * nYCheck;
+                GByte abyPixel[sizeof(double)] = {};
+                GDALCopyWords(&dfValue, GDT_Float64, 0, abyPixel, eDataType, 0,
+                              1);
+                if (IsByteSpecialCase(nXCheck, nYCheck))
+                {
+                    if (!(bGotNoDataValue &&
+                          (abyPixel[0] == static_cast<GByte>(dfNoDataValue))))
                     {
-                        ++panHistogram[static_cast<int>(dfIndex)];
+                        panHist[abyPixel[0]] += nPixels;
                     }
                 }
-            }
+                else
+                {
+                    double dfPixelValue = 0.0;
+                    if (GetHistogramValue(abyPixel, 0, dfPixelValue))
+                        AddToHistogram(panHist, dfPixelValue, nPixels);
+                }
+                return true;
+            });
 
-            poBlock->DropLock();
+        if (oReducer.Run(AddBlockToHistogram, pfnProgress, pProgressData,
+                         "Compute Histogram") != CE_None)
+        {
+            return CE_Failure;
         }
 
-        CPLFree(pabyMaskData);
+        for (const auto &anSlotHistogram : aanSlotHistograms)
+        {
+            for (int i = 0; i < nBuckets; ++i)
+                panHistogram[i] += anSlotHistogram[i];
+        }
     }
 
     pfnProgress(1.0, "Compute Histogram", pProgressData);
@@ -5610,6 +6345,108 @@ static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
     return dfValue;
 }
 
+/************************************************************************/
+/*                     GDALStatisticsAccumulator                        */
+/************************************************************************/
+
+namespace
+{
+
+// Running minimum, maximum, mean and sum of square of differences to the
+// mean, updated with the Welford algorithm.
+struct GDALStatisticsAccumulator
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUIntBig nValidCount = 0;
+    GUIntBig nSampleCount = 0;
+
+    void AddBlock(GDALDataType eDataType, bool bSignedByte, const void *pData,
+                  const GByte *pabyMaskData, int nXCheck, int nYCheck,
+                  int nLineStride, bool bGotNoDataValue, double dfNoDataValue,
+                  bool bGotFloatNoDataValue, float fNoDataValue)
+    {
+        for (int iY = 0; iY < nYCheck; iY++)
+        {
+            for (int iX = 0; iX < nXCheck; iX++)
+            {
+                const GPtrDiff_t iOffset =
+                    iX + static_cast<GPtrDiff_t>(iY) * nLineStride;
+                if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                    continue;
+
+                bool bValid = true;
+                const double dfValue =
+                    GetPixelValue(eDataType, bSignedByte, pData, iOffset,
+                                  bGotNoDataValue, dfNoDataValue,
+                                  bGotFloatNoDataValue, fNoDataValue, bValid);
+                if (!bValid)
+                    continue;
+
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+
+                nValidCount++;
+                const double dfDelta = dfValue - dfMean;
+                dfMean += dfDelta / nValidCount;
+                dfM2 += dfDelta * (dfValue - dfMean);
+            }
+        }
+
+        nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+    }
+
+    // Same as AddBlock() for a block whose pixels are all equal to dfValue.
+    void AddUniformBlock(GDALDataType eDataType, double dfValue, int nXCheck,
+                         int nYCheck, bool bGotNoDataValue,
+                         double dfNoDataValue, bool bGotFloatNoDataValue,
+                         float fNoDataValue)
+    {
+        // Apply the same validity rules as for a regular pixel
+        GByte abyPixel[2 * sizeof(double)] = {};
+        GDALCopyWords(&dfValue, GDT_Float64, 0, abyPixel, eDataType, 0, 1);
+        GDALStatisticsAccumulator oOther;
+        oOther.AddBlock(eDataType, false, abyPixel, nullptr, 1, 1, 1,
+                        bGotNoDataValue, dfNoDataValue, bGotFloatNoDataValue,
+                        fNoDataValue);
+        const GUIntBig nPixels = static_cast<GUIntBig>(nXCheck) * nYCheck;
+        oOther.nSampleCount = nPixels;
+        if (oOther.nValidCount)
+            oOther.nValidCount = nPixels;
+        Merge(oOther);
+    }
+
+    // Combines the moments of two disjoint sets of samples, using the
+    // pairwise formula of Chan et al.
+    void Merge(const GDALStatisticsAccumulator &other)
+    {
+        nSampleCount += other.nSampleCount;
+        if (other.nValidCount == 0)
+            return;
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        if (nValidCount == 0)
+        {
+            dfMean = other.dfMean;
+            dfM2 = other.dfM2;
+            nValidCount = other.nValidCount;
+            return;
+        }
+        const double dfCountA = static_cast<double>(nValidCount);
+        const double dfCountB = static_cast<double>(other.nValidCount);
+        const double dfCount = dfCountA + dfCountB;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * (dfCountB / dfCount);
+        dfM2 +=
+            other.dfM2 + dfDelta * dfDelta * (dfCountA * dfCountB / dfCount);
+        nValidCount += other.nValidCount;
+    }
+};
+
+}  // namespace
+
 /************************************************************************/
 /*                         SetValidPercent()                            */
 /************************************************************************/
@@ -5677,6 +6514,12 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or an integer value to process blocks in parallel. Blocks
+ * are still read from the calling thread. The moments of each block are then
+ * merged, so the mean and standard deviation may differ from the ones of a
+ * single-threaded computation in their last digits.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -5759,10 +6602,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     // the difference of the sum of square values with the square of the sum.
     // dfMean and dfM2 are updated at each sample.
     // dfM2 is the sum of square of differences to the current mean.
-    double dfMin = std::numeric_limits<double>::max();
-    double dfMax = -std::numeric_limits<double>::max();
-    double dfMean = 0.0;
-    double dfM2 = 0.0;
+    GDALStatisticsAccumulator oStats;
 
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
@@ -5797,9 +6637,6 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE");
     }
 
-    GUIntBig nSampleCount = 0;
-    GUIntBig nValidCount = 0;
-
     if (bApproxOK && HasArbitraryOverviews())
     {
         /* --------------------------------------------------------------------
@@ -5858,34 +6695,10 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             }
         }
 
-        /* this isn't the fastest way to do this, but is easier for now */
-        for (int iY = 0; iY < nYReduced; iY++)
-        {
-            for (int iX = 0; iX < nXReduced; iX++)
-            {
-                const int iOffset = iX + iY * nXReduced;
-                if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                    continue;
-
-                bool bValid = true;
-                double dfValue =
-                    GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                  CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                                  bGotFloatNoDataValue, fNoDataValue, bValid);
-                if (!bValid)
-                    continue;
-
-                dfMin = std::min(dfMin, dfValue);
-                dfMax = std::max(dfMax, dfValue);
-
-                nValidCount++;
-                const double dfDelta = dfValue - dfMean;
-                dfMean += dfDelta / nValidCount;
-                dfM2 += dfDelta * (dfValue - dfMean);
-            }
-        }
-
-        nSampleCount = static_cast<GUIntBig>(nXReduced) * nYReduced;
+        oStats.AddBlock(eDataType, bSignedByte, pData, pabyMaskData,
+                        nXReduced, nYReduced, nXReduced,
+                        CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                        bGotFloatNoDataValue, fNoDataValue);
 
         CPLFree(pData);
         CPLFree(pabyMaskData);
@@ -5937,10 +6750,6 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                       static_cast<GUInt64>(nBlockYSize))))
         {
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
             // If no valid nodata, map to invalid value (256 for Byte)
             const GUInt32 nNoDataValue =
                 (bGotNoDataValue && dfNoDataValue >= 0 &&
@@ -5950,31 +6759,41 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (int iSampleBlock = 0;
-                 iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
-            {
-                const int iYBlock = iSampleBlock / nBlocksPerRow;
-                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+            GDALBlockReducer oReducer(this, nullptr, nBlocksPerRow,
+                                      nBlocksPerRow * nBlocksPerColumn,
+                                      nSampleRate);
 
+            // Integral sums are exact, so the per-slot partial results can
+            // be combined in any order.
+            struct IntegerStats
+            {
+                GUInt32 nMin = 0;
+                GUInt32 nMax = 0;
+                GUIntBig nSum = 0;
+                GUIntBig nSumSquare = 0;
+                GUIntBig nSampleCount = 0;
+                GUIntBig nValidCount = 0;
+            };
+
+            std::vector<IntegerStats> aoSlotStats(oReducer.GetSlotCount());
+            for (auto &oSlotStats : aoSlotStats)
+                oSlotStats.nMin = nMaxValueType;
+
+            const auto AddBlockToStats =
+                [this, nMaxValueType, nNoDataValue, &aoSlotStats](
+                    size_t /* iSample */, int iSlot, const void *pData,
+                    const GByte * /* pabyMaskData */, int nXCheck, int nYCheck)
+            {
+                auto &o = aoSlotStats[iSlot];
                 if (eDataType == GDT_Byte)
                 {
                     ComputeStatisticsInternal<
                         GByte, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
                           static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                          nNoDataValue <= nMaxValueType, nNoDataValue, o.nMin,
+                          o.nMax, o.nSum, o.nSumSquare, o.nSampleCount,
+                          o.nValidCount);
                 }
                 else
                 {
@@ -5982,21 +6801,59 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                         GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
                           static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                          nNoDataValue <= nMaxValueType, nNoDataValue, o.nMin,
+                          o.nMax, o.nSum, o.nSumSquare, o.nSampleCount,
+                          o.nValidCount);
                 }
+                return true;
+            };
 
-                poBlock->DropLock();
-
-                if (!pfnProgress(iSampleBlock /
-                                     static_cast<double>(nBlocksPerRow *
-                                                         nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
+            oReducer.SetUniformBlockFunc(
+                [nMaxValueType, nNoDataValue,
+                 &aoSlotStats](size_t /* iSample */, int iSlot, double dfValue,
+                               int nXCheck, int nYCheck)
                 {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
-                }
+                    if (!(dfValue >= 0 && dfValue <= nMaxValueType))
+                        return false;
+                    const GUInt32 nValue = static_cast<GUInt32>(dfValue);
+                    if (nValue != dfValue)
+                        return false;
+                    auto &o = aoSlotStats[iSlot];
+                    const GUIntBig nPixels =
+                        static_cast<GUIntBig>(nXCheck) * nYCheck;
+                    o.nSampleCount += nPixels;
+                    if (nValue != nNoDataValue)
+                    {
+                        o.nMin = std::min(o.nMin, nValue);
+                        o.nMax = std::max(o.nMax, nValue);
+                        o.nSum += nValue * nPixels;
+                        o.nSumSquare +=
+                            static_cast<GUIntBig>(nValue) * nValue * nPixels;
+                        o.nValidCount += nPixels;
+                    }
+                    return true;
+                });
+
+            if (oReducer.Run(AddBlockToStats, pfnProgress, pProgressData,
+                             "Compute Statistics") != CE_None)
+            {
+                return CE_Failure;
+            }
+
+            GUInt32 nMin = nMaxValueType;
+            GUInt32 nMax = 0;
+            GUIntBig nSum = 0;
+            GUIntBig nSumSquare = 0;
+            GUIntBig nSampleCount = 0;
+            GUIntBig nValidCount = 0;
+            for (const auto &o : aoSlotStats)
+            {
+                nMin = std::min(nMin, o.nMin);
+                nMax = std::max(nMax, o.nMax);
+                nSum += o.nSum;
+                nSumSquare += o.nSumSquare;
+                nSampleCount += o.nSampleCount;
+                nValidCount += o.nValidCount;
             }
 
             if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -6010,8 +6867,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             /*      Save computed information. */
             /* --------------------------------------------------------------------
              */
-            if (nValidCount)
-                dfMean = static_cast<double>(nSum) / nValidCount;
+            const double dfMean =
+                nValidCount ? static_cast<double>(nSum) / nValidCount : 0.0;
 
             // To avoid potential precision issues when doing the difference,
             // we need to do that computation on 128 bit rather than casting
@@ -6065,93 +6922,63 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         }
 #endif
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        GDALBlockReducer oReducer(this, poMaskBand, nBlocksPerRow,
+                                  nBlocksPerRow * nBlocksPerColumn,
+                                  nSampleRate);
+
+        // When blocks are processed in parallel, the moments of each block
+        // are computed separately, and merged in the order of the blocks at
+        // the end, so that the result does not depend on thread scheduling.
+        std::vector<GDALStatisticsAccumulator> aoBlockStats;
+        try
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
+            aoBlockStats.resize(
+                oReducer.IsParallel() ? oReducer.GetSampleCount() : 1);
         }
-
-        for (int iSampleBlock = 0;
-             iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        catch (const std::exception &)
         {
-            const int iYBlock = iSampleBlock / nBlocksPerRow;
-            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            void *const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
-            }
-
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    bool bValid = true;
-                    double dfValue = GetPixelValue(
-                        eDataType, bSignedByte, pData, iOffset,
-                        CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                        bGotFloatNoDataValue, fNoDataValue, bValid);
-
-                    if (!bValid)
-                        continue;
-
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
-
-                    nValidCount++;
-                    const double dfDelta = dfValue - dfMean;
-                    dfMean += dfDelta / nValidCount;
-                    dfM2 += dfDelta * (dfValue - dfMean);
-                }
-            }
-
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory allocating statistics");
+            return CE_Failure;
+        }
 
-            poBlock->DropLock();
+        const bool bParallel = oReducer.IsParallel();
+        const auto AddBlockToStats =
+            [this, bParallel, bSignedByte, bGotNoDataValue, dfNoDataValue,
+             bGotFloatNoDataValue, fNoDataValue,
+             &aoBlockStats](size_t iSample, int /* iSlot */, const void *pData,
+                            const GByte *pabyMaskData, int nXCheck, int nYCheck)
+        {
+            aoBlockStats[bParallel ? iSample : 0].AddBlock(
+                eDataType, bSignedByte, pData, pabyMaskData, nXCheck, nYCheck,
+                nBlockXSize, CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                bGotFloatNoDataValue, fNoDataValue);
+            return true;
+        };
 
-            if (!pfnProgress(
-                    iSampleBlock /
-                        static_cast<double>(nBlocksPerRow * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
+        oReducer.SetUniformBlockFunc(
+            [this, bParallel, bSignedByte, bGotNoDataValue, dfNoDataValue,
+             bGotFloatNoDataValue, fNoDataValue,
+             &aoBlockStats](size_t iSample, int /* iSlot */, double dfValue,
+                            int nXCheck, int nYCheck)
             {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+                if (bSignedByte)
+                    return false;
+                aoBlockStats[bParallel ? iSample : 0].AddUniformBlock(
+                    eDataType, dfValue, nXCheck, nYCheck,
+                    CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                    bGotFloatNoDataValue, fNoDataValue);
+                return true;
+            });
+
+        if (oReducer.Run(AddBlockToStats, pfnProgress, pProgressData,
+                         "Compute Statistics") != CE_None)
+        {
+            return CE_Failure;
         }
 
-        CPLFree(pabyMaskData);
+        for (const auto &oBlockStats : aoBlockStats)
+            oStats.Merge(oBlockStats);
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -6163,9 +6990,10 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Save computed information.                                      */
     /* -------------------------------------------------------------------- */
-    const double dfStdDev = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
+    const double dfStdDev =
+        oStats.nValidCount > 0 ? sqrt(oStats.dfM2 / oStats.nValidCount) : 0.0;
 
-    if (nValidCount > 0)
+    if (oStats.nValidCount > 0)
     {
         if (bApproxOK)
         {
@@ -6175,31 +7003,31 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         {
             SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
         }
-        SetStatistics(dfMin, dfMax, dfMean, dfStdDev);
+        SetStatistics(oStats.dfMin, oStats.dfMax, oStats.dfMean, dfStdDev);
     }
     else
     {
-        dfMin = 0.0;
-        dfMax = 0.0;
+        oStats.dfMin = 0.0;
+        oStats.dfMax = 0.0;
     }
 
-    SetValidPercent(nSampleCount, nValidCount);
+    SetValidPercent(oStats.nSampleCount, oStats.nValidCount);
 
     /* -------------------------------------------------------------------- */
     /*      Record results.                                                 */
     /* -------------------------------------------------------------------- */
     if (pdfMin != nullptr)
-        *pdfMin = dfMin;
+        *pdfMin = oStats.dfMin;
     if (pdfMax != nullptr)
-        *pdfMax = dfMax;
+        *pdfMax = oStats.dfMax;
 
     if (pdfMean != nullptr)
-        *pdfMean = dfMean;
+        *pdfMean = oStats.dfMean;
 
     if (pdfStdDev != nullptr)
         *pdfStdDev = dfStdDev;
 
-    if (nValidCount > 0)
+    if (oStats.nValidCount > 0)
         return CE_None;
 
     ReportError(
@@ -6484,58 +7312,56 @@ static bool ComputeMinMaxGenericIterBlocks(
     GDALRasterBand *poMaskBand, double &dfMin, double &dfMax)
 
 {
-    GByte *pabyMaskData = nullptr;
     int nBlockXSize, nBlockYSize;
     poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
-    if (poMaskBand)
-    {
-        pabyMaskData =
-            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-        if (!pabyMaskData)
-        {
-            return false;
-        }
-    }
-
-    for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
-         iSampleBlock += nSampleRate)
-    {
-        const int iYBlock = iSampleBlock / nBlocksPerRow;
-        const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
-        if (poBlock == nullptr)
-        {
-            CPLFree(pabyMaskData);
-            return false;
-        }
+    GDALBlockReducer oReducer(poBand, poMaskBand, nBlocksPerRow, nTotalBlocks,
+                              nSampleRate);
 
-        void *const pData = poBlock->GetDataRef();
+    std::vector<std::pair<double, double>> aoSlotMinMax(
+        oReducer.GetSlotCount(), std::pair<double, double>(dfMin, dfMax));
 
-        int nXCheck = 0, nYCheck = 0;
-        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+    const auto AddBlockToMinMax =
+        [eDataType, bSignedByte, nBlockXSize, bGotNoDataValue, dfNoDataValue,
+         bGotFloatNoDataValue, fNoDataValue,
+         &aoSlotMinMax](size_t /* iSample */, int iSlot, const void *pData,
+                        const GByte *pabyMaskData, int nXCheck, int nYCheck)
+    {
+        auto &oMinMax = aoSlotMinMax[iSlot];
+        ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck, nYCheck,
+                             nBlockXSize, bGotNoDataValue, dfNoDataValue,
+                             bGotFloatNoDataValue, fNoDataValue, pabyMaskData,
+                             oMinMax.first, oMinMax.second);
+        return true;
+    };
 
-        if (poMaskBand &&
-            poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                 iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                 pabyMaskData, nXCheck, nYCheck, GDT_Byte, 0,
-                                 nBlockXSize, nullptr) != CE_None)
+    // Only the value of a uniform block matters
+    oReducer.SetUniformBlockFunc(
+        [eDataType, bSignedByte, bGotNoDataValue, dfNoDataValue,
+         bGotFloatNoDataValue, fNoDataValue,
+         &aoSlotMinMax](size_t /* iSample */, int iSlot, double dfValue,
+                        int /* nXCheck */, int /* nYCheck */)
         {
-            poBlock->DropLock();
-            CPLFree(pabyMaskData);
-            return false;
-        }
+            if (bSignedByte)
+                return false;
+            GByte abyPixel[2 * sizeof(double)] = {};
+            GDALCopyWords(&dfValue, GDT_Float64, 0, abyPixel, eDataType, 0, 1);
+            auto &oMinMax = aoSlotMinMax[iSlot];
+            ComputeMinMaxGeneric(abyPixel, eDataType, false, 1, 1, 1,
+                                 bGotNoDataValue, dfNoDataValue,
+                                 bGotFloatNoDataValue, fNoDataValue, nullptr,
+                                 oMinMax.first, oMinMax.second);
+            return true;
+        });
 
-        ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck, nYCheck,
-                             nBlockXSize, CPL_TO_BOOL(bGotNoDataValue),
-                             dfNoDataValue, bGotFloatNoDataValue, fNoDataValue,
-                             pabyMaskData, dfMin, dfMax);
+    if (oReducer.Run(AddBlockToMinMax, nullptr, nullptr, nullptr) != CE_None)
+        return false;
 
-        poBlock->DropLock();
+    for (const auto &oMinMax : aoSlotMinMax)
+    {
+        dfMin = std::min(dfMin, oMinMax.first);
+        dfMax = std::max(dfMax, oMinMax.second);
     }
-
-    CPLFree(pabyMaskData);
     return true;
 }
 
@@ -6550,6 +7376,9 @@ static bool ComputeMinMaxGenericIterBlocks(
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or an integer value to process blocks in parallel.
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -6647,9 +7476,10 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, bGotNoDataValue, dfNoDataValue, &nMin, &nMax,
-         &nMinInt16, &nMaxInt16](const void *pData, int nXCheck,
-                                 int nBufferWidth, int nYCheck)
+        [this, bSignedByte, bGotNoDataValue,
+         dfNoDataValue](const void *pData, int nXCheck, int nBufferWidth,
+                        int nYCheck, GUInt32 &l_nMin, GUInt32 &l_nMax,
+                        GInt16 &l_nMinInt16, GInt16 &l_nMaxInt16)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -6663,7 +7493,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  l_nMin, l_nMax, nSum, nSumSquare, nSampleCount, nValidCount);
         }
         else if (eDataType == GDT_UInt16)
         {
@@ -6677,7 +7507,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  l_nMin, l_nMax, nSum, nSumSquare, nSampleCount, nValidCount);
         }
         else if (eDataType == GDT_Int16)
         {
@@ -6693,7 +7523,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, true>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, nNoDataValue, &nMinInt16, &nMaxInt16);
+                        nXCheck, nNoDataValue, &l_nMinInt16, &l_nMaxInt16);
                 }
             }
             else
@@ -6703,7 +7533,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, false>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, 0, &nMinInt16, &nMaxInt16);
+                        nXCheck, 0, &l_nMinInt16, &l_nMaxInt16);
                 }
             }
         }
@@ -6769,7 +7599,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced, nMin,
+                                  nMax, nMinInt16, nMaxInt16);
         }
         else
         {
@@ -6810,29 +7641,65 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            for (int iSampleBlock = 0;
-                 iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
-            {
-                const int iYBlock = iSampleBlock / nBlocksPerRow;
-                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+            GDALBlockReducer oReducer(this, nullptr, nBlocksPerRow,
+                                      nBlocksPerRow * nBlocksPerColumn,
+                                      nSampleRate);
 
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
-
-                poBlock->DropLock();
+            struct MinMax
+            {
+                GUInt32 nMin;
+                GUInt32 nMax;
+                GInt16 nMinInt16;
+                GInt16 nMaxInt16;
+            };
+
+            std::vector<MinMax> aoSlotMinMax(
+                oReducer.GetSlotCount(),
+                MinMax{nMin, nMax, nMinInt16, nMaxInt16});
+
+            const auto AddBlockToMinMax =
+                [this, bSignedByte, &ComputeMinMaxForBlock, &aoSlotMinMax](
+                    size_t /* iSample */, int iSlot, const void *pData,
+                    const GByte * /* pabyMaskData */, int nXCheck, int nYCheck)
+            {
+                auto &o = aoSlotMinMax[iSlot];
+                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                      o.nMin, o.nMax, o.nMinInt16,
+                                      o.nMaxInt16);
+                // No need to go further once the full range has been found
+                return !(eDataType == GDT_Byte && !bSignedByte &&
+                         o.nMin == 0 && o.nMax == 255);
+            };
+
+            // Only the value of a uniform block matters
+            oReducer.SetUniformBlockFunc(
+                [this, bSignedByte, &ComputeMinMaxForBlock, &aoSlotMinMax](
+                    size_t /* iSample */, int iSlot, double dfValue,
+                    int /* nXCheck */, int /* nYCheck */)
+                {
+                    if (bSignedByte)
+                        return false;
+                    GByte abyPixel[sizeof(double)] = {};
+                    GDALCopyWords(&dfValue, GDT_Float64, 0, abyPixel,
+                                  eDataType, 0, 1);
+                    auto &o = aoSlotMinMax[iSlot];
+                    ComputeMinMaxForBlock(abyPixel, 1, 1, 1, o.nMin, o.nMax,
+                                          o.nMinInt16, o.nMaxInt16);
+                    return true;
+                });
+
+            if (oReducer.Run(AddBlockToMinMax, nullptr, nullptr, nullptr) !=
+                CE_None)
+            {
+                return CE_Failure;
+            }
 
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
-                    break;
+            for (const auto &o : aoSlotMinMax)
+            {
+                nMin = std::min(nMin, o.nMin);
+                nMax = std::max(nMax, o.nMax);
+                nMinInt16 = std::min(nMinInt16, o.nMinInt16);
+                nMaxInt16 = std::max(nMaxInt16, o.nMaxInt16);
             }
         }
         else
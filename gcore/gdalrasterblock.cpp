@@ -33,34 +33,89 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstring>
+#include <memory>
 #include <mutex>
+#include <utility>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+/************************************************************************/
+/*                      GDALRasterBlockCacheShard                       */
+/************************************************************************/
+
+namespace
+{
+/** Doubly-linked list of blocks, from the most recently inserted or used
+ * (head) to the oldest one (tail). */
+struct GDALRasterBlockCacheList
+{
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    // Only modified under the shard lock, but may be read without it.
+    std::atomic<GIntBig> nCacheUsed{0};
+};
+
+// The global block cache can be split in several shards (see the
+// GDAL_RB_CACHE_SHARDS configuration option), each one with its own
+// lists and lock, so that threads working on different bands do not contend
+// on a single lock. Blocks are assigned to a shard according to their band.
+struct GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+
+    // With the LRU policy, only aoLists[LIST_MAIN] is used.
+    // With the 2Q policy, aoLists[LIST_PROBATION] is the FIFO queue of
+    // blocks that have been accessed in a single burst ("A1in"), and
+    // aoLists[LIST_MAIN] the LRU list of blocks that have been accessed
+    // again after having been evicted from the FIFO queue ("Am").
+    GDALRasterBlockCacheList aoLists[2];
+
+    // Keys of the blocks recently evicted from the FIFO queue of the 2Q
+    // policy ("A1out"). Lazily created.
+    std::unique_ptr<lru11::Cache<uint64_t, bool>> poEvictedKeys{};
+
+    // Only modified under hLock, but may be read without it.
+    std::atomic<GIntBig> nCacheUsed{0};
+};
+
+/** Eviction policy of the global block cache. */
+enum class GDALRasterBlockCachePolicy
+{
+    LRU,
+    TWO_QUEUES,
+};
+}  // namespace
+
+constexpr int LIST_MAIN = 0;
+constexpr int LIST_PROBATION = 1;
+
+constexpr int MAX_CACHE_SHARDS = 64;
+static GDALRasterBlockCacheShard asShards[MAX_CACHE_SHARDS];
+static int nShardCount = 1;
+
+static GDALRasterBlockCachePolicy eCachePolicy =
+    GDALRasterBlockCachePolicy::LRU;
+
+// Maximum amount of cache used by a single dataset, either in bytes, or
+// as a percentage of GDAL_CACHEMAX. 0 means no limit.
+static GIntBig nCacheMaxPerDataset = 0;
+static double dfCacheMaxPerDatasetPct = 0;
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
@@ -91,13 +146,205 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(oShard)                                                \
+    CPLLockHolderD(&((oShard).hLock), GetLockType());                          \
+    CPLLockSetDebugPerf((oShard).hLock, bDebugContention)
+#define TAKE_LOCK(oShard) CPLLockHolderOptionalLockD((oShard).hLock)
+#define DESTROY_LOCK(oShard) CPLDestroyLock((oShard).hLock)
 
-#endif
+/************************************************************************/
+/*                      InitializeCacheSettings()                       */
+/************************************************************************/
+
+static void InitializeCacheSettings()
+{
+    static std::once_flag flagCacheSettings;
+    std::call_once(
+        flagCacheSettings,
+        []()
+        {
+            const char *pszShards =
+                CPLGetConfigOption("GDAL_RB_CACHE_SHARDS", "1");
+            int nShards = EQUAL(pszShards, "ALL_CPUS")
+                              ? std::min(CPLGetNumCPUs(), MAX_CACHE_SHARDS)
+                              : atoi(pszShards);
+            if (nShards < 1 || nShards > MAX_CACHE_SHARDS)
+            {
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "GDAL_RB_CACHE_SHARDS=%s not supported. "
+                         "Value should be in [1,%d] range",
+                         pszShards, MAX_CACHE_SHARDS);
+                nShards = std::max(1, std::min(nShards, MAX_CACHE_SHARDS));
+            }
+            nShardCount = nShards;
+
+            const char *pszPolicy =
+                CPLGetConfigOption("GDAL_RB_CACHE_POLICY", "LRU");
+            if (EQUAL(pszPolicy, "2Q"))
+                eCachePolicy = GDALRasterBlockCachePolicy::TWO_QUEUES;
+            else if (!EQUAL(pszPolicy, "LRU"))
+            {
+                CPLError(
+                    CE_Warning, CPLE_NotSupported,
+                    "GDAL_RB_CACHE_POLICY=%s not supported. Falling back to LRU",
+                    pszPolicy);
+            }
+
+            const char *pszMaxPerDataset =
+                CPLGetConfigOption("GDAL_CACHEMAX_PER_DATASET", nullptr);
+            if (pszMaxPerDataset)
+            {
+                if (strchr(pszMaxPerDataset, '%') != nullptr)
+                {
+                    dfCacheMaxPerDatasetPct = CPLAtof(pszMaxPerDataset);
+                    if (!(dfCacheMaxPerDatasetPct > 0 &&
+                          dfCacheMaxPerDatasetPct <= 100))
+                    {
+                        CPLError(CE_Warning, CPLE_IllegalArg,
+                                 "Invalid value for GDAL_CACHEMAX_PER_DATASET. "
+                                 "Ignoring it.");
+                        dfCacheMaxPerDatasetPct = 0;
+                    }
+                }
+                else
+                {
+                    nCacheMaxPerDataset = CPLAtoGIntBig(pszMaxPerDataset);
+                    if (nCacheMaxPerDataset < 0)
+                    {
+                        CPLError(CE_Warning, CPLE_IllegalArg,
+                                 "Invalid value for GDAL_CACHEMAX_PER_DATASET. "
+                                 "Ignoring it.");
+                        nCacheMaxPerDataset = 0;
+                    }
+                    else if (nCacheMaxPerDataset < 100000)
+                    {
+                        nCacheMaxPerDataset *= 1024 * 1024;
+                    }
+                }
+            }
+        });
+}
+
+/************************************************************************/
+/*                           GetShardCount()                            */
+/************************************************************************/
+
+static int GetShardCount()
+{
+    InitializeCacheSettings();
+    return nShardCount;
+}
+
+/************************************************************************/
+/*                       GetCacheMaxPerDataset()                        */
+/************************************************************************/
+
+static GIntBig GetCacheMaxPerDataset(GIntBig nCurCacheMax)
+{
+    if (dfCacheMaxPerDatasetPct > 0)
+        return static_cast<GIntBig>(static_cast<double>(nCurCacheMax) *
+                                    dfCacheMaxPerDatasetPct / 100.0);
+    return nCacheMaxPerDataset;
+}
+
+static bool IsCacheMaxPerDatasetSet()
+{
+    return dfCacheMaxPerDatasetPct > 0 || nCacheMaxPerDataset > 0;
+}
+
+/************************************************************************/
+/*                            GetShardIdx()                             */
+/************************************************************************/
+
+static int GetShardIdx(const GDALRasterBand *poBand)
+{
+    const int nShards = GetShardCount();
+    if (nShards == 1)
+        return 0;
+    // Fibonacci hashing of the band pointer, whose low bits are not
+    // significant due to alignment.
+    const uint64_t nHash =
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(poBand)) *
+        UINT64_C(11400714819323198485);
+    return static_cast<int>((nHash >> 32) % static_cast<unsigned>(nShards));
+}
+
+/************************************************************************/
+/*                            GetBlockKey()                             */
+/************************************************************************/
+
+// Identifier of a block, only used to recognize blocks recently evicted
+// from the FIFO queue of the 2Q policy. Collisions are harmless.
+static uint64_t GetBlockKey(const GDALRasterBand *poBand, int nXOff, int nYOff)
+{
+    uint64_t nKey = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(poBand));
+    nKey = nKey * UINT64_C(11400714819323198485) + static_cast<uint32_t>(nXOff);
+    nKey = nKey * UINT64_C(11400714819323198485) + static_cast<uint32_t>(nYOff);
+    return nKey;
+}
+
+/************************************************************************/
+/*                        RememberEvictedBlock()                        */
+/************************************************************************/
+
+// Must be called with the shard lock held.
+static void RememberEvictedBlock(GDALRasterBlockCacheShard &oShard,
+                                 uint64_t nKey)
+{
+    if (!oShard.poEvictedKeys)
+    {
+        // Remember about as many keys as half the number of 256x256 Byte
+        // blocks the shard can hold.
+        const size_t nMaxKeys = static_cast<size_t>(std::max<GIntBig>(
+            1024, nCacheMax / nShardCount / (2 * 256 * 256)));
+        oShard.poEvictedKeys =
+            std::make_unique<lru11::Cache<uint64_t, bool>>(nMaxKeys);
+    }
+    oShard.poEvictedKeys->insert(nKey, true);
+}
+
+/************************************************************************/
+/*                      ForgetEvictedBlockIfKnown()                     */
+/************************************************************************/
+
+// Must be called with the shard lock held.
+static bool ForgetEvictedBlockIfKnown(GDALRasterBlockCacheShard &oShard,
+                                      uint64_t nKey)
+{
+    return oShard.poEvictedKeys && oShard.poEvictedKeys->remove(nKey);
+}
+
+/************************************************************************/
+/*                         GetEvictionOrder()                           */
+/************************************************************************/
+
+// Returns the number of lists to consider for eviction in oShard, and
+// fills anLists[] with their indices, in the order they must be visited.
+static int GetEvictionOrder(const GDALRasterBlockCacheShard &oShard,
+                            int anLists[2])
+{
+    if (eCachePolicy == GDALRasterBlockCachePolicy::LRU)
+    {
+        anLists[0] = LIST_MAIN;
+        return 1;
+    }
+
+    // Evict first from the FIFO queue as long as it holds more than 25% of
+    // the shard, so that blocks accessed once by a large sequential scan
+    // do not push out the blocks that are repeatedly accessed.
+    if (4 * oShard.aoLists[LIST_PROBATION].nCacheUsed > oShard.nCacheUsed ||
+        oShard.aoLists[LIST_MAIN].poOldest == nullptr)
+    {
+        anLists[0] = LIST_PROBATION;
+        anLists[1] = LIST_MAIN;
+    }
+    else
+    {
+        anLists[0] = LIST_MAIN;
+        anLists[1] = LIST_PROBATION;
+    }
+    return 2;
+}
 
 // #define ENABLE_DEBUG
 
@@ -241,8 +488,10 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
+            const int nShards = GetShardCount();
+            for (int i = 0; i < nShards; ++i)
             {
-                INITIALIZE_LOCK;
+                INITIALIZE_LOCK(asShards[i]);
             }
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
@@ -434,25 +683,44 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    GDALRasterBlock *poTarget = nullptr;
 
+    // Start with the shard that holds the most memory.
+    const int nShards = GetShardCount();
+    int iFirstShard = 0;
+    for (int i = 1; i < nShards; ++i)
+    {
+        if (asShards[i].nCacheUsed > asShards[iFirstShard].nCacheUsed)
+            iFirstShard = i;
+    }
+    for (int iShardIter = 0; poTarget == nullptr && iShardIter < nShards;
+         ++iShardIter)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        auto &oShard = asShards[(iFirstShard + iShardIter) % nShards];
+        INITIALIZE_LOCK(oShard);
 
-        while (poTarget != nullptr)
+        int anLists[2];
+        const int nLists = GetEvictionOrder(oShard, anLists);
+        for (int iListIter = 0; poTarget == nullptr && iListIter < nLists;
+             ++iListIter)
         {
-            if (!bDirtyBlocksOnly ||
-                (poTarget->GetDirty() && nDisableDirtyBlockFlushCounter == 0))
+            poTarget = oShard.aoLists[anLists[iListIter]].poOldest;
+
+            while (poTarget != nullptr)
             {
-                if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0, -1))
-                    break;
+                if (!bDirtyBlocksOnly || (poTarget->GetDirty() &&
+                                          nDisableDirtyBlockFlushCounter == 0))
+                {
+                    if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0,
+                                                    -1))
+                        break;
+                }
+                poTarget = poTarget->poPrevious;
             }
-            poTarget = poTarget->poPrevious;
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
         if (bSleepsForBockCacheDebug)
         {
             // coverity[tainted_data]
@@ -462,10 +730,18 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
                 CPLSleep(dfDelay);
         }
 
+        if (poTarget->nCacheList == LIST_PROBATION)
+            RememberEvictedBlock(
+                oShard, GetBlockKey(poTarget->poBand, poTarget->nXOff,
+                                    poTarget->nYOff));
         poTarget->Detach_unlocked();
+        poTarget->poBand->poBandBlockCache->IncEvictions();
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
     if (bSleepsForBockCacheDebug)
     {
         // coverity[tainted_data]
@@ -562,6 +838,69 @@ void GDALRasterBlock::LeaveDisableDirtyBlockFlush()
     CPLAtomicDec(&nDisableDirtyBlockFlushCounter);
 }
 
+/************************************************************************/
+/*                        GDALRasterBlockView()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+GDALRasterBlockView::GDALRasterBlockView(GDALRasterBlock *poBlock,
+                                         int nValidXSize, int nValidYSize)
+    : m_poBlock(poBlock), m_nValidXSize(nValidXSize),
+      m_nValidYSize(nValidYSize)
+{
+}
+
+//! @endcond
+
+/** Move constructor */
+GDALRasterBlockView::GDALRasterBlockView(GDALRasterBlockView &&other) noexcept
+    : m_poBlock(other.m_poBlock), m_nValidXSize(other.m_nValidXSize),
+      m_nValidYSize(other.m_nValidYSize)
+{
+    other.m_poBlock = nullptr;
+    other.m_nValidXSize = 0;
+    other.m_nValidYSize = 0;
+}
+
+/** Move assignment operator */
+GDALRasterBlockView &
+GDALRasterBlockView::operator=(GDALRasterBlockView &&other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        std::swap(m_poBlock, other.m_poBlock);
+        std::swap(m_nValidXSize, other.m_nValidXSize);
+        std::swap(m_nValidYSize, other.m_nValidYSize);
+    }
+    return *this;
+}
+
+/** Destructor. Unpins the block. */
+GDALRasterBlockView::~GDALRasterBlockView()
+{
+    Release();
+}
+
+/************************************************************************/
+/*                              Release()                               */
+/************************************************************************/
+
+/** Unpin the block from the block cache, and make the view empty.
+ *
+ * @since GDAL 3.10
+ */
+void GDALRasterBlockView::Release()
+{
+    if (m_poBlock)
+    {
+        m_poBlock->DropLock();
+        m_poBlock = nullptr;
+        m_nValidXSize = 0;
+        m_nValidYSize = 0;
+    }
+}
+
 /************************************************************************/
 /*                          GDALRasterBlock()                           */
 /************************************************************************/
@@ -585,7 +924,9 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
                                  int nYOffIn)
     : eType(poBandIn->GetRasterDataType()), bDirty(false), nLockCount(0),
       nXOff(nXOffIn), nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr),
-      poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true)
+      poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true),
+      nShard(GetShardIdx(poBandIn)), nCacheList(LIST_MAIN), bUniform(false),
+      dfUniformValue(0)
 {
     CPLAssert(poBandIn != nullptr);
     poBand->GetBlockSize(&nXSize, &nYSize);
@@ -612,7 +953,8 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
 GDALRasterBlock::GDALRasterBlock(int nXOffIn, int nYOffIn)
     : eType(GDT_Unknown), bDirty(false), nLockCount(0), nXOff(nXOffIn),
       nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr), poBand(nullptr),
-      poNext(nullptr), poPrevious(nullptr), bMustDetach(false)
+      poNext(nullptr), poPrevious(nullptr), bMustDetach(false), nShard(0),
+      nCacheList(LIST_MAIN), bUniform(false), dfUniformValue(0)
 {
 }
 
@@ -632,6 +974,7 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
     pData = nullptr;
     bDirty = false;
     nLockCount = 0;
+    bUniform = false;
 
     poNext = nullptr;
     poPrevious = nullptr;
@@ -701,19 +1044,21 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(asShards[nShard]);
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    auto &oShard = asShards[nShard];
+    auto &oList = oShard.aoLists[nCacheList];
+    if (oList.poOldest == this)
+        oList.poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (oList.poNewest == this)
     {
-        poNewest = poNext;
+        oList.poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -727,7 +1072,20 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        const GIntBig nEffectiveSize = GetEffectiveBlockSize(GetBlockSize());
+        oList.nCacheUsed -= nEffectiveSize;
+        oShard.nCacheUsed -= nEffectiveSize;
+        nCacheUsed -= nEffectiveSize;
+        VSIMemoryAccountingUpdate(VSI_MEMORY_TAG_BLOCK_CACHE, -nEffectiveSize);
+        poBand->poBandBlockCache->AddCacheUsed(-nEffectiveSize);
+        if (IsCacheMaxPerDatasetSet())
+        {
+            GDALDataset *poDS = poBand->GetDataset();
+            if (poDS)
+                poDS->AddToBlockCacheUsed(-nEffectiveSize);
+        }
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -747,26 +1105,37 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int i = 0; i < GetShardCount(); ++i)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        auto &oShard = asShards[i];
+        TAKE_LOCK(oShard);
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        for (int iList = 0; iList < 2; ++iList)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            const auto &oList = oShard.aoLists[iList];
+            CPLAssert(
+                (oList.poNewest == nullptr && oList.poOldest == nullptr) ||
+                (oList.poNewest != nullptr && oList.poOldest != nullptr));
 
-            poLast = poBlock;
-        }
+            if (oList.poNewest != nullptr)
+            {
+                CPLAssert(oList.poNewest->poPrevious == nullptr);
+                CPLAssert(oList.poOldest->poNext == nullptr);
+
+                GDALRasterBlock *poLast = nullptr;
+                for (GDALRasterBlock *poBlock = oList.poNewest;
+                     poBlock != nullptr; poBlock = poBlock->poNext)
+                {
+                    CPLAssert(poBlock->poPrevious == poLast);
+                    CPLAssert(poBlock->nShard == i);
+                    CPLAssert(poBlock->nCacheList == iList);
 
-        CPLAssert(poOldest == poLast);
+                    poLast = poBlock;
+                }
+
+                CPLAssert(oList.poOldest == poLast);
+            }
+        }
     }
 }
 
@@ -779,8 +1148,10 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+    auto &oShard = asShards[GetShardIdx(poBand)];
+    TAKE_LOCK(oShard);
+    for (GDALRasterBlock *poBlock = oShard.aoLists[LIST_MAIN].poNewest;
+         poBlock != nullptr;
          poBlock = poBlock->poNext)
     {
         if (poBlock->GetBand() == poBand)
@@ -829,6 +1200,8 @@ CPLErr GDALRasterBlock::Write()
 
     if (poBand->eFlushBlockErr == CE_None)
     {
+        if (poBand->poBandBlockCache)
+            poBand->poBandBlockCache->IncDirtyBlocksWritten();
         int bCallLeaveReadWrite = poBand->EnterReadWrite(GF_Write);
         CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
         if (bCallLeaveReadWrite)
@@ -853,11 +1226,17 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    // Blocks in the FIFO queue of the 2Q policy are not moved when accessed
+    if (nCacheList == LIST_PROBATION)
+        return;
+
+    auto &oShard = asShards[nShard];
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.aoLists[nCacheList].poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(oShard);
     Touch_unlocked();
 }
 
@@ -870,15 +1249,16 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    auto &oList = asShards[nShard].aoLists[nCacheList];
+    if (oList.poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (oList.poOldest == this)
+        oList.poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -887,19 +1267,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oList.poNewest;
 
-    if (poNewest != nullptr)
+    if (oList.poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(oList.poNewest->poPrevious == nullptr);
+        oList.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oList.poNewest = this;
 
-    if (poOldest == nullptr)
+    if (oList.poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        oList.poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -928,9 +1308,9 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
-    const GIntBig nCurCacheMax = GDALGetCacheMax64();
+    GIntBig nCurCacheMax = GDALGetCacheMax64();
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
@@ -941,125 +1321,196 @@ CPLErr GDALRasterBlock::Internalize()
     bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
+    const int nShards = GetShardCount();
+    const GIntBig nEffectiveSize = GetEffectiveBlockSize(nSizeInBytes);
+
+    // Shrink the cache if the other subsystems use most of the soft memory
+    // limit, but always keep room for the new block.
+    const GIntBig nSoftBudget =
+        VSIGetMemorySoftBudget(VSI_MEMORY_TAG_BLOCK_CACHE);
+    if (nSoftBudget >= 0)
+        nCurCacheMax =
+            std::min(nCurCacheMax, std::max(nSoftBudget, nEffectiveSize));
+
+    const GIntBig nCurCacheMaxPerDataset =
+        poThisDS ? GetCacheMaxPerDataset(nCurCacheMax) : 0;
+    const auto IsOverLimit = [nCurCacheMax, nCurCacheMaxPerDataset, poThisDS]()
+    {
+        return nCacheUsed > nCurCacheMax ||
+               (nCurCacheMaxPerDataset > 0 &&
+                poThisDS->GetBlockCacheUsed() > nCurCacheMaxPerDataset);
+    };
     do
     {
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
+
+        if (bFirstIter)
         {
-            TAKE_LOCK;
+            nCacheUsed += nEffectiveSize;
+            VSIMemoryAccountingUpdate(VSI_MEMORY_TAG_BLOCK_CACHE,
+                                      nEffectiveSize);
+            if (poThisDS && IsCacheMaxPerDatasetSet())
+                poThisDS->AddToBlockCacheUsed(nEffectiveSize);
+        }
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+        // Evict blocks from the shard of this block first, and then from
+        // the other shards if that was not enough.
+        for (int iShardIter = 0;
+             !bLoopAgain && iShardIter < nShards && IsOverLimit(); ++iShardIter)
+        {
+            auto &oShard = asShards[(nShard + iShardIter) % nShards];
+            TAKE_LOCK(oShard);
+
+            int anLists[2];
+            const int nLists = GetEvictionOrder(oShard, anLists);
+            for (int iListIter = 0;
+                 !bLoopAgain && iListIter < nLists && IsOverLimit();
+                 ++iListIter)
             {
-                GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
-                // In this first pass, only discard dirty blocks of this
-                // dataset. We do this to decrease significantly the likelihood
-                // of the following weakness of the block cache design:
-                // 1. Thread 1 fills block B with ones
-                // 2. Thread 2 evicts this dirty block, while thread 1 almost
-                //    at the same time (but slightly after) tries to reacquire
-                //    this block. As it has been removed from the block cache
-                //    array/set, thread 1 now tries to read block B from disk,
-                //    so gets the old value.
-                while (poTarget != nullptr)
+                auto &oList = oShard.aoLists[anLists[iListIter]];
+                GDALRasterBlock *poTarget = oList.poOldest;
+                while (IsOverLimit())
                 {
-                    if (!poTarget->GetDirty())
-                    {
-                        if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount),
-                                                        0, -1))
-                            break;
-                    }
-                    else if (nDisableDirtyBlockFlushCounter == 0)
+                    // If we are only above the quota of this dataset, only
+                    // evict blocks of this dataset.
+                    const bool bOnlyThisDataset = nCacheUsed <= nCurCacheMax;
+
+                    GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
+                    // In this first pass, only discard dirty blocks of this
+                    // dataset. We do this to decrease significantly the
+                    // likelihood of the following weakness of the block cache
+                    // design:
+                    // 1. Thread 1 fills block B with ones
+                    // 2. Thread 2 evicts this dirty block, while thread 1
+                    //    almost at the same time (but slightly after) tries to
+                    //    reacquire this block. As it has been removed from the
+                    //    block cache array/set, thread 1 now tries to read
+                    //    block B from disk, so gets the old value.
+                    while (poTarget != nullptr)
                     {
-                        if (poTarget->poBand->GetDataset() == poThisDS)
+                        if (bOnlyThisDataset &&
+                            poTarget->poBand->GetDataset() != poThisDS)
+                        {
+                            // skip
+                        }
+                        else if (!poTarget->GetDirty())
                         {
                             if (CPLAtomicCompareAndExchange(
                                     &(poTarget->nLockCount), 0, -1))
                                 break;
                         }
-                        else if (poDirtyBlockOtherDataset == nullptr)
+                        else if (nDisableDirtyBlockFlushCounter == 0)
                         {
-                            poDirtyBlockOtherDataset = poTarget;
+                            if (poTarget->poBand->GetDataset() == poThisDS)
+                            {
+                                if (CPLAtomicCompareAndExchange(
+                                        &(poTarget->nLockCount), 0, -1))
+                                    break;
+                            }
+                            else if (poDirtyBlockOtherDataset == nullptr)
+                            {
+                                poDirtyBlockOtherDataset = poTarget;
+                            }
                         }
+                        poTarget = poTarget->poPrevious;
                     }
-                    poTarget = poTarget->poPrevious;
-                }
-                if (poTarget == nullptr && poDirtyBlockOtherDataset)
-                {
-                    if (CPLAtomicCompareAndExchange(
-                            &(poDirtyBlockOtherDataset->nLockCount), 0, -1))
-                    {
-                        CPLDebug("GDAL",
-                                 "Evicting dirty block of another dataset");
-                        poTarget = poDirtyBlockOtherDataset;
-                    }
-                    else
+                    if (poTarget == nullptr && poDirtyBlockOtherDataset)
                     {
-                        poTarget = poOldest;
-                        while (poTarget != nullptr)
+                        if (CPLAtomicCompareAndExchange(
+                                &(poDirtyBlockOtherDataset->nLockCount), 0,
+                                -1))
                         {
-                            if (CPLAtomicCompareAndExchange(
-                                    &(poTarget->nLockCount), 0, -1))
+                            CPLDebug("GDAL",
+                                     "Evicting dirty block of another dataset");
+                            poTarget = poDirtyBlockOtherDataset;
+                        }
+                        else
+                        {
+                            poTarget = oList.poOldest;
+                            while (poTarget != nullptr)
                             {
-                                CPLDebug(
-                                    "GDAL",
-                                    "Evicting dirty block of another dataset");
-                                break;
+                                if (CPLAtomicCompareAndExchange(
+                                        &(poTarget->nLockCount), 0, -1))
+                                {
+                                    CPLDebug("GDAL", "Evicting dirty block of "
+                                                     "another dataset");
+                                    break;
+                                }
+                                poTarget = poTarget->poPrevious;
                             }
-                            poTarget = poTarget->poPrevious;
                         }
                     }
-                }
 
-                if (poTarget != nullptr)
-                {
-                    if (bSleepsForBockCacheDebug)
+                    if (poTarget != nullptr)
                     {
-                        // coverity[tainted_data]
-                        const double dfDelay = CPLAtof(CPLGetConfigOption(
-                            "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
-                        if (dfDelay > 0)
-                            CPLSleep(dfDelay);
-                    }
+                        if (bSleepsForBockCacheDebug)
+                        {
+                            // coverity[tainted_data]
+                            const double dfDelay = CPLAtof(CPLGetConfigOption(
+                                "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK",
+                                "0"));
+                            if (dfDelay > 0)
+                                CPLSleep(dfDelay);
+                        }
 
-                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                        GDALRasterBlock *_poPrevious = poTarget->poPrevious;
 
-                    poTarget->Detach_unlocked();
-                    poTarget->GetBand()->UnreferenceBlock(poTarget);
+                        if (poTarget->nCacheList == LIST_PROBATION)
+                            RememberEvictedBlock(
+                                oShard,
+                                GetBlockKey(poTarget->poBand, poTarget->nXOff,
+                                            poTarget->nYOff));
+                        poTarget->Detach_unlocked();
+                        poTarget->poBand->poBandBlockCache->IncEvictions();
+                        poTarget->GetBand()->UnreferenceBlock(poTarget);
 
-                    apoBlocksToFree[nBlocksToFree++] = poTarget;
-                    if (poTarget->GetDirty())
-                    {
-                        // Only free one dirty block at a time so that
-                        // other dirty blocks of other bands with the same
-                        // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
-                        break;
+                        apoBlocksToFree[nBlocksToFree++] = poTarget;
+                        if (poTarget->GetDirty())
+                        {
+                            // Only free one dirty block at a time so that
+                            // other dirty blocks of other bands with the same
+                            // coordinates can be found with TryGetLockedBlock()
+                            bLoopAgain = IsOverLimit();
+                            break;
+                        }
+                        if (nBlocksToFree == 64)
+                        {
+                            bLoopAgain = IsOverLimit();
+                            break;
+                        }
+
+                        poTarget = _poPrevious;
                     }
-                    if (nBlocksToFree == 64)
+                    else
                     {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
                         break;
                     }
-
-                    poTarget = _poPrevious;
-                }
-                else
-                {
-                    break;
                 }
             }
+        }
 
-            /* ------------------------------------------------------------------
-             */
-            /*      Add this block to the list. */
-            /* ------------------------------------------------------------------
-             */
-            if (!bLoopAgain)
-                Touch_unlocked();
+        /* -------------------------------------------------------------------- */
+        /*      Add this block to the list.                                     */
+        /* -------------------------------------------------------------------- */
+        if (!bLoopAgain)
+        {
+            auto &oShard = asShards[nShard];
+            TAKE_LOCK(oShard);
+            // With the 2Q policy, blocks go first in the FIFO queue, unless
+            // they have been recently evicted from it.
+            nCacheList = LIST_MAIN;
+            if (eCachePolicy == GDALRasterBlockCachePolicy::TWO_QUEUES &&
+                !ForgetEvictedBlockIfKnown(
+                    oShard, GetBlockKey(poBand, nXOff, nYOff)))
+            {
+                nCacheList = LIST_PROBATION;
+            }
+            Touch_unlocked();
+            oShard.aoLists[nCacheList].nCacheUsed += nEffectiveSize;
+            oShard.nCacheUsed += nEffectiveSize;
+            poBand->poBandBlockCache->AddCacheUsed(nEffectiveSize);
         }
 
         bFirstIter = false;
@@ -1140,6 +1591,8 @@ void GDALRasterBlock::MarkDirty()
             poBand->IncDirtyBlocks(1);
     }
     bDirty = true;
+    // The content is about to be modified
+    bUniform = false;
 }
 
 /************************************************************************/
@@ -1160,6 +1613,27 @@ void GDALRasterBlock::MarkClean()
     bDirty = false;
 }
 
+/************************************************************************/
+/*                            MarkUniform()                             */
+/************************************************************************/
+
+/**
+ * Mark the block as having all its pixels equal to the same value.
+ *
+ * This is normally called by GDALRasterBand::GetLockedBlockRef() when the
+ * driver has reported it with SetReadBlockUniformValue() from IReadBlock().
+ * The flag is reset by MarkDirty().
+ *
+ * @param dfValue Value of all the pixels of the block.
+ * @since GDAL 3.10
+ */
+
+void GDALRasterBlock::MarkUniform(double dfValue)
+{
+    bUniform = true;
+    dfUniformValue = dfValue;
+}
+
 /************************************************************************/
 /*                          DestroyRBMutex()                           */
 /************************************************************************/
@@ -1167,9 +1641,13 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &oShard : asShards)
+    {
+        if (oShard.hLock != nullptr)
+            DESTROY_LOCK(oShard);
+        oShard.hLock = nullptr;
+        oShard.poEvictedKeys.reset();
+    }
 }
 
 /*! @endcond */
@@ -1248,7 +1726,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(asShards[nShard]);
 
     return FALSE;
 }
@@ -1257,14 +1735,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int i = 0; i < GetShardCount(); ++i )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = asShards[i].aoLists[LIST_MAIN].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
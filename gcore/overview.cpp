@@ -42,6 +42,8 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -2093,6 +2095,14 @@ static CPLErr GDALResampleChunk_Mode_T(
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
     std::vector<int> anVals(256, 0);
 
+    // For GUInt16: per-value counters, and list of the values to reset.
+    std::vector<int> anCounts;
+    std::vector<GUInt16> anTouchedVals;
+
+    // For other types, with large windows: (value, position) pairs sorted
+    // to count the occurrences, instead of a quadratic linear search.
+    std::vector<std::pair<T, int>> aoValPos;
+
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
     /* ==================================================================== */
@@ -2215,6 +2225,122 @@ static CPLErr GDALResampleChunk_Mode_T(
                     nMaxNumPx = nNumPx;
                 }
 
+                // The value retained is the first one to reach the maximum
+                // count in scan order. The code paths below all implement
+                // that same rule.
+                if constexpr (std::is_same<T, GUInt16>::value)
+                {
+                    if (anCounts.empty())
+                    {
+                        try
+                        {
+                            anCounts.resize(65536);
+                            anTouchedVals.reserve(nNumPx);
+                        }
+                        catch (const std::exception &)
+                        {
+                            CPLError(CE_Failure, CPLE_OutOfMemory,
+                                     "Out of memory in mode resampling");
+                            CPLFree(padfVals);
+                            CPLFree(panSums);
+                            return CE_Failure;
+                        }
+                    }
+                    int nMaxCount = 0;
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const GPtrDiff_t iTotYOff =
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        {
+                            if (pabySrcScanlineNodataMask == nullptr ||
+                                pabySrcScanlineNodataMask[iX + iTotYOff])
+                            {
+                                const GUInt16 nVal =
+                                    paSrcScanline[iX + iTotYOff];
+                                const int nCount = ++anCounts[nVal];
+                                if (nCount == 1)
+                                    anTouchedVals.push_back(nVal);
+                                if (nCount > nMaxCount)
+                                {
+                                    nMaxCount = nCount;
+                                    padfVals[0] = nVal;
+                                }
+                            }
+                        }
+                    }
+                    for (const GUInt16 nVal : anTouchedVals)
+                        anCounts[nVal] = 0;
+                    anTouchedVals.clear();
+                    paDstScanline[iDstPixel - nDstXOff] =
+                        nMaxCount == 0 ? tNoDataValue : padfVals[0];
+                    continue;
+                }
+                else if (nNumPx > 32)
+                {
+                    aoValPos.clear();
+                    int nPos = 0;
+                    int nBestCount = 0;
+                    int nBestLastPos = 0;
+                    T bestVal = tNoDataValue;
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const GPtrDiff_t iTotYOff =
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        {
+                            if (pabySrcScanlineNodataMask == nullptr ||
+                                pabySrcScanlineNodataMask[iX + iTotYOff])
+                            {
+                                const T val = paSrcScanline[iX + iTotYOff];
+                                // NaN never compares equal, so each NaN
+                                // counts as a distinct value.
+                                if (CPLIsNan(static_cast<double>(val)))
+                                {
+                                    if (nBestCount == 0)
+                                    {
+                                        nBestCount = 1;
+                                        nBestLastPos = nPos;
+                                        bestVal = val;
+                                    }
+                                }
+                                else
+                                {
+                                    aoValPos.emplace_back(val, nPos);
+                                }
+                                ++nPos;
+                            }
+                        }
+                    }
+                    // Sorting by value, then position, gives runs of equal
+                    // values whose last element is the position where
+                    // the value reached its final count.
+                    std::sort(aoValPos.begin(), aoValPos.end());
+                    for (size_t i = 0; i < aoValPos.size();)
+                    {
+                        size_t iEnd = i + 1;
+                        while (iEnd < aoValPos.size() &&
+                               aoValPos[iEnd].first == aoValPos[i].first)
+                            ++iEnd;
+                        const int nCount = static_cast<int>(iEnd - i);
+                        const int nLastPos = aoValPos[iEnd - 1].second;
+                        if (nCount > nBestCount ||
+                            (nCount == nBestCount && nLastPos < nBestLastPos))
+                        {
+                            nBestCount = nCount;
+                            nBestLastPos = nLastPos;
+                            bestVal = aoValPos[i].first;
+                        }
+                        i = iEnd;
+                    }
+                    paDstScanline[iDstPixel - nDstXOff] = bestVal;
+                    continue;
+                }
+
                 for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
                 {
                     const GPtrDiff_t iTotYOff =
@@ -2555,11 +2681,11 @@ static inline void GDALResampleConvolutionVertical_2cols(
 /*             GDALResampleConvolutionVertical_16cols<T>                */
 /************************************************************************/
 
-template <class T>
+template <class T, class Tdest>
 static inline void
 GDALResampleConvolutionVertical_16cols(const T *pChunk, int nStride,
                                        const double *padfWeights,
-                                       int nSrcLineCount, float *afDest)
+                                       int nSrcLineCount, Tdest *afDest)
 {
     int i = 0;
     int j = 0;
@@ -2608,26 +2734,17 @@ GDALResampleConvolutionVertical_16cols(const T *pChunk, int nStride,
     v_acc3.Store4Val(afDest + 12);
 }
 
-template <class T>
-static inline void GDALResampleConvolutionVertical_16cols(const T *, int,
-                                                          const double *, int,
-                                                          double *)
-{
-    // Cannot be reached
-    CPLAssert(false);
-}
-
 #else
 
 /************************************************************************/
 /*              GDALResampleConvolutionVertical_8cols<T>                */
 /************************************************************************/
 
-template <class T>
+template <class T, class Tdest>
 static inline void
 GDALResampleConvolutionVertical_8cols(const T *pChunk, int nStride,
                                       const double *padfWeights,
-                                      int nSrcLineCount, float *afDest)
+                                      int nSrcLineCount, Tdest *afDest)
 {
     int i = 0;
     int j = 0;
@@ -2662,15 +2779,6 @@ GDALResampleConvolutionVertical_8cols(const T *pChunk, int nStride,
     v_acc1.Store4Val(afDest + 4);
 }
 
-template <class T>
-static inline void GDALResampleConvolutionVertical_8cols(const T *, int,
-                                                         const double *, int,
-                                                         double *)
-{
-    // Cannot be reached
-    CPLAssert(false);
-}
-
 #endif  // __AVX__
 
 /************************************************************************/
@@ -2728,6 +2836,22 @@ inline double GDALResampleConvolutionHorizontal<GUInt16>(
                                                  nSrcPixelCount);
 }
 
+template <>
+inline double GDALResampleConvolutionHorizontal<float>(
+    const float *pChunk, const double *padfWeightsAligned, int nSrcPixelCount)
+{
+    return GDALResampleConvolutionHorizontalSSE2(pChunk, padfWeightsAligned,
+                                                 nSrcPixelCount);
+}
+
+template <>
+inline double GDALResampleConvolutionHorizontal<double>(
+    const double *pChunk, const double *padfWeightsAligned, int nSrcPixelCount)
+{
+    return GDALResampleConvolutionHorizontalSSE2(pChunk, padfWeightsAligned,
+                                                 nSrcPixelCount);
+}
+
 /************************************************************************/
 /*              GDALResampleConvolutionHorizontalWithMaskSSE2<T>        */
 /************************************************************************/
@@ -2787,6 +2911,28 @@ inline void GDALResampleConvolutionHorizontalWithMask<GUInt16>(
         dfWeightSum);
 }
 
+template <>
+inline void GDALResampleConvolutionHorizontalWithMask<float>(
+    const float *pChunk, const GByte *pabyMask,
+    const double *padfWeightsAligned, int nSrcPixelCount, double &dfVal,
+    double &dfWeightSum)
+{
+    GDALResampleConvolutionHorizontalWithMaskSSE2(
+        pChunk, pabyMask, padfWeightsAligned, nSrcPixelCount, dfVal,
+        dfWeightSum);
+}
+
+template <>
+inline void GDALResampleConvolutionHorizontalWithMask<double>(
+    const double *pChunk, const GByte *pabyMask,
+    const double *padfWeightsAligned, int nSrcPixelCount, double &dfVal,
+    double &dfWeightSum)
+{
+    GDALResampleConvolutionHorizontalWithMaskSSE2(
+        pChunk, pabyMask, padfWeightsAligned, nSrcPixelCount, dfVal,
+        dfWeightSum);
+}
+
 /************************************************************************/
 /*              GDALResampleConvolutionHorizontal_3rows_SSE2<T>         */
 /************************************************************************/
@@ -2862,6 +3008,28 @@ inline void GDALResampleConvolutionHorizontal_3rows<GUInt16>(
         dfRes1, dfRes2, dfRes3);
 }
 
+template <>
+inline void GDALResampleConvolutionHorizontal_3rows<float>(
+    const float *pChunkRow1, const float *pChunkRow2, const float *pChunkRow3,
+    const double *padfWeightsAligned, int nSrcPixelCount, double &dfRes1,
+    double &dfRes2, double &dfRes3)
+{
+    GDALResampleConvolutionHorizontal_3rows_SSE2(
+        pChunkRow1, pChunkRow2, pChunkRow3, padfWeightsAligned, nSrcPixelCount,
+        dfRes1, dfRes2, dfRes3);
+}
+
+template <>
+inline void GDALResampleConvolutionHorizontal_3rows<double>(
+    const double *pChunkRow1, const double *pChunkRow2,
+    const double *pChunkRow3, const double *padfWeightsAligned,
+    int nSrcPixelCount, double &dfRes1, double &dfRes2, double &dfRes3)
+{
+    GDALResampleConvolutionHorizontal_3rows_SSE2(
+        pChunkRow1, pChunkRow2, pChunkRow3, padfWeightsAligned, nSrcPixelCount,
+        dfRes1, dfRes2, dfRes3);
+}
+
 /************************************************************************/
 /*     GDALResampleConvolutionHorizontalPixelCountLess8_3rows_SSE2<T>   */
 /************************************************************************/
@@ -2928,6 +3096,28 @@ inline void GDALResampleConvolutionHorizontalPixelCountLess8_3rows<GUInt16>(
         dfRes1, dfRes2, dfRes3);
 }
 
+template <>
+inline void GDALResampleConvolutionHorizontalPixelCountLess8_3rows<float>(
+    const float *pChunkRow1, const float *pChunkRow2, const float *pChunkRow3,
+    const double *padfWeightsAligned, int nSrcPixelCount, double &dfRes1,
+    double &dfRes2, double &dfRes3)
+{
+    GDALResampleConvolutionHorizontalPixelCountLess8_3rows_SSE2(
+        pChunkRow1, pChunkRow2, pChunkRow3, padfWeightsAligned, nSrcPixelCount,
+        dfRes1, dfRes2, dfRes3);
+}
+
+template <>
+inline void GDALResampleConvolutionHorizontalPixelCountLess8_3rows<double>(
+    const double *pChunkRow1, const double *pChunkRow2,
+    const double *pChunkRow3, const double *padfWeightsAligned,
+    int nSrcPixelCount, double &dfRes1, double &dfRes2, double &dfRes3)
+{
+    GDALResampleConvolutionHorizontalPixelCountLess8_3rows_SSE2(
+        pChunkRow1, pChunkRow2, pChunkRow3, padfWeightsAligned, nSrcPixelCount,
+        dfRes1, dfRes2, dfRes3);
+}
+
 /************************************************************************/
 /*     GDALResampleConvolutionHorizontalPixelCount4_3rows_SSE2<T>       */
 /************************************************************************/
@@ -2981,6 +3171,28 @@ inline void GDALResampleConvolutionHorizontalPixelCount4_3rows<GUInt16>(
         dfRes3);
 }
 
+template <>
+inline void GDALResampleConvolutionHorizontalPixelCount4_3rows<float>(
+    const float *pChunkRow1, const float *pChunkRow2, const float *pChunkRow3,
+    const double *padfWeightsAligned, double &dfRes1, double &dfRes2,
+    double &dfRes3)
+{
+    GDALResampleConvolutionHorizontalPixelCount4_3rows_SSE2(
+        pChunkRow1, pChunkRow2, pChunkRow3, padfWeightsAligned, dfRes1, dfRes2,
+        dfRes3);
+}
+
+template <>
+inline void GDALResampleConvolutionHorizontalPixelCount4_3rows<double>(
+    const double *pChunkRow1, const double *pChunkRow2,
+    const double *pChunkRow3, const double *padfWeightsAligned, double &dfRes1,
+    double &dfRes2, double &dfRes3)
+{
+    GDALResampleConvolutionHorizontalPixelCount4_3rows_SSE2(
+        pChunkRow1, pChunkRow2, pChunkRow3, padfWeightsAligned, dfRes1, dfRes2,
+        dfRes3);
+}
+
 #endif  // USE_SSE2
 
 /************************************************************************/
@@ -3412,7 +3624,8 @@ static CPLErr GDALResampleChunk_ConvolutionT(
             size_t j =
                 (nSrcLineStart - nChunkYOff) * static_cast<size_t>(nDstXSize);
 #ifdef USE_SSE2
-            if constexpr (eWrkDataType == GDT_Float32)
+            if constexpr (eWrkDataType == GDT_Float32 ||
+                          eWrkDataType == GDT_Float64)
             {
 #ifdef __AVX__
                 for (; iFilteredPixelOff + 15 < nDstXSize;
@@ -4558,9 +4771,11 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     void *pChunk = nullptr;
 
     const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
-                                                       ? CPLGetNumCPUs()
-                                                       : atoi(pszThreads)));
+    const GDALThreadReservation oThreadReservation(
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads))));
+    const int nThreads = oThreadReservation.GetThreadCount();
     auto poThreadPool =
         nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
     auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
@@ -4934,6 +5149,12 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
  *
+ * Starting with GDAL 3.10, when an overview level is computed from the
+ * previous one, the previous level is taken from memory rather than read
+ * back from the overview bands, provided that it fits in
+ * GDAL_OVR_LEVEL_IN_MEMORY_MAX_SIZE bytes (100 MB by default), that no mask
+ * is involved and that the overview bands are not lossy compressed.
+ *
  * @param nBands the number of bands, size of papoSrcBands and size of
  *               first dimension of papapoOverviewBands
  * @param papoSrcBands the list of source bands to downsample
@@ -5093,9 +5314,11 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         CPLTestBool(CPLGetConfigOption("GDAL_OVR_PROPAGATE_NODATA", "NO"));
 
     const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
-                                                       ? CPLGetNumCPUs()
-                                                       : atoi(pszThreads)));
+    const GDALThreadReservation oThreadReservation(
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads))));
+    const int nThreads = oThreadReservation.GetThreadCount();
     auto poThreadPool =
         nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
     auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
@@ -5105,6 +5328,19 @@ CPLErr GDALRegenerateOverviewsMultiBand(
     const int nChunkMaxSize =
         atoi(CPLGetConfigOption("GDAL_OVR_CHUNK_MAX_SIZE", "10485760"));
 
+    // Maximum size of an overview level kept in memory, to be used as the
+    // source of the next level, instead of reading it back from the overview
+    // bands (which may involve decompressing blocks just compressed).
+    const GIntBig nLevelInMemoryMaxSize = CPLAtoGIntBig(
+        CPLGetConfigOption("GDAL_OVR_LEVEL_IN_MEMORY_MAX_SIZE", "104857600"));
+    const bool bFullRefresh =
+        nSrcXOff == 0 && nSrcYOff == 0 && nSrcXSize == nToplevelSrcWidth &&
+        nSrcYSize == nToplevelSrcHeight;
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eDataType);
+
+    // Content of the previous overview level, per band, if kept in memory.
+    std::vector<std::vector<GByte>> aabyPrevLevel;
+
     // Second pass to do the real job.
     double dfCurPixelCount = 0;
     CPLErr eErr = CE_None;
@@ -5200,6 +5436,62 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         const int nFullResXChunkQueried =
             nFullResXChunk + 2 * nKernelRadius * nOvrFactor;
 
+        // Use the previous level from memory if it has been kept.
+        std::vector<std::vector<GByte>> aabySrcLevel;
+        if (iSrcOverview >= 0)
+            aabySrcLevel = std::move(aabyPrevLevel);
+        aabyPrevLevel.clear();
+
+        // Keep this level in memory if it will be the source of the next
+        // one, and if reading it back would give the same values (no
+        // lossy compression nor NBITS truncation).
+        std::vector<std::vector<GByte>> aabyCurLevel;
+        if (bFullRefresh && !bUseNoDataMask && iOverview + 1 < nOverviews &&
+            papapoOverviewBands[0][iOverview + 1]->GetXSize() <
+                nDstTotalWidth &&
+            static_cast<GIntBig>(nDstTotalWidth) * nDstTotalHeight * nBands *
+                    nDataTypeSize <=
+                nLevelInMemoryMaxSize)
+        {
+            bool bCanKeepLevel = true;
+            for (int iBand = 0; iBand < nBands && bCanKeepLevel; ++iBand)
+            {
+                auto poOvrBand = papapoOverviewBands[iBand][iOverview];
+                if (poOvrBand->GetMetadataItem("NBITS", "IMAGE_STRUCTURE"))
+                    bCanKeepLevel = false;
+                auto poOvrDS = poOvrBand->GetDataset();
+                const char *pszCompress =
+                    poOvrDS ? poOvrDS->GetMetadataItem("COMPRESSION",
+                                                       "IMAGE_STRUCTURE")
+                            : nullptr;
+                if (pszCompress &&
+                    (EQUAL(pszCompress, "JPEG") ||
+                     EQUAL(pszCompress, "YCbCr JPEG") ||
+                     EQUAL(pszCompress, "WEBP") ||
+                     STARTS_WITH_CI(pszCompress, "LERC") ||
+                     EQUAL(pszCompress, "JXL")))
+                {
+                    bCanKeepLevel = false;
+                }
+            }
+            if (bCanKeepLevel)
+            {
+                try
+                {
+                    aabyCurLevel.resize(nBands);
+                    for (auto &abyLevel : aabyCurLevel)
+                    {
+                        abyLevel.resize(static_cast<size_t>(nDstTotalWidth) *
+                                        nDstTotalHeight * nDataTypeSize);
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    aabyCurLevel.clear();
+                }
+            }
+        }
+
         // Structure describing a resampling job
         struct OvrJob
         {
@@ -5230,6 +5522,10 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             GDALDataType eSrcDataType = GDT_Unknown;
             bool bPropagateNoData = false;
 
+            // Copy of the overview level to update, or nullptr
+            GByte *pabyLevel = nullptr;
+            int nLevelWidth = 0;
+
             // Output values of resampling function
             CPLErr eErr = CE_Failure;
             void *pDstBuffer = nullptr;
@@ -5268,13 +5564,33 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         // Function to write resample data to target band
         const auto WriteJobData = [](const OvrJob *poJob)
         {
-            return poJob->poOverview->RasterIO(
-                GF_Write, poJob->nDstXOff, poJob->nDstYOff,
-                poJob->nDstXOff2 - poJob->nDstXOff,
-                poJob->nDstYOff2 - poJob->nDstYOff, poJob->pDstBuffer,
-                poJob->nDstXOff2 - poJob->nDstXOff,
-                poJob->nDstYOff2 - poJob->nDstYOff, poJob->eDstBufferDataType,
+            const int nXCount = poJob->nDstXOff2 - poJob->nDstXOff;
+            const int nYCount = poJob->nDstYOff2 - poJob->nDstYOff;
+            const CPLErr l_eErr = poJob->poOverview->RasterIO(
+                GF_Write, poJob->nDstXOff, poJob->nDstYOff, nXCount, nYCount,
+                poJob->pDstBuffer, nXCount, nYCount, poJob->eDstBufferDataType,
                 0, 0, nullptr);
+            if (l_eErr == CE_None && poJob->pabyLevel)
+            {
+                const int nSrcDTSize =
+                    GDALGetDataTypeSizeBytes(poJob->eDstBufferDataType);
+                const int nDstDTSize =
+                    GDALGetDataTypeSizeBytes(poJob->eSrcDataType);
+                for (int iY = 0; iY < nYCount; ++iY)
+                {
+                    GDALCopyWords64(
+                        static_cast<const GByte *>(poJob->pDstBuffer) +
+                            static_cast<size_t>(iY) * nXCount * nSrcDTSize,
+                        poJob->eDstBufferDataType, nSrcDTSize,
+                        poJob->pabyLevel +
+                            (static_cast<size_t>(poJob->nDstYOff + iY) *
+                                 poJob->nLevelWidth +
+                             poJob->nDstXOff) *
+                                nDstDTSize,
+                        poJob->eSrcDataType, nDstDTSize, nXCount);
+                }
+            }
+            return l_eErr;
         };
 
         // Wait for completion of oldest job and serialize it
@@ -5444,6 +5760,28 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                 // Read the source buffers for all the bands.
                 for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
                 {
+                    if (!aabySrcLevel.empty())
+                    {
+                        const int nWrkDTSize =
+                            GDALGetDataTypeSizeBytes(eWrkDataType);
+                        for (int iY = 0; iY < nChunkYSizeQueried; ++iY)
+                        {
+                            GDALCopyWords64(
+                                aabySrcLevel[iBand].data() +
+                                    (static_cast<size_t>(nChunkYOffQueried +
+                                                         iY) *
+                                         nSrcWidth +
+                                     nChunkXOffQueried) *
+                                        nDataTypeSize,
+                                eDataType, nDataTypeSize,
+                                static_cast<GByte *>(apaChunk[iBand]) +
+                                    static_cast<size_t>(iY) *
+                                        nChunkXSizeQueried * nWrkDTSize,
+                                eWrkDataType, nWrkDTSize, nChunkXSizeQueried);
+                        }
+                        continue;
+                    }
+
                     GDALRasterBand *poSrcBand = nullptr;
                     if (iSrcOverview == -1)
                         poSrcBand = papoSrcBands[iBand];
@@ -5492,6 +5830,11 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                     poJob->dfNoDataValue = padfNoDataValue[iBand];
                     poJob->eSrcDataType = eDataType;
                     poJob->bPropagateNoData = bPropagateNoData;
+                    if (!aabyCurLevel.empty())
+                    {
+                        poJob->pabyLevel = aabyCurLevel[iBand].data();
+                        poJob->nLevelWidth = nDstTotalWidth;
+                    }
 
                     if (poJobQueue)
                     {
@@ -5535,6 +5878,8 @@ CPLErr GDALRegenerateOverviewsMultiBand(
 
             CPLFree(apabyChunkNoDataMask[iBand]);
         }
+
+        aabyPrevLevel = std::move(aabyCurLevel);
     }
 
     CPLFree(pabHasNoData);
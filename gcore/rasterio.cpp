@@ -41,20 +41,27 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
+#include "rasterio_avx2.h"
 #include "vrtdataset.h"
 
 static void GDALFastCopyByte(const GByte *CPL_RESTRICT pSrcData,
@@ -388,10 +395,11 @@ CPLErr GDALRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
+    static CPLCachedBoolConfigOption gbNoCostlyOverview(
+        "GDAL_NO_COSTLY_OVERVIEW", false);
     if (eRWFlag == GF_Read && nBufXSize < nXSize / 100 &&
         nBufYSize < nYSize / 100 && nPixelSpace == nBufDataSize &&
-        nLineSpace == nPixelSpace * nBufXSize &&
-        CPLTestBool(CPLGetConfigOption("GDAL_NO_COSTLY_OVERVIEW", "NO")))
+        nLineSpace == nPixelSpace * nBufXSize && gbNoCostlyOverview.Get())
     {
         memset(pData, 0, static_cast<size_t>(nLineSpace * nBufYSize));
         return CE_None;
@@ -1223,6 +1231,25 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (!bHasNoData)
             dfNoDataValue = 0.0;
 
+        // When GDAL_NUM_THREADS is set, chunks are resampled in worker
+        // threads, while the next ones are being read.
+        const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const GDALThreadReservation oThreadReservation(
+            std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                          ? CPLGetNumCPUs()
+                                          : atoi(pszThreads))));
+        const int nThreads = oThreadReservation.GetThreadCount();
+        auto poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
+
+        // Use smaller chunks when multithreading, so that all threads get
+        // some work even for small requests.
+        const GIntBig nMaxChunkPixels =
+            poJobQueue ? std::max(64 * 1024, 1024 * 1024 / nThreads)
+                       : 1024 * 1024;
+
         int nDstBlockXSize = nBufXSize;
         int nDstBlockYSize = nBufYSize;
         int nFullResXChunk = 0;
@@ -1239,7 +1266,7 @@ CPLErr GDALRasterBand::RasterIOResampled(
                 nFullResYChunk = nRasterYSize;
             if ((nDstBlockXSize == 1 && nDstBlockYSize == 1) ||
                 (static_cast<GIntBig>(nFullResXChunk) * nFullResYChunk <=
-                 1024 * 1024))
+                 nMaxChunkPixels))
                 break;
             // When operating on the full width of a raster whose block width is
             // the raster width, prefer doing chunks in height.
@@ -1270,29 +1297,154 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
-        void *pChunk =
-            VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
-                                nFullResXSizeQueried, nFullResYSizeQueried);
-        GByte *pabyChunkNoDataMask = nullptr;
-
         GDALRasterBand *poMaskBand = GetMaskBand();
         int l_nMaskFlags = GetMaskFlags();
 
         bool bUseNoDataMask = ((l_nMaskFlags & GMF_ALL_VALID) == 0);
-        if (bUseNoDataMask)
+
+        // Resampling of a chunk, and copy of the result into the output
+        // buffer. Jobs write to disjoint areas of the output buffer.
+        struct ResampleJob
         {
-            pabyChunkNoDataMask = static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                nFullResXSizeQueried, nFullResYSizeQueried));
-        }
-        if (pChunk == nullptr ||
-            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
+            // Parameters common to all jobs
+            GDALResampleFunction pfnResampleFunc = nullptr;
+            double dfXRatioDstToSrc = 0;
+            double dfYRatioDstToSrc = 0;
+            double dfSrcXDelta = 0;
+            double dfSrcYDelta = 0;
+            GDALDataType eWrkDataType = GDT_Unknown;
+            GDALRasterBand *poMEMBand = nullptr;
+            const char *pszResampling = nullptr;
+            bool bHasNoData = false;
+            double dfNoDataValue = 0;
+            GDALColorTable *poColorTable = nullptr;
+            GDALDataType eSrcDataType = GDT_Unknown;
+            GByte *pabyDstData = nullptr;
+            GDALDataType eDstDataType = GDT_Unknown;
+            GSpacing nDstPixelSpace = 0;
+            GSpacing nDstLineSpace = 0;
+
+            // Chunk specific parameters
+            void *pChunk = nullptr;
+            GByte *pabyChunkNoDataMask = nullptr;
+            bool bNoDataMaskFullyOpaque = false;
+            int nChunkXOff = 0;
+            int nChunkXSize = 0;
+            int nChunkYOff = 0;
+            int nChunkYSize = 0;
+            int nDstXOff = 0;
+            int nDstXOff2 = 0;
+            int nDstYOff = 0;
+            int nDstYOff2 = 0;
+            // Whether the input buffers can be released once resampled
+            bool bReleaseChunkAfterRun = false;
+
+            CPLErr eErr = CE_None;
+
+            ResampleJob() = default;
+            ResampleJob(const ResampleJob &) = default;
+            ResampleJob &operator=(const ResampleJob &) = delete;
+
+            ~ResampleJob()
+            {
+                CPLFree(pChunk);
+                CPLFree(pabyChunkNoDataMask);
+            }
+
+            static void Run(void *pData)
+            {
+                auto psJob = static_cast<ResampleJob *>(pData);
+                void *pDstBuffer = nullptr;
+                GDALDataType eDstBufferDataType = GDT_Unknown;
+                const bool bPropagateNoData = false;
+                psJob->eErr = psJob->pfnResampleFunc(
+                    psJob->dfXRatioDstToSrc, psJob->dfYRatioDstToSrc,
+                    psJob->dfSrcXDelta, psJob->dfSrcYDelta,
+                    psJob->eWrkDataType, psJob->pChunk,
+                    psJob->bNoDataMaskFullyOpaque
+                        ? nullptr
+                        : psJob->pabyChunkNoDataMask,
+                    psJob->nChunkXOff, psJob->nChunkXSize, psJob->nChunkYOff,
+                    psJob->nChunkYSize, psJob->nDstXOff, psJob->nDstXOff2,
+                    psJob->nDstYOff, psJob->nDstYOff2, psJob->poMEMBand,
+                    &pDstBuffer, &eDstBufferDataType, psJob->pszResampling,
+                    psJob->bHasNoData, psJob->dfNoDataValue,
+                    psJob->poColorTable, psJob->eSrcDataType,
+                    bPropagateNoData);
+                if (psJob->eErr == CE_None)
+                {
+                    // Equivalent to a RasterIO() write in the MEM band, but
+                    // safe to run concurrently.
+                    const int nDstXCount = psJob->nDstXOff2 - psJob->nDstXOff;
+                    const size_t nDstBufferLineSize =
+                        static_cast<size_t>(nDstXCount) *
+                        GDALGetDataTypeSizeBytes(eDstBufferDataType);
+                    for (int iY = psJob->nDstYOff; iY < psJob->nDstYOff2; ++iY)
+                    {
+                        GDALCopyWords64(
+                            static_cast<const GByte *>(pDstBuffer) +
+                                (iY - psJob->nDstYOff) * nDstBufferLineSize,
+                            eDstBufferDataType,
+                            GDALGetDataTypeSizeBytes(eDstBufferDataType),
+                            psJob->pabyDstData + iY * psJob->nDstLineSpace +
+                                psJob->nDstXOff * psJob->nDstPixelSpace,
+                            psJob->eDstDataType,
+                            static_cast<int>(psJob->nDstPixelSpace),
+                            nDstXCount);
+                    }
+                }
+                CPLFree(pDstBuffer);
+                if (psJob->bReleaseChunkAfterRun)
+                {
+                    CPLFree(psJob->pChunk);
+                    psJob->pChunk = nullptr;
+                    CPLFree(psJob->pabyChunkNoDataMask);
+                    psJob->pabyChunkNoDataMask = nullptr;
+                }
+            }
+        };
+
+        ResampleJob oJobTemplate;
+        oJobTemplate.pfnResampleFunc = pfnResampleFunc;
+        oJobTemplate.dfXRatioDstToSrc = dfXRatioDstToSrc;
+        oJobTemplate.dfYRatioDstToSrc = dfYRatioDstToSrc;
+        oJobTemplate.dfSrcXDelta = dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
+        oJobTemplate.dfSrcYDelta = dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
+        oJobTemplate.eWrkDataType = eWrkDataType;
+        oJobTemplate.poMEMBand = GDALRasterBand::FromHandle(hMEMBand);
+        oJobTemplate.pszResampling = pszResampling;
+        oJobTemplate.bHasNoData = bHasNoData;
+        oJobTemplate.dfNoDataValue = dfNoDataValue;
+        oJobTemplate.poColorTable = GetColorTable();
+        oJobTemplate.eSrcDataType = eDataType;
+        oJobTemplate.pabyDstData = pabyData;
+        oJobTemplate.eDstDataType = eDTMem;
+        oJobTemplate.nDstPixelSpace = nPSMem;
+        oJobTemplate.nDstLineSpace = nLSMem;
+
+        const auto AllocateBuffers = [&](ResampleJob &oJob)
+        {
+            oJob.pChunk =
+                VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
+                                    nFullResXSizeQueried, nFullResYSizeQueried);
+            if (bUseNoDataMask)
+            {
+                oJob.pabyChunkNoDataMask = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nFullResXSizeQueried,
+                                        nFullResYSizeQueried));
+            }
+            return oJob.pChunk != nullptr &&
+                   (!bUseNoDataMask || oJob.pabyChunkNoDataMask != nullptr);
+        };
+        // Without multithreading, the same buffers are used for all chunks.
+        ResampleJob oSerialJob(oJobTemplate);
+        if (!poJobQueue && !AllocateBuffers(oSerialJob))
         {
             GDALClose(poMEMDS);
-            CPLFree(pChunk);
-            CPLFree(pabyChunkNoDataMask);
             VSIFree(pTempBuffer);
             return CE_Failure;
         }
+        std::vector<std::unique_ptr<ResampleJob>> apoJobs;
 
         int nTotalBlocks = ((nBufXSize + nDstBlockXSize - 1) / nDstBlockXSize) *
                            ((nBufYSize + nDstBlockYSize - 1) / nDstBlockYSize);
@@ -1363,6 +1515,24 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
                 CPLAssert(nChunkXSizeQueried <= nFullResXSizeQueried);
 
+                ResampleJob *psJob = &oSerialJob;
+                if (poJobQueue)
+                {
+                    // Bound the number of chunks held in memory
+                    poJobQueue->WaitCompletion(nThreads);
+                    apoJobs.push_back(
+                        std::make_unique<ResampleJob>(oJobTemplate));
+                    psJob = apoJobs.back().get();
+                    psJob->bReleaseChunkAfterRun = true;
+                    if (!AllocateBuffers(*psJob))
+                    {
+                        eErr = CE_Failure;
+                        break;
+                    }
+                }
+                void *pChunk = psJob->pChunk;
+                GByte *pabyChunkNoDataMask = psJob->pabyChunkNoDataMask;
+
                 // Read the source buffers.
                 eErr = RasterIO(GF_Read, nChunkXOffQueried, nChunkYOffQueried,
                                 nChunkXSizeQueried, nChunkYSizeQueried, pChunk,
@@ -1412,36 +1582,27 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
                 if (!bSkipResample && eErr == CE_None)
                 {
-                    const bool bPropagateNoData = false;
-                    void *pDstBuffer = nullptr;
-                    GDALDataType eDstBufferDataType = GDT_Unknown;
-                    GDALRasterBand *poMEMBand =
-                        GDALRasterBand::FromHandle(hMEMBand);
-                    eErr = pfnResampleFunc(
-                        dfXRatioDstToSrc, dfYRatioDstToSrc,
-                        dfXOff - nXOff, /* == 0 if bHasXOffVirtual */
-                        dfYOff - nYOff, /* == 0 if bHasYOffVirtual */
-                        eWrkDataType, pChunk,
-                        bNoDataMaskFullyOpaque ? nullptr : pabyChunkNoDataMask,
-                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff),
-                        nChunkXSizeQueried,
-                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff),
-                        nChunkYSizeQueried, nDstXOff + nDestXOffVirtual,
-                        nDstXOff + nDestXOffVirtual + nDstXCount,
-                        nDstYOff + nDestYOffVirtual,
-                        nDstYOff + nDestYOffVirtual + nDstYCount, poMEMBand,
-                        &pDstBuffer, &eDstBufferDataType, pszResampling,
-                        bHasNoData, dfNoDataValue, GetColorTable(), eDataType,
-                        bPropagateNoData);
-                    if (eErr == CE_None)
+                    psJob->bNoDataMaskFullyOpaque = bNoDataMaskFullyOpaque;
+                    psJob->nChunkXOff =
+                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
+                    psJob->nChunkXSize = nChunkXSizeQueried;
+                    psJob->nChunkYOff =
+                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
+                    psJob->nChunkYSize = nChunkYSizeQueried;
+                    psJob->nDstXOff = nDstXOff + nDestXOffVirtual;
+                    psJob->nDstXOff2 = nDstXOff + nDestXOffVirtual + nDstXCount;
+                    psJob->nDstYOff = nDstYOff + nDestYOffVirtual;
+                    psJob->nDstYOff2 = nDstYOff + nDestYOffVirtual + nDstYCount;
+                    if (poJobQueue)
+                    {
+                        if (!poJobQueue->SubmitJob(ResampleJob::Run, psJob))
+                            eErr = CE_Failure;
+                    }
+                    else
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        ResampleJob::Run(psJob);
+                        eErr = psJob->eErr;
                     }
-                    CPLFree(pDstBuffer);
                 }
 
                 nBlocksDone++;
@@ -1454,8 +1615,15 @@ CPLErr GDALRasterBand::RasterIOResampled(
             }
         }
 
-        CPLFree(pChunk);
-        CPLFree(pabyChunkNoDataMask);
+        if (poJobQueue)
+        {
+            poJobQueue->WaitCompletion();
+            for (const auto &poJob : apoJobs)
+            {
+                if (eErr == CE_None)
+                    eErr = poJob->eErr;
+            }
+        }
     }
 
     if (eBufType != eDataType)
@@ -1959,6 +2127,46 @@ CPLErr GDALDataset::RasterIOResampled(GDALRWFlag /* eRWFlag */, int nXOff,
 
 //! @endcond
 
+#if defined(__x86_64) || defined(_M_X64)
+
+#include <emmintrin.h>
+
+/************************************************************************/
+/*                       GDALSwapPackedWordsSSE2()                      */
+/************************************************************************/
+
+// Byte swaps packed words 16 bytes at a time, and returns the number of
+// words processed. The remaining ones are left to the caller.
+template <int WORD_SIZE>
+static int GDALSwapPackedWordsSSE2(GByte *pabyData, int nWordCount)
+{
+    constexpr int WORDS_PER_VECTOR = 16 / WORD_SIZE;
+    int i = 0;
+    for (; i + WORDS_PER_VECTOR <= nWordCount; i += WORDS_PER_VECTOR)
+    {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pabyData));
+        // Swap the two bytes of each 16-bit lane...
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        // ... and then reverse the order of the 16-bit lanes of each word.
+        if constexpr (WORD_SIZE == 4)
+        {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else if constexpr (WORD_SIZE == 8)
+        {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData), v);
+        pabyData += 16;
+    }
+    return i;
+}
+
+#endif
+
 /************************************************************************/
 /*                           GDALSwapWords()                            */
 /************************************************************************/
@@ -1996,6 +2204,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 2:
             CPLAssert(nWordSkip >= 2 || nWordCount == 1);
+#if defined(__x86_64) || defined(_M_X64)
+            if (nWordSkip == 2)
+            {
+                const int nSwapped =
+                    GDALSwapPackedWordsSSE2<2>(pabyData, nWordCount);
+                pabyData += static_cast<size_t>(nSwapped) * 2;
+                nWordCount -= nSwapped;
+            }
+#endif
             for (int i = 0; i < nWordCount; i++)
             {
                 CPL_SWAP16PTR(pabyData);
@@ -2005,6 +2222,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 4:
             CPLAssert(nWordSkip >= 4 || nWordCount == 1);
+#if defined(__x86_64) || defined(_M_X64)
+            if (nWordSkip == 4)
+            {
+                const int nSwapped =
+                    GDALSwapPackedWordsSSE2<4>(pabyData, nWordCount);
+                pabyData += static_cast<size_t>(nSwapped) * 4;
+                nWordCount -= nSwapped;
+            }
+#endif
             if (CPL_IS_ALIGNED(pabyData, 4) && (nWordSkip % 4) == 0)
             {
                 for (int i = 0; i < nWordCount; i++)
@@ -2026,6 +2252,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 8:
             CPLAssert(nWordSkip >= 8 || nWordCount == 1);
+#if defined(__x86_64) || defined(_M_X64)
+            if (nWordSkip == 8)
+            {
+                const int nSwapped =
+                    GDALSwapPackedWordsSSE2<8>(pabyData, nWordCount);
+                pabyData += static_cast<size_t>(nSwapped) * 8;
+                nWordCount -= nSwapped;
+            }
+#endif
 #ifdef CPL_HAS_GINT64
             if (CPL_IS_ALIGNED(pabyData, 8) && (nWordSkip % 8) == 0)
             {
@@ -2210,6 +2445,11 @@ void GDALCopyWordsByteTo16Bit(const GByte *const CPL_RESTRICT pSrcData,
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
         decltype(nWordCount) n = 0;
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+        if (CPLHaveRuntimeAVX2())
+            n = GDALCopyByteToUInt16_AVX2(
+                pSrcData, reinterpret_cast<GUInt16 *>(pDstData), nWordCount);
+#endif
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
             reinterpret_cast<GByte *>(pDstData);
@@ -2328,6 +2568,10 @@ void GDALCopyWordsT(const GByte *const CPL_RESTRICT pSrcData,
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
         decltype(nWordCount) n = 0;
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+        if (CPLHaveRuntimeAVX2())
+            n = GDALCopyByteToFloat32_AVX2(pSrcData, pDstData, nWordCount);
+#endif
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
             reinterpret_cast<GByte *>(pDstData);
@@ -2447,6 +2691,10 @@ void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
         decltype(nWordCount) n = 0;
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+        if (CPLHaveRuntimeAVX2())
+            n = GDALCopyUInt16ToByte_AVX2(pSrcData, pDstData, nWordCount);
+#endif
         // In SSE2, min_epu16 does not exist, so shift from
         // UInt16 to SInt16 to be able to use min_epi16
         const __m128i xmm_UINT16_to_INT16 = _mm_set1_epi16(-32768);
@@ -2519,6 +2767,10 @@ void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
         decltype(nWordCount) n = 0;
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+        if (CPLHaveRuntimeAVX2())
+            n = GDALCopyUInt16ToFloat32_AVX2(pSrcData, pDstData, nWordCount);
+#endif
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
             reinterpret_cast<GByte *>(pDstData);
@@ -2606,6 +2858,26 @@ void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
                             nDstPixelStride, nWordCount);
 }
 
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+
+template <>
+void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, float *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) n = 0;
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)) &&
+        CPLHaveRuntimeAVX2())
+    {
+        n = GDALCopyFloat64ToFloat32_AVX2(pSrcData, pDstData, nWordCount);
+    }
+    GDALCopyWordsGenericT(pSrcData + n, nSrcPixelStride, pDstData + n,
+                          nDstPixelStride, nWordCount - n);
+}
+
+#endif
+
 #endif  // defined(__x86_64) || defined(_M_X64)
 
 template <>
@@ -2613,6 +2885,18 @@ void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GByte *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)) &&
+        CPLHaveRuntimeAVX2())
+    {
+        const auto n =
+            GDALCopyFloat32ToByte_AVX2(pSrcData, pDstData, nWordCount);
+        GDALCopyWordsT_8atatime(pSrcData + n, nSrcPixelStride, pDstData + n,
+                                nDstPixelStride, nWordCount - n);
+        return;
+    }
+#endif
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -2631,6 +2915,18 @@ void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
                     int nSrcPixelStride, GUInt16 *const CPL_RESTRICT pDstData,
                     int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)) &&
+        CPLHaveRuntimeAVX2())
+    {
+        const auto n =
+            GDALCopyFloat32ToUInt16_AVX2(pSrcData, pDstData, nWordCount);
+        GDALCopyWordsT_8atatime(pSrcData + n, nSrcPixelStride, pDstData + n,
+                                nDstPixelStride, nWordCount - n);
+        return;
+    }
+#endif
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -3151,6 +3447,69 @@ void GDALUnrolledCopy<GByte, 4, 1>(GByte *CPL_RESTRICT pDest,
         pSrc += 4;
     }
 }
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+// vld2q_u8(), vld3q_u8() and vld4q_u8() load 16 interleaved values, that is
+// up to 3 bytes after the last value of interest, hence the checks against
+// nIters - 16.
+
+template <>
+void GDALUnrolledCopy<GByte, 2, 1>(GByte *CPL_RESTRICT pDest,
+                                   const GByte *CPL_RESTRICT pSrc,
+                                   GPtrDiff_t nIters)
+{
+    decltype(nIters) i = 0;
+    for (; i + 16 < nIters; i += 16)
+    {
+        vst1q_u8(pDest + i, vld2q_u8(pSrc).val[0]);
+        pSrc += 2 * 16;
+    }
+    for (; i < nIters; i++)
+    {
+        pDest[i] = *pSrc;
+        pSrc += 2;
+    }
+}
+
+template <>
+void GDALUnrolledCopy<GByte, 3, 1>(GByte *CPL_RESTRICT pDest,
+                                   const GByte *CPL_RESTRICT pSrc,
+                                   GPtrDiff_t nIters)
+{
+    decltype(nIters) i = 0;
+    for (; i + 16 < nIters; i += 16)
+    {
+        vst1q_u8(pDest + i, vld3q_u8(pSrc).val[0]);
+        pSrc += 3 * 16;
+    }
+    for (; i < nIters; i++)
+    {
+        pDest[i] = *pSrc;
+        pSrc += 3;
+    }
+}
+
+template <>
+void GDALUnrolledCopy<GByte, 4, 1>(GByte *CPL_RESTRICT pDest,
+                                   const GByte *CPL_RESTRICT pSrc,
+                                   GPtrDiff_t nIters)
+{
+    decltype(nIters) i = 0;
+    for (; i + 16 < nIters; i += 16)
+    {
+        vst1q_u8(pDest + i, vld4q_u8(pSrc).val[0]);
+        pSrc += 4 * 16;
+    }
+    for (; i < nIters; i++)
+    {
+        pDest[i] = *pSrc;
+        pSrc += 4;
+    }
+}
+
 #endif  // defined(__x86_64) || defined(_M_X64)
 
 /************************************************************************/
@@ -4538,6 +4897,248 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*                    GDALCopyWholeRasterPipeline                       */
+/************************************************************************/
+
+namespace
+{
+struct GDALCopyWholeRasterPipeline
+{
+    struct Swath
+    {
+        int nBand = 0;  // 0 means all bands
+        int iX = 0;
+        int iY = 0;
+        int nCols = 0;
+        int nLines = 0;
+    };
+
+    GDALDataset *poSrcDS = nullptr;
+    GDALDataType eDT = GDT_Unknown;
+    int nBandCount = 0;
+    bool bCheckHoles = false;
+    std::vector<Swath> asSwaths{};
+    std::vector<void *> apBuffers{};
+
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    size_t nRead = 0;
+    size_t nWritten = 0;
+    bool bStop = false;
+    CPLErr eReadErr = CE_None;
+    std::vector<bool> abHasData{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoReadErrors{};
+
+    static void ReaderFunc(void *pData);
+};
+
+/************************************************************************/
+/*                            ReaderFunc()                              */
+/************************************************************************/
+
+// Reads swaths into the ring of buffers, staying at most apBuffers.size()
+// swaths ahead of the writer.
+void GDALCopyWholeRasterPipeline::ReaderFunc(void *pData)
+{
+    auto psPipeline = static_cast<GDALCopyWholeRasterPipeline *>(pData);
+    const size_t nDepth = psPipeline->apBuffers.size();
+
+    CPLInstallErrorHandlerAccumulator(psPipeline->aoReadErrors);
+    CPLSetCurrentErrorHandlerCatchDebug(FALSE);
+    for (size_t i = 0; i < psPipeline->asSwaths.size(); ++i)
+    {
+        {
+            std::unique_lock oLock(psPipeline->oMutex);
+            psPipeline->oCV.wait(oLock,
+                                 [psPipeline, i, nDepth]
+                                 {
+                                     return psPipeline->bStop ||
+                                            i - psPipeline->nWritten < nDepth;
+                                 });
+            if (psPipeline->bStop)
+                break;
+        }
+
+        const Swath &sSwath = psPipeline->asSwaths[i];
+        int nBand = sSwath.nBand;
+
+        // As in the serial code path, holes are only checked per band.
+        int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
+        if (psPipeline->bCheckHoles && nBand != 0)
+        {
+            nStatus =
+                psPipeline->poSrcDS->GetRasterBand(nBand)
+                    ->GetDataCoverageStatus(sSwath.iX, sSwath.iY, sSwath.nCols,
+                                            sSwath.nLines,
+                                            GDAL_DATA_COVERAGE_STATUS_DATA);
+        }
+        const bool bHasData = (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA) != 0;
+
+        CPLErr eErr = CE_None;
+        if (bHasData)
+        {
+            eErr = psPipeline->poSrcDS->RasterIO(
+                GF_Read, sSwath.iX, sSwath.iY, sSwath.nCols, sSwath.nLines,
+                psPipeline->apBuffers[i % nDepth], sSwath.nCols, sSwath.nLines,
+                psPipeline->eDT, nBand == 0 ? psPipeline->nBandCount : 1,
+                nBand == 0 ? nullptr : &nBand, 0, 0, 0, nullptr);
+        }
+
+        std::lock_guard oLock(psPipeline->oMutex);
+        psPipeline->abHasData[i] = bHasData;
+        psPipeline->eReadErr = eErr;
+        psPipeline->nRead = i + 1;
+        psPipeline->oCV.notify_all();
+        if (eErr != CE_None)
+            break;
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                GDALDatasetCopyWholeRasterPipelined()                 */
+/************************************************************************/
+
+// Variant of the copy loops of GDALDatasetCopyWholeRaster() where a
+// dedicated thread reads the next swaths from the source while the calling
+// thread writes the current one, so that a slow source and a compressing
+// destination work concurrently. pSwathBuf is used as the first of the
+// nPipelineDepth buffers. bDone is set to false, and nothing is done, if the
+// pipeline cannot be set up.
+static CPLErr GDALDatasetCopyWholeRasterPipelined(
+    GDALDataset *poSrcDS, GDALDataset *poDstDS, GDALDataType eDT,
+    int nBandCount, bool bInterleave, bool bCheckHoles, int nSwathCols,
+    int nSwathLines, void *pSwathBuf, int nPipelineDepth,
+    GDALProgressFunc pfnProgress, void *pProgressData, bool &bDone)
+{
+    bDone = false;
+
+    const int nXSize = poDstDS->GetRasterXSize();
+    const int nYSize = poDstDS->GetRasterYSize();
+
+    GDALCopyWholeRasterPipeline sPipeline;
+    sPipeline.poSrcDS = poSrcDS;
+    sPipeline.eDT = eDT;
+    sPipeline.nBandCount = nBandCount;
+    sPipeline.bCheckHoles = bCheckHoles;
+
+    // Same traversal order as the serial code path.
+    const int nBandIterations = bInterleave ? 1 : nBandCount;
+    for (int iBand = 0; iBand < nBandIterations; iBand++)
+    {
+        for (int iY = 0; iY < nYSize; iY += nSwathLines)
+        {
+            for (int iX = 0; iX < nXSize; iX += nSwathCols)
+            {
+                GDALCopyWholeRasterPipeline::Swath sSwath;
+                sSwath.nBand = bInterleave ? 0 : iBand + 1;
+                sSwath.iX = iX;
+                sSwath.iY = iY;
+                sSwath.nCols = std::min(nSwathCols, nXSize - iX);
+                sSwath.nLines = std::min(nSwathLines, nYSize - iY);
+                sPipeline.asSwaths.push_back(sSwath);
+            }
+        }
+    }
+    sPipeline.abHasData.resize(sPipeline.asSwaths.size());
+
+    const size_t nBufferSize = static_cast<size_t>(nSwathCols) * nSwathLines *
+                               GDALGetDataTypeSizeBytes(eDT) *
+                               (bInterleave ? nBandCount : 1);
+    sPipeline.apBuffers.push_back(pSwathBuf);
+    for (int i = 1; i < nPipelineDepth; ++i)
+    {
+        void *pBuffer = VSI_MALLOC_VERBOSE(nBufferSize);
+        if (!pBuffer)
+            break;
+        sPipeline.apBuffers.push_back(pBuffer);
+    }
+    const auto FreeExtraBuffers = [&sPipeline]()
+    {
+        for (size_t i = 1; i < sPipeline.apBuffers.size(); ++i)
+            VSIFree(sPipeline.apBuffers[i]);
+    };
+    if (sPipeline.apBuffers.size() < 2)
+    {
+        FreeExtraBuffers();
+        return CE_None;
+    }
+
+    CPLJoinableThread *hThread = CPLCreateJoinableThread(
+        GDALCopyWholeRasterPipeline::ReaderFunc, &sPipeline);
+    if (!hThread)
+    {
+        FreeExtraBuffers();
+        return CE_None;
+    }
+    bDone = true;
+
+    CPLDebug("GDAL",
+             "GDALDatasetCopyWholeRaster(): pipelined copy with %d buffers",
+             static_cast<int>(sPipeline.apBuffers.size()));
+
+    const size_t nDepth = sPipeline.apBuffers.size();
+    const size_t nTotalSwaths = sPipeline.asSwaths.size();
+    CPLErr eErr = CE_None;
+    for (size_t i = 0; i < nTotalSwaths && eErr == CE_None; ++i)
+    {
+        bool bHasData = false;
+        {
+            std::unique_lock oLock(sPipeline.oMutex);
+            sPipeline.oCV.wait(oLock,
+                               [&sPipeline, i] { return sPipeline.nRead > i; });
+            if (sPipeline.eReadErr != CE_None)
+            {
+                eErr = sPipeline.eReadErr;
+                break;
+            }
+            bHasData = sPipeline.abHasData[i];
+        }
+
+        const auto &sSwath = sPipeline.asSwaths[i];
+        if (bHasData)
+        {
+            int nBand = sSwath.nBand;
+            eErr = poDstDS->RasterIO(
+                GF_Write, sSwath.iX, sSwath.iY, sSwath.nCols, sSwath.nLines,
+                sPipeline.apBuffers[i % nDepth], sSwath.nCols, sSwath.nLines,
+                eDT, nBand == 0 ? nBandCount : 1, nBand == 0 ? nullptr : &nBand,
+                0, 0, 0, nullptr);
+        }
+
+        {
+            std::lock_guard oLock(sPipeline.oMutex);
+            sPipeline.nWritten = i + 1;
+            sPipeline.oCV.notify_all();
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(static_cast<double>(i + 1) / nTotalSwaths, nullptr,
+                         pProgressData))
+        {
+            eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
+        }
+    }
+
+    {
+        std::lock_guard oLock(sPipeline.oMutex);
+        sPipeline.bStop = true;
+        sPipeline.oCV.notify_all();
+    }
+    CPLJoinThread(hThread);
+
+    for (const auto &oError : sPipeline.aoReadErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+
+    FreeExtraBuffers();
+    return eErr;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -4563,6 +5164,11 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * sizes to achieve best compression.</li> <li>"SKIP_HOLES=YES" to skip chunks
  * for which GDALGetDataCoverageStatus() returns GDAL_DATA_COVERAGE_STATUS_EMPTY
  * (GDAL &gt;= 2.2)</li>
+ * <li>"PIPELINE_DEPTH=n" with n &gt;= 2 to read the source from a dedicated
+ * thread, up to n swaths ahead of the writing of the destination. Each swath
+ * buffer is at most GDAL_SWATH_SIZE bytes. Defaults to the value of the
+ * GDAL_COPY_PIPELINE_DEPTH configuration option, or 1 (no pipelining).
+ * (GDAL &gt;= 3.10)</li>
  * </ul>
  * More options may be supported in the future.
  *
@@ -4705,7 +5311,25 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     const bool bCheckHoles =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
-    if (!bInterleave)
+    const int nPipelineDepth = std::min(
+        64,
+        atoi(CSLFetchNameValueDef(
+            papszOptions, "PIPELINE_DEPTH",
+            CPLGetConfigOption("GDAL_COPY_PIPELINE_DEPTH", "1"))));
+    bool bDone = false;
+    if (nPipelineDepth >= 2)
+    {
+        eErr = GDALDatasetCopyWholeRasterPipelined(
+            poSrcDS, poDstDS, eDT, nBandCount, bInterleave, bCheckHoles,
+            nSwathCols, nSwathLines, pSwathBuf, nPipelineDepth, pfnProgress,
+            pProgressData, bDone);
+    }
+
+    if (bDone)
+    {
+        // Done by GDALDatasetCopyWholeRasterPipelined()
+    }
+    else if (!bInterleave)
     {
         GDALRasterIOExtraArg sExtraArg;
         INIT_RASTERIO_EXTRA_ARG(sExtraArg);
@@ -5461,7 +6085,17 @@ static void GDALDeinterleave3Byte(const GByte *CPL_RESTRICT pabySrc,
                                   GByte *CPL_RESTRICT pabyDest1,
                                   GByte *CPL_RESTRICT pabyDest2, size_t nIters)
 {
-    for (size_t i = 0; i < nIters; ++i)
+    size_t i = 0;
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    for (; i + 15 < nIters; i += 16)
+    {
+        const uint8x16x3_t v = vld3q_u8(pabySrc + 3 * i);
+        vst1q_u8(pabyDest0 + i, v.val[0]);
+        vst1q_u8(pabyDest1 + i, v.val[1]);
+        vst1q_u8(pabyDest2 + i, v.val[2]);
+    }
+#endif
+    for (; i < nIters; ++i)
     {
         pabyDest0[i] = pabySrc[3 * i + 0];
         pabyDest1[i] = pabySrc[3 * i + 1];
@@ -5484,7 +6118,18 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
                                   GByte *CPL_RESTRICT pabyDest2,
                                   GByte *CPL_RESTRICT pabyDest3, size_t nIters)
 {
-    for (size_t i = 0; i < nIters; ++i)
+    size_t i = 0;
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    for (; i + 15 < nIters; i += 16)
+    {
+        const uint8x16x4_t v = vld4q_u8(pabySrc + 4 * i);
+        vst1q_u8(pabyDest0 + i, v.val[0]);
+        vst1q_u8(pabyDest1 + i, v.val[1]);
+        vst1q_u8(pabyDest2 + i, v.val[2]);
+        vst1q_u8(pabyDest3 + i, v.val[3]);
+    }
+#endif
+    for (; i < nIters; ++i)
     {
         pabyDest0[i] = pabySrc[4 * i + 0];
         pabyDest1[i] = pabySrc[4 * i + 1];
@@ -5608,3 +6253,119 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
                         ppDestBuffer[iComp], eDestDT, nDestDTSize, nIters);
     }
 }
+
+/************************************************************************/
+/*                         GDALApplyByteLUT()                           */
+/************************************************************************/
+
+/** Map Byte values through a 256-entry lookup table.
+
+    In pseudo-code
+    \verbatim
+    for(size_t i = 0; i < nCount; ++i)
+        pabyDst[i * nDstPixelStride] = pabyLUT[pabySrc[i]]
+    \endverbatim
+
+    When the destination is packed, 8 values are looked up per iteration
+    and written with a single 64-bit store.
+
+    @param pabySrc Source indices (nCount values).
+    @param pabyLUT Lookup table of 256 values.
+    @param pabyDst Destination buffer.
+    @param nDstPixelStride Offset in bytes between consecutive destination
+                           values.
+    @param nCount Number of values to process.
+    @since GDAL 3.10
+ */
+void GDALApplyByteLUT(const GByte *CPL_RESTRICT pabySrc,
+                      const GByte *CPL_RESTRICT pabyLUT,
+                      GByte *CPL_RESTRICT pabyDst, GPtrDiff_t nDstPixelStride,
+                      size_t nCount)
+{
+    size_t i = 0;
+    if (nDstPixelStride == 1)
+    {
+        // Shifts are identical for extraction and insertion, so this is
+        // independent of the host endianness.
+        for (; i + 8 <= nCount; i += 8)
+        {
+            uint64_t nIdx;
+            memcpy(&nIdx, pabySrc + i, sizeof(nIdx));
+            uint64_t nOut = 0;
+            for (int iShift = 0; iShift < 64; iShift += 8)
+            {
+                nOut |= static_cast<uint64_t>(
+                            pabyLUT[static_cast<GByte>(nIdx >> iShift)])
+                        << iShift;
+            }
+            memcpy(pabyDst + i, &nOut, sizeof(nOut));
+        }
+    }
+    for (; i < nCount; ++i)
+    {
+        pabyDst[i * nDstPixelStride] = pabyLUT[pabySrc[i]];
+    }
+}
+
+/************************************************************************/
+/*                       GDALExpandPaletteByte()                        */
+/************************************************************************/
+
+/** Expand Byte palette indices to per-component Byte buffers.
+
+    In pseudo-code
+    \verbatim
+    for(size_t i = 0; i < nCount; ++i)
+        for(int iComp = 0; iComp < nComponents; iComp++ )
+            papabyDst[iComp][i] = pabyColorTable[4 * pabySrc[i] + iComp]
+    \endverbatim
+
+    For 3 and 4 components, color entries are gathered as 32-bit words into
+    a pixel-interleaved chunk which is then split with GDALDeinterleave(),
+    which is SIMD accelerated.
+
+    @param pabySrc Source indices (nCount values).
+    @param pabyColorTable 256 color entries, each made of 4 consecutive
+                          bytes (c1, c2, c3, c4).
+    @param nComponents Number of components to output, between 1 and 4.
+    @param papabyDst Array of nComponents destination buffers, each of
+                     nCount values. papabyDst[0] may be equal to pabySrc, to
+                     expand in place.
+    @param nCount Number of values to process.
+    @since GDAL 3.10
+ */
+void GDALExpandPaletteByte(const GByte *pabySrc,
+                           const GByte *CPL_RESTRICT pabyColorTable,
+                           int nComponents, GByte *const *papabyDst,
+                           size_t nCount)
+{
+    CPLAssert(nComponents >= 1 && nComponents <= 4);
+    if (nComponents < 3)
+    {
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            const GByte *pabyEntry = pabyColorTable + 4 * pabySrc[i];
+            for (int iComp = 0; iComp < nComponents; ++iComp)
+                papabyDst[iComp][i] = pabyEntry[iComp];
+        }
+        return;
+    }
+
+    constexpr size_t CHUNK_SIZE = 1024;
+    GUInt32 anInterleaved[CHUNK_SIZE];
+    GByte abyDummy[CHUNK_SIZE];
+    for (size_t iStart = 0; iStart < nCount; iStart += CHUNK_SIZE)
+    {
+        const size_t nChunk = std::min(CHUNK_SIZE, nCount - iStart);
+        for (size_t i = 0; i < nChunk; ++i)
+        {
+            memcpy(&anInterleaved[i], pabyColorTable + 4 * pabySrc[iStart + i],
+                   sizeof(GUInt32));
+        }
+        void *apDst[4] = {papabyDst[0] + iStart, papabyDst[1] + iStart,
+                          papabyDst[2] + iStart,
+                          nComponents == 4 ? papabyDst[3] + iStart
+                                           : static_cast<GByte *>(abyDummy)};
+        GDALDeinterleave(anInterleaved, GDT_Byte, 4, apDst, GDT_Byte, nChunk);
+    }
+}
@@ -0,0 +1,240 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#include "rasterio_avx2.h"
+
+#include <immintrin.h>
+
+// Do not include gdal_priv_templates.hpp, or any header with inline
+// functions that could be compiled here with AVX2 instructions and be
+// selected by the linker for use by other compilation units.
+
+/************************************************************************/
+/*                     GDALCopyFloat32ToByte_AVX2()                     */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyFloat32ToByte_AVX2(const float *CPL_RESTRICT pSrc,
+                                      GByte *CPL_RESTRICT pDst,
+                                      GPtrDiff_t nWordCount)
+{
+    // Same rounding and clamping as GDALCopy4Words(const float*, GByte*):
+    // max() with 0.5 (and not 0) also maps NaN to 0.
+    const __m256 p0d5 = _mm256_set1_ps(0.5f);
+    const __m256 ymm_max = _mm256_set1_ps(255);
+    const __m256i ymm_permute = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    GPtrDiff_t n = 0;
+    for (; n + 31 < nWordCount; n += 32)
+    {
+        __m256 ymm0 = _mm256_loadu_ps(pSrc + n);
+        __m256 ymm1 = _mm256_loadu_ps(pSrc + n + 8);
+        __m256 ymm2 = _mm256_loadu_ps(pSrc + n + 16);
+        __m256 ymm3 = _mm256_loadu_ps(pSrc + n + 24);
+        ymm0 = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(ymm0, p0d5), p0d5),
+                             ymm_max);
+        ymm1 = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(ymm1, p0d5), p0d5),
+                             ymm_max);
+        ymm2 = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(ymm2, p0d5), p0d5),
+                             ymm_max);
+        ymm3 = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(ymm3, p0d5), p0d5),
+                             ymm_max);
+        // Pack int32 to uint16, and then uint16 to uint8. Packing operates
+        // on each 128-bit lane, hence the final permutation.
+        const __m256i ymm01 = _mm256_packus_epi32(_mm256_cvttps_epi32(ymm0),
+                                                  _mm256_cvttps_epi32(ymm1));
+        const __m256i ymm23 = _mm256_packus_epi32(_mm256_cvttps_epi32(ymm2),
+                                                  _mm256_cvttps_epi32(ymm3));
+        const __m256i ymm = _mm256_permutevar8x32_epi32(
+            _mm256_packus_epi16(ymm01, ymm23), ymm_permute);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + n), ymm);
+    }
+    return n;
+}
+
+/************************************************************************/
+/*                    GDALCopyFloat32ToUInt16_AVX2()                    */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyFloat32ToUInt16_AVX2(const float *CPL_RESTRICT pSrc,
+                                        GUInt16 *CPL_RESTRICT pDst,
+                                        GPtrDiff_t nWordCount)
+{
+    const __m256 p0d5 = _mm256_set1_ps(0.5f);
+    const __m256 ymm_max = _mm256_set1_ps(65535);
+    GPtrDiff_t n = 0;
+    for (; n + 15 < nWordCount; n += 16)
+    {
+        __m256 ymm0 = _mm256_loadu_ps(pSrc + n);
+        __m256 ymm1 = _mm256_loadu_ps(pSrc + n + 8);
+        ymm0 = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(ymm0, p0d5), p0d5),
+                             ymm_max);
+        ymm1 = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(ymm1, p0d5), p0d5),
+                             ymm_max);
+        const __m256i ymm = _mm256_packus_epi32(_mm256_cvttps_epi32(ymm0),
+                                                _mm256_cvttps_epi32(ymm1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + n),
+                            _mm256_permute4x64_epi64(ymm, 0 | (2 << 2) |
+                                                              (1 << 4) |
+                                                              (3 << 6)));
+    }
+    return n;
+}
+
+/************************************************************************/
+/*                   GDALCopyFloat64ToFloat32_AVX2()                    */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyFloat64ToFloat32_AVX2(const double *CPL_RESTRICT pSrc,
+                                         float *CPL_RESTRICT pDst,
+                                         GPtrDiff_t nWordCount)
+{
+    // Values out of the float range are converted to infinity, as done by
+    // GDALCopyWord(double, float&), including those that would be rounded
+    // to +/- FLT_MAX by a plain conversion.
+    const __m256d ymm_posmax = _mm256_set1_pd(3.4028234663852886e+38);
+    const __m256d ymm_negmax = _mm256_set1_pd(-3.4028234663852886e+38);
+    const __m256d ymm_posinf =
+        _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FF0000000000000LL));
+    const __m256d ymm_neginf = _mm256_xor_pd(ymm_posinf, _mm256_set1_pd(-0.0));
+    GPtrDiff_t n = 0;
+    for (; n + 7 < nWordCount; n += 8)
+    {
+        __m256d ymm0 = _mm256_loadu_pd(pSrc + n);
+        __m256d ymm1 = _mm256_loadu_pd(pSrc + n + 4);
+        ymm0 = _mm256_blendv_pd(ymm0, ymm_posinf,
+                                _mm256_cmp_pd(ymm0, ymm_posmax, _CMP_GT_OQ));
+        ymm1 = _mm256_blendv_pd(ymm1, ymm_posinf,
+                                _mm256_cmp_pd(ymm1, ymm_posmax, _CMP_GT_OQ));
+        ymm0 = _mm256_blendv_pd(ymm0, ymm_neginf,
+                                _mm256_cmp_pd(ymm0, ymm_negmax, _CMP_LT_OQ));
+        ymm1 = _mm256_blendv_pd(ymm1, ymm_neginf,
+                                _mm256_cmp_pd(ymm1, ymm_negmax, _CMP_LT_OQ));
+        _mm_storeu_ps(pDst + n, _mm256_cvtpd_ps(ymm0));
+        _mm_storeu_ps(pDst + n + 4, _mm256_cvtpd_ps(ymm1));
+    }
+    return n;
+}
+
+/************************************************************************/
+/*                      GDALCopyUInt16ToByte_AVX2()                     */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyUInt16ToByte_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                     GByte *CPL_RESTRICT pDst,
+                                     GPtrDiff_t nWordCount)
+{
+    const __m256i ymm_255 = _mm256_set1_epi16(255);
+    GPtrDiff_t n = 0;
+    for (; n + 31 < nWordCount; n += 32)
+    {
+        __m256i ymm0 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pSrc + n));
+        __m256i ymm1 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(pSrc + n + 16));
+        ymm0 = _mm256_min_epu16(ymm0, ymm_255);
+        ymm1 = _mm256_min_epu16(ymm1, ymm_255);
+        const __m256i ymm = _mm256_packus_epi16(ymm0, ymm1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + n),
+                            _mm256_permute4x64_epi64(ymm, 0 | (2 << 2) |
+                                                              (1 << 4) |
+                                                              (3 << 6)));
+    }
+    return n;
+}
+
+/************************************************************************/
+/*                      GDALCopyByteToUInt16_AVX2()                     */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyByteToUInt16_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                     GUInt16 *CPL_RESTRICT pDst,
+                                     GPtrDiff_t nWordCount)
+{
+    GPtrDiff_t n = 0;
+    for (; n + 31 < nWordCount; n += 32)
+    {
+        const __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n));
+        const __m128i xmm1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n + 16));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + n),
+                            _mm256_cvtepu8_epi16(xmm0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + n + 16),
+                            _mm256_cvtepu8_epi16(xmm1));
+    }
+    return n;
+}
+
+/************************************************************************/
+/*                     GDALCopyByteToFloat32_AVX2()                     */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyByteToFloat32_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                      float *CPL_RESTRICT pDst,
+                                      GPtrDiff_t nWordCount)
+{
+    GPtrDiff_t n = 0;
+    for (; n + 15 < nWordCount; n += 16)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n));
+        const __m256i ymm0 = _mm256_cvtepu8_epi32(xmm);
+        const __m256i ymm1 = _mm256_cvtepu8_epi32(_mm_srli_si128(xmm, 8));
+        _mm256_storeu_ps(pDst + n, _mm256_cvtepi32_ps(ymm0));
+        _mm256_storeu_ps(pDst + n + 8, _mm256_cvtepi32_ps(ymm1));
+    }
+    return n;
+}
+
+/************************************************************************/
+/*                    GDALCopyUInt16ToFloat32_AVX2()                    */
+/************************************************************************/
+
+GPtrDiff_t GDALCopyUInt16ToFloat32_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                        float *CPL_RESTRICT pDst,
+                                        GPtrDiff_t nWordCount)
+{
+    GPtrDiff_t n = 0;
+    for (; n + 15 < nWordCount; n += 16)
+    {
+        const __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n));
+        const __m128i xmm1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n + 8));
+        _mm256_storeu_ps(pDst + n,
+                         _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(xmm0)));
+        _mm256_storeu_ps(pDst + n + 8,
+                         _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(xmm1)));
+    }
+    return n;
+}
+
+#endif
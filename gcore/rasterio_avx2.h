@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef RASTERIO_AVX2_H_INCLUDED
+#define RASTERIO_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+// The following functions convert packed arrays, and process an integral
+// number of AVX2 registers. They return the number of values converted, that
+// is nWordCount rounded down to a multiple of 8, 16 or 32, and let the caller
+// deal with the remaining values.
+
+GPtrDiff_t GDALCopyFloat32ToByte_AVX2(const float *CPL_RESTRICT pSrc,
+                                      GByte *CPL_RESTRICT pDst,
+                                      GPtrDiff_t nWordCount);
+
+GPtrDiff_t GDALCopyFloat32ToUInt16_AVX2(const float *CPL_RESTRICT pSrc,
+                                        GUInt16 *CPL_RESTRICT pDst,
+                                        GPtrDiff_t nWordCount);
+
+GPtrDiff_t GDALCopyFloat64ToFloat32_AVX2(const double *CPL_RESTRICT pSrc,
+                                         float *CPL_RESTRICT pDst,
+                                         GPtrDiff_t nWordCount);
+
+GPtrDiff_t GDALCopyUInt16ToByte_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                     GByte *CPL_RESTRICT pDst,
+                                     GPtrDiff_t nWordCount);
+
+GPtrDiff_t GDALCopyByteToUInt16_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                     GUInt16 *CPL_RESTRICT pDst,
+                                     GPtrDiff_t nWordCount);
+
+GPtrDiff_t GDALCopyByteToFloat32_AVX2(const GByte *CPL_RESTRICT pSrc,
+                                      float *CPL_RESTRICT pDst,
+                                      GPtrDiff_t nWordCount);
+
+GPtrDiff_t GDALCopyUInt16ToFloat32_AVX2(const GUInt16 *CPL_RESTRICT pSrc,
+                                        float *CPL_RESTRICT pDst,
+                                        GPtrDiff_t nWordCount);
+
+#endif
+
+#endif /* RASTERIO_AVX2_H_INCLUDED */
@@ -338,6 +338,8 @@ RawRasterBand::~RawRasterBand()
 
     RawRasterBand::FlushCache(true);
 
+    CPLVirtualMemFree(m_psReadOnlyMapping);
+
     if (bOwnsFP)
     {
         if (VSIFCloseL(fpRawL) != 0)
@@ -1012,6 +1014,13 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
         return FALSE;
     }
 
+    // Reading from a memory mapping of the file is always preferred to
+    // going through the block cache.
+    if (CanUseReadOnlyMapping())
+    {
+        return TRUE;
+    }
+
     RawDataset *rawDataset = dynamic_cast<RawDataset *>(this->GetDataset());
     int oldCachedCPLOneBigReadOption = 0;
     if (rawDataset != nullptr)
@@ -1059,6 +1068,136 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
     return result;
 }
 
+/************************************************************************/
+/*                       CanUseReadOnlyMapping()                        */
+/************************************************************************/
+
+// Returns whether reads can be served from a read-only memory mapping of the
+// band extent in the file, which is created on the first call if the
+// RAW_USE_MMAP configuration option is set.
+bool RawRasterBand::CanUseReadOnlyMapping()
+{
+    if (m_bReadOnlyMappingTried)
+        return m_psReadOnlyMapping != nullptr;
+    m_bReadOnlyMappingTried = true;
+
+    // Restricted to 64 bit builds, as mapping whole bands of large files
+    // would quickly exhaust the address space otherwise.
+    if (sizeof(void *) < 8 || eAccess != GA_ReadOnly || nPixelOffset <= 0 ||
+        nLineOffset <= 0 || !CPLIsVirtualMemFileMapAvailable() ||
+        VSIFGetNativeFileDescriptorL(fpRawL) == nullptr ||
+        !CPLTestBool(CPLGetConfigOption("RAW_USE_MMAP", "NO")))
+    {
+        return false;
+    }
+
+    const vsi_l_offset nSize =
+        static_cast<vsi_l_offset>(nRasterYSize - 1) * nLineOffset +
+        static_cast<vsi_l_offset>(nRasterXSize - 1) * nPixelOffset +
+        GDALGetDataTypeSizeBytes(eDataType);
+    {
+        // A truncated file is not an error at that point: the regular code
+        // path will deal with it.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        m_psReadOnlyMapping =
+            CPLVirtualMemFileMapNew(fpRawL, nImgOffset, nSize,
+                                    VIRTUALMEM_READONLY_ENFORCED, nullptr,
+                                    nullptr);
+    }
+    if (m_psReadOnlyMapping)
+        CPLDebug("RAW", "Band %d: reading from a memory mapping", nBand);
+    return m_psReadOnlyMapping != nullptr;
+}
+
+/************************************************************************/
+/*                          ReadFromMapping()                           */
+/************************************************************************/
+
+CPLErr RawRasterBand::ReadFromMapping(int nXOff, int nYOff, int nXSize,
+                                      int nYSize, void *pData, int nBufXSize,
+                                      int nBufYSize, GDALDataType eBufType,
+                                      GSpacing nPixelSpace, GSpacing nLineSpace,
+                                      GDALRasterIOExtraArg *psExtraArg)
+{
+    // Needed for ICC fast math approximations
+    constexpr double EPS = 1e-10;
+
+    GByte *const pabyMapping =
+        static_cast<GByte *>(CPLVirtualMemGetAddr(m_psReadOnlyMapping));
+    const size_t nBytesPerLine =
+        static_cast<size_t>(nPixelOffset) * (nXSize - 1) +
+        GDALGetDataTypeSizeBytes(eDataType);
+    GByte *const pabyFirstPixel =
+        pabyMapping + static_cast<size_t>(nYOff) * nLineOffset +
+        static_cast<size_t>(nXOff) * nPixelOffset;
+
+    // Full width requests are typical of scanline oriented processing:
+    // let the kernel read ahead the requested lines and evict them once
+    // consumed.
+    if (nXSize == nRasterXSize && nYSize == nBufYSize)
+    {
+        const size_t nExtent =
+            static_cast<size_t>(nYSize - 1) * nLineOffset + nBytesPerLine;
+        CPLVirtualMemAdvise(m_psReadOnlyMapping, pabyFirstPixel, nExtent,
+                            VIRTUALMEM_ADVICE_SEQUENTIAL);
+        CPLVirtualMemAdvise(m_psReadOnlyMapping, pabyFirstPixel, nExtent,
+                            VIRTUALMEM_ADVICE_WILLNEED);
+    }
+
+    // Data not in CPU order is swapped in a temporary line buffer.
+    GByte *pabySwapped = nullptr;
+    if (NeedsByteOrderChange())
+    {
+        pabySwapped = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nBytesPerLine));
+        if (pabySwapped == nullptr)
+            return CE_Failure;
+    }
+
+    const double dfSrcXInc = static_cast<double>(nXSize) / nBufXSize;
+    const double dfSrcYInc = static_cast<double>(nYSize) / nBufYSize;
+    for (int iLine = 0; iLine < nBufYSize; iLine++)
+    {
+        const size_t nLine = static_cast<size_t>(iLine * dfSrcYInc + EPS);
+        const GByte *pabySrc = pabyFirstPixel + nLine * nLineOffset;
+        if (pabySwapped)
+        {
+            memcpy(pabySwapped, pabySrc, nBytesPerLine);
+            DoByteSwap(pabySwapped, nXSize, nPixelOffset, true);
+            pabySrc = pabySwapped;
+        }
+
+        GByte *pabyDst = static_cast<GByte *>(pData) + iLine * nLineSpace;
+        if (nXSize == nBufXSize)
+        {
+            GDALCopyWords(pabySrc, eDataType, nPixelOffset, pabyDst, eBufType,
+                          static_cast<int>(nPixelSpace), nXSize);
+        }
+        else
+        {
+            for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
+            {
+                GDALCopyWords(
+                    pabySrc +
+                        static_cast<size_t>(iPixel * dfSrcXInc + EPS) *
+                            nPixelOffset,
+                    eDataType, nPixelOffset, pabyDst + iPixel * nPixelSpace,
+                    eBufType, static_cast<int>(nPixelSpace), 1);
+            }
+        }
+
+        if (psExtraArg->pfnProgress != nullptr &&
+            !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nBufYSize, "",
+                                     psExtraArg->pProgressData))
+        {
+            CPLFree(pabySwapped);
+            return CE_Failure;
+        }
+    }
+
+    CPLFree(pabySwapped);
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1121,6 +1260,13 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 return CE_None;
         }
 
+        if (CanUseReadOnlyMapping())
+        {
+            return ReadFromMapping(nXOff, nYOff, nXSize, nYSize, pData,
+                                   nBufXSize, nBufYSize, eBufType, nPixelSpace,
+                                   nLineSpace, psExtraArg);
+        }
+
         // 1. Simplest case when we should get contiguous block
         //    of uninterleaved pixels.
         if (nXSize == GetXSize() && nXSize == nBufXSize &&
@@ -122,6 +122,9 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
                                         // modified content that needs to
                                         // be pushed to disk
 
+    CPLVirtualMem *m_psReadOnlyMapping = nullptr;
+    bool m_bReadOnlyMappingTried = false;
+
     GDALColorTable *poCT{};
     GDALColorInterp eInterp = GCI_Undefined;
 
@@ -256,6 +259,12 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     vsi_l_offset ComputeFileOffset(int iLine) const;
     bool FlushCurrentLine(bool bNeedUsableBufferAfter);
     CPLErr BIPWriteBlock(int nBlockYOff, int nCallingBand, const void *pImage);
+    bool CanUseReadOnlyMapping();
+    CPLErr ReadFromMapping(int nXOff, int nYOff, int nXSize, int nYSize,
+                           void *pData, int nBufXSize, int nBufYSize,
+                           GDALDataType eBufType, GSpacing nPixelSpace,
+                           GSpacing nLineSpace,
+                           GDALRasterIOExtraArg *psExtraArg);
 };
 
 #ifdef GDAL_COMPILATION
@@ -31,6 +31,7 @@
 #include "gnmgraph.h"
 #include "gnm_priv.h"
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <set>
 
@@ -51,11 +52,13 @@ void GNMGraph::AddVertex(GNMGFID nFID)
     GNMStdVertex stVertex;
     stVertex.bIsBlocked = false;
     m_mstVertices[nFID] = std::move(stVertex);
+    m_bCSRGraphDirty = true;
 }
 
 void GNMGraph::DeleteVertex(GNMGFID nFID)
 {
     m_mstVertices.erase(nFID);
+    m_bCSRGraphDirty = true;
 
     // remove all edges with this vertex
     std::vector<GNMGFID> aoIdsToErase;
@@ -103,6 +106,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
     stEdge.bIsBlocked = false;
 
     m_mstEdges[nConFID] = stEdge;
+    m_bCSRGraphDirty = true;
 
     if (bIsBidir)
     {
@@ -117,16 +121,27 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
 
 void GNMGraph::DeleteEdge(GNMGFID nConFID)
 {
-    m_mstEdges.erase(nConFID);
+    auto ite = m_mstEdges.find(nConFID);
+    if (ite == m_mstEdges.end())
+        return;
 
-    // remove edge from all vertices anOutEdgeFIDs
-    for (auto &it : m_mstVertices)
+    // remove edge from the anOutEdgeFIDs of its vertices: no other vertex
+    // can reference it
+    for (GNMGFID nVertexFID :
+         {ite->second.nSrcVertexFID, ite->second.nTgtVertexFID})
     {
-        it.second.anOutEdgeFIDs.erase(
-            std::remove(it.second.anOutEdgeFIDs.begin(),
-                        it.second.anOutEdgeFIDs.end(), nConFID),
-            it.second.anOutEdgeFIDs.end());
+        auto itv = m_mstVertices.find(nVertexFID);
+        if (itv != m_mstVertices.end())
+        {
+            itv->second.anOutEdgeFIDs.erase(
+                std::remove(itv->second.anOutEdgeFIDs.begin(),
+                            itv->second.anOutEdgeFIDs.end(), nConFID),
+                itv->second.anOutEdgeFIDs.end());
+        }
     }
+
+    m_mstEdges.erase(ite);
+    m_bCSRGraphDirty = true;
 }
 
 void GNMGraph::ChangeEdge(GNMGFID nFID, double dfCost, double dfInvCost)
@@ -136,6 +151,7 @@ void GNMGraph::ChangeEdge(GNMGFID nFID, double dfCost, double dfInvCost)
     {
         it->second.dfDirCost = dfCost;
         it->second.dfInvCost = dfInvCost;
+        m_bCSRGraphDirty = true;
     }
 }
 
@@ -146,6 +162,7 @@ void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
     if (itv != m_mstVertices.end())
     {
         itv->second.bIsBlocked = bBlock;
+        m_bCSRGraphDirty = true;
         return;
     }
 
@@ -154,6 +171,7 @@ void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
     if (ite != m_mstEdges.end())
     {
         ite->second.bIsBlocked = bBlock;
+        m_bCSRGraphDirty = true;
     }
 }
 
@@ -179,6 +197,7 @@ void GNMGraph::ChangeAllBlockState(bool bBlock)
     {
         ite->second.bIsBlocked = bBlock;
     }
+    m_bCSRGraphDirty = true;
 }
 
 GNMPATH
@@ -241,7 +260,19 @@ GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID,
 
 GNMPATH GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID)
 {
-    return DijkstraShortestPath(nStartFID, nEndFID, m_mstEdges);
+    const GNMCSRGraph &oGraph = GetCSRGraph();
+    size_t nStart = 0;
+    size_t nEnd = 0;
+    if (!GetCSRVertexIndex(nStartFID, nStart) ||
+        !GetCSRVertexIndex(nEndFID, nEnd))
+    {
+        // The start vertex is always reached, even if it is not in the graph
+        GNMPATH aoPath;
+        if (nStartFID == nEndFID)
+            aoPath.push_back(std::make_pair(nStartFID, -1));
+        return aoPath;
+    }
+    return CSRShortestPath(nStart, nEnd, oGraph.adfOutCosts);
 }
 
 std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
@@ -268,35 +299,57 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
     if (aoFirstPath.empty())
         return A;  // return empty array if there is no path between points.
 
+    const GNMCSRGraph &oGraph = GetCSRGraph();
+    size_t nEnd = 0;
+    if (!GetCSRVertexIndex(nEndFID, nEnd))
+    {
+        A.push_back(aoFirstPath);
+        return A;
+    }
+
     A.push_back(aoFirstPath);
 
     size_t i, k, l;
     GNMPATH::iterator itAk, tempIt, itR;
     std::vector<GNMPATH>::iterator itA;
-    std::map<GNMGFID, double>::iterator itDel;
     GNMPATH aoRootPath, aoRootPathOther, aoSpurPath;
-    GNMGFID nSpurNode, nVertexToDel, nEdgeToDel;
+    size_t nSpurNode, nVertexToDel;
     double dfSumCost;
 
-    std::map<GNMGFID, GNMStdEdge> mstEdges = m_mstEdges;
+    // Costs of the CSR graph slots, and the slots whose cost has been
+    // temporarily set to infinity.
+    std::vector<double> adfCosts = oGraph.adfOutCosts;
+    std::vector<size_t> anDeletedSlots;
+    const auto DeleteEdge = [&oGraph, &adfCosts, &anDeletedSlots](GNMGFID nFID)
+    {
+        // A bidirectional edge has two slots
+        auto oRange = std::equal_range(
+            oGraph.aoEdgeSlots.begin(), oGraph.aoEdgeSlots.end(),
+            std::make_pair(nFID, size_t(0)),
+            [](const std::pair<GNMGFID, size_t> &a,
+               const std::pair<GNMGFID, size_t> &b)
+            { return a.first < b.first; });
+        for (auto it = oRange.first; it != oRange.second; ++it)
+        {
+            adfCosts[it->second] = std::numeric_limits<double>::infinity();
+            anDeletedSlots.push_back(it->second);
+        }
+    };
 
     for (k = 0; k < nK - 1; ++k)  // -1 because we have already found one
     {
-        std::map<GNMGFID, double>
-            mDeletedEdges;  // for infinity costs assignment
-        itAk = A[k].begin();
-
         for (i = 0; i < A[k].size() - 1; ++i)  // avoid end node
         {
             // Get the current node.
-            nSpurNode = A[k][i].first;
+            if (!GetCSRVertexIndex(A[k][i].first, nSpurNode))
+                continue;
 
             // Get the root path from the 0 to the current node.
 
             // Equivalent to A[k][i]
             // because we will use std::vector::assign, which assigns [..)
             // range, not [..]
-            ++itAk;
+            itAk = A[k].begin() + i + 1;
 
             aoRootPath.assign(A[k].begin(), itAk);
 
@@ -331,10 +384,7 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
                     (i < aoRootPathOther.size()))
                 {
                     tempIt = itA->begin() + i + 1;
-                    mDeletedEdges.insert(std::make_pair(
-                        tempIt->second, mstEdges[tempIt->second].dfDirCost));
-                    mstEdges[tempIt->second].dfDirCost =
-                        std::numeric_limits<double>::infinity();
+                    DeleteEdge(tempIt->second);
                 }
             }
 
@@ -347,33 +397,29 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
             // end()-1, because we should not remove the spur node
             for (itR = aoRootPath.begin(); itR != aoRootPath.end() - 1; ++itR)
             {
-                nVertexToDel = itR->first;
-                for (l = 0;
-                     l < m_mstVertices[nVertexToDel].anOutEdgeFIDs.size(); ++l)
+                if (!GetCSRVertexIndex(itR->first, nVertexToDel))
+                    continue;
+                for (l = oGraph.anOutOffsets[nVertexToDel];
+                     l < oGraph.anOutOffsets[nVertexToDel + 1]; ++l)
                 {
-                    nEdgeToDel = m_mstVertices[nVertexToDel].anOutEdgeFIDs[l];
-                    mDeletedEdges.insert(std::make_pair(
-                        nEdgeToDel, mstEdges[nEdgeToDel].dfDirCost));
-                    mstEdges[nEdgeToDel].dfDirCost =
-                        std::numeric_limits<double>::infinity();
+                    DeleteEdge(oGraph.anOutEdgeFIDs[l]);
                 }
             }
 
             // Find the new best path in the modified graph.
-            aoSpurPath = DijkstraShortestPath(nSpurNode, nEndFID, mstEdges);
+            aoSpurPath = CSRShortestPath(nSpurNode, nEnd, adfCosts);
 
             // Firstly, restore deleted edges in order to calculate the summary
             // cost of the path correctly later, because the costs will be
             // gathered from the initial graph.
             // We must do it here, after each edge removing, because the later
             // Dijkstra searches must consider these edges.
-            for (itDel = mDeletedEdges.begin(); itDel != mDeletedEdges.end();
-                 ++itDel)
+            for (size_t nSlot : anDeletedSlots)
             {
-                mstEdges[itDel->first].dfDirCost = itDel->second;
+                adfCosts[nSlot] = oGraph.adfOutCosts[nSlot];
             }
 
-            mDeletedEdges.clear();
+            anDeletedSlots.clear();
 
             // If the part of a new best path has been found we form a full one
             // and add it to the candidates array.
@@ -392,7 +438,9 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
                     // infinity, because every time we assign infinity costs for
                     // edges of old paths, we anyway have the alternative edges
                     // with non-infinity costs.
-                    dfSumCost += mstEdges[itR->second].dfDirCost;
+                    const auto ite = m_mstEdges.find(itR->second);
+                    if (ite != m_mstEdges.end())
+                        dfSumCost += ite->second.dfDirCost;
                 }
 
                 B.insert(std::make_pair(dfSumCost, aoRootPath));
@@ -452,6 +500,8 @@ void GNMGraph::Clear()
 {
     m_mstVertices.clear();
     m_mstEdges.clear();
+    m_oCSRGraph = GNMCSRGraph();
+    m_bCSRGraphDirty = true;
 }
 
 void GNMGraph::DijkstraShortestPathTree(
@@ -567,6 +617,140 @@ GNMGFID GNMGraph::GetOppositVertex(GNMGFID nEdgeFID, GNMGFID nVertexFID) const
     return -1;
 }
 
+const GNMGraph::GNMCSRGraph &GNMGraph::GetCSRGraph()
+{
+    if (!m_bCSRGraphDirty)
+        return m_oCSRGraph;
+
+    m_oCSRGraph = GNMCSRGraph();
+    GNMCSRGraph &oGraph = m_oCSRGraph;
+
+    // Vertices are iterated in FID order, so anVertexFIDs is sorted.
+    oGraph.anVertexFIDs.reserve(m_mstVertices.size());
+    oGraph.abVertexBlocked.reserve(m_mstVertices.size());
+    for (const auto &oVertex : m_mstVertices)
+    {
+        oGraph.anVertexFIDs.push_back(oVertex.first);
+        oGraph.abVertexBlocked.push_back(oVertex.second.bIsBlocked);
+    }
+
+    oGraph.anOutOffsets.reserve(m_mstVertices.size() + 1);
+    oGraph.anOutOffsets.push_back(0);
+    for (const auto &oVertex : m_mstVertices)
+    {
+        for (GNMGFID nEdgeFID : oVertex.second.anOutEdgeFIDs)
+        {
+            const auto ite = m_mstEdges.find(nEdgeFID);
+            if (ite == m_mstEdges.end())
+                continue;
+            const GNMStdEdge &stEdge = ite->second;
+            const GNMGFID nTargetFID = oVertex.first == stEdge.nSrcVertexFID
+                                           ? stEdge.nTgtVertexFID
+                                           : stEdge.nSrcVertexFID;
+            size_t nTarget = 0;
+            if (!GetCSRVertexIndex(nTargetFID, nTarget))
+                continue;
+
+            // We go in any edge from source to target so we take only
+            // direct cost (even if an edge is bi-directed).
+            oGraph.aoEdgeSlots.push_back(
+                std::make_pair(nEdgeFID, oGraph.anOutTargets.size()));
+            oGraph.anOutTargets.push_back(static_cast<std::uint32_t>(nTarget));
+            oGraph.anOutEdgeFIDs.push_back(nEdgeFID);
+            oGraph.adfOutCosts.push_back(
+                stEdge.bIsBlocked ? std::numeric_limits<double>::infinity()
+                                  : stEdge.dfDirCost);
+        }
+        oGraph.anOutOffsets.push_back(oGraph.anOutTargets.size());
+    }
+    std::sort(oGraph.aoEdgeSlots.begin(), oGraph.aoEdgeSlots.end());
+
+    m_bCSRGraphDirty = false;
+    return m_oCSRGraph;
+}
+
+bool GNMGraph::GetCSRVertexIndex(GNMGFID nFID, size_t &nIndex) const
+{
+    const auto &anVertexFIDs = m_oCSRGraph.anVertexFIDs;
+    const auto it =
+        std::lower_bound(anVertexFIDs.begin(), anVertexFIDs.end(), nFID);
+    if (it == anVertexFIDs.end() || *it != nFID)
+        return false;
+    nIndex = static_cast<size_t>(it - anVertexFIDs.begin());
+    return true;
+}
+
+GNMPATH GNMGraph::CSRShortestPath(size_t nStart, size_t nEnd,
+                                  const std::vector<double> &adfCosts) const
+{
+    const GNMCSRGraph &oGraph = m_oCSRGraph;
+    const size_t nVertices = oGraph.anVertexFIDs.size();
+    constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+    std::vector<double> adfMarks(nVertices,
+                                 std::numeric_limits<double>::infinity());
+    std::vector<size_t> anPathTreeSlots(nVertices, NO_SLOT);
+    std::vector<std::uint32_t> anPathTreeVertices(nVertices);
+    std::vector<bool> abSeen(nVertices, false);
+
+    // Binary heap of (mark, vertex). A vertex may be queued several times
+    // with decreasing marks: only its first extraction is considered.
+    typedef std::pair<double, std::uint32_t> MarkedVertex;
+    std::priority_queue<MarkedVertex, std::vector<MarkedVertex>,
+                        std::greater<MarkedVertex>>
+        oToSee;
+    adfMarks[nStart] = 0.0;
+    oToSee.push(MarkedVertex(0.0, static_cast<std::uint32_t>(nStart)));
+
+    while (!oToSee.empty())
+    {
+        const MarkedVertex oCurrent = oToSee.top();
+        oToSee.pop();
+        const size_t nCurrent = oCurrent.second;
+        if (abSeen[nCurrent])
+            continue;
+        abSeen[nCurrent] = true;
+
+        // The mark of the end vertex can no longer decrease.
+        if (nCurrent == nEnd)
+            break;
+
+        for (size_t nSlot = oGraph.anOutOffsets[nCurrent];
+             nSlot < oGraph.anOutOffsets[nCurrent + 1]; ++nSlot)
+        {
+            const size_t nTarget = oGraph.anOutTargets[nSlot];
+            const double dfNewVertexMark = oCurrent.first + adfCosts[nSlot];
+            if (!abSeen[nTarget] && dfNewVertexMark < adfMarks[nTarget] &&
+                !oGraph.abVertexBlocked[nTarget])
+            {
+                adfMarks[nTarget] = dfNewVertexMark;
+                anPathTreeSlots[nTarget] = nSlot;
+                anPathTreeVertices[nTarget] =
+                    static_cast<std::uint32_t>(nCurrent);
+                oToSee.push(MarkedVertex(dfNewVertexMark,
+                                         static_cast<std::uint32_t>(nTarget)));
+            }
+        }
+    }
+
+    GNMPATH aoShortestPath;
+    if (nEnd != nStart && anPathTreeSlots[nEnd] == NO_SLOT)
+        return aoShortestPath;
+
+    // Walk the tree from end point to start point.
+    for (size_t nVertex = nEnd; nVertex != nStart;
+         nVertex = anPathTreeVertices[nVertex])
+    {
+        aoShortestPath.push_back(
+            std::make_pair(oGraph.anVertexFIDs[nVertex],
+                           oGraph.anOutEdgeFIDs[anPathTreeSlots[nVertex]]));
+    }
+    aoShortestPath.push_back(
+        std::make_pair(oGraph.anVertexFIDs[nStart], GNMGFID(-1)));
+    std::reverse(aoShortestPath.begin(), aoShortestPath.end());
+    return aoShortestPath;
+}
+
 void GNMGraph::TraceTargets(std::queue<GNMGFID> &vertexQueue,
                             std::set<GNMGFID> &markedVertIds,
                             GNMPATH &connectedIds)
@@ -34,6 +34,7 @@
 
 #include "cpl_port.h"
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+#include <cstdint>
 #include <map>
 #include <queue>
 #include <set>
@@ -82,6 +83,9 @@ struct GNMStdVertex
  * GNMGraph class to receive the results in OGRLayer form.
  * NOTE: GNMGraph holds the whole graph in memory, so it can consume
  * a lot of memory if operating huge networks.
+ * The shortest path methods run on a compact (compressed sparse row) copy
+ * of the graph, which is built on first use after the graph has been
+ * modified.
  *
  * @since GDAL 2.1
  */
@@ -247,9 +251,32 @@ class CPL_DLL GNMGraph
                               std::set<GNMGFID> &markedVertIds,
                               GNMPATH &connectedIds);
 
+    /** Compressed sparse row form of the graph. Vertices are designated by
+     * their index in anVertexFIDs, and the outgoing edges of vertex i are the
+     * slots in the [anOutOffsets[i], anOutOffsets[i+1]) range. A
+     * bidirectional edge has one slot per direction. */
+    struct GNMCSRGraph
+    {
+        std::vector<GNMGFID> anVertexFIDs{};  // sorted
+        std::vector<bool> abVertexBlocked{};
+        std::vector<size_t> anOutOffsets{};
+        std::vector<std::uint32_t> anOutTargets{};
+        std::vector<GNMGFID> anOutEdgeFIDs{};
+        std::vector<double> adfOutCosts{};  // infinity if the edge is blocked
+        // Slots of each edge, sorted by edge FID
+        std::vector<std::pair<GNMGFID, size_t>> aoEdgeSlots{};
+    };
+
+    const GNMCSRGraph &GetCSRGraph();
+    bool GetCSRVertexIndex(GNMGFID nFID, size_t &nIndex) const;
+    GNMPATH CSRShortestPath(size_t nStart, size_t nEnd,
+                            const std::vector<double> &adfCosts) const;
+
   protected:
     std::map<GNMGFID, GNMStdVertex> m_mstVertices;
     std::map<GNMGFID, GNMStdEdge> m_mstEdges;
+    GNMCSRGraph m_oCSRGraph{};
+    bool m_bCSRGraphDirty = true;
     //! @endcond
 };
 
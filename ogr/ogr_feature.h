@@ -1227,6 +1227,7 @@ class CPL_DLL OGRFeature
     OGRErr SetGeomField(int iField, const OGRGeometry *);
 
     void Reset();
+    void SwapContent(OGRFeature &oOther);
 
     OGRFeature *Clone() const CPL_WARN_UNUSED_RESULT;
     virtual OGRBoolean Equal(const OGRFeature *poFeature) const;
@@ -1950,6 +1951,7 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+struct OGRFeatureQueryProgram;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1957,6 +1959,8 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    // Compiled form of pSWQExpr, when it only uses supported operations
+    std::unique_ptr<OGRFeatureQueryProgram> m_poProgram;
 
     char **FieldCollector(void *, char **);
 
@@ -41,6 +41,7 @@
 #include <climits>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 /**
  * \file ogr_geometry.h
@@ -4254,6 +4255,67 @@ class CPL_DLL OGRGeometryFactory
     static OGRCurve *
     curveFromLineString(const OGRLineString *poLS,
                         const char *const *papszOptions = nullptr);
+
+    /** Operation applied by processGeometries() and processWKBGeometries()
+     * @since GDAL 3.10
+     */
+    enum class BatchOperation
+    {
+        /** OGRGeometry::Buffer() */
+        BUFFER,
+        /** OGRGeometry::MakeValid() */
+        MAKE_VALID,
+        /** OGRGeometry::SimplifyPreserveTopology() */
+        SIMPLIFY_PRESERVE_TOPOLOGY,
+        /** OGRGeometry::Intersection() with a single other geometry */
+        INTERSECTION,
+    };
+
+    static std::vector<std::unique_ptr<OGRGeometry>>
+    processGeometries(BatchOperation eOperation,
+                      const OGRGeometry *const *papoGeoms, size_t nCount,
+                      const OGRGeometry *poOtherGeom = nullptr,
+                      CSLConstList papszOptions = nullptr);
+
+    static std::vector<std::vector<GByte>>
+    processWKBGeometries(BatchOperation eOperation,
+                         const GByte *const *papabyWKB,
+                         const size_t *panWKBSize, size_t nCount,
+                         const OGRGeometry *poOtherGeom = nullptr,
+                         CSLConstList papszOptions = nullptr);
+
+    static std::unique_ptr<OGRGeometry>
+    unionGeometries(const OGRGeometry *const *papoGeoms, size_t nCount,
+                    CSLConstList papszOptions = nullptr);
+};
+
+/** Computes the union of a stream of geometries, without holding all of
+ * them in memory.
+ *
+ * Geometries are unioned by batches with
+ * OGRGeometryFactory::unionGeometries().
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL OGRGeometryUnionAccumulator
+{
+  public:
+    explicit OGRGeometryUnionAccumulator(CSLConstList papszOptions = nullptr);
+    ~OGRGeometryUnionAccumulator();
+
+    bool AddGeometry(std::unique_ptr<OGRGeometry> poGeom);
+    std::unique_ptr<OGRGeometry> GetResult();
+
+  private:
+    const CPLStringList m_aosOptions;
+    const size_t m_nBatchSize;
+    std::vector<std::unique_ptr<OGRGeometry>> m_apoPending{};
+    // m_apoLevels[i], if not null, is the union of 2^i batches
+    std::vector<std::unique_ptr<OGRGeometry>> m_apoLevels{};
+
+    bool FlushPending();
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeometryUnionAccumulator)
 };
 
 OGRwkbGeometryType CPL_DLL OGRFromOGCGeomType(const char *pszGeomType);
@@ -1018,4 +1018,8 @@ OGRCoordinateTransformation CPL_DLL *OGRCreateCoordinateTransformation(
     const OGRSpatialReference *poSource, const OGRSpatialReference *poTarget,
     const OGRCoordinateTransformationOptions &options);
 
+OGRCoordinateTransformation CPL_DLL *
+OGRCreateThreadSafeCoordinateTransformation(OGRCoordinateTransformation *poCT,
+                                            int nThreads);
+
 #endif /* ndef OGR_SPATIALREF_H_INCLUDED */
@@ -30,6 +30,7 @@
 #include "ogr_wkb.h"
 #include "ogr_core.h"
 #include "ogr_geometry.h"
+#include "ogr_geos.h"
 #include "ogr_p.h"
 
 #include <algorithm>
@@ -39,6 +40,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #define USE_FAST_FLOAT
 #ifdef USE_FAST_FLOAT
@@ -1072,6 +1074,568 @@ void OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb, size_t nWKBSize)
         pabyWkb, nWKBSize, iOffsetInOut, /* nRec = */ 0);
 }
 
+/************************************************************************/
+/*                  OGRWKBVisitPointSequences()                         */
+/************************************************************************/
+
+// Walks through the point sequences of a linear geometry, calling pfnFunc
+// (if not null) on each of them. Returns false if the WKB is corrupted or
+// of an unsupported geometry type.
+static bool
+OGRWKBVisitPointSequences(const GByte *data, const size_t size,
+                          size_t &iOffsetInOut, const int nRec,
+                          const OGRWKBGeometryView::PointSequenceFunc *pfnFunc,
+                          bool &bStopOut)
+{
+    if (size - iOffsetInOut < MIN_WKB_SIZE)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[iOffsetInOut]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    const OGRwkbByteOrder eByteOrder = static_cast<OGRwkbByteOrder>(nByteOrder);
+
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(data + iOffsetInOut, wkbVariantIso,
+                               &eGeometryType) != OGRERR_NONE)
+        return false;
+    iOffsetInOut += WKB_PREFIX_SIZE;
+    const auto eFlatType = wkbFlatten(eGeometryType);
+
+    OGRWKBGeometryView::PointSequence oSeq;
+    oSeq.bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeometryType));
+    oSeq.bHasM = CPL_TO_BOOL(OGR_GT_HasM(eGeometryType));
+    oSeq.nDim = 2 + (oSeq.bHasZ ? 1 : 0) + (oSeq.bHasM ? 1 : 0);
+    oSeq.bNeedSwap = OGR_SWAP(eByteOrder);
+    const size_t nPointSize = oSeq.nDim * sizeof(double);
+
+    const auto Emit = [pfnFunc, &bStopOut, &oSeq]()
+    {
+        if (pfnFunc && !(*pfnFunc)(oSeq))
+            bStopOut = true;
+    };
+
+    const auto ReadPointSequence = [data, size, &iOffsetInOut, &oSeq,
+                                    eByteOrder, nPointSize]()
+    {
+        if (size - iOffsetInOut < sizeof(uint32_t))
+            return false;
+        oSeq.nPointCount =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (oSeq.nPointCount > (size - iOffsetInOut) / nPointSize)
+            return false;
+        oSeq.pabyData = data + iOffsetInOut;
+        iOffsetInOut += oSeq.nPointCount * nPointSize;
+        return true;
+    };
+
+    if (eFlatType == wkbPoint)
+    {
+        if (size - iOffsetInOut < nPointSize)
+            return false;
+        oSeq.eType = wkbPoint;
+        oSeq.pabyData = data + iOffsetInOut;
+        oSeq.nPointCount = std::isnan(oSeq.GetX(0)) ? 0 : 1;
+        iOffsetInOut += nPointSize;
+        Emit();
+        return true;
+    }
+
+    if (eFlatType == wkbLineString)
+    {
+        oSeq.eType = wkbLineString;
+        if (!ReadPointSequence())
+            return false;
+        Emit();
+        return true;
+    }
+
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        oSeq.eType = wkbLinearRing;
+        const uint32_t nRings =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nRings > (size - iOffsetInOut) / sizeof(uint32_t))
+            return false;
+        for (uint32_t i = 0; i < nRings && !bStopOut; i++)
+        {
+            oSeq.nRingIdx = static_cast<int>(i);
+            if (!ReadPointSequence())
+                return false;
+            Emit();
+        }
+        return true;
+    }
+
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+    {
+        if (nRec == 128)
+            return false;
+        const uint32_t nParts =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nParts > (size - iOffsetInOut) / MIN_WKB_SIZE)
+            return false;
+        for (uint32_t k = 0; k < nParts && !bStopOut; k++)
+        {
+            if (!OGRWKBVisitPointSequences(data, size, iOffsetInOut, nRec + 1,
+                                           pfnFunc, bStopOut))
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                         OGRWKBGeometryView()                         */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * The structure of the WKB is validated at construction time.
+ *
+ * @param pabyWkb WKB buffer, that must outlive the view.
+ * @param nWKBSize size of pabyWkb in bytes.
+ */
+OGRWKBGeometryView::OGRWKBGeometryView(const GByte *pabyWkb, size_t nWKBSize)
+    : m_pabyWkb(pabyWkb), m_nWKBSize(nWKBSize)
+{
+    size_t iOffset = 0;
+    bool bStop = false;
+    if (pabyWkb && OGRWKBVisitPointSequences(pabyWkb, nWKBSize, iOffset, 0,
+                                             nullptr, bStop))
+    {
+        m_bValid = true;
+        OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &m_eGeometryType);
+    }
+}
+
+/************************************************************************/
+/*                        ForEachPointSequence()                        */
+/************************************************************************/
+
+/** Call func on each point sequence of the geometry, in the order of the
+ * WKB, until it returns false.
+ *
+ * @return false if the WKB is not valid or the iteration was interrupted.
+ */
+bool OGRWKBGeometryView::ForEachPointSequence(
+    const PointSequenceFunc &func) const
+{
+    if (!m_bValid)
+        return false;
+    size_t iOffset = 0;
+    bool bStop = false;
+    OGRWKBVisitPointSequences(m_pabyWkb, m_nWKBSize, iOffset, 0, &func,
+                              bStop);
+    return !bStop;
+}
+
+/************************************************************************/
+/*                              IsEmpty()                               */
+/************************************************************************/
+
+/** Return whether the geometry has no point. */
+bool OGRWKBGeometryView::IsEmpty() const
+{
+    return GetPointCount() == 0;
+}
+
+/************************************************************************/
+/*                            GetEnvelope()                             */
+/************************************************************************/
+
+/** Compute the 2D envelope of the geometry.
+ *
+ * @return false if the WKB is not valid.
+ */
+bool OGRWKBGeometryView::GetEnvelope(OGREnvelope &sEnvelope) const
+{
+    sEnvelope = OGREnvelope();
+    return m_bValid &&
+           OGRWKBGetBoundingBox(m_pabyWkb, m_nWKBSize, sEnvelope);
+}
+
+/** Compute the 3D envelope of the geometry.
+ *
+ * @return false if the WKB is not valid.
+ */
+bool OGRWKBGeometryView::GetEnvelope(OGREnvelope3D &sEnvelope) const
+{
+    sEnvelope = OGREnvelope3D();
+    return m_bValid &&
+           OGRWKBGetBoundingBox(m_pabyWkb, m_nWKBSize, sEnvelope);
+}
+
+/************************************************************************/
+/*                           GetPointCount()                            */
+/************************************************************************/
+
+/** Return the total number of points of the geometry. */
+size_t OGRWKBGeometryView::GetPointCount() const
+{
+    size_t nCount = 0;
+    ForEachPointSequence(
+        [&nCount](const PointSequence &oSeq)
+        {
+            nCount += oSeq.nPointCount;
+            return true;
+        });
+    return nCount;
+}
+
+/************************************************************************/
+/*                         OGRWKBSequenceArea()                         */
+/************************************************************************/
+
+// Unsigned area of a closed point sequence, according to Green's Theorem.
+// Cf OGRSimpleCurve::get_LinearArea()
+static double OGRWKBSequenceArea(const OGRWKBGeometryView::PointSequence &oSeq)
+{
+    const uint32_t nPoints = oSeq.nPointCount;
+    if (nPoints < 4)
+        return 0;
+    double x_m1 = oSeq.GetX(0);
+    double y_m1 = oSeq.GetY(0);
+    double y_m2 = y_m1;
+    double dfArea = 0;
+    for (uint32_t i = 1; i < nPoints; ++i)
+    {
+        const double x = oSeq.GetX(i);
+        const double y = oSeq.GetY(i);
+        dfArea += x_m1 * (y - y_m2);
+        y_m2 = y_m1;
+        x_m1 = x;
+        y_m1 = y;
+    }
+    dfArea += x_m1 * (y_m1 - y_m2);
+    return 0.5 * std::fabs(dfArea);
+}
+
+/************************************************************************/
+/*                              GetArea()                               */
+/************************************************************************/
+
+/** Compute the planar area of the geometry, with the same conventions as
+ * OGR_G_Area(): areas of polygons and closed linestrings are summed, and
+ * interior rings are subtracted.
+ */
+double OGRWKBGeometryView::GetArea() const
+{
+    double dfArea = 0;
+    ForEachPointSequence(
+        [&dfArea](const PointSequence &oSeq)
+        {
+            if (oSeq.eType == wkbLinearRing)
+            {
+                const double dfRingArea = OGRWKBSequenceArea(oSeq);
+                dfArea += oSeq.nRingIdx == 0 ? dfRingArea : -dfRingArea;
+            }
+            else if (oSeq.eType == wkbLineString && oSeq.nPointCount >= 4 &&
+                     oSeq.GetX(0) == oSeq.GetX(oSeq.nPointCount - 1) &&
+                     oSeq.GetY(0) == oSeq.GetY(oSeq.nPointCount - 1))
+            {
+                dfArea += OGRWKBSequenceArea(oSeq);
+            }
+            return true;
+        });
+    return dfArea;
+}
+
+/************************************************************************/
+/*                             GetLength()                              */
+/************************************************************************/
+
+/** Compute the planar length of the geometry, with the same conventions as
+ * OGR_G_Length(): only linestrings contribute, not polygon rings.
+ */
+double OGRWKBGeometryView::GetLength() const
+{
+    double dfLength = 0;
+    ForEachPointSequence(
+        [&dfLength](const PointSequence &oSeq)
+        {
+            if (oSeq.eType == wkbLineString)
+            {
+                for (uint32_t i = 1; i < oSeq.nPointCount; ++i)
+                {
+                    const double dfDeltaX = oSeq.GetX(i) - oSeq.GetX(i - 1);
+                    const double dfDeltaY = oSeq.GetY(i) - oSeq.GetY(i - 1);
+                    dfLength += sqrt(dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY);
+                }
+            }
+            return true;
+        });
+    return dfLength;
+}
+
+/************************************************************************/
+/*                       OGRWKBPointInRing()                            */
+/************************************************************************/
+
+// Returns 1 if (dfX, dfY) is strictly inside the ring, 0 if it is on its
+// boundary and -1 if it is outside.
+static int OGRWKBPointInRing(const OGRWKBGeometryView::PointSequence &oSeq,
+                             double dfX, double dfY)
+{
+    const uint32_t nPoints = oSeq.nPointCount;
+    if (nPoints == 0)
+        return -1;
+    bool bInside = false;
+    double dfXPrev = oSeq.GetX(nPoints - 1);
+    double dfYPrev = oSeq.GetY(nPoints - 1);
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        const double dfXCur = oSeq.GetX(i);
+        const double dfYCur = oSeq.GetY(i);
+        if (dfY >= std::min(dfYCur, dfYPrev) &&
+            dfY <= std::max(dfYCur, dfYPrev) &&
+            dfX >= std::min(dfXCur, dfXPrev) &&
+            dfX <= std::max(dfXCur, dfXPrev) &&
+            (dfXPrev - dfXCur) * (dfY - dfYCur) ==
+                (dfYPrev - dfYCur) * (dfX - dfXCur))
+        {
+            return 0;
+        }
+        if ((dfYCur > dfY) != (dfYPrev > dfY) &&
+            dfX < (dfXPrev - dfXCur) * (dfY - dfYCur) / (dfYPrev - dfYCur) +
+                      dfXCur)
+        {
+            bInside = !bInside;
+        }
+        dfXPrev = dfXCur;
+        dfYPrev = dfYCur;
+    }
+    return bInside ? 1 : -1;
+}
+
+/************************************************************************/
+/*                             Intersects()                             */
+/************************************************************************/
+
+/** Return whether the point (dfX, dfY) is inside or on the boundary of one
+ * of the polygons of the geometry.
+ *
+ * Points and linestrings are ignored, so this returns false for
+ * non-surface geometries.
+ */
+bool OGRWKBGeometryView::Intersects(double dfX, double dfY) const
+{
+    bool bIntersects = false;
+    // Whether the point is inside the exterior ring of the polygon being
+    // processed, and not yet excluded by one of its interior rings.
+    bool bInCurPolygon = false;
+    ForEachPointSequence(
+        [dfX, dfY, &bIntersects, &bInCurPolygon](const PointSequence &oSeq)
+        {
+            if (oSeq.eType != wkbLinearRing)
+                return true;
+            if (oSeq.nRingIdx == 0)
+            {
+                if (bInCurPolygon)
+                {
+                    bIntersects = true;
+                    return false;
+                }
+                const int nRet = OGRWKBPointInRing(oSeq, dfX, dfY);
+                if (nRet == 0)
+                {
+                    bIntersects = true;
+                    return false;
+                }
+                bInCurPolygon = nRet > 0;
+            }
+            else if (bInCurPolygon)
+            {
+                const int nRet = OGRWKBPointInRing(oSeq, dfX, dfY);
+                if (nRet == 0)
+                {
+                    bIntersects = true;
+                    return false;
+                }
+                if (nRet > 0)
+                    bInCurPolygon = false;
+            }
+            return true;
+        });
+    return bIntersects || bInCurPolygon;
+}
+
+/************************************************************************/
+/*                            ExportToGEOS()                            */
+/************************************************************************/
+
+#ifdef HAVE_GEOS
+
+static GEOSCoordSequence *
+OGRWKBPointSequenceToGEOS(GEOSContextHandle_t hGEOSCtxt,
+                          const OGRWKBGeometryView::PointSequence &oSeq)
+{
+    GEOSCoordSequence *poSeq = GEOSCoordSeq_create_r(
+        hGEOSCtxt, oSeq.nPointCount, oSeq.bHasZ ? 3 : 2);
+    if (poSeq == nullptr)
+        return nullptr;
+    for (uint32_t i = 0; i < oSeq.nPointCount; ++i)
+    {
+        GEOSCoordSeq_setX_r(hGEOSCtxt, poSeq, i, oSeq.GetX(i));
+        GEOSCoordSeq_setY_r(hGEOSCtxt, poSeq, i, oSeq.GetY(i));
+        if (oSeq.bHasZ)
+            GEOSCoordSeq_setZ_r(hGEOSCtxt, poSeq, i, oSeq.GetZ(i));
+    }
+    return poSeq;
+}
+
+static GEOSGeom OGRWKBGeometryToGEOS(GEOSContextHandle_t hGEOSCtxt,
+                                     const GByte *data, size_t size,
+                                     size_t &iOffsetInOut, int nRec)
+{
+    // The WKB has already been validated.
+    const size_t iStartOffset = iOffsetInOut;
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    OGRReadWKBGeometryType(data + iOffsetInOut, wkbVariantIso, &eGeometryType);
+    const auto eFlatType = wkbFlatten(eGeometryType);
+
+    if (eFlatType == wkbPoint || eFlatType == wkbLineString ||
+        eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        std::vector<GEOSGeom> apoRings;
+        GEOSGeom poRet = nullptr;
+        bool bError = false;
+        const OGRWKBGeometryView::PointSequenceFunc func =
+            [hGEOSCtxt, &apoRings, &poRet,
+             &bError](const OGRWKBGeometryView::PointSequence &oSeq)
+        {
+            if (oSeq.eType == wkbPoint && oSeq.nPointCount == 0)
+            {
+                poRet = GEOSGeom_createEmptyPoint_r(hGEOSCtxt);
+                return true;
+            }
+            GEOSCoordSequence *poSeq =
+                OGRWKBPointSequenceToGEOS(hGEOSCtxt, oSeq);
+            if (poSeq == nullptr)
+            {
+                bError = true;
+                return false;
+            }
+            if (oSeq.eType == wkbPoint)
+                poRet = GEOSGeom_createPoint_r(hGEOSCtxt, poSeq);
+            else if (oSeq.eType == wkbLineString)
+                poRet = GEOSGeom_createLineString_r(hGEOSCtxt, poSeq);
+            else
+            {
+                GEOSGeom poRing = GEOSGeom_createLinearRing_r(hGEOSCtxt, poSeq);
+                if (poRing == nullptr)
+                {
+                    bError = true;
+                    return false;
+                }
+                apoRings.push_back(poRing);
+            }
+            return true;
+        };
+        bool bStop = false;
+        OGRWKBVisitPointSequences(data, size, iOffsetInOut, nRec, &func,
+                                  bStop);
+        if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+        {
+            if (!bError && apoRings.empty())
+            {
+                poRet = GEOSGeom_createEmptyPolygon_r(hGEOSCtxt);
+            }
+            else if (!bError)
+            {
+                poRet = GEOSGeom_createPolygon_r(
+                    hGEOSCtxt, apoRings[0],
+                    apoRings.size() > 1 ? apoRings.data() + 1 : nullptr,
+                    static_cast<unsigned>(apoRings.size() - 1));
+                if (poRet)
+                    apoRings.clear();
+            }
+            for (GEOSGeom poRing : apoRings)
+                GEOSGeom_destroy_r(hGEOSCtxt, poRing);
+        }
+        else if (bError && poRet)
+        {
+            GEOSGeom_destroy_r(hGEOSCtxt, poRet);
+            poRet = nullptr;
+        }
+        return poRet;
+    }
+
+    int nGEOSType;
+    switch (eFlatType)
+    {
+        case wkbMultiPoint:
+            nGEOSType = GEOS_MULTIPOINT;
+            break;
+        case wkbMultiLineString:
+            nGEOSType = GEOS_MULTILINESTRING;
+            break;
+        case wkbMultiPolygon:
+        case wkbPolyhedralSurface:
+        case wkbTIN:
+            nGEOSType = GEOS_MULTIPOLYGON;
+            break;
+        default:
+            nGEOSType = GEOS_GEOMETRYCOLLECTION;
+            break;
+    }
+
+    const bool bNeedSwap = OGR_SWAP(static_cast<OGRwkbByteOrder>(
+        DB2_V72_FIX_BYTE_ORDER(data[iStartOffset])));
+    iOffsetInOut += WKB_PREFIX_SIZE;
+    const uint32_t nParts = OGRWKBReadUInt32(data + iOffsetInOut, bNeedSwap);
+    iOffsetInOut += sizeof(uint32_t);
+    std::vector<GEOSGeom> apoParts;
+    apoParts.reserve(nParts);
+    for (uint32_t k = 0; k < nParts; k++)
+    {
+        GEOSGeom poPart = OGRWKBGeometryToGEOS(hGEOSCtxt, data, size,
+                                               iOffsetInOut, nRec + 1);
+        if (poPart == nullptr)
+        {
+            for (GEOSGeom poOtherPart : apoParts)
+                GEOSGeom_destroy_r(hGEOSCtxt, poOtherPart);
+            return nullptr;
+        }
+        apoParts.push_back(poPart);
+    }
+    GEOSGeom poRet = GEOSGeom_createCollection_r(
+        hGEOSCtxt, nGEOSType, apoParts.data(),
+        static_cast<unsigned>(apoParts.size()));
+    if (poRet == nullptr)
+    {
+        for (GEOSGeom poPart : apoParts)
+            GEOSGeom_destroy_r(hGEOSCtxt, poPart);
+    }
+    return poRet;
+}
+
+#endif  // HAVE_GEOS
+
+/** Build a GEOS geometry directly from the WKB coordinates.
+ *
+ * M values are ignored. The returned geometry must be freed with
+ * GEOSGeom_destroy_r().
+ *
+ * @return the GEOS geometry, or nullptr in case of error.
+ */
+GEOSGeom
+OGRWKBGeometryView::ExportToGEOS(CPL_UNUSED GEOSContextHandle_t hGEOSCtxt) const
+{
+#ifdef HAVE_GEOS
+    if (!m_bValid || hGEOSCtxt == nullptr)
+        return nullptr;
+    size_t iOffset = 0;
+    return OGRWKBGeometryToGEOS(hGEOSCtxt, m_pabyWkb, m_nWKBSize, iOffset, 0);
+#else
+    CPLError(CE_Failure, CPLE_NotSupported, "GEOS support not enabled.");
+    return nullptr;
+#endif
+}
+
 /************************************************************************/
 /*                         OGRAppendBuffer()                            */
 /************************************************************************/
@@ -32,6 +32,13 @@
 #include "cpl_port.h"
 #include "ogr_core.h"
 
+#include <functional>
+
+/** GEOS geometry type */
+typedef struct GEOSGeom_t *GEOSGeom;
+/** GEOS context handle type */
+typedef struct GEOSContextHandle_HS *GEOSContextHandle_t;
+
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
                                bool &bNeedSwap, uint32_t &nType);
 bool OGRWKBPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
@@ -48,6 +55,10 @@ bool CPL_DLL OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
 bool CPL_DLL OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
                                          const OGREnvelope &sEnvelope);
 
+int CPL_DLL OGRPreparedGeometryIntersectsWKB(
+    struct _OGRPreparedGeometry *hPreparedGeom, const GByte *pabyWKB,
+    size_t nWKBSize);
+
 void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
                                                      size_t nWKBSize);
 
@@ -62,6 +73,117 @@ void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
 const GByte CPL_DLL *WKBFromEWKB(GByte *pabyEWKB, size_t nEWKBSize,
                                  size_t &nWKBSizeOut, int *pnSRIDOut);
 
+/************************************************************************/
+/*                       OGRWKBGeometryView                             */
+/************************************************************************/
+
+/** Read-only view over a WKB geometry, to compute a few properties without
+ * instantiating a OGRGeometry object.
+ *
+ * The view does not copy the WKB buffer, which must outlive it. ISO and
+ * 25D (OGC 99-049) dimension flags are recognized. Only linear geometry
+ * types (Point, LineString, Polygon, Triangle and collections of them) are
+ * supported: IsValid() returns false for other types or truncated/corrupted
+ * buffers, in which case the other methods return a default value.
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL OGRWKBGeometryView
+{
+  public:
+    /** Sequence of points of a Point, LineString or polygon ring. */
+    struct PointSequence
+    {
+        /** wkbPoint, wkbLineString or wkbLinearRing */
+        OGRwkbGeometryType eType = wkbUnknown;
+        /** Pointer to the coordinates of the first point */
+        const GByte *pabyData = nullptr;
+        /** Number of points (0 for an empty point) */
+        uint32_t nPointCount = 0;
+        /** Number of ordinates per point (2, 3 or 4) */
+        int nDim = 2;
+        /** Whether points have a Z ordinate */
+        bool bHasZ = false;
+        /** Whether points have a M ordinate */
+        bool bHasM = false;
+        /** Whether ordinates must be byte-swapped */
+        bool bNeedSwap = false;
+        /** Index of the ring in its polygon (0 = exterior ring), or -1 */
+        int nRingIdx = -1;
+
+        /** Return the X ordinate of point i */
+        inline double GetX(uint32_t i) const
+        {
+            return GetOrdinate(i, 0);
+        }
+
+        /** Return the Y ordinate of point i */
+        inline double GetY(uint32_t i) const
+        {
+            return GetOrdinate(i, 1);
+        }
+
+        /** Return the Z ordinate of point i, or 0 */
+        inline double GetZ(uint32_t i) const
+        {
+            return bHasZ ? GetOrdinate(i, 2) : 0.0;
+        }
+
+        /** Return the M ordinate of point i, or 0 */
+        inline double GetM(uint32_t i) const
+        {
+            return bHasM ? GetOrdinate(i, nDim - 1) : 0.0;
+        }
+
+      private:
+        inline double GetOrdinate(uint32_t i, int iOrdinate) const
+        {
+            double dfVal;
+            memcpy(&dfVal,
+                   pabyData + (static_cast<size_t>(i) * nDim + iOrdinate) *
+                                  sizeof(double),
+                   sizeof(double));
+            if (bNeedSwap)
+                CPL_SWAP64PTR(&dfVal);
+            return dfVal;
+        }
+    };
+
+    /** Callback of ForEachPointSequence(). Must return false to stop the
+     * iteration. */
+    using PointSequenceFunc = std::function<bool(const PointSequence &)>;
+
+    OGRWKBGeometryView(const GByte *pabyWkb, size_t nWKBSize);
+
+    /** Return whether the WKB is valid and of a supported type. */
+    bool IsValid() const
+    {
+        return m_bValid;
+    }
+
+    /** Return the geometry type, or wkbUnknown if the WKB is not valid. */
+    OGRwkbGeometryType GetGeometryType() const
+    {
+        return m_eGeometryType;
+    }
+
+    bool IsEmpty() const;
+    bool GetEnvelope(OGREnvelope &sEnvelope) const;
+    bool GetEnvelope(OGREnvelope3D &sEnvelope) const;
+    bool ForEachPointSequence(const PointSequenceFunc &func) const;
+    size_t GetPointCount() const;
+    double GetArea() const;
+    double GetLength() const;
+    bool Intersects(double dfX, double dfY) const;
+    GEOSGeom ExportToGEOS(GEOSContextHandle_t hGEOSCtxt) const;
+
+  private:
+    const GByte *m_pabyWkb = nullptr;
+    size_t m_nWKBSize = 0;
+    OGRwkbGeometryType m_eGeometryType = wkbUnknown;
+    bool m_bValid = false;
+};
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
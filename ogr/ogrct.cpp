@@ -36,15 +36,20 @@
 #include <cstring>
 #include <limits>
 #include <list>
+#include <map>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_mem_cache.h"
 #include "cpl_string.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
 #include "ogr_proj_p.h"
+#include "gdal_thread_pool.h"
 
 #include "proj.h"
 #include "proj_experimental.h"
@@ -761,6 +766,18 @@ class OGRProjCT : public OGRCoordinateTransformation
 
     bool bWebMercatorToWGS84LongLat = false;
 
+    // Analytic transformations done without PROJ
+    enum class FastPath
+    {
+        NONE,
+        WGS84_TO_WEBMERCATOR,
+        WGS84_TO_UTM,
+        UTM_TO_WGS84,
+    };
+    FastPath m_eFastPath = FastPath::NONE;
+    double m_dfUTMLon0 = 0.0;            // central meridian, in degrees
+    double m_dfUTMFalseNorthing = 0.0;  // 0 or 10,000,000 m
+
     size_t nErrorCount = 0;
 
     double dfThreshold = 0.0;
@@ -811,6 +828,7 @@ class OGRProjCT : public OGRCoordinateTransformation
 
     void ComputeThreshold();
     void DetectWebMercatorToWGS84();
+    void DetectAnalyticFastPath();
 
     OGRProjCT(const OGRProjCT &other);
     OGRProjCT &operator=(const OGRProjCT &) = delete;
@@ -1276,6 +1294,8 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       dfTargetCoordinateEpoch(other.dfTargetCoordinateEpoch),
       m_osTargetSRS(other.m_osTargetSRS),
       bWebMercatorToWGS84LongLat(other.bWebMercatorToWGS84LongLat),
+      m_eFastPath(other.m_eFastPath), m_dfUTMLon0(other.m_dfUTMLon0),
+      m_dfUTMFalseNorthing(other.m_dfUTMFalseNorthing),
       nErrorCount(other.nErrorCount), dfThreshold(other.dfThreshold),
       m_pj(other.m_pj), m_bReversePj(other.m_bReversePj),
       m_bEmitErrors(other.m_bEmitErrors), bNoTransform(other.bNoTransform),
@@ -1441,6 +1461,97 @@ void OGRProjCT::DetectWebMercatorToWGS84()
     }
 }
 
+/************************************************************************/
+/*                        DetectAnalyticFastPath()                      */
+/************************************************************************/
+
+// Detects common CRS pairs for which the coordinate operation is a pure
+// conversion that can be evaluated analytically, without going through
+// PROJ: WGS84 -> WebMercator and WGS84 <-> WGS84 / UTM.
+// As in DetectWebMercatorToWGS84(), this relies on the EPSG codes of the
+// CRS and assumes that their definition is the official one.
+void OGRProjCT::DetectAnalyticFastPath()
+{
+    m_eFastPath = FastPath::NONE;
+    if (bWebMercatorToWGS84LongLat || !m_options.d->osCoordOperation.empty() ||
+        !poSRSSource || !poSRSTarget || dfSourceCoordinateEpoch > 0 ||
+        dfTargetCoordinateEpoch > 0 ||
+        !CPLTestBool(CPLGetConfigOption("OGR_CT_USE_FAST_PATH", "YES")))
+    {
+        return;
+    }
+
+    const char *pszSourceAuth = poSRSSource->GetAuthorityName(nullptr);
+    const char *pszSourceCode = poSRSSource->GetAuthorityCode(nullptr);
+    const char *pszTargetAuth = poSRSTarget->GetAuthorityName(nullptr);
+    const char *pszTargetCode = poSRSTarget->GetAuthorityCode(nullptr);
+    if (!(pszSourceAuth && pszSourceCode && pszTargetAuth && pszTargetCode &&
+          EQUAL(pszSourceAuth, "EPSG") && EQUAL(pszTargetAuth, "EPSG")))
+    {
+        return;
+    }
+
+    // Returns the zone number (positive for north, negative for south) of
+    // a WGS 84 / UTM zone EPSG code, or 0.
+    const auto GetWGS84UTMZone = [](const char *pszCode)
+    {
+        if (strlen(pszCode) != 5 || !EQUALN(pszCode, "32", 2))
+            return 0;
+        const int nCode = atoi(pszCode);
+        if (nCode >= 32601 && nCode <= 32660)
+            return nCode - 32600;
+        if (nCode >= 32701 && nCode <= 32760)
+            return -(nCode - 32700);
+        return 0;
+    };
+
+    // The exact Transverse Mercator implementation of PROJ is what we
+    // reproduce, so do not interfere with a request for the approximate one.
+    const auto UseExactTMerc = []()
+    {
+        const char *pszUseETMERC =
+            CPLGetConfigOption("OSR_USE_ETMERC", nullptr);
+        if (pszUseETMERC && pszUseETMERC[0] && !CPLTestBool(pszUseETMERC))
+            return false;
+        const char *pszUseApproxTMERC =
+            CPLGetConfigOption("OSR_USE_APPROX_TMERC", nullptr);
+        return !(pszUseApproxTMERC && CPLTestBool(pszUseApproxTMERC));
+    };
+
+    int nUTMZone = 0;
+    if (EQUAL(pszSourceCode, "4326"))
+    {
+        if (EQUAL(pszTargetCode, "3857") || EQUAL(pszTargetCode, "3785") ||
+            EQUAL(pszTargetCode, "900913"))
+        {
+            m_eFastPath = FastPath::WGS84_TO_WEBMERCATOR;
+        }
+        else if ((nUTMZone = GetWGS84UTMZone(pszTargetCode)) != 0 &&
+                 UseExactTMerc())
+        {
+            m_eFastPath = FastPath::WGS84_TO_UTM;
+        }
+    }
+    else if (EQUAL(pszTargetCode, "4326") &&
+             (nUTMZone = GetWGS84UTMZone(pszSourceCode)) != 0 &&
+             UseExactTMerc())
+    {
+        m_eFastPath = FastPath::UTM_TO_WGS84;
+    }
+
+    if (nUTMZone != 0)
+    {
+        m_dfUTMLon0 = (std::abs(nUTMZone) - 1) * 6 - 180 + 3;
+        m_dfUTMFalseNorthing = nUTMZone > 0 ? 0.0 : 10000000.0;
+    }
+
+    if (m_eFastPath != FastPath::NONE)
+    {
+        CPLDebug("OGRCT", "Using analytic EPSG:%s to EPSG:%s transformation",
+                 pszSourceCode, pszTargetCode);
+    }
+}
+
 /************************************************************************/
 /*                             Initialize()                             */
 /************************************************************************/
@@ -1586,6 +1697,7 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
     ComputeThreshold();
 
     DetectWebMercatorToWGS84();
+    DetectAnalyticFastPath();
 
     const char *pszCTOpSelection =
         CPLGetConfigOption("OGR_CT_OP_SELECTION", nullptr);
@@ -1640,7 +1752,8 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
                  m_bReversePj ? "(reversed) " : "");
 #endif
     }
-    else if (!bWebMercatorToWGS84LongLat && poSRSSource && poSRSTarget)
+    else if (!bWebMercatorToWGS84LongLat && m_eFastPath == FastPath::NONE &&
+             poSRSSource && poSRSTarget)
     {
 #ifdef DEBUG_PERF
         struct CPLTimeVal tvStart;
@@ -2290,6 +2403,366 @@ int OGRProjCT::Transform(size_t nCount, double *x, double *y, double *z,
 #define PROJ_ERR_COORD_TRANSFM_NO_OPERATION 2051
 #endif
 
+/************************************************************************/
+/*                        OGRWGS84TMercCoefs                            */
+/************************************************************************/
+
+namespace
+{
+// Coefficients of the 6th order Krüger series, in the Poder/Engsager
+// formulation, for the UTM projection on the WGS84 ellipsoid. This is the
+// same algorithm as the default ("exact") implementation of PROJ tmerc/utm,
+// so results match the ones of the corresponding PROJ pipeline.
+struct OGRWGS84TMercCoefs
+{
+    static constexpr int ORDER = 6;
+
+    double cgb[ORDER] = {};  // Gaussian -> geodetic latitude
+    double cbg[ORDER] = {};  // geodetic -> Gaussian latitude
+    double utg[ORDER] = {};  // ellipsoidal N, E -> spherical N, E
+    double gtu[ORDER] = {};  // spherical N, E -> ellipsoidal N, E
+    double Qn = 0;           // meridian quadrant, scaled by k0
+
+    OGRWGS84TMercCoefs()
+    {
+        const double f = 1.0 / SRS_WGS84_INVFLATTENING;
+        const double n = f / (2 - f);
+        constexpr double k0 = 0.9996;
+
+        double np = n * n;
+        cgb[0] = n * (2 + n * (-2 / 3.0 +
+                               n * (-2 + n * (116 / 45.0 +
+                                              n * (26 / 45.0 +
+                                                   n * (-2854 / 675.0))))));
+        cbg[0] = n * (-2 + n * (2 / 3.0 +
+                                n * (4 / 3.0 +
+                                     n * (-82 / 45.0 +
+                                          n * (32 / 45.0 +
+                                               n * (4642 / 4725.0))))));
+        cgb[1] = np * (7 / 3.0 +
+                       n * (-8 / 5.0 +
+                            n * (-227 / 45.0 +
+                                 n * (2704 / 315.0 + n * (2323 / 945.0)))));
+        cbg[1] = np * (5 / 3.0 +
+                       n * (-16 / 15.0 +
+                            n * (-13 / 9.0 +
+                                 n * (904 / 315.0 + n * (-1522 / 945.0)))));
+        np *= n;
+        cgb[2] = np * (56 / 15.0 +
+                       n * (-136 / 35.0 +
+                            n * (-1262 / 105.0 + n * (73814 / 2835.0))));
+        cbg[2] = np * (-26 / 15.0 +
+                       n * (34 / 21.0 + n * (8 / 5.0 + n * (-12686 / 2835.0))));
+        np *= n;
+        cgb[3] = np * (4279 / 630.0 +
+                       n * (-332 / 35.0 + n * (-399572 / 14175.0)));
+        cbg[3] =
+            np * (1237 / 630.0 + n * (-12 / 5.0 + n * (-24832 / 14175.0)));
+        np *= n;
+        cgb[4] = np * (4174 / 315.0 + n * (-144838 / 6237.0));
+        cbg[4] = np * (-734 / 315.0 + n * (109598 / 31185.0));
+        np *= n;
+        cgb[5] = np * (601676 / 22275.0);
+        cbg[5] = np * (444337 / 155925.0);
+
+        np = n * n;
+        Qn = k0 / (1 + n) * (1 + np * (1 / 4.0 + np * (1 / 64.0 + np / 256.0)));
+
+        utg[0] = n * (-0.5 +
+                      n * (2 / 3.0 +
+                           n * (-37 / 96.0 +
+                                n * (1 / 360.0 +
+                                     n * (81 / 512.0 +
+                                          n * (-96199 / 604800.0))))));
+        gtu[0] = n * (0.5 +
+                      n * (-2 / 3.0 +
+                           n * (5 / 16.0 +
+                                n * (41 / 180.0 +
+                                     n * (-127 / 288.0 +
+                                          n * (7891 / 37800.0))))));
+        utg[1] = np * (-1 / 48.0 +
+                       n * (-1 / 15.0 +
+                            n * (437 / 1440.0 +
+                                 n * (-46 / 105.0 +
+                                      n * (1118711 / 3870720.0)))));
+        gtu[1] = np * (13 / 48.0 +
+                       n * (-3 / 5.0 +
+                            n * (557 / 1440.0 +
+                                 n * (281 / 630.0 +
+                                      n * (-1983433 / 1935360.0)))));
+        np *= n;
+        utg[2] = np * (-17 / 480.0 +
+                       n * (37 / 840.0 +
+                            n * (209 / 4480.0 + n * (-5569 / 90720.0))));
+        gtu[2] = np * (61 / 240.0 +
+                       n * (-103 / 140.0 +
+                            n * (15061 / 26880.0 + n * (167603 / 181440.0))));
+        np *= n;
+        utg[3] = np * (-4397 / 161280.0 +
+                       n * (11 / 504.0 + n * (830251 / 7257600.0)));
+        gtu[3] = np * (49561 / 161280.0 +
+                       n * (-179 / 168.0 + n * (6601661 / 7257600.0)));
+        np *= n;
+        utg[4] = np * (-4583 / 161280.0 + n * (108847 / 3991680.0));
+        gtu[4] = np * (34729 / 80640.0 + n * (-3418889 / 1995840.0));
+        np *= n;
+        utg[5] = np * (-20648693 / 638668800.0);
+        gtu[5] = np * (212378941 / 319334400.0);
+    }
+
+    static const OGRWGS84TMercCoefs &Get()
+    {
+        static const OGRWGS84TMercCoefs coefs;
+        return coefs;
+    }
+};
+}  // namespace
+
+// Real Clenshaw summation of a series of sin(2k.B) terms, added to B.
+static double OGRTMercGatg(const double *p1, int len_p1, double B)
+{
+    const double cos_2B = 2 * cos(2 * B);
+    const double *p = p1 + len_p1;
+    double h = 0;
+    double h1 = *--p;
+    double h2 = 0;
+    while (p - p1)
+    {
+        h = -h2 + cos_2B * h1 + *--p;
+        h2 = h1;
+        h1 = h;
+    }
+    return B + h * sin(2 * B);
+}
+
+// Complex Clenshaw summation of a series of sin(2k.(arg_r + i.arg_i)) terms.
+static void OGRTMercClenS(const double *a, int size, double arg_r,
+                          double arg_i, double &R, double &I)
+{
+    const double *p = a + size;
+    const double sin_arg_r = sin(arg_r);
+    const double cos_arg_r = cos(arg_r);
+    const double sinh_arg_i = sinh(arg_i);
+    const double cosh_arg_i = cosh(arg_i);
+    double r = 2 * cos_arg_r * cosh_arg_i;
+    double i = -2 * sin_arg_r * sinh_arg_i;
+    double hr = *--p;
+    double hi = 0;
+    double hr1 = 0;
+    double hi1 = 0;
+    while (a - p)
+    {
+        const double hr2 = hr1;
+        const double hi2 = hi1;
+        hr1 = hr;
+        hi1 = hi;
+        hr = -hr2 + r * hr1 - i * hi1 + *--p;
+        hi = -hi2 + i * hr1 + r * hi1;
+    }
+    r = sin_arg_r * cosh_arg_i;
+    i = cos_arg_r * sinh_arg_i;
+    R = r * hr - i * hi;
+    I = r * hi + i * hr;
+}
+
+// Limit of the normalized complex easting beyond which the series do not
+// converge any more (corresponds to 150 degrees).
+constexpr double TMERC_MAX_NORMALIZED_EASTING = 2.623395162778;
+
+constexpr double FAST_PATH_DEG_TO_RAD = M_PI / 180.0;
+constexpr double FAST_PATH_RAD_TO_DEG = 180.0 / M_PI;
+
+// Wraps a longitude difference, in radians, into [-pi, pi].
+static inline double OGRFastPathAdjLon(double lon)
+{
+    if (fabs(lon) > M_PI)
+    {
+        lon = fmod(lon + M_PI, 2 * M_PI);
+        if (lon < 0)
+            lon += 2 * M_PI;
+        lon -= M_PI;
+    }
+    return lon;
+}
+
+// Validates a geographic input coordinate, in degrees, the same way as PROJ
+// does before forward projection.
+static inline bool OGRFastPathIsValidLongLat(double lon, double lat)
+{
+    return std::isfinite(lon) && std::isfinite(lat) &&
+           fabs(lat) <= 90.0 + 1e-10 && fabs(lon) <= 10 * FAST_PATH_RAD_TO_DEG;
+}
+
+/************************************************************************/
+/*                   OGRFastTransformWGS84ToWebMercator()               */
+/************************************************************************/
+
+// x = longitude, y = latitude in degrees -> x = easting, y = northing
+static void OGRFastTransformWGS84ToWebMercator(size_t nCount, double *x,
+                                               double *y, int *panErrorCodes)
+{
+    constexpr double SPHERE_RADIUS = SRS_WGS84_SEMIMAJOR;
+    for (size_t i = 0; i < nCount; i++)
+    {
+        int nErr = 0;
+        if (!OGRFastPathIsValidLongLat(x[i], y[i]))
+        {
+            nErr = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+        }
+        else
+        {
+            const double phi = y[i] * FAST_PATH_DEG_TO_RAD;
+            if (fabs(fabs(phi) - M_PI / 2) <= 1e-10)
+            {
+                nErr = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+            }
+            else
+            {
+                x[i] = SPHERE_RADIUS *
+                       OGRFastPathAdjLon(x[i] * FAST_PATH_DEG_TO_RAD);
+                y[i] = SPHERE_RADIUS * asinh(tan(phi));
+            }
+        }
+        if (nErr)
+        {
+            x[i] = HUGE_VAL;
+            y[i] = HUGE_VAL;
+        }
+        if (panErrorCodes)
+            panErrorCodes[i] = nErr;
+    }
+}
+
+/************************************************************************/
+/*                      OGRFastTransformWGS84ToUTM()                    */
+/************************************************************************/
+
+// x = longitude, y = latitude in degrees -> x = easting, y = northing
+static void OGRFastTransformWGS84ToUTM(size_t nCount, double *x, double *y,
+                                       double dfLon0, double dfFalseNorthing,
+                                       int *panErrorCodes)
+{
+    const auto &coefs = OGRWGS84TMercCoefs::Get();
+    constexpr int ORDER = OGRWGS84TMercCoefs::ORDER;
+    constexpr double A = SRS_WGS84_SEMIMAJOR;
+    constexpr double FALSE_EASTING = 500000.0;
+    const double lam0 = dfLon0 * FAST_PATH_DEG_TO_RAD;
+    for (size_t i = 0; i < nCount; i++)
+    {
+        int nErr = 0;
+        if (!OGRFastPathIsValidLongLat(x[i], y[i]))
+        {
+            nErr = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+        }
+        else
+        {
+            // Geodetic latitude -> Gaussian latitude
+            double Cn = OGRTMercGatg(coefs.cbg, ORDER,
+                                     std::clamp(y[i], -90.0, 90.0) *
+                                         FAST_PATH_DEG_TO_RAD);
+            double Ce =
+                OGRFastPathAdjLon(x[i] * FAST_PATH_DEG_TO_RAD - lam0);
+
+            // Gaussian latitude, longitude -> complex spherical latitude
+            const double sin_Cn = sin(Cn);
+            const double cos_Cn = cos(Cn);
+            const double sin_Ce = sin(Ce);
+            const double cos_Ce = cos(Ce);
+            Cn = atan2(sin_Cn, cos_Ce * cos_Cn);
+            Ce = atan2(sin_Ce * cos_Cn, hypot(sin_Cn, cos_Cn * cos_Ce));
+
+            // Complex spherical N, E -> ellipsoidal normalized N, E
+            Ce = asinh(tan(Ce));
+            double dCn = 0;
+            double dCe = 0;
+            OGRTMercClenS(coefs.gtu, ORDER, 2 * Cn, 2 * Ce, dCn, dCe);
+            Cn += dCn;
+            Ce += dCe;
+            if (fabs(Ce) <= TMERC_MAX_NORMALIZED_EASTING)
+            {
+                x[i] = A * coefs.Qn * Ce + FALSE_EASTING;
+                y[i] = A * coefs.Qn * Cn + dfFalseNorthing;
+            }
+            else
+            {
+                nErr = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+            }
+        }
+        if (nErr)
+        {
+            x[i] = HUGE_VAL;
+            y[i] = HUGE_VAL;
+        }
+        if (panErrorCodes)
+            panErrorCodes[i] = nErr;
+    }
+}
+
+/************************************************************************/
+/*                      OGRFastTransformUTMToWGS84()                    */
+/************************************************************************/
+
+// x = easting, y = northing -> x = longitude, y = latitude in degrees
+static void OGRFastTransformUTMToWGS84(size_t nCount, double *x, double *y,
+                                       double dfLon0, double dfFalseNorthing,
+                                       int *panErrorCodes)
+{
+    const auto &coefs = OGRWGS84TMercCoefs::Get();
+    constexpr int ORDER = OGRWGS84TMercCoefs::ORDER;
+    constexpr double A = SRS_WGS84_SEMIMAJOR;
+    constexpr double FALSE_EASTING = 500000.0;
+    const double lam0 = dfLon0 * FAST_PATH_DEG_TO_RAD;
+    const double dfInvAQn = 1.0 / (A * coefs.Qn);
+    for (size_t i = 0; i < nCount; i++)
+    {
+        int nErr = 0;
+        if (!std::isfinite(x[i]) || !std::isfinite(y[i]))
+        {
+            nErr = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+        }
+        else
+        {
+            // Normalize N, E
+            double Cn = (y[i] - dfFalseNorthing) * dfInvAQn;
+            double Ce = (x[i] - FALSE_EASTING) * dfInvAQn;
+            if (fabs(Ce) <= TMERC_MAX_NORMALIZED_EASTING)
+            {
+                // Normalized N, E -> complex spherical latitude, longitude
+                double dCn = 0;
+                double dCe = 0;
+                OGRTMercClenS(coefs.utg, ORDER, 2 * Cn, 2 * Ce, dCn, dCe);
+                Cn += dCn;
+                Ce += dCe;
+                Ce = atan(sinh(Ce));
+
+                // Complex spherical latitude -> Gaussian latitude, longitude
+                const double sin_Cn = sin(Cn);
+                const double cos_Cn = cos(Cn);
+                const double sin_Ce = sin(Ce);
+                const double cos_Ce = cos(Ce);
+                Ce = atan2(sin_Ce, cos_Ce * cos_Cn);
+                Cn = atan2(sin_Cn * cos_Ce, hypot(sin_Ce, cos_Ce * cos_Cn));
+
+                // Gaussian latitude, longitude -> geodetic latitude, longitude
+                x[i] = OGRFastPathAdjLon(Ce + lam0) * FAST_PATH_RAD_TO_DEG;
+                y[i] = OGRTMercGatg(coefs.cgb, ORDER, Cn) *
+                       FAST_PATH_RAD_TO_DEG;
+            }
+            else
+            {
+                nErr = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+            }
+        }
+        if (nErr)
+        {
+            x[i] = HUGE_VAL;
+            y[i] = HUGE_VAL;
+        }
+        if (panErrorCodes)
+            panErrorCodes[i] = nErr;
+    }
+}
+
 int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                                        double *z, double *t, int *panErrorCodes)
 
@@ -2501,6 +2974,41 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
 
         bTransformDone = true;
     }
+    else if (m_eFastPath != FastPath::NONE)
+    {
+        // Analytic transformations (see DetectAnalyticFastPath())
+        if (m_eSourceFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        switch (m_eFastPath)
+        {
+            case FastPath::WGS84_TO_WEBMERCATOR:
+                OGRFastTransformWGS84ToWebMercator(nCount, x, y,
+                                                   panErrorCodes);
+                break;
+            case FastPath::WGS84_TO_UTM:
+                OGRFastTransformWGS84ToUTM(nCount, x, y, m_dfUTMLon0,
+                                           m_dfUTMFalseNorthing,
+                                           panErrorCodes);
+                break;
+            case FastPath::UTM_TO_WGS84:
+                OGRFastTransformUTMToWGS84(nCount, x, y, m_dfUTMLon0,
+                                           m_dfUTMFalseNorthing,
+                                           panErrorCodes);
+                break;
+            case FastPath::NONE:
+                break;
+        }
+
+        if (m_eTargetFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        bTransformDone = true;
+    }
 
     // Determine the default coordinate epoch, if not provided in the point to
     // transform.
@@ -3548,7 +4056,8 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
 {
     PJ *new_pj = nullptr;
     // m_pj can be nullptr if using m_eStrategy != PROJ
-    if (m_pj && !bWebMercatorToWGS84LongLat && !bNoTransform)
+    if (m_pj && !bWebMercatorToWGS84LongLat &&
+        m_eFastPath == FastPath::NONE && !bNoTransform)
     {
         // See https://github.com/OSGeo/PROJ/pull/2582
         // This may fail before PROJ 8.0.1 if the m_pj object is a "meta"
@@ -3601,10 +4110,299 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
     poNewCT->m_options = newOptions;
 
     poNewCT->DetectWebMercatorToWGS84();
+    poNewCT->DetectAnalyticFastPath();
 
     return poNewCT;
 }
 
+/************************************************************************/
+/*                           OGRThreadSafeCT                            */
+/************************************************************************/
+
+namespace
+{
+/** Coordinate transformation that can be used concurrently from several
+ * threads, and that splits the transformation of large arrays of points
+ * between threads of the global thread pool.
+ *
+ * It holds a clone of the wrapped transformation for each thread that has
+ * used it, since OGRProjCT (and its PJ object) must not be used by several
+ * threads at the same time.
+ */
+class OGRThreadSafeCT final : public OGRCoordinateTransformation
+{
+    std::unique_ptr<OGRCoordinateTransformation> m_poCT{};
+    const int m_nThreads;
+    mutable std::mutex m_oMutex{};
+    std::map<std::thread::id, std::unique_ptr<OGRCoordinateTransformation>>
+        m_oMapThreadToCT{};
+    bool m_bEmitErrors = true;
+
+    // Minimum number of points for each job of a parallel transformation
+    static constexpr size_t MIN_POINTS_PER_JOB = 10000;
+
+    OGRCoordinateTransformation *GetThreadCT();
+
+    struct Job
+    {
+        OGRThreadSafeCT *poThis = nullptr;
+        size_t nCount = 0;
+        double *x = nullptr;
+        double *y = nullptr;
+        double *z = nullptr;
+        double *t = nullptr;
+        int *panErrorCodes = nullptr;
+        int *pabSuccess = nullptr;
+        int nRet = FALSE;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    static void TransformJob(void *pData);
+
+    int TransformInternal(size_t nCount, double *x, double *y, double *z,
+                          double *t, int *panErrorCodes, int *pabSuccess);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRThreadSafeCT)
+
+  public:
+    OGRThreadSafeCT(std::unique_ptr<OGRCoordinateTransformation> poCT,
+                    int nThreads)
+        : m_poCT(std::move(poCT)), m_nThreads(nThreads),
+          m_bEmitErrors(m_poCT->GetEmitErrors())
+    {
+    }
+
+    const OGRSpatialReference *GetSourceCS() const override
+    {
+        return m_poCT->GetSourceCS();
+    }
+
+    const OGRSpatialReference *GetTargetCS() const override
+    {
+        return m_poCT->GetTargetCS();
+    }
+
+    bool GetEmitErrors() const override
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        return m_bEmitErrors;
+    }
+
+    void SetEmitErrors(bool bEmitErrors) override
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bEmitErrors = bEmitErrors;
+        for (auto &oIter : m_oMapThreadToCT)
+            oIter.second->SetEmitErrors(bEmitErrors);
+    }
+
+    int Transform(size_t nCount, double *x, double *y, double *z, double *t,
+                  int *pabSuccess) override
+    {
+        return TransformInternal(nCount, x, y, z, t, nullptr, pabSuccess);
+    }
+
+    int TransformWithErrorCodes(size_t nCount, double *x, double *y,
+                                double *z, double *t,
+                                int *panErrorCodes) override
+    {
+        return TransformInternal(nCount, x, y, z, t, panErrorCodes, nullptr);
+    }
+
+    int TransformBounds(const double xmin, const double ymin,
+                        const double xmax, const double ymax, double *out_xmin,
+                        double *out_ymin, double *out_xmax, double *out_ymax,
+                        const int densify_pts) override
+    {
+        return GetThreadCT()->TransformBounds(xmin, ymin, xmax, ymax, out_xmin,
+                                              out_ymin, out_xmax, out_ymax,
+                                              densify_pts);
+    }
+
+    OGRCoordinateTransformation *Clone() const override
+    {
+        std::unique_ptr<OGRCoordinateTransformation> poCT;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            poCT.reset(m_poCT->Clone());
+        }
+        if (!poCT)
+            return nullptr;
+        return new OGRThreadSafeCT(std::move(poCT), m_nThreads);
+    }
+
+    OGRCoordinateTransformation *GetInverse() const override
+    {
+        std::unique_ptr<OGRCoordinateTransformation> poCT;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            poCT.reset(m_poCT->GetInverse());
+        }
+        if (!poCT)
+            return nullptr;
+        return new OGRThreadSafeCT(std::move(poCT), m_nThreads);
+    }
+};
+
+/************************************************************************/
+/*                            GetThreadCT()                             */
+/************************************************************************/
+
+/** Return the clone of the wrapped transformation used by the calling
+ * thread, creating it if needed. */
+OGRCoordinateTransformation *OGRThreadSafeCT::GetThreadCT()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto &poCT = m_oMapThreadToCT[std::this_thread::get_id()];
+    if (!poCT)
+    {
+        poCT.reset(m_poCT->Clone());
+        if (!poCT)
+        {
+            // Should not happen with OGRProjCT. Sharing the wrapped
+            // transformation between threads would not be safe.
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot clone coordinate transformation");
+            m_oMapThreadToCT.erase(std::this_thread::get_id());
+            return nullptr;
+        }
+        poCT->SetEmitErrors(m_bEmitErrors);
+    }
+    return poCT.get();
+}
+
+/************************************************************************/
+/*                           TransformJob()                             */
+/************************************************************************/
+
+void OGRThreadSafeCT::TransformJob(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    auto poCT = psJob->poThis->GetThreadCT();
+    if (poCT == nullptr)
+    {
+        psJob->nRet = FALSE;
+    }
+    else if (psJob->pabSuccess)
+    {
+        psJob->nRet = poCT->Transform(psJob->nCount, psJob->x, psJob->y,
+                                      psJob->z, psJob->t, psJob->pabSuccess);
+    }
+    else
+    {
+        psJob->nRet = poCT->TransformWithErrorCodes(
+            psJob->nCount, psJob->x, psJob->y, psJob->z, psJob->t,
+            psJob->panErrorCodes);
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                         TransformInternal()                          */
+/************************************************************************/
+
+int OGRThreadSafeCT::TransformInternal(size_t nCount, double *x, double *y,
+                                       double *z, double *t,
+                                       int *panErrorCodes, int *pabSuccess)
+{
+    const size_t nMaxJobs = nCount / MIN_POINTS_PER_JOB;
+    GDALThreadReservation oThreadReservation(
+        m_nThreads > 1 && nMaxJobs > 1
+            ? static_cast<int>(
+                  std::min(static_cast<size_t>(m_nThreads), nMaxJobs))
+            : 1);
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+    {
+        auto poCT = GetThreadCT();
+        if (!poCT)
+            return FALSE;
+        return pabSuccess ? poCT->Transform(nCount, x, y, z, t, pabSuccess)
+                          : poCT->TransformWithErrorCodes(nCount, x, y, z, t,
+                                                          panErrorCodes);
+    }
+
+    // Each job transforms a contiguous range of points
+    std::vector<Job> asJobs(nThreads);
+    const size_t nPointsPerJob =
+        (nCount + static_cast<size_t>(nThreads) - 1) / nThreads;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (int i = 0; i < nThreads; ++i)
+    {
+        const size_t nStart = i * nPointsPerJob;
+        Job &sJob = asJobs[i];
+        sJob.poThis = this;
+        sJob.nCount = std::min(nPointsPerJob, nCount - nStart);
+        sJob.x = x + nStart;
+        sJob.y = y + nStart;
+        sJob.z = z ? z + nStart : nullptr;
+        sJob.t = t ? t + nStart : nullptr;
+        sJob.panErrorCodes = panErrorCodes ? panErrorCodes + nStart : nullptr;
+        sJob.pabSuccess = pabSuccess ? pabSuccess + nStart : nullptr;
+        if (!poJobQueue->SubmitJob(TransformJob, &sJob))
+        {
+            // Run it in the calling thread then
+            TransformJob(&sJob);
+        }
+    }
+    poJobQueue->WaitCompletion();
+
+    int nRet = TRUE;
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &sError : sJob.aoErrors)
+            CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+        if (!sJob.nRet)
+            nRet = FALSE;
+    }
+    return nRet;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*             OGRCreateThreadSafeCoordinateTransformation()            */
+/************************************************************************/
+
+/**
+ * Create a coordinate transformation that can be used concurrently from
+ * several threads.
+ *
+ * OGRProjCT objects, as returned by OGRCreateCoordinateTransformation(),
+ * must not be used by several threads at the same time, so multi-threaded
+ * code has to Clone() them for each thread. The returned object does that
+ * transparently, by holding a clone of poCT, with its own PROJ objects, for
+ * each thread that uses it.
+ *
+ * Additionally, when nThreads is greater than one, calls to Transform()
+ * and TransformWithErrorCodes() with a large number of points are split
+ * into contiguous ranges of points that are transformed by threads of the
+ * global GDAL thread pool. Note that if the transformation uses the
+ * BEST_ACCURACY or FIRST_MATCHING strategies of OGR_CT_OP_SELECTION, the
+ * operation is then selected for the average point of each range, rather
+ * than of the whole array.
+ *
+ * @param poCT the coordinate transformation to wrap. Ownership is
+ * transferred to the returned object. Must not be NULL.
+ * @param nThreads maximum number of threads used to transform a single
+ * array of points. 1 to only use the calling thread.
+ * @return a new coordinate transformation, to be destroyed with the delete
+ * operator or OCTDestroyCoordinateTransformation().
+ * @since GDAL 3.10
+ */
+
+OGRCoordinateTransformation *
+OGRCreateThreadSafeCoordinateTransformation(OGRCoordinateTransformation *poCT,
+                                            int nThreads)
+{
+    return new OGRThreadSafeCT(
+        std::unique_ptr<OGRCoordinateTransformation>(poCT),
+        std::max(1, nThreads));
+}
+
 /************************************************************************/
 /*                            OSRCTCleanCache()                         */
 /************************************************************************/
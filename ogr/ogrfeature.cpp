@@ -43,6 +43,7 @@
 #include <limits>
 #include <map>
 #include <new>
+#include <utility>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -375,6 +376,35 @@ void OGRFeature::Reset()
     }
 }
 
+/************************************************************************/
+/*                            SwapContent()                             */
+/************************************************************************/
+
+/** Exchange the content (FID, field values, geometries, style string,
+ * style table and native data) of this feature with the one of another
+ * feature.
+ *
+ * Both features must share the same feature definition. No memory
+ * allocation or copy of field values or geometries is involved.
+ *
+ * @param oOther Other feature.
+ * @since GDAL 3.10
+ */
+void OGRFeature::SwapContent(OGRFeature &oOther)
+{
+    CPLAssert(poDefn == oOther.poDefn);
+    if (this == &oOther)
+        return;
+
+    std::swap(nFID, oOther.nFID);
+    std::swap(papoGeometries, oOther.papoGeometries);
+    std::swap(pauFields, oOther.pauFields);
+    std::swap(m_pszNativeData, oOther.m_pszNativeData);
+    std::swap(m_pszNativeMediaType, oOther.m_pszNativeMediaType);
+    std::swap(m_pszStyleString, oOther.m_pszStyleString);
+    std::swap(m_poStyleTable, oOther.m_poStyleTable);
+}
+
 /************************************************************************/
 /*                        SetFDefnUnsafe()                              */
 /************************************************************************/
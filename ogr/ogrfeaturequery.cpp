@@ -32,9 +32,17 @@
 #include "ogr_feature.h"
 #include "ogr_swq.h"
 
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <climits>
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -56,13 +64,613 @@ const char *const SpecialFieldNames[SPECIAL_FIELD_COUNT] = {
 const swq_field_type SpecialFieldTypes[SPECIAL_FIELD_COUNT] = {
     SWQ_INTEGER, SWQ_STRING, SWQ_STRING, SWQ_STRING, SWQ_FLOAT};
 
+static int OGRFeatureFetcherFixFieldIndex(OGRFeatureDefn *poFDefn, int nIdx);
+
+/************************************************************************/
+/*                        OGRFeatureQueryProgram                        */
+/************************************************************************/
+
+// Flat, type-specialized form of the most common predicates of attribute
+// filters: comparisons of a column with constants (including BETWEEN, IN
+// and LIKE), IS NULL, combined with AND, OR and NOT. It is evaluated
+// without allocating swq_expr_node objects. Constant sub-expressions are
+// folded, IN lists are turned into hash sets and simple LIKE patterns are
+// turned into prefix/suffix/substring tests.
+//
+// Instructions are stored in prefix order, each one recording the number of
+// instructions of its sub-tree, so that AND and OR can skip their second
+// operand. The semantics are those of SWQGeneralEvaluator(): a comparison
+// involving a NULL value is false.
+struct OGRFeatureQueryProgram
+{
+    enum class Opcode : GByte
+    {
+        CONSTANT,
+        AND,
+        OR,
+        NOT,
+        IS_NULL,
+        INT_CMP,
+        DOUBLE_CMP,
+        STRING_CMP,
+        INT_IN,
+        DOUBLE_IN,
+        STRING_IN,
+        LIKE_EXACT,
+        LIKE_PREFIX,
+        LIKE_SUFFIX,
+        LIKE_CONTAINS,
+        LIKE_ALL,
+        LIKE_GENERIC,
+    };
+
+    struct Instruction
+    {
+        Opcode eOpcode = Opcode::CONSTANT;
+        // Comparison operator for *_CMP
+        swq_op eOp = SWQ_EQ;
+        // Type of the column
+        swq_field_type eFieldType = SWQ_INTEGER;
+        // For CONSTANT
+        bool bValue = false;
+        // For STRING_CMP with SWQ_EQ: whether the constant was on the left
+        bool bSwapped = false;
+        // For LIKE_GENERIC
+        bool bInsensitive = false;
+        char chEscape = '\0';
+        int iField = 0;
+        // Number of instructions of the sub-tree, including this one
+        size_t nSize = 1;
+        // Values (or bounds for BETWEEN)
+        GIntBig nValue1 = 0;
+        GIntBig nValue2 = 0;
+        double dfValue1 = 0;
+        double dfValue2 = 0;
+        // Index in aosStrings for *_CMP and LIKE_*, or in the set vectors
+        // for *_IN
+        size_t nIdx1 = 0;
+        size_t nIdx2 = 0;
+    };
+
+    std::vector<Instruction> asInstructions{};
+    std::vector<std::string> aosStrings{};
+    std::vector<std::unordered_set<GIntBig>> aoIntSets{};
+    std::vector<std::unordered_set<double>> aoDoubleSets{};
+    std::vector<std::unordered_set<std::string>> aoStringSets{};
+    // Buffer for the lower-cased value tested against STRING_IN sets
+    std::string osTmp{};
+
+    bool Compile(swq_expr_node *poNode, OGRFeatureDefn *poDefn,
+                 const swq_evaluation_context &sContext, int nDepth);
+    bool Evaluate(OGRFeature *poFeature, size_t iInstr,
+                  const swq_evaluation_context &sContext);
+
+  private:
+    bool CompileComparison(const swq_expr_node *poNode,
+                           OGRFeatureDefn *poDefn);
+    bool CompileLike(const swq_expr_node *poNode, OGRFeatureDefn *poDefn);
+};
+
+// Returns whether the node is a column of the (single) table, with a
+// type supported by OGRFeatureQueryProgram.
+static bool IsSupportedColumn(const swq_expr_node *poNode)
+{
+    return poNode->eNodeType == SNT_COLUMN && poNode->table_index == 0 &&
+           (poNode->field_type == SWQ_INTEGER ||
+            poNode->field_type == SWQ_INTEGER64 ||
+            poNode->field_type == SWQ_BOOLEAN ||
+            poNode->field_type == SWQ_FLOAT ||
+            poNode->field_type == SWQ_STRING);
+}
+
+static bool IsIntegerLike(swq_field_type eType)
+{
+    return SWQ_IS_INTEGER(eType) || eType == SWQ_BOOLEAN;
+}
+
+static bool HasColumn(const swq_expr_node *poNode)
+{
+    if (poNode->eNodeType == SNT_COLUMN)
+        return true;
+    for (int i = 0; i < poNode->nSubExprCount; ++i)
+    {
+        if (HasColumn(poNode->papoSubExpr[i]))
+            return true;
+    }
+    return false;
+}
+
+static std::string &ToLowerASCII(const char *pszStr, std::string &osOut)
+{
+    osOut.assign(pszStr);
+    for (char &ch : osOut)
+        ch = static_cast<char>(CPLTolower(static_cast<unsigned char>(ch)));
+    return osOut;
+}
+
+/************************************************************************/
+/*                  OGRFeatureQueryProgram::Compile()                   */
+/************************************************************************/
+
+bool OGRFeatureQueryProgram::Compile(swq_expr_node *poNode,
+                                     OGRFeatureDefn *poDefn,
+                                     const swq_evaluation_context &sContext,
+                                     int nDepth)
+{
+    // Evaluate() fails beyond 32 recursion levels
+    if (nDepth >= 30 || poNode->eNodeType != SNT_OPERATION ||
+        poNode->field_type != SWQ_BOOLEAN)
+    {
+        return false;
+    }
+
+    const size_t iInstr = asInstructions.size();
+
+    if (!HasColumn(poNode))
+    {
+        // Constant folding
+        std::unique_ptr<swq_expr_node> poResult(
+            poNode->Evaluate(nullptr, nullptr, sContext));
+        if (!poResult || !IsIntegerLike(poResult->field_type))
+            return false;
+        Instruction sInstr;
+        sInstr.eOpcode = Opcode::CONSTANT;
+        sInstr.bValue = !poResult->is_null && poResult->int_value != 0;
+        asInstructions.push_back(sInstr);
+        return true;
+    }
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        case SWQ_NOT:
+        {
+            if (poNode->nSubExprCount !=
+                (poNode->nOperation == SWQ_NOT ? 1 : 2))
+                return false;
+            Instruction sInstr;
+            sInstr.eOpcode = poNode->nOperation == SWQ_AND ? Opcode::AND
+                             : poNode->nOperation == SWQ_OR ? Opcode::OR
+                                                            : Opcode::NOT;
+            asInstructions.push_back(sInstr);
+            for (int i = 0; i < poNode->nSubExprCount; ++i)
+            {
+                if (!Compile(poNode->papoSubExpr[i], poDefn, sContext,
+                             nDepth + 1))
+                    return false;
+            }
+            asInstructions[iInstr].nSize = asInstructions.size() - iInstr;
+            return true;
+        }
+
+        case SWQ_ISNULL:
+        {
+            if (poNode->nSubExprCount != 1 ||
+                !IsSupportedColumn(poNode->papoSubExpr[0]))
+                return false;
+            Instruction sInstr;
+            sInstr.eOpcode = Opcode::IS_NULL;
+            sInstr.iField = OGRFeatureFetcherFixFieldIndex(
+                poDefn, poNode->papoSubExpr[0]->field_index);
+            asInstructions.push_back(sInstr);
+            return true;
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+        case SWQ_BETWEEN:
+        case SWQ_IN:
+            return CompileComparison(poNode, poDefn);
+
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            return CompileLike(poNode, poDefn);
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*             OGRFeatureQueryProgram::CompileComparison()              */
+/************************************************************************/
+
+bool OGRFeatureQueryProgram::CompileComparison(const swq_expr_node *poNode,
+                                               OGRFeatureDefn *poDefn)
+{
+    const swq_op eOp = poNode->nOperation;
+    const int nCount = poNode->nSubExprCount;
+    if ((eOp == SWQ_BETWEEN && nCount != 3) || (eOp == SWQ_IN && nCount < 2) ||
+        (eOp != SWQ_BETWEEN && eOp != SWQ_IN && nCount != 2))
+    {
+        return false;
+    }
+
+    Instruction sInstr;
+    sInstr.eOp = eOp;
+
+    // Put the column first, swapping the comparison operator
+    std::vector<const swq_expr_node *> apoValues(
+        poNode->papoSubExpr, poNode->papoSubExpr + nCount);
+    if (nCount == 2 && eOp != SWQ_IN &&
+        apoValues[0]->eNodeType == SNT_CONSTANT &&
+        apoValues[1]->eNodeType == SNT_COLUMN)
+    {
+        std::swap(apoValues[0], apoValues[1]);
+        sInstr.bSwapped = true;
+        if (eOp == SWQ_LT)
+            sInstr.eOp = SWQ_GT;
+        else if (eOp == SWQ_LE)
+            sInstr.eOp = SWQ_GE;
+        else if (eOp == SWQ_GT)
+            sInstr.eOp = SWQ_LT;
+        else if (eOp == SWQ_GE)
+            sInstr.eOp = SWQ_LE;
+    }
+
+    const swq_expr_node *poColumn = apoValues[0];
+    if (!IsSupportedColumn(poColumn))
+        return false;
+    for (int i = 1; i < nCount; ++i)
+    {
+        if (apoValues[i]->eNodeType != SNT_CONSTANT || apoValues[i]->is_null)
+            return false;
+    }
+
+    sInstr.eFieldType = poColumn->field_type;
+    sInstr.iField =
+        OGRFeatureFetcherFixFieldIndex(poDefn, poColumn->field_index);
+
+    // Select the same code path as SWQGeneralEvaluator()
+    const swq_field_type eColType = poColumn->field_type;
+    const swq_field_type eFirstType = apoValues[1]->field_type;
+    if (eColType == SWQ_FLOAT || eFirstType == SWQ_FLOAT)
+    {
+        if (eColType == SWQ_STRING || eColType == SWQ_BOOLEAN)
+            return false;
+        std::vector<double> adfValues;
+        for (int i = 1; i < nCount; ++i)
+        {
+            const auto eType = apoValues[i]->field_type;
+            if (i == 1 && SWQ_IS_INTEGER(eType))
+                adfValues.push_back(
+                    static_cast<double>(apoValues[i]->int_value));
+            else if (eType == SWQ_FLOAT)
+                adfValues.push_back(apoValues[i]->float_value);
+            else
+                return false;
+        }
+        if (eOp == SWQ_IN)
+        {
+            sInstr.eOpcode = Opcode::DOUBLE_IN;
+            sInstr.nIdx1 = aoDoubleSets.size();
+            aoDoubleSets.emplace_back();
+            for (const double dfValue : adfValues)
+            {
+                // -0 == 0, and NaN is never equal to anything
+                if (!std::isnan(dfValue))
+                    aoDoubleSets.back().insert(dfValue == 0 ? 0.0 : dfValue);
+            }
+        }
+        else
+        {
+            sInstr.eOpcode = Opcode::DOUBLE_CMP;
+            sInstr.dfValue1 = adfValues[0];
+            if (nCount == 3)
+                sInstr.dfValue2 = adfValues[1];
+        }
+    }
+    else if (IsIntegerLike(eColType))
+    {
+        std::vector<GIntBig> anValues;
+        for (int i = 1; i < nCount; ++i)
+        {
+            if (!IsIntegerLike(apoValues[i]->field_type))
+                return false;
+            anValues.push_back(apoValues[i]->int_value);
+        }
+        if (eOp == SWQ_IN)
+        {
+            sInstr.eOpcode = Opcode::INT_IN;
+            sInstr.nIdx1 = aoIntSets.size();
+            aoIntSets.emplace_back(anValues.begin(), anValues.end());
+        }
+        else
+        {
+            sInstr.eOpcode = Opcode::INT_CMP;
+            sInstr.nValue1 = anValues[0];
+            if (nCount == 3)
+                sInstr.nValue2 = anValues[1];
+        }
+    }
+    else
+    {
+        CPLAssert(eColType == SWQ_STRING);
+        for (int i = 1; i < nCount; ++i)
+        {
+            if (apoValues[i]->field_type != SWQ_STRING ||
+                apoValues[i]->string_value == nullptr)
+                return false;
+        }
+        if (eOp == SWQ_IN)
+        {
+            sInstr.eOpcode = Opcode::STRING_IN;
+            sInstr.nIdx1 = aoStringSets.size();
+            aoStringSets.emplace_back();
+            for (int i = 1; i < nCount; ++i)
+            {
+                aoStringSets.back().insert(
+                    ToLowerASCII(apoValues[i]->string_value, osTmp));
+            }
+        }
+        else
+        {
+            sInstr.eOpcode = Opcode::STRING_CMP;
+            sInstr.nIdx1 = aosStrings.size();
+            aosStrings.push_back(apoValues[1]->string_value);
+            if (nCount == 3)
+            {
+                sInstr.nIdx2 = aosStrings.size();
+                aosStrings.push_back(apoValues[2]->string_value);
+            }
+        }
+    }
+
+    asInstructions.push_back(sInstr);
+    return true;
+}
+
+/************************************************************************/
+/*                OGRFeatureQueryProgram::CompileLike()                 */
+/************************************************************************/
+
+bool OGRFeatureQueryProgram::CompileLike(const swq_expr_node *poNode,
+                                         OGRFeatureDefn *poDefn)
+{
+    const int nCount = poNode->nSubExprCount;
+    if (nCount != 2 && nCount != 3)
+        return false;
+    const swq_expr_node *poColumn = poNode->papoSubExpr[0];
+    if (!IsSupportedColumn(poColumn) || poColumn->field_type != SWQ_STRING)
+        return false;
+    for (int i = 1; i < nCount; ++i)
+    {
+        const swq_expr_node *poValue = poNode->papoSubExpr[i];
+        if (poValue->eNodeType != SNT_CONSTANT || poValue->is_null ||
+            poValue->field_type != SWQ_STRING ||
+            poValue->string_value == nullptr)
+            return false;
+    }
+
+    Instruction sInstr;
+    sInstr.eFieldType = SWQ_STRING;
+    sInstr.iField =
+        OGRFeatureFetcherFixFieldIndex(poDefn, poColumn->field_index);
+    sInstr.chEscape =
+        nCount == 3 ? poNode->papoSubExpr[2]->string_value[0] : '\0';
+    sInstr.bInsensitive =
+        poNode->nOperation == SWQ_ILIKE ||
+        CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+
+    // Recognize patterns made of a literal and a leading and/or trailing %,
+    // matched byte-wise when case-sensitive.
+    std::string osPattern(poNode->papoSubExpr[1]->string_value);
+    sInstr.eOpcode = Opcode::LIKE_GENERIC;
+    if (!sInstr.bInsensitive && sInstr.chEscape == '\0' &&
+        osPattern.find('_') == std::string::npos)
+    {
+        const bool bLeading = !osPattern.empty() && osPattern.front() == '%';
+        const bool bTrailing =
+            osPattern.size() >= 2 && osPattern.back() == '%';
+        std::string osLiteral(osPattern);
+        if (bLeading)
+            osLiteral.erase(0, 1);
+        if (bTrailing)
+            osLiteral.pop_back();
+        if (osPattern == "%")
+            sInstr.eOpcode = Opcode::LIKE_ALL;
+        else if (osLiteral.find('%') == std::string::npos &&
+                 (osLiteral.size() > 0 || (!bLeading && !bTrailing)))
+        {
+            sInstr.eOpcode = bLeading && bTrailing ? Opcode::LIKE_CONTAINS
+                             : bLeading            ? Opcode::LIKE_SUFFIX
+                             : bTrailing           ? Opcode::LIKE_PREFIX
+                                                   : Opcode::LIKE_EXACT;
+            osPattern = std::move(osLiteral);
+        }
+    }
+    sInstr.nIdx1 = aosStrings.size();
+    aosStrings.push_back(std::move(osPattern));
+
+    asInstructions.push_back(sInstr);
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRFeatureQueryProgram::Evaluate()                   */
+/************************************************************************/
+
+template <class T>
+static bool OGRFeatureQueryCompare(T val, swq_op eOp, T val1, T val2)
+{
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            return val == val1;
+        case SWQ_NE:
+            return val != val1;
+        case SWQ_LT:
+            return val < val1;
+        case SWQ_LE:
+            return val <= val1;
+        case SWQ_GT:
+            return val > val1;
+        case SWQ_GE:
+            return val >= val1;
+        case SWQ_BETWEEN:
+            return val >= val1 && val <= val2;
+        default:
+            break;
+    }
+    return false;
+}
+
+// Same as the SWQ_EQ case of the string operations of
+// SWQGeneralEvaluator(): a trailing +00 timezone may be ignored.
+static bool OGRFeatureQueryStringEqual(const char *pszA, const char *pszB)
+{
+    const size_t nLenA = strlen(pszA);
+    const size_t nLenB = strlen(pszB);
+    if (nLenA > 3 && nLenB > 3 && strcmp(pszA + nLenA - 3, "+00") == 0 &&
+        pszB[nLenB - 3] == ':')
+    {
+        return EQUALN(pszA, pszB, nLenB);
+    }
+    if (nLenA > 3 && nLenB > 3 && pszA[nLenA - 3] == ':' &&
+        strcmp(pszB + nLenB - 3, "+00") == 0)
+    {
+        return EQUALN(pszA, pszB, nLenA);
+    }
+    return strcasecmp(pszA, pszB) == 0;
+}
+
+bool OGRFeatureQueryProgram::Evaluate(OGRFeature *poFeature, size_t iInstr,
+                                      const swq_evaluation_context &sContext)
+{
+    const Instruction &sInstr = asInstructions[iInstr];
+    switch (sInstr.eOpcode)
+    {
+        case Opcode::CONSTANT:
+            return sInstr.bValue;
+        case Opcode::AND:
+            return Evaluate(poFeature, iInstr + 1, sContext) &&
+                   Evaluate(poFeature,
+                            iInstr + 1 + asInstructions[iInstr + 1].nSize,
+                            sContext);
+        case Opcode::OR:
+            return Evaluate(poFeature, iInstr + 1, sContext) ||
+                   Evaluate(poFeature,
+                            iInstr + 1 + asInstructions[iInstr + 1].nSize,
+                            sContext);
+        case Opcode::NOT:
+            return !Evaluate(poFeature, iInstr + 1, sContext);
+        case Opcode::IS_NULL:
+            return !poFeature->IsFieldSetAndNotNull(sInstr.iField);
+        default:
+            break;
+    }
+
+    const int iField = sInstr.iField;
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    switch (sInstr.eOpcode)
+    {
+        case Opcode::INT_CMP:
+        case Opcode::INT_IN:
+        {
+            const GIntBig nVal = sInstr.eFieldType == SWQ_INTEGER64
+                                     ? poFeature->GetFieldAsInteger64(iField)
+                                     : poFeature->GetFieldAsInteger(iField);
+            if (sInstr.eOpcode == Opcode::INT_IN)
+                return aoIntSets[sInstr.nIdx1].count(nVal) != 0;
+            return OGRFeatureQueryCompare(nVal, sInstr.eOp, sInstr.nValue1,
+                                          sInstr.nValue2);
+        }
+
+        case Opcode::DOUBLE_CMP:
+        case Opcode::DOUBLE_IN:
+        {
+            double dfVal;
+            if (sInstr.eFieldType == SWQ_FLOAT)
+                dfVal = poFeature->GetFieldAsDouble(iField);
+            else if (sInstr.eFieldType == SWQ_INTEGER64)
+                dfVal =
+                    static_cast<double>(poFeature->GetFieldAsInteger64(iField));
+            else
+                dfVal = poFeature->GetFieldAsInteger(iField);
+            if (sInstr.eOpcode == Opcode::DOUBLE_IN)
+                return aoDoubleSets[sInstr.nIdx1].count(
+                           dfVal == 0 ? 0.0 : dfVal) != 0;
+            return OGRFeatureQueryCompare(dfVal, sInstr.eOp, sInstr.dfValue1,
+                                          sInstr.dfValue2);
+        }
+
+        case Opcode::STRING_CMP:
+        {
+            const char *pszVal = poFeature->GetFieldAsString(iField);
+            const char *pszValue1 = aosStrings[sInstr.nIdx1].c_str();
+            if (sInstr.eOp == SWQ_EQ)
+            {
+                return sInstr.bSwapped
+                           ? OGRFeatureQueryStringEqual(pszValue1, pszVal)
+                           : OGRFeatureQueryStringEqual(pszVal, pszValue1);
+            }
+            const int nCmp = strcasecmp(pszVal, pszValue1);
+            if (sInstr.eOp == SWQ_BETWEEN)
+                return nCmp >= 0 &&
+                       strcasecmp(pszVal,
+                                  aosStrings[sInstr.nIdx2].c_str()) <= 0;
+            return OGRFeatureQueryCompare(nCmp, sInstr.eOp, 0, 0);
+        }
+
+        case Opcode::STRING_IN:
+            return aoStringSets[sInstr.nIdx1].count(ToLowerASCII(
+                       poFeature->GetFieldAsString(iField), osTmp)) != 0;
+
+        case Opcode::LIKE_EXACT:
+            return strcmp(poFeature->GetFieldAsString(iField),
+                          aosStrings[sInstr.nIdx1].c_str()) == 0;
+
+        case Opcode::LIKE_PREFIX:
+        {
+            const std::string &osPrefix = aosStrings[sInstr.nIdx1];
+            return strncmp(poFeature->GetFieldAsString(iField),
+                           osPrefix.c_str(), osPrefix.size()) == 0;
+        }
+
+        case Opcode::LIKE_SUFFIX:
+        {
+            const std::string &osSuffix = aosStrings[sInstr.nIdx1];
+            const char *pszVal = poFeature->GetFieldAsString(iField);
+            const size_t nLen = strlen(pszVal);
+            return nLen >= osSuffix.size() &&
+                   memcmp(pszVal + nLen - osSuffix.size(), osSuffix.c_str(),
+                          osSuffix.size()) == 0;
+        }
+
+        case Opcode::LIKE_CONTAINS:
+            return strstr(poFeature->GetFieldAsString(iField),
+                          aosStrings[sInstr.nIdx1].c_str()) != nullptr;
+
+        case Opcode::LIKE_ALL:
+            return true;
+
+        case Opcode::LIKE_GENERIC:
+            return swq_test_like(poFeature->GetFieldAsString(iField),
+                                 aosStrings[sInstr.nIdx1].c_str(),
+                                 sInstr.chEscape, sInstr.bInsensitive,
+                                 sContext.bUTF8Strings) != 0;
+
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                          OGRFeatureQuery()                           */
 /************************************************************************/
 
 OGRFeatureQuery::OGRFeatureQuery()
     : poTargetDefn(nullptr), pSWQExpr(nullptr),
-      m_psContext(new swq_evaluation_context())
+      m_psContext(new swq_evaluation_context()), m_poProgram(nullptr)
 {
 }
 
@@ -122,6 +730,7 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         delete static_cast<swq_expr_node *>(pSWQExpr);
         pSWQExpr = nullptr;
     }
+    m_poProgram.reset();
 
     const char *pszFIDColumn = nullptr;
     bool bMustAddFID = false;
@@ -243,6 +852,16 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (CPLTestBool(
+                 CPLGetConfigOption("OGR_SQL_COMPILED_FILTER", "YES")))
+    {
+        m_poProgram = std::make_unique<OGRFeatureQueryProgram>();
+        if (!m_poProgram->Compile(static_cast<swq_expr_node *>(pSWQExpr),
+                                  poDefn, *m_psContext, 0))
+        {
+            m_poProgram.reset();
+        }
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -328,6 +947,9 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poProgram)
+        return m_poProgram->Evaluate(poFeature, 0, *m_psContext);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -345,6 +967,183 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     return bLogicalResult;
 }
 
+/************************************************************************/
+/*                        GetIndexRangeOfExpr()                         */
+/*                                                                      */
+/*      Compute the interval of values of an indexed field that         */
+/*      contains the features matching a >, >=, <, <=, BETWEEN or       */
+/*      LIKE 'prefix%' expression. The interval may be larger than      */
+/*      the exact set of matching values, as the features returned      */
+/*      from the index are evaluated against the full expression.      */
+/************************************************************************/
+
+namespace
+{
+struct OGRIndexRange
+{
+    OGRAttrIndex *poIndex = nullptr;
+    bool bEmpty = false;
+    bool bHasMin = false;
+    bool bHasMax = false;
+    OGRField sMin{};
+    OGRField sMax{};
+    std::string osMin{};
+    std::string osMax{};
+};
+}  // namespace
+
+static bool GetIndexRangeOfExpr(const swq_expr_node *psExpr,
+                                OGRLayer *poLayer, OGRIndexRange &sRange)
+{
+    const swq_op eOp = psExpr->nOperation;
+    const int nCount = psExpr->nSubExprCount;
+    const bool bIsLike = eOp == SWQ_LIKE || eOp == SWQ_ILIKE;
+    const bool bIsComparison =
+        eOp == SWQ_GT || eOp == SWQ_GE || eOp == SWQ_LT || eOp == SWQ_LE;
+    if (!((bIsComparison && nCount == 2) ||
+          (eOp == SWQ_BETWEEN && nCount == 3) ||
+          (bIsLike && (nCount == 2 || nCount == 3))))
+    {
+        return false;
+    }
+
+    // Put the column first, reversing the comparison if needed
+    const swq_expr_node *poColumn = psExpr->papoSubExpr[0];
+    const swq_expr_node *poValue = psExpr->papoSubExpr[1];
+    swq_op eCmpOp = eOp;
+    if (bIsComparison && poColumn->eNodeType == SNT_CONSTANT &&
+        poValue->eNodeType == SNT_COLUMN)
+    {
+        std::swap(poColumn, poValue);
+        eCmpOp = eOp == SWQ_GT   ? SWQ_LT
+                 : eOp == SWQ_GE ? SWQ_LE
+                 : eOp == SWQ_LT ? SWQ_GT
+                                 : SWQ_GE;
+    }
+    if (poColumn->eNodeType != SNT_COLUMN)
+        return false;
+    for (int i = 1; i < nCount; ++i)
+    {
+        const swq_expr_node *poSubExpr =
+            i == 1 ? poValue : psExpr->papoSubExpr[i];
+        if (poSubExpr->eNodeType != SNT_CONSTANT || poSubExpr->is_null)
+            return false;
+    }
+
+    OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    const int nIdx =
+        OGRFeatureFetcherFixFieldIndex(poDefn, poColumn->field_index);
+    if (nIdx < 0 || nIdx >= poDefn->GetFieldCount())
+        return false;
+    sRange.poIndex = poLayer->GetIndex()->GetFieldIndex(nIdx);
+    if (sRange.poIndex == nullptr)
+        return false;
+    const OGRFieldType eType = poDefn->GetFieldDefn(nIdx)->GetType();
+
+    if (bIsLike)
+    {
+        if (eType != OFTString || poValue->field_type != SWQ_STRING ||
+            poValue->string_value == nullptr ||
+            (nCount == 3 &&
+             (psExpr->papoSubExpr[2]->field_type != SWQ_STRING ||
+              psExpr->papoSubExpr[2]->string_value == nullptr)))
+        {
+            return false;
+        }
+        const char chEscape =
+            nCount == 3 ? psExpr->papoSubExpr[2]->string_value[0] : '\0';
+        const bool bInsensitive =
+            eOp == SWQ_ILIKE ||
+            CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+
+        // Literal prefix of the pattern. Keys are upper-cased in ASCII, so
+        // stop at the first non-ASCII character when case-insensitive.
+        for (const char *pszIter = poValue->string_value;
+             *pszIter != '\0' && *pszIter != '%' && *pszIter != '_' &&
+             *pszIter != chEscape;
+             ++pszIter)
+        {
+            if (bInsensitive && (static_cast<unsigned char>(*pszIter) & 0x80))
+                break;
+            sRange.osMin += *pszIter;
+        }
+        if (sRange.osMin.empty())
+            return false;
+        // Greater or equal to any key starting with the prefix
+        sRange.osMax = sRange.osMin + std::string(256, '\xFF');
+        sRange.bHasMin = true;
+        sRange.bHasMax = true;
+        sRange.sMin.String = &sRange.osMin[0];
+        sRange.sMax.String = &sRange.osMax[0];
+        return true;
+    }
+
+    if (eType != OFTInteger && eType != OFTReal)
+        return false;
+
+    double adfValues[2] = {0, 0};
+    for (int i = 1; i < nCount; ++i)
+    {
+        const swq_expr_node *poSubExpr =
+            i == 1 ? poValue : psExpr->papoSubExpr[i];
+        if (poSubExpr->field_type == SWQ_FLOAT)
+            adfValues[i - 1] = poSubExpr->float_value;
+        else if (SWQ_IS_INTEGER(poSubExpr->field_type))
+            adfValues[i - 1] = static_cast<double>(poSubExpr->int_value);
+        else
+            return false;
+        if (std::isnan(adfValues[i - 1]))
+            return false;
+    }
+
+    // Strict comparisons are handled as non-strict ones
+    double dfMin = -std::numeric_limits<double>::infinity();
+    double dfMax = std::numeric_limits<double>::infinity();
+    if (eCmpOp == SWQ_GT || eCmpOp == SWQ_GE)
+        dfMin = adfValues[0];
+    else if (eCmpOp == SWQ_LT || eCmpOp == SWQ_LE)
+        dfMax = adfValues[0];
+    else
+    {
+        dfMin = adfValues[0];
+        dfMax = adfValues[1];
+    }
+
+    if (eType == OFTInteger)
+    {
+        dfMin = std::ceil(dfMin);
+        dfMax = std::floor(dfMax);
+        if (dfMin > INT_MAX || dfMax < INT_MIN || dfMin > dfMax)
+        {
+            sRange.bEmpty = true;
+            return true;
+        }
+        if (dfMin > INT_MIN)
+        {
+            sRange.bHasMin = true;
+            sRange.sMin.Integer = static_cast<int>(dfMin);
+        }
+        if (dfMax < INT_MAX)
+        {
+            sRange.bHasMax = true;
+            sRange.sMax.Integer = static_cast<int>(dfMax);
+        }
+    }
+    else
+    {
+        if (dfMin > dfMax)
+        {
+            sRange.bEmpty = true;
+            return true;
+        }
+        sRange.bHasMin = !std::isinf(dfMin);
+        sRange.sMin.Real = dfMin;
+        sRange.bHasMax = !std::isinf(dfMax);
+        sRange.sMax.Real = dfMax;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                            CanUseIndex()                             */
 /************************************************************************/
@@ -366,13 +1165,24 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
     if (psExpr == nullptr || psExpr->eNodeType != SNT_OPERATION)
         return FALSE;
 
-    if ((psExpr->nOperation == SWQ_OR || psExpr->nOperation == SWQ_AND) &&
-        psExpr->nSubExprCount == 2)
+    if (psExpr->nOperation == SWQ_OR && psExpr->nSubExprCount == 2)
     {
         return CanUseIndex(psExpr->papoSubExpr[0], poLayer) &&
                CanUseIndex(psExpr->papoSubExpr[1], poLayer);
     }
 
+    // The index of one side of an AND is enough to restrict the features
+    // to evaluate.
+    if (psExpr->nOperation == SWQ_AND && psExpr->nSubExprCount == 2)
+    {
+        return CanUseIndex(psExpr->papoSubExpr[0], poLayer) ||
+               CanUseIndex(psExpr->papoSubExpr[1], poLayer);
+    }
+
+    OGRIndexRange sRange;
+    if (GetIndexRangeOfExpr(psExpr, poLayer, sRange))
+        return TRUE;
+
     if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
         psExpr->nSubExprCount < 2)
         return FALSE;
@@ -575,7 +1385,7 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         GIntBig *panFIDList1 =
             EvaluateAgainstIndices(psExpr->papoSubExpr[0], poLayer, nFIDCount1);
         GIntBig *panFIDList2 =
-            panFIDList1 == nullptr
+            panFIDList1 == nullptr && psExpr->nOperation == SWQ_OR
                 ? nullptr
                 : EvaluateAgainstIndices(psExpr->papoSubExpr[1], poLayer,
                                          nFIDCount2);
@@ -591,11 +1401,51 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
                     OGRANDGIntBigArray(panFIDList1, nFIDCount1, panFIDList2,
                                        nFIDCount2, nFIDCount);
         }
+        else if (psExpr->nOperation == SWQ_AND)
+        {
+            // The features matching the AND are among the ones matching
+            // the indexed side, and they are evaluated against the full
+            // expression afterwards.
+            if (panFIDList1 != nullptr)
+            {
+                nFIDCount = nFIDCount1;
+                return panFIDList1;
+            }
+            if (panFIDList2 != nullptr)
+            {
+                nFIDCount = nFIDCount2;
+                return panFIDList2;
+            }
+        }
         CPLFree(panFIDList1);
         CPLFree(panFIDList2);
         return panFIDList;
     }
 
+    OGRIndexRange sRange;
+    if (GetIndexRangeOfExpr(psExpr, poLayer, sRange))
+    {
+        if (sRange.bEmpty)
+        {
+            GIntBig *panFIDs =
+                static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig)));
+            panFIDs[0] = OGRNullFID;
+            nFIDCount = 0;
+            return panFIDs;
+        }
+        int nFIDCount32 = 0;
+        GIntBig *panFIDs = sRange.poIndex->GetRangeMatches(
+            sRange.bHasMin ? &sRange.sMin : nullptr,
+            sRange.bHasMax ? &sRange.sMax : nullptr, &nFIDCount32);
+        nFIDCount = nFIDCount32;
+        if (panFIDs != nullptr && nFIDCount > 1)
+        {
+            // The returned FIDs are expected to be sorted.
+            std::sort(panFIDs, panFIDs + nFIDCount);
+        }
+        return panFIDs;
+    }
+
     if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
         psExpr->nSubExprCount < 2)
         return nullptr;
@@ -30,17 +30,22 @@
 #include "cpl_port.h"
 #include "ogr_geometry.h"
 
+#include <algorithm>
 #include <climits>
+#include <cmath>
 #include <cstdarg>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "ogr_api.h"
@@ -52,6 +57,7 @@
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
 #include "ogr_wkb.h"
+#include "gdal_thread_pool.h"
 
 #ifndef HAVE_GEOS
 #define UNUSED_IF_NO_GEOS CPL_UNUSED
@@ -1504,6 +1510,11 @@ OGRErr OGRGeometry::importFromWkb(const GByte *pabyData, size_t nSize,
  *
  * This method is the same as the C function OGR_G_ImportFromWkb().
  *
+ * When called on a geometry that already has content, polygon rings,
+ * sub-geometries of collections and coordinate arrays are reused as much as
+ * possible (Since GDAL 3.10), so that drivers decoding a stream of similar
+ * geometries into the same object avoid most dynamic memory allocations.
+ *
  * @param pabyData the binary input data.
  * @param nSize the size of pabyData in bytes, or -1 if not known.
  * @param eWkbVariant if wkbVariantPostGIS1, special interpretation is
@@ -6707,6 +6718,31 @@ int OGRPreparedGeometryIntersects(
         return FALSE;
     }
 
+    // Points are by far the most common case when filtering features, and
+    // do not need to go through the WKB serialization of exportToGEOS().
+    if (wkbFlatten(poOtherGeom->getGeometryType()) == wkbPoint)
+    {
+        const OGRPoint *poPoint = poOtherGeom->toPoint();
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+        return GEOSPreparedIntersectsXY_r(hPreparedGeom->hGEOSCtxt,
+                                          hPreparedGeom->poPreparedGEOSGeom,
+                                          poPoint->getX(),
+                                          poPoint->getY()) == 1;
+#else
+        GEOSGeom hGEOSPoint = GEOSGeom_createPointFromXY_r(
+            hPreparedGeom->hGEOSCtxt, poPoint->getX(), poPoint->getY());
+        if (hGEOSPoint == nullptr)
+            return FALSE;
+        const bool bRet =
+            GEOSPreparedIntersects_r(hPreparedGeom->hGEOSCtxt,
+                                     hPreparedGeom->poPreparedGEOSGeom,
+                                     hGEOSPoint) == 1;
+        GEOSGeom_destroy_r(hPreparedGeom->hGEOSCtxt, hGEOSPoint);
+        return bRet;
+#endif
+    }
+
     GEOSGeom hGEOSOtherGeom =
         poOtherGeom->exportToGEOS(hPreparedGeom->hGEOSCtxt);
     if (hGEOSOtherGeom == nullptr)
@@ -6723,6 +6759,60 @@ int OGRPreparedGeometryIntersects(
 #endif
 }
 
+/************************************************************************/
+/*                    OGRPreparedGeometryIntersectsWKB()                */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Returns whether a prepared geometry intersects with a WKB geometry.
+ *
+ * The WKB geometry is directly converted to a GEOS geometry, without
+ * instantiating an intermediate OGRGeometry.
+ *
+ * @param hPreparedGeom prepared geometry.
+ * @param pabyWKB WKB geometry.
+ * @param nWKBSize size of pabyWKB in bytes.
+ * @return 1 if the geometries intersect, 0 if they do not, or -1 if the WKB
+ * geometry could not be directly converted (invalid WKB or unsupported
+ * geometry type), in which case the caller should fallback to
+ * OGRPreparedGeometryIntersects().
+ */
+int OGRPreparedGeometryIntersectsWKB(
+    UNUSED_IF_NO_GEOS const OGRPreparedGeometryH hPreparedGeom,
+    UNUSED_IF_NO_GEOS const GByte *pabyWKB, UNUSED_IF_NO_GEOS size_t nWKBSize)
+{
+#if defined(HAVE_GEOS)
+    if (hPreparedGeom == nullptr)
+        return 0;
+
+    const OGRWKBGeometryView oView(pabyWKB, nWKBSize);
+    if (!oView.IsValid())
+        return -1;
+    // The check for IsEmpty() is for buggy GEOS versions.
+    // See https://github.com/libgeos/geos/pull/423
+    if (oView.IsEmpty())
+        return 0;
+
+    GEOSGeom hGEOSOtherGeom = oView.ExportToGEOS(hPreparedGeom->hGEOSCtxt);
+    if (hGEOSOtherGeom == nullptr)
+        return -1;
+
+    const int nRet =
+        GEOSPreparedIntersects_r(hPreparedGeom->hGEOSCtxt,
+                                 hPreparedGeom->poPreparedGEOSGeom,
+                                 hGEOSOtherGeom) == 1
+            ? 1
+            : 0;
+    GEOSGeom_destroy_r(hPreparedGeom->hGEOSCtxt, hGEOSOtherGeom);
+
+    return nRet;
+#else
+    return -1;
+#endif
+}
+
+//! @endcond
+
 /** Returns whether a prepared geometry contains a geometry.
  * @param hPreparedGeom prepared geometry.
  * @param hOtherGeom other geometry.
@@ -8233,3 +8323,769 @@ void OGRwkbExportOptionsSetPrecision(
     if (hPrecisionOptions)
         psOptions->sPrecision.SetFrom(*hPrecisionOptions);
 }
+
+/************************************************************************/
+/*                      OGRGeometryBatchProcessor                       */
+/************************************************************************/
+
+namespace
+{
+// Minimum number of geometries processed by a job of processGeometries()
+constexpr size_t MIN_GEOMETRIES_PER_JOB = 16;
+
+// Number of threads from the NUM_THREADS option, or GDAL_NUM_THREADS,
+// capped to nMaxJobs
+int GetMaxThreadsFromOptions(CSLConstList papszOptions, size_t nMaxJobs)
+{
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    int nMaxThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszNumThreads);
+    nMaxThreads = std::max(1, std::min(128, nMaxThreads));
+    return static_cast<int>(std::max<size_t>(
+        1, std::min(static_cast<size_t>(nMaxThreads), nMaxJobs)));
+}
+
+// Same as the protected OGRGeometry::IsSFCGALCompatible()
+bool IsSFCGALCompatibleGeometry(const OGRGeometry *poGeom)
+{
+    const OGRwkbGeometryType eGType = wkbFlatten(poGeom->getGeometryType());
+    if (eGType == wkbTriangle || eGType == wkbPolyhedralSurface ||
+        eGType == wkbTIN)
+    {
+        return true;
+    }
+    if (eGType == wkbGeometryCollection || eGType == wkbMultiSurface)
+    {
+        bool bIsSFCGALCompatible = false;
+        for (const auto *poSubGeom : *(poGeom->toGeometryCollection()))
+        {
+            const OGRwkbGeometryType eSubGeomType =
+                wkbFlatten(poSubGeom->getGeometryType());
+            if (eSubGeomType == wkbTIN || eSubGeomType == wkbPolyhedralSurface)
+                bIsSFCGALCompatible = true;
+            else if (eSubGeomType != wkbMultiPolygon)
+                return false;
+        }
+        return bIsSFCGALCompatible;
+    }
+    return false;
+}
+
+class OGRGeometryBatchProcessor
+{
+  public:
+    using BatchOperation = OGRGeometryFactory::BatchOperation;
+
+    // Returns the input geometry of index i. poHolder may be used to own it.
+    using InputGetter = std::function<const OGRGeometry *(
+        size_t i, std::unique_ptr<OGRGeometry> &poHolder)>;
+    // Receives the result for the geometry of index i (possibly null).
+    using OutputSetter =
+        std::function<void(size_t i, std::unique_ptr<OGRGeometry> poGeom)>;
+
+    OGRGeometryBatchProcessor(BatchOperation eOperation,
+                              const OGRGeometry *poOtherGeom,
+                              CSLConstList papszOptions)
+        : m_eOperation(eOperation), m_poOtherGeom(poOtherGeom),
+          m_papszOptions(papszOptions),
+          m_dfDistance(
+              CPLAtof(CSLFetchNameValueDef(papszOptions, "DISTANCE", "0"))),
+          m_nQuadSegs(atoi(CSLFetchNameValueDef(papszOptions, "QUADSEGS",
+                                                "30"))),
+          m_dfTolerance(
+              CPLAtof(CSLFetchNameValueDef(papszOptions, "TOLERANCE", "0")))
+    {
+    }
+
+    bool Run(size_t nCount, const InputGetter &getInput,
+             const OutputSetter &setOutput) const;
+
+  private:
+    const BatchOperation m_eOperation;
+    const OGRGeometry *const m_poOtherGeom;
+    const CSLConstList m_papszOptions;
+    const double m_dfDistance;
+    const int m_nQuadSegs;
+    const double m_dfTolerance;
+
+    struct Job
+    {
+        const OGRGeometryBatchProcessor *poThis = nullptr;
+        const InputGetter *pGetInput = nullptr;
+        const OutputSetter *pSetOutput = nullptr;
+        size_t nStart = 0;
+        size_t nEnd = 0;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    static void ProcessJob(void *pData);
+
+    std::unique_ptr<OGRGeometry>
+    ProcessOne(const OGRGeometry *poGeom, GEOSContextHandle_t hGEOSCtxt,
+               GEOSGeom hOtherGeosGeom) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeometryBatchProcessor)
+};
+
+/************************************************************************/
+/*                             ProcessOne()                             */
+/************************************************************************/
+
+// Same as the corresponding OGRGeometry method, but re-using hGEOSCtxt and
+// the already converted other geometry.
+std::unique_ptr<OGRGeometry> OGRGeometryBatchProcessor::ProcessOne(
+    const OGRGeometry *poGeom, UNUSED_IF_NO_GEOS GEOSContextHandle_t hGEOSCtxt,
+    UNUSED_IF_NO_GEOS GEOSGeom hOtherGeosGeom) const
+{
+    const auto DelegateToGeometry = [this, poGeom]()
+    {
+        switch (m_eOperation)
+        {
+            case BatchOperation::BUFFER:
+                return std::unique_ptr<OGRGeometry>(
+                    poGeom->Buffer(m_dfDistance, m_nQuadSegs));
+            case BatchOperation::MAKE_VALID:
+                return std::unique_ptr<OGRGeometry>(
+                    poGeom->MakeValid(m_papszOptions));
+            case BatchOperation::SIMPLIFY_PRESERVE_TOPOLOGY:
+                return std::unique_ptr<OGRGeometry>(
+                    poGeom->SimplifyPreserveTopology(m_dfTolerance));
+            case BatchOperation::INTERSECTION:
+                break;
+        }
+        return std::unique_ptr<OGRGeometry>(
+            poGeom->Intersection(m_poOtherGeom));
+    };
+
+#ifndef HAVE_GEOS
+    return DelegateToGeometry();
+#else
+    // Cases handled by SFCGAL, or needing a validity check first
+    if (hGEOSCtxt == nullptr || IsSFCGALCompatibleGeometry(poGeom) ||
+        (m_eOperation == BatchOperation::MAKE_VALID &&
+         wkbFlatten(poGeom->getGeometryType()) == wkbCurvePolygon) ||
+        (m_eOperation == BatchOperation::MAKE_VALID &&
+         EQUAL(CSLFetchNameValueDef(m_papszOptions, "METHOD", "LINEWORK"),
+               "STRUCTURE")))
+    {
+        return DelegateToGeometry();
+    }
+
+    GEOSGeom hGeosGeom = poGeom->exportToGEOS(hGEOSCtxt);
+    if (hGeosGeom == nullptr)
+        return nullptr;
+
+    std::unique_ptr<OGRGeometry> poRet;
+    switch (m_eOperation)
+    {
+        case BatchOperation::BUFFER:
+        {
+            GEOSGeom hGeosProduct =
+                GEOSBuffer_r(hGEOSCtxt, hGeosGeom, m_dfDistance, m_nQuadSegs);
+            poRet.reset(BuildGeometryFromGEOS(hGEOSCtxt, hGeosProduct,
+                                              poGeom, nullptr));
+            break;
+        }
+
+        case BatchOperation::MAKE_VALID:
+        {
+            GEOSGeom hGeosProduct = GEOSMakeValid_r(hGEOSCtxt, hGeosGeom);
+            if (hGeosProduct)
+            {
+                poRet.reset(OGRGeometryFactory::createFromGEOS(hGEOSCtxt,
+                                                               hGeosProduct));
+                if (poRet && poGeom->getSpatialReference())
+                    poRet->assignSpatialReference(
+                        poGeom->getSpatialReference());
+                poRet.reset(OGRGeometryRebuildCurves(poGeom, nullptr,
+                                                     poRet.release()));
+                GEOSGeom_destroy_r(hGEOSCtxt, hGeosProduct);
+            }
+            break;
+        }
+
+        case BatchOperation::SIMPLIFY_PRESERVE_TOPOLOGY:
+        {
+            GEOSGeom hGeosProduct = GEOSTopologyPreserveSimplify_r(
+                hGEOSCtxt, hGeosGeom, m_dfTolerance);
+            poRet.reset(BuildGeometryFromGEOS(hGEOSCtxt, hGeosProduct,
+                                              poGeom, nullptr));
+            break;
+        }
+
+        case BatchOperation::INTERSECTION:
+        {
+            if (hOtherGeosGeom)
+            {
+                GEOSGeom hGeosProduct =
+                    GEOSIntersection_r(hGEOSCtxt, hGeosGeom, hOtherGeosGeom);
+                poRet.reset(BuildGeometryFromGEOS(hGEOSCtxt, hGeosProduct,
+                                                  poGeom, m_poOtherGeom));
+            }
+            break;
+        }
+    }
+    GEOSGeom_destroy_r(hGEOSCtxt, hGeosGeom);
+    return poRet;
+#endif
+}
+
+/************************************************************************/
+/*                             ProcessJob()                             */
+/************************************************************************/
+
+void OGRGeometryBatchProcessor::ProcessJob(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    const auto poThis = psJob->poThis;
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+
+    // One GEOS context, and one conversion of the other geometry, per job
+    GEOSContextHandle_t hGEOSCtxt = nullptr;
+    GEOSGeom hOtherGeosGeom = nullptr;
+#ifdef HAVE_GEOS
+    hGEOSCtxt = OGRGeometry::createGEOSContext();
+    if (poThis->m_eOperation == BatchOperation::INTERSECTION &&
+        !IsSFCGALCompatibleGeometry(poThis->m_poOtherGeom))
+    {
+        hOtherGeosGeom = poThis->m_poOtherGeom->exportToGEOS(hGEOSCtxt);
+    }
+#endif
+
+    for (size_t i = psJob->nStart; i < psJob->nEnd; ++i)
+    {
+        std::unique_ptr<OGRGeometry> poHolder;
+        const OGRGeometry *poGeom = (*psJob->pGetInput)(i, poHolder);
+        std::unique_ptr<OGRGeometry> poRet;
+        if (poGeom)
+        {
+            if (poThis->m_eOperation == BatchOperation::INTERSECTION &&
+                (hOtherGeosGeom == nullptr ||
+                 IsSFCGALCompatibleGeometry(poGeom)))
+            {
+                poRet = poThis->ProcessOne(poGeom, nullptr, nullptr);
+            }
+            else
+            {
+                poRet = poThis->ProcessOne(poGeom, hGEOSCtxt, hOtherGeosGeom);
+            }
+        }
+        (*psJob->pSetOutput)(i, std::move(poRet));
+    }
+
+#ifdef HAVE_GEOS
+    if (hOtherGeosGeom)
+        GEOSGeom_destroy_r(hGEOSCtxt, hOtherGeosGeom);
+    OGRGeometry::freeGEOSContext(hGEOSCtxt);
+#endif
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+bool OGRGeometryBatchProcessor::Run(size_t nCount, const InputGetter &getInput,
+                                    const OutputSetter &setOutput) const
+{
+    if (m_eOperation == BatchOperation::INTERSECTION && !m_poOtherGeom)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "An other geometry must be provided for INTERSECTION");
+        return false;
+    }
+
+    GDALThreadReservation oThreadReservation(GetMaxThreadsFromOptions(
+        m_papszOptions, nCount / MIN_GEOMETRIES_PER_JOB));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    const int nJobs = poJobQueue ? nThreads : 1;
+    std::vector<Job> asJobs(nJobs);
+    const size_t nPerJob = (nCount + static_cast<size_t>(nJobs) - 1) / nJobs;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        Job &sJob = asJobs[i];
+        sJob.poThis = this;
+        sJob.pGetInput = &getInput;
+        sJob.pSetOutput = &setOutput;
+        sJob.nStart = std::min(nCount, i * nPerJob);
+        sJob.nEnd = std::min(nCount, sJob.nStart + nPerJob);
+        if (!poJobQueue || !poJobQueue->SubmitJob(ProcessJob, &sJob))
+        {
+            // Run it in the calling thread then
+            ProcessJob(&sJob);
+        }
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    // Re-emit errors in the order of the geometries
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &sError : sJob.aoErrors)
+            CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+    }
+    return true;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                         processGeometries()                          */
+/************************************************************************/
+
+/**
+ * \brief Apply an operation to an array of geometries, in parallel.
+ *
+ * This is equivalent to calling the OGRGeometry method corresponding to
+ * eOperation on each geometry, but a single GEOS context is created for
+ * all the geometries processed by a thread, and for INTERSECTION, the other
+ * geometry is converted to GEOS only once per thread. Geometries are
+ * processed by threads of the global GDAL thread pool.
+ *
+ * Supported options are:
+ * <ul>
+ * <li>DISTANCE=val: buffer distance, for BUFFER. Defaults to 0.</li>
+ * <li>QUADSEGS=n: number of segments used to approximate a quadrant of
+ * circle, for BUFFER. Defaults to 30.</li>
+ * <li>TOLERANCE=val: distance tolerance, for SIMPLIFY_PRESERVE_TOPOLOGY.
+ * Defaults to 0.</li>
+ * <li>METHOD and KEEP_COLLAPSED, for MAKE_VALID: see
+ * OGRGeometry::MakeValid().</li>
+ * <li>NUM_THREADS=n|ALL_CPUS: maximum number of threads. Defaults to the
+ * value of the GDAL_NUM_THREADS configuration option, or 1.</li>
+ * </ul>
+ *
+ * @param eOperation Operation to apply.
+ * @param papoGeoms Array of nCount geometries. Null elements are allowed.
+ * @param nCount Number of geometries.
+ * @param poOtherGeom Other geometry for INTERSECTION. Ignored for other
+ *                    operations.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return a vector of nCount geometries. An element is null when the
+ * corresponding input geometry is null or the operation failed on it.
+ * @since GDAL 3.10
+ */
+
+std::vector<std::unique_ptr<OGRGeometry>> OGRGeometryFactory::processGeometries(
+    BatchOperation eOperation, const OGRGeometry *const *papoGeoms,
+    size_t nCount, const OGRGeometry *poOtherGeom, CSLConstList papszOptions)
+{
+    std::vector<std::unique_ptr<OGRGeometry>> apoRet(nCount);
+    OGRGeometryBatchProcessor oProcessor(eOperation, poOtherGeom,
+                                         papszOptions);
+    oProcessor.Run(
+        nCount,
+        [papoGeoms](size_t i, std::unique_ptr<OGRGeometry> &)
+        { return papoGeoms[i]; },
+        [&apoRet](size_t i, std::unique_ptr<OGRGeometry> poGeom)
+        { apoRet[i] = std::move(poGeom); });
+    return apoRet;
+}
+
+/************************************************************************/
+/*                        processWKBGeometries()                        */
+/************************************************************************/
+
+/**
+ * \brief Apply an operation to an array of WKB geometries, in parallel.
+ *
+ * This is the same as processGeometries(), except that input and output
+ * geometries are encoded as WKB, e.g. from or to an Arrow WKB column.
+ * Decoding and encoding of WKB is also done by the worker threads.
+ *
+ * @param eOperation Operation to apply.
+ * @param papabyWKB Array of nCount WKB geometries. Null elements are allowed.
+ * @param panWKBSize Array of the nCount sizes in bytes of papabyWKB.
+ * @param nCount Number of geometries.
+ * @param poOtherGeom Other geometry for INTERSECTION. Ignored for other
+ *                    operations.
+ * @param papszOptions NULL terminated list of options, or NULL. See
+ *                     processGeometries().
+ * @return a vector of nCount ISO WKB geometries. An element is empty when
+ * the corresponding input geometry is null or invalid, or the operation
+ * failed on it.
+ * @since GDAL 3.10
+ */
+
+std::vector<std::vector<GByte>> OGRGeometryFactory::processWKBGeometries(
+    BatchOperation eOperation, const GByte *const *papabyWKB,
+    const size_t *panWKBSize, size_t nCount, const OGRGeometry *poOtherGeom,
+    CSLConstList papszOptions)
+{
+    std::vector<std::vector<GByte>> aabyRet(nCount);
+    OGRGeometryBatchProcessor oProcessor(eOperation, poOtherGeom,
+                                         papszOptions);
+    oProcessor.Run(
+        nCount,
+        [papabyWKB, panWKBSize](size_t i,
+                                std::unique_ptr<OGRGeometry> &poHolder)
+        {
+            OGRGeometry *poGeom = nullptr;
+            if (papabyWKB[i] &&
+                OGRGeometryFactory::createFromWkb(papabyWKB[i], nullptr,
+                                                  &poGeom, panWKBSize[i]) ==
+                    OGRERR_NONE)
+            {
+                poHolder.reset(poGeom);
+            }
+            return poHolder.get();
+        },
+        [&aabyRet](size_t i, std::unique_ptr<OGRGeometry> poGeom)
+        {
+            if (poGeom)
+            {
+                auto &abyWKB = aabyRet[i];
+                abyWKB.resize(poGeom->WkbSize());
+                poGeom->exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+            }
+        });
+    return aabyRet;
+}
+
+/************************************************************************/
+/*                          unionGeometries()                           */
+/************************************************************************/
+
+namespace
+{
+// Minimum number of geometries of a leaf partition of unionGeometries()
+constexpr size_t MIN_GEOMETRIES_PER_UNION_LEAF = 64;
+
+struct UnionJob
+{
+    std::vector<const OGRGeometry *> apoGeoms{};
+    std::unique_ptr<OGRGeometry> poResult{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
+// Computes the unary union of psJob->apoGeoms
+void UnionJobFunc(void *pData)
+{
+    UnionJob *psJob = static_cast<UnionJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+#ifdef HAVE_GEOS
+    GEOSContextHandle_t hGEOSCtxt = OGRGeometry::createGEOSContext();
+    std::vector<GEOSGeom> ahGeosGeoms;
+    ahGeosGeoms.reserve(psJob->apoGeoms.size());
+    bool bOK = true;
+    for (const auto *poGeom : psJob->apoGeoms)
+    {
+        GEOSGeom hGeosGeom = poGeom->exportToGEOS(hGEOSCtxt);
+        if (!hGeosGeom)
+        {
+            bOK = false;
+            break;
+        }
+        ahGeosGeoms.push_back(hGeosGeom);
+    }
+    if (bOK)
+    {
+        // Takes ownership of ahGeosGeoms
+        GEOSGeom hCollection = GEOSGeom_createCollection_r(
+            hGEOSCtxt, GEOS_GEOMETRYCOLLECTION, ahGeosGeoms.data(),
+            static_cast<unsigned>(ahGeosGeoms.size()));
+        ahGeosGeoms.clear();
+        if (hCollection)
+        {
+            GEOSGeom hGeosProduct = GEOSUnaryUnion_r(hGEOSCtxt, hCollection);
+            GEOSGeom_destroy_r(hGEOSCtxt, hCollection);
+            if (hGeosProduct)
+            {
+                psJob->poResult.reset(OGRGeometryFactory::createFromGEOS(
+                    hGEOSCtxt, hGeosProduct));
+                GEOSGeom_destroy_r(hGEOSCtxt, hGeosProduct);
+            }
+        }
+    }
+    for (GEOSGeom hGeosGeom : ahGeosGeoms)
+        GEOSGeom_destroy_r(hGEOSCtxt, hGeosGeom);
+    OGRGeometry::freeGEOSContext(hGEOSCtxt);
+#endif
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+// Runs the jobs that have no result yet, in parallel if poJobQueue is not
+// null. Returns false if one of them failed.
+bool RunUnionJobs(std::vector<UnionJob> &asJobs, CPLJobQueue *poJobQueue)
+{
+    for (auto &sJob : asJobs)
+    {
+        if (sJob.poResult)
+            continue;
+        if (!poJobQueue || !poJobQueue->SubmitJob(UnionJobFunc, &sJob))
+        {
+            // Run it in the calling thread then
+            UnionJobFunc(&sJob);
+        }
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    bool bRet = true;
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &sError : sJob.aoErrors)
+            CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+        if (!sJob.poResult)
+            bRet = false;
+    }
+    return bRet;
+}
+
+}  // namespace
+
+/**
+ * \brief Compute the union of an array of geometries, in parallel.
+ *
+ * The result is the same as the one of OGRGeometry::UnaryUnion() on a
+ * collection of the input geometries, up to the order of its parts and
+ * vertices, but the union is computed with a spatial partitioning: the
+ * geometries are sorted with the Sort-Tile-Recursive algorithm, contiguous
+ * runs of spatially close geometries are unioned in parallel by threads of
+ * the global GDAL thread pool, and the partial unions are then merged
+ * pairwise, also in parallel, until a single geometry remains.
+ *
+ * Curve geometries are linearized.
+ *
+ * Supported options are:
+ * <ul>
+ * <li>NUM_THREADS=n|ALL_CPUS: maximum number of threads. Defaults to the
+ * value of the GDAL_NUM_THREADS configuration option, or 1.</li>
+ * </ul>
+ *
+ * @param papoGeoms Array of nCount geometries. Null elements are ignored.
+ * @param nCount Number of geometries.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return the union, with the spatial reference system of the first
+ * geometry, or NULL if there is no input geometry or in case of error.
+ * @see OGRGeometryUnionAccumulator for inputs that do not fit in memory.
+ * @since GDAL 3.10
+ */
+
+std::unique_ptr<OGRGeometry>
+OGRGeometryFactory::unionGeometries(const OGRGeometry *const *papoGeoms,
+                                    size_t nCount, CSLConstList papszOptions)
+{
+#ifndef HAVE_GEOS
+    (void)papoGeoms;
+    (void)nCount;
+    (void)papszOptions;
+    CPLError(CE_Failure, CPLE_NotSupported, "GEOS support not enabled.");
+    return nullptr;
+#else
+    struct Item
+    {
+        const OGRGeometry *poGeom;
+        double dfX;
+        double dfY;
+    };
+
+    std::vector<Item> asItems;
+    asItems.reserve(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        if (papoGeoms[i])
+        {
+            OGREnvelope sEnv;
+            papoGeoms[i]->getEnvelope(&sEnv);
+            asItems.push_back(Item{papoGeoms[i], (sEnv.MinX + sEnv.MaxX) / 2,
+                                   (sEnv.MinY + sEnv.MaxY) / 2});
+        }
+    }
+    if (asItems.empty())
+        return nullptr;
+    const OGRSpatialReference *poSRS = asItems[0].poGeom->getSpatialReference();
+
+    GDALThreadReservation oThreadReservation(GetMaxThreadsFromOptions(
+        papszOptions, asItems.size() / MIN_GEOMETRIES_PER_UNION_LEAF));
+    const int nThreads = oThreadReservation.GetThreadCount();
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Several leaves per thread, for load balancing
+    const size_t nLeaves =
+        poJobQueue
+            ? std::max<size_t>(
+                  1, std::min(static_cast<size_t>(nThreads) * 4,
+                              asItems.size() / MIN_GEOMETRIES_PER_UNION_LEAF))
+            : 1;
+    const size_t nPerLeaf = (asItems.size() + nLeaves - 1) / nLeaves;
+
+    // Sort-Tile-Recursive ordering: vertical slices sorted by X, each of
+    // them sorted by Y, so that consecutive leaves are spatially compact.
+    if (nLeaves > 1)
+    {
+        std::sort(asItems.begin(), asItems.end(),
+                  [](const Item &a, const Item &b) { return a.dfX < b.dfX; });
+        const size_t nSlices = static_cast<size_t>(
+            std::ceil(std::sqrt(static_cast<double>(nLeaves))));
+        const size_t nPerSlice = nPerLeaf * ((nLeaves + nSlices - 1) / nSlices);
+        for (size_t nStart = 0; nStart < asItems.size(); nStart += nPerSlice)
+        {
+            const size_t nEnd = std::min(asItems.size(), nStart + nPerSlice);
+            std::sort(asItems.begin() + nStart, asItems.begin() + nEnd,
+                      [](const Item &a, const Item &b)
+                      { return a.dfY < b.dfY; });
+        }
+    }
+
+    std::vector<UnionJob> asJobs;
+    for (size_t nStart = 0; nStart < asItems.size(); nStart += nPerLeaf)
+    {
+        UnionJob sJob;
+        const size_t nEnd = std::min(asItems.size(), nStart + nPerLeaf);
+        for (size_t i = nStart; i < nEnd; ++i)
+            sJob.apoGeoms.push_back(asItems[i].poGeom);
+        asJobs.push_back(std::move(sJob));
+    }
+    asItems.clear();
+
+    // Union leaves, and then merge neighbouring partial results pairwise
+    if (!RunUnionJobs(asJobs, poJobQueue.get()))
+        return nullptr;
+    while (asJobs.size() > 1)
+    {
+        std::vector<UnionJob> asMergeJobs((asJobs.size() + 1) / 2);
+        for (size_t i = 0; i < asMergeJobs.size(); ++i)
+        {
+            if (2 * i + 1 < asJobs.size())
+            {
+                asMergeJobs[i].apoGeoms = {asJobs[2 * i].poResult.get(),
+                                           asJobs[2 * i + 1].poResult.get()};
+            }
+            else
+            {
+                // Odd one: nothing to merge with at that level
+                asMergeJobs[i].poResult = std::move(asJobs[2 * i].poResult);
+            }
+        }
+        if (!RunUnionJobs(asMergeJobs, poJobQueue.get()))
+            return nullptr;
+        asJobs = std::move(asMergeJobs);
+    }
+
+    auto poRet = std::move(asJobs[0].poResult);
+    poRet->assignSpatialReference(poSRS);
+    return poRet;
+#endif
+}
+
+/************************************************************************/
+/*                     OGRGeometryUnionAccumulator                      */
+/************************************************************************/
+
+/**
+ * \brief Constructor.
+ *
+ * Supported options are the ones of OGRGeometryFactory::unionGeometries(),
+ * and:
+ * <ul>
+ * <li>BATCH_SIZE=n: number of geometries accumulated before they are
+ * unioned. Defaults to 10000.</li>
+ * </ul>
+ *
+ * @param papszOptions NULL terminated list of options, or NULL.
+ */
+OGRGeometryUnionAccumulator::OGRGeometryUnionAccumulator(
+    CSLConstList papszOptions)
+    : m_aosOptions(papszOptions),
+      m_nBatchSize(static_cast<size_t>(std::max(
+          2, atoi(m_aosOptions.FetchNameValueDef("BATCH_SIZE", "10000")))))
+{
+}
+
+/** Destructor */
+OGRGeometryUnionAccumulator::~OGRGeometryUnionAccumulator() = default;
+
+/************************************************************************/
+/*                            AddGeometry()                             */
+/************************************************************************/
+
+/**
+ * \brief Add a geometry to the union.
+ *
+ * Once BATCH_SIZE geometries have been added, they are unioned, and the
+ * result is merged with the ones of previous batches, in a binary counter
+ * fashion, so that the number of partial unions kept in memory grows as the
+ * logarithm of the number of batches.
+ *
+ * @param poGeom Geometry to add. Null geometries are ignored.
+ * @return false in case of error.
+ */
+bool OGRGeometryUnionAccumulator::AddGeometry(
+    std::unique_ptr<OGRGeometry> poGeom)
+{
+    if (!poGeom)
+        return true;
+    m_apoPending.push_back(std::move(poGeom));
+    if (m_apoPending.size() < m_nBatchSize)
+        return true;
+    return FlushPending();
+}
+
+/************************************************************************/
+/*                            FlushPending()                            */
+/************************************************************************/
+
+bool OGRGeometryUnionAccumulator::FlushPending()
+{
+    std::vector<const OGRGeometry *> apoGeoms;
+    for (const auto &poGeom : m_apoPending)
+        apoGeoms.push_back(poGeom.get());
+    auto poPartial = OGRGeometryFactory::unionGeometries(
+        apoGeoms.data(), apoGeoms.size(), m_aosOptions.List());
+    m_apoPending.clear();
+    if (!poPartial)
+        return false;
+
+    for (auto &poLevel : m_apoLevels)
+    {
+        if (!poLevel)
+        {
+            poLevel = std::move(poPartial);
+            return true;
+        }
+        const OGRGeometry *const apoPair[] = {poLevel.get(), poPartial.get()};
+        poPartial = OGRGeometryFactory::unionGeometries(apoPair, 2,
+                                                        m_aosOptions.List());
+        poLevel.reset();
+        if (!poPartial)
+            return false;
+    }
+    m_apoLevels.push_back(std::move(poPartial));
+    return true;
+}
+
+/************************************************************************/
+/*                             GetResult()                              */
+/************************************************************************/
+
+/**
+ * \brief Return the union of all geometries added, and reset the object.
+ *
+ * @return the union, or NULL if no geometry has been added or in case of
+ * error.
+ */
+std::unique_ptr<OGRGeometry> OGRGeometryUnionAccumulator::GetResult()
+{
+    std::vector<const OGRGeometry *> apoGeoms;
+    for (const auto &poGeom : m_apoPending)
+        apoGeoms.push_back(poGeom.get());
+    for (const auto &poLevel : m_apoLevels)
+    {
+        if (poLevel)
+            apoGeoms.push_back(poLevel.get());
+    }
+    auto poRet = OGRGeometryFactory::unionGeometries(
+        apoGeoms.data(), apoGeoms.size(), m_aosOptions.List());
+    m_apoPending.clear();
+    m_apoLevels.clear();
+    return poRet;
+}
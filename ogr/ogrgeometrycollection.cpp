@@ -493,6 +493,20 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         return OGRERR_CORRUPT_DATA;
     }
 
+    // Detach the existing sub-geometries, so that they can be reused when
+    // importing on top of an existing collection of the same structure, to
+    // save dynamic memory allocations.
+    OGRGeometry **papoOldGeoms = papoGeoms;
+    const int nOldGeomCount = nGeomCount;
+    papoGeoms = nullptr;
+    nGeomCount = 0;
+    const auto FreeOldGeoms = [papoOldGeoms, nOldGeomCount]()
+    {
+        for (int i = 0; i < nOldGeomCount; ++i)
+            delete papoOldGeoms[i];
+        CPLFree(papoOldGeoms);
+    };
+
     OGRwkbByteOrder eByteOrder = wkbXDR;
     size_t nDataOffset = 0;
     int nGeomCountNew = 0;
@@ -501,7 +515,10 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
                                                     nGeomCountNew, eWkbVariant);
 
     if (eErr != OGRERR_NONE)
+    {
+        FreeOldGeoms();
         return eErr;
+    }
 
     CPLAssert(nGeomCount == 0);
     nGeomCount = nGeomCountNew;
@@ -512,6 +529,7 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
     if (nGeomCount != 0 && papoGeoms == nullptr)
     {
         nGeomCount = 0;
+        FreeOldGeoms();
         return OGRERR_NOT_ENOUGH_MEMORY;
     }
 
@@ -523,16 +541,25 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         // Parses sub-geometry.
         const unsigned char *pabySubData = pabyData + nDataOffset;
         if (nSize < 9 && nSize != static_cast<size_t>(-1))
+        {
+            nGeomCount = iGeom;
+            FreeOldGeoms();
             return OGRERR_NOT_ENOUGH_DATA;
+        }
 
         OGRwkbGeometryType eSubGeomType = wkbUnknown;
         eErr = OGRReadWKBGeometryType(pabySubData, eWkbVariant, &eSubGeomType);
         if (eErr != OGRERR_NONE)
+        {
+            nGeomCount = iGeom;
+            FreeOldGeoms();
             return eErr;
+        }
 
         if (!isCompatibleSubType(eSubGeomType))
         {
             nGeomCount = iGeom;
+            FreeOldGeoms();
             CPLDebug(
                 "OGR",
                 "Cannot add geometry of type (%d) to geometry of type (%d)",
@@ -540,11 +567,25 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
             return OGRERR_CORRUPT_DATA;
         }
 
+        // Reuse the sub-geometry at the same index if it is of the same
+        // type. Restricted to non-curve types, as createFromWkb() may stroke
+        // curve geometries depending on OGR_STROKE_CURVE.
         OGRGeometry *poSubGeom = nullptr;
+        const OGRwkbGeometryType eFlatSubGeomType = wkbFlatten(eSubGeomType);
+        if (iGeom < nOldGeomCount && papoOldGeoms[iGeom] &&
+            !OGR_GT_IsNonLinear(eFlatSubGeomType) &&
+            wkbFlatten(papoOldGeoms[iGeom]->getGeometryType()) ==
+                eFlatSubGeomType)
+        {
+            poSubGeom = papoOldGeoms[iGeom];
+            papoOldGeoms[iGeom] = nullptr;
+        }
+
         size_t nSubGeomBytesConsumed = 0;
         if (OGR_GT_IsSubClassOf(eSubGeomType, wkbGeometryCollection))
         {
-            poSubGeom = OGRGeometryFactory::createGeometry(eSubGeomType);
+            if (poSubGeom == nullptr)
+                poSubGeom = OGRGeometryFactory::createGeometry(eSubGeomType);
             if (poSubGeom == nullptr)
                 eErr = OGRERR_FAILURE;
             else
@@ -554,9 +595,14 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         }
         else
         {
-            eErr = OGRGeometryFactory::createFromWkb(
-                pabySubData, nullptr, &poSubGeom, nSize, eWkbVariant,
-                nSubGeomBytesConsumed);
+            if (poSubGeom)
+                eErr = poSubGeom->importFromWkb(pabySubData, nSize,
+                                                eWkbVariant,
+                                                nSubGeomBytesConsumed);
+            else
+                eErr = OGRGeometryFactory::createFromWkb(
+                    pabySubData, nullptr, &poSubGeom, nSize, eWkbVariant,
+                    nSubGeomBytesConsumed);
 
             if (eErr == OGRERR_NONE)
             {
@@ -579,6 +625,7 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         {
             nGeomCount = iGeom;
             delete poSubGeom;
+            FreeOldGeoms();
             return eErr;
         }
 
@@ -599,6 +646,7 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         nDataOffset += nSubGeomBytesConsumed;
     }
     nBytesConsumedOut = nDataOffset;
+    FreeOldGeoms();
 
     return OGRERR_NONE;
 }
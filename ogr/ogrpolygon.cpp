@@ -385,18 +385,45 @@ OGRErr OGRPolygon::importFromWkb(const unsigned char *pabyData, size_t nSize,
 
     nBytesConsumedOut = 0;
 
+    // Detach the existing rings, so that they (and their point arrays) can
+    // be reused when importing on top of an existing polygon, to save
+    // dynamic memory allocations.
+    OGRCurve **papoOldRings = oCC.papoCurves;
+    const int nOldRingCount = oCC.nCurveCount;
+    oCC.papoCurves = nullptr;
+    oCC.nCurveCount = 0;
+    int nReusedRings = 0;
+    const auto FreeOldRings = [papoOldRings, nOldRingCount, &nReusedRings]()
+    {
+        for (int i = nReusedRings; i < nOldRingCount; ++i)
+            delete papoOldRings[i];
+        CPLFree(papoOldRings);
+    };
+
     // coverity[tainted_data]
     OGRErr eErr = oCC.importPreambleFromWkb(this, pabyData, nSize, nDataOffset,
                                             eByteOrder, 4, eWkbVariant);
     if (eErr != OGRERR_NONE)
+    {
+        FreeOldRings();
         return eErr;
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Get the rings.                                                  */
     /* -------------------------------------------------------------------- */
     for (int iRing = 0; iRing < oCC.nCurveCount; iRing++)
     {
-        OGRLinearRing *poLR = new OGRLinearRing();
+        OGRLinearRing *poLR;
+        if (nReusedRings < nOldRingCount)
+        {
+            poLR = cpl::down_cast<OGRLinearRing *>(papoOldRings[nReusedRings]);
+            ++nReusedRings;
+        }
+        else
+        {
+            poLR = new OGRLinearRing();
+        }
         oCC.papoCurves[iRing] = poLR;
         size_t nBytesConsumedRing = 0;
         eErr = poLR->_importFromWkb(eByteOrder, flags, pabyData + nDataOffset,
@@ -405,6 +432,7 @@ OGRErr OGRPolygon::importFromWkb(const unsigned char *pabyData, size_t nSize,
         {
             delete oCC.papoCurves[iRing];
             oCC.nCurveCount = iRing;
+            FreeOldRings();
             return eErr;
         }
 
@@ -418,6 +446,7 @@ OGRErr OGRPolygon::importFromWkb(const unsigned char *pabyData, size_t nSize,
         nDataOffset += nBytesConsumedRing;
     }
     nBytesConsumedOut = nDataOffset;
+    FreeOldRings();
 
     return OGRERR_NONE;
 }
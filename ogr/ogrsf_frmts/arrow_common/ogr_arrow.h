@@ -100,7 +100,12 @@ class OGRArrowLayer CPL_NON_FINAL
     // Modified by UseRecordBatchBaseImplementation()
     mutable struct ArrowSchema m_sCachedSchema = {};
 
-    bool SkipToNextFeatureDueToAttributeFilter() const;
+    bool SkipToNextFeatureDueToAttributeFilter() const
+    {
+        return SkipToNextFeatureDueToAttributeFilter(
+            m_poBatchColumns, m_nIdxInBatch, m_nFeatureIdx);
+    }
+
     void ExploreExprNode(const swq_expr_node *poNode);
     bool UseRecordBatchBaseImplementation() const;
 
@@ -234,6 +239,17 @@ class OGRArrowLayer CPL_NON_FINAL
 
     void SetBatch(const std::shared_ptr<arrow::RecordBatch> &poBatch);
 
+    // Evaluate the attribute filter constraints on row nIdxInBatch of
+    // apoColumns (indexed like Constraint::iArrayIdx). Null entries of
+    // apoColumns are skipped.
+    bool SkipToNextFeatureDueToAttributeFilter(
+        const std::vector<std::shared_ptr<arrow::Array>> &apoColumns,
+        int64_t nIdxInBatch, int64_t nFeatureIdx) const;
+
+    // Returns -1 if the current batch has no bounding box column usable
+    // for the spatial filter
+    int64_t CountBatchRowsIntersectingFilterBBOX() const;
+
     // Refreshes Constraint.iArrayIdx from iField. To be called by SetIgnoredFields()
     void ComputeConstraintsArrayIdx();
 
@@ -3586,7 +3586,9 @@ inline bool ConstraintEvaluator(const OGRArrowLayer::Constraint &constraint,
 /*                 SkipToNextFeatureDueToAttributeFilter()              */
 /************************************************************************/
 
-inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
+inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter(
+    const std::vector<std::shared_ptr<arrow::Array>> &apoColumns,
+    int64_t nIdxInBatch, int64_t nFeatureIdx) const
 {
     for (const auto &constraint : m_asAttributeFilterConstraints)
     {
@@ -3597,7 +3599,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                 m_osFIDColumn.empty())
             {
                 if (!ConstraintEvaluator(constraint,
-                                         static_cast<GIntBig>(m_nFeatureIdx)))
+                                         static_cast<GIntBig>(nFeatureIdx)))
                 {
                     return true;
                 }
@@ -3612,10 +3614,16 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
             }
         }
 
-        const arrow::Array *array =
-            m_poBatchColumns[constraint.iArrayIdx].get();
+        // Callers evaluating constraints on a subset of the columns leave
+        // the other ones null
+        if (static_cast<size_t>(constraint.iArrayIdx) >= apoColumns.size() ||
+            !apoColumns[constraint.iArrayIdx])
+        {
+            continue;
+        }
+        const arrow::Array *array = apoColumns[constraint.iArrayIdx].get();
 
-        const bool bIsNull = array->IsNull(m_nIdxInBatch);
+        const bool bIsNull = array->IsNull(nIdxInBatch);
         if (constraint.nOperation == SWQ_ISNULL)
         {
             if (bIsNull)
@@ -3648,7 +3656,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::BooleanArray *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<int>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3660,7 +3668,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::UInt8Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<int>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3672,7 +3680,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::Int8Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<int>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3684,7 +3692,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::UInt16Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<int>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3696,7 +3704,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::Int16Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<int>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3708,7 +3716,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::UInt32Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<GIntBig>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<GIntBig>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3719,7 +3727,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                 const auto castArray =
                     static_cast<const arrow::Int32Array *>(array);
                 if (!ConstraintEvaluator(constraint,
-                                         castArray->Value(m_nIdxInBatch)))
+                                         castArray->Value(nIdxInBatch)))
                 {
                     return true;
                 }
@@ -3731,7 +3739,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::UInt64Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<double>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<double>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3743,7 +3751,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::Int64Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<GIntBig>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<GIntBig>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3753,7 +3761,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
             {
                 const auto castArray =
                     static_cast<const arrow::HalfFloatArray *>(array);
-                const uint16_t nFloat16 = castArray->Value(m_nIdxInBatch);
+                const uint16_t nFloat16 = castArray->Value(nIdxInBatch);
                 uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
                 float f;
                 memcpy(&f, &nFloat32, sizeof(nFloat32));
@@ -3769,7 +3777,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::FloatArray *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        static_cast<double>(castArray->Value(m_nIdxInBatch))))
+                        static_cast<double>(castArray->Value(nIdxInBatch))))
                 {
                     return true;
                 }
@@ -3780,7 +3788,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                 const auto castArray =
                     static_cast<const arrow::DoubleArray *>(array);
                 if (!ConstraintEvaluator(constraint,
-                                         castArray->Value(m_nIdxInBatch)))
+                                         castArray->Value(nIdxInBatch)))
                 {
                     return true;
                 }
@@ -3792,7 +3800,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::StringArray *>(array);
                 int out_length = 0;
                 const uint8_t *data =
-                    castArray->GetValue(m_nIdxInBatch, &out_length);
+                    castArray->GetValue(nIdxInBatch, &out_length);
                 if (!ConstraintEvaluator(
                         constraint,
                         std::string_view(reinterpret_cast<const char *>(data),
@@ -3809,7 +3817,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::Decimal128Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        CPLAtof(castArray->FormatValue(m_nIdxInBatch).c_str())))
+                        CPLAtof(castArray->FormatValue(nIdxInBatch).c_str())))
                 {
                     return true;
                 }
@@ -3822,7 +3830,7 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
                     static_cast<const arrow::Decimal256Array *>(array);
                 if (!ConstraintEvaluator(
                         constraint,
-                        CPLAtof(castArray->FormatValue(m_nIdxInBatch).c_str())))
+                        CPLAtof(castArray->FormatValue(nIdxInBatch).c_str())))
                 {
                     return true;
                 }
@@ -3959,6 +3967,85 @@ OGRArrowLayer::SetBatch(const std::shared_ptr<arrow::RecordBatch> &poBatch)
     }
 }
 
+/************************************************************************/
+/*                      CountIntersectingBBOX()                         */
+/************************************************************************/
+
+/** Count the rows of a bounding box covering column that intersect
+ * sFilterEnvelope. Written as a branchless loop over the raw value buffers
+ * so that the compiler can vectorize it when there are no null values.
+ */
+template <class ArrayType>
+static int64_t CountIntersectingBBOX(const arrow::Array *poArrayBBOX,
+                                     const ArrayType *poArrayXMin,
+                                     const ArrayType *poArrayYMin,
+                                     const ArrayType *poArrayXMax,
+                                     const ArrayType *poArrayYMax,
+                                     const OGREnvelope &sFilterEnvelope)
+{
+    using T = typename ArrayType::value_type;
+    const int64_t nLength = poArrayBBOX->length();
+    const T *CPL_RESTRICT pXMin = poArrayXMin->raw_values();
+    const T *CPL_RESTRICT pYMin = poArrayYMin->raw_values();
+    const T *CPL_RESTRICT pXMax = poArrayXMax->raw_values();
+    const T *CPL_RESTRICT pYMax = poArrayYMax->raw_values();
+    const double dfMinX = sFilterEnvelope.MinX;
+    const double dfMinY = sFilterEnvelope.MinY;
+    const double dfMaxX = sFilterEnvelope.MaxX;
+    const double dfMaxY = sFilterEnvelope.MaxY;
+
+    int64_t nCount = 0;
+    if (poArrayBBOX->null_count() == 0 && poArrayXMin->null_count() == 0 &&
+        poArrayYMin->null_count() == 0 && poArrayXMax->null_count() == 0 &&
+        poArrayYMax->null_count() == 0)
+    {
+        for (int64_t i = 0; i < nLength; ++i)
+        {
+            nCount += static_cast<int>(pXMin[i] <= dfMaxX) &
+                      static_cast<int>(pYMin[i] <= dfMaxY) &
+                      static_cast<int>(pXMax[i] >= dfMinX) &
+                      static_cast<int>(pYMax[i] >= dfMinY);
+        }
+    }
+    else
+    {
+        for (int64_t i = 0; i < nLength; ++i)
+        {
+            if (!poArrayBBOX->IsNull(i) && !poArrayXMin->IsNull(i) &&
+                !poArrayYMin->IsNull(i) && !poArrayXMax->IsNull(i) &&
+                !poArrayYMax->IsNull(i) && pXMin[i] <= dfMaxX &&
+                pYMin[i] <= dfMaxY && pXMax[i] >= dfMinX && pYMax[i] >= dfMinY)
+            {
+                ++nCount;
+            }
+        }
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*               CountBatchRowsIntersectingFilterBBOX()                 */
+/************************************************************************/
+
+inline int64_t OGRArrowLayer::CountBatchRowsIntersectingFilterBBOX() const
+{
+    if (!m_poFilterGeom || !m_poArrayBBOX)
+        return -1;
+    if (m_poArrayXMinFloat)
+    {
+        return CountIntersectingBBOX(m_poArrayBBOX, m_poArrayXMinFloat,
+                                     m_poArrayYMinFloat, m_poArrayXMaxFloat,
+                                     m_poArrayYMaxFloat, m_sFilterEnvelope);
+    }
+    if (m_poArrayXMinDouble)
+    {
+        return CountIntersectingBBOX(m_poArrayBBOX, m_poArrayXMinDouble,
+                                     m_poArrayYMinDouble, m_poArrayXMaxDouble,
+                                     m_poArrayYMaxDouble, m_sFilterEnvelope);
+    }
+    return -1;
+}
+
 /************************************************************************/
 /*                        GetNextRawFeature()                           */
 /************************************************************************/
@@ -5518,6 +5605,16 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             }
         }
 
+        // Skip, without exporting it, a batch where no bounding box of the
+        // covering column intersects the spatial filter.
+        if (CountBatchRowsIntersectingFilterBBOX() == 0)
+        {
+            m_nIdxInBatch = m_poBatch->num_rows();
+            for (int64_t i = 0; i < m_nIdxInBatch; ++i)
+                IncrFeatureIdx();
+            continue;
+        }
+
         struct ArrowSchema schema;
         memset(&schema, 0, sizeof(schema));
         auto status = arrow::ExportRecordBatch(*m_poBatch, out_array, &schema);
@@ -32,8 +32,13 @@
 #define OGR_CSV_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogrsidecarspatialindex.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <set>
+#include <vector>
 
 typedef enum
 {
@@ -98,6 +103,40 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     bool bHasFieldNames;
 
     OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *
+    GetNextUnfilteredFeatureSequential(OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *TranslateTokens(char **papszTokens, int nFID,
+                                OGRFeature *poFeatureToReuse = nullptr);
+
+    // Records are read from fpCSV by large chunks
+    std::string m_osRecordBuffer{};
+    size_t m_nRecordBufferPos = 0;
+    bool m_bRecordBufferEOF = false;
+    // Offset in fpCSV of the start of m_osRecordBuffer
+    vsi_l_offset m_nRecordBufferFileOffset = 0;
+    // Offset in fpCSV of the last record returned by ReadRawRecord()
+    vsi_l_offset m_nLastRecordOffset = 0;
+    std::string m_osRecord{};
+
+    bool ReadRawRecord(std::string &osRecord);
+    void SeekToRecord(vsi_l_offset nOffset);
+
+    // Sidecar spatial index, used when a spatial filter is set
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSpatialIndex{};
+    bool m_bSpatialIndexProbed = false;
+    bool m_bUseSpatialIndex = false;
+    std::vector<OGRSidecarSpatialIndex::Item> m_aoSpatialIndexCandidates{};
+    size_t m_nSpatialIndexCandidateIdx = 0;
+
+    OGRSidecarSpatialIndex *GetSpatialIndex();
+    OGRFeature *GetNextIndexedFeature();
+
+    // Multi-threaded reading, enabled with GDAL_NUM_THREADS
+    int m_nNumThreads = 1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoReadyFeatures{};
+
+    bool ReadFeaturesMultiThreaded();
+    static void TranslateRecordsJob(void *pData);
 
     bool bNew;
     bool bInWriteMode;
@@ -138,7 +177,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **AutodetectFieldTypes(char **papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth;
+    std::atomic<bool> bWarningBadTypeOrWidth;
     bool bKeepSourceColumns;
     bool bKeepGeomColumns;
 
@@ -226,6 +265,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
 
     OGRFeatureDefn *GetLayerDefn() override
@@ -273,6 +313,9 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     }
 
     OGRErr WriteHeader();
+
+    OGRErr CreateSpatialIndex();
+    OGRErr DropSpatialIndex();
 };
 
 /************************************************************************/
@@ -331,6 +374,10 @@ class OGRCSVDataSource final : public OGRDataSource
     }
 
     static CPLString GetRealExtension(CPLString osFilename);
+
+    virtual OGRLayer *ExecuteSQL(const char *pszSQLCommand,
+                                 OGRGeometry *poSpatialFilter,
+                                 const char *pszDialect) override;
 };
 
 #endif  // ndef OGR_CSV_H_INCLUDED
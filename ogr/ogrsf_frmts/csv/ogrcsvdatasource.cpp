@@ -1193,6 +1193,58 @@ void OGRCSVDataSource::CreateForSingleFile(const char *pszDirname,
     osDefaultCSVName = CPLGetFilename(pszFilename);
 }
 
+/************************************************************************/
+/*                             ExecuteSQL()                             */
+/************************************************************************/
+
+OGRLayer *OGRCSVDataSource::ExecuteSQL(const char *pszStatement,
+                                       OGRGeometry *poSpatialFilter,
+                                       const char *pszDialect)
+{
+    /* ==================================================================== */
+    /*      Handle commands to create or drop a sidecar spatial index.      */
+    /* ==================================================================== */
+    const bool bCreate =
+        STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX ON ");
+    if (bCreate || STARTS_WITH_CI(pszStatement, "DROP SPATIAL INDEX ON "))
+    {
+        const char *pszLayerName = pszStatement + (bCreate ? 24 : 22);
+        OGRCSVLayer *poLayer = nullptr;
+        for (auto &poIter : m_apoLayers)
+        {
+            if (EQUAL(poIter->GetLayer()->GetName(), pszLayerName))
+            {
+                poLayer = dynamic_cast<OGRCSVLayer *>(poIter->GetLayer());
+                if (poLayer == nullptr)
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Spatial index cannot be managed on a layer "
+                             "opened in update mode");
+                    return nullptr;
+                }
+                break;
+            }
+        }
+        if (poLayer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Layer %s not recognised.",
+                     pszLayerName);
+        }
+        else if (bCreate)
+        {
+            poLayer->CreateSpatialIndex();
+        }
+        else
+        {
+            poLayer->DropSpatialIndex();
+        }
+        return nullptr;
+    }
+
+    return OGRDataSource::ExecuteSQL(pszStatement, poSpatialFilter,
+                                     pszDialect);
+}
+
 /************************************************************************/
 /*                            GetFileList()                             */
 /************************************************************************/
@@ -47,8 +47,10 @@
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -90,6 +92,16 @@ OGRCSVLayer::OGRCSVLayer(GDALDataset *poDS, const char *pszLayerNameIn,
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
     poFeatureDefn->SetGeomType(wkbNone);
+
+    // A sidecar spatial index would no longer match the rewritten file
+    if (bInWriteMode)
+    {
+        const std::string osIndexFilename =
+            OGRSidecarSpatialIndex::GetFilename(pszFilename);
+        VSIStatBufL sStat;
+        if (VSIStatL(osIndexFilename.c_str(), &sStat) == 0)
+            VSIUnlink(osIndexFilename.c_str());
+    }
 }
 
 /************************************************************************/
@@ -875,6 +887,11 @@ std::vector<std::string> OGRCSVLayer::GetFileList()
     ret.emplace_back(pszFilename);
     if (!m_osCSVTFilename.empty())
         ret.emplace_back(m_osCSVTFilename);
+    const std::string osIndexFilename =
+        OGRSidecarSpatialIndex::GetFilename(pszFilename);
+    VSIStatBufL sStat;
+    if (VSIStatL(osIndexFilename.c_str(), &sStat) == 0)
+        ret.emplace_back(osIndexFilename);
     return ret;
 }
 
@@ -1298,6 +1315,40 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     nNextFID = 1;
+
+    m_osRecordBuffer.clear();
+    m_nRecordBufferPos = 0;
+    m_bRecordBufferEOF = false;
+    m_nRecordBufferFileOffset = fpCSV ? VSIFTellL(fpCSV) : 0;
+    m_nLastRecordOffset = m_nRecordBufferFileOffset;
+    m_apoReadyFeatures.clear();
+    m_nNumThreads = 1;
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads && !bInWriteMode)
+    {
+        const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                    ? CPLGetNumCPUs()
+                                    : atoi(pszNumThreads);
+        m_nNumThreads = std::max(1, std::min(nNumThreads, 128));
+    }
+
+    // Restrict reading to the candidate records of the sidecar spatial
+    // index, if there is one.
+    m_bUseSpatialIndex = false;
+    m_aoSpatialIndexCandidates.clear();
+    m_nSpatialIndexCandidateIdx = 0;
+    if (m_poFilterGeom != nullptr && m_iGeomFieldFilter == 0 &&
+        !bInWriteMode && fpCSV != nullptr)
+    {
+        auto poSpatialIndex = GetSpatialIndex();
+        if (poSpatialIndex &&
+            poSpatialIndex->Search(m_sFilterEnvelope,
+                                   m_aoSpatialIndexCandidates))
+        {
+            m_bUseSpatialIndex = true;
+        }
+    }
 }
 
 /************************************************************************/
@@ -1306,23 +1357,399 @@ void OGRCSVLayer::ResetReading()
 
 char **OGRCSVLayer::GetNextLineTokens()
 {
-    while (true)
+    // Records are read from large chunks rather than with
+    // CSVReadParseLine3L(), whose line reader does small reads followed by
+    // a seek back.
+    while (ReadRawRecord(m_osRecord))
     {
-        // Read the CSV record.
-        char **papszTokens = CSVReadParseLine3L(
-            fpCSV, m_nMaxLineSize, szDelimiter, bHonourStrings,
-            false,  // bKeepLeadingAndClosingQuotes
-            bMergeDelimiter,
-            true  // bSkipBOM
-        );
-        if (papszTokens == nullptr)
-            return nullptr;
+        // Skip BOM, as CSVReadParseLine3L() does
+        const char *pszRecord = m_osRecord.c_str();
+        if (m_osRecord.size() >= 3 && memcmp(pszRecord, "\xEF\xBB\xBF", 3) == 0)
+            pszRecord += 3;
 
-        if (papszTokens[0] != nullptr)
+        char **papszTokens =
+            CSVSplitRecord(pszRecord, szDelimiter, bHonourStrings,
+                           false,  // bKeepLeadingAndClosingQuotes
+                           bMergeDelimiter);
+        if (papszTokens != nullptr && papszTokens[0] != nullptr)
             return papszTokens;
 
         CSLDestroy(papszTokens);
     }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                           ReadRawRecord()                            */
+/************************************************************************/
+
+// Extract the next record, without tokenizing it, from m_osRecordBuffer,
+// which is refilled from fpCSV with large sequential reads. This mimics the
+// line handling of CSVReadParseLine3L(): a line break in a quoted field does
+// not end the record and is replaced by '\n'. Returns false at end of file.
+bool OGRCSVLayer::ReadRawRecord(std::string &osRecord)
+{
+    // Smaller chunks when jumping between candidates of the spatial index
+    const size_t nChunkSize = m_bUseSpatialIndex ? 64 * 1024 : 1024 * 1024;
+    m_nLastRecordOffset = m_nRecordBufferFileOffset + m_nRecordBufferPos;
+    const char szStopChars[] = {'\r', '\n', bHonourStrings ? '"' : '\0',
+                                '\0'};
+    while (true)
+    {
+        osRecord.clear();
+        const char *const pszBuffer = m_osRecordBuffer.c_str();
+        const size_t nSize = m_osRecordBuffer.size();
+        size_t nSegmentStart = m_nRecordBufferPos;
+        size_t nLineStart = m_nRecordBufferPos;
+        bool bInString = false;
+        bool bNeedMoreData = false;
+        size_t i = m_nRecordBufferPos;
+        while (i < nSize)
+        {
+            // Skip runs of ordinary characters at once: strcspn() is
+            // vectorized by common C libraries. It also stops on nul
+            // characters, which are processed as ordinary ones below.
+            i += strcspn(pszBuffer + i, szStopChars);
+            const char ch = i < nSize ? pszBuffer[i] : '\0';
+            const bool bLineBreak = (ch == '\r' || ch == '\n');
+            const size_t nLineLength =
+                i - nLineStart + ((i < nSize && !bLineBreak) ? 1 : 0);
+            if (m_nMaxLineSize > 0 &&
+                nLineLength >= static_cast<size_t>(m_nMaxLineSize))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Maximum number of characters allowed reached.");
+                m_osRecordBuffer.clear();
+                m_nRecordBufferPos = 0;
+                m_bRecordBufferEOF = true;
+                return false;
+            }
+            if (i == nSize)
+                break;
+            if (bLineBreak)
+            {
+                if (i + 1 == nSize && !m_bRecordBufferEOF)
+                {
+                    // Cannot tell yet if this is a CR LF or LF CR sequence
+                    bNeedMoreData = true;
+                    break;
+                }
+                const char chPair = (ch == '\r') ? '\n' : '\r';
+                const size_t nNext =
+                    (i + 1 < nSize && pszBuffer[i + 1] == chPair) ? i + 2
+                                                                  : i + 1;
+                osRecord.append(pszBuffer + nSegmentStart, i - nSegmentStart);
+                if (!bInString)
+                {
+                    m_nRecordBufferPos = nNext;
+                    return true;
+                }
+                osRecord += '\n';
+                nSegmentStart = nNext;
+                nLineStart = nNext;
+                i = nNext;
+                continue;
+            }
+            if (ch == '"')
+                bInString = !bInString;
+            ++i;
+        }
+
+        if (!bNeedMoreData && m_bRecordBufferEOF)
+        {
+            if (m_nRecordBufferPos == nSize)
+                return false;
+            osRecord.append(m_osRecordBuffer, nSegmentStart,
+                            nSize - nSegmentStart);
+            // CSVReadParseLine3L() does not append a line break for the
+            // missing line after an unbalanced quote at end of file.
+            if (bInString && !osRecord.empty() && osRecord.back() == '\n')
+                osRecord.pop_back();
+            m_nRecordBufferPos = nSize;
+            return true;
+        }
+
+        // Incomplete record: keep its beginning and read a new chunk
+        m_nRecordBufferFileOffset += m_nRecordBufferPos;
+        m_osRecordBuffer.erase(0, m_nRecordBufferPos);
+        m_nRecordBufferPos = 0;
+        const size_t nOldSize = m_osRecordBuffer.size();
+        m_osRecordBuffer.resize(nOldSize + nChunkSize);
+        const size_t nRead =
+            VSIFReadL(&m_osRecordBuffer[nOldSize], 1, nChunkSize, fpCSV);
+        m_osRecordBuffer.resize(nOldSize + nRead);
+        if (nRead < nChunkSize)
+            m_bRecordBufferEOF = true;
+    }
+}
+
+/************************************************************************/
+/*                           SeekToRecord()                             */
+/************************************************************************/
+
+// Position the record reader on the record starting at nOffset, reusing
+// the current buffer when possible.
+void OGRCSVLayer::SeekToRecord(vsi_l_offset nOffset)
+{
+    if (nOffset >= m_nRecordBufferFileOffset &&
+        nOffset - m_nRecordBufferFileOffset <= m_osRecordBuffer.size())
+    {
+        m_nRecordBufferPos =
+            static_cast<size_t>(nOffset - m_nRecordBufferFileOffset);
+        return;
+    }
+    VSIFSeekL(fpCSV, nOffset, SEEK_SET);
+    m_osRecordBuffer.clear();
+    m_nRecordBufferPos = 0;
+    m_bRecordBufferEOF = false;
+    m_nRecordBufferFileOffset = nOffset;
+}
+
+/************************************************************************/
+/*                          GetSpatialIndex()                           */
+/************************************************************************/
+
+OGRSidecarSpatialIndex *OGRCSVLayer::GetSpatialIndex()
+{
+    if (!m_bSpatialIndexProbed && !bInWriteMode)
+    {
+        m_bSpatialIndexProbed = true;
+        m_poSpatialIndex = OGRSidecarSpatialIndex::Open(pszFilename);
+    }
+    return m_poSpatialIndex.get();
+}
+
+/************************************************************************/
+/*                       GetNextIndexedFeature()                        */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::GetNextIndexedFeature()
+{
+    if (m_nSpatialIndexCandidateIdx == m_aoSpatialIndexCandidates.size())
+        return nullptr;
+    const auto &oItem =
+        m_aoSpatialIndexCandidates[m_nSpatialIndexCandidateIdx++];
+    SeekToRecord(oItem.nOffset);
+    char **papszTokens = GetNextLineTokens();
+    if (papszTokens == nullptr)
+        return nullptr;
+    OGRFeature *poFeature =
+        TranslateTokens(papszTokens, static_cast<int>(oItem.nFID));
+    CSLDestroy(papszTokens);
+    m_nFeaturesRead++;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                        CreateSpatialIndex()                          */
+/************************************************************************/
+
+OGRErr OGRCSVLayer::CreateSpatialIndex()
+{
+    if (fpCSV == nullptr || bInWriteMode)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Spatial index can only be created on a layer opened in "
+                 "read-only mode");
+        return OGRERR_FAILURE;
+    }
+    if (poFeatureDefn->GetGeomFieldCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Layer %s has no geometry field", GetDescription());
+        return OGRERR_FAILURE;
+    }
+
+    // Scan all records, regardless of the current filters
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexProbed = true;
+    ResetReading();
+    OGRGeomFieldDefn *poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(0);
+    const bool bGeomFieldIgnored = CPL_TO_BOOL(poGeomFieldDefn->IsIgnored());
+    poGeomFieldDefn->SetIgnored(false);
+    std::vector<OGRSidecarSpatialIndex::Item> aoItems;
+    OGRFeature oFeature(poFeatureDefn);
+    while (char **papszTokens = GetNextLineTokens())
+    {
+        TranslateTokens(papszTokens, nNextFID, &oFeature);
+        CSLDestroy(papszTokens);
+        const OGRGeometry *poGeom = oFeature.GetGeomFieldRef(0);
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGRSidecarSpatialIndex::Item oItem;
+            poGeom->getEnvelope(&oItem.sEnvelope);
+            oItem.nOffset = m_nLastRecordOffset;
+            oItem.nFID = nNextFID;
+            aoItems.push_back(oItem);
+        }
+        nNextFID++;
+    }
+    poGeomFieldDefn->SetIgnored(bGeomFieldIgnored);
+
+    const bool bOK =
+        OGRSidecarSpatialIndex::Build(pszFilename, std::move(aoItems));
+    m_bSpatialIndexProbed = false;
+    ResetReading();
+    return bOK ? OGRERR_NONE : OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                         DropSpatialIndex()                           */
+/************************************************************************/
+
+OGRErr OGRCSVLayer::DropSpatialIndex()
+{
+    const std::string osIndexFilename =
+        OGRSidecarSpatialIndex::GetFilename(pszFilename);
+    VSIStatBufL sStat;
+    if (VSIStatL(osIndexFilename.c_str(), &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Layer %s has no spatial index", GetDescription());
+        return OGRERR_FAILURE;
+    }
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexProbed = true;
+    ResetReading();
+    if (VSIUnlink(osIndexFilename.c_str()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot delete %s",
+                 osIndexFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                        TranslateRecordsJob()                         */
+/************************************************************************/
+
+namespace
+{
+struct OGRCSVTranslationJob
+{
+    OGRCSVLayer *poLayer = nullptr;
+    const std::string *paosRecords = nullptr;
+    OGRFeature **papoFeatures = nullptr;
+    size_t nCount = 0;
+    int nFirstFID = 0;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+void OGRCSVLayer::TranslateRecordsJob(void *pData)
+{
+    auto psJob = static_cast<OGRCSVTranslationJob *>(pData);
+    auto poLayer = psJob->poLayer;
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    for (size_t i = 0; i < psJob->nCount; ++i)
+    {
+        char **papszTokens = CSVSplitRecord(
+            psJob->paosRecords[i].c_str(), poLayer->szDelimiter,
+            poLayer->bHonourStrings,
+            false,  // bKeepLeadingAndClosingQuotes
+            poLayer->bMergeDelimiter);
+        if (papszTokens != nullptr && papszTokens[0] != nullptr)
+        {
+            psJob->papoFeatures[i] = poLayer->TranslateTokens(
+                papszTokens, psJob->nFirstFID + static_cast<int>(i));
+        }
+        CSLDestroy(papszTokens);
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                     ReadFeaturesMultiThreaded()                      */
+/************************************************************************/
+
+// Records are extracted sequentially, so that the file is still read with
+// large contiguous requests (which matters for /vsicurl/), and the batch of
+// records is then split in contiguous ranges that are tokenized and
+// translated on worker threads. Features are queued in file order.
+// Returns false once all records have been read.
+bool OGRCSVLayer::ReadFeaturesMultiThreaded()
+{
+    constexpr size_t RECORDS_PER_THREAD = 256;
+    constexpr size_t MAX_BATCH_BYTES = 64 * 1024 * 1024;
+    const size_t nMaxRecords =
+        static_cast<size_t>(m_nNumThreads) * RECORDS_PER_THREAD;
+
+    std::vector<std::string> aosRecords;
+    std::string osRecord;
+    size_t nBatchBytes = 0;
+    while (aosRecords.size() < nMaxRecords && nBatchBytes < MAX_BATCH_BYTES &&
+           ReadRawRecord(osRecord))
+    {
+        // Skip BOM, as CSVReadParseLine3L() does
+        if (osRecord.size() >= 3 &&
+            memcmp(osRecord.data(), "\xEF\xBB\xBF", 3) == 0)
+        {
+            osRecord.erase(0, 3);
+        }
+        // Empty lines do not produce a feature
+        if (osRecord.empty())
+            continue;
+        nBatchBytes += osRecord.size();
+        aosRecords.emplace_back(std::move(osRecord));
+    }
+    if (aosRecords.empty())
+        return false;
+
+    const size_t nCount = aosRecords.size();
+    std::vector<OGRFeature *> apoFeatures(nCount);
+    // Not worth using threads on a few features
+    constexpr size_t MIN_FEATURES_PER_JOB = 64;
+    const size_t nJobs =
+        std::max<size_t>(1, std::min(static_cast<size_t>(m_nNumThreads),
+                                     nCount / MIN_FEATURES_PER_JOB));
+    std::vector<OGRCSVTranslationJob> asJobs(nJobs);
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        const size_t nStart = nCount * i / nJobs;
+        const size_t nEnd = nCount * (i + 1) / nJobs;
+        asJobs[i].poLayer = this;
+        asJobs[i].paosRecords = aosRecords.data() + nStart;
+        asJobs[i].papoFeatures = apoFeatures.data() + nStart;
+        asJobs[i].nCount = nEnd - nStart;
+        asJobs[i].nFirstFID = nNextFID + static_cast<int>(nStart);
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue)
+    {
+        for (auto &sJob : asJobs)
+        {
+            if (!poQueue->SubmitJob(TranslateRecordsJob, &sJob))
+                TranslateRecordsJob(&sJob);
+        }
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &sJob : asJobs)
+            TranslateRecordsJob(&sJob);
+    }
+
+    // Re-emit errors from the calling thread, in the order of the records
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    // Records without any field were skipped, so number features here.
+    for (OGRFeature *poFeature : apoFeatures)
+    {
+        if (poFeature)
+        {
+            poFeature->SetFID(nNextFID++);
+            m_apoReadyFeatures.emplace_back(poFeature);
+        }
+    }
+    return true;
 }
 
 /************************************************************************/
@@ -1333,8 +1760,15 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < 1 || fpCSV == nullptr)
         return nullptr;
-    if (nFID < nNextFID || bNeedRewindBeforeRead)
+    if (nFID < nNextFID || bNeedRewindBeforeRead || m_bUseSpatialIndex)
+    {
         ResetReading();
+        // Records are read sequentially from there
+        m_bUseSpatialIndex = false;
+    }
+    // Features already translated by the multi-threaded reader are before
+    // nNextFID.
+    m_apoReadyFeatures.clear();
     while (nNextFID < nFID)
     {
         char **papszTokens = GetNextLineTokens();
@@ -1343,7 +1777,7 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
         CSLDestroy(papszTokens);
         nNextFID++;
     }
-    return GetNextUnfilteredFeature();
+    return GetNextUnfilteredFeatureSequential();
 }
 
 /************************************************************************/
@@ -1352,6 +1786,35 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 
 OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
+{
+    if (fpCSV == nullptr)
+        return nullptr;
+
+    if (m_bUseSpatialIndex)
+        return GetNextIndexedFeature();
+
+    if (m_nNumThreads <= 1)
+        return GetNextUnfilteredFeatureSequential();
+
+    // A batch may only contain empty records, hence the loop.
+    while (m_apoReadyFeatures.empty())
+    {
+        if (!ReadFeaturesMultiThreaded())
+            return nullptr;
+    }
+    OGRFeature *poFeature = m_apoReadyFeatures.front().release();
+    m_apoReadyFeatures.pop_front();
+    m_nFeaturesRead++;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                 GetNextUnfilteredFeatureSequential()                 */
+/************************************************************************/
+
+OGRFeature *
+OGRCSVLayer::GetNextUnfilteredFeatureSequential(OGRFeature *poFeatureToReuse)
+
 {
     if (fpCSV == nullptr)
         return nullptr;
@@ -1361,8 +1824,35 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
-    // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
+    OGRFeature *poFeature =
+        TranslateTokens(papszTokens, nNextFID, poFeatureToReuse);
+    nNextFID++;
+
+    CSLDestroy(papszTokens);
+
+    m_nFeaturesRead++;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                          TranslateTokens()                           */
+/************************************************************************/
+
+// Can be called from worker threads: it only reads the layer state, apart
+// from bWarningBadTypeOrWidth which is atomic.
+// When poFeatureToReuse is not null, it is reset and filled instead of
+// creating a new feature.
+OGRFeature *OGRCSVLayer::TranslateTokens(char **papszTokens, int nFID,
+                                         OGRFeature *poFeatureToReuse)
+
+{
+    // Create the OGR feature, or recycle the provided one.
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(poFeatureDefn);
 
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
@@ -1450,7 +1940,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nFID, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1479,7 +1969,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                  "Invalid value type found in record %d for "
                                  "field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nFID, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              poFieldDefn->GetWidth() > 0 &&
@@ -1491,7 +1981,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                  "Value with a width greater than field width "
                                  "found in record %d for field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nFID, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              eType == CPL_VALUE_REAL &&
@@ -1510,7 +2000,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                      "field precision found in record %d for "
                                      "field %s. "
                                      "This warning will no longer be emitted",
-                                     nNextFID, poFieldDefn->GetNameRef());
+                                     nFID, poFieldDefn->GetNameRef());
                         }
                     }
                 }
@@ -1523,7 +2013,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                             CE_Warning, CPLE_AppDefined,
                             "Invalid value type found in record %d for field "
                             "%s. This warning will no longer be emitted.",
-                            nNextFID, poFieldDefn->GetNameRef());
+                            nFID, poFieldDefn->GetNameRef());
                     }
                 }
             }
@@ -1541,7 +2031,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nFID, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1563,7 +2053,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                              "Value with a width greater than field width "
                              "found in record %d for field %s. "
                              "This warning will no longer be emitted",
-                             nNextFID, poFieldDefn->GetNameRef());
+                             nFID, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1688,12 +2178,8 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    CSLDestroy(papszTokens);
-
     // Translate the record id.
-    poFeature->SetFID(nNextFID++);
-
-    m_nFeaturesRead++;
+    poFeature->SetFID(nFID);
 
     return poFeature;
 }
@@ -1725,6 +2211,36 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+    // Only the sequential reading of records can translate them directly
+    // into the provided feature.
+    if (oFeature.GetDefnRef() != poFeatureDefn || m_bUseSpatialIndex ||
+        m_nNumThreads > 1)
+    {
+        return OGRLayer::GetNextFeatureInto(oFeature);
+    }
+
+    while (true)
+    {
+        if (!GetNextUnfilteredFeatureSequential(&oFeature))
+            return false;
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(oFeature.GetGeomFieldRef(m_iGeomFieldFilter))) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(&oFeature)))
+            return true;
+    }
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -1741,6 +2257,8 @@ int OGRCSVLayer::TestCapability(const char *pszCap)
                eGeometryFormat == OGR_CSV_GEOM_AS_WKT;
     else if (EQUAL(pszCap, OLCIgnoreFields))
         return TRUE;
+    else if (EQUAL(pszCap, OLCFastSpatialFilter))
+        return GetSpatialIndex() != nullptr;
     else if (EQUAL(pszCap, OLCCurveGeometries))
         return TRUE;
     else if (EQUAL(pszCap, OLCMeasuredGeometries))
@@ -60,6 +60,12 @@ class DXFBlockDefinition
     ~DXFBlockDefinition();
 
     std::vector<OGRDXFFeature *> apoFeatures;
+
+    // Merged geometry of the block (with its nested blocks inlined), in
+    // block coordinates. Computed on the first insertion of the block when
+    // block geometries are merged. See OGRDXFLayer::GetMergedBlockGeometry()
+    bool bMergedGeometryComputed = false;
+    std::unique_ptr<OGRGeometry> poMergedGeometry{};
 };
 
 /************************************************************************/
@@ -533,6 +539,14 @@ class OGRDXFLayer final : public OGRLayer
                            int nControlPoints, std::vector<double> &adfKnots,
                            int nKnots, std::vector<double> &adfWeights);
     static OGRGeometry *SimplifyBlockGeometry(OGRGeometryCollection *);
+    static void ApplyInsertTransformer(OGRGeometry *poGeom,
+                                       OGRDXFInsertTransformer oTransformer,
+                                       const OGRDXFFeature *poFeature);
+    const OGRGeometry *GetMergedBlockGeometry(const CPLString &osBlockName);
+    OGRDXFFeature *
+    InsertMergedBlockGeometry(const OGRGeometry *poMergedGeometry,
+                              OGRDXFInsertTransformer oTransformer,
+                              OGRDXFFeature *const poFeature);
     OGRDXFFeature *InsertBlockInline(GUInt32 nInitialErrorCounter,
                                      const CPLString &osBlockName,
                                      OGRDXFInsertTransformer oTransformer,
@@ -603,6 +617,11 @@ class OGRDXFReader
 {
     int ReadValueRaw(char *pszValueBuffer, int nValueBufferSize);
 
+    // Number of bytes read from the file at once by LoadDiskChunk()
+    static constexpr unsigned int CHUNK_SIZE = 8192;
+    // Number of bytes that should be available in the buffer to read a value
+    static constexpr unsigned int MIN_AVAILABLE_BYTES = 512;
+
   public:
     OGRDXFReader();
     ~OGRDXFReader();
@@ -614,7 +633,7 @@ class OGRDXFReader
     unsigned int iSrcBufferOffset;
     unsigned int nSrcBufferBytes;
     unsigned int iSrcBufferFileOffset;
-    char achSrcBuffer[1025];
+    char achSrcBuffer[CHUNK_SIZE + MIN_AVAILABLE_BYTES + 1];
 
     unsigned int nLastValueSize;
     int nLineNumber;
@@ -2729,6 +2729,132 @@ OGRDXFLayer::SimplifyBlockGeometry(OGRGeometryCollection *poCollection)
     return poCollection;
 }
 
+/************************************************************************/
+/*                       ApplyInsertTransformer()                       */
+/*                                                                      */
+/*     Transforms a geometry from block coordinates to the location     */
+/*     of a block insertion: rotation and scaling, then the OCS to      */
+/*     WCS transformation of poFeature, then the offset translation.    */
+/************************************************************************/
+
+void OGRDXFLayer::ApplyInsertTransformer(OGRGeometry *poGeom,
+                                         OGRDXFInsertTransformer oTransformer,
+                                         const OGRDXFFeature *poFeature)
+{
+    // With the default OCS, the OCS to WCS transformation is the identity,
+    // so everything can be done in a single pass.
+    if (poFeature->oOCS == DXFTriple(0.0, 0.0, 1.0))
+    {
+        poGeom->transform(&oTransformer);
+        return;
+    }
+
+    // Rotation and scaling first
+    OGRDXFInsertTransformer oInnerTrans =
+        oTransformer.GetRotateScaleTransformer();
+    poGeom->transform(&oInnerTrans);
+
+    // Then the OCS to WCS transformation
+    poFeature->ApplyOCSTransformer(poGeom);
+
+    // Offset translation last
+    oInnerTrans = oTransformer.GetOffsetTransformer();
+    poGeom->transform(&oInnerTrans);
+}
+
+/************************************************************************/
+/*                       GetMergedBlockGeometry()                       */
+/*                                                                      */
+/*     Returns the merged geometry of a block, in block coordinates,    */
+/*     so that a block inserted many times is only inlined and          */
+/*     simplified once. Returns NULL if the block cannot be reduced     */
+/*     to a single geometry (text or ASM entities, missing nested       */
+/*     blocks, ...), in which case InsertBlockInline() must be used.    */
+/************************************************************************/
+
+const OGRGeometry *
+OGRDXFLayer::GetMergedBlockGeometry(const CPLString &osBlockName)
+{
+    DXFBlockDefinition *poBlock = poDS->LookupBlock(osBlockName);
+    if (poBlock == nullptr)
+        return nullptr;
+
+    if (!poBlock->bMergedGeometryComputed)
+    {
+        poBlock->bMergedGeometryComputed = true;
+
+        // Inline the block at the origin. Warnings are silenced here: they
+        // will be emitted by InsertBlockInline() at each insertion of a
+        // block that is not cached.
+        OGRDXFFeatureQueue apoExtraFeatures;
+        std::unique_ptr<OGRDXFFeature> poMergedFeature;
+        bool bCacheable = false;
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            const GUInt32 nErrorCounter = CPLGetErrorCounter();
+            try
+            {
+                poMergedFeature.reset(InsertBlockInline(
+                    nErrorCounter, osBlockName, OGRDXFInsertTransformer(),
+                    new OGRDXFFeature(poFeatureDefn), apoExtraFeatures, true,
+                    true));
+                bCacheable = CPLGetErrorCounter() == nErrorCounter;
+            }
+            catch (const std::invalid_argument &)
+            {
+            }
+        }
+
+        if (!apoExtraFeatures.empty())
+        {
+            bCacheable = false;
+            while (!apoExtraFeatures.empty())
+            {
+                delete apoExtraFeatures.front();
+                apoExtraFeatures.pop();
+            }
+        }
+
+        if (bCacheable && poMergedFeature &&
+            poMergedFeature->GetGeometryRef() != nullptr)
+        {
+            poBlock->poMergedGeometry.reset(poMergedFeature->StealGeometry());
+        }
+    }
+
+    return poBlock->poMergedGeometry.get();
+}
+
+/************************************************************************/
+/*                     InsertMergedBlockGeometry()                      */
+/*                                                                      */
+/*     Equivalent of InsertBlockInline() with bMergeGeometry set, for   */
+/*     a block whose merged geometry has been cached.                   */
+/************************************************************************/
+
+OGRDXFFeature *
+OGRDXFLayer::InsertMergedBlockGeometry(const OGRGeometry *poMergedGeometry,
+                                       OGRDXFInsertTransformer oTransformer,
+                                       OGRDXFFeature *const poFeature)
+{
+    // Transform the insertion point from OCS into world coordinates.
+    OGRPoint oInsertionPoint(oTransformer.dfXOffset, oTransformer.dfYOffset,
+                             oTransformer.dfZOffset);
+
+    poFeature->ApplyOCSTransformer(&oInsertionPoint);
+
+    oTransformer.dfXOffset = oInsertionPoint.getX();
+    oTransformer.dfYOffset = oInsertionPoint.getY();
+    oTransformer.dfZOffset = oInsertionPoint.getZ();
+
+    OGRGeometry *poGeom = poMergedGeometry->clone();
+    ApplyInsertTransformer(poGeom, oTransformer, poFeature);
+    poFeature->SetGeometryDirectly(poGeom);
+
+    PrepareLineStyle(poFeature);
+    return poFeature;
+}
+
 /************************************************************************/
 /*                       InsertBlockReference()                         */
 /*                                                                      */
@@ -2937,17 +3063,7 @@ OGRDXFFeature *OGRDXFLayer::InsertBlockInline(
             OGRGeometry *poSubFeatGeom = poSubFeature->GetGeometryRef();
             if (poSubFeatGeom != nullptr)
             {
-                // Rotation and scaling first
-                OGRDXFInsertTransformer oInnerTrans =
-                    oTransformer.GetRotateScaleTransformer();
-                poSubFeatGeom->transform(&oInnerTrans);
-
-                // Then the OCS to WCS transformation
-                poFeature->ApplyOCSTransformer(poSubFeatGeom);
-
-                // Offset translation last
-                oInnerTrans = oTransformer.GetOffsetTransformer();
-                poSubFeatGeom->transform(&oInnerTrans);
+                ApplyInsertTransformer(poSubFeatGeom, oTransformer, poFeature);
             }
             // Transform the specially-stored data for ASM entities
             else if (poSubFeature->poASMTransform)
@@ -3277,20 +3393,33 @@ bool OGRDXFLayer::GenerateINSERTFeatures()
     else
     {
         OGRDXFFeatureQueue apoExtraFeatures;
-        try
+        const OGRGeometry *poMergedGeometry =
+            poDS->ShouldMergeBlockGeometries()
+                ? GetMergedBlockGeometry(m_oInsertState.m_osBlockName)
+                : nullptr;
+        if (poMergedGeometry)
         {
-            poFeature = InsertBlockInline(
-                CPLGetErrorCounter(), m_oInsertState.m_osBlockName,
-                std::move(oTransformer), poFeature, apoExtraFeatures, true,
-                poDS->ShouldMergeBlockGeometries());
+            poFeature = InsertMergedBlockGeometry(
+                poMergedGeometry, std::move(oTransformer), poFeature);
         }
-        catch (const std::invalid_argument &)
+        else
         {
-            // Block doesn't exist
-            CPLError(CE_Warning, CPLE_AppDefined, "Block %s does not exist",
-                     m_oInsertState.m_osBlockName.c_str());
-            delete poFeature;
-            return false;
+            try
+            {
+                poFeature = InsertBlockInline(
+                    CPLGetErrorCounter(), m_oInsertState.m_osBlockName,
+                    std::move(oTransformer), poFeature, apoExtraFeatures,
+                    true, poDS->ShouldMergeBlockGeometries());
+            }
+            catch (const std::invalid_argument &)
+            {
+                // Block doesn't exist
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Block %s does not exist",
+                         m_oInsertState.m_osBlockName.c_str());
+                delete poFeature;
+                return false;
+            }
         }
 
         if (poFeature)
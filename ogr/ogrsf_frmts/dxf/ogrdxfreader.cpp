@@ -32,6 +32,8 @@
 #include "cpl_string.h"
 #include "cpl_csv.h"
 
+#include <cstring>
+
 /************************************************************************/
 /*                            OGRDXFReader()                            */
 /************************************************************************/
@@ -81,19 +83,19 @@ void OGRDXFReader::ResetReadPointer(unsigned int iNewOffset,
 /************************************************************************/
 /*                           LoadDiskChunk()                            */
 /*                                                                      */
-/*      Load another block (512 bytes) of input from the source         */
-/*      file.                                                           */
+/*      Load another block (CHUNK_SIZE bytes) of input from the         */
+/*      source file.                                                    */
 /************************************************************************/
 
 void OGRDXFReader::LoadDiskChunk()
 
 {
-    if (nSrcBufferBytes - iSrcBufferOffset > 511)
+    if (nSrcBufferBytes - iSrcBufferOffset >= MIN_AVAILABLE_BYTES)
         return;
 
     if (iSrcBufferOffset > 0)
     {
-        CPLAssert(nSrcBufferBytes <= 1024);
+        CPLAssert(nSrcBufferBytes <= CHUNK_SIZE + MIN_AVAILABLE_BYTES);
         CPLAssert(iSrcBufferOffset <= nSrcBufferBytes);
 
         memmove(achSrcBuffer, achSrcBuffer + iSrcBufferOffset,
@@ -103,11 +105,11 @@ void OGRDXFReader::LoadDiskChunk()
         iSrcBufferOffset = 0;
     }
 
-    nSrcBufferBytes +=
-        static_cast<int>(VSIFReadL(achSrcBuffer + nSrcBufferBytes, 1, 512, fp));
+    nSrcBufferBytes += static_cast<int>(
+        VSIFReadL(achSrcBuffer + nSrcBufferBytes, 1, CHUNK_SIZE, fp));
     achSrcBuffer[nSrcBufferBytes] = '\0';
 
-    CPLAssert(nSrcBufferBytes <= 1024);
+    CPLAssert(nSrcBufferBytes <= CHUNK_SIZE + MIN_AVAILABLE_BYTES);
     CPLAssert(iSrcBufferOffset <= nSrcBufferBytes);
 }
 
@@ -123,7 +125,7 @@ int OGRDXFReader::ReadValueRaw(char *pszValueBuf, int nValueBufSize)
     /* -------------------------------------------------------------------- */
     /*      Make sure we have lots of data in our buffer for one value.     */
     /* -------------------------------------------------------------------- */
-    if (nSrcBufferBytes - iSrcBufferOffset < 512)
+    if (nSrcBufferBytes - iSrcBufferOffset < MIN_AVAILABLE_BYTES)
         LoadDiskChunk();
 
     /* -------------------------------------------------------------------- */
@@ -135,10 +137,8 @@ int OGRDXFReader::ReadValueRaw(char *pszValueBuf, int nValueBufSize)
     nLineNumber++;
 
     // proceed to newline.
-    while (achSrcBuffer[iSrcBufferOffset] != '\n' &&
-           achSrcBuffer[iSrcBufferOffset] != '\r' &&
-           achSrcBuffer[iSrcBufferOffset] != '\0')
-        iSrcBufferOffset++;
+    iSrcBufferOffset += static_cast<unsigned int>(
+        strcspn(achSrcBuffer + iSrcBufferOffset, "\r\n"));
 
     if (achSrcBuffer[iSrcBufferOffset] == '\0')
         return -1;
@@ -164,9 +164,7 @@ int OGRDXFReader::ReadValueRaw(char *pszValueBuf, int nValueBufSize)
     nLineNumber++;
 
     // proceed to newline.
-    while (achSrcBuffer[iEOL] != '\n' && achSrcBuffer[iEOL] != '\r' &&
-           achSrcBuffer[iEOL] != '\0')
-        iEOL++;
+    iEOL += static_cast<unsigned int>(strcspn(achSrcBuffer + iEOL, "\r\n"));
 
     bool bLongLine = false;
     while (achSrcBuffer[iEOL] == '\0' ||
@@ -198,9 +196,8 @@ int OGRDXFReader::ReadValueRaw(char *pszValueBuf, int nValueBufSize)
             return -1;
 
         // Proceed to newline again
-        while (achSrcBuffer[iEOL] != '\n' && achSrcBuffer[iEOL] != '\r' &&
-               achSrcBuffer[iEOL] != '\0')
-            iEOL++;
+        iEOL +=
+            static_cast<unsigned int>(strcspn(achSrcBuffer + iEOL, "\r\n"));
     }
 
     size_t nValueBufLen = 0;
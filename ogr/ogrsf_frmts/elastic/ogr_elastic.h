@@ -35,12 +35,18 @@
 #include "cpl_json_header.h"
 #include "cpl_hash_set.h"
 #include "ogr_p.h"
+#include "cpl_error_internal.h"
 #include "cpl_http.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 
 typedef enum
@@ -52,6 +58,39 @@ typedef enum
 
 class OGRElasticDataSource;
 
+/************************************************************************/
+/*                        OGRElasticSlicedScroll                        */
+/************************************************************************/
+
+/** Runs one scroll per slice of a sliced scroll search, each in its own
+ * thread, and queues their responses.
+ */
+class OGRElasticSlicedScroll
+{
+    OGRElasticDataSource *m_poDS = nullptr;
+    std::vector<std::thread> m_aoThreads{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<json_object *> m_apoResponses{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> m_aoErrors{};
+    size_t m_nMaxQueuedResponses = 0;
+    int m_nRunningSlices = 0;
+    bool m_bStop = false;
+
+    void Run(CPLString osRequest, CPLString osPostData, bool bAddPretty);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRElasticSlicedScroll)
+
+  public:
+    OGRElasticSlicedScroll(OGRElasticDataSource *poDS,
+                           const CPLString &osRequest,
+                           const CPLString &osPostData, int nSlices,
+                           bool bAddPretty);
+    ~OGRElasticSlicedScroll();
+
+    json_object *GetNextResponse();
+};
+
 class OGRESSortDesc
 {
   public:
@@ -93,6 +132,12 @@ class OGRElasticLayer final : public OGRLayer
 
     CPLString m_osBulkContent{};
     int m_nBulkUpload{};
+    int m_nBulkConcurrentRequests = 1;
+    std::mutex m_oBulkMutex{};
+    bool m_bBulkRequestFailed = false;
+    std::vector<CPLErrorHandlerAccumulatorStruct> m_aoBulkErrors{};
+    // Must be declared after the members used by its jobs
+    std::unique_ptr<CPLJobQueue> m_poBulkJobQueue{};
 
     CPLString m_osFID{};
 
@@ -112,6 +157,7 @@ class OGRElasticLayer final : public OGRLayer
     int m_iCurFeatureInPage = 0;
     std::vector<OGRFeature *> m_apoCachedFeatures{};
     bool m_bEOF = false;
+    std::unique_ptr<OGRElasticSlicedScroll> m_poSlicedScroll{};
 
     json_object *m_poSpatialFilter = nullptr;
     CPLString m_osJSONFilter{};
@@ -139,7 +185,9 @@ class OGRElasticLayer final : public OGRLayer
 
     void CopyMembersTo(OGRElasticLayer *poNew);
 
-    bool PushIndex();
+    bool PushIndex(bool bAsync = false);
+    bool WaitBulkRequests();
+    static void BulkRequestJob(void *pData);
     CPLString BuildMap();
 
     OGRErr WriteMapIfNecessary();
@@ -362,6 +410,8 @@ class OGRElasticDataSource final : public GDALDataset
 
     bool m_bOverwrite;
     int m_nBulkUpload;
+    int m_nBulkConcurrentRequests = 1;
+    int m_nScrollSlices = 1;
     char *m_pszWriteMap;
     char *m_pszMapping;
     int m_nBatchSize;
@@ -35,6 +35,8 @@
 #include "ogrgeojsonreader.h"
 #include "ogr_swq.h"
 
+#include <algorithm>
+
 /************************************************************************/
 /*                        OGRElasticDataSource()                        */
 /************************************************************************/
@@ -844,6 +846,12 @@ bool OGRElasticDataSource::Open(GDALOpenInfo *poOpenInfo)
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "USERPWD", "");
     m_nBatchSize = atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                              "BATCH_SIZE", "100"));
+    m_nScrollSlices = std::max(
+        1, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                     "SCROLL_SLICES", "1")));
+    m_nBulkConcurrentRequests = std::max(
+        1, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                     "BULK_CONCURRENT_REQUESTS", "1")));
     m_nFeatureCountToEstablishFeatureDefn = atoi(
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                              "FEATURE_COUNT_TO_ESTABLISH_FEATURE_DEFN", "100"));
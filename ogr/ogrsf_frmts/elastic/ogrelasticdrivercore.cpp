@@ -115,6 +115,9 @@ void OGRElasticsearchDriverSetCommonMetadata(GDALDriver *poDriver)
         "use bulk insert for feature creation' default='YES'/>"
         "  <Option name='BULK_SIZE' type='integer' description='Size in bytes "
         "of the buffer for bulk upload' default='1000000'/>"
+        "  <Option name='BULK_CONCURRENT_REQUESTS' type='integer' "
+        "description='Maximum number of bulk upload requests in flight' "
+        "default='1'/>"
         "  <Option name='DOT_AS_NESTED_FIELD' type='boolean' "
         "description='Whether to consider dot character in field name as "
         "sub-document' default='YES'/>"
@@ -140,6 +143,9 @@ void OGRElasticsearchDriverSetCommonMetadata(GDALDriver *poDriver)
         "serialized description of an aggregation request'/>"
         "  <Option name='BATCH_SIZE' type='integer' description='Number of "
         "features to retrieve per batch' default='100'/>"
+        "  <Option name='SCROLL_SLICES' type='integer' description='Number "
+        "of slices of the scroll request retrieved in parallel' "
+        "default='1'/>"
         "  <Option name='FEATURE_COUNT_TO_ESTABLISH_FEATURE_DEFN' "
         "type='integer' description='Number of features to retrieve to "
         "establish feature definition. -1 = unlimited' default='100'/>"
@@ -163,6 +169,9 @@ void OGRElasticsearchDriverSetCommonMetadata(GDALDriver *poDriver)
         "use bulk insert for feature creation' default='YES'/>"
         "  <Option name='BULK_SIZE' type='integer' description='Size in bytes "
         "of the buffer for bulk upload' default='1000000'/>"
+        "  <Option name='BULK_CONCURRENT_REQUESTS' type='integer' "
+        "description='Maximum number of bulk upload requests in flight' "
+        "default='1'/>"
         "  <Option name='FID' type='string' description='Field name, with "
         "integer values, to use as FID' default='ogc_fid'/>"
         "  <Option name='FORWARD_HTTP_HEADERS_FROM_ENV' type='string' "
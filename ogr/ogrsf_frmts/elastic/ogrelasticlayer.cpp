@@ -38,7 +38,9 @@
 #include "../geojson/ogrgeojsonreader.h"
 #include "../geojson/ogrgeojsonutils.h"
 #include "ogr_geo_utils.h"
+#include "gdal_thread_pool.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <set>
 
@@ -100,6 +102,7 @@ OGRElasticLayer::OGRElasticLayer(const char *pszLayerName,
       m_bStoreFields(CPLFetchBool(papszOptions, "STORE_FIELDS", false)),
       m_osESSearch(pszESSearch ? pszESSearch : ""),
       m_nBulkUpload(poDS->m_nBulkUpload),
+      m_nBulkConcurrentRequests(poDS->m_nBulkConcurrentRequests),
       m_osPrecision(CSLFetchNameValueDef(papszOptions, "GEOM_PRECISION", "")),
       // Undocumented. Only useful for developers.
       m_bAddPretty(CPLTestBool(CPLGetConfigOption("ES_ADD_PRETTY", "FALSE"))),
@@ -122,6 +125,12 @@ OGRElasticLayer::OGRElasticLayer(const char *pszLayerName,
         m_nBulkUpload =
             atoi(CSLFetchNameValueDef(papszOptions, "BULK_SIZE", "1000000"));
     }
+    if (const char *pszBulkConcurrentRequests =
+            CSLFetchNameValue(papszOptions, "BULK_CONCURRENT_REQUESTS"))
+    {
+        m_nBulkConcurrentRequests =
+            std::max(1, atoi(pszBulkConcurrentRequests));
+    }
 
     const char *pszStoredFields =
         CSLFetchNameValue(papszOptions, "STORED_FIELDS");
@@ -254,6 +263,7 @@ void OGRElasticLayer::CopyMembersTo(OGRElasticLayer *poNew)
     poNew->m_bFeatureDefnFinalized = true;
     poNew->m_osBulkContent = m_osBulkContent;
     poNew->m_nBulkUpload = m_nBulkUpload;
+    poNew->m_nBulkConcurrentRequests = m_nBulkConcurrentRequests;
     poNew->m_osFID = m_osFID;
     poNew->m_aaosFieldPaths = m_aaosFieldPaths;
     poNew->m_aosMapToFieldIndex = m_aosMapToFieldIndex;
@@ -295,6 +305,7 @@ OGRElasticLayer *OGRElasticLayer::Clone()
 OGRElasticLayer::~OGRElasticLayer()
 {
     OGRElasticLayer::SyncToDisk();
+    WaitBulkRequests();
 
     OGRElasticLayer::ResetReading();
 
@@ -1076,6 +1087,7 @@ const char *OGRElasticLayer::GetFIDColumn()
 
 void OGRElasticLayer::ResetReading()
 {
+    m_poSlicedScroll.reset();
     if (!m_osScrollID.empty())
     {
         char **papszOptions =
@@ -1237,7 +1249,11 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
     m_iCurFeatureInPage = 0;
 
     CPLString osRequest, osPostData;
-    if (m_nReadFeaturesSinceResetReading == 0)
+    if (m_poSlicedScroll)
+    {
+        // Requests are issued by the slice threads
+    }
+    else if (m_nReadFeaturesSinceResetReading == 0)
     {
         if (!m_osESSearch.empty())
         {
@@ -1270,6 +1286,16 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
                 CPLSPrintf("/_search?scroll=1m&size=%d", m_poDS->m_nBatchSize);
             osPostData = m_osJSONFilter;
         }
+
+        // Sliced scroll is available since ES 5. Do not use it when an
+        // ordering is expected.
+        if (m_poDS->m_nScrollSlices > 1 && m_poDS->m_nMajorVersion >= 5 &&
+            m_aoSortColumns.empty() && m_osESSearch.empty())
+        {
+            m_poSlicedScroll = std::make_unique<OGRElasticSlicedScroll>(
+                m_poDS, osRequest, osPostData, m_poDS->m_nScrollSlices,
+                m_bAddPretty);
+        }
     }
     else
     {
@@ -1282,22 +1308,32 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
                                m_poDS->GetURL(), m_osScrollID.c_str());
     }
 
-    if (m_bAddPretty)
-        osRequest += "&pretty";
-    poResponse = m_poDS->RunRequest(osRequest, osPostData);
+    if (m_poSlicedScroll)
+    {
+        poResponse = m_poSlicedScroll->GetNextResponse();
+    }
+    else
+    {
+        if (m_bAddPretty)
+            osRequest += "&pretty";
+        poResponse = m_poDS->RunRequest(osRequest, osPostData);
+    }
     if (poResponse == nullptr)
     {
         m_bEOF = true;
         return nullptr;
     }
-    m_osScrollID.clear();
-    json_object *poScrollID =
-        CPL_json_object_object_get(poResponse, "_scroll_id");
-    if (poScrollID)
+    if (!m_poSlicedScroll)
     {
-        const char *pszScrollID = json_object_get_string(poScrollID);
-        if (pszScrollID)
-            m_osScrollID = pszScrollID;
+        m_osScrollID.clear();
+        json_object *poScrollID =
+            CPL_json_object_object_get(poResponse, "_scroll_id");
+        if (poScrollID)
+        {
+            const char *pszScrollID = json_object_get_string(poScrollID);
+            if (pszScrollID)
+                m_osScrollID = pszScrollID;
+        }
     }
 
     json_object *poHits = CPL_json_object_object_get(poResponse, "hits");
@@ -1387,6 +1423,183 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
     return nullptr;
 }
 
+/************************************************************************/
+/*                       OGRElasticSlicedScroll()                       */
+/************************************************************************/
+
+OGRElasticSlicedScroll::OGRElasticSlicedScroll(OGRElasticDataSource *poDS,
+                                               const CPLString &osRequest,
+                                               const CPLString &osPostData,
+                                               int nSlices, bool bAddPretty)
+    : m_poDS(poDS), m_nMaxQueuedResponses(2 * static_cast<size_t>(nSlices))
+{
+    json_object *poQuery = nullptr;
+    if (osPostData.empty())
+        poQuery = json_object_new_object();
+    else if (!OGRJSonParse(osPostData.c_str(), &poQuery, false) ||
+             json_object_get_type(poQuery) != json_type_object)
+    {
+        json_object_put(poQuery);
+        poQuery = nullptr;
+    }
+
+    // Without a JSON object to add the slice to, fallback to a single scroll
+    if (poQuery == nullptr)
+        nSlices = 1;
+
+    const CPLStringList aosThreadLocalConfigOptions(
+        CPLGetThreadLocalConfigOptions());
+    m_nRunningSlices = nSlices;
+    for (int i = 0; i < nSlices; ++i)
+    {
+        CPLString osSlicePostData(osPostData);
+        if (poQuery)
+        {
+            json_object *poSlice = json_object_new_object();
+            json_object_object_add(poSlice, "id", json_object_new_int(i));
+            json_object_object_add(poSlice, "max",
+                                   json_object_new_int(nSlices));
+            json_object_object_add(poQuery, "slice", poSlice);
+            osSlicePostData = json_object_to_json_string(poQuery);
+        }
+        m_aoThreads.emplace_back(
+            [this, osRequest, osSlicePostData, bAddPretty,
+             aosThreadLocalConfigOptions]()
+            {
+                CPLSetThreadLocalConfigOptions(
+                    aosThreadLocalConfigOptions.List());
+                Run(osRequest, osSlicePostData, bAddPretty);
+                CPLSetThreadLocalConfigOptions(nullptr);
+            });
+    }
+    json_object_put(poQuery);
+}
+
+/************************************************************************/
+/*                      ~OGRElasticSlicedScroll()                       */
+/************************************************************************/
+
+OGRElasticSlicedScroll::~OGRElasticSlicedScroll()
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bStop = true;
+    }
+    m_oCV.notify_all();
+    for (auto &oThread : m_aoThreads)
+        oThread.join();
+    for (json_object *poResponse : m_apoResponses)
+        json_object_put(poResponse);
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+void OGRElasticSlicedScroll::Run(CPLString osRequest, CPLString osPostData,
+                                 bool bAddPretty)
+{
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLString osScrollID;
+    if (bAddPretty)
+        osRequest += "&pretty";
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock,
+                       [this]
+                       {
+                           return m_bStop ||
+                                  m_apoResponses.size() < m_nMaxQueuedResponses;
+                       });
+            if (m_bStop)
+                break;
+        }
+
+        CPLInstallErrorHandlerAccumulator(aoErrors);
+        json_object *poResponse = m_poDS->RunRequest(osRequest, osPostData);
+        CPLUninstallErrorHandlerAccumulator();
+        if (poResponse == nullptr)
+            break;
+
+        json_object *poScrollID =
+            CPL_json_object_object_get(poResponse, "_scroll_id");
+        if (poScrollID)
+        {
+            const char *pszScrollID = json_object_get_string(poScrollID);
+            if (pszScrollID)
+                osScrollID = pszScrollID;
+        }
+
+        json_object *poHits =
+            json_ex_get_object_by_path(poResponse, "hits.hits");
+        if (poHits == nullptr ||
+            json_object_get_type(poHits) != json_type_array ||
+            json_object_array_length(poHits) == 0)
+        {
+            // The scroll is exhausted and no longer needs to be deleted
+            if (poHits != nullptr)
+                osScrollID.clear();
+            json_object_put(poResponse);
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_apoResponses.push_back(poResponse);
+        }
+        m_oCV.notify_all();
+
+        if (osScrollID.empty())
+            break;
+        osRequest = CPLSPrintf("%s/_search/scroll?scroll=1m&scroll_id=%s",
+                               m_poDS->GetURL(), osScrollID.c_str());
+        if (bAddPretty)
+            osRequest += "&pretty";
+        osPostData.clear();
+    }
+
+    if (!osScrollID.empty())
+    {
+        CPLInstallErrorHandlerAccumulator(aoErrors);
+        m_poDS->Delete(CPLSPrintf("%s/_search/scroll?scroll_id=%s",
+                                  m_poDS->GetURL(), osScrollID.c_str()));
+        CPLUninstallErrorHandlerAccumulator();
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_aoErrors.insert(m_aoErrors.end(), aoErrors.begin(), aoErrors.end());
+        m_nRunningSlices--;
+    }
+    m_oCV.notify_all();
+}
+
+/************************************************************************/
+/*                          GetNextResponse()                           */
+/************************************************************************/
+
+/** Returns the next response of any slice, or nullptr when all slices are
+ * exhausted. The caller takes ownership of the returned object.
+ */
+json_object *OGRElasticSlicedScroll::GetNextResponse()
+{
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oCV.wait(oLock, [this]
+               { return !m_apoResponses.empty() || m_nRunningSlices == 0; });
+    for (const auto &oError : m_aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    m_aoErrors.clear();
+    if (m_apoResponses.empty())
+        return nullptr;
+    json_object *poResponse = m_apoResponses.front();
+    m_apoResponses.pop_front();
+    oLock.unlock();
+    m_oCV.notify_all();
+    return poResponse;
+}
+
 /************************************************************************/
 /*                      decode_geohash_bbox()                           */
 /************************************************************************/
@@ -2708,7 +2921,7 @@ OGRErr OGRElasticLayer::ICreateFeature(OGRFeature *poFeature)
         // Only push the data if we are over our bulk upload limit
         if ((int)m_osBulkContent.length() > m_nBulkUpload)
         {
-            if (!PushIndex())
+            if (!PushIndex(/* bAsync = */ true))
             {
                 return OGRERR_FAILURE;
             }
@@ -2847,7 +3060,7 @@ OGRErr OGRElasticLayer::IUpsertFeature(OGRFeature *poFeature)
         // Only push the data if we are over our bulk upload limit
         if (m_osBulkContent.length() > static_cast<size_t>(m_nBulkUpload))
         {
-            if (!PushIndex())
+            if (!PushIndex(/* bAsync = */ true))
             {
                 return OGRERR_FAILURE;
             }
@@ -2882,20 +3095,120 @@ OGRErr OGRElasticLayer::IUpsertFeature(OGRFeature *poFeature)
 /*                             PushIndex()                              */
 /************************************************************************/
 
-bool OGRElasticLayer::PushIndex()
+namespace
+{
+struct OGRElasticBulkRequest
+{
+    OGRElasticLayer *poLayer = nullptr;
+    CPLString osContent{};
+};
+}  // namespace
+
+/** Uploads the pending bulk content.
+ *
+ * If bAsync is true and BULK_CONCURRENT_REQUESTS is greater than 1, the
+ * upload is done by a worker thread, and this method only waits for
+ * completion of previous uploads when the maximum number of concurrent
+ * requests is reached. Otherwise, it waits for all pending uploads and
+ * uploads the content synchronously.
+ */
+bool OGRElasticLayer::PushIndex(bool bAsync)
 {
+    if (bAsync && m_nBulkConcurrentRequests > 1 && !m_osBulkContent.empty())
+    {
+        if (!m_poBulkJobQueue)
+        {
+            auto poThreadPool =
+                GDALGetGlobalThreadPool(m_nBulkConcurrentRequests);
+            if (poThreadPool)
+                m_poBulkJobQueue = poThreadPool->CreateJobQueue();
+        }
+        if (m_poBulkJobQueue)
+        {
+            // Back pressure: do not accumulate more requests than allowed
+            m_poBulkJobQueue->WaitCompletion(m_nBulkConcurrentRequests - 1);
+
+            auto psRequest = new OGRElasticBulkRequest();
+            psRequest->poLayer = this;
+            std::swap(psRequest->osContent, m_osBulkContent);
+            if (!m_poBulkJobQueue->SubmitJob(BulkRequestJob, psRequest))
+            {
+                std::swap(psRequest->osContent, m_osBulkContent);
+                delete psRequest;
+            }
+            else
+            {
+                // Report failures of previous requests as soon as possible
+                std::lock_guard<std::mutex> oLock(m_oBulkMutex);
+                for (const auto &oError : m_aoBulkErrors)
+                    CPLError(oError.type, oError.no, "%s",
+                             oError.msg.c_str());
+                m_aoBulkErrors.clear();
+                return !m_bBulkRequestFailed;
+            }
+        }
+    }
+
+    bool bRet = WaitBulkRequests();
     if (m_osBulkContent.empty())
     {
-        return true;
+        return bRet;
     }
 
-    const bool bRet = m_poDS->UploadFile(
-        CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
+    if (!m_poDS->UploadFile(CPLSPrintf("%s/_bulk", m_poDS->GetURL()),
+                            m_osBulkContent))
+        bRet = false;
     m_osBulkContent.clear();
 
     return bRet;
 }
 
+/************************************************************************/
+/*                           BulkRequestJob()                           */
+/************************************************************************/
+
+void OGRElasticLayer::BulkRequestJob(void *pData)
+{
+    std::unique_ptr<OGRElasticBulkRequest> psRequest(
+        static_cast<OGRElasticBulkRequest *>(pData));
+    OGRElasticLayer *poLayer = psRequest->poLayer;
+
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    const bool bOK = poLayer->m_poDS->UploadFile(
+        CPLSPrintf("%s/_bulk", poLayer->m_poDS->GetURL()),
+        psRequest->osContent);
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poLayer->m_oBulkMutex);
+    if (!bOK)
+        poLayer->m_bBulkRequestFailed = true;
+    poLayer->m_aoBulkErrors.insert(poLayer->m_aoBulkErrors.end(),
+                                   aoErrors.begin(), aoErrors.end());
+}
+
+/************************************************************************/
+/*                          WaitBulkRequests()                          */
+/************************************************************************/
+
+/** Waits for completion of asynchronous bulk uploads, and reports their
+ * errors. Returns false if one of them failed.
+ */
+bool OGRElasticLayer::WaitBulkRequests()
+{
+    if (!m_poBulkJobQueue)
+        return true;
+    m_poBulkJobQueue->WaitCompletion();
+
+    std::lock_guard<std::mutex> oLock(m_oBulkMutex);
+    for (const auto &oError : m_aoBulkErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    m_aoBulkErrors.clear();
+    const bool bRet = !m_bBulkRequestFailed;
+    m_bBulkRequestFailed = false;
+    return bRet;
+}
+
 /************************************************************************/
 /*                            CreateField()                             */
 /************************************************************************/
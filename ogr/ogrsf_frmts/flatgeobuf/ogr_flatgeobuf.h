@@ -39,6 +39,8 @@
 
 #include <deque>
 #include <limits>
+#include <memory>
+#include <vector>
 
 class OGRFlatGeobufDataset;
 
@@ -102,6 +104,20 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
+    // features read ahead by GetNextArrowArray(), whose buffers are verified
+    // and geometries decoded on worker threads (GDAL_NUM_THREADS)
+    struct PrefetchedFeature
+    {
+        uint64_t offset = 0;      // offset of the feature size prefix
+        uint64_t nextOffset = 0;  // offset of the next feature
+        std::vector<GByte> buffer{};
+        bool verified = true;
+        std::unique_ptr<OGRGeometry> geometry{};
+    };
+
+    int m_nNumThreads = 1;
+    std::deque<PrefetchedFeature> m_prefetchedFeatures{};
+
     // creation
     GDALDataset *m_poDS = nullptr;  // parent dataset to get metadata from it
     bool m_create = false;
@@ -129,11 +145,14 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
     OGRErr parseFeature(OGRFeature *poFeature);
+    bool readNextFeature(OGRFeature *poFeature);
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
     OGRErr readIndex();
     OGRErr readFeatureOffset(uint64_t index, uint64_t &featureOffset);
+    void prefetchFeatures(size_t maxFeatures);
+    static void decodePrefetchedFeaturesJob(void *pData);
 
     // serialize
     bool CreateFinalFile();
@@ -172,6 +191,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
     virtual OGRFeature *GetNextFeature() override;
+    virtual bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
                                int bApproxOK = true) override;
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) override;
@@ -29,9 +29,11 @@
 #include "ogrsf_frmts.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_json.h"
 #include "cpl_http.h"
 #include "cpl_time.h"
+#include "gdal_thread_pool.h"
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
 #include "ogr_recordbatch.h"
@@ -64,6 +66,18 @@ static OGRErr CPLErrorIO(const char *message)
     return OGRERR_FAILURE;
 }
 
+// Number of threads from the GDAL_NUM_THREADS configuration option
+static int GetNumThreads()
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        return 1;
+    const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : atoi(pszNumThreads);
+    return std::max(1, std::min(nNumThreads, 128));
+}
+
 OGRFlatGeobufLayer::OGRFlatGeobufLayer(const Header *poHeader, GByte *headerBuf,
                                        const char *pszFilename, VSILFILE *poFp,
                                        uint64_t offset)
@@ -85,6 +99,7 @@ OGRFlatGeobufLayer::OGRFlatGeobufLayer(const Header *poHeader, GByte *headerBuf,
     m_hasZ = m_poHeader->has_z();
     m_hasM = m_poHeader->has_m();
     m_hasT = m_poHeader->has_t();
+    m_nNumThreads = GetNumThreads();
     const auto envelope = m_poHeader->envelope();
     if (envelope && envelope->size() == 4)
     {
@@ -540,6 +555,154 @@ void OGRFlatGeobufLayer::writeHeader(VSILFILE *poFp, uint64_t featuresCount,
     m_writeOffset += c;
 }
 
+namespace
+{
+struct HilbertKey
+{
+    uint32_t hilbertValue;
+    size_t idx;  // index in the items to sort
+};
+
+// Same ordering as hilbertSort(), with ties broken by insertion order
+bool HilbertKeyGreater(const HilbertKey &a, const HilbertKey &b)
+{
+    return a.hilbertValue > b.hilbertValue ||
+           (a.hilbertValue == b.hilbertValue && a.idx < b.idx);
+}
+
+struct HilbertSortJob
+{
+    const std::deque<FeatureItem> *items = nullptr;
+    NodeItem extent{};
+    HilbertKey *keys = nullptr;
+    size_t start = 0;
+    size_t middle = 0;
+    size_t end = 0;
+};
+
+// Computes and sorts the keys of [start, end)
+void HilbertSortRunJob(void *pData)
+{
+    auto psJob = static_cast<HilbertSortJob *>(pData);
+    const auto &extent = psJob->extent;
+    const double width = extent.width();
+    const double height = extent.height();
+    for (size_t i = psJob->start; i < psJob->end; ++i)
+    {
+        psJob->keys[i].hilbertValue =
+            hilbert((*psJob->items)[i].nodeItem, HILBERT_MAX, extent.minX,
+                    extent.minY, width, height);
+        psJob->keys[i].idx = i;
+    }
+    std::sort(psJob->keys + psJob->start, psJob->keys + psJob->end,
+              HilbertKeyGreater);
+}
+
+// Merges the sorted runs [start, middle) and [middle, end)
+void HilbertMergeRunsJob(void *pData)
+{
+    auto psJob = static_cast<HilbertSortJob *>(pData);
+    std::inplace_merge(psJob->keys + psJob->start, psJob->keys + psJob->middle,
+                       psJob->keys + psJob->end, HilbertKeyGreater);
+}
+}  // namespace
+
+/************************************************************************/
+/*                      HilbertSortMultiThreaded()                      */
+/************************************************************************/
+
+// Multi-threaded equivalent of hilbertSort(). The Hilbert value of each item
+// is computed once (rather than at each comparison), runs of items are
+// sorted on worker threads and merged pairwise, also on worker threads, and
+// items are finally permuted in place, so that only 16 bytes per item of
+// extra memory are needed.
+static void HilbertSortMultiThreaded(std::deque<FeatureItem> &items,
+                                     int nNumThreads)
+{
+    const size_t nItems = items.size();
+    std::vector<HilbertKey> keys(nItems);
+
+    constexpr size_t MIN_ITEMS_PER_RUN = 10 * 1000;
+    const size_t nRuns = std::max<size_t>(
+        1, std::min(static_cast<size_t>(nNumThreads),
+                    nItems / MIN_ITEMS_PER_RUN));
+    std::vector<size_t> runBounds;
+    for (size_t i = 0; i <= nRuns; ++i)
+        runBounds.push_back(nItems * i / nRuns);
+
+    CPLWorkerThreadPool *poThreadPool =
+        nRuns > 1 ? GDALGetGlobalThreadPool(nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    const auto runJobs = [&poQueue](std::vector<HilbertSortJob> &jobs,
+                                    CPLThreadFunc pfnFunc)
+    {
+        for (auto &job : jobs)
+        {
+            if (!poQueue || !poQueue->SubmitJob(pfnFunc, &job))
+                pfnFunc(&job);
+        }
+        if (poQueue)
+            poQueue->WaitCompletion();
+    };
+
+    const NodeItem extent = calcExtent(items);
+    std::vector<HilbertSortJob> jobs(nRuns);
+    for (size_t i = 0; i < nRuns; ++i)
+    {
+        jobs[i].items = &items;
+        jobs[i].extent = extent;
+        jobs[i].keys = keys.data();
+        jobs[i].start = runBounds[i];
+        jobs[i].end = runBounds[i + 1];
+    }
+    runJobs(jobs, HilbertSortRunJob);
+
+    while (runBounds.size() > 2)
+    {
+        jobs.clear();
+        std::vector<size_t> newRunBounds;
+        for (size_t i = 0; i + 1 < runBounds.size(); i += 2)
+        {
+            newRunBounds.push_back(runBounds[i]);
+            if (i + 2 < runBounds.size())
+            {
+                HilbertSortJob job;
+                job.keys = keys.data();
+                job.start = runBounds[i];
+                job.middle = runBounds[i + 1];
+                job.end = runBounds[i + 2];
+                jobs.push_back(job);
+            }
+        }
+        newRunBounds.push_back(nItems);
+        runJobs(jobs, HilbertMergeRunsJob);
+        runBounds = std::move(newRunBounds);
+    }
+
+    // Apply the permutation in place, following its cycles. keys[j].idx is
+    // the index of the item that goes to position j, and is set to j once
+    // done.
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        if (keys[i].idx == i)
+            continue;
+        FeatureItem tmp = items[i];
+        size_t j = i;
+        while (true)
+        {
+            const size_t k = keys[j].idx;
+            keys[j].idx = j;
+            if (k == i)
+            {
+                items[j] = tmp;
+                break;
+            }
+            items[j] = items[k];
+            j = k;
+        }
+    }
+}
+
 static bool SupportsSeekWhileWriting(const std::string &osFilename)
 {
     return (!STARTS_WITH(osFilename.c_str(), "/vsi")) ||
@@ -611,7 +774,11 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
     writeHeader(m_poFp, m_featuresCount, &extentVector);
 
     CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
-    hilbertSort(m_featureItems);
+    const int nNumThreads = GetNumThreads();
+    if (nNumThreads > 1)
+        HilbertSortMultiThreaded(m_featureItems, nNumThreads);
+    else
+        hilbertSort(m_featureItems);
     CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
     uint64_t featureOffset = 0;
     for (auto &item : m_featureItems)
@@ -992,8 +1159,33 @@ static inline bool ParseDateTime(const char *pszInput, size_t nLen,
 
 OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
 {
-    if (m_create)
+    auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+    if (!readNextFeature(poFeature.get()))
         return nullptr;
+    return poFeature.release();
+}
+
+bool OGRFlatGeobufLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+    return readNextFeature(&oFeature);
+}
+
+// Reads the next feature matching the filters into poFeature, which is
+// recycled for features that do not match them.
+bool OGRFlatGeobufLayer::readNextFeature(OGRFeature *poFeature)
+{
+    if (m_create)
+        return false;
+
+    // Resume after the features consumed by GetNextArrowArray()
+    if (!m_prefetchedFeatures.empty())
+    {
+        m_offset = m_prefetchedFeatures.front().offset;
+        VSIFSeekL(m_poFp, m_offset, SEEK_SET);
+        m_prefetchedFeatures.clear();
+    }
 
     while (true)
     {
@@ -1001,32 +1193,32 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
         {
             CPLDebugOnly("FlatGeobuf", "GetNextFeature: iteration end at %lu",
                          static_cast<long unsigned int>(m_featuresPos));
-            return nullptr;
+            return false;
         }
 
         if (readIndex() != OGRERR_NONE)
         {
-            return nullptr;
+            return false;
         }
 
         if (m_queriedSpatialIndex && m_featuresCount == 0)
         {
             CPLDebugOnly("FlatGeobuf", "GetNextFeature: no features found");
-            return nullptr;
+            return false;
         }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
-        if (parseFeature(poFeature.get()) != OGRERR_NONE)
+        poFeature->Reset();
+        if (parseFeature(poFeature) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Fatal error parsing feature");
-            return nullptr;
+            return false;
         }
 
         if (VSIFEofL(m_poFp))
         {
             CPLDebug("FlatGeobuf", "GetNextFeature: iteration end due to EOF");
-            return nullptr;
+            return false;
         }
 
         m_featuresPos++;
@@ -1034,8 +1226,8 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
         if ((m_poFilterGeom == nullptr || m_ignoreSpatialFilter ||
              FilterGeometry(poFeature->GetGeometryRef())) &&
             (m_poAttrQuery == nullptr || m_ignoreAttributeFilter ||
-             m_poAttrQuery->Evaluate(poFeature.get())))
-            return poFeature.release();
+             m_poAttrQuery->Evaluate(poFeature)))
+            return true;
     }
 }
 
@@ -1444,6 +1636,162 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                    decodePrefetchedFeaturesJob()                     */
+/************************************************************************/
+
+namespace
+{
+struct FlatGeobufDecodeJob
+{
+    bool verifyBuffers = true;
+    bool decodeGeometry = true;
+    GeometryType geometryType = GeometryType::Unknown;
+    bool hasZ = false;
+    bool hasM = false;
+    std::vector<void *> features{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> errors{};
+};
+}  // namespace
+
+void OGRFlatGeobufLayer::decodePrefetchedFeaturesJob(void *pData)
+{
+    auto psJob = static_cast<FlatGeobufDecodeJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->errors);
+    for (void *pFeature : psJob->features)
+    {
+        auto &prefetched = *static_cast<PrefetchedFeature *>(pFeature);
+        if (psJob->verifyBuffers)
+        {
+            Verifier v(prefetched.buffer.data(), prefetched.buffer.size());
+            prefetched.verified = VerifyFeatureBuffer(v);
+        }
+        if (!prefetched.verified || !psJob->decodeGeometry)
+            continue;
+        const auto geometry =
+            GetRoot<Feature>(prefetched.buffer.data())->geometry();
+        if (geometry != nullptr)
+        {
+            auto geometryType = psJob->geometryType;
+            if (geometryType == GeometryType::Unknown)
+                geometryType = geometry->type();
+            prefetched.geometry.reset(
+                GeometryReader(geometry, geometryType, psJob->hasZ,
+                               psJob->hasM)
+                    .read());
+        }
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                         prefetchFeatures()                           */
+/************************************************************************/
+
+// Reads up to maxFeatures features, in the order in which GetNextArrowArray()
+// consumes them, into m_prefetchedFeatures, and then verifies their buffers
+// and decodes their geometries on worker threads. Reading stops at the first
+// feature that cannot be read this way, which is left to the regular code
+// path of GetNextArrowArray() (including the reporting of errors).
+void OGRFlatGeobufLayer::prefetchFeatures(size_t maxFeatures)
+{
+    CPLAssert(m_prefetchedFeatures.empty());
+    constexpr size_t MAX_PREFETCH_BYTES = 64 * 1024 * 1024;
+    size_t prefetchedBytes = 0;
+    uint64_t offset = m_offset;
+    for (size_t i = 0;
+         i < maxFeatures && prefetchedBytes < MAX_PREFETCH_BYTES; ++i)
+    {
+        const size_t featuresPos = m_featuresPos + i;
+        if (m_featuresCount > 0 && featuresPos >= m_featuresCount)
+            break;
+        bool seek = (featuresPos == 0);
+        if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
+        {
+            offset = m_offsetFeatures + m_foundItems[featuresPos].offset;
+            seek = true;
+        }
+        if (seek && VSIFSeekL(m_poFp, offset, SEEK_SET) == -1)
+            break;
+
+        PrefetchedFeature prefetched;
+        prefetched.offset = offset;
+        uint32_t featureSize = 0;
+        bool ok =
+            VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) == 1;
+        CPL_LSBPTR32(&featureSize);
+        // Large features are subject to extra sanity checks in the regular
+        // code path
+        ok = ok && featureSize <= 100 * 1024 * 1024;
+        if (ok)
+        {
+            try
+            {
+                prefetched.buffer.resize(featureSize);
+            }
+            catch (const std::bad_alloc &)
+            {
+                ok = false;
+            }
+        }
+        ok = ok && VSIFReadL(prefetched.buffer.data(), 1, featureSize,
+                             m_poFp) == featureSize;
+        if (!ok)
+        {
+            // Position the file where the regular code path expects it
+            VSIFSeekL(m_poFp, offset, SEEK_SET);
+            break;
+        }
+        offset += featureSize + sizeof(featureSize);
+        prefetched.nextOffset = offset;
+        prefetchedBytes += featureSize;
+        m_prefetchedFeatures.emplace_back(std::move(prefetched));
+    }
+
+    const size_t count = m_prefetchedFeatures.size();
+    if (count == 0)
+        return;
+
+    // Not worth using threads on a few features
+    constexpr size_t MIN_FEATURES_PER_JOB = 64;
+    const size_t jobCount =
+        std::max<size_t>(1, std::min(static_cast<size_t>(m_nNumThreads),
+                                     count / MIN_FEATURES_PER_JOB));
+    std::vector<FlatGeobufDecodeJob> jobs(jobCount);
+    for (size_t i = 0; i < jobCount; ++i)
+    {
+        auto &job = jobs[i];
+        job.verifyBuffers = m_bVerifyBuffers;
+        job.decodeGeometry = !m_poFeatureDefn->IsGeometryIgnored();
+        job.geometryType = m_geometryType;
+        job.hasZ = m_hasZ;
+        job.hasM = m_hasM;
+        for (size_t j = count * i / jobCount; j < count * (i + 1) / jobCount;
+             ++j)
+        {
+            job.features.push_back(&m_prefetchedFeatures[j]);
+        }
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        jobCount > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    for (auto &job : jobs)
+    {
+        if (!poQueue || !poQueue->SubmitJob(decodePrefetchedFeaturesJob, &job))
+            decodePrefetchedFeaturesJob(&job);
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    // Re-emit errors from the calling thread, in the order of the features
+    for (const auto &job : jobs)
+    {
+        for (const auto &error : job.errors)
+            CPLError(error.type, error.no, "%s", error.msg.c_str());
+    }
+}
+
 /************************************************************************/
 /*                      GetNextArrowArray()                             */
 /************************************************************************/
@@ -1499,6 +1847,8 @@ begin:
     const GIntBig nFeatureIdxStart = m_featuresPos;
 
     const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    // Not worth using threads on a few features
+    constexpr size_t MIN_PREFETCHED_FEATURES = 128;
     while (iFeat < sHelper.m_nMaxBatchSize)
     {
         bEOFOrError = true;
@@ -1529,82 +1879,118 @@ begin:
         if (m_featuresPos == 0)
             seek = true;
 
-        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+        // Read features ahead to process them on worker threads. Only the
+        // front one is consumed by each iteration.
+        if (m_prefetchedFeatures.empty() && m_nNumThreads > 1 &&
+            static_cast<size_t>(sHelper.m_nMaxBatchSize - iFeat) >=
+                MIN_PREFETCHED_FEATURES)
         {
-            break;
+            prefetchFeatures(sHelper.m_nMaxBatchSize - iFeat);
         }
+        PrefetchedFeature *prefetched =
+            m_prefetchedFeatures.empty() ? nullptr
+                                         : &m_prefetchedFeatures.front();
+
         uint32_t featureSize;
-        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
+        const GByte *featureBuf;
+        bool verified = true;
+        if (prefetched)
         {
-            if (VSIFEofL(m_poFp))
-                break;
-            CPLErrorIO("reading feature size");
-            goto error;
+            featureSize = static_cast<uint32_t>(prefetched->buffer.size());
+            featureBuf = prefetched->buffer.data();
+            m_offset = prefetched->nextOffset;
+            verified = prefetched->verified;
         }
-        CPL_LSBPTR32(&featureSize);
-
-        // Sanity check to avoid allocated huge amount of memory on corrupted
-        // feature
-        if (featureSize > 100 * 1024 * 1024)
+        else
         {
-            if (featureSize > feature_max_buffer_size)
+            if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+            {
+                break;
+            }
+            if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
             {
-                CPLErrorInvalidSize("feature");
+                if (VSIFEofL(m_poFp))
+                    break;
+                CPLErrorIO("reading feature size");
                 goto error;
             }
+            CPL_LSBPTR32(&featureSize);
 
-            if (m_nFileSize == 0)
+            // Sanity check to avoid allocated huge amount of memory on
+            // corrupted feature
+            if (featureSize > 100 * 1024 * 1024)
             {
-                VSIStatBufL sStatBuf;
-                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                if (featureSize > feature_max_buffer_size)
+                {
+                    CPLErrorInvalidSize("feature");
+                    goto error;
+                }
+
+                if (m_nFileSize == 0)
+                {
+                    VSIStatBufL sStatBuf;
+                    if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                    {
+                        m_nFileSize = sStatBuf.st_size;
+                    }
+                }
+                if (m_offset + featureSize > m_nFileSize)
                 {
-                    m_nFileSize = sStatBuf.st_size;
+                    CPLErrorIO("reading feature size");
+                    goto error;
                 }
             }
-            if (m_offset + featureSize > m_nFileSize)
+
+            const auto err = ensureFeatureBuf(featureSize);
+            if (err != OGRERR_NONE)
+                goto error;
+            if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
             {
-                CPLErrorIO("reading feature size");
+                CPLErrorIO("reading feature");
                 goto error;
             }
-        }
+            m_offset += featureSize + sizeof(featureSize);
+            featureBuf = m_featureBuf;
 
-        const auto err = ensureFeatureBuf(featureSize);
-        if (err != OGRERR_NONE)
-            goto error;
-        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        {
-            CPLErrorIO("reading feature");
-            goto error;
+            if (m_bVerifyBuffers)
+            {
+                Verifier v(m_featureBuf, featureSize);
+                verified = VerifyFeatureBuffer(v);
+            }
         }
-        m_offset += featureSize + sizeof(featureSize);
 
-        if (m_bVerifyBuffers)
+        if (!verified)
         {
-            Verifier v(m_featureBuf, featureSize);
-            const auto ok = VerifyFeatureBuffer(v);
-            if (!ok)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Buffer verification failed");
-                CPLDebugOnly("FlatGeobuf", "m_offset: %lu",
-                             static_cast<long unsigned int>(m_offset));
-                CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu",
-                             static_cast<long unsigned int>(m_featuresPos));
-                CPLDebugOnly("FlatGeobuf", "featureSize: %d", featureSize);
-                goto error;
-            }
+            CPLError(CE_Failure, CPLE_AppDefined, "Buffer verification failed");
+            CPLDebugOnly("FlatGeobuf", "m_offset: %lu",
+                         static_cast<long unsigned int>(m_offset));
+            CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu",
+                         static_cast<long unsigned int>(m_featuresPos));
+            CPLDebugOnly("FlatGeobuf", "featureSize: %d", featureSize);
+            goto error;
         }
 
-        const auto feature = GetRoot<Feature>(m_featureBuf);
+        const auto feature = GetRoot<Feature>(featureBuf);
         const auto geometry = feature->geometry();
         const auto properties = feature->properties();
         if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
         {
-            auto geometryType = m_geometryType;
-            if (geometryType == GeometryType::Unknown)
-                geometryType = geometry->type();
-            auto poOGRGeometry = std::unique_ptr<OGRGeometry>(
-                GeometryReader(geometry, geometryType, m_hasZ, m_hasM).read());
+            std::unique_ptr<OGRGeometry> poOwnedGeometry;
+            const OGRGeometry *poOGRGeometry;
+            if (prefetched)
+            {
+                poOGRGeometry = prefetched->geometry.get();
+            }
+            else
+            {
+                auto geometryType = m_geometryType;
+                if (geometryType == GeometryType::Unknown)
+                    geometryType = geometry->type();
+                poOwnedGeometry.reset(
+                    GeometryReader(geometry, geometryType, m_hasZ, m_hasM)
+                        .read());
+                poOGRGeometry = poOwnedGeometry.get();
+            }
             if (poOGRGeometry == nullptr)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -1612,7 +1998,7 @@ begin:
                 goto error;
             }
 
-            if (!FilterGeometry(poOGRGeometry.get()))
+            if (!FilterGeometry(poOGRGeometry))
                 goto end_of_loop;
 
             const int iArrowField = sHelper.m_mapOGRGeomFieldToArrowField[0];
@@ -1977,7 +2363,10 @@ begin:
 
     end_of_loop:
 
-        if (VSIFEofL(m_poFp))
+        if (prefetched)
+            m_prefetchedFeatures.pop_front();
+
+        if (m_prefetchedFeatures.empty() && VSIFEofL(m_poFp))
         {
             CPLDebug("FlatGeobuf", "GetNextFeature: iteration end due to EOF");
             break;
@@ -2438,6 +2827,8 @@ void OGRFlatGeobufLayer::ResetReading()
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
     m_ignoreAttributeFilter = false;
+    m_prefetchedFeatures.clear();
+    m_nNumThreads = GetNumThreads();
     return;
 }
 
@@ -78,4 +78,23 @@ OGRAttrIndex::~OGRAttrIndex()
 {
 }
 
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+// Returns the FIDs of the features whose key is between psMinKey and
+// psMaxKey (inclusive), as a list terminated by OGRNullFID, or nullptr if
+// the index does not support range lookups. A null bound means no bound.
+// The list may be a superset of the features that actually match (e.g. when
+// string keys are truncated or case-insensitive), so the attribute filter
+// must still be evaluated on the returned features.
+
+GIntBig *OGRAttrIndex::GetRangeMatches(const OGRField * /* psMinKey */,
+                                       const OGRField * /* psMaxKey */,
+                                       int *pnFIDCount)
+{
+    *pnFIDCount = 0;
+    return nullptr;
+}
+
 //! @endcond
@@ -34,6 +34,7 @@
 #include "ogr_api.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -1308,6 +1309,306 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                             GetJoinKey()                             */
+/************************************************************************/
+
+/** Compute the key of a feature in the hash table of a join.
+ *
+ * Keys are built so that they are equal when the attribute filter emitted
+ * by GetFilterForJoin() would match: real values of the primary layer go
+ * through the same "%.16g" formatting, and strings are lowercased when
+ * the secondary layer compares them case-insensitively, as the OGR SQL
+ * evaluator does.
+ */
+static bool GetJoinKey(OGRFeature *poFeature, int iField, OGRFieldType eKeyType,
+                       bool bPrimary, bool bCaseInsensitive,
+                       std::string &osKey)
+{
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    switch (eKeyType)
+    {
+        case OFTInteger64:
+            osKey = std::to_string(poFeature->GetFieldAsInteger64(iField));
+            break;
+
+        case OFTReal:
+        {
+            double dfVal = poFeature->GetFieldAsDouble(iField);
+            if (bPrimary &&
+                poFeature->GetFieldDefnRef(iField)->GetType() == OFTReal)
+            {
+                dfVal = CPLAtof(CPLSPrintf("%.16g", dfVal));
+            }
+            if (std::isnan(dfVal))
+                return false;
+            if (dfVal == 0)
+                dfVal = 0;  // normalize -0.0
+            osKey.assign(reinterpret_cast<const char *>(&dfVal),
+                         sizeof(dfVal));
+            break;
+        }
+
+        default:
+        {
+            CPLAssert(eKeyType == OFTString);
+            osKey = poFeature->GetFieldAsString(iField);
+            if (bCaseInsensitive)
+            {
+                for (char &ch : osKey)
+                    ch = static_cast<char>(
+                        CPLTolower(static_cast<unsigned char>(ch)));
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   IsJoinLayerCaseInsensitive()                       */
+/************************************************************************/
+
+/** Return whether the attribute filter of the secondary layer of a join
+ * compares strings case-insensitively.
+ *
+ * This is the case when it is evaluated by OGR SQL, but not for drivers
+ * that forward it to a SQL backend. This is found by filtering on
+ * osValue, a value of the field that has cased characters, with its case
+ * swapped.
+ */
+static bool IsJoinLayerCaseInsensitive(OGRLayer *poJoinLayer, int iField,
+                                       const std::string &osValue)
+{
+    std::string osSwapped(osValue);
+    for (char &ch : osSwapped)
+    {
+        const int nCh = static_cast<unsigned char>(ch);
+        const int nUpper = CPLToupper(nCh);
+        ch = static_cast<char>(nUpper != nCh ? nUpper : CPLTolower(nCh));
+    }
+
+    char *pszEscaped = CPLEscapeString(
+        osSwapped.c_str(), static_cast<int>(osSwapped.size()), CPLES_SQL);
+    const std::string osFilter = CPLSPrintf(
+        "\"%s\" = '%s'",
+        poJoinLayer->GetLayerDefn()->GetFieldDefn(iField)->GetNameRef(),
+        pszEscaped);
+    CPLFree(pszEscaped);
+
+    bool bCaseInsensitive = false;
+    poJoinLayer->ResetReading();
+    if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
+    {
+        // A feature whose value differs from the filtered one can only
+        // have been returned by a case-insensitive comparison.
+        while (auto poFeature =
+                   std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+        {
+            if (poFeature->IsFieldSetAndNotNull(iField) &&
+                osSwapped != poFeature->GetFieldAsString(iField))
+            {
+                bCaseInsensitive = true;
+                break;
+            }
+        }
+    }
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+    return bCaseInsensitive;
+}
+
+/************************************************************************/
+/*                         BuildJoinHashTable()                         */
+/************************************************************************/
+
+/** Index the features of the secondary layer of a join in a hash table
+ * by the join key, when the join condition is an equality between a field
+ * of the primary layer and one of the secondary layer, both numeric or
+ * both strings.
+ *
+ * This avoids issuing an attribute filter on the secondary layer for each
+ * feature of the primary layer, which is costly for drivers without
+ * attribute indices. Up to OGR_GENSQL_HASH_JOIN_MAX_FEATURES features are
+ * kept in memory. Beyond that, only their FIDs are kept and features are
+ * fetched back with GetFeature() if the secondary layer has fast random
+ * read, and otherwise the attribute filter code path is used.
+ */
+void OGRGenSQLResultsLayer::BuildJoinHashTable(int iJoin)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    JoinHashTable &oHashTable = m_aoJoinHashTables[iJoin];
+    oHashTable.bBuilt = true;
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_GENSQL_HASH_JOIN", "YES")))
+        return;
+
+    const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return;
+    }
+    const swq_expr_node *poPrimaryColumn = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondaryColumn = poExpr->papoSubExpr[1];
+    if (poPrimaryColumn->table_index != 0)
+        std::swap(poPrimaryColumn, poSecondaryColumn);
+    if (poPrimaryColumn->table_index != 0 ||
+        poSecondaryColumn->table_index != psJoinInfo->secondary_table)
+    {
+        return;
+    }
+
+    OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
+    if (poJoinLayer == poSrcLayer)
+        return;
+
+    const int iPrimaryField = poPrimaryColumn->field_index;
+    const int iSecondaryField = poSecondaryColumn->field_index;
+    const OGRFeatureDefn *poPrimaryFDefn = poSrcLayer->GetLayerDefn();
+    const OGRFeatureDefn *poSecondaryFDefn = poJoinLayer->GetLayerDefn();
+    if (iPrimaryField < 0 || iPrimaryField >= poPrimaryFDefn->GetFieldCount() ||
+        iSecondaryField < 0 ||
+        iSecondaryField >= poSecondaryFDefn->GetFieldCount())
+    {
+        return;
+    }
+    const auto ePrimaryType =
+        poPrimaryFDefn->GetFieldDefn(iPrimaryField)->GetType();
+    const auto eSecondaryType =
+        poSecondaryFDefn->GetFieldDefn(iSecondaryField)->GetType();
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    if (IsInteger(ePrimaryType) && IsInteger(eSecondaryType))
+        oHashTable.eKeyType = OFTInteger64;
+    else if ((IsInteger(ePrimaryType) || ePrimaryType == OFTReal) &&
+             (IsInteger(eSecondaryType) || eSecondaryType == OFTReal))
+        oHashTable.eKeyType = OFTReal;
+    else if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+        oHashTable.eKeyType = OFTString;
+    else
+        return;
+
+    const GIntBig nMaxFeatures = CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_GENSQL_HASH_JOIN_MAX_FEATURES", "1000000"));
+    GIntBig nFeatures = 0;
+    std::string osKey;
+    // Until a string value with cased characters is met, keys are the
+    // same whether comparisons are case-sensitive or not.
+    bool bCaseSensitivityKnown = oHashTable.eKeyType != OFTString;
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+    while (auto poFeature =
+               std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+    {
+        if (!bCaseSensitivityKnown &&
+            poFeature->IsFieldSetAndNotNull(iSecondaryField))
+        {
+            const std::string osValue =
+                poFeature->GetFieldAsString(iSecondaryField);
+            if (std::any_of(osValue.begin(), osValue.end(),
+                            [](char ch)
+                            {
+                                const int nCh = static_cast<unsigned char>(ch);
+                                return CPLToupper(nCh) != CPLTolower(nCh);
+                            }))
+            {
+                bCaseSensitivityKnown = true;
+                oHashTable.bCaseInsensitive = IsJoinLayerCaseInsensitive(
+                    poJoinLayer, iSecondaryField, osValue);
+                // Restart from the first feature, as the probe reset reading
+                nFeatures = 0;
+                oHashTable.bFIDOnly = false;
+                oHashTable.oMapFeatures.clear();
+                oHashTable.oMapFIDs.clear();
+                continue;
+            }
+        }
+        if (++nFeatures > nMaxFeatures && !oHashTable.bFIDOnly)
+        {
+            if (!poJoinLayer->TestCapability(OLCRandomRead))
+            {
+                CPLDebug("OGR",
+                         "Too many features in %s to build a hash table for "
+                         "the join",
+                         poJoinLayer->GetName());
+                oHashTable.oMapFeatures.clear();
+                return;
+            }
+            // Only keep FIDs from now
+            oHashTable.bFIDOnly = true;
+            for (const auto &oIter : oHashTable.oMapFeatures)
+            {
+                oHashTable.oMapFIDs[oIter.first] = oIter.second->GetFID();
+            }
+            oHashTable.oMapFeatures.clear();
+        }
+        if (!GetJoinKey(poFeature.get(), iSecondaryField, oHashTable.eKeyType,
+                        false, oHashTable.bCaseInsensitive, osKey))
+        {
+            continue;
+        }
+        // Keep the first matching feature, as the attribute filter
+        // based code path does.
+        if (oHashTable.bFIDOnly)
+        {
+            if (poFeature->GetFID() == OGRNullFID)
+            {
+                oHashTable.oMapFIDs.clear();
+                return;
+            }
+            oHashTable.oMapFIDs.emplace(osKey, poFeature->GetFID());
+        }
+        else if (oHashTable.oMapFeatures.find(osKey) ==
+                 oHashTable.oMapFeatures.end())
+        {
+            oHashTable.oMapFeatures[osKey] = std::move(poFeature);
+        }
+    }
+
+    oHashTable.iPrimaryField = iPrimaryField;
+    oHashTable.bValid = true;
+}
+
+/************************************************************************/
+/*                       GetJoinFeatureFromHashTable()                  */
+/************************************************************************/
+
+/** Return the feature of the secondary layer of a join that matches a
+ * feature of the primary layer, or nullptr, using the hash table built
+ * by BuildJoinHashTable().
+ */
+OGRFeature *OGRGenSQLResultsLayer::GetJoinFeatureFromHashTable(
+    int iJoin, OGRFeature *poSrcFeat)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    const JoinHashTable &oHashTable = m_aoJoinHashTables[iJoin];
+    std::string osKey;
+    if (!GetJoinKey(poSrcFeat, oHashTable.iPrimaryField, oHashTable.eKeyType,
+                    true, oHashTable.bCaseInsensitive, osKey))
+    {
+        return nullptr;
+    }
+    if (oHashTable.bFIDOnly)
+    {
+        const auto oIter = oHashTable.oMapFIDs.find(osKey);
+        if (oIter == oHashTable.oMapFIDs.end())
+            return nullptr;
+        OGRLayer *poJoinLayer =
+            papoTableLayers[psSelectInfo->join_defs[iJoin].secondary_table];
+        return poJoinLayer->GetFeature(oIter->second);
+    }
+    const auto oIter = oHashTable.oMapFeatures.find(osKey);
+    if (oIter == oHashTable.oMapFeatures.end())
+        return nullptr;
+    return oIter->second->Clone();
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1339,6 +1640,17 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        if (m_aoJoinHashTables.empty())
+            m_aoJoinHashTables.resize(psSelectInfo->join_count);
+        if (!m_aoJoinHashTables[iJoin].bBuilt)
+            BuildJoinHashTable(iJoin);
+        if (m_aoJoinHashTables[iJoin].bValid)
+        {
+            apoFeatures.push_back(
+                GetJoinFeatureFromHashTable(iJoin, poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
 
         osFilter = GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
@@ -36,6 +36,8 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -87,9 +89,28 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig nIteratedFeatures;
     std::vector<CPLString> m_oDistinctList;
 
+    //! Map from the join key to the first matching feature (or its FID) of
+    //! the secondary layer of a join on fields equality
+    struct JoinHashTable
+    {
+        bool bBuilt = false;
+        bool bValid = false;
+        bool bFIDOnly = false;
+        bool bCaseInsensitive = false;
+        int iPrimaryField = -1;
+        OGRFieldType eKeyType = OFTInteger64;
+        std::unordered_map<std::string, std::unique_ptr<OGRFeature>>
+            oMapFeatures{};
+        std::unordered_map<std::string, GIntBig> oMapFIDs{};
+    };
+
+    std::vector<JoinHashTable> m_aoJoinHashTables{};
+
     int PrepareSummary();
 
     OGRFeature *TranslateFeature(OGRFeature *);
+    void BuildJoinHashTable(int iJoin);
+    OGRFeature *GetJoinFeatureFromHashTable(int iJoin, OGRFeature *poSrcFeat);
     void CreateOrderByIndex();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
@@ -32,6 +32,12 @@
 #include "mitab/mitab_priv.h"
 #include "cpl_minixml.h"
 
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <utility>
+#include <vector>
+
 /************************************************************************/
 /*                            OGRMIAttrIndex                            */
 /*                                                                      */
@@ -61,6 +67,9 @@ class OGRMIAttrIndex : public OGRAttrIndex
     GIntBig *GetAllMatches(OGRField *psKey) override;
     GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
                            int *nLength) override;
+    GIntBig *GetRangeMatches(const OGRField *psMinKey,
+                             const OGRField *psMaxKey,
+                             int *pnFIDCount) override;
 
     OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
     OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
@@ -820,6 +829,143 @@ GIntBig *OGRMIAttrIndex::GetAllMatches(OGRField *psKey)
     return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
 }
 
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+GIntBig *OGRMIAttrIndex::GetRangeMatches(const OGRField *psMinKey,
+                                         const OGRField *psMaxKey,
+                                         int *pnFIDCount)
+{
+    *pnFIDCount = 0;
+
+    const int nKeyLength = poINDFile->GetKeyLength(iIndex);
+    if (nKeyLength <= 0)
+        return nullptr;
+
+    // Intervals of keys to scan, in the order of the keys in the index
+    using Key = std::vector<GByte>;
+    std::vector<std::pair<Key, Key>> aoIntervals;
+    const Key abyLowestKey(nKeyLength, 0);
+    const Key abyHighestKey(nKeyLength, 0xFF);
+    const auto ToKey = [nKeyLength](const GByte *pabyKey)
+    { return Key(pabyKey, pabyKey + nKeyLength); };
+
+    switch (poFldDefn->GetType())
+    {
+        case OFTInteger:
+        {
+            // Keys are the big-endian representation of the value, with
+            // the sign bit flipped, on 1, 2 or 4 bytes.
+            if (nKeyLength > 4)
+                return nullptr;
+            const GIntBig nKeyMaxVal =
+                (static_cast<GIntBig>(1) << (8 * nKeyLength - 1)) - 1;
+            const GIntBig nMin =
+                std::max(psMinKey ? psMinKey->Integer : INT_MIN,
+                         static_cast<int>(-nKeyMaxVal - 1));
+            const GIntBig nMax =
+                std::min(psMaxKey ? psMaxKey->Integer : INT_MAX,
+                         static_cast<int>(nKeyMaxVal));
+            if (nMin <= nMax)
+            {
+                Key abyMinKey = ToKey(
+                    poINDFile->BuildKey(iIndex, static_cast<GInt32>(nMin)));
+                aoIntervals.emplace_back(
+                    std::move(abyMinKey),
+                    ToKey(poINDFile->BuildKey(iIndex,
+                                              static_cast<GInt32>(nMax))));
+            }
+            break;
+        }
+
+        case OFTReal:
+        {
+            // Keys are the big-endian representation of the opposite of the
+            // value: negative values come first, by decreasing value, then
+            // zero and positive values, by increasing value.
+            if (nKeyLength != 8)
+                return nullptr;
+            const double dfMin = psMinKey
+                                     ? psMinKey->Real
+                                     : -std::numeric_limits<double>::infinity();
+            const double dfMax = psMaxKey
+                                     ? psMaxKey->Real
+                                     : std::numeric_limits<double>::infinity();
+            if (!(dfMin <= dfMax))
+                break;
+            if (dfMin <= 0)
+            {
+                // Negative values, including -0
+                Key abyMinKey =
+                    dfMax < 0 ? ToKey(poINDFile->BuildKey(iIndex, dfMax))
+                              : abyLowestKey;
+                aoIntervals.emplace_back(
+                    std::move(abyMinKey),
+                    dfMin == 0 ? abyLowestKey
+                               : ToKey(poINDFile->BuildKey(iIndex, dfMin)));
+            }
+            if (dfMax >= 0)
+            {
+                Key abyMinKey = ToKey(
+                    poINDFile->BuildKey(iIndex, dfMin > 0 ? dfMin : 0.0));
+                aoIntervals.emplace_back(
+                    std::move(abyMinKey),
+                    ToKey(poINDFile->BuildKey(iIndex, dfMax)));
+            }
+            break;
+        }
+
+        case OFTString:
+        {
+            // Keys are upper-cased, truncated and padded with nul bytes.
+            Key abyMinKey =
+                psMinKey ? ToKey(poINDFile->BuildKey(iIndex, psMinKey->String))
+                         : abyLowestKey;
+            aoIntervals.emplace_back(
+                std::move(abyMinKey),
+                psMaxKey ? ToKey(poINDFile->BuildKey(iIndex, psMaxKey->String))
+                         : abyHighestKey);
+            break;
+        }
+
+        default:
+            return nullptr;
+    }
+
+    int nLength = 2;
+    GIntBig *panFIDList =
+        static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * nLength));
+    Key abyKey(nKeyLength);
+    for (const auto &oInterval : aoIntervals)
+    {
+        GIntBig nFID = poINDFile->FindFirstGreaterOrEqual(
+            iIndex, oInterval.first.data(), abyKey.data());
+        while (nFID > 0 && abyKey <= oInterval.second)
+        {
+            if (*pnFIDCount >= nLength - 1)
+            {
+                nLength = nLength * 2 + 10;
+                panFIDList = static_cast<GIntBig *>(
+                    CPLRealloc(panFIDList, sizeof(GIntBig) * nLength));
+            }
+            panFIDList[(*pnFIDCount)++] = nFID - 1;
+
+            nFID = poINDFile->FindNextInOrder(iIndex, abyKey.data());
+        }
+        if (nFID < 0)
+        {
+            CPLFree(panFIDList);
+            *pnFIDCount = 0;
+            return nullptr;
+        }
+    }
+
+    panFIDList[*pnFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
 /************************************************************************/
 /*                               Clear()                                */
 /************************************************************************/
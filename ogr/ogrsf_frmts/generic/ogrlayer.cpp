@@ -35,10 +35,17 @@
 #include "ograpispy.h"
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
+#include "gdal_thread_pool.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_quad_tree.h"
 #include "cpl_time.h"
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <set>
 
 /************************************************************************/
@@ -650,6 +657,85 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature object.
+
+ This method behaves like GetNextFeature(), honouring the spatial and
+ attribute filters, but the next feature is stored into a feature object
+ owned by the caller, instead of a newly allocated one. Calling it in a
+ loop with the same OGRFeature instance enables drivers that override
+ this method (GPKG, Shapefile, FlatGeobuf, CSV, OpenFileGDB) to recycle
+ the feature, its field array and, when possible, its geometry, instead
+ of allocating them again for each feature.
+
+ The feature should have been created with GetLayerDefn() as its feature
+ definition. Otherwise, the next feature is copied into it with
+ OGRFeature::SetFrom() in forgiving mode. The previous content of the
+ feature is discarded.
+
+ The default implementation calls GetNextFeature() and moves its content
+ into oFeature with OGRFeature::SwapContent().
+
+ This method is the same as the C function OGR_L_GetNextFeatureInto().
+
+ @param oFeature feature into which the next feature is stored. Its
+ content is undefined when false is returned.
+ @return true if a feature was read, false if no more features are
+ available or an error occurred.
+ @since GDAL 3.10
+*/
+
+bool OGRLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    auto poFeature = std::unique_ptr<OGRFeature>(GetNextFeature());
+    if (!poFeature)
+        return false;
+    if (poFeature->GetDefnRef() == oFeature.GetDefnRef())
+    {
+        oFeature.SwapContent(*poFeature);
+    }
+    else
+    {
+        oFeature.Reset();
+        oFeature.SetFrom(poFeature.get());
+        oFeature.SetFID(poFeature->GetFID());
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      OGR_L_GetNextFeatureInto()                      */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature object.
+
+ This function is the same as the C++ method OGRLayer::GetNextFeatureInto().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeature handle to the feature into which the next feature is
+ stored, typically created with OGR_F_Create(OGR_L_GetLayerDefn(hLayer)).
+ @return true if a feature was read, false if no more features are
+ available or an error occurred.
+ @since GDAL 3.10
+*/
+
+bool OGR_L_GetNextFeatureInto(OGRLayerH hLayer, OGRFeatureH hFeature)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureInto", false);
+    VALIDATE_POINTER1(hFeature, "OGR_L_GetNextFeatureInto", false);
+
+    return OGRLayer::FromHandle(hLayer)->GetNextFeatureInto(
+        *OGRFeature::FromHandle(hFeature));
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -1900,6 +1986,16 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
             }
             else if (OGRGeometryFactory::haveGEOS())
             {
+                if (m_pPreparedFilterGeom)
+                {
+                    // Convert directly the WKB to GEOS, without going
+                    // through an OGRGeometry
+                    const int nRet = OGRPreparedGeometryIntersectsWKB(
+                        m_pPreparedFilterGeom, pabyWKB, nWKBSize);
+                    if (nRet >= 0)
+                        return nRet == 1;
+                }
+
                 OGRGeometry *poGeom = nullptr;
                 int ret = FALSE;
                 if (OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeom,
@@ -2571,6 +2667,380 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
         return poGeom;
 }
 
+/************************************************************************/
+/*                        OGRLayerOverlayIndex                          */
+/************************************************************************/
+
+namespace
+{
+
+/** Features of the other layer of an overlay operation that may intersect
+ * a given feature, as returned by OGRLayerOverlayIndex::Query() */
+struct OGRLayerOverlayCandidates
+{
+    std::vector<OGRFeature *> apoFeatures{};
+    // Owns the features when they have been read from the layer.
+    std::vector<OGRFeatureUniquePtr> apoFeaturesHolder{};
+
+    std::vector<OGRFeature *>::const_iterator begin() const
+    {
+        return apoFeatures.begin();
+    }
+
+    std::vector<OGRFeature *>::const_iterator end() const
+    {
+        return apoFeatures.end();
+    }
+};
+
+/** Gives access to the features of the other layer of an overlay operation
+ * that intersect a given feature.
+ *
+ * Once Build() has been called, the features of the layer (honoring its
+ * current filters) are held in memory and indexed with a quad tree on the
+ * envelopes of their geometries, so that Query() can be called concurrently
+ * from several threads. Otherwise, Query() sets a spatial filter on the
+ * layer and reads it.
+ */
+class OGRLayerOverlayIndex
+{
+    OGRLayer *m_poLayer = nullptr;
+    bool m_bBuilt = false;
+    std::vector<OGRFeatureUniquePtr> m_apoFeatures{};
+    CPLQuadTree *m_hQuadTree = nullptr;
+    mutable std::mutex m_oMutex{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerOverlayIndex)
+
+  public:
+    explicit OGRLayerOverlayIndex(OGRLayer *poLayer) : m_poLayer(poLayer)
+    {
+    }
+
+    ~OGRLayerOverlayIndex()
+    {
+        if (m_hQuadTree)
+            CPLQuadTreeDestroy(m_hQuadTree);
+    }
+
+    void Build();
+
+    bool IsBuilt() const
+    {
+        return m_bBuilt;
+    }
+
+    OGRGeometry *Query(OGRGeometry *pGeometryExistingFilter,
+                       OGRFeature *pFeature,
+                       OGRLayerOverlayCandidates &oCandidates) const;
+
+    void SetFieldsFrom(OGRFeature *pFeatureDst, const OGRFeature *pFeatureSrc,
+                       const int *map) const;
+};
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Load the features of the layer with a non-empty geometry in memory and
+ * index them. */
+void OGRLayerOverlayIndex::Build()
+{
+    OGREnvelope sGlobalEnvelope;
+    std::vector<OGREnvelope> asEnvelopes;
+    m_poLayer->ResetReading();
+    while (OGRFeature *poFeature = m_poLayer->GetNextFeature())
+    {
+        OGRFeatureUniquePtr poFeatureHolder(poFeature);
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            sGlobalEnvelope.Merge(sEnvelope);
+            asEnvelopes.push_back(sEnvelope);
+            m_apoFeatures.push_back(std::move(poFeatureHolder));
+        }
+    }
+    m_bBuilt = true;
+    if (m_apoFeatures.empty())
+        return;
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalEnvelope.MinX;
+    sGlobalBounds.miny = sGlobalEnvelope.MinY;
+    sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+    sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+    m_hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    for (size_t i = 0; i < asEnvelopes.size(); ++i)
+    {
+        CPLRectObj sRect;
+        sRect.minx = asEnvelopes[i].MinX;
+        sRect.miny = asEnvelopes[i].MinY;
+        sRect.maxx = asEnvelopes[i].MaxX;
+        sRect.maxy = asEnvelopes[i].MaxY;
+        CPLQuadTreeInsertWithBounds(
+            m_hQuadTree, reinterpret_cast<void *>(static_cast<uintptr_t>(i)),
+            &sRect);
+    }
+}
+
+/************************************************************************/
+/*                               Query()                                */
+/************************************************************************/
+
+/** Equivalent of set_filter_from() followed by a read of the layer.
+ *
+ * Returns the geometry of pFeature, or nullptr if it has none or if it does
+ * not intersect pGeometryExistingFilter, and fills oCandidates with the
+ * features of the layer that intersect it (or its intersection with
+ * pGeometryExistingFilter), in the order they are read from the layer.
+ */
+OGRGeometry *
+OGRLayerOverlayIndex::Query(OGRGeometry *pGeometryExistingFilter,
+                            OGRFeature *pFeature,
+                            OGRLayerOverlayCandidates &oCandidates) const
+{
+    oCandidates.apoFeatures.clear();
+    oCandidates.apoFeaturesHolder.clear();
+
+    if (!m_bBuilt)
+    {
+        OGRGeometry *geom =
+            set_filter_from(m_poLayer, pGeometryExistingFilter, pFeature);
+        if (geom)
+        {
+            for (auto &&y : m_poLayer)
+            {
+                oCandidates.apoFeatures.push_back(y.get());
+                oCandidates.apoFeaturesHolder.push_back(std::move(y));
+            }
+        }
+        return geom;
+    }
+
+    OGRGeometry *geom = pFeature->GetGeometryRef();
+    if (!geom)
+        return nullptr;
+    OGRGeometryUniquePtr intersection;
+    const OGRGeometry *filter = geom;
+    if (pGeometryExistingFilter)
+    {
+        if (!geom->Intersects(pGeometryExistingFilter))
+            return nullptr;
+        intersection.reset(geom->Intersection(pGeometryExistingFilter));
+        if (!intersection)
+            return nullptr;
+        filter = intersection.get();
+    }
+    if (!m_hQuadTree || filter->IsEmpty())
+        return geom;
+
+    OGREnvelope sEnvelope;
+    filter->getEnvelope(&sEnvelope);
+    CPLRectObj sAoi;
+    sAoi.minx = sEnvelope.MinX;
+    sAoi.miny = sEnvelope.MinY;
+    sAoi.maxx = sEnvelope.MaxX;
+    sAoi.maxy = sEnvelope.MaxY;
+    int nCount = 0;
+    void **pahFeatures = CPLQuadTreeSearch(m_hQuadTree, &sAoi, &nCount);
+    std::vector<size_t> anIndices;
+    anIndices.reserve(nCount);
+    for (int i = 0; i < nCount; ++i)
+    {
+        anIndices.push_back(static_cast<size_t>(
+            reinterpret_cast<uintptr_t>(pahFeatures[i])));
+    }
+    CPLFree(pahFeatures);
+    // Preserve the order in which features are read from the layer
+    std::sort(anIndices.begin(), anIndices.end());
+
+    OGRPreparedGeometryUniquePtr filter_prepared;
+    if (anIndices.size() > 1 && OGRHasPreparedGeometrySupport())
+    {
+        filter_prepared.reset(OGRCreatePreparedGeometry(
+            OGRGeometry::ToHandle(const_cast<OGRGeometry *>(filter))));
+    }
+    for (size_t i : anIndices)
+    {
+        OGRFeature *y = m_apoFeatures[i].get();
+        OGRGeometry *y_geom = y->GetGeometryRef();
+        if (filter_prepared
+                ? OGRPreparedGeometryIntersects(filter_prepared.get(),
+                                                OGRGeometry::ToHandle(y_geom))
+                : filter->Intersects(y_geom))
+        {
+            oCandidates.apoFeatures.push_back(y);
+        }
+    }
+    return geom;
+}
+
+/************************************************************************/
+/*                           SetFieldsFrom()                            */
+/************************************************************************/
+
+/** Thread-safe equivalent of pFeatureDst->SetFieldsFrom(pFeatureSrc, map)
+ * for a feature returned by Query().
+ *
+ * Converting field values to string caches the result in the source
+ * feature, which is shared between threads when the index is built.
+ */
+void OGRLayerOverlayIndex::SetFieldsFrom(OGRFeature *pFeatureDst,
+                                         const OGRFeature *pFeatureSrc,
+                                         const int *map) const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    pFeatureDst->SetFieldsFrom(pFeatureSrc, map);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                          get_num_threads()                           */
+/************************************************************************/
+
+static int get_num_threads(const char *const *papszOptions)
+{
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, std::min(nThreads, 1024));
+}
+
+/************************************************************************/
+/*                         process_features()                           */
+/************************************************************************/
+
+using OGRLayerOverlayFunc = std::function<OGRErr(
+    const OGRFeatureUniquePtr &x, std::vector<OGRFeatureUniquePtr> &results)>;
+
+namespace
+{
+struct OGRLayerOverlayJob
+{
+    const OGRLayerOverlayFunc *pFunc = nullptr;
+    OGRFeatureUniquePtr x{};
+    std::vector<OGRFeatureUniquePtr> results{};
+    OGRErr eErr = OGRERR_NONE;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+static void process_feature_job(void *pData)
+{
+    auto psJob = static_cast<OGRLayerOverlayJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    psJob->eErr = (*psJob->pFunc)(psJob->x, psJob->results);
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/** Call func on each feature of pLayer and insert the features it returns
+ * into pLayerResult, in the order of the features of pLayer.
+ *
+ * When nThreads > 1, func is called concurrently on batches of features by
+ * worker threads, and must thus be thread-safe. Reading pLayer and writing
+ * pLayerResult are always done by the calling thread. Processing stops at
+ * the first feature for which func does not return OGRERR_NONE, once the
+ * features it returned have been inserted.
+ */
+static OGRErr process_features(OGRLayer *pLayer, OGRLayer *pLayerResult,
+                               const OGRLayerOverlayFunc &func, int nThreads,
+                               int bSkipFailures, GDALProgressFunc pfnProgress,
+                               void *pProgressArg, double &progress_counter,
+                               double progress_max)
+{
+    GDALThreadReservation oThreadReservation(nThreads);
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    std::vector<OGRLayerOverlayJob> asJobs;
+    // Must be declared after asJobs, so that its destructor, that waits for
+    // the completion of jobs, is called first.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (poThreadPool)
+        poJobQueue = poThreadPool->CreateJobQueue();
+    const size_t nBatchSize =
+        poJobQueue
+            ? static_cast<size_t>(oThreadReservation.GetThreadCount()) * 64
+            : 1;
+
+    pLayer->ResetReading();
+    bool bEOF = false;
+    while (!bEOF)
+    {
+        asJobs.clear();
+        while (asJobs.size() < nBatchSize)
+        {
+            OGRFeature *x = pLayer->GetNextFeature();
+            if (!x)
+            {
+                bEOF = true;
+                break;
+            }
+            asJobs.emplace_back();
+            asJobs.back().pFunc = &func;
+            asJobs.back().x.reset(x);
+        }
+
+        if (poJobQueue)
+        {
+            for (auto &sJob : asJobs)
+            {
+                if (!poJobQueue->SubmitJob(process_feature_job, &sJob))
+                {
+                    poJobQueue->WaitCompletion();
+                    return OGRERR_FAILURE;
+                }
+            }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            for (auto &sJob : asJobs)
+                sJob.eErr = func(sJob.x, sJob.results);
+        }
+
+        for (auto &sJob : asJobs)
+        {
+            for (const auto &sError : sJob.aoErrors)
+            {
+                CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+            }
+
+            if (pfnProgress)
+            {
+                double p = progress_counter / progress_max;
+                if (p > 0 && !pfnProgress(p, "", pProgressArg))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                    return OGRERR_FAILURE;
+                }
+                progress_counter += 1.0;
+            }
+
+            for (auto &z : sJob.results)
+            {
+                OGRErr ret = pLayerResult->CreateFeature(z.get());
+                if (ret != OGRERR_NONE)
+                {
+                    if (!bSkipFailures)
+                        return ret;
+                    CPLErrorReset();
+                }
+            }
+            if (sJob.eErr != OGRERR_NONE)
+                return sJob.eErr;
+        }
+    }
+    return OGRERR_NONE;
+}
+
 /************************************************************************/
 /*                          Intersection()                              */
 /************************************************************************/
@@ -2616,6 +3086,15 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -2656,7 +3135,6 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     GBool bEnvelopeSet;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     int bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     int bPromoteToMulti = CPLTestBool(
@@ -2670,57 +3148,15 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-    bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
-    if (bKeepLowerDimGeom)
-    {
-        // require that the result layer is of geom type unknown
-        if (pLayerResult->GetGeomType() != wkbUnknown)
-        {
-            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
-                            "since the result layer does not allow it.");
-            bKeepLowerDimGeom = FALSE;
-        }
-    }
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
 
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processFeature = [&](const OGRFeatureUniquePtr &x,
+                                    std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // is it worth to proceed?
         if (bEnvelopeSet)
         {
@@ -2734,35 +3170,34 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                     sEnvelopeMethod.MaxX < x_env.MinX ||
                     sEnvelopeMethod.MaxY < x_env.MinY)
                 {
-                    continue;
+                    return OGRERR_NONE;
                 }
             }
             else
             {
-                continue;
+                return OGRERR_NONE;
             }
         }
 
         // set up the filter for method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRPreparedGeometryUniquePtr x_prepared_geom;
@@ -2772,11 +3207,11 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
             if (!x_prepared_geom)
             {
-                goto done;
+                return OGRERR_FAILURE;
             }
         }
 
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -2786,7 +3221,6 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (x_prepared_geom)
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
                 if (bPretestContainment &&
                     OGRPreparedGeometryContains(x_prepared_geom.get(),
                                                 OGRGeometry::ToHandle(y_geom)))
@@ -2807,13 +3241,11 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                         continue;
                     }
                 }
@@ -2826,13 +3258,11 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                         continue;
                     }
                 }
@@ -2846,27 +3276,58 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             }
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
             z->SetFieldsFrom(x.get(), mapInput);
-            z->SetFieldsFrom(y.get(), mapMethod);
+            oMethodIndex.SetFieldsFrom(z.get(), y, mapMethod);
             if (bPromoteToMulti)
                 z_geom.reset(promote_to_multi(z_geom.release()));
             z->SetGeometryDirectly(z_geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
         }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
+    }
+
+    // get resources
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
+    bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
+    if (bKeepLowerDimGeom)
+    {
+        // require that the result layer is of geom type unknown
+        if (pLayerResult->GetGeomType() != wkbUnknown)
+        {
+            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
+                            "since the result layer does not allow it.");
+            bKeepLowerDimGeom = FALSE;
+        }
+    }
+
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processFeature,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
         ret = OGRERR_FAILURE;
@@ -2929,6 +3390,15 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -3017,6 +3487,16 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer, and then of the input layer, into an in-memory spatial
+ *     index, but set a spatial filter on them for each processed feature
+ *     instead. This uses less memory, but is much slower on large layers.
+ *     (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -3058,7 +3538,6 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     int bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     int bPromoteToMulti = CPLTestBool(
@@ -3070,80 +3549,35 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(this, &pGeometryInputFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-    if (bKeepLowerDimGeom)
-    {
-        // require that the result layer is of geom type unknown
-        if (pLayerResult->GetGeomType() != wkbUnknown)
-        {
-            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
-                            "since the result layer does not allow it.");
-            bKeepLowerDimGeom = FALSE;
-        }
-    }
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
+    OGRLayerOverlayIndex oInputIndex(this);
 
-    // add features based on input layer
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processInput = [&](const OGRFeatureUniquePtr &x,
+                                  std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRPreparedGeometryUniquePtr x_prepared_geom;
@@ -3153,14 +3587,14 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
             if (!x_prepared_geom)
             {
-                goto done;
+                return OGRERR_FAILURE;
             }
         }
 
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3182,13 +3616,11 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 if (!bSkipFailures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return OGRERR_FAILURE;
                 }
                 else
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                 }
             }
 
@@ -3198,13 +3630,11 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 if (!bSkipFailures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return OGRERR_FAILURE;
                 }
                 else
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                     continue;
                 }
             }
@@ -3219,7 +3649,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
                 z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
+                oMethodIndex.SetFieldsFrom(z.get(), y, mapMethod);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -3235,8 +3665,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                     {
                         if (!bSkipFailures)
                         {
-                            ret = OGRERR_FAILURE;
-                            goto done;
+                            return OGRERR_FAILURE;
                         }
                         else
                         {
@@ -3249,19 +3678,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                     }
                 }
 
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
-                    {
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
+                results.push_back(std::move(z));
             }
         }
         x_prepared_geom.reset();
@@ -3277,68 +3694,41 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
         }
-    }
+        return OGRERR_NONE;
+    };
 
-    // restore filter on method layer and add features based on it
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&x : pLayerMethod)
+    // Compute the result features for one feature of the method layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processMethod = [&](const OGRFeatureUniquePtr &x,
+                                   std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on input layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
+            oInputIndex.Query(pGeometryInputFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3356,13 +3746,11 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                     }
                 }
                 else
@@ -3383,21 +3771,68 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
+        }
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
+    }
+
+    // get resources
+    ret = clone_spatial_filter(this, &pGeometryInputFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
+    if (bKeepLowerDimGeom)
+    {
+        // require that the result layer is of geom type unknown
+        if (pLayerResult->GetGeomType() != wkbUnknown)
+        {
+            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
+                            "since the result layer does not allow it.");
+            bKeepLowerDimGeom = FALSE;
         }
     }
+
+    // add features based on input layer
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processInput,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
+    // restore filter on method layer and add features based on it
+    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+    if (bUseSpatialIndex)
+        oInputIndex.Build();
+    ret = process_features(
+        pLayerMethod, pLayerResult, processMethod,
+        oInputIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -3463,6 +3898,16 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer, and then of the input layer, into an in-memory spatial
+ *     index, but set a spatial filter on them for each processed feature
+ *     instead. This uses less memory, but is much slower on large layers.
+ *     (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -3542,6 +3987,16 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer, and then of the input layer, into an in-memory spatial
+ *     index, but set a spatial filter on them for each processed feature
+ *     instead. This uses less memory, but is much slower on large layers.
+ *     (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -3583,82 +4038,46 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     int bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     int bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
+    OGRLayerOverlayIndex oInputIndex(this);
 
-    // get resources
-    ret = clone_spatial_filter(this, &pGeometryInputFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-
-    // add features based on input layer
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processInput = [&](const OGRFeatureUniquePtr &x,
+                                  std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRGeometryUniquePtr geom(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3673,13 +4092,11 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                     }
                 }
                 else
@@ -3698,68 +4115,41 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 geom.reset(promote_to_multi(geom.release()));
             z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
         }
-    }
+        return OGRERR_NONE;
+    };
 
-    // restore filter on method layer and add features based on it
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&x : pLayerMethod)
+    // Compute the result features for one feature of the method layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processMethod = [&](const OGRFeatureUniquePtr &x,
+                                   std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on input layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
+            oInputIndex.Query(pGeometryInputFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRGeometryUniquePtr geom(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3772,13 +4162,11 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                     }
                 }
                 else
@@ -3797,21 +4185,58 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 geom.reset(promote_to_multi(geom.release()));
             z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
         }
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
     }
+
+    // get resources
+    ret = clone_spatial_filter(this, &pGeometryInputFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
+
+    // add features based on input layer
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processInput,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
+    // restore filter on method layer and add features based on it
+    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+    if (bUseSpatialIndex)
+        oInputIndex.Build();
+    ret = process_features(
+        pLayerMethod, pLayerResult, processMethod,
+        oInputIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -3870,6 +4295,16 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer, and then of the input layer, into an in-memory spatial
+ *     index, but set a spatial filter on them for each processed feature
+ *     instead. This uses less memory, but is much slower on large layers.
+ *     (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -3957,6 +4392,15 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -3995,7 +4439,6 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int *mapMethod = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     int bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     int bPromoteToMulti = CPLTestBool(
@@ -4007,77 +4450,34 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-    if (bKeepLowerDimGeom)
-    {
-        // require that the result layer is of geom type unknown
-        if (pLayerResult->GetGeomType() != wkbUnknown)
-        {
-            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
-                            "since the result layer does not allow it.");
-            bKeepLowerDimGeom = FALSE;
-        }
-    }
-
-    // get resources
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
 
-    // split the features in input layer to the result layer
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processFeature = [&](const OGRFeatureUniquePtr &x,
+                                    std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRPreparedGeometryUniquePtr x_prepared_geom;
@@ -4087,14 +4487,14 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
             if (!x_prepared_geom)
             {
-                goto done;
+                return OGRERR_FAILURE;
             }
         }
 
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4114,13 +4514,11 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 if (!bSkipFailures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return OGRERR_FAILURE;
                 }
                 else
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                 }
             }
 
@@ -4130,13 +4528,11 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 if (!bSkipFailures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return OGRERR_FAILURE;
                 }
                 else
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                 }
             }
             else if (poIntersection->IsEmpty() ||
@@ -4151,7 +4547,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
                 z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
+                oMethodIndex.SetFieldsFrom(z.get(), y, mapMethod);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -4166,8 +4562,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                     {
                         if (!bSkipFailures)
                         {
-                            ret = OGRERR_FAILURE;
-                            goto done;
+                            return OGRERR_FAILURE;
                         }
                         else
                         {
@@ -4179,19 +4574,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                         x_geom_diff.swap(x_geom_diff_new);
                     }
                 }
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
-                    {
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
+                results.push_back(std::move(z));
             }
         }
 
@@ -4208,21 +4591,53 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
+        }
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
+    }
+    if (bKeepLowerDimGeom)
+    {
+        // require that the result layer is of geom type unknown
+        if (pLayerResult->GetGeomType() != wkbUnknown)
+        {
+            CPLDebug("OGR", "Resetting KEEP_LOWER_DIMENSION_GEOMETRIES to NO "
+                            "since the result layer does not allow it.");
+            bKeepLowerDimGeom = FALSE;
         }
     }
+
+    // get resources
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
+
+    // split the features in input layer to the result layer
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processFeature,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -4283,6 +4698,15 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -4362,6 +4786,15 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -4408,72 +4841,39 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, false, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
 
-    // add clipped features from the input layer
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processFeature = [&](const OGRFeatureUniquePtr &x,
+                                    std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRGeometryUniquePtr x_geom_diff(
             x_geom->clone());  // this will be the geometry of a result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4488,13 +4888,11 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                     }
                 }
                 else
@@ -4515,22 +4913,44 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
             z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
         }
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
     }
 
+    // get resources
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, false, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
+
+    // add clipped features from the input layer
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processFeature,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
+
     // restore the original filter and add features from the update layer
     pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
     for (auto &&y : pLayerMethod)
@@ -4627,6 +5047,15 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -4699,6 +5128,15 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -4735,74 +5173,45 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     int bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     int bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, nullptr, mapInput,
-                            nullptr, false, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
 
-    poDefnResult = pLayerResult->GetLayerDefn();
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processFeature = [&](const OGRFeatureUniquePtr &x,
+                                    std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRGeometryUniquePtr
             geom;  // this will be the geometry of the result feature
         // incrementally add area from y to geom
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4819,13 +5228,11 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 {
                     if (!bSkipFailures)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        return OGRERR_FAILURE;
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
                     }
                 }
                 else
@@ -4845,13 +5252,11 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 if (!bSkipFailures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return OGRERR_FAILURE;
                 }
                 else
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                 }
             }
             else if (!poIntersection->IsEmpty())
@@ -4862,22 +5267,39 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
                 z->SetGeometryDirectly(poIntersection.release());
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
-                    {
-                        goto done;
-                    }
-                    else
-                    {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
-                    }
-                }
+                results.push_back(std::move(z));
             }
         }
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
     }
+
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, nullptr, mapInput,
+                            nullptr, false, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+
+    poDefnResult = pLayerResult->GetLayerDefn();
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processFeature,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -4924,6 +5346,15 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -4996,6 +5427,15 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -5032,76 +5472,46 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
-    double progress_ticker = 0;
     int bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     int bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
-    // check for GEOS
-    if (!OGRGeometryFactory::haveGEOS())
-    {
-        return OGRERR_UNSUPPORTED_OPERATION;
-    }
-
-    // get resources
-    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = create_field_map(poDefnInput, &mapInput);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, nullptr, mapInput,
-                            nullptr, false, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
+    const bool bUseSpatialIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_SPATIAL_INDEX", "YES"));
+    OGRLayerOverlayIndex oMethodIndex(pLayerMethod);
 
-    for (auto &&x : this)
+    // Compute the result features for one feature of this layer.
+    // May be called concurrently from several threads by process_features().
+    const auto processFeature = [&](const OGRFeatureUniquePtr &x,
+                                    std::vector<OGRFeatureUniquePtr> &results)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
         // set up the filter on the method layer
         CPLErrorReset();
+        OGRLayerOverlayCandidates oCandidates;
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            oMethodIndex.Query(pGeometryMethodFilter, x.get(), oCandidates);
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
             {
-                ret = OGRERR_FAILURE;
-                goto done;
+                return OGRERR_FAILURE;
             }
             else
             {
                 CPLErrorReset();
-                ret = OGRERR_NONE;
             }
         }
         if (!x_geom)
         {
-            continue;
+            return OGRERR_NONE;
         }
 
         OGRGeometryUniquePtr geom(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
         // incrementally erase y from geom
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oCandidates)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -5112,13 +5522,11 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 if (!bSkipFailures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return OGRERR_FAILURE;
                 }
                 else
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
                 }
             }
             else
@@ -5139,21 +5547,39 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             if (bPromoteToMulti)
                 geom.reset(promote_to_multi(geom.release()));
             z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+            results.push_back(std::move(z));
         }
+        return OGRERR_NONE;
+    };
+
+    // check for GEOS
+    if (!OGRGeometryFactory::haveGEOS())
+    {
+        return OGRERR_UNSUPPORTED_OPERATION;
     }
+
+    // get resources
+    ret = clone_spatial_filter(pLayerMethod, &pGeometryMethodFilter);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = create_field_map(poDefnInput, &mapInput);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, nullptr, mapInput,
+                            nullptr, false, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
+
+    if (bUseSpatialIndex)
+        oMethodIndex.Build();
+    ret = process_features(
+        this, pLayerResult, processFeature,
+        oMethodIndex.IsBuilt() ? get_num_threads(papszOptions) : 1,
+        bSkipFailures, pfnProgress, pProgressArg, progress_counter,
+        progress_max);
+    if (ret != OGRERR_NONE)
+        goto done;
     if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -5200,6 +5626,15 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>USE_SPATIAL_INDEX=YES/NO. Set to NO to not load the features of the
+ *     method layer into an in-memory spatial index, but set a spatial filter
+ *     on it for each processed feature instead. This uses less memory, but is
+ *     much slower on large layers. (Since GDAL 3.10)
+ * <li>NUM_THREADS=number or ALL_CPUS. Number of threads used to process the
+ *     features when the spatial index is used. Defaults to the value of
+ *     the GDAL_NUM_THREADS configuration option, or 1. The result features
+ *     are inserted in the same order whatever the number of threads.
+ *     (Since GDAL 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -42,6 +42,7 @@
 #include "cpl_time.h"
 #include <cassert>
 #include <cinttypes>
+#include <functional>
 #include <limits>
 #include <utility>
 #include <set>
@@ -4658,6 +4659,577 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                      ArrowAttrQueryContext                           */
+/************************************************************************/
+
+namespace
+{
+//! Context of EvaluateAttrQueryOnArrowArray()
+struct ArrowAttrQueryContext
+{
+    const OGRFeatureDefn *poFeatureDefn = nullptr;
+    const struct ArrowSchema *schema = nullptr;
+    const struct ArrowArray *array = nullptr;
+    const std::map<std::string, std::vector<int>> *poMapFieldNameToArrowPath =
+        nullptr;
+    GIntBig nBaseSeqFID = -1;
+    int iArrowFIDField = -1;
+    bool bUTF8Strings = false;
+    size_t nLength = 0;
+};
+
+//! Arrow column, or sequential FID, referenced by a column node
+struct ArrowAttrQueryColumn
+{
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    GIntBig nBaseSeqFID = -1;
+};
+}  // namespace
+
+/************************************************************************/
+/*                      GetArrowAttrQueryColumn()                       */
+/************************************************************************/
+
+static bool GetArrowAttrQueryColumn(const ArrowAttrQueryContext &ctxt,
+                                    const swq_expr_node *poNode,
+                                    ArrowAttrQueryColumn &col)
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index != 0)
+        return false;
+
+    const int nFieldCount = ctxt.poFeatureDefn->GetFieldCount();
+    int iArrowField = -1;
+    if (poNode->field_index == nFieldCount + SPF_FID)
+    {
+        if (ctxt.nBaseSeqFID >= 0)
+        {
+            col.nBaseSeqFID = ctxt.nBaseSeqFID;
+            return true;
+        }
+        iArrowField = ctxt.iArrowFIDField;
+    }
+    else if (poNode->field_index >= 0 && poNode->field_index < nFieldCount)
+    {
+        const auto oIter = ctxt.poMapFieldNameToArrowPath->find(
+            ctxt.poFeatureDefn->GetFieldDefn(poNode->field_index)
+                ->GetNameRef());
+        // Fields nested in structures are left to the row-based evaluation
+        if (oIter != ctxt.poMapFieldNameToArrowPath->end() &&
+            oIter->second.size() == 1)
+        {
+            iArrowField = oIter->second[0];
+        }
+    }
+    if (iArrowField < 0)
+        return false;
+
+    col.psSchema = ctxt.schema->children[iArrowField];
+    col.psArray = ctxt.array->children[iArrowField];
+    return col.psSchema->dictionary == nullptr;
+}
+
+/************************************************************************/
+/*                        CompareArrowValues()                          */
+/************************************************************************/
+
+template <class T, class V, class Op>
+static void CompareArrowValues(const T *panValues, size_t nLength, V v, Op op,
+                               uint8_t *pabyRes)
+{
+    for (size_t i = 0; i < nLength; ++i)
+        pabyRes[i] = op(static_cast<V>(panValues[i]), v);
+}
+
+template <class T, class V>
+static void CompareArrowValues(const T *panValues, size_t nLength,
+                               int nOperation, V v, uint8_t *pabyRes)
+{
+    switch (nOperation)
+    {
+        case SWQ_EQ:
+            CompareArrowValues(panValues, nLength, v, std::equal_to<V>(),
+                               pabyRes);
+            break;
+        case SWQ_NE:
+            CompareArrowValues(panValues, nLength, v, std::not_equal_to<V>(),
+                               pabyRes);
+            break;
+        case SWQ_LT:
+            CompareArrowValues(panValues, nLength, v, std::less<V>(), pabyRes);
+            break;
+        case SWQ_LE:
+            CompareArrowValues(panValues, nLength, v, std::less_equal<V>(),
+                               pabyRes);
+            break;
+        case SWQ_GT:
+            CompareArrowValues(panValues, nLength, v, std::greater<V>(),
+                               pabyRes);
+            break;
+        case SWQ_GE:
+            CompareArrowValues(panValues, nLength, v, std::greater_equal<V>(),
+                               pabyRes);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                  EvaluateArrowNumericComparison()                    */
+/************************************************************************/
+
+/** Evaluate "column nOperation v" for all rows, without taking into account
+ * the validity of the column.
+ */
+template <class V>
+static bool EvaluateArrowNumericComparison(const ArrowAttrQueryColumn &col,
+                                           size_t nLength, int nOperation,
+                                           V v, uint8_t *pabyRes)
+{
+    if (col.psArray == nullptr)
+    {
+        std::vector<int64_t> anFIDs(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            anFIDs[i] = col.nBaseSeqFID + static_cast<int64_t>(i);
+        CompareArrowValues(anFIDs.data(), nLength, nOperation, v, pabyRes);
+        return true;
+    }
+
+    const char *format = col.psSchema->format;
+    const size_t nOffset = static_cast<size_t>(col.psArray->offset);
+    const void *pValues = col.psArray->buffers[1];
+    if (IsBoolean(format))
+    {
+        std::vector<uint8_t> abyValues(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            abyValues[i] =
+                TestBit(static_cast<const uint8_t *>(pValues), i + nOffset);
+        CompareArrowValues(abyValues.data(), nLength, nOperation, v, pabyRes);
+    }
+    else if (IsInt8(format))
+        CompareArrowValues(static_cast<const int8_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsUInt8(format))
+        CompareArrowValues(static_cast<const uint8_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsInt16(format))
+        CompareArrowValues(static_cast<const int16_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsUInt16(format))
+        CompareArrowValues(static_cast<const uint16_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsInt32(format))
+        CompareArrowValues(static_cast<const int32_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsUInt32(format))
+        CompareArrowValues(static_cast<const uint32_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsInt64(format))
+        CompareArrowValues(static_cast<const int64_t *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsFloat32(format))
+        CompareArrowValues(static_cast<const float *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else if (IsFloat64(format))
+        CompareArrowValues(static_cast<const double *>(pValues) + nOffset,
+                           nLength, nOperation, v, pabyRes);
+    else
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*                  CompareArrowStringCaseInsensitive()                 */
+/************************************************************************/
+
+/** Equivalent of strcasecmp() on a (not nul-terminated) Arrow string, which
+ * is considered to stop at its first nul character, if any.
+ */
+static int CompareArrowStringCaseInsensitive(const char *pachStr, size_t nLen,
+                                             const char *pszConstant)
+{
+    for (size_t i = 0;; ++i)
+    {
+        const int ch1 = i < nLen ? CPLTolower(static_cast<unsigned char>(
+                                       pachStr[i]))
+                                 : 0;
+        const int ch2 = CPLTolower(static_cast<unsigned char>(pszConstant[i]));
+        if (ch1 != ch2)
+            return ch1 - ch2;
+        if (ch1 == 0)
+            return 0;
+    }
+}
+
+/************************************************************************/
+/*                  EvaluateArrowStringPredicate()                      */
+/************************************************************************/
+
+/** Evaluate a comparison, IN, BETWEEN, LIKE or ILIKE predicate of a string
+ * column against string constants, for all rows, without taking into
+ * account the validity of the column.
+ */
+template <class OffsetType>
+static void EvaluateArrowStringPredicate(const ArrowAttrQueryContext &ctxt,
+                                         const ArrowAttrQueryColumn &col,
+                                         const swq_expr_node *poNode,
+                                         uint8_t *pabyRes)
+{
+    const size_t nOffset = static_cast<size_t>(col.psArray->offset);
+    const OffsetType *panOffsets =
+        static_cast<const OffsetType *>(col.psArray->buffers[1]) + nOffset;
+    const char *pachData = static_cast<const char *>(col.psArray->buffers[2]);
+    const int nOperation = poNode->nOperation;
+    const bool bLikeInsensitive =
+        nOperation == SWQ_ILIKE ||
+        (nOperation == SWQ_LIKE &&
+         CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE")));
+    const char chEscape = (nOperation == SWQ_LIKE || nOperation == SWQ_ILIKE) &&
+                                  poNode->nSubExprCount == 3
+                              ? poNode->papoSubExpr[2]->string_value[0]
+                              : '\0';
+    std::string osTmp;
+    for (size_t i = 0; i < ctxt.nLength; ++i)
+    {
+        const char *pachStr = pachData + static_cast<size_t>(panOffsets[i]);
+        const size_t nLen =
+            static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
+        switch (nOperation)
+        {
+            case SWQ_EQ:
+            case SWQ_NE:
+            case SWQ_LT:
+            case SWQ_LE:
+            case SWQ_GT:
+            case SWQ_GE:
+            {
+                const int nCmp = CompareArrowStringCaseInsensitive(
+                    pachStr, nLen, poNode->papoSubExpr[1]->string_value);
+                pabyRes[i] = nOperation == SWQ_EQ   ? nCmp == 0
+                             : nOperation == SWQ_NE ? nCmp != 0
+                             : nOperation == SWQ_LT ? nCmp < 0
+                             : nOperation == SWQ_LE ? nCmp <= 0
+                             : nOperation == SWQ_GT ? nCmp > 0
+                                                    : nCmp >= 0;
+                break;
+            }
+
+            case SWQ_IN:
+            {
+                pabyRes[i] = false;
+                for (int j = 1; j < poNode->nSubExprCount; ++j)
+                {
+                    if (CompareArrowStringCaseInsensitive(
+                            pachStr, nLen,
+                            poNode->papoSubExpr[j]->string_value) == 0)
+                    {
+                        pabyRes[i] = true;
+                        break;
+                    }
+                }
+                break;
+            }
+
+            case SWQ_BETWEEN:
+            {
+                pabyRes[i] =
+                    CompareArrowStringCaseInsensitive(
+                        pachStr, nLen, poNode->papoSubExpr[1]->string_value) >=
+                        0 &&
+                    CompareArrowStringCaseInsensitive(
+                        pachStr, nLen, poNode->papoSubExpr[2]->string_value) <=
+                        0;
+                break;
+            }
+
+            default:
+            {
+                CPLAssert(nOperation == SWQ_LIKE || nOperation == SWQ_ILIKE);
+                osTmp.assign(pachStr, nLen);
+                pabyRes[i] = static_cast<uint8_t>(
+                    swq_test_like(osTmp.c_str(),
+                                  poNode->papoSubExpr[1]->string_value,
+                                  chEscape, bLikeInsensitive,
+                                  ctxt.bUTF8Strings) != 0);
+                break;
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                  EvaluateAttrQueryOnArrowArray()                     */
+/************************************************************************/
+
+/** Evaluate an attribute filter expression directly on the buffers of an
+ * Arrow array, and set pabyRes[i] to 1 for the rows that satisfy it,
+ * and 0 otherwise.
+ *
+ * Only handles comparison, IN, BETWEEN, LIKE, ILIKE and IS NULL predicates
+ * between a top-level numeric or string column and constants, combined with
+ * AND, OR and NOT. Returns false for other expressions, which must then be
+ * evaluated on OGRFeature objects.
+ *
+ * As in SWQGeneralEvaluator(), a predicate involving a null value is false.
+ */
+static bool EvaluateAttrQueryOnArrowArray(const ArrowAttrQueryContext &ctxt,
+                                          const swq_expr_node *poNode,
+                                          uint8_t *pabyRes)
+{
+    const size_t nLength = ctxt.nLength;
+    if (poNode->eNodeType != SNT_OPERATION || poNode->nSubExprCount < 1)
+        return false;
+
+    const int nOperation = poNode->nOperation;
+    if (nOperation == SWQ_AND || nOperation == SWQ_OR)
+    {
+        if (!EvaluateAttrQueryOnArrowArray(ctxt, poNode->papoSubExpr[0],
+                                           pabyRes))
+            return false;
+        std::vector<uint8_t> abyOther(nLength);
+        for (int j = 1; j < poNode->nSubExprCount; ++j)
+        {
+            if (!EvaluateAttrQueryOnArrowArray(ctxt, poNode->papoSubExpr[j],
+                                               abyOther.data()))
+                return false;
+            if (nOperation == SWQ_AND)
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                    pabyRes[i] &= abyOther[i];
+            }
+            else
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                    pabyRes[i] |= abyOther[i];
+            }
+        }
+        return true;
+    }
+
+    if (nOperation == SWQ_NOT)
+    {
+        if (!EvaluateAttrQueryOnArrowArray(ctxt, poNode->papoSubExpr[0],
+                                           pabyRes))
+            return false;
+        for (size_t i = 0; i < nLength; ++i)
+            pabyRes[i] ^= 1;
+        return true;
+    }
+
+    ArrowAttrQueryColumn col;
+    const swq_expr_node *poColumnNode = poNode->papoSubExpr[0];
+    int nColumnOperation = nOperation;
+    if (nOperation == SWQ_EQ || nOperation == SWQ_NE || nOperation == SWQ_LT ||
+        nOperation == SWQ_LE || nOperation == SWQ_GT || nOperation == SWQ_GE)
+    {
+        if (poNode->nSubExprCount != 2)
+            return false;
+        // Normalize "constant op column" as "column op' constant"
+        if (poColumnNode->eNodeType == SNT_CONSTANT)
+        {
+            poColumnNode = poNode->papoSubExpr[1];
+            nColumnOperation = nOperation == SWQ_LT   ? SWQ_GT
+                               : nOperation == SWQ_LE ? SWQ_GE
+                               : nOperation == SWQ_GT ? SWQ_LT
+                               : nOperation == SWQ_GE ? SWQ_LE
+                                                      : nOperation;
+        }
+    }
+    else if (nOperation == SWQ_IN)
+    {
+        if (poNode->nSubExprCount < 2)
+            return false;
+    }
+    else if (nOperation == SWQ_BETWEEN)
+    {
+        if (poNode->nSubExprCount != 3)
+            return false;
+    }
+    else if (nOperation == SWQ_LIKE || nOperation == SWQ_ILIKE)
+    {
+        if (poNode->nSubExprCount != 2 && poNode->nSubExprCount != 3)
+            return false;
+    }
+    else if (nOperation != SWQ_ISNULL)
+    {
+        return false;
+    }
+    if (!GetArrowAttrQueryColumn(ctxt, poColumnNode, col))
+        return false;
+
+    const uint8_t *pabyValidity =
+        col.psArray && col.psArray->null_count != 0
+            ? static_cast<const uint8_t *>(col.psArray->buffers[0])
+            : nullptr;
+    const size_t nOffset =
+        col.psArray ? static_cast<size_t>(col.psArray->offset) : 0;
+
+    if (nOperation == SWQ_ISNULL)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+            pabyRes[i] = pabyValidity && !TestBit(pabyValidity, i + nOffset);
+        return true;
+    }
+
+    // Check that the other operands are non-null constants of a type
+    // compatible with the column.
+    const swq_field_type eColType = poColumnNode->field_type;
+    const bool bStringColumn =
+        eColType == SWQ_STRING && col.psArray &&
+        (IsString(col.psSchema->format) ||
+         IsLargeString(col.psSchema->format));
+    bool bUseFloat = eColType == SWQ_FLOAT;
+    if (!bStringColumn && eColType != SWQ_INTEGER &&
+        eColType != SWQ_INTEGER64 && eColType != SWQ_BOOLEAN && !bUseFloat)
+    {
+        return false;
+    }
+    bool bIntegerAfterSecondOperand = false;
+    bool bFloatAfterSecondOperand = false;
+    for (int j = 0; j < poNode->nSubExprCount; ++j)
+    {
+        const swq_expr_node *poOther = poNode->papoSubExpr[j];
+        if (poOther == poColumnNode)
+            continue;
+        if (poOther->eNodeType != SNT_CONSTANT || poOther->is_null)
+            return false;
+        if (bStringColumn)
+        {
+            if (poOther->field_type != SWQ_STRING ||
+                poOther->string_value == nullptr)
+                return false;
+        }
+        else if (poOther->field_type == SWQ_FLOAT)
+        {
+            // Like SWQGeneralEvaluator(), only the type of the first two
+            // operands determines whether the comparison is done on floats
+            if (j <= 1)
+                bUseFloat = true;
+            else
+                bFloatAfterSecondOperand = true;
+        }
+        else if (poOther->field_type == SWQ_INTEGER ||
+                 poOther->field_type == SWQ_INTEGER64 ||
+                 poOther->field_type == SWQ_BOOLEAN)
+        {
+            if (j >= 2)
+                bIntegerAfterSecondOperand = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    // SWQGeneralEvaluator() does not convert the IN and BETWEEN operands
+    // after the second one: leave such mixes of types to it.
+    if ((bUseFloat && bIntegerAfterSecondOperand) ||
+        (!bUseFloat && bFloatAfterSecondOperand))
+    {
+        return false;
+    }
+
+    if (bStringColumn)
+    {
+        if (nOperation == SWQ_LIKE || nOperation == SWQ_ILIKE)
+        {
+            if (poNode->nSubExprCount == 3 &&
+                poNode->papoSubExpr[2]->string_value[0] == '\0')
+                return false;
+        }
+        else if (nOperation == SWQ_EQ)
+        {
+            // SWQGeneralEvaluator() has special rules to compare timestamps
+            // with and without an explicit +00 time zone.
+            const char *pszConstant = poNode->papoSubExpr[1]->string_value;
+            const size_t nConstantLen = strlen(pszConstant);
+            if (nConstantLen > 3 &&
+                (pszConstant[nConstantLen - 3] == ':' ||
+                 strcmp(pszConstant + nConstantLen - 3, "+00") == 0))
+            {
+                return false;
+            }
+        }
+        if (poColumnNode != poNode->papoSubExpr[0])
+            return false;
+        if (IsString(col.psSchema->format))
+            EvaluateArrowStringPredicate<uint32_t>(ctxt, col, poNode,
+                                                   pabyRes);
+        else
+            EvaluateArrowStringPredicate<uint64_t>(ctxt, col, poNode,
+                                                   pabyRes);
+    }
+    else if (nOperation == SWQ_LIKE || nOperation == SWQ_ILIKE)
+    {
+        return false;
+    }
+    else
+    {
+        const auto EvaluateOne = [&col, nLength, bUseFloat](
+                                     int nOp, const swq_expr_node *poConstant,
+                                     uint8_t *pabyOut)
+        {
+            if (bUseFloat)
+            {
+                const double dfVal =
+                    poConstant->field_type == SWQ_FLOAT
+                        ? poConstant->float_value
+                        : static_cast<double>(poConstant->int_value);
+                return EvaluateArrowNumericComparison(col, nLength, nOp,
+                                                      dfVal, pabyOut);
+            }
+            return EvaluateArrowNumericComparison(
+                col, nLength, nOp, static_cast<int64_t>(poConstant->int_value),
+                pabyOut);
+        };
+
+        if (nOperation == SWQ_IN || nOperation == SWQ_BETWEEN)
+        {
+            if (!EvaluateOne(nOperation == SWQ_IN ? SWQ_EQ : SWQ_GE,
+                             poNode->papoSubExpr[1], pabyRes))
+                return false;
+            std::vector<uint8_t> abyOther(nLength);
+            for (int j = 2; j < poNode->nSubExprCount; ++j)
+            {
+                if (nOperation == SWQ_IN)
+                {
+                    EvaluateOne(SWQ_EQ, poNode->papoSubExpr[j],
+                                abyOther.data());
+                    for (size_t i = 0; i < nLength; ++i)
+                        pabyRes[i] |= abyOther[i];
+                }
+                else
+                {
+                    EvaluateOne(SWQ_LE, poNode->papoSubExpr[j],
+                                abyOther.data());
+                    for (size_t i = 0; i < nLength; ++i)
+                        pabyRes[i] &= abyOther[i];
+                }
+            }
+        }
+        else
+        {
+            const swq_expr_node *poConstant =
+                poColumnNode == poNode->papoSubExpr[0] ? poNode->papoSubExpr[1]
+                                                       : poNode->papoSubExpr[0];
+            if (!EvaluateOne(nColumnOperation, poConstant, pabyRes))
+                return false;
+        }
+    }
+
+    if (pabyValidity)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (!TestBit(pabyValidity, i + nOffset))
+                pabyRes[i] = 0;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4770,6 +5342,42 @@ static size_t FillValidityArrayFromAttrQuery(
         }
     }
 
+    // Try first to evaluate the filter directly on the Arrow buffers, which
+    // is much faster than on OGRFeature objects.
+    if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_COLUMNAR_ATTRIBUTE_FILTER",
+                                       "YES")) &&
+        (!bNeedsFID || nBaseSeqFID >= 0 || anArrowPathToFIDColumn.size() == 1))
+    {
+        ArrowAttrQueryContext ctxt;
+        ctxt.poFeatureDefn = poFeatureDefn;
+        ctxt.schema = schema;
+        ctxt.array = array;
+        ctxt.poMapFieldNameToArrowPath = &oMapFieldNameToArrowPath;
+        ctxt.nBaseSeqFID = nBaseSeqFID;
+        if (anArrowPathToFIDColumn.size() == 1)
+            ctxt.iArrowFIDField = anArrowPathToFIDColumn[0];
+        ctxt.bUTF8Strings =
+            const_cast<OGRLayer *>(poLayer)->TestCapability(OLCStringsAsUTF8);
+        ctxt.nLength = nLength;
+        std::vector<uint8_t> abyRes(nLength);
+        if (EvaluateAttrQueryOnArrowArray(
+                ctxt, static_cast<swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+                abyRes.data()))
+        {
+            for (size_t iRow = 0; iRow < nLength; ++iRow)
+            {
+                if (abyValidityFromFilters[iRow])
+                {
+                    if (abyRes[iRow])
+                        nCountIntersecting++;
+                    else
+                        abyValidityFromFilters[iRow] = false;
+                }
+            }
+            return nCountIntersecting;
+        }
+    }
+
     for (size_t iRow = 0; iRow < nLength; ++iRow)
     {
         if (!abyValidityFromFilters[iRow])
@@ -0,0 +1,508 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Spatial index stored in a sidecar file of a text vector file
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogrsidecarspatialindex.h"
+
+#include "cpl_error.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+//! @cond Doxygen_Suppress
+
+// File layout, all values being little-endian:
+// - header: magic (8 bytes), version (uint32), node size (uint32),
+//   number of items (uint64), size (uint64) and modification time (int64)
+//   of the data file.
+// - nodes of each level, root level first, leaf level (items) last. Each
+//   node is made of its extent (4 doubles), an uint64 which is the index of
+//   its first child node for non-leaf nodes and the byte offset of the
+//   record for leaf nodes, and the FID (int64, leaf nodes only).
+
+constexpr char SIDX_MAGIC[] = "GDALSIDX";
+constexpr int SIDX_MAGIC_SIZE = 8;
+constexpr uint32_t SIDX_VERSION = 1;
+constexpr uint32_t SIDX_NODE_SIZE = 16;
+constexpr int SIDX_HEADER_SIZE = SIDX_MAGIC_SIZE + 4 + 4 + 8 + 8 + 8;
+constexpr int SIDX_NODE_BYTES = 4 * 8 + 8 + 8;
+
+/************************************************************************/
+/*                          GetLevelBounds()                            */
+/************************************************************************/
+
+static std::vector<std::pair<uint64_t, uint64_t>>
+GetLevelBounds(uint64_t nItems, uint32_t nNodeSize)
+{
+    std::vector<uint64_t> anLevelNodeCount;
+    uint64_t n = nItems;
+    anLevelNodeCount.push_back(n);
+    do
+    {
+        n = (n + nNodeSize - 1) / nNodeSize;
+        anLevelNodeCount.push_back(n);
+    } while (n > 1);
+
+    std::vector<std::pair<uint64_t, uint64_t>> anLevelBounds;
+    uint64_t nStart = 0;
+    for (auto it = anLevelNodeCount.rbegin(); it != anLevelNodeCount.rend();
+         ++it)
+    {
+        anLevelBounds.emplace_back(nStart, nStart + *it);
+        nStart += *it;
+    }
+    return anLevelBounds;
+}
+
+/************************************************************************/
+/*                             Hilbert()                                */
+/************************************************************************/
+
+// Position of (x, y) along a Hilbert curve over a 65536x65536 grid.
+// Based on public domain code at
+// https://github.com/rawrunprotected/hilbert_curves
+static uint32_t Hilbert(uint32_t x, uint32_t y)
+{
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+/************************************************************************/
+/*                         Node serialization                           */
+/************************************************************************/
+
+static void WriteNode(GByte *pabyDst, const OGREnvelope &sEnvelope,
+                      uint64_t nOffset, int64_t nFID)
+{
+    double adfValues[4] = {sEnvelope.MinX, sEnvelope.MinY, sEnvelope.MaxX,
+                           sEnvelope.MaxY};
+    for (double &dfVal : adfValues)
+        CPL_LSBPTR64(&dfVal);
+    CPL_LSBPTR64(&nOffset);
+    CPL_LSBPTR64(&nFID);
+    memcpy(pabyDst, adfValues, sizeof(adfValues));
+    memcpy(pabyDst + 32, &nOffset, sizeof(nOffset));
+    memcpy(pabyDst + 40, &nFID, sizeof(nFID));
+}
+
+static void ReadNode(const GByte *pabySrc, OGREnvelope &sEnvelope,
+                     uint64_t &nOffset, int64_t &nFID)
+{
+    double adfValues[4];
+    memcpy(adfValues, pabySrc, sizeof(adfValues));
+    memcpy(&nOffset, pabySrc + 32, sizeof(nOffset));
+    memcpy(&nFID, pabySrc + 40, sizeof(nFID));
+    for (double &dfVal : adfValues)
+        CPL_LSBPTR64(&dfVal);
+    CPL_LSBPTR64(&nOffset);
+    CPL_LSBPTR64(&nFID);
+    sEnvelope.MinX = adfValues[0];
+    sEnvelope.MinY = adfValues[1];
+    sEnvelope.MaxX = adfValues[2];
+    sEnvelope.MaxY = adfValues[3];
+}
+
+/************************************************************************/
+/*                      ~OGRSidecarSpatialIndex()                       */
+/************************************************************************/
+
+OGRSidecarSpatialIndex::~OGRSidecarSpatialIndex()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+std::string
+OGRSidecarSpatialIndex::GetFilename(const std::string &osDataFilename)
+{
+    return osDataFilename + ".sidx";
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Write the sidecar index of osDataFilename from aoItems, which is
+ * consumed. */
+bool OGRSidecarSpatialIndex::Build(const std::string &osDataFilename,
+                                   std::vector<Item> &&aoItems)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osDataFilename.c_str(), &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s",
+                 osDataFilename.c_str());
+        return false;
+    }
+
+    // Sort items along a Hilbert curve over the extent of their centers
+    if (!aoItems.empty())
+    {
+        OGREnvelope sExtent;
+        for (const auto &oItem : aoItems)
+            sExtent.Merge(oItem.sEnvelope);
+        const double dfWidth = sExtent.MaxX - sExtent.MinX;
+        const double dfHeight = sExtent.MaxY - sExtent.MinY;
+        constexpr double HILBERT_MAX = 65535;
+        std::vector<std::pair<uint32_t, size_t>> anKeys;
+        anKeys.reserve(aoItems.size());
+        for (size_t i = 0; i < aoItems.size(); ++i)
+        {
+            const auto &sEnv = aoItems[i].sEnvelope;
+            const uint32_t nX =
+                dfWidth > 0 ? static_cast<uint32_t>(
+                                  HILBERT_MAX *
+                                  ((sEnv.MinX + sEnv.MaxX) / 2 - sExtent.MinX) /
+                                  dfWidth)
+                            : 0;
+            const uint32_t nY =
+                dfHeight > 0
+                    ? static_cast<uint32_t>(
+                          HILBERT_MAX *
+                          ((sEnv.MinY + sEnv.MaxY) / 2 - sExtent.MinY) /
+                          dfHeight)
+                    : 0;
+            anKeys.emplace_back(Hilbert(nX, nY), i);
+        }
+        std::sort(anKeys.begin(), anKeys.end());
+        std::vector<Item> aoSorted;
+        aoSorted.reserve(aoItems.size());
+        for (const auto &oKey : anKeys)
+            aoSorted.push_back(aoItems[oKey.second]);
+        aoItems = std::move(aoSorted);
+    }
+
+    const uint64_t nItems = aoItems.size();
+    const auto anLevelBounds = GetLevelBounds(nItems, SIDX_NODE_SIZE);
+    const uint64_t nNodes = anLevelBounds.back().second;
+    if (nNodes > std::numeric_limits<size_t>::max() / SIDX_NODE_BYTES)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Too many features");
+        return false;
+    }
+
+    // Compute the extent of non-leaf nodes, bottom-up
+    std::vector<OGREnvelope> asNodeEnvelopes(static_cast<size_t>(nNodes));
+    const uint64_t nLeafStart = anLevelBounds.back().first;
+    for (uint64_t i = 0; i < nItems; ++i)
+        asNodeEnvelopes[static_cast<size_t>(nLeafStart + i)] =
+            aoItems[static_cast<size_t>(i)].sEnvelope;
+    for (size_t iLevel = anLevelBounds.size() - 1; iLevel > 0; --iLevel)
+    {
+        const auto &oChildBounds = anLevelBounds[iLevel];
+        const auto &oParentBounds = anLevelBounds[iLevel - 1];
+        for (uint64_t iParent = oParentBounds.first;
+             iParent < oParentBounds.second; ++iParent)
+        {
+            const uint64_t nFirstChild =
+                oChildBounds.first +
+                (iParent - oParentBounds.first) * SIDX_NODE_SIZE;
+            const uint64_t nLastChild =
+                std::min(nFirstChild + SIDX_NODE_SIZE, oChildBounds.second);
+            for (uint64_t iChild = nFirstChild; iChild < nLastChild; ++iChild)
+            {
+                asNodeEnvelopes[static_cast<size_t>(iParent)].Merge(
+                    asNodeEnvelopes[static_cast<size_t>(iChild)]);
+            }
+        }
+    }
+
+    const std::string osFilename = GetFilename(osDataFilename);
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if (!fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    GByte abyHeader[SIDX_HEADER_SIZE];
+    memcpy(abyHeader, SIDX_MAGIC, SIDX_MAGIC_SIZE);
+    uint32_t nVersion = SIDX_VERSION;
+    uint32_t nNodeSize = SIDX_NODE_SIZE;
+    uint64_t nItemsLSB = nItems;
+    uint64_t nDataSize = static_cast<uint64_t>(sStat.st_size);
+    int64_t nDataMTime = static_cast<int64_t>(sStat.st_mtime);
+    CPL_LSBPTR32(&nVersion);
+    CPL_LSBPTR32(&nNodeSize);
+    CPL_LSBPTR64(&nItemsLSB);
+    CPL_LSBPTR64(&nDataSize);
+    CPL_LSBPTR64(&nDataMTime);
+    memcpy(abyHeader + 8, &nVersion, 4);
+    memcpy(abyHeader + 12, &nNodeSize, 4);
+    memcpy(abyHeader + 16, &nItemsLSB, 8);
+    memcpy(abyHeader + 24, &nDataSize, 8);
+    memcpy(abyHeader + 32, &nDataMTime, 8);
+    bool bOK = VSIFWriteL(abyHeader, sizeof(abyHeader), 1, fp) == 1;
+
+    // Write nodes by batches
+    constexpr size_t NODES_PER_BATCH = 4096;
+    std::vector<GByte> abyBatch(NODES_PER_BATCH * SIDX_NODE_BYTES);
+    size_t nInBatch = 0;
+    size_t iLevel = 0;
+    for (uint64_t iNode = 0; bOK && iNode < nNodes; ++iNode)
+    {
+        while (iNode >= anLevelBounds[iLevel].second)
+            ++iLevel;
+        const bool bLeaf = iLevel + 1 == anLevelBounds.size();
+        uint64_t nOffset;
+        int64_t nFID = 0;
+        if (bLeaf)
+        {
+            const auto &oItem =
+                aoItems[static_cast<size_t>(iNode - nLeafStart)];
+            nOffset = oItem.nOffset;
+            nFID = oItem.nFID;
+        }
+        else
+        {
+            nOffset = anLevelBounds[iLevel + 1].first +
+                      (iNode - anLevelBounds[iLevel].first) * SIDX_NODE_SIZE;
+        }
+        WriteNode(abyBatch.data() + nInBatch * SIDX_NODE_BYTES,
+                  asNodeEnvelopes[static_cast<size_t>(iNode)], nOffset, nFID);
+        if (++nInBatch == NODES_PER_BATCH || iNode + 1 == nNodes)
+        {
+            bOK = VSIFWriteL(abyBatch.data(), SIDX_NODE_BYTES, nInBatch, fp) ==
+                  nInBatch;
+            nInBatch = 0;
+        }
+    }
+
+    if (VSIFCloseL(fp) != 0)
+        bOK = false;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while writing %s",
+                 osFilename.c_str());
+        VSIUnlink(osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+/** Open the sidecar index of osDataFilename. Returns nullptr if there is none,
+ * or if it is out of date with respect to the data file. */
+std::unique_ptr<OGRSidecarSpatialIndex>
+OGRSidecarSpatialIndex::Open(const std::string &osDataFilename)
+{
+    const std::string osFilename = GetFilename(osDataFilename);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+        VSIStatL(osDataFilename.c_str(), &sStat) != 0)
+    {
+        return nullptr;
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!fp)
+        return nullptr;
+    std::unique_ptr<OGRSidecarSpatialIndex> poIndex(
+        new OGRSidecarSpatialIndex());
+    poIndex->m_fp = fp;
+
+    GByte abyHeader[SIDX_HEADER_SIZE];
+    if (VSIFReadL(abyHeader, sizeof(abyHeader), 1, fp) != 1 ||
+        memcmp(abyHeader, SIDX_MAGIC, SIDX_MAGIC_SIZE) != 0)
+    {
+        CPLDebug("OGR", "%s is not a valid spatial index", osFilename.c_str());
+        return nullptr;
+    }
+    uint32_t nVersion;
+    uint32_t nNodeSize;
+    uint64_t nItems;
+    uint64_t nDataSize;
+    int64_t nDataMTime;
+    memcpy(&nVersion, abyHeader + 8, 4);
+    memcpy(&nNodeSize, abyHeader + 12, 4);
+    memcpy(&nItems, abyHeader + 16, 8);
+    memcpy(&nDataSize, abyHeader + 24, 8);
+    memcpy(&nDataMTime, abyHeader + 32, 8);
+    CPL_LSBPTR32(&nVersion);
+    CPL_LSBPTR32(&nNodeSize);
+    CPL_LSBPTR64(&nItems);
+    CPL_LSBPTR64(&nDataSize);
+    CPL_LSBPTR64(&nDataMTime);
+    if (nVersion != SIDX_VERSION || nNodeSize < 2 || nNodeSize > 65536 ||
+        nItems > std::numeric_limits<uint64_t>::max() / SIDX_NODE_BYTES / 2)
+    {
+        CPLDebug("OGR", "%s is not a supported spatial index",
+                 osFilename.c_str());
+        return nullptr;
+    }
+    if (nDataSize != static_cast<uint64_t>(sStat.st_size) ||
+        nDataMTime != static_cast<int64_t>(sStat.st_mtime))
+    {
+        CPLDebug("OGR", "%s is out of date. Ignoring it", osFilename.c_str());
+        return nullptr;
+    }
+
+    poIndex->m_nItems = nItems;
+    poIndex->m_nNodeSize = nNodeSize;
+    poIndex->m_anLevelBounds = GetLevelBounds(nItems, nNodeSize);
+    return poIndex;
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Collect the items whose extent intersects sEnvelope, sorted by
+ * increasing record offset. */
+bool OGRSidecarSpatialIndex::Search(const OGREnvelope &sEnvelope,
+                                    std::vector<Item> &aoResults)
+{
+    aoResults.clear();
+    if (m_nItems == 0)
+        return true;
+
+    struct Block
+    {
+        uint64_t nFirstNode;
+        uint64_t nNodeCount;
+        size_t iLevel;
+    };
+
+    std::vector<Block> asStack;
+    asStack.push_back({0, 1, 0});
+    std::vector<GByte> abyNodes;
+    const size_t nLeafLevel = m_anLevelBounds.size() - 1;
+    while (!asStack.empty())
+    {
+        const Block sBlock = asStack.back();
+        asStack.pop_back();
+
+        abyNodes.resize(static_cast<size_t>(sBlock.nNodeCount) *
+                        SIDX_NODE_BYTES);
+        if (VSIFSeekL(m_fp,
+                      SIDX_HEADER_SIZE + sBlock.nFirstNode * SIDX_NODE_BYTES,
+                      SEEK_SET) != 0 ||
+            VSIFReadL(abyNodes.data(), SIDX_NODE_BYTES,
+                      static_cast<size_t>(sBlock.nNodeCount),
+                      m_fp) != sBlock.nNodeCount)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read spatial index nodes");
+            return false;
+        }
+
+        const auto &oChildBounds =
+            sBlock.iLevel < nLeafLevel ? m_anLevelBounds[sBlock.iLevel + 1]
+                                       : m_anLevelBounds[nLeafLevel];
+        for (uint64_t i = 0; i < sBlock.nNodeCount; ++i)
+        {
+            Item oItem;
+            ReadNode(abyNodes.data() + static_cast<size_t>(i) * SIDX_NODE_BYTES,
+                     oItem.sEnvelope, oItem.nOffset, oItem.nFID);
+            if (!oItem.sEnvelope.Intersects(sEnvelope))
+                continue;
+            if (sBlock.iLevel == nLeafLevel)
+            {
+                aoResults.push_back(oItem);
+            }
+            else
+            {
+                if (oItem.nOffset < oChildBounds.first ||
+                    oItem.nOffset >= oChildBounds.second)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Corrupted spatial index");
+                    return false;
+                }
+                asStack.push_back(
+                    {oItem.nOffset,
+                     std::min<uint64_t>(m_nNodeSize,
+                                        oChildBounds.second - oItem.nOffset),
+                     sBlock.iLevel + 1});
+            }
+        }
+    }
+
+    std::sort(aoResults.begin(), aoResults.end(),
+              [](const Item &a, const Item &b)
+              { return a.nOffset < b.nOffset; });
+    return true;
+}
+
+//! @endcond
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Spatial index stored in a sidecar file of a text vector file
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef OGRSIDECARSPATIALINDEX_H_DEFINED
+#define OGRSIDECARSPATIALINDEX_H_DEFINED
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+#include "ogr_core.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** Packed Hilbert R-tree stored in a "<datafile>.sidx" sidecar file.
+ *
+ * It maps the bounding box of each feature of a sequentially read vector
+ * file (CSV, GeoJSONSeq) to the byte offset of its record and its FID, so
+ * that a spatial filter can be evaluated by only reading candidate records.
+ * The sidecar records the size and modification time of the data file, and
+ * is ignored once they no longer match.
+ */
+class CPL_DLL OGRSidecarSpatialIndex
+{
+  public:
+    struct Item
+    {
+        OGREnvelope sEnvelope{};
+        uint64_t nOffset = 0;  // Byte offset of the record in the data file
+        int64_t nFID = 0;
+    };
+
+    ~OGRSidecarSpatialIndex();
+
+    static std::string GetFilename(const std::string &osDataFilename);
+
+    static bool Build(const std::string &osDataFilename,
+                      std::vector<Item> &&aoItems);
+
+    static std::unique_ptr<OGRSidecarSpatialIndex>
+    Open(const std::string &osDataFilename);
+
+    uint64_t GetItemCount() const
+    {
+        return m_nItems;
+    }
+
+    bool Search(const OGREnvelope &sEnvelope, std::vector<Item> &aoResults);
+
+  private:
+    VSILFILE *m_fp = nullptr;
+    uint64_t m_nItems = 0;
+    uint32_t m_nNodeSize = 0;
+    // [start, end) node indices of each level, root level first
+    std::vector<std::pair<uint64_t, uint64_t>> m_anLevelBounds{};
+
+    OGRSidecarSpatialIndex() = default;
+    OGRSidecarSpatialIndex(const OGRSidecarSpatialIndex &) = delete;
+    OGRSidecarSpatialIndex &operator=(const OGRSidecarSpatialIndex &) = delete;
+};
+
+//! @endcond
+
+#endif  // OGRSIDECARSPATIALINDEX_H_DEFINED
@@ -32,7 +32,11 @@
 #include "ogr_geojson.h"
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <set>
 #include <functional>
@@ -52,11 +56,17 @@ class OGRGeoJSONReaderStreamingParser final
     bool m_bOriginalIdModifiedEmitted = false;
     std::set<GIntBig> m_oSetUsedFIDs{};
 
+    // Features whose conversion to OGRFeature is deferred, to be done
+    // by worker threads.
+    int m_nNumThreads = 1;
+    std::vector<std::pair<json_object *, std::string>> m_aoPendingObjects{};
+
     std::map<std::string, int> m_oMapFieldNameToIdx{};
     std::vector<std::unique_ptr<OGRFieldDefn>> m_apoFieldDefn{};
     gdal::DirectedAcyclicGraph<int, std::string> m_dag{};
 
     void AnalyzeFeature();
+    void AddFeature(OGRFeature *poFeat);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONReaderStreamingParser)
 
@@ -75,6 +85,27 @@ class OGRGeoJSONReaderStreamingParser final
 
     OGRFeature *GetNextFeature();
 
+    /** Whether more features should be parsed before calling
+     * ConvertPendingFeatures() */
+    bool NeedsMorePendingFeatures() const
+    {
+        // Enough features for each thread to get a job of a reasonable size
+        constexpr size_t FEATURES_PER_THREAD = 256;
+        return m_nNumThreads > 1 &&
+               m_aoPendingObjects.size() <
+                   FEATURES_PER_THREAD * static_cast<size_t>(m_nNumThreads);
+    }
+
+    void ConvertPendingFeatures();
+
+    /** Sets the number of threads used to convert features. Features are
+     * then only returned by GetNextFeature() after ConvertPendingFeatures()
+     */
+    void SetNumThreads(int nNumThreads)
+    {
+        m_nNumThreads = nNumThreads;
+    }
+
     inline bool GetOriginalIdModifiedEmitted() const
     {
         return m_bOriginalIdModifiedEmitted;
@@ -260,6 +291,8 @@ OGRGeoJSONReaderStreamingParser::~OGRGeoJSONReaderStreamingParser()
 {
     for (size_t i = 0; i < m_apoFeatures.size(); i++)
         delete m_apoFeatures[i];
+    for (auto &oPending : m_aoPendingObjects)
+        json_object_put(oPending.first);
 }
 
 /************************************************************************/
@@ -296,44 +329,148 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
         }
         m_poLayer->IncFeatureCount();
     }
+    else if (m_nNumThreads > 1)
+    {
+        m_aoPendingObjects.emplace_back(json_object_get(poObj), osJson);
+    }
     else
     {
         OGRFeature *poFeat =
             m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str());
         if (poFeat)
+            AddFeature(poFeat);
+    }
+}
+
+/************************************************************************/
+/*                            AddFeature()                              */
+/************************************************************************/
+
+// Assign a unique FID to the feature and append it to the features ready
+// to be returned.
+void OGRGeoJSONReaderStreamingParser::AddFeature(OGRFeature *poFeat)
+{
+    GIntBig nFID = poFeat->GetFID();
+    if (nFID == OGRNullFID)
+    {
+        nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
+        while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
         {
-            GIntBig nFID = poFeat->GetFID();
-            if (nFID == OGRNullFID)
-            {
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-                {
-                    ++nFID;
-                }
-            }
-            else if (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-            {
-                if (!m_bOriginalIdModifiedEmitted)
-                {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Several features with id = " CPL_FRMT_GIB " have "
-                             "been found. Altering it to be unique. "
-                             "This warning will not be emitted anymore for "
-                             "this layer",
-                             nFID);
-                    m_bOriginalIdModifiedEmitted = true;
-                }
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-                {
-                    ++nFID;
-                }
-            }
-            m_oSetUsedFIDs.insert(nFID);
-            poFeat->SetFID(nFID);
+            ++nFID;
+        }
+    }
+    else if (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
+    {
+        if (!m_bOriginalIdModifiedEmitted)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Several features with id = " CPL_FRMT_GIB " have "
+                     "been found. Altering it to be unique. "
+                     "This warning will not be emitted anymore for "
+                     "this layer",
+                     nFID);
+            m_bOriginalIdModifiedEmitted = true;
+        }
+        nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
+        while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
+        {
+            ++nFID;
+        }
+    }
+    m_oSetUsedFIDs.insert(nFID);
+    poFeat->SetFID(nFID);
 
-            m_apoFeatures.push_back(poFeat);
+    m_apoFeatures.push_back(poFeat);
+}
+
+/************************************************************************/
+/*                       ConvertPendingFeatures()                       */
+/************************************************************************/
+
+namespace
+{
+struct OGRGeoJSONConversionJob
+{
+    OGRGeoJSONReader *poReader = nullptr;
+    OGRGeoJSONLayer *poLayer = nullptr;
+    std::pair<json_object *, std::string> *paoObjects = nullptr;
+    OGRFeature **papoFeatures = nullptr;
+    size_t nCount = 0;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+static void ConvertGeoJSONFeatures(void *pData)
+{
+    auto psJob = static_cast<OGRGeoJSONConversionJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    for (size_t i = 0; i < psJob->nCount; ++i)
+    {
+        auto &oPending = psJob->paoObjects[i];
+        psJob->papoFeatures[i] = psJob->poReader->ReadFeature(
+            psJob->poLayer, oPending.first, oPending.second.c_str());
+        json_object_put(oPending.first);
+        oPending.first = nullptr;
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+// Convert the pending GeoJSON objects to OGRFeature on worker threads, and
+// append them, in order, to the features ready to be returned.
+void OGRGeoJSONReaderStreamingParser::ConvertPendingFeatures()
+{
+    if (m_aoPendingObjects.empty())
+        return;
+
+    const size_t nCount = m_aoPendingObjects.size();
+    std::vector<OGRFeature *> apoFeatures(nCount);
+    // Not worth using threads on a few features
+    constexpr size_t MIN_FEATURES_PER_JOB = 64;
+    const size_t nJobs =
+        std::max<size_t>(1, std::min(static_cast<size_t>(m_nNumThreads),
+                                     nCount / MIN_FEATURES_PER_JOB));
+    std::vector<OGRGeoJSONConversionJob> asJobs(nJobs);
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        const size_t nStart = nCount * i / nJobs;
+        const size_t nEnd = nCount * (i + 1) / nJobs;
+        asJobs[i].poReader = &m_oReader;
+        asJobs[i].poLayer = m_poLayer;
+        asJobs[i].paoObjects = m_aoPendingObjects.data() + nStart;
+        asJobs[i].papoFeatures = apoFeatures.data() + nStart;
+        asJobs[i].nCount = nEnd - nStart;
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue)
+    {
+        for (auto &sJob : asJobs)
+        {
+            if (!poQueue->SubmitJob(ConvertGeoJSONFeatures, &sJob))
+                ConvertGeoJSONFeatures(&sJob);
         }
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &sJob : asJobs)
+            ConvertGeoJSONFeatures(&sJob);
+    }
+    m_aoPendingObjects.clear();
+
+    // Re-emit errors from the calling thread, in the order of the features
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    for (OGRFeature *poFeat : apoFeatures)
+    {
+        if (poFeat)
+            AddFeature(poFeat);
     }
 }
 
@@ -685,6 +822,17 @@ OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
             *this, poLayer, false, bStoreNativeData_);
         poStreamingParser_->SetOriginalIdModifiedEmitted(
             bOriginalIdModifiedEmitted_);
+
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                        ? CPLGetNumCPUs()
+                                        : atoi(pszNumThreads);
+            poStreamingParser_->SetNumThreads(
+                std::max(1, std::min(nNumThreads, 128)));
+        }
         VSIFSeekL(fp_, 0, SEEK_SET);
         bFirstSeg_ = true;
         bJSonPLikeWrapper_ = false;
@@ -714,6 +862,12 @@ OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
             break;
         }
 
+        // In multi-threaded mode, accumulate enough features before
+        // converting them in parallel.
+        if (!bFinished && poStreamingParser_->NeedsMorePendingFeatures())
+            continue;
+        poStreamingParser_->ConvertPendingFeatures();
+
         poFeat = poStreamingParser_->GetNextFeature();
         if (poFeat)
             return poFeat;
@@ -2363,10 +2517,10 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
     }
     else
     {
-        static bool bWarned = false;
-        if (!bWarned)
+        // May be called concurrently from several threads
+        static std::atomic<bool> bWarned{false};
+        if (!bWarned.exchange(true))
         {
-            bWarned = true;
             CPLDebug(
                 "GeoJSON",
                 "Non conformant Feature object. Missing \'geometry\' member.");
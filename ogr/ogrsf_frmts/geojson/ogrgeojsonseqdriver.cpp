@@ -30,12 +30,16 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_vsi_error.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geojson.h"
 #include "ogrgeojsonreader.h"
 #include "ogrgeojsonwriter.h"
+#include "ogrsidecarspatialindex.h"
 
 #include <algorithm>
+#include <deque>
 #include <memory>
 
 constexpr char RS = '\x1e';
@@ -54,6 +58,8 @@ class OGRGeoJSONSeqDataSource final : public GDALDataset
     bool m_bSupportsRead = true;
     bool m_bAtEOF = false;
     bool m_bIsRSSeparated = false;
+    // Name of the data file, empty if it is not a regular file
+    std::string m_osDataFilename{};
 
   public:
     OGRGeoJSONSeqDataSource();
@@ -70,6 +76,11 @@ class OGRGeoJSONSeqDataSource final : public GDALDataset
                            CSLConstList papszOptions) override;
     int TestCapability(const char *pszCap) override;
 
+    OGRLayer *ExecuteSQL(const char *pszSQLCommand,
+                         OGRGeometry *poSpatialFilter,
+                         const char *pszDialect) override;
+    char **GetFileList() override;
+
     bool Open(GDALOpenInfo *poOpenInfo, GeoJSONSourceType nSrcType);
     bool Create(const char *pszName, char **papszOptions);
 };
@@ -93,6 +104,10 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     std::string m_osFeatureBuffer;
     size_t m_nPosInBuffer = 0;
     size_t m_nBufferValidSize = 0;
+    // Offset in the file of the start of m_osBuffer
+    vsi_l_offset m_nBufferFileOffset = 0;
+    // Offset in the file of the record in m_osFeatureBuffer
+    vsi_l_offset m_nRecordOffset = 0;
 
     vsi_l_offset m_nFileSize = 0;
     GIntBig m_nIter = 0;
@@ -100,11 +115,30 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     GIntBig m_nTotalFeatures = 0;
     GIntBig m_nNextFID = 0;
 
+    int m_nNumThreads = 1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoReadyFeatures{};
+
     std::unique_ptr<OGRCoordinateTransformation> m_poCT{};
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
+    bool GetNextRecord();
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRFeature *TranslateObject(json_object *poObject);
+    OGRFeature *GetNextUnfilteredFeature();
+    bool ReadFeaturesMultiThreaded();
+    static void TranslateRecordsJob(void *pData);
+
+    // Sidecar spatial index, used when a spatial filter is set
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSpatialIndex{};
+    bool m_bSpatialIndexProbed = false;
+    bool m_bUseSpatialIndex = false;
+    std::vector<OGRSidecarSpatialIndex::Item> m_aoSpatialIndexCandidates{};
+    size_t m_nSpatialIndexCandidateIdx = 0;
+
+    void SeekToRecord(vsi_l_offset nOffset);
+    OGRSidecarSpatialIndex *GetSpatialIndex();
+    OGRFeature *GetNextIndexedFeature();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -141,6 +175,9 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     {
         return m_poDS;
     }
+
+    OGRErr CreateSpatialIndex();
+    OGRErr DropSpatialIndex();
 };
 
 /************************************************************************/
@@ -306,6 +343,59 @@ int OGRGeoJSONSeqDataSource::TestCapability(const char *pszCap)
     return FALSE;
 }
 
+/************************************************************************/
+/*                             ExecuteSQL()                             */
+/************************************************************************/
+
+OGRLayer *OGRGeoJSONSeqDataSource::ExecuteSQL(const char *pszStatement,
+                                              OGRGeometry *poSpatialFilter,
+                                              const char *pszDialect)
+{
+    // Handle commands to create or drop a sidecar spatial index
+    const bool bCreate =
+        STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX ON ");
+    if (bCreate || STARTS_WITH_CI(pszStatement, "DROP SPATIAL INDEX ON "))
+    {
+        const char *pszLayerName = pszStatement + (bCreate ? 24 : 22);
+        auto poLayer =
+            cpl::down_cast<OGRGeoJSONSeqLayer *>(GetLayerByName(pszLayerName));
+        if (poLayer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Layer %s not recognised.",
+                     pszLayerName);
+        }
+        else if (bCreate)
+        {
+            poLayer->CreateSpatialIndex();
+        }
+        else
+        {
+            poLayer->DropSpatialIndex();
+        }
+        return nullptr;
+    }
+
+    return GDALDataset::ExecuteSQL(pszStatement, poSpatialFilter, pszDialect);
+}
+
+/************************************************************************/
+/*                            GetFileList()                             */
+/************************************************************************/
+
+char **OGRGeoJSONSeqDataSource::GetFileList()
+{
+    CPLStringList aosFiles(GDALDataset::GetFileList());
+    if (!m_osDataFilename.empty())
+    {
+        const std::string osIndexFilename =
+            OGRSidecarSpatialIndex::GetFilename(m_osDataFilename);
+        VSIStatBufL sStat;
+        if (VSIStatL(osIndexFilename.c_str(), &sStat) == 0)
+            aosFiles.AddString(osIndexFilename.c_str());
+    }
+    return aosFiles.StealList();
+}
+
 /************************************************************************/
 /*                           OGRGeoJSONSeqLayer()                       */
 /************************************************************************/
@@ -491,14 +581,45 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_osFeatureBuffer.clear();
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
+    m_nBufferFileOffset = 0;
     m_nNextFID = 0;
+
+    m_apoReadyFeatures.clear();
+    m_nNumThreads = 1;
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+    {
+        const int nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                    ? CPLGetNumCPUs()
+                                    : atoi(pszNumThreads);
+        m_nNumThreads = std::max(1, std::min(nNumThreads, 128));
+    }
+
+    // Restrict reading to the candidate records of the sidecar spatial
+    // index, if there is one.
+    m_bUseSpatialIndex = false;
+    m_aoSpatialIndexCandidates.clear();
+    m_nSpatialIndexCandidateIdx = 0;
+    if (m_poFilterGeom != nullptr && m_iGeomFieldFilter == 0)
+    {
+        auto poSpatialIndex = GetSpatialIndex();
+        if (poSpatialIndex &&
+            poSpatialIndex->Search(m_sFilterEnvelope,
+                                   m_aoSpatialIndexCandidates))
+        {
+            m_bUseSpatialIndex = true;
+        }
+    }
 }
 
 /************************************************************************/
-/*                           GetNextObject()                            */
+/*                           GetNextRecord()                            */
 /************************************************************************/
 
-json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+// Extract the next non-empty record (without its trailing separator and
+// end-of-line characters) into m_osFeatureBuffer.
+bool OGRGeoJSONSeqLayer::GetNextRecord()
 {
     m_osFeatureBuffer.clear();
     while (true)
@@ -508,8 +629,9 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         {
             if (m_nBufferValidSize < m_osBuffer.size())
             {
-                return nullptr;
+                return false;
             }
+            m_nBufferFileOffset = VSIFTellL(m_poDS->m_fp);
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
             m_nPosInBuffer = 0;
@@ -532,10 +654,13 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
             if (m_nPosInBuffer >= m_nBufferValidSize)
             {
-                return nullptr;
+                return false;
             }
         }
 
+        if (m_osFeatureBuffer.empty())
+            m_nRecordOffset = m_nBufferFileOffset + m_nPosInBuffer;
+
         // Find next feature separator in buffer
         const size_t nNextSepPos = m_osBuffer.find(
             m_poDS->m_bIsRSSeparated ? RS : '\n', m_nPosInBuffer);
@@ -560,7 +685,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
                          "for larger features, or 0 to remove any size limit.",
                          static_cast<unsigned>(m_osFeatureBuffer.size() / 1024 /
                                                1024));
-                return nullptr;
+                return false;
             }
             m_nPosInBuffer = m_nBufferValidSize;
             if (m_nBufferValidSize == m_osBuffer.size())
@@ -577,20 +702,353 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         }
         if (!m_osFeatureBuffer.empty())
         {
-            json_object *poObject = nullptr;
-            CPL_IGNORE_RET_VAL(
-                OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
-            m_osFeatureBuffer.clear();
-            if (json_object_get_type(poObject) == json_type_object)
-            {
-                return poObject;
-            }
-            json_object_put(poObject);
-            if (bLooseIdentification)
-            {
+            return true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           SeekToRecord()                             */
+/************************************************************************/
+
+// Position the record reader on the record starting at nOffset, reusing
+// the current buffer when possible.
+void OGRGeoJSONSeqLayer::SeekToRecord(vsi_l_offset nOffset)
+{
+    m_osFeatureBuffer.clear();
+    if (nOffset >= m_nBufferFileOffset &&
+        nOffset - m_nBufferFileOffset < m_nBufferValidSize)
+    {
+        m_nPosInBuffer = static_cast<size_t>(nOffset - m_nBufferFileOffset);
+        return;
+    }
+    VSIFSeekL(m_poDS->m_fp, nOffset, SEEK_SET);
+    // Force a reload of the buffer
+    m_nPosInBuffer = m_osBuffer.size();
+    m_nBufferValidSize = m_osBuffer.size();
+}
+
+/************************************************************************/
+/*                          GetSpatialIndex()                           */
+/************************************************************************/
+
+OGRSidecarSpatialIndex *OGRGeoJSONSeqLayer::GetSpatialIndex()
+{
+    if (!m_bSpatialIndexProbed && !m_bWriteOnlyLayer &&
+        !m_poDS->m_osDataFilename.empty())
+    {
+        m_bSpatialIndexProbed = true;
+        m_poSpatialIndex =
+            OGRSidecarSpatialIndex::Open(m_poDS->m_osDataFilename);
+    }
+    return m_poSpatialIndex.get();
+}
+
+/************************************************************************/
+/*                       GetNextIndexedFeature()                        */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetNextIndexedFeature()
+{
+    while (m_nSpatialIndexCandidateIdx < m_aoSpatialIndexCandidates.size())
+    {
+        const auto &oItem =
+            m_aoSpatialIndexCandidates[m_nSpatialIndexCandidateIdx++];
+        SeekToRecord(oItem.nOffset);
+        auto poObject = GetNextObject(false);
+        if (!poObject)
+            return nullptr;
+        OGRFeature *poFeature = TranslateObject(poObject);
+        json_object_put(poObject);
+        if (poFeature)
+        {
+            if (poFeature->GetFID() == OGRNullFID)
+                poFeature->SetFID(oItem.nFID);
+            return poFeature;
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        CreateSpatialIndex()                          */
+/************************************************************************/
+
+OGRErr OGRGeoJSONSeqLayer::CreateSpatialIndex()
+{
+    if (m_bWriteOnlyLayer || m_poDS->m_osDataFilename.empty())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Spatial index can only be created on a layer read from a "
+                 "file");
+        return OGRERR_FAILURE;
+    }
+
+    // Scan all records, regardless of the current filters, and number
+    // features as GetNextFeature() does.
+    GetLayerDefn();  // force scan if not already done
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexProbed = true;
+    ResetReading();
+    std::vector<OGRSidecarSpatialIndex::Item> aoItems;
+    while (auto poObject = GetNextObject(false))
+    {
+        const vsi_l_offset nOffset = m_nRecordOffset;
+        OGRFeature *poFeature = TranslateObject(poObject);
+        json_object_put(poObject);
+        if (!poFeature)
+            continue;
+        if (poFeature->GetFID() == OGRNullFID)
+        {
+            poFeature->SetFID(m_nNextFID);
+            m_nNextFID++;
+        }
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGRSidecarSpatialIndex::Item oItem;
+            poGeom->getEnvelope(&oItem.sEnvelope);
+            oItem.nOffset = nOffset;
+            oItem.nFID = poFeature->GetFID();
+            aoItems.push_back(oItem);
+        }
+        delete poFeature;
+    }
+
+    const bool bOK = OGRSidecarSpatialIndex::Build(m_poDS->m_osDataFilename,
+                                                   std::move(aoItems));
+    m_bSpatialIndexProbed = false;
+    ResetReading();
+    return bOK ? OGRERR_NONE : OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                         DropSpatialIndex()                           */
+/************************************************************************/
+
+OGRErr OGRGeoJSONSeqLayer::DropSpatialIndex()
+{
+    const std::string osIndexFilename =
+        m_poDS->m_osDataFilename.empty()
+            ? std::string()
+            : OGRSidecarSpatialIndex::GetFilename(m_poDS->m_osDataFilename);
+    VSIStatBufL sStat;
+    if (osIndexFilename.empty() ||
+        VSIStatL(osIndexFilename.c_str(), &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Layer %s has no spatial index",
+                 GetDescription());
+        return OGRERR_FAILURE;
+    }
+    m_poSpatialIndex.reset();
+    m_bSpatialIndexProbed = true;
+    ResetReading();
+    if (VSIUnlink(osIndexFilename.c_str()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot delete %s",
+                 osIndexFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetNextObject()                            */
+/************************************************************************/
+
+json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+{
+    while (GetNextRecord())
+    {
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
+        m_osFeatureBuffer.clear();
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            return poObject;
+        }
+        json_object_put(poObject);
+        if (bLooseIdentification)
+        {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          TranslateObject()                           */
+/************************************************************************/
+
+// Returns nullptr for objects that do not translate to a feature.
+// Safe to call from worker threads once the layer definition is established.
+OGRFeature *OGRGeoJSONSeqLayer::TranslateObject(json_object *poObject)
+{
+    const auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        return m_oReader.ReadFeature(this, poObject, "");
+    }
+    else if (type == GeoJSONObject::eFeatureCollection ||
+             type == GeoJSONObject::eUnknown)
+    {
+        return nullptr;
+    }
+
+    OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+    if (!poGeom)
+    {
+        return nullptr;
+    }
+    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    poFeature->SetGeometryDirectly(poGeom);
+    return poFeature;
+}
+
+/************************************************************************/
+/*                        TranslateRecordsJob()                         */
+/************************************************************************/
+
+namespace
+{
+struct OGRGeoJSONSeqTranslationJob
+{
+    OGRGeoJSONSeqLayer *poLayer = nullptr;
+    const std::string *paosRecords = nullptr;
+    OGRFeature **papoFeatures = nullptr;
+    size_t nCount = 0;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+void OGRGeoJSONSeqLayer::TranslateRecordsJob(void *pData)
+{
+    auto psJob = static_cast<OGRGeoJSONSeqTranslationJob *>(pData);
+    auto poLayer = psJob->poLayer;
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    for (size_t i = 0; i < psJob->nCount; ++i)
+    {
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(
+            OGRJSonParse(psJob->paosRecords[i].c_str(), &poObject));
+        if (json_object_get_type(poObject) == json_type_object)
+            psJob->papoFeatures[i] = poLayer->TranslateObject(poObject);
+        json_object_put(poObject);
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                     ReadFeaturesMultiThreaded()                      */
+/************************************************************************/
+
+// Records are extracted sequentially, so that the file is still read with
+// large contiguous requests (which matters for /vsicurl/), and the batch of
+// records is then split in contiguous ranges that are parsed and translated
+// on worker threads. Features are queued in file order.
+// Returns false once all records have been read.
+bool OGRGeoJSONSeqLayer::ReadFeaturesMultiThreaded()
+{
+    constexpr size_t RECORDS_PER_THREAD = 256;
+    constexpr size_t MAX_BATCH_BYTES = 64 * 1024 * 1024;
+    const size_t nMaxRecords =
+        static_cast<size_t>(m_nNumThreads) * RECORDS_PER_THREAD;
+
+    std::vector<std::string> aosRecords;
+    size_t nBatchBytes = 0;
+    while (aosRecords.size() < nMaxRecords && nBatchBytes < MAX_BATCH_BYTES &&
+           GetNextRecord())
+    {
+        nBatchBytes += m_osFeatureBuffer.size();
+        aosRecords.emplace_back(std::move(m_osFeatureBuffer));
+        m_osFeatureBuffer.clear();
+    }
+    if (aosRecords.empty())
+        return false;
+
+    const size_t nCount = aosRecords.size();
+    std::vector<OGRFeature *> apoFeatures(nCount);
+    // Not worth using threads on a few features
+    constexpr size_t MIN_FEATURES_PER_JOB = 64;
+    const size_t nJobs =
+        std::max<size_t>(1, std::min(static_cast<size_t>(m_nNumThreads),
+                                     nCount / MIN_FEATURES_PER_JOB));
+    std::vector<OGRGeoJSONSeqTranslationJob> asJobs(nJobs);
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        const size_t nStart = nCount * i / nJobs;
+        const size_t nEnd = nCount * (i + 1) / nJobs;
+        asJobs[i].poLayer = this;
+        asJobs[i].paosRecords = aosRecords.data() + nStart;
+        asJobs[i].papoFeatures = apoFeatures.data() + nStart;
+        asJobs[i].nCount = nEnd - nStart;
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue)
+    {
+        for (auto &sJob : asJobs)
+        {
+            if (!poQueue->SubmitJob(TranslateRecordsJob, &sJob))
+                TranslateRecordsJob(&sJob);
+        }
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &sJob : asJobs)
+            TranslateRecordsJob(&sJob);
+    }
+
+    // Re-emit errors from the calling thread, in the order of the records
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    for (OGRFeature *poFeature : apoFeatures)
+    {
+        if (poFeature)
+            m_apoReadyFeatures.emplace_back(poFeature);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GetNextUnfilteredFeature()                      */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetNextUnfilteredFeature()
+{
+    if (m_bUseSpatialIndex)
+        return GetNextIndexedFeature();
+
+    if (m_nNumThreads > 1)
+    {
+        // A batch may only contain records that are not features, hence
+        // the loop.
+        while (m_apoReadyFeatures.empty())
+        {
+            if (!ReadFeaturesMultiThreaded())
                 return nullptr;
-            }
         }
+        OGRFeature *poFeature = m_apoReadyFeatures.front().release();
+        m_apoReadyFeatures.pop_front();
+        return poFeature;
+    }
+
+    while (true)
+    {
+        auto poObject = GetNextObject(false);
+        if (!poObject)
+            return nullptr;
+        OGRFeature *poFeature = TranslateObject(poObject);
+        json_object_put(poObject);
+        if (poFeature)
+            return poFeature;
     }
 }
 
@@ -614,35 +1072,9 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
+        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        if (!poFeature)
             return nullptr;
-        OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
-        {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
-        {
-            json_object_put(poObject);
-            continue;
-        }
-        else
-        {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
-            json_object_put(poObject);
-            if (!poGeom)
-            {
-                continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
-        }
 
         if (poFeature->GetFID() == OGRNullFID)
         {
@@ -681,6 +1113,8 @@ int OGRGeoJSONSeqLayer::TestCapability(const char *pszCap)
 {
     if (EQUAL(pszCap, OLCStringsAsUTF8))
         return true;
+    if (EQUAL(pszCap, OLCFastSpatialFilter))
+        return GetSpatialIndex() != nullptr;
     if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
         EQUAL(pszCap, OLCFastFeatureCount))
     {
@@ -799,6 +1233,7 @@ bool OGRGeoJSONSeqDataSource::Open(GDALOpenInfo *poOpenInfo,
 
     if (nSrcType == eGeoJSONSourceFile)
     {
+        m_osDataFilename = pszUnprefixedFilename;
         if (pszUnprefixedFilename != poOpenInfo->pszFilename)
         {
             osLayerName = CPLGetBasename(pszUnprefixedFilename);
@@ -30,12 +30,14 @@
 #include "cpl_port.h"
 #include "gmlreader.h"
 
+#include <algorithm>
 #include <cstdio>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                             GMLFeature()                             */
@@ -297,3 +299,160 @@ void GMLFeature::SetBoundedByGeometry(CPLXMLNode *psGeom)
         CPLDestroyXMLNode(m_psBoundedByGeometry);
     m_psBoundedByGeometry = psGeom;
 }
+
+/************************************************************************/
+/*                        GMLFeaturePrefetcher()                        */
+/************************************************************************/
+
+// Number of features read per thread and per batch
+constexpr int GML_PREFETCH_FEATURES_PER_THREAD = 256;
+
+GMLFeaturePrefetcher::GMLFeaturePrefetcher(IGMLReader *poReader,
+                                           int nThreads,
+                                           PrepareFunc pfnPrepare)
+    : m_poReader(poReader), m_nThreads(nThreads),
+      m_pfnPrepare(std::move(pfnPrepare))
+{
+    for (int i = 0; i < m_nThreads; i++)
+        m_ahCacheSRS.push_back(GML_BuildOGRGeometryFromList_CreateCache());
+}
+
+/************************************************************************/
+/*                       ~GMLFeaturePrefetcher()                        */
+/************************************************************************/
+
+GMLFeaturePrefetcher::~GMLFeaturePrefetcher()
+{
+    Reset();
+    for (void *hCacheSRS : m_ahCacheSRS)
+        GML_BuildOGRGeometryFromList_DestroyCache(hCacheSRS);
+}
+
+/************************************************************************/
+/*                      GetThreadCountFromConfig()                      */
+/************************************************************************/
+
+/** Returns the number of threads to use, from the GDAL_NUM_THREADS
+ * configuration option. A value <= 1 means that no prefetching should be
+ * done. */
+int GMLFeaturePrefetcher::GetThreadCountFromConfig()
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::max(1, std::min(atoi(pszNumThreads), 128));
+}
+
+/************************************************************************/
+/*                               Reset()                                */
+/************************************************************************/
+
+/** Discards the features that have been read but not returned yet. To be
+ * called before resetting the reading of the underlying reader. */
+void GMLFeaturePrefetcher::Reset()
+{
+    for (size_t i = m_iNext; i < m_asQueue.size(); i++)
+    {
+        delete m_asQueue[i].poFeature;
+        for (OGRGeometry *poGeom : m_asQueue[i].apoGeometries)
+            delete poGeom;
+    }
+    m_asQueue.clear();
+    m_iNext = 0;
+}
+
+/************************************************************************/
+/*                                Fill()                                */
+/************************************************************************/
+
+void GMLFeaturePrefetcher::Fill()
+{
+    m_asQueue.clear();
+    m_iNext = 0;
+
+    GDALThreadReservation oReservation(m_nThreads);
+    const int nThreads = oReservation.GetThreadCount();
+
+    const size_t nMaxFeatures =
+        static_cast<size_t>(nThreads) * GML_PREFETCH_FEATURES_PER_THREAD;
+    while (m_asQueue.size() < nMaxFeatures)
+    {
+        GMLFeature *poFeature = m_poReader->NextFeature();
+        if (poFeature == nullptr)
+            break;
+        m_asQueue.emplace_back();
+        m_asQueue.back().poFeature = poFeature;
+    }
+    if (m_asQueue.empty())
+        return;
+
+    struct Job
+    {
+        GMLFeaturePrefetcher *poThis;
+        size_t nStart;
+        size_t nEnd;
+        void *hCacheSRS;
+    };
+
+    const auto JobFunc = [](void *pData)
+    {
+        const Job *psJob = static_cast<const Job *>(pData);
+        for (size_t i = psJob->nStart; i < psJob->nEnd; i++)
+        {
+            GMLPreparedFeature &sPrepared = psJob->poThis->m_asQueue[i];
+            CPLInstallErrorHandlerAccumulator(sPrepared.aoErrors);
+            psJob->poThis->m_pfnPrepare(sPrepared, psJob->hCacheSRS);
+            CPLUninstallErrorHandlerAccumulator();
+        }
+    };
+
+    const size_t nFeatures = m_asQueue.size();
+    const size_t nJobs = std::min(static_cast<size_t>(nThreads), nFeatures);
+    std::vector<Job> asJobs(nJobs);
+    for (size_t i = 0; i < nJobs; i++)
+    {
+        asJobs[i].poThis = this;
+        asJobs[i].nStart = i * nFeatures / nJobs;
+        asJobs[i].nEnd = (i + 1) * nFeatures / nJobs;
+        asJobs[i].hCacheSRS = m_ahCacheSRS[i];
+    }
+
+    CPLWorkerThreadPool *poPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(static_cast<int>(nJobs))
+                  : nullptr;
+    if (poPool == nullptr)
+    {
+        for (auto &sJob : asJobs)
+            JobFunc(&sJob);
+        return;
+    }
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+        poQueue->SubmitJob(JobFunc, &sJob);
+    poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                              GetNext()                               */
+/************************************************************************/
+
+/** Returns the next feature, in file order. Returns false when there are
+ * no more features. */
+bool GMLFeaturePrefetcher::GetNext(GMLPreparedFeature &sPrepared)
+{
+    if (m_iNext == m_asQueue.size())
+        Fill();
+    if (m_iNext == m_asQueue.size())
+        return false;
+
+    GMLPreparedFeature &sNext = m_asQueue[m_iNext];
+    sPrepared.poFeature = sNext.poFeature;
+    sPrepared.apoGeometries = std::move(sNext.apoGeometries);
+    sPrepared.bError = sNext.bError;
+    sPrepared.osErrorMsg = std::move(sNext.osErrorMsg);
+    sPrepared.aoErrors = std::move(sNext.aoErrors);
+    sNext.poFeature = nullptr;
+    sNext.apoGeometries.clear();
+    m_iNext++;
+    return true;
+}
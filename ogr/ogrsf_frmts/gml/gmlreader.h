@@ -32,12 +32,15 @@
 #define GMLREADER_H_INCLUDED
 
 #include "cpl_port.h"
+#include "cpl_error_internal.h"
 #include "cpl_vsi.h"
 #include "cpl_minixml.h"
 #include "ogr_core.h"
 #include "gmlutils.h"
 
+#include <functional>
 #include <map>
+#include <string>
 #include <vector>
 
 // Special value to map to a NULL field
@@ -529,6 +532,62 @@ class CPL_DLL IGMLReader
     }
 };
 
+/************************************************************************/
+/*                         GMLFeaturePrefetcher                         */
+/************************************************************************/
+
+/** Feature returned by GMLFeaturePrefetcher::GetNext(), with the result of
+ * its preparation by a worker thread. The caller takes ownership of
+ * poFeature and of the geometries. */
+struct GMLPreparedFeature
+{
+    GMLFeature *poFeature = nullptr;
+    std::vector<OGRGeometry *> apoGeometries{};
+    bool bError = false;
+    std::string osErrorMsg{};
+    // Errors emitted during the preparation, to be re-emitted by the caller
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
+/** Reads features from a GML (or NAS) reader by batches, and converts
+ * their geometries to OGR geometries with worker threads, before returning
+ * them in file order.
+ *
+ * XML parsing itself remains sequential, but the GML to OGR geometry
+ * conversion, which is often the most expensive part, is parallelized.
+ */
+class CPL_DLL GMLFeaturePrefetcher
+{
+  public:
+    /** Called from worker threads. Must only use sPrepared and the SRS
+     * cache passed to GML_BuildOGRGeometryFromList(), which is specific
+     * to the calling thread. */
+    typedef std::function<void(GMLPreparedFeature &sPrepared,
+                               void *hCacheSRS)>
+        PrepareFunc;
+
+    GMLFeaturePrefetcher(IGMLReader *poReader, int nThreads,
+                         PrepareFunc pfnPrepare);
+    ~GMLFeaturePrefetcher();
+
+    bool GetNext(GMLPreparedFeature &sPrepared);
+    void Reset();
+
+    static int GetThreadCountFromConfig();
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GMLFeaturePrefetcher)
+
+    IGMLReader *m_poReader;
+    int m_nThreads;
+    PrepareFunc m_pfnPrepare;
+    std::vector<void *> m_ahCacheSRS{};
+    std::vector<GMLPreparedFeature> m_asQueue{};
+    size_t m_iNext = 0;
+
+    void Fill();
+};
+
 IGMLReader *CreateGMLReader(bool bUseExpatParserPreferably,
                             bool bInvertAxisOrderIfLatLong,
                             bool bConsiderEPSGAsURN,
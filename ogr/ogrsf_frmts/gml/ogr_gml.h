@@ -37,6 +37,7 @@
 #include "gmlutils.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 class OGRGMLDataSource;
@@ -73,6 +74,15 @@ class OGRGMLLayer final : public OGRLayer
 
     bool bFaceHoleNegative;
 
+    // Number of threads used to prefetch features and build their
+    // geometries in parallel. 1 means no prefetching.
+    int m_nPrefetchThreads = 1;
+    std::unique_ptr<GMLFeaturePrefetcher> m_poPrefetcher{};
+
+    bool BuildGeometries(const GMLFeature *poGMLFeature, void *hCacheSRSIn,
+                         std::vector<OGRGeometry *> &apoGeometries,
+                         std::string &osErrorMsg);
+
   public:
     OGRGMLLayer(const char *pszName, bool bWriter, OGRGMLDataSource *poDS);
 
@@ -55,7 +55,9 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
       // Must be in synced in OGR_G_CreateFromGML(), OGRGMLLayer::OGRGMLLayer()
       // and GMLReader::GMLReader().
       bFaceHoleNegative(
-          CPLTestBool(CPLGetConfigOption("GML_FACE_HOLE_NEGATIVE", "NO")))
+          CPLTestBool(CPLGetConfigOption("GML_FACE_HOLE_NEGATIVE", "NO"))),
+      m_nPrefetchThreads(
+          bWriter ? 1 : GMLFeaturePrefetcher::GetThreadCountFromConfig())
 {
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
@@ -69,6 +71,8 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
 OGRGMLLayer::~OGRGMLLayer()
 
 {
+    m_poPrefetcher.reset();
+
     CPLFree(pszFIDPrefix);
 
     if (poFeatureDefn)
@@ -101,6 +105,8 @@ void OGRGMLLayer::ResetReading()
     }
 
     iNextGMLId = 0;
+    if (m_poPrefetcher)
+        m_poPrefetcher->Reset();
     poDS->GetReader()->ResetReading();
     CPLDebug("GML", "ResetReading()");
     if (poDS->GetLayerCount() > 1 && poDS->GetReadMode() == STANDARD)
@@ -124,6 +130,91 @@ static GIntBig Increment(GIntBig nVal)
     return nVal;
 }
 
+/************************************************************************/
+/*                          BuildGeometries()                           */
+/************************************************************************/
+
+// Builds the OGR geometries of a GML feature: one per geometry field when
+// there are several of them, or zero or one otherwise.
+// May be called from worker threads, hence hCacheSRSIn.
+// On failure, returns false, and osErrorMsg may be set with the error
+// message of the geometry conversion, when it has not been emitted.
+bool OGRGMLLayer::BuildGeometries(const GMLFeature *poGMLFeature,
+                                  void *hCacheSRSIn,
+                                  std::vector<OGRGeometry *> &apoGeometries,
+                                  std::string &osErrorMsg)
+{
+    const CPLXMLNode *const *papsGeometry = poGMLFeature->GetGeometryList();
+
+    const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
+    const CPLXMLNode *psBoundedByGeometry =
+        poGMLFeature->GetBoundedByGeometry();
+    if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
+    {
+        apsGeometries[0] = psBoundedByGeometry;
+        papsGeometry = apsGeometries;
+    }
+
+    const char *pszSRSName = poDS->GetGlobalSRSName();
+    const int nGeomFieldCount = poFeatureDefn->GetGeomFieldCount();
+    if (nGeomFieldCount > 1)
+    {
+        apoGeometries.resize(nGeomFieldCount);
+        for (int i = 0; i < nGeomFieldCount; i++)
+        {
+            const CPLXMLNode *psGeom = poGMLFeature->GetGeometryRef(i);
+            if (psGeom != nullptr)
+            {
+                const CPLXMLNode *myGeometryList[2] = {psGeom, nullptr};
+                OGRGeometry *poGeom = GML_BuildOGRGeometryFromList(
+                    myGeometryList, true, poDS->GetInvertAxisOrderIfLatLong(),
+                    pszSRSName, poDS->GetConsiderEPSGAsURN(),
+                    poDS->GetSwapCoordinates(),
+                    poDS->GetSecondaryGeometryOption(), hCacheSRSIn,
+                    bFaceHoleNegative);
+                if (poGeom == nullptr)
+                {
+                    for (OGRGeometry *poOtherGeom : apoGeometries)
+                        delete poOtherGeom;
+                    apoGeometries.clear();
+                    return false;
+                }
+
+                // Do geometry type changes if needed to match layer
+                // geometry type.
+                apoGeometries[i] = OGRGeometryFactory::forceTo(
+                    poGeom, poFeatureDefn->GetGeomFieldDefn(i)->GetType());
+            }
+        }
+    }
+    else if (papsGeometry[0] &&
+             strcmp(papsGeometry[0]->pszValue, "null") == 0)
+    {
+        // do nothing
+    }
+    else if (papsGeometry[0] != nullptr)
+    {
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        OGRGeometry *poGeom = GML_BuildOGRGeometryFromList(
+            papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
+            pszSRSName, poDS->GetConsiderEPSGAsURN(),
+            poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
+            hCacheSRSIn, bFaceHoleNegative);
+        CPLPopErrorHandler();
+
+        if (poGeom == nullptr)
+        {
+            osErrorMsg = CPLGetLastErrorMsg();
+            return false;
+        }
+
+        // Do geometry type changes if needed to match layer geometry type.
+        apoGeometries.push_back(
+            OGRGeometryFactory::forceTo(poGeom, GetGeomType()));
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -145,12 +236,33 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         poDS->SetLastReadLayer(this);
     }
 
+    // Prefetching is only possible when the features of other layers are
+    // not interleaved with ours, or are just skipped.
+    if (m_nPrefetchThreads > 1 && !m_poPrefetcher &&
+        poDS->GetReadMode() == STANDARD)
+    {
+        m_poPrefetcher = std::make_unique<GMLFeaturePrefetcher>(
+            poDS->GetReader(), m_nPrefetchThreads,
+            [this](GMLPreparedFeature &sPrepared, void *hCacheSRSIn)
+            {
+                if (sPrepared.poFeature->GetClass() == poFClass)
+                {
+                    sPrepared.bError = !BuildGeometries(
+                        sPrepared.poFeature, hCacheSRSIn,
+                        sPrepared.apoGeometries, sPrepared.osErrorMsg);
+                }
+            });
+    }
+
     /* ==================================================================== */
     /*      Loop till we find and translate a feature meeting all our       */
     /*      requirements.                                                   */
     /* ==================================================================== */
+
     while (true)
     {
+        GMLPreparedFeature sPrepared;
+        bool bPrepared = false;
         GMLFeature *poGMLFeature = poDS->PeekStoredGMLFeature();
         if (poGMLFeature != nullptr)
         {
@@ -158,7 +270,17 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         }
         else
         {
-            poGMLFeature = poDS->GetReader()->NextFeature();
+            if (m_poPrefetcher)
+            {
+                if (!m_poPrefetcher->GetNext(sPrepared))
+                    return nullptr;
+                poGMLFeature = sPrepared.poFeature;
+                bPrepared = true;
+            }
+            else
+            {
+                poGMLFeature = poDS->GetReader()->NextFeature();
+            }
             if (poGMLFeature == nullptr)
                 return nullptr;
 
@@ -276,63 +398,40 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         /* --------------------------------------------------------------------
          */
 
-        OGRGeometry **papoGeometries = nullptr;
-        const CPLXMLNode *const *papsGeometry = poGMLFeature->GetGeometryList();
-
-        const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
-        const CPLXMLNode *psBoundedByGeometry =
-            poGMLFeature->GetBoundedByGeometry();
-        if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
+        std::vector<OGRGeometry *> apoGeometries;
+        std::string osErrorMsg;
+        bool bGeomOK;
+        if (bPrepared)
+        {
+            for (const auto &oError : sPrepared.aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            apoGeometries = std::move(sPrepared.apoGeometries);
+            osErrorMsg = std::move(sPrepared.osErrorMsg);
+            bGeomOK = !sPrepared.bError;
+        }
+        else
         {
-            apsGeometries[0] = psBoundedByGeometry;
-            papsGeometry = apsGeometries;
+            bGeomOK = BuildGeometries(poGMLFeature, hCacheSRS, apoGeometries,
+                                      osErrorMsg);
         }
 
+        OGRGeometry **papoGeometries = nullptr;
         OGRGeometry *poGeom = nullptr;
 
         if (poFeatureDefn->GetGeomFieldCount() > 1)
         {
+            if (!bGeomOK)
+            {
+                // We assume the createFromGML() function would have
+                // already reported the error.
+                delete poGMLFeature;
+                return nullptr;
+            }
+
             papoGeometries = static_cast<OGRGeometry **>(CPLCalloc(
                 poFeatureDefn->GetGeomFieldCount(), sizeof(OGRGeometry *)));
-            const char *pszSRSName = poDS->GetGlobalSRSName();
             for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
-            {
-                const CPLXMLNode *psGeom = poGMLFeature->GetGeometryRef(i);
-                if (psGeom != nullptr)
-                {
-                    const CPLXMLNode *myGeometryList[2] = {psGeom, nullptr};
-                    poGeom = GML_BuildOGRGeometryFromList(
-                        myGeometryList, true,
-                        poDS->GetInvertAxisOrderIfLatLong(), pszSRSName,
-                        poDS->GetConsiderEPSGAsURN(),
-                        poDS->GetSwapCoordinates(),
-                        poDS->GetSecondaryGeometryOption(), hCacheSRS,
-                        bFaceHoleNegative);
-
-                    // Do geometry type changes if needed to match layer
-                    // geometry type.
-                    if (poGeom != nullptr)
-                    {
-                        papoGeometries[i] = OGRGeometryFactory::forceTo(
-                            poGeom,
-                            poFeatureDefn->GetGeomFieldDefn(i)->GetType());
-                        poGeom = nullptr;
-                    }
-                    else
-                    {
-                        // We assume the createFromGML() function would have
-                        // already reported the error.
-                        for (int j = 0; j < poFeatureDefn->GetGeomFieldCount();
-                             j++)
-                        {
-                            delete papoGeometries[j];
-                        }
-                        CPLFree(papoGeometries);
-                        delete poGMLFeature;
-                        return nullptr;
-                    }
-                }
-            }
+                papoGeometries[i] = apoGeometries[i];
 
             if (m_poFilterGeom != nullptr && m_iGeomFieldFilter >= 0 &&
                 m_iGeomFieldFilter < poFeatureDefn->GetGeomFieldCount() &&
@@ -348,50 +447,28 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
                 continue;
             }
         }
-        else if (papsGeometry[0] &&
-                 strcmp(papsGeometry[0]->pszValue, "null") == 0)
+        else if (!bGeomOK)
         {
-            // do nothing
+            const bool bGoOn = CPLTestBool(
+                CPLGetConfigOption("GML_SKIP_CORRUPTED_FEATURES", "NO"));
+
+            CPLError(bGoOn ? CE_Warning : CE_Failure, CPLE_AppDefined,
+                     "Geometry of feature " CPL_FRMT_GIB
+                     " %scannot be parsed: %s%s",
+                     nFID, pszGML_FID ? CPLSPrintf("%s ", pszGML_FID) : "",
+                     osErrorMsg.c_str(),
+                     bGoOn ? ". Skipping to next feature."
+                           : ". You may set the GML_SKIP_CORRUPTED_FEATURES "
+                             "configuration option to YES to skip to the next "
+                             "feature");
+            delete poGMLFeature;
+            if (bGoOn)
+                continue;
+            return nullptr;
         }
-        else if (papsGeometry[0] != nullptr)
+        else if (!apoGeometries.empty())
         {
-            const char *pszSRSName = poDS->GetGlobalSRSName();
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            poGeom = GML_BuildOGRGeometryFromList(
-                papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
-                pszSRSName, poDS->GetConsiderEPSGAsURN(),
-                poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
-                hCacheSRS, bFaceHoleNegative);
-            CPLPopErrorHandler();
-
-            // Do geometry type changes if needed to match layer geometry type.
-            if (poGeom != nullptr)
-            {
-                poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
-            }
-            else
-            {
-                const CPLString osLastErrorMsg(CPLGetLastErrorMsg());
-
-                const bool bGoOn = CPLTestBool(
-                    CPLGetConfigOption("GML_SKIP_CORRUPTED_FEATURES", "NO"));
-
-                CPLError(
-                    bGoOn ? CE_Warning : CE_Failure, CPLE_AppDefined,
-                    "Geometry of feature " CPL_FRMT_GIB
-                    " %scannot be parsed: %s%s",
-                    nFID, pszGML_FID ? CPLSPrintf("%s ", pszGML_FID) : "",
-                    osLastErrorMsg.c_str(),
-                    bGoOn ? ". Skipping to next feature."
-                          : ". You may set the GML_SKIP_CORRUPTED_FEATURES "
-                            "configuration option to YES to skip to the next "
-                            "feature");
-                delete poGMLFeature;
-                if (bGoOn)
-                    continue;
-                return nullptr;
-            }
-
+            poGeom = apoGeometries[0];
             if (m_poFilterGeom != nullptr && !FilterGeometry(poGeom))
             {
                 delete poGMLFeature;
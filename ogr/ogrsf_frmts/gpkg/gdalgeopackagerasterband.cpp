@@ -31,6 +31,8 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <limits>
@@ -696,14 +698,12 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::ReadTile(
                 abyCT[4 * i + 2] = 0;
                 abyCT[4 * i + 3] = 0;
             }
-            for (GPtrDiff_t i = 0; i < nBlockPixels; i++)
-            {
-                const GByte byVal = pabyTileData[i];
-                pabyTileData[i] = abyCT[4 * byVal];
-                pabyTileData[i + 1 * nBlockPixels] = abyCT[4 * byVal + 1];
-                pabyTileData[i + 2 * nBlockPixels] = abyCT[4 * byVal + 2];
-                pabyTileData[i + 3 * nBlockPixels] = abyCT[4 * byVal + 3];
-            }
+            GByte *const apabyDst[4] = {
+                pabyTileData, pabyTileData + 1 * nBlockPixels,
+                pabyTileData + 2 * nBlockPixels,
+                pabyTileData + 3 * nBlockPixels};
+            GDALExpandPaletteByte(pabyTileData, abyCT, 4, apabyDst,
+                                  static_cast<size_t>(nBlockPixels));
         }
         else
         {
@@ -877,6 +877,20 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         return pabyData;
     }
 
+    if (!m_oMapPrefetchedTiles.empty())
+    {
+        const auto oIter =
+            m_oMapPrefetchedTiles.find(std::make_pair(nRow, nCol));
+        if (oIter != m_oMapPrefetchedTiles.end())
+        {
+            memcpy(pabyData, oIter->second.abyData.data(),
+                   oIter->second.abyData.size());
+            if (pbIsLossyFormat)
+                *pbIsLossyFormat = oIter->second.bIsLossyFormat;
+            return pabyData;
+        }
+    }
+
 #ifdef DEBUG_VERBOSE
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
@@ -998,6 +1012,249 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     return pabyData;
 }
 
+/************************************************************************/
+/*                          PrefetchTiles()                             */
+/************************************************************************/
+
+// Fetches with a single SQL request the tiles intersecting a RasterIO()
+// request, whose blocks are not already cached, and decodes them, in parallel
+// if GDAL_NUM_THREADS is set. The decoded tiles are then used by ReadTile()
+// until ClearPrefetchedTiles() is called.
+// Returns true if tiles have been prefetched.
+bool GDALGPKGMBTilesLikePseudoDataset::PrefetchTiles(int nXOff, int nYOff,
+                                                     int nXSize, int nYSize,
+                                                     int nBufXSize,
+                                                     int nBufYSize)
+{
+    // Nested call, or update mode where tiles may be partially written
+    if (!m_oMapPrefetchedTiles.empty() || IGetUpdate() ||
+        m_pabyCachedTiles == nullptr)
+        return false;
+
+    // Down-sampling requests are normally served from overviews
+    GDALRasterBand *poFirstBand = IGetRasterBand(1);
+    if ((nBufXSize < nXSize || nBufYSize < nYSize) &&
+        poFirstBand->GetOverviewCount() > 0)
+        return false;
+
+    int nBlockXSize, nBlockYSize;
+    poFirstBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlockXStart = nXOff / nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYStart = nYOff / nBlockYSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+
+    const int nRowMin = std::max(0, nBlockYStart + m_nShiftYTiles);
+    const int nRowMax =
+        std::min(m_nTileMatrixHeight - 1,
+                 nBlockYEnd + m_nShiftYTiles + (m_nShiftYPixelsMod ? 1 : 0));
+    const int nColMin = std::max(0, nBlockXStart + m_nShiftXTiles);
+    const int nColMax =
+        std::min(m_nTileMatrixWidth - 1,
+                 nBlockXEnd + m_nShiftXTiles + (m_nShiftXPixelsMod ? 1 : 0));
+    if (nRowMin > nRowMax || nColMin > nColMax)
+        return false;
+
+    // Collect the tiles whose blocks are not cached yet. When tiles are not
+    // aligned with blocks, we cannot easily know, so fetch them all.
+    auto poBand =
+        cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(poFirstBand);
+    std::map<std::pair<int, int>, PrefetchedTile> oMapTiles;
+    for (int nRow = nRowMin; nRow <= nRowMax; ++nRow)
+    {
+        for (int nCol = nColMin; nCol <= nColMax; ++nCol)
+        {
+            if (m_nShiftXPixelsMod == 0 && m_nShiftYPixelsMod == 0)
+            {
+                GDALRasterBlock *poBlock =
+                    poBand->AccessibleTryGetLockedBlockRef(
+                        nCol - m_nShiftXTiles, nRow - m_nShiftYTiles);
+                if (poBlock)
+                {
+                    poBlock->DropLock();
+                    continue;
+                }
+            }
+            oMapTiles[std::make_pair(nRow, nCol)];
+        }
+    }
+    if (oMapTiles.size() <= 1)
+        return false;
+
+    // Do not prefetch more than what the block cache can hold
+    const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
+    const size_t nTileSize = static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                             m_nDTSize * nTileBands;
+    if (static_cast<uint64_t>(oMapTiles.size()) * nTileSize >
+        static_cast<uint64_t>(GDALGetCacheMax64() / 2))
+    {
+        return false;
+    }
+
+    // Make sure that the color table is established before decoding tiles
+    // in worker threads, since this may issue SQL requests
+    poFirstBand->GetColorTable();
+
+    // MBTiles rows are bottom-up: GetRowFromIntoTopConvention() is its own
+    // inverse.
+    const int nDBRow1 = GetRowFromIntoTopConvention(nRowMin);
+    const int nDBRow2 = GetRowFromIntoTopConvention(nRowMax);
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_row, tile_column, tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_row BETWEEN %d AND %d AND "
+        "tile_column BETWEEN %d AND %d%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel, std::min(nDBRow1, nDBRow2),
+        std::max(nDBRow1, nDBRow2), nColMin, nColMax,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+        return false;
+
+    struct TileToDecode
+    {
+        PrefetchedTile *psTile = nullptr;
+        std::vector<GByte> abyRawData{};
+        GIntBig nTileId = 0;
+        double dfTileOffset = 0.0;
+        double dfTileScale = 1.0;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        GDALGPKGMBTilesLikePseudoDataset *poTPD = nullptr;
+    };
+
+    std::vector<TileToDecode> asTilesToDecode;
+    while ((rc = sqlite3_step(hStmt)) == SQLITE_ROW)
+    {
+        const int nRow =
+            GetRowFromIntoTopConvention(sqlite3_column_int(hStmt, 0));
+        const int nCol = sqlite3_column_int(hStmt, 1);
+        auto oIter = oMapTiles.find(std::make_pair(nRow, nCol));
+        if (oIter == oMapTiles.end() ||
+            sqlite3_column_type(hStmt, 2) != SQLITE_BLOB)
+            continue;
+        TileToDecode sTile;
+        sTile.psTile = &(oIter->second);
+        const GByte *pabyRawData =
+            static_cast<const GByte *>(sqlite3_column_blob(hStmt, 2));
+        sTile.abyRawData.assign(pabyRawData,
+                                pabyRawData + sqlite3_column_bytes(hStmt, 2));
+        sTile.nTileId =
+            (m_eDT == GDT_Byte) ? 0 : sqlite3_column_int64(hStmt, 3);
+        sTile.poTPD = this;
+        asTilesToDecode.emplace_back(std::move(sTile));
+    }
+    sqlite3_finalize(hStmt);
+    if (rc != SQLITE_DONE)
+        return false;
+
+    for (auto &sTile : asTilesToDecode)
+        GetTileOffsetAndScale(sTile.nTileId, sTile.dfTileOffset,
+                              sTile.dfTileScale);
+
+    // Tiles not found in the database are empty
+    for (auto &oIter : oMapTiles)
+    {
+        oIter.second.abyData.resize(nTileSize);
+        FillEmptyTile(oIter.second.abyData.data());
+    }
+
+    const auto DecodeJob = [](void *pData)
+    {
+        TileToDecode *psTile = static_cast<TileToDecode *>(pData);
+        const std::string osMemFileName(
+            CPLSPrintf("/vsimem/gpkg_prefetch_tile_%p", psTile));
+        VSILFILE *fp = VSIFileFromMemBuffer(
+            osMemFileName.c_str(), psTile->abyRawData.data(),
+            psTile->abyRawData.size(), FALSE);
+        VSIFCloseL(fp);
+        CPLInstallErrorHandlerAccumulator(psTile->aoErrors);
+        // On failure, ReadTile() fills the tile as empty, which is what
+        // the non-prefetched code path does too.
+        psTile->poTPD->ReadTile(osMemFileName, psTile->psTile->abyData.data(),
+                                psTile->dfTileOffset, psTile->dfTileScale,
+                                &(psTile->psTile->bIsLossyFormat));
+        CPLUninstallErrorHandlerAccumulator();
+        VSIUnlink(osMemFileName.c_str());
+        psTile->abyRawData.clear();
+    };
+
+    int nThreads = 1;
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+    }
+    GDALThreadReservation oThreadReservation(
+        std::min(nThreads, static_cast<int>(asTilesToDecode.size())));
+    CPLWorkerThreadPool *poThreadPool =
+        oThreadReservation.GetThreadCount() > 1
+            ? GDALGetGlobalThreadPool(oThreadReservation.GetThreadCount())
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        CPLDebug("GPKG", "Decoding %d tiles with up to %d threads",
+                 static_cast<int>(asTilesToDecode.size()),
+                 oThreadReservation.GetThreadCount());
+        for (auto &sTile : asTilesToDecode)
+            poJobQueue->SubmitJob(DecodeJob, &sTile);
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &sTile : asTilesToDecode)
+            DecodeJob(&sTile);
+    }
+
+    for (const auto &sTile : asTilesToDecode)
+    {
+        for (const auto &oError : sTile.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    m_oMapPrefetchedTiles = std::move(oMapTiles);
+    return true;
+}
+
+/************************************************************************/
+/*                       ClearPrefetchedTiles()                         */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::ClearPrefetchedTiles()
+{
+    m_oMapPrefetchedTiles.clear();
+}
+
+/************************************************************************/
+/*                            IRasterIO()                               */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    const bool bPrefetched =
+        eRWFlag == GF_Read && m_poTPD->PrefetchTiles(nXOff, nYOff, nXSize,
+                                                     nYSize, nBufXSize,
+                                                     nBufYSize);
+    const CPLErr eErr = GDALPamRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    if (bPrefetched)
+        m_poTPD->ClearPrefetchedTiles();
+    return eErr;
+}
+
 /************************************************************************/
 /*                         IReadBlock()                                 */
 /************************************************************************/
@@ -2235,66 +2492,11 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             GByte *pabyBlob =
                 VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
 
-            /* Create or commit and recreate transaction */
-            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
-                m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
-            {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
-            {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
-            }
-            poMainDS->m_nTileInsertionCount++;
-
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
-#ifdef DEBUG_VERBOSE
-            CPLDebug("GPKG", "%s", pszSQL);
-#endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-            if (rc != SQLITE_OK)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "failed to prepare SQL %s: %s", pszSQL,
-                         sqlite3_errmsg(IGetDB()));
-                CPLFree(pabyBlob);
-            }
-            else
-            {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
-                rc = sqlite3_step(hStmt);
-                if (rc == SQLITE_DONE)
-                    eErr = CE_None;
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
-                }
-            }
-            sqlite3_finalize(hStmt);
-            sqlite3_free(pszSQL);
+            eErr = InsertTileBlob(nRow, nCol, pabyBlob,
+                                  static_cast<size_t>(nBlobSize));
 
-            if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
+            if (eErr == CE_None && (m_eTF == GPKG_TF_PNG_16BIT ||
+                                    m_eTF == GPKG_TF_TIFF_32BIT_FLOAT))
             {
                 GIntBig nTileId = GetTileId(nRow, nCol);
                 if (nTileId == 0)
@@ -2303,7 +2505,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 {
                     DeleteFromGriddedTileAncillary(nTileId);
 
-                    pszSQL = sqlite3_mprintf(
+                    char *pszSQL = sqlite3_mprintf(
                         "INSERT INTO gpkg_2d_gridded_tile_ancillary "
                         "(tpudt_name, tpudt_id, scale, offset, min, max, "
                         "mean, std_dev) VALUES "
@@ -2312,9 +2514,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 #ifdef DEBUG_VERBOSE
                     CPLDebug("GPKG", "%s", pszSQL);
 #endif
-                    hStmt = nullptr;
-                    rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
-                                            nullptr);
+                    sqlite3_stmt *hStmt = nullptr;
+                    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
+                                                nullptr);
                     if (rc != SQLITE_OK)
                     {
                         eErr = CE_Failure;
@@ -2360,6 +2562,79 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
     return eErr;
 }
 
+/************************************************************************/
+/*                           InsertTileBlob()                           */
+/************************************************************************/
+
+/** Inserts (or replaces) the encoded content of a tile. pabyBlob must have
+ * been allocated with CPLMalloc() and is owned by this method. */
+CPLErr GDALGPKGMBTilesLikePseudoDataset::InsertTileBlob(int nRow, int nCol,
+                                                        GByte *pabyBlob,
+                                                        size_t nBlobSize)
+{
+    /* Create or commit and recreate transaction */
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileInsertionCount < 0)
+    {
+        CPLFree(pabyBlob);
+        return CE_Failure;
+    }
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            CPLFree(pabyBlob);
+            return CE_Failure;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    CPLErr eErr = CE_Failure;
+    char *pszSQL = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                                   "(zoom_level, tile_row, tile_column, "
+                                   "tile_data) VALUES (%d, %d, %d, ?)",
+                                   m_osRasterTable.c_str(), m_nZoomLevel,
+                                   GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to prepare SQL %s: %s",
+                 pszSQL, sqlite3_errmsg(IGetDB()));
+        CPLFree(pabyBlob);
+    }
+    else
+    {
+        sqlite3_bind_blob(hStmt, 1, pabyBlob, static_cast<int>(nBlobSize),
+                          CPLFree);
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol, m_nZoomLevel,
+                     sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+    return eErr;
+}
+
 /************************************************************************/
 /*                     FlushRemainingShiftedTiles()                     */
 /************************************************************************/
@@ -34,6 +34,10 @@
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 typedef struct
 {
     int nRow;
@@ -112,6 +116,16 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     GDALGPKGMBTilesLikePseudoDataset *m_poParentDS = nullptr;
 
+    // Tiles fetched and decoded by PrefetchTiles(), indexed by (row, col)
+    // and used by ReadTile() until ClearPrefetchedTiles() is called.
+    struct PrefetchedTile
+    {
+        std::vector<GByte> abyData{};
+        bool bIsLossyFormat = false;
+    };
+
+    std::map<std::pair<int, int>, PrefetchedTile> m_oMapPrefetchedTiles{};
+
   private:
     bool m_bInWriteTile = false;
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
@@ -138,7 +152,13 @@ class GDALGPKGMBTilesLikePseudoDataset
     GByte *ReadTile(int nRow, int nCol, GByte *pabyData,
                     bool *pbIsLossyFormat = nullptr);
 
+    bool PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize,
+                       int nBufXSize, int nBufYSize);
+    void ClearPrefetchedTiles();
+
     CPLErr WriteTile();
+    CPLErr InsertTileBlob(int nRow, int nCol, GByte *pabyBlob,
+                          size_t nBlobSize);
 
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
@@ -178,6 +198,11 @@ class GDALGPKGMBTilesLikeRasterBand : public GDALPamRasterBand
 
     virtual CPLErr IReadBlock(int nBlockXOff, int nBlockYOff,
                               void *pData) override;
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData, int nBufXSize,
+                             int nBufYSize, GDALDataType eBufType,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff,
                                void *pData) override;
     virtual CPLErr FlushCache(bool bAtClosing) override;
@@ -414,6 +414,9 @@ class GDALGeoPackageDataset final : public OGRSQLiteBaseDataSource,
                                    char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressData);
+    bool CopyCompressedTiles(GDALDataset *poSrcDS, const char *pszFormat,
+                             GDALProgressFunc pfnProgress,
+                             void *pProgressData);
 
     static std::string GetCurrentDateEscapedSQL();
 
@@ -605,7 +608,9 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -723,6 +728,9 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     int m_nIsCompatOfOptimizedGetNextArrowArray = -1;
     bool m_bGetNextArrowArrayCalledSinceResetReading = false;
+    // FID after which the optimized GetNextArrowArray() reads its next batch
+    GIntBig m_iNextFIDForArrowArray = 0;
+    GIntBig m_nMaxFIDForArrowArray = 0;
 
     int m_nCountInsertInTransactionThreshold = -1;
     GIntBig m_nCountInsertInTransaction = 0;
@@ -784,6 +792,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 #endif
 
     void CheckGeometryType(const OGRFeature *poFeature);
+    void CheckGeometryType(OGRwkbGeometryType eGeomType);
 
     OGRErr ReadTableDefinition();
     void InitView();
@@ -799,6 +808,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                                         const char *pszNewName);
 
     OGRErr CreateOrUpsertFeature(OGRFeature *poFeature, bool bUpsert);
+    bool UpdateExtentAndRTree(GIntBig nFID, const OGREnvelope &oEnv,
+                              bool bUpsert);
 
     GIntBig GetTotalFeatureCount();
 
@@ -839,6 +850,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     void GetNextArrowArrayAsynchronousWorker();
     void CancelAsyncNextArrowArray();
 
+    bool PrepareGetNextFeature();
+
   protected:
     friend void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext,
                                                    int /*argc*/,
@@ -878,6 +891,9 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     void ResetReading() override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr IUpsertFeature(OGRFeature *poFeature) override;
     OGRErr IUpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
@@ -896,6 +912,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr SetAttributeFilter(const char *pszQuery) override;
     OGRErr SyncToDisk() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     OGRErr StartTransaction() override;
     OGRErr CommitTransaction() override;
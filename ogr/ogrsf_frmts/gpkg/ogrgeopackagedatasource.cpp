@@ -1137,10 +1137,15 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    const bool bPrefetched =
+        eRWFlag == GF_Read && PrefetchTiles(nXOff, nYOff, nXSize, nYSize,
+                                            nBufXSize, nBufYSize);
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
         psExtraArg);
+    if (bPrefetched)
+        ClearPrefetchedTiles();
 
     // If writing all bands, in non-shifted mode, flush all entirely written
     // tiles This can avoid "stressing" the block cache with too many dirty
@@ -6085,6 +6090,164 @@ static GDALDataset *GetUnderlyingDataset(GDALDataset *poSrcDS)
     return poSrcDS;
 }
 
+/************************************************************************/
+/*                    GetCompressedTilesCopyFormat()                    */
+/************************************************************************/
+
+/** Returns the format ("JPEG" or "WEBP") in which the tiles of the source
+ * dataset can be inserted as they are in a GeoPackage with the CUSTOM tiling
+ * scheme, or an empty string if they must be re-encoded. */
+static std::string GetCompressedTilesCopyFormat(GDALDataset *poSrcDS,
+                                                CSLConstList papszOptions,
+                                                bool bAuto)
+{
+    const int nBands = poSrcDS->GetRasterCount();
+    double adfGeoTransform[6];
+    if (nBands == 0 || poSrcDS->GetGeoTransform(adfGeoTransform) != CE_None)
+        return std::string();
+    auto poSrcBand = poSrcDS->GetRasterBand(1);
+    if (poSrcBand->GetRasterDataType() != GDT_Byte ||
+        poSrcBand->GetColorTable() != nullptr)
+    {
+        return std::string();
+    }
+
+    // Source and target tiling grids must match
+    int nSrcBlockXSize = 0;
+    int nSrcBlockYSize = 0;
+    poSrcBand->GetBlockSize(&nSrcBlockXSize, &nSrcBlockYSize);
+    const char *pszTileSize =
+        CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", "256");
+    if (atoi(CSLFetchNameValueDef(papszOptions, "BLOCKXSIZE", pszTileSize)) !=
+            nSrcBlockXSize ||
+        atoi(CSLFetchNameValueDef(papszOptions, "BLOCKYSIZE", pszTileSize)) !=
+            nSrcBlockYSize)
+    {
+        return std::string();
+    }
+
+    // An explicit QUALITY is a request for re-encoding
+    if (bAuto && CSLFetchNameValue(papszOptions, "QUALITY") != nullptr)
+        return std::string();
+
+    const CPLStringList aosFormats(poSrcDS->GetCompressionFormats(
+        0, 0, nSrcBlockXSize, nSrcBlockYSize, nBands, nullptr));
+    if (aosFormats.size() != 1)
+        return std::string();
+    const CPLStringList aosTokens(CSLTokenizeString2(aosFormats[0], ";", 0));
+    if (aosTokens.empty())
+        return std::string();
+
+    const char *pszTF = CSLFetchNameValueDef(papszOptions, "TILE_FORMAT", "");
+    if (EQUAL(aosTokens[0], "JPEG") &&
+        strstr(aosFormats[0], "colorspace=RGBA") == nullptr &&
+        (EQUAL(pszTF, "JPEG") ||
+         (nBands == 3 && (pszTF[0] == '\0' || EQUAL(pszTF, "AUTO") ||
+                          EQUAL(pszTF, "PNG_JPEG")))))
+    {
+        if (nBands == 1 || nBands == 3)
+            return "JPEG";
+    }
+    else if (EQUAL(aosTokens[0], "WEBP") && EQUAL(pszTF, "WEBP") &&
+             (nBands == 3 || nBands == 4))
+    {
+        return "WEBP";
+    }
+    return std::string();
+}
+
+/************************************************************************/
+/*                        CopyCompressedTiles()                         */
+/************************************************************************/
+
+/** Copies the tiles of the source dataset, whose grid matches the one of
+ * this dataset, without decoding them when possible. Tiles that cannot be
+ * read in pszFormat are re-encoded. */
+bool GDALGeoPackageDataset::CopyCompressedTiles(GDALDataset *poSrcDS,
+                                                const char *pszFormat,
+                                                GDALProgressFunc pfnProgress,
+                                                void *pProgressData)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nTilesPerRow = DIV_ROUND_UP(nRasterXSize, nBlockXSize);
+    const int nTilesPerCol = DIV_ROUND_UP(nRasterYSize, nBlockYSize);
+    const double dfTotalTiles =
+        static_cast<double>(nTilesPerRow) * nTilesPerCol;
+    GIntBig nCopiedTiles = 0;
+    GIntBig nReencodedTiles = 0;
+    std::vector<GByte> abyPixels;
+
+    for (int nRow = 0; nRow < nTilesPerCol; ++nRow)
+    {
+        for (int nCol = 0; nCol < nTilesPerRow; ++nCol)
+        {
+            const int nXOff = nCol * nBlockXSize;
+            const int nYOff = nRow * nBlockYSize;
+            void *pBuffer = nullptr;
+            size_t nBufferSize = 0;
+            char *pszDetailedFormat = nullptr;
+            if (poSrcDS->ReadCompressedData(pszFormat, nXOff, nYOff,
+                                            nBlockXSize, nBlockYSize, nBands,
+                                            nullptr, &pBuffer, &nBufferSize,
+                                            &pszDetailedFormat) == CE_None &&
+                (pszDetailedFormat == nullptr ||
+                 strstr(pszDetailedFormat, "colorspace=RGBA") == nullptr) &&
+                nBufferSize < static_cast<size_t>(INT_MAX))
+            {
+                CPLFree(pszDetailedFormat);
+                if (InsertTileBlob(nRow, nCol, static_cast<GByte *>(pBuffer),
+                                   nBufferSize) != CE_None)
+                {
+                    return false;
+                }
+                ++nCopiedTiles;
+            }
+            else
+            {
+                VSIFree(pBuffer);
+                CPLFree(pszDetailedFormat);
+
+                // Missing or incompatible source tile: go through the
+                // regular decoding/encoding path.
+                const int nXSize =
+                    std::min(nBlockXSize, nRasterXSize - nXOff);
+                const int nYSize =
+                    std::min(nBlockYSize, nRasterYSize - nYOff);
+                abyPixels.resize(static_cast<size_t>(nXSize) * nYSize *
+                                 nBands);
+                if (poSrcDS->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                                      abyPixels.data(), nXSize, nYSize,
+                                      GDT_Byte, nBands, nullptr, 0, 0, 0,
+                                      nullptr) != CE_None ||
+                    RasterIO(GF_Write, nXOff, nYOff, nXSize, nYSize,
+                             abyPixels.data(), nXSize, nYSize, GDT_Byte,
+                             nBands, nullptr, 0, 0, 0, nullptr) != CE_None)
+                {
+                    return false;
+                }
+                ++nReencodedTiles;
+            }
+
+            if (!pfnProgress(
+                    (static_cast<double>(nRow) * nTilesPerRow + nCol + 1) /
+                        dfTotalTiles,
+                    "", pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+        }
+    }
+
+    CPLDebug("GPKG",
+             CPL_FRMT_GIB " tiles copied without re-encoding, " CPL_FRMT_GIB
+                          " re-encoded",
+             nCopiedTiles, nReencodedTiles);
+    return FlushCache(false) == CE_None;
+}
+
 /************************************************************************/
 /*                            CreateCopy()                              */
 /************************************************************************/
@@ -6150,6 +6313,53 @@ GDALDataset *GDALGeoPackageDataset::CreateCopy(const char *pszFilename,
             return nullptr;
         }
 
+        // Try to copy the compressed tiles of the source dataset as they are
+        const char *pszLosslessCopy =
+            CSLFetchNameValueDef(papszOptions, "LOSSLESS_COPY", "AUTO");
+        const bool bAutoLosslessCopy = EQUAL(pszLosslessCopy, "AUTO");
+        if (bAutoLosslessCopy || CPLTestBool(pszLosslessCopy))
+        {
+            const std::string osFormat = GetCompressedTilesCopyFormat(
+                poSrcDS, papszOptions, bAutoLosslessCopy);
+            if (!osFormat.empty())
+            {
+                CPLDebug("GPKG", "Copying %s tiles from source dataset",
+                         osFormat.c_str());
+                auto poDS = std::make_unique<GDALGeoPackageDataset>();
+                if (!poDS->Create(pszFilename, poSrcDS->GetRasterXSize(),
+                                  poSrcDS->GetRasterYSize(), nBands, GDT_Byte,
+                                  apszUpdatedOptions))
+                {
+                    return nullptr;
+                }
+                double adfGeoTransform[6];
+                poSrcDS->GetGeoTransform(adfGeoTransform);
+                poDS->SetGeoTransform(adfGeoTransform);
+                const auto poSrcSRS = poSrcDS->GetSpatialRef();
+                if (poSrcSRS && !poSrcSRS->IsEmpty())
+                    poDS->SetSpatialRef(poSrcSRS);
+                poDS->SetMetadata(poSrcDS->GetMetadata());
+                if (nBands <= 3)
+                {
+                    poDS->m_nBandCountFromMetadata = nBands;
+                    poDS->m_bMetadataDirty = true;
+                }
+                if (!poDS->CopyCompressedTiles(poSrcDS, osFormat.c_str(),
+                                               pfnProgress, pProgressData))
+                {
+                    return nullptr;
+                }
+                poDS->SetPamFlags(poDS->GetPamFlags() & ~GPF_DIRTY);
+                return poDS.release();
+            }
+            else if (!bAutoLosslessCopy)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "LOSSLESS_COPY=YES requested but not possible");
+                return nullptr;
+            }
+        }
+
         GDALGeoPackageDataset *poDS = nullptr;
         GDALDriver *poThisDriver =
             reinterpret_cast<GDALDriver *>(GDALGetDriverByName("GPKG"));
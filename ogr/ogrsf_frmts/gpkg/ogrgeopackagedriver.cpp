@@ -497,6 +497,13 @@ void GDALGPKGDriver::InitializeCreationOptionList()
         "  <Option name='BLOCKYSIZE' type='int' scope='raster' "
         "description='Block height in pixels' default='256' "
         "max='4096'/>" COMPRESSION_OPTIONS
+        "  <Option name='LOSSLESS_COPY' type='string-select' scope='raster' "
+        "description='Whether to copy JPEG or WEBP tiles of the source dataset "
+        "without re-encoding them' default='AUTO'>"
+        "    <Value>AUTO</Value>"
+        "    <Value>YES</Value>"
+        "    <Value>NO</Value>"
+        "  </Option>"
         "  <Option name='TILING_SCHEME' type='string' scope='raster' "
         "description='Which tiling scheme to use: pre-defined value or custom "
         "inline/outline JSON definition' default='CUSTOM'>"
@@ -92,6 +92,19 @@ void OGRGeoPackageLayer::ClearStatement()
 
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+// When poFeatureToReuse is not null, the next feature is translated into it
+// and it is returned, instead of a new feature.
+OGRFeature *
+OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (m_bEOF)
         return nullptr;
@@ -134,14 +147,16 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        OGRFeature *poFeature =
+            TranslateFeature(m_poQueryStatement, poFeatureToReuse);
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        if (poFeature != poFeatureToReuse)
+            delete poFeature;
     }
 }
 
@@ -343,13 +358,28 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                  OGRFeature *poFeatureToReuse)
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Create a feature from the current result.                       */
+    /*      Create a feature from the current result, or recycle the one    */
+    /*      provided by the caller, keeping its geometry aside so that it   */
+    /*      can be reused if the next one is of the same type.              */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    std::unique_ptr<OGRGeometry> poGeomToReuse;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == m_poFeatureDefn);
+        if (m_iGeomCol >= 0)
+            poGeomToReuse.reset(poFeature->StealGeometry());
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(m_poFeatureDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -386,7 +416,7 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
             const GByte *pabyGpkg = static_cast<const GByte *>(
                 sqlite3_column_blob(hStmt, m_iGeomCol));
             OGRGeometry *poGeom =
-                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr, poGeomToReuse);
             if (poGeom == nullptr)
             {
                 // Try also spatialite geometry blobs
@@ -30,6 +30,7 @@
 #include "ogr_geopackage.h"
 #include "ogrgeopackageutility.h"
 #include "ogrsqliteutility.h"
+#include "ogrlayerarrow.h"
 #include "cpl_md5.h"
 #include "cpl_time.h"
 #include "ogr_p.h"
@@ -2114,34 +2115,36 @@ void OGRGeoPackageTableLayer::DisableFeatureCountTriggers(
  * reflect the dimensionality of feature geometries.
  */
 void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+    if (poGeom != nullptr)
+        CheckGeometryType(poGeom->getGeometryType());
+}
+
+void OGRGeoPackageTableLayer::CheckGeometryType(OGRwkbGeometryType eGeomTypeIn)
 {
     const OGRwkbGeometryType eLayerGeomType = GetGeomType();
     const OGRwkbGeometryType eFlattenLayerGeomType = wkbFlatten(eLayerGeomType);
-    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
     if (eFlattenLayerGeomType != wkbNone && eFlattenLayerGeomType != wkbUnknown)
     {
-        if (poGeom != nullptr)
+        OGRwkbGeometryType eGeomType = wkbFlatten(eGeomTypeIn);
+        if (!OGR_GT_IsSubClassOf(eGeomType, eFlattenLayerGeomType) &&
+            m_eSetBadGeomTypeWarned.find(eGeomType) ==
+                m_eSetBadGeomTypeWarned.end())
         {
-            OGRwkbGeometryType eGeomType =
-                wkbFlatten(poGeom->getGeometryType());
-            if (!OGR_GT_IsSubClassOf(eGeomType, eFlattenLayerGeomType) &&
-                m_eSetBadGeomTypeWarned.find(eGeomType) ==
-                    m_eSetBadGeomTypeWarned.end())
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "A geometry of type %s is inserted into layer %s "
-                         "of geometry type %s, which is not normally allowed "
-                         "by the GeoPackage specification, but the driver will "
-                         "however do it. "
-                         "To create a conformant GeoPackage, if using ogr2ogr, "
-                         "the -nlt option can be used to override the layer "
-                         "geometry type. "
-                         "This warning will no longer be emitted for this "
-                         "combination of layer and feature geometry type.",
-                         OGRToOGCGeomType(eGeomType), GetName(),
-                         OGRToOGCGeomType(eFlattenLayerGeomType));
-                m_eSetBadGeomTypeWarned.insert(eGeomType);
-            }
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "A geometry of type %s is inserted into layer %s "
+                     "of geometry type %s, which is not normally allowed "
+                     "by the GeoPackage specification, but the driver will "
+                     "however do it. "
+                     "To create a conformant GeoPackage, if using ogr2ogr, "
+                     "the -nlt option can be used to override the layer "
+                     "geometry type. "
+                     "This warning will no longer be emitted for this "
+                     "combination of layer and feature geometry type.",
+                     OGRToOGCGeomType(eGeomType), GetName(),
+                     OGRToOGCGeomType(eFlattenLayerGeomType));
+            m_eSetBadGeomTypeWarned.insert(eGeomType);
         }
     }
 
@@ -2149,50 +2152,46 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
     // if we have geometries with Z and M components
     if (m_nZFlag == 0 || m_nMFlag == 0)
     {
-        if (poGeom != nullptr)
+        bool bUpdateGpkgGeometryColumnsTable = false;
+        if (m_nZFlag == 0 && wkbHasZ(eGeomTypeIn))
         {
-            bool bUpdateGpkgGeometryColumnsTable = false;
-            const OGRwkbGeometryType eGeomType = poGeom->getGeometryType();
-            if (m_nZFlag == 0 && wkbHasZ(eGeomType))
-            {
-                if (eLayerGeomType != wkbUnknown && !wkbHasZ(eLayerGeomType))
-                {
-                    CPLError(
-                        CE_Warning, CPLE_AppDefined,
-                        "Layer '%s' has been declared with non-Z geometry type "
-                        "%s, but it does contain geometries with Z. Setting "
-                        "the Z=2 hint into gpkg_geometry_columns",
-                        GetName(),
-                        OGRToOGCGeomType(eLayerGeomType, true, true, true));
-                }
-                m_nZFlag = 2;
-                bUpdateGpkgGeometryColumnsTable = true;
-            }
-            if (m_nMFlag == 0 && wkbHasM(eGeomType))
+            if (eLayerGeomType != wkbUnknown && !wkbHasZ(eLayerGeomType))
             {
-                if (eLayerGeomType != wkbUnknown && !wkbHasM(eLayerGeomType))
-                {
-                    CPLError(
-                        CE_Warning, CPLE_AppDefined,
-                        "Layer '%s' has been declared with non-M geometry type "
-                        "%s, but it does contain geometries with M. Setting "
-                        "the M=2 hint into gpkg_geometry_columns",
-                        GetName(),
-                        OGRToOGCGeomType(eLayerGeomType, true, true, true));
-                }
-                m_nMFlag = 2;
-                bUpdateGpkgGeometryColumnsTable = true;
+                CPLError(
+                    CE_Warning, CPLE_AppDefined,
+                    "Layer '%s' has been declared with non-Z geometry type "
+                    "%s, but it does contain geometries with Z. Setting "
+                    "the Z=2 hint into gpkg_geometry_columns",
+                    GetName(),
+                    OGRToOGCGeomType(eLayerGeomType, true, true, true));
             }
-            if (bUpdateGpkgGeometryColumnsTable)
+            m_nZFlag = 2;
+            bUpdateGpkgGeometryColumnsTable = true;
+        }
+        if (m_nMFlag == 0 && wkbHasM(eGeomTypeIn))
+        {
+            if (eLayerGeomType != wkbUnknown && !wkbHasM(eLayerGeomType))
             {
-                /* Update gpkg_geometry_columns */
-                char *pszSQL = sqlite3_mprintf(
-                    "UPDATE gpkg_geometry_columns SET z = %d, m = %d WHERE "
-                    "table_name = '%q' AND column_name = '%q'",
-                    m_nZFlag, m_nMFlag, GetName(), GetGeometryColumn());
-                CPL_IGNORE_RET_VAL(SQLCommand(m_poDS->GetDB(), pszSQL));
-                sqlite3_free(pszSQL);
+                CPLError(
+                    CE_Warning, CPLE_AppDefined,
+                    "Layer '%s' has been declared with non-M geometry type "
+                    "%s, but it does contain geometries with M. Setting "
+                    "the M=2 hint into gpkg_geometry_columns",
+                    GetName(),
+                    OGRToOGCGeomType(eLayerGeomType, true, true, true));
             }
+            m_nMFlag = 2;
+            bUpdateGpkgGeometryColumnsTable = true;
+        }
+        if (bUpdateGpkgGeometryColumnsTable)
+        {
+            /* Update gpkg_geometry_columns */
+            char *pszSQL = sqlite3_mprintf(
+                "UPDATE gpkg_geometry_columns SET z = %d, m = %d WHERE "
+                "table_name = '%q' AND column_name = '%q'",
+                m_nZFlag, m_nMFlag, GetName(), GetGeometryColumn());
+            CPL_IGNORE_RET_VAL(SQLCommand(m_poDS->GetDB(), pszSQL));
+            sqlite3_free(pszSQL);
         }
     }
 }
@@ -2276,6 +2275,95 @@ static float rtreeValueUp(double d)
     return f;
 }
 
+/************************************************************************/
+/*                        UpdateExtentAndRTree()                        */
+/************************************************************************/
+
+// Update the layer extent and the spatial index with the envelope of the
+// (non-empty) geometry of the just inserted feature of id nFID.
+bool OGRGeoPackageTableLayer::UpdateExtentAndRTree(GIntBig nFID,
+                                                   const OGREnvelope &oEnv,
+                                                   bool bUpsert)
+{
+    UpdateExtent(&oEnv);
+
+    if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
+        HasSpatialIndex() && m_poDS->IsInTransaction())
+    {
+        m_nCountInsertInTransaction++;
+        if (m_nCountInsertInTransactionThreshold < 0)
+        {
+            m_nCountInsertInTransactionThreshold =
+                atoi(CPLGetConfigOption(
+                    "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
+        }
+        if (m_nCountInsertInTransaction ==
+            m_nCountInsertInTransactionThreshold)
+        {
+            StartDeferredSpatialIndexUpdate();
+        }
+        else if (!m_aoRTreeTriggersSQL.empty())
+        {
+            if (m_aoRTreeEntries.size() == 1000 * 1000)
+            {
+                if (!FlushPendingSpatialIndexUpdate())
+                    return false;
+            }
+            GPKGRTreeEntry sEntry;
+            sEntry.nId = nFID;
+            sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+            sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+            sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+            sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+            m_aoRTreeEntries.push_back(sEntry);
+        }
+    }
+    else if (!bUpsert && m_bAllowedRTreeThread &&
+             !m_bErrorDuringRTreeThread)
+    {
+        GPKGRTreeEntry sEntry;
+#ifdef DEBUG_VERBOSE
+        if (m_aoRTreeEntries.empty())
+            CPLDebug("GPKG",
+                     "Starting to fill m_aoRTreeEntries at "
+                     "FID " CPL_FRMT_GIB,
+                     nFID);
+#endif
+        sEntry.nId = nFID;
+        sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+        sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+        sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+        sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+        try
+        {
+            m_aoRTreeEntries.push_back(sEntry);
+            if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
+            {
+                m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
+                m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
+            }
+            if (!m_bThreadRTreeStarted &&
+                m_oQueueRTreeEntries.size() ==
+                    m_nRTreeBatchesBeforeStart)
+            {
+                StartAsyncRTree();
+            }
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLDebug("GPKG",
+                     "Memory allocation error regarding RTree "
+                     "structures. Falling back to slower method");
+            if (m_bThreadRTreeStarted)
+                CancelAsyncRTree();
+            else
+                m_bAllowedRTreeThread = false;
+        }
+    }
+
+    return true;
+}
+
 OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
                                                       bool bUpsert)
 {
@@ -2536,98 +2624,550 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
         {
             OGREnvelope oEnv;
             poGeom->getEnvelope(&oEnv);
-            UpdateExtent(&oEnv);
+            if (!UpdateExtentAndRTree(nFID, oEnv, bUpsert))
+                return OGRERR_FAILURE;
+        }
+    }
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    if (m_nTotalFeatureCount >= 0)
+        m_nTotalFeatureCount++;
+#endif
+
+    m_bContentChanged = true;
+
+    /* All done! */
+    return OGRERR_NONE;
+}
+
+OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
 
-            if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
-                HasSpatialIndex() && m_poDS->IsInTransaction())
+namespace
+{
+// Column of the Arrow batch bound to a parameter of the INSERT statement
+struct GPKGArrowColumn
+{
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    int iField = -1;  // OGR field index, or -1 for the FID/geometry column
+};
+}  // namespace
+
+static inline bool ArrowIsNull(const struct ArrowArray *psArray, size_t iRow)
+{
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+    return psArray->null_count != 0 && pabyValidity != nullptr &&
+           (pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) == 0;
+}
+
+template <class T>
+static inline T ArrowGetValue(const struct ArrowArray *psArray, size_t iRow)
+{
+    return static_cast<const T *>(
+        psArray->buffers[1])[iRow + static_cast<size_t>(psArray->offset)];
+}
+
+// Returns the pointer to and the size of a string or binary value
+template <class OffsetType>
+static inline const GByte *ArrowGetBinary(const struct ArrowArray *psArray,
+                                          size_t iRow, size_t &nSize)
+{
+    const OffsetType *panOffsets = static_cast<const OffsetType *>(
+                                       psArray->buffers[1]) +
+                                   iRow + static_cast<size_t>(psArray->offset);
+    nSize = static_cast<size_t>(panOffsets[1] - panOffsets[0]);
+    return static_cast<const GByte *>(psArray->buffers[2]) + panOffsets[0];
+}
+
+// Returns whether the Arrow column is tagged as a WKB geometry column
+static bool IsArrowWKBColumn(const struct ArrowSchema *psSchema)
+{
+    if (psSchema->metadata == nullptr)
+        return false;
+    const auto oMetadata = OGRParseArrowMetadata(psSchema->metadata);
+    const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+    return oIter != oMetadata.end() &&
+           (oIter->second == EXTENSION_NAME_OGC_WKB ||
+            oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+}
+
+// Returns whether the Arrow format can be directly bound to a column of type
+// eType
+static bool IsArrowFormatCompatibleOfFastWrite(const char *pszFormat,
+                                               OGRFieldType eType)
+{
+    if (pszFormat[0] == '\0' || pszFormat[1] != '\0')
+        return false;
+    switch (pszFormat[0])
+    {
+        case 'b':
+        case 'c':
+        case 'C':
+        case 's':
+        case 'S':
+        case 'i':
+            return eType == OFTInteger || eType == OFTInteger64 ||
+                   eType == OFTReal;
+        case 'I':
+        case 'l':
+            return eType == OFTInteger64 || eType == OFTReal;
+        case 'f':
+        case 'g':
+            return eType == OFTReal;
+        case 'u':
+        case 'U':
+            return eType == OFTString;
+        case 'z':
+        case 'Z':
+            return eType == OFTBinary;
+        default:
+            break;
+    }
+    return false;
+}
+
+// Write a batch of rows by binding directly the values of the Arrow columns
+// to a prepared INSERT statement, and converting WKB geometries to GeoPackage
+// blobs without going through OGRFeature and OGRGeometry.
+// Batches with columns that this does not handle (dates, lists, dictionaries,
+// fields with a width or a default value, etc.) are delegated to the
+// generic implementation.
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    if (!m_bFeatureDefnCompleted)
+        GetLayerDefn();
+    if (!m_poDS->GetUpdate() || strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children ||
+        schema->n_children == 0 || array->offset != 0 ||
+        array->null_count != 0 || m_iFIDAsRegularColumnIndex >= 0)
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    if (!pszFIDName || pszFIDName[0] == 0)
+        pszFIDName = DEFAULT_ARROW_FID_NAME;
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    // Map the Arrow columns to the ones of the table
+    GPKGArrowColumn oFIDColumn;
+    GPKGArrowColumn oGeomColumn;
+    std::vector<GPKGArrowColumn> aoFieldColumns;
+    std::vector<bool> abFieldBound(m_poFeatureDefn->GetFieldCount(), false);
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        const auto psChildSchema = schema->children[i];
+        const auto psChildArray = array->children[i];
+        if (psChildSchema->dictionary != nullptr ||
+            psChildSchema->n_children != 0 || psChildSchema->name == nullptr)
+        {
+            return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        }
+        const char *pszFormat = psChildSchema->format;
+        if (EQUAL(psChildSchema->name, pszFIDName))
+        {
+            if (oFIDColumn.psSchema != nullptr ||
+                !(strcmp(pszFormat, "i") == 0 || strcmp(pszFormat, "l") == 0))
             {
-                m_nCountInsertInTransaction++;
-                if (m_nCountInsertInTransactionThreshold < 0)
-                {
-                    m_nCountInsertInTransactionThreshold =
-                        atoi(CPLGetConfigOption(
-                            "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
-                }
-                if (m_nCountInsertInTransaction ==
-                    m_nCountInsertInTransactionThreshold)
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            oFIDColumn.psSchema = psChildSchema;
+            oFIDColumn.psArray = psChildArray;
+        }
+        else if (m_poFeatureDefn->GetGeomFieldCount() == 1 &&
+                 (EQUAL(psChildSchema->name, pszGeomFieldName) ||
+                  IsArrowWKBColumn(psChildSchema)))
+        {
+            if (oGeomColumn.psSchema != nullptr ||
+                !(strcmp(pszFormat, "z") == 0 || strcmp(pszFormat, "Z") == 0))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            oGeomColumn.psSchema = psChildSchema;
+            oGeomColumn.psArray = psChildArray;
+        }
+        else
+        {
+            // Columns with metadata may be extension types (geometry, JSON,
+            // ...) that the generic implementation knows how to handle.
+            const int iField =
+                psChildSchema->metadata == nullptr
+                    ? m_poFeatureDefn->GetFieldIndex(psChildSchema->name)
+                    : -1;
+            if (iField < 0 || abFieldBound[iField] ||
+                m_abGeneratedColumns[iField])
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(iField);
+            if (poFieldDefn->GetWidth() > 0 ||
+                !IsArrowFormatCompatibleOfFastWrite(pszFormat,
+                                                    poFieldDefn->GetType()))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            abFieldBound[iField] = true;
+            GPKGArrowColumn oColumn;
+            oColumn.psSchema = psChildSchema;
+            oColumn.psArray = psChildArray;
+            oColumn.iField = iField;
+            aoFieldColumns.push_back(oColumn);
+        }
+    }
+
+    // Fields not in the batch get the default value of the column from
+    // the database, whereas CreateFeature() would use the one of OGR.
+    for (int iField = 0; iField < m_poFeatureDefn->GetFieldCount(); ++iField)
+    {
+        if (!abFieldBound[iField] &&
+            m_poFeatureDefn->GetFieldDefn(iField)->GetDefault() != nullptr)
+        {
+            return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        }
+    }
+
+    if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return false;
+
+    CancelAsyncNextArrowArray();
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    // To maximize performance of insertion, disable feature count triggers
+    if (m_bOGRFeatureCountTriggersEnabled)
+    {
+        DisableFeatureCountTriggers();
+    }
+#endif
+
+    /* Build the INSERT statement */
+    std::string osSQL("INSERT INTO \"");
+    osSQL += SQLEscapeName(m_pszTableName);
+    osSQL += "\" (";
+    std::string osValues;
+    const auto AddColumn = [&osSQL, &osValues](const char *pszName)
+    {
+        if (!osValues.empty())
+        {
+            osSQL += ", ";
+            osValues += ", ";
+        }
+        osSQL += '"';
+        osSQL += SQLEscapeName(pszName);
+        osSQL += '"';
+        osValues += '?';
+    };
+    if (oFIDColumn.psSchema)
+    {
+        if (m_pszFidColumn == nullptr)
+            return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        AddColumn(m_pszFidColumn);
+    }
+    if (oGeomColumn.psSchema)
+        AddColumn(m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef());
+    for (const auto &oColumn : aoFieldColumns)
+        AddColumn(m_poFeatureDefn->GetFieldDefn(oColumn.iField)->GetNameRef());
+    osSQL += ") VALUES (";
+    osSQL += osValues;
+    osSQL += ')';
+
+    sqlite3 *hDB = m_poDS->GetDB();
+    sqlite3_stmt *hStmt = nullptr;
+    if (sqlite3_prepare_v2(hDB, osSQL.c_str(), -1, &hStmt, nullptr) !=
+        SQLITE_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to prepare SQL: %s - %s",
+                 osSQL.c_str(), sqlite3_errmsg(hDB));
+        return false;
+    }
+
+    bool bTransactionOK;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        bTransactionOK = StartTransaction() == OGRERR_NONE;
+    }
+
+    const bool bUseOGRGeometry =
+        m_sBinaryPrecision.nXYBitPrecision != INT_MIN ||
+        m_sBinaryPrecision.nZBitPrecision != INT_MIN ||
+        m_sBinaryPrecision.nMBitPrecision != INT_MIN;
+    int64_t nFIDNullCount = 0;
+    bool bRet = true;
+    const size_t nRows = static_cast<size_t>(array->length);
+    for (size_t iRow = 0; bRet && iRow < nRows; ++iRow)
+    {
+        int iCol = 1;
+        int err = SQLITE_OK;
+
+        const bool bHasFID =
+            oFIDColumn.psArray && !ArrowIsNull(oFIDColumn.psArray, iRow);
+        if (oFIDColumn.psArray)
+        {
+            if (!bHasFID)
+                err = sqlite3_bind_null(hStmt, iCol);
+            else if (oFIDColumn.psSchema->format[0] == 'i')
+                err = sqlite3_bind_int64(
+                    hStmt, iCol,
+                    ArrowGetValue<int32_t>(oFIDColumn.psArray, iRow));
+            else
+                err = sqlite3_bind_int64(
+                    hStmt, iCol,
+                    ArrowGetValue<int64_t>(oFIDColumn.psArray, iRow));
+            ++iCol;
+        }
+
+        bool bHasEnvelope = false;
+        OGREnvelope oEnv;
+        if (err == SQLITE_OK && oGeomColumn.psArray)
+        {
+            if (ArrowIsNull(oGeomColumn.psArray, iRow))
+            {
+                err = sqlite3_bind_null(hStmt, iCol);
+            }
+            else
+            {
+                size_t nWKBSize = 0;
+                const GByte *pabyWKB =
+                    oGeomColumn.psSchema->format[0] == 'z'
+                        ? ArrowGetBinary<int32_t>(oGeomColumn.psArray, iRow,
+                                                  nWKBSize)
+                        : ArrowGetBinary<int64_t>(oGeomColumn.psArray, iRow,
+                                                  nWKBSize);
+                size_t nGPKGSize = 0;
+                OGRwkbGeometryType eGeomType = wkbUnknown;
+                GByte *pabyGPKG =
+                    bUseOGRGeometry
+                        ? nullptr
+                        : GPkgGeometryFromWKB(pabyWKB, nWKBSize, m_iSrs,
+                                              eGeomType, oEnv, &nGPKGSize);
+                if (pabyGPKG)
                 {
-                    StartDeferredSpatialIndexUpdate();
+                    bHasEnvelope = true;
                 }
-                else if (!m_aoRTreeTriggersSQL.empty())
+                else
                 {
-                    if (m_aoRTreeEntries.size() == 1000 * 1000)
+                    // Empty geometries, curves, precision rounding, etc.
+                    OGRGeometry *poGeom = nullptr;
+                    if (OGRGeometryFactory::createFromWkb(
+                            pabyWKB, nullptr, &poGeom, nWKBSize) !=
+                        OGRERR_NONE)
                     {
-                        if (!FlushPendingSpatialIndexUpdate())
-                            return OGRERR_FAILURE;
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Cannot parse WKB geometry");
+                        bRet = false;
+                        break;
                     }
-                    GPKGRTreeEntry sEntry;
-                    sEntry.nId = nFID;
-                    sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                    sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                    sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                    sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                    m_aoRTreeEntries.push_back(sEntry);
-                }
-            }
-            else if (!bUpsert && m_bAllowedRTreeThread &&
-                     !m_bErrorDuringRTreeThread)
-            {
-                GPKGRTreeEntry sEntry;
-#ifdef DEBUG_VERBOSE
-                if (m_aoRTreeEntries.empty())
-                    CPLDebug("GPKG",
-                             "Starting to fill m_aoRTreeEntries at "
-                             "FID " CPL_FRMT_GIB,
-                             nFID);
-#endif
-                sEntry.nId = nFID;
-                sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                try
-                {
-                    m_aoRTreeEntries.push_back(sEntry);
-                    if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
+                    std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+                    eGeomType = poGeom->getGeometryType();
+                    pabyGPKG = GPkgGeometryFromOGR(poGeom, m_iSrs,
+                                                   &m_sBinaryPrecision,
+                                                   &nGPKGSize);
+                    if (!pabyGPKG)
                     {
-                        m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
-                        m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
+                        bRet = false;
+                        break;
                     }
-                    if (!m_bThreadRTreeStarted &&
-                        m_oQueueRTreeEntries.size() ==
-                            m_nRTreeBatchesBeforeStart)
+                    if (!poGeom->IsEmpty())
                     {
-                        StartAsyncRTree();
+                        poGeom->getEnvelope(&oEnv);
+                        bHasEnvelope = true;
                     }
+                    CreateGeometryExtensionIfNecessary(poGeom);
                 }
-                catch (const std::bad_alloc &)
+                CheckGeometryType(eGeomType);
+                err = sqlite3_bind_blob(hStmt, iCol, pabyGPKG,
+                                        static_cast<int>(nGPKGSize), CPLFree);
+            }
+            ++iCol;
+        }
+
+        for (const auto &oColumn : aoFieldColumns)
+        {
+            if (err != SQLITE_OK)
+                break;
+            const auto psChildArray = oColumn.psArray;
+            if (ArrowIsNull(psChildArray, iRow))
+            {
+                err = sqlite3_bind_null(hStmt, iCol++);
+                continue;
+            }
+            switch (oColumn.psSchema->format[0])
+            {
+                case 'b':
                 {
-                    CPLDebug("GPKG",
-                             "Memory allocation error regarding RTree "
-                             "structures. Falling back to slower method");
-                    if (m_bThreadRTreeStarted)
-                        CancelAsyncRTree();
-                    else
-                        m_bAllowedRTreeThread = false;
+                    const size_t nIdx =
+                        iRow + static_cast<size_t>(psChildArray->offset);
+                    const uint8_t *pabyData =
+                        static_cast<const uint8_t *>(psChildArray->buffers[1]);
+                    err = sqlite3_bind_int(
+                        hStmt, iCol, (pabyData[nIdx / 8] >> (nIdx % 8)) & 1);
+                    break;
+                }
+                case 'c':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol, ArrowGetValue<int8_t>(psChildArray, iRow));
+                    break;
+                case 'C':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol,
+                        ArrowGetValue<uint8_t>(psChildArray, iRow));
+                    break;
+                case 's':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol,
+                        ArrowGetValue<int16_t>(psChildArray, iRow));
+                    break;
+                case 'S':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol,
+                        ArrowGetValue<uint16_t>(psChildArray, iRow));
+                    break;
+                case 'i':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol,
+                        ArrowGetValue<int32_t>(psChildArray, iRow));
+                    break;
+                case 'I':
+                    err = sqlite3_bind_int64(
+                        hStmt, iCol,
+                        ArrowGetValue<uint32_t>(psChildArray, iRow));
+                    break;
+                case 'l':
+                    err = sqlite3_bind_int64(
+                        hStmt, iCol,
+                        ArrowGetValue<int64_t>(psChildArray, iRow));
+                    break;
+                case 'f':
+                    err = sqlite3_bind_double(
+                        hStmt, iCol, ArrowGetValue<float>(psChildArray, iRow));
+                    break;
+                case 'g':
+                    err = sqlite3_bind_double(
+                        hStmt, iCol, ArrowGetValue<double>(psChildArray, iRow));
+                    break;
+                case 'u':
+                case 'U':
+                {
+                    size_t nSize = 0;
+                    const GByte *pabyData =
+                        oColumn.psSchema->format[0] == 'u'
+                            ? ArrowGetBinary<int32_t>(psChildArray, iRow, nSize)
+                            : ArrowGetBinary<int64_t>(psChildArray, iRow,
+                                                      nSize);
+                    err = sqlite3_bind_text(
+                        hStmt, iCol, reinterpret_cast<const char *>(pabyData),
+                        static_cast<int>(nSize), SQLITE_STATIC);
+                    break;
+                }
+                default:
+                {
+                    size_t nSize = 0;
+                    const GByte *pabyData =
+                        oColumn.psSchema->format[0] == 'z'
+                            ? ArrowGetBinary<int32_t>(psChildArray, iRow, nSize)
+                            : ArrowGetBinary<int64_t>(psChildArray, iRow,
+                                                      nSize);
+                    err = sqlite3_bind_blob(hStmt, iCol, pabyData,
+                                            static_cast<int>(nSize),
+                                            SQLITE_STATIC);
+                    break;
                 }
             }
+            ++iCol;
         }
-    }
 
+        if (err != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "sqlite3_bind_xxx() failed");
+            bRet = false;
+            break;
+        }
+
+        err = sqlite3_step(hStmt);
+        if (!(err == SQLITE_OK || err == SQLITE_DONE))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "failed to execute insert : %s",
+                     sqlite3_errmsg(hDB) ? sqlite3_errmsg(hDB) : "");
+            bRet = false;
+            break;
+        }
+        sqlite3_reset(hStmt);
+        sqlite3_clear_bindings(hStmt);
+
+        const GIntBig nFID = sqlite3_last_insert_rowid(hDB);
+        if (bHasEnvelope && !UpdateExtentAndRTree(nFID, oEnv, false))
+        {
+            bRet = false;
+            break;
+        }
 #ifdef ENABLE_GPKG_OGR_CONTENTS
-    if (m_nTotalFeatureCount >= 0)
-        m_nTotalFeatureCount++;
+        if (m_nTotalFeatureCount >= 0)
+            m_nTotalFeatureCount++;
 #endif
 
+        // Return the FID of the created features into the FID column, as
+        // the generic implementation does.
+        if (oFIDColumn.psArray && !bHasFID)
+        {
+            auto psFIDArray =
+                const_cast<struct ArrowArray *>(oFIDColumn.psArray);
+            uint8_t *pabyValidity = static_cast<uint8_t *>(
+                const_cast<void *>(psFIDArray->buffers[0]));
+            const size_t nIdx = iRow + static_cast<size_t>(psFIDArray->offset);
+            if (oFIDColumn.psSchema->format[0] == 'i' &&
+                nFID > std::numeric_limits<int32_t>::max())
+            {
+                ++nFIDNullCount;
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "FID " CPL_FRMT_GIB
+                         " cannot be stored in FID array of type int32",
+                         nFID);
+                continue;
+            }
+            if (oFIDColumn.psSchema->format[0] == 'i')
+                static_cast<int32_t *>(const_cast<void *>(
+                    psFIDArray->buffers[1]))[nIdx] = static_cast<int32_t>(nFID);
+            else
+                static_cast<int64_t *>(
+                    const_cast<void *>(psFIDArray->buffers[1]))[nIdx] = nFID;
+            if (pabyValidity)
+                pabyValidity[nIdx / 8] |= static_cast<uint8_t>(1 << (nIdx % 8));
+        }
+    }
+    sqlite3_finalize(hStmt);
+
+    if (oFIDColumn.psArray && oFIDColumn.psArray->buffers[0])
+    {
+        const_cast<struct ArrowArray *>(oFIDColumn.psArray)->null_count =
+            nFIDNullCount;
+    }
+
     m_bContentChanged = true;
 
-    /* All done! */
-    return OGRERR_NONE;
-}
+    if (bTransactionOK)
+    {
+        if (bRet)
+            bRet = CommitTransaction() == OGRERR_NONE;
+        else
+            RollbackTransaction();
+    }
 
-OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
-{
-    return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
+    return bRet;
 }
 
 /************************************************************************/
@@ -3569,15 +4109,15 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 }
 
 /************************************************************************/
-/*                           GetNextFeature()                           */
+/*                        PrepareGetNextFeature()                       */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+bool OGRGeoPackageTableLayer::PrepareGetNextFeature()
 {
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
-        return nullptr;
+        return false;
 
     CancelAsyncNextArrowArray();
 
@@ -3586,8 +4126,19 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
         // Both are exclusive
         CreateSpatialIndexIfNecessary();
         if (!RunDeferredSpatialIndexUpdate())
-            return nullptr;
+            return false;
     }
+    return true;
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+{
+    if (!PrepareGetNextFeature())
+        return nullptr;
 
     OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
@@ -3597,6 +4148,26 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
     return poFeature;
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (!PrepareGetNextFeature())
+        return false;
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if (!GetNextFeatureInternal(&oFeature))
+        return false;
+    if (m_iFIDAsRegularColumnIndex >= 0)
+    {
+        oFeature.SetField(m_iFIDAsRegularColumnIndex, oFeature.GetFID());
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                        GetFeature()                                  */
 /************************************************************************/
@@ -8566,33 +9137,44 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
-    // We can use this optimized version only if there is no hole in FID
-    // numbering. That is min(fid) == 1 and max(fid) == m_nTotalFeatureCount
-    if (m_nIsCompatOfOptimizedGetNextArrowArray < 0)
+    // We can use this optimized version only if the FID numbering is dense
+    // enough, since batches are read by ranges of nMaxBatchSize FIDs (batches
+    // may thus contain less than nMaxBatchSize features if there are holes).
+    // That is max(fid) - min(fid) + 1 <= 2 * m_nTotalFeatureCount.
+    // The FID range is re-evaluated at each new iteration, since the layer
+    // may have been modified in between.
+    if (m_nIsCompatOfOptimizedGetNextArrowArray < 0 ||
+        !m_bGetNextArrowArrayCalledSinceResetReading)
     {
         m_nIsCompatOfOptimizedGetNextArrowArray = FALSE;
         const auto nTotalFeatureCount = GetTotalFeatureCount();
-        if (nTotalFeatureCount < 0)
+        if (nTotalFeatureCount <= 0)
             return GetNextArrowArrayAsynchronous(stream, out_array);
+        GIntBig nMaxFID;
         {
             char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMaxFID != nTotalFeatureCount)
+            if (err != OGRERR_NONE ||
+                nMaxFID > std::numeric_limits<GIntBig>::max() / 2)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        GIntBig nMinFID;
         {
             char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMinFID != 1)
+            if (err != OGRERR_NONE || nMinFID < 0 || nMinFID > nMaxFID ||
+                nMaxFID - nMinFID >= 2 * nTotalFeatureCount)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
         m_nIsCompatOfOptimizedGetNextArrowArray = TRUE;
+        m_iNextFIDForArrowArray = nMinFID - 1;
+        m_nMaxFIDForArrowArray = nMaxFID;
     }
 
     m_bGetNextArrowArrayCalledSinceResetReading = true;
@@ -8602,58 +9184,88 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
         m_aosArrowArrayStreamOptions);
 
-    // Fetch the answer from a potentially queued asynchronous task
-    if (!m_oQueueArrowArrayPrefetchTasks.empty())
+    const auto GetThreadsAvailable = []()
     {
-        const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
-        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
-        m_oQueueArrowArrayPrefetchTasks.pop();
+        const char *pszMaxThreads =
+            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+        if (pszMaxThreads == nullptr)
+            return std::min(4, CPLGetNumCPUs());
+        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+            return CPLGetNumCPUs();
+        else
+            return atoi(pszMaxThreads);
+    };
 
-        // Wait for thread to be ready
+    // Loop until we get a non-empty batch, or reach the end of the FID range
+    while (true)
+    {
+        // Fetch the answer from a potentially queued asynchronous task
+        while (!m_oQueueArrowArrayPrefetchTasks.empty())
         {
-            std::unique_lock<std::mutex> oLock(task->m_oMutex);
-            while (!task->m_bArrayReady)
+            const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
+            auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+            m_oQueueArrowArrayPrefetchTasks.pop();
+
+            // Wait for thread to be ready
             {
-                task->m_oCV.wait(oLock);
+                std::unique_lock<std::mutex> oLock(task->m_oMutex);
+                while (!task->m_bArrayReady)
+                {
+                    task->m_oCV.wait(oLock);
+                }
+                task->m_bArrayReady = false;
             }
-            task->m_bArrayReady = false;
-        }
-        if (!task->m_osErrorMsg.empty())
-            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                     task->m_osErrorMsg.c_str());
+            if (!task->m_osErrorMsg.empty())
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         task->m_osErrorMsg.c_str());
 
-        const auto stopThread = [&task]()
-        {
+            const auto stopThread = [&task]()
             {
-                std::lock_guard oLock(task->m_oMutex);
-                task->m_bStop = true;
-                task->m_oCV.notify_one();
+                {
+                    std::lock_guard oLock(task->m_oMutex);
+                    task->m_bStop = true;
+                    task->m_oCV.notify_one();
+                }
+                if (task->m_oThread.joinable())
+                    task->m_oThread.join();
+            };
+
+            if (task->m_iStartShapeId != m_iNextFIDForArrowArray)
+            {
+                // Should not normally happen, unless the user messes with
+                // GetNextFeature()
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Worker thread task has not expected m_iStartShapeId "
+                         "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
+                         task->m_iStartShapeId, m_iNextFIDForArrowArray);
+                if (task->m_psArrowArray->release)
+                    task->m_psArrowArray->release(task->m_psArrowArray.get());
+
+                stopThread();
+                break;
             }
-            if (task->m_oThread.joinable())
-                task->m_oThread.join();
-        };
 
-        if (task->m_iStartShapeId != m_iNextShapeId)
-        {
-            // Should not normally happen, unless the user messes with
-            // GetNextFeature()
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Worker thread task has not expected m_iStartShapeId "
-                     "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
-                     task->m_iStartShapeId, m_iNextShapeId);
-            if (task->m_psArrowArray->release)
-                task->m_psArrowArray->release(task->m_psArrowArray.get());
+            // An empty array without error means that the FID range of the
+            // task was a hole in the FID numbering.
+            const bool bEmptyRange = task->m_psArrowArray->release == nullptr;
+            if (bEmptyRange && (!task->m_osErrorMsg.empty() ||
+                                task->m_bMemoryLimitReached))
+            {
+                stopThread();
+                break;
+            }
 
-            stopThread();
-        }
-        else if (task->m_psArrowArray->release)
-        {
-            m_iNextShapeId += task->m_psArrowArray->length;
+            m_iNextFIDForArrowArray += nMaxBatchSize;
+            if (!bEmptyRange)
+            {
+                m_iNextShapeId += task->m_psArrowArray->length;
 
-            // Transfer the task ArrowArray to the client array
-            memcpy(out_array, task->m_psArrowArray.get(),
-                   sizeof(struct ArrowArray));
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+                // Transfer the task ArrowArray to the client array
+                memcpy(out_array, task->m_psArrowArray.get(),
+                       sizeof(struct ArrowArray));
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+            }
 
             if (task->m_bMemoryLimitReached)
             {
@@ -8665,12 +9277,13 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             // Are the records still available for reading beyond the current
             // queued tasks ? If so, recycle this task to read them
             else if (task->m_iStartShapeId +
-                         static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
-                     m_nTotalFeatureCount)
+                         static_cast<GIntBig>(nTasks) * nMaxBatchSize <
+                     m_nMaxFIDForArrowArray)
             {
                 task->m_iStartShapeId +=
                     static_cast<GIntBig>(nTasks) * nMaxBatchSize;
-                task->m_poLayer->m_iNextShapeId = task->m_iStartShapeId;
+                task->m_poLayer->m_iNextFIDForArrowArray =
+                    task->m_iStartShapeId;
                 try
                 {
                     // Wake-up thread with new task
@@ -8680,154 +9293,152 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                         task->m_oCV.notify_one();
                     }
                     m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
-                    return 0;
                 }
                 catch (const std::exception &e)
                 {
                     CPLError(CE_Failure, CPLE_AppDefined,
                              "Cannot start worker thread: %s", e.what());
+                    stopThread();
                 }
             }
             else
             {
                 stopThread();
-                return 0;
             }
+            if (!bEmptyRange)
+                return 0;
         }
 
-        stopThread();
-    }
-
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
-    // Start asynchronous tasks to prefetch the next ArrowArray
-    if (m_poDS->GetAccess() == GA_ReadOnly &&
-        m_oQueueArrowArrayPrefetchTasks.empty() &&
-        m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
-            m_nTotalFeatureCount &&
-        sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
-        CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
-    {
-        const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
-            DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
-                         nMaxBatchSize),
-            GetThreadsAvailable()));
-        CPLDebug("GPKG", "Using %d threads", nMaxTasks);
-        GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
-        oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
-        oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
-        for (int iTask = 0; iTask < nMaxTasks; ++iTask)
-        {
-            auto task = std::make_unique<ArrowArrayPrefetchTask>();
-            task->m_iStartShapeId =
-                m_iNextShapeId +
-                static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
-            task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
-            if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+        // Start asynchronous tasks to prefetch the next ArrowArray
+        if (m_poDS->GetAccess() == GA_ReadOnly &&
+            m_oQueueArrowArrayPrefetchTasks.empty() &&
+            m_iNextFIDForArrowArray + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
+                m_nMaxFIDForArrowArray &&
+            sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
+            CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
+        {
+            const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
+                DIV_ROUND_UP(m_nMaxFIDForArrowArray - nMaxBatchSize -
+                                 m_iNextFIDForArrowArray,
+                             nMaxBatchSize),
+                GetThreadsAvailable()));
+            CPLDebug("GPKG", "Using %d threads", nMaxTasks);
+            GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
+            oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
+            oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+            for (int iTask = 0; iTask < nMaxTasks; ++iTask)
             {
-                break;
-            }
-            auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
-                task->m_poDS->GetLayerByName(GetName()));
-            if (poOtherLayer == nullptr ||
-                poOtherLayer->GetLayerDefn()->GetFieldCount() !=
-                    m_poFeatureDefn->GetFieldCount())
-            {
-                break;
-            }
-
-            // Install query logging callback
-            if (m_poDS->pfnQueryLoggerFunc)
-            {
-                task->m_poDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
-                                                 m_poDS->poQueryLoggerArg);
-            }
+                auto task = std::make_unique<ArrowArrayPrefetchTask>();
+                task->m_iStartShapeId =
+                    m_iNextFIDForArrowArray +
+                    static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
+                task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
+                if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+                {
+                    break;
+                }
+                auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
+                    task->m_poDS->GetLayerByName(GetName()));
+                if (poOtherLayer == nullptr ||
+                    poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                        m_poFeatureDefn->GetFieldCount())
+                {
+                    break;
+                }
 
-            task->m_poLayer = poOtherLayer;
-            task->m_psArrowArray = std::make_unique<struct ArrowArray>();
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+                // Install query logging callback
+                if (m_poDS->pfnQueryLoggerFunc)
+                {
+                    task->m_poDS->SetQueryLoggerFunc(
+                        m_poDS->pfnQueryLoggerFunc, m_poDS->poQueryLoggerArg);
+                }
 
-            poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
-            poOtherLayer->m_aosArrowArrayStreamOptions =
-                m_aosArrowArrayStreamOptions;
-            auto poOtherFDefn = poOtherLayer->GetLayerDefn();
-            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
-            {
-                poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
-            }
-            for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
-            {
-                poOtherFDefn->GetFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
-            }
+                task->m_poLayer = poOtherLayer;
+                task->m_psArrowArray = std::make_unique<struct ArrowArray>();
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+
+                poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
+                poOtherLayer->m_nMaxFIDForArrowArray = m_nMaxFIDForArrowArray;
+                poOtherLayer->m_aosArrowArrayStreamOptions =
+                    m_aosArrowArrayStreamOptions;
+                auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+                for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+                }
+                for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+                }
 
-            poOtherLayer->m_iNextShapeId = task->m_iStartShapeId;
+                poOtherLayer->m_iNextFIDForArrowArray = task->m_iStartShapeId;
 
-            auto taskPtr = task.get();
-            auto taskRunner = [taskPtr]()
-            {
-                std::unique_lock oLock(taskPtr->m_oMutex);
-                do
+                auto taskPtr = task.get();
+                auto taskRunner = [taskPtr]()
                 {
-                    taskPtr->m_bFetchRows = false;
-                    taskPtr->m_poLayer->GetNextArrowArrayInternal(
-                        taskPtr->m_psArrowArray.get(), taskPtr->m_osErrorMsg,
-                        taskPtr->m_bMemoryLimitReached);
-                    taskPtr->m_bArrayReady = true;
-                    taskPtr->m_oCV.notify_one();
-                    if (taskPtr->m_bMemoryLimitReached)
-                        break;
-                    // cppcheck-suppress knownConditionTrueFalse
-                    // Coverity apparently is confused by the fact that we
-                    // use unique_lock here to guard access for m_bStop whereas
-                    // in other places we use a lock_guard, but there's nothing
-                    // wrong.
-                    // coverity[missing_lock:FALSE]
-                    while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                    std::unique_lock oLock(taskPtr->m_oMutex);
+                    do
                     {
-                        taskPtr->m_oCV.wait(oLock);
-                    }
-                } while (!taskPtr->m_bStop);
-            };
+                        taskPtr->m_bFetchRows = false;
+                        taskPtr->m_poLayer->GetNextArrowArrayInternal(
+                            taskPtr->m_psArrowArray.get(),
+                            taskPtr->m_osErrorMsg,
+                            taskPtr->m_bMemoryLimitReached);
+                        taskPtr->m_bArrayReady = true;
+                        taskPtr->m_oCV.notify_one();
+                        if (taskPtr->m_bMemoryLimitReached)
+                            break;
+                        // cppcheck-suppress knownConditionTrueFalse
+                        // Coverity apparently is confused by the fact that we
+                        // use unique_lock here to guard access for m_bStop
+                        // whereas in other places we use a lock_guard, but
+                        // there's nothing wrong.
+                        // coverity[missing_lock:FALSE]
+                        while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                        {
+                            taskPtr->m_oCV.wait(oLock);
+                        }
+                    } while (!taskPtr->m_bStop);
+                };
 
-            task->m_bFetchRows = true;
-            try
-            {
-                task->m_oThread = std::thread(taskRunner);
-            }
-            catch (const std::exception &e)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot start worker thread: %s", e.what());
-                break;
+                task->m_bFetchRows = true;
+                try
+                {
+                    task->m_oThread = std::thread(taskRunner);
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot start worker thread: %s", e.what());
+                    break;
+                }
+                m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
             }
-            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
         }
-    }
 
-    std::string osErrorMsg;
-    bool bMemoryLimitReached = false;
-    int ret =
-        GetNextArrowArrayInternal(out_array, osErrorMsg, bMemoryLimitReached);
-    if (!osErrorMsg.empty())
-        CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
-    if (bMemoryLimitReached)
-    {
-        CancelAsyncNextArrowArray();
-        m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        std::string osErrorMsg;
+        bool bMemoryLimitReached = false;
+        int ret = GetNextArrowArrayInternal(out_array, osErrorMsg,
+                                            bMemoryLimitReached);
+        if (!osErrorMsg.empty())
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
+        if (bMemoryLimitReached)
+        {
+            CancelAsyncNextArrowArray();
+            m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        }
+        // Go on with the next FID range if this one was a hole
+        else if (ret == 0 && out_array->release == nullptr &&
+                 osErrorMsg.empty() &&
+                 m_iNextFIDForArrowArray < m_nMaxFIDForArrowArray)
+        {
+            continue;
+        }
+        return ret;
     }
-    return ret;
 }
 
 /************************************************************************/
@@ -8841,7 +9452,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     bMemoryLimitReached = false;
     memset(out_array, 0, sizeof(*out_array));
 
-    if (m_iNextShapeId >= m_nTotalFeatureCount)
+    if (m_iNextFIDForArrowArray >= m_nMaxFIDForArrowArray)
     {
         return 0;
     }
@@ -8917,9 +9528,9 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += "\" WHERE \"";
     osSQL += SQLEscapeName(m_pszFidColumn);
     osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += std::to_string(m_iNextFIDForArrowArray + 1);
     osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
+    osSQL += std::to_string(m_iNextFIDForArrowArray +
                             sFillArrowArray.psHelper->m_nMaxBatchSize);
 
     // CPLDebug("GPKG", "%s", osSQL.c_str());
@@ -8956,6 +9567,10 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
 
     m_iNextShapeId += sFillArrowArray.nCountRows;
+    // When the memory limit is reached, the optimized GetNextArrowArray()
+    // is no longer used, and reading resumes from m_iNextShapeId.
+    if (!bMemoryLimitReached)
+        m_iNextFIDForArrowArray += sFillArrowArray.psHelper->m_nMaxBatchSize;
 
     return 0;
 }
@@ -30,6 +30,7 @@
 #include "ogr_p.h"
 #include "ogr_wkb.h"
 #include "sqlite/ogrsqlitebase.h"
+#include <cmath>
 #include <limits>
 
 /* Requirement 20: A GeoPackage SHALL store feature table geometries */
@@ -365,6 +366,82 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
     return pabyWkb;
 }
 
+/* Build a GeoPackage geometry blob directly from an ISO WKB geometry, without
+ * instantiating an OGRGeometry. Only non-empty Point, LineString, Polygon
+ * and Multi* geometries are handled: nullptr is returned otherwise, and the
+ * caller must then go through GPkgGeometryFromOGR(). */
+GByte *GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                           OGRwkbGeometryType &eGeomType,
+                           OGREnvelope &sEnvelope, size_t *pnGPKGLen)
+{
+    bool bNeedSwap = false;
+    uint32_t nType = 0;
+    if (!OGRWKBGetGeomType(pabyWKB, nWKBSize, bNeedSwap, nType))
+        return nullptr;
+    // Reject the legacy 2.5D and the PostGIS EWKB flags, as well as
+    // geometry types that may require a GeoPackage extension.
+    const uint32_t nFlatType = nType % 1000;
+    if (nType >= 4000 || nFlatType < wkbPoint || nFlatType > wkbMultiPolygon)
+        return nullptr;
+    if (OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eGeomType) !=
+        OGRERR_NONE)
+        return nullptr;
+
+    const bool bPoint = wkbFlatten(eGeomType) == wkbPoint;
+    const bool bHasZ = CPL_TO_BOOL(wkbHasZ(eGeomType));
+    OGREnvelope3D sEnvelope3D;
+    if (!OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope3D) ||
+        !sEnvelope3D.IsInit() || std::isnan(sEnvelope3D.MinX) ||
+        std::isnan(sEnvelope3D.MinY))
+    {
+        return nullptr;
+    }
+    sEnvelope = sEnvelope3D;
+
+    /* Header has 8 bytes, and extra space for bounds, except for points */
+    const int iDims = bHasZ ? 3 : 2;
+    const size_t nHeaderLen = 2 + 1 + 1 + 4 + (bPoint ? 0 : 8 * 2 * iDims);
+    if (nWKBSize > static_cast<size_t>(std::numeric_limits<int>::max()) -
+                       nHeaderLen)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "too big geometry blob");
+        return nullptr;
+    }
+    const size_t nGPKGLen = nHeaderLen + nWKBSize;
+    GByte *pabyGPKG = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nGPKGLen));
+    if (!pabyGPKG)
+        return nullptr;
+    *pnGPKGLen = nGPKGLen;
+
+    /* Magic and version */
+    pabyGPKG[0] = 0x47;
+    pabyGPKG[1] = 0x50;
+    pabyGPKG[2] = 0;
+
+    /* Flags: envelope type and byte order of the header */
+    const GByte byEnv = bPoint ? 0 : (bHasZ ? 2 : 1);
+    pabyGPKG[3] = static_cast<GByte>((byEnv << 1) | CPL_IS_LSB);
+
+    memcpy(pabyGPKG + 4, &iSrsId, 4);
+
+    if (!bPoint)
+    {
+        double *padPtr = reinterpret_cast<double *>(pabyGPKG + 8);
+        padPtr[0] = sEnvelope3D.MinX;
+        padPtr[1] = sEnvelope3D.MaxX;
+        padPtr[2] = sEnvelope3D.MinY;
+        padPtr[3] = sEnvelope3D.MaxY;
+        if (bHasZ)
+        {
+            padPtr[4] = sEnvelope3D.MinZ;
+            padPtr[5] = sEnvelope3D.MaxZ;
+        }
+    }
+
+    memcpy(pabyGPKG + nHeaderLen, pabyWKB, nWKBSize);
+    return pabyGPKG;
+}
+
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader)
 {
@@ -513,6 +590,51 @@ OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
     return poGeom;
 }
 
+/************************************************************************/
+/*                         GPkgGeometryToOGR()                          */
+/************************************************************************/
+
+/* Variant of the above that imports the WKB into poGeomToReuse, whose
+ * ownership is then transferred to the returned geometry, if it is of the
+ * same type as the encoded geometry. This avoids reallocating the geometry,
+ * its sub-geometries and point arrays when reading sequentially features
+ * with geometries of the same type. */
+OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
+                               OGRSpatialReference *poSrs,
+                               std::unique_ptr<OGRGeometry> &poGeomToReuse)
+{
+    if (!poGeomToReuse)
+        return GPkgGeometryToOGR(pabyGpkg, nGpkgLen, poSrs);
+
+    CPLAssert(pabyGpkg != nullptr);
+
+    GPkgHeader oHeader;
+    if (GPkgHeaderFromWKB(pabyGpkg, nGpkgLen, &oHeader) != OGRERR_NONE)
+        return nullptr;
+
+    const GByte *pabyWkb = pabyGpkg + oHeader.nHeaderLen;
+    const size_t nWkbLen = nGpkgLen - oHeader.nHeaderLen;
+
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if (nWkbLen >= 5 &&
+        OGRReadWKBGeometryType(pabyWkb, wkbVariantOldOgc, &eGeomType) ==
+            OGRERR_NONE &&
+        eGeomType == poGeomToReuse->getGeometryType())
+    {
+        size_t nBytesConsumed = 0;
+        if (poGeomToReuse->importFromWkb(pabyWkb, nWkbLen, wkbVariantOldOgc,
+                                         nBytesConsumed) != OGRERR_NONE)
+        {
+            poGeomToReuse.reset();
+            return nullptr;
+        }
+        poGeomToReuse->assignSpatialReference(poSrs);
+        return poGeomToReuse.release();
+    }
+
+    return GPkgGeometryToOGR(pabyGpkg, nGpkgLen, poSrs);
+}
+
 /************************************************************************/
 /*                     OGRGeoPackageGetHeader()                         */
 /************************************************************************/
@@ -30,6 +30,8 @@
 #include "ogrsf_frmts.h"
 #include <sqlite3.h>
 
+#include <memory>
+
 #ifndef OGR_GEOPACKAGEUTILITY_H_INCLUDED
 #define OGR_GEOPACKAGEUTILITY_H_INCLUDED
 
@@ -61,8 +63,14 @@ OGRwkbGeometryType GPkgGeometryTypeToWKB(const char *pszGpkgType, bool bHasZ,
 GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
                            const OGRGeomCoordinateBinaryPrecision *psPrecision,
                            size_t *pnWkbLen);
+GByte *GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                           OGRwkbGeometryType &eGeomType,
+                           OGREnvelope &sEnvelope, size_t *pnGPKGLen);
 OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
                                OGRSpatialReference *poSrs);
+OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
+                               OGRSpatialReference *poSrs,
+                               std::unique_ptr<OGRGeometry> &poGeomToReuse);
 
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader);
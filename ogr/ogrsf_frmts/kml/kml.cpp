@@ -29,6 +29,7 @@
 #include "kmlnode.h"
 #include "kml.h"
 
+#include <climits>
 #include <cstring>
 #include <cstdio>
 #include <exception>
@@ -43,10 +44,14 @@
 
 constexpr int PARSER_BUF_SIZE = 8192;
 
+// Size above which streaming mode is enabled by default
+constexpr vsi_l_offset STREAMING_MIN_FILE_SIZE = 10 * 1024 * 1024;
+
 KML::KML()
     : poTrunk_(nullptr), nNumLayers_(-1), papoLayers_(nullptr), nDepth_(0),
       validity(KML_VALIDITY_UNKNOWN), pKMLFile_(nullptr), poCurrent_(nullptr),
-      oCurrentParser(nullptr), nDataHandlerCounter(0), nWithoutEventCounter(0)
+      oCurrentParser(nullptr), nDataHandlerCounter(0), nWithoutEventCounter(0),
+      bStreaming_(false)
 {
 }
 
@@ -88,10 +93,40 @@ bool KML::parse()
         poCurrent_ = nullptr;
     }
 
+    // In streaming mode, the content of each Placemark is released once
+    // it has been classified, so that memory usage does not depend on the
+    // size of the file.
+    const char *pszStreaming = CPLGetConfigOption("KML_STREAMING", "AUTO");
+    if (EQUAL(pszStreaming, "AUTO"))
+    {
+        VSIFSeekL(pKMLFile_, 0, SEEK_END);
+        bStreaming_ = VSIFTellL(pKMLFile_) > STREAMING_MIN_FILE_SIZE;
+        VSIRewindL(pKMLFile_);
+    }
+    else
+    {
+        bStreaming_ = CPLTestBool(pszStreaming);
+    }
+    if (bStreaming_)
+    {
+        // Byte offsets cannot be used to re-parse a Placemark alone in
+        // UTF-16 files
+        GByte abyBOM[2] = {0, 0};
+        if (VSIFReadL(abyBOM, 1, 2, pKMLFile_) == 2 &&
+            ((abyBOM[0] == 0xFF && abyBOM[1] == 0xFE) ||
+             (abyBOM[0] == 0xFE && abyBOM[1] == 0xFF)))
+        {
+            bStreaming_ = false;
+        }
+        VSIRewindL(pKMLFile_);
+    }
+    sEncoding_.clear();
+
     XML_Parser oParser = OGRCreateExpatXMLParser();
     XML_SetUserData(oParser, this);
     XML_SetElementHandler(oParser, startElement, endElement);
     XML_SetCharacterDataHandler(oParser, dataHandler);
+    XML_SetXmlDeclHandler(oParser, xmlDeclHandler);
     oCurrentParser = oParser;
     nWithoutEventCounter = 0;
 
@@ -259,6 +294,11 @@ void XMLCALL KML::startElement(void *pUserData, const char *pszName,
             KMLNode *poMynew = new KMLNode();
             poMynew->setName(pszName);
             poMynew->setLevel(poKML->nDepth_);
+            if (poKML->bStreaming_ && strcmp(pszName, "Placemark") == 0)
+            {
+                poMynew->setFileOffset(static_cast<vsi_l_offset>(
+                    XML_GetCurrentByteIndex(poKML->oCurrentParser)));
+            }
 
             for (int i = 0; ppszAttr[i]; i += 2)
             {
@@ -508,6 +548,21 @@ void XMLCALL KML::endElement(void *pUserData, const char *pszName)
             {
                 if (poKML->poCurrent_ != nullptr)
                     poKML->poCurrent_->addChildren(poTmp);
+
+                // In streaming mode, only keep the classification of the
+                // Placemark. Its content is parsed again by getFeature().
+                // (empty element tags have a zero byte count: nothing to
+                // save)
+                const int nByteCount =
+                    XML_GetCurrentByteCount(poKML->oCurrentParser);
+                if (poKML->bStreaming_ && poKML->poCurrent_ != nullptr &&
+                    poTmp->getName().compare("Placemark") == 0 &&
+                    nByteCount > 0 && poTmp->classify(poKML))
+                {
+                    poTmp->releaseSubTree(static_cast<vsi_l_offset>(
+                        XML_GetCurrentByteIndex(poKML->oCurrentParser) +
+                        nByteCount));
+                }
             }
         }
         else if (poKML->poCurrent_ != nullptr)
@@ -563,6 +618,19 @@ void XMLCALL KML::dataHandler(void *pUserData, const char *pszData, int nLen)
     }
 }
 
+void XMLCALL KML::xmlDeclHandler(void *pUserData, const char * /* pszVersion */,
+                                 const char *pszEncoding, int /* nStandalone */)
+{
+    KML *poKML = static_cast<KML *>(pUserData);
+
+    if (pszEncoding != nullptr)
+    {
+        poKML->sEncoding_ = pszEncoding;
+        if (STARTS_WITH_CI(pszEncoding, "UTF-16"))
+            poKML->bStreaming_ = false;
+    }
+}
+
 bool KML::isValid()
 {
     checkValidity();
@@ -690,7 +758,115 @@ Feature *KML::getFeature(std::size_t nNum, int &nLastAsked, int &nLastCount)
     if (poCurrent_ == nullptr)
         return nullptr;
 
-    return poCurrent_->getFeature(nNum, nLastAsked, nLastCount);
+    return poCurrent_->getFeature(this, nNum, nLastAsked, nLastCount);
+}
+
+/************************************************************************/
+/*                           parsePlacemark()                           */
+/************************************************************************/
+
+// Parse again a Placemark whose content has been released in streaming mode
+std::unique_ptr<KMLNode> KML::parsePlacemark(vsi_l_offset nOffset,
+                                             vsi_l_offset nSize)
+{
+    if (nullptr == pKMLFile_)
+        return nullptr;
+
+    std::string osXML;
+    if (!sEncoding_.empty())
+    {
+        osXML = "<?xml version=\"1.0\" encoding=\"";
+        osXML += sEncoding_;
+        osXML += "\"?>";
+    }
+    const size_t nHeaderSize = osXML.size();
+    if (nSize > static_cast<vsi_l_offset>(INT_MAX - nHeaderSize))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too large Placemark");
+        return nullptr;
+    }
+    try
+    {
+        osXML.resize(nHeaderSize + static_cast<size_t>(nSize));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate " CPL_FRMT_GUIB " bytes for Placemark",
+                 static_cast<GUIntBig>(nSize));
+        return nullptr;
+    }
+    if (VSIFSeekL(pKMLFile_, nOffset, SEEK_SET) != 0 ||
+        VSIFReadL(&osXML[nHeaderSize], 1, static_cast<size_t>(nSize),
+                  pKMLFile_) != static_cast<size_t>(nSize))
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read Placemark at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nOffset));
+        return nullptr;
+    }
+
+    // The parser callbacks build the tree from the state of this object,
+    // which must be preserved for the layers.
+    KMLNode *poTrunkBackup = poTrunk_;
+    KMLNode *poCurrentBackup = poCurrent_;
+    const unsigned int nDepthBackup = nDepth_;
+    const bool bStreamingBackup = bStreaming_;
+    poTrunk_ = nullptr;
+    poCurrent_ = nullptr;
+    nDepth_ = 0;
+    bStreaming_ = false;
+
+    XML_Parser oParser = OGRCreateExpatXMLParser();
+    XML_SetUserData(oParser, this);
+    XML_SetElementHandler(oParser, startElement, endElement);
+    XML_SetCharacterDataHandler(oParser, dataHandler);
+    oCurrentParser = oParser;
+    nDataHandlerCounter = 0;
+
+    bool bError = false;
+    if (XML_Parse(oParser, osXML.data(), static_cast<int>(osXML.size()),
+                  TRUE) == XML_STATUS_ERROR)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "XML parsing of Placemark at offset " CPL_FRMT_GUIB
+                 " failed : %s",
+                 static_cast<GUIntBig>(nOffset),
+                 XML_ErrorString(XML_GetErrorCode(oParser)));
+        bError = true;
+    }
+    XML_ParserFree(oParser);
+
+    std::unique_ptr<KMLNode> poPlacemark;
+    if (bError)
+    {
+        // Release the partially built tree
+        if (poCurrent_ != nullptr)
+        {
+            while (poCurrent_)
+            {
+                KMLNode *poTemp = poCurrent_->getParent();
+                delete poCurrent_;
+                poCurrent_ = poTemp;
+            }
+        }
+        else
+        {
+            delete poTrunk_;
+        }
+    }
+    else
+    {
+        poPlacemark.reset(poTrunk_);
+    }
+    poTrunk_ = poTrunkBackup;
+    poCurrent_ = poCurrentBackup;
+    nDepth_ = nDepthBackup;
+    bStreaming_ = bStreamingBackup;
+
+    if (poPlacemark && !poPlacemark->classify(this))
+        poPlacemark.reset();
+    return poPlacemark;
 }
 
 void KML::unregisterLayerIfMatchingThisNode(KMLNode *poNode)
@@ -37,6 +37,7 @@
 
 // std
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -82,6 +83,9 @@ class KML
     int getNumFeatures();
     Feature *getFeature(std::size_t nNum, int &nLastAsked, int &nLastCount);
 
+    std::unique_ptr<KMLNode> parsePlacemark(vsi_l_offset nOffset,
+                                            vsi_l_offset nSize);
+
     void unregisterLayerIfMatchingThisNode(KMLNode *poNode);
 
   protected:
@@ -93,6 +97,8 @@ class KML
     static void XMLCALL dataHandler(void *, const char *, int);
     static void XMLCALL dataHandlerValidate(void *, const char *, int);
     static void XMLCALL endElement(void *, const char *);
+    static void XMLCALL xmlDeclHandler(void *, const char *, const char *,
+                                       int);
 
     // Trunk of KMLnodes.
     KMLNode *poTrunk_;
@@ -117,6 +123,12 @@ class KML
     XML_Parser oCurrentParser;
     int nDataHandlerCounter;
     int nWithoutEventCounter;
+
+    // Whether the content of Placemarks is released once they have been
+    // classified, and parsed again from the file when the feature is read.
+    bool bStreaming_;
+    // Encoding declared in the XML header.
+    std::string sEncoding_;
 };
 
 #endif  // HAVE_EXPAT
@@ -120,7 +120,7 @@ KMLNode::KMLNode()
       pvsContent_(new std::vector<std::string>),
       pvoAttributes_(new std::vector<Attribute *>), poParent_(nullptr),
       nLevel_(0), eType_(Unknown), b25D_(false), nLayerNumber_(-1),
-      nNumFeatures_(-1)
+      nNumFeatures_(-1), nFileOffset_(0), nFileSize_(0)
 {
 }
 
@@ -351,6 +351,24 @@ bool KMLNode::hasOnlyEmpty() const
     return true;
 }
 
+void KMLNode::setFileOffset(vsi_l_offset nOffset)
+{
+    nFileOffset_ = nOffset;
+}
+
+// Once the node has been classified, only keep what is needed to walk the
+// structure of the document. getFeature() parses the element again from
+// the file.
+void KMLNode::releaseSubTree(vsi_l_offset nFileEnd)
+{
+    nFileSize_ = nFileEnd - nFileOffset_;
+
+    for (auto *poChild : *pvpoChildren_)
+        delete poChild;
+    kml_nodes_t().swap(*pvpoChildren_);
+    kml_content_t().swap(*pvsContent_);
+}
+
 void KMLNode::setType(Nodetype oNotet)
 {
     eType_ = oNotet;
@@ -707,7 +725,8 @@ OGRGeometry *KMLNode::getGeometry(Nodetype eType)
     return poGeom;
 }
 
-Feature *KMLNode::getFeature(std::size_t nNum, int &nLastAsked, int &nLastCount)
+Feature *KMLNode::getFeature(KML *poKML, std::size_t nNum, int &nLastAsked,
+                             int &nLastCount)
 {
     if (nNum >= getNumFeatures())
         return nullptr;
@@ -747,6 +766,17 @@ Feature *KMLNode::getFeature(std::size_t nNum, int &nLastAsked, int &nLastCount)
     if (poFeat == nullptr)
         return nullptr;
 
+    // In streaming mode, the content of the Placemark must be parsed again
+    std::unique_ptr<KMLNode> poParsedFeat;
+    if (poFeat->nFileSize_ > 0)
+    {
+        poParsedFeat =
+            poKML->parsePlacemark(poFeat->nFileOffset_, poFeat->nFileSize_);
+        if (!poParsedFeat)
+            return nullptr;
+        poFeat = poParsedFeat.get();
+    }
+
     // Create a feature structure
     Feature *psReturn = new Feature;
     // Build up the name
@@ -85,7 +85,11 @@ class KMLNode
     std::string getDescriptionElement() const;
 
     std::size_t getNumFeatures();
-    Feature *getFeature(std::size_t nNum, int &nLastAsked, int &nLastCount);
+    Feature *getFeature(KML *poKML, std::size_t nNum, int &nLastAsked,
+                        int &nLastCount);
+
+    void setFileOffset(vsi_l_offset nOffset);
+    void releaseSubTree(vsi_l_offset nFileEnd);
 
     OGRGeometry *getGeometry(Nodetype eType = Unknown);
 
@@ -114,6 +118,11 @@ class KMLNode
     int nLayerNumber_;
     int nNumFeatures_;
 
+    // Range of the element in the file when its subtree has been released
+    // in streaming mode (nFileSize_ == 0 otherwise).
+    vsi_l_offset nFileOffset_;
+    vsi_l_offset nFileSize_;
+
     void unregisterLayerIfMatchingThisNode(KML *poKML);
 };
 
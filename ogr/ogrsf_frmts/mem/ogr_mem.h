@@ -31,9 +31,12 @@
 #ifndef OGRMEM_H_INCLUDED
 #define OGRMEM_H_INCLUDED
 
+#include "cpl_quad_tree.h"
 #include "ogrsf_frmts.h"
 
 #include <map>
+#include <memory>
+#include <vector>
 
 /************************************************************************/
 /*                             OGRMemLayer                              */
@@ -172,6 +175,114 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
     }
 };
 
+/************************************************************************/
+/*                           OGRMemArrowLayer                           */
+/************************************************************************/
+
+/** Append-only in-memory layer storing its content as Arrow record batches
+ * (STORAGE=ARROW layer creation option).
+ *
+ * Batches written with WriteArrowBatch() whose schema matches the one of
+ * the layer are stored as they are, and GetArrowStream() returns views of
+ * the stored batches without copying them. Features written with
+ * CreateFeature() are accumulated and converted into batches. A row
+ * oriented copy, used by GetNextFeature() and GetFeature(), and a spatial
+ * index are only built when first needed.
+ */
+class OGRMemArrowLayer final : public OGRLayer
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemArrowLayer)
+
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    GDALDataset *m_poDS = nullptr;
+    std::string m_osFIDColumn{};
+    bool m_bAdvertizeUTF8 = false;
+
+    //! Stored batches, all following the schema returned by GetSchema()
+    std::vector<std::shared_ptr<struct ArrowArray>> m_apoBatches{};
+    GIntBig m_nTotalFeatureCount = 0;
+    GIntBig m_nNextFID = 0;
+
+    //! Features written with CreateFeature() and not yet in m_apoBatches
+    std::unique_ptr<OGRMemLayer> m_poStagingLayer{};
+
+    //! Row oriented copy of the first m_nRowCacheBatches batches
+    std::unique_ptr<OGRMemLayer> m_poRowCache{};
+    size_t m_nRowCacheBatches = 0;
+
+    //! Spatial index on geometry field m_iIndexedGeomField of the first
+    //! m_nIndexedBatches batches
+    CPLQuadTree *m_hSpatialIndex = nullptr;
+    int m_iIndexedGeomField = -1;
+    size_t m_nIndexedBatches = 0;
+    std::vector<GIntBig> m_anIndexedFIDs{};
+
+    //! FIDs matching the spatial filter, for the current read
+    bool m_bCandidatesComputed = false;
+    std::vector<GIntBig> m_anCandidateFIDs{};
+    size_t m_iNextCandidate = 0;
+
+    std::unique_ptr<OGRMemLayer> CreateRowLayer() const;
+    const char *GetArrowFIDName() const;
+    bool GetSchema(struct ArrowSchema *out_schema) const;
+    bool FlushStagingLayer();
+    bool AppendBatch(struct ArrowArray *array);
+    bool CanStoreDirectly(const struct ArrowSchema *schema,
+                          const struct ArrowArray *array,
+                          CSLConstList papszOptions) const;
+    bool BuildRowCache();
+    bool BuildSpatialIndex(int iGeomField);
+    OGRFeature *TranslateFeature(OGRFeature *poRowFeature) const;
+    bool CanUseFastArrowStream(CSLConstList papszOptions) const;
+
+    static int GetArrowSchemaFromStream(struct ArrowArrayStream *stream,
+                                        struct ArrowSchema *out_schema);
+    static int GetNextArrowArrayFromStream(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array);
+    static const char *GetLastErrorFromStream(struct ArrowArrayStream *);
+    static void ReleaseStreamPrivate(struct ArrowArrayStream *stream);
+
+  public:
+    OGRMemArrowLayer(GDALDataset *poDS, const char *pszName,
+                     const OGRGeomFieldDefn *poGeomFieldDefn,
+                     const char *pszFIDColumn, bool bAdvertizeUTF8);
+    ~OGRMemArrowLayer() override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRFeature *GetFeature(GIntBig nFID) override;
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    GIntBig GetFeatureCount(int bForce) override;
+
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poFeatureDefn;
+    }
+
+    const char *GetFIDColumn() override
+    {
+        return m_osFIDColumn.c_str();
+    }
+
+    OGRErr CreateField(const OGRFieldDefn *poField,
+                       int bApproxOK = TRUE) override;
+    OGRErr CreateGeomField(const OGRGeomFieldDefn *poGeomField,
+                           int bApproxOK = TRUE) override;
+
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
+    int TestCapability(const char *) override;
+
+    GDALDataset *GetDataset() override
+    {
+        return m_poDS;
+    }
+};
+
 /************************************************************************/
 /*                           OGRMemDataSource                           */
 /************************************************************************/
@@ -180,7 +291,7 @@ class OGRMemDataSource CPL_NON_FINAL : public OGRDataSource
 {
     CPL_DISALLOW_COPY_ASSIGN(OGRMemDataSource)
 
-    OGRMemLayer **papoLayers;
+    OGRLayer **papoLayers;
     int nLayers;
 
     char *pszName;
@@ -0,0 +1,823 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRMemArrowLayer class.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_mem.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "ogr_recordbatch.h"
+#include "ogr_wkb.h"
+#include "ogrsf_frmts.h"
+
+// Number of features accumulated by CreateFeature() before they are
+// converted into a batch.
+constexpr GIntBig MAX_STAGED_FEATURES = 65536;
+
+namespace
+{
+
+/************************************************************************/
+/*                            ArrowArrayView                            */
+/************************************************************************/
+
+// Private data of an ArrowArray that references the buffers of a stored
+// batch, which is kept alive as long as the view (or one of its children)
+// has not been released.
+struct ArrowArrayView
+{
+    std::shared_ptr<struct ArrowArray> m_poBatch{};
+};
+
+void ReleaseArrowArrayView(struct ArrowArray *array)
+{
+    for (int64_t i = 0; i < array->n_children; ++i)
+    {
+        if (array->children[i]->release)
+            array->children[i]->release(array->children[i]);
+        delete array->children[i];
+    }
+    delete[] array->children;
+    if (array->dictionary)
+    {
+        if (array->dictionary->release)
+            array->dictionary->release(array->dictionary);
+        delete array->dictionary;
+    }
+    delete static_cast<ArrowArrayView *>(array->private_data);
+    array->private_data = nullptr;
+    array->release = nullptr;
+}
+
+void MakeArrowArrayView(const struct ArrowArray *src, struct ArrowArray *dst,
+                        const std::shared_ptr<struct ArrowArray> &poBatch)
+{
+    // Buffers are shared with the source array: only the structures are
+    // allocated.
+    *dst = *src;
+    dst->children = nullptr;
+    if (src->n_children > 0)
+    {
+        dst->children = new struct ArrowArray *[src->n_children];
+        for (int64_t i = 0; i < src->n_children; ++i)
+        {
+            dst->children[i] = new struct ArrowArray;
+            MakeArrowArrayView(src->children[i], dst->children[i], poBatch);
+        }
+    }
+    dst->dictionary = nullptr;
+    if (src->dictionary)
+    {
+        dst->dictionary = new struct ArrowArray;
+        MakeArrowArrayView(src->dictionary, dst->dictionary, poBatch);
+    }
+    dst->private_data = new ArrowArrayView{poBatch};
+    dst->release = ReleaseArrowArrayView;
+}
+
+/************************************************************************/
+/*                        AreSameArrowSchemas()                         */
+/************************************************************************/
+
+bool AreSameArrowSchemas(const struct ArrowSchema *a,
+                         const struct ArrowSchema *b)
+{
+    if (strcmp(a->format, b->format) != 0 ||
+        strcmp(a->name ? a->name : "", b->name ? b->name : "") != 0 ||
+        a->n_children != b->n_children ||
+        (a->dictionary == nullptr) != (b->dictionary == nullptr))
+    {
+        return false;
+    }
+    for (int64_t i = 0; i < a->n_children; ++i)
+    {
+        if (!AreSameArrowSchemas(a->children[i], b->children[i]))
+            return false;
+    }
+    return a->dictionary == nullptr ||
+           AreSameArrowSchemas(a->dictionary, b->dictionary);
+}
+
+/************************************************************************/
+/*                       OGRMemArrowStreamPrivate                       */
+/************************************************************************/
+
+struct OGRMemArrowStreamPrivate
+{
+    const OGRMemArrowLayer *m_poLayer = nullptr;
+    std::vector<std::shared_ptr<struct ArrowArray>> m_apoBatches{};
+    size_t m_iNextBatch = 0;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                          OGRMemArrowLayer()                          */
+/************************************************************************/
+
+OGRMemArrowLayer::OGRMemArrowLayer(GDALDataset *poDS, const char *pszName,
+                                   const OGRGeomFieldDefn *poGeomFieldDefn,
+                                   const char *pszFIDColumn,
+                                   bool bAdvertizeUTF8)
+    : m_poFeatureDefn(new OGRFeatureDefn(pszName)), m_poDS(poDS),
+      m_osFIDColumn(pszFIDColumn), m_bAdvertizeUTF8(bAdvertizeUTF8)
+{
+    m_poFeatureDefn->Reference();
+
+    SetDescription(m_poFeatureDefn->GetName());
+    m_poFeatureDefn->SetGeomType(wkbNone);
+    if (poGeomFieldDefn)
+        m_poFeatureDefn->AddGeomFieldDefn(poGeomFieldDefn);
+
+    m_poFeatureDefn->Seal(/* bSealFields = */ true);
+}
+
+/************************************************************************/
+/*                         ~OGRMemArrowLayer()                          */
+/************************************************************************/
+
+OGRMemArrowLayer::~OGRMemArrowLayer()
+{
+    if (m_hSpatialIndex)
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+    m_poFeatureDefn->Release();
+}
+
+/************************************************************************/
+/*                           CreateRowLayer()                           */
+/************************************************************************/
+
+// Creates an OGRMemLayer with the same fields as this layer.
+std::unique_ptr<OGRMemLayer> OGRMemArrowLayer::CreateRowLayer() const
+{
+    auto poLayer = std::make_unique<OGRMemLayer>(m_poFeatureDefn->GetName(),
+                                                 nullptr, wkbNone);
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+        CPL_IGNORE_RET_VAL(
+            poLayer->CreateGeomField(m_poFeatureDefn->GetGeomFieldDefn(i)));
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+        CPL_IGNORE_RET_VAL(
+            poLayer->CreateField(m_poFeatureDefn->GetFieldDefn(i)));
+    poLayer->SetFIDColumn(m_osFIDColumn.c_str());
+    return poLayer;
+}
+
+/************************************************************************/
+/*                             GetSchema()                              */
+/************************************************************************/
+
+// Returns the schema of the stored batches, which is the one of the
+// default OGRLayer::GetArrowStream() implementation.
+bool OGRMemArrowLayer::GetSchema(struct ArrowSchema *out_schema) const
+{
+    memset(out_schema, 0, sizeof(*out_schema));
+    auto poLayer = CreateRowLayer();
+    struct ArrowArrayStream stream;
+    const char *const apszOptions[] = {"INCLUDE_FID=YES", nullptr};
+    if (!poLayer->GetArrowStream(&stream, apszOptions))
+        return false;
+    const bool bRet = stream.get_schema(&stream, out_schema) == 0;
+    stream.release(&stream);
+    return bRet;
+}
+
+/************************************************************************/
+/*                            AppendBatch()                             */
+/************************************************************************/
+
+// Takes ownership of array, which must follow the schema of GetSchema().
+bool OGRMemArrowLayer::AppendBatch(struct ArrowArray *array)
+{
+    auto poBatch = std::shared_ptr<struct ArrowArray>(
+        new struct ArrowArray(*array),
+        [](struct ArrowArray *psArray)
+        {
+            if (psArray->release)
+                psArray->release(psArray);
+            delete psArray;
+        });
+    array->release = nullptr;
+
+    if (poBatch->length > 0)
+    {
+        // FIDs are increasing within a batch
+        const struct ArrowArray *psFIDArray = poBatch->children[0];
+        const int64_t *panFIDs =
+            static_cast<const int64_t *>(psFIDArray->buffers[1]) +
+            psFIDArray->offset + poBatch->offset;
+        m_nNextFID = std::max(m_nNextFID, static_cast<GIntBig>(
+                                              panFIDs[poBatch->length - 1]) +
+                                              1);
+    }
+    m_nTotalFeatureCount += poBatch->length;
+    m_apoBatches.push_back(std::move(poBatch));
+    return true;
+}
+
+/************************************************************************/
+/*                         FlushStagingLayer()                          */
+/************************************************************************/
+
+// Converts the features accumulated by CreateFeature() into batches.
+bool OGRMemArrowLayer::FlushStagingLayer()
+{
+    if (!m_poStagingLayer)
+        return true;
+    auto poStagingLayer = std::move(m_poStagingLayer);
+
+    struct ArrowArrayStream stream;
+    const char *const apszOptions[] = {"INCLUDE_FID=YES", nullptr};
+    if (!poStagingLayer->GetArrowStream(&stream, apszOptions))
+        return false;
+    bool bRet = true;
+    while (true)
+    {
+        struct ArrowArray array;
+        if (stream.get_next(&stream, &array) != 0)
+        {
+            bRet = false;
+            break;
+        }
+        if (array.release == nullptr)
+            break;
+        AppendBatch(&array);
+    }
+    stream.release(&stream);
+    return bRet;
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRMemArrowLayer::ResetReading()
+{
+    if (m_poRowCache)
+        m_poRowCache->ResetReading();
+    m_bCandidatesComputed = false;
+    m_anCandidateFIDs.clear();
+    m_iNextCandidate = 0;
+}
+
+/************************************************************************/
+/*                           BuildRowCache()                            */
+/************************************************************************/
+
+// Converts the batches that are not yet in m_poRowCache into features.
+bool OGRMemArrowLayer::BuildRowCache()
+{
+    if (!FlushStagingLayer())
+        return false;
+    if (!m_poRowCache)
+        m_poRowCache = CreateRowLayer();
+    if (m_nRowCacheBatches == m_apoBatches.size())
+        return true;
+
+    struct ArrowSchema schema;
+    if (!GetSchema(&schema))
+        return false;
+    bool bRet = true;
+    for (; m_nRowCacheBatches < m_apoBatches.size(); ++m_nRowCacheBatches)
+    {
+        const auto &poBatch = m_apoBatches[m_nRowCacheBatches];
+        struct ArrowArray array;
+        MakeArrowArrayView(poBatch.get(), &array, poBatch);
+        bRet = m_poRowCache->WriteArrowBatch(&schema, &array);
+        if (array.release)
+            array.release(&array);
+        if (!bRet)
+            break;
+    }
+    schema.release(&schema);
+    return bRet;
+}
+
+/************************************************************************/
+/*                         BuildSpatialIndex()                          */
+/************************************************************************/
+
+// Indexes the bounding boxes of the WKB geometries of the stored batches.
+bool OGRMemArrowLayer::BuildSpatialIndex(int iGeomField)
+{
+    if (m_hSpatialIndex && m_iIndexedGeomField == iGeomField &&
+        m_nIndexedBatches == m_apoBatches.size())
+    {
+        return true;
+    }
+    if (m_hSpatialIndex)
+    {
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+        m_hSpatialIndex = nullptr;
+    }
+    m_anIndexedFIDs.clear();
+
+    const int iChild = 1 + m_poFeatureDefn->GetFieldCount() + iGeomField;
+    std::vector<OGREnvelope> asEnvelopes;
+    OGREnvelope sGlobalEnvelope;
+    for (const auto &poBatch : m_apoBatches)
+    {
+        const struct ArrowArray *psFIDArray = poBatch->children[0];
+        const struct ArrowArray *psGeomArray = poBatch->children[iChild];
+        const int64_t *panFIDs =
+            static_cast<const int64_t *>(psFIDArray->buffers[1]) +
+            psFIDArray->offset + poBatch->offset;
+        const GByte *pabyValidity =
+            static_cast<const GByte *>(psGeomArray->buffers[0]);
+        const int32_t *panOffsets =
+            static_cast<const int32_t *>(psGeomArray->buffers[1]);
+        const GByte *pabyData =
+            static_cast<const GByte *>(psGeomArray->buffers[2]);
+        for (int64_t iRow = 0; iRow < poBatch->length; ++iRow)
+        {
+            const int64_t iIdx = iRow + psGeomArray->offset + poBatch->offset;
+            if (pabyValidity &&
+                (pabyValidity[iIdx / 8] & (1 << (iIdx % 8))) == 0)
+            {
+                continue;
+            }
+            OGREnvelope sEnvelope;
+            if (OGRWKBGetBoundingBox(
+                    pabyData + panOffsets[iIdx],
+                    static_cast<size_t>(panOffsets[iIdx + 1] -
+                                        panOffsets[iIdx]),
+                    sEnvelope))
+            {
+                sGlobalEnvelope.Merge(sEnvelope);
+                asEnvelopes.push_back(sEnvelope);
+                m_anIndexedFIDs.push_back(panFIDs[iRow]);
+            }
+        }
+    }
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalEnvelope.IsInit() ? sGlobalEnvelope.MinX : 0;
+    sGlobalBounds.miny = sGlobalEnvelope.IsInit() ? sGlobalEnvelope.MinY : 0;
+    sGlobalBounds.maxx = sGlobalEnvelope.IsInit() ? sGlobalEnvelope.MaxX : 0;
+    sGlobalBounds.maxy = sGlobalEnvelope.IsInit() ? sGlobalEnvelope.MaxY : 0;
+    m_hSpatialIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLQuadTreeSetMaxDepth(m_hSpatialIndex,
+                           CPLQuadTreeGetAdvisedMaxDepth(
+                               static_cast<int>(std::min<size_t>(
+                                   asEnvelopes.size(),
+                                   std::numeric_limits<int>::max()))));
+    for (size_t i = 0; i < asEnvelopes.size(); ++i)
+    {
+        CPLRectObj sBounds;
+        sBounds.minx = asEnvelopes[i].MinX;
+        sBounds.miny = asEnvelopes[i].MinY;
+        sBounds.maxx = asEnvelopes[i].MaxX;
+        sBounds.maxy = asEnvelopes[i].MaxY;
+        CPLQuadTreeInsertWithBounds(
+            m_hSpatialIndex,
+            reinterpret_cast<void *>(static_cast<uintptr_t>(i)), &sBounds);
+    }
+    CPLDebug("Mem", "Spatial index built on %d features of layer %s",
+             static_cast<int>(asEnvelopes.size()), GetDescription());
+
+    m_iIndexedGeomField = iGeomField;
+    m_nIndexedBatches = m_apoBatches.size();
+    return true;
+}
+
+/************************************************************************/
+/*                          TranslateFeature()                          */
+/************************************************************************/
+
+// Makes a feature of the row cache a feature of this layer.
+OGRFeature *OGRMemArrowLayer::TranslateFeature(OGRFeature *poRowFeature) const
+{
+    // Both layer definitions are identical.
+    poRowFeature->SetFDefnUnsafe(m_poFeatureDefn);
+    return poRowFeature;
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRMemArrowLayer::GetNextFeature()
+{
+    if (!BuildRowCache())
+        return nullptr;
+
+    if (m_poFilterGeom == nullptr)
+    {
+        while (OGRFeature *poRowFeature = m_poRowCache->GetNextFeature())
+        {
+            auto poFeature = TranslateFeature(poRowFeature);
+            if (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature))
+            {
+                m_nFeaturesRead++;
+                return poFeature;
+            }
+            delete poFeature;
+        }
+        return nullptr;
+    }
+
+    if (!m_bCandidatesComputed)
+    {
+        m_bCandidatesComputed = true;
+        m_iNextCandidate = 0;
+        m_anCandidateFIDs.clear();
+        if (!BuildSpatialIndex(m_iGeomFieldFilter))
+            return nullptr;
+
+        CPLRectObj sAoi;
+        sAoi.minx = m_sFilterEnvelope.MinX;
+        sAoi.miny = m_sFilterEnvelope.MinY;
+        sAoi.maxx = m_sFilterEnvelope.MaxX;
+        sAoi.maxy = m_sFilterEnvelope.MaxY;
+        int nCount = 0;
+        void **pahResults = CPLQuadTreeSearch(m_hSpatialIndex, &sAoi, &nCount);
+        m_anCandidateFIDs.reserve(nCount);
+        for (int i = 0; i < nCount; ++i)
+        {
+            m_anCandidateFIDs.push_back(
+                m_anIndexedFIDs[reinterpret_cast<uintptr_t>(pahResults[i])]);
+        }
+        CPLFree(pahResults);
+        // Return features in the order they were written
+        std::sort(m_anCandidateFIDs.begin(), m_anCandidateFIDs.end());
+    }
+
+    while (m_iNextCandidate < m_anCandidateFIDs.size())
+    {
+        OGRFeature *poRowFeature =
+            m_poRowCache->GetFeature(m_anCandidateFIDs[m_iNextCandidate++]);
+        if (poRowFeature == nullptr)
+            continue;
+        auto poFeature = TranslateFeature(poRowFeature);
+        if (FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter)) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
+        {
+            m_nFeaturesRead++;
+            return poFeature;
+        }
+        delete poFeature;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                             GetFeature()                             */
+/************************************************************************/
+
+OGRFeature *OGRMemArrowLayer::GetFeature(GIntBig nFID)
+{
+    if (!BuildRowCache())
+        return nullptr;
+    OGRFeature *poRowFeature = m_poRowCache->GetFeature(nFID);
+    return poRowFeature ? TranslateFeature(poRowFeature) : nullptr;
+}
+
+/************************************************************************/
+/*                           ICreateFeature()                           */
+/************************************************************************/
+
+OGRErr OGRMemArrowLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    // Storage is append-only: FIDs must be increasing.
+    if (poFeature->GetFID() == OGRNullFID || poFeature->GetFID() < m_nNextFID)
+        poFeature->SetFID(m_nNextFID);
+    m_nNextFID = poFeature->GetFID() + 1;
+
+    if (!m_poStagingLayer)
+        m_poStagingLayer = CreateRowLayer();
+    OGRErr eErr = m_poStagingLayer->CreateFeature(poFeature);
+    if (eErr == OGRERR_NONE &&
+        m_poStagingLayer->GetFeatureCount(FALSE) >= MAX_STAGED_FEATURES &&
+        !FlushStagingLayer())
+    {
+        eErr = OGRERR_FAILURE;
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRMemArrowLayer::GetFeatureCount(int bForce)
+{
+    if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr)
+        return OGRLayer::GetFeatureCount(bForce);
+    return m_nTotalFeatureCount +
+           (m_poStagingLayer ? m_poStagingLayer->GetFeatureCount(FALSE) : 0);
+}
+
+/************************************************************************/
+/*                            CreateField()                             */
+/************************************************************************/
+
+OGRErr OGRMemArrowLayer::CreateField(const OGRFieldDefn *poField,
+                                     int /* bApproxOK */)
+{
+    if (!m_apoBatches.empty() || m_poStagingLayer)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "CreateField() not supported on a STORAGE=ARROW layer once "
+                 "features have been written");
+        return OGRERR_FAILURE;
+    }
+    whileUnsealing(m_poFeatureDefn)->AddFieldDefn(poField);
+    m_poRowCache.reset();
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          CreateGeomField()                           */
+/************************************************************************/
+
+OGRErr OGRMemArrowLayer::CreateGeomField(const OGRGeomFieldDefn *poGeomField,
+                                         int /* bApproxOK */)
+{
+    if (!m_apoBatches.empty() || m_poStagingLayer)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "CreateGeomField() not supported on a STORAGE=ARROW layer "
+                 "once features have been written");
+        return OGRERR_FAILURE;
+    }
+    whileUnsealing(m_poFeatureDefn)->AddGeomFieldDefn(poGeomField);
+    m_poRowCache.reset();
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          CanStoreDirectly()                          */
+/************************************************************************/
+
+// Returns whether a batch passed to WriteArrowBatch() can be stored
+// without conversion.
+bool OGRMemArrowLayer::CanStoreDirectly(const struct ArrowSchema *schema,
+                                        const struct ArrowArray *array,
+                                        CSLConstList papszOptions) const
+{
+    struct ArrowSchema sLayerSchema;
+    if (!GetSchema(&sLayerSchema))
+        return false;
+    bool bRet = AreSameArrowSchemas(schema, &sLayerSchema) &&
+                array->n_children == schema->n_children &&
+                array->offset == 0 && array->length > 0;
+    if (bRet)
+    {
+        for (const auto &[pszKey, pszValue] :
+             cpl::IterateNameValue(papszOptions))
+        {
+            if (EQUAL(pszKey, "FID"))
+            {
+                bRet = strcmp(pszValue, sLayerSchema.children[0]->name) == 0;
+            }
+            else if (EQUAL(pszKey, "GEOMETRY_NAME"))
+            {
+                bRet = m_poFeatureDefn->GetGeomFieldCount() == 1 &&
+                       strcmp(pszValue,
+                              sLayerSchema.children[sLayerSchema.n_children - 1]
+                                  ->name) == 0;
+            }
+            else if (!EQUAL(pszKey, "IF_FID_NOT_PRESERVED"))
+            {
+                bRet = false;
+            }
+            if (!bRet)
+                break;
+        }
+    }
+    sLayerSchema.release(&sLayerSchema);
+    if (!bRet)
+        return false;
+
+    // FIDs must be non-null and increasing
+    const struct ArrowArray *psFIDArray = array->children[0];
+    if (psFIDArray->null_count != 0)
+        return false;
+    const int64_t *panFIDs =
+        static_cast<const int64_t *>(psFIDArray->buffers[1]) +
+        psFIDArray->offset;
+    if (panFIDs[0] < m_nNextFID)
+        return false;
+    for (int64_t i = 1; i < array->length; ++i)
+    {
+        if (panFIDs[i] <= panFIDs[i - 1])
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRMemArrowLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                       struct ArrowArray *array,
+                                       CSLConstList papszOptions)
+{
+    if (CanStoreDirectly(schema, array, papszOptions))
+    {
+        // Preserve the order of writes
+        if (!FlushStagingLayer())
+            return false;
+        return AppendBatch(array);
+    }
+    CPLDebug("Mem", "WriteArrowBatch(): batch converted to the layer schema");
+    return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+}
+
+/************************************************************************/
+/*                       CanUseFastArrowStream()                        */
+/************************************************************************/
+
+bool OGRMemArrowLayer::CanUseFastArrowStream(CSLConstList papszOptions) const
+{
+    if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr)
+        return false;
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+    {
+        if (m_poFeatureDefn->GetFieldDefn(i)->IsIgnored())
+            return false;
+    }
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        if (m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored())
+            return false;
+    }
+
+    for (const auto &[pszKey, pszValue] : cpl::IterateNameValue(papszOptions))
+    {
+        if (EQUAL(pszKey, "INCLUDE_FID"))
+        {
+            if (!CPLTestBool(pszValue))
+                return false;
+        }
+        else if (EQUAL(pszKey, "MAX_FEATURES_IN_BATCH"))
+        {
+            const GIntBig nMaxBatchSize = CPLAtoGIntBig(pszValue);
+            for (const auto &poBatch : m_apoBatches)
+            {
+                if (poBatch->length > nMaxBatchSize)
+                    return false;
+            }
+        }
+        else if (EQUAL(pszKey, "GEOMETRY_ENCODING"))
+        {
+            if (!EQUAL(pszValue, "WKB"))
+                return false;
+        }
+        else if (EQUAL(pszKey, "GEOMETRY_METADATA_ENCODING"))
+        {
+            if (!EQUAL(pszValue, "OGC"))
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          GetArrowStream()                            */
+/************************************************************************/
+
+/** Returns views of the stored batches when there is no filter, ignored
+ * field or option that would require to transform them, and otherwise
+ * falls back to the generic implementation.
+ *
+ * Contrary to the generic implementation, several streams can be active
+ * at the same time. A stream returns the batches that were stored when it
+ * was created.
+ */
+bool OGRMemArrowLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                      CSLConstList papszOptions)
+{
+    if (!FlushStagingLayer())
+        return false;
+    if (!CanUseFastArrowStream(papszOptions))
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+
+    memset(out_stream, 0, sizeof(*out_stream));
+    auto psPrivate = new OGRMemArrowStreamPrivate();
+    psPrivate->m_poLayer = this;
+    psPrivate->m_apoBatches = m_apoBatches;
+    out_stream->private_data = psPrivate;
+    out_stream->get_schema = GetArrowSchemaFromStream;
+    out_stream->get_next = GetNextArrowArrayFromStream;
+    out_stream->get_last_error = GetLastErrorFromStream;
+    out_stream->release = ReleaseStreamPrivate;
+    return true;
+}
+
+/************************************************************************/
+/*                      GetArrowSchemaFromStream()                      */
+/************************************************************************/
+
+int OGRMemArrowLayer::GetArrowSchemaFromStream(struct ArrowArrayStream *stream,
+                                               struct ArrowSchema *out_schema)
+{
+    const auto psPrivate =
+        static_cast<const OGRMemArrowStreamPrivate *>(stream->private_data);
+    return psPrivate->m_poLayer->GetSchema(out_schema) ? 0 : EIO;
+}
+
+/************************************************************************/
+/*                    GetNextArrowArrayFromStream()                     */
+/************************************************************************/
+
+int OGRMemArrowLayer::GetNextArrowArrayFromStream(
+    struct ArrowArrayStream *stream, struct ArrowArray *out_array)
+{
+    auto psPrivate =
+        static_cast<OGRMemArrowStreamPrivate *>(stream->private_data);
+    if (psPrivate->m_iNextBatch == psPrivate->m_apoBatches.size())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return 0;
+    }
+    const auto &poBatch = psPrivate->m_apoBatches[psPrivate->m_iNextBatch++];
+    MakeArrowArrayView(poBatch.get(), out_array, poBatch);
+    return 0;
+}
+
+/************************************************************************/
+/*                       GetLastErrorFromStream()                       */
+/************************************************************************/
+
+const char *
+OGRMemArrowLayer::GetLastErrorFromStream(struct ArrowArrayStream *stream)
+{
+    return OGRLayer::GetLastErrorArrowArrayStream(stream);
+}
+
+/************************************************************************/
+/*                        ReleaseStreamPrivate()                        */
+/************************************************************************/
+
+void OGRMemArrowLayer::ReleaseStreamPrivate(struct ArrowArrayStream *stream)
+{
+    delete static_cast<OGRMemArrowStreamPrivate *>(stream->private_data);
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRMemArrowLayer::TestCapability(const char *pszCap)
+{
+    if (EQUAL(pszCap, OLCRandomRead) || EQUAL(pszCap, OLCSequentialWrite) ||
+        EQUAL(pszCap, OLCFastSpatialFilter) ||
+        EQUAL(pszCap, OLCFastGetArrowStream) ||
+        EQUAL(pszCap, OLCFastWriteArrowBatch))
+        return TRUE;
+
+    else if (EQUAL(pszCap, OLCFastFeatureCount))
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+
+    else if (EQUAL(pszCap, OLCCreateField) ||
+             EQUAL(pszCap, OLCCreateGeomField))
+        return m_apoBatches.empty() && !m_poStagingLayer;
+
+    else if (EQUAL(pszCap, OLCStringsAsUTF8))
+        return m_bAdvertizeUTF8;
+
+    else if (EQUAL(pszCap, OLCCurveGeometries) ||
+             EQUAL(pszCap, OLCMeasuredGeometries) ||
+             EQUAL(pszCap, OLCZGeometries))
+        return TRUE;
+
+    return FALSE;
+}
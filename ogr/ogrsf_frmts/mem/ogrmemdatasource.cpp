@@ -35,6 +35,8 @@
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
 
+#include <memory>
+
 /************************************************************************/
 /*                          OGRMemDataSource()                          */
 /************************************************************************/
@@ -81,21 +83,52 @@ OGRMemDataSource::ICreateLayer(const char *pszLayerName,
         poSRS = poSRSIn->Clone();
         poSRS->SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
     }
-    OGRMemLayer *poLayer = new OGRMemLayer(pszLayerName, poSRS, eType);
+    const bool bAdvertizeUTF8 =
+        CPLFetchBool(papszOptions, "ADVERTIZE_UTF8", false);
+    const char *pszFIDColumn = CSLFetchNameValueDef(papszOptions, "FID", "");
+
+    OGRLayer *poLayer = nullptr;
+    const char *pszStorage =
+        CSLFetchNameValueDef(papszOptions, "STORAGE", "FEATURE");
+    if (EQUAL(pszStorage, "ARROW"))
+    {
+        std::unique_ptr<OGRGeomFieldDefn> poGeomFieldDefnClone;
+        if (poGeomFieldDefn && eType != wkbNone)
+        {
+            poGeomFieldDefnClone =
+                std::make_unique<OGRGeomFieldDefn>(poGeomFieldDefn);
+            poGeomFieldDefnClone->SetSpatialRef(poSRS);
+        }
+        poLayer = new OGRMemArrowLayer(this, pszLayerName,
+                                       poGeomFieldDefnClone.get(),
+                                       pszFIDColumn, bAdvertizeUTF8);
+    }
+    else if (!EQUAL(pszStorage, "FEATURE"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported value for STORAGE: %s", pszStorage);
+    }
+    else
+    {
+        OGRMemLayer *poMemLayer =
+            new OGRMemLayer(pszLayerName, poSRS, eType);
+        if (bAdvertizeUTF8)
+            poMemLayer->SetAdvertizeUTF8(true);
+
+        poMemLayer->SetDataset(this);
+        poMemLayer->SetFIDColumn(pszFIDColumn);
+        poLayer = poMemLayer;
+    }
     if (poSRS)
     {
         poSRS->Release();
     }
-
-    if (CPLFetchBool(papszOptions, "ADVERTIZE_UTF8", false))
-        poLayer->SetAdvertizeUTF8(true);
-
-    poLayer->SetDataset(this);
-    poLayer->SetFIDColumn(CSLFetchNameValueDef(papszOptions, "FID", ""));
+    if (!poLayer)
+        return nullptr;
 
     // Add layer to data source layer list.
-    papoLayers = static_cast<OGRMemLayer **>(
-        CPLRealloc(papoLayers, sizeof(OGRMemLayer *) * (nLayers + 1)));
+    papoLayers = static_cast<OGRLayer **>(
+        CPLRealloc(papoLayers, sizeof(OGRLayer *) * (nLayers + 1)));
 
     papoLayers[nLayers++] = poLayer;
 
@@ -203,7 +236,7 @@ bool OGRMemDataSource::DeleteFieldDomain(const std::string &name,
 
     for (int i = 0; i < nLayers; i++)
     {
-        OGRMemLayer *poLayer = papoLayers[i];
+        OGRLayer *poLayer = papoLayers[i];
         for (int j = 0; j < poLayer->GetLayerDefn()->GetFieldCount(); ++j)
         {
             OGRFieldDefn *poFieldDefn =
@@ -125,6 +125,11 @@ void RegisterOGRMEM()
         "the layer will contain UTF-8 strings' default='NO'/>"
         "  <Option name='FID' type='string' description="
         "'Name of the FID column to create' default='' />"
+        "  <Option name='STORAGE' type='string-select' description="
+        "'How features are stored' default='FEATURE'>"
+        "    <Value>FEATURE</Value>"
+        "    <Value>ARROW</Value>"
+        "  </Option>"
         "</LayerCreationOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_COORDINATE_EPOCH, "YES");
@@ -708,6 +708,73 @@ GInt32 TABINDFile::FindNext(int nIndexNumber, GByte *pKeyValue)
     return m_papoIndexRootNodes[nIndexNumber - 1]->FindNext(pKeyValue);
 }
 
+/**********************************************************************
+ *                   TABINDFile::GetKeyLength()
+ *
+ * Return the length in bytes of the keys of the specified index, or -1
+ * if the index number is not valid.
+ **********************************************************************/
+int TABINDFile::GetKeyLength(int nIndexNumber)
+{
+    if (ValidateIndexNo(nIndexNumber) != 0)
+        return -1;
+
+    return m_papoIndexRootNodes[nIndexNumber - 1]->GetKeyLength();
+}
+
+/**********************************************************************
+ *                   TABINDFile::FindFirstGreaterOrEqual()
+ *
+ * Start a scan of the index, in key order, at the first entry whose key
+ * is greater or equal to pKeyValue. The key of that entry is copied in
+ * pFoundKeyValue (GetKeyLength() bytes) if it is not NULL.
+ * FindNextInOrder() can then be used to continue the scan.
+ *
+ * Note that index numbers are positive values starting at 1.
+ *
+ * Return value:
+ *  - the entry's corresponding record number in the .DAT file (greater
+ *    than 0)
+ *  - 0 if all keys of the index are lower than pKeyValue
+ *  - or -1 if an error happened
+ **********************************************************************/
+GInt32 TABINDFile::FindFirstGreaterOrEqual(int nIndexNumber,
+                                           const GByte *pKeyValue,
+                                           GByte *pFoundKeyValue)
+{
+    if (ValidateIndexNo(nIndexNumber) != 0)
+        return -1;
+
+    // FindFirst() leaves the cursor of the leaf node on the first entry
+    // greater or equal to the key, even if it does not find the key.
+    TABINDNode *poRootNode = m_papoIndexRootNodes[nIndexNumber - 1];
+    if (poRootNode->FindFirst(pKeyValue) < 0)
+        return -1;
+
+    return poRootNode->GetCurEntry(pFoundKeyValue);
+}
+
+/**********************************************************************
+ *                   TABINDFile::FindNextInOrder()
+ *
+ * Continue the scan previously initiated by FindFirstGreaterOrEqual(),
+ * whatever the key of the next entry.
+ *
+ * Return value:
+ *  - the entry's corresponding record number in the .DAT file (greater
+ *    than 0)
+ *  - 0 if the end of the index has been reached
+ *  - or -1 if an error happened
+ **********************************************************************/
+GInt32 TABINDFile::FindNextInOrder(int nIndexNumber, GByte *pFoundKeyValue)
+{
+    if (ValidateIndexNo(nIndexNumber) != 0)
+        return -1;
+
+    return m_papoIndexRootNodes[nIndexNumber - 1]->FindNextInOrder(
+        pFoundKeyValue);
+}
+
 /**********************************************************************
  *                   TABINDFile::CreateIndex()
  *
@@ -1408,6 +1475,85 @@ GInt32 TABINDNode::FindNext(GByte *pKeyValue)
     return 0;
 }
 
+/**********************************************************************
+ *                   TABINDNode::GetCurEntry()
+ *
+ * Return the record number of the leaf entry at the current search
+ * position, and copy its key in pKeyValue if it is not NULL. If the search
+ * position is past the end of the current leaf node, move to the next
+ * leaf nodes.
+ *
+ * Return value:
+ *  - the entry's corresponding record number in the .DAT file (greater
+ *    than 0)
+ *  - 0 if the end of the index has been reached
+ *  - or -1 if an error happened
+ **********************************************************************/
+GInt32 TABINDNode::GetCurEntry(GByte *pKeyValue)
+{
+    if (m_poDataBlock == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AssertionFailed,
+                 "TABINDNode::Search(): Node has not been initialized yet!");
+        return -1;
+    }
+
+    if (m_nSubTreeDepth > 1)
+    {
+        /*-------------------------------------------------------------
+         * Index Node: the search position is in the current child node.
+         *------------------------------------------------------------*/
+        if (m_poCurChildNode == nullptr)
+            return 0;
+        return m_poCurChildNode->GetCurEntry(pKeyValue);
+    }
+
+    std::set<int> oSetVisitedNodePtr;
+    while (m_nCurIndexEntry >= m_numEntriesInNode && m_nNextNodePtr > 0)
+    {
+        if (!oSetVisitedNodePtr.insert(m_nNextNodePtr).second)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid next node pointer structure");
+            return -1;
+        }
+        if (GotoNodePtr(m_nNextNodePtr) != 0)
+            return -1;
+        m_nCurIndexEntry = 0;
+    }
+
+    if (m_nCurIndexEntry >= m_numEntriesInNode)
+        return 0;
+
+    return ReadIndexEntry(m_nCurIndexEntry, pKeyValue);
+}
+
+/**********************************************************************
+ *                   TABINDNode::FindNextInOrder()
+ *
+ * Move the search position previously set by FindFirst() to the next
+ * leaf entry, whatever its key, and return it as GetCurEntry() does.
+ **********************************************************************/
+GInt32 TABINDNode::FindNextInOrder(GByte *pKeyValue)
+{
+    if (m_poDataBlock == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AssertionFailed,
+                 "TABINDNode::Search(): Node has not been initialized yet!");
+        return -1;
+    }
+
+    if (m_nSubTreeDepth > 1)
+    {
+        if (m_poCurChildNode == nullptr)
+            return 0;
+        return m_poCurChildNode->FindNextInOrder(pKeyValue);
+    }
+
+    m_nCurIndexEntry++;
+    return GetCurEntry(pKeyValue);
+}
+
 /**********************************************************************
  *                   TABINDNode::CommitToFile()
  *
@@ -1729,6 +1729,8 @@ class TABINDNode
 
     GInt32 FindFirst(const GByte *pKeyValue);
     GInt32 FindNext(GByte *pKeyValue);
+    GInt32 GetCurEntry(GByte *pKeyValue);
+    GInt32 FindNextInOrder(GByte *pKeyValue);
 
     int CommitToFile();
 
@@ -1801,6 +1803,10 @@ class TABINDFile
     GByte *BuildKey(int nIndexNumber, double dValue);
     GInt32 FindFirst(int nIndexNumber, GByte *pKeyValue);
     GInt32 FindNext(int nIndexNumber, GByte *pKeyValue);
+    int GetKeyLength(int nIndexNumber);
+    GInt32 FindFirstGreaterOrEqual(int nIndexNumber, const GByte *pKeyValue,
+                                   GByte *pFoundKeyValue);
+    GInt32 FindNextInOrder(int nIndexNumber, GByte *pFoundKeyValue);
 
     int CreateIndex(TABFieldType eType, int nFieldSize);
     int AddEntry(int nIndexNumber, GByte *pKeyValue, GInt32 nRecordNo);
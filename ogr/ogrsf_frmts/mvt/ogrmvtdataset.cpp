@@ -78,6 +78,7 @@ constexpr int knMAX_FILES_PER_DIR = 10000;
 #include "cpl_worker_thread_pool.h"
 
 #include <mutex>
+#include <tuple>
 
 // Limitations from https://github.com/mapbox/mapbox-geostats
 constexpr size_t knMAX_COUNT_LAYERS = 1000;
@@ -90,6 +91,10 @@ constexpr size_t knMAX_STRING_VALUE_LENGTH = 256;
 constexpr size_t knMAX_LAYER_NAME_LENGTH = 256;
 constexpr size_t knMAX_FIELD_NAME_LENGTH = 256;
 
+// Size of the features accumulated in memory before they are flushed to the
+// temporary database
+constexpr size_t knMAX_PENDING_TEMP_RECORDS_SIZE = 32 * 1024 * 1024;
+
 #undef SQLITE_STATIC
 #define SQLITE_STATIC ((sqlite3_destructor_type) nullptr)
 
@@ -3299,6 +3304,26 @@ class OGRMVTWriterDataset final : public GDALDataset
     sqlite3_vfs *m_pMyVFS = nullptr;
     sqlite3 *m_hDB = nullptr;
     sqlite3_stmt *m_hInsertStmt = nullptr;
+
+    // Record of the temporary database, for a feature in a tile
+    struct TempRecord
+    {
+        int nZ = 0;
+        int nX = 0;
+        int nY = 0;
+        std::string osLayer{};
+        GIntBig nSerial = 0;
+        std::string osFeature{};  // compressed MVT layer with the feature
+        int nGeomType = 0;
+        double dfAreaOrLength = 0;
+    };
+
+    // Records waiting to be inserted in the temporary database. Protected
+    // by m_oDBMutex.
+    mutable std::vector<TempRecord> m_aoPendingTempRecords{};
+    mutable size_t m_nPendingTempRecordsSize = 0;
+    // Serializes insertions in the temporary database
+    mutable std::mutex m_oTempDBInsertMutex;
     int m_nMinZoom = 0;
     int m_nMaxZoom = 5;
     double m_dfSimplification = 0.0;
@@ -3339,6 +3364,8 @@ class OGRMVTWriterDataset final : public GDALDataset
 
     static void WriterTaskFunc(void *pParam);
 
+    OGRErr FlushTempRecords(std::vector<TempRecord> &aoRecords) const;
+
     OGRErr PreGenerateForTileReal(int nZ, int nX, int nY,
                                   const CPLString &osTargetName,
                                   bool bIsMaxZoomForLayer,
@@ -4262,34 +4289,96 @@ OGRErr OGRMVTWriterDataset::PreGenerateForTileReal(
     size_t nCompressedSize = 0;
     void *pCompressed = CPLZLibDeflate(oBuffer.data(), oBuffer.size(), -1,
                                        nullptr, 0, &nCompressedSize);
-    oBuffer.assign(static_cast<char *>(pCompressed), nCompressedSize);
+
+    TempRecord oRecord;
+    oRecord.nZ = nZ;
+    oRecord.nX = nTileX;
+    oRecord.nY = nTileY;
+    oRecord.osLayer = osTargetName;
+    oRecord.nSerial = nSerial;
+    oRecord.osFeature.assign(static_cast<char *>(pCompressed),
+                             nCompressedSize);
+    oRecord.nGeomType = static_cast<int>(poGPBFeature->getType());
+    oRecord.dfAreaOrLength = dfAreaOrLength;
     CPLFree(pCompressed);
 
+    // Queue the record, and if enough of them have been accumulated, take
+    // ownership of the batch to insert it.
+    std::vector<TempRecord> aoRecordsToFlush;
+    {
+        std::unique_ptr<std::lock_guard<std::mutex>> poLockGuard;
+        if (m_bThreadPoolOK)
+            poLockGuard =
+                std::make_unique<std::lock_guard<std::mutex>>(m_oDBMutex);
+
+        m_nTempTiles++;
+        m_nPendingTempRecordsSize += sizeof(TempRecord) +
+                                     oRecord.osLayer.size() +
+                                     oRecord.osFeature.size();
+        m_aoPendingTempRecords.push_back(std::move(oRecord));
+        if (m_nPendingTempRecordsSize >= knMAX_PENDING_TEMP_RECORDS_SIZE)
+        {
+            std::swap(aoRecordsToFlush, m_aoPendingTempRecords);
+            m_nPendingTempRecordsSize = 0;
+        }
+    }
+
+    if (!aoRecordsToFlush.empty())
+        return FlushTempRecords(aoRecordsToFlush);
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          FlushTempRecords()                          */
+/************************************************************************/
+
+// Inserts a batch of records in the temporary database, in a single
+// transaction. Records are sorted by tile first, so that the features of a
+// same tile end up in contiguous pages of the database, which makes the
+// index creation and reading them back in CreateOutput() cheaper.
+OGRErr
+OGRMVTWriterDataset::FlushTempRecords(std::vector<TempRecord> &aoRecords) const
+{
+    std::sort(aoRecords.begin(), aoRecords.end(),
+              [](const TempRecord &a, const TempRecord &b)
+              {
+                  return std::tie(a.nZ, a.nX, a.nY, a.osLayer, a.nSerial) <
+                         std::tie(b.nZ, b.nX, b.nY, b.osLayer, b.nSerial);
+              });
+
     std::unique_ptr<std::lock_guard<std::mutex>> poLockGuard;
     if (m_bThreadPoolOK)
-        poLockGuard = std::make_unique<std::lock_guard<std::mutex>>(m_oDBMutex);
-
-    m_nTempTiles++;
-    sqlite3_bind_int(m_hInsertStmt, 1, nZ);
-    sqlite3_bind_int(m_hInsertStmt, 2, nTileX);
-    sqlite3_bind_int(m_hInsertStmt, 3, nTileY);
-    sqlite3_bind_text(m_hInsertStmt, 4, osTargetName.c_str(), -1,
-                      SQLITE_STATIC);
-    sqlite3_bind_int64(m_hInsertStmt, 5, nSerial);
-    sqlite3_bind_blob(m_hInsertStmt, 6, oBuffer.data(),
-                      static_cast<int>(oBuffer.size()), SQLITE_STATIC);
-    sqlite3_bind_int(m_hInsertStmt, 7,
-                     static_cast<int>(poGPBFeature->getType()));
-    sqlite3_bind_double(m_hInsertStmt, 8, dfAreaOrLength);
-    int rc = sqlite3_step(m_hInsertStmt);
-    sqlite3_reset(m_hInsertStmt);
-
-    if (!(rc == SQLITE_OK || rc == SQLITE_DONE))
-    {
+        poLockGuard =
+            std::make_unique<std::lock_guard<std::mutex>>(m_oTempDBInsertMutex);
+
+    if (SQLCommand(m_hDB, "BEGIN") != OGRERR_NONE)
         return OGRERR_FAILURE;
+
+    for (const auto &oRecord : aoRecords)
+    {
+        sqlite3_bind_int(m_hInsertStmt, 1, oRecord.nZ);
+        sqlite3_bind_int(m_hInsertStmt, 2, oRecord.nX);
+        sqlite3_bind_int(m_hInsertStmt, 3, oRecord.nY);
+        sqlite3_bind_text(m_hInsertStmt, 4, oRecord.osLayer.c_str(), -1,
+                          SQLITE_STATIC);
+        sqlite3_bind_int64(m_hInsertStmt, 5, oRecord.nSerial);
+        sqlite3_bind_blob(m_hInsertStmt, 6, oRecord.osFeature.data(),
+                          static_cast<int>(oRecord.osFeature.size()),
+                          SQLITE_STATIC);
+        sqlite3_bind_int(m_hInsertStmt, 7, oRecord.nGeomType);
+        sqlite3_bind_double(m_hInsertStmt, 8, oRecord.dfAreaOrLength);
+        const int rc = sqlite3_step(m_hInsertStmt);
+        sqlite3_reset(m_hInsertStmt);
+
+        if (!(rc == SQLITE_OK || rc == SQLITE_DONE))
+        {
+            CPL_IGNORE_RET_VAL(SQLCommand(m_hDB, "ROLLBACK"));
+            return OGRERR_FAILURE;
+        }
     }
 
-    return OGRERR_NONE;
+    return SQLCommand(m_hDB, "COMMIT");
 }
 
 /************************************************************************/
@@ -5167,6 +5256,18 @@ bool OGRMVTWriterDataset::CreateOutput()
     if (m_bThreadPoolOK)
         m_oThreadPool.WaitCompletion();
 
+    if (!m_aoPendingTempRecords.empty())
+    {
+        if (FlushTempRecords(m_aoPendingTempRecords) != OGRERR_NONE)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot insert features in temporary database");
+            return false;
+        }
+        m_aoPendingTempRecords.clear();
+        m_nPendingTempRecordsSize = 0;
+    }
+
     std::map<CPLString, MVTLayerProperties> oMapLayerProps;
     std::set<CPLString> oSetLayers;
 
@@ -5175,6 +5276,15 @@ bool OGRMVTWriterDataset::CreateOutput()
         return GenerateMetadata(0, oMapLayerProps);
     }
 
+    // The index is created once all features have been inserted, which is
+    // much faster than maintaining it during insertions.
+    CPLDebug("MVT", "Indexing temporary database...");
+    if (SQLCommand(m_hDB, "CREATE INDEX IF NOT EXISTS temp_index ON temp "
+                          "(z, x, y, layer, idx)") != OGRERR_NONE)
+    {
+        return false;
+    }
+
     CPLDebug("MVT", "Building output file from temporary database...");
 
     sqlite3_stmt *hStmtZXY = nullptr;
@@ -6034,8 +6144,7 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
             "PRAGMA temp_store = MEMORY;"
             "CREATE TABLE temp(z INTEGER, x INTEGER, y INTEGER, layer TEXT, "
             "idx INTEGER, feature BLOB, geomtype INTEGER, area_or_length "
-            "DOUBLE);"
-            "CREATE INDEX temp_index ON temp (z, x, y, layer, idx);"));
+            "DOUBLE);"));
     }
 
     sqlite3_stmt *hInsertStmt = nullptr;
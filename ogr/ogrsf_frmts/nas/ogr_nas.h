@@ -34,6 +34,8 @@
 #include "ogrsf_frmts.h"
 #include "nasreaderp.h"
 #include "ogr_api.h"
+#include <memory>
+#include <string>
 #include <vector>
 
 class OGRNASDataSource;
@@ -52,6 +54,15 @@ class OGRNASLayer final : public OGRLayer
 
     GMLFeatureClass *poFClass;
 
+    // Number of threads used to prefetch features and build their
+    // geometries in parallel. 1 means no prefetching.
+    int m_nPrefetchThreads = 1;
+    std::unique_ptr<GMLFeaturePrefetcher> m_poPrefetcher{};
+
+    bool BuildGeometries(const GMLFeature *poNASFeature,
+                         std::vector<OGRGeometry *> &apoGeometries,
+                         std::string &osErrorMsg);
+
   public:
     OGRNASLayer(const char *pszName, OGRNASDataSource *poDS);
 
@@ -41,7 +41,8 @@ OGRNASLayer::OGRNASLayer(const char *pszName, OGRNASDataSource *poDSIn)
           pszName + (STARTS_WITH_CI(pszName, "ogr:") ? 4 : 0))),
       iNextNASId(0), poDS(poDSIn),
       // Readers should get the corresponding GMLFeatureClass and cache it.
-      poFClass(poDS->GetReader()->GetClass(pszName))
+      poFClass(poDS->GetReader()->GetClass(pszName)),
+      m_nPrefetchThreads(GMLFeaturePrefetcher::GetThreadCountFromConfig())
 {
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
@@ -55,6 +56,8 @@ OGRNASLayer::OGRNASLayer(const char *pszName, OGRNASDataSource *poDSIn)
 OGRNASLayer::~OGRNASLayer()
 
 {
+    m_poPrefetcher.reset();
+
     if (poFeatureDefn)
         poFeatureDefn->Release();
 }
@@ -67,11 +70,55 @@ void OGRNASLayer::ResetReading()
 
 {
     iNextNASId = 0;
+    if (m_poPrefetcher)
+        m_poPrefetcher->Reset();
     poDS->GetReader()->ResetReading();
     if (poFClass)
         poDS->GetReader()->SetFilteredClassName(poFClass->GetElementName());
 }
 
+/************************************************************************/
+/*                          BuildGeometries()                           */
+/************************************************************************/
+
+// Builds the OGR geometries of a NAS feature, one per geometry field.
+// May be called from worker threads.
+// On failure, returns false and sets osErrorMsg.
+bool OGRNASLayer::BuildGeometries(const GMLFeature *poNASFeature,
+                                  std::vector<OGRGeometry *> &apoGeometries,
+                                  std::string &osErrorMsg)
+{
+    const CPLXMLNode *const *papsGeometry = poNASFeature->GetGeometryList();
+    const OGRwkbGeometryType eLayerGeomType = GetGeomType();
+
+    apoGeometries.resize(poNASFeature->GetGeometryCount());
+    for (int iGeom = 0; iGeom < poNASFeature->GetGeometryCount(); ++iGeom)
+    {
+        if (papsGeometry[iGeom] == nullptr)
+            continue;
+
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        OGRGeometry *poGeom = OGRGeometry::FromHandle(
+            OGR_G_CreateFromGMLTree(papsGeometry[iGeom]));
+        CPLPopErrorHandler();
+        if (poGeom == nullptr)
+            osErrorMsg = CPLGetLastErrorMsg();
+        poGeom = NASReader::ConvertGeometry(poGeom);
+        poGeom = OGRGeometryFactory::forceTo(poGeom, eLayerGeomType);
+        // poGeom->dumpReadable( 0, "NAS: " );
+
+        if (poGeom == nullptr)
+        {
+            for (OGRGeometry *poOtherGeom : apoGeometries)
+                delete poOtherGeom;
+            apoGeometries.clear();
+            return false;
+        }
+        apoGeometries[iGeom] = poGeom;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -84,6 +131,22 @@ OGRFeature *OGRNASLayer::GetNextFeature()
     if (iNextNASId == 0)
         ResetReading();
 
+    if (m_nPrefetchThreads > 1 && !m_poPrefetcher)
+    {
+        m_poPrefetcher = std::make_unique<GMLFeaturePrefetcher>(
+            poDS->GetReader(), m_nPrefetchThreads,
+            [this](GMLPreparedFeature &sPrepared, void * /* hCacheSRS */)
+            {
+                if (sPrepared.poFeature->GetClass() == poFClass)
+                {
+                    sPrepared.bError =
+                        !BuildGeometries(sPrepared.poFeature,
+                                         sPrepared.apoGeometries,
+                                         sPrepared.osErrorMsg);
+                }
+            });
+    }
+
     /* ==================================================================== */
     /*      Loop till we find and translate a feature meeting all our       */
     /*      requirements.                                                   */
@@ -96,7 +159,19 @@ OGRFeature *OGRNASLayer::GetNextFeature()
         /* --------------------------------------------------------------------
          */
         delete poNASFeature;
-        poNASFeature = poDS->GetReader()->NextFeature();
+        GMLPreparedFeature sPrepared;
+        bool bPrepared = false;
+        if (m_poPrefetcher)
+        {
+            if (!m_poPrefetcher->GetNext(sPrepared))
+                return nullptr;
+            poNASFeature = sPrepared.poFeature;
+            bPrepared = true;
+        }
+        else
+        {
+            poNASFeature = poDS->GetReader()->NextFeature();
+        }
         if (poNASFeature == nullptr)
             return nullptr;
 
@@ -121,45 +196,40 @@ OGRFeature *OGRNASLayer::GetNextFeature()
         /*      Does it satisfy the spatial query, if there is one? */
         /* --------------------------------------------------------------------
          */
-        const CPLXMLNode *const *papsGeometry = poNASFeature->GetGeometryList();
-
-        std::vector<OGRGeometry *> poGeom(poNASFeature->GetGeometryCount());
-
-        bool bErrored = false, bFiltered = false;
+        std::vector<OGRGeometry *> poGeom;
         CPLString osLastErrorMsg;
-        for (int iGeom = 0; iGeom < poNASFeature->GetGeometryCount(); ++iGeom)
+        bool bErrored;
+        if (bPrepared)
         {
-            if (papsGeometry[iGeom] == nullptr)
-            {
-                poGeom[iGeom] = nullptr;
-            }
-            else
+            for (const auto &oError : sPrepared.aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            poGeom = std::move(sPrepared.apoGeometries);
+            osLastErrorMsg = sPrepared.osErrorMsg;
+            bErrored = sPrepared.bError;
+        }
+        else
+        {
+            std::string osErrorMsg;
+            bErrored = !BuildGeometries(poNASFeature, poGeom, osErrorMsg);
+            osLastErrorMsg = osErrorMsg;
+        }
+
+        bool bFiltered = false;
+        if (!bErrored && m_poFilterGeom != nullptr)
+        {
+            for (OGRGeometry *poSubGeom : poGeom)
             {
-                CPLPushErrorHandler(CPLQuietErrorHandler);
-
-                poGeom[iGeom] =
-                    (OGRGeometry *)OGR_G_CreateFromGMLTree(papsGeometry[iGeom]);
-                CPLPopErrorHandler();
-                if (poGeom[iGeom] == nullptr)
-                    osLastErrorMsg = CPLGetLastErrorMsg();
-                poGeom[iGeom] = NASReader::ConvertGeometry(poGeom[iGeom]);
-                poGeom[iGeom] =
-                    OGRGeometryFactory::forceTo(poGeom[iGeom], GetGeomType());
-                // poGeom->dumpReadable( 0, "NAS: " );
-
-                if (poGeom[iGeom] == nullptr)
-                    bErrored = true;
+                if (!FilterGeometry(poSubGeom))
+                {
+                    bFiltered = true;
+                    break;
+                }
             }
-
-            bFiltered =
-                m_poFilterGeom != nullptr && !FilterGeometry(poGeom[iGeom]);
-            if (bErrored || bFiltered)
+            if (bFiltered)
             {
-                while (iGeom > 0)
-                    delete poGeom[--iGeom];
+                for (OGRGeometry *poSubGeom : poGeom)
+                    delete poSubGeom;
                 poGeom.clear();
-
-                break;
             }
         }
 
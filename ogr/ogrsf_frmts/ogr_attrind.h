@@ -52,6 +52,8 @@ class CPL_DLL OGRAttrIndex
     virtual GIntBig *GetAllMatches(OGRField *psKey) = 0;
     virtual GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList,
                                    int *nFIDCount, int *nLength) = 0;
+    virtual GIntBig *GetRangeMatches(const OGRField *psMinKey,
+                                     const OGRField *psMaxKey, int *pnFIDCount);
 
     virtual OGRErr AddEntry(OGRField *psKey, GIntBig nFID) = 0;
     virtual OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) = 0;
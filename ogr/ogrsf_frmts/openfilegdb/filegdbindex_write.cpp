@@ -37,6 +37,7 @@
 #include <limits>
 
 #include "cpl_string.h"
+#include "gdal_thread_pool.h"
 
 namespace OpenFileGDB
 {
@@ -432,6 +433,108 @@ void FileGDBTable::ComputeOptimalSpatialIndexGridResolution()
     }
 }
 
+/************************************************************************/
+/*                            ParallelSort()                            */
+/************************************************************************/
+
+// Sorts asValues. When GDAL_NUM_THREADS is set, runs of the array are
+// sorted by the threads of the global thread pool, and then merged
+// pairwise, the merges of a same round being also done in parallel.
+template <class T, class Compare>
+static void ParallelSort(std::vector<T> &asValues, Compare comp)
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    int nThreads = 1;
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(nThreads, 128));
+    }
+    // Not worth using threads on small arrays.
+    // Configurable only for debugging & autotest purposes
+    const size_t nMinValuesPerRun = std::max(
+        1, atoi(CPLGetConfigOption("OPENFILEGDB_MIN_VALUES_PER_SORT_RUN",
+                                   "100000")));
+    const int nRuns = static_cast<int>(std::max<size_t>(
+        1, std::min<size_t>(nThreads, asValues.size() / nMinValuesPerRun)));
+    CPLWorkerThreadPool *poThreadPool =
+        nRuns > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+    {
+        std::sort(asValues.begin(), asValues.end(), comp);
+        return;
+    }
+
+    struct Job
+    {
+        std::vector<T> *pasValues;
+        Compare *pComp;
+        size_t nStart;
+        size_t nMiddle;  // only used by merge jobs
+        size_t nEnd;
+    };
+
+    std::vector<size_t> anBounds;
+    for (int i = 0; i <= nRuns; ++i)
+    {
+        anBounds.push_back(static_cast<size_t>(
+            static_cast<uint64_t>(asValues.size()) * i / nRuns));
+    }
+
+    // Sort runs
+    std::vector<Job> asJobs(nRuns);
+    auto poQueue = poThreadPool->CreateJobQueue();
+    for (int i = 0; i < nRuns; ++i)
+    {
+        asJobs[i] = Job{&asValues, &comp, anBounds[i], 0, anBounds[i + 1]};
+        poQueue->SubmitJob(
+            [](void *pData)
+            {
+                const Job *psJob = static_cast<const Job *>(pData);
+                std::sort(psJob->pasValues->begin() + psJob->nStart,
+                          psJob->pasValues->begin() + psJob->nEnd,
+                          *(psJob->pComp));
+            },
+            &asJobs[i]);
+    }
+    poQueue->WaitCompletion();
+
+    // Merge pairs of adjacent runs, until there is a single one
+    while (anBounds.size() > 2)
+    {
+        std::vector<size_t> anNewBounds;
+        asJobs.clear();
+        for (size_t i = 0; i + 2 < anBounds.size(); i += 2)
+        {
+            asJobs.push_back(Job{&asValues, &comp, anBounds[i],
+                                 anBounds[i + 1], anBounds[i + 2]});
+            anNewBounds.push_back(anBounds[i]);
+        }
+        // Odd number of runs: the last one is merged at the next round
+        if ((anBounds.size() % 2) == 0)
+            anNewBounds.push_back(anBounds[anBounds.size() - 2]);
+        anNewBounds.push_back(anBounds.back());
+
+        for (auto &sJob : asJobs)
+        {
+            poQueue->SubmitJob(
+                [](void *pData)
+                {
+                    const Job *psJob = static_cast<const Job *>(pData);
+                    std::inplace_merge(
+                        psJob->pasValues->begin() + psJob->nStart,
+                        psJob->pasValues->begin() + psJob->nMiddle,
+                        psJob->pasValues->begin() + psJob->nEnd,
+                        *(psJob->pComp));
+                },
+                &sJob);
+        }
+        poQueue->WaitCompletion();
+        anBounds = std::move(anNewBounds);
+    }
+}
+
 /************************************************************************/
 /*                           WriteIndex()                               */
 /************************************************************************/
@@ -488,11 +591,11 @@ static bool WriteIndex(
     }
 
     // Sort by ascending values, and for same value by ascending OID
-    std::sort(asValues.begin(), asValues.end(),
-              [](const ValueOIDPair &a, const ValueOIDPair &b) {
-                  return a.first < b.first ||
-                         (a.first == b.first && a.second < b.second);
-              });
+    ParallelSort(asValues,
+                 [](const ValueOIDPair &a, const ValueOIDPair &b) {
+                     return a.first < b.first ||
+                            (a.first == b.first && a.second < b.second);
+                 });
 
     bool bRet = true;
     std::vector<GByte> abyPage;
@@ -711,6 +711,12 @@ bool FileGDBTable::Open(const char *pszFilename, bool bUpdate,
     CPLAssert(m_fpTable == nullptr);
 
     m_bUpdate = bUpdate;
+    if (!m_bUpdate)
+    {
+        m_nReadAheadSize = static_cast<size_t>(std::max(
+            0, atoi(CPLGetConfigOption("OPENFILEGDB_READ_AHEAD_SIZE",
+                                       "262144"))));
+    }
 
     m_osFilename = pszFilename;
     CPLString m_osFilenameWithLayerName(m_osFilename);
@@ -1418,10 +1424,11 @@ FileGDBTable::GetOffsetInTableForRow(int iRow, vsi_l_offset *pnOffsetInTableX)
 
     if (pnOffsetInTableX)
         *pnOffsetInTableX = nOffsetInTableX;
-    VSIFSeekL(m_fpTableX, nOffsetInTableX, SEEK_SET);
 
     GByte abyBuffer[6];
-    m_bError = VSIFReadL(abyBuffer, m_nTablxOffsetSize, 1, m_fpTableX) != 1;
+    m_bError = !ReadWithReadAhead(m_fpTableX, m_sTableXReadAhead,
+                                  nOffsetInTableX, abyBuffer,
+                                  m_nTablxOffsetSize);
     returnErrorIf(m_bError);
 
     const vsi_l_offset nOffset = ReadFeatureOffset(abyBuffer);
@@ -1439,6 +1446,52 @@ FileGDBTable::GetOffsetInTableForRow(int iRow, vsi_l_offset *pnOffsetInTableX)
     return nOffset;
 }
 
+/************************************************************************/
+/*                         ReadWithReadAhead()                          */
+/************************************************************************/
+
+/* Reads nSize bytes at nOffset. When the read follows closely the previous
+ * one, a larger span of m_nReadAheadSize bytes is read and kept in sBuffer to
+ * serve the next requests. Random accesses (e.g. through an index) are
+ * served with a direct read, to avoid fetching bytes that will not be used.
+ */
+bool FileGDBTable::ReadWithReadAhead(VSILFILE *fp, ReadAheadBuffer &sBuffer,
+                                     vsi_l_offset nOffset, void *pDest,
+                                     size_t nSize)
+{
+    const vsi_l_offset nEnd = nOffset + nSize;
+    if (nOffset >= sBuffer.nOffset &&
+        nEnd <= sBuffer.nOffset + sBuffer.abyData.size())
+    {
+        memcpy(pDest,
+               sBuffer.abyData.data() +
+                   static_cast<size_t>(nOffset - sBuffer.nOffset),
+               nSize);
+        sBuffer.nLastReadEnd = nEnd;
+        return true;
+    }
+
+    const bool bSequential = nOffset >= sBuffer.nLastReadEnd &&
+                             nOffset - sBuffer.nLastReadEnd < m_nReadAheadSize;
+    sBuffer.nLastReadEnd = nEnd;
+    if (!bSequential || nSize >= m_nReadAheadSize)
+    {
+        VSIFSeekL(fp, nOffset, SEEK_SET);
+        return VSIFReadL(pDest, nSize, 1, fp) == 1;
+    }
+
+    sBuffer.abyData.resize(m_nReadAheadSize);
+    VSIFSeekL(fp, nOffset, SEEK_SET);
+    const size_t nRead =
+        VSIFReadL(sBuffer.abyData.data(), 1, m_nReadAheadSize, fp);
+    sBuffer.abyData.resize(nRead);
+    sBuffer.nOffset = nOffset;
+    if (nRead < nSize)
+        return false;
+    memcpy(pDest, sBuffer.abyData.data(), nSize);
+    return true;
+}
+
 /************************************************************************/
 /*                        ReadFeatureOffset()                           */
 /************************************************************************/
@@ -1510,9 +1563,9 @@ int FileGDBTable::SelectRow(int iRow)
             return FALSE;
         }
 
-        VSIFSeekL(m_fpTable, nOffsetTable, SEEK_SET);
         GByte abyBuffer[4];
-        returnErrorAndCleanupIf(VSIFReadL(abyBuffer, 4, 1, m_fpTable) != 1,
+        returnErrorAndCleanupIf(!ReadWithReadAhead(m_fpTable, m_sTableReadAhead,
+                                                   nOffsetTable, abyBuffer, 4),
                                 m_nCurRow = -1);
 
         m_nRowBlobLength = GetUInt32(abyBuffer, 0);
@@ -1566,7 +1619,6 @@ int FileGDBTable::SelectRow(int iRow)
                     {
                         VSIFSeekL(m_fpTable, 0, SEEK_END);
                         m_nFileSize = VSIFTellL(m_fpTable);
-                        VSIFSeekL(m_fpTable, nOffsetTable + 4, SEEK_SET);
                     }
                     if (nOffsetTable + 4 + m_nRowBlobLength > m_nFileSize)
                     {
@@ -1595,10 +1647,11 @@ int FileGDBTable::SelectRow(int iRow)
                 }
             }
 
-            returnErrorAndCleanupIf(VSIFReadL(m_abyBuffer.data(),
-                                              m_nRowBlobLength, 1,
-                                              m_fpTable) != 1,
-                                    m_nCurRow = -1);
+            returnErrorAndCleanupIf(
+                !ReadWithReadAhead(m_fpTable, m_sTableReadAhead,
+                                   nOffsetTable + 4, m_abyBuffer.data(),
+                                   m_nRowBlobLength),
+                m_nCurRow = -1);
             /* Protection for 4 ReadVarUInt64NoCheck */
             CPL_STATIC_ASSERT(ZEROES_AFTER_END_OF_BUFFER == 4);
             m_abyBuffer[m_nRowBlobLength] = 0;
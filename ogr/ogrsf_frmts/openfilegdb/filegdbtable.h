@@ -431,6 +431,20 @@ class FileGDBTable
     vsi_l_offset m_nFileSize = 0; /* only read when needed */
     bool m_bUpdate = false;
 
+    // Read-ahead buffers used when the .gdbtable/.gdbtablx files are read
+    // sequentially, so that a full scan issues a few large reads instead of
+    // two small ones per row. Only used in read-only mode.
+    struct ReadAheadBuffer
+    {
+        std::vector<GByte> abyData{};
+        vsi_l_offset nOffset = 0;       // file offset of abyData[0]
+        vsi_l_offset nLastReadEnd = 0;  // to detect sequential reads
+    };
+
+    size_t m_nReadAheadSize = 0;  // 0 = disabled
+    ReadAheadBuffer m_sTableReadAhead{};
+    ReadAheadBuffer m_sTableXReadAhead{};
+
     std::string m_osFilename{};
     bool m_bIsV9 = false;
     std::vector<std::unique_ptr<FileGDBField>> m_apoFields{};
@@ -563,6 +577,8 @@ class FileGDBTable
     bool WriteFieldDescriptors(VSILFILE *fpTable);
     bool SeekIntoTableXForNewFeature(int nObjectID);
     uint64_t ReadFeatureOffset(const GByte *pabyBuffer);
+    bool ReadWithReadAhead(VSILFILE *fp, ReadAheadBuffer &sBuffer,
+                           vsi_l_offset nOffset, void *pDest, size_t nSize);
     void WriteFeatureOffset(uint64_t nFeatureOffset, GByte *pabyBuffer);
     bool WriteFeatureOffset(uint64_t nFeatureOffset);
     bool EncodeFeature(const std::vector<OGRField> &asRawFields,
@@ -157,12 +157,16 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     int BuildLayerDefinition();
     int BuildGeometryColumnGDBv10(const std::string &osParentDefinition);
-    OGRFeature *GetCurrentFeature();
+    OGRFeature *GetCurrentFeature(OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
 
     std::unique_ptr<FileGDBOGRGeometryConverter> m_poGeomConverter{};
 
     int m_iFieldToReadAsBinary = -1;
 
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    bool CanUseOptimizedGetNextArrowArray();
+
     FileGDBIterator *m_poAttributeIterator = nullptr;
     int m_bIteratorSufficientToEvaluateFilter = FALSE;
     FileGDBIterator *BuildIteratorFromExprNode(swq_expr_node *poNode);
@@ -278,9 +282,13 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     virtual void ResetReading() override;
     virtual OGRFeature *GetNextFeature() override;
+    virtual bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
     virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
 
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+
     virtual GIntBig GetFeatureCount(int bForce = TRUE) override;
     virtual OGRErr GetExtent(OGREnvelope *psExtent, int bForce = TRUE) override;
 
@@ -306,6 +314,9 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     virtual int TestCapability(const char *) override;
 
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     virtual OGRErr Rename(const char *pszNewName) override;
 
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
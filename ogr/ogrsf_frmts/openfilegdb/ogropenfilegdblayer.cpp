@@ -54,6 +54,8 @@
 #include "filegdbtable.h"
 #include "ogr_swq.h"
 #include "filegdb_coordprec_read.h"
+#include "gdal_thread_pool.h"
+#include "ograrrowarrayhelper.h"
 
 /************************************************************************/
 /*                      OGROpenFileGDBLayer()                           */
@@ -1695,13 +1697,47 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                       PromoteToMultiGeometry()                      */
+/***********************************************************************/
+
+// Polygons and lines are reported as multi geometries, consistently with
+// the layer geometry type.
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    const OGRwkbGeometryType eFlattenType =
+        wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
 
-OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
+// When poFeatureToReuse is not null, it is reset and filled instead of
+// creating a new feature.
+OGRFeature *
+OGROpenFileGDBLayer::GetCurrentFeature(OGRFeature *poFeatureToReuse)
 {
-    OGRFeature *poFeature = nullptr;
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
     int iOGRIdx = 0;
     int iRow = m_poLyrTable->GetCurRow();
     for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount(); iGDBIdx++)
@@ -1745,33 +1781,15 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                     !m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(
                         psField))
                 {
-                    delete poFeature;
+                    if (poFeature != poFeatureToReuse)
+                        delete poFeature;
                     return nullptr;
                 }
 
                 OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMultiGeometry(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
@@ -1842,6 +1860,31 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
 /***********************************************************************/
 
 OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/***********************************************************************/
+/*                         GetNextFeatureInto()                        */
+/***********************************************************************/
+
+bool OGROpenFileGDBLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (!BuildLayerDefinition())
+        return false;
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+    return GetNextFeatureInternal(&oFeature) != nullptr;
+}
+
+/***********************************************************************/
+/*                       GetNextFeatureInternal()                      */
+/***********************************************************************/
+
+// When poFeatureToReuse is not null, the next feature is read into it and
+// it is returned, instead of a new feature.
+OGRFeature *
+OGROpenFileGDBLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
 {
     if (!BuildLayerDefinition() || m_bEOF)
         return nullptr;
@@ -1867,7 +1910,7 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
                     m_pahFilteredFeatures[m_iCurFeat++]));
                 if (m_poLyrTable->SelectRow(iRow))
                 {
-                    poFeature = GetCurrentFeature();
+                    poFeature = GetCurrentFeature(poFeatureToReuse);
                     if (poFeature)
                         break;
                 }
@@ -1887,7 +1930,7 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
                     return nullptr;
                 if (m_poLyrTable->SelectRow(iRow))
                 {
-                    poFeature = GetCurrentFeature();
+                    poFeature = GetCurrentFeature(poFeatureToReuse);
                     if (poFeature)
                         break;
                 }
@@ -1916,7 +1959,7 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
                 else
                 {
                     m_iCurFeat++;
-                    poFeature = GetCurrentFeature();
+                    poFeature = GetCurrentFeature(poFeatureToReuse);
                     if (m_eSpatialIndexState == SPI_IN_BUILDING &&
                         m_iCurFeat == m_poLyrTable->GetTotalRecordCount())
                     {
@@ -1939,10 +1982,575 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
             return poFeature;
         }
 
-        delete poFeature;
+        if (poFeature != poFeatureToReuse)
+            delete poFeature;
+    }
+}
+
+/***********************************************************************/
+/*                  CanUseOptimizedGetNextArrowArray()                 */
+/***********************************************************************/
+
+// Whether GetNextArrowArray() can fill the Arrow buffers directly from the
+// rows of the table: sequential reading without filter, and field types that
+// map to the ones handled by OGRArrowArrayHelper.
+bool OGROpenFileGDBLayer::CanUseOptimizedGetNextArrowArray()
+{
+    if (m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        m_poAttributeIterator != nullptr ||
+        m_poSpatialIndexIterator != nullptr ||
+        m_poCombinedIterator != nullptr || m_nFilteredFeatureCount >= 0 ||
+        m_iFIDAsRegularColumnIndex >= 0 || m_iFieldToReadAsBinary >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed() ||
+        !m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO")))
+    {
+        return false;
+    }
+
+    int iOGRIdx = 0;
+    for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount(); iGDBIdx++)
+    {
+        if (iGDBIdx == m_iGeomFieldIdx ||
+            iGDBIdx == m_poLyrTable->GetObjectIdFieldIdx())
+        {
+            continue;
+        }
+        const OGRFieldDefn *poFieldDefn =
+            m_poFeatureDefn->GetFieldDefn(iOGRIdx);
+        iOGRIdx++;
+        if (poFieldDefn->IsIgnored())
+            continue;
+        if (m_poLyrTable->GetField(iGDBIdx)->GetType() == FGFT_RASTER)
+            return false;
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+            case OFTInteger64:
+            case OFTReal:
+            case OFTString:
+            case OFTBinary:
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+/***********************************************************************/
+/*                     ConvertGeometryBlobsToWKB()                     */
+/***********************************************************************/
+
+namespace
+{
+// Conversion of a range of the geometry blobs of a batch to ISO WKB
+struct OGROpenFileGDBWKBConversionJob
+{
+    const FileGDBGeomField *poGeomField = nullptr;
+    // Converter to use, or nullptr to instantiate one (when run in a
+    // worker thread)
+    FileGDBOGRGeometryConverter *poConverter = nullptr;
+    const GByte *pabyBlobs = nullptr;
+    const size_t *panBlobOffsets = nullptr;
+    int iStart = 0;
+    int iEnd = 0;
+    // Output WKB. A zero size is used for null geometries
+    std::vector<GByte> abyWKB{};
+    std::vector<size_t> anWKBOffsets{};
+    bool bMemoryError = false;
+};
+}  // namespace
+
+static void ConvertGeometryBlobsToWKB(void *pData)
+{
+    auto psJob = static_cast<OGROpenFileGDBWKBConversionJob *>(pData);
+    std::unique_ptr<FileGDBOGRGeometryConverter> poConverterHolder;
+    FileGDBOGRGeometryConverter *poConverter = psJob->poConverter;
+    if (poConverter == nullptr)
+    {
+        poConverterHolder.reset(
+            FileGDBOGRGeometryConverter::BuildConverter(psJob->poGeomField));
+        poConverter = poConverterHolder.get();
+    }
+
+    try
+    {
+        psJob->anWKBOffsets.resize(psJob->iEnd - psJob->iStart + 1);
+        psJob->anWKBOffsets[0] = 0;
+        for (int i = psJob->iStart; i < psJob->iEnd; ++i)
+        {
+            const size_t nBlobSize =
+                psJob->panBlobOffsets[i + 1] - psJob->panBlobOffsets[i];
+            size_t nWKBSize = 0;
+            if (nBlobSize > 0)
+            {
+                OGRField sField;
+                sField.Binary.nCount = static_cast<int>(nBlobSize);
+                sField.Binary.paData = const_cast<GByte *>(
+                    psJob->pabyBlobs + psJob->panBlobOffsets[i]);
+                OGRGeometry *poGeom = poConverter->GetAsGeometry(&sField);
+                if (poGeom != nullptr)
+                {
+                    std::unique_ptr<OGRGeometry> poGeomHolder(
+                        PromoteToMultiGeometry(poGeom));
+                    nWKBSize = poGeomHolder->WkbSize();
+                    const size_t nOldSize = psJob->abyWKB.size();
+                    psJob->abyWKB.resize(nOldSize + nWKBSize);
+                    poGeomHolder->exportToWkb(wkbNDR,
+                                              psJob->abyWKB.data() + nOldSize,
+                                              wkbVariantIso);
+                }
+            }
+            psJob->anWKBOffsets[i - psJob->iStart + 1] =
+                psJob->anWKBOffsets[i - psJob->iStart] + nWKBSize;
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        psJob->bMemoryError = true;
     }
 }
 
+/***********************************************************************/
+/*                         GetNextArrowArray()                         */
+/***********************************************************************/
+
+// Specialized implementation for sequential reading without filters, that
+// fills the Arrow buffers directly from the row buffers of the table,
+// without instantiating OGRFeature objects. Geometry blobs of a batch are
+// converted to WKB at the end of the batch, in worker threads when
+// GDAL_NUM_THREADS is set.
+// In other cases, fall back to generic implementation.
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!BuildLayerDefinition())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
+    if (!CanUseOptimizedGetNextArrowArray())
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    // Columns of the table to read, in increasing order, associated with
+    // their OGR field index, or -1 for the geometry column.
+    std::vector<std::pair<int, int>> anColumns;
+    bool bReadGeometry = false;
+    int iOGRIdx = 0;
+    for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount(); iGDBIdx++)
+    {
+        if (iGDBIdx == m_iGeomFieldIdx)
+        {
+            if (sHelper.m_mapOGRGeomFieldToArrowField[0] >= 0)
+            {
+                anColumns.emplace_back(iGDBIdx, -1);
+                bReadGeometry = true;
+            }
+            else if (m_eSpatialIndexState == SPI_IN_BUILDING)
+            {
+                m_eSpatialIndexState = SPI_INVALID;
+            }
+        }
+        else if (iGDBIdx != m_poLyrTable->GetObjectIdFieldIdx())
+        {
+            if (sHelper.m_mapOGRFieldToArrowField[iOGRIdx] >= 0)
+                anColumns.emplace_back(iGDBIdx, iOGRIdx);
+            iOGRIdx++;
+        }
+    }
+
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const int nTotalRecordCount = m_poLyrTable->GetTotalRecordCount();
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    std::vector<int> anRows;
+    std::vector<GByte> abyGeomBlobs;
+    std::vector<size_t> anGeomBlobOffsets{0};
+    int errorErrno = EIO;
+    bool bOK = true;
+    bool bBatchFull = false;
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize && !m_bEOF &&
+           m_iCurFeat < nTotalRecordCount)
+    {
+        const int iRow = m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+        if (iRow < 0)
+        {
+            if (m_poLyrTable->HasGotError())
+                bOK = false;
+            else
+                m_bEOF = TRUE;
+            break;
+        }
+
+        for (const auto &oColumn : anColumns)
+        {
+            const int iGDBIdx = oColumn.first;
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr && m_poLyrTable->HasGotError())
+            {
+                bOK = false;
+                break;
+            }
+
+            const int iOGRField = oColumn.second;
+            if (iOGRField < 0)
+            {
+                if (psField != nullptr)
+                {
+                    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+                    {
+                        OGREnvelope sFeatureEnvelope;
+                        if (m_poLyrTable->GetFeatureExtent(psField,
+                                                           &sFeatureEnvelope))
+                        {
+                            CPLRectObj sBounds;
+                            sBounds.minx = sFeatureEnvelope.MinX;
+                            sBounds.miny = sFeatureEnvelope.MinY;
+                            sBounds.maxx = sFeatureEnvelope.MaxX;
+                            sBounds.maxy = sFeatureEnvelope.MaxY;
+                            CPLQuadTreeInsertWithBounds(
+                                m_pQuadTree,
+                                reinterpret_cast<void *>(
+                                    static_cast<uintptr_t>(iRow)),
+                                &sBounds);
+                        }
+                    }
+                    abyGeomBlobs.insert(abyGeomBlobs.end(),
+                                        psField->Binary.paData,
+                                        psField->Binary.paData +
+                                            psField->Binary.nCount);
+                }
+                anGeomBlobOffsets.push_back(abyGeomBlobs.size());
+                continue;
+            }
+
+            const int iArrowField =
+                sHelper.m_mapOGRFieldToArrowField[iOGRField];
+            auto psArray = out_array->children[iArrowField];
+            if (psField == nullptr)
+            {
+                if (sHelper.m_abNullableFields[iOGRField])
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                    {
+                        errorErrno = ENOMEM;
+                        bOK = false;
+                        break;
+                    }
+                }
+                else if (psArray->n_buffers == 3)
+                {
+                    OGRArrowArrayHelper::SetEmptyStringOrBinary(psArray, iFeat);
+                }
+                continue;
+            }
+
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iOGRField);
+            const auto eSubType = poFieldDefn->GetSubType();
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    if (eSubType == OFSTBoolean)
+                    {
+                        if (psField->Integer)
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                    }
+                    else if (eSubType == OFSTInt16)
+                    {
+                        OGRArrowArrayHelper::SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psField->Integer));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetInt32(psArray, iFeat,
+                                                      psField->Integer);
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    OGRArrowArrayHelper::SetInt64(psArray, iFeat,
+                                                  psField->Integer64);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (eSubType == OFSTFloat32)
+                    {
+                        OGRArrowArrayHelper::SetFloat(
+                            psArray, iFeat, static_cast<float>(psField->Real));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                                       psField->Real);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    const GByte *pabyData;
+                    size_t nLen;
+                    if (poFieldDefn->GetType() == OFTString)
+                    {
+                        pabyData =
+                            reinterpret_cast<const GByte *>(psField->String);
+                        nLen = strlen(psField->String);
+                    }
+                    else
+                    {
+                        pabyData = psField->Binary.paData;
+                        nLen = static_cast<size_t>(psField->Binary.nCount);
+                    }
+                    if (iFeat > 0)
+                    {
+                        const auto panOffsets = static_cast<const int32_t *>(
+                            psArray->buffers[1]);
+                        const uint32_t nCurLength =
+                            static_cast<uint32_t>(panOffsets[iFeat]);
+                        if (nLen <= nMemLimit && nLen > nMemLimit - nCurLength)
+                        {
+                            bBatchFull = true;
+                            break;
+                        }
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        bOK = false;
+                        break;
+                    }
+                    memcpy(outPtr, pabyData, nLen);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    OGRArrowArrayHelper::SetDate(psArray, iFeat, brokenDown,
+                                                 *psField);
+                    break;
+                }
+
+                case OFTTime:
+                {
+                    OGRArrowArrayHelper::SetInt32(
+                        psArray, iFeat,
+                        psField->Date.Hour * 3600000 +
+                            psField->Date.Minute * 60000 +
+                            static_cast<int>(psField->Date.Second * 1000 +
+                                             0.5));
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        FGFT_DATETIME)
+                    {
+                        sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    }
+                    OGRArrowArrayHelper::SetDateTime(
+                        psArray, iFeat, brokenDown,
+                        sHelper.m_anTZFlags[iOGRField], sField);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+            if (!bOK || bBatchFull)
+                break;
+        }
+        if (!bOK || bBatchFull)
+            break;
+
+        anRows.push_back(iRow);
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iRow + 1;
+        m_iCurFeat = iRow + 1;
+        iFeat++;
+    }
+
+    if (bOK && bReadGeometry && iFeat > 0)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        int nThreads = 1;
+        if (pszNumThreads)
+        {
+            nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads);
+            nThreads = std::max(1, std::min(nThreads, 128));
+        }
+        // Not worth using threads on small batches
+        constexpr int MIN_FEATURES_PER_JOB = 1000;
+        const int nJobs =
+            std::max(1, std::min(nThreads, iFeat / MIN_FEATURES_PER_JOB));
+
+        const FileGDBGeomField *poGDBGeomField =
+            cpl::down_cast<const FileGDBGeomField *>(
+                m_poLyrTable->GetField(m_iGeomFieldIdx));
+        std::vector<OGROpenFileGDBWKBConversionJob> asJobs(nJobs);
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            auto &sJob = asJobs[iJob];
+            sJob.poGeomField = poGDBGeomField;
+            sJob.pabyBlobs = abyGeomBlobs.data();
+            sJob.panBlobOffsets = anGeomBlobOffsets.data();
+            sJob.iStart = static_cast<int>(static_cast<int64_t>(iFeat) *
+                                           iJob / nJobs);
+            sJob.iEnd = static_cast<int>(static_cast<int64_t>(iFeat) *
+                                         (iJob + 1) / nJobs);
+        }
+
+        CPLWorkerThreadPool *poThreadPool =
+            nJobs > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        if (poThreadPool)
+        {
+            auto poQueue = poThreadPool->CreateJobQueue();
+            for (auto &sJob : asJobs)
+            {
+                if (!poQueue->SubmitJob(ConvertGeometryBlobsToWKB, &sJob))
+                    ConvertGeometryBlobsToWKB(&sJob);
+            }
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            for (auto &sJob : asJobs)
+            {
+                sJob.poConverter = m_poGeomConverter.get();
+                ConvertGeometryBlobsToWKB(&sJob);
+            }
+        }
+
+        const int iArrowField = sHelper.m_mapOGRGeomFieldToArrowField[0];
+        auto psArray = out_array->children[iArrowField];
+        bool bTruncated = false;
+        for (const auto &sJob : asJobs)
+        {
+            if (sJob.bMemoryError)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory when converting geometries to WKB");
+                errorErrno = ENOMEM;
+                bOK = false;
+            }
+            for (int i = sJob.iStart; bOK && !bTruncated && i < sJob.iEnd; ++i)
+            {
+                const size_t nWKBOffset = sJob.anWKBOffsets[i - sJob.iStart];
+                const size_t nWKBSize =
+                    sJob.anWKBOffsets[i - sJob.iStart + 1] - nWKBOffset;
+                if (nWKBSize == 0)
+                {
+                    if (!sHelper.SetNull(iArrowField, i))
+                    {
+                        errorErrno = ENOMEM;
+                        bOK = false;
+                    }
+                    continue;
+                }
+                if (i > 0)
+                {
+                    const auto panOffsets =
+                        static_cast<const int32_t *>(psArray->buffers[1]);
+                    const uint32_t nCurLength =
+                        static_cast<uint32_t>(panOffsets[i]);
+                    if (nWKBSize <= nMemLimit &&
+                        nWKBSize > nMemLimit - nCurLength)
+                    {
+                        // Truncate the batch, and resume reading from that
+                        // feature at next call.
+                        bTruncated = true;
+                        iFeat = i;
+                        m_iCurFeat = anRows[i];
+                        m_bEOF = FALSE;
+                        if (m_eSpatialIndexState == SPI_IN_BUILDING)
+                            m_eSpatialIndexState = SPI_INVALID;
+                        break;
+                    }
+                }
+                GByte *outPtr =
+                    sHelper.GetPtrForStringOrBinary(iArrowField, i, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    errorErrno = ENOMEM;
+                    bOK = false;
+                    break;
+                }
+                memcpy(outPtr, sJob.abyWKB.data() + nWKBOffset, nWKBSize);
+            }
+            if (!bOK || bTruncated)
+                break;
+        }
+    }
+
+    if (!bOK)
+    {
+        sHelper.ClearArray();
+        return errorErrno;
+    }
+
+    if (m_eSpatialIndexState == SPI_IN_BUILDING &&
+        m_iCurFeat == nTotalRecordCount)
+    {
+        CPLDebug("OpenFileGDB", "SPI_COMPLETED");
+        m_eSpatialIndexState = SPI_COMPLETED;
+    }
+
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
+    {
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+    }
+
+    return 0;
+}
+
+/***********************************************************************/
+/*                          GetMetadataItem()                          */
+/***********************************************************************/
+
+const char *OGROpenFileGDBLayer::GetMetadataItem(const char *pszName,
+                                                 const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
@@ -2304,6 +2912,11 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap)
     else if (EQUAL(pszCap, OLCZGeometries))
         return TRUE;
 
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+    {
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+    }
+
     else if (EQUAL(pszCap, OLCFastSpatialFilter))
     {
         return m_eSpatialIndexState == SPI_COMPLETED ||
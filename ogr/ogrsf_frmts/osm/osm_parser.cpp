@@ -36,6 +36,7 @@
 #include <cstring>
 #include <algorithm>
 #include <exception>
+#include <new>
 #include <string>
 #include <vector>
 
@@ -123,6 +124,8 @@ typedef struct
     bool bStatus;
 } DecompressionJob;
 
+struct OSMDecodedBlock;
+
 struct _OSMContext
 {
     char *pszStrBuf;
@@ -166,6 +169,11 @@ struct _OSMContext
     int nJobs;
     int iNextJob;
 
+    // Slots for the parallel decoding of PrimitiveBlocks. Null when
+    // decoding is done in the main thread.
+    OSMDecodedBlock *pasDecodedBlocks;
+    int nDecodedBlocks;
+
 #ifdef HAVE_EXPAT
     XML_Parser hXMLParser;
     bool bEOF;
@@ -1699,6 +1707,223 @@ static bool ProcessSingleBlob(OSMContext *psCtxt, DecompressionJob &sJob,
     }
 }
 
+/************************************************************************/
+/*                           OSMDecodedBlock                            */
+/************************************************************************/
+
+typedef enum
+{
+    DECODED_NODES,
+    DECODED_WAY,
+    DECODED_RELATION
+} DecodedEventType;
+
+typedef struct
+{
+    DecodedEventType eType;
+    size_t nIdx;  // in asNodes, asWays or asRelations
+    unsigned int nCount;
+} DecodedEvent;
+
+// Notifications emitted by ReadPrimitiveBlock() when run from a worker
+// thread. They are replayed in order from the main thread, so that the user
+// callbacks see exactly the same sequence as with serial decoding.
+// Strings still point into the uncompressed buffer of the block.
+struct OSMDecodedBlock
+{
+    OSMContext *psCtxt = nullptr;
+    const DecompressionJob *psJob = nullptr;
+    bool bStatus = false;
+
+    std::vector<DecodedEvent> asEvents{};
+    std::vector<OSMNode> asNodes{};
+    std::vector<OSMWay> asWays{};
+    std::vector<OSMRelation> asRelations{};
+    std::vector<OSMTag> asTags{};
+    std::vector<GIntBig> anNodeRefs{};
+    std::vector<OSMMember> asMembers{};
+};
+
+static void RecordNodesFunc(unsigned int nNodes, OSMNode *pasNodes,
+                            OSMContext * /* psCtxt */, void *user_data)
+{
+    OSMDecodedBlock *psBlock = static_cast<OSMDecodedBlock *>(user_data);
+    psBlock->asEvents.push_back(
+        DecodedEvent{DECODED_NODES, psBlock->asNodes.size(), nNodes});
+    for (unsigned int i = 0; i < nNodes; i++)
+    {
+        psBlock->asNodes.push_back(pasNodes[i]);
+        psBlock->asTags.insert(psBlock->asTags.end(), pasNodes[i].pasTags,
+                               pasNodes[i].pasTags + pasNodes[i].nTags);
+    }
+}
+
+static void RecordWayFunc(OSMWay *psWay, OSMContext * /* psCtxt */,
+                          void *user_data)
+{
+    OSMDecodedBlock *psBlock = static_cast<OSMDecodedBlock *>(user_data);
+    psBlock->asEvents.push_back(
+        DecodedEvent{DECODED_WAY, psBlock->asWays.size(), 1});
+    psBlock->asWays.push_back(*psWay);
+    psBlock->asTags.insert(psBlock->asTags.end(), psWay->pasTags,
+                           psWay->pasTags + psWay->nTags);
+    psBlock->anNodeRefs.insert(psBlock->anNodeRefs.end(), psWay->panNodeRefs,
+                               psWay->panNodeRefs + psWay->nRefs);
+}
+
+static void RecordRelationFunc(OSMRelation *psRelation,
+                               OSMContext * /* psCtxt */, void *user_data)
+{
+    OSMDecodedBlock *psBlock = static_cast<OSMDecodedBlock *>(user_data);
+    psBlock->asEvents.push_back(
+        DecodedEvent{DECODED_RELATION, psBlock->asRelations.size(), 1});
+    psBlock->asRelations.push_back(*psRelation);
+    psBlock->asTags.insert(psBlock->asTags.end(), psRelation->pasTags,
+                           psRelation->pasTags + psRelation->nTags);
+    psBlock->asMembers.insert(psBlock->asMembers.end(),
+                              psRelation->pasMembers,
+                              psRelation->pasMembers + psRelation->nMembers);
+}
+
+/************************************************************************/
+/*                           DecodeFunction()                           */
+/************************************************************************/
+
+static void DecodeFunction(void *pDataIn)
+{
+    OSMDecodedBlock *psBlock = static_cast<OSMDecodedBlock *>(pDataIn);
+    const DecompressionJob *psJob = psBlock->psJob;
+
+    psBlock->asEvents.clear();
+    psBlock->asNodes.clear();
+    psBlock->asWays.clear();
+    psBlock->asRelations.clear();
+    psBlock->asTags.clear();
+    psBlock->anNodeRefs.clear();
+    psBlock->asMembers.clear();
+
+    psBlock->bStatus = ReadPrimitiveBlock(
+        psJob->pabyDstBase + psJob->nDstOffset,
+        psJob->pabyDstBase + psJob->nDstOffset + psJob->nDstSize,
+        psBlock->psCtxt);
+    if (!psBlock->bStatus)
+        return;
+
+    // Now that the arrays will no longer grow, make the pointers of the
+    // recorded objects point into them.
+    size_t iTag = 0;
+    size_t iNodeRef = 0;
+    size_t iMember = 0;
+    for (const auto &sEvent : psBlock->asEvents)
+    {
+        if (sEvent.eType == DECODED_NODES)
+        {
+            for (unsigned int i = 0; i < sEvent.nCount; i++)
+            {
+                OSMNode &sNode = psBlock->asNodes[sEvent.nIdx + i];
+                sNode.pasTags = psBlock->asTags.data() + iTag;
+                iTag += sNode.nTags;
+            }
+        }
+        else if (sEvent.eType == DECODED_WAY)
+        {
+            OSMWay &sWay = psBlock->asWays[sEvent.nIdx];
+            sWay.pasTags = psBlock->asTags.data() + iTag;
+            iTag += sWay.nTags;
+            sWay.panNodeRefs = psBlock->anNodeRefs.data() + iNodeRef;
+            iNodeRef += sWay.nRefs;
+        }
+        else
+        {
+            OSMRelation &sRelation = psBlock->asRelations[sEvent.nIdx];
+            sRelation.pasTags = psBlock->asTags.data() + iTag;
+            iTag += sRelation.nTags;
+            sRelation.pasMembers = psBlock->asMembers.data() + iMember;
+            iMember += sRelation.nMembers;
+        }
+    }
+}
+
+/************************************************************************/
+/*                        SubmitDecodingJobs()                          */
+/************************************************************************/
+
+static void SubmitDecodingJobs(OSMContext *psCtxt, int iFirstJob,
+                               int nJobCount)
+{
+    std::vector<void *> ahJobs;
+    for (int i = iFirstJob; i < psCtxt->nJobs && i < iFirstJob + nJobCount;
+         i++)
+    {
+        OSMDecodedBlock *psBlock =
+            &psCtxt->pasDecodedBlocks[i % psCtxt->nDecodedBlocks];
+        psBlock->psJob = &psCtxt->asJobs[i];
+        psBlock->bStatus = false;
+        ahJobs.push_back(psBlock);
+    }
+    if (!ahJobs.empty())
+        psCtxt->poWTP->SubmitJobs(DecodeFunction, ahJobs);
+}
+
+/************************************************************************/
+/*                           ProcessNextBlob()                          */
+/************************************************************************/
+
+// Process the blob of index iNextJob, and increment iNextJob.
+// When parallel decoding is enabled, blobs are decoded by windows of
+// nDecodedBlocks / 2 blobs: while the notifications of a window are
+// replayed, the next window is decoded by the worker threads.
+static bool ProcessNextBlob(OSMContext *psCtxt, BlobType eType)
+{
+    const int iJob = psCtxt->iNextJob;
+    psCtxt->iNextJob++;
+    if (psCtxt->pasDecodedBlocks == nullptr || eType != BLOB_OSMDATA)
+    {
+        return ProcessSingleBlob(psCtxt, psCtxt->asJobs[iJob], eType);
+    }
+
+    const int nWindow = psCtxt->nDecodedBlocks / 2;
+    if (iJob == 0)
+    {
+        SubmitDecodingJobs(psCtxt, 0, nWindow);
+    }
+    if ((iJob % nWindow) == 0)
+    {
+        psCtxt->poWTP->WaitCompletion();
+        SubmitDecodingJobs(psCtxt, iJob + nWindow, nWindow);
+    }
+
+    const OSMDecodedBlock *psBlock =
+        &psCtxt->pasDecodedBlocks[iJob % psCtxt->nDecodedBlocks];
+    CPLAssert(psBlock->psJob == &psCtxt->asJobs[iJob]);
+    if (!psBlock->bStatus)
+        return false;
+
+    for (const auto &sEvent : psBlock->asEvents)
+    {
+        if (sEvent.eType == DECODED_NODES)
+        {
+            psCtxt->pfnNotifyNodes(
+                sEvent.nCount,
+                const_cast<OSMNode *>(&psBlock->asNodes[sEvent.nIdx]), psCtxt,
+                psCtxt->user_data);
+        }
+        else if (sEvent.eType == DECODED_WAY)
+        {
+            psCtxt->pfnNotifyWay(
+                const_cast<OSMWay *>(&psBlock->asWays[sEvent.nIdx]), psCtxt,
+                psCtxt->user_data);
+        }
+        else
+        {
+            psCtxt->pfnNotifyRelation(
+                const_cast<OSMRelation *>(&psBlock->asRelations[sEvent.nIdx]),
+                psCtxt, psCtxt->user_data);
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                   RunDecompressionJobsAndProcessAll()                */
 /************************************************************************/
@@ -1710,9 +1935,10 @@ static bool RunDecompressionJobsAndProcessAll(OSMContext *psCtxt,
     {
         return false;
     }
-    for (int i = 0; i < psCtxt->nJobs; i++)
+    psCtxt->iNextJob = 0;
+    while (psCtxt->iNextJob < psCtxt->nJobs)
     {
-        if (!ProcessSingleBlob(psCtxt, psCtxt->asJobs[i], eType))
+        if (!ProcessNextBlob(psCtxt, eType))
         {
             return false;
         }
@@ -1859,9 +2085,9 @@ static bool ReadBlob(OSMContext *psCtxt, BlobType eType)
                     else
                     {
                         // Make sure that uncompressed blobs are separated by
-                        // EXTRA_BYTES in the case where in the future we would
-                        // implement parallel decoding of them (not sure if
-                        // that's doable)
+                        // EXTRA_BYTES, as they are decoded in parallel and
+                        // ReadStringTable() may write a NUL byte just after
+                        // the end of a blob.
                         psCtxt->nTotalUncompressedSize +=
                             nUncompressedSize + EXTRA_BYTES;
                     }
@@ -1886,11 +2112,11 @@ static bool ReadBlob(OSMContext *psCtxt, BlobType eType)
                 THROW_OSM_PARSING_EXCEPTION;
             }
             // Just process one blob at a time
-            if (!ProcessSingleBlob(psCtxt, psCtxt->asJobs[0], eType))
+            psCtxt->iNextJob = 0;
+            if (!ProcessNextBlob(psCtxt, eType))
             {
                 THROW_OSM_PARSING_EXCEPTION;
             }
-            psCtxt->iNextJob = 1;
         }
 
         psCtxt->nBlobOffset =
@@ -1913,12 +2139,10 @@ static OSMRetCode PBF_ProcessBlock(OSMContext *psCtxt)
     // Process any remaining queued jobs one by one
     if (psCtxt->iNextJob < psCtxt->nJobs)
     {
-        if (!(ProcessSingleBlob(psCtxt, psCtxt->asJobs[psCtxt->iNextJob],
-                                BLOB_OSMDATA)))
+        if (!ProcessNextBlob(psCtxt, BLOB_OSMDATA))
         {
             return OSM_ERROR;
         }
-        psCtxt->iNextJob++;
         return OSM_OK;
     }
     psCtxt->iNextJob = 0;
@@ -2783,6 +3007,37 @@ OSMContext *OSM_Open(const char *pszFilename, NotifyNodesFunc pfnNotifyNodes,
         }
     }
 
+    if (bPBF && psCtxt->poWTP &&
+        CPLTestBool(CPLGetConfigOption("OSM_PARALLEL_DECODING", "YES")))
+    {
+        const int nDecodedBlocks = 2 * psCtxt->poWTP->GetThreadCount();
+        psCtxt->pasDecodedBlocks =
+            new (std::nothrow) OSMDecodedBlock[nDecodedBlocks];
+        if (psCtxt->pasDecodedBlocks == nullptr)
+        {
+            OSM_Close(psCtxt);
+            return nullptr;
+        }
+        psCtxt->nDecodedBlocks = nDecodedBlocks;
+        for (int i = 0; i < nDecodedBlocks; i++)
+        {
+            OSMContext *psDecodingCtxt = static_cast<OSMContext *>(
+                VSI_CALLOC_VERBOSE(1, sizeof(OSMContext)));
+            if (psDecodingCtxt == nullptr)
+            {
+                OSM_Close(psCtxt);
+                return nullptr;
+            }
+            psDecodingCtxt->bPBF = true;
+            psDecodingCtxt->pfnNotifyNodes = RecordNodesFunc;
+            psDecodingCtxt->pfnNotifyWay = RecordWayFunc;
+            psDecodingCtxt->pfnNotifyRelation = RecordRelationFunc;
+            psDecodingCtxt->pfnNotifyBounds = EmptyNotifyBoundsFunc;
+            psDecodingCtxt->user_data = &psCtxt->pasDecodedBlocks[i];
+            psCtxt->pasDecodedBlocks[i].psCtxt = psDecodingCtxt;
+        }
+    }
+
     return psCtxt;
 }
 
@@ -2805,6 +3060,24 @@ void OSM_Close(OSMContext *psCtxt)
     }
 #endif
 
+    // Wait for any pending decoding job before freeing its buffers
+    if (psCtxt->poWTP)
+        psCtxt->poWTP->WaitCompletion();
+    for (int i = 0; i < psCtxt->nDecodedBlocks; i++)
+    {
+        OSMContext *psDecodingCtxt = psCtxt->pasDecodedBlocks[i].psCtxt;
+        if (psDecodingCtxt)
+        {
+            VSIFree(psDecodingCtxt->panStrOff);
+            VSIFree(psDecodingCtxt->pasNodes);
+            VSIFree(psDecodingCtxt->pasTags);
+            VSIFree(psDecodingCtxt->pasMembers);
+            VSIFree(psDecodingCtxt->panNodeRefs);
+            VSIFree(psDecodingCtxt);
+        }
+    }
+    delete[] psCtxt->pasDecodedBlocks;
+
     VSIFree(psCtxt->pabyBlob);
     VSIFree(psCtxt->pabyBlobHeader);
     VSIFree(psCtxt->pabyUncompressed);
@@ -2825,6 +3098,11 @@ void OSM_Close(OSMContext *psCtxt)
 
 void OSM_ResetReading(OSMContext *psCtxt)
 {
+    // Wait for any pending decoding job, before the buffers it reads from
+    // are reused
+    if (psCtxt->poWTP)
+        psCtxt->poWTP->WaitCompletion();
+
     VSIFSeekL(psCtxt->fp, 0, SEEK_SET);
 
     psCtxt->nBytesRead = 0;
@@ -62,6 +62,12 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
     bool DealWithGeometryColumn(
         int iFieldIdx, const std::shared_ptr<arrow::Field> &field,
         std::function<OGRwkbGeometryType(void)> computeGeometryTypeFun);
+    static bool ParseGeometryColumnCovering(const CPLJSONObject &oJSONDef,
+                                            std::string &osBBOXColumn,
+                                            std::string &osXMin,
+                                            std::string &osYMin,
+                                            std::string &osXMax,
+                                            std::string &osYMax);
 
   public:
     int TestCapability(const char *) override;
@@ -123,6 +129,14 @@ class OGRParquetLayer final : public OGRParquetLayerBase
         const std::map<std::string, int> &oMapParquetColumnNameToIdx);
     bool CreateRecordBatchReader(int iStartingRowGroup);
     bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
+    bool GetLateMaterializationColumns(
+        std::vector<int> &anParquetCols,
+        std::vector<std::pair<int, std::string>> &aoArrayIdxAndName) const;
+    bool RowGroupHasMatchingRows(
+        int iRowGroup, int64_t nFeatureIdxStart,
+        const std::vector<int> &anParquetCols,
+        const std::vector<std::pair<int, std::string>> &aoArrayIdxAndName)
+        const;
     bool ReadNextBatch() override;
 
     void InvalidateCachedBatches() override;
@@ -225,6 +239,10 @@ class OGRParquetDatasetLayer final : public OGRParquetLayerBase
     std::shared_ptr<arrow::dataset::Scanner> m_poScanner{};
 
     void EstablishFeatureDefn();
+    void ProcessGeometryColumnCovering(
+        const std::shared_ptr<arrow::Field> &field,
+        const CPLJSONObject &oJSONGeometryColumn);
+    std::shared_ptr<arrow::dataset::Scanner> BuildScanner() const;
 
   protected:
     std::string GetDriverUCName() const override
@@ -304,6 +322,11 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     OGRLayer *m_poTmpGPKGLayer = nullptr;
     //! Number of features written by ICreateFeature(). Only used in SORT_BY_BBOX mode
     GIntBig m_nTmpFeatureCount = 0;
+    //! Whether features are sorted along a Hilbert curve rather than by
+    //! walking the RTree. Only used in SORT_BY_BBOX mode
+    bool m_bSortByHilbert = false;
+    //! Whether columns of row groups are encoded in parallel
+    bool m_bUseThreads = false;
 
     virtual bool IsFileWriterCreated() const override
     {
@@ -339,6 +362,7 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
 
     //! Copy temporary GeoPackage layer to final Parquet file
     bool CopyTmpGpkgLayerToFinalFile();
+    bool CreateTmpGpkgHilbertKeyTable();
 
   public:
     OGRParquetWriterLayer(
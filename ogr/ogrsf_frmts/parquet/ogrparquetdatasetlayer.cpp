@@ -69,6 +69,26 @@ void OGRParquetDatasetLayer::EstablishFeatureDefn()
 
     LoadGDALMetadata(kv_metadata.get());
 
+    const bool bUseBBOX = CPLTestBool(CPLGetConfigOption(
+        ("OGR_" + GetDriverUCName() + "_USE_BBOX").c_str(), "YES"));
+
+    // Keep track of declared bounding box columns in GeoParquet JSON metadata,
+    // in order not to expose them as regular fields.
+    std::set<std::string> oSetBBOXColumns;
+    if (bUseBBOX)
+    {
+        for (const auto &iter : m_oMapGeometryColumns)
+        {
+            std::string osBBOXColumn;
+            std::string osXMin, osYMin, osXMax, osYMax;
+            if (ParseGeometryColumnCovering(iter.second, osBBOXColumn, osXMin,
+                                            osYMin, osXMax, osYMax))
+            {
+                oSetBBOXColumns.insert(osBBOXColumn);
+            }
+        }
+    }
+
     const auto &fields = m_poSchema->fields();
     for (int i = 0; i < m_poSchema->num_fields(); ++i)
     {
@@ -80,9 +100,23 @@ void OGRParquetDatasetLayer::EstablishFeatureDefn()
             continue;
         }
 
+        if (oSetBBOXColumns.find(field->name()) != oSetBBOXColumns.end())
+        {
+            m_oSetBBoxArrowColumns.insert(i);
+            continue;
+        }
+
         const bool bGeometryField =
             DealWithGeometryColumn(i, field, []() { return wkbUnknown; });
-        if (!bGeometryField)
+        if (bGeometryField)
+        {
+            const auto oIter = m_oMapGeometryColumns.find(field->name());
+            if (bUseBBOX && oIter != m_oMapGeometryColumns.end())
+            {
+                ProcessGeometryColumnCovering(field, oIter->second);
+            }
+        }
+        else
         {
             CreateFieldFromSchema(field, {i},
                                   oMapFieldNameToGDALSchemaFieldDefn);
@@ -95,6 +129,141 @@ void OGRParquetDatasetLayer::EstablishFeatureDefn()
               m_poFeatureDefn->GetGeomFieldCount());
 }
 
+/************************************************************************/
+/*                  ProcessGeometryColumnCovering()                     */
+/************************************************************************/
+
+/** Process GeoParquet JSON geometry field object to extract information about
+ * its bounding box column, and appropriately fill
+ * m_oMapGeomFieldIndexToGeomColBBOX with information on that bounding box
+ * column.
+ */
+void OGRParquetDatasetLayer::ProcessGeometryColumnCovering(
+    const std::shared_ptr<arrow::Field> &field,
+    const CPLJSONObject &oJSONGeometryColumn)
+{
+    std::string osBBOXColumn;
+    std::string osXMin, osYMin, osXMax, osYMax;
+    if (!ParseGeometryColumnCovering(oJSONGeometryColumn, osBBOXColumn, osXMin,
+                                     osYMin, osXMax, osYMax))
+    {
+        return;
+    }
+
+    OGRArrowLayer::GeomColBBOX sDesc;
+    sDesc.iArrowCol = m_poSchema->GetFieldIndex(osBBOXColumn);
+    const auto fieldBBOX = m_poSchema->GetFieldByName(osBBOXColumn);
+    if (sDesc.iArrowCol < 0 || !fieldBBOX ||
+        fieldBBOX->type()->id() != arrow::Type::STRUCT)
+    {
+        return;
+    }
+
+    const auto fieldBBOXStruct =
+        std::static_pointer_cast<arrow::StructType>(fieldBBOX->type());
+    const auto fieldXMin = fieldBBOXStruct->GetFieldByName(osXMin);
+    const auto fieldYMin = fieldBBOXStruct->GetFieldByName(osYMin);
+    const auto fieldXMax = fieldBBOXStruct->GetFieldByName(osXMax);
+    const auto fieldYMax = fieldBBOXStruct->GetFieldByName(osYMax);
+    const int nXMinIdx = fieldBBOXStruct->GetFieldIndex(osXMin);
+    const int nYMinIdx = fieldBBOXStruct->GetFieldIndex(osYMin);
+    const int nXMaxIdx = fieldBBOXStruct->GetFieldIndex(osXMax);
+    const int nYMaxIdx = fieldBBOXStruct->GetFieldIndex(osYMax);
+    if (nXMinIdx >= 0 && nYMinIdx >= 0 && nXMaxIdx >= 0 && nYMaxIdx >= 0 &&
+        fieldXMin && fieldYMin && fieldXMax && fieldYMax &&
+        (fieldXMin->type()->id() == arrow::Type::FLOAT ||
+         fieldXMin->type()->id() == arrow::Type::DOUBLE) &&
+        fieldXMin->type()->id() == fieldYMin->type()->id() &&
+        fieldXMin->type()->id() == fieldXMax->type()->id() &&
+        fieldXMin->type()->id() == fieldYMax->type()->id())
+    {
+        CPLDebug("PARQUET",
+                 "Bounding box column '%s' detected for "
+                 "geometry column '%s'",
+                 osBBOXColumn.c_str(), field->name().c_str());
+        sDesc.iArrowSubfieldXMin = nXMinIdx;
+        sDesc.iArrowSubfieldYMin = nYMinIdx;
+        sDesc.iArrowSubfieldXMax = nXMaxIdx;
+        sDesc.iArrowSubfieldYMax = nYMaxIdx;
+        sDesc.bIsFloat = (fieldXMin->type()->id() == arrow::Type::FLOAT);
+
+        m_oMapGeomFieldIndexToGeomColBBOX
+            [m_poFeatureDefn->GetGeomFieldCount() - 1] = std::move(sDesc);
+    }
+}
+
+/************************************************************************/
+/*                           BuildScanner()                             */
+/************************************************************************/
+
+/** Return the scanner to read features with.
+ *
+ * When a spatial filter is set and the geometry column has a bounding box
+ * covering column, the bounding box of the filter is pushed down as a filter
+ * expression on that column, so that Arrow Dataset can skip fragments and
+ * row groups from their statistics, and only returns rows whose bounding box
+ * intersects it.
+ */
+std::shared_ptr<arrow::dataset::Scanner>
+OGRParquetDatasetLayer::BuildScanner() const
+{
+#if ARROW_VERSION_MAJOR >= 8
+    // Features are numbered sequentially when there is no FID column, so
+    // filtering rows out before they reach us would change their FID.
+    if (!m_poFilterGeom || m_iFIDArrowColumn < 0 ||
+        !CPLTestBool(CPLGetConfigOption(
+            ("OGR_" + GetDriverUCName() + "_USE_BBOX").c_str(), "YES")))
+    {
+        return m_poScanner;
+    }
+
+    const auto oIter =
+        m_oMapGeomFieldIndexToGeomColBBOX.find(m_iGeomFieldFilter);
+    if (oIter == m_oMapGeomFieldIndexToGeomColBBOX.end())
+        return m_poScanner;
+
+    const auto &sDesc = oIter->second;
+    const auto &fieldBBOX = m_poSchema->field(sDesc.iArrowCol);
+    const auto fieldBBOXStruct =
+        std::static_pointer_cast<arrow::StructType>(fieldBBOX->type());
+    const auto GetRef = [&fieldBBOX, &fieldBBOXStruct](int iSubField)
+    {
+        return arrow::compute::field_ref(arrow::FieldRef(
+            fieldBBOX->name(), fieldBBOXStruct->field(iSubField)->name()));
+    };
+
+    const auto oFilter = arrow::compute::and_(
+        {arrow::compute::less_equal(
+             GetRef(sDesc.iArrowSubfieldXMin),
+             arrow::compute::literal(m_sFilterEnvelope.MaxX)),
+         arrow::compute::less_equal(
+             GetRef(sDesc.iArrowSubfieldYMin),
+             arrow::compute::literal(m_sFilterEnvelope.MaxY)),
+         arrow::compute::greater_equal(
+             GetRef(sDesc.iArrowSubfieldXMax),
+             arrow::compute::literal(m_sFilterEnvelope.MinX)),
+         arrow::compute::greater_equal(
+             GetRef(sDesc.iArrowSubfieldYMax),
+             arrow::compute::literal(m_sFilterEnvelope.MinY))});
+
+    arrow::dataset::ScannerBuilder oBuilder(
+        m_poScanner->dataset(),
+        std::make_shared<arrow::dataset::ScanOptions>(
+            *(m_poScanner->options())));
+    auto status = oBuilder.Filter(oFilter);
+    if (status.ok())
+    {
+        auto result = oBuilder.Finish();
+        if (result.ok())
+            return *result;
+        status = result.status();
+    }
+    CPLDebug("PARQUET", "Cannot push down spatial filter: %s",
+             status.message().c_str());
+#endif
+    return m_poScanner;
+}
+
 /************************************************************************/
 /*                           ResetReading()                             */
 /************************************************************************/
@@ -115,7 +284,7 @@ bool OGRParquetDatasetLayer::ReadNextBatch()
 
     if (m_poRecordBatchReader == nullptr)
     {
-        auto result = m_poScanner->ToRecordBatchReader();
+        auto result = BuildScanner()->ToRecordBatchReader();
         if (!result.ok())
         {
             CPLError(CE_Failure, CPLE_AppDefined,
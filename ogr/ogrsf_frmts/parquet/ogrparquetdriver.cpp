@@ -27,6 +27,7 @@
  ****************************************************************************/
 
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ogrsf_frmts.h"
 
 #include <algorithm>
@@ -290,6 +291,9 @@ static GDALDataset *OpenFromDatasetFactory(
             nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
                               ? CPLGetNumCPUs()
                               : atoi(pszNumThreads);
+        // The Arrow CPU thread pool is process-wide: cap it to the budget
+        if (GDALGetThreadBudget() > 0)
+            nNumThreads = std::min(nNumThreads, GDALGetThreadBudget());
         if (nNumThreads > 1)
         {
             CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
@@ -930,11 +934,14 @@ void OGRParquetDriver::InitMetadata()
     {
         auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
         CPLAddXMLAttributeAndValue(psOption, "name", "SORT_BY_BBOX");
-        CPLAddXMLAttributeAndValue(psOption, "type", "boolean");
+        CPLAddXMLAttributeAndValue(psOption, "type", "string-select");
         CPLAddXMLAttributeAndValue(psOption, "default", "NO");
         CPLAddXMLAttributeAndValue(psOption, "description",
                                    "Whether features should be sorted based on "
                                    "the bounding box of their geometries");
+        CPLCreateXMLElementAndValue(psOption, "Value", "YES");
+        CPLCreateXMLElementAndValue(psOption, "Value", "NO");
+        CPLCreateXMLElementAndValue(psOption, "Value", "HILBERT");
     }
 
     char *pszXML = CPLSerializeXMLTree(oTree.get());
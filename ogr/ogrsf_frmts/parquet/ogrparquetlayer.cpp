@@ -30,6 +30,7 @@
 #include "cpl_time.h"
 #include "cpl_multiproc.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
 
@@ -122,12 +123,11 @@ void OGRParquetLayerBase::LoadGeoMetadata(
 /************************************************************************/
 
 //! Parse bounding box column definition
-static bool ParseGeometryColumnCovering(const CPLJSONObject &oJSONDef,
-                                        std::string &osBBOXColumn,
-                                        std::string &osXMin,
-                                        std::string &osYMin,
-                                        std::string &osXMax,
-                                        std::string &osYMax)
+/* static */
+bool OGRParquetLayerBase::ParseGeometryColumnCovering(
+    const CPLJSONObject &oJSONDef, std::string &osBBOXColumn,
+    std::string &osXMin, std::string &osYMin, std::string &osXMax,
+    std::string &osYMax)
 {
     const auto oCovering = oJSONDef["covering"];
     if (oCovering.IsValid() &&
@@ -483,6 +483,9 @@ OGRParquetLayer::OGRParquetLayer(
     else
         nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
                                                        : atoi(pszNumThreads);
+    // The Arrow CPU thread pool is process-wide: cap it to the thread budget
+    if (GDALGetThreadBudget() > 0)
+        nNumThreads = std::min(nNumThreads, GDALGetThreadBudget());
     if (nNumThreads > 1)
     {
         CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
@@ -1387,6 +1390,127 @@ void OGRParquetLayer::IncrFeatureIdx()
     }
 }
 
+/************************************************************************/
+/*                 GetLateMaterializationColumns()                      */
+/************************************************************************/
+
+/** Return the Parquet columns needed to evaluate the attribute filter
+ * constraints, and for each of them the index of the array it feeds in
+ * SkipToNextFeatureDueToAttributeFilter() and its Arrow field name.
+ *
+ * Returns false when decoding those columns first would not save anything
+ * over decoding all requested columns.
+ */
+bool OGRParquetLayer::GetLateMaterializationColumns(
+    std::vector<int> &anParquetCols,
+    std::vector<std::pair<int, std::string>> &aoArrayIdxAndName) const
+{
+    if (m_asAttributeFilterConstraints.empty() ||
+        !CPLTestBool(
+            CPLGetConfigOption("OGR_PARQUET_LATE_MATERIALIZATION", "YES")))
+    {
+        return false;
+    }
+
+    for (const auto &constraint : m_asAttributeFilterConstraints)
+    {
+        if (constraint.iArrayIdx < 0)
+            continue;
+        int iParquetCol = -1;
+        std::string osArrowName;
+        if (constraint.iField == m_poFeatureDefn->GetFieldCount() + SPF_FID)
+        {
+            iParquetCol = m_iFIDParquetColumn;
+            osArrowName = m_osFIDColumn;
+        }
+        else if (constraint.iField >= 0 &&
+                 constraint.iField < m_poFeatureDefn->GetFieldCount() &&
+                 m_anMapFieldIndexToArrowColumn[constraint.iField].size() == 1)
+        {
+            const auto &field = m_poSchema->field(
+                m_anMapFieldIndexToArrowColumn[constraint.iField][0]);
+            // Only top-level primitive columns map to a single Parquet one
+            if (field->type()->num_fields() == 0)
+            {
+                iParquetCol =
+                    m_anMapFieldIndexToParquetColumn[constraint.iField];
+                osArrowName = field->name();
+            }
+        }
+        if (iParquetCol < 0)
+            return false;
+        if (std::find(anParquetCols.begin(), anParquetCols.end(),
+                      iParquetCol) == anParquetCols.end())
+        {
+            anParquetCols.push_back(iParquetCol);
+        }
+        aoArrayIdxAndName.emplace_back(constraint.iArrayIdx,
+                                       std::move(osArrowName));
+    }
+
+    const size_t nReadCols =
+        m_bIgnoredFields
+            ? m_anRequestedParquetColumns.size()
+            : static_cast<size_t>(m_poArrowReader->parquet_reader()
+                                      ->metadata()
+                                      ->schema()
+                                      ->num_columns());
+    return !anParquetCols.empty() && anParquetCols.size() < nReadCols;
+}
+
+/************************************************************************/
+/*                      RowGroupHasMatchingRows()                       */
+/************************************************************************/
+
+/** Decode only the columns returned by GetLateMaterializationColumns() for
+ * a row group, and return whether at least one of its rows passes the
+ * attribute filter constraints.
+ *
+ * Errors are not reported here, and the row group is then kept, so that
+ * the regular reading code path deals with them.
+ */
+bool OGRParquetLayer::RowGroupHasMatchingRows(
+    int iRowGroup, int64_t nFeatureIdxStart,
+    const std::vector<int> &anParquetCols,
+    const std::vector<std::pair<int, std::string>> &aoArrayIdxAndName) const
+{
+    std::shared_ptr<arrow::RecordBatchReader> poReader;
+    auto status = m_poArrowReader->GetRecordBatchReader(
+        {iRowGroup}, anParquetCols, &poReader);
+    if (poReader == nullptr)
+        return true;
+
+    std::vector<std::shared_ptr<arrow::Array>> apoColumns;
+    int64_t nFeatureIdx = nFeatureIdxStart;
+    while (true)
+    {
+        std::shared_ptr<arrow::RecordBatch> poBatch;
+        status = poReader->ReadNext(&poBatch);
+        if (!status.ok())
+            return true;
+        if (poBatch == nullptr)
+            return false;
+
+        apoColumns.clear();
+        for (const auto &[iArrayIdx, osArrowName] : aoArrayIdxAndName)
+        {
+            if (static_cast<size_t>(iArrayIdx) >= apoColumns.size())
+                apoColumns.resize(iArrayIdx + 1);
+            apoColumns[iArrayIdx] = poBatch->GetColumnByName(osArrowName);
+            if (apoColumns[iArrayIdx] == nullptr)
+                return true;
+        }
+
+        const int64_t nRows = poBatch->num_rows();
+        for (int64_t i = 0; i < nRows; ++i, ++nFeatureIdx)
+        {
+            if (!SkipToNextFeatureDueToAttributeFilter(apoColumns, i,
+                                                       nFeatureIdx))
+                return true;
+        }
+    }
+}
+
 /************************************************************************/
 /*                           ReadNextBatch()                            */
 /************************************************************************/
@@ -1745,6 +1869,57 @@ bool OGRParquetLayer::ReadNextBatch()
 
                 nFeatureIdxTotal += poRowGroup->metadata()->num_rows();
             }
+
+            // Late materialization: decode first only the columns used by
+            // the attribute filter, and skip the row groups where no row
+            // matches it, before decoding all the requested columns.
+            std::vector<int> anFilterParquetCols;
+            std::vector<std::pair<int, std::string>> aoFilterArrayIdxAndName;
+            if (GetLateMaterializationColumns(anFilterParquetCols,
+                                              aoFilterArrayIdxAndName))
+            {
+                const auto metadata =
+                    m_poArrowReader->parquet_reader()->metadata();
+                if (bIterateEverything)
+                {
+                    bIterateEverything = false;
+                    anSelectedGroups.clear();
+                    m_asFeatureIdxRemapping.clear();
+                    nFeatureIdxTotal = 0;
+                    for (int iRowGroup = 0; iRowGroup < nNumGroups;
+                         ++iRowGroup)
+                    {
+                        m_asFeatureIdxRemapping.emplace_back(
+                            std::make_pair(nFeatureIdxTotal, nFeatureIdxTotal));
+                        anSelectedGroups.push_back(iRowGroup);
+                        nFeatureIdxTotal +=
+                            metadata->RowGroup(iRowGroup)->num_rows();
+                    }
+                }
+
+                std::vector<int> anMatchingGroups;
+                std::vector<std::pair<int64_t, int64_t>> asMatchingRemapping;
+                nFeatureIdxSelected = 0;
+                for (size_t i = 0; i < anSelectedGroups.size(); ++i)
+                {
+                    const int iRowGroup = anSelectedGroups[i];
+                    const int64_t nFeatureIdxStart =
+                        m_asFeatureIdxRemapping[i].second;
+                    if (RowGroupHasMatchingRows(iRowGroup, nFeatureIdxStart,
+                                                anFilterParquetCols,
+                                                aoFilterArrayIdxAndName))
+                    {
+                        asMatchingRemapping.emplace_back(
+                            std::make_pair(nFeatureIdxSelected,
+                                           nFeatureIdxStart));
+                        anMatchingGroups.push_back(iRowGroup);
+                        nFeatureIdxSelected +=
+                            metadata->RowGroup(iRowGroup)->num_rows();
+                    }
+                }
+                anSelectedGroups = std::move(anMatchingGroups);
+                m_asFeatureIdxRemapping = std::move(asMatchingRemapping);
+            }
         }
 
         if (bIterateEverything)
@@ -33,8 +33,10 @@
 
 #include "../arrow_common/ograrrowwriterlayer.hpp"
 
+#include "gdal_thread_pool.h"
 #include "ogr_wkb.h"
 
+#include <algorithm>
 #include <utility>
 
 /************************************************************************/
@@ -93,15 +95,11 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
     // Interval in terms of features between 2 debug progress report messages
     constexpr int PROGRESS_FC_INTERVAL = 100 * 1000;
 
-    // First, write features without geometries
+    // Write the features of a result layer whose first field is the
+    // serialized feature, in the order of that layer.
+    const auto CopySerializedFeatures = [this, &oFeat](OGRLayer *poTmpLayer)
     {
-        auto poTmpLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
-            "SELECT serialized_feature FROM tmp WHERE fid NOT IN (SELECT id "
-            "FROM rtree_tmp_geom)",
-            nullptr, nullptr));
-        if (!poTmpLayer)
-            return false;
-        for (const auto &poSrcFeature : poTmpLayer.get())
+        for (const auto &poSrcFeature : poTmpLayer)
         {
             int nBytesFeature = 0;
             const GByte *pabyFeatureData =
@@ -127,10 +125,36 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
             }
         }
 
-        if (!FlushFeatures())
-        {
+        return FlushFeatures();
+    };
+
+    // First, write features without geometries
+    {
+        auto poTmpLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
+            "SELECT serialized_feature FROM tmp WHERE fid NOT IN (SELECT id "
+            "FROM rtree_tmp_geom)",
+            nullptr, nullptr));
+        if (!poTmpLayer || !CopySerializedFeatures(poTmpLayer.get()))
             return false;
-        }
+    }
+
+    if (m_bSortByHilbert)
+    {
+        // Let SQLite sort features on their Hilbert key. It switches to an
+        // external merge sort, using temporary files, when they do not fit
+        // in its cache.
+        if (!CreateTmpGpkgHilbertKeyTable())
+            return false;
+        auto poTmpLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
+            "SELECT tmp.serialized_feature FROM hilbert JOIN tmp ON "
+            "tmp.fid = hilbert.fid ORDER BY hilbert.hilbert_key, hilbert.fid",
+            nullptr, nullptr));
+        if (!poTmpLayer || !CopySerializedFeatures(poTmpLayer.get()))
+            return false;
+
+        CPLDebug("PARQUET",
+                 "CopyTmpGpkgLayerToFinalFile(): 100%%, successfully finished");
+        return true;
     }
 
     // Now walk through the GPKG RTree for features with geometries
@@ -291,6 +315,145 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
     return true;
 }
 
+/************************************************************************/
+/*                             Hilbert()                                */
+/************************************************************************/
+
+// Position of (x, y) along a Hilbert curve over a 65536x65536 grid.
+// Based on public domain code at
+// https://github.com/rawrunprotected/hilbert_curves
+static uint32_t Hilbert(uint32_t x, uint32_t y)
+{
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+/************************************************************************/
+/*                   CreateTmpGpkgHilbertKeyTable()                     */
+/************************************************************************/
+
+/** Create a "hilbert" table in the temporary GeoPackage with, for each
+ * feature with a geometry, the position of the center of its bounding box
+ * along a Hilbert curve over the extent of the layer.
+ * Only used in SORT_BY_BBOX=HILBERT mode.
+ */
+bool OGRParquetWriterLayer::CreateTmpGpkgHilbertKeyTable()
+{
+    OGREnvelope sExtent;
+    {
+        auto poTmpLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
+            "SELECT MIN(minx), MIN(miny), MAX(maxx), MAX(maxy) FROM "
+            "rtree_tmp_geom",
+            nullptr, nullptr));
+        if (!poTmpLayer)
+            return false;
+        const auto poExtentFeature =
+            std::unique_ptr<const OGRFeature>(poTmpLayer->GetNextFeature());
+        if (!poExtentFeature)
+            return false;
+        sExtent.MinX = poExtentFeature->GetFieldAsDouble(0);
+        sExtent.MinY = poExtentFeature->GetFieldAsDouble(1);
+        sExtent.MaxX = poExtentFeature->GetFieldAsDouble(2);
+        sExtent.MaxY = poExtentFeature->GetFieldAsDouble(3);
+    }
+
+    OGRLayer *poKeyLayer =
+        m_poTmpGPKG->CreateLayer("hilbert", nullptr, wkbNone);
+    if (!poKeyLayer)
+        return false;
+    OGRFieldDefn oFieldDefn("hilbert_key", OFTInteger64);
+    if (poKeyLayer->CreateField(&oFieldDefn) != OGRERR_NONE)
+        return false;
+
+    auto poRTreeLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
+        "SELECT id, minx, miny, maxx, maxy FROM rtree_tmp_geom", nullptr,
+        nullptr));
+    if (!poRTreeLayer)
+        return false;
+
+    const double dfWidth = sExtent.MaxX - sExtent.MinX;
+    const double dfHeight = sExtent.MaxY - sExtent.MinY;
+    constexpr double HILBERT_MAX = 65535;
+    OGRFeature oKeyFeature(poKeyLayer->GetLayerDefn());
+    for (const auto &poRTreeFeature : poRTreeLayer.get())
+    {
+        const double dfX = (poRTreeFeature->GetFieldAsDouble(1) +
+                            poRTreeFeature->GetFieldAsDouble(3)) /
+                           2;
+        const double dfY = (poRTreeFeature->GetFieldAsDouble(2) +
+                            poRTreeFeature->GetFieldAsDouble(4)) /
+                           2;
+        const uint32_t nX =
+            dfWidth > 0 ? static_cast<uint32_t>(
+                              std::clamp(HILBERT_MAX * (dfX - sExtent.MinX) /
+                                             dfWidth,
+                                         0.0, HILBERT_MAX))
+                        : 0;
+        const uint32_t nY =
+            dfHeight > 0 ? static_cast<uint32_t>(
+                               std::clamp(HILBERT_MAX * (dfY - sExtent.MinY) /
+                                              dfHeight,
+                                          0.0, HILBERT_MAX))
+                         : 0;
+        oKeyFeature.SetFID(poRTreeFeature->GetFieldAsInteger64(0));
+        oKeyFeature.SetField(0, static_cast<GIntBig>(Hilbert(nX, nY)));
+        if (poKeyLayer->CreateFeature(&oKeyFeature) != OGRERR_NONE)
+            return false;
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                       IsSupportedGeometryType()                      */
 /************************************************************************/
@@ -330,7 +493,10 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
         papszOptions, "WRITE_COVERING_BBOX",
         CPLGetConfigOption("OGR_PARQUET_WRITE_COVERING_BBOX", "YES")));
 
-    if (CPLTestBool(CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX", "NO")))
+    const char *pszSortByBBOX =
+        CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX", "NO");
+    m_bSortByHilbert = EQUAL(pszSortByBBOX, "HILBERT");
+    if (m_bSortByHilbert || CPLTestBool(pszSortByBBOX))
     {
         const std::string osTmpGPKG(std::string(m_poDataset->GetDescription()) +
                                     ".tmp.gpkg");
@@ -502,6 +668,24 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
     m_bEdgesSpherical = EQUAL(
         CSLFetchNameValueDef(papszOptions, "EDGES", "PLANAR"), "SPHERICAL");
 
+#if PARQUET_VERSION_MAJOR >= 12
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    int nNumThreads = 0;
+    if (pszNumThreads == nullptr)
+        nNumThreads = std::min(4, CPLGetNumCPUs());
+    else
+        nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszNumThreads);
+    // The Arrow CPU thread pool is process-wide: cap it to the thread budget
+    if (GDALGetThreadBudget() > 0)
+        nNumThreads = std::min(nNumThreads, GDALGetThreadBudget());
+    if (nNumThreads > 1)
+    {
+        CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
+        m_bUseThreads = true;
+    }
+#endif
+
     m_bInitializationOK = true;
     return true;
 }
@@ -1015,8 +1199,12 @@ void OGRParquetWriterLayer::CreateWriter()
         FinalizeSchema();
     }
 
-    auto arrowWriterProperties =
-        parquet::ArrowWriterProperties::Builder().store_schema()->build();
+    parquet::ArrowWriterProperties::Builder oArrowWriterPropertiesBuilder;
+    oArrowWriterPropertiesBuilder.store_schema();
+#if PARQUET_VERSION_MAJOR >= 12
+    oArrowWriterPropertiesBuilder.set_use_threads(m_bUseThreads);
+#endif
+    auto arrowWriterProperties = oArrowWriterPropertiesBuilder.build();
     CPL_IGNORE_RET_VAL(Open(*m_poSchema, m_poMemoryPool, m_poOutputStream,
                             m_oWriterPropertiesBuilder.build(),
                             std::move(arrowWriterProperties), &m_poFileWriter,
@@ -1091,6 +1279,45 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
 
 bool OGRParquetWriterLayer::FlushGroup()
 {
+#if PARQUET_VERSION_MAJOR >= 12
+    if (m_bUseThreads)
+    {
+        // The columns of a buffered row group are encoded and compressed
+        // in parallel by Arrow when use_threads is set.
+        const int64_t nRows = m_apoBuilders[0]->length();
+        std::vector<std::shared_ptr<arrow::Array>> apoArrays;
+        const bool bRet = WriteArrays(
+            [&apoArrays](const std::shared_ptr<arrow::Field> &,
+                         const std::shared_ptr<arrow::Array> &array)
+            {
+                apoArrays.push_back(array);
+                return true;
+            });
+        ClearArrayBuilers();
+        if (!bRet)
+            return false;
+
+        auto status = m_poFileWriter->NewBufferedRowGroup();
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "NewBufferedRowGroup() failed with %s",
+                     status.message().c_str());
+            return false;
+        }
+
+        status = m_poFileWriter->WriteRecordBatch(
+            *arrow::RecordBatch::Make(m_poSchema, nRows, std::move(apoArrays)));
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WriteRecordBatch() failed: %s", status.message().c_str());
+            return false;
+        }
+        return true;
+    }
+#endif
+
     auto status = m_poFileWriter->NewRowGroup(m_apoBuilders[0]->length());
     if (!status.ok())
     {
@@ -378,6 +378,19 @@ class OGRPGTableLayer final : public OGRPGLayer
     void LoadMetadata();
     void SerializeMetadata();
 
+    // State of the native GetNextArrowArray() implementation
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    std::string m_osArrowCopyFields{};
+    // Index of the OGR field of each column after the FID in
+    // m_osArrowCopyFields, or -1 - geometry field index for geometry columns
+    std::vector<int> m_anArrowCopyFields{};
+    bool m_bArrowStreamHasLastFID = false;
+    GIntBig m_nArrowStreamLastFID = 0;
+    bool m_bArrowStreamEOF = false;
+
+    bool CanUseOptimizedGetNextArrowArray();
+    bool BuildArrowCopyFields();
+
   public:
     OGRPGTableLayer(OGRPGDataSource *, CPLString &osCurrentSchema,
                     const char *pszTableName, const char *pszSchemaName,
@@ -391,6 +404,8 @@ class OGRPGTableLayer final : public OGRPGLayer
     virtual void ResetReading() override;
     virtual OGRFeature *GetNextFeature() override;
     virtual GIntBig GetFeatureCount(int) override;
+    virtual int GetNextArrowArray(struct ArrowArrayStream *,
+                                  struct ArrowArray *out_array) override;
 
     virtual void SetSpatialFilter(OGRGeometry *poGeom) override
     {
@@ -409,6 +424,9 @@ class OGRPGTableLayer final : public OGRPGLayer
                           bool bUpdateStyleString) override;
     virtual OGRErr DeleteFeature(GIntBig nFID) override;
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
 
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
                                int bApproxOK = TRUE) override;
@@ -33,9 +33,14 @@
 #include "cpl_string.h"
 #include "cpl_error.h"
 #include "ogr_p.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 
 #include <chrono>
+#include <climits>
 #include <condition_variable>
+#include <deque>
+#include <limits>
 #include <mutex>
 #include <thread>
 
@@ -492,6 +497,12 @@ char **OGRPGTableLayer::GetMetadata(const char *pszDomain)
 const char *OGRPGTableLayer::GetMetadataItem(const char *pszName,
                                              const char *pszDomain)
 {
+    if (pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+
     LoadMetadata();
 
     GetMetadata(pszDomain);
@@ -1168,6 +1179,11 @@ void OGRPGTableLayer::ResetReading()
     poDS->EndCopy();
     bUseCopyByDefault = FALSE;
 
+    m_osArrowCopyFields.clear();
+    m_bArrowStreamHasLastFID = false;
+    m_nArrowStreamLastFID = 0;
+    m_bArrowStreamEOF = false;
+
     BuildFullQueryStatement();
 
     OGRPGLayer::ResetReading();
@@ -1186,40 +1202,858 @@ OGRFeature *OGRPGTableLayer::GetNextFeature()
         return nullptr;
     poDS->EndCopy();
 
-    if (pszQueryStatement == nullptr)
-        ResetReading();
+    if (pszQueryStatement == nullptr)
+        ResetReading();
+
+    OGRPGGeomFieldDefn *poGeomFieldDefn = nullptr;
+    if (poFeatureDefn->GetGeomFieldCount() != 0)
+        poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter);
+    poFeatureDefn->GetFieldCount();
+
+    while (true)
+    {
+        OGRFeature *poFeature = GetNextRawFeature();
+        if (poFeature == nullptr)
+            return nullptr;
+
+        /* We just have to look if there is a geometry filter */
+        /* If there's a PostGIS geometry column, the spatial filter */
+        /* is already taken into account in the select request */
+        /* The attribute filter is always taken into account by the select
+         * request */
+        if (m_poFilterGeom == nullptr || poGeomFieldDefn == nullptr ||
+            poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOMETRY ||
+            poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY ||
+            FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter)))
+        {
+            if (iFIDAsRegularColumnIndex >= 0)
+            {
+                poFeature->SetField(iFIDAsRegularColumnIndex,
+                                    poFeature->GetFID());
+            }
+            return poFeature;
+        }
+
+        delete poFeature;
+    }
+}
+
+/************************************************************************/
+/*                  CanUseOptimizedGetNextArrowArray()                  */
+/************************************************************************/
+
+bool OGRPGTableLayer::CanUseOptimizedGetNextArrowArray()
+{
+    // The optimized code path paginates on the FID column, and expects
+    // binary values in UTF-8 and geometries extracted as WKB by PostGIS.
+    if (pszFIDColumn == nullptr || iFIDAsRegularColumnIndex >= 0 ||
+        !poDS->IsUTF8ClientEncoding() ||
+        !m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        m_aosArrowArrayStreamOptions.FetchNameValue("TIMEZONE") != nullptr ||
+        CPLTestBool(CPLGetConfigOption("OGR_PG_STREAM_BASE_IMPL", "NO")))
+    {
+        return false;
+    }
+
+    if (m_poFilterGeom != nullptr &&
+        poFeatureDefn->GetGeomFieldCount() > m_iGeomFieldFilter)
+    {
+        // The spatial filter must be fully evaluated server-side
+        const OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter);
+        if (poDS->sPostGISVersion.nMajor < 0 ||
+            (poGeomFieldDefn->ePostgisType != GEOM_TYPE_GEOMETRY &&
+             poGeomFieldDefn->ePostgisType != GEOM_TYPE_GEOGRAPHY))
+        {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); ++i)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+            case OFTInteger64:
+            case OFTReal:
+            case OFTString:
+            case OFTBinary:
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        const OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        if (poGeomFieldDefn->IsIgnored())
+            continue;
+        if (poDS->sPostGISVersion.nMajor < 2 ||
+            (poGeomFieldDefn->ePostgisType != GEOM_TYPE_GEOMETRY &&
+             poGeomFieldDefn->ePostgisType != GEOM_TYPE_GEOGRAPHY))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                          GetArrowCopyCast()                          */
+/************************************************************************/
+
+/** Returns the type to which a column of PostgreSQL type nTypeOID must be
+ * cast so that its binary COPY representation is the one expected for
+ * poFieldDefn, or nullptr if no cast is needed.
+ */
+static const char *GetArrowCopyCast(const OGRFieldDefn *poFieldDefn,
+                                    Oid nTypeOID)
+{
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger:
+            if (poFieldDefn->GetSubType() == OFSTBoolean)
+                return nTypeOID == BOOLOID ? nullptr : "boolean";
+            if (poFieldDefn->GetSubType() == OFSTInt16)
+                return nTypeOID == INT2OID ? nullptr : "int2";
+            // Values out of the int4 range are truncated on client side
+            return (nTypeOID == INT2OID || nTypeOID == INT4OID ||
+                    nTypeOID == INT8OID)
+                       ? nullptr
+                       : "int8";
+
+        case OFTInteger64:
+            return (nTypeOID == INT2OID || nTypeOID == INT4OID ||
+                    nTypeOID == INT8OID)
+                       ? nullptr
+                       : "int8";
+
+        case OFTReal:
+            return (nTypeOID == FLOAT4OID || nTypeOID == FLOAT8OID)
+                       ? nullptr
+                       : "float8";
+
+        case OFTString:
+            // Types whose binary representation is their UTF-8 text
+            return (nTypeOID == TEXTOID || nTypeOID == VARCHAROID ||
+                    nTypeOID == BPCHAROID || nTypeOID == NAMEOID ||
+                    nTypeOID == JSONOID)
+                       ? nullptr
+                       : "text";
+
+        case OFTBinary:
+            return nTypeOID == BYTEAOID ? nullptr : "bytea";
+
+        case OFTDate:
+            return nTypeOID == DATEOID ? nullptr : "date";
+
+        case OFTTime:
+            return nTypeOID == TIMEOID ? nullptr : "time";
+
+        case OFTDateTime:
+            // timestamptz values are converted to the session time zone,
+            // as done by the text output of the regular code path
+            return nTypeOID == TIMESTAMPOID ? nullptr : "timestamp";
+
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        BuildArrowCopyFields()                        */
+/************************************************************************/
+
+bool OGRPGTableLayer::BuildArrowCopyFields()
+{
+    m_anArrowCopyFields.clear();
+
+    std::string osRawFields;
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); ++i)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        if (!osRawFields.empty())
+            osRawFields += ", ";
+        osRawFields += OGRPGEscapeColumnName(poFieldDefn->GetNameRef());
+        m_anArrowCopyFields.push_back(i);
+    }
+
+    // Fetch the actual PostgreSQL types of the attribute columns, so as to
+    // cast only the ones whose binary representation we do not decode.
+    std::vector<Oid> anTypeOIDs;
+    if (!osRawFields.empty())
+    {
+        CPLString osCommand;
+        osCommand.Printf("SELECT %s FROM %s LIMIT 0", osRawFields.c_str(),
+                         pszSqlTableName);
+        PGresult *hResult = OGRPG_PQexec(poDS->GetPGConn(), osCommand);
+        if (!hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK ||
+            PQnfields(hResult) != static_cast<int>(m_anArrowCopyFields.size()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     PQerrorMessage(poDS->GetPGConn()));
+            OGRPGClearResult(hResult);
+            return false;
+        }
+        for (int i = 0; i < PQnfields(hResult); ++i)
+            anTypeOIDs.push_back(PQftype(hResult, i));
+        OGRPGClearResult(hResult);
+    }
+
+    std::string osFields(OGRPGEscapeColumnName(pszFIDColumn));
+    osFields += "::int8";
+    for (size_t i = 0; i < m_anArrowCopyFields.size(); ++i)
+    {
+        const OGRFieldDefn *poFieldDefn =
+            poFeatureDefn->GetFieldDefn(m_anArrowCopyFields[i]);
+        osFields += ", ";
+        osFields += OGRPGEscapeColumnName(poFieldDefn->GetNameRef());
+        const char *pszCast = GetArrowCopyCast(poFieldDefn, anTypeOIDs[i]);
+        if (pszCast)
+        {
+            osFields += "::";
+            osFields += pszCast;
+        }
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        const OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        if (poGeomFieldDefn->IsIgnored())
+            continue;
+        osFields += ", ST_AsBinary(";
+        osFields += OGRPGEscapeColumnName(poGeomFieldDefn->GetNameRef());
+        if (poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY)
+            osFields += "::geometry";
+        osFields += ", 'NDR')";
+        m_anArrowCopyFields.push_back(-1 - i);
+    }
+
+    m_osArrowCopyFields = std::move(osFields);
+    return true;
+}
+
+/************************************************************************/
+/*                          OGRPGCopyOutReader                          */
+/************************************************************************/
+
+namespace
+{
+/** Receives the rows of a COPY ... TO STDOUT in a background thread, so
+ * that fetching them from the server overlaps with their decoding.
+ *
+ * The connection must not be used by anyone else until Finish() has
+ * returned.
+ */
+class OGRPGCopyOutReader
+{
+    PGconn *const m_hPGConn;
+    std::thread m_oThread{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<std::pair<char *, int>> m_aoQueue{};
+    size_t m_nQueuedBytes = 0;
+    bool m_bFinished = false;
+    bool m_bStopRequested = false;
+    int m_nLastRet = 0;
+
+    static constexpr size_t MAX_QUEUED_BYTES = 64 * 1024 * 1024;
+
+    OGRPGCopyOutReader(const OGRPGCopyOutReader &) = delete;
+    OGRPGCopyOutReader &operator=(const OGRPGCopyOutReader &) = delete;
+
+    void Run()
+    {
+        while (true)
+        {
+            char *pszBuffer = nullptr;
+            const int nRet = PQgetCopyData(m_hPGConn, &pszBuffer, 0);
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            if (nRet <= 0)
+            {
+                m_nLastRet = nRet;
+                m_bFinished = true;
+                m_oCV.notify_all();
+                return;
+            }
+            m_oCV.wait(oLock,
+                       [this]
+                       {
+                           return m_bStopRequested ||
+                                  m_nQueuedBytes < MAX_QUEUED_BYTES;
+                       });
+            if (m_bStopRequested)
+            {
+                // Keep on consuming rows so that the connection is usable
+                // afterwards.
+                PQfreemem(pszBuffer);
+                continue;
+            }
+            m_aoQueue.emplace_back(pszBuffer, nRet);
+            m_nQueuedBytes += nRet;
+            m_oCV.notify_all();
+        }
+    }
+
+  public:
+    explicit OGRPGCopyOutReader(PGconn *hPGConn) : m_hPGConn(hPGConn)
+    {
+        m_oThread = std::thread([this] { Run(); });
+    }
+
+    ~OGRPGCopyOutReader()
+    {
+        Finish();
+    }
+
+    /** Returns the next row, to be freed with PQfreemem(), or nullptr once
+     * all rows have been received. */
+    char *GetNextRow(int &nLen)
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock, [this] { return m_bFinished || !m_aoQueue.empty(); });
+        if (m_aoQueue.empty())
+            return nullptr;
+        const auto oRow = m_aoQueue.front();
+        m_aoQueue.pop_front();
+        m_nQueuedBytes -= oRow.second;
+        m_oCV.notify_all();
+        nLen = oRow.second;
+        return oRow.first;
+    }
+
+    /** Discards remaining rows and waits for the end of the copy.
+     * Returns false if PQgetCopyData() reported an error. */
+    bool Finish()
+    {
+        if (m_oThread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                m_bStopRequested = true;
+                for (auto &oRow : m_aoQueue)
+                    PQfreemem(oRow.first);
+                m_aoQueue.clear();
+                m_nQueuedBytes = 0;
+                m_oCV.notify_all();
+            }
+            m_oThread.join();
+        }
+        return m_nLastRet == -1;
+    }
+};
+
+/************************************************************************/
+/*                         Binary COPY helpers                          */
+/************************************************************************/
+
+inline int16_t PGCopyReadInt16(const GByte *pabyData)
+{
+    int16_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_MSBPTR16(&nVal);
+    return nVal;
+}
+
+inline int32_t PGCopyReadInt32(const GByte *pabyData)
+{
+    int32_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_MSBPTR32(&nVal);
+    return nVal;
+}
+
+inline int64_t PGCopyReadInt64(const GByte *pabyData)
+{
+    int64_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_MSBPTR64(&nVal);
+    return nVal;
+}
+
+inline float PGCopyReadFloat32(const GByte *pabyData)
+{
+    float fVal;
+    memcpy(&fVal, pabyData, sizeof(fVal));
+    CPL_MSBPTR32(&fVal);
+    return fVal;
+}
+
+inline double PGCopyReadFloat64(const GByte *pabyData)
+{
+    double dfVal;
+    memcpy(&dfVal, pabyData, sizeof(dfVal));
+    CPL_MSBPTR64(&dfVal);
+    return dfVal;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+/* Each batch is read with a
+ * COPY (SELECT ... WHERE fid > last_fid ORDER BY fid LIMIT batch_size)
+ * TO STDOUT (FORMAT binary)
+ * statement, so that the connection is free between batches. Rows are
+ * received in a background thread while the current thread decodes them.
+ */
+int OGRPGTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+
+    if (bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+    poDS->EndCopy();
+    GetLayerDefn()->GetFieldCount();
+
+    if (!CanUseOptimizedGetNextArrowArray())
+        return OGRPGLayer::GetNextArrowArray(stream, out_array);
+
+    memset(out_array, 0, sizeof(*out_array));
+    if (m_bArrowStreamEOF)
+        return 0;
+
+    OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+        return ENOMEM;
+
+    if (m_osArrowCopyFields.empty() && !BuildArrowCopyFields())
+    {
+        sHelper.ClearArray();
+        return EIO;
+    }
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    CPLString osWhere(osWHERE);
+    if (m_bArrowStreamHasLastFID)
+    {
+        CPLString osFIDCond;
+        osFIDCond.Printf("%s > " CPL_FRMT_GIB,
+                         OGRPGEscapeColumnName(pszFIDColumn).c_str(),
+                         m_nArrowStreamLastFID);
+        if (osWhere.empty())
+            osWhere = "WHERE " + osFIDCond;
+        else
+            osWhere = "WHERE (" + osWhere.substr(strlen("WHERE ")) + ") AND " +
+                      osFIDCond;
+    }
+
+    CPLString osCommand;
+    osCommand.Printf(
+        "COPY (SELECT %s FROM %s %s ORDER BY %s LIMIT %d) "
+        "TO STDOUT (FORMAT binary)",
+        m_osArrowCopyFields.c_str(), pszSqlTableName, osWhere.c_str(),
+        OGRPGEscapeColumnName(pszFIDColumn).c_str(), sHelper.m_nMaxBatchSize);
+
+    PGconn *hPGConn = poDS->GetPGConn();
+    PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand);
+    if (!hResult || PQresultStatus(hResult) != PGRES_COPY_OUT)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(hPGConn));
+        OGRPGClearResult(hResult);
+        sHelper.ClearArray();
+        return EIO;
+    }
+    OGRPGClearResult(hResult);
+
+    constexpr int64_t SECONDS_FROM_1970_TO_2000 = 946684800;
+    constexpr int DAYS_FROM_1970_TO_2000 = 10957;
+    const int nExpectedColumns =
+        1 + static_cast<int>(m_anArrowCopyFields.size());
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    bool bOK = true;
+    bool bHeaderRead = false;
+    bool bBatchFull = false;
+    int iFeat = 0;
+    const char *pszError = nullptr;
+    // Value pointer and length (-1 for NULL) of each column of a row
+    std::vector<std::pair<const GByte *, int32_t>> aoValues(nExpectedColumns);
+
+    OGRPGCopyOutReader oReader(hPGConn);
+    while (!bBatchFull && pszError == nullptr)
+    {
+        int nLen = 0;
+        char *pszRow = oReader.GetNextRow(nLen);
+        if (pszRow == nullptr)
+            break;
+
+        const GByte *pabyIter = reinterpret_cast<const GByte *>(pszRow);
+        const GByte *const pabyEnd = pabyIter + nLen;
+
+        if (!bHeaderRead)
+        {
+            // Signature, flags and header extension length
+            constexpr char achSignature[] = "PGCOPY\n\377\r\n";
+            constexpr int SIGNATURE_SIZE = 11;
+            int32_t nExtLen = -1;
+            if (nLen >= SIGNATURE_SIZE + 8 &&
+                memcmp(pabyIter, achSignature, SIGNATURE_SIZE) == 0)
+            {
+                pabyIter += SIGNATURE_SIZE + 4;
+                nExtLen = PGCopyReadInt32(pabyIter);
+                pabyIter += 4;
+            }
+            if (nExtLen < 0 || nExtLen > pabyEnd - pabyIter)
+            {
+                pszError = "Invalid binary COPY header";
+                PQfreemem(pszRow);
+                break;
+            }
+            pabyIter += nExtLen;
+            bHeaderRead = true;
+        }
+
+        // Each buffer returned by PQgetCopyData() holds a single row, or
+        // the file trailer (-1 column count).
+        if (pabyEnd - pabyIter < 2 || PGCopyReadInt16(pabyIter) == -1)
+        {
+            PQfreemem(pszRow);
+            continue;
+        }
+        if (PGCopyReadInt16(pabyIter) != nExpectedColumns)
+        {
+            pszError = "Unexpected number of columns in binary COPY";
+            PQfreemem(pszRow);
+            break;
+        }
+        pabyIter += 2;
+
+        // First pass: locate values, and check that the row fits in the
+        // memory limit.
+        for (int iCol = 0; iCol < nExpectedColumns; ++iCol)
+        {
+            const int32_t nValLen =
+                pabyEnd - pabyIter >= 4 ? PGCopyReadInt32(pabyIter) : -2;
+            if (nValLen < -1 || nValLen > pabyEnd - pabyIter - 4)
+            {
+                pszError = "Truncated binary COPY row";
+                break;
+            }
+            pabyIter += 4;
+            aoValues[iCol] = std::make_pair(pabyIter, nValLen);
+            if (nValLen > 0)
+                pabyIter += nValLen;
+
+            if (iCol == 0)
+            {
+                if (nValLen != 8)
+                {
+                    pszError = "Unexpected value length in binary COPY";
+                    break;
+                }
+                continue;
+            }
+            const int iOGRField = m_anArrowCopyFields[iCol - 1];
+            int iArrowField;
+            if (iOGRField < 0)
+            {
+                iArrowField =
+                    sHelper.m_mapOGRGeomFieldToArrowField[-1 - iOGRField];
+            }
+            else
+            {
+                const auto eType =
+                    poFeatureDefn->GetFieldDefn(iOGRField)->GetType();
+                if (eType != OFTString && eType != OFTBinary)
+                    continue;
+                iArrowField = sHelper.m_mapOGRFieldToArrowField[iOGRField];
+            }
+            const auto panOffsets = static_cast<const int32_t *>(
+                out_array->children[iArrowField]->buffers[1]);
+            if (iFeat > 0 && nValLen > 0 &&
+                static_cast<uint32_t>(nValLen) >
+                    nMemLimit - static_cast<uint32_t>(panOffsets[iFeat]))
+            {
+                bBatchFull = true;
+            }
+        }
+        if (pszError != nullptr || bBatchFull)
+        {
+            PQfreemem(pszRow);
+            break;
+        }
+
+        // Second pass: store values
+        const GIntBig nFID = PGCopyReadInt64(aoValues[0].first);
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = nFID;
+        for (int iCol = 1; iCol < nExpectedColumns && pszError == nullptr;
+             ++iCol)
+        {
+            const GByte *pabyVal = aoValues[iCol].first;
+            const int32_t nValLen = aoValues[iCol].second;
+            const int iOGRField = m_anArrowCopyFields[iCol - 1];
+            if (iOGRField < 0)
+            {
+                const int iArrowField =
+                    sHelper.m_mapOGRGeomFieldToArrowField[-1 - iOGRField];
+                if (nValLen < 0)
+                {
+                    sHelper.SetNull(iArrowField, iFeat);
+                    continue;
+                }
+                GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                    iArrowField, iFeat, nValLen);
+                if (pabyDst == nullptr)
+                {
+                    pszError = "Cannot allocate WKB buffer";
+                    break;
+                }
+                memcpy(pabyDst, pabyVal, nValLen);
+                continue;
+            }
+
+            const int iArrowField =
+                sHelper.m_mapOGRFieldToArrowField[iOGRField];
+            auto psArray = out_array->children[iArrowField];
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefn(iOGRField);
+            const OGRFieldType eType = poFieldDefn->GetType();
+            if (nValLen < 0)
+            {
+                if (sHelper.m_abNullableFields[iArrowField])
+                    sHelper.SetNull(iArrowField, iFeat);
+                else if (eType == OFTString || eType == OFTBinary)
+                    OGRArrowArrayHelper::SetEmptyStringOrBinary(psArray,
+                                                                iFeat);
+                continue;
+            }
+
+            switch (eType)
+            {
+                case OFTInteger:
+                {
+                    int64_t nVal = 0;
+                    if (nValLen == 1)
+                        nVal = pabyVal[0] != 0;
+                    else if (nValLen == 2)
+                        nVal = PGCopyReadInt16(pabyVal);
+                    else if (nValLen == 4)
+                        nVal = PGCopyReadInt32(pabyVal);
+                    else if (nValLen == 8)
+                        nVal = PGCopyReadInt64(pabyVal);
+                    else
+                    {
+                        pszError = "Unexpected value length in binary COPY";
+                        break;
+                    }
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        if (nVal)
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTInt16)
+                    {
+                        OGRArrowArrayHelper::SetInt16(
+                            psArray, iFeat, static_cast<int16_t>(nVal));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetInt32(
+                            psArray, iFeat, static_cast<int32_t>(nVal));
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    int64_t nVal = 0;
+                    if (nValLen == 2)
+                        nVal = PGCopyReadInt16(pabyVal);
+                    else if (nValLen == 4)
+                        nVal = PGCopyReadInt32(pabyVal);
+                    else if (nValLen == 8)
+                        nVal = PGCopyReadInt64(pabyVal);
+                    else
+                    {
+                        pszError = "Unexpected value length in binary COPY";
+                        break;
+                    }
+                    OGRArrowArrayHelper::SetInt64(psArray, iFeat, nVal);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    double dfVal = 0;
+                    if (nValLen == 4)
+                        dfVal = PGCopyReadFloat32(pabyVal);
+                    else if (nValLen == 8)
+                        dfVal = PGCopyReadFloat64(pabyVal);
+                    else
+                    {
+                        pszError = "Unexpected value length in binary COPY";
+                        break;
+                    }
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        OGRArrowArrayHelper::SetFloat(
+                            psArray, iFeat, static_cast<float>(dfVal));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetDouble(psArray, iFeat, dfVal);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    GByte *pabyDst = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nValLen);
+                    if (pabyDst == nullptr)
+                    {
+                        pszError = "Cannot allocate string buffer";
+                        break;
+                    }
+                    memcpy(pabyDst, pabyVal, nValLen);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    if (nValLen != 4)
+                    {
+                        pszError = "Unexpected value length in binary COPY";
+                        break;
+                    }
+                    // Days since 2000-01-01
+                    const int32_t nDays = PGCopyReadInt32(pabyVal);
+                    if (nDays == std::numeric_limits<int32_t>::max() ||
+                        nDays == std::numeric_limits<int32_t>::min())
+                    {
+                        // +/- infinity
+                        sHelper.SetNull(iArrowField, iFeat);
+                        break;
+                    }
+                    OGRArrowArrayHelper::SetInt32(
+                        psArray, iFeat, nDays + DAYS_FROM_1970_TO_2000);
+                    break;
+                }
+
+                case OFTTime:
+                {
+                    if (nValLen != 8)
+                    {
+                        pszError = "Unexpected value length in binary COPY";
+                        break;
+                    }
+                    // Microseconds since midnight
+                    const int64_t nUS = PGCopyReadInt64(pabyVal);
+                    OGRArrowArrayHelper::SetInt32(
+                        psArray, iFeat,
+                        static_cast<int32_t>((nUS + 500) / 1000));
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    if (nValLen != 8)
+                    {
+                        pszError = "Unexpected value length in binary COPY";
+                        break;
+                    }
+                    // Microseconds since 2000-01-01T00:00:00
+                    const int64_t nUS = PGCopyReadInt64(pabyVal);
+                    if (nUS == std::numeric_limits<int64_t>::max() ||
+                        nUS == std::numeric_limits<int64_t>::min())
+                    {
+                        // +/- infinity
+                        sHelper.SetNull(iArrowField, iFeat);
+                        break;
+                    }
+                    int64_t nSec = nUS / (1000 * 1000);
+                    int64_t nFracUS = nUS % (1000 * 1000);
+                    if (nFracUS < 0)
+                    {
+                        nSec -= 1;
+                        nFracUS += 1000 * 1000;
+                    }
+                    // Same rounding of milliseconds as
+                    // OGRArrowArrayHelper::SetDateTime()
+                    OGRArrowArrayHelper::SetInt64(
+                        psArray, iFeat,
+                        (nSec + SECONDS_FROM_1970_TO_2000) * 1000 +
+                            ((nFracUS + 500) / 1000) % 1000);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        PQfreemem(pszRow);
+        if (pszError != nullptr)
+            break;
 
-    OGRPGGeomFieldDefn *poGeomFieldDefn = nullptr;
-    if (poFeatureDefn->GetGeomFieldCount() != 0)
-        poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter);
-    poFeatureDefn->GetFieldCount();
+        m_nArrowStreamLastFID = nFID;
+        m_bArrowStreamHasLastFID = true;
+        ++iFeat;
+    }
 
-    while (true)
+    if (!oReader.Finish() && pszError == nullptr)
     {
-        OGRFeature *poFeature = GetNextRawFeature();
-        if (poFeature == nullptr)
-            return nullptr;
-
-        /* We just have to look if there is a geometry filter */
-        /* If there's a PostGIS geometry column, the spatial filter */
-        /* is already taken into account in the select request */
-        /* The attribute filter is always taken into account by the select
-         * request */
-        if (m_poFilterGeom == nullptr || poGeomFieldDefn == nullptr ||
-            poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOMETRY ||
-            poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY ||
-            FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter)))
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(hPGConn));
+        bOK = false;
+    }
+    while ((hResult = PQgetResult(hPGConn)) != nullptr)
+    {
+        if (PQresultStatus(hResult) != PGRES_COMMAND_OK && bOK &&
+            pszError == nullptr)
         {
-            if (iFIDAsRegularColumnIndex >= 0)
-            {
-                poFeature->SetField(iFIDAsRegularColumnIndex,
-                                    poFeature->GetFID());
-            }
-            return poFeature;
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     PQerrorMessage(hPGConn));
+            bOK = false;
         }
+        OGRPGClearResult(hResult);
+    }
 
-        delete poFeature;
+    if (pszError != nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+        bOK = false;
+    }
+    if (!bOK)
+    {
+        sHelper.ClearArray();
+        return EIO;
     }
+
+    // A partial batch, not truncated because of the memory limit, means
+    // that all rows have been read.
+    if (!bBatchFull && iFeat < sHelper.m_nMaxBatchSize)
+        m_bArrowStreamEOF = true;
+
+    if (iFeat == 0)
+    {
+        sHelper.ClearArray();
+        return 0;
+    }
+    sHelper.Shrink(iFeat);
+    return 0;
 }
 
 /************************************************************************/
@@ -2246,6 +3080,648 @@ OGRErr OGRPGTableLayer::CreateFeatureViaCopy(OGRFeature *poFeature)
     return result;
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+namespace
+{
+// Column of the Arrow batch written in the binary COPY stream
+struct OGRPGArrowColumn
+{
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    int iGeomField = -1;
+    Oid nTypeOID = 0;  // type of the destination column, for attributes
+};
+
+inline bool ArrowIsNull(const struct ArrowArray *psArray, size_t iRow)
+{
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+    return psArray->null_count != 0 && pabyValidity != nullptr &&
+           (pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) == 0;
+}
+
+template <class T>
+inline T ArrowGetValue(const struct ArrowArray *psArray, size_t iRow)
+{
+    return static_cast<const T *>(
+        psArray->buffers[1])[iRow + static_cast<size_t>(psArray->offset)];
+}
+
+// Returns the pointer to and the size of a string or binary value
+inline const GByte *ArrowGetBinary(const struct ArrowSchema *psSchema,
+                                   const struct ArrowArray *psArray,
+                                   size_t iRow, size_t &nSize)
+{
+    const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+    size_t nStart;
+    if (psSchema->format[0] == 'u' || psSchema->format[0] == 'z')
+    {
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]) + nIdx;
+        nStart = static_cast<size_t>(panOffsets[0]);
+        nSize = static_cast<size_t>(panOffsets[1] - panOffsets[0]);
+    }
+    else
+    {
+        const auto panOffsets =
+            static_cast<const int64_t *>(psArray->buffers[1]) + nIdx;
+        nStart = static_cast<size_t>(panOffsets[0]);
+        nSize = static_cast<size_t>(panOffsets[1] - panOffsets[0]);
+    }
+    return static_cast<const GByte *>(psArray->buffers[2]) + nStart;
+}
+
+// Returns an integer Arrow value, or a real one in dfVal for 'f' and 'g'
+inline int64_t ArrowGetNumber(const struct ArrowSchema *psSchema,
+                              const struct ArrowArray *psArray, size_t iRow,
+                              double &dfVal)
+{
+    switch (psSchema->format[0])
+    {
+        case 'b':
+        {
+            const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+            return (static_cast<const uint8_t *>(
+                        psArray->buffers[1])[nIdx / 8] >>
+                    (nIdx % 8)) &
+                   1;
+        }
+        case 'c':
+            return ArrowGetValue<int8_t>(psArray, iRow);
+        case 'C':
+            return ArrowGetValue<uint8_t>(psArray, iRow);
+        case 's':
+            return ArrowGetValue<int16_t>(psArray, iRow);
+        case 'S':
+            return ArrowGetValue<uint16_t>(psArray, iRow);
+        case 'i':
+            return ArrowGetValue<int32_t>(psArray, iRow);
+        case 'I':
+            return ArrowGetValue<uint32_t>(psArray, iRow);
+        case 'l':
+            return ArrowGetValue<int64_t>(psArray, iRow);
+        case 'f':
+            dfVal = ArrowGetValue<float>(psArray, iRow);
+            break;
+        default:
+            dfVal = ArrowGetValue<double>(psArray, iRow);
+            break;
+    }
+    return 0;
+}
+
+// Returns whether the Arrow column is tagged as a WKB geometry column
+bool IsArrowWKBColumn(const struct ArrowSchema *psSchema)
+{
+    if (psSchema->metadata == nullptr)
+        return false;
+    const auto oMetadata = OGRParseArrowMetadata(psSchema->metadata);
+    const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+    return oIter != oMetadata.end() &&
+           (oIter->second == EXTENSION_NAME_OGC_WKB ||
+            oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+}
+
+// Returns whether values of the Arrow format can be written without loss
+// in the binary representation of a column of type nTypeOID
+bool IsArrowFormatCompatibleOfBinaryCopy(const char *pszFormat, Oid nTypeOID)
+{
+    if (pszFormat[0] == '\0' || pszFormat[1] != '\0')
+        return false;
+    switch (pszFormat[0])
+    {
+        case 'b':
+            return nTypeOID == BOOLOID || nTypeOID == INT2OID ||
+                   nTypeOID == INT4OID || nTypeOID == INT8OID;
+        case 'c':
+        case 'C':
+        case 's':
+            return nTypeOID == INT2OID || nTypeOID == INT4OID ||
+                   nTypeOID == INT8OID || nTypeOID == FLOAT4OID ||
+                   nTypeOID == FLOAT8OID;
+        case 'S':
+        case 'i':
+            return nTypeOID == INT4OID || nTypeOID == INT8OID ||
+                   nTypeOID == FLOAT8OID;
+        case 'I':
+        case 'l':
+            return nTypeOID == INT8OID;
+        case 'f':
+            return nTypeOID == FLOAT4OID || nTypeOID == FLOAT8OID;
+        case 'g':
+            return nTypeOID == FLOAT8OID;
+        case 'u':
+        case 'U':
+            return nTypeOID == TEXTOID || nTypeOID == VARCHAROID;
+        case 'z':
+        case 'Z':
+            return nTypeOID == BYTEAOID;
+        default:
+            break;
+    }
+    return false;
+}
+
+/** Accumulates the content of a binary COPY FROM STDIN stream, and sends
+ * it to the server by chunks. */
+class OGRPGBinaryCopyWriter
+{
+    PGconn *const m_hPGConn;
+    std::vector<GByte> m_abyBuffer{};
+
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+
+  public:
+    explicit OGRPGBinaryCopyWriter(PGconn *hPGConn) : m_hPGConn(hPGConn)
+    {
+        static const GByte abyHeader[] = {'P', 'G', 'C', 'O',  'P', 'Y',
+                                          '\n', 0xFF, '\r', '\n', 0,
+                                          // Flags
+                                          0, 0, 0, 0,
+                                          // Header extension length
+                                          0, 0, 0, 0};
+        m_abyBuffer.reserve(CHUNK_SIZE + CHUNK_SIZE / 4);
+        m_abyBuffer.insert(m_abyBuffer.end(), abyHeader,
+                           abyHeader + sizeof(abyHeader));
+    }
+
+    void AppendInt16(int16_t nVal)
+    {
+        CPL_MSBPTR16(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        m_abyBuffer.insert(m_abyBuffer.end(), pabyVal, pabyVal + sizeof(nVal));
+    }
+
+    void AppendInt32(int32_t nVal)
+    {
+        CPL_MSBPTR32(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        m_abyBuffer.insert(m_abyBuffer.end(), pabyVal, pabyVal + sizeof(nVal));
+    }
+
+    void AppendInt64(int64_t nVal)
+    {
+        CPL_MSBPTR64(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        m_abyBuffer.insert(m_abyBuffer.end(), pabyVal, pabyVal + sizeof(nVal));
+    }
+
+    void AppendBytes(const GByte *pabyData, size_t nSize)
+    {
+        m_abyBuffer.insert(m_abyBuffer.end(), pabyData, pabyData + nSize);
+    }
+
+    /** Appends a value of the type of nTypeOID, from an integer or real */
+    void AppendNumber(Oid nTypeOID, int64_t nVal, double dfVal, bool bIsReal)
+    {
+        switch (nTypeOID)
+        {
+            case BOOLOID:
+                AppendInt32(1);
+                m_abyBuffer.push_back(nVal != 0 ? 1 : 0);
+                break;
+            case INT2OID:
+                AppendInt32(2);
+                AppendInt16(static_cast<int16_t>(nVal));
+                break;
+            case INT4OID:
+                AppendInt32(4);
+                AppendInt32(static_cast<int32_t>(nVal));
+                break;
+            case INT8OID:
+                AppendInt32(8);
+                AppendInt64(nVal);
+                break;
+            case FLOAT4OID:
+            {
+                float fVal = bIsReal ? static_cast<float>(dfVal)
+                                     : static_cast<float>(nVal);
+                AppendInt32(4);
+                CPL_MSBPTR32(&fVal);
+                AppendBytes(reinterpret_cast<const GByte *>(&fVal),
+                            sizeof(fVal));
+                break;
+            }
+            default:
+            {
+                if (!bIsReal)
+                    dfVal = static_cast<double>(nVal);
+                AppendInt32(8);
+                CPL_MSBPTR64(&dfVal);
+                AppendBytes(reinterpret_cast<const GByte *>(&dfVal),
+                            sizeof(dfVal));
+                break;
+            }
+        }
+    }
+
+    /** Sends the accumulated data to the server if it is large enough, or
+     * unconditionally if bForce */
+    bool Flush(bool bForce)
+    {
+        if (m_abyBuffer.empty() || (!bForce && m_abyBuffer.size() < CHUNK_SIZE))
+            return true;
+        const int nRet = PQputCopyData(
+            m_hPGConn, reinterpret_cast<const char *>(m_abyBuffer.data()),
+            static_cast<int>(m_abyBuffer.size()));
+        m_abyBuffer.clear();
+        if (nRet != 1)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     PQerrorMessage(m_hPGConn));
+            return false;
+        }
+        return true;
+    }
+};
+
+}  // namespace
+
+// Write a batch of rows with a COPY ... FROM STDIN (FORMAT binary)
+// statement, encoding directly the values of the Arrow columns, without
+// going through OGRFeature and OGRGeometry.
+// Batches with columns that this does not handle (dates, lists,
+// dictionaries, fields with a width, lossy type conversions, geometries
+// whose dimension differ from the one of the geometry column, etc.) are
+// delegated to the generic implementation.
+bool OGRPGTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                      struct ArrowArray *array,
+                                      CSLConstList papszOptions)
+{
+    GetLayerDefn()->GetFieldCount();
+
+    if (!bUpdateAccess || strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children ||
+        schema->n_children == 0 || array->offset != 0 ||
+        array->null_count != 0 || iFIDAsRegularColumnIndex >= 0 ||
+        !poDS->IsUTF8ClientEncoding() ||
+        (bFirstInsertion &&
+         CPLTestBool(CPLGetConfigOption("OGR_TRUNCATE", "NO"))))
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    if (!pszFIDName || pszFIDName[0] == 0)
+        pszFIDName = DEFAULT_ARROW_FID_NAME;
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    // Map the Arrow columns to the ones of the table
+    OGRPGArrowColumn oFIDColumn;
+    std::vector<OGRPGArrowColumn> aoColumns;
+    std::vector<int> anFields;
+    std::vector<bool> abFieldWritten(poFeatureDefn->GetFieldCount(), false);
+    std::vector<bool> abGeomFieldWritten(poFeatureDefn->GetGeomFieldCount(),
+                                         false);
+    std::string osFieldList;
+    const auto AddColumnName = [&osFieldList](const char *pszName)
+    {
+        if (!osFieldList.empty())
+            osFieldList += ", ";
+        osFieldList += OGRPGEscapeColumnName(pszName);
+    };
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        const auto psChildSchema = schema->children[i];
+        const auto psChildArray = array->children[i];
+        if (psChildSchema->dictionary != nullptr ||
+            psChildSchema->n_children != 0 || psChildSchema->name == nullptr)
+        {
+            return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        }
+        const char *pszFormat = psChildSchema->format;
+        const bool bIsBinary =
+            strcmp(pszFormat, "z") == 0 || strcmp(pszFormat, "Z") == 0;
+        int iGeomField = -1;
+        if (bIsBinary)
+        {
+            iGeomField = poFeatureDefn->GetGeomFieldIndex(psChildSchema->name);
+            if (iGeomField < 0 && EQUAL(psChildSchema->name, pszGeomFieldName))
+                iGeomField = 0;
+            if (iGeomField < 0 && IsArrowWKBColumn(psChildSchema) &&
+                poFeatureDefn->GetGeomFieldCount() == 1)
+                iGeomField = 0;
+            if (iGeomField >= poFeatureDefn->GetGeomFieldCount())
+                iGeomField = -1;
+        }
+
+        if (pszFIDColumn != nullptr && EQUAL(psChildSchema->name, pszFIDName))
+        {
+            // Explicit FIDs. NULL values would not get their value from the
+            // sequence.
+            if (oFIDColumn.psSchema != nullptr ||
+                psChildArray->null_count != 0 ||
+                !(strcmp(pszFormat, "i") == 0 || strcmp(pszFormat, "l") == 0))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            oFIDColumn.psSchema = psChildSchema;
+            oFIDColumn.psArray = psChildArray;
+        }
+        else if (iGeomField >= 0)
+        {
+            const OGRPGGeomFieldDefn *poGeomFieldDefn =
+                poFeatureDefn->GetGeomFieldDefn(iGeomField);
+            if (abGeomFieldWritten[iGeomField] ||
+                (poGeomFieldDefn->ePostgisType != GEOM_TYPE_GEOMETRY &&
+                 poGeomFieldDefn->ePostgisType != GEOM_TYPE_GEOGRAPHY))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            abGeomFieldWritten[iGeomField] = true;
+            OGRPGArrowColumn oColumn;
+            oColumn.psSchema = psChildSchema;
+            oColumn.psArray = psChildArray;
+            oColumn.iGeomField = iGeomField;
+            aoColumns.push_back(oColumn);
+            anFields.push_back(-1);
+            AddColumnName(poGeomFieldDefn->GetNameRef());
+        }
+        else
+        {
+            // Columns with metadata may be extension types (JSON, ...)
+            // that the generic implementation knows how to handle.
+            const int iField =
+                psChildSchema->metadata == nullptr
+                    ? poFeatureDefn->GetFieldIndex(psChildSchema->name)
+                    : -1;
+            if (iField < 0 || abFieldWritten[iField] ||
+                m_abGeneratedColumns[iField] ||
+                poFeatureDefn->GetFieldDefn(iField)->GetWidth() > 0)
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            abFieldWritten[iField] = true;
+            OGRPGArrowColumn oColumn;
+            oColumn.psSchema = psChildSchema;
+            oColumn.psArray = psChildArray;
+            aoColumns.push_back(oColumn);
+            anFields.push_back(iField);
+            AddColumnName(poFeatureDefn->GetFieldDefn(iField)->GetNameRef());
+        }
+    }
+    if (aoColumns.empty())
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    const size_t nRows = static_cast<size_t>(array->length);
+    if (oFIDColumn.psSchema != nullptr &&
+        strcmp(oFIDColumn.psSchema->format, "l") == 0 &&
+        OGRLayer::GetMetadataItem(OLMD_FID64) == nullptr)
+    {
+        // Promotion of the FID column to 64 bit is done by CreateFeature()
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            if (!CPL_INT64_FITS_ON_INT32(
+                    ArrowGetValue<int64_t>(oFIDColumn.psArray, iRow)))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+        }
+    }
+
+    // Geometries must have the dimension of their column, as they are not
+    // processed by PostGIS like with CreateFeature()
+    for (const auto &oColumn : aoColumns)
+    {
+        if (oColumn.iGeomField < 0)
+            continue;
+        const int nFlags =
+            poFeatureDefn->GetGeomFieldDefn(oColumn.iGeomField)
+                ->GeometryTypeFlags;
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            if (ArrowIsNull(oColumn.psArray, iRow))
+                continue;
+            size_t nWKBSize = 0;
+            const GByte *pabyWKB = ArrowGetBinary(
+                oColumn.psSchema, oColumn.psArray, iRow, nWKBSize);
+            OGRwkbGeometryType eGeomType = wkbUnknown;
+            if (nWKBSize < 5 ||
+                OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eGeomType) !=
+                    OGRERR_NONE ||
+                CPL_TO_BOOL(OGR_GT_HasZ(eGeomType)) !=
+                    ((nFlags & OGRGeometry::OGR_G_3D) != 0) ||
+                CPL_TO_BOOL(OGR_GT_HasM(eGeomType)) !=
+                    ((nFlags & OGRGeometry::OGR_G_MEASURED) != 0))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+        }
+    }
+
+    if (bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return false;
+    poDS->EndCopy();
+    bFirstInsertion = FALSE;
+
+    PGconn *hPGConn = poDS->GetPGConn();
+
+    // Fetch the types of the destination attribute columns
+    {
+        std::string osAttrList;
+        for (size_t i = 0; i < aoColumns.size(); ++i)
+        {
+            if (anFields[i] < 0)
+                continue;
+            if (!osAttrList.empty())
+                osAttrList += ", ";
+            osAttrList += OGRPGEscapeColumnName(
+                poFeatureDefn->GetFieldDefn(anFields[i])->GetNameRef());
+        }
+        if (!osAttrList.empty())
+        {
+            CPLString osCommand;
+            osCommand.Printf("SELECT %s FROM %s LIMIT 0", osAttrList.c_str(),
+                             pszSqlTableName);
+            PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand);
+            if (!hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         PQerrorMessage(hPGConn));
+                OGRPGClearResult(hResult);
+                return false;
+            }
+            int iResultCol = 0;
+            bool bCompatible = true;
+            for (size_t i = 0; i < aoColumns.size(); ++i)
+            {
+                if (anFields[i] < 0)
+                    continue;
+                aoColumns[i].nTypeOID = PQftype(hResult, iResultCol++);
+                if (!IsArrowFormatCompatibleOfBinaryCopy(
+                        aoColumns[i].psSchema->format, aoColumns[i].nTypeOID))
+                {
+                    bCompatible = false;
+                }
+            }
+            OGRPGClearResult(hResult);
+            if (!bCompatible)
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        }
+    }
+
+    if (oFIDColumn.psSchema != nullptr)
+    {
+        osFieldList = OGRPGEscapeColumnName(pszFIDColumn) + ", " + osFieldList;
+    }
+
+    CPLString osCommand;
+    osCommand.Printf("COPY %s (%s) FROM STDIN (FORMAT binary)",
+                     pszSqlTableName, osFieldList.c_str());
+    PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand);
+    if (!hResult || PQresultStatus(hResult) != PGRES_COPY_IN)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(hPGConn));
+        OGRPGClearResult(hResult);
+        return false;
+    }
+    OGRPGClearResult(hResult);
+
+    const int16_t nColumns = static_cast<int16_t>(
+        aoColumns.size() + (oFIDColumn.psSchema != nullptr ? 1 : 0));
+    OGRPGBinaryCopyWriter oWriter(hPGConn);
+    bool bRet = true;
+    for (size_t iRow = 0; bRet && iRow < nRows; ++iRow)
+    {
+        oWriter.AppendInt16(nColumns);
+        if (oFIDColumn.psSchema != nullptr)
+        {
+            oWriter.AppendInt32(8);
+            oWriter.AppendInt64(
+                oFIDColumn.psSchema->format[0] == 'i'
+                    ? ArrowGetValue<int32_t>(oFIDColumn.psArray, iRow)
+                    : ArrowGetValue<int64_t>(oFIDColumn.psArray, iRow));
+        }
+
+        for (const auto &oColumn : aoColumns)
+        {
+            if (ArrowIsNull(oColumn.psArray, iRow))
+            {
+                oWriter.AppendInt32(-1);
+                continue;
+            }
+
+            const char chFormat = oColumn.psSchema->format[0];
+            if (oColumn.iGeomField >= 0)
+            {
+                size_t nWKBSize = 0;
+                const GByte *pabyWKB = ArrowGetBinary(
+                    oColumn.psSchema, oColumn.psArray, iRow, nWKBSize);
+                const int nSRSId =
+                    poFeatureDefn->GetGeomFieldDefn(oColumn.iGeomField)
+                        ->nSRSId;
+                if (nSRSId > 0 && nWKBSize <= INT_MAX - 4)
+                {
+                    // Convert to EWKB, with the SRID of the column
+                    constexpr uint32_t EWKB_SRID_FLAG = 0x20000000U;
+                    uint32_t nType;
+                    memcpy(&nType, pabyWKB + 1, sizeof(nType));
+                    int32_t nSRID = nSRSId;
+                    if (pabyWKB[0] == wkbNDR)
+                    {
+                        CPL_LSBPTR32(&nType);
+                        nType |= EWKB_SRID_FLAG;
+                        CPL_LSBPTR32(&nType);
+                        CPL_LSBPTR32(&nSRID);
+                    }
+                    else
+                    {
+                        CPL_MSBPTR32(&nType);
+                        nType |= EWKB_SRID_FLAG;
+                        CPL_MSBPTR32(&nType);
+                        CPL_MSBPTR32(&nSRID);
+                    }
+                    oWriter.AppendInt32(static_cast<int32_t>(nWKBSize + 4));
+                    oWriter.AppendBytes(pabyWKB, 1);
+                    oWriter.AppendBytes(reinterpret_cast<const GByte *>(&nType),
+                                        sizeof(nType));
+                    oWriter.AppendBytes(reinterpret_cast<const GByte *>(&nSRID),
+                                        sizeof(nSRID));
+                    oWriter.AppendBytes(pabyWKB + 5, nWKBSize - 5);
+                }
+                else if (nWKBSize <= INT_MAX)
+                {
+                    oWriter.AppendInt32(static_cast<int32_t>(nWKBSize));
+                    oWriter.AppendBytes(pabyWKB, nWKBSize);
+                }
+                else
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Too large geometry");
+                    bRet = false;
+                    break;
+                }
+            }
+            else if (chFormat == 'u' || chFormat == 'U' || chFormat == 'z' ||
+                     chFormat == 'Z')
+            {
+                size_t nSize = 0;
+                const GByte *pabyData = ArrowGetBinary(
+                    oColumn.psSchema, oColumn.psArray, iRow, nSize);
+                if (nSize > INT_MAX)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Too large string or binary content");
+                    bRet = false;
+                    break;
+                }
+                oWriter.AppendInt32(static_cast<int32_t>(nSize));
+                oWriter.AppendBytes(pabyData, nSize);
+            }
+            else
+            {
+                double dfVal = 0;
+                const int64_t nVal = ArrowGetNumber(
+                    oColumn.psSchema, oColumn.psArray, iRow, dfVal);
+                oWriter.AppendNumber(oColumn.nTypeOID, nVal, dfVal,
+                                     chFormat == 'f' || chFormat == 'g');
+            }
+        }
+
+        if (bRet)
+            bRet = oWriter.Flush(false);
+    }
+
+    if (bRet)
+    {
+        // File trailer
+        oWriter.AppendInt16(-1);
+        bRet = oWriter.Flush(true);
+    }
+
+    if (PQputCopyEnd(hPGConn, bRet ? nullptr : "aborted") != 1)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(hPGConn));
+        bRet = false;
+    }
+    while ((hResult = PQgetResult(hPGConn)) != nullptr)
+    {
+        if (PQresultStatus(hResult) != PGRES_COMMAND_OK && bRet)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "COPY statement failed.\n%s", PQerrorMessage(hPGConn));
+            bRet = false;
+        }
+        OGRPGClearResult(hResult);
+    }
+
+    if (bRet && oFIDColumn.psSchema != nullptr && nRows > 0)
+    {
+        bNeedToUpdateSequence = true;
+        UpdateSequenceIfNeeded();
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -2271,7 +3747,7 @@ int OGRPGTableLayer::TestCapability(const char *pszCap)
         }
     }
 
-    if (EQUAL(pszCap, OLCRandomRead))
+    if (EQUAL(pszCap, OLCRandomRead) || EQUAL(pszCap, OLCFastGetArrowStream))
     {
         GetLayerDefn()->GetFieldCount();
         return pszFIDColumn != nullptr;
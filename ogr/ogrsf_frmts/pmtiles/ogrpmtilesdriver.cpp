@@ -148,6 +148,106 @@ static GDALDataset *OGRPMTilesDriverCreate(const char *pszFilename, int nXSize,
     }
     return nullptr;
 }
+
+/************************************************************************/
+/*                              CreateCopy()                            */
+/************************************************************************/
+
+// Raster PMTiles are created by generating a temporary MBTiles file, with
+// the MBTiles raster driver, that contains the full resolution level and
+// all overview zoom levels, and then converting it into PMTiles.
+static GDALDataset *
+OGRPMTilesDriverCreateCopy(const char *pszFilename, GDALDataset *poSrcDS,
+                           int bStrict, char **papszOptions,
+                           GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    if (poSrcDS->GetRasterCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "PMTiles CreateCopy() only supports raster datasets");
+        return nullptr;
+    }
+
+    auto poMBTilesDriver = GetGDALDriverManager()->GetDriverByName("MBTiles");
+    if (!poMBTilesDriver)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "MBTiles driver needed to create raster PMTiles");
+        return nullptr;
+    }
+
+    std::string osTmpFile(pszFilename);
+    if (!VSIIsLocal(pszFilename))
+    {
+        osTmpFile = CPLGenerateTempFilename(CPLGetFilename(pszFilename));
+    }
+    osTmpFile += ".tmp.mbtiles";
+
+    // Only forward the raster options understood by the MBTiles driver
+    CPLStringList aosOptions;
+    for (const char *pszKey :
+         {"NAME", "DESCRIPTION", "TYPE", "BLOCKSIZE", "TILE_FORMAT", "QUALITY",
+          "ZLEVEL", "DITHER", "ZOOM_LEVEL_STRATEGY", "RESAMPLING", "BOUNDS",
+          "CENTER"})
+    {
+        const char *pszValue = CSLFetchNameValue(papszOptions, pszKey);
+        if (pszValue)
+            aosOptions.SetNameValue(pszKey, pszValue);
+    }
+    if (!aosOptions.FetchNameValue("NAME"))
+        aosOptions.SetNameValue("NAME", CPLGetBasename(pszFilename));
+
+    bool bRet;
+    {
+        void *pScaledProgress =
+            GDALCreateScaledProgress(0.0, 0.5, pfnProgress, pProgressData);
+        auto poMBTilesDS = std::unique_ptr<GDALDataset>(
+            poMBTilesDriver->CreateCopy(osTmpFile.c_str(), poSrcDS, bStrict,
+                                        aosOptions.List(), GDALScaledProgress,
+                                        pScaledProgress));
+        GDALDestroyScaledProgress(pScaledProgress);
+        bRet = poMBTilesDS != nullptr;
+
+        // Generate all zoom levels down to zoom level 0
+        const int nOvrCount =
+            bRet ? poMBTilesDS->GetRasterBand(1)->GetOverviewCount() : 0;
+        if (nOvrCount > 0)
+        {
+            std::vector<int> anOvrFactors;
+            for (int i = 0; i < nOvrCount; ++i)
+                anOvrFactors.push_back(1 << (i + 1));
+            pScaledProgress =
+                GDALCreateScaledProgress(0.5, 0.9, pfnProgress, pProgressData);
+            bRet = poMBTilesDS->BuildOverviews(
+                       CSLFetchNameValueDef(papszOptions, "RESAMPLING",
+                                            "BILINEAR"),
+                       nOvrCount, anOvrFactors.data(), 0, nullptr,
+                       GDALScaledProgress, pScaledProgress,
+                       nullptr) == CE_None;
+            GDALDestroyScaledProgress(pScaledProgress);
+        }
+
+        if (poMBTilesDS && poMBTilesDS->Close() != CE_None)
+            bRet = false;
+    }
+
+    bRet = bRet &&
+           OGRPMTilesConvertFromMBTiles(pszFilename, osTmpFile.c_str());
+    VSIUnlink(osTmpFile.c_str());
+    if (!bRet)
+        return nullptr;
+
+    if (pfnProgress)
+        pfnProgress(1.0, "", pProgressData);
+
+    // The driver does not read raster tiles, but the file can still be
+    // opened to expose its metadata.
+    GDALOpenInfo oOpenInfo(pszFilename, GA_ReadOnly);
+    CPLStringList aosOpenOptions;
+    aosOpenOptions.SetNameValue("ACCEPT_ANY_TILE_TYPE", "YES");
+    oOpenInfo.papszOpenOptions = aosOpenOptions.List();
+    return OGRPMTilesDriverOpen(&oOpenInfo);
+}
 #endif
 
 /************************************************************************/
@@ -208,7 +308,46 @@ void RegisterOGRPMTiles()
         "description='Layer type' default='overlay'>"
         "    <Value>overlay</Value>"
         "    <Value>baselayer</Value>"
-        "  </Option>" MVT_MBTILES_PMTILES_COMMON_DSCO "</CreationOptionList>");
+        "  </Option>"
+        "  <Option name='BLOCKSIZE' scope='raster' type='int' "
+        "description='Block size in pixels' default='256' min='64' "
+        "max='8192'/>"
+        "  <Option name='TILE_FORMAT' scope='raster' type='string-select' "
+        "description='Format to use to create tiles' default='PNG'>"
+        "    <Value>PNG</Value>"
+        "    <Value>PNG8</Value>"
+        "    <Value>JPEG</Value>"
+        "    <Value>WEBP</Value>"
+        "  </Option>"
+        "  <Option name='QUALITY' scope='raster' type='int' min='1' max='100' "
+        "description='Quality for JPEG and WEBP tiles' default='75'/>"
+        "  <Option name='ZLEVEL' scope='raster' type='int' min='1' max='9' "
+        "description='DEFLATE compression level for PNG tiles' default='6'/>"
+        "  <Option name='DITHER' scope='raster' type='boolean' "
+        "description='Whether to apply Floyd-Steinberg dithering (for "
+        "TILE_FORMAT=PNG8)' default='NO'/>"
+        "  <Option name='ZOOM_LEVEL_STRATEGY' scope='raster' "
+        "type='string-select' description='Strategy to determine zoom level.' "
+        "default='AUTO'>"
+        "    <Value>AUTO</Value>"
+        "    <Value>LOWER</Value>"
+        "    <Value>UPPER</Value>"
+        "  </Option>"
+        "  <Option name='RESAMPLING' scope='raster' type='string-select' "
+        "description='Resampling algorithm.' default='BILINEAR'>"
+        "    <Value>NEAREST</Value>"
+        "    <Value>BILINEAR</Value>"
+        "    <Value>CUBIC</Value>"
+        "    <Value>CUBICSPLINE</Value>"
+        "    <Value>LANCZOS</Value>"
+        "    <Value>MODE</Value>"
+        "    <Value>AVERAGE</Value>"
+        "  </Option>"
+        "  <Option name='BOUNDS' scope='raster' type='string' "
+        "description='Override default value for bounds metadata item'/>"
+        "  <Option name='CENTER' scope='raster' type='string' "
+        "description='Override default value for center metadata item'/>"
+        MVT_MBTILES_PMTILES_COMMON_DSCO "</CreationOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_LAYER, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_FIELD, "YES");
@@ -220,6 +359,10 @@ void RegisterOGRPMTiles()
     poDriver->SetMetadataItem(GDAL_DS_LAYER_CREATIONOPTIONLIST, MVT_LCO);
 
     poDriver->pfnCreate = OGRPMTilesDriverCreate;
+
+    poDriver->SetMetadataItem(GDAL_DCAP_RASTER, "YES");
+    poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte");
+    poDriver->pfnCreateCopy = OGRPMTilesDriverCreateCopy;
 #endif
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
@@ -96,8 +96,29 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
     // MBTiles advertises scheme=tms. Override this
     oObj.Set("scheme", "xyz");
 
+    // MVT tiles produced by the MBTiles driver are gzip-compressed, whereas
+    // raster tiles are stored as such.
     const auto osFormat = oObj.GetString("format", "{missing}");
-    if (osFormat != "pbf")
+    uint8_t nTileType = pmtiles::TILETYPE_UNKNOWN;
+    uint8_t nTileCompression = pmtiles::COMPRESSION_NONE;
+    if (osFormat == "pbf")
+    {
+        nTileType = pmtiles::TILETYPE_MVT;
+        nTileCompression = pmtiles::COMPRESSION_GZIP;
+    }
+    else if (osFormat == "png")
+    {
+        nTileType = pmtiles::TILETYPE_PNG;
+    }
+    else if (osFormat == "jpg")
+    {
+        nTileType = pmtiles::TILETYPE_JPEG;
+    }
+    else if (osFormat == "webp")
+    {
+        nTileType = pmtiles::TILETYPE_WEBP;
+    }
+    else
     {
         CPLError(CE_Failure, CPLE_AppDefined, "format=%s unhandled",
                  osFormat.c_str());
@@ -118,6 +139,33 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
         return false;
     }
 
+    const CPLStringList aosBounds(
+        CSLTokenizeString2(oObj.GetString("bounds").c_str(), ",", 0));
+    if (aosBounds.size() != 4)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Expected 4 values for bounds");
+        return false;
+    }
+    const double dfMinX = CPLAtof(aosBounds[0]);
+    const double dfMinY = CPLAtof(aosBounds[1]);
+    const double dfMaxX = CPLAtof(aosBounds[2]);
+    const double dfMaxY = CPLAtof(aosBounds[3]);
+    if (std::fabs(dfMinX) > 180 || std::fabs(dfMinY) > 90 ||
+        std::fabs(dfMaxX) > 180 || std::fabs(dfMaxY) > 90)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid bounds");
+        return false;
+    }
+
+    // The MBTiles raster writer only writes the center if the CENTER
+    // creation option is specified. Default to the center of the bounds at
+    // the minimum zoom level.
+    if (oObj.GetString("center").empty())
+    {
+        oObj.Set("center", CPLSPrintf("%.17g,%.17g,%d", (dfMinX + dfMaxX) / 2,
+                                      (dfMinY + dfMaxY) / 2, nMinZoom));
+    }
+
     const CPLStringList aosCenter(
         CSLTokenizeString2(oObj.GetString("center").c_str(), ",", 0));
     if (aosCenter.size() != 3)
@@ -139,24 +187,6 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
         return false;
     }
 
-    const CPLStringList aosBounds(
-        CSLTokenizeString2(oObj.GetString("bounds").c_str(), ",", 0));
-    if (aosBounds.size() != 4)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Expected 4 values for bounds");
-        return false;
-    }
-    const double dfMinX = CPLAtof(aosBounds[0]);
-    const double dfMinY = CPLAtof(aosBounds[1]);
-    const double dfMaxX = CPLAtof(aosBounds[2]);
-    const double dfMaxY = CPLAtof(aosBounds[3]);
-    if (std::fabs(dfMinX) > 180 || std::fabs(dfMinY) > 90 ||
-        std::fabs(dfMaxX) > 180 || std::fabs(dfMaxY) > 90)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Invalid bounds");
-        return false;
-    }
-
     CPLJSONDocument oMetadataDoc;
     oMetadataDoc.SetRoot(oObj);
     osMetadata = oMetadataDoc.SaveAsString();
@@ -175,8 +205,8 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
     sHeader.tile_contents_count = 0;
     sHeader.clustered = true;
     sHeader.internal_compression = pmtiles::COMPRESSION_GZIP;
-    sHeader.tile_compression = pmtiles::COMPRESSION_GZIP;
-    sHeader.tile_type = pmtiles::TILETYPE_MVT;
+    sHeader.tile_compression = nTileCompression;
+    sHeader.tile_type = nTileType;
     sHeader.min_zoom = static_cast<uint8_t>(nMinZoom);
     sHeader.max_zoom = static_cast<uint8_t>(nMaxZoom);
     sHeader.min_lon_e7 = static_cast<int32_t>(dfMinX * 10e6);
@@ -259,6 +289,7 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
     struct TileEntry
     {
         uint64_t nTileId;
+        GIntBig nFID;
         std::array<unsigned char, 16> abyMD5;
     };
 
@@ -316,6 +347,7 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
 
         TileEntry sEntry;
         sEntry.nTileId = nTileId;
+        sEntry.nFID = poFeature->GetFID();
 
         CPLMD5Context md5context;
         CPLMD5Init(&md5context);
@@ -411,13 +443,10 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
             }
             else
             {
+                pmtiles::zxy sXYZ(0, 0, 0);
                 try
                 {
-                    const auto sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
-                    poTilesLayer->SetAttributeFilter(CPLSPrintf(
-                        "zoom_level = %d AND tile_column = %u AND tile_row = "
-                        "%u",
-                        sXYZ.z, sXYZ.x, (1U << sXYZ.z) - 1U - sXYZ.y));
+                    sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
                 }
                 catch (const std::exception &e)
                 {
@@ -426,9 +455,29 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
                              "Cannot compute xyz: %s", e.what());
                     return false;
                 }
-                poTilesLayer->ResetReading();
-                auto poFeature =
-                    std::unique_ptr<OGRFeature>(poTilesLayer->GetNextFeature());
+                const int nRow = static_cast<int>((1U << sXYZ.z) - 1U - sXYZ.y);
+
+                // Fetch the tile from the FID (SQLite rowid) collected in
+                // the first pass, which avoids a query for each tile.
+                // Fallback to a query if the FID is not usable, e.g. if
+                // "tiles" is a view.
+                auto poFeature = std::unique_ptr<OGRFeature>(
+                    sEntry.nFID != OGRNullFID
+                        ? poTilesLayer->GetFeature(sEntry.nFID)
+                        : nullptr);
+                if (!poFeature ||
+                    poFeature->GetFieldAsInteger(iZoomLevel) != sXYZ.z ||
+                    poFeature->GetFieldAsInteger(iTileColumn) !=
+                        static_cast<int>(sXYZ.x) ||
+                    poFeature->GetFieldAsInteger(iTileRow) != nRow)
+                {
+                    poTilesLayer->SetAttributeFilter(CPLSPrintf(
+                        "zoom_level = %d AND tile_column = %u AND tile_row = "
+                        "%d",
+                        sXYZ.z, sXYZ.x, nRow));
+                    poTilesLayer->ResetReading();
+                    poFeature.reset(poTilesLayer->GetNextFeature());
+                }
                 if (!poFeature)
                 {
                     CPLError(CE_Failure, CPLE_AppDefined, "Cannot find tile");
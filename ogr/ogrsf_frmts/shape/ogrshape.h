@@ -55,7 +55,8 @@
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse = nullptr);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
@@ -210,6 +211,10 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void CloseUnderlyingLayer() override;
 
+    void PrefetchFeaturesMultiThreaded();
+    int GetNextArrowArrayGeneric(struct ArrowArrayStream *,
+                                 struct ArrowArray *out_array);
+
     // WARNING: Each of the below public methods should start with a call to
     // TouchLayer() and test its return value, so as to make sure that
     // the layer is properly re-opened if necessary.
@@ -233,7 +238,9 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    OGRFeature *FetchShape(int iShapeId,
+                           OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
@@ -248,6 +255,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     int GetNextArrowArray(struct ArrowArrayStream *,
@@ -37,15 +37,21 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_port.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -896,7 +902,8 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*      if the shapeid bbox intersects the geometry.                    */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToReuse)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -917,7 +924,8 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -931,14 +939,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
     }
     else
     {
         poFeature =
             SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, nullptr,
-                              osEncoding, m_bHasWarnedWrongWindingOrder);
+                              osEncoding, m_bHasWarnedWrongWindingOrder,
+                              poFeatureToReuse);
     }
 
     return poFeature;
@@ -950,6 +960,31 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRShapeLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    if (oFeature.GetDefnRef() != poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+    return GetNextFeatureInternal(&oFeature) != nullptr;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/*                                                                      */
+/*      When poFeatureToReuse is not null, the next feature is read     */
+/*      into it and it is returned, instead of a new feature.           */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (!TouchLayer())
         return nullptr;
@@ -982,7 +1017,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]));
+                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]),
+                           poFeatureToReuse);
 
             iMatchingFID++;
         }
@@ -1000,10 +1036,10 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 else if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(iNextShapeId);
+                    poFeature = FetchShape(iNextShapeId, poFeatureToReuse);
             }
             else
-                poFeature = FetchShape(iNextShapeId);
+                poFeature = FetchShape(iNextShapeId, poFeatureToReuse);
 
             iNextShapeId++;
         }
@@ -1025,7 +1061,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return poFeature;
             }
 
-            delete poFeature;
+            if (poFeature != poFeatureToReuse)
+                delete poFeature;
         }
     }
 }
@@ -3860,6 +3897,315 @@ GDALDataset *OGRShapeLayer::GetDataset()
     return poDS;
 }
 
+/************************************************************************/
+/*                         Read-only file views                         */
+/************************************************************************/
+
+namespace
+{
+
+// Makes the content of the .shp or .dbf file behind "file" available under
+// a /vsimem/ filename, by memory mapping it when it is a local file.
+// Returns false if that is not possible.
+bool OpenFileView(SAFile file, const void *pOwner,
+                  std::string &osViewFilename, CPLVirtualMem *&psMapping)
+{
+    psMapping = nullptr;
+    const char *pszFilename = VSI_SHP_GetFilename(file);
+    if (STARTS_WITH(pszFilename, "/vsimem/"))
+    {
+        osViewFilename = pszFilename;
+        return true;
+    }
+
+    VSILFILE *fp = VSI_SHP_GetVSIL(file);
+    VSIStatBufL sStat;
+    if (!CPLIsVirtualMemFileMapAvailable() ||
+        VSIFGetNativeFileDescriptorL(fp) == nullptr ||
+        VSIStatL(pszFilename, &sStat) != 0 || sStat.st_size == 0 ||
+        static_cast<vsi_l_offset>(static_cast<size_t>(sStat.st_size)) !=
+            static_cast<vsi_l_offset>(sStat.st_size))
+    {
+        return false;
+    }
+    psMapping = CPLVirtualMemFileMapNew(fp, 0, sStat.st_size,
+                                        VIRTUALMEM_READONLY, nullptr, nullptr);
+    if (psMapping == nullptr)
+        return false;
+
+    osViewFilename = CPLSPrintf("/vsimem/_shapedriver/%p/%s", pOwner,
+                                CPLGetFilename(pszFilename));
+    VSIFCloseL(VSIFileFromMemBuffer(
+        osViewFilename.c_str(),
+        static_cast<GByte *>(CPLVirtualMemGetAddr(psMapping)),
+        CPLVirtualMemGetSize(psMapping), false));
+    return true;
+}
+
+void CloseFileView(const std::string &osViewFilename, CPLVirtualMem *psMapping)
+{
+    if (psMapping)
+    {
+        VSIUnlink(osViewFilename.c_str());
+        CPLVirtualMemFree(psMapping);
+    }
+}
+
+// Returns a copy of hSHP reading from the view, that can be used
+// independently of hSHP (and of other copies) in another thread.
+SHPHandle SHPOpenView(SHPHandle hSHP, const char *pszViewFilename)
+{
+    SHPHandle hView = static_cast<SHPHandle>(CPLMalloc(sizeof(SHPInfo)));
+    *hView = *hSHP;
+    hView->fpSHP =
+        hSHP->sHooks.FOpen(pszViewFilename, "rb", hSHP->sHooks.pvUserData);
+    if (hView->fpSHP == nullptr)
+    {
+        CPLFree(hView);
+        return nullptr;
+    }
+    // The .shx content is entirely loaded for non-network files
+    hView->fpSHX = nullptr;
+    hView->bUpdated = FALSE;
+    hView->pabyRec = nullptr;
+    hView->nBufSize = 0;
+    hView->pabyObjectBuf = nullptr;
+    hView->nObjectBufSize = 0;
+    hView->psCachedObject = nullptr;
+    hView->bFastModeReadObject = FALSE;
+    SHPSetFastModeReadObject(hView, TRUE);
+    return hView;
+}
+
+// Closes a handle returned by SHPOpenView(). panRecOffset and panRecSize
+// are owned by the original handle.
+void SHPCloseView(SHPHandle hView)
+{
+    hView->sHooks.FClose(hView->fpSHP);
+    free(hView->pabyRec);
+    free(hView->pabyObjectBuf);
+    free(hView->psCachedObject);
+    CPLFree(hView);
+}
+
+// Same as SHPOpenView(), for a .dbf file
+DBFHandle DBFOpenView(DBFHandle hDBF, const char *pszViewFilename)
+{
+    DBFHandle hView = static_cast<DBFHandle>(CPLMalloc(sizeof(DBFInfo)));
+    *hView = *hDBF;
+    hView->fp =
+        hDBF->sHooks.FOpen(pszViewFilename, "rb", hDBF->sHooks.pvUserData);
+    if (hView->fp == nullptr)
+    {
+        CPLFree(hView);
+        return nullptr;
+    }
+    hView->nCurrentRecord = -1;
+    hView->bCurrentRecordModified = FALSE;
+    hView->pszCurrentRecord =
+        static_cast<char *>(malloc(std::max(1, hDBF->nRecordLength)));
+    hView->nWorkFieldLength = 0;
+    hView->pszWorkField = nullptr;
+    hView->bNoHeader = FALSE;
+    hView->bUpdated = FALSE;
+    return hView;
+}
+
+// Closes a handle returned by DBFOpenView(). Field definitions are owned by
+// the original handle.
+void DBFCloseView(DBFHandle hView)
+{
+    hView->sHooks.FClose(hView->fp);
+    free(hView->pszCurrentRecord);
+    free(hView->pszWorkField);
+    CPLFree(hView);
+}
+
+struct OGRShapeReadJob
+{
+    SHPHandle hSHP = nullptr;
+    DBFHandle hDBF = nullptr;
+    OGRFeatureDefn *poFeatureDefn = nullptr;
+    const char *pszEncoding = nullptr;
+    int nStart = 0;
+    int nEnd = 0;
+    // Index of the first record that could not be read, or nEnd
+    int nStop = 0;
+    bool bHasWarnedWrongWindingOrder = false;
+    // Null for deleted records
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
+void ReadFeaturesJob(void *pData)
+{
+    auto psJob = static_cast<OGRShapeReadJob *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    psJob->nStop = psJob->nEnd;
+    for (int iShape = psJob->nStart; iShape < psJob->nEnd; ++iShape)
+    {
+        if (psJob->hDBF && DBFIsRecordDeleted(psJob->hDBF, iShape))
+        {
+            psJob->apoFeatures.emplace_back(nullptr);
+            continue;
+        }
+        if (psJob->hDBF && VSIFEofL(VSI_SHP_GetVSIL(psJob->hDBF->fp)))
+        {
+            // I/O error, left to GetNextFeature()
+            psJob->nStop = iShape;
+            break;
+        }
+        const size_t nErrorsBefore = psJob->aoErrors.size();
+        auto poFeature = std::unique_ptr<OGRFeature>(SHPReadOGRFeature(
+            psJob->hSHP, psJob->hDBF, psJob->poFeatureDefn, iShape, nullptr,
+            psJob->pszEncoding, psJob->bHasWarnedWrongWindingOrder));
+        if (!poFeature)
+        {
+            // Leave that record, and the errors it caused, to
+            // GetNextFeature()
+            psJob->aoErrors.resize(nErrorsBefore);
+            psJob->nStop = iShape;
+            break;
+        }
+        psJob->apoFeatures.emplace_back(std::move(poFeature));
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                   PrefetchFeaturesMultiThreaded()                    */
+/************************************************************************/
+
+// Reads the features of the next Arrow batch on worker threads, when
+// GDAL_NUM_THREADS is set, and queues them where the generic
+// implementation of GetNextArrowArray() picks them. Each thread reads
+// through its own copy of the shapelib handles, over a memory mapping of
+// the .shp and .dbf files. Features that cannot be read that way are left
+// to GetNextFeature().
+void OGRShapeLayer::PrefetchFeaturesMultiThreaded()
+{
+    if (m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        panMatchingFIDs != nullptr || bUpdateAccess ||
+        (hSHP == nullptr && hDBF == nullptr))
+    {
+        return;
+    }
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        return;
+    const int nNumThreads = std::max(
+        1, std::min(EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                     : atoi(pszNumThreads),
+                    128));
+
+    auto &oFeatureQueue =
+        m_poSharedArrowArrayStreamPrivateData->m_oFeatureQueue;
+    if (!oFeatureQueue.empty())
+        return;
+
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    const int nStart = iNextShapeId;
+    const int nEnd =
+        nTotalShapeCount - nStart > nMaxBatchSize ? nStart + nMaxBatchSize
+                                                  : nTotalShapeCount;
+    // Not worth using threads on a few features
+    constexpr int MIN_FEATURES_PER_JOB = 64;
+    const int nJobs = std::min(nNumThreads, (nEnd - nStart) /
+                                                MIN_FEATURES_PER_JOB);
+    if (nJobs <= 1)
+        return;
+
+    std::string osSHPView;
+    std::string osDBFView;
+    CPLVirtualMem *psSHPMapping = nullptr;
+    CPLVirtualMem *psDBFMapping = nullptr;
+    if ((hSHP && !OpenFileView(hSHP->fpSHP, this, osSHPView, psSHPMapping)) ||
+        (hDBF && !OpenFileView(hDBF->fp, this, osDBFView, psDBFMapping)))
+    {
+        CloseFileView(osSHPView, psSHPMapping);
+        return;
+    }
+
+    std::vector<OGRShapeReadJob> asJobs(nJobs);
+    bool bOK = true;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        auto &sJob = asJobs[i];
+        sJob.hSHP = hSHP ? SHPOpenView(hSHP, osSHPView.c_str()) : nullptr;
+        sJob.hDBF = hDBF ? DBFOpenView(hDBF, osDBFView.c_str()) : nullptr;
+        bOK = bOK && (hSHP == nullptr || sJob.hSHP != nullptr) &&
+              (hDBF == nullptr || sJob.hDBF != nullptr);
+        sJob.poFeatureDefn = poFeatureDefn;
+        sJob.pszEncoding = osEncoding.c_str();
+        sJob.nStart = nStart + static_cast<int>(
+                                   static_cast<GIntBig>(nEnd - nStart) * i /
+                                   nJobs);
+        sJob.nEnd = nStart + static_cast<int>(
+                                 static_cast<GIntBig>(nEnd - nStart) *
+                                 (i + 1) / nJobs);
+        sJob.bHasWarnedWrongWindingOrder = m_bHasWarnedWrongWindingOrder;
+    }
+
+    if (bOK)
+    {
+        auto poQueue = GDALGetGlobalThreadPool(nNumThreads)->CreateJobQueue();
+        for (auto &sJob : asJobs)
+        {
+            if (!poQueue->SubmitJob(ReadFeaturesJob, &sJob))
+                ReadFeaturesJob(&sJob);
+        }
+        poQueue->WaitCompletion();
+
+        // Queue the features, in order, up to the first record that could
+        // not be read
+        for (auto &sJob : asJobs)
+        {
+            for (const auto &sError : sJob.aoErrors)
+                CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
+            if (sJob.bHasWarnedWrongWindingOrder)
+                m_bHasWarnedWrongWindingOrder = true;
+            for (auto &poFeature : sJob.apoFeatures)
+            {
+                if (!poFeature)
+                    continue;
+                OGRGeometry *poGeom = poFeature->GetGeometryRef();
+                if (poGeom != nullptr)
+                    poGeom->assignSpatialReference(GetSpatialRef());
+                m_nFeaturesRead++;
+                oFeatureQueue.emplace_back(std::move(poFeature));
+            }
+            iNextShapeId = sJob.nStop;
+            if (sJob.nStop != sJob.nEnd)
+                break;
+        }
+    }
+
+    for (auto &sJob : asJobs)
+    {
+        if (sJob.hSHP)
+            SHPCloseView(sJob.hSHP);
+        if (sJob.hDBF)
+            DBFCloseView(sJob.hDBF);
+    }
+    CloseFileView(osSHPView, psSHPMapping);
+    CloseFileView(osDBFView, psDBFMapping);
+}
+
+/************************************************************************/
+/*                     GetNextArrowArrayGeneric()                       */
+/************************************************************************/
+
+int OGRShapeLayer::GetNextArrowArrayGeneric(struct ArrowArrayStream *stream,
+                                            struct ArrowArray *out_array)
+{
+    PrefetchFeaturesMultiThreaded();
+    return OGRLayer::GetNextArrowArray(stream, out_array);
+}
+
 /************************************************************************/
 /*                        GetNextArrowArray()                           */
 /************************************************************************/
@@ -3879,7 +4225,7 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
 
     if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
     {
-        return OGRLayer::GetNextArrowArray(stream, out_array);
+        return GetNextArrowArrayGeneric(stream, out_array);
     }
 
     // If any field is not ignored, use generic implementation
@@ -3887,11 +4233,11 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     for (int i = 0; i < nFieldCount; ++i)
     {
         if (!poFeatureDefn->GetFieldDefn(i)->IsIgnored())
-            return OGRLayer::GetNextArrowArray(stream, out_array);
+            return GetNextArrowArrayGeneric(stream, out_array);
     }
     if (GetGeomType() != wkbNone &&
         !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
-        return OGRLayer::GetNextArrowArray(stream, out_array);
+        return GetNextArrowArrayGeneric(stream, out_array);
 
     OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
                                 m_aosArrowArrayStreamOptions, out_array);
@@ -3901,7 +4247,7 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     }
 
     if (!sHelper.m_bIncludeFID)
-        return OGRLayer::GetNextArrowArray(stream, out_array);
+        return GetNextArrowArrayGeneric(stream, out_array);
 
     m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
     int nCount = 0;
@@ -1297,7 +1297,8 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1321,7 +1322,16 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == poDefn);
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(poDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -29,9 +29,12 @@
 #include "cpl_port.h"
 #include "ogr_sqlite.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
@@ -60,12 +63,200 @@ typedef struct
 #define GET_UNDERLYING_VFS(pVFS)                                               \
     ((OGRSQLiteVFSAppDataStruct *)pVFS->pAppData)->pDefaultVFS
 
+/************************************************************************/
+/*                        OGRSQLitePagePrefetcher                       */
+/************************************************************************/
+
+// Prefetches the sibling pages of B-tree leaf pages read in sequence, for
+// read-only main database files on non-local file systems (/vsicurl/, ...),
+// so that a scan of a table or index issues a few multi-range requests
+// instead of one request per page.
+class OGRSQLitePagePrefetcher
+{
+    static constexpr int MAX_PREFETCH_PAGES = 64;
+    static constexpr int MAX_CACHED_PAGES = 2 * MAX_PREFETCH_PAGES;
+
+    int m_nPageSize = 0;
+    // Child pages of the last interior B-tree page read, in key order
+    std::vector<unsigned> m_anChildPages{};
+    // Index in m_anChildPages of the last child page read
+    int m_iLastChild = -1;
+    int m_nSequentialReads = 0;
+    std::map<unsigned, std::vector<GByte>> m_oMapCachedPages{};
+
+    bool ParseInteriorPage(const GByte *pabyPage, unsigned nPage);
+    void Prefetch(VSILFILE *fp, int iFirstChild);
+
+  public:
+    bool Read(VSILFILE *fp, void *pBuffer, int iAmt, sqlite3_int64 iOfst);
+};
+
+/************************************************************************/
+/*                         ParseInteriorPage()                          */
+/************************************************************************/
+
+// Returns true if the page is an interior B-tree page
+bool OGRSQLitePagePrefetcher::ParseInteriorPage(const GByte *pabyPage,
+                                                unsigned nPage)
+{
+    // The first page starts with the 100-byte database header
+    const int nHeaderOffset = nPage == 1 ? 100 : 0;
+    const GByte *pabyHeader = pabyPage + nHeaderOffset;
+    // 0x02: interior index b-tree page, 0x05: interior table b-tree page
+    if (pabyHeader[0] != 0x02 && pabyHeader[0] != 0x05)
+        return false;
+
+    const auto ReadUInt32 = [](const GByte *pabyData)
+    {
+        GUInt32 nVal;
+        memcpy(&nVal, pabyData, sizeof(nVal));
+        return CPL_MSBWORD32(nVal);
+    };
+
+    m_anChildPages.clear();
+    m_iLastChild = -1;
+    m_nSequentialReads = 0;
+    const int nCells = (pabyHeader[3] << 8) | pabyHeader[4];
+    if (nHeaderOffset + 12 + 2 * nCells > m_nPageSize)
+        return true;
+    for (int i = 0; i < nCells; ++i)
+    {
+        const int nCellOffset =
+            (pabyHeader[12 + 2 * i] << 8) | pabyHeader[12 + 2 * i + 1];
+        if (nCellOffset + 4 > m_nPageSize)
+        {
+            m_anChildPages.clear();
+            return true;
+        }
+        m_anChildPages.push_back(ReadUInt32(pabyPage + nCellOffset));
+    }
+    m_anChildPages.push_back(ReadUInt32(pabyHeader + 8));
+    return true;
+}
+
+/************************************************************************/
+/*                              Prefetch()                              */
+/************************************************************************/
+
+void OGRSQLitePagePrefetcher::Prefetch(VSILFILE *fp, int iFirstChild)
+{
+    // Double the number of prefetched pages as the scan goes on
+    const int nPages = std::min(
+        {1 << std::min(m_nSequentialReads, 6), MAX_PREFETCH_PAGES,
+         static_cast<int>(m_anChildPages.size()) - iFirstChild});
+
+    std::vector<unsigned> anPages;
+    for (int i = iFirstChild; i < iFirstChild + nPages; ++i)
+    {
+        if (m_anChildPages[i] != 0 &&
+            m_oMapCachedPages.find(m_anChildPages[i]) ==
+                m_oMapCachedPages.end())
+        {
+            anPages.push_back(m_anChildPages[i]);
+        }
+    }
+    if (anPages.empty())
+        return;
+    if (m_oMapCachedPages.size() + anPages.size() > MAX_CACHED_PAGES)
+        m_oMapCachedPages.clear();
+
+    // Sort pages so that contiguous ones can be merged by the file system
+    std::sort(anPages.begin(), anPages.end());
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    std::vector<std::vector<GByte> *> apoBuffers;
+    for (unsigned nPage : anPages)
+    {
+        auto &abyPage = m_oMapCachedPages[nPage];
+        abyPage.resize(m_nPageSize);
+        apoBuffers.push_back(&abyPage);
+        apData.push_back(abyPage.data());
+        anOffsets.push_back(static_cast<vsi_l_offset>(nPage - 1) *
+                            m_nPageSize);
+        anSizes.push_back(m_nPageSize);
+    }
+    if (VSIFReadMultiRangeL(static_cast<int>(anPages.size()), apData.data(),
+                            anOffsets.data(), anSizes.data(), fp) != 0)
+    {
+        for (unsigned nPage : anPages)
+            m_oMapCachedPages.erase(nPage);
+    }
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+// Returns false if the read must be done by the caller
+bool OGRSQLitePagePrefetcher::Read(VSILFILE *fp, void *pBuffer, int iAmt,
+                                   sqlite3_int64 iOfst)
+{
+    // SQLite reads whole pages, except for the database header
+    if (iAmt < 512 || iAmt > 65536 || (iAmt & (iAmt - 1)) != 0 ||
+        (iOfst % iAmt) != 0 || (m_nPageSize != 0 && iAmt != m_nPageSize))
+    {
+        return false;
+    }
+    if (m_nPageSize == 0)
+        m_nPageSize = iAmt;
+    const unsigned nPage = static_cast<unsigned>(iOfst / iAmt) + 1;
+
+    auto oIter = m_oMapCachedPages.find(nPage);
+    if (oIter != m_oMapCachedPages.end())
+    {
+        memcpy(pBuffer, oIter->second.data(), iAmt);
+        m_oMapCachedPages.erase(oIter);
+    }
+    else
+    {
+        VSIFSeekL(fp, static_cast<vsi_l_offset>(iOfst), SEEK_SET);
+        if (static_cast<int>(VSIFReadL(pBuffer, 1, iAmt, fp)) != iAmt)
+        {
+            VSIFSeekL(fp, static_cast<vsi_l_offset>(iOfst), SEEK_SET);
+            return false;
+        }
+    }
+
+    // Interior pages become the parent of the next pages read
+    if (ParseInteriorPage(static_cast<const GByte *>(pBuffer), nPage))
+        return true;
+
+    // Is this page the sibling of the previously read child page?
+    const int nChildren = static_cast<int>(m_anChildPages.size());
+    const int iNextChild = m_iLastChild + 1;
+    if (iNextChild < nChildren && m_anChildPages[iNextChild] == nPage)
+    {
+        m_iLastChild = iNextChild;
+        ++m_nSequentialReads;
+        if (m_nSequentialReads >= 2 && iNextChild + 1 < nChildren &&
+            m_oMapCachedPages.find(m_anChildPages[iNextChild + 1]) ==
+                m_oMapCachedPages.end())
+        {
+            Prefetch(fp, iNextChild + 1);
+        }
+    }
+    else
+    {
+        const auto oChildIter =
+            std::find(m_anChildPages.begin(), m_anChildPages.end(), nPage);
+        if (oChildIter != m_anChildPages.end())
+        {
+            m_iLastChild =
+                static_cast<int>(oChildIter - m_anChildPages.begin());
+            m_nSequentialReads = 1;
+        }
+    }
+    return true;
+}
+
 typedef struct
 {
     const struct sqlite3_io_methods *pMethods;
     VSILFILE *fp;
     int bDeleteOnClose;
     char *pszFilename;
+    OGRSQLitePagePrefetcher *poPrefetcher;
 } OGRSQLiteFileStruct;
 
 static int OGRSQLiteIOClose(sqlite3_file *pFile)
@@ -76,6 +267,7 @@ static int OGRSQLiteIOClose(sqlite3_file *pFile)
              pMyFile->pszFilename);
 #endif
     VSIFCloseL(pMyFile->fp);
+    delete pMyFile->poPrefetcher;
     if (pMyFile->bDeleteOnClose)
         VSIUnlink(pMyFile->pszFilename);
     CPLFree(pMyFile->pszFilename);
@@ -86,6 +278,11 @@ static int OGRSQLiteIORead(sqlite3_file *pFile, void *pBuffer, int iAmt,
                            sqlite3_int64 iOfst)
 {
     OGRSQLiteFileStruct *pMyFile = (OGRSQLiteFileStruct *)pFile;
+    if (pMyFile->poPrefetcher &&
+        pMyFile->poPrefetcher->Read(pMyFile->fp, pBuffer, iAmt, iOfst))
+    {
+        return SQLITE_OK;
+    }
     VSIFSeekL(pMyFile->fp, (vsi_l_offset)iOfst, SEEK_SET);
     int nRead = (int)VSIFReadL(pBuffer, 1, iAmt, pMyFile->fp);
 #ifdef DEBUG_IO
@@ -252,6 +449,7 @@ static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zName,
     pMyFile->pMethods = nullptr;
     pMyFile->bDeleteOnClose = FALSE;
     pMyFile->pszFilename = nullptr;
+    pMyFile->poPrefetcher = nullptr;
     if (flags & SQLITE_OPEN_READONLY)
         pMyFile->fp = VSIFOpenL(zName, "rb");
     else if (flags & SQLITE_OPEN_CREATE)
@@ -283,6 +481,14 @@ static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zName,
     pMyFile->pMethods = &OGRSQLiteIOMethods;
     pMyFile->bDeleteOnClose = (flags & SQLITE_OPEN_DELETEONCLOSE);
     pMyFile->pszFilename = CPLStrdup(zName);
+    const char *pszPrefetch =
+        CPLGetConfigOption("OGR_SQLITE_VFS_PREFETCH", "AUTO");
+    if ((flags & SQLITE_OPEN_READONLY) && (flags & SQLITE_OPEN_MAIN_DB) &&
+        (EQUAL(pszPrefetch, "AUTO") ? !VSIIsLocal(zName)
+                                    : CPLTestBool(pszPrefetch)))
+    {
+        pMyFile->poPrefetcher = new OGRSQLitePagePrefetcher();
+    }
 
     if (pOutFlags != nullptr)
         *pOutFlags = flags;
@@ -31,6 +31,7 @@
 #include "cpl_port.h"
 #include "ogrsqlitevirtualogr.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdio>
 #include <cstdlib>
@@ -413,6 +414,10 @@ typedef struct
 
     GByte *pabyGeomBLOB;
     int nGeomBLOBLen;
+
+    /* Mask of used columns for which SetIgnoredFields() has been called */
+    bool bIgnoredFieldsSet;
+    sqlite3_uint64 nColUsed;
 } OGR2SQLITE_vtab_cursor;
 
 #ifdef VIRTUAL_OGR_DYNAMIC_EXTENSION_ENABLED
@@ -974,43 +979,44 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
         }
     }
 
-    int *panConstraints = nullptr;
-
-    if (nConstraints)
-    {
-        panConstraints =
-            (int *)sqlite3_malloc((int)sizeof(int) * (1 + 2 * nConstraints));
-        panConstraints[0] = nConstraints;
+    /* The constraints are followed by the mask of the columns used by the */
+    /* statement, split in two 32-bit halves */
+    int *panConstraints =
+        (int *)sqlite3_malloc((int)sizeof(int) * (1 + 2 * nConstraints + 2));
+    if (panConstraints == nullptr)
+        return SQLITE_NOMEM;
+    panConstraints[0] = nConstraints;
 
-        nConstraints = 0;
+    nConstraints = 0;
 
-        for (int i = 0; i < pIndex->nConstraint; i++)
+    for (int i = 0; i < pIndex->nConstraint; i++)
+    {
+        if (pIndex->aConstraintUsage[i].omit)
         {
-            if (pIndex->aConstraintUsage[i].omit)
-            {
-                panConstraints[2 * nConstraints + 1] =
-                    pIndex->aConstraint[i].iColumn;
-                panConstraints[2 * nConstraints + 2] =
-                    pIndex->aConstraint[i].op;
+            panConstraints[2 * nConstraints + 1] =
+                pIndex->aConstraint[i].iColumn;
+            panConstraints[2 * nConstraints + 2] = pIndex->aConstraint[i].op;
 
-                nConstraints++;
-            }
+            nConstraints++;
         }
     }
 
+    sqlite3_uint64 nColUsed = ~static_cast<sqlite3_uint64>(0);
+#if SQLITE_VERSION_NUMBER >= 3010000L
+    /* SQLite >= 3.10 */
+    if (sqlite3_libversion_number() >= 3010000)
+        nColUsed = pIndex->colUsed;
+#endif
+    panConstraints[2 * nConstraints + 1] =
+        static_cast<int>(static_cast<GUInt32>(nColUsed & 0xFFFFFFFFU));
+    panConstraints[2 * nConstraints + 2] =
+        static_cast<int>(static_cast<GUInt32>(nColUsed >> 32));
+
     pIndex->orderByConsumed = false;
     pIndex->idxNum = 0;
 
-    if (nConstraints != 0)
-    {
-        pIndex->idxStr = (char *)panConstraints;
-        pIndex->needToFreeIdxStr = true;
-    }
-    else
-    {
-        pIndex->idxStr = nullptr;
-        pIndex->needToFreeIdxStr = false;
-    }
+    pIndex->idxStr = (char *)panConstraints;
+    pIndex->needToFreeIdxStr = true;
 
     return SQLITE_OK;
 }
@@ -1109,6 +1115,9 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
 #endif
     pMyVTab->nMyRef--;
 
+    if (pMyCursor->bIgnoredFieldsSet)
+        pMyCursor->poLayer->SetIgnoredFields(nullptr);
+
     delete pMyCursor->poFeature;
     delete pMyCursor->poDupDataSource;
 
@@ -1119,6 +1128,54 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
     return SQLITE_OK;
 }
 
+/************************************************************************/
+/*                     OGR2SQLITE_SetIgnoredFields()                    */
+/************************************************************************/
+
+/* Ask the layer to not fetch the fields and geometries that the statement */
+/* does not use, as reported by SQLite in the colUsed mask */
+static void OGR2SQLITE_SetIgnoredFields(OGR2SQLITE_vtab_cursor *pMyCursor,
+                                        sqlite3_uint64 nColUsed,
+                                        const int *panConstraints,
+                                        int nConstraints)
+{
+    if (pMyCursor->bIgnoredFieldsSet && pMyCursor->nColUsed == nColUsed)
+        return;
+
+    /* Bit 63 is set if any column >= 63 is used */
+    const auto IsColUsed = [nColUsed](int iCol)
+    { return ((nColUsed >> std::min(iCol, 63)) & 1) != 0; };
+    const int nFIDOffset = pMyCursor->pVTab->bHasFIDColumn ? 1 : 0;
+
+    OGRFeatureDefn *poFDefn = pMyCursor->poLayer->GetLayerDefn();
+    const int nFieldCount = poFDefn->GetFieldCount();
+    CPLStringList aosIgnored;
+    for (int i = 0; i < nFieldCount; i++)
+    {
+        bool bUsed = IsColUsed(nFIDOffset + i);
+        for (int j = 0; !bUsed && j < nConstraints; j++)
+            bUsed = panConstraints[2 * j + 1] == nFIDOffset + i;
+        if (!bUsed)
+            aosIgnored.AddString(poFDefn->GetFieldDefn(i)->GetNameRef());
+    }
+    if (!IsColUsed(nFIDOffset + nFieldCount))
+        aosIgnored.AddString("OGR_STYLE");
+    for (int i = 0; i < poFDefn->GetGeomFieldCount(); i++)
+    {
+        if (!IsColUsed(nFIDOffset + nFieldCount + 1 + i))
+        {
+            aosIgnored.AddString(
+                i == 0 ? "OGR_GEOMETRY"
+                       : poFDefn->GetGeomFieldDefn(i)->GetNameRef());
+        }
+    }
+
+    pMyCursor->poLayer->SetIgnoredFields(
+        const_cast<const char **>(aosIgnored.List()));
+    pMyCursor->bIgnoredFieldsSet = true;
+    pMyCursor->nColUsed = nColUsed;
+}
+
 /************************************************************************/
 /*                          OGR2SQLITE_Filter()                         */
 /************************************************************************/
@@ -1138,6 +1195,19 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
     if (nConstraints != argc)
         return SQLITE_ERROR;
 
+    if (panConstraints &&
+        CPLTestBool(CPLGetConfigOption("OGR_SQLITE_VTABLE_IGNORE_UNUSED_FIELDS",
+                                       "YES")))
+    {
+        const sqlite3_uint64 nColUsed =
+            static_cast<GUInt32>(panConstraints[2 * nConstraints + 1]) |
+            (static_cast<sqlite3_uint64>(
+                 static_cast<GUInt32>(panConstraints[2 * nConstraints + 2]))
+             << 32);
+        OGR2SQLITE_SetIgnoredFields(pMyCursor, nColUsed, panConstraints,
+                                    nConstraints);
+    }
+
     CPLString osAttributeFilter;
 
     OGRFeatureDefn *poFDefn = pMyCursor->poLayer->GetLayerDefn();
@@ -1503,12 +1573,13 @@ static int OGR2SQLITE_Column(sqlite3_vtab_cursor *pCursor,
         }
         else
         {
-            GByte *pabyGeomBLOBDup =
-                (GByte *)CPLMalloc(pMyCursor->nGeomBLOBLen);
-            memcpy(pabyGeomBLOBDup, pMyCursor->pabyGeomBLOB,
-                   pMyCursor->nGeomBLOBLen);
-            sqlite3_result_blob(pContext, pabyGeomBLOBDup,
+            /* Hand over the blob to SQLite instead of copying it. It will */
+            /* be exported again if this column is requested again for */
+            /* the same feature. */
+            sqlite3_result_blob(pContext, pMyCursor->pabyGeomBLOB,
                                 pMyCursor->nGeomBLOBLen, CPLFree);
+            pMyCursor->pabyGeomBLOB = nullptr;
+            pMyCursor->nGeomBLOBLen = -1;
         }
 
         return SQLITE_OK;
@@ -29,12 +29,17 @@
 #include "ogrsf_frmts.h"
 #include "cpl_conv.h"
 #include "cpl_minixml.h"
+#include "cpl_error_internal.h"
 #include "cpl_http.h"
 #include "ogr_swq.h"
 #include "parsexsd.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <set>
 
@@ -74,10 +79,12 @@ constexpr const char *OGC_CRS84_WKT =
 /*                           OGROAPIFDataset                             */
 /************************************************************************/
 class OGROAPIFLayer;
+class OGROAPIFPagePrefetcher;
 
 class OGROAPIFDataset final : public GDALDataset
 {
     friend class OGROAPIFLayer;
+    friend class OGROAPIFPagePrefetcher;
 
     bool m_bMustCleanPersistent = false;
     CPLString m_osRootURL;
@@ -86,6 +93,7 @@ class OGROAPIFDataset final : public GDALDataset
     int m_nPageSize = 1000;
     int m_nInitialRequestPageSize = 20;
     bool m_bPageSizeSetFromOpenOptions = false;
+    int m_nPrefetchPages = 0;
     std::vector<std::unique_ptr<OGRLayer>> m_apoLayers;
     std::string m_osAskedCRS{};
     OGRSpatialReference m_oAskedCRS{};
@@ -102,7 +110,8 @@ class OGROAPIFDataset final : public GDALDataset
 
     bool Download(const CPLString &osURL, const char *pszAccept,
                   CPLString &osResult, CPLString &osContentType,
-                  CPLStringList *paosHeaders = nullptr);
+                  CPLStringList *paosHeaders = nullptr,
+                  const char *pszPersistentName = nullptr);
 
     bool DownloadJSon(const CPLString &osURL, CPLJSONDocument &oDoc,
                       const char *pszAccept = MEDIA_TYPE_GEOJSON
@@ -137,6 +146,54 @@ class OGROAPIFDataset final : public GDALDataset
     CPLString ReinjectAuthInURL(const CPLString &osURL) const;
 };
 
+/************************************************************************/
+/*                        OGROAPIFPagePrefetcher                        */
+/************************************************************************/
+
+/** Downloads and parses, in a background thread, up to a given number of
+ * pages ahead of the one being read, by following their "next" link.
+ */
+class OGROAPIFPagePrefetcher
+{
+  public:
+    struct Page
+    {
+        CPLString osURL{};
+        bool bOK = false;
+        CPLJSONDocument oDoc{};
+        CPLStringList aosHeaders{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    OGROAPIFPagePrefetcher(OGROAPIFDataset *poDS, int nMaxPages);
+    ~OGROAPIFPagePrefetcher();
+
+    bool IsRunning() const
+    {
+        return m_oThread.joinable();
+    }
+
+    void Start(const CPLString &osURL);
+    void Stop();
+    bool Get(const CPLString &osURL, Page &oPage);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGROAPIFPagePrefetcher)
+
+    OGROAPIFDataset *m_poDS = nullptr;
+    const int m_nMaxPages;
+    const CPLString m_osPersistentName;
+    bool m_bMustCleanPersistent = false;
+    std::thread m_oThread{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<Page> m_aoPages{};
+    bool m_bStop = false;
+    bool m_bFinished = false;
+
+    void Run(CPLString osURL, const CPLStringList &aosTLConfigOptions);
+};
+
 /************************************************************************/
 /*                            OGROAPIFLayer                              */
 /************************************************************************/
@@ -181,6 +238,7 @@ class OGROAPIFLayer final : public OGRLayer
     std::vector<std::string> m_aosItemAssetNames{};  // STAC specific
     CPLJSONDocument m_oCurDoc{};
     int m_iFeatureInPage = 0;
+    std::unique_ptr<OGROAPIFPagePrefetcher> m_poPrefetcher{};
 
     void EstablishFeatureDefn();
     OGRFeature *GetNextRawFeature();
@@ -272,6 +330,9 @@ static bool CheckContentType(const char *pszGotContentType,
 
 OGROAPIFDataset::~OGROAPIFDataset()
 {
+    // Make sure that page prefetching threads are stopped
+    m_apoLayers.clear();
+
     if (m_bMustCleanPersistent)
     {
         char **papszOptions = CSLSetNameValue(nullptr, "CLOSE_PERSISTENT",
@@ -328,7 +389,8 @@ CPLString OGROAPIFDataset::ReinjectAuthInURL(const CPLString &osURL) const
 
 bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
                                CPLString &osResult, CPLString &osContentType,
-                               CPLStringList *paosHeaders)
+                               CPLStringList *paosHeaders,
+                               const char *pszPersistentName)
 {
 #ifndef REMOVE_HACK
     VSIStatBufL sStatBuf;
@@ -358,9 +420,17 @@ bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
         papszOptions =
             CSLSetNameValue(papszOptions, "USERPWD", m_osUserPwd.c_str());
     }
-    m_bMustCleanPersistent = true;
-    papszOptions =
-        CSLAddString(papszOptions, CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    if (pszPersistentName)
+    {
+        papszOptions = CSLSetNameValue(papszOptions, "PERSISTENT",
+                                       pszPersistentName);
+    }
+    else
+    {
+        m_bMustCleanPersistent = true;
+        papszOptions = CSLAddString(papszOptions,
+                                    CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    }
     CPLString osURLWithQueryParameters(osURL);
     if (!m_osUserQueryParams.empty() &&
         osURL.find('?' + m_osUserQueryParams) == std::string::npos &&
@@ -1094,6 +1164,10 @@ bool OGROAPIFDataset::Open(GDALOpenInfo *poOpenInfo)
         m_bPageSizeSetFromOpenOptions = true;
     }
 
+    m_nPrefetchPages = std::max(
+        0, atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                     "PREFETCH_PAGES", "0")));
+
     const int initialRequestPageSize = atoi(CSLFetchNameValueDef(
         poOpenInfo->papszOpenOptions, "INITIAL_REQUEST_PAGE_SIZE", "-1"));
 
@@ -1894,12 +1968,205 @@ void OGROAPIFLayer::EstablishFeatureDefn()
     }
 }
 
+/************************************************************************/
+/*                          GetNextPageURL()                            */
+/************************************************************************/
+
+// Returns the href of the "next" link of a page of features
+static std::string GetNextPageURL(const CPLJSONObject &oRoot)
+{
+    std::string osRet;
+    CPLJSONArray oLinks = oRoot.GetArray("links");
+    if (oLinks.IsValid())
+    {
+        int nCountRelNext = 0;
+        std::string osNextURL;
+        for (int i = 0; i < oLinks.Size(); i++)
+        {
+            CPLJSONObject oLink = oLinks[i];
+            if (!oLink.IsValid() ||
+                oLink.GetType() != CPLJSONObject::Type::Object)
+            {
+                continue;
+            }
+            if (EQUAL(oLink.GetString("rel").c_str(), "next"))
+            {
+                nCountRelNext++;
+                auto type = oLink.GetString("type");
+                if (type == MEDIA_TYPE_GEOJSON || type == MEDIA_TYPE_JSON)
+                {
+                    osRet = oLink.GetString("href");
+                    break;
+                }
+                else if (type.empty())
+                {
+                    osNextURL = oLink.GetString("href");
+                }
+            }
+        }
+        if (nCountRelNext == 1 && osRet.empty())
+        {
+            // In case we go a "rel": "next" without a "type"
+            osRet = std::move(osNextURL);
+        }
+    }
+    return osRet;
+}
+
+/************************************************************************/
+/*                       OGROAPIFPagePrefetcher()                       */
+/************************************************************************/
+
+OGROAPIFPagePrefetcher::OGROAPIFPagePrefetcher(OGROAPIFDataset *poDS,
+                                               int nMaxPages)
+    : m_poDS(poDS), m_nMaxPages(nMaxPages),
+      m_osPersistentName(CPLSPrintf("OAPIF_PREFETCH:%p", this))
+{
+}
+
+/************************************************************************/
+/*                      ~OGROAPIFPagePrefetcher()                       */
+/************************************************************************/
+
+OGROAPIFPagePrefetcher::~OGROAPIFPagePrefetcher()
+{
+    Stop();
+    if (m_bMustCleanPersistent)
+    {
+        char **papszOptions = CSLSetNameValue(nullptr, "CLOSE_PERSISTENT",
+                                              m_osPersistentName.c_str());
+        CPLHTTPDestroyResult(CPLHTTPFetch(m_poDS->m_osRootURL, papszOptions));
+        CSLDestroy(papszOptions);
+    }
+}
+
+/************************************************************************/
+/*                               Start()                                */
+/************************************************************************/
+
+void OGROAPIFPagePrefetcher::Start(const CPLString &osURL)
+{
+    Stop();
+    m_bMustCleanPersistent = true;
+    m_oThread = std::thread(&OGROAPIFPagePrefetcher::Run, this, osURL,
+                            CPLStringList(CPLGetThreadLocalConfigOptions()));
+}
+
+/************************************************************************/
+/*                                Stop()                                */
+/************************************************************************/
+
+void OGROAPIFPagePrefetcher::Stop()
+{
+    if (!m_oThread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bStop = true;
+    }
+    m_oCV.notify_all();
+    m_oThread.join();
+    m_aoPages.clear();
+    m_bStop = false;
+    m_bFinished = false;
+}
+
+/************************************************************************/
+/*                                 Run()                                */
+/************************************************************************/
+
+void OGROAPIFPagePrefetcher::Run(CPLString osURL,
+                                 const CPLStringList &aosTLConfigOptions)
+{
+    CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+    while (!osURL.empty())
+    {
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock,
+                       [this]
+                       {
+                           return m_bStop ||
+                                  static_cast<int>(m_aoPages.size()) <
+                                      m_nMaxPages;
+                       });
+            if (m_bStop)
+                break;
+        }
+
+        Page oPage;
+        oPage.osURL = osURL;
+        CPLInstallErrorHandlerAccumulator(oPage.aoErrors);
+        CPLString osResult;
+        CPLString osContentType;
+        oPage.bOK = m_poDS->Download(osURL,
+                                     MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
+                                     osResult, osContentType, &oPage.aosHeaders,
+                                     m_osPersistentName.c_str()) &&
+                    oPage.oDoc.LoadMemory(osResult);
+        CPLUninstallErrorHandlerAccumulator();
+
+        // Same logic as in OGROAPIFLayer::GetNextRawFeature()
+        osURL.clear();
+        if (oPage.bOK)
+        {
+            const auto oRoot = oPage.oDoc.GetRoot();
+            if (oRoot.GetArray("features").Size() > 0)
+            {
+                osURL = GetNextPageURL(oRoot);
+                if (!osURL.empty())
+                    osURL = m_poDS->ReinjectAuthInURL(osURL);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_aoPages.push_back(std::move(oPage));
+        }
+        m_oCV.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bFinished = true;
+    }
+    m_oCV.notify_all();
+    CPLSetThreadLocalConfigOptions(nullptr);
+}
+
+/************************************************************************/
+/*                                 Get()                                */
+/************************************************************************/
+
+/** Returns in oPage the prefetched page for osURL. Returns false if it is not
+ * the next prefetched page.
+ */
+bool OGROAPIFPagePrefetcher::Get(const CPLString &osURL, Page &oPage)
+{
+    if (!m_oThread.joinable())
+        return false;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock,
+                   [this] { return !m_aoPages.empty() || m_bFinished; });
+        if (m_aoPages.empty() || m_aoPages.front().osURL != osURL)
+            return false;
+        oPage = std::move(m_aoPages.front());
+        m_aoPages.pop_front();
+    }
+    m_oCV.notify_all();
+    for (const auto &oError : oPage.aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    return true;
+}
+
 /************************************************************************/
 /*                           ResetReading()                             */
 /************************************************************************/
 
 void OGROAPIFLayer::ResetReading()
 {
+    if (m_poPrefetcher)
+        m_poPrefetcher->Stop();
     m_poUnderlyingDS.reset();
     m_poUnderlyingLayer = nullptr;
     m_nFID = 1;
@@ -1998,11 +2265,24 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
             CPLString osURL(m_osGetURL);
             m_osGetURL.clear();
             CPLStringList aosHeaders;
-            if (!m_poDS->DownloadJSon(osURL, m_oCurDoc,
-                                      MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
-                                      &aosHeaders))
+            OGROAPIFPagePrefetcher::Page oPage;
+            if (m_poPrefetcher && m_poPrefetcher->Get(osURL, oPage))
             {
-                return nullptr;
+                if (!oPage.bOK)
+                    return nullptr;
+                m_oCurDoc = std::move(oPage.oDoc);
+                aosHeaders = std::move(oPage.aosHeaders);
+            }
+            else
+            {
+                if (m_poPrefetcher)
+                    m_poPrefetcher->Stop();
+                if (!m_poDS->DownloadJSon(
+                        osURL, m_oCurDoc,
+                        MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON, &aosHeaders))
+                {
+                    return nullptr;
+                }
             }
 
             const std::string osContentCRS =
@@ -2085,41 +2365,7 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
             // actually
             if (m_poUnderlyingLayer->GetFeatureCount() > 0 && m_osGetID.empty())
             {
-                CPLJSONArray oLinks = m_oCurDoc.GetRoot().GetArray("links");
-                if (oLinks.IsValid())
-                {
-                    int nCountRelNext = 0;
-                    std::string osNextURL;
-                    for (int i = 0; i < oLinks.Size(); i++)
-                    {
-                        CPLJSONObject oLink = oLinks[i];
-                        if (!oLink.IsValid() ||
-                            oLink.GetType() != CPLJSONObject::Type::Object)
-                        {
-                            continue;
-                        }
-                        if (EQUAL(oLink.GetString("rel").c_str(), "next"))
-                        {
-                            nCountRelNext++;
-                            auto type = oLink.GetString("type");
-                            if (type == MEDIA_TYPE_GEOJSON ||
-                                type == MEDIA_TYPE_JSON)
-                            {
-                                m_osGetURL = oLink.GetString("href");
-                                break;
-                            }
-                            else if (type.empty())
-                            {
-                                osNextURL = oLink.GetString("href");
-                            }
-                        }
-                    }
-                    if (nCountRelNext == 1 && m_osGetURL.empty())
-                    {
-                        // In case we go a "rel": "next" without a "type"
-                        m_osGetURL = std::move(osNextURL);
-                    }
-                }
+                m_osGetURL = GetNextPageURL(m_oCurDoc.GetRoot());
 
 #ifdef no_longer_used
                 // Recommendation /rec/core/link-header
@@ -2152,6 +2398,18 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
                 if (!m_osGetURL.empty())
                 {
                     m_osGetURL = m_poDS->ReinjectAuthInURL(m_osGetURL);
+
+                    if (m_poDS->m_nPrefetchPages > 0)
+                    {
+                        if (!m_poPrefetcher)
+                        {
+                            m_poPrefetcher =
+                                std::make_unique<OGROAPIFPagePrefetcher>(
+                                    m_poDS, m_poDS->m_nPrefetchPages);
+                        }
+                        if (!m_poPrefetcher->IsRunning())
+                            m_poPrefetcher->Start(m_osGetURL);
+                    }
                 }
             }
         }
@@ -3173,6 +3431,9 @@ void RegisterOGROAPIF()
         "  <Option name='INITIAL_REQUEST_PAGE_SIZE' type='int' "
         "description='Maximum number of features to retrieve in the initial "
         "request issued to determine the schema from a feature sample'/>"
+        "  <Option name='PREFETCH_PAGES' type='int' "
+        "description='Number of pages of results downloaded in advance' "
+        "default='0'/>"
         "  <Option name='USERPWD' type='string' "
         "description='Basic authentication as username:password'/>"
         "  <Option name='IGNORE_SCHEMA' type='boolean' "
@@ -0,0 +1,612 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  bench_ogr_drivers: compare vector drivers on synthetic datasets
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+#include "ogr_api.h"
+#include "ogr_recordbatch.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+
+// Synthetic features are spread over [0, EXTENT) x [0, EXTENT)
+constexpr double EXTENT = 1000;
+
+/************************************************************************/
+/*                             DriverSpec                               */
+/************************************************************************/
+
+struct DriverSpec
+{
+    const char *pszDriver;
+    const char *pszExtension;
+    std::vector<const char *> apszLCO;
+    std::vector<const char *> apszOpenOptions;
+};
+
+const std::vector<DriverSpec> &GetDriverSpecs()
+{
+    static const std::vector<DriverSpec> asSpecs = {
+        {"GPKG", "gpkg", {}, {}},
+        {"FlatGeobuf", "fgb", {}, {}},
+        {"Parquet", "parquet", {}, {}},
+        {"ESRI Shapefile", "shp", {"SPATIAL_INDEX=YES"}, {}},
+        {"GeoJSON", "geojson", {}, {}},
+        {"GeoJSONSeq", "geojsonl", {}, {}},
+        {"CSV",
+         "csv",
+         {"GEOMETRY=AS_WKT", "CREATE_CSVT=YES"},
+         {"GEOM_POSSIBLE_NAMES=WKT", "KEEP_GEOM_COLUMNS=NO"}},
+        {"OpenFileGDB", "gdb", {}, {}},
+    };
+    return asSpecs;
+}
+
+/************************************************************************/
+/*                          Peak RSS tracking                           */
+/************************************************************************/
+
+// Resets the peak resident set size of the process, when the operating
+// system allows it, so that it can be measured per operation.
+void ResetPeakRSS()
+{
+#ifdef __linux__
+    if (FILE *f = fopen("/proc/self/clear_refs", "wb"))
+    {
+        fputs("5", f);
+        fclose(f);
+    }
+#endif
+}
+
+// Returns the peak resident set size in bytes, or -1 if unknown.
+GIntBig GetPeakRSS()
+{
+#ifdef __linux__
+    // VmHWM is affected by ResetPeakRSS(), contrary to ru_maxrss
+    if (FILE *f = fopen("/proc/self/status", "rb"))
+    {
+        GIntBig nPeak = -1;
+        char szLine[256];
+        while (fgets(szLine, sizeof(szLine), f))
+        {
+            if (STARTS_WITH(szLine, "VmHWM:"))
+            {
+                nPeak = CPLAtoGIntBig(szLine + strlen("VmHWM:")) * 1024;
+                break;
+            }
+        }
+        fclose(f);
+        return nPeak;
+    }
+    return -1;
+#elif defined(__APPLE__)
+    struct rusage sUsage;
+    if (getrusage(RUSAGE_SELF, &sUsage) != 0)
+        return -1;
+    return static_cast<GIntBig>(sUsage.ru_maxrss);
+#else
+    return -1;
+#endif
+}
+
+/************************************************************************/
+/*                            GetTotalSize()                            */
+/************************************************************************/
+
+// Returns the cumulated size of all the files in a directory.
+GIntBig GetTotalSize(const std::string &osDir)
+{
+    GIntBig nTotal = 0;
+    const CPLStringList aosFiles(VSIReadDirRecursive(osDir.c_str()));
+    for (const char *pszFile : aosFiles)
+    {
+        VSIStatBufL sStat;
+        const std::string osPath =
+            CPLFormFilename(osDir.c_str(), pszFile, nullptr);
+        if (VSIStatL(osPath.c_str(), &sStat) == 0 && VSI_ISREG(sStat.st_mode))
+            nTotal += sStat.st_size;
+    }
+    return nTotal;
+}
+
+/************************************************************************/
+/*                           CreateGeometry()                           */
+/************************************************************************/
+
+std::unique_ptr<OGRGeometry> CreateGeometry(OGRwkbGeometryType eGeomType,
+                                            double dfX, double dfY)
+{
+    switch (eGeomType)
+    {
+        case wkbLineString:
+        {
+            auto poLS = std::make_unique<OGRLineString>();
+            for (int i = 0; i < 10; ++i)
+                poLS->addPoint(dfX + i * 0.1, dfY + (i % 2) * 0.1);
+            return poLS;
+        }
+        case wkbPolygon:
+        {
+            auto poRing = std::make_unique<OGRLinearRing>();
+            poRing->addPoint(dfX, dfY);
+            poRing->addPoint(dfX, dfY + 0.5);
+            poRing->addPoint(dfX + 0.5, dfY + 0.5);
+            poRing->addPoint(dfX + 0.5, dfY);
+            poRing->addPoint(dfX, dfY);
+            auto poPoly = std::make_unique<OGRPolygon>();
+            poPoly->addRingDirectly(poRing.release());
+            return poPoly;
+        }
+        default:
+            break;
+    }
+    return std::make_unique<OGRPoint>(dfX, dfY);
+}
+
+/************************************************************************/
+/*                               Result                                 */
+/************************************************************************/
+
+struct Result
+{
+    std::string osDriver{};
+    std::string osOperation{};
+    GIntBig nFeatures = 0;
+    double dfSeconds = 0;
+    GIntBig nBytes = 0;
+    GIntBig nPeakRSS = -1;
+};
+
+/************************************************************************/
+/*                              Measure()                               */
+/************************************************************************/
+
+// Runs fn, which returns the number of features processed, and records it
+// as an operation. nBytes is the size of the dataset involved, used to
+// compute the throughput.
+Result Measure(const char *pszDriver, const char *pszOperation, GIntBig nBytes,
+               const std::function<GIntBig()> &fn)
+{
+    Result oResult;
+    oResult.osDriver = pszDriver;
+    oResult.osOperation = pszOperation;
+    ResetPeakRSS();
+    const auto nStart = std::chrono::steady_clock::now();
+    oResult.nFeatures = fn();
+    const auto nEnd = std::chrono::steady_clock::now();
+    oResult.dfSeconds = std::chrono::duration<double>(nEnd - nStart).count();
+    oResult.nBytes = nBytes;
+    oResult.nPeakRSS = GetPeakRSS();
+    return oResult;
+}
+
+/************************************************************************/
+/*                            PrintResult()                             */
+/************************************************************************/
+
+void PrintResult(const Result &oResult)
+{
+    const double dfSeconds = std::max(oResult.dfSeconds, 1e-9);
+    printf("%-15s %-18s %10" CPL_FRMT_GB_WITHOUT_PREFIX "d %9.3f s "
+           "%12.0f feat/s %9.1f MB/s %8.1f MB RSS\n",
+           oResult.osDriver.c_str(), oResult.osOperation.c_str(),
+           oResult.nFeatures, oResult.dfSeconds,
+           static_cast<double>(oResult.nFeatures) / dfSeconds,
+           static_cast<double>(oResult.nBytes) / dfSeconds / (1024 * 1024),
+           oResult.nPeakRSS >= 0
+               ? static_cast<double>(oResult.nPeakRSS) / (1024 * 1024)
+               : -1.0);
+    fflush(stdout);
+}
+
+/************************************************************************/
+/*                            WriteDataset()                            */
+/************************************************************************/
+
+GIntBig WriteDataset(const DriverSpec &sSpec, const std::string &osFilename,
+                     GIntBig nFeatures, OGRwkbGeometryType eGeomType)
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName(sSpec.pszDriver);
+    std::unique_ptr<GDALDataset> poDS(poDriver->Create(
+        osFilename.c_str(), 0, 0, 0, GDT_Unknown, nullptr));
+    if (!poDS)
+        return 0;
+
+    OGRSpatialReference oSRS;
+    oSRS.importFromEPSG(32631);
+    CPLStringList aosLCO;
+    for (const char *pszLCO : sSpec.apszLCO)
+        aosLCO.AddString(pszLCO);
+    OGRLayer *poLayer =
+        poDS->CreateLayer("test", &oSRS, eGeomType, aosLCO.List());
+    if (!poLayer)
+        return 0;
+
+    OGRFieldDefn oFieldId("id", OFTInteger64);
+    OGRFieldDefn oFieldName("name", OFTString);
+    oFieldName.SetWidth(32);
+    OGRFieldDefn oFieldValue("value", OFTReal);
+    OGRFieldDefn oFieldCategory("category", OFTInteger);
+    if (poLayer->CreateField(&oFieldId) != OGRERR_NONE ||
+        poLayer->CreateField(&oFieldName) != OGRERR_NONE ||
+        poLayer->CreateField(&oFieldValue) != OGRERR_NONE ||
+        poLayer->CreateField(&oFieldCategory) != OGRERR_NONE)
+    {
+        return 0;
+    }
+
+    const bool bTransaction = poDS->StartTransaction() == OGRERR_NONE;
+    OGRFeature oFeature(poLayer->GetLayerDefn());
+    unsigned nSeed = 12345;
+    const auto Random = [&nSeed]()
+    {
+        nSeed = nSeed * 1103515245U + 12345U;
+        return static_cast<double>((nSeed >> 8) & 0xFFFFFF) / 0x1000000;
+    };
+    GIntBig nWritten = 0;
+    for (GIntBig i = 0; i < nFeatures; ++i)
+    {
+        oFeature.SetFID(OGRNullFID);
+        oFeature.SetField(0, i);
+        oFeature.SetField(1, CPLSPrintf("feature_" CPL_FRMT_GIB, i));
+        oFeature.SetField(2, Random() * 1000);
+        oFeature.SetField(3, static_cast<int>(i % 100));
+        oFeature.SetGeometryDirectly(
+            CreateGeometry(eGeomType, Random() * EXTENT, Random() * EXTENT)
+                .release());
+        if (poLayer->CreateFeature(&oFeature) != OGRERR_NONE)
+            break;
+        ++nWritten;
+    }
+    if (bTransaction)
+        poDS->CommitTransaction();
+    if (poDS->Close() != CE_None)
+        return 0;
+    return nWritten;
+}
+
+/************************************************************************/
+/*                            OpenDataset()                             */
+/************************************************************************/
+
+std::unique_ptr<GDALDataset> OpenDataset(const DriverSpec &sSpec,
+                                         const std::string &osFilename)
+{
+    CPLStringList aosOpenOptions;
+    for (const char *pszOO : sSpec.apszOpenOptions)
+        aosOpenOptions.AddString(pszOO);
+    const char *const apszDrivers[] = {sSpec.pszDriver, nullptr};
+    return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+        osFilename.c_str(), GDAL_OF_VECTOR | GDAL_OF_VERBOSE_ERROR,
+        apszDrivers, aosOpenOptions.List()));
+}
+
+/************************************************************************/
+/*                             ScanLayer()                              */
+/************************************************************************/
+
+GIntBig ScanLayer(OGRLayer *poLayer, std::vector<GIntBig> *panFIDs = nullptr)
+{
+    GIntBig nCount = 0;
+    poLayer->ResetReading();
+    for (auto &&poFeature : poLayer)
+    {
+        if (panFIDs)
+            panFIDs->push_back(poFeature->GetFID());
+        ++nCount;
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*                          ScanArrowStream()                           */
+/************************************************************************/
+
+GIntBig ScanArrowStream(OGRLayer *poLayer)
+{
+    poLayer->ResetReading();
+    struct ArrowArrayStream stream;
+    if (!poLayer->GetArrowStream(&stream, nullptr))
+        return 0;
+    GIntBig nCount = 0;
+    while (true)
+    {
+        struct ArrowArray array;
+        if (stream.get_next(&stream, &array) != 0 || array.release == nullptr)
+            break;
+        nCount += array.length;
+        array.release(&array);
+    }
+    stream.release(&stream);
+    return nCount;
+}
+
+/************************************************************************/
+/*                            BenchDriver()                             */
+/************************************************************************/
+
+void BenchDriver(const DriverSpec &sSpec, const std::string &osDir,
+                 GIntBig nFeatures, OGRwkbGeometryType eGeomType,
+                 int nRandomReads, std::vector<Result> &aoResults)
+{
+    const auto AddResult = [&aoResults](Result &&oResult)
+    {
+        PrintResult(oResult);
+        aoResults.push_back(std::move(oResult));
+    };
+
+    VSIMkdir(osDir.c_str(), 0755);
+    const std::string osFilename =
+        CPLFormFilename(osDir.c_str(), "test", sSpec.pszExtension);
+
+    auto oWrite = Measure(sSpec.pszDriver, "write", 0,
+                          [&]() {
+                              return WriteDataset(sSpec, osFilename, nFeatures,
+                                                  eGeomType);
+                          });
+    const GIntBig nBytes = GetTotalSize(osDir);
+    oWrite.nBytes = nBytes;
+    const bool bWriteOK = oWrite.nFeatures == nFeatures;
+    AddResult(std::move(oWrite));
+    if (!bWriteOK)
+    {
+        fprintf(stderr, "%s: write failed. Skipping read benchmarks\n",
+                sSpec.pszDriver);
+        return;
+    }
+
+    auto poDS = OpenDataset(sSpec, osFilename);
+    OGRLayer *poLayer = poDS ? poDS->GetLayer(0) : nullptr;
+    if (!poLayer)
+        return;
+
+    std::vector<GIntBig> anFIDs;
+    anFIDs.reserve(static_cast<size_t>(nFeatures));
+    AddResult(Measure(sSpec.pszDriver, "GetNextFeature", nBytes,
+                      [&]() { return ScanLayer(poLayer, &anFIDs); }));
+
+    AddResult(Measure(sSpec.pszDriver, "ArrowStream", nBytes,
+                      [&]() { return ScanArrowStream(poLayer); }));
+
+    // Both filters select about 1% of the features
+    poLayer->SetSpatialFilterRect(0, 0, EXTENT / 10, EXTENT / 10);
+    AddResult(Measure(sSpec.pszDriver, "spatial filter", nBytes,
+                      [&]() { return ScanLayer(poLayer); }));
+    poLayer->SetSpatialFilter(nullptr);
+
+    poLayer->SetAttributeFilter("value < 10");
+    AddResult(Measure(sSpec.pszDriver, "attribute filter", nBytes,
+                      [&]() { return ScanLayer(poLayer); }));
+    poLayer->SetAttributeFilter(nullptr);
+
+    if (!anFIDs.empty() && nRandomReads > 0)
+    {
+        AddResult(Measure(sSpec.pszDriver, "random GetFeature", 0,
+                          [&]()
+                          {
+                              GIntBig nCount = 0;
+                              unsigned nSeed = 12345;
+                              for (int i = 0; i < nRandomReads; ++i)
+                              {
+                                  nSeed = nSeed * 1103515245U + 12345U;
+                                  const GIntBig nFID =
+                                      anFIDs[(nSeed >> 4) % anFIDs.size()];
+                                  if (std::unique_ptr<OGRFeature>(
+                                          poLayer->GetFeature(nFID)))
+                                      ++nCount;
+                              }
+                              return nCount;
+                          }));
+    }
+}
+
+/************************************************************************/
+/*                             WriteJSON()                              */
+/************************************************************************/
+
+bool WriteJSON(const std::string &osFilename,
+               const std::vector<Result> &aoResults, GIntBig nFeatures,
+               OGRwkbGeometryType eGeomType)
+{
+    CPLJSONDocument oDoc;
+    CPLJSONObject oRoot = oDoc.GetRoot();
+
+    CPLJSONObject oContext;
+    oContext.Add("gdal_version", GDALVersionInfo("RELEASE_NAME"));
+    oContext.Add("features", nFeatures);
+    oContext.Add("geometry_type", OGRGeometryTypeToName(eGeomType));
+    oRoot.Add("context", oContext);
+
+    CPLJSONArray oResults;
+    for (const auto &oResult : aoResults)
+    {
+        const double dfSeconds = std::max(oResult.dfSeconds, 1e-9);
+        CPLJSONObject oObj;
+        oObj.Add("driver", oResult.osDriver);
+        oObj.Add("operation", oResult.osOperation);
+        oObj.Add("features", oResult.nFeatures);
+        oObj.Add("seconds", oResult.dfSeconds);
+        oObj.Add("features_per_second",
+                 static_cast<double>(oResult.nFeatures) / dfSeconds);
+        oObj.Add("bytes", oResult.nBytes);
+        oObj.Add("megabytes_per_second", static_cast<double>(oResult.nBytes) /
+                                             dfSeconds / (1024 * 1024));
+        oObj.Add("peak_rss_bytes", oResult.nPeakRSS);
+        oResults.Add(oObj);
+    }
+    oRoot.Add("results", oResults);
+
+    return oDoc.Save(osFilename);
+}
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+void Usage()
+{
+    printf("Usage: bench_ogr_drivers [--features=<n>] "
+           "[--geometry=point|linestring|polygon]\n");
+    printf("                         [--drivers=<name>[,<name>]*] "
+           "[--random-reads=<n>]\n");
+    printf("                         [--tmpdir=<dir>] [--json=<filename>]\n");
+    printf("\nDefault drivers:");
+    for (const auto &sSpec : GetDriverSpecs())
+        printf(" \"%s\"", sSpec.pszDriver);
+    printf("\n");
+    exit(1);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    GIntBig nFeatures = 100000;
+    OGRwkbGeometryType eGeomType = wkbPoint;
+    CPLStringList aosDrivers;
+    int nRandomReads = 10000;
+    std::string osTmpDir;
+    std::string osJSON;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        const char *pszArg = argv[iArg];
+        if (STARTS_WITH(pszArg, "--features="))
+        {
+            nFeatures = CPLAtoGIntBig(pszArg + strlen("--features="));
+        }
+        else if (STARTS_WITH(pszArg, "--geometry="))
+        {
+            const char *pszType = pszArg + strlen("--geometry=");
+            if (EQUAL(pszType, "point"))
+                eGeomType = wkbPoint;
+            else if (EQUAL(pszType, "linestring"))
+                eGeomType = wkbLineString;
+            else if (EQUAL(pszType, "polygon"))
+                eGeomType = wkbPolygon;
+            else
+                Usage();
+        }
+        else if (STARTS_WITH(pszArg, "--drivers="))
+        {
+            aosDrivers = CSLTokenizeString2(pszArg + strlen("--drivers="), ",",
+                                            CSLT_HONOURSTRINGS);
+        }
+        else if (STARTS_WITH(pszArg, "--random-reads="))
+        {
+            nRandomReads = atoi(pszArg + strlen("--random-reads="));
+        }
+        else if (STARTS_WITH(pszArg, "--tmpdir="))
+        {
+            osTmpDir = pszArg + strlen("--tmpdir=");
+        }
+        else if (STARTS_WITH(pszArg, "--json="))
+        {
+            osJSON = pszArg + strlen("--json=");
+        }
+        else
+        {
+            Usage();
+        }
+    }
+    CSLDestroy(argv);
+    if (nFeatures <= 0)
+        Usage();
+
+    GDALAllRegister();
+
+    // Datasets are written on the local filesystem by default, so that
+    // the I/O costs are taken into account.
+    const std::string osBaseDir =
+        osTmpDir.empty() ? CPLGenerateTempFilename("bench_ogr_drivers")
+                         : CPLFormFilename(osTmpDir.c_str(),
+                                           "bench_ogr_drivers", nullptr);
+    if (VSIMkdir(osBaseDir.c_str(), 0755) != 0)
+    {
+        fprintf(stderr, "Cannot create %s\n", osBaseDir.c_str());
+        exit(1);
+    }
+
+    printf("%" CPL_FRMT_GB_WITHOUT_PREFIX "d %s features, in %s\n", nFeatures,
+           OGRGeometryTypeToName(eGeomType), osBaseDir.c_str());
+
+    std::vector<Result> aoResults;
+    for (const auto &sSpec : GetDriverSpecs())
+    {
+        if (!aosDrivers.empty() && aosDrivers.FindString(sSpec.pszDriver) < 0)
+            continue;
+        if (!GetGDALDriverManager()->GetDriverByName(sSpec.pszDriver))
+        {
+            printf("%-15s not available\n", sSpec.pszDriver);
+            continue;
+        }
+        const std::string osDir =
+            CPLFormFilename(osBaseDir.c_str(), sSpec.pszExtension, nullptr);
+        BenchDriver(sSpec, osDir, nFeatures, eGeomType, nRandomReads,
+                    aoResults);
+        VSIRmdirRecursive(osDir.c_str());
+    }
+    VSIRmdirRecursive(osBaseDir.c_str());
+
+    int nRet = 0;
+    if (!osJSON.empty() &&
+        !WriteJSON(osJSON, aoResults, nFeatures, eGeomType))
+    {
+        fprintf(stderr, "Cannot write %s\n", osJSON.c_str());
+        nRet = 1;
+    }
+
+    GDALDestroyDriverManager();
+
+    return nRet;
+}
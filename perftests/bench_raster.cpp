@@ -0,0 +1,769 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Raster benchmark suite, with JSON output and comparison against
+ *           a baseline.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+// Typical use to catch regressions between two builds:
+//
+//   old_build/perftests/bench_raster --json=ref.json
+//   new_build/perftests/bench_raster --baseline=ref.json --tolerance=20
+//
+// The second invocation exits with a non-zero code if any benchmark is more
+// than 20% slower than in ref.json.
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+#include "gdal_utils.h"
+#include "ogr_spatialref.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr const char *BENCH_DIR = "/vsimem/bench_raster";
+
+/************************************************************************/
+/*                            BenchmarkState                            */
+/************************************************************************/
+
+// Passed to each benchmark run. Only the code run through Measure() is
+// timed, so that set-up and tear-down can be done around it.
+class BenchmarkState
+{
+  public:
+    void Measure(const std::function<void()> &fn)
+    {
+        const auto nStartCPU = std::clock();
+        const auto nStart = std::chrono::steady_clock::now();
+        fn();
+        const auto nEnd = std::chrono::steady_clock::now();
+        const auto nEndCPU = std::clock();
+        m_dfRealTime +=
+            std::chrono::duration<double, std::milli>(nEnd - nStart).count();
+        m_dfCPUTime +=
+            static_cast<double>(nEndCPU - nStartCPU) * 1000 / CLOCKS_PER_SEC;
+    }
+
+    void Skip(const std::string &osReason)
+    {
+        m_osSkipReason = osReason;
+    }
+
+    double GetRealTime() const
+    {
+        return m_dfRealTime;
+    }
+
+    double GetCPUTime() const
+    {
+        return m_dfCPUTime;
+    }
+
+    const std::string &GetSkipReason() const
+    {
+        return m_osSkipReason;
+    }
+
+  private:
+    double m_dfRealTime = 0;
+    double m_dfCPUTime = 0;
+    std::string m_osSkipReason{};
+};
+
+struct Benchmark
+{
+    std::string osName;
+    std::function<void(BenchmarkState &)> fn;
+};
+
+std::vector<Benchmark> &GetBenchmarks()
+{
+    static std::vector<Benchmark> aoBenchmarks;
+    return aoBenchmarks;
+}
+
+void Register(const std::string &osName,
+              std::function<void(BenchmarkState &)> fn)
+{
+    GetBenchmarks().push_back(Benchmark{osName, std::move(fn)});
+}
+
+/************************************************************************/
+/*                       CreatePatternDataset()                         */
+/************************************************************************/
+
+// Creates a MEM dataset filled with a smooth pattern plus some noise, so
+// that compression and resampling work on somewhat realistic data.
+std::unique_ptr<GDALDataset> CreatePatternDataset(int nXSize, int nYSize,
+                                                  int nBands, GDALDataType eDT)
+{
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    std::unique_ptr<GDALDataset> poDS(
+        poMEMDriver->Create("", nXSize, nYSize, nBands, eDT, nullptr));
+    std::vector<double> adfLine(nXSize);
+    unsigned nSeed = 12345;
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        for (int iY = 0; iY < nYSize; ++iY)
+        {
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                nSeed = nSeed * 1103515245U + 12345U;
+                adfLine[iX] = ((iX + iY * 2 + iBand * 50) % 200) +
+                              static_cast<double>((nSeed >> 16) % 32);
+            }
+            CPL_IGNORE_RET_VAL(poDS->GetRasterBand(iBand)->RasterIO(
+                GF_Write, 0, iY, nXSize, 1, adfLine.data(), nXSize, 1,
+                GDT_Float64, 0, 0, nullptr));
+        }
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                         SetGeoreferencing()                          */
+/************************************************************************/
+
+void SetGeoreferencing(GDALDataset *poDS, double dfMinX, double dfMaxY,
+                       double dfRes)
+{
+    double adfGT[6] = {dfMinX, dfRes, 0, dfMaxY, 0, -dfRes};
+    poDS->SetGeoTransform(adfGT);
+    OGRSpatialReference oSRS;
+    oSRS.importFromEPSG(4326);
+    oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    poDS->SetSpatialRef(&oSRS);
+}
+
+/************************************************************************/
+/*                          GTiffHasCodec()                             */
+/************************************************************************/
+
+bool GTiffHasCodec(const char *pszCodec)
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    const char *pszCOList =
+        poDriver ? poDriver->GetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST)
+                 : nullptr;
+    return pszCOList &&
+           strstr(pszCOList, CPLSPrintf("<Value>%s</Value>", pszCodec));
+}
+
+/************************************************************************/
+/*                     RegisterRasterIOBenchmarks()                     */
+/************************************************************************/
+
+void RegisterRasterIOBenchmarks()
+{
+    const std::pair<const char *, GDALRIOResampleAlg> asAlgs[] = {
+        {"nearest", GRIORA_NearestNeighbour},
+        {"bilinear", GRIORA_Bilinear},
+        {"cubic", GRIORA_Cubic},
+        {"cubicspline", GRIORA_CubicSpline},
+        {"lanczos", GRIORA_Lanczos},
+        {"average", GRIORA_Average},
+        {"rms", GRIORA_RMS},
+        {"mode", GRIORA_Mode},
+        {"gauss", GRIORA_Gauss},
+    };
+    for (const GDALDataType eDT : {GDT_Byte, GDT_Float32})
+    {
+        for (const auto &[pszAlg, eAlg] : asAlgs)
+        {
+            for (const bool bUpsample : {false, true})
+            {
+                const int nSrcSize = bUpsample ? 512 : 4096;
+                const int nDstSize = bUpsample ? 2048 : 1024;
+                Register(CPLSPrintf("RasterIO/%s/%s/%s",
+                                    bUpsample ? "upsample4" : "downsample4",
+                                    pszAlg, GDALGetDataTypeName(eDT)),
+                         [eDT, eAlg = eAlg, nSrcSize,
+                          nDstSize](BenchmarkState &state)
+                         {
+                             auto poDS = CreatePatternDataset(
+                                 nSrcSize, nSrcSize, 1, eDT);
+                             std::vector<GByte> abyBuffer(
+                                 static_cast<size_t>(nDstSize) * nDstSize *
+                                 GDALGetDataTypeSizeBytes(eDT));
+                             GDALRasterIOExtraArg sExtraArg;
+                             INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+                             sExtraArg.eResampleAlg = eAlg;
+                             state.Measure(
+                                 [&]()
+                                 {
+                                     CPL_IGNORE_RET_VAL(
+                                         poDS->GetRasterBand(1)->RasterIO(
+                                             GF_Read, 0, 0, nSrcSize, nSrcSize,
+                                             abyBuffer.data(), nDstSize,
+                                             nDstSize, eDT, 0, 0, &sExtraArg));
+                                 });
+                         });
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                      RegisterGTiffBenchmarks()                       */
+/************************************************************************/
+
+void RegisterGTiffBenchmarks()
+{
+    for (const char *pszCodec : {"NONE", "PACKBITS", "LZW", "DEFLATE", "ZSTD",
+                                 "LZMA", "LERC", "JPEG", "WEBP"})
+    {
+        const auto CreateTIFF = [pszCodec](const char *pszFilename)
+        {
+            auto poSrcDS = CreatePatternDataset(2048, 2048, 3, GDT_Byte);
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("TILED", "YES");
+            aosOptions.SetNameValue("COMPRESS", pszCodec);
+            auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+            std::unique_ptr<GDALDataset>(
+                poDriver->CreateCopy(pszFilename, poSrcDS.get(), false,
+                                     aosOptions.List(), nullptr, nullptr));
+        };
+
+        Register(std::string("GTiff/write/").append(pszCodec),
+                 [pszCodec](BenchmarkState &state)
+                 {
+                     if (!GTiffHasCodec(pszCodec))
+                     {
+                         state.Skip(std::string(pszCodec) + " not available");
+                         return;
+                     }
+                     auto poSrcDS =
+                         CreatePatternDataset(2048, 2048, 3, GDT_Byte);
+                     CPLStringList aosOptions;
+                     aosOptions.SetNameValue("TILED", "YES");
+                     aosOptions.SetNameValue("COMPRESS", pszCodec);
+                     auto poDriver =
+                         GetGDALDriverManager()->GetDriverByName("GTiff");
+                     const std::string osFilename =
+                         std::string(BENCH_DIR) + "/out.tif";
+                     state.Measure(
+                         [&]()
+                         {
+                             std::unique_ptr<GDALDataset>(poDriver->CreateCopy(
+                                 osFilename.c_str(), poSrcDS.get(), false,
+                                 aosOptions.List(), nullptr, nullptr));
+                         });
+                 });
+
+        Register(std::string("GTiff/read/").append(pszCodec),
+                 [pszCodec, CreateTIFF](BenchmarkState &state)
+                 {
+                     if (!GTiffHasCodec(pszCodec))
+                     {
+                         state.Skip(std::string(pszCodec) + " not available");
+                         return;
+                     }
+                     const std::string osFilename =
+                         std::string(BENCH_DIR) + "/in.tif";
+                     CreateTIFF(osFilename.c_str());
+                     std::vector<GByte> abyBuffer(2048 * 2048 * 3);
+                     state.Measure(
+                         [&]()
+                         {
+                             std::unique_ptr<GDALDataset> poDS(
+                                 GDALDataset::Open(osFilename.c_str(),
+                                                   GDAL_OF_RASTER));
+                             if (poDS)
+                             {
+                                 CPL_IGNORE_RET_VAL(poDS->RasterIO(
+                                     GF_Read, 0, 0, 2048, 2048,
+                                     abyBuffer.data(), 2048, 2048, GDT_Byte, 3,
+                                     nullptr, 0, 0, 0, nullptr));
+                             }
+                         });
+                 });
+    }
+}
+
+/************************************************************************/
+/*                     RegisterOverviewBenchmarks()                     */
+/************************************************************************/
+
+void RegisterOverviewBenchmarks()
+{
+    for (const char *pszAlg :
+         {"NEAREST", "AVERAGE", "RMS", "BILINEAR", "CUBIC", "CUBICSPLINE",
+          "LANCZOS", "MODE", "GAUSS"})
+    {
+        Register(
+            std::string("Overviews/").append(pszAlg),
+            [pszAlg](BenchmarkState &state)
+            {
+                const std::string osFilename =
+                    std::string(BENCH_DIR) + "/ovr.tif";
+                auto poSrcDS = CreatePatternDataset(2048, 2048, 3, GDT_Byte);
+                auto poDriver =
+                    GetGDALDriverManager()->GetDriverByName("GTiff");
+                const char *const apszOptions[] = {"TILED=YES", nullptr};
+                std::unique_ptr<GDALDataset> poDS(poDriver->CreateCopy(
+                    osFilename.c_str(), poSrcDS.get(), false,
+                    const_cast<char **>(apszOptions), nullptr, nullptr));
+                if (!poDS)
+                    return;
+                const int anLevels[] = {2, 4, 8};
+                state.Measure(
+                    [&]()
+                    {
+                        CPL_IGNORE_RET_VAL(poDS->BuildOverviews(
+                            pszAlg, 3, anLevels, 0, nullptr, nullptr, nullptr,
+                            nullptr));
+                    });
+            });
+    }
+}
+
+/************************************************************************/
+/*                       RegisterWarpBenchmarks()                       */
+/************************************************************************/
+
+void RegisterWarpBenchmarks()
+{
+    for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+    {
+        for (const char *pszKernel :
+             {"near", "bilinear", "cubic", "cubicspline", "lanczos", "average",
+              "mode"})
+        {
+            Register(
+                CPLSPrintf("Warp/%s/%s", pszKernel, GDALGetDataTypeName(eDT)),
+                [eDT, pszKernel](BenchmarkState &state)
+                {
+                    auto poSrcDS = CreatePatternDataset(1024, 1024, 1, eDT);
+                    SetGeoreferencing(poSrcDS.get(), 2, 49, 0.001);
+                    CPLStringList aosArgv;
+                    aosArgv.AddString("-of");
+                    aosArgv.AddString("MEM");
+                    aosArgv.AddString("-t_srs");
+                    aosArgv.AddString("EPSG:3857");
+                    aosArgv.AddString("-r");
+                    aosArgv.AddString(pszKernel);
+                    auto psOptions =
+                        GDALWarpAppOptionsNew(aosArgv.List(), nullptr);
+                    GDALDatasetH hSrcDS = GDALDataset::ToHandle(poSrcDS.get());
+                    state.Measure(
+                        [&]()
+                        {
+                            GDALClose(GDALWarp("", nullptr, 1, &hSrcDS,
+                                               psOptions, nullptr));
+                        });
+                    GDALWarpAppOptionsFree(psOptions);
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                       RegisterVRTBenchmarks()                        */
+/************************************************************************/
+
+void RegisterVRTBenchmarks()
+{
+    for (const int nFactor : {1, 4})
+    {
+        Register(
+            CPLSPrintf("VRT/mosaic_4x4_tiles/read_1_%d", nFactor),
+            [nFactor](BenchmarkState &state)
+            {
+                constexpr int TILE_SIZE = 512;
+                constexpr int TILE_COUNT = 4;
+                auto poDriver =
+                    GetGDALDriverManager()->GetDriverByName("GTiff");
+                CPLStringList aosTiles;
+                for (int iY = 0; iY < TILE_COUNT; ++iY)
+                {
+                    for (int iX = 0; iX < TILE_COUNT; ++iX)
+                    {
+                        auto poTileDS = CreatePatternDataset(
+                            TILE_SIZE, TILE_SIZE, 1, GDT_Byte);
+                        SetGeoreferencing(poTileDS.get(), iX * TILE_SIZE,
+                                          -iY * TILE_SIZE, 1);
+                        const std::string osTile =
+                            CPLSPrintf("%s/tile_%d_%d.tif", BENCH_DIR, iX, iY);
+                        std::unique_ptr<GDALDataset>(
+                            poDriver->CreateCopy(osTile.c_str(), poTileDS.get(),
+                                                 false, nullptr, nullptr,
+                                                 nullptr));
+                        aosTiles.AddString(osTile.c_str());
+                    }
+                }
+                const std::string osVRT =
+                    std::string(BENCH_DIR) + "/mosaic.vrt";
+                GDALClose(GDALBuildVRT(osVRT.c_str(), aosTiles.size(), nullptr,
+                                       aosTiles.List(), nullptr, nullptr));
+
+                const int nSize = TILE_SIZE * TILE_COUNT / nFactor;
+                std::vector<GByte> abyBuffer(static_cast<size_t>(nSize) *
+                                             nSize);
+                state.Measure(
+                    [&]()
+                    {
+                        // Re-open each time, so that nothing is served from
+                        // the block cache of the sources.
+                        std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+                            osVRT.c_str(), GDAL_OF_RASTER));
+                        if (poDS)
+                        {
+                            CPL_IGNORE_RET_VAL(poDS->GetRasterBand(1)->RasterIO(
+                                GF_Read, 0, 0, poDS->GetRasterXSize(),
+                                poDS->GetRasterYSize(), abyBuffer.data(),
+                                nSize, nSize, GDT_Byte, 0, 0, nullptr));
+                        }
+                    });
+            });
+    }
+}
+
+/************************************************************************/
+/*                    RegisterBlockCacheBenchmarks()                    */
+/************************************************************************/
+
+void RegisterBlockCacheBenchmarks()
+{
+    for (const int nThreads : {1, 2, 4, 8})
+    {
+        Register(
+            CPLSPrintf("BlockCache/concurrent_read/threads:%d", nThreads),
+            [nThreads](BenchmarkState &state)
+            {
+                constexpr int SIZE = 4096;
+                constexpr int BLOCK_SIZE = 256;
+                const std::string osFilename =
+                    std::string(BENCH_DIR) + "/cache.tif";
+                {
+                    auto poSrcDS =
+                        CreatePatternDataset(SIZE, SIZE, 1, GDT_Byte);
+                    auto poDriver =
+                        GetGDALDriverManager()->GetDriverByName("GTiff");
+                    const char *const apszOptions[] = {"TILED=YES", nullptr};
+                    std::unique_ptr<GDALDataset>(poDriver->CreateCopy(
+                        osFilename.c_str(), poSrcDS.get(), false,
+                        const_cast<char **>(apszOptions), nullptr, nullptr));
+                }
+
+                // A cache smaller than the raster, so that blocks are
+                // evicted while other threads are adding theirs.
+                const GIntBig nOldCacheMax = GDALGetCacheMax64();
+                GDALSetCacheMax64(SIZE * SIZE / 4);
+
+                const auto ReadAllBlocks = [&osFilename](int iThread)
+                {
+                    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+                        osFilename.c_str(), GDAL_OF_RASTER));
+                    if (!poDS)
+                        return;
+                    auto poBand = poDS->GetRasterBand(1);
+                    constexpr int BLOCKS_PER_ROW = SIZE / BLOCK_SIZE;
+                    constexpr int BLOCK_COUNT = BLOCKS_PER_ROW * BLOCKS_PER_ROW;
+                    for (int iPass = 0; iPass < 2; ++iPass)
+                    {
+                        for (int i = 0; i < BLOCK_COUNT; ++i)
+                        {
+                            // Each thread starts at a different block.
+                            const int iBlock =
+                                (i + iThread * BLOCK_COUNT / 8) % BLOCK_COUNT;
+                            auto poBlock = poBand->GetLockedBlockRef(
+                                iBlock % BLOCKS_PER_ROW,
+                                iBlock / BLOCKS_PER_ROW);
+                            if (poBlock)
+                                poBlock->DropLock();
+                        }
+                    }
+                };
+
+                state.Measure(
+                    [&]()
+                    {
+                        std::vector<std::thread> aoThreads;
+                        for (int i = 0; i < nThreads; ++i)
+                            aoThreads.emplace_back(ReadAllBlocks, i);
+                        for (auto &oThread : aoThreads)
+                            oThread.join();
+                    });
+
+                GDALSetCacheMax64(nOldCacheMax);
+            });
+    }
+}
+
+/************************************************************************/
+/*                               Result                                 */
+/************************************************************************/
+
+struct Result
+{
+    std::string osName{};
+    std::string osSkipReason{};
+    int nRepetitions = 0;
+    double dfRealTimeMin = 0;
+    double dfRealTimeMedian = 0;
+    double dfCPUTimeMin = 0;
+};
+
+/************************************************************************/
+/*                           RunBenchmark()                             */
+/************************************************************************/
+
+Result RunBenchmark(const Benchmark &oBenchmark, int nRepetitions)
+{
+    Result oResult;
+    oResult.osName = oBenchmark.osName;
+    std::vector<double> adfRealTimes;
+    std::vector<double> adfCPUTimes;
+    for (int i = 0; i < nRepetitions; ++i)
+    {
+        VSIMkdir(BENCH_DIR, 0755);
+        BenchmarkState oState;
+        oBenchmark.fn(oState);
+        VSIRmdirRecursive(BENCH_DIR);
+        if (!oState.GetSkipReason().empty())
+        {
+            oResult.osSkipReason = oState.GetSkipReason();
+            return oResult;
+        }
+        adfRealTimes.push_back(oState.GetRealTime());
+        adfCPUTimes.push_back(oState.GetCPUTime());
+    }
+    std::sort(adfRealTimes.begin(), adfRealTimes.end());
+    oResult.nRepetitions = nRepetitions;
+    oResult.dfRealTimeMin = adfRealTimes.front();
+    oResult.dfRealTimeMedian = adfRealTimes[adfRealTimes.size() / 2];
+    oResult.dfCPUTimeMin =
+        *std::min_element(adfCPUTimes.begin(), adfCPUTimes.end());
+    return oResult;
+}
+
+/************************************************************************/
+/*                             WriteJSON()                              */
+/************************************************************************/
+
+bool WriteJSON(const std::string &osFilename,
+               const std::vector<Result> &aoResults)
+{
+    CPLJSONDocument oDoc;
+    CPLJSONObject oRoot = oDoc.GetRoot();
+
+    CPLJSONObject oContext;
+    oContext.Add("gdal_version", GDALVersionInfo("RELEASE_NAME"));
+    oContext.Add("num_cpus", CPLGetNumCPUs());
+    oRoot.Add("context", oContext);
+
+    CPLJSONArray oBenchmarks;
+    for (const auto &oResult : aoResults)
+    {
+        if (!oResult.osSkipReason.empty())
+            continue;
+        CPLJSONObject oBenchmark;
+        oBenchmark.Add("name", oResult.osName);
+        oBenchmark.Add("repetitions", oResult.nRepetitions);
+        oBenchmark.Add("real_time_min", oResult.dfRealTimeMin);
+        oBenchmark.Add("real_time_median", oResult.dfRealTimeMedian);
+        oBenchmark.Add("cpu_time_min", oResult.dfCPUTimeMin);
+        oBenchmark.Add("time_unit", "ms");
+        oBenchmarks.Add(oBenchmark);
+    }
+    oRoot.Add("benchmarks", oBenchmarks);
+
+    return oDoc.Save(osFilename);
+}
+
+/************************************************************************/
+/*                         CompareToBaseline()                          */
+/************************************************************************/
+
+// Returns the number of benchmarks slower than in the baseline by more than
+// dfTolerancePct percent, or -1 if the baseline cannot be read.
+int CompareToBaseline(const std::string &osFilename,
+                      const std::vector<Result> &aoResults,
+                      double dfTolerancePct)
+{
+    CPLJSONDocument oDoc;
+    if (!oDoc.Load(osFilename))
+        return -1;
+
+    std::map<std::string, double> oMapBaseline;
+    for (const auto &oBenchmark : oDoc.GetRoot().GetArray("benchmarks"))
+    {
+        oMapBaseline[oBenchmark.GetString("name")] =
+            oBenchmark.GetDouble("real_time_min");
+    }
+
+    printf("\nComparison to %s (tolerance: %.1f%%)\n", osFilename.c_str(),
+           dfTolerancePct);
+    int nRegressions = 0;
+    for (const auto &oResult : aoResults)
+    {
+        const auto oIter = oMapBaseline.find(oResult.osName);
+        if (!oResult.osSkipReason.empty() || oIter == oMapBaseline.end() ||
+            oIter->second <= 0)
+        {
+            continue;
+        }
+        const double dfRatio = oResult.dfRealTimeMin / oIter->second;
+        const bool bRegression = dfRatio > 1 + dfTolerancePct / 100;
+        if (bRegression)
+            ++nRegressions;
+        printf("%-50s %10.2f -> %10.2f ms  %+7.1f%%%s\n",
+               oResult.osName.c_str(), oIter->second, oResult.dfRealTimeMin,
+               (dfRatio - 1) * 100, bRegression ? "  REGRESSION" : "");
+    }
+    return nRegressions;
+}
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+void Usage()
+{
+    printf("Usage: bench_raster [--list] [--filter=<regex>]\n");
+    printf("                    [--repetitions=<n>] [--json=<filename>]\n");
+    printf("                    [--baseline=<filename>] "
+           "[--tolerance=<percent>]\n");
+    exit(1);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    bool bList = false;
+    std::string osFilter;
+    int nRepetitions = 3;
+    std::string osJSON;
+    std::string osBaseline;
+    double dfTolerancePct = 20;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        const char *pszArg = argv[iArg];
+        if (strcmp(pszArg, "--list") == 0)
+            bList = true;
+        else if (STARTS_WITH(pszArg, "--filter="))
+            osFilter = pszArg + strlen("--filter=");
+        else if (STARTS_WITH(pszArg, "--repetitions="))
+            nRepetitions = std::max(1, atoi(pszArg + strlen("--repetitions=")));
+        else if (STARTS_WITH(pszArg, "--json="))
+            osJSON = pszArg + strlen("--json=");
+        else if (STARTS_WITH(pszArg, "--baseline="))
+            osBaseline = pszArg + strlen("--baseline=");
+        else if (STARTS_WITH(pszArg, "--tolerance="))
+            dfTolerancePct = CPLAtof(pszArg + strlen("--tolerance="));
+        else
+            Usage();
+    }
+    CSLDestroy(argv);
+
+    GDALAllRegister();
+
+    RegisterRasterIOBenchmarks();
+    RegisterGTiffBenchmarks();
+    RegisterOverviewBenchmarks();
+    RegisterWarpBenchmarks();
+    RegisterVRTBenchmarks();
+    RegisterBlockCacheBenchmarks();
+
+    const std::regex oFilter(osFilter);
+    std::vector<Result> aoResults;
+    for (const auto &oBenchmark : GetBenchmarks())
+    {
+        if (!osFilter.empty() && !std::regex_search(oBenchmark.osName, oFilter))
+            continue;
+        if (bList)
+        {
+            printf("%s\n", oBenchmark.osName.c_str());
+            continue;
+        }
+
+        aoResults.push_back(RunBenchmark(oBenchmark, nRepetitions));
+        const auto &oResult = aoResults.back();
+        if (!oResult.osSkipReason.empty())
+        {
+            printf("%-50s skipped: %s\n", oResult.osName.c_str(),
+                   oResult.osSkipReason.c_str());
+        }
+        else
+        {
+            printf("%-50s min %10.2f ms  median %10.2f ms  cpu %10.2f ms\n",
+                   oResult.osName.c_str(), oResult.dfRealTimeMin,
+                   oResult.dfRealTimeMedian, oResult.dfCPUTimeMin);
+        }
+        fflush(stdout);
+    }
+
+    int nRet = 0;
+    if (!osJSON.empty() && !WriteJSON(osJSON, aoResults))
+    {
+        fprintf(stderr, "Cannot write %s\n", osJSON.c_str());
+        nRet = 1;
+    }
+    if (!osBaseline.empty())
+    {
+        const int nRegressions =
+            CompareToBaseline(osBaseline, aoResults, dfTolerancePct);
+        if (nRegressions < 0)
+        {
+            fprintf(stderr, "Cannot read %s\n", osBaseline.c_str());
+            nRet = 1;
+        }
+        else if (nRegressions > 0)
+        {
+            fprintf(stderr, "%d benchmark(s) regressed\n", nRegressions);
+            nRet = 1;
+        }
+    }
+
+    GDALDestroyDriverManager();
+
+    return nRet;
+}
@@ -0,0 +1,54 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2024 GDAL contributors
+
+# Compares the speed of QB3 with other lossless codecs of the GTiff driver,
+# for single and multi-threaded encoding and decoding.
+
+import time
+
+from osgeo import gdal
+
+if "QB3" not in gdal.GetDriverByName("GTiff").GetMetadataItem("DMD_CREATIONOPTIONLIST"):
+    raise Exception("GDAL not built with QB3 support")
+
+srcfilename = "/vsimem/test.tif"
+gdal.Translate(
+    srcfilename,
+    "../autotest/gcore/data/rgbsmall.tif",
+    options="-outsize 8000 8000 -r cubic -co TILED=YES",
+)
+
+
+def doit(compress, threads, options=""):
+
+    gdal.SetConfigOption("GDAL_NUM_THREADS", str(threads))
+
+    start = time.time()
+    gdal.Translate(
+        "/vsimem/out.tif",
+        srcfilename,
+        options="-co TILED=YES -co COMPRESS=" + compress + " " + options,
+    )
+    end = time.time()
+    size = gdal.VSIStatL("/vsimem/out.tif").size
+
+    ds = gdal.Open("/vsimem/out.tif")
+    start_read = time.time()
+    ds.ReadRaster()
+    end_read = time.time()
+    ds = None
+
+    print(
+        "COMPRESS=%s %s, NUM_THREADS=%d: write %.2f s, read %.2f s, %d bytes"
+        % (compress, options, threads, end - start, end_read - start_read, size)
+    )
+
+    gdal.SetConfigOption("GDAL_NUM_THREADS", None)
+    gdal.Unlink("/vsimem/out.tif")
+
+
+for threads in (0, 2, 4, 8):
+    doit("QB3", threads)
+    doit("ZSTD", threads, "-co PREDICTOR=2")
+    doit("DEFLATE", threads, "-co PREDICTOR=2")
+    doit("LERC", threads)
@@ -113,5 +113,37 @@ int main(int /* argc */, char * /* argv */[])
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
+    // Packed conversions that have AVX2 (x86_64) or NEON (aarch64) code paths
+    const GDALDataType aeTypePairs[][2] = {
+        {GDT_Byte, GDT_UInt16},    {GDT_Byte, GDT_Float32},
+        {GDT_UInt16, GDT_Byte},    {GDT_UInt16, GDT_Float32},
+        {GDT_Float32, GDT_Byte},   {GDT_Float32, GDT_UInt16},
+        {GDT_Float64, GDT_Float32}};
+    for (int k = 0; k < 2; k++)
+    {
+        if (k == 1)
+        {
+            // Only effective in DEBUG builds
+            printf("Disabling AVX2\n");
+            CPLSetConfigOption("GDAL_USE_AVX2", "NO");
+        }
+
+        for (const auto &aeTypes : aeTypePairs)
+        {
+            start = clock();
+            for (i = 0; i < 10000; i++)
+                GDALCopyWords(
+                    in, aeTypes[0], GDALGetDataTypeSizeBytes(aeTypes[0]), out,
+                    aeTypes[1], GDALGetDataTypeSizeBytes(aeTypes[1]),
+                    256 * 256);
+            end = clock();
+            printf("%s -> %s (packed, 10000 iterations) : %.2f s\n",
+                   GDALGetDataTypeName(aeTypes[0]),
+                   GDALGetDataTypeName(aeTypes[1]),
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
+    }
+    CPLSetConfigOption("GDAL_USE_AVX2", nullptr);
+
     return 0;
 }
@@ -62,6 +62,21 @@ int main(int /* argc */, char * /* argv */[])
                    (end - start) * 1.0 / CLOCKS_PER_SEC);
         }
 
+        {
+            // Misaligned buffers, that do not benefit from the 32-bit word
+            // based generic implementation.
+            void *threeDstBuffers[] = {static_cast<GByte *>(dst0) + 1,
+                                       static_cast<GByte *>(dst1) + 1,
+                                       static_cast<GByte *>(dst2) + 1};
+            const auto start = clock();
+            for (int i = 0; i < 2000 * (1024 / SIZE) * (1024 / SIZE); ++i)
+                GDALDeinterleave(static_cast<GByte *>(src) + 1, GDT_Byte, 3,
+                                 threeDstBuffers, GDT_Byte, SIZE * SIZE - 1);
+            const auto end = clock();
+            printf("GDALDeinterleave Byte 3 (misaligned) : %.2f\n",
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
+
         {
             void *fourDstBuffers[] = {dst0, dst1, dst2, dst3};
             const auto start = clock();
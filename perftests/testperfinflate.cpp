@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Test performance of Deflate decompression.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+
+// Measures CPLZLibInflate() on chunks of typical tile sizes, and sequential
+// reading of a /vsigzip/ file, with and without CPL_VSIL_GZIP_INDEX, so as
+// to compare builds against zlib, libdeflate and ISA-L.
+
+#include "cpl_conv.h"
+#include "cpl_vsi.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static std::string MakeContent(size_t nSize)
+{
+    // Moderately compressible text, such as CSV
+    std::string osContent;
+    osContent.reserve(nSize + 32);
+    for (unsigned i = 0; osContent.size() < nSize; ++i)
+    {
+        osContent += std::to_string(i * 2654435761U % 1000003);
+        osContent += (i % 8) == 7 ? '\n' : ',';
+    }
+    osContent.resize(nSize);
+    return osContent;
+}
+
+template <class F> static double MeasureSeconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+static void BenchmarkChunks(size_t nChunkSize, int nIters)
+{
+    const std::string osContent = MakeContent(nChunkSize);
+    size_t nCompressedSize = 0;
+    void *pCompressed = CPLZLibDeflate(osContent.data(), osContent.size(), -1,
+                                       nullptr, 0, &nCompressedSize);
+    std::vector<char> abyOut(nChunkSize + 1);
+
+    const double dfSeconds = MeasureSeconds(
+        [&]()
+        {
+            for (int i = 0; i < nIters; ++i)
+            {
+                size_t nOutBytes = 0;
+                CPLZLibInflate(pCompressed, nCompressedSize, abyOut.data(),
+                               abyOut.size(), &nOutBytes);
+            }
+        });
+    printf("CPLZLibInflate %d KB chunks : %.1f MB/s\n",
+           static_cast<int>(nChunkSize / 1024),
+           static_cast<double>(nChunkSize) * nIters / dfSeconds / 1e6);
+    VSIFree(pCompressed);
+}
+
+static void BenchmarkVSIGZip(const char *pszFilename, size_t nSize,
+                             const char *pszIndex)
+{
+    CPLSetConfigOption("CPL_VSIL_GZIP_INDEX", pszIndex);
+    CPLSetConfigOption("CPL_VSIL_GZIP_WRITE_PROPERTIES", "NO");
+    std::vector<char> abyBuffer(65536);
+    const double dfSeconds = MeasureSeconds(
+        [&]()
+        {
+            VSILFILE *fp =
+                VSIFOpenL((std::string("/vsigzip/") + pszFilename).c_str(),
+                          "rb");
+            if (fp)
+            {
+                while (VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), fp) ==
+                       abyBuffer.size())
+                {
+                }
+                VSIFCloseL(fp);
+            }
+        });
+    printf("/vsigzip/ sequential read, CPL_VSIL_GZIP_INDEX=%s : %.1f MB/s\n",
+           pszIndex, static_cast<double>(nSize) / dfSeconds / 1e6);
+    CPLSetConfigOption("CPL_VSIL_GZIP_INDEX", nullptr);
+    CPLSetConfigOption("CPL_VSIL_GZIP_WRITE_PROPERTIES", nullptr);
+}
+
+int main(int /* argc */, char * /* argv */[])
+{
+    BenchmarkChunks(64 * 1024, 2000);
+    BenchmarkChunks(1024 * 1024, 100);
+
+    constexpr size_t SIZE = 256 * 1024 * 1024;
+    const char *pszFilename = "/vsimem/testperfinflate.gz";
+    {
+        const std::string osContent = MakeContent(SIZE);
+        VSILFILE *fp =
+            VSIFOpenL((std::string("/vsigzip/") + pszFilename).c_str(), "wb");
+        VSIFWriteL(osContent.data(), 1, osContent.size(), fp);
+        VSIFCloseL(fp);
+    }
+    BenchmarkVSIGZip(pszFilename, SIZE, "NO");
+    // The first indexed read includes building the index
+    BenchmarkVSIGZip(pszFilename, SIZE, "YES");
+    BenchmarkVSIGZip(pszFilename, SIZE, "YES");
+    VSIUnlink(pszFilename);
+
+    return 0;
+}
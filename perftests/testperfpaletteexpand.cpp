@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test performance of GDALApplyByteLUT() and
+ *           GDALExpandPaletteByte().
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "cpl_conv.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+int main(int /* argc */, char * /* argv */[])
+{
+    constexpr int SIZE = 1024;
+    constexpr int ITERS = 1000;
+    GByte *src = static_cast<GByte *>(malloc(SIZE * SIZE));
+    GByte *dst0 = static_cast<GByte *>(malloc(SIZE * SIZE));
+    GByte *dst1 = static_cast<GByte *>(malloc(SIZE * SIZE));
+    GByte *dst2 = static_cast<GByte *>(malloc(SIZE * SIZE));
+    GByte *dst3 = static_cast<GByte *>(malloc(SIZE * SIZE));
+    GByte *const dstBuffers[] = {dst0, dst1, dst2, dst3};
+
+    for (int i = 0; i < SIZE * SIZE; ++i)
+        src[i] = static_cast<GByte>((i * 7919) >> 3);
+    GByte abyCT[4 * 256];
+    for (int i = 0; i < 4 * 256; ++i)
+        abyCT[i] = static_cast<GByte>(255 - (i % 251));
+    GByte abyLUT[256];
+    for (int i = 0; i < 256; ++i)
+        abyLUT[i] = abyCT[4 * i];
+
+    {
+        const auto start = clock();
+        for (int iter = 0; iter < ITERS; ++iter)
+        {
+            for (int i = 0; i < SIZE * SIZE; ++i)
+                dst0[i] = abyLUT[src[i]];
+        }
+        const auto end = clock();
+        printf("Reference LUT loop : %.2f\n",
+               (end - start) * 1.0 / CLOCKS_PER_SEC);
+    }
+
+    {
+        const auto start = clock();
+        for (int iter = 0; iter < ITERS; ++iter)
+            GDALApplyByteLUT(src, abyLUT, dst0, 1, SIZE * SIZE);
+        const auto end = clock();
+        printf("GDALApplyByteLUT : %.2f\n",
+               (end - start) * 1.0 / CLOCKS_PER_SEC);
+    }
+
+    for (int nComponents = 3; nComponents <= 4; ++nComponents)
+    {
+        {
+            const auto start = clock();
+            for (int iter = 0; iter < ITERS; ++iter)
+            {
+                for (int i = 0; i < SIZE * SIZE; ++i)
+                {
+                    const GByte *pabyEntry = abyCT + 4 * src[i];
+                    for (int iComp = 0; iComp < nComponents; ++iComp)
+                        dstBuffers[iComp][i] = pabyEntry[iComp];
+                }
+            }
+            const auto end = clock();
+            printf("Reference palette expansion %d : %.2f\n", nComponents,
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
+
+        for (int k = 0; k < 2; k++)
+        {
+            if (k == 1)
+                CPLSetConfigOption("GDAL_USE_SSSE3", "NO");
+            const auto start = clock();
+            for (int iter = 0; iter < ITERS; ++iter)
+                GDALExpandPaletteByte(src, abyCT, nComponents, dstBuffers,
+                                      SIZE * SIZE);
+            const auto end = clock();
+            printf("GDALExpandPaletteByte %d%s : %.2f\n", nComponents,
+                   k == 1 ? " (SSSE3 disabled)" : "",
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+            CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
+        }
+    }
+
+    VSIFree(src);
+    VSIFree(dst0);
+    VSIFree(dst1);
+    VSIFree(dst2);
+    VSIFree(dst3);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test performance of GDALSwapWords().
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdal.h"
+#include "cpl_conv.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+int main(int /* argc */, char * /* argv */[])
+{
+    constexpr int SIZE = 1024;
+    GByte *buffer = static_cast<GByte *>(calloc(SIZE * SIZE + 8, 8));
+
+    for (int nWordSize : {2, 4, 8})
+    {
+        const int nWordCount = SIZE * SIZE * 8 / nWordSize;
+
+        {
+            const auto start = clock();
+            for (int i = 0; i < 200; ++i)
+                GDALSwapWords(buffer, nWordSize, nWordCount, nWordSize);
+            const auto end = clock();
+            printf("GDALSwapWords %d bytes, packed : %.2f\n", nWordSize,
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
+
+        {
+            const auto start = clock();
+            for (int i = 0; i < 200; ++i)
+                GDALSwapWords(buffer + 1, nWordSize, nWordCount, nWordSize);
+            const auto end = clock();
+            printf("GDALSwapWords %d bytes, packed, misaligned : %.2f\n",
+                   nWordSize, (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
+
+        {
+            // Interleaved with another word, as in pixel interleaved rasters
+            const auto start = clock();
+            for (int i = 0; i < 200; ++i)
+                GDALSwapWords(buffer, nWordSize, nWordCount / 2,
+                              2 * nWordSize);
+            const auto end = clock();
+            printf("GDALSwapWords %d bytes, interleaved : %.2f\n", nWordSize,
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
+    }
+
+    free(buffer);
+
+    return 0;
+}
@@ -38,6 +38,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_http.h"
 #include <algorithm>
+#include <map>
 
 // #define DEBUG_VERBOSE 1
 
@@ -72,6 +73,21 @@ static std::string gosSourceProfileSessionToken;
 static std::string gosRoleArnWebIdentity;
 static std::string gosWebIdentityTokenFile;
 
+// Sessions of S3 Express One Zone directory buckets, indexed by
+// bucket host and access key id
+namespace
+{
+struct S3ExpressSession
+{
+    std::string osSecretAccessKey{};
+    std::string osAccessKeyId{};
+    std::string osSessionToken{};
+    GIntBig nExpiration = 0;
+};
+}  // namespace
+
+static std::map<std::string, S3ExpressSession> goMapS3ExpressSessions;
+
 /************************************************************************/
 /*                         CPLGetLowerCaseHex()                         */
 /************************************************************************/
@@ -377,6 +393,7 @@ VSIS3HandleHelper::VSIS3HandleHelper(
       m_osRegion(osRegion), m_osRequestPayer(osRequestPayer),
       m_osBucket(osBucket), m_osObjectKey(osObjectKey), m_bUseHTTPS(bUseHTTPS),
       m_bUseVirtualHosting(bUseVirtualHosting),
+      m_bIsDirectoryBucket(IsDirectoryBucket(osBucket)),
       m_eCredentialsSource(eCredentialsSource)
 {
     VSIS3UpdateParams::UpdateHandleFromMap(this);
@@ -414,6 +431,21 @@ std::string VSIS3HandleHelper::BuildURL(const std::string &osEndpoint,
                           CPLAWSURLEncode(osObjectKey, false).c_str());
 }
 
+/************************************************************************/
+/*                         IsDirectoryBucket()                          */
+/************************************************************************/
+
+// S3 Express One Zone directory buckets are named
+// bucket-base-name--zone-id--x-s3
+bool VSIS3HandleHelper::IsDirectoryBucket(const std::string &osBucket)
+{
+    constexpr const char *SUFFIX = "--x-s3";
+    const size_t nSuffixLen = strlen(SUFFIX);
+    return osBucket.size() > nSuffixLen &&
+           osBucket.compare(osBucket.size() - nSuffixLen, nSuffixLen,
+                            SUFFIX) == 0;
+}
+
 /************************************************************************/
 /*                           RebuildURL()                               */
 /************************************************************************/
@@ -1690,6 +1722,7 @@ void VSIS3HandleHelper::ClearCache()
     gosRegion.clear();
     gosRoleArnWebIdentity.clear();
     gosWebIdentityTokenFile.clear();
+    goMapS3ExpressSessions.clear();
 }
 
 /************************************************************************/
@@ -1732,6 +1765,7 @@ VSIS3HandleHelper *VSIS3HandleHelper::BuildFromURI(const char *pszURI,
 
     std::string osEndpoint = VSIGetPathSpecificOption(
         osPathForOption.c_str(), "AWS_S3_ENDPOINT", "s3.amazonaws.com");
+    const bool bDefaultEndpoint = osEndpoint == "s3.amazonaws.com";
     if (!osRegion.empty() && osEndpoint == "s3.amazonaws.com")
     {
         osEndpoint = "s3." + osRegion + ".amazonaws.com";
@@ -1746,6 +1780,20 @@ VSIS3HandleHelper *VSIS3HandleHelper::BuildFromURI(const char *pszURI,
     {
         return nullptr;
     }
+    if (bDefaultEndpoint && !osRegion.empty() && IsDirectoryBucket(osBucket))
+    {
+        // Directory buckets are served by a zonal endpoint:
+        // bucket-base-name--zone-id--x-s3 is at
+        // s3express-zone-id.region.amazonaws.com
+        const std::string osBaseName(
+            osBucket.substr(0, osBucket.size() - strlen("--x-s3")));
+        const auto nPos = osBaseName.rfind("--");
+        if (nPos != std::string::npos)
+        {
+            osEndpoint = "s3express-" + osBaseName.substr(nPos + 2) + "." +
+                         osRegion + ".amazonaws.com";
+        }
+    }
     const bool bUseHTTPS = CPLTestBool(
         VSIGetPathSpecificOption(osPathForOption.c_str(), "AWS_HTTPS", "YES"));
     const bool bIsValidNameForVirtualHosting =
@@ -1868,6 +1916,118 @@ void VSIS3HandleHelper::RefreshCredentials(const std::string &osPathForOption,
     }
 }
 
+/************************************************************************/
+/*                   GetS3ExpressSessionCredentials()                   */
+/************************************************************************/
+
+// Issue a CreateSession request on a directory bucket, or reuse the result
+// of a previous one, to get temporary credentials scoped to the bucket.
+// See https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateSession.html
+bool VSIS3HandleHelper::GetS3ExpressSessionCredentials(
+    const std::string &osPathForOption, const std::string &osHost,
+    std::string &osSecretAccessKey, std::string &osAccessKeyId,
+    std::string &osSessionToken) const
+{
+    CPLMutexHolder oHolder(&ghMutex);
+
+    const std::string osKey(osHost + '/' + m_osBucket + '/' + m_osAccessKeyId);
+    auto oIter = goMapS3ExpressSessions.find(osKey);
+    if (oIter != goMapS3ExpressSessions.end())
+    {
+        time_t nCurTime;
+        time(&nCurTime);
+        // Sessions last 5 minutes. Keep a bit of margin, as for other
+        // temporary credentials.
+        if (nCurTime < oIter->second.nExpiration - 60)
+        {
+            osSecretAccessKey = oIter->second.osSecretAccessKey;
+            osAccessKeyId = oIter->second.osAccessKeyId;
+            osSessionToken = oIter->second.osSessionToken;
+            return true;
+        }
+        goMapS3ExpressSessions.erase(oIter);
+    }
+
+    std::string osXAMZDate =
+        VSIGetPathSpecificOption(osPathForOption.c_str(), "AWS_TIMESTAMP", "");
+    if (osXAMZDate.empty())
+        osXAMZDate = CPLGetAWS_SIGN4_Timestamp(time(nullptr));
+    const std::string osXAMZContentSHA256 =
+        CPLGetLowerCaseHexSHA256(std::string());
+
+    const std::string osAuthorization = CPLGetAWS_SIGN4_Authorization(
+        m_osSecretAccessKey, m_osAccessKeyId, m_osSessionToken, m_osRegion,
+        std::string(),  // m_osRequestPayer,
+        "s3express", "GET",
+        nullptr,  // psExistingHeaders,
+        osHost, m_bUseVirtualHosting ? "/" : "/" + m_osBucket + "/",
+        "session=", osXAMZContentSHA256,
+        true,  // bAddHeaderAMZContentSHA256
+        osXAMZDate);
+
+    CPLStringList aosOptions(CPLHTTPGetOptionsFromEnv(osPathForOption.c_str()));
+    std::string headers;
+    headers += "x-amz-date: " + osXAMZDate + "\r\n";
+    headers += "x-amz-content-sha256: " + osXAMZContentSHA256 + "\r\n";
+    if (!m_osSessionToken.empty())
+        headers += "X-Amz-Security-Token: " + m_osSessionToken + "\r\n";
+    headers += "Authorization: " + osAuthorization;
+    aosOptions.SetNameValue("HEADERS", headers.c_str());
+
+    const std::string osURL = BuildURL(m_osEndpoint, m_osBucket, std::string(),
+                                       m_bUseHTTPS, m_bUseVirtualHosting) +
+                              "?session";
+    bool bRet = false;
+    CPLHTTPResult *psResult = CPLHTTPFetch(osURL.c_str(), aosOptions.List());
+    if (psResult)
+    {
+        if (psResult->nStatus == 0 && psResult->pabyData != nullptr)
+        {
+            CPLXMLTreeCloser oTree(CPLParseXMLString(
+                reinterpret_cast<char *>(psResult->pabyData)));
+            const auto psCredentials =
+                oTree ? CPLGetXMLNode(oTree.get(),
+                                      "=CreateSessionResult.Credentials")
+                      : nullptr;
+            if (psCredentials)
+            {
+                S3ExpressSession oSession;
+                oSession.osAccessKeyId =
+                    CPLGetXMLValue(psCredentials, "AccessKeyId", "");
+                oSession.osSecretAccessKey =
+                    CPLGetXMLValue(psCredentials, "SecretAccessKey", "");
+                oSession.osSessionToken =
+                    CPLGetXMLValue(psCredentials, "SessionToken", "");
+                Iso8601ToUnixTime(
+                    CPLGetXMLValue(psCredentials, "Expiration", ""),
+                    &oSession.nExpiration);
+                if (!oSession.osSecretAccessKey.empty() &&
+                    !oSession.osSessionToken.empty())
+                {
+                    osSecretAccessKey = oSession.osSecretAccessKey;
+                    osAccessKeyId = oSession.osAccessKeyId;
+                    osSessionToken = oSession.osSessionToken;
+                    goMapS3ExpressSessions[osKey] = std::move(oSession);
+                    bRet = true;
+                }
+            }
+            if (!bRet)
+            {
+                CPLDebug("S3", "%s",
+                         reinterpret_cast<char *>(psResult->pabyData));
+            }
+        }
+        CPLHTTPDestroyResult(psResult);
+    }
+    if (!bRet)
+    {
+        CPLDebug("S3",
+                 "CreateSession on %s failed. Using regular credentials",
+                 m_osBucket.c_str());
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                           GetCurlHeaders()                           */
 /************************************************************************/
@@ -1898,12 +2058,45 @@ struct curl_slist *VSIS3HandleHelper::GetCurlHeaders(
     const std::string osHost(m_bUseVirtualHosting && !m_osBucket.empty()
                                  ? std::string(m_osBucket + "." + m_osEndpoint)
                                  : m_osEndpoint);
+
+    // Requests to directory buckets are signed with the credentials of a
+    // session obtained with CreateSession, which are passed in the
+    // x-amz-s3session-token header instead of x-amz-security-token.
+    std::string osS3ExpressSecretAccessKey;
+    std::string osS3ExpressAccessKeyId;
+    std::string osS3ExpressSessionToken;
+    const bool bUseS3ExpressSession =
+        m_bIsDirectoryBucket && !m_osSecretAccessKey.empty() &&
+        CPLTestBool(VSIGetPathSpecificOption(
+            osPathForOption.c_str(), "AWS_S3EXPRESS_SESSION_AUTH", "YES")) &&
+        GetS3ExpressSessionCredentials(
+            osPathForOption, osHost, osS3ExpressSecretAccessKey,
+            osS3ExpressAccessKeyId, osS3ExpressSessionToken);
+    struct curl_slist *psHeadersToSign = nullptr;
+    if (bUseS3ExpressSession)
+    {
+        for (const struct curl_slist *psIter = psExistingHeaders; psIter;
+             psIter = psIter->next)
+        {
+            psHeadersToSign = curl_slist_append(psHeadersToSign, psIter->data);
+        }
+        psHeadersToSign = curl_slist_append(
+            psHeadersToSign, CPLSPrintf("x-amz-s3session-token: %s",
+                                        osS3ExpressSessionToken.c_str()));
+    }
+
     const std::string osAuthorization =
         m_osSecretAccessKey.empty()
             ? std::string()
             : CPLGetAWS_SIGN4_Authorization(
-                  m_osSecretAccessKey, m_osAccessKeyId, m_osSessionToken,
-                  m_osRegion, m_osRequestPayer, "s3", osVerb, psExistingHeaders,
+                  bUseS3ExpressSession ? osS3ExpressSecretAccessKey
+                                       : m_osSecretAccessKey,
+                  bUseS3ExpressSession ? osS3ExpressAccessKeyId
+                                       : m_osAccessKeyId,
+                  bUseS3ExpressSession ? std::string() : m_osSessionToken,
+                  m_osRegion, m_osRequestPayer,
+                  bUseS3ExpressSession ? "s3express" : "s3", osVerb,
+                  bUseS3ExpressSession ? psHeadersToSign : psExistingHeaders,
                   osHost,
                   m_bUseVirtualHosting
                       ? CPLAWSURLEncode("/" + m_osObjectKey, false).c_str()
@@ -1913,6 +2106,7 @@ struct curl_slist *VSIS3HandleHelper::GetCurlHeaders(
                   osCanonicalQueryString, osXAMZContentSHA256,
                   true,  // bAddHeaderAMZContentSHA256
                   osXAMZDate);
+    curl_slist_free_all(psHeadersToSign);
 
     struct curl_slist *headers = nullptr;
     headers = curl_slist_append(
@@ -1920,7 +2114,11 @@ struct curl_slist *VSIS3HandleHelper::GetCurlHeaders(
     headers =
         curl_slist_append(headers, CPLSPrintf("x-amz-content-sha256: %s",
                                               osXAMZContentSHA256.c_str()));
-    if (!m_osSessionToken.empty())
+    if (bUseS3ExpressSession)
+        headers = curl_slist_append(
+            headers, CPLSPrintf("x-amz-s3session-token: %s",
+                                osS3ExpressSessionToken.c_str()));
+    else if (!m_osSessionToken.empty())
         headers =
             curl_slist_append(headers, CPLSPrintf("X-Amz-Security-Token: %s",
                                                   m_osSessionToken.c_str()));
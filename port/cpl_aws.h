@@ -164,10 +164,17 @@ class VSIS3HandleHelper final : public IVSIS3LikeHandleHelper
     std::string m_osObjectKey{};
     bool m_bUseHTTPS = false;
     bool m_bUseVirtualHosting = false;
+    bool m_bIsDirectoryBucket = false;
     AWSCredentialsSource m_eCredentialsSource = AWSCredentialsSource::REGULAR;
 
     void RebuildURL() override;
 
+    bool GetS3ExpressSessionCredentials(const std::string &osPathForOption,
+                                        const std::string &osHost,
+                                        std::string &osSecretAccessKey,
+                                        std::string &osAccessKeyId,
+                                        std::string &osSessionToken) const;
+
     static bool GetOrRefreshTemporaryCredentialsForRole(
         bool bForceRefresh, std::string &osSecretAccessKey,
         std::string &osAccessKeyId, std::string &osSessionToken,
@@ -226,6 +233,8 @@ class VSIS3HandleHelper final : public IVSIS3LikeHandleHelper
                                 const std::string &osObjectKey, bool bUseHTTPS,
                                 bool bUseVirtualHosting);
 
+    static bool IsDirectoryBucket(const std::string &osBucket);
+
     struct curl_slist *
     GetCurlHeaders(const std::string &osVerb,
                    const struct curl_slist *psExistingHeaders,
@@ -78,10 +78,13 @@
 #include <xlocale.h>  // for LC_NUMERIC_MASK on MacOS
 #endif
 
+#include <atomic>
+#include <memory>
 #ifdef DEBUG_CONFIG_OPTIONS
 #include <set>
 #endif
 #include <string>
+#include <vector>
 
 #if __cplusplus >= 202002L
 #include <type_traits>  // For std::endian
@@ -115,6 +118,69 @@ static bool gbIgnoreEnvVariables =
 static std::vector<std::pair<CPLSetConfigOptionSubscriber, void *>>
     gSetConfigOptionSubscribers{};
 
+namespace
+{
+/************************************************************************/
+/*                     CPLGlobalConfigOptionsSnapshot                   */
+/************************************************************************/
+
+// Immutable copy of g_papszConfigOptions, so that global configuration
+// options can be looked up without taking hConfigMutex.
+// Lookups are done on the private copy of the "KEY=VALUE" entries, but the
+// returned values point to the entries of g_papszConfigOptions, so that
+// they remain valid until the same key is modified, as documented for
+// CPLGetConfigOption().
+class CPLGlobalConfigOptionsSnapshot
+{
+    CPLStringList m_aosEntries{};
+    std::vector<const char *> m_apszGlobalEntries{};
+
+    CPL_DISALLOW_COPY_ASSIGN(CPLGlobalConfigOptionsSnapshot)
+
+  public:
+    explicit CPLGlobalConfigOptionsSnapshot(const char *const *papszOptions)
+        : m_aosEntries(CSLDuplicate(papszOptions))
+    {
+        for (const char *const *papszIter = papszOptions;
+             papszIter && *papszIter; ++papszIter)
+        {
+            m_apszGlobalEntries.push_back(*papszIter);
+        }
+    }
+
+    // Same semantics as CSLFetchNameValue()
+    const char *Fetch(const char *pszKey) const
+    {
+        const size_t nLen = strlen(pszKey);
+        for (size_t i = 0; i < m_apszGlobalEntries.size(); ++i)
+        {
+            const char *pszEntry = m_aosEntries[static_cast<int>(i)];
+            if (EQUALN(pszEntry, pszKey, nLen) &&
+                (pszEntry[nLen] == '=' || pszEntry[nLen] == ':'))
+            {
+                return m_apszGlobalEntries[i] + nLen + 1;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Snapshot last used by a thread, stored in CTLS_GLOBALCONFIGOPTIONS.
+struct CPLGlobalConfigOptionsTLS
+{
+    GUInt32 nGeneration = 0;
+    std::shared_ptr<const CPLGlobalConfigOptionsSnapshot> poSnapshot{};
+};
+
+}  // namespace
+
+// Incremented each time g_papszConfigOptions is modified.
+static std::atomic<GUInt32> g_nConfigOptionsGeneration{0};
+
+// Lazily (re)built snapshot of g_papszConfigOptions. Protected by hConfigMutex.
+static std::shared_ptr<const CPLGlobalConfigOptionsSnapshot>
+    g_poConfigOptionsSnapshot{};
+
 // Used by CPLOpenShared() and friends.
 static CPLMutex *hSharedFileMutex = nullptr;
 static int nSharedFileCount = 0;
@@ -1656,6 +1722,40 @@ static void CPLAccessConfigOption(const char *pszKey, bool bGet)
 }
 #endif
 
+/************************************************************************/
+/*                 CPLGlobalConfigOptionsTLSFreeFunc()                  */
+/************************************************************************/
+
+static void CPLGlobalConfigOptionsTLSFreeFunc(void *pData)
+{
+    delete static_cast<CPLGlobalConfigOptionsTLS *>(pData);
+}
+
+/************************************************************************/
+/*              CPLInvalidateGlobalConfigOptionsSnapshot()              */
+/************************************************************************/
+
+// Must be called with hConfigMutex held, after g_papszConfigOptions has
+// been modified.
+static void CPLInvalidateGlobalConfigOptionsSnapshot()
+{
+    g_poConfigOptionsSnapshot.reset();
+    g_nConfigOptionsGeneration.fetch_add(1, std::memory_order_release);
+}
+
+/************************************************************************/
+/*                   CPLHasThreadLocalConfigOptions()                   */
+/************************************************************************/
+
+static bool CPLHasThreadLocalConfigOptions()
+{
+    int bMemoryError = FALSE;
+    char **papszTLConfigOptions = reinterpret_cast<char **>(
+        CPLGetTLSEx(CTLS_CONFIGOPTIONS, &bMemoryError));
+    return bMemoryError || (papszTLConfigOptions != nullptr &&
+                            *papszTLConfigOptions != nullptr);
+}
+
 /************************************************************************/
 /*                         CPLGetConfigOption()                         */
 /************************************************************************/
@@ -1773,6 +1873,7 @@ void CPLSetConfigOptions(const char *const *papszConfigOptions)
     CSLDestroy(const_cast<char **>(g_papszConfigOptions));
     g_papszConfigOptions = const_cast<volatile char **>(
         CSLDuplicate(const_cast<char **>(papszConfigOptions)));
+    CPLInvalidateGlobalConfigOptionsSnapshot();
 }
 
 /************************************************************************/
@@ -1819,10 +1920,51 @@ const char *CPL_STDCALL CPLGetGlobalConfigOption(const char *pszKey,
     CPLAccessConfigOption(pszKey, TRUE);
 #endif
 
-    CPLMutexHolderD(&hConfigMutex);
+    // Fast path: look up the snapshot of the global options last used
+    // by this thread, which is only refreshed (under hConfigMutex) when the
+    // global options have been modified since.
+    const GUInt32 nGeneration =
+        g_nConfigOptionsGeneration.load(std::memory_order_acquire);
+    int bMemoryError = FALSE;
+    auto psTLS = static_cast<CPLGlobalConfigOptionsTLS *>(
+        CPLGetTLSEx(CTLS_GLOBALCONFIGOPTIONS, &bMemoryError));
+    if (psTLS == nullptr && !bMemoryError)
+    {
+        psTLS = new CPLGlobalConfigOptionsTLS();
+        CPLSetTLSWithFreeFuncEx(CTLS_GLOBALCONFIGOPTIONS, psTLS,
+                                CPLGlobalConfigOptionsTLSFreeFunc,
+                                &bMemoryError);
+        if (bMemoryError)
+        {
+            delete psTLS;
+            psTLS = nullptr;
+        }
+    }
 
-    const char *pszResult =
-        CSLFetchNameValue(const_cast<char **>(g_papszConfigOptions), pszKey);
+    const char *pszResult = nullptr;
+    if (psTLS == nullptr)
+    {
+        CPLMutexHolderD(&hConfigMutex);
+        pszResult = CSLFetchNameValue(
+            const_cast<char **>(g_papszConfigOptions), pszKey);
+    }
+    else
+    {
+        if (!psTLS->poSnapshot || psTLS->nGeneration != nGeneration)
+        {
+            CPLMutexHolderD(&hConfigMutex);
+            if (!g_poConfigOptionsSnapshot)
+            {
+                g_poConfigOptionsSnapshot =
+                    std::make_shared<CPLGlobalConfigOptionsSnapshot>(
+                        const_cast<char **>(g_papszConfigOptions));
+            }
+            psTLS->poSnapshot = g_poConfigOptionsSnapshot;
+            psTLS->nGeneration =
+                g_nConfigOptionsGeneration.load(std::memory_order_relaxed);
+        }
+        pszResult = psTLS->poSnapshot->Fetch(pszKey);
+    }
 
     if (pszResult == nullptr)
         return pszDefault;
@@ -1957,6 +2099,7 @@ void CPL_STDCALL CPLSetConfigOption(const char *pszKey, const char *pszValue)
 
     g_papszConfigOptions = const_cast<volatile char **>(CSLSetNameValue(
         const_cast<char **>(g_papszConfigOptions), pszKey, pszValue));
+    CPLInvalidateGlobalConfigOptionsSnapshot();
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/false);
@@ -2094,6 +2237,7 @@ void CPL_STDCALL CPLFreeConfig()
 
         CSLDestroy(const_cast<char **>(g_papszConfigOptions));
         g_papszConfigOptions = nullptr;
+        CPLInvalidateGlobalConfigOptionsSnapshot();
 
         int bMemoryError = FALSE;
         char **papszTLConfigOptions = reinterpret_cast<char **>(
@@ -3508,4 +3652,71 @@ CPLConfigOptionSetter::~CPLConfigOptionSetter()
     CPLFree(m_pszKey);
 }
 
+/************************************************************************/
+/*                    CPLGetCachedConfigOptionValue()                   */
+/************************************************************************/
+
+// The cache packs the generation of the global configuration options
+// (plus one, so that 0 means "not cached") in its 32 most significant bits,
+// and the parsed value in its 32 least significant bits.
+template <class ParseFunc>
+static int CPLGetCachedConfigOptionValue(std::atomic<GUInt64> &nCache,
+                                         const char *pszKey,
+                                         ParseFunc parseFunc)
+{
+    if (CPLHasThreadLocalConfigOptions())
+        return parseFunc(CPLGetConfigOption(pszKey, nullptr));
+
+    // Read the generation before the value, so that a concurrent
+    // CPLSetConfigOption() results in a cache miss at the next call.
+    const GUInt64 nTag =
+        static_cast<GUInt64>(static_cast<GUInt32>(
+            g_nConfigOptionsGeneration.load(std::memory_order_acquire) + 1))
+        << 32;
+    const GUInt64 nCached = nCache.load(std::memory_order_relaxed);
+    if ((nCached & ~static_cast<GUInt64>(0xFFFFFFFFU)) == nTag)
+        return static_cast<int>(static_cast<GUInt32>(nCached));
+
+    const int nValue = parseFunc(CPLGetConfigOption(pszKey, nullptr));
+    nCache.store(nTag | static_cast<GUInt32>(nValue),
+                 std::memory_order_relaxed);
+    return nValue;
+}
+
+/************************************************************************/
+/*                      CPLCachedBoolConfigOption                       */
+/************************************************************************/
+
+CPLCachedBoolConfigOption::CPLCachedBoolConfigOption(const char *pszKey,
+                                                     bool bDefault)
+    : m_pszKey(pszKey), m_bDefault(bDefault)
+{
+}
+
+bool CPLCachedBoolConfigOption::Get()
+{
+    return CPLGetCachedConfigOptionValue(
+               m_nCache, m_pszKey,
+               [this](const char *pszValue)
+               { return pszValue ? CPLTestBool(pszValue) : m_bDefault; }) !=
+           0;
+}
+
+/************************************************************************/
+/*                       CPLCachedIntConfigOption                       */
+/************************************************************************/
+
+CPLCachedIntConfigOption::CPLCachedIntConfigOption(const char *pszKey,
+                                                   int nDefault)
+    : m_pszKey(pszKey), m_nDefault(nDefault)
+{
+}
+
+int CPLCachedIntConfigOption::Get()
+{
+    return CPLGetCachedConfigOptionValue(
+        m_nCache, m_pszKey, [this](const char *pszValue)
+        { return pszValue ? atoi(pszValue) : m_nDefault; });
+}
+
 //! @endcond
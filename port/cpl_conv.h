@@ -396,6 +396,77 @@ extern "C++"
 #endif /* def __cplusplus */
 //! @endcond
 
+/* -------------------------------------------------------------------- */
+/*      C++ objects caching the parsed value of a config option         */
+/* -------------------------------------------------------------------- */
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+extern "C++"
+{
+#ifndef DOXYGEN_SKIP
+#include <atomic>
+#endif
+
+    /** Boolean configuration option whose parsed value is cached.
+     *
+     * Meant to be used as a static object in hot code paths, to avoid
+     * looking up and parsing the option at each call:
+     * <pre>
+     *     static CPLCachedBoolConfigOption gbOption("MY_OPTION", false);
+     *     if (gbOption.Get()) ...
+     * </pre>
+     *
+     * The value is parsed again after CPLSetConfigOption() or
+     * CPLSetConfigOptions() has been called, and is never cached when the
+     * calling thread has options set with CPLSetThreadLocalConfigOption().
+     * Changes of environment variables after the first access are not
+     * detected. pszKey must remain valid during the lifetime of the object
+     * (typically a string literal).
+     *
+     * @since GDAL 3.10
+     */
+    class CPL_DLL CPLCachedBoolConfigOption
+    {
+        CPL_DISALLOW_COPY_ASSIGN(CPLCachedBoolConfigOption)
+      public:
+        CPLCachedBoolConfigOption(const char *pszKey, bool bDefault);
+
+        /** Return the value of the option, as evaluated by CPLTestBool(),
+         * or the default value if it is not set. */
+        bool Get();
+
+      private:
+        const char *const m_pszKey;
+        const bool m_bDefault;
+        std::atomic<GUInt64> m_nCache{0};
+    };
+
+    /** Integer configuration option whose parsed value is cached.
+     *
+     * Same as CPLCachedBoolConfigOption, but for options parsed with atoi().
+     *
+     * @since GDAL 3.10
+     */
+    class CPL_DLL CPLCachedIntConfigOption
+    {
+        CPL_DISALLOW_COPY_ASSIGN(CPLCachedIntConfigOption)
+      public:
+        CPLCachedIntConfigOption(const char *pszKey, int nDefault);
+
+        /** Return the value of the option, or the default value if it is
+         * not set. */
+        int Get();
+
+      private:
+        const char *const m_pszKey;
+        const int m_nDefault;
+        std::atomic<GUInt64> m_nCache{0};
+    };
+}
+
+#endif /* def __cplusplus */
+
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 
 extern "C++"
@@ -30,48 +30,241 @@
 #include "cpl_string.h"
 #include "cpl_cpu_features.h"
 
+#include <cstdlib>
+
 //! @cond Doxygen_Suppress
 
+#define CPUID_SSE3_ECX_BIT 0
 #define CPUID_SSSE3_ECX_BIT 9
+#define CPUID_FMA_ECX_BIT 12
+#define CPUID_SSE41_ECX_BIT 19
+#define CPUID_SSE42_ECX_BIT 20
 #define CPUID_OSXSAVE_ECX_BIT 27
 #define CPUID_AVX_ECX_BIT 28
 
 #define CPUID_SSE_EDX_BIT 25
+#define CPUID_SSE2_EDX_BIT 26
+
+#define CPUID_AVX2_EBX_BIT 5
+#define CPUID_AVX512F_EBX_BIT 16
+#define CPUID_AVX512BW_EBX_BIT 30
+#define CPUID_AVX512VL_EBX_BIT 31
 
 #define BIT_XMM_STATE (1 << 1)
 #define BIT_YMM_STATE (2 << 1)
+// Opmask, upper 256 bits of ZMM0-15 and ZMM16-31 states
+#define BIT_ZMM_STATES (7 << 5)
 
 #define REG_EAX 0
 #define REG_EBX 1
 #define REG_ECX 2
 #define REG_EDX 3
 
-#if defined(__GNUC__)
+#if defined(__GNUC__) && (defined(__x86_64) || defined(__i386__))
 #if defined(__x86_64)
-#define GCC_CPUID(level, a, b, c, d)                                           \
+#define GCC_CPUID_COUNT(level, count, a, b, c, d)                              \
     __asm__("xchgq %%rbx, %q1\n"                                               \
             "cpuid\n"                                                          \
             "xchgq %%rbx, %q1"                                                 \
             : "=a"(a), "=r"(b), "=c"(c), "=d"(d)                               \
-            : "0"(level))
+            : "0"(level), "2"(count))
 #else
-#define GCC_CPUID(level, a, b, c, d)                                           \
+#define GCC_CPUID_COUNT(level, count, a, b, c, d)                              \
     __asm__("xchgl %%ebx, %1\n"                                                \
             "cpuid\n"                                                          \
             "xchgl %%ebx, %1"                                                  \
             : "=a"(a), "=r"(b), "=c"(c), "=d"(d)                               \
-            : "0"(level))
+            : "0"(level), "2"(count))
 #endif
 
-#define CPL_CPUID(level, array)                                                \
-    GCC_CPUID(level, array[0], array[1], array[2], array[3])
+#define CPL_CPUID_COUNT(level, count, array)                                   \
+    GCC_CPUID_COUNT(level, count, array[0], array[1], array[2], array[3])
 
-#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+static unsigned int CPLGetXCR0()
+{
+    unsigned int nXCRLow;
+    unsigned int nXCRHigh;
+    __asm__("xgetbv" : "=a"(nXCRLow), "=d"(nXCRHigh) : "c"(0));
+    CPL_IGNORE_RET_VAL(nXCRHigh);  // unused
+    return nXCRLow;
+}
+
+#define HAVE_CPL_CPUID
+
+#elif defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 160040219) &&                \
+    (defined(_M_IX86) || defined(_M_X64))
+// _xgetbv available only in Visual Studio 2010 SP1 or later
 
 #include <intrin.h>
-#define CPL_CPUID(level, array) __cpuid(array, level)
+#define CPL_CPUID_COUNT(level, count, array) __cpuidex(array, level, count)
+
+static unsigned int CPLGetXCR0()
+{
+    return static_cast<unsigned int>(_xgetbv(_XCR_XFEATURE_ENABLED_MASK));
+}
+
+#define HAVE_CPL_CPUID
+
+#endif
+
+#define CPL_CPUID(level, array) CPL_CPUID_COUNT(level, 0, array)
 
+/************************************************************************/
+/*                     CPLDetectRuntimeCPUFeatures()                    */
+/************************************************************************/
+
+static int CPLDetectRuntimeCPUFeatures()
+{
+    int nFeatures = 0;
+#if defined(HAVE_CPL_CPUID)
+    int cpuinfo[4] = {0, 0, 0, 0};
+    CPL_CPUID(0, cpuinfo);
+    const int nMaxLevel = cpuinfo[REG_EAX];
+    if (nMaxLevel < 1)
+        return 0;
+
+    CPL_CPUID(1, cpuinfo);
+    const auto HasBit = [](int nReg, int nBit)
+    { return (nReg & (1 << nBit)) != 0; };
+    if (HasBit(cpuinfo[REG_EDX], CPUID_SSE_EDX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_SSE;
+    if (HasBit(cpuinfo[REG_EDX], CPUID_SSE2_EDX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_SSE2;
+    if (HasBit(cpuinfo[REG_ECX], CPUID_SSE3_ECX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_SSE3;
+    if (HasBit(cpuinfo[REG_ECX], CPUID_SSSE3_ECX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_SSSE3;
+    if (HasBit(cpuinfo[REG_ECX], CPUID_SSE41_ECX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_SSE41;
+    if (HasBit(cpuinfo[REG_ECX], CPUID_SSE42_ECX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_SSE42;
+
+    // AVX and above require the OS to save the YMM (and ZMM) registers on
+    // context switches, which is reported by XGETBV.
+    if (!HasBit(cpuinfo[REG_ECX], CPUID_OSXSAVE_ECX_BIT))
+        return nFeatures;
+    const unsigned int nXCR0 = CPLGetXCR0();
+    if ((nXCR0 & (BIT_XMM_STATE | BIT_YMM_STATE)) !=
+        (BIT_XMM_STATE | BIT_YMM_STATE))
+    {
+        return nFeatures;
+    }
+    if (HasBit(cpuinfo[REG_ECX], CPUID_AVX_ECX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_AVX;
+    else
+        return nFeatures;
+    if (HasBit(cpuinfo[REG_ECX], CPUID_FMA_ECX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_FMA;
+
+    if (nMaxLevel < 7)
+        return nFeatures;
+    CPL_CPUID_COUNT(7, 0, cpuinfo);
+    if (HasBit(cpuinfo[REG_EBX], CPUID_AVX2_EBX_BIT))
+        nFeatures |= CPL_CPU_FEATURE_AVX2;
+    if ((nXCR0 & BIT_ZMM_STATES) == BIT_ZMM_STATES &&
+        HasBit(cpuinfo[REG_EBX], CPUID_AVX512F_EBX_BIT))
+    {
+        nFeatures |= CPL_CPU_FEATURE_AVX512F;
+        if (HasBit(cpuinfo[REG_EBX], CPUID_AVX512BW_EBX_BIT))
+            nFeatures |= CPL_CPU_FEATURE_AVX512BW;
+        if (HasBit(cpuinfo[REG_EBX], CPUID_AVX512VL_EBX_BIT))
+            nFeatures |= CPL_CPU_FEATURE_AVX512VL;
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    // Advanced SIMD is mandatory in ARMv8-A
+    nFeatures |= CPL_CPU_FEATURE_NEON;
+#elif defined(__ARM_NEON)
+    nFeatures |= CPL_CPU_FEATURE_NEON;
 #endif
+    return nFeatures;
+}
+
+/************************************************************************/
+/*                     CPLParseDisabledCPUFeatures()                    */
+/************************************************************************/
+
+static int CPLParseDisabledCPUFeatures(const char *pszList)
+{
+    static const struct
+    {
+        const char *pszName;
+        int nFlag;
+    } asFeatures[] = {
+        {"SSE", CPL_CPU_FEATURE_SSE},
+        {"SSE2", CPL_CPU_FEATURE_SSE2},
+        {"SSE3", CPL_CPU_FEATURE_SSE3},
+        {"SSSE3", CPL_CPU_FEATURE_SSSE3},
+        {"SSE4.1", CPL_CPU_FEATURE_SSE41},
+        {"SSE4.2", CPL_CPU_FEATURE_SSE42},
+        {"AVX", CPL_CPU_FEATURE_AVX},
+        {"FMA", CPL_CPU_FEATURE_FMA},
+        {"AVX2", CPL_CPU_FEATURE_AVX2},
+        {"AVX512F", CPL_CPU_FEATURE_AVX512F},
+        {"AVX512BW", CPL_CPU_FEATURE_AVX512BW},
+        {"AVX512VL", CPL_CPU_FEATURE_AVX512VL},
+        {"NEON", CPL_CPU_FEATURE_NEON},
+    };
+
+    // Do not use CSLTokenizeString2() or CPLGetConfigOption(), as this
+    // may be called from static initializers.
+    int nDisabled = 0;
+    const char *pszIter = pszList;
+    while (*pszIter)
+    {
+        const char *pszEnd = pszIter;
+        while (*pszEnd && *pszEnd != ',' && *pszEnd != ' ')
+            ++pszEnd;
+        const size_t nLen = static_cast<size_t>(pszEnd - pszIter);
+        for (const auto &sFeature : asFeatures)
+        {
+            if (strlen(sFeature.pszName) == nLen &&
+                EQUALN(sFeature.pszName, pszIter, nLen))
+            {
+                nDisabled |= sFeature.nFlag;
+            }
+        }
+        pszIter = *pszEnd ? pszEnd + 1 : pszEnd;
+    }
+
+    // Disabling a feature disables the features that depend on it
+    if (nDisabled & CPL_CPU_FEATURE_AVX)
+        nDisabled |= CPL_CPU_FEATURE_FMA | CPL_CPU_FEATURE_AVX2;
+    if (nDisabled & (CPL_CPU_FEATURE_AVX | CPL_CPU_FEATURE_AVX2))
+        nDisabled |= CPL_CPU_FEATURE_AVX512F;
+    if (nDisabled & CPL_CPU_FEATURE_AVX512F)
+        nDisabled |= CPL_CPU_FEATURE_AVX512BW | CPL_CPU_FEATURE_AVX512VL;
+    return nDisabled;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                      CPLGetRuntimeCPUFeatures()                      */
+/************************************************************************/
+
+/** Return the SIMD instruction sets supported by the CPU and the OS, as a
+ * combination of CPL_CPU_FEATURE_xxx flags.
+ *
+ * Detection is done once. Features listed in the GDAL_DISABLE_CPU_FEATURES
+ * environment variable (comma separated, for example "AVX2,AVX512F") are not
+ * reported.
+ *
+ * @since GDAL 3.10
+ */
+int CPLGetRuntimeCPUFeatures()
+{
+    static const int nFeatures = []()
+    {
+        int nRet = CPLDetectRuntimeCPUFeatures();
+        const char *pszDisabled = getenv("GDAL_DISABLE_CPU_FEATURES");
+        if (pszDisabled)
+            nRet &= ~CPLParseDisabledCPUFeatures(pszDisabled);
+        return nRet;
+    }();
+    return nFeatures;
+}
+
+//! @cond Doxygen_Suppress
 
 #if defined(HAVE_SSE_AT_COMPILE_TIME) && !defined(HAVE_INLINE_SSE)
 
@@ -81,9 +274,7 @@
 
 bool CPLHaveRuntimeSSE()
 {
-    int cpuinfo[4] = {0, 0, 0, 0};
-    CPL_CPUID(1, cpuinfo);
-    return (cpuinfo[REG_EDX] & (1 << CPUID_SSE_EDX_BIT)) != 0;
+    return CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_SSE);
 }
 
 #endif
@@ -94,20 +285,13 @@ bool CPLHaveRuntimeSSE()
 /*                         CPLHaveRuntimeSSSE3()                        */
 /************************************************************************/
 
-static inline bool CPLDetectSSSE3()
-{
-    int cpuinfo[4] = {0, 0, 0, 0};
-    CPL_CPUID(1, cpuinfo);
-    return (cpuinfo[REG_ECX] & (1 << CPUID_SSSE3_ECX_BIT)) != 0;
-}
-
 #if defined(__GNUC__) && !defined(DEBUG)
 bool bCPLHasSSSE3 = false;
 static void CPLHaveRuntimeSSSE3Initialize() __attribute__((constructor));
 
 static void CPLHaveRuntimeSSSE3Initialize()
 {
-    bCPLHasSSSE3 = CPLDetectSSSE3();
+    bCPLHasSSSE3 = CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_SSSE3);
 }
 #else
 bool CPLHaveRuntimeSSSE3()
@@ -116,7 +300,7 @@ bool CPLHaveRuntimeSSSE3()
     if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_SSSE3", "YES")))
         return false;
 #endif
-    return CPLDetectSSSE3();
+    return CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_SSSE3);
 }
 #endif
 
@@ -130,86 +314,50 @@ bool CPLHaveRuntimeSSSE3()
 
 #if defined(__GNUC__)
 
-static bool CPLDetectRuntimeAVX()
-{
-    int cpuinfo[4] = {0, 0, 0, 0};
-    CPL_CPUID(1, cpuinfo);
-
-    // Check OSXSAVE feature.
-    if ((cpuinfo[REG_ECX] & (1 << CPUID_OSXSAVE_ECX_BIT)) == 0)
-    {
-        return false;
-    }
-
-    // Check AVX feature.
-    if ((cpuinfo[REG_ECX] & (1 << CPUID_AVX_ECX_BIT)) == 0)
-    {
-        return false;
-    }
-
-    // Issue XGETBV and check the XMM and YMM state bit.
-    unsigned int nXCRLow;
-    unsigned int nXCRHigh;
-    __asm__("xgetbv" : "=a"(nXCRLow), "=d"(nXCRHigh) : "c"(0));
-    if ((nXCRLow & (BIT_XMM_STATE | BIT_YMM_STATE)) !=
-        (BIT_XMM_STATE | BIT_YMM_STATE))
-    {
-        return false;
-    }
-    CPL_IGNORE_RET_VAL(nXCRHigh);  // unused
-
-    return true;
-}
-
 bool bCPLHasAVX = false;
 static void CPLHaveRuntimeAVXInitialize() __attribute__((constructor));
 
 static void CPLHaveRuntimeAVXInitialize()
 {
-    bCPLHasAVX = CPLDetectRuntimeAVX();
+    bCPLHasAVX = CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_AVX);
 }
 
-#elif defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 160040219) &&                \
-    (defined(_M_IX86) || defined(_M_X64))
-// _xgetbv available only in Visual Studio 2010 SP1 or later
+#else
 
 bool CPLHaveRuntimeAVX()
 {
-    int cpuinfo[4] = {0, 0, 0, 0};
-    CPL_CPUID(1, cpuinfo);
+    return CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_AVX);
+}
 
-    // Check OSXSAVE feature.
-    if ((cpuinfo[REG_ECX] & (1 << CPUID_OSXSAVE_ECX_BIT)) == 0)
-    {
-        return false;
-    }
+#endif
 
-    // Check AVX feature.
-    if ((cpuinfo[REG_ECX] & (1 << CPUID_AVX_ECX_BIT)) == 0)
-    {
-        return false;
-    }
+#endif  // defined(HAVE_AVX_AT_COMPILE_TIME) && !defined(CPLHaveRuntimeAVX)
 
-    // Issue XGETBV and check the XMM and YMM state bit.
-    unsigned __int64 xcrFeatureMask = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
-    if ((xcrFeatureMask & (BIT_XMM_STATE | BIT_YMM_STATE)) !=
-        (BIT_XMM_STATE | BIT_YMM_STATE))
-    {
-        return false;
-    }
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
 
-    return true;
-}
+/************************************************************************/
+/*                         CPLHaveRuntimeAVX2()                         */
+/************************************************************************/
 
-#else
+#if defined(__GNUC__) && !defined(DEBUG)
+bool bCPLHasAVX2 = false;
+static void CPLHaveRuntimeAVX2Initialize() __attribute__((constructor));
 
-bool CPLHaveRuntimeAVX()
+static void CPLHaveRuntimeAVX2Initialize()
 {
-    return false;
+    bCPLHasAVX2 = CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_AVX2);
+}
+#else
+bool CPLHaveRuntimeAVX2()
+{
+#ifdef DEBUG
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX2", "YES")))
+        return false;
+#endif
+    return CPLHaveRuntimeCPUFeatures(CPL_CPU_FEATURE_AVX2);
 }
-
 #endif
 
-#endif  // defined(HAVE_AVX_AT_COMPILE_TIME) && !defined(CPLHaveRuntimeAVX)
+#endif  // defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
 
 //! @endcond
@@ -32,6 +32,93 @@
 #include "cpl_port.h"
 #include "cpl_string.h"
 
+#include <cstddef>
+
+/** \file cpl_cpu_features.h
+ *
+ * Runtime detection of the SIMD instruction sets of the CPU, and helper to
+ * select the best implementation of a function among several ones compiled
+ * with different instruction sets.
+ */
+
+/** \anchor CPL_CPU_FEATURE_xxx
+ * Flags returned by CPLGetRuntimeCPUFeatures() */
+#define CPL_CPU_FEATURE_SSE (1 << 0)
+/** SSE2 */
+#define CPL_CPU_FEATURE_SSE2 (1 << 1)
+/** SSE3 */
+#define CPL_CPU_FEATURE_SSE3 (1 << 2)
+/** SSSE3 */
+#define CPL_CPU_FEATURE_SSSE3 (1 << 3)
+/** SSE4.1 */
+#define CPL_CPU_FEATURE_SSE41 (1 << 4)
+/** SSE4.2 */
+#define CPL_CPU_FEATURE_SSE42 (1 << 5)
+/** AVX, with OS support for YMM registers */
+#define CPL_CPU_FEATURE_AVX (1 << 6)
+/** FMA3 */
+#define CPL_CPU_FEATURE_FMA (1 << 7)
+/** AVX2 */
+#define CPL_CPU_FEATURE_AVX2 (1 << 8)
+/** AVX-512 Foundation, with OS support for ZMM registers */
+#define CPL_CPU_FEATURE_AVX512F (1 << 9)
+/** AVX-512 Byte and Word instructions */
+#define CPL_CPU_FEATURE_AVX512BW (1 << 10)
+/** AVX-512 Vector Length extensions */
+#define CPL_CPU_FEATURE_AVX512VL (1 << 11)
+/** ARM Advanced SIMD */
+#define CPL_CPU_FEATURE_NEON (1 << 12)
+
+int CPL_DLL CPLGetRuntimeCPUFeatures();
+
+/** Return whether all the CPL_CPU_FEATURE_xxx flags of nFeatures are
+ * available at runtime.
+ * @since GDAL 3.10
+ */
+static inline bool CPLHaveRuntimeCPUFeatures(int nFeatures)
+{
+    return (CPLGetRuntimeCPUFeatures() & nFeatures) == nFeatures;
+}
+
+/** Candidate implementation of a function, for CPLCPUDispatch() */
+template <class Fn> struct CPLCPUDispatchEntry
+{
+    /** Combination of CPL_CPU_FEATURE_xxx flags required by pfn */
+    int nRequiredFeatures;
+    /** Implementation (may be nullptr if not compiled in) */
+    Fn pfn;
+};
+
+/** Return the first implementation of asEntries whose required CPU features
+ * are available, or pfnDefault.
+ *
+ * Entries should be sorted from the most to the least demanding one.
+ * The intended use is to resolve a function pointer once, typically in
+ * the initializer of a static variable:
+ * \code{.cpp}
+ * static const auto pfnKernel = CPLCPUDispatch<KernelFn>(
+ *     {{CPL_CPU_FEATURE_AVX2, KernelAVX2}, {CPL_CPU_FEATURE_SSSE3,
+ *     KernelSSSE3}}, KernelGeneric);
+ * \endcode
+ *
+ * @since GDAL 3.10
+ */
+template <class Fn, size_t N>
+Fn CPLCPUDispatch(const CPLCPUDispatchEntry<Fn> (&asEntries)[N],
+                  Fn pfnDefault)
+{
+    const int nFeatures = CPLGetRuntimeCPUFeatures();
+    for (const auto &sEntry : asEntries)
+    {
+        if (sEntry.pfn &&
+            (nFeatures & sEntry.nRequiredFeatures) == sEntry.nRequiredFeatures)
+        {
+            return sEntry.pfn;
+        }
+    }
+    return pfnDefault;
+}
+
 //! @cond Doxygen_Suppress
 
 #ifdef HAVE_SSE_AT_COMPILE_TIME
@@ -93,6 +180,30 @@ bool CPLHaveRuntimeAVX();
 #endif
 #endif
 
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+#if __AVX2__
+#define HAVE_INLINE_AVX2
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+#ifdef DEBUG
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX2", "YES")))
+        return false;
+#endif
+    return true;
+}
+#elif defined(__GNUC__) && !defined(DEBUG)
+extern bool bCPLHasAVX2;
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+    return bCPLHasAVX2;
+}
+#else
+bool CPLHaveRuntimeAVX2();
+#endif
+#endif
+
 //! @endcond
 
 #endif  // CPL_CPU_FEATURES_H
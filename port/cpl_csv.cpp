@@ -43,6 +43,7 @@
 #include "gdal_csv.h"
 
 #include <algorithm>
+#include <string>
 
 /* ==================================================================== */
 /*      The CSVTable is a persistent set of info about an open CSV      */
@@ -284,20 +285,32 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
     if (pszString == nullptr)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
 
-    char *pszToken = static_cast<char *>(CPLCalloc(10, 1));
-    int nTokenMax = 10;
+    std::string osToken;
     const size_t nDelimiterLength = strlen(pszDelimiter);
+    // Characters that may end a run of ordinary characters outside of a
+    // quoted string.
+    const char szStopChars[] = {pszDelimiter[0], '"', '\0'};
 
     const char *pszIter = pszString;
     while (*pszIter != '\0')
     {
         bool bInString = false;
 
-        int nTokenLen = 0;
+        osToken.clear();
 
         // Try to find the next delimiter, marking end of token.
-        do
+        while (true)
         {
+            // Copy runs of ordinary characters at once. strcspn() and
+            // strchr() are vectorized by common C libraries.
+            const size_t nRunLength = bInString
+                                          ? strcspn(pszIter, "\"")
+                                          : strcspn(pszIter, szStopChars);
+            osToken.append(pszIter, nRunLength);
+            pszIter += nRunLength;
+            if (*pszIter == '\0')
+                break;
+
             // End if this is a delimiter skip it and break.
             if (!bInString &&
                 strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
@@ -314,7 +327,7 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
 
             if (*pszIter == '"')
             {
-                if (!bInString && nTokenLen > 0)
+                if (!bInString && !osToken.empty())
                 {
                     // do not treat in a special way double quotes that appear
                     // in the middle of a field (similarly to OpenOffice)
@@ -324,7 +337,10 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
                 {
                     bInString = !bInString;
                     if (!bKeepLeadingAndClosingQuotes)
+                    {
+                        ++pszIter;
                         continue;
+                    }
                 }
                 else  // Doubled quotes in string resolve to one quote.
                 {
@@ -332,18 +348,11 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
                 }
             }
 
-            if (nTokenLen >= nTokenMax - 2)
-            {
-                nTokenMax = nTokenMax * 2 + 10;
-                pszToken = static_cast<char *>(CPLRealloc(pszToken, nTokenMax));
-            }
-
-            pszToken[nTokenLen] = *pszIter;
-            nTokenLen++;
-        } while (*(++pszIter) != '\0');
+            osToken += *pszIter;
+            ++pszIter;
+        }
 
-        pszToken[nTokenLen] = '\0';
-        aosRetList.AddString(pszToken);
+        aosRetList.AddString(osToken.c_str());
 
         // If the last token is an empty token, then we have to catch
         // it now, otherwise we won't reenter the loop and it will be lost.
@@ -356,8 +365,6 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
         }
     }
 
-    CPLFree(pszToken);
-
     if (aosRetList.Count() == 0)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
     else
@@ -674,11 +681,9 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
 
         while (true)
         {
-            for (; i < osWorkLine.size(); i++)
-            {
-                if (osWorkLine[i] == '\"')
-                    nCount++;
-            }
+            nCount += static_cast<int>(
+                std::count(osWorkLine.begin() + i, osWorkLine.end(), '\"'));
+            i = osWorkLine.size();
 
             if (nCount % 2 == 0)
                 break;
@@ -704,6 +709,39 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
     }
 }
 
+/************************************************************************/
+/*                           CSVSplitRecord()                           */
+/************************************************************************/
+
+/** Split an already read CSV record into fields.
+ *
+ * This is the tokenization step of CSVReadParseLine3L(). The record may span
+ * several lines, joined with '\n', when it contains quoted line breaks.
+ * The return result is a stringlist, in the sense of the CSL functions.
+ *
+ * @param pszRecord Record content, without its trailing line break.
+ * @param pszDelimiter Delimiter sequence (can be multiple bytes)
+ * @param bHonourStrings Should be true, unless double quotes should not be
+ *                       considered when separating fields.
+ * @param bKeepLeadingAndClosingQuotes Whether the leading and closing double
+ *                                     quote characters should be kept.
+ * @param bMergeDelimiter Whether consecutive delimiters should be considered
+ *                        as a single one. Should generally be set to false.
+ * @since GDAL 3.10
+ */
+char **CSVSplitRecord(const char *pszRecord, const char *pszDelimiter,
+                      bool bHonourStrings, bool bKeepLeadingAndClosingQuotes,
+                      bool bMergeDelimiter)
+{
+    // Special fix to read NdfcFacilities.xls with un-balanced double quotes.
+    if (!bHonourStrings)
+    {
+        return CSLTokenizeStringComplex(pszRecord, pszDelimiter, FALSE, TRUE);
+    }
+    return CSVSplitLine(pszRecord, pszDelimiter, bKeepLeadingAndClosingQuotes,
+                        bMergeDelimiter);
+}
+
 /************************************************************************/
 /*                          CSVReadParseLine()                          */
 /*                                                                      */
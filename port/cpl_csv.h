@@ -62,6 +62,11 @@ char CPL_DLL **CSVReadParseLine3L(VSILFILE *fp, size_t nMaxLineSize,
                                   bool bKeepLeadingAndClosingQuotes,
                                   bool bMergeDelimiter, bool bSkipBOM);
 
+char CPL_DLL **CSVSplitRecord(const char *pszRecord, const char *pszDelimiter,
+                              bool bHonourStrings,
+                              bool bKeepLeadingAndClosingQuotes,
+                              bool bMergeDelimiter);
+
 char CPL_DLL **CSVScanLines(FILE *, int, const char *, CSVCompareCriteria);
 char CPL_DLL **CSVScanLinesL(VSILFILE *, int, const char *, CSVCompareCriteria);
 char CPL_DLL **CSVScanFile(const char *, int, const char *, CSVCompareCriteria);
@@ -1910,6 +1910,52 @@ static int CPLHTTPCurlDebugFunction(CURL *handle, curl_infotype type,
     return 0;
 }
 
+/************************************************************************/
+/*                       CPLHTTPGetShareHandle()                        */
+/************************************************************************/
+
+// Per-thread connection caches mean that each thread pays the cost of DNS
+// resolution and of a full TLS handshake for each endpoint. Sharing the DNS
+// cache and the TLS session IDs through a process-wide share handle allows
+// new connections to resume TLS sessions, whatever the thread. Note that
+// libcurl does not support sharing the connection cache itself among
+// concurrent threads (CURL_LOCK_DATA_CONNECT), so connections, and HTTP/2
+// multiplexing over them, remain per-thread.
+
+static std::mutex gaoShareMutexes[CURL_LOCK_DATA_LAST];
+
+static void CPLHTTPShareLock(CURL * /* handle */, curl_lock_data data,
+                             curl_lock_access /* access */,
+                             void * /* userptr */)
+{
+    gaoShareMutexes[data].lock();
+}
+
+static void CPLHTTPShareUnlock(CURL * /* handle */, curl_lock_data data,
+                               void * /* userptr */)
+{
+    gaoShareMutexes[data].unlock();
+}
+
+static CURLSH *CPLHTTPGetShareHandle()
+{
+    // Never destroyed, as it may still be referenced by easy handles cached
+    // in thread-local storage.
+    static CURLSH *hShare = []()
+    {
+        CURLSH *h = curl_share_init();
+        if (h)
+        {
+            curl_share_setopt(h, CURLSHOPT_LOCKFUNC, CPLHTTPShareLock);
+            curl_share_setopt(h, CURLSHOPT_UNLOCKFUNC, CPLHTTPShareUnlock);
+            curl_share_setopt(h, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(h, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        }
+        return h;
+    }();
+    return hShare;
+}
+
 /************************************************************************/
 /*                         CPLHTTPSetOptions()                          */
 /************************************************************************/
@@ -1992,6 +2038,14 @@ void *CPLHTTPSetOptions(void *pcurl, const char *pszURL,
                  pszHttpVersion);
     }
 
+    if (CPLTestBool(
+            CPLGetConfigOption("GDAL_HTTP_SHARED_SESSION_CACHE", "YES")))
+    {
+        CURLSH *hShare = CPLHTTPGetShareHandle();
+        if (hShare)
+            unchecked_curl_easy_setopt(http_handle, CURLOPT_SHARE, hShare);
+    }
+
     // Default value is 1 since curl 7.50.2. But worth applying it on
     // previous versions as well.
     const char *pszTCPNoDelay =
@@ -27,6 +27,7 @@
 
 #include "cpl_json.h"
 
+#include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_json_header.h"
 #include "cpl_vsi.h"
@@ -67,6 +68,480 @@ static json_object *CPLJSON_json_object_new_uint64(uint64_t nVal)
 
 #endif
 
+//------------------------------------------------------------------------------
+// CPLJSONFastParser
+//------------------------------------------------------------------------------
+/*! @cond Doxygen_Suppress */
+namespace
+{
+
+/** Single pass recursive descent JSON parser building json-c objects.
+ *
+ * It is substantially faster than json_tokener on large documents, mostly
+ * because it avoids the per-character state machine and the intermediate
+ * printbuf copies, and scans string contents 8 bytes at a time.
+ *
+ * It only accepts strict JSON with an object or array at top level, and
+ * gives up (Parse() returns nullptr) on anything else, including valid
+ * but uncommon constructs (\u0000, very long integers, deep nesting).
+ * The caller must then retry with json_tokener, so that the accepted
+ * syntax, error messages and resulting objects are unchanged.
+ */
+class CPLJSONFastParser
+{
+  public:
+    CPLJSONFastParser(const char *pszData, size_t nLength)
+        : m_pszCur(pszData), m_pszEnd(pszData + nLength)
+    {
+    }
+
+    json_object *Parse();
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(CPLJSONFastParser)
+
+    // json_tokener fails at depth JSON_TOKENER_DEFAULT_DEPTH - 1 (=31).
+    // Stay below so that the tokener reports the error.
+    static constexpr int MAX_DEPTH = 30;
+
+    const char *m_pszCur;
+    const char *const m_pszEnd;
+    std::string m_osScratch{};
+
+    void SkipWhiteSpace()
+    {
+        while (m_pszCur < m_pszEnd && (*m_pszCur == ' ' || *m_pszCur == '\n' ||
+                                       *m_pszCur == '\r' || *m_pszCur == '\t'))
+            ++m_pszCur;
+    }
+
+    bool ParseValue(int nDepth, json_object *&poOut);
+    bool ParseObject(int nDepth, json_object *&poOut);
+    bool ParseArray(int nDepth, json_object *&poOut);
+    bool ParseString(const char *&pszStr, size_t &nStrLen);
+    bool ParseNumber(json_object *&poOut);
+    bool ParseHex4(unsigned &nVal);
+};
+
+/************************************************************************/
+/*                        CPLJSONFastParser::Parse()                    */
+/************************************************************************/
+
+json_object *CPLJSONFastParser::Parse()
+{
+    SkipWhiteSpace();
+    if (m_pszCur == m_pszEnd || (*m_pszCur != '{' && *m_pszCur != '['))
+        return nullptr;
+    json_object *poRet = nullptr;
+    if (!ParseValue(0, poRet))
+        return nullptr;
+    SkipWhiteSpace();
+    if (m_pszCur != m_pszEnd)
+    {
+        json_object_put(poRet);
+        return nullptr;
+    }
+    return poRet;
+}
+
+/************************************************************************/
+/*                     CPLJSONFastParser::ParseValue()                  */
+/************************************************************************/
+
+bool CPLJSONFastParser::ParseValue(int nDepth, json_object *&poOut)
+{
+    poOut = nullptr;
+    if (m_pszCur == m_pszEnd)
+        return false;
+    const auto MatchLiteral = [this](const char *pszLiteral, size_t nLen)
+    {
+        if (static_cast<size_t>(m_pszEnd - m_pszCur) < nLen ||
+            memcmp(m_pszCur, pszLiteral, nLen) != 0)
+            return false;
+        m_pszCur += nLen;
+        return true;
+    };
+    switch (*m_pszCur)
+    {
+        case '{':
+            return ParseObject(nDepth + 1, poOut);
+        case '[':
+            return ParseArray(nDepth + 1, poOut);
+        case '"':
+        {
+            const char *pszStr = nullptr;
+            size_t nStrLen = 0;
+            if (!ParseString(pszStr, nStrLen))
+                return false;
+            poOut = json_object_new_string_len(pszStr,
+                                               static_cast<int>(nStrLen));
+            return true;
+        }
+        case 't':
+            if (!MatchLiteral("true", 4))
+                return false;
+            poOut = json_object_new_boolean(true);
+            return true;
+        case 'f':
+            if (!MatchLiteral("false", 5))
+                return false;
+            poOut = json_object_new_boolean(false);
+            return true;
+        case 'n':
+            // null is represented by a nullptr json_object
+            return MatchLiteral("null", 4);
+        default:
+            return ParseNumber(poOut);
+    }
+}
+
+/************************************************************************/
+/*                    CPLJSONFastParser::ParseObject()                  */
+/************************************************************************/
+
+bool CPLJSONFastParser::ParseObject(int nDepth, json_object *&poOut)
+{
+    if (nDepth > MAX_DEPTH)
+        return false;
+    ++m_pszCur;  // skip '{'
+    poOut = json_object_new_object();
+    SkipWhiteSpace();
+    if (m_pszCur < m_pszEnd && *m_pszCur == '}')
+    {
+        ++m_pszCur;
+        return true;
+    }
+    while (true)
+    {
+        if (m_pszCur == m_pszEnd || *m_pszCur != '"')
+            break;
+        const char *pszKey = nullptr;
+        size_t nKeyLen = 0;
+        if (!ParseString(pszKey, nKeyLen))
+            break;
+        // pszKey may point to m_osScratch, which the value parsing reuses
+        const std::string osKey(pszKey, nKeyLen);
+        SkipWhiteSpace();
+        if (m_pszCur == m_pszEnd || *m_pszCur != ':')
+            break;
+        ++m_pszCur;
+        SkipWhiteSpace();
+        json_object *poVal = nullptr;
+        if (!ParseValue(nDepth, poVal))
+            break;
+        json_object_object_add(poOut, osKey.c_str(), poVal);
+        SkipWhiteSpace();
+        if (m_pszCur == m_pszEnd)
+            break;
+        if (*m_pszCur == '}')
+        {
+            ++m_pszCur;
+            return true;
+        }
+        if (*m_pszCur != ',')
+            break;
+        ++m_pszCur;
+        SkipWhiteSpace();
+    }
+    json_object_put(poOut);
+    poOut = nullptr;
+    return false;
+}
+
+/************************************************************************/
+/*                     CPLJSONFastParser::ParseArray()                  */
+/************************************************************************/
+
+bool CPLJSONFastParser::ParseArray(int nDepth, json_object *&poOut)
+{
+    if (nDepth > MAX_DEPTH)
+        return false;
+    ++m_pszCur;  // skip '['
+    poOut = json_object_new_array();
+    SkipWhiteSpace();
+    if (m_pszCur < m_pszEnd && *m_pszCur == ']')
+    {
+        ++m_pszCur;
+        return true;
+    }
+    while (true)
+    {
+        json_object *poVal = nullptr;
+        if (!ParseValue(nDepth, poVal))
+            break;
+        json_object_array_add(poOut, poVal);
+        SkipWhiteSpace();
+        if (m_pszCur == m_pszEnd)
+            break;
+        if (*m_pszCur == ']')
+        {
+            ++m_pszCur;
+            return true;
+        }
+        if (*m_pszCur != ',')
+            break;
+        ++m_pszCur;
+        SkipWhiteSpace();
+    }
+    json_object_put(poOut);
+    poOut = nullptr;
+    return false;
+}
+
+/************************************************************************/
+/*                     CPLJSONFastParser::ParseHex4()                   */
+/************************************************************************/
+
+bool CPLJSONFastParser::ParseHex4(unsigned &nVal)
+{
+    if (m_pszEnd - m_pszCur < 4)
+        return false;
+    nVal = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const char ch = *m_pszCur++;
+        nVal <<= 4;
+        if (ch >= '0' && ch <= '9')
+            nVal |= static_cast<unsigned>(ch - '0');
+        else if (ch >= 'a' && ch <= 'f')
+            nVal |= static_cast<unsigned>(ch - 'a' + 10);
+        else if (ch >= 'A' && ch <= 'F')
+            nVal |= static_cast<unsigned>(ch - 'A' + 10);
+        else
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    CPLJSONFastParser::ParseString()                  */
+/************************************************************************/
+
+/** Parses the string starting at m_pszCur (on the opening double quote).
+ * On success, pszStr/nStrLen point either directly in the input buffer
+ * (no escape sequence) or to m_osScratch.
+ */
+bool CPLJSONFastParser::ParseString(const char *&pszStr, size_t &nStrLen)
+{
+    ++m_pszCur;  // skip '"'
+    const char *pszStart = m_pszCur;
+
+    // Fast path: look for the first double quote, backslash or control
+    // character, 8 bytes at a time.
+    constexpr uint64_t ONES = ~static_cast<uint64_t>(0) / 255;
+    constexpr uint64_t HIGH_BITS = ONES * 0x80;
+    while (m_pszEnd - m_pszCur >= 8)
+    {
+        uint64_t nWord;
+        memcpy(&nWord, m_pszCur, sizeof(nWord));
+        const uint64_t nQuote = nWord ^ (ONES * '"');
+        const uint64_t nBackslash = nWord ^ (ONES * '\\');
+        const uint64_t nMask = ((nQuote - ONES) & ~nQuote) |
+                               ((nBackslash - ONES) & ~nBackslash) |
+                               ((nWord - ONES * 0x20) & ~nWord);
+        if ((nMask & HIGH_BITS) != 0)
+            break;
+        m_pszCur += 8;
+    }
+    while (m_pszCur < m_pszEnd)
+    {
+        const unsigned char ch = static_cast<unsigned char>(*m_pszCur);
+        if (ch == '"')
+        {
+            pszStr = pszStart;
+            nStrLen = static_cast<size_t>(m_pszCur - pszStart);
+            ++m_pszCur;
+            return true;
+        }
+        if (ch == '\\')
+            break;
+        if (ch < 0x20)
+            return false;
+        ++m_pszCur;
+    }
+    if (m_pszCur == m_pszEnd)
+        return false;
+
+    // Slow path: unescape into m_osScratch
+    m_osScratch.assign(pszStart, static_cast<size_t>(m_pszCur - pszStart));
+    while (m_pszCur < m_pszEnd)
+    {
+        const unsigned char ch = static_cast<unsigned char>(*m_pszCur);
+        if (ch == '"')
+        {
+            ++m_pszCur;
+            pszStr = m_osScratch.data();
+            nStrLen = m_osScratch.size();
+            return true;
+        }
+        if (ch < 0x20)
+            return false;
+        ++m_pszCur;
+        if (ch != '\\')
+        {
+            m_osScratch += static_cast<char>(ch);
+            continue;
+        }
+        if (m_pszCur == m_pszEnd)
+            return false;
+        const char chEscaped = *m_pszCur++;
+        switch (chEscaped)
+        {
+            case '"':
+            case '\\':
+            case '/':
+                m_osScratch += chEscaped;
+                break;
+            case 'b':
+                m_osScratch += '\b';
+                break;
+            case 'f':
+                m_osScratch += '\f';
+                break;
+            case 'n':
+                m_osScratch += '\n';
+                break;
+            case 'r':
+                m_osScratch += '\r';
+                break;
+            case 't':
+                m_osScratch += '\t';
+                break;
+            case 'u':
+            {
+                unsigned nCodePoint = 0;
+                if (!ParseHex4(nCodePoint) || nCodePoint == 0 ||
+                    (nCodePoint >= 0xDC00 && nCodePoint <= 0xDFFF))
+                    return false;
+                if (nCodePoint >= 0xD800 && nCodePoint <= 0xDBFF)
+                {
+                    // High surrogate: must be followed by a low surrogate.
+                    // Lone surrogates are left to json_tokener.
+                    unsigned nLow = 0;
+                    if (m_pszEnd - m_pszCur < 2 || m_pszCur[0] != '\\' ||
+                        m_pszCur[1] != 'u')
+                        return false;
+                    m_pszCur += 2;
+                    if (!ParseHex4(nLow) || nLow < 0xDC00 || nLow > 0xDFFF)
+                        return false;
+                    nCodePoint =
+                        0x10000 + ((nCodePoint - 0xD800) << 10) +
+                        (nLow - 0xDC00);
+                }
+                if (nCodePoint < 0x80)
+                {
+                    m_osScratch += static_cast<char>(nCodePoint);
+                }
+                else if (nCodePoint < 0x800)
+                {
+                    m_osScratch += static_cast<char>(0xC0 | (nCodePoint >> 6));
+                    m_osScratch +=
+                        static_cast<char>(0x80 | (nCodePoint & 0x3F));
+                }
+                else if (nCodePoint < 0x10000)
+                {
+                    m_osScratch +=
+                        static_cast<char>(0xE0 | (nCodePoint >> 12));
+                    m_osScratch +=
+                        static_cast<char>(0x80 | ((nCodePoint >> 6) & 0x3F));
+                    m_osScratch +=
+                        static_cast<char>(0x80 | (nCodePoint & 0x3F));
+                }
+                else
+                {
+                    m_osScratch +=
+                        static_cast<char>(0xF0 | (nCodePoint >> 18));
+                    m_osScratch +=
+                        static_cast<char>(0x80 | ((nCodePoint >> 12) & 0x3F));
+                    m_osScratch +=
+                        static_cast<char>(0x80 | ((nCodePoint >> 6) & 0x3F));
+                    m_osScratch +=
+                        static_cast<char>(0x80 | (nCodePoint & 0x3F));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                    CPLJSONFastParser::ParseNumber()                  */
+/************************************************************************/
+
+bool CPLJSONFastParser::ParseNumber(json_object *&poOut)
+{
+    const char *pszStart = m_pszCur;
+    const bool bNegative = *m_pszCur == '-';
+    if (bNegative)
+        ++m_pszCur;
+    const char *pszDigits = m_pszCur;
+    int64_t nVal = 0;
+    while (m_pszCur < m_pszEnd && *m_pszCur >= '0' && *m_pszCur <= '9')
+    {
+        nVal = nVal * 10 + (*m_pszCur - '0');
+        ++m_pszCur;
+        // Longer integers are left to json_tokener, that handles overflows
+        // and unsigned 64-bit values.
+        if (m_pszCur - pszDigits > 18)
+            return false;
+    }
+    const size_t nDigits = static_cast<size_t>(m_pszCur - pszDigits);
+    if (nDigits == 0 || (nDigits > 1 && *pszDigits == '0'))
+        return false;
+
+    bool bIsDouble = false;
+    if (m_pszCur < m_pszEnd && *m_pszCur == '.')
+    {
+        bIsDouble = true;
+        ++m_pszCur;
+        const char *pszFracStart = m_pszCur;
+        while (m_pszCur < m_pszEnd && *m_pszCur >= '0' && *m_pszCur <= '9')
+            ++m_pszCur;
+        if (m_pszCur == pszFracStart)
+            return false;
+    }
+    if (m_pszCur < m_pszEnd && (*m_pszCur == 'e' || *m_pszCur == 'E'))
+    {
+        bIsDouble = true;
+        ++m_pszCur;
+        if (m_pszCur < m_pszEnd && (*m_pszCur == '+' || *m_pszCur == '-'))
+            ++m_pszCur;
+        const char *pszExpStart = m_pszCur;
+        while (m_pszCur < m_pszEnd && *m_pszCur >= '0' && *m_pszCur <= '9')
+            ++m_pszCur;
+        if (m_pszCur == pszExpStart)
+            return false;
+    }
+
+    if (!bIsDouble)
+    {
+        poOut = json_object_new_int64(bNegative ? -nVal : nVal);
+        return true;
+    }
+
+    // Doubles keep their original representation for serialization, as
+    // json_tokener does.
+    char szBuffer[64];
+    const size_t nLen = static_cast<size_t>(m_pszCur - pszStart);
+    if (nLen >= sizeof(szBuffer))
+        return false;
+    memcpy(szBuffer, pszStart, nLen);
+    szBuffer[nLen] = 0;
+    char *pszNumEnd = nullptr;
+    const double dfVal = CPLStrtod(szBuffer, &pszNumEnd);
+    if (pszNumEnd != szBuffer + nLen)
+        return false;
+    poOut = json_object_new_double_s(dfVal, szBuffer);
+    return true;
+}
+
+}  // namespace
+
+/*! @endcond */
+
 //------------------------------------------------------------------------------
 // JSONDocument
 //------------------------------------------------------------------------------
@@ -263,6 +738,15 @@ bool CPLJSONDocument::LoadMemory(const GByte *pabyData, int nLength)
         return true;
     }
 
+    if (CPLTestBool(CPLGetConfigOption("CPL_JSON_FAST_PARSER", "YES")))
+    {
+        CPLJSONFastParser oParser(reinterpret_cast<const char *>(pabyData),
+                                  static_cast<size_t>(nLength));
+        m_poRootJsonObject = oParser.Parse();
+        if (m_poRootJsonObject)
+            return true;
+    }
+
     json_tokener *jstok = json_tokener_new();
     m_poRootJsonObject = json_tokener_parse_ex(
         jstok, reinterpret_cast<const char *>(pabyData), nLength);
@@ -0,0 +1,312 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Packed, bulk-loaded, static R-tree
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+
+#include "cpl_packed_rtree.h"
+
+#include "cpl_error.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/*! @cond Doxygen_Suppress */
+
+/************************************************************************/
+/*                            HilbertIndex()                            */
+/************************************************************************/
+
+// Index along a Hilbert curve of (x, y), both in the [0, 65535] range.
+// Adapted from https://github.com/rawrunprotected/hilbert_curves (public
+// domain), also used by flatbush and FlatGeobuf.
+static uint32_t HilbertIndex(uint32_t x, uint32_t y)
+{
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+/************************************************************************/
+/*                           CPLPackedRTree()                           */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param nNodeSize Maximum number of children of a node (at least 2).
+ */
+CPLPackedRTree::CPLPackedRTree(int nNodeSize)
+    : m_nNodeSize(std::max(2, nNodeSize))
+{
+}
+
+/************************************************************************/
+/*                              Reserve()                               */
+/************************************************************************/
+
+/** Reserve memory for nItems items. */
+void CPLPackedRTree::Reserve(size_t nItems)
+{
+    m_adfMinX.reserve(nItems);
+    m_adfMinY.reserve(nItems);
+    m_adfMaxX.reserve(nItems);
+    m_adfMaxY.reserve(nItems);
+    m_anValues.reserve(nItems);
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+/** Add an item, with its bounding box and the value returned by Search().
+ *
+ * Must be called before Build().
+ */
+void CPLPackedRTree::Add(double dfMinX, double dfMinY, double dfMaxX,
+                         double dfMaxY, size_t nValue)
+{
+    CPLAssert(!m_bBuilt);
+    m_adfMinX.push_back(dfMinX);
+    m_adfMinY.push_back(dfMinY);
+    m_adfMaxX.push_back(dfMaxX);
+    m_adfMaxY.push_back(dfMaxY);
+    m_anValues.push_back(nValue);
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Sort the items and build the nodes of the tree. */
+void CPLPackedRTree::Build()
+{
+    CPLAssert(!m_bBuilt);
+    m_bBuilt = true;
+
+    const size_t nItems = m_anValues.size();
+    m_anLevelEnd.clear();
+    m_anLevelEnd.push_back(nItems);
+    if (nItems == 0)
+        return;
+
+    double dfMinX = m_adfMinX[0];
+    double dfMinY = m_adfMinY[0];
+    double dfMaxX = m_adfMaxX[0];
+    double dfMaxY = m_adfMaxY[0];
+    for (size_t i = 1; i < nItems; ++i)
+    {
+        dfMinX = std::min(dfMinX, m_adfMinX[i]);
+        dfMinY = std::min(dfMinY, m_adfMinY[i]);
+        dfMaxX = std::max(dfMaxX, m_adfMaxX[i]);
+        dfMaxY = std::max(dfMaxY, m_adfMaxY[i]);
+    }
+
+    // Sort items by the Hilbert index of their center.
+    if (nItems > static_cast<size_t>(m_nNodeSize))
+    {
+        constexpr double HILBERT_MAX = 65535.0;
+        const double dfWidth = dfMaxX - dfMinX;
+        const double dfHeight = dfMaxY - dfMinY;
+        const auto GetCoord = [HILBERT_MAX](double dfVal, double dfExtent)
+        {
+            const double dfRes =
+                dfExtent > 0 ? std::floor(HILBERT_MAX * dfVal / dfExtent) : 0;
+            // Also handles NaN
+            if (!(dfRes >= 0))
+                return 0U;
+            return static_cast<uint32_t>(std::min(dfRes, HILBERT_MAX));
+        };
+        std::vector<std::pair<uint32_t, size_t>> aoHilbertIdx(nItems);
+        for (size_t i = 0; i < nItems; ++i)
+        {
+            const double dfX =
+                (m_adfMinX[i] + m_adfMaxX[i]) / 2 - dfMinX;
+            const double dfY =
+                (m_adfMinY[i] + m_adfMaxY[i]) / 2 - dfMinY;
+            aoHilbertIdx[i].first =
+                HilbertIndex(GetCoord(dfX, dfWidth), GetCoord(dfY, dfHeight));
+            aoHilbertIdx[i].second = i;
+        }
+        std::sort(aoHilbertIdx.begin(), aoHilbertIdx.end());
+
+        const auto Reorder = [&aoHilbertIdx, nItems](auto &aVals)
+        {
+            typename std::remove_reference<decltype(aVals)>::type aNewVals(
+                nItems);
+            for (size_t i = 0; i < nItems; ++i)
+                aNewVals[i] = aVals[aoHilbertIdx[i].second];
+            aVals = std::move(aNewVals);
+        };
+        Reorder(m_adfMinX);
+        Reorder(m_adfMinY);
+        Reorder(m_adfMaxX);
+        Reorder(m_adfMaxY);
+        Reorder(m_anValues);
+    }
+
+    // Compute the number of nodes of each level, up to the root.
+    size_t nLevelCount = nItems;
+    size_t nTotal = nItems;
+    do
+    {
+        nLevelCount = (nLevelCount + m_nNodeSize - 1) / m_nNodeSize;
+        nTotal += nLevelCount;
+        m_anLevelEnd.push_back(nTotal);
+    } while (nLevelCount > 1);
+
+    m_adfMinX.resize(nTotal);
+    m_adfMinY.resize(nTotal);
+    m_adfMaxX.resize(nTotal);
+    m_adfMaxY.resize(nTotal);
+
+    // Compute the bounds of nodes from the ones of their children.
+    for (size_t iLevel = 1; iLevel < m_anLevelEnd.size(); ++iLevel)
+    {
+        const size_t nChildStart = iLevel >= 2 ? m_anLevelEnd[iLevel - 2] : 0;
+        const size_t nChildEnd = m_anLevelEnd[iLevel - 1];
+        size_t iPos = nChildEnd;
+        for (size_t iChild = nChildStart; iChild < nChildEnd;
+             iChild += m_nNodeSize, ++iPos)
+        {
+            const size_t iChildLast =
+                std::min(iChild + m_nNodeSize, nChildEnd);
+            double dfNodeMinX = m_adfMinX[iChild];
+            double dfNodeMinY = m_adfMinY[iChild];
+            double dfNodeMaxX = m_adfMaxX[iChild];
+            double dfNodeMaxY = m_adfMaxY[iChild];
+            for (size_t i = iChild + 1; i < iChildLast; ++i)
+            {
+                dfNodeMinX = std::min(dfNodeMinX, m_adfMinX[i]);
+                dfNodeMinY = std::min(dfNodeMinY, m_adfMinY[i]);
+                dfNodeMaxX = std::max(dfNodeMaxX, m_adfMaxX[i]);
+                dfNodeMaxY = std::max(dfNodeMaxY, m_adfMaxY[i]);
+            }
+            m_adfMinX[iPos] = dfNodeMinX;
+            m_adfMinY[iPos] = dfNodeMinY;
+            m_adfMaxX[iPos] = dfNodeMaxX;
+            m_adfMaxY[iPos] = dfNodeMaxY;
+        }
+    }
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Append to anValues the values of the items whose bounding box
+ * intersects the search window (boundaries included).
+ *
+ * Items are returned in no particular order. Can be called concurrently.
+ */
+void CPLPackedRTree::Search(double dfMinX, double dfMinY, double dfMaxX,
+                            double dfMaxY, std::vector<size_t> &anValues) const
+{
+    CPLAssert(m_bBuilt);
+    if (!m_bBuilt || m_anValues.empty())
+        return;
+
+    // Pairs of (node position, level)
+    std::vector<std::pair<size_t, size_t>> aoStack;
+    aoStack.emplace_back(m_anLevelEnd.back() - 1, m_anLevelEnd.size() - 1);
+    while (!aoStack.empty())
+    {
+        const auto [nPos, nLevel] = aoStack.back();
+        aoStack.pop_back();
+
+        const size_t nLevelStart = m_anLevelEnd[nLevel - 1];
+        const size_t nChildLevelStart =
+            nLevel >= 2 ? m_anLevelEnd[nLevel - 2] : 0;
+        const size_t nChildStart =
+            nChildLevelStart + (nPos - nLevelStart) * m_nNodeSize;
+        const size_t nChildEnd =
+            std::min(nChildStart + m_nNodeSize, nLevelStart);
+        for (size_t i = nChildStart; i < nChildEnd; ++i)
+        {
+            if (m_adfMaxX[i] < dfMinX || m_adfMaxY[i] < dfMinY ||
+                m_adfMinX[i] > dfMaxX || m_adfMinY[i] > dfMaxY)
+            {
+                continue;
+            }
+            if (nLevel == 1)
+                anValues.push_back(m_anValues[i]);
+            else
+                aoStack.emplace_back(i, nLevel - 1);
+        }
+    }
+}
+
+/*! @endcond */
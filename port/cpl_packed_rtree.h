@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Packed, bulk-loaded, static R-tree
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+
+#ifndef CPL_PACKED_RTREE_H_INCLUDED
+#define CPL_PACKED_RTREE_H_INCLUDED
+
+/*! @cond Doxygen_Suppress */
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include "cpl_port.h"
+
+#include <cstddef>
+#include <vector>
+
+/** Static R-tree, bulk-loaded with items sorted along a Hilbert curve.
+ *
+ * Contrary to CPLQuadTree, nodes are not allocated individually: the bounds
+ * of all nodes are stored level by level, in separate contiguous arrays of
+ * minimum and maximum X and Y, so that the children of a node are scanned
+ * linearly. This is much faster to build and to query for large numbers of
+ * items.
+ *
+ * Usage is to Add() all items, call Build(), and then Search(). Once built,
+ * the tree cannot be modified, and Search() can be called concurrently
+ * from several threads.
+ */
+class CPL_DLL CPLPackedRTree
+{
+  public:
+    explicit CPLPackedRTree(int nNodeSize = 16);
+
+    void Reserve(size_t nItems);
+    void Add(double dfMinX, double dfMinY, double dfMaxX, double dfMaxY,
+             size_t nValue);
+    void Build();
+
+    /** Return the number of items. */
+    size_t size() const
+    {
+        return m_anValues.size();
+    }
+
+    void Search(double dfMinX, double dfMinY, double dfMaxX, double dfMaxY,
+                std::vector<size_t> &anValues) const;
+
+  private:
+    int m_nNodeSize;
+    bool m_bBuilt = false;
+    // Bounds of items (first size() elements), and then of the nodes of
+    // each level, from the bottom up.
+    std::vector<double> m_adfMinX{};
+    std::vector<double> m_adfMinY{};
+    std::vector<double> m_adfMaxX{};
+    std::vector<double> m_adfMaxY{};
+    std::vector<size_t> m_anValues{};
+    // End (exclusive) of each level in the above arrays.
+    std::vector<size_t> m_anLevelEnd{};
+};
+
+#endif /* defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS) */
+
+/*! @endcond */
+
+#endif /* CPL_PACKED_RTREE_H_INCLUDED */
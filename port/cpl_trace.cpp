@@ -0,0 +1,238 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Timed spans emitted in the Chrome trace event format
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_trace.h"
+
+#include "cpl_conv.h"
+#include "cpl_json_streaming_writer.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <cstdlib>
+#include <mutex>
+
+/*! @cond Doxygen_Suppress */
+
+int CPLTraceSpan::gnEnabled = -1;  // unknown state
+
+namespace
+{
+struct CPLTraceState
+{
+    std::mutex oMutex{};
+    // Plain stdio file, so that it can still be closed from atexit()
+    FILE *fp = nullptr;
+    bool bFirstEvent = true;
+    std::chrono::steady_clock::time_point oEpoch{};
+    // Empty means all categories
+    CPLStringList aosCategories{};
+};
+
+CPLTraceState &GetState()
+{
+    static CPLTraceState sState;
+    return sState;
+}
+
+// Must be called with the mutex held
+void CloseTraceFile(CPLTraceState &sState)
+{
+    if (sState.fp)
+    {
+        VSIFWrite("\n]\n", 1, 3, sState.fp);
+        VSIFClose(sState.fp);
+        sState.fp = nullptr;
+    }
+}
+
+void CloseTraceFileAtExit()
+{
+    auto &sState = GetState();
+    std::lock_guard<std::mutex> oLock(sState.oMutex);
+    CloseTraceFile(sState);
+}
+}  // namespace
+
+/************************************************************************/
+/*                            ReadEnabled()                             */
+/************************************************************************/
+
+void CPLTraceSpan::ReadEnabled()
+{
+    auto &sState = GetState();
+    std::lock_guard<std::mutex> oLock(sState.oMutex);
+    if (gnEnabled >= 0)
+        return;
+
+    const char *pszFilename = CPLGetConfigOption("CPL_TRACE_FILE", nullptr);
+    if (pszFilename && pszFilename[0] != '\0')
+    {
+        sState.fp = VSIFOpen(pszFilename, "wb");
+        if (!sState.fp)
+        {
+            CPLError(CE_Warning, CPLE_FileIO,
+                     "Cannot create trace file %s. Tracing disabled",
+                     pszFilename);
+        }
+        else
+        {
+            VSIFWrite("[\n", 1, 2, sState.fp);
+            sState.bFirstEvent = true;
+            sState.oEpoch = std::chrono::steady_clock::now();
+            sState.aosCategories = CSLTokenizeString2(
+                CPLGetConfigOption("CPL_TRACE_CATEGORIES", ""), ",", 0);
+            static bool bRegistered = false;
+            if (!bRegistered)
+            {
+                bRegistered = true;
+                atexit(CloseTraceFileAtExit);
+            }
+        }
+    }
+    gnEnabled = sState.fp ? TRUE : FALSE;
+}
+
+/************************************************************************/
+/*                               Reset()                                */
+/************************************************************************/
+
+/** Closes the current trace file, if any, and causes the CPL_TRACE_FILE
+ * configuration option to be read again on the next span. */
+void CPLTraceSpan::Reset()
+{
+    auto &sState = GetState();
+    std::lock_guard<std::mutex> oLock(sState.oMutex);
+    CloseTraceFile(sState);
+    gnEnabled = -1;
+}
+
+/************************************************************************/
+/*                               Start()                                */
+/************************************************************************/
+
+void CPLTraceSpan::Start()
+{
+    const auto &aosCategories = GetState().aosCategories;
+    if (!aosCategories.empty() &&
+        aosCategories.FindString(m_pszCategory) < 0)
+    {
+        return;
+    }
+    m_bActive = true;
+    m_oStart = std::chrono::steady_clock::now();
+}
+
+/************************************************************************/
+/*                               AddArg()                               */
+/************************************************************************/
+
+/** Adds a string argument to the span. No-op if the span is not active. */
+void CPLTraceSpan::AddArg(const char *pszKey, const char *pszValue)
+{
+    if (!m_bActive)
+        return;
+    Arg oArg;
+    oArg.osKey = pszKey;
+    oArg.osValue = pszValue ? pszValue : "";
+    oArg.bIsString = true;
+    m_aoArgs.push_back(std::move(oArg));
+}
+
+/** Adds an integer argument to the span. No-op if the span is not active. */
+void CPLTraceSpan::AddArg(const char *pszKey, GIntBig nValue)
+{
+    if (!m_bActive)
+        return;
+    Arg oArg;
+    oArg.osKey = pszKey;
+    oArg.nValue = nValue;
+    m_aoArgs.push_back(std::move(oArg));
+}
+
+/************************************************************************/
+/*                                End()                                 */
+/************************************************************************/
+
+void CPLTraceSpan::End()
+{
+    const auto oEnd = std::chrono::steady_clock::now();
+    auto &sState = GetState();
+
+    // Format outside of the lock: only the file write is serialized
+    CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+    oWriter.SetPrettyFormatting(false);
+    {
+        auto oObj = oWriter.MakeObjectContext();
+        oWriter.AddObjKey("name");
+        oWriter.Add(m_pszName);
+        oWriter.AddObjKey("cat");
+        oWriter.Add(m_pszCategory);
+        oWriter.AddObjKey("ph");
+        oWriter.Add("X");
+        oWriter.AddObjKey("pid");
+        oWriter.Add(CPLGetCurrentProcessID());
+        oWriter.AddObjKey("tid");
+        oWriter.Add(static_cast<std::int64_t>(CPLGetPID()));
+        oWriter.AddObjKey("ts");
+        oWriter.Add(static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                m_oStart - sState.oEpoch)
+                .count()));
+        oWriter.AddObjKey("dur");
+        oWriter.Add(static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(oEnd -
+                                                                  m_oStart)
+                .count()));
+        if (!m_aoArgs.empty())
+        {
+            oWriter.AddObjKey("args");
+            auto oArgs = oWriter.MakeObjectContext();
+            for (const auto &oArg : m_aoArgs)
+            {
+                oWriter.AddObjKey(oArg.osKey);
+                if (oArg.bIsString)
+                    oWriter.Add(oArg.osValue);
+                else
+                    oWriter.Add(static_cast<std::int64_t>(oArg.nValue));
+            }
+        }
+    }
+    const std::string &osEvent = oWriter.GetString();
+
+    std::lock_guard<std::mutex> oLock(sState.oMutex);
+    if (!sState.fp)
+        return;
+    if (!sState.bFirstEvent)
+        VSIFWrite(",\n", 1, 2, sState.fp);
+    sState.bFirstEvent = false;
+    VSIFWrite(osEvent.data(), 1, osEvent.size(), sState.fp);
+    // So that the trace is usable even if the process does not exit cleanly
+    VSIFFlush(sState.fp);
+}
+
+/*! @endcond */
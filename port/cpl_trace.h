@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Timed spans emitted in the Chrome trace event format
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef CPL_TRACE_H_INCLUDED
+#define CPL_TRACE_H_INCLUDED
+
+/*! @cond Doxygen_Suppress */
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include "cpl_port.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/** Timed span, written to the file pointed by the CPL_TRACE_FILE
+ * configuration option, in the Chrome trace event format, when the object
+ * is destroyed.
+ *
+ * When tracing is disabled (the default), constructing a span only costs
+ * a test of a global flag. pszCategory and pszName must be string literals
+ * (or at least outlive the span).
+ *
+ * The output can be loaded in chrome://tracing or https://ui.perfetto.dev
+ */
+class CPL_DLL CPLTraceSpan
+{
+  public:
+    CPLTraceSpan(const char *pszCategory, const char *pszName)
+        : m_pszCategory(pszCategory), m_pszName(pszName)
+    {
+        if (IsEnabled())
+            Start();
+    }
+
+    ~CPLTraceSpan()
+    {
+        if (m_bActive)
+            End();
+    }
+
+    /** Returns whether this span will be emitted. Can be used to skip
+     * computing expensive arguments. */
+    bool IsActive() const
+    {
+        return m_bActive;
+    }
+
+    void AddArg(const char *pszKey, const char *pszValue);
+    void AddArg(const char *pszKey, GIntBig nValue);
+
+    /** Returns whether tracing is enabled. */
+    static bool IsEnabled()
+    {
+        if (gnEnabled < 0)
+            ReadEnabled();
+        return gnEnabled == TRUE;
+    }
+
+    static void Reset();
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(CPLTraceSpan)
+
+    static int gnEnabled;
+    static void ReadEnabled();
+
+    struct Arg
+    {
+        std::string osKey{};
+        std::string osValue{};
+        GIntBig nValue = 0;
+        bool bIsString = false;
+    };
+
+    const char *m_pszCategory;
+    const char *m_pszName;
+    bool m_bActive = false;
+    std::chrono::steady_clock::time_point m_oStart{};
+    std::vector<Arg> m_aoArgs{};
+
+    void Start();
+    void End();
+};
+
+#endif /* defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS) */
+
+/*! @endcond */
+
+#endif /* CPL_TRACE_H_INCLUDED */
@@ -2159,6 +2159,64 @@ int CPLIsVirtualMemFileMapAvailable(void)
 #endif
 }
 
+/************************************************************************/
+/*                        CPLVirtualMemAdvise()                         */
+/************************************************************************/
+
+void CPLVirtualMemAdvise(CPLVirtualMem *ctxt, void *pAddr, size_t nSize,
+                         CPLVirtualMemAdvice eAdvice)
+{
+#ifdef HAVE_MMAP
+    if (ctxt == nullptr || nSize == 0)
+        return;
+    while (ctxt->pVMemBase != nullptr)
+        ctxt = ctxt->pVMemBase;
+    if (ctxt->eType != VIRTUAL_MEM_TYPE_FILE_MEMORY_MAPPED)
+        return;
+
+    // madvise() requires a page aligned address.
+    GByte *const pabyMapStart = static_cast<GByte *>(ctxt->pDataToFree);
+    GByte *const pabyMapEnd = static_cast<GByte *>(ctxt->pData) + ctxt->nSize;
+    GByte *pabyStart = static_cast<GByte *>(pAddr);
+    GByte *pabyEnd = pabyStart + nSize;
+    if (pabyStart < pabyMapStart)
+        pabyStart = pabyMapStart;
+    if (pabyEnd > pabyMapEnd)
+        pabyEnd = pabyMapEnd;
+    if (pabyStart >= pabyEnd)
+        return;
+    const size_t nPageSize = ctxt->nPageSize;
+    pabyStart = pabyMapStart +
+                (static_cast<size_t>(pabyStart - pabyMapStart) / nPageSize) *
+                    nPageSize;
+
+    int nAdvice = MADV_NORMAL;
+    switch (eAdvice)
+    {
+        case VIRTUALMEM_ADVICE_NORMAL:
+            break;
+        case VIRTUALMEM_ADVICE_SEQUENTIAL:
+            nAdvice = MADV_SEQUENTIAL;
+            break;
+        case VIRTUALMEM_ADVICE_RANDOM:
+            nAdvice = MADV_RANDOM;
+            break;
+        case VIRTUALMEM_ADVICE_WILLNEED:
+            nAdvice = MADV_WILLNEED;
+            break;
+    }
+    // This is only a hint: failures are harmless.
+    CPL_IGNORE_RET_VAL(madvise(pabyStart,
+                               static_cast<size_t>(pabyEnd - pabyStart),
+                               nAdvice));
+#else
+    (void)ctxt;
+    (void)pAddr;
+    (void)nSize;
+    (void)eAdvice;
+#endif
+}
+
 /************************************************************************/
 /*                        CPLVirtualMemFree()                           */
 /************************************************************************/
@@ -367,6 +367,39 @@ void CPL_DLL CPLVirtualMemUnDeclareThread(CPLVirtualMem *ctxt);
 void CPL_DLL CPLVirtualMemPin(CPLVirtualMem *ctxt, void *pAddr, size_t nSize,
                               int bWriteOp);
 
+/** Access pattern hint given to CPLVirtualMemAdvise().
+ *
+ * @since GDAL 3.10
+ */
+typedef enum
+{
+    /*! No particular access pattern. */
+    VIRTUALMEM_ADVICE_NORMAL,
+    /*! Pages will be accessed in increasing address order. */
+    VIRTUALMEM_ADVICE_SEQUENTIAL,
+    /*! Pages will be accessed in random order. */
+    VIRTUALMEM_ADVICE_RANDOM,
+    /*! Pages will be accessed soon, and may be read ahead. */
+    VIRTUALMEM_ADVICE_WILLNEED
+} CPLVirtualMemAdvice;
+
+/** Give a hint to the operating system about how a region of a file memory
+ * mapping will be accessed.
+ *
+ * This maps to madvise() on systems that support it, and is a no-op
+ * otherwise, or for mappings not created with CPLVirtualMemFileMapNew().
+ * The region is extended to page boundaries and clipped to the mapping.
+ *
+ * @param ctxt context returned by CPLVirtualMemFileMapNew().
+ * @param pAddr start of the memory region.
+ * @param nSize the size of the memory region.
+ * @param eAdvice the expected access pattern.
+ *
+ * @since GDAL 3.10
+ */
+void CPL_DLL CPLVirtualMemAdvise(CPLVirtualMem *ctxt, void *pAddr, size_t nSize,
+                                 CPLVirtualMemAdvice eAdvice);
+
 /** Cleanup any resource and handlers related to virtual memory.
  *
  * This function must be called after the last CPLVirtualMem object has
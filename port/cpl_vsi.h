@@ -221,6 +221,9 @@ int CPL_DLL VSIStatL(const char *, VSIStatBufL *) CPL_WARN_UNUSED_RESULT;
 int CPL_DLL VSIStatExL(const char *pszFilename, VSIStatBufL *psStatBuf,
                        int nFlags) CPL_WARN_UNUSED_RESULT;
 
+int CPL_DLL *VSIStatMultipleL(CSLConstList papszFilenames,
+                              VSIStatBufL *pasStatBuf, int nFlags);
+
 int CPL_DLL VSIIsCaseSensitiveFS(const char *pszFilename);
 
 int CPL_DLL VSISupportsSparseFiles(const char *pszPath);
@@ -385,6 +388,35 @@ char CPL_DLL *VSIStrdupVerbose(const char *pszStr, const char *pszFile,
 GIntBig CPL_DLL CPLGetPhysicalRAM(void);
 GIntBig CPL_DLL CPLGetUsablePhysicalRAM(void);
 
+/** Subsystems whose memory usage is accounted.
+ * @since GDAL 3.10
+ */
+typedef enum
+{
+    /** Raster block cache */
+    VSI_MEMORY_TAG_BLOCK_CACHE = 0,
+    /** In-memory region cache of /vsicurl/ and derived file systems */
+    VSI_MEMORY_TAG_REGION_CACHE = 1,
+    /** Working buffers of the warping engine */
+    VSI_MEMORY_TAG_WARP = 2,
+    /** Other subsystems, such as driver internal buffers */
+    VSI_MEMORY_TAG_OTHER = 3
+} VSIMemoryTag;
+
+/** Number of values of VSIMemoryTag.
+ * @since GDAL 3.10
+ */
+#define VSI_MEMORY_TAG_COUNT 4
+
+void CPL_DLL VSIMemoryAccountingUpdate(VSIMemoryTag eTag, GIntBig nDelta);
+GIntBig CPL_DLL VSIMemoryAccountingGetUsage(VSIMemoryTag eTag,
+                                            GIntBig *pnHighWaterMark);
+void CPL_DLL VSIMemoryAccountingResetHighWaterMarks(void);
+char CPL_DLL *VSIMemoryAccountingGetAsSerializedJSON(char **papszOptions);
+GIntBig CPL_DLL VSIGetMemorySoftLimit(void);
+void CPL_DLL VSISetMemorySoftLimit(GIntBig nLimit);
+GIntBig CPL_DLL VSIGetMemorySoftBudget(VSIMemoryTag eTag);
+
 /* ==================================================================== */
 /*      Other...                                                        */
 /* ==================================================================== */
@@ -476,6 +508,9 @@ void CPL_DLL VSIInstallSubFileHandler(void);
 void VSIInstallCurlFileHandler(void);
 void CPL_DLL VSICurlClearCache(void);
 void CPL_DLL VSICurlPartialClearCache(const char *pszFilenamePrefix);
+int CPL_DLL VSICurlPrimeCache(const char *pszDirname,
+                              CSLConstList papszFilenames,
+                              const GUIntBig *panFileSizes);
 void VSIInstallCurlStreamingFileHandler(void);
 void VSIInstallS3FileHandler(void);
 void VSIInstallS3StreamingFileHandler(void);
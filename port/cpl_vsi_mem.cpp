@@ -43,10 +43,12 @@
 #endif
 
 #include <algorithm>
+#include <functional>
 #include <map>
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <mutex>
 // c++17 or VS2017
@@ -73,11 +75,13 @@
 /*
 ** Notes on Multithreading:
 **
-** VSIMemFilesystemHandler: This class maintains a mutex to protect
-** access and update of the oFileList array which has all the "files" in
-** the memory filesystem area.  It is expected that multiple threads would
-** want to create and read different files at the same time and so might
-** collide access oFileList without the mutex.
+** VSIMemFilesystemHandler: The "files" of the memory filesystem area are
+** spread among several shards, according to a hash of their name, each
+** one with its own file list and its own mutex. It is expected that
+** multiple threads would want to create and read different files at the
+** same time, and they will then rarely contend for the same mutex.
+** Operations that span several files (Rename()) lock all shards, in
+** increasing index order, and ReadDirEx() visits them one after the other.
 **
 ** VSIMemFile: A mutex protects accesses to the file
 **
@@ -171,8 +175,16 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
     CPL_DISALLOW_COPY_ASSIGN(VSIMemFilesystemHandler)
 
   public:
-    std::map<CPLString, std::shared_ptr<VSIMemFile>> oFileList{};
-    CPLMutex *hMutex = nullptr;
+    using FileList = std::map<CPLString, std::shared_ptr<VSIMemFile>>;
+
+    struct Shard
+    {
+        CPL_SHARED_MUTEX_TYPE m_oMutex{};
+        FileList oFileList{};
+    };
+
+    static constexpr size_t SHARD_COUNT = 16;
+    Shard m_aoShards[SHARD_COUNT]{};
 
     explicit VSIMemFilesystemHandler(const char *pszPrefix)
         : m_osPrefix(pszPrefix)
@@ -198,7 +210,13 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
 
     static std::string NormalizePath(const std::string &in);
 
-    int Unlink_unlocked(const char *pszFilename);
+    Shard &GetShard(const std::string &osFilename)
+    {
+        return m_aoShards[std::hash<std::string>()(osFilename) % SHARD_COUNT];
+    }
+
+    std::shared_ptr<VSIMemFile> GetFile(const std::string &osFilename);
+    void SetFile(const std::shared_ptr<VSIMemFile> &poFile);
 
     VSIFilesystemHandler *Duplicate(const char *pszPrefix) override
     {
@@ -540,14 +558,61 @@ int VSIMemHandle::Truncate(vsi_l_offset nNewSize)
 /*                      ~VSIMemFilesystemHandler()                      */
 /************************************************************************/
 
-VSIMemFilesystemHandler::~VSIMemFilesystemHandler()
+VSIMemFilesystemHandler::~VSIMemFilesystemHandler() = default;
+
+/************************************************************************/
+/*                              GetFile()                               */
+/************************************************************************/
+
+// Returns the file or directory of the given normalized name, or nullptr.
+std::shared_ptr<VSIMemFile>
+VSIMemFilesystemHandler::GetFile(const std::string &osFilename)
+{
+    Shard &oShard = GetShard(osFilename);
+    CPL_SHARED_LOCK oLock(oShard.m_oMutex);
+    auto oIter = oShard.oFileList.find(osFilename);
+    if (oIter == oShard.oFileList.end())
+        return nullptr;
+    return oIter->second;
+}
+
+/************************************************************************/
+/*                              SetFile()                               */
+/************************************************************************/
+
+// Inserts poFile under its name, replacing any existing file.
+void VSIMemFilesystemHandler::SetFile(const std::shared_ptr<VSIMemFile> &poFile)
+{
+    Shard &oShard = GetShard(poFile->osFilename);
+    CPL_EXCLUSIVE_LOCK oLock(oShard.m_oMutex);
+    oShard.oFileList[poFile->osFilename] = poFile;
+}
+
+/************************************************************************/
+/*                        VSIMemMkdirParents()                          */
+/************************************************************************/
 
+// Equivalent of VSIMkdirRecursive(), used to create the parent directories
+// of a new file without holding any lock. Several threads may create files
+// in the same new directory concurrently, so a directory that could not be
+// created because another thread created it in the meantime is not an error.
+static bool VSIMemMkdirParents(const std::string &osPathname)
 {
-    oFileList.clear();
+    VSIStatBufL sStat;
+    if (VSIStatL(osPathname.c_str(), &sStat) == 0)
+        return VSI_ISDIR(sStat.st_mode);
 
-    if (hMutex != nullptr)
-        CPLDestroyMutex(hMutex);
-    hMutex = nullptr;
+    const std::string osParentPath(CPLGetPath(osPathname.c_str()));
+    // Prevent crazy paths from recursing forever.
+    if (osParentPath.length() >= osPathname.length())
+        return false;
+    if (!VSIMemMkdirParents(osParentPath))
+        return false;
+
+    if (VSIMkdir(osPathname.c_str(), 0755) == 0)
+        return true;
+    return VSIStatL(osPathname.c_str(), &sStat) == 0 &&
+           VSI_ISDIR(sStat.st_mode);
 }
 
 /************************************************************************/
@@ -560,7 +625,6 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
                                                 CSLConstList /* papszOptions */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
     const CPLString osFilename = NormalizePath(pszFilename);
     if (osFilename.empty())
         return nullptr;
@@ -576,11 +640,7 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
     /* -------------------------------------------------------------------- */
     /*      Get the filename we are opening, create if needed.              */
     /* -------------------------------------------------------------------- */
-    std::shared_ptr<VSIMemFile> poFile = nullptr;
-    if (oFileList.find(osFilename) != oFileList.end())
-    {
-        poFile = oFileList[osFilename];
-    }
+    std::shared_ptr<VSIMemFile> poFile = GetFile(osFilename);
 
     // If no file and opening in read, error out.
     if (strstr(pszAccess, "w") == nullptr &&
@@ -597,27 +657,35 @@ VSIVirtualHandle *VSIMemFilesystemHandler::Open(const char *pszFilename,
     // Create.
     if (poFile == nullptr)
     {
-        const char *pszFileDir = CPLGetPath(osFilename.c_str());
-        if (VSIMkdirRecursive(pszFileDir, 0755) == -1)
+        const std::string osFileDir = CPLGetPath(osFilename.c_str());
+        if (!VSIMemMkdirParents(osFileDir))
         {
             if (bSetError)
             {
                 VSIError(VSIE_FileError,
                          "Could not create directory %s for writing",
-                         pszFileDir);
+                         osFileDir.c_str());
             }
             errno = ENOENT;
             return nullptr;
         }
 
-        poFile = std::make_shared<VSIMemFile>();
-        poFile->osFilename = osFilename;
-        oFileList[poFile->osFilename] = poFile;
+        // The parent directory has been created without holding any lock,
+        // so another thread may have created the file in the meantime.
+        Shard &oShard = GetShard(osFilename);
+        CPL_EXCLUSIVE_LOCK oLock(oShard.m_oMutex);
+        auto &poListedFile = oShard.oFileList[osFilename];
+        if (poListedFile == nullptr)
+        {
+            poListedFile = std::make_shared<VSIMemFile>();
+            poListedFile->osFilename = osFilename;
+            poListedFile->nMaxLength = nMaxLength;
 #ifdef DEBUG_VERBOSE
-        CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
-                 static_cast<int>(poFile.use_count()));
+            CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
+                     static_cast<int>(poListedFile.use_count()));
 #endif
-        poFile->nMaxLength = nMaxLength;
+        }
+        poFile = poListedFile;
     }
     // Overwrite
     else if (strstr(pszAccess, "w"))
@@ -665,8 +733,6 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
                                   VSIStatBufL *pStatBuf, int /* nFlags */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osFilename = NormalizePath(pszFilename);
 
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
@@ -678,17 +744,13 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
         return 0;
     }
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile = GetFile(osFilename);
+    if (poFile == nullptr)
     {
         errno = ENOENT;
         return -1;
     }
 
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
-
-    memset(pStatBuf, 0, sizeof(VSIStatBufL));
-
     CPL_SHARED_LOCK oLock(poFile->m_oMutex);
     if (poFile->bIsDirectory)
     {
@@ -711,33 +773,28 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
 
 int VSIMemFilesystemHandler::Unlink(const char *pszFilename)
 
-{
-    CPLMutexHolder oHolder(&hMutex);
-    return Unlink_unlocked(pszFilename);
-}
-
-/************************************************************************/
-/*                           Unlink_unlocked()                          */
-/************************************************************************/
-
-int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
-
 {
     const CPLString osFilename = NormalizePath(pszFilename);
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    // Released after the lock, so that the file is not freed under it.
+    std::shared_ptr<VSIMemFile> poFile;
     {
-        errno = ENOENT;
-        return -1;
+        Shard &oShard = GetShard(osFilename);
+        CPL_EXCLUSIVE_LOCK oLock(oShard.m_oMutex);
+        auto oIter = oShard.oFileList.find(osFilename);
+        if (oIter == oShard.oFileList.end())
+        {
+            errno = ENOENT;
+            return -1;
+        }
+        poFile = std::move(oIter->second);
+        oShard.oFileList.erase(oIter);
     }
 
 #ifdef DEBUG_VERBOSE
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
     CPLDebug("VSIMEM", "Unlink %s: ref_count=%d (before)", pszFilename,
              static_cast<int>(poFile.use_count()));
 #endif
-    oFileList.erase(oIter);
 
     return 0;
 }
@@ -749,11 +806,12 @@ int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
 int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPathname = NormalizePath(pszPathname);
 
-    if (oFileList.find(osPathname) != oFileList.end())
+    Shard &oShard = GetShard(osPathname);
+    CPL_EXCLUSIVE_LOCK oLock(oShard.m_oMutex);
+
+    if (oShard.oFileList.find(osPathname) != oShard.oFileList.end())
     {
         errno = EEXIST;
         return -1;
@@ -762,7 +820,7 @@ int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
     std::shared_ptr<VSIMemFile> poFile = std::make_shared<VSIMemFile>();
     poFile->osFilename = osPathname;
     poFile->bIsDirectory = true;
-    oFileList[osPathname] = poFile;
+    oShard.oFileList[osPathname] = poFile;
 #ifdef DEBUG_VERBOSE
     CPLDebug("VSIMEM", "Mkdir on %s: ref_count=%d", pszPathname,
              static_cast<int>(poFile.use_count()));
@@ -788,8 +846,6 @@ int VSIMemFilesystemHandler::Rmdir(const char *pszPathname)
 char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osPath = NormalizePath(pszPath);
 
     char **papszDir = nullptr;
@@ -798,37 +854,50 @@ char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
     if (nPathLen > 0 && osPath.back() == '/')
         nPathLen--;
 
+    std::vector<std::string> aosFilePaths;
+    for (auto &oShard : m_aoShards)
+    {
+        CPL_SHARED_LOCK oLock(oShard.m_oMutex);
+        for (const auto &iter : oShard.oFileList)
+        {
+            const char *pszFilePath = iter.first.c_str();
+            if (EQUALN(osPath, pszFilePath, nPathLen) &&
+                pszFilePath[nPathLen] == '/' &&
+                strstr(pszFilePath + nPathLen + 1, "/") == nullptr)
+            {
+                aosFilePaths.push_back(iter.first);
+            }
+        }
+    }
+    // Same order as when all files were in a single list.
+    std::sort(aosFilePaths.begin(), aosFilePaths.end());
+
     // In case of really big number of files in the directory, CSLAddString
     // can be slow (see #2158). We then directly build the list.
     int nItems = 0;
     int nAllocatedItems = 0;
 
-    for (const auto &iter : oFileList)
+    for (const auto &osFilePath : aosFilePaths)
     {
-        const char *pszFilePath = iter.second->osFilename.c_str();
-        if (EQUALN(osPath, pszFilePath, nPathLen) &&
-            pszFilePath[nPathLen] == '/' &&
-            strstr(pszFilePath + nPathLen + 1, "/") == nullptr)
+        const char *pszFilePath = osFilePath.c_str();
+        if (nItems == 0)
         {
-            if (nItems == 0)
-            {
-                papszDir = static_cast<char **>(CPLCalloc(2, sizeof(char *)));
-                nAllocatedItems = 1;
-            }
-            else if (nItems >= nAllocatedItems)
-            {
-                nAllocatedItems = nAllocatedItems * 2;
-                papszDir = static_cast<char **>(CPLRealloc(
-                    papszDir, (nAllocatedItems + 2) * sizeof(char *)));
-            }
+            papszDir = static_cast<char **>(CPLCalloc(2, sizeof(char *)));
+            nAllocatedItems = 1;
+        }
+        else if (nItems >= nAllocatedItems)
+        {
+            nAllocatedItems = nAllocatedItems * 2;
+            papszDir = static_cast<char **>(CPLRealloc(
+                papszDir, (nAllocatedItems + 2) * sizeof(char *)));
+        }
 
-            papszDir[nItems] = CPLStrdup(pszFilePath + nPathLen + 1);
-            papszDir[nItems + 1] = nullptr;
+        papszDir[nItems] = CPLStrdup(pszFilePath + nPathLen + 1);
+        papszDir[nItems + 1] = nullptr;
 
-            nItems++;
-            if (nMaxFiles > 0 && nItems > nMaxFiles)
-                break;
-        }
+        nItems++;
+        if (nMaxFiles > 0 && nItems > nMaxFiles)
+            break;
     }
 
     return papszDir;
@@ -842,8 +911,6 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
                                     const char *pszNewPath)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osOldPath = NormalizePath(pszOldPath);
     const CPLString osNewPath = NormalizePath(pszNewPath);
     if (!STARTS_WITH(pszNewPath, m_osPrefix.c_str()))
@@ -852,31 +919,54 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
     if (osOldPath.compare(osNewPath) == 0)
         return 0;
 
-    if (oFileList.find(osOldPath) == oFileList.end())
+    // The file and its children may be spread among all shards.
+    for (auto &oShard : m_aoShards)
+        oShard.m_oMutex.lock();
+    struct Unlocker
+    {
+        Shard *m_paoShards;
+
+        ~Unlocker()
+        {
+            for (size_t i = SHARD_COUNT; i > 0; --i)
+                m_paoShards[i - 1].m_oMutex.unlock();
+        }
+    } oUnlocker{m_aoShards};
+
+    auto &oOldShardList = GetShard(osOldPath).oFileList;
+    if (oOldShardList.find(osOldPath) == oOldShardList.end())
     {
         errno = ENOENT;
         return -1;
     }
 
-    std::map<CPLString, std::shared_ptr<VSIMemFile>>::iterator it =
-        oFileList.find(osOldPath);
-    while (it != oFileList.end() && it->first.ifind(osOldPath) == 0)
+    std::vector<std::shared_ptr<VSIMemFile>> apoMovedFiles;
+    for (auto &oShard : m_aoShards)
     {
-        const CPLString osRemainder = it->first.substr(osOldPath.size());
-        if (osRemainder.empty() || osRemainder[0] == '/')
+        for (auto it = oShard.oFileList.begin(); it != oShard.oFileList.end();)
         {
-            const CPLString osNewFullPath = osNewPath + osRemainder;
-            Unlink_unlocked(osNewFullPath);
-            oFileList[osNewFullPath] = it->second;
-            it->second->osFilename = osNewFullPath;
-            oFileList.erase(it++);
-        }
-        else
-        {
-            ++it;
+            if (it->first.ifind(osOldPath) == 0 &&
+                (it->first.size() == osOldPath.size() ||
+                 it->first[osOldPath.size()] == '/'))
+            {
+                apoMovedFiles.push_back(std::move(it->second));
+                it = oShard.oFileList.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
         }
     }
 
+    for (auto &poFile : apoMovedFiles)
+    {
+        poFile->osFilename = osNewPath + poFile->osFilename.substr(
+                                             osOldPath.size());
+        GetShard(poFile->osFilename).oFileList[poFile->osFilename] =
+            std::move(poFile);
+    }
+
     return 0;
 }
 
@@ -1025,11 +1115,12 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
     // ownership of pabyData.
     if (!osFilename.empty())
     {
-        const char *pszFileDir = CPLGetPath(osFilename.c_str());
-        if (VSIMkdirRecursive(pszFileDir, 0755) == -1)
+        const std::string osFileDir = CPLGetPath(osFilename.c_str());
+        if (!VSIMemMkdirParents(osFileDir))
         {
             VSIError(VSIE_FileError,
-                     "Could not create directory %s for writing", pszFileDir);
+                     "Could not create directory %s for writing",
+                     osFileDir.c_str());
             errno = ENOENT;
             return nullptr;
         }
@@ -1045,9 +1136,7 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
 
     if (!osFilename.empty())
     {
-        CPLMutexHolder oHolder(&poHandler->hMutex);
-        poHandler->Unlink_unlocked(osFilename);
-        poHandler->oFileList[poFile->osFilename] = poFile;
+        poHandler->SetFile(poFile);
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "VSIFileFromMemBuffer() %s: ref_count=%d (after)",
                  poFile->osFilename.c_str(),
@@ -1097,12 +1186,14 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
     const CPLString osFilename =
         VSIMemFilesystemHandler::NormalizePath(pszFilename);
 
-    CPLMutexHolder oHolder(&poHandler->hMutex);
+    auto &oShard = poHandler->GetShard(osFilename);
+    CPL_EXCLUSIVE_LOCK oLock(oShard.m_oMutex);
 
-    if (poHandler->oFileList.find(osFilename) == poHandler->oFileList.end())
+    auto oIter = oShard.oFileList.find(osFilename);
+    if (oIter == oShard.oFileList.end())
         return nullptr;
 
-    std::shared_ptr<VSIMemFile> poFile = poHandler->oFileList[osFilename];
+    std::shared_ptr<VSIMemFile> poFile = oIter->second;
     GByte *pabyData = poFile->pabyData;
     if (pnDataLength != nullptr)
         *pnDataLength = poFile->nLength;
@@ -1115,7 +1206,7 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
         else
             poFile->bOwnData = false;
 
-        poHandler->oFileList.erase(poHandler->oFileList.find(osFilename));
+        oShard.oFileList.erase(oIter);
 #ifdef DEBUG_VERBOSE
         CPLDebug("VSIMEM", "VSIGetMemFileBuffer() %s: ref_count=%d (before)",
                  poFile->osFilename.c_str(),
@@ -186,6 +186,8 @@ class CPL_DLL VSIFilesystemHandler
                                    CSLConstList papszOptions) = 0;
     virtual int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
                      int nFlags) = 0;
+    virtual int *StatMultiple(CSLConstList papszFilenames,
+                              VSIStatBufL *pasStatBuf, int nFlags);
 
     virtual int Unlink(const char *pszFilename)
     {
@@ -873,6 +873,85 @@ int VSIStatExL(const char *pszFilename, VSIStatBufL *psStatBuf, int nFlags)
     return poFSHandler->Stat(pszFilename, psStatBuf, nFlags);
 }
 
+/************************************************************************/
+/*                          VSIStatMultipleL()                          */
+/************************************************************************/
+
+/**
+ * \brief Get filesystem object info on several files.
+ *
+ * This is equivalent to calling VSIStatExL() on each file, but network
+ * file systems (/vsicurl/, /vsis3/, etc.) may issue the requests
+ * concurrently, or use directory listings to get the information of several
+ * files at once. This is typically useful to warm the file system caches
+ * before opening a large number of remote datasets.
+ *
+ * Files may belong to different file system handlers.
+ *
+ * When the requests are performed concurrently, errors are not
+ * reported through VSI_STAT_SET_ERROR_FLAG.
+ *
+ * @param papszFilenames NULL terminated list of files. UTF-8 encoded.
+ * @param pasStatBuf array of CSLCount(papszFilenames) structures to load
+ * with information.
+ * @param nFlags same as the nFlags argument of VSIStatExL().
+ *
+ * @return an array of size CSLCount(papszFilenames), whose values are 0 or -1
+ * depending on the success of VSIStatExL() on the corresponding file. The
+ * array should be freed with VSIFree().
+ *
+ * @since GDAL 3.10
+ */
+
+int *VSIStatMultipleL(CSLConstList papszFilenames, VSIStatBufL *pasStatBuf,
+                      int nFlags)
+{
+    const int nCount = CSLCount(papszFilenames);
+    int *panRet =
+        static_cast<int *>(CPLCalloc(std::max(1, nCount), sizeof(int)));
+    if (nFlags == 0)
+        nFlags =
+            VSI_STAT_EXISTS_FLAG | VSI_STAT_NATURE_FLAG | VSI_STAT_SIZE_FLAG;
+
+    // Dispatch files to their file system handler, preserving order
+    std::vector<VSIFilesystemHandler *> apoHandlers;
+    std::map<VSIFilesystemHandler *, std::vector<int>> oMapHandlerToIndices;
+    for (int i = 0; i < nCount; ++i)
+    {
+        auto poFSHandler = VSIFileManager::GetHandler(papszFilenames[i]);
+        auto &anIndices = oMapHandlerToIndices[poFSHandler];
+        if (anIndices.empty())
+            apoHandlers.push_back(poFSHandler);
+        anIndices.push_back(i);
+    }
+
+    for (auto poFSHandler : apoHandlers)
+    {
+        const auto &anIndices = oMapHandlerToIndices[poFSHandler];
+        if (anIndices.size() == 1)
+        {
+            const int i = anIndices[0];
+            panRet[i] = poFSHandler->Stat(papszFilenames[i], &pasStatBuf[i],
+                                          nFlags);
+            continue;
+        }
+        CPLStringList aosFilenames;
+        for (int i : anIndices)
+            aosFilenames.AddString(papszFilenames[i]);
+        std::vector<VSIStatBufL> asStatBuf(anIndices.size());
+        int *panRetHandler = poFSHandler->StatMultiple(
+            aosFilenames.List(), asStatBuf.data(), nFlags);
+        for (size_t j = 0; j < anIndices.size(); ++j)
+        {
+            pasStatBuf[anIndices[j]] = asStatBuf[j];
+            panRet[anIndices[j]] = panRetHandler[j];
+        }
+        VSIFree(panRetHandler);
+    }
+
+    return panRet;
+}
+
 /************************************************************************/
 /*                       VSIGetFileMetadata()                           */
 /************************************************************************/
@@ -1822,6 +1901,22 @@ int *VSIFilesystemHandler::UnlinkBatch(CSLConstList papszFiles)
     return panRet;
 }
 
+/************************************************************************/
+/*                           StatMultiple()                             */
+/************************************************************************/
+
+int *VSIFilesystemHandler::StatMultiple(CSLConstList papszFilenames,
+                                        VSIStatBufL *pasStatBuf, int nFlags)
+{
+    int *panRet = static_cast<int *>(
+        CPLCalloc(std::max(1, CSLCount(papszFilenames)), sizeof(int)));
+    for (int i = 0; papszFilenames && papszFilenames[i]; ++i)
+    {
+        panRet[i] = Stat(papszFilenames[i], &pasStatBuf[i], nFlags);
+    }
+    return panRet;
+}
+
 /************************************************************************/
 /*                          RmdirRecursive()                            */
 /************************************************************************/
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -44,6 +45,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
@@ -78,6 +80,12 @@ void VSICurlPartialClearCache(const char *)
     // Not supported.
 }
 
+int VSICurlPrimeCache(const char *, CSLConstList, const GUIntBig *)
+{
+    // Not supported.
+    return FALSE;
+}
+
 void VSICurlAuthParametersChanged()
 {
     // Not supported.
@@ -271,6 +279,22 @@ VSICurlFindStringSensitiveExceptEscapeSequences(char **papszList,
     return -1;
 }
 
+/************************************************************************/
+/*                     VSICurlCacheEntryHasExpired()                    */
+/************************************************************************/
+
+// Whether an entry of the caches of file properties and directory listings,
+// inserted at nCacheTimestamp, is older than CPL_VSIL_CURL_METADATA_CACHE_TTL
+static bool VSICurlCacheEntryHasExpired(time_t nCacheTimestamp)
+{
+    const char *pszTTL =
+        CPLGetConfigOption("CPL_VSIL_CURL_METADATA_CACHE_TTL", nullptr);
+    if (pszTTL == nullptr)
+        return false;
+    const double dfTTL = CPLAtof(pszTTL);
+    return dfTTL > 0 && difftime(time(nullptr), nCacheTimestamp) > dfTTL;
+}
+
 /************************************************************************/
 /*                      VSICurlIsFileInList()                           */
 /************************************************************************/
@@ -494,6 +518,10 @@ VSICurlHandle::~VSICurlHandle()
     {
         m_oThreadAdviseRead.join();
     }
+    if (m_oThreadReadAhead.joinable())
+    {
+        m_oThreadReadAhead.join();
+    }
 
     if (!m_bCached)
     {
@@ -871,7 +899,10 @@ void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle)
     CPLHTTPRestoreSigPipeHandler(old_handler);
 
     if (hEasyHandle)
+    {
         curl_multi_remove_handle(hCurlMultiHandle, hEasyHandle);
+        cpl::NetworkStatisticsLogger::LogRequestTimings(hEasyHandle);
+    }
 }
 
 /************************************************************************/
@@ -1849,6 +1880,12 @@ retry:
         CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s)...", rangeStr,
                  osURL.c_str());
 
+    // One span per attempt, so that retries show up individually
+    CPLTraceSpan oSpan("network", "DownloadRegion");
+    oSpan.AddArg("url", m_pszURL);
+    oSpan.AddArg("range", rangeStr);
+    oSpan.AddArg("retry", nRetryCount);
+
     std::string osHeaderRange;  // leave in this scope
     if (sWriteFuncHeaderData.bIsHTTP)
     {
@@ -1876,6 +1913,7 @@ retry:
     curl_slist_free_all(headers);
 
     NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+    oSpan.AddArg("bytes", static_cast<GIntBig>(sWriteFuncData.nSize));
 
     if (sWriteFuncData.bInterrupted)
     {
@@ -1890,6 +1928,7 @@ retry:
 
     long response_code = 0;
     curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+    oSpan.AddArg("http_code", static_cast<GIntBig>(response_code));
 
     if (ENABLE_DEBUG && szCurlErrBuf[0] != '\0')
     {
@@ -2187,7 +2226,10 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
 #endif
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer,
+                        m_bCached ? &oFileProp : nullptr);
+        NetworkStatisticsLogger::LogRegionDownloaded(m_pszURL, l_startOffset,
+                                                     nChunkSize);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
@@ -2217,6 +2259,12 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
 #endif
 
     vsi_l_offset iterOffset = curOffset;
+    if (ReadLargeRangeInParallel(pBuffer, iterOffset, nBufferRequestSize))
+    {
+        curOffset = iterOffset + nBufferRequestSize;
+        return nMemb;
+    }
+
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     while (nBufferRequestSize)
@@ -2237,12 +2285,32 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
 
         const vsi_l_offset nOffsetToDownload =
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+
+        // Wait for the read-ahead in progress if it covers that block
+        const bool bInReadAheadWindow =
+            nOffsetToDownload >= m_nReadAheadStart &&
+            nOffsetToDownload < m_nReadAheadEnd;
+        if (bInReadAheadWindow && m_oThreadReadAhead.joinable())
+        {
+            m_oThreadReadAhead.join();
+        }
+
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
-            poFS->GetRegion(m_pszURL, nOffsetToDownload);
+            poFS->GetRegion(m_pszURL, nOffsetToDownload,
+                            m_bCached ? &oFileProp : nullptr);
+        NetworkStatisticsLogger::LogRegionCacheLookup(psRegion != nullptr);
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
+
+            // When the sequential scan enters the read-ahead window, fetch
+            // the next one, so that the download of the next range overlaps
+            // with the consumption of the current one.
+            if (bInReadAheadWindow && nOffsetToDownload == m_nReadAheadStart)
+            {
+                StartReadAhead(m_nReadAheadEnd, nBlocksToDownload);
+            }
         }
         else
         {
@@ -2279,10 +2347,12 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             // this should not cause bugs. Just missed optimization.
             for (int i = 1; i < nBlocksToDownload; i++)
             {
-                if (poFS->GetRegion(m_pszURL, nOffsetToDownload +
-                                                  static_cast<vsi_l_offset>(i) *
-                                                      knDOWNLOAD_CHUNK_SIZE) !=
-                    nullptr)
+                if (poFS->GetRegion(
+                        m_pszURL,
+                        nOffsetToDownload +
+                            static_cast<vsi_l_offset>(i) *
+                                knDOWNLOAD_CHUNK_SIZE,
+                        m_bCached ? &oFileProp : nullptr) != nullptr)
                 {
                     nBlocksToDownload = i;
                     break;
@@ -2302,8 +2372,20 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
                     bEOF = true;
                 return 0;
             }
+
+            // After a few consecutive sequential downloads, assume a
+            // sequential scan and prefetch the next range asynchronously.
+            constexpr int MIN_BLOCKS_FOR_READ_AHEAD = 4;
+            if (nBlocksToDownload >= MIN_BLOCKS_FOR_READ_AHEAD &&
+                nOffsetToDownload + osRegion.size() == lastDownloadedOffset)
+            {
+                StartReadAhead(lastDownloadedOffset, nBlocksToDownload);
+            }
         }
 
+        NetworkStatisticsLogger::LogRegionConsumed(m_pszURL,
+                                                   nOffsetToDownload);
+
         const vsi_l_offset nRegionOffset = iterOffset - nOffsetToDownload;
         if (osRegion.size() < nRegionOffset)
         {
@@ -2340,6 +2422,275 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     return ret;
 }
 
+/************************************************************************/
+/*                           StartReadAhead()                           */
+/************************************************************************/
+
+// Start downloading nBlocks from nStartOffset in a background thread. The
+// result is stored in the region cache, where Read() will find it.
+void VSICurlHandle::StartReadAhead(vsi_l_offset nStartOffset, int nBlocks)
+{
+    static CPLCachedBoolConfigOption gbReadAhead("CPL_VSIL_CURL_READ_AHEAD",
+                                                 true);
+    m_nReadAheadStart = 0;
+    m_nReadAheadEnd = 0;
+    if (pfnReadCbk != nullptr || bInterrupted || !gbReadAhead.Get())
+    {
+        return;
+    }
+
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize || nStartOffset >= oFileProp.fileSize)
+        return;
+
+    // Do not prefetch more than what the region cache can comfortably hold
+    // with the blocks being consumed.
+    nBlocks = std::min(nBlocks, std::max(1, GetMaxRegions() / 4));
+    if (poFS->GetRegion(m_pszURL, nStartOffset) != nullptr)
+        return;
+
+    if (m_oThreadReadAhead.joinable())
+        m_oThreadReadAhead.join();
+
+    ManagePlanetaryComputerSigning();
+
+    bool bHasExpired = false;
+    const std::string osURL(GetRedirectURLIfValid(bHasExpired));
+    if (bHasExpired)
+        return;
+
+    const vsi_l_offset nBlocksEndOffset =
+        nStartOffset +
+        static_cast<vsi_l_offset>(nBlocks) * VSICURLGetDownloadChunkSize();
+    m_nReadAheadStart = nStartOffset;
+    m_nReadAheadEnd = std::min(nBlocksEndOffset, oFileProp.fileSize);
+    // So that the doubling heuristics of Read() goes on after the window
+    lastDownloadedOffset = nBlocksEndOffset;
+
+    m_oThreadReadAhead =
+        std::thread(&VSICurlHandle::ReadAheadTask, this, osURL,
+                    m_nReadAheadStart, m_nReadAheadEnd, oFileProp);
+}
+
+/************************************************************************/
+/*                            ReadAheadTask()                           */
+/************************************************************************/
+
+void VSICurlHandle::ReadAheadTask(const std::string &osURL,
+                                  vsi_l_offset nStartOffset,
+                                  vsi_l_offset nEndOffset,
+                                  const FileProp &oFilePropForDiskCache)
+{
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction("ReadAhead");
+
+    CURLM *hMultiHandle = curl_multi_init();
+    CURL *hCurlHandle = curl_easy_init();
+    struct curl_slist *headers =
+        VSICurlSetOptions(hCurlHandle, osURL.c_str(), m_papszHTTPOptions);
+
+    WriteFuncStruct sWriteFuncData;
+    VSICURLInitWriteFuncStruct(&sWriteFuncData, this, nullptr, nullptr);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA, &sWriteFuncData);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                               VSICurlHandleWriteFunc);
+
+    WriteFuncStruct sWriteFuncHeaderData;
+    VSICURLInitWriteFuncStruct(&sWriteFuncHeaderData, nullptr, nullptr,
+                               nullptr);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                               &sWriteFuncHeaderData);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                               VSICurlHandleWriteFunc);
+    sWriteFuncHeaderData.bIsHTTP = STARTS_WITH(m_pszURL, "http");
+    sWriteFuncHeaderData.nStartOffset = nStartOffset;
+    sWriteFuncHeaderData.nEndOffset = nEndOffset - 1;
+
+    char rangeStr[512] = {};
+    snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+             sWriteFuncHeaderData.nStartOffset,
+             sWriteFuncHeaderData.nEndOffset);
+
+    if (ENABLE_DEBUG)
+        CPLDebug(poFS->GetDebugKey(), "Reading ahead %s (%s)...", rangeStr,
+                 osURL.c_str());
+
+    std::string osHeaderRange;  // leave in this scope
+    if (sWriteFuncHeaderData.bIsHTTP)
+    {
+        osHeaderRange = CPLSPrintf("Range: bytes=%s", rangeStr);
+        // So it gets included in Azure signature
+        headers = curl_slist_append(headers, osHeaderRange.c_str());
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+    }
+    else
+    {
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
+    }
+
+    headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
+
+    VSICURLMultiPerform(hMultiHandle, hCurlHandle);
+
+    long response_code = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+
+    // Errors are silently ignored: Read() will just download the range again
+    if ((response_code == 206 || response_code == 225) &&
+        sWriteFuncData.nSize == nEndOffset - nStartOffset)
+    {
+        NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+
+        const size_t knDOWNLOAD_CHUNK_SIZE =
+            static_cast<size_t>(VSICURLGetDownloadChunkSize());
+        for (size_t nOffset = 0; nOffset < sWriteFuncData.nSize;
+             nOffset += knDOWNLOAD_CHUNK_SIZE)
+        {
+            poFS->AddRegion(
+                m_pszURL, nStartOffset + nOffset,
+                std::min(knDOWNLOAD_CHUNK_SIZE, sWriteFuncData.nSize - nOffset),
+                sWriteFuncData.pBuffer + nOffset,
+                m_bCached ? &oFilePropForDiskCache : nullptr);
+        }
+    }
+    else if (ENABLE_DEBUG)
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "Read ahead of %s failed with response_code=%ld", rangeStr,
+                 response_code);
+    }
+
+    VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+    curl_easy_cleanup(hCurlHandle);
+    CPLFree(sWriteFuncData.pBuffer);
+    CPLFree(sWriteFuncHeaderData.pBuffer);
+    curl_slist_free_all(headers);
+    VSICURLMultiCleanup(hMultiHandle);
+}
+
+/************************************************************************/
+/*                      ReadLargeRangeInParallel()                      */
+/************************************************************************/
+
+// Large contiguous reads are limited by the throughput of a single
+// connection. Split them into parts of CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE
+// bytes, downloaded by up to CPL_VSIL_CURL_PARALLEL_READ_CONNECTIONS
+// concurrent requests, directly into the user buffer, bypassing the region
+// cache. Chunks already in the region cache are copied from it rather than
+// downloaded again. Return false if the read must go through the regular
+// code path.
+bool VSICurlHandle::ReadLargeRangeInParallel(void *pBuffer,
+                                             vsi_l_offset nOffset,
+                                             size_t nSize)
+{
+    const int nMaxConnections = atoi(
+        CPLGetConfigOption("CPL_VSIL_CURL_PARALLEL_READ_CONNECTIONS", "8"));
+    const GIntBig nPartSizeBig = CPLAtoGIntBig(CPLGetConfigOption(
+        "CPL_VSIL_CURL_PARALLEL_READ_PART_SIZE", "8388608"));
+    if (nMaxConnections <= 1 ||
+        nPartSizeBig < VSICURLGetDownloadChunkSize() ||
+        static_cast<GUIntBig>(nPartSizeBig) > nSize / 2)
+    {
+        return false;
+    }
+    const size_t nPartSize = static_cast<size_t>(nPartSizeBig);
+
+    if (pfnReadCbk != nullptr || bInterrupted ||
+        !poFS->HasOptimizedReadMultiRange(m_osFilename.c_str()))
+    {
+        return false;
+    }
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize || nOffset >= oFileProp.fileSize ||
+        nSize > oFileProp.fileSize - nOffset)
+    {
+        // Reads that go past the end of file are left to the regular code
+        // path so that short reads are handled consistently.
+        return false;
+    }
+
+    ManagePlanetaryComputerSigning();
+
+    // Collect the runs of (offset in buffer, size) that are not in the
+    // region cache, and fill the buffer with the cached chunks.
+    GByte *const pabyBuffer = static_cast<GByte *>(pBuffer);
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    std::vector<std::pair<size_t, size_t>> aoRuns;
+    for (size_t nDone = 0; nDone < nSize;)
+    {
+        const vsi_l_offset nCurOffset = nOffset + nDone;
+        const vsi_l_offset nChunkOffset =
+            (nCurOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+        const size_t nOffsetInChunk =
+            static_cast<size_t>(nCurOffset - nChunkOffset);
+        const size_t nThisSize = std::min(
+            static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE) - nOffsetInChunk,
+            nSize - nDone);
+        const auto psRegion = poFS->GetRegion(
+            m_pszURL, nChunkOffset, m_bCached ? &oFileProp : nullptr);
+        if (psRegion && psRegion->size() >= nOffsetInChunk + nThisSize)
+        {
+            memcpy(pabyBuffer + nDone, psRegion->data() + nOffsetInChunk,
+                   nThisSize);
+        }
+        else if (!aoRuns.empty() &&
+                 aoRuns.back().first + aoRuns.back().second == nDone)
+        {
+            aoRuns.back().second += nThisSize;
+        }
+        else
+        {
+            aoRuns.emplace_back(nDone, nThisSize);
+        }
+        nDone += nThisSize;
+    }
+
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for (const auto &oRun : aoRuns)
+    {
+        for (size_t nDone = 0; nDone < oRun.second;)
+        {
+            const size_t nThisPart = std::min(nPartSize, oRun.second - nDone);
+            apData.push_back(pabyBuffer + oRun.first + nDone);
+            anOffsets.push_back(nOffset + oRun.first + nDone);
+            anSizes.push_back(nThisPart);
+            nDone += nThisPart;
+        }
+    }
+    if (anSizes.empty())
+        return true;
+
+    if (ENABLE_DEBUG)
+        CPLDebug(poFS->GetDebugKey(),
+                 "Reading " CPL_FRMT_GUIB "-" CPL_FRMT_GUIB
+                 " with %d parts over up to %d connections",
+                 static_cast<GUIntBig>(nOffset),
+                 static_cast<GUIntBig>(nOffset + nSize - 1),
+                 static_cast<int>(anSizes.size()), nMaxConnections);
+
+    // If the server does not honour ranges, errors will be emitted, but we
+    // will silently retry with the regular code path.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    for (size_t i = 0; i < anSizes.size(); i += nMaxConnections)
+    {
+        const int nBatch = static_cast<int>(std::min(
+            static_cast<size_t>(nMaxConnections), anSizes.size() - i));
+        if (ReadMultiRangeParallel(nBatch, &apData[i], &anOffsets[i],
+                                   &anSizes[i],
+                                   /* bMergeConsecutiveRanges = */ false) != 0)
+        {
+            CPLDebug(poFS->GetDebugKey(),
+                     "Parallel read failed. Retrying with a single request");
+            return false;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2375,6 +2726,25 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
     ManagePlanetaryComputerSigning();
 
+    const bool bMergeConsecutiveRanges = CPLTestBool(
+        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+
+    return ReadMultiRangeParallel(nRanges, ppData, panOffsets, panSizes,
+                                  bMergeConsecutiveRanges);
+}
+
+/************************************************************************/
+/*                       ReadMultiRangeParallel()                       */
+/************************************************************************/
+
+// Issue one GET request per range (or group of consecutive ranges if
+// bMergeConsecutiveRanges), all run in parallel on the multi handle.
+int VSICurlHandle::ReadMultiRangeParallel(int const nRanges,
+                                          void **const ppData,
+                                          const vsi_l_offset *const panOffsets,
+                                          const size_t *const panSizes,
+                                          bool bMergeConsecutiveRanges)
+{
     bool bHasExpired = false;
     std::string osURL(GetRedirectURLIfValid(bHasExpired));
     if (bHasExpired)
@@ -2411,9 +2781,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
     std::vector<CurlErrBuffer> asCurlErrors(nRanges);
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
-
     for (int i = 0, iRequest = 0; i < nRanges;)
     {
         size_t nSize = 0;
@@ -3685,25 +4052,71 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                         CreateRegionValue()                          */
+/************************************************************************/
+
+// Returns a region cache value, whose size is accounted in
+// VSI_MEMORY_TAG_REGION_CACHE during its lifetime.
+static std::shared_ptr<std::string> CreateRegionValue(const char *pData,
+                                                      size_t nSize)
+{
+    VSIMemoryAccountingUpdate(VSI_MEMORY_TAG_REGION_CACHE,
+                              static_cast<GIntBig>(nSize));
+    return std::shared_ptr<std::string>(
+        new std::string(pData, nSize),
+        [](std::string *psValue)
+        {
+            VSIMemoryAccountingUpdate(
+                VSI_MEMORY_TAG_REGION_CACHE,
+                -static_cast<GIntBig>(psValue->size()));
+            delete psValue;
+        });
+}
+
 /************************************************************************/
 /*                          GetRegion()                                 */
 /************************************************************************/
 
 std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
-                                        vsi_l_offset nFileOffsetStart)
+                                        vsi_l_offset nFileOffsetStart,
+                                        const FileProp *poFilePropForDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    // Try the persistent cache, outside of hMutex as this does I/O
+    auto poDiskCache =
+        poFilePropForDiskCache ? VSICurlDiskCache::Get() : nullptr;
+    if (poDiskCache)
+    {
+        const std::string osKey =
+            VSICurlDiskCache::GetKey(pszURL, *poFilePropForDiskCache,
+                                     nFileOffsetStart, knDOWNLOAD_CHUNK_SIZE);
+        std::string osValue;
+        if (!osKey.empty() && poDiskCache->Read(osKey, osValue))
+        {
+            auto value = CreateRegionValue(osValue.data(), osValue.size());
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                value);
+            return value;
+        }
     }
 
     return nullptr;
@@ -3713,16 +4126,45 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
 /*                          AddRegion()                                 */
 /************************************************************************/
 
-void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
-                                             vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+void VSICurlFilesystemHandlerBase::AddRegion(
+    const char *pszURL, vsi_l_offset nFileOffsetStart, size_t nSize,
+    const char *pData, const FileProp *poFilePropForDiskCache)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        auto poRegionCache = GetRegionCache();
+        poRegionCache->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+            CreateRegionValue(pData, nSize));
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+        // Evict the oldest regions if we exceed our share of the soft
+        // memory limit. Regions still referenced by a reader are only
+        // released when it is done with them.
+        const GIntBig nSoftBudget =
+            VSIGetMemorySoftBudget(VSI_MEMORY_TAG_REGION_CACHE);
+        FilenameOffsetPair oOldestKey("", 0);
+        std::shared_ptr<std::string> poOldestValue;
+        while (nSoftBudget >= 0 && poRegionCache->size() > 1 &&
+               VSIMemoryAccountingGetUsage(VSI_MEMORY_TAG_REGION_CACHE,
+                                           nullptr) > nSoftBudget &&
+               poRegionCache->getOldestEntry(oOldestKey, poOldestValue))
+        {
+            poOldestValue.reset();
+            poRegionCache->remove(oOldestKey);
+        }
+    }
+
+    auto poDiskCache =
+        poFilePropForDiskCache ? VSICurlDiskCache::Get() : nullptr;
+    if (poDiskCache)
+    {
+        const std::string osKey = VSICurlDiskCache::GetKey(
+            pszURL, *poFilePropForDiskCache, nFileOffsetStart,
+            VSICURLGetDownloadChunkSize());
+        if (!osKey.empty())
+            poDiskCache->Write(osKey, pData, nSize);
+    }
 }
 
 /************************************************************************/
@@ -3766,10 +4208,17 @@ bool VSICurlFilesystemHandlerBase::GetCachedDirList(
 {
     CPLMutexHolder oHolder(&hMutex);
 
-    return oCacheDirList.tryGet(std::string(pszURL), oCachedDirList) &&
-           // Let a chance to use new auth parameters
-           gnGenerationAuthParameters ==
-               oCachedDirList.nGenerationAuthParameters;
+    if (!oCacheDirList.tryGet(std::string(pszURL), oCachedDirList))
+        return false;
+    if (VSICurlCacheEntryHasExpired(oCachedDirList.nCacheTimestamp))
+    {
+        nCachedFilesInDirList -= oCachedDirList.oFileList.size();
+        oCacheDirList.remove(std::string(pszURL));
+        return false;
+    }
+    // Let a chance to use new auth parameters
+    return gnGenerationAuthParameters ==
+           oCachedDirList.nGenerationAuthParameters;
 }
 
 /************************************************************************/
@@ -3800,11 +4249,63 @@ void VSICurlFilesystemHandlerBase::SetCachedDirList(
         oCacheDirList.remove(oldestKey);
     }
     oCachedDirList.nGenerationAuthParameters = gnGenerationAuthParameters;
+    oCachedDirList.nCacheTimestamp = time(nullptr);
 
     nCachedFilesInDirList += oCachedDirList.oFileList.size();
     oCacheDirList.insert(key, oCachedDirList);
 }
 
+/************************************************************************/
+/*                             PrimeCache()                             */
+/************************************************************************/
+
+bool VSICurlFilesystemHandlerBase::PrimeCache(const char *pszDirname,
+                                              CSLConstList papszFilenames,
+                                              const GUIntBig *panFileSizes)
+{
+    std::string osDirname(pszDirname);
+    while (osDirname.size() > GetFSPrefix().size() && osDirname.back() == '/')
+        osDirname.pop_back();
+    if (osDirname.size() <= GetFSPrefix().size())
+        return false;
+
+    CachedDirList cachedDirList;
+    cachedDirList.bGotFileList = true;
+    cachedDirList.oFileList.Assign(CSLDuplicate(papszFilenames), true);
+    if (cachedDirList.oFileList.empty())
+    {
+        // Same as in ReadDirInternal()
+        cachedDirList.oFileList.AddString(".");
+    }
+    SetCachedDirList(osDirname.c_str(), cachedDirList);
+
+    const std::string osURL = GetURLFromFilename(osDirname);
+    FileProp cachedDirProp;
+    GetCachedFileProp(osURL.c_str(), cachedDirProp);
+    cachedDirProp.eExists = EXIST_YES;
+    cachedDirProp.bIsDirectory = true;
+    cachedDirProp.nMode = S_IFDIR;
+    SetCachedFileProp(osURL.c_str(), cachedDirProp);
+
+    for (int i = 0; papszFilenames && papszFilenames[i]; ++i)
+    {
+        const std::string osCachedFilename =
+            osURL + "/" + papszFilenames[i];
+        FileProp cachedFileProp;
+        GetCachedFileProp(osCachedFilename.c_str(), cachedFileProp);
+        cachedFileProp.eExists = EXIST_YES;
+        cachedFileProp.bIsDirectory = false;
+        cachedFileProp.nMode = S_IFREG;
+        if (panFileSizes)
+        {
+            cachedFileProp.bHasComputedFileSize = true;
+            cachedFileProp.fileSize = panFileSizes[i];
+        }
+        SetCachedFileProp(osCachedFilename.c_str(), cachedFileProp);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                        ExistsInCacheDirList()                        */
 /************************************************************************/
@@ -4139,7 +4640,7 @@ VSIVirtualHandle *VSICurlFilesystemHandlerBase::Open(const char *pszFilename,
     const char *pszOptionVal = CSLFetchNameValueDef(
         papszOptions, "DISABLE_READDIR_ON_OPEN",
         VSIGetPathSpecificOption(pszFilename, "GDAL_DISABLE_READDIR_ON_OPEN",
-                                 "NO"));
+                                 GetDefaultDisableReadDirOnOpen(pszFilename)));
     const bool bSkipReadDir =
         !bListDir || bEmptyDir || EQUAL(pszOptionVal, "EMPTY_DIR") ||
         CPLTestBool(pszOptionVal) || !AllowCachedDataFor(pszFilename);
@@ -5118,7 +5619,8 @@ int VSICurlFilesystemHandlerBase::Stat(const char *pszFilename,
         nullptr, nullptr, nullptr));
 
     const char *pszOptionVal = VSIGetPathSpecificOption(
-        pszFilename, "GDAL_DISABLE_READDIR_ON_OPEN", "NO");
+        pszFilename, "GDAL_DISABLE_READDIR_ON_OPEN",
+        GetDefaultDisableReadDirOnOpen(pszFilename));
     const bool bSkipReadDir =
         !bListDir || bEmptyDir || EQUAL(pszOptionVal, "EMPTY_DIR") ||
         CPLTestBool(pszOptionVal) || !AllowCachedDataFor(pszFilename);
@@ -5156,6 +5658,22 @@ int VSICurlFilesystemHandlerBase::Stat(const char *pszFilename,
             return -1;
         }
     }
+    else if (!bSkipReadDir && osFilename.back() != '/')
+    {
+        // If the listing of the directory is already known (from a previous
+        // ReadDir() or VSICurlPrimeCache()), use it to answer negatively
+        // without a network request. The comparison is case insensitive, as
+        // some servers are.
+        CachedDirList cachedDirList;
+        if (GetCachedDirList(CPLGetDirname(osFilename.c_str()),
+                             cachedDirList) &&
+            cachedDirList.bGotFileList &&
+            cachedDirList.oFileList.FindString(
+                CPLGetFilename(osFilename.c_str())) < 0)
+        {
+            return -1;
+        }
+    }
 
     VSICurlHandle *poHandle = CreateFileHandle(osFilename.c_str());
     if (poHandle == nullptr)
@@ -5178,6 +5696,118 @@ int VSICurlFilesystemHandlerBase::Stat(const char *pszFilename,
     return nRet;
 }
 
+/************************************************************************/
+/*                           StatMultiple()                             */
+/************************************************************************/
+
+int *VSICurlFilesystemHandlerBase::StatMultiple(CSLConstList papszFilenames,
+                                                VSIStatBufL *pasStatBuf,
+                                                int nFlags)
+{
+    const int nCount = CSLCount(papszFilenames);
+    int *panRet =
+        static_cast<int *>(CPLCalloc(std::max(1, nCount), sizeof(int)));
+
+    // Serve what we can from the cache, and group the other files by
+    // directory.
+    std::vector<int> anToStat;
+    std::map<std::string, int> oMapDirToCount;
+    for (int i = 0; i < nCount; ++i)
+    {
+        if (Stat(papszFilenames[i], &pasStatBuf[i],
+                 nFlags | VSI_STAT_CACHE_ONLY) == 0)
+            continue;
+        anToStat.push_back(i);
+        oMapDirToCount[CPLGetDirname(papszFilenames[i])]++;
+    }
+
+    // When many files are requested in the same directory, a listing,
+    // which returns up to 1000 objects per request on cloud storage, is
+    // cheaper than one request per file. Bound the number of listed files
+    // so that the listing does not end up more costly.
+    constexpr int MIN_FILES_FOR_LISTING = 10;
+    constexpr int MAX_LISTED_FILES_PER_REQUESTED_FILE = 100;
+    for (const auto &oIter : oMapDirToCount)
+    {
+        const char *pszDir = oIter.first.c_str();
+        if (oIter.second < MIN_FILES_FOR_LISTING ||
+            !STARTS_WITH_CI(pszDir, GetFSPrefix().c_str()) ||
+            !AllowCachedDataFor(pszDir))
+            continue;
+        const char *pszOptionVal = VSIGetPathSpecificOption(
+            pszDir, "GDAL_DISABLE_READDIR_ON_OPEN",
+            GetDefaultDisableReadDirOnOpen(pszDir));
+        if (EQUAL(pszOptionVal, "EMPTY_DIR") || CPLTestBool(pszOptionVal))
+            continue;
+        const int nMaxFiles =
+            oIter.second >
+                    std::numeric_limits<int>::max() /
+                        MAX_LISTED_FILES_PER_REQUESTED_FILE
+                ? 0
+                : oIter.second * MAX_LISTED_FILES_PER_REQUESTED_FILE;
+        CSLDestroy(ReadDirInternal(pszDir, nMaxFiles, nullptr));
+    }
+
+    // Stat the remaining files concurrently. The listings above have
+    // hopefully populated the cache for most of them.
+    const int nThreads = std::min(
+        static_cast<int>(anToStat.size()),
+        std::max(1, atoi(CPLGetConfigOption(
+                        "CPL_VSIL_CURL_STAT_MULTIPLE_CONNECTIONS", "16"))));
+    if (nThreads <= 1)
+    {
+        for (int i : anToStat)
+            panRet[i] = Stat(papszFilenames[i], &pasStatBuf[i], nFlags);
+        return panRet;
+    }
+
+    struct JobQueue
+    {
+        VSICurlFilesystemHandlerBase *poFS = nullptr;
+        CSLConstList papszFilenames = nullptr;
+        VSIStatBufL *pasStatBuf = nullptr;
+        int *panRet = nullptr;
+        int nFlags = 0;
+        const std::vector<int> *panToStat = nullptr;
+        std::atomic<int> nCurIdx{0};
+    };
+
+    JobQueue sJobQueue;
+    sJobQueue.poFS = this;
+    sJobQueue.papszFilenames = papszFilenames;
+    sJobQueue.pasStatBuf = pasStatBuf;
+    sJobQueue.panRet = panRet;
+    sJobQueue.nFlags = nFlags & ~VSI_STAT_SET_ERROR_FLAG;
+    sJobQueue.panToStat = &anToStat;
+
+    const auto threadFunc = [](void *pData)
+    {
+        JobQueue *psJobQueue = static_cast<JobQueue *>(pData);
+        while (true)
+        {
+            const int nIdx = psJobQueue->nCurIdx++;
+            if (static_cast<size_t>(nIdx) >= psJobQueue->panToStat->size())
+                break;
+            const int i = (*psJobQueue->panToStat)[nIdx];
+            psJobQueue->panRet[i] = psJobQueue->poFS->Stat(
+                psJobQueue->papszFilenames[i], &psJobQueue->pasStatBuf[i],
+                psJobQueue->nFlags);
+        }
+    };
+
+    CPLWorkerThreadPool oThreadPool;
+    if (!oThreadPool.Setup(nThreads, nullptr, nullptr))
+    {
+        threadFunc(&sJobQueue);
+        return panRet;
+    }
+    for (int i = 0; i < nThreads; ++i)
+        oThreadPool.SubmitJob(threadFunc, &sJobQueue);
+    oThreadPool.WaitCompletion();
+
+    return panRet;
+}
+
 /************************************************************************/
 /*                               Unlink()                               */
 /************************************************************************/
@@ -5592,6 +6222,25 @@ long CurlRequestHelper::perform(CURL *hCurlHandle, struct curl_slist *headers,
 // Global variable
 NetworkStatisticsLogger NetworkStatisticsLogger::gInstance{};
 int NetworkStatisticsLogger::gnEnabled = -1;  // unknown state
+bool NetworkStatisticsLogger::gbDetailed = false;
+
+const double NetworkStatisticsLogger::LatencyHistogram::adfBoundsMs[] = {
+    5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000};
+
+namespace
+{
+// Timings of the last request performed by the current thread, consumed by
+// the next NetworkStatisticsLogger::LogXXX() call of that thread.
+struct LastRequestTimings
+{
+    bool bValid = false;
+    std::string osEndpoint{};
+    double dfTimeToFirstByteMs = 0;
+    double dfTotalMs = 0;
+};
+
+thread_local LastRequestTimings tlsLastRequestTimings;
+}  // namespace
 
 static void ShowNetworkStats()
 {
@@ -5608,6 +6257,9 @@ void NetworkStatisticsLogger::ReadEnabled()
                                   "CPL_VSIL_NETWORK_STATS_ENABLED", "NO")))
             ? TRUE
             : FALSE;
+    gbDetailed = gnEnabled == TRUE &&
+                 CPLTestBool(CPLGetConfigOption(
+                     "CPL_VSIL_NETWORK_STATS_DETAILED", "NO"));
     if (bShowNetworkStats)
     {
         static bool bRegistered = false;
@@ -5710,16 +6362,57 @@ NetworkStatisticsLogger::GetCountersForContext()
     return v;
 }
 
+// Whether the current thread is in an action that lists a directory
+bool NetworkStatisticsLogger::IsInListingAction()
+{
+    for (const auto &item : m_mapThreadIdToContextPath[CPLGetPID()])
+    {
+        if (item.eType == ContextPathType::ACTION &&
+            (item.osName == "ListBucket" || item.osName == "ReadDir" ||
+             item.osName == "OpenDir"))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Attributes the timings of the last request of the current thread, if
+// any, to pszMethod.
+void NetworkStatisticsLogger::AddLastRequestLatencies(
+    const char *pszMethod, const std::vector<Counters *> &apoCounters)
+{
+    auto &sTimings = tlsLastRequestTimings;
+    if (!gbDetailed || !sTimings.bValid)
+        return;
+    sTimings.bValid = false;
+
+    const auto AddTo = [&sTimings](Latencies &sLatencies)
+    {
+        sLatencies.oTimeToFirstByte.Add(sTimings.dfTimeToFirstByteMs);
+        sLatencies.oTotal.Add(sTimings.dfTotalMs);
+    };
+    for (auto counters : apoCounters)
+        AddTo(counters->oMapMethodToLatencies[pszMethod]);
+    if (!sTimings.osEndpoint.empty())
+        AddTo(m_oMapEndpointToLatencies[sTimings.osEndpoint][pszMethod]);
+}
+
 void NetworkStatisticsLogger::LogGET(size_t nDownloadedBytes)
 {
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
-    for (auto counters : gInstance.GetCountersForContext())
+    const auto apoCounters = gInstance.GetCountersForContext();
+    const bool bListing = gbDetailed && gInstance.IsInListingAction();
+    for (auto counters : apoCounters)
     {
         counters->nGET++;
         counters->nGETDownloadedBytes += nDownloadedBytes;
+        if (bListing)
+            counters->nLIST++;
     }
+    gInstance.AddLastRequestLatencies(bListing ? "LIST" : "GET", apoCounters);
 }
 
 void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes)
@@ -5727,11 +6420,13 @@ void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes)
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
-    for (auto counters : gInstance.GetCountersForContext())
+    const auto apoCounters = gInstance.GetCountersForContext();
+    for (auto counters : apoCounters)
     {
         counters->nPUT++;
         counters->nPUTUploadedBytes += nUploadedBytes;
     }
+    gInstance.AddLastRequestLatencies("PUT", apoCounters);
 }
 
 void NetworkStatisticsLogger::LogHEAD()
@@ -5739,10 +6434,12 @@ void NetworkStatisticsLogger::LogHEAD()
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
-    for (auto counters : gInstance.GetCountersForContext())
+    const auto apoCounters = gInstance.GetCountersForContext();
+    for (auto counters : apoCounters)
     {
         counters->nHEAD++;
     }
+    gInstance.AddLastRequestLatencies("HEAD", apoCounters);
 }
 
 void NetworkStatisticsLogger::LogPOST(size_t nUploadedBytes,
@@ -5751,12 +6448,14 @@ void NetworkStatisticsLogger::LogPOST(size_t nUploadedBytes,
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
-    for (auto counters : gInstance.GetCountersForContext())
+    const auto apoCounters = gInstance.GetCountersForContext();
+    for (auto counters : apoCounters)
     {
         counters->nPOST++;
         counters->nPOSTUploadedBytes += nUploadedBytes;
         counters->nPOSTDownloadedBytes += nDownloadedBytes;
     }
+    gInstance.AddLastRequestLatencies("POST", apoCounters);
 }
 
 void NetworkStatisticsLogger::LogDELETE()
@@ -5764,19 +6463,117 @@ void NetworkStatisticsLogger::LogDELETE()
     if (!IsEnabled())
         return;
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
-    for (auto counters : gInstance.GetCountersForContext())
+    const auto apoCounters = gInstance.GetCountersForContext();
+    for (auto counters : apoCounters)
     {
         counters->nDELETE++;
     }
+    gInstance.AddLastRequestLatencies("DELETE", apoCounters);
+}
+
+// Called after each request performed by VSICURLMultiPerform(). The timings
+// are attributed to the method by the next LogXXX() call of the thread.
+void NetworkStatisticsLogger::LogRequestTimings(CURL *hCurlHandle)
+{
+    if (!IsEnabled() || !gbDetailed)
+        return;
+    auto &sTimings = tlsLastRequestTimings;
+    double dfTimeToFirstByte = 0;
+    double dfTotal = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME,
+                      &dfTimeToFirstByte);
+    curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME, &dfTotal);
+    sTimings.dfTimeToFirstByteMs = dfTimeToFirstByte * 1000;
+    sTimings.dfTotalMs = dfTotal * 1000;
+
+    // Endpoint is scheme://host[:port]
+    sTimings.osEndpoint.clear();
+    char *pszEffectiveURL = nullptr;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_EFFECTIVE_URL, &pszEffectiveURL);
+    if (pszEffectiveURL)
+    {
+        sTimings.osEndpoint = pszEffectiveURL;
+        const auto nPosScheme = sTimings.osEndpoint.find("://");
+        if (nPosScheme != std::string::npos)
+        {
+            const auto nPosPath = sTimings.osEndpoint.find_first_of(
+                "/?", nPosScheme + strlen("://"));
+            if (nPosPath != std::string::npos)
+                sTimings.osEndpoint.resize(nPosPath);
+        }
+    }
+    sTimings.bValid = true;
+}
+
+void NetworkStatisticsLogger::LogRegionCacheLookup(bool bHit)
+{
+    if (!IsEnabled() || !gbDetailed)
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    if (bHit)
+        gInstance.m_sRegionCache.nHits++;
+    else
+        gInstance.m_sRegionCache.nMisses++;
+}
+
+void NetworkStatisticsLogger::LogRegionDownloaded(const char *pszURL,
+                                                  vsi_l_offset nOffset,
+                                                  size_t nSize)
+{
+    if (!IsEnabled() || !gbDetailed)
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    gInstance.m_sRegionCache.nDownloadedBytes += nSize;
+    gInstance.m_sRegionCache
+        .oUnconsumedRegions[std::make_pair(std::string(pszURL), nOffset)] =
+        nSize;
+}
+
+void NetworkStatisticsLogger::LogRegionConsumed(const char *pszURL,
+                                                vsi_l_offset nOffset)
+{
+    if (!IsEnabled() || !gbDetailed)
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    gInstance.m_sRegionCache.oUnconsumedRegions.erase(
+        std::make_pair(std::string(pszURL), nOffset));
 }
 
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
     gInstance.m_stats = Stats();
+    gInstance.m_sRegionCache = RegionCacheStats();
+    gInstance.m_oMapEndpointToLatencies.clear();
     gnEnabled = -1;
 }
 
+void NetworkStatisticsLogger::LatencyHistogram::Add(double dfMs)
+{
+    int i = 0;
+    while (i < N_BOUNDS && dfMs > adfBoundsMs[i])
+        ++i;
+    anCounts[i]++;
+    nCount++;
+    dfSumMs += dfMs;
+}
+
+void NetworkStatisticsLogger::LatencyHistogram::AsJSON(
+    CPLJSONObject &oJSON) const
+{
+    oJSON.Add("count", nCount);
+    oJSON.Add("sum_ms", dfSumMs);
+    CPLJSONObject oBuckets;
+    GIntBig nCumulated = 0;
+    for (int i = 0; i < N_BOUNDS; ++i)
+    {
+        nCumulated += anCounts[i];
+        oBuckets.Add(CPLSPrintf("%.0f", adfBoundsMs[i]), nCumulated);
+    }
+    oBuckets.Add("+Inf", nCount);
+    oJSON.Add("buckets_ms", oBuckets);
+}
+
 void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
 {
     CPLJSONObject oMethods;
@@ -5798,6 +6595,17 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
         oMethods.Add("POST/downloaded_bytes", counters.nPOSTDownloadedBytes);
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
+    if (counters.nLIST)
+        oMethods.Add("LIST/count", counters.nLIST);
+    for (const auto &kv : counters.oMapMethodToLatencies)
+    {
+        CPLJSONObject oTimeToFirstByte;
+        kv.second.oTimeToFirstByte.AsJSON(oTimeToFirstByte);
+        oMethods.Add(kv.first + "/time_to_first_byte", oTimeToFirstByte);
+        CPLJSONObject oTotal;
+        kv.second.oTotal.AsJSON(oTotal);
+        oMethods.Add(kv.first + "/total_time", oTotal);
+    }
     oJSON.Add("methods", oMethods);
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
@@ -5836,6 +6644,48 @@ std::string NetworkStatisticsLogger::GetReportAsSerializedJSON()
 
     CPLJSONObject oJSON;
     gInstance.m_stats.AsJSON(oJSON);
+
+    if (gbDetailed)
+    {
+        const auto &sRegionCache = gInstance.m_sRegionCache;
+        CPLJSONObject oRegionCache;
+        oRegionCache.Add("hits", sRegionCache.nHits);
+        oRegionCache.Add("misses", sRegionCache.nMisses);
+        const GIntBig nLookups = sRegionCache.nHits + sRegionCache.nMisses;
+        if (nLookups)
+        {
+            oRegionCache.Add("hit_ratio",
+                             static_cast<double>(sRegionCache.nHits) /
+                                 static_cast<double>(nLookups));
+        }
+        oRegionCache.Add("downloaded_bytes", sRegionCache.nDownloadedBytes);
+        GIntBig nUnconsumedBytes = 0;
+        for (const auto &kv : sRegionCache.oUnconsumedRegions)
+            nUnconsumedBytes += kv.second;
+        oRegionCache.Add("unconsumed_bytes", nUnconsumedBytes);
+        oJSON.Add("region_cache", oRegionCache);
+
+        CPLJSONObject oEndpoints;
+        for (const auto &kvEndpoint : gInstance.m_oMapEndpointToLatencies)
+        {
+            CPLJSONObject oEndpoint;
+            for (const auto &kv : kvEndpoint.second)
+            {
+                CPLJSONObject oMethod;
+                CPLJSONObject oTimeToFirstByte;
+                kv.second.oTimeToFirstByte.AsJSON(oTimeToFirstByte);
+                oMethod.Add("time_to_first_byte", oTimeToFirstByte);
+                CPLJSONObject oTotal;
+                kv.second.oTotal.AsJSON(oTotal);
+                oMethod.Add("total_time", oTotal);
+                oEndpoint.Add(kv.first, oMethod);
+            }
+            // Not using Add(), as it would interpret the / in the URL
+            oEndpoints.AddNoSplitName(kvEndpoint.first, oEndpoint);
+        }
+        oJSON.Add("endpoints", oEndpoints);
+    }
+
     return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
 }
 
@@ -5885,10 +6735,18 @@ static lru11::Cache<std::string, cpl::FileProp> *poCacheFileProp = nullptr;
 bool VSICURLGetCachedFileProp(const char *pszURL, cpl::FileProp &oFileProp)
 {
     std::lock_guard<std::mutex> oLock(oCacheFilePropMutex);
-    return poCacheFileProp != nullptr &&
-           poCacheFileProp->tryGet(std::string(pszURL), oFileProp) &&
-           // Let a chance to use new auth parameters
-           !(oFileProp.eExists == cpl::EXIST_NO &&
+    if (poCacheFileProp == nullptr ||
+        !poCacheFileProp->tryGet(std::string(pszURL), oFileProp))
+    {
+        return false;
+    }
+    if (VSICurlCacheEntryHasExpired(oFileProp.nCacheTimestamp))
+    {
+        poCacheFileProp->remove(std::string(pszURL));
+        return false;
+    }
+    // Let a chance to use new auth parameters
+    return !(oFileProp.eExists == cpl::EXIST_NO &&
              gnGenerationAuthParameters != oFileProp.nGenerationAuthParameters);
 }
 
@@ -5903,6 +6761,7 @@ void VSICURLSetCachedFileProp(const char *pszURL, cpl::FileProp &oFileProp)
         poCacheFileProp =
             new lru11::Cache<std::string, cpl::FileProp>(100 * 1024);
     oFileProp.nGenerationAuthParameters = gnGenerationAuthParameters;
+    oFileProp.nCacheTimestamp = time(nullptr);
     poCacheFileProp->insert(std::string(pszURL), oFileProp);
 }
 
@@ -6197,6 +7056,46 @@ void VSICurlPartialClearCache(const char *pszFilenamePrefix)
         poFSHandler->PartialClearCache(pszFilenamePrefix);
 }
 
+/************************************************************************/
+/*                          VSICurlPrimeCache()                         */
+/************************************************************************/
+
+/**
+ * \brief Populate the caches of /vsicurl/ (and related file systems) with
+ * the content of a directory.
+ *
+ * This is typically used with the content of a manifest or inventory file
+ * listing the objects of a bucket, so that opening each of them does not
+ * require listing its directory or probing for side-car files (.aux.xml,
+ * .ovr, .msk, world files, ...) on the network. The directory listing is
+ * considered complete: files not in papszFilenames are assumed not to
+ * exist.
+ *
+ * The cached information is subject to the same invalidation rules as the
+ * one retrieved from the network: VSICurlClearCache(),
+ * VSICurlPartialClearCache() and the CPL_VSIL_CURL_METADATA_CACHE_TTL
+ * configuration option.
+ *
+ * @param pszDirname Directory name, e.g. "/vsis3/bucket/some/prefix".
+ * @param papszFilenames NULL-terminated list of the names (without path) of
+ *                       the files of the directory.
+ * @param panFileSizes Array of the sizes in bytes of the files, with the same
+ *                     number of elements as papszFilenames, or NULL if
+ *                     unknown.
+ * @return TRUE in case of success.
+ * @since GDAL 3.10
+ */
+
+int VSICurlPrimeCache(const char *pszDirname, CSLConstList papszFilenames,
+                      const GUIntBig *panFileSizes)
+{
+    auto poFSHandler = dynamic_cast<cpl::VSICurlFilesystemHandlerBase *>(
+        VSIFileManager::GetHandler(pszDirname));
+
+    return poFSHandler &&
+           poFSHandler->PrimeCache(pszDirname, papszFilenames, panFileSizes);
+}
+
 /************************************************************************/
 /*                        VSINetworkStatsReset()                        */
 /************************************************************************/
@@ -6232,6 +7131,15 @@ void VSINetworkStatsReset(void)
  * Statistics can also be emitted on standard output at process termination if
  * the CPL_VSIL_SHOW_NETWORK_STATS configuration option is set to YES.
  *
+ * Starting with GDAL 3.10, if the CPL_VSIL_NETWORK_STATS_DETAILED
+ * configuration option is also set to YES, the report includes, per method,
+ * "time_to_first_byte" and "total_time" histograms (with "count", "sum_ms"
+ * and cumulative "buckets_ms" members, as expected by Prometheus) and
+ * "LIST/count", as well as a top-level "endpoints" object with the
+ * histograms per scheme://host and a "region_cache" object with the "hits",
+ * "misses", "hit_ratio", "downloaded_bytes" and "unconsumed_bytes"
+ * (downloaded but never read) of the in-memory region cache.
+ *
  * Example of output:
  * <pre>
  * {
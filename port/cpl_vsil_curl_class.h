@@ -38,6 +38,7 @@
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
@@ -98,6 +99,40 @@ class FileProp
     int nMode = 0;  // st_mode member of struct stat
     bool bS3LikeRedirect = false;
     std::string ETag{};
+    // time() when the entry was put in the cache
+    time_t nCacheTimestamp = 0;
+};
+
+/************************************************************************/
+/*                           VSICurlDiskCache                           */
+/************************************************************************/
+
+// Optional persistent cache of downloaded regions, enabled by setting the
+// CPL_VSIL_CURL_DISK_CACHE_DIR configuration option. Entries are keyed by
+// URL and by ETag (or size and modification time when there is no ETag),
+// so that a change of the remote file invalidates them. Entries are written
+// to a temporary file and atomically renamed, so that a cache directory can
+// be shared by several processes.
+class VSICurlDiskCache
+{
+  public:
+    static VSICurlDiskCache *Get();
+
+    static std::string GetKey(const char *pszURL, const FileProp &oFileProp,
+                              vsi_l_offset nFileOffsetStart, int nChunkSize);
+
+    bool Read(const std::string &osKey, std::string &osData);
+    void Write(const std::string &osKey, const char *pData, size_t nSize);
+
+  private:
+    std::mutex m_oMutex{};
+    std::string m_osDir{};
+    GIntBig m_nMaxSize = 0;
+    GIntBig m_nEstimatedSize = -1;  // -1 means not yet computed
+    GIntBig m_nWrittenSinceLastScan = 0;
+
+    std::string GetFilename(const std::string &osKey) const;
+    void Prune();
 };
 
 struct CachedDirList
@@ -105,6 +140,8 @@ struct CachedDirList
     bool bGotFileList = false;
     unsigned int nGenerationAuthParameters = 0;
     CPLStringList oFileList{}; /* only file name without path */
+    // time() when the entry was put in the cache
+    time_t nCacheTimestamp = 0;
 };
 
 struct WriteFuncStruct
@@ -261,6 +298,8 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
 
     int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
              int nFlags) override;
+    int *StatMultiple(CSLConstList papszFilenames, VSIStatBufL *pasStatBuf,
+                      int nFlags) override;
     int Unlink(const char *pszFilename) override;
     int Rename(const char *oldpath, const char *newpath) override;
     int Mkdir(const char *pszDirname, long nMode) override;
@@ -289,6 +328,13 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     virtual std::string GetFSPrefix() const = 0;
     virtual bool AllowCachedDataFor(const char *pszFilename);
 
+    // Default value of GDAL_DISABLE_READDIR_ON_OPEN for that file
+    virtual const char *
+    GetDefaultDisableReadDirOnOpen(const char * /* pszFilename */)
+    {
+        return "NO";
+    }
+
     virtual bool IsLocal(const char * /* pszPath */) override
     {
         return false;
@@ -307,11 +353,13 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
         return false;
     }
 
-    std::shared_ptr<std::string> GetRegion(const char *pszURL,
-                                           vsi_l_offset nFileOffsetStart);
+    std::shared_ptr<std::string>
+    GetRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
+              const FileProp *poFilePropForDiskCache = nullptr);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData,
+                   const FileProp *poFilePropForDiskCache = nullptr);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -331,6 +379,8 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
 
     bool GetCachedDirList(const char *pszURL, CachedDirList &oCachedDirList);
     void SetCachedDirList(const char *pszURL, CachedDirList &oCachedDirList);
+    bool PrimeCache(const char *pszDirname, CSLConstList papszFilenames,
+                    const GUIntBig *panFileSizes);
     bool ExistsInCacheDirList(const std::string &osDirname, bool *pbIsDir);
 
     virtual std::string GetURLFromFilename(const std::string &osFilename);
@@ -420,6 +470,12 @@ class VSICurlHandle : public VSIVirtualHandle
     int ReadMultiRangeSingleGet(int nRanges, void **ppData,
                                 const vsi_l_offset *panOffsets,
                                 const size_t *panSizes);
+    int ReadMultiRangeParallel(int nRanges, void **ppData,
+                               const vsi_l_offset *panOffsets,
+                               const size_t *panSizes,
+                               bool bMergeConsecutiveRanges);
+    bool ReadLargeRangeInParallel(void *pBuffer, vsi_l_offset nOffset,
+                                  size_t nSize);
     std::string GetRedirectURLIfValid(bool &bHasExpired) const;
 
     void UpdateRedirectInfo(CURL *hCurlHandle,
@@ -439,6 +495,15 @@ class VSICurlHandle : public VSIVirtualHandle
     std::vector<std::unique_ptr<AdviseReadRange>> m_aoAdviseReadRanges{};
     std::thread m_oThreadAdviseRead{};
 
+    // Used by the read-ahead of sequential reads in Read()
+    std::thread m_oThreadReadAhead{};
+    vsi_l_offset m_nReadAheadStart = 0;
+    vsi_l_offset m_nReadAheadEnd = 0;  // exclusive. 0 if no read-ahead
+    void StartReadAhead(vsi_l_offset nStartOffset, int nBlocks);
+    void ReadAheadTask(const std::string &osURL, vsi_l_offset nStartOffset,
+                       vsi_l_offset nEndOffset,
+                       const FileProp &oFilePropForDiskCache);
+
   protected:
     virtual struct curl_slist *
     GetCurlHeaders(const std::string & /*osVerb*/,
@@ -588,6 +653,8 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    friend class VSIS3WriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -739,7 +806,21 @@ class VSIS3WriteHandle final : public VSIVirtualHandle
     double m_dfRetryDelay = 0.0;
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Parallel upload of parts. Only used when
+    // VSIxxx_UPLOAD_PARALLEL_PARTS > 1
+    int m_nMaxParallelParts = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poUploadThreadPool{};
+    std::unique_ptr<CPLJobQueue> m_poUploadJobQueue{};
+    std::mutex m_oMutexUpload{};
+    std::vector<GByte *> m_apabyFreeBuffers{};  // protected by m_oMutexUpload
+    bool m_bUploadError = false;                // protected by m_oMutexUpload
+
+    struct UploadPartJob;
+
     bool UploadPart();
+    bool UploadPartAsync();
+    bool WaitPendingPartUploads();
+    static void UploadPartJobFunc(void *pData);
     bool DoSinglePartPUT();
 
     static size_t ReadCallBackBufferChunked(char *buffer, size_t size,
@@ -852,12 +933,36 @@ struct CurlRequestHelper
 class NetworkStatisticsLogger
 {
     static int gnEnabled;
+    // Set by CPL_VSIL_NETWORK_STATS_DETAILED
+    static bool gbDetailed;
     static NetworkStatisticsLogger gInstance;
 
     NetworkStatisticsLogger() = default;
 
     std::mutex m_mutex{};
 
+    // Histogram of durations, with cumulative buckets in the JSON output,
+    // as expected by Prometheus.
+    struct LatencyHistogram
+    {
+        static constexpr int N_BOUNDS = 12;
+        static const double adfBoundsMs[N_BOUNDS];
+
+        // Last one is for durations greater than the last bound
+        GIntBig anCounts[N_BOUNDS + 1] = {};
+        GIntBig nCount = 0;
+        double dfSumMs = 0;
+
+        void Add(double dfMs);
+        void AsJSON(CPLJSONObject &oJSON) const;
+    };
+
+    struct Latencies
+    {
+        LatencyHistogram oTimeToFirstByte{};
+        LatencyHistogram oTotal{};
+    };
+
     struct Counters
     {
         GIntBig nHEAD = 0;
@@ -869,6 +974,21 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+
+        // Only collected when gbDetailed is set
+        GIntBig nLIST = 0;  // GET requests issued to list a directory
+        std::map<std::string, Latencies> oMapMethodToLatencies{};
+    };
+
+    // Only collected when gbDetailed is set
+    struct RegionCacheStats
+    {
+        GIntBig nHits = 0;
+        GIntBig nMisses = 0;
+        GIntBig nDownloadedBytes = 0;
+        // Regions downloaded, but not read yet
+        std::map<std::pair<std::string, vsi_l_offset>, size_t>
+            oUnconsumedRegions{};
     };
 
     enum class ContextPathType
@@ -911,10 +1031,16 @@ class NetworkStatisticsLogger
     Stats m_stats{};
     std::map<GIntBig, std::vector<ContextPathItem>>
         m_mapThreadIdToContextPath{};
+    RegionCacheStats m_sRegionCache{};
+    std::map<std::string, std::map<std::string, Latencies>>
+        m_oMapEndpointToLatencies{};
 
     static void ReadEnabled();
 
     std::vector<Counters *> GetCountersForContext();
+    bool IsInListingAction();
+    void AddLastRequestLatencies(const char *pszMethod,
+                                 const std::vector<Counters *> &apoCounters);
 
   public:
     static inline bool IsEnabled()
@@ -948,6 +1074,15 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogRequestTimings(CURL *hCurlHandle);
+
+    static void LogRegionCacheLookup(bool bHit);
+
+    static void LogRegionDownloaded(const char *pszURL, vsi_l_offset nOffset,
+                                    size_t nSize);
+
+    static void LogRegionConsumed(const char *pszURL, vsi_l_offset nOffset);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
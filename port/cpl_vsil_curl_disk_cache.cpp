@@ -0,0 +1,334 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of /vsicurl/ downloaded regions
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+constexpr char DISK_CACHE_SIGNATURE[] = "GDAL_VSICURL_CACHE_1";
+constexpr GIntBig DISK_CACHE_SIZE_DEFAULT = 1024 * 1024 * 1024;
+// Temporary files older than that are leftovers of killed processes
+constexpr time_t STALE_TEMPORARY_FILE_DELAY = 3600;
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+/** Return the disk cache, or nullptr if CPL_VSIL_CURL_DISK_CACHE_DIR is not
+ * set. */
+VSICurlDiskCache *VSICurlDiskCache::Get()
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return nullptr;
+
+    static VSICurlDiskCache oCache;
+    std::lock_guard<std::mutex> oLock(oCache.m_oMutex);
+    const GIntBig nMaxSize = CPLAtoGIntBig(CPLGetConfigOption(
+        "CPL_VSIL_CURL_DISK_CACHE_SIZE",
+        CPLSPrintf(CPL_FRMT_GIB, DISK_CACHE_SIZE_DEFAULT)));
+    if (oCache.m_osDir != pszDir || oCache.m_nMaxSize != nMaxSize)
+    {
+        oCache.m_osDir = pszDir;
+        oCache.m_nMaxSize = std::max<GIntBig>(0, nMaxSize);
+        oCache.m_nEstimatedSize = -1;
+        oCache.m_nWrittenSinceLastScan = 0;
+    }
+    return &oCache;
+}
+
+/************************************************************************/
+/*                               GetKey()                               */
+/************************************************************************/
+
+/** Return the key of a region, or an empty string if the properties of the
+ * file are not sufficient to detect a later change of its content. */
+std::string VSICurlDiskCache::GetKey(const char *pszURL,
+                                     const FileProp &oFileProp,
+                                     vsi_l_offset nFileOffsetStart,
+                                     int nChunkSize)
+{
+    if (oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize)
+        return std::string();
+
+    std::string osKey(pszURL);
+    osKey += '\n';
+    if (!oFileProp.ETag.empty())
+    {
+        osKey += "etag=";
+        osKey += oFileProp.ETag;
+    }
+    else if (oFileProp.mTime > 0)
+    {
+        osKey += CPLSPrintf("mtime=" CPL_FRMT_GIB,
+                            static_cast<GIntBig>(oFileProp.mTime));
+    }
+    else
+    {
+        return std::string();
+    }
+    osKey += CPLSPrintf("\nsize=" CPL_FRMT_GUIB,
+                        static_cast<GUIntBig>(oFileProp.fileSize));
+    osKey += CPLSPrintf("\nchunk=%d\noffset=" CPL_FRMT_GUIB, nChunkSize,
+                        static_cast<GUIntBig>(nFileOffsetStart));
+    return osKey;
+}
+
+/************************************************************************/
+/*                             GetFilename()                            */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetFilename(const std::string &osKey) const
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+    // Spread entries over 256 sub-directories
+    const std::string osSubDir =
+        CPLFormFilename(m_osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr);
+    return CPLFormFilename(osSubDir.c_str(), osHex.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+/** Read the content of a region. Return false if it is not in the cache. */
+bool VSICurlDiskCache::Read(const std::string &osKey, std::string &osData)
+{
+    std::string osFilename;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_nMaxSize == 0)
+            return false;
+        osFilename = GetFilename(osKey);
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+
+    // Layout: signature, key size (uint32 LSB), key, data size (uint64 LSB),
+    // data.
+    bool bOK = false;
+    char szSignature[sizeof(DISK_CACHE_SIGNATURE)] = {};
+    GUInt32 nKeySize = 0;
+    if (VSIFReadL(szSignature, sizeof(szSignature), 1, fp) == 1 &&
+        memcmp(szSignature, DISK_CACHE_SIGNATURE, sizeof(szSignature)) == 0 &&
+        VSIFReadL(&nKeySize, sizeof(nKeySize), 1, fp) == 1)
+    {
+        CPL_LSBPTR32(&nKeySize);
+        if (nKeySize == osKey.size())
+        {
+            std::string osStoredKey;
+            osStoredKey.resize(nKeySize);
+            GUInt64 nDataSize = 0;
+            // The key is checked to rule out hash collisions
+            if (VSIFReadL(&osStoredKey[0], nKeySize, 1, fp) == 1 &&
+                osStoredKey == osKey &&
+                VSIFReadL(&nDataSize, sizeof(nDataSize), 1, fp) == 1)
+            {
+                CPL_LSBPTR64(&nDataSize);
+                if (nDataSize > 0 && nDataSize <= 10 * 1024 * 1024)
+                {
+                    osData.resize(static_cast<size_t>(nDataSize));
+                    bOK = VSIFReadL(&osData[0], osData.size(), 1, fp) == 1;
+                }
+            }
+        }
+    }
+    VSIFCloseL(fp);
+    if (!bOK)
+    {
+        CPLDebug("VSICURL", "Ignoring invalid disk cache entry %s",
+                 osFilename.c_str());
+        osData.clear();
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                                Write()                               */
+/************************************************************************/
+
+/** Store the content of a region in the cache. Errors are silently ignored,
+ * as the cache is just an optimization. */
+void VSICurlDiskCache::Write(const std::string &osKey, const char *pData,
+                             size_t nSize)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    const GIntBig nEntrySize = static_cast<GIntBig>(
+        sizeof(DISK_CACHE_SIGNATURE) + sizeof(GUInt32) + osKey.size() +
+        sizeof(GUInt64) + nSize);
+    if (nSize == 0 || nEntrySize > m_nMaxSize)
+        return;
+
+    const std::string osFilename = GetFilename(osKey);
+    const std::string osSubDir = CPLGetPath(osFilename.c_str());
+    VSIStatBufL sStat;
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0)
+        VSIMkdirRecursive(osSubDir.c_str(), 0755);
+
+    // Write into a temporary file, then atomically rename it, so that
+    // concurrent readers, possibly in other processes, never see a partial
+    // entry.
+    static std::atomic<int> nCounter{0};
+    const std::string osTmpFilename(
+        CPLSPrintf("%s.%d_%d.tmp", osFilename.c_str(), CPLGetCurrentProcessID(),
+                   nCounter++));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+        return;
+    GUInt32 nKeySize = static_cast<GUInt32>(osKey.size());
+    CPL_LSBPTR32(&nKeySize);
+    GUInt64 nDataSize = nSize;
+    CPL_LSBPTR64(&nDataSize);
+    bool bOK =
+        VSIFWriteL(DISK_CACHE_SIGNATURE, sizeof(DISK_CACHE_SIGNATURE), 1,
+                   fp) == 1 &&
+        VSIFWriteL(&nKeySize, sizeof(nKeySize), 1, fp) == 1 &&
+        VSIFWriteL(osKey.data(), osKey.size(), 1, fp) == 1 &&
+        VSIFWriteL(&nDataSize, sizeof(nDataSize), 1, fp) == 1 &&
+        VSIFWriteL(pData, nSize, 1, fp) == 1;
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        // Can happen on Windows if another process has just created the
+        // same entry.
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    if (m_nEstimatedSize >= 0)
+        m_nEstimatedSize += nEntrySize;
+    m_nWrittenSinceLastScan += nEntrySize;
+    // Other processes may also fill the cache, so rescan it regularly
+    if (m_nEstimatedSize < 0 || m_nEstimatedSize > m_nMaxSize ||
+        m_nWrittenSinceLastScan > m_nMaxSize / 10)
+    {
+        Prune();
+    }
+}
+
+/************************************************************************/
+/*                                Prune()                               */
+/************************************************************************/
+
+// Must be called with m_oMutex held. Compute the size of the cache, and
+// if it exceeds the limit, delete the oldest entries until the size is below
+// 90% of it.
+void VSICurlDiskCache::Prune()
+{
+    struct Entry
+    {
+        std::string osFilename;
+        GIntBig nSize;
+        time_t nMTime;
+    };
+
+    std::vector<Entry> aoEntries;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    const CPLStringList aosSubDirs(VSIReadDir(m_osDir.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2)
+            continue;
+        const std::string osSubDir =
+            CPLFormFilename(m_osDir.c_str(), pszSubDir, nullptr);
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            if (pszFile[0] == '.')
+                continue;
+            std::string osFilename =
+                CPLFormFilename(osSubDir.c_str(), pszFile, nullptr);
+            VSIStatBufL sStat;
+            if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+                !VSI_ISREG(sStat.st_mode))
+            {
+                continue;
+            }
+            if (EQUAL(CPLGetExtension(pszFile), "tmp"))
+            {
+                if (nNow - sStat.st_mtime > STALE_TEMPORARY_FILE_DELAY)
+                    VSIUnlink(osFilename.c_str());
+                continue;
+            }
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            aoEntries.push_back(Entry{std::move(osFilename),
+                                      static_cast<GIntBig>(sStat.st_size),
+                                      sStat.st_mtime});
+        }
+    }
+
+    if (nTotalSize > m_nMaxSize)
+    {
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        const GIntBig nTargetSize = m_nMaxSize / 10 * 9;
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            // Failure is fine: another process may have deleted it already
+            VSIUnlink(oEntry.osFilename.c_str());
+            nTotalSize -= oEntry.nSize;
+        }
+    }
+
+    m_nEstimatedSize = nTotalSize;
+    m_nWrittenSinceLastScan = 0;
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // HAVE_CURL
@@ -97,6 +97,10 @@
 #include "libdeflate.h"
 #endif
 
+#ifdef HAVE_ISAL
+#include "isa-l/igzip_lib.h"
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <limits>
@@ -345,6 +349,8 @@ class VSIDeflate64Handle final : public VSIVirtualHandle
 };
 #endif
 
+struct VSIGZipIndex;
+
 class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
 {
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipFilesystemHandler)
@@ -352,6 +358,10 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
     CPLMutex *hMutex = nullptr;
     VSIGZipHandle *poHandleLastGZipFile = nullptr;
     bool m_bInSaveInfo = false;
+    std::string m_osLastIndexFilename{};
+    std::shared_ptr<const VSIGZipIndex> m_poLastIndex{};
+
+    VSIVirtualHandle *OpenIndexed(const char *pszBaseFilename);
 
   public:
     VSIGZipFilesystemHandler() = default;
@@ -2894,6 +2904,716 @@ vsi_l_offset VSIGZipWriteHandle::Tell()
     return nCurOffset;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSIGZipIndex                              */
+/* ==================================================================== */
+/************************************************************************/
+
+// Access points into a single-member gzip stream, located at deflate block
+// boundaries, from which decompression can be resumed without decoding the
+// previous data, as in zlib's examples/zran.c. Each access point stores the
+// 32 KB of uncompressed data that precede it, which is the dictionary
+// needed to resume. This enables decompressing several regions of the
+// file concurrently.
+
+constexpr int GZIP_INDEX_WINDOW_SIZE = 32768;
+constexpr const char *GZIP_INDEX_SIGNATURE = "GDALGZIX";
+constexpr uint32_t GZIP_INDEX_VERSION = 1;
+
+struct VSIGZipIndex
+{
+    struct AccessPoint
+    {
+        // Offset of the first byte fully after the access point
+        vsi_l_offset nCompressedOffset = 0;
+        vsi_l_offset nUncompressedOffset = 0;
+        // Number of bits of the previous byte that belong to the access point
+        int nBits = 0;
+        // Deflate compressed dictionary
+        std::string osCompressedWindow{};
+    };
+
+    vsi_l_offset nCompressedSize = 0;
+    vsi_l_offset nUncompressedSize = 0;
+    std::vector<AccessPoint> asPoints{};
+
+    static std::unique_ptr<VSIGZipIndex>
+    Build(VSIVirtualHandle *poHandle, vsi_l_offset nCompressedSize,
+          vsi_l_offset nSpacing);
+    static std::unique_ptr<VSIGZipIndex> Load(const char *pszFilename,
+                                              vsi_l_offset nCompressedSize);
+    bool Save(const char *pszFilename) const;
+
+    size_t GetPointIdx(vsi_l_offset nUncompressedOffset) const;
+    vsi_l_offset GetSegmentSize(size_t iPoint) const;
+    vsi_l_offset GetSegmentCompressedStart(size_t iPoint) const;
+    vsi_l_offset GetSegmentCompressedEnd(size_t iPoint) const;
+    bool GetWindow(size_t iPoint, std::vector<GByte> &abyWindow) const;
+    bool Inflate(size_t iPoint, const GByte *pabyIn, size_t nInSize,
+                 GByte *pabyOut, size_t nOutSize) const;
+};
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+// Decompresses the whole stream, recording an access point every nSpacing
+// uncompressed bytes. Returns nullptr for multi-member or corrupted files.
+std::unique_ptr<VSIGZipIndex>
+VSIGZipIndex::Build(VSIVirtualHandle *poHandle, vsi_l_offset nCompressedSize,
+                    vsi_l_offset nSpacing)
+{
+    if (poHandle->Seek(0, SEEK_SET) != 0)
+        return nullptr;
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    // 15 + 32: window of 32 KB, and automatic gzip header detection
+    if (inflateInit2(&sStream, 15 + 32) != Z_OK)
+        return nullptr;
+
+    auto poIndex = std::make_unique<VSIGZipIndex>();
+    poIndex->nCompressedSize = nCompressedSize;
+
+    std::vector<GByte> abyInput(Z_BUFSIZE);
+    std::vector<GByte> abyWindow(GZIP_INDEX_WINDOW_SIZE);
+    std::vector<GByte> abyOrderedWindow(GZIP_INDEX_WINDOW_SIZE);
+    vsi_l_offset nTotalIn = 0;
+    vsi_l_offset nTotalOut = 0;
+    vsi_l_offset nLastPointOut = 0;
+    int ret = Z_OK;
+    do
+    {
+        sStream.avail_in = static_cast<uInt>(
+            poHandle->Read(abyInput.data(), 1, abyInput.size()));
+        if (sStream.avail_in == 0)
+        {
+            ret = Z_DATA_ERROR;  // truncated file
+            break;
+        }
+        sStream.next_in = abyInput.data();
+        do
+        {
+            // The output buffer is a circular buffer holding the last
+            // 32 KB of uncompressed data
+            if (sStream.avail_out == 0)
+            {
+                sStream.avail_out = GZIP_INDEX_WINDOW_SIZE;
+                sStream.next_out = abyWindow.data();
+            }
+
+            nTotalIn += sStream.avail_in;
+            nTotalOut += sStream.avail_out;
+            // Z_BLOCK: stop at the end of each deflate block header
+            ret = inflate(&sStream, Z_BLOCK);
+            nTotalIn -= sStream.avail_in;
+            nTotalOut -= sStream.avail_out;
+            if (ret != Z_OK)
+                break;
+
+            // data_type & 128: at the end of a block header.
+            // data_type & 64: of the last block.
+            if ((sStream.data_type & 128) != 0 &&
+                (sStream.data_type & 64) == 0 &&
+                (nTotalOut == 0 || nTotalOut - nLastPointOut > nSpacing))
+            {
+                const size_t nLeft = sStream.avail_out;
+                memcpy(abyOrderedWindow.data(),
+                       abyWindow.data() + GZIP_INDEX_WINDOW_SIZE - nLeft,
+                       nLeft);
+                memcpy(abyOrderedWindow.data() + nLeft, abyWindow.data(),
+                       GZIP_INDEX_WINDOW_SIZE - nLeft);
+
+                AccessPoint sPoint;
+                sPoint.nCompressedOffset = nTotalIn;
+                sPoint.nUncompressedOffset = nTotalOut;
+                sPoint.nBits = sStream.data_type & 7;
+                uLongf nCompressedWindowSize =
+                    compressBound(GZIP_INDEX_WINDOW_SIZE);
+                sPoint.osCompressedWindow.resize(nCompressedWindowSize);
+                if (compress2(reinterpret_cast<Bytef *>(
+                                  &sPoint.osCompressedWindow[0]),
+                              &nCompressedWindowSize, abyOrderedWindow.data(),
+                              GZIP_INDEX_WINDOW_SIZE, Z_BEST_SPEED) != Z_OK)
+                {
+                    ret = Z_MEM_ERROR;
+                    break;
+                }
+                sPoint.osCompressedWindow.resize(nCompressedWindowSize);
+                poIndex->asPoints.push_back(std::move(sPoint));
+                nLastPointOut = nTotalOut;
+            }
+        } while (sStream.avail_in != 0);
+    } while (ret == Z_OK);
+    inflateEnd(&sStream);
+
+    if (ret != Z_STREAM_END)
+    {
+        CPLDebug("GZIP", "Cannot build index: inflate() returned %d", ret);
+        return nullptr;
+    }
+    if (nTotalIn != nCompressedSize)
+    {
+        // Concatenated gzip members, or trailing garbage
+        CPLDebug("GZIP", "Cannot build index: data after end of gzip stream");
+        return nullptr;
+    }
+    if (poIndex->asPoints.empty())
+    {
+        // Single deflate block: nothing to parallelize
+        return nullptr;
+    }
+    poIndex->nUncompressedSize = nTotalOut;
+    CPLDebug("GZIP", "Built index of %d access points",
+             static_cast<int>(poIndex->asPoints.size()));
+    return poIndex;
+}
+
+/************************************************************************/
+/*                                Load()                                */
+/************************************************************************/
+
+// Loads an index written by Save(), if it matches the compressed size.
+std::unique_ptr<VSIGZipIndex>
+VSIGZipIndex::Load(const char *pszFilename, vsi_l_offset nCompressedSize)
+{
+    VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+    if (!fp)
+        return nullptr;
+
+    auto poIndex = std::make_unique<VSIGZipIndex>();
+    const auto ReadUInt32 = [fp](uint32_t &nVal)
+    {
+        if (VSIFReadL(&nVal, sizeof(nVal), 1, fp) != 1)
+            return false;
+        CPL_LSBPTR32(&nVal);
+        return true;
+    };
+    const auto ReadUInt64 = [fp](uint64_t &nVal)
+    {
+        if (VSIFReadL(&nVal, sizeof(nVal), 1, fp) != 1)
+            return false;
+        CPL_LSBPTR64(&nVal);
+        return true;
+    };
+
+    char szSignature[8] = {};
+    uint32_t nVersion = 0;
+    uint64_t nFileCompressedSize = 0;
+    uint64_t nUncompressedSize = 0;
+    uint32_t nPoints = 0;
+    bool bOK =
+        VSIFReadL(szSignature, sizeof(szSignature), 1, fp) == 1 &&
+        memcmp(szSignature, GZIP_INDEX_SIGNATURE, sizeof(szSignature)) == 0 &&
+        ReadUInt32(nVersion) && nVersion == GZIP_INDEX_VERSION &&
+        ReadUInt64(nFileCompressedSize) &&
+        nFileCompressedSize == nCompressedSize &&
+        ReadUInt64(nUncompressedSize) && ReadUInt32(nPoints);
+    poIndex->nCompressedSize = nCompressedSize;
+    poIndex->nUncompressedSize = nUncompressedSize;
+    for (uint32_t i = 0; bOK && i < nPoints; ++i)
+    {
+        AccessPoint sPoint;
+        uint64_t nCompressedOffset = 0;
+        uint64_t nUncompressedOffset = 0;
+        GByte nBits = 0;
+        uint32_t nCompressedWindowSize = 0;
+        bOK = ReadUInt64(nCompressedOffset) &&
+              nCompressedOffset <= nCompressedSize &&
+              ReadUInt64(nUncompressedOffset) &&
+              nUncompressedOffset <= nUncompressedSize &&
+              (poIndex->asPoints.empty() ||
+               nUncompressedOffset >=
+                   poIndex->asPoints.back().nUncompressedOffset) &&
+              VSIFReadL(&nBits, 1, 1, fp) == 1 && nBits < 8 &&
+              ReadUInt32(nCompressedWindowSize) &&
+              nCompressedWindowSize <= compressBound(GZIP_INDEX_WINDOW_SIZE);
+        if (bOK)
+        {
+            sPoint.nCompressedOffset = nCompressedOffset;
+            sPoint.nUncompressedOffset = nUncompressedOffset;
+            sPoint.nBits = nBits;
+            sPoint.osCompressedWindow.resize(nCompressedWindowSize);
+            bOK = VSIFReadL(&sPoint.osCompressedWindow[0], 1,
+                            nCompressedWindowSize,
+                            fp) == nCompressedWindowSize;
+            poIndex->asPoints.push_back(std::move(sPoint));
+        }
+    }
+    VSIFCloseL(fp);
+
+    if (!bOK || poIndex->asPoints.empty() ||
+        poIndex->asPoints[0].nUncompressedOffset != 0)
+    {
+        CPLDebug("GZIP", "Ignoring invalid or outdated index %s", pszFilename);
+        return nullptr;
+    }
+    return poIndex;
+}
+
+/************************************************************************/
+/*                                Save()                                */
+/************************************************************************/
+
+bool VSIGZipIndex::Save(const char *pszFilename) const
+{
+    VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+    if (!fp)
+        return false;
+
+    const auto WriteUInt32 = [fp](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        return VSIFWriteL(&nVal, sizeof(nVal), 1, fp) == 1;
+    };
+    const auto WriteUInt64 = [fp](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        return VSIFWriteL(&nVal, sizeof(nVal), 1, fp) == 1;
+    };
+
+    bool bOK = VSIFWriteL(GZIP_INDEX_SIGNATURE, 8, 1, fp) == 1 &&
+               WriteUInt32(GZIP_INDEX_VERSION) &&
+               WriteUInt64(nCompressedSize) && WriteUInt64(nUncompressedSize) &&
+               WriteUInt32(static_cast<uint32_t>(asPoints.size()));
+    for (const auto &sPoint : asPoints)
+    {
+        if (!bOK)
+            break;
+        const GByte nBits = static_cast<GByte>(sPoint.nBits);
+        bOK = WriteUInt64(sPoint.nCompressedOffset) &&
+              WriteUInt64(sPoint.nUncompressedOffset) &&
+              VSIFWriteL(&nBits, 1, 1, fp) == 1 &&
+              WriteUInt32(
+                  static_cast<uint32_t>(sPoint.osCompressedWindow.size())) &&
+              VSIFWriteL(sPoint.osCompressedWindow.data(), 1,
+                         sPoint.osCompressedWindow.size(),
+                         fp) == sPoint.osCompressedWindow.size();
+    }
+    if (VSIFCloseL(fp) != 0)
+        bOK = false;
+    if (!bOK)
+        VSIUnlink(pszFilename);
+    return bOK;
+}
+
+/************************************************************************/
+/*                            GetPointIdx()                             */
+/************************************************************************/
+
+// Returns the index of the last access point at or before the offset.
+size_t VSIGZipIndex::GetPointIdx(vsi_l_offset nUncompressedOffset) const
+{
+    const auto oIter =
+        std::upper_bound(asPoints.begin(), asPoints.end(), nUncompressedOffset,
+                         [](vsi_l_offset nOffset, const AccessPoint &sPoint)
+                         { return nOffset < sPoint.nUncompressedOffset; });
+    CPLAssert(oIter != asPoints.begin());
+    return static_cast<size_t>(oIter - asPoints.begin()) - 1;
+}
+
+/************************************************************************/
+/*                          GetSegmentSize()                            */
+/************************************************************************/
+
+// Uncompressed size between an access point and the next one.
+vsi_l_offset VSIGZipIndex::GetSegmentSize(size_t iPoint) const
+{
+    const vsi_l_offset nEnd = iPoint + 1 < asPoints.size()
+                                  ? asPoints[iPoint + 1].nUncompressedOffset
+                                  : nUncompressedSize;
+    return nEnd - asPoints[iPoint].nUncompressedOffset;
+}
+
+/************************************************************************/
+/*                     GetSegmentCompressedStart()                      */
+/************************************************************************/
+
+vsi_l_offset VSIGZipIndex::GetSegmentCompressedStart(size_t iPoint) const
+{
+    const auto &sPoint = asPoints[iPoint];
+    return sPoint.nCompressedOffset - (sPoint.nBits ? 1 : 0);
+}
+
+/************************************************************************/
+/*                      GetSegmentCompressedEnd()                       */
+/************************************************************************/
+
+vsi_l_offset VSIGZipIndex::GetSegmentCompressedEnd(size_t iPoint) const
+{
+    // Include a few more bytes than strictly needed, for inflate() to be
+    // able to finish the last symbols of the segment.
+    constexpr vsi_l_offset MARGIN = 64;
+    if (iPoint + 1 < asPoints.size())
+    {
+        return std::min(nCompressedSize,
+                        asPoints[iPoint + 1].nCompressedOffset + MARGIN);
+    }
+    return nCompressedSize;
+}
+
+/************************************************************************/
+/*                             GetWindow()                              */
+/************************************************************************/
+
+// Returns the uncompressed dictionary of access point iPoint.
+bool VSIGZipIndex::GetWindow(size_t iPoint, std::vector<GByte> &abyWindow) const
+{
+    const auto &sPoint = asPoints[iPoint];
+    abyWindow.resize(GZIP_INDEX_WINDOW_SIZE);
+    uLongf nWindowSize = GZIP_INDEX_WINDOW_SIZE;
+    return uncompress(abyWindow.data(), &nWindowSize,
+                      reinterpret_cast<const Bytef *>(
+                          sPoint.osCompressedWindow.data()),
+                      static_cast<uLong>(sPoint.osCompressedWindow.size())) ==
+               Z_OK &&
+           nWindowSize == GZIP_INDEX_WINDOW_SIZE;
+}
+
+/************************************************************************/
+/*                              Inflate()                               */
+/************************************************************************/
+
+// Decompresses nOutSize bytes from access point iPoint, pabyIn starting at
+// GetSegmentCompressedStart(iPoint). Thread-safe.
+bool VSIGZipIndex::Inflate(size_t iPoint, const GByte *pabyIn, size_t nInSize,
+                           GByte *pabyOut, size_t nOutSize) const
+{
+    const auto &sPoint = asPoints[iPoint];
+    if (sPoint.nBits && nInSize == 0)
+        return false;
+
+#ifdef HAVE_ISAL
+    // ISA-L igzip is faster than zlib for streaming decompression, and
+    // supports resuming at an arbitrary bit position with a dictionary.
+    struct inflate_state sState;
+    isal_inflate_init(&sState);
+    sState.crc_flag = ISAL_DEFLATE;
+    if (sPoint.nBits)
+    {
+        sState.read_in = pabyIn[0] >> (8 - sPoint.nBits);
+        sState.read_in_length = sPoint.nBits;
+        ++pabyIn;
+        --nInSize;
+    }
+    if (sPoint.nUncompressedOffset > 0)
+    {
+        std::vector<GByte> abyWindow;
+        if (!GetWindow(iPoint, abyWindow) ||
+            isal_inflate_set_dict(&sState, abyWindow.data(),
+                                  GZIP_INDEX_WINDOW_SIZE) != ISAL_DECOMP_OK)
+        {
+            return false;
+        }
+    }
+    sState.next_in = const_cast<uint8_t *>(pabyIn);
+    sState.avail_in = static_cast<uint32_t>(nInSize);
+    sState.next_out = pabyOut;
+    sState.avail_out = static_cast<uint32_t>(nOutSize);
+    const int ret = isal_inflate(&sState);
+    return (ret == ISAL_DECOMP_OK || ret == ISAL_END_INPUT) &&
+           sState.avail_out == 0;
+#else
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    // Raw deflate stream
+    if (inflateInit2(&sStream, -15) != Z_OK)
+        return false;
+
+    bool bOK = true;
+    if (sPoint.nBits)
+    {
+        bOK = inflatePrime(&sStream, sPoint.nBits,
+                           pabyIn[0] >> (8 - sPoint.nBits)) == Z_OK;
+        ++pabyIn;
+        --nInSize;
+    }
+    if (bOK && sPoint.nUncompressedOffset > 0)
+    {
+        std::vector<GByte> abyWindow;
+        bOK = GetWindow(iPoint, abyWindow) &&
+              inflateSetDictionary(&sStream, abyWindow.data(),
+                                   GZIP_INDEX_WINDOW_SIZE) == Z_OK;
+    }
+    if (bOK)
+    {
+        sStream.next_in = const_cast<Bytef *>(pabyIn);
+        sStream.avail_in = static_cast<uInt>(nInSize);
+        sStream.next_out = pabyOut;
+        sStream.avail_out = static_cast<uInt>(nOutSize);
+        const int ret = inflate(&sStream, Z_NO_FLUSH);
+        bOK = (ret == Z_OK || ret == Z_STREAM_END) && sStream.avail_out == 0;
+    }
+    inflateEnd(&sStream);
+    return bOK;
+#endif
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSIGZipIndexedHandle                           */
+/* ==================================================================== */
+/************************************************************************/
+
+// Read-only handle on a gzip file with a VSIGZipIndex, that decompresses
+// the segments between consecutive access points in parallel, and keeps
+// the last decompressed segments to serve subsequent reads.
+class VSIGZipIndexedHandle final : public VSIVirtualHandle
+{
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    std::shared_ptr<const VSIGZipIndex> m_poIndex{};
+    int m_nThreads = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+    vsi_l_offset m_nCurPos = 0;
+    bool m_bEOF = false;
+
+    // Decompressed segments, starting at access point m_iFirstCachedPoint
+    size_t m_iFirstCachedPoint = 0;
+    std::vector<std::vector<GByte>> m_aabyCachedSegments{};
+
+    bool DecompressSegments(size_t iFirstPoint);
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipIndexedHandle)
+
+  public:
+    VSIGZipIndexedHandle(VSIVirtualHandle *poBaseHandle,
+                         const std::shared_ptr<const VSIGZipIndex> &poIndex,
+                         int nThreads)
+        : m_poBaseHandle(poBaseHandle), m_poIndex(poIndex), m_nThreads(nThreads)
+    {
+    }
+
+    ~VSIGZipIndexedHandle() override;
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurPos;
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+
+    size_t Write(const void *, size_t, size_t) override
+    {
+        return 0;
+    }
+
+    int Eof() override
+    {
+        return m_bEOF;
+    }
+
+    int Close() override;
+};
+
+/************************************************************************/
+/*                       ~VSIGZipIndexedHandle()                        */
+/************************************************************************/
+
+VSIGZipIndexedHandle::~VSIGZipIndexedHandle()
+{
+    VSIGZipIndexedHandle::Close();
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIGZipIndexedHandle::Close()
+{
+    int nRet = 0;
+    if (m_poBaseHandle)
+    {
+        nRet = m_poBaseHandle->Close();
+        delete m_poBaseHandle;
+        m_poBaseHandle = nullptr;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIGZipIndexedHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+        m_nCurPos = nOffset;
+    else if (nWhence == SEEK_CUR)
+        m_nCurPos += nOffset;
+    else
+        m_nCurPos = m_poIndex->nUncompressedSize + nOffset;
+    return 0;
+}
+
+/************************************************************************/
+/*                        DecompressSegments()                          */
+/************************************************************************/
+
+// Decompresses up to m_nThreads segments starting at iFirstPoint, reading
+// their compressed data in a single request.
+bool VSIGZipIndexedHandle::DecompressSegments(size_t iFirstPoint)
+{
+    const size_t nSegments = std::min(static_cast<size_t>(m_nThreads),
+                                      m_poIndex->asPoints.size() - iFirstPoint);
+    const vsi_l_offset nCompressedStart =
+        m_poIndex->GetSegmentCompressedStart(iFirstPoint);
+    const vsi_l_offset nCompressedEnd =
+        m_poIndex->GetSegmentCompressedEnd(iFirstPoint + nSegments - 1);
+
+    m_iFirstCachedPoint = 0;
+    m_aabyCachedSegments.clear();
+
+    constexpr vsi_l_offset MAX_COMPRESSED_BYTES =
+        std::numeric_limits<int>::max();
+    if (nCompressedEnd - nCompressedStart > MAX_COMPRESSED_BYTES)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Too large compressed segments. Decrease "
+                 "CPL_VSIL_GZIP_INDEX_SPACING");
+        return false;
+    }
+    std::vector<GByte> abyCompressed;
+    try
+    {
+        abyCompressed.resize(
+            static_cast<size_t>(nCompressedEnd - nCompressedStart));
+        m_aabyCachedSegments.resize(nSegments);
+        for (size_t i = 0; i < nSegments; ++i)
+        {
+            m_aabyCachedSegments[i].resize(static_cast<size_t>(
+                m_poIndex->GetSegmentSize(iFirstPoint + i)));
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in VSIGZipIndexedHandle::DecompressSegments()");
+        m_aabyCachedSegments.clear();
+        return false;
+    }
+
+    if (m_poBaseHandle->Seek(nCompressedStart, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(abyCompressed.data(), 1, abyCompressed.size()) !=
+            abyCompressed.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read compressed data");
+        m_aabyCachedSegments.clear();
+        return false;
+    }
+
+    struct Job
+    {
+        const VSIGZipIndex *poIndex = nullptr;
+        size_t iPoint = 0;
+        const GByte *pabyIn = nullptr;
+        size_t nInSize = 0;
+        std::vector<GByte> *pabyOut = nullptr;
+        bool bOK = false;
+
+        static void Func(void *pData)
+        {
+            auto psJob = static_cast<Job *>(pData);
+            psJob->bOK = psJob->poIndex->Inflate(
+                psJob->iPoint, psJob->pabyIn, psJob->nInSize,
+                psJob->pabyOut->data(), psJob->pabyOut->size());
+        }
+    };
+
+    std::vector<Job> asJobs(nSegments);
+    std::vector<void *> apJobs;
+    for (size_t i = 0; i < nSegments; ++i)
+    {
+        const size_t iPoint = iFirstPoint + i;
+        const vsi_l_offset nStart =
+            m_poIndex->GetSegmentCompressedStart(iPoint);
+        const vsi_l_offset nEnd = m_poIndex->GetSegmentCompressedEnd(iPoint);
+        auto &sJob = asJobs[i];
+        sJob.poIndex = m_poIndex.get();
+        sJob.iPoint = iPoint;
+        sJob.pabyIn = abyCompressed.data() + (nStart - nCompressedStart);
+        sJob.nInSize = static_cast<size_t>(nEnd - nStart);
+        sJob.pabyOut = &m_aabyCachedSegments[i];
+        apJobs.push_back(&sJob);
+    }
+
+    if (nSegments > 1 && m_poPool == nullptr)
+    {
+        m_poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!m_poPool->Setup(m_nThreads, nullptr, nullptr, false))
+            m_poPool.reset();
+    }
+    if (nSegments > 1 && m_poPool)
+    {
+        m_poPool->SubmitJobs(Job::Func, apJobs);
+        m_poPool->WaitCompletion();
+    }
+    else
+    {
+        for (void *pJob : apJobs)
+            Job::Func(pJob);
+    }
+
+    for (const auto &sJob : asJobs)
+    {
+        if (!sJob.bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decompression of gzip segment %d failed",
+                     static_cast<int>(sJob.iPoint));
+            m_aabyCachedSegments.clear();
+            return false;
+        }
+    }
+    m_iFirstCachedPoint = iFirstPoint;
+    return true;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIGZipIndexedHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
+{
+    const size_t nToRead = nSize * nMemb;
+    if (nToRead == 0)
+        return 0;
+
+    GByte *pabyOut = static_cast<GByte *>(pBuffer);
+    size_t nRead = 0;
+    while (nRead < nToRead)
+    {
+        if (m_nCurPos >= m_poIndex->nUncompressedSize)
+        {
+            m_bEOF = true;
+            break;
+        }
+
+        const size_t iPoint = m_poIndex->GetPointIdx(m_nCurPos);
+        if (iPoint < m_iFirstCachedPoint ||
+            iPoint >= m_iFirstCachedPoint + m_aabyCachedSegments.size())
+        {
+            if (!DecompressSegments(iPoint))
+                break;
+        }
+
+        const auto &abySegment =
+            m_aabyCachedSegments[iPoint - m_iFirstCachedPoint];
+        const size_t nOffsetInSegment = static_cast<size_t>(
+            m_nCurPos - m_poIndex->asPoints[iPoint].nUncompressedOffset);
+        const size_t nChunk =
+            std::min(abySegment.size() - nOffsetInSegment, nToRead - nRead);
+        memcpy(pabyOut + nRead, abySegment.data() + nOffsetInSegment, nChunk);
+        nRead += nChunk;
+        m_nCurPos += nChunk;
+    }
+
+    return nRead / nSize;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIGZipFilesystemHandler                       */
@@ -3001,6 +3721,14 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /*      Otherwise we are in the read access case.                       */
     /* -------------------------------------------------------------------- */
 
+    if (CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO")))
+    {
+        VSIVirtualHandle *poHandle =
+            OpenIndexed(pszFilename + strlen("/vsigzip/"));
+        if (poHandle)
+            return poHandle;
+    }
+
     VSIGZipHandle *poGZIPHandle = OpenGZipReadOnly(pszFilename, pszAccess);
     if (poGZIPHandle)
         // Wrap the VSIGZipHandle inside a buffered reader that will
@@ -3011,6 +3739,93 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     return nullptr;
 }
 
+/************************************************************************/
+/*                            OpenIndexed()                             */
+/************************************************************************/
+
+// Opens the file with a VSIGZipIndexedHandle, loading the index from the
+// .gzidx sidecar file, or building it (and saving it if allowed) if needed.
+// Returns nullptr if the file cannot be indexed.
+VSIVirtualHandle *
+VSIGZipFilesystemHandler::OpenIndexed(const char *pszBaseFilename)
+{
+    auto poBaseHandle = std::unique_ptr<VSIVirtualHandle>(
+        VSIFileManager::GetHandler(pszBaseFilename)
+            ->Open(pszBaseFilename, "rb"));
+    if (poBaseHandle == nullptr)
+        return nullptr;
+
+    unsigned char signature[2] = {'\0', '\0'};
+    if (poBaseHandle->Read(signature, 1, 2) != 2 ||
+        signature[0] != gz_magic[0] || signature[1] != gz_magic[1] ||
+        poBaseHandle->Seek(0, SEEK_END) != 0)
+    {
+        poBaseHandle->Close();
+        return nullptr;
+    }
+    const vsi_l_offset nCompressedSize = poBaseHandle->Tell();
+
+    std::shared_ptr<const VSIGZipIndex> poIndex;
+    {
+        CPLMutexHolder oHolder(&hMutex);
+        if (m_poLastIndex && m_osLastIndexFilename == pszBaseFilename &&
+            m_poLastIndex->nCompressedSize == nCompressedSize)
+        {
+            poIndex = m_poLastIndex;
+        }
+    }
+
+    if (poIndex == nullptr)
+    {
+        const std::string osIndexFilename =
+            std::string(pszBaseFilename).append(".gzidx");
+        poIndex = VSIGZipIndex::Load(osIndexFilename.c_str(), nCompressedSize);
+        if (poIndex == nullptr)
+        {
+            const char *pszSpacing =
+                CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_SPACING", "4M");
+            vsi_l_offset nSpacing =
+                static_cast<vsi_l_offset>(std::max(0, atoi(pszSpacing)));
+            if (strchr(pszSpacing, 'K'))
+                nSpacing *= 1024;
+            else if (strchr(pszSpacing, 'M'))
+                nSpacing *= 1024 * 1024;
+            // Segments must be addressable with 32 bit sizes by zlib
+            nSpacing = std::max<vsi_l_offset>(
+                GZIP_INDEX_WINDOW_SIZE,
+                std::min<vsi_l_offset>(1024 * 1024 * 1024, nSpacing));
+
+            auto poNewIndex = VSIGZipIndex::Build(poBaseHandle.get(),
+                                                  nCompressedSize, nSpacing);
+            if (poNewIndex &&
+                CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_PROPERTIES",
+                                               "YES")))
+            {
+                CPLPushErrorHandler(CPLQuietErrorHandler);
+                CPL_IGNORE_RET_VAL(poNewIndex->Save(osIndexFilename.c_str()));
+                CPLPopErrorHandler();
+            }
+            poIndex = std::move(poNewIndex);
+        }
+        if (poIndex == nullptr)
+        {
+            poBaseHandle->Close();
+            return nullptr;
+        }
+
+        CPLMutexHolder oHolder(&hMutex);
+        m_osLastIndexFilename = pszBaseFilename;
+        m_poLastIndex = poIndex;
+    }
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+    nThreads = std::max(1, std::min(128, nThreads));
+
+    return new VSIGZipIndexedHandle(poBaseHandle.release(), poIndex, nThreads);
+}
+
 /************************************************************************/
 /*                      SupportsSequentialWrite()                       */
 /************************************************************************/
@@ -5010,6 +5825,35 @@ void *CPLZLibInflate(const void *ptr, size_t nBytes, void *outptr,
                             pnOutBytes);
 }
 
+#ifdef HAVE_LIBDEFLATE
+
+/************************************************************************/
+/*                 GetThreadLocalLibdeflateDecompressor()               */
+/************************************************************************/
+
+// libdeflate decompressors keep no state between calls, but allocating one
+// has a cost that matters for small chunks, so keep one per thread.
+static struct libdeflate_decompressor *GetThreadLocalLibdeflateDecompressor()
+{
+    struct DecompressorHolder
+    {
+        struct libdeflate_decompressor *pDecompressor = nullptr;
+
+        ~DecompressorHolder()
+        {
+            if (pDecompressor)
+                libdeflate_free_decompressor(pDecompressor);
+        }
+    };
+
+    static thread_local DecompressorHolder sHolder;
+    if (sHolder.pDecompressor == nullptr)
+        sHolder.pDecompressor = libdeflate_alloc_decompressor();
+    return sHolder.pDecompressor;
+}
+
+#endif
+
 /************************************************************************/
 /*                         CPLZLibInflateEx()                           */
 /************************************************************************/
@@ -5047,7 +5891,8 @@ void *CPLZLibInflateEx(const void *ptr, size_t nBytes, void *outptr,
 #ifdef HAVE_LIBDEFLATE
     if (outptr)
     {
-        struct libdeflate_decompressor *dec = libdeflate_alloc_decompressor();
+        struct libdeflate_decompressor *dec =
+            GetThreadLocalLibdeflateDecompressor();
         if (dec == nullptr)
         {
             if (bAllowResizeOutptr)
@@ -5069,7 +5914,6 @@ void *CPLZLibInflateEx(const void *ptr, size_t nBytes, void *outptr,
         }
         if (pnOutBytes)
             *pnOutBytes = nOutBytes;
-        libdeflate_free_decompressor(dec);
         if (res == LIBDEFLATE_INSUFFICIENT_SPACE && bAllowResizeOutptr)
         {
             if (nOutAvailableBytes >
@@ -5105,6 +5949,35 @@ void *CPLZLibInflateEx(const void *ptr, size_t nBytes, void *outptr,
             return outptr;
         }
     }
+#elif defined(HAVE_ISAL)
+    if (outptr && nBytes <= std::numeric_limits<uint32_t>::max() &&
+        nOutAvailableBytes <= std::numeric_limits<uint32_t>::max())
+    {
+        struct inflate_state sState;
+        isal_inflate_init(&sState);
+        sState.crc_flag = nBytes > 2 &&
+                                  static_cast<const GByte *>(ptr)[0] == 0x1F &&
+                                  static_cast<const GByte *>(ptr)[1] == 0x8B
+                              ? ISAL_GZIP
+                              : ISAL_ZLIB;
+        sState.next_in = static_cast<uint8_t *>(const_cast<void *>(ptr));
+        sState.avail_in = static_cast<uint32_t>(nBytes);
+        sState.next_out = static_cast<uint8_t *>(outptr);
+        sState.avail_out = static_cast<uint32_t>(nOutAvailableBytes);
+        if (isal_inflate_stateless(&sState) == ISAL_DECOMP_OK)
+        {
+            const size_t nOutBytes = sState.total_out;
+            if (pnOutBytes)
+                *pnOutBytes = nOutBytes;
+            // Nul-terminate if possible.
+            if (nOutBytes < nOutAvailableBytes)
+            {
+                static_cast<char *>(outptr)[nOutBytes] = '\0';
+            }
+            return outptr;
+        }
+        // Otherwise, for example if outptr is too small, use zlib below.
+    }
 #endif
 
     z_stream strm;
@@ -35,6 +35,7 @@
 #include "cpl_time.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_vsil_curl_class.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <errno.h>
 
@@ -662,6 +663,14 @@ class VSIS3FSHandler final : public IVSIS3LikeFSHandler
         return STARTS_WITH(pszHeaderName, "x-amz-");
     }
 
+    bool IsDirectoryBucketFilename(const char *pszFilename) const;
+
+    const char *GetDefaultDisableReadDirOnOpen(const char *pszFilename) override
+    {
+        // Avoid listing requests on directory buckets, for low latency
+        return IsDirectoryBucketFilename(pszFilename) ? "EMPTY_DIR" : "NO";
+    }
+
     VSIVirtualHandleUniquePtr
     CreateWriteHandle(const char *pszFilename,
                       CSLConstList papszOptions) override;
@@ -681,6 +690,8 @@ class VSIS3FSHandler final : public IVSIS3LikeFSHandler
     int *UnlinkBatch(CSLConstList papszFiles) override;
     int RmdirRecursive(const char *pszDirname) override;
 
+    char **SiblingFiles(const char *pszFilename) override;
+
     char **GetFileMetadata(const char *pszFilename, const char *pszDomain,
                            CSLConstList papszOptions) override;
 
@@ -783,6 +794,42 @@ VSIS3WriteHandle::VSIS3WriteHandle(IVSIS3LikeFSHandler *poFS,
                      "Cannot allocate working buffer for %s",
                      m_poFS->GetFSPrefix().c_str());
         }
+
+        // Number of parts that can be uploaded concurrently while the
+        // caller keeps on filling the next one.
+        m_nMaxParallelParts = std::max(
+            1, std::min(64, atoi(VSIGetPathSpecificOption(
+                                pszFilename,
+                                (std::string("VSI") + poFS->GetDebugKey() +
+                                 "_UPLOAD_PARALLEL_PARTS")
+                                    .c_str(),
+                                "1"))));
+        const char *pszMaxMemoryMB = VSIGetPathSpecificOption(
+            pszFilename,
+            (std::string("VSI") + poFS->GetDebugKey() + "_UPLOAD_MAX_MEMORY")
+                .c_str(),
+            nullptr);
+        if (m_nMaxParallelParts > 1 && pszMaxMemoryMB)
+        {
+            // One buffer per part in flight, plus the one being filled.
+            const GIntBig nMaxBuffers =
+                CPLAtoGIntBig(pszMaxMemoryMB) * 1024 * 1024 / m_nBufferSize;
+            m_nMaxParallelParts = static_cast<int>(std::max<GIntBig>(
+                1, std::min<GIntBig>(m_nMaxParallelParts, nMaxBuffers - 1)));
+        }
+        if (m_nMaxParallelParts > 1 && m_pabyBuffer)
+        {
+            m_poUploadThreadPool = std::make_unique<CPLWorkerThreadPool>();
+            if (m_poUploadThreadPool->Setup(m_nMaxParallelParts, nullptr,
+                                            nullptr))
+            {
+                m_poUploadJobQueue = m_poUploadThreadPool->CreateJobQueue();
+            }
+            else
+            {
+                m_poUploadThreadPool.reset();
+            }
+        }
     }
 }
 
@@ -793,8 +840,12 @@ VSIS3WriteHandle::VSIS3WriteHandle(IVSIS3LikeFSHandler *poFS,
 VSIS3WriteHandle::~VSIS3WriteHandle()
 {
     VSIS3WriteHandle::Close();
+    m_poUploadJobQueue.reset();
+    m_poUploadThreadPool.reset();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     if (m_hCurlMulti)
     {
         if (m_hCurl)
@@ -974,6 +1025,8 @@ bool VSIS3WriteHandle::UploadPart()
             knMAX_PART_NUMBER, m_osFilename.c_str());
         return false;
     }
+    if (m_poUploadJobQueue)
+        return UploadPartAsync();
     const std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
@@ -987,6 +1040,116 @@ bool VSIS3WriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                           UploadPartAsync()                          */
+/************************************************************************/
+
+struct VSIS3WriteHandle::UploadPartJob
+{
+    VSIS3WriteHandle *poHandle = nullptr;
+    int nPartNumber = 0;
+    GByte *pabyBuffer = nullptr;
+    int nBufferSize = 0;
+};
+
+/* Hands over the current buffer to a worker thread, and makes a new buffer
+ * available to Write(). At most m_nMaxParallelParts parts are in flight, so
+ * memory usage is bounded to (m_nMaxParallelParts + 1) * m_nBufferSize.
+ */
+bool VSIS3WriteHandle::UploadPartAsync()
+{
+    auto psJob = new UploadPartJob();
+    psJob->poHandle = this;
+    psJob->nPartNumber = m_nPartNumber;
+    psJob->pabyBuffer = m_pabyBuffer;
+    psJob->nBufferSize = m_nBufferOff;
+    if (!m_poUploadJobQueue->SubmitJob(UploadPartJobFunc, psJob))
+    {
+        delete psJob;
+        return false;
+    }
+    m_pabyBuffer = nullptr;
+    m_nBufferOff = 0;
+
+    // Throttle the producer
+    m_poUploadJobQueue->WaitCompletion(m_nMaxParallelParts);
+
+    bool bError;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexUpload);
+        bError = m_bUploadError;
+        if (!m_apabyFreeBuffers.empty())
+        {
+            m_pabyBuffer = m_apabyFreeBuffers.back();
+            m_apabyFreeBuffers.pop_back();
+        }
+    }
+    if (bError)
+        return false;
+    if (m_pabyBuffer == nullptr)
+    {
+        m_pabyBuffer =
+            static_cast<GByte *>(VSI_MALLOC_VERBOSE(m_nBufferSize));
+        if (m_pabyBuffer == nullptr)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          UploadPartJobFunc()                         */
+/************************************************************************/
+
+void VSIS3WriteHandle::UploadPartJobFunc(void *pData)
+{
+    std::unique_ptr<UploadPartJob> psJob(static_cast<UploadPartJob *>(pData));
+    VSIS3WriteHandle *poThis = psJob->poHandle;
+
+    // The handle helper gets modified by UploadPart(), so each job needs
+    // its own one.
+    std::string osEtag;
+    auto poS3HandleHelper = std::unique_ptr<IVSIS3LikeHandleHelper>(
+        poThis->m_poFS->CreateHandleHelper(
+            poThis->m_osFilename.c_str() +
+                poThis->m_poFS->GetFSPrefix().size(),
+            false));
+    if (poS3HandleHelper)
+    {
+        osEtag = poThis->m_poFS->UploadPart(
+            poThis->m_osFilename, psJob->nPartNumber, poThis->m_osUploadID,
+            static_cast<vsi_l_offset>(poThis->m_nBufferSize) *
+                (psJob->nPartNumber - 1),
+            psJob->pabyBuffer, psJob->nBufferSize, poS3HandleHelper.get(),
+            poThis->m_nMaxRetry, poThis->m_dfRetryDelay, nullptr);
+    }
+
+    std::lock_guard<std::mutex> oLock(poThis->m_oMutexUpload);
+    if (osEtag.empty())
+    {
+        poThis->m_bUploadError = true;
+    }
+    else
+    {
+        if (static_cast<int>(poThis->m_aosEtags.size()) < psJob->nPartNumber)
+            poThis->m_aosEtags.resize(psJob->nPartNumber);
+        poThis->m_aosEtags[psJob->nPartNumber - 1] = std::move(osEtag);
+    }
+    poThis->m_apabyFreeBuffers.push_back(psJob->pabyBuffer);
+}
+
+/************************************************************************/
+/*                        WaitPendingPartUploads()                      */
+/************************************************************************/
+
+bool VSIS3WriteHandle::WaitPendingPartUploads()
+{
+    if (!m_poUploadJobQueue)
+        return true;
+    m_poUploadJobQueue->WaitCompletion();
+    std::lock_guard<std::mutex> oLock(m_oMutexUpload);
+    return !m_bUploadError;
+}
+
 std::string IVSIS3LikeFSHandler::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -2019,13 +2182,24 @@ int VSIS3WriteHandle::Close()
         {
             if (m_bError)
             {
+                WaitPendingPartUploads();
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
                                             m_poS3HandleHelper, m_nMaxRetry,
                                             m_dfRetryDelay))
                     nRet = -1;
             }
             else if (m_nBufferOff > 0 && !UploadPart())
+            {
+                WaitPendingPartUploads();
+                nRet = -1;
+            }
+            else if (!WaitPendingPartUploads())
+            {
+                m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
+                                       m_poS3HandleHelper, m_nMaxRetry,
+                                       m_dfRetryDelay);
                 nRet = -1;
+            }
             else if (m_poFS->CompleteMultipart(
                          m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
                          m_poS3HandleHelper, m_nMaxRetry, m_dfRetryDelay))
@@ -3097,6 +3271,41 @@ int IVSIS3LikeFSHandler::Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
     return nRet;
 }
 
+/************************************************************************/
+/*                      IsDirectoryBucketFilename()                     */
+/************************************************************************/
+
+bool VSIS3FSHandler::IsDirectoryBucketFilename(const char *pszFilename) const
+{
+    if (!STARTS_WITH_CI(pszFilename, GetFSPrefix().c_str()))
+        return false;
+    std::string osBucket(pszFilename + GetFSPrefix().size());
+    const auto nPos = osBucket.find('/');
+    if (nPos != std::string::npos)
+        osBucket.resize(nPos);
+    return VSIS3HandleHelper::IsDirectoryBucket(osBucket);
+}
+
+/************************************************************************/
+/*                            SiblingFiles()                            */
+/************************************************************************/
+
+char **VSIS3FSHandler::SiblingFiles(const char *pszFilename)
+{
+    // On directory buckets, behave by default as if
+    // GDAL_DISABLE_READDIR_ON_OPEN=EMPTY_DIR, to avoid listing requests and
+    // probing for side-car files.
+    if (IsDirectoryBucketFilename(pszFilename) &&
+        EQUAL(VSIGetPathSpecificOption(pszFilename,
+                                       "GDAL_DISABLE_READDIR_ON_OPEN",
+                                       "EMPTY_DIR"),
+              "EMPTY_DIR"))
+    {
+        return CSLAddString(nullptr, CPLGetFilename(pszFilename));
+    }
+    return IVSIS3LikeFSHandler::SiblingFiles(pszFilename);
+}
+
 /************************************************************************/
 /*                          CreateFileHandle()                          */
 /************************************************************************/
@@ -257,6 +257,13 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     bool HasPRead() const override;
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+#endif
+#ifdef POSIX_FADV_WILLNEED
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
 #endif
 };
 
@@ -663,6 +670,73 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
     return pread(fileno(fp), pBuffer, nSize, static_cast<off_t>(nOffset));
 #endif
 }
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    // Data written through the stdio buffer might not be visible to pread()
+    if (!bReadOnly)
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+
+    // Let the kernel queue all the reads at once, instead of one at a time
+    if (nRanges > 1)
+        AdviseRead(nRanges, panOffsets, panSizes);
+
+    for (int i = 0; i < nRanges; ++i)
+    {
+        GByte *pabyData = static_cast<GByte *>(ppData[i]);
+        size_t nRemaining = panSizes[i];
+        vsi_l_offset nOffset = panOffsets[i];
+        while (nRemaining > 0)
+        {
+#ifdef HAVE_PREAD64
+            const ssize_t nRead =
+                pread64(fileno(fp), pabyData, nRemaining, nOffset);
+#else
+            const ssize_t nRead = pread(fileno(fp), pabyData, nRemaining,
+                                        static_cast<off_t>(nOffset));
+#endif
+            if (nRead < 0 && errno == EINTR)
+                continue;
+            if (nRead <= 0)
+                return -1;
+            pabyData += nRead;
+            nRemaining -= static_cast<size_t>(nRead);
+            nOffset += static_cast<vsi_l_offset>(nRead);
+#ifdef VSI_COUNT_BYTES_READ
+            nTotalBytesRead += static_cast<vsi_l_offset>(nRead);
+#endif
+        }
+    }
+    return 0;
+}
+#endif
+
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+#ifdef POSIX_FADV_WILLNEED
+void VSIUnixStdioHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    // Start reading the ranges into the page cache asynchronously, so that
+    // subsequent reads, possibly from several threads, find them there.
+    for (int i = 0; i < nRanges; ++i)
+    {
+        CPL_IGNORE_RET_VAL(posix_fadvise(fileno(fp),
+                                         static_cast<off_t>(panOffsets[i]),
+                                         static_cast<off_t>(panSizes[i]),
+                                         POSIX_FADV_WILLNEED));
+    }
+}
 #endif
 
 /************************************************************************/
@@ -49,6 +49,7 @@
 #include "cpl_vsi.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdarg>
 #include <cstddef>
@@ -65,6 +66,7 @@
 #endif
 
 #include "cpl_config.h"
+#include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
 
@@ -1643,3 +1645,281 @@ GIntBig CPLGetUsablePhysicalRAM(void)
 #endif
     return nRAM;
 }
+
+/************************************************************************/
+/*                         Memory accounting                            */
+/************************************************************************/
+
+namespace
+{
+struct VSIMemoryAccounting
+{
+    std::atomic<GIntBig> anUsage[VSI_MEMORY_TAG_COUNT] = {};
+    std::atomic<GIntBig> anHighWaterMark[VSI_MEMORY_TAG_COUNT] = {};
+    std::atomic<GIntBig> nTotalUsage{0};
+    std::atomic<GIntBig> nTotalHighWaterMark{0};
+    // -2: not read yet from CPL_MEMORY_SOFT_LIMIT, -1: no limit
+    std::atomic<GIntBig> nSoftLimit{-2};
+};
+
+VSIMemoryAccounting &GetMemoryAccounting()
+{
+    static VSIMemoryAccounting sAccounting;
+    return sAccounting;
+}
+
+void UpdateHighWaterMark(std::atomic<GIntBig> &nHighWaterMark, GIntBig nValue)
+{
+    GIntBig nCur = nHighWaterMark.load();
+    while (nValue > nCur && !nHighWaterMark.compare_exchange_weak(nCur, nValue))
+    {
+        // nCur has been updated by compare_exchange_weak()
+    }
+}
+
+const char *GetMemoryTagName(int iTag)
+{
+    switch (iTag)
+    {
+        case VSI_MEMORY_TAG_BLOCK_CACHE:
+            return "block_cache";
+        case VSI_MEMORY_TAG_REGION_CACHE:
+            return "region_cache";
+        case VSI_MEMORY_TAG_WARP:
+            return "warp";
+        default:
+            break;
+    }
+    return "other";
+}
+}  // namespace
+
+/************************************************************************/
+/*                     VSIMemoryAccountingUpdate()                      */
+/************************************************************************/
+
+/** Update the memory usage accounted for a subsystem.
+ *
+ * Subsystems holding significant amounts of memory call this function with
+ * a positive value when they allocate it, and a negative one when they
+ * release it, so that the usage of each of them, and their high-water marks,
+ * can be retrieved with VSIMemoryAccountingGetUsage() or
+ * VSIMemoryAccountingGetAsSerializedJSON(). This is also what
+ * VSIGetMemorySoftBudget() is based on.
+ *
+ * @param eTag Subsystem.
+ * @param nDelta Number of bytes allocated (positive) or released (negative).
+ * @since GDAL 3.10
+ */
+void VSIMemoryAccountingUpdate(VSIMemoryTag eTag, GIntBig nDelta)
+{
+    const int iTag = static_cast<int>(eTag);
+    if (iTag < 0 || iTag >= VSI_MEMORY_TAG_COUNT)
+        return;
+    auto &sAccounting = GetMemoryAccounting();
+    const GIntBig nUsage = (sAccounting.anUsage[iTag] += nDelta);
+    const GIntBig nTotalUsage = (sAccounting.nTotalUsage += nDelta);
+    if (nDelta > 0)
+    {
+        UpdateHighWaterMark(sAccounting.anHighWaterMark[iTag], nUsage);
+        UpdateHighWaterMark(sAccounting.nTotalHighWaterMark, nTotalUsage);
+    }
+}
+
+/************************************************************************/
+/*                    VSIMemoryAccountingGetUsage()                     */
+/************************************************************************/
+
+/** Return the memory usage accounted for a subsystem.
+ *
+ * @param eTag Subsystem.
+ * @param pnHighWaterMark Pointer to a variable set to the maximum usage
+ * reached, since the start of the process or the last call to
+ * VSIMemoryAccountingResetHighWaterMarks(). May be NULL.
+ * @return the current usage, in bytes.
+ * @since GDAL 3.10
+ */
+GIntBig VSIMemoryAccountingGetUsage(VSIMemoryTag eTag,
+                                    GIntBig *pnHighWaterMark)
+{
+    const int iTag = static_cast<int>(eTag);
+    if (iTag < 0 || iTag >= VSI_MEMORY_TAG_COUNT)
+    {
+        if (pnHighWaterMark)
+            *pnHighWaterMark = 0;
+        return 0;
+    }
+    const auto &sAccounting = GetMemoryAccounting();
+    if (pnHighWaterMark)
+        *pnHighWaterMark = sAccounting.anHighWaterMark[iTag];
+    return sAccounting.anUsage[iTag];
+}
+
+/************************************************************************/
+/*               VSIMemoryAccountingResetHighWaterMarks()               */
+/************************************************************************/
+
+/** Reset the high-water marks to the current usages.
+ *
+ * @since GDAL 3.10
+ */
+void VSIMemoryAccountingResetHighWaterMarks(void)
+{
+    auto &sAccounting = GetMemoryAccounting();
+    for (int i = 0; i < VSI_MEMORY_TAG_COUNT; ++i)
+        sAccounting.anHighWaterMark[i] = sAccounting.anUsage[i].load();
+    sAccounting.nTotalHighWaterMark = sAccounting.nTotalUsage.load();
+}
+
+/************************************************************************/
+/*               VSIMemoryAccountingGetAsSerializedJSON()               */
+/************************************************************************/
+
+/** Return the accounted memory usages, as a JSON serialized object.
+ *
+ * Example of output:
+ * <pre>
+ * {
+ *   "total":{
+ *     "usage":123456,
+ *     "high_water_mark":234567
+ *   },
+ *   "soft_limit":1073741824,
+ *   "subsystems":{
+ *     "block_cache":{
+ *       "usage":100000,
+ *       "high_water_mark":200000
+ *     },
+ *     [...]
+ *   }
+ * }
+ * </pre>
+ *
+ * "soft_limit" is only present if a soft limit is set.
+ *
+ * @param papszOptions Unused.
+ * @return a JSON serialized string to free with VSIFree()
+ * @since GDAL 3.10
+ */
+char *VSIMemoryAccountingGetAsSerializedJSON(CPL_UNUSED char **papszOptions)
+{
+    const auto &sAccounting = GetMemoryAccounting();
+    std::string osJSON("{\n  \"total\":{\n");
+    osJSON += CPLSPrintf("    \"usage\":" CPL_FRMT_GIB ",\n",
+                         sAccounting.nTotalUsage.load());
+    osJSON += CPLSPrintf("    \"high_water_mark\":" CPL_FRMT_GIB "\n  },\n",
+                         sAccounting.nTotalHighWaterMark.load());
+    const GIntBig nSoftLimit = VSIGetMemorySoftLimit();
+    if (nSoftLimit >= 0)
+        osJSON +=
+            CPLSPrintf("  \"soft_limit\":" CPL_FRMT_GIB ",\n", nSoftLimit);
+    osJSON += "  \"subsystems\":{\n";
+    for (int i = 0; i < VSI_MEMORY_TAG_COUNT; ++i)
+    {
+        osJSON += CPLSPrintf("    \"%s\":{\n", GetMemoryTagName(i));
+        osJSON += CPLSPrintf("      \"usage\":" CPL_FRMT_GIB ",\n",
+                             sAccounting.anUsage[i].load());
+        osJSON += CPLSPrintf("      \"high_water_mark\":" CPL_FRMT_GIB "\n",
+                             sAccounting.anHighWaterMark[i].load());
+        osJSON += (i + 1 < VSI_MEMORY_TAG_COUNT) ? "    },\n" : "    }\n";
+    }
+    osJSON += "  }\n}";
+    return CPLStrdup(osJSON.c_str());
+}
+
+/************************************************************************/
+/*                       VSIGetMemorySoftLimit()                        */
+/************************************************************************/
+
+/** Return the soft memory limit.
+ *
+ * It is initialized from the CPL_MEMORY_SOFT_LIMIT configuration option,
+ * which can be expressed in bytes, with a MB or GB suffix, or as a
+ * percentage of the usable physical RAM (e.g. "50%"), and can be modified
+ * with VSISetMemorySoftLimit().
+ *
+ * @return the soft memory limit in bytes, or -1 if there is none.
+ * @since GDAL 3.10
+ */
+GIntBig VSIGetMemorySoftLimit(void)
+{
+    auto &sAccounting = GetMemoryAccounting();
+    GIntBig nSoftLimit = sAccounting.nSoftLimit;
+    if (nSoftLimit == -2)
+    {
+        nSoftLimit = -1;
+        const char *pszLimit =
+            CPLGetConfigOption("CPL_MEMORY_SOFT_LIMIT", nullptr);
+        if (pszLimit && pszLimit[0] != '\0')
+        {
+            const double dfValue = CPLAtof(pszLimit);
+            if (strchr(pszLimit, '%'))
+            {
+                nSoftLimit = static_cast<GIntBig>(
+                    dfValue / 100 *
+                    static_cast<double>(CPLGetUsablePhysicalRAM()));
+            }
+            else if (strstr(pszLimit, "GB") || strstr(pszLimit, "gb"))
+            {
+                nSoftLimit = static_cast<GIntBig>(dfValue * 1024 * 1024 * 1024);
+            }
+            else if (strstr(pszLimit, "MB") || strstr(pszLimit, "mb"))
+            {
+                nSoftLimit = static_cast<GIntBig>(dfValue * 1024 * 1024);
+            }
+            else
+            {
+                nSoftLimit = CPLAtoGIntBig(pszLimit);
+            }
+            if (nSoftLimit <= 0)
+            {
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "Invalid value for CPL_MEMORY_SOFT_LIMIT: %s",
+                         pszLimit);
+                nSoftLimit = -1;
+            }
+        }
+        sAccounting.nSoftLimit = nSoftLimit;
+    }
+    return nSoftLimit;
+}
+
+/************************************************************************/
+/*                       VSISetMemorySoftLimit()                        */
+/************************************************************************/
+
+/** Set the soft memory limit.
+ *
+ * When a soft limit is set, the block cache, the region cache of /vsicurl/
+ * and the warping engine restrict their memory usage so that the total
+ * accounted usage stays under it, as far as possible. See
+ * VSIGetMemorySoftBudget().
+ *
+ * @param nLimit Limit in bytes, or a negative value to remove the limit.
+ * @since GDAL 3.10
+ */
+void VSISetMemorySoftLimit(GIntBig nLimit)
+{
+    GetMemoryAccounting().nSoftLimit = nLimit < 0 ? -1 : nLimit;
+}
+
+/************************************************************************/
+/*                       VSIGetMemorySoftBudget()                       */
+/************************************************************************/
+
+/** Return the memory that a subsystem may use, given the soft limit and
+ * the usage of the other subsystems.
+ *
+ * @param eTag Subsystem.
+ * @return the budget in bytes (possibly 0), or -1 if there is no soft limit.
+ * @since GDAL 3.10
+ */
+GIntBig VSIGetMemorySoftBudget(VSIMemoryTag eTag)
+{
+    const GIntBig nSoftLimit = VSIGetMemorySoftLimit();
+    if (nSoftLimit < 0)
+        return -1;
+    const GIntBig nOthersUsage = GetMemoryAccounting().nTotalUsage -
+                                 VSIMemoryAccountingGetUsage(eTag, nullptr);
+    return std::max<GIntBig>(0, nSoftLimit - nOthersUsage);
+}
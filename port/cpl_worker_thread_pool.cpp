@@ -29,20 +29,18 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 
-struct CPLWorkerThreadJob
-{
-    CPLThreadFunc pfnFunc;
-    void *pData;
-};
-
 static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local CPLWorkerThread *threadLocalCurrentWorkerThread = nullptr;
 
 /************************************************************************/
 /*                         CPLWorkerThreadPool()                        */
@@ -52,6 +50,12 @@ static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
  *
  * The pool is in an uninitialized state after this call. The Setup() method
  * must be called.
+ *
+ * Each worker thread has its own job queue. Jobs submitted from outside
+ * the pool are distributed in a round-robin way among those queues, and jobs
+ * submitted from a job running in the pool are queued in the queue of its
+ * worker thread. A worker thread whose queue is empty steals jobs from the
+ * queues of the other worker threads.
  */
 CPLWorkerThreadPool::CPLWorkerThreadPool()
 {
@@ -82,8 +86,6 @@ CPLWorkerThreadPool::~CPLWorkerThreadPool()
         }
         CPLJoinThread(wt->hThread);
     }
-
-    CPLListDestroy(psWaitingWorkerThreadsList);
 }
 
 /************************************************************************/
@@ -96,21 +98,19 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentWorkerThread = psWT;
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
 
-    while (true)
+    CPLWorkerThreadJob sJob;
+    while (poTP->GetNextJob(psWT, sJob))
     {
-        CPLWorkerThreadJob *psJob = poTP->GetNextJob(psWT);
-        if (psJob == nullptr)
-            break;
-
-        if (psJob->pfnFunc)
+        if (sJob.pfnFunc)
         {
-            psJob->pfnFunc(psJob->pData);
+            CPLTraceSpan oSpan("threadpool", "job");
+            sJob.pfnFunc(sJob.pData);
         }
-        CPLFree(psJob);
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p finished a job", psWT);
 #endif
@@ -119,129 +119,170 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
 }
 
 /************************************************************************/
-/*                             SubmitJob()                              */
+/*                       StartNewWorkerThread()                         */
 /************************************************************************/
 
-/** Queue a new job.
- *
- * @param pfnFunc Function to run for the job.
- * @param pData User data to pass to the job function.
- * @return true in case of success.
- */
-bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
+// Must be called with m_mutex held.
+bool CPLWorkerThreadPool::StartNewWorkerThread(CPLThreadFunc pfnInitFunc,
+                                               void *pInitData)
 {
-    CPLAssert(m_nMaxThreads > 0);
-
-    bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
-    if (threadLocalCurrentThreadPool == this)
-    {
-        // If there are waiting threads or we have not started all allowed
-        // threads, we can submit this job asynchronously
-        {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            if (nWaitingWorkerThreads > 0 ||
-                static_cast<int>(aWT.size()) < m_nMaxThreads)
-            {
-                bMustIncrementWaitingWorkerThreadsAfterSubmission = true;
-                nWaitingWorkerThreads--;
-            }
-        }
-        if (!bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        {
-            // otherwise there is a risk of deadlock, so execute synchronously.
-            pfnFunc(pData);
-            return true;
-        }
-    }
-
-    CPLWorkerThreadJob *psJob = static_cast<CPLWorkerThreadJob *>(
-        VSI_MALLOC_VERBOSE(sizeof(CPLWorkerThreadJob)));
-    if (psJob == nullptr)
+    std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
+    wt->pfnInitFunc = pfnInitFunc;
+    wt->pInitData = pInitData;
+    wt->poTP = this;
+    wt->bMarkedAsWaiting = false;
+    wt->nQueueIdx = static_cast<int>(aWT.size() % MAX_JOB_QUEUES);
+
+    // Make the queue of the new thread visible before it starts running
+    const int nJobQueuesBefore = m_nJobQueues;
+    m_nJobQueues = std::max(nJobQueuesBefore, wt->nQueueIdx + 1);
+
+    wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
+    if (wt->hThread == nullptr)
     {
-        if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            nWaitingWorkerThreads++;
-        }
+        m_nJobQueues = nJobQueuesBefore;
         return false;
     }
-    psJob->pfnFunc = pfnFunc;
-    psJob->pData = pData;
+    aWT.emplace_back(std::move(wt));
+    return true;
+}
 
-    CPLList *psItem =
-        static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-    if (psItem == nullptr)
+/************************************************************************/
+/*                             QueueJobs()                              */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::QueueJobs(CPLThreadFunc pfnFunc,
+                                    void *const *papData, size_t nJobs,
+                                    bool bNested)
+{
     {
-        VSIFree(psJob);
-        if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        for (size_t i = 0;
+             i < nJobs && static_cast<int>(aWT.size()) < m_nMaxThreads; i++)
         {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            nWaitingWorkerThreads++;
+            // CPLDebug("CPL", "Starting new thread...");
+            if (!StartNewWorkerThread(nullptr, nullptr))
+            {
+                if (aWT.empty())
+                    return false;
+                break;
+            }
         }
-        return false;
     }
-    psItem->pData = psJob;
 
-    std::unique_lock<std::mutex> oGuard(m_mutex);
-
-    if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        nWaitingWorkerThreads++;
+    // Increment the number of pending jobs before they can be run, so that
+    // it cannot transiently go negative.
+    nPendingJobs += static_cast<int>(nJobs);
 
-    if (static_cast<int>(aWT.size()) < m_nMaxThreads)
+    const int nJobQueues = m_nJobQueues;
+    for (size_t i = 0; i < nJobs; i++)
     {
-        // CPLDebug("CPL", "Starting new thread...");
-        std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-        wt->pfnInitFunc = nullptr;
-        wt->pInitData = nullptr;
-        wt->poTP = this;
-        wt->bMarkedAsWaiting = false;
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        if (wt->hThread == nullptr)
+        CPLWorkerThreadJob sJob;
+        sJob.pfnFunc = pfnFunc;
+        sJob.pData = papData[i];
+        if (bNested)
         {
-            VSIFree(psJob);
-            VSIFree(psItem);
-            return false;
+            // Jobs submitted from a job are put in front of the queue of the
+            // current worker thread, so that they are run first, either by
+            // this thread or by a thread stealing them.
+            auto &oQueue =
+                m_aoJobQueues[threadLocalCurrentWorkerThread->nQueueIdx];
+            std::lock_guard<std::mutex> oGuard(oQueue.m_mutex);
+            oQueue.m_aoJobs.push_front(sJob);
         }
         else
         {
-            aWT.emplace_back(std::move(wt));
+            auto &oQueue = m_aoJobQueues[m_nNextJobQueue++ % nJobQueues];
+            std::lock_guard<std::mutex> oGuard(oQueue.m_mutex);
+            oQueue.m_aoJobs.push_back(sJob);
         }
     }
+    // Must be done after the jobs have been queued. See GetNextJob().
+    m_nQueuedJobs += static_cast<int>(nJobs);
 
-    psItem->psNext = psJobQueue;
-    psJobQueue = psItem;
-    nPendingJobs++;
+    WakeUpWaitingWorkerThreads(static_cast<int>(nJobs));
 
-    if (psWaitingWorkerThreadsList)
-    {
-        CPLWorkerThread *psWorkerThread =
-            static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
+    return true;
+}
+
+/************************************************************************/
+/*                    WakeUpWaitingWorkerThreads()                      */
+/************************************************************************/
 
-        CPLAssert(psWorkerThread->bMarkedAsWaiting);
-        psWorkerThread->bMarkedAsWaiting = false;
+void CPLWorkerThreadPool::WakeUpWaitingWorkerThreads(int nCount)
+{
+    // Avoid taking the pool mutex when all threads are busy.
+    if (nWaitingWorkerThreads == 0)
+        return;
 
-        CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-        CPLList *psToFree = psWaitingWorkerThreadsList;
-        psWaitingWorkerThreadsList = psNext;
-        nWaitingWorkerThreads--;
+    std::vector<CPLWorkerThread *> apoToWakeUp;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        while (nCount > 0 && !m_apoWaitingWorkerThreads.empty())
+        {
+            CPLWorkerThread *psWorkerThread = m_apoWaitingWorkerThreads.back();
+            m_apoWaitingWorkerThreads.pop_back();
 
-        // CPLAssert(
-        //   CPLListCount(psWaitingWorkerThreadsList) == nWaitingWorkerThreads);
+            CPLAssert(psWorkerThread->bMarkedAsWaiting);
+            psWorkerThread->bMarkedAsWaiting = false;
+            nWaitingWorkerThreads--;
+            m_nWokenUpWorkerThreads++;
+            psWorkerThread->bWokenUp = true;
+            apoToWakeUp.push_back(psWorkerThread);
+            nCount--;
+        }
+    }
 
+    for (CPLWorkerThread *psWorkerThread : apoToWakeUp)
+    {
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "Waking up %p", psWorkerThread);
 #endif
+        // A thread marked as waiting holds its mutex until it actually
+        // sleeps, so the notification cannot be lost.
+        std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
+        psWorkerThread->m_cv.notify_one();
+    }
+}
+
+/************************************************************************/
+/*                             SubmitJob()                              */
+/************************************************************************/
+
+/** Queue a new job.
+ *
+ * When called from a job running in this pool, the new job is queued in
+ * the queue of the current worker thread if there are waiting threads that
+ * can steal it, or executed synchronously otherwise.
+ *
+ * @param pfnFunc Function to run for the job.
+ * @param pData User data to pass to the job function.
+ * @return true in case of success.
+ */
+bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
+{
+    CPLAssert(m_nMaxThreads > 0);
 
+    if (threadLocalCurrentThreadPool == this)
+    {
+        // If there are waiting threads or we have not started all allowed
+        // threads, we can submit this job asynchronously
+        bool bAsync;
         {
-            std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-            oGuard.unlock();
-            psWorkerThread->m_cv.notify_one();
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            bAsync = nWaitingWorkerThreads > 0 ||
+                     static_cast<int>(aWT.size()) < m_nMaxThreads;
         }
-
-        CPLFree(psToFree);
+        if (!bAsync)
+        {
+            // otherwise there is a risk of deadlock, so execute synchronously.
+            pfnFunc(pData);
+            return true;
+        }
+        return QueueJobs(pfnFunc, &pData, 1, true);
     }
 
-    return true;
+    return QueueJobs(pfnFunc, &pData, 1, false);
 }
 
 /************************************************************************/
@@ -270,111 +311,10 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
         return true;
     }
 
-    std::unique_lock<std::mutex> oGuard(m_mutex);
-
-    CPLList *psJobQueueInit = psJobQueue;
-    bool bRet = true;
-
-    for (size_t i = 0; i < apData.size(); i++)
-    {
-        if (static_cast<int>(aWT.size()) < m_nMaxThreads)
-        {
-            std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-            wt->pfnInitFunc = nullptr;
-            wt->pInitData = nullptr;
-            wt->poTP = this;
-            wt->bMarkedAsWaiting = false;
-            wt->hThread =
-                CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-            if (wt->hThread == nullptr)
-            {
-                if (aWT.empty())
-                    return false;
-            }
-            else
-            {
-                aWT.emplace_back(std::move(wt));
-            }
-        }
-
-        CPLWorkerThreadJob *psJob = static_cast<CPLWorkerThreadJob *>(
-            VSI_MALLOC_VERBOSE(sizeof(CPLWorkerThreadJob)));
-        if (psJob == nullptr)
-        {
-            bRet = false;
-            break;
-        }
-        psJob->pfnFunc = pfnFunc;
-        psJob->pData = apData[i];
-
-        CPLList *psItem =
-            static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-        if (psItem == nullptr)
-        {
-            VSIFree(psJob);
-            bRet = false;
-            break;
-        }
-        psItem->pData = psJob;
-
-        psItem->psNext = psJobQueue;
-        psJobQueue = psItem;
-        nPendingJobs++;
-    }
-
-    if (!bRet)
-    {
-        for (CPLList *psIter = psJobQueue; psIter != psJobQueueInit;)
-        {
-            CPLList *psNext = psIter->psNext;
-            VSIFree(psIter->pData);
-            VSIFree(psIter);
-            nPendingJobs--;
-            psIter = psNext;
-        }
-        return false;
-    }
-
-    for (size_t i = 0; i < apData.size(); i++)
-    {
-        if (psWaitingWorkerThreadsList && psJobQueue)
-        {
-            CPLWorkerThread *psWorkerThread;
-
-            psWorkerThread = static_cast<CPLWorkerThread *>(
-                psWaitingWorkerThreadsList->pData);
-
-            CPLAssert(psWorkerThread->bMarkedAsWaiting);
-            psWorkerThread->bMarkedAsWaiting = false;
-
-            CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-            CPLList *psToFree = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psNext;
-            nWaitingWorkerThreads--;
-
-            // CPLAssert(
-            //    CPLListCount(psWaitingWorkerThreadsList) ==
-            //    nWaitingWorkerThreads);
-
-#if DEBUG_VERBOSE
-            CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-            {
-                std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-                oGuard.unlock();
-                psWorkerThread->m_cv.notify_one();
-            }
-
-            CPLFree(psToFree);
-            oGuard.lock();
-        }
-        else
-        {
-            break;
-        }
-    }
+    if (apData.empty())
+        return true;
 
-    return true;
+    return QueueJobs(pfnFunc, apData.data(), apData.size(), false);
 }
 
 /************************************************************************/
@@ -392,10 +332,12 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    m_nWaitersForJobCompletion++;
     while (nPendingJobs > nMaxRemainingJobs)
     {
         m_cv.wait(oGuard);
     }
+    m_nWaitersForJobCompletion--;
 }
 
 /************************************************************************/
@@ -407,6 +349,7 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
 void CPLWorkerThreadPool::WaitEvent()
 {
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    m_nWaitersForJobCompletion++;
     while (true)
     {
         const int nPendingJobsBefore = nPendingJobs;
@@ -421,6 +364,7 @@ void CPLWorkerThreadPool::WaitEvent()
             break;
         }
     }
+    m_nWaitersForJobCompletion--;
 }
 
 /************************************************************************/
@@ -465,25 +409,19 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
     }
 
     bool bRet = true;
-    for (int i = static_cast<int>(aWT.size()); i < nThreads; i++)
     {
-        std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-        wt->pfnInitFunc = pfnInitFunc;
-        wt->pInitData = pasInitData ? pasInitData[i] : nullptr;
-        wt->poTP = this;
-        wt->bMarkedAsWaiting = false;
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        if (wt->hThread == nullptr)
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        for (int i = static_cast<int>(aWT.size()); i < nThreads; i++)
         {
-            nThreads = i;
-            bRet = false;
-            break;
+            if (!StartNewWorkerThread(pfnInitFunc,
+                                      pasInitData ? pasInitData[i] : nullptr))
+            {
+                nThreads = i;
+                bRet = false;
+                break;
+            }
         }
-        aWT.emplace_back(std::move(wt));
-    }
 
-    {
-        std::lock_guard<std::mutex> oGuard(m_mutex);
         if (nThreads > m_nMaxThreads)
             m_nMaxThreads = nThreads;
     }
@@ -510,65 +448,122 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 
 void CPLWorkerThreadPool::DeclareJobFinished()
 {
-    std::lock_guard<std::mutex> oGuard(m_mutex);
     nPendingJobs--;
-    m_cv.notify_one();
+    // Only take the pool mutex if a thread is waiting in WaitCompletion()
+    // or WaitEvent(). Those increment m_nWaitersForJobCompletion before
+    // checking nPendingJobs, so the notification cannot be lost.
+    if (m_nWaitersForJobCompletion > 0)
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_cv.notify_all();
+    }
 }
 
 /************************************************************************/
-/*                             GetNextJob()                             */
+/*                               PopJob()                               */
 /************************************************************************/
 
-CPLWorkerThreadJob *
-CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
+// Get a job from the queue of index nFirstQueueIdx, or steal one from the
+// other queues if it is empty.
+bool CPLWorkerThreadPool::PopJob(int nFirstQueueIdx, CPLWorkerThreadJob &sJob)
 {
-    while (true)
+    if (m_nQueuedJobs <= 0)
+        return false;
+
+    const int nJobQueues = m_nJobQueues;
+    for (int i = 0; i < nJobQueues; i++)
     {
-        std::unique_lock<std::mutex> oGuard(m_mutex);
-        if (eState == CPLWTS_STOP)
+        auto &oQueue = m_aoJobQueues[(nFirstQueueIdx + i) % nJobQueues];
+        std::lock_guard<std::mutex> oGuard(oQueue.m_mutex);
+        if (!oQueue.m_aoJobs.empty())
         {
-            return nullptr;
+            sJob = oQueue.m_aoJobs.front();
+            oQueue.m_aoJobs.pop_front();
+            m_nQueuedJobs--;
+            return true;
         }
-        CPLList *psTopJobIter = psJobQueue;
-        if (psTopJobIter)
-        {
-            psJobQueue = psTopJobIter->psNext;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                           RunPendingJob()                            */
+/************************************************************************/
+
+// Run a queued job in the current thread, if there is one that a worker
+// thread that has just been woken up is not about to pick.
+bool CPLWorkerThreadPool::RunPendingJob()
+{
+    if (m_nQueuedJobs <= m_nWokenUpWorkerThreads)
+        return false;
+
+    CPLWorkerThread *psWorkerThread = threadLocalCurrentWorkerThread;
+    CPLWorkerThreadJob sJob;
+    if (!PopJob(psWorkerThread && psWorkerThread->poTP == this
+                    ? psWorkerThread->nQueueIdx
+                    : 0,
+                sJob))
+    {
+        return false;
+    }
+    if (sJob.pfnFunc)
+    {
+        // Job run by a thread waiting for the completion of the queue
+        CPLTraceSpan oSpan("threadpool", "job (from waiting thread)");
+        sJob.pfnFunc(sJob.pData);
+    }
+    DeclareJobFinished();
+    return true;
+}
+
+/************************************************************************/
+/*                             GetNextJob()                             */
+/************************************************************************/
 
+bool CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread,
+                                     CPLWorkerThreadJob &sJob)
+{
+    while (true)
+    {
+        const bool bGotJob = PopJob(psWorkerThread->nQueueIdx, sJob);
+        if (psWorkerThread->bWokenUp.exchange(false))
+            m_nWokenUpWorkerThreads--;
+        if (bGotJob)
+        {
 #if DEBUG_VERBOSE
             CPLDebug("JOB", "%p got a job", psWorkerThread);
 #endif
-            CPLWorkerThreadJob *psJob =
-                static_cast<CPLWorkerThreadJob *>(psTopJobIter->pData);
-            CPLFree(psTopJobIter);
-            return psJob;
+            return true;
+        }
+
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        if (eState == CPLWTS_STOP)
+        {
+            return false;
         }
 
         if (!psWorkerThread->bMarkedAsWaiting)
         {
             psWorkerThread->bMarkedAsWaiting = true;
+            m_apoWaitingWorkerThreads.push_back(psWorkerThread);
             nWaitingWorkerThreads++;
+        }
 
-            CPLList *psItem =
-                static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-            if (psItem == nullptr)
-            {
-                eState = CPLWTS_ERROR;
-                m_cv.notify_one();
-
-                return nullptr;
-            }
-
-            psItem->pData = psWorkerThread;
-            psItem->psNext = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psItem;
-
-#if DEBUG_VERBOSE
-            CPLAssert(CPLListCount(psWaitingWorkerThreadsList) ==
-                      nWaitingWorkerThreads);
-#endif
+        // Jobs may have been queued after PopJob() failed, by a thread that
+        // did not see us as waiting yet. As we incremented
+        // nWaitingWorkerThreads before reading m_nQueuedJobs, and QueueJobs()
+        // does the reverse, such jobs are seen here.
+        if (m_nQueuedJobs > 0)
+        {
+            psWorkerThread->bMarkedAsWaiting = false;
+            m_apoWaitingWorkerThreads.erase(
+                std::find(m_apoWaitingWorkerThreads.begin(),
+                          m_apoWaitingWorkerThreads.end(), psWorkerThread));
+            nWaitingWorkerThreads--;
+            continue;
         }
 
-        m_cv.notify_one();
+        m_cv.notify_all();
 
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p sleeping", psWorkerThread);
@@ -691,6 +686,27 @@ bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
     std::unique_lock<std::mutex> oGuard(m_mutex);
+
+    if (threadLocalCurrentThreadPool == m_poPool)
+    {
+        // We are in a job of the pool that submitted nested jobs. Rather than
+        // blocking this worker thread, which could exhaust the pool and
+        // deadlock, help running queued jobs until ours are completed.
+        while (m_nPendingJobs > nMaxRemainingJobs)
+        {
+            oGuard.unlock();
+            const bool bRanJob = m_poPool->RunPendingJob();
+            oGuard.lock();
+            if (!bRanJob && m_nPendingJobs > nMaxRemainingJobs)
+            {
+                // Our remaining jobs are running in other threads. Wake up
+                // regularly in case new jobs are queued in the meantime.
+                m_cv.wait_for(oGuard, std::chrono::milliseconds(10));
+            }
+        }
+        return;
+    }
+
     // coverity[missing_lock:FALSE]
     while (m_nPendingJobs > nMaxRemainingJobs)
     {
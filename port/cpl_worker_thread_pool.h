@@ -33,7 +33,9 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -46,9 +48,22 @@
  */
 
 #ifndef DOXYGEN_SKIP
-struct CPLWorkerThreadJob;
 class CPLWorkerThreadPool;
 
+struct CPLWorkerThreadJob
+{
+    CPLThreadFunc pfnFunc = nullptr;
+    void *pData = nullptr;
+};
+
+/** Queue of jobs, owned by a worker thread, from which other worker threads
+ * can steal jobs when their own queue is empty. */
+struct CPLWorkerThreadJobQueue
+{
+    std::mutex m_mutex{};
+    std::deque<CPLWorkerThreadJob> m_aoJobs{};
+};
+
 struct CPLWorkerThread
 {
     CPL_DISALLOW_COPY_ASSIGN(CPLWorkerThread)
@@ -59,6 +74,8 @@ struct CPLWorkerThread
     CPLWorkerThreadPool *poTP = nullptr;
     CPLJoinableThread *hThread = nullptr;
     bool bMarkedAsWaiting = false;
+    std::atomic<bool> bWokenUp{false};
+    int nQueueIdx = 0;
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
@@ -79,22 +96,40 @@ class CPL_DLL CPLWorkerThreadPool
 {
     CPL_DISALLOW_COPY_ASSIGN(CPLWorkerThreadPool)
 
+    /** Maximum number of job queues. Worker threads beyond that number share
+     * the queue of a previous worker thread. */
+    static constexpr int MAX_JOB_QUEUES = 64;
+
     std::vector<std::unique_ptr<CPLWorkerThread>> aWT{};
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    CPLList *psJobQueue = nullptr;
-    int nPendingJobs = 0;
 
-    CPLList *psWaitingWorkerThreadsList = nullptr;
-    int nWaitingWorkerThreads = 0;
+    CPLWorkerThreadJobQueue m_aoJobQueues[MAX_JOB_QUEUES]{};
+    std::atomic<int> m_nJobQueues{0};
+    std::atomic<int> m_nQueuedJobs{0};
+    std::atomic<unsigned> m_nNextJobQueue{0};
+    std::atomic<int> nPendingJobs{0};
+    std::atomic<int> m_nWaitersForJobCompletion{0};
+
+    std::vector<CPLWorkerThread *> m_apoWaitingWorkerThreads{};
+    std::atomic<int> nWaitingWorkerThreads{0};
+    std::atomic<int> m_nWokenUpWorkerThreads{0};
 
     int m_nMaxThreads = 0;
 
     static void WorkerThreadFunction(void *user_data);
 
+    bool StartNewWorkerThread(CPLThreadFunc pfnInitFunc, void *pInitData);
+    bool QueueJobs(CPLThreadFunc pfnFunc, void *const *papData, size_t nJobs,
+                   bool bNested);
+    void WakeUpWaitingWorkerThreads(int nCount);
+    bool PopJob(int nFirstQueueIdx, CPLWorkerThreadJob &sJob);
+    bool RunPendingJob();
     void DeclareJobFinished();
-    CPLWorkerThreadJob *GetNextJob(CPLWorkerThread *psWorkerThread);
+    bool GetNextJob(CPLWorkerThread *psWorkerThread, CPLWorkerThreadJob &sJob);
+
+    friend class CPLJobQueue;
 
   public:
     CPLWorkerThreadPool();
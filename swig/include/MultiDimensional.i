@@ -681,6 +681,93 @@ public:
 
     return eErr;
   }
+
+%apply (int nList, GUIntBig* pList) {(int nPointIndices, GUIntBig *point_indices)};
+  CPLErr Drill( int dim_idx,
+                int nPoints,
+                int nPointIndices, GUIntBig* point_indices,
+                GUIntBig start_idx,
+                GUIntBig count,
+                GDALExtendedDataTypeHS* buffer_datatype,
+                void **buf,
+                char** options = 0 ) {
+    *buf = NULL;
+
+    const int nExpectedDims = (int)GDALMDArrayGetDimensionCount(self);
+    if( dim_idx < 0 || dim_idx >= nExpectedDims )
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Invalid dim_idx");
+        return CE_Failure;
+    }
+    if( nPoints < 0 ||
+        (GUIntBig)nPointIndices != (GUIntBig)nPoints * (nExpectedDims - 1) )
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Wrong number of values in point_indices");
+        return CE_Failure;
+    }
+    if( GDALExtendedDataTypeGetClass(buffer_datatype) != GEDTC_NUMERIC )
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Only numeric buffer data types are supported");
+        return CE_Failure;
+    }
+    const size_t count_internal = (size_t)count;
+    if( count_internal != count )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Integer overflow");
+        return CE_Failure;
+    }
+    const size_t nDTSize = GDALExtendedDataTypeGetSize(buffer_datatype);
+    if( count_internal != 0 &&
+        (size_t)nPoints > std::numeric_limits<size_t>::max() / count_internal / nDTSize )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Integer overflow");
+        return CE_Failure;
+    }
+    const size_t buf_size = (size_t)nPoints * count_internal * nDTSize;
+
+    SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+    *buf = (void *)PyByteArray_FromStringAndSize( NULL, buf_size );
+    if (*buf == NULL)
+    {
+        *buf = Py_None;
+        if( !GetUseExceptions() )
+        {
+            PyErr_Clear();
+        }
+        SWIG_PYTHON_THREAD_END_BLOCK;
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate result buffer");
+        return CE_Failure;
+    }
+    char *data = PyByteArray_AsString( (PyObject *)*buf );
+    SWIG_PYTHON_THREAD_END_BLOCK;
+
+    if( buf_size == 0 )
+    {
+        return CE_None;
+    }
+
+    CPLErr eErr = GDALMDArrayDrill( self,
+                                    dim_idx,
+                                    nPoints,
+                                    point_indices,
+                                    start_idx,
+                                    count_internal,
+                                    buffer_datatype,
+                                    data,
+                                    options ) ? CE_None : CE_Failure;
+    if (eErr == CE_Failure)
+    {
+        SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+        Py_DECREF((PyObject*)*buf);
+        SWIG_PYTHON_THREAD_END_BLOCK;
+        *buf = NULL;
+    }
+
+    return eErr;
+  }
+%clear (int nPointIndices, GUIntBig *point_indices);
 %clear (void **buf );
 
   CPLErr WriteStringArray( int nDims1, GUIntBig* array_start_idx,
@@ -214,6 +214,8 @@ void CPL_STDCALL PyCPLErrorHandler(CPLErr eErrClass, CPLErrorNum err_no, const c
 %rename (HasThreadSupport) wrapper_HasThreadSupport;
 %rename (NetworkStatsReset) VSINetworkStatsReset;
 %rename (NetworkStatsGetAsSerializedJSON) VSINetworkStatsGetAsSerializedJSON;
+%rename (MemoryAccountingResetHighWaterMarks) VSIMemoryAccountingResetHighWaterMarks;
+%rename (MemoryAccountingGetAsSerializedJSON) VSIMemoryAccountingGetAsSerializedJSON;
 
 %apply Pointer NONNULL {const char *pszScope};
 retStringAndCPLFree*
@@ -929,9 +931,33 @@ int     VSIFWriteL( const char *, int, int, VSILFILE *fp );
 void VSICurlClearCache();
 void VSICurlPartialClearCache( const char* utf8_path );
 
+#if defined(SWIGPYTHON)
+%rename (VSICurlPrimeCache) wrapper_VSICurlPrimeCache;
+%apply (char **options) {char **filenames};
+%apply (int nList, GUIntBig* pList) {(int nSizes, GUIntBig *sizes)};
+%inline {
+int wrapper_VSICurlPrimeCache( const char* utf8_path, char** filenames,
+                               int nSizes, GUIntBig *sizes )
+{
+    if( nSizes != 0 && nSizes != CSLCount(filenames) )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "sizes should be empty or have the same number of elements as filenames");
+        return FALSE;
+    }
+    return VSICurlPrimeCache(utf8_path, filenames, nSizes ? sizes : NULL);
+}
+}
+%clear char **filenames;
+%clear (int nSizes, GUIntBig *sizes);
+#endif
+
 void VSINetworkStatsReset();
 retStringAndCPLFree* VSINetworkStatsGetAsSerializedJSON( char** options = NULL );
 
+void VSIMemoryAccountingResetHighWaterMarks();
+retStringAndCPLFree* VSIMemoryAccountingGetAsSerializedJSON( char** options = NULL );
+
 #endif /* !defined(SWIGJAVA) */
 
 %apply (char **CSL) {char **};
@@ -883,6 +883,110 @@ retStringAndCPLFree* GetArrayFilename(PyArrayObject *psArray)
 %}
 %clear (int band_list, int *pband_list );
 
+%feature( "kwargs" ) BandReadMultiWindowNumPy;
+%inline %{
+  CPLErr BandReadMultiWindowNumPy( GDALRasterBandShadow* band,
+                                   PyObject* windows,
+                                   PyObject* arrays,
+                                   GDALDataType buf_type,
+                                   GDALRIOResampleAlg resample_alg )
+{
+    /* The GIL has been released by the wrapper: take it only to collect */
+    /* the windows and arrays, and keep a reference to the arrays while */
+    /* reading into them. */
+    std::vector<GDALRasterIOWindow> asWindows;
+    std::vector<PyObject*> apoArrays;
+    bool bOK = true;
+
+    SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+    const Py_ssize_t nCount = PySequence_Check(windows) &&
+                              PySequence_Check(arrays) ?
+                                PySequence_Size(windows) : -1;
+    if( nCount < 0 || nCount > INT_MAX || PySequence_Size(arrays) != nCount )
+    {
+        PyErr_Clear();
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "windows and arrays should be sequences of the same size");
+        bOK = false;
+    }
+    for( Py_ssize_t i = 0; bOK && i < nCount; ++i )
+    {
+        GDALRasterIOWindow sWindow;
+        memset(&sWindow, 0, sizeof(sWindow));
+        PyObject* poWindow = PySequence_GetItem(windows, i);
+        if( !poWindow ||
+            !PyArg_ParseTuple(poWindow, "iiii", &sWindow.nXOff, &sWindow.nYOff,
+                              &sWindow.nXSize, &sWindow.nYSize) )
+        {
+            PyErr_Clear();
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Window %d should be a (xoff, yoff, xsize, ysize) tuple",
+                     static_cast<int>(i));
+            bOK = false;
+        }
+        Py_XDECREF(poWindow);
+        if( !bOK )
+            break;
+
+        PyObject* poArray = PySequence_GetItem(arrays, i);
+        if( !poArray || !PyArray_Check(poArray) ||
+            PyArray_NDIM((PyArrayObject*)poArray) != 2 )
+        {
+            PyErr_Clear();
+            Py_XDECREF(poArray);
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Array %d should be a numpy array of dimension 2",
+                     static_cast<int>(i));
+            bOK = false;
+            break;
+        }
+        apoArrays.push_back(poArray);
+        PyArrayObject* psArray = (PyArrayObject*)poArray;
+        if( !(PyArray_FLAGS(psArray) & NPY_ARRAY_WRITEABLE) )
+        {
+            CPLError( CE_Failure, CPLE_AppDefined,
+                      "Cannot read in a non-writeable array." );
+            bOK = false;
+            break;
+        }
+        if( PyArray_DIMS(psArray)[0] > INT_MAX ||
+            PyArray_DIMS(psArray)[1] > INT_MAX )
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                        "Too big array dimensions");
+            bOK = false;
+            break;
+        }
+        sWindow.pData = PyArray_DATA(psArray);
+        sWindow.nBufXSize = static_cast<int>(PyArray_DIMS(psArray)[1]);
+        sWindow.nBufYSize = static_cast<int>(PyArray_DIMS(psArray)[0]);
+        sWindow.nPixelSpace = PyArray_STRIDES(psArray)[1];
+        sWindow.nLineSpace = PyArray_STRIDES(psArray)[0];
+        asWindows.push_back(sWindow);
+    }
+    SWIG_PYTHON_THREAD_END_BLOCK;
+
+    CPLErr eErr = CE_Failure;
+    if( bOK )
+    {
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        sExtraArg.eResampleAlg = resample_alg;
+        eErr = GDALRasterReadMultiWindow( band,
+                                          static_cast<int>(asWindows.size()),
+                                          asWindows.data(), buf_type,
+                                          &sExtraArg );
+    }
+
+    SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+    for( PyObject* poArray: apoArrays )
+        Py_DECREF(poArray);
+    SWIG_PYTHON_THREAD_END_BLOCK;
+
+    return eErr;
+}
+%}
+
 %{
 static bool CheckNumericDataType(GDALExtendedDataTypeHS* dt)
 {
@@ -2726,6 +2830,59 @@ def BandReadAsArray(band, xoff=0, yoff=0, win_xsize=None, win_ysize=None,
 
     return buf_obj
 
+def BandReadMultiWindowAsArray(band, windows, buf_objs=None, buf_type=None,
+                               resample_alg=gdal.GRIORA_NearestNeighbour):
+    """Pure python implementation of reading several windows of a GDAL band
+    into numpy arrays.  Used by the gdal.Band.ReadMultiWindowAsArray method."""
+
+    windows = [tuple(_to_primitive_type(v) for v in window) for window in windows]
+    for window in windows:
+        if len(window) != 4:
+            raise ValueError("windows should be (xoff, yoff, xsize, ysize) tuples")
+
+    if buf_objs is None:
+        if buf_type is None:
+            buf_type = band.DataType
+
+        typecode = GDALTypeCodeToNumericTypeCode(buf_type)
+        if typecode is None:
+            buf_type = gdalconst.GDT_Float32
+            typecode = numpy.float32
+        else:
+            buf_type = NumericTypeCodeToGDALTypeCode(typecode)
+
+        if buf_type == gdalconst.GDT_Byte:
+            band._EnablePixelTypeSignedByteWarning(False)
+            if band.GetMetadataItem('PIXELTYPE', 'IMAGE_STRUCTURE') == 'SIGNEDBYTE':
+                typecode = numpy.int8
+            band._EnablePixelTypeSignedByteWarning(True)
+        buf_objs = [numpy.empty([window[3], window[2]], dtype=typecode)
+                    for window in windows]
+
+    else:
+        buf_objs = list(buf_objs)
+        if len(buf_objs) != len(windows):
+            raise ValueError("buf_objs should have as many arrays as windows")
+        datatype = None
+        for buf_obj in buf_objs:
+            if len(buf_obj.shape) != 2:
+                raise ValueError("expected arrays of dimension 2")
+            array_datatype = NumericTypeCodeToGDALTypeCode(buf_obj.dtype.type)
+            if not array_datatype:
+                raise ValueError("array does not have corresponding GDAL data type")
+            if datatype is not None and array_datatype != datatype:
+                raise ValueError("all arrays should have the same data type")
+            datatype = array_datatype
+        if buf_type is not None and datatype is not None and buf_type != datatype:
+            raise ValueError("Specified buf_type not consistent with array type")
+        buf_type = datatype if datatype is not None else gdalconst.GDT_Byte
+
+    if BandReadMultiWindowNumPy(band, windows, buf_objs, buf_type, resample_alg) != 0:
+        _RaiseException()
+        return None
+
+    return buf_objs
+
 def BandWriteArray(band, array, xoff=0, yoff=0,
                    resample_alg=gdal.GRIORA_NearestNeighbour,
                    callback=None, callback_data=None):
@@ -715,6 +715,60 @@ void wrapper_VSIGetMemFileBuffer(const char *utf8_path, GByte **out, vsi_l_offse
                                          callback=callback,
                                          callback_data=callback_data)
 
+  def ReadMultiWindowAsArray(self, windows, buf_objs=None, buf_type=None,
+                             resample_alg=gdalconst.GRIORA_NearestNeighbour):
+      """
+      Read several windows of this raster band into NumPy arrays, in a
+      single call.
+
+      This lets drivers fetch the data needed by all windows as a batch, for
+      example with a single multi-range request for a GeoTIFF file on a
+      network file system.
+
+      As the other I/O methods, this method releases the Python Global
+      Interpreter Lock (GIL) while reading, and reads directly into the
+      provided arrays, whatever their strides. Concurrent reads from several
+      Python threads can thus proceed in parallel, provided that each thread
+      uses its own dataset object.
+
+      .. versionadded:: 3.10
+
+      Parameters
+      ----------
+      windows : list
+           List of (xoff, yoff, xsize, ysize) tuples, with integer values.
+      buf_objs : list, optional
+           List of two-dimensional arrays, one per window, into which values
+           will be read, with the same data type. Their shape gives the size
+           of the buffer of each window. By default, arrays of the size of
+           the windows are allocated.
+      buf_type : int, optional
+           The data type of the returned arrays, when ``buf_objs`` is not
+           specified.
+      resample_alg : int, default = :py:const:`gdal.GRIORA_NearestNeighbour`.
+           Specifies the resampling algorithm to use when the size of
+           a window and of its buffer are not equal.
+
+      Returns
+      -------
+      list of np.ndarray
+
+      Examples
+      --------
+      >>> import numpy as np
+      >>> ds = gdal.GetDriverByName("MEM").Create("", 4, 4, eType=gdal.GDT_Float32)
+      >>> ds.WriteArray(np.arange(16).reshape(4, 4))
+      0
+      >>> band = ds.GetRasterBand(1)
+      >>> band.ReadMultiWindowAsArray([(0, 0, 2, 1), (2, 2, 2, 2)])
+      [array([[0., 1.]], dtype=float32), array([[10., 11.],
+             [14., 15.]], dtype=float32)]
+      """
+      from osgeo import gdal_array
+
+      return gdal_array.BandReadMultiWindowAsArray(self, windows, buf_objs,
+                                                   buf_type, resample_alg)
+
   def WriteArray(self, array, xoff=0, yoff=0,
                  resample_alg=gdalconst.GRIORA_NearestNeighbour,
                  callback=None,
@@ -1829,6 +1883,27 @@ def GetMDArrayNames(self, options = []) -> "list[str]":
       from osgeo import gdal_array
       return gdal_array.MDArrayReadAsArray(self, array_start_idx, count, array_step, buffer_datatype, buf_obj)
 
+  def Drill(self,
+            dim_idx,
+            points,
+            start_idx = 0,
+            count = None,
+            buffer_datatype = None,
+            options = []):
+      """Extract the values along dimension dim_idx at a set of points.
+
+      points is a sequence of tuples with the indices of each point in all
+      dimensions but dim_idx, in the order of GetDimensions().
+      The result is a bytearray of len(points) consecutive series of count
+      values.
+      """
+      if count is None:
+        count = self.GetDimensions()[dim_idx].GetSize() - start_idx
+      if not buffer_datatype:
+        buffer_datatype = self.GetDataType()
+      point_indices = [idx for point in points for idx in point]
+      return _gdal.MDArray_Drill(self, dim_idx, len(points), point_indices, start_idx, count, buffer_datatype, options)
+
   def AdviseRead(self, array_start_idx = None, count = None, options = []):
       if not array_start_idx:
         array_start_idx = [0] * self.GetDimensionCount()
@@ -4041,6 +4116,7 @@ def FootprintOptions(options=None,
                      combineBands=None,
                      srcNodata=None,
                      ovr=None,
+                     coarseOvr=None,
                      targetCoordinateSystem=None,
                      dstSRS=None,
                      splitPolys=None,
@@ -4071,6 +4147,9 @@ def FootprintOptions(options=None,
         source nodata value(s).
     ovr:
         overview index.
+    coarseOvr:
+        overview index of the coarse pass used to only polygonize at full
+        resolution the tiles near the boundary of the valid area.
     targetCoordinateSystem:
         "pixel" or "georef"
     dstSRS:
@@ -4131,6 +4210,8 @@ def FootprintOptions(options=None,
             new_options += ['-srcnodata', str(srcNodata)]
         if ovr is not None:
             new_options += ['-ovr', str(ovr)]
+        if coarseOvr is not None:
+            new_options += ['-coarse_ovr', str(coarseOvr)]
         if splitPolys:
             new_options += ["-split_polys"]
         if convexHull: